@@ -210,12 +210,12 @@ void arch_secondary_cpu_init(void)
 
 #ifdef CONFIG_SMP
 
-static void broadcast_ipi(unsigned int ipi)
+static void send_ipi(unsigned int ipi, uint32_t cpu_bitmap)
 {
 	uint32_t mpidr = MPIDR_TO_CORE(GET_MPIDR());
 
 	/*
-	 * Send SGI to all cores except itself
+	 * Send SGI to all cores in the bitmap except itself
 	 */
 	unsigned int num_cpus = arch_num_cpus();
 
@@ -223,6 +223,10 @@ static void broadcast_ipi(unsigned int ipi)
 		uint32_t target_mpidr = cpu_map[i];
 		uint8_t aff0;
 
+		if ((cpu_bitmap & BIT(i)) == 0) {
+			continue;
+		}
+
 		if (mpidr == target_mpidr || mpidr == INV_MPID) {
 			continue;
 		}
@@ -232,6 +236,11 @@ static void broadcast_ipi(unsigned int ipi)
 	}
 }
 
+static void broadcast_ipi(unsigned int ipi)
+{
+	send_ipi(ipi, BIT_MASK(CONFIG_MP_MAX_NUM_CPUS));
+}
+
 void sched_ipi_handler(const void *unused)
 {
 	ARG_UNUSED(unused);
@@ -245,6 +254,11 @@ void arch_sched_ipi(void)
 	broadcast_ipi(SGI_SCHED_IPI);
 }
 
+void arch_sched_directed_ipi(uint32_t cpu_bitmap)
+{
+	send_ipi(SGI_SCHED_IPI, cpu_bitmap);
+}
+
 int arch_smp_init(void)
 {
 	cpu_map[0] = MPIDR_TO_CORE(GET_MPIDR());
@@ -211,6 +211,7 @@ void z_arm_configure_dynamic_mpu_regions(struct k_thread *thread)
 	LOG_DBG("configure thread %p's domain", thread);
 	struct k_mem_domain *mem_domain = thread->mem_domain_info.mem_domain;
 
+#if !defined(CONFIG_ARM_MPU_DOMAIN_CACHE)
 	if (mem_domain) {
 		LOG_DBG("configure domain: %p", mem_domain);
 		uint32_t num_partitions = mem_domain->num_partitions;
@@ -243,6 +244,7 @@ void z_arm_configure_dynamic_mpu_regions(struct k_thread *thread)
 			}
 		}
 	}
+#endif /* !CONFIG_ARM_MPU_DOMAIN_CACHE */
 	/* Thread user stack */
 	LOG_DBG("configure user thread %p's context", thread);
 	if (thread->arch.priv_stack_start) {
@@ -312,6 +314,11 @@ void z_arm_configure_dynamic_mpu_regions(struct k_thread *thread)
 #endif /* CONFIG_MPU_STACK_GUARD */
 
 	/* Configure the dynamic MPU regions */
+#if defined(CONFIG_ARM_MPU_DOMAIN_CACHE)
+	arm_core_mpu_configure_cached_dynamic_mpu_regions(mem_domain,
+							  dynamic_regions,
+							  region_num);
+#else
 #ifdef CONFIG_AARCH32_ARMV8_R
 	arm_core_mpu_disable();
 #endif
@@ -320,6 +327,7 @@ void z_arm_configure_dynamic_mpu_regions(struct k_thread *thread)
 #ifdef CONFIG_AARCH32_ARMV8_R
 	arm_core_mpu_enable();
 #endif
+#endif /* CONFIG_ARM_MPU_DOMAIN_CACHE */
 }
 
 #if defined(CONFIG_USERSPACE)
@@ -343,4 +351,45 @@ int arch_buffer_validate(void *addr, size_t size, int write)
 	return arm_core_mpu_buffer_validate(addr, size, write);
 }
 
+#if defined(CONFIG_ARM_MPU_DOMAIN_CACHE)
+int arch_mem_domain_init(struct k_mem_domain *domain)
+{
+	domain->arch.valid = false;
+	return 0;
+}
+
+int arch_mem_domain_partition_add(struct k_mem_domain *domain,
+				  uint32_t partition_id)
+{
+	/* Compute the regions again when the domain is next programmed */
+	ARG_UNUSED(partition_id);
+	domain->arch.valid = false;
+	return 0;
+}
+
+int arch_mem_domain_partition_remove(struct k_mem_domain *domain,
+				     uint32_t partition_id)
+{
+	/* The partition is only cleared after this returns, which is fine
+	 * as the regions are computed again at the next context switch.
+	 */
+	ARG_UNUSED(partition_id);
+	domain->arch.valid = false;
+	return 0;
+}
+
+int arch_mem_domain_thread_add(struct k_thread *thread)
+{
+	/* The domain is programmed when the thread is next switched in */
+	ARG_UNUSED(thread);
+	return 0;
+}
+
+int arch_mem_domain_thread_remove(struct k_thread *thread)
+{
+	ARG_UNUSED(thread);
+	return 0;
+}
+#endif /* CONFIG_ARM_MPU_DOMAIN_CACHE */
+
 #endif /* CONFIG_USERSPACE */
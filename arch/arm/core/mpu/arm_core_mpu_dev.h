@@ -15,6 +15,7 @@ extern "C" {
 
 #if defined(CONFIG_ARM_MPU)
 struct k_thread;
+struct k_mem_domain;
 
 #if defined(CONFIG_USERSPACE)
 
@@ -188,6 +189,25 @@ void arm_core_mpu_configure_dynamic_mpu_regions(
 	const struct z_arm_mpu_partition *dynamic_regions,
 	uint8_t regions_num);
 
+#if defined(CONFIG_ARM_MPU_DOMAIN_CACHE)
+/**
+ * @brief configure dynamic MPU regions, caching those of a memory domain
+ *
+ * Like arm_core_mpu_configure_dynamic_mpu_regions(), with the regions of
+ * the memory domain programmed first. These are taken from the MPU
+ * register values cached in the domain, computed again if the domain
+ * has changed, and not programmed at all if they are already programmed.
+ *
+ * @param mem_domain memory domain of the thread, or NULL
+ * @param thread_regions an array of the other dynamic regions of the thread
+ * @param regions_num the number of other dynamic regions
+ */
+void arm_core_mpu_configure_cached_dynamic_mpu_regions(
+	struct k_mem_domain *mem_domain,
+	const struct z_arm_mpu_partition *thread_regions,
+	uint8_t regions_num);
+#endif /* CONFIG_ARM_MPU_DOMAIN_CACHE */
+
 #if defined(CONFIG_USERSPACE)
 /**
  * @brief update configuration of an active memory partition
@@ -394,6 +394,90 @@ void arm_core_mpu_configure_dynamic_mpu_regions(const struct z_arm_mpu_partition
 	}
 }
 
+#if defined(CONFIG_ARM_MPU_DOMAIN_CACHE)
+/* Memory domain whose regions are programmed right after the static
+ * regions, and index of the first MPU region following the dynamic
+ * regions of the current thread.
+ */
+static struct k_mem_domain *programmed_domain;
+static uint8_t dynamic_regions_end = UINT8_MAX;
+
+static void mem_domain_cache_update(struct k_mem_domain *domain)
+{
+	struct arch_mem_domain *cache = &domain->arch;
+	arm_mpu_region_attr_t attr;
+	uint8_t region_num = 0U;
+
+	for (int i = 0; i < CONFIG_MAX_DOMAIN_PARTITIONS; i++) {
+		struct k_mem_partition *partition = &domain->partitions[i];
+
+		if (partition->size == 0U) {
+			continue;
+		}
+
+		get_region_attr_from_mpu_partition_info(&attr,
+			&partition->attr, partition->start, partition->size);
+		cache->regions[region_num].rbar =
+			(partition->start & MPU_RBAR_ADDR_Msk) | MPU_RBAR_VALID_Msk;
+		cache->regions[region_num].rasr = attr.rasr | MPU_RASR_ENABLE_Msk;
+		region_num++;
+	}
+
+	cache->num_regions = region_num;
+	cache->valid = true;
+}
+
+/**
+ * @brief configure dynamic MPU regions using cached memory domain regions
+ */
+void arm_core_mpu_configure_cached_dynamic_mpu_regions(
+	struct k_mem_domain *mem_domain,
+	const struct z_arm_mpu_partition *thread_regions, uint8_t regions_num)
+{
+	int mpu_reg_index = static_regions_num;
+	uint8_t regions_end = MIN(dynamic_regions_end, get_num_regions());
+
+	if (mem_domain != NULL) {
+		struct arch_mem_domain *cache = &mem_domain->arch;
+
+		if (!cache->valid) {
+			mem_domain_cache_update(mem_domain);
+			programmed_domain = NULL;
+		}
+
+		if (mem_domain != programmed_domain) {
+			__ASSERT(mpu_reg_index + cache->num_regions <= get_num_regions(),
+				 "Out-of-bounds error for domain %p regions\n",
+				 mem_domain);
+
+			for (int i = 0; i < cache->num_regions; i++) {
+				MPU->RBAR = cache->regions[i].rbar | (mpu_reg_index + i);
+				MPU->RASR = cache->regions[i].rasr;
+			}
+			programmed_domain = mem_domain;
+		}
+
+		mpu_reg_index += cache->num_regions;
+	} else {
+		programmed_domain = NULL;
+	}
+
+	mpu_reg_index = mpu_configure_regions(thread_regions, regions_num,
+					      mpu_reg_index, false);
+	if (mpu_reg_index == -EINVAL) {
+		__ASSERT(0, "Configuring %u dynamic MPU regions failed\n",
+			regions_num);
+		return;
+	}
+
+	/* Disable the regions left over from the previous thread only */
+	for (int i = mpu_reg_index; i < regions_end; i++) {
+		ARM_MPU_ClrRegion(i);
+	}
+	dynamic_regions_end = mpu_reg_index;
+}
+#endif /* CONFIG_ARM_MPU_DOMAIN_CACHE */
+
 /* ARM MPU Driver Initial Setup */
 
 /*
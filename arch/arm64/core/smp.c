@@ -180,12 +180,12 @@ void arch_secondary_cpu_init(int cpu_num)
 
 #ifdef CONFIG_SMP
 
-static void broadcast_ipi(unsigned int ipi)
+static void send_ipi(unsigned int ipi, uint32_t cpu_bitmap)
 {
 	uint64_t mpidr = MPIDR_TO_CORE(GET_MPIDR());
 
 	/*
-	 * Send SGI to all cores except itself
+	 * Send SGI to all cores in the bitmap except itself
 	 */
 	unsigned int num_cpus = arch_num_cpus();
 
@@ -193,6 +193,10 @@ static void broadcast_ipi(unsigned int ipi)
 		uint64_t target_mpidr = cpu_map[i];
 		uint8_t aff0;
 
+		if ((cpu_bitmap & BIT(i)) == 0) {
+			continue;
+		}
+
 		if (mpidr == target_mpidr || target_mpidr == INV_MPID) {
 			continue;
 		}
@@ -202,6 +206,11 @@ static void broadcast_ipi(unsigned int ipi)
 	}
 }
 
+static void broadcast_ipi(unsigned int ipi)
+{
+	send_ipi(ipi, BIT_MASK(CONFIG_MP_MAX_NUM_CPUS));
+}
+
 void sched_ipi_handler(const void *unused)
 {
 	ARG_UNUSED(unused);
@@ -215,6 +224,11 @@ void arch_sched_ipi(void)
 	broadcast_ipi(SGI_SCHED_IPI);
 }
 
+void arch_sched_directed_ipi(uint32_t cpu_bitmap)
+{
+	send_ipi(SGI_SCHED_IPI, cpu_bitmap);
+}
+
 #ifdef CONFIG_USERSPACE
 void mem_cfg_ipi_handler(const void *unused)
 {
@@ -48,6 +48,19 @@ const struct device *z_get_sw_isr_device_from_irq(unsigned int irq);
  */
 unsigned int z_get_sw_isr_irq_from_device(const struct device *dev);
 
+/**
+ * @brief Helper function used to get the entries of the passed in parent interrupt
+ * controller device in _sw_isr_table.
+ *
+ * The entries of the lines of an aggregator are contiguous, so that it can call
+ * the ISR of its local IRQ n from the n-th entry, without any lookup on the way.
+ *
+ * @param dev parent interrupt controller device
+ *
+ * @return first entry of the interrupt controller, or NULL if it is not an aggregator
+ */
+struct _isr_table_entry *z_get_sw_isr_table_from_device(const struct device *dev);
+
 #ifdef __cplusplus
 }
 #endif
@@ -141,6 +141,35 @@ unsigned int z_get_sw_isr_irq_from_device(const struct device *dev)
 	return 0;
 }
 
+struct _isr_table_entry *z_get_sw_isr_table_from_device(const struct device *dev)
+{
+	unsigned int offset = 0U;
+
+	for (size_t i = 0U; i < CONFIG_NUM_2ND_LEVEL_AGGREGATORS; ++i) {
+		if (_lvl2_irq_list[i].dev == dev) {
+			offset = _lvl2_irq_list[i].offset;
+			break;
+		}
+	}
+
+#ifdef CONFIG_3RD_LEVEL_INTERRUPTS
+	for (size_t i = 0U; (offset == 0U) && (i < CONFIG_NUM_3RD_LEVEL_AGGREGATORS); ++i) {
+		if (_lvl3_irq_list[i].dev == dev) {
+			offset = _lvl3_irq_list[i].offset;
+			break;
+		}
+	}
+#endif /* CONFIG_3RD_LEVEL_INTERRUPTS */
+
+	if (offset == 0U) {
+		return NULL;
+	}
+
+	__ASSERT_NO_MSG((offset - CONFIG_GEN_IRQ_START_VECTOR) < IRQ_TABLE_SIZE);
+
+	return &_sw_isr_table[offset - CONFIG_GEN_IRQ_START_VECTOR];
+}
+
 unsigned int z_get_sw_isr_table_idx(unsigned int irq)
 {
 	unsigned int table_idx, level, parent_irq, local_irq, parent_offset;
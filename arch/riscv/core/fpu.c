@@ -334,6 +334,10 @@ int arch_float_disable(struct k_thread *thread)
 #endif
 
 		arch_irq_unlock(key);
+
+#ifdef CONFIG_RISCV_VECTOR_SHARING
+		z_riscv_vector_disable(thread);
+#endif
 	}
 
 	return 0;
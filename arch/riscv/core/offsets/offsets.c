@@ -87,6 +87,16 @@ GEN_OFFSET_SYM(_thread_arch_t, exception_depth);
 
 #endif /* CONFIG_FPU_SHARING */
 
+#if defined(CONFIG_RISCV_VECTOR_SHARING)
+
+GEN_OFFSET_SYM(z_riscv_vector_context_t, vstart);
+GEN_OFFSET_SYM(z_riscv_vector_context_t, vl);
+GEN_OFFSET_SYM(z_riscv_vector_context_t, vtype);
+GEN_OFFSET_SYM(z_riscv_vector_context_t, vcsr);
+GEN_OFFSET_SYM(z_riscv_vector_context_t, v);
+
+#endif /* CONFIG_RISCV_VECTOR_SHARING */
+
 /* esf member offsets */
 GEN_OFFSET_SYM(z_arch_esf_t, ra);
 GEN_OFFSET_SYM(z_arch_esf_t, t0);
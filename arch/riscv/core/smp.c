@@ -85,15 +85,17 @@ void arch_secondary_cpu_init(int hartid)
 static atomic_val_t cpu_pending_ipi[CONFIG_MP_MAX_NUM_CPUS];
 #define IPI_SCHED	0
 #define IPI_FPU_FLUSH	1
+#define IPI_VECTOR_FLUSH	2
 
-void arch_sched_ipi(void)
+void arch_sched_directed_ipi(uint32_t cpu_bitmap)
 {
 	unsigned int key = arch_irq_lock();
 	unsigned int id = _current_cpu->id;
 	unsigned int num_cpus = arch_num_cpus();
 
 	for (unsigned int i = 0; i < num_cpus; i++) {
-		if (i != id && _kernel.cpus[i].arch.online) {
+		if ((i != id) && _kernel.cpus[i].arch.online &&
+		    ((cpu_bitmap & BIT(i)) != 0)) {
 			atomic_set_bit(&cpu_pending_ipi[i], IPI_SCHED);
 			MSIP(_kernel.cpus[i].arch.hartid) = 1;
 		}
@@ -102,6 +104,11 @@ void arch_sched_ipi(void)
 	arch_irq_unlock(key);
 }
 
+void arch_sched_ipi(void)
+{
+	arch_sched_directed_ipi(BIT_MASK(CONFIG_MP_MAX_NUM_CPUS));
+}
+
 #ifdef CONFIG_FPU_SHARING
 void arch_flush_fpu_ipi(unsigned int cpu)
 {
@@ -110,6 +117,14 @@ void arch_flush_fpu_ipi(unsigned int cpu)
 }
 #endif
 
+#ifdef CONFIG_RISCV_VECTOR_SHARING
+void z_riscv_flush_vector_ipi(unsigned int cpu)
+{
+	atomic_set_bit(&cpu_pending_ipi[cpu], IPI_VECTOR_FLUSH);
+	MSIP(_kernel.cpus[cpu].arch.hartid) = 1;
+}
+#endif
+
 static void sched_ipi_handler(const void *unused)
 {
 	ARG_UNUSED(unused);
@@ -129,10 +144,16 @@ static void sched_ipi_handler(const void *unused)
 		arch_flush_local_fpu();
 		/*
 		 * No need to re-enable IRQs here as long as
-		 * this remains the last case.
+		 * this and the vector flush remain the last cases.
 		 */
 	}
 #endif
+#ifdef CONFIG_RISCV_VECTOR_SHARING
+	if (pending_ipi & ATOMIC_MASK(IPI_VECTOR_FLUSH)) {
+		csr_clear(mstatus, MSTATUS_IEN);
+		z_riscv_flush_local_vector();
+	}
+#endif
 }
 
 #ifdef CONFIG_FPU_SHARING
@@ -154,6 +175,11 @@ void arch_spin_relax(void)
 		 */
 		arch_float_disable(_current_cpu->arch.fpu_owner);
 	}
+#ifdef CONFIG_RISCV_VECTOR_SHARING
+	if (atomic_test_and_clear_bit(pending_ipi, IPI_VECTOR_FLUSH)) {
+		z_riscv_vector_disable(_current_cpu->arch.vector_owner);
+	}
+#endif
 }
 #endif
 
@@ -72,6 +72,10 @@ void arch_new_thread(struct k_thread *thread, k_thread_stack_t *stack,
 	/* Unshared FP mode: enable FPU of each thread. */
 	stack_init->mstatus |= MSTATUS_FS_INIT;
 #endif
+#if defined(CONFIG_RISCV_ISA_EXT_V) && !defined(CONFIG_RISCV_VECTOR_SHARING)
+	/* Unshared vector mode: enable the vector unit of each thread. */
+	stack_init->mstatus |= MSTATUS_VS_INIT;
+#endif
 
 #if defined(CONFIG_USERSPACE)
 	/* Clear user thread context */
@@ -0,0 +1,269 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Lazy context switching of the vector registers, on the model of the
+ * FPU sharing in fpu.c: the vector unit of a CPU is owned by the last
+ * thread that used it there, and is disabled for other threads until
+ * their first vector instruction traps.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/kernel_structs.h>
+#include <kernel_arch_interface.h>
+#include <zephyr/sys/atomic.h>
+
+/* to be found in vector.S */
+extern void z_riscv_vector_save(struct z_riscv_vector_context *saved_vector_context);
+extern void z_riscv_vector_restore(struct z_riscv_vector_context *saved_vector_context);
+
+static void vector_disable(void)
+{
+	unsigned long status = csr_read(mstatus);
+
+	__ASSERT((status & MSTATUS_IEN) == 0, "must be called with IRQs disabled");
+
+	if ((status & MSTATUS_VS) != 0) {
+		csr_clear(mstatus, MSTATUS_VS);
+
+		/* remember its clean/dirty state */
+		_current_cpu->arch.vector_state = (status & MSTATUS_VS);
+	}
+}
+
+static void vector_load(void)
+{
+	__ASSERT((csr_read(mstatus) & MSTATUS_IEN) == 0,
+		 "must be called with IRQs disabled");
+	__ASSERT((csr_read(mstatus) & MSTATUS_VS) == 0,
+		 "must be called with vector access disabled");
+
+	/* become new owner */
+	atomic_ptr_set(&_current_cpu->arch.vector_owner, _current);
+
+	/* restore our content */
+	csr_set(mstatus, MSTATUS_VS_INIT);
+	__ASSERT(csr_read(vlenb) <= CONFIG_RISCV_VECTOR_VLEN / 8,
+		 "CONFIG_RISCV_VECTOR_VLEN is lower than the CPU VLEN");
+	z_riscv_vector_restore(&_current->arch.saved_vector_context);
+}
+
+/*
+ * Flush the vector registers and clear ownership. If the saved state is
+ * "clean" then the in-memory copy is up to date and the transfer skipped.
+ * As with the FPU, this must be called with vector access disabled.
+ *
+ * This is called locally and also from the scheduler IPI handler.
+ */
+void z_riscv_flush_local_vector(void)
+{
+	__ASSERT((csr_read(mstatus) & MSTATUS_IEN) == 0,
+		 "must be called with IRQs disabled");
+	__ASSERT((csr_read(mstatus) & MSTATUS_VS) == 0,
+		 "must be called with vector access disabled");
+
+	struct k_thread *owner = atomic_ptr_get(&_current_cpu->arch.vector_owner);
+
+	if (owner != NULL) {
+		bool dirty = (_current_cpu->arch.vector_state == MSTATUS_VS_DIRTY);
+
+		if (dirty) {
+			/* turn on vector access */
+			csr_set(mstatus, MSTATUS_VS_CLEAN);
+			/* save current owner's content */
+			z_riscv_vector_save(&owner->arch.saved_vector_context);
+		}
+
+		/* dirty means active use */
+		owner->arch.vector_recently_used = dirty;
+
+		/* disable vector access */
+		csr_clear(mstatus, MSTATUS_VS);
+
+		/* release ownership */
+		atomic_ptr_clear(&_current_cpu->arch.vector_owner);
+	}
+}
+
+#ifdef CONFIG_SMP
+static void flush_owned_vector(struct k_thread *thread)
+{
+	__ASSERT((csr_read(mstatus) & MSTATUS_IEN) == 0,
+		 "must be called with IRQs disabled");
+
+	int i;
+	atomic_ptr_val_t owner;
+
+	/* search all CPUs for the owner we want */
+	unsigned int num_cpus = arch_num_cpus();
+
+	for (i = 0; i < num_cpus; i++) {
+		owner = atomic_ptr_get(&_kernel.cpus[i].arch.vector_owner);
+		if (owner != thread) {
+			continue;
+		}
+		/* we found it live on CPU i */
+		if (i == _current_cpu->id) {
+			vector_disable();
+			z_riscv_flush_local_vector();
+			break;
+		}
+		/* the vector context is live on another CPU */
+		z_riscv_flush_vector_ipi(i);
+
+		/*
+		 * Wait for it only if this is about the thread currently
+		 * running on this CPU, see flush_owned_fpu() for why.
+		 */
+		if (thread == _current) {
+			vector_disable();
+			z_riscv_flush_local_vector();
+			do {
+				arch_nop();
+				owner = atomic_ptr_get(&_kernel.cpus[i].arch.vector_owner);
+			} while (owner == thread);
+		}
+		break;
+	}
+}
+#endif
+
+void z_riscv_vector_enter_exc(void)
+{
+	/* always deny vector access whenever an exception is entered */
+	vector_disable();
+}
+
+/*
+ * Process the vector trap, the same way as z_riscv_fpu_trap(): save the
+ * registers of their owner and restore those of the current thread, or
+ * only grant access with IRQs masked when already in exception.
+ */
+void z_riscv_vector_trap(z_arch_esf_t *esf)
+{
+	__ASSERT((esf->mstatus & MSTATUS_VS) == 0 &&
+		 (csr_read(mstatus) & MSTATUS_VS) == 0,
+		 "called despite vector unit being accessible");
+
+	/* save current owner's content if any */
+	z_riscv_flush_local_vector();
+
+	if (_current->arch.exception_depth > 0) {
+		/*
+		 * We were already in exception when the vector access
+		 * trapped. Prevent any further IRQ recursion as we
+		 * wouldn't be able to preserve the interrupted exception's
+		 * vector context.
+		 */
+		esf->mstatus &= ~MSTATUS_MPIE_EN;
+
+		/* make it accessible to the returning context */
+		esf->mstatus |= MSTATUS_VS_INIT;
+
+		return;
+	}
+
+#ifdef CONFIG_SMP
+	/*
+	 * Make sure the vector context we need isn't live on another CPU.
+	 * The current CPU's vector context is NULL at this point.
+	 */
+	flush_owned_vector(_current);
+#endif
+
+	/* make it accessible and clean to the returning context */
+	esf->mstatus |= MSTATUS_VS_CLEAN;
+
+	/* and load it with corresponding content */
+	vector_load();
+}
+
+/*
+ * Grant or deny access to the vector registers based on their ownership
+ * before executing non-exception code, as fpu_access_allowed() does.
+ */
+static bool vector_access_allowed(unsigned int exc_update_level)
+{
+	__ASSERT((csr_read(mstatus) & MSTATUS_IEN) == 0,
+		 "must be called with IRQs disabled");
+
+	if (_current->arch.exception_depth == exc_update_level) {
+		/* We're about to execute non-exception code */
+		if (_current_cpu->arch.vector_owner == _current) {
+			/* everything is already in place */
+			return true;
+		}
+		if (_current->arch.vector_recently_used) {
+			/*
+			 * The thread made active use of the vector unit
+			 * before being switched out: claim it back now
+			 * rather than on the likely trap to come.
+			 */
+			vector_disable();
+			z_riscv_flush_local_vector();
+#ifdef CONFIG_SMP
+			flush_owned_vector(_current);
+#endif
+			vector_load();
+			_current_cpu->arch.vector_state = MSTATUS_VS_CLEAN;
+			return true;
+		}
+		return false;
+	}
+	/*
+	 * Any new exception level should always trap on vector access
+	 * so that IRQs get disabled before granting it.
+	 */
+	return false;
+}
+
+/*
+ * This is called on every exception exit except for z_riscv_vector_trap()
+ * and z_riscv_fpu_trap().
+ */
+void z_riscv_vector_exit_exc(z_arch_esf_t *esf)
+{
+	if (vector_access_allowed(1)) {
+		esf->mstatus &= ~MSTATUS_VS;
+		esf->mstatus |= _current_cpu->arch.vector_state;
+	} else {
+		esf->mstatus &= ~MSTATUS_VS;
+	}
+}
+
+/*
+ * This is called from z_riscv_context_switch(). Vector access may be
+ * granted only if exception level is 0, it is re-evaluated at exception
+ * exit time otherwise.
+ */
+void z_riscv_vector_thread_context_switch(void)
+{
+	if (vector_access_allowed(0)) {
+		csr_clear(mstatus, MSTATUS_VS);
+		csr_set(mstatus, _current_cpu->arch.vector_state);
+	} else {
+		vector_disable();
+	}
+}
+
+/* Called from arch_float_disable(), e.g. when the thread is aborted */
+void z_riscv_vector_disable(struct k_thread *thread)
+{
+	if (thread != NULL) {
+		unsigned int key = arch_irq_lock();
+
+#ifdef CONFIG_SMP
+		flush_owned_vector(thread);
+#else
+		if (thread == _current_cpu->arch.vector_owner) {
+			vector_disable();
+			z_riscv_flush_local_vector();
+		}
+#endif
+
+		arch_irq_unlock(key);
+	}
+}
@@ -99,6 +99,12 @@ void arch_flush_local_fpu(void);
 void arch_flush_fpu_ipi(unsigned int cpu);
 #endif
 
+#ifdef CONFIG_RISCV_VECTOR_SHARING
+void z_riscv_flush_local_vector(void);
+void z_riscv_flush_vector_ipi(unsigned int cpu);
+void z_riscv_vector_disable(struct k_thread *thread);
+#endif
+
 #ifndef CONFIG_MULTITHREADING
 extern FUNC_NORETURN void z_riscv_switch_to_main_no_multithreading(
 	k_thread_entry_t main_func, void *p1, void *p2, void *p3);
@@ -45,6 +45,10 @@ if(CONFIG_RISCV_ISA_EXT_C)
     string(CONCAT riscv_march ${riscv_march} "c")
 endif()
 
+if(CONFIG_RISCV_ISA_EXT_V)
+    string(CONCAT riscv_march ${riscv_march} "v")
+endif()
+
 if(CONFIG_RISCV_ISA_EXT_ZICSR)
     string(CONCAT riscv_march ${riscv_march} "_zicsr")
 endif()
@@ -132,3 +132,7 @@ endif()
 if(CONFIG_DEVICE_MUTABLE)
   zephyr_iterable_section(NAME device_mutable GROUP DATA_REGION ${XIP_ALIGN_WITH_INPUT} SUBALIGN 4)
 endif()
+
+if(CONFIG_DEVICE_NAME_INDEX)
+  zephyr_iterable_section(NAME z_device_name_slot GROUP DATA_REGION ${XIP_ALIGN_WITH_INPUT} SUBALIGN 4)
+endif()
@@ -1369,9 +1369,12 @@ endmacro()
 # - NOKEEP: suppress the generation of KEEP() statements in the linker script,
 #   to allow any unused code in the given files/library to be discarded.
 # - PHDR [program_header]: add program header. Used on Xtensa platforms.
+# - FILTER [regex]: only relocate the sections whose name matches the regular
+#   expression, e.g. "^\\.text\\.(foo|bar)$" to relocate the functions foo
+#   and bar when building with -ffunction-sections.
 function(zephyr_code_relocate)
   set(options NOCOPY NOKEEP)
-  set(single_args LIBRARY LOCATION PHDR)
+  set(single_args LIBRARY LOCATION PHDR FILTER)
   set(multi_args FILES)
   cmake_parse_arguments(CODE_REL "${options}" "${single_args}"
     "${multi_args}" ${ARGN})
@@ -1437,6 +1440,12 @@ function(zephyr_code_relocate)
   if(CODE_REL_NOKEEP)
     list(APPEND flag_list NOKEEP)
   endif()
+  if(CODE_REL_FILTER)
+    # The regular expression may contain the characters used to separate the
+    # directives and lists, pass it hex encoded.
+    string(HEX "${CODE_REL_FILTER}" filter_hex)
+    list(APPEND flag_list FILTER=${filter_hex})
+  endif()
   if(CODE_REL_PHDR)
     set(CODE_REL_LOCATION "${CODE_REL_LOCATION}\ :${CODE_REL_PHDR}")
   endif()
@@ -196,6 +196,11 @@ struct adc_stm32_data {
 	volatile int dma_error;
 	struct stream dma;
 #endif
+#if defined(CONFIG_ADC_STREAM) && defined(CONFIG_ADC_STM32_DMA)
+	adc_stream_callback_t stream_cb;
+	void *stream_user_data;
+	size_t stream_half;
+#endif
 };
 
 struct adc_stm32_cfg {
@@ -213,23 +218,25 @@ struct adc_stm32_cfg {
 };
 
 #ifdef CONFIG_ADC_STM32_DMA
-static void adc_stm32_enable_dma_support(ADC_TypeDef *adc)
+static void adc_stm32_enable_dma_support(ADC_TypeDef *adc, bool circular)
 {
-	/* Allow ADC to create DMA request and set to one-shot mode as implemented in HAL drivers */
+	/* Allow ADC to create DMA request and set to one-shot mode as implemented in HAL drivers,
+	 * or to keep creating requests after the end of the DMA transfer in circular mode
+	 */
+	uint32_t mode = circular ? LL_ADC_REG_DMA_TRANSFER_UNLIMITED :
+				   LL_ADC_REG_DMA_TRANSFER_LIMITED;
 
 #if defined(CONFIG_SOC_SERIES_STM32H7X)
 
 #if defined(ADC_VER_V5_V90)
 	if (adc == ADC3) {
-		LL_ADC_REG_SetDMATransferMode(adc,
-			ADC3_CFGR_DMACONTREQ(LL_ADC_REG_DMA_TRANSFER_LIMITED));
+		LL_ADC_REG_SetDMATransferMode(adc, ADC3_CFGR_DMACONTREQ(mode));
 		LL_ADC_EnableDMAReq(adc);
 	} else {
-		LL_ADC_REG_SetDataTransferMode(adc,
-			ADC_CFGR_DMACONTREQ(LL_ADC_REG_DMA_TRANSFER_LIMITED));
+		LL_ADC_REG_SetDataTransferMode(adc, ADC_CFGR_DMACONTREQ(mode));
 	}
 #elif defined(ADC_VER_V5_X)
-	LL_ADC_REG_SetDataTransferMode(adc, LL_ADC_REG_DMA_TRANSFER_LIMITED);
+	LL_ADC_REG_SetDataTransferMode(adc, mode);
 #else
 #error "Unsupported ADC version"
 #endif
@@ -241,13 +248,13 @@ static void adc_stm32_enable_dma_support(ADC_TypeDef *adc)
 #else /* DT_HAS_COMPAT_STATUS_OKAY(st_stm32f1_adc) */
 
 	/* Default mechanism for other MCUs */
-	LL_ADC_REG_SetDMATransfer(adc, LL_ADC_REG_DMA_TRANSFER_LIMITED);
+	LL_ADC_REG_SetDMATransfer(adc, mode);
 
 #endif
 }
 
 static int adc_stm32_dma_start(const struct device *dev,
-			       void *buffer, size_t channel_count)
+			       void *buffer, size_t len, bool circular)
 {
 	const struct adc_stm32_cfg *config = dev->config;
 	ADC_TypeDef *adc = (ADC_TypeDef *)config->base;
@@ -260,16 +267,16 @@ static int adc_stm32_dma_start(const struct device *dev,
 	blk_cfg = &dma->dma_blk_cfg;
 
 	/* prepare the block */
-	blk_cfg->block_size = channel_count * sizeof(int16_t);
+	blk_cfg->block_size = len;
 
 	/* Source and destination */
 	blk_cfg->source_address = (uint32_t)LL_ADC_DMA_GetRegAddr(adc, LL_ADC_DMA_REG_REGULAR_DATA);
 	blk_cfg->source_addr_adj = DMA_ADDR_ADJ_NO_CHANGE;
-	blk_cfg->source_reload_en = 0;
+	blk_cfg->source_reload_en = circular;
 
 	blk_cfg->dest_address = (uint32_t)buffer;
 	blk_cfg->dest_addr_adj = DMA_ADDR_ADJ_INCREMENT;
-	blk_cfg->dest_reload_en = 0;
+	blk_cfg->dest_reload_en = circular;
 
 	/* Manually set the FIFO threshold to 1/4 because the
 	 * dmamux DTS entry does not contain fifo threshold
@@ -287,7 +294,7 @@ static int adc_stm32_dma_start(const struct device *dev,
 		return ret;
 	}
 
-	adc_stm32_enable_dma_support(adc);
+	adc_stm32_enable_dma_support(adc, circular);
 
 	data->dma_error = 0;
 	ret = dma_start(data->dma.dma_dev, data->dma.channel);
@@ -727,6 +734,26 @@ static int adc_stm32_oversampling(ADC_TypeDef *adc, uint8_t ratio)
 #endif /* CONFIG_SOC_SERIES_STM32xxx */
 
 #ifdef CONFIG_ADC_STM32_DMA
+#ifdef CONFIG_ADC_STREAM
+static void adc_stm32_stream_event(struct adc_stm32_data *data, int status)
+{
+	const uint8_t *buf = (const uint8_t *)data->buffer;
+
+	if (status < 0) {
+		LOG_ERR("DMA streaming failed: %d", status);
+		data->stream_cb(data->dev, NULL, 0, status, data->stream_user_data);
+		return;
+	}
+
+	/* Half transfer for the first half of the ring, completion for the second one */
+	if (status == DMA_STATUS_COMPLETE) {
+		buf += data->stream_half;
+	}
+
+	data->stream_cb(data->dev, buf, data->stream_half, 0, data->stream_user_data);
+}
+#endif /* CONFIG_ADC_STREAM */
+
 static void dma_callback(const struct device *dev, void *user_data,
 			 uint32_t channel, int status)
 {
@@ -737,6 +764,13 @@ static void dma_callback(const struct device *dev, void *user_data,
 
 	LOG_DBG("dma callback");
 
+#ifdef CONFIG_ADC_STREAM
+	if ((channel == data->dma.channel) && (data->stream_cb != NULL)) {
+		adc_stm32_stream_event(data, status);
+		return;
+	}
+#endif /* CONFIG_ADC_STREAM */
+
 	if (channel == data->dma.channel) {
 #if !DT_HAS_COMPAT_STATUS_OKAY(st_stm32f1_adc)
 		if (LL_ADC_IsActiveFlag_OVR(adc) || (status >= 0)) {
@@ -915,8 +949,9 @@ static int set_sequencer(const struct device *dev)
 	return 0;
 }
 
-static int start_read(const struct device *dev,
-		      const struct adc_sequence *sequence)
+/* Set up the ADC for the conversions of a sequence */
+static int adc_stm32_setup_sequence(const struct device *dev,
+				    const struct adc_sequence *sequence)
 {
 	const struct adc_stm32_cfg *config = dev->config;
 	struct adc_stm32_data *data = dev->data;
@@ -997,6 +1032,25 @@ static int start_read(const struct device *dev,
 	LL_ADC_ClearFlag_OVR(adc);
 #endif /* !DT_HAS_COMPAT_STATUS_OKAY(st_stm32f1_adc) */
 
+	return 0;
+}
+
+static int start_read(const struct device *dev,
+		      const struct adc_sequence *sequence)
+{
+	const struct adc_stm32_cfg *config = dev->config;
+	struct adc_stm32_data *data = dev->data;
+	ADC_TypeDef *adc = (ADC_TypeDef *)config->base;
+	int err;
+
+	/* Remove warning for some series */
+	ARG_UNUSED(adc);
+
+	err = adc_stm32_setup_sequence(dev, sequence);
+	if (err) {
+		return err;
+	}
+
 #if !defined(CONFIG_ADC_STM32_DMA)
 #if DT_HAS_COMPAT_STATUS_OKAY(st_stm32f4_adc)
 	/* Trigger an ISR after each sampling (not just end of sequence) */
@@ -1040,7 +1094,7 @@ static void adc_context_start_sampling(struct adc_context *ctx)
 	/* Make sure DMA bit of ADC register CR2 is set to 0 before starting a DMA transfer */
 	LL_ADC_REG_SetDMATransfer(adc, LL_ADC_REG_DMA_TRANSFER_NONE);
 #endif
-	adc_stm32_dma_start(dev, data->buffer, data->channel_count);
+	adc_stm32_dma_start(dev, data->buffer, data->channel_count * sizeof(int16_t), false);
 #endif
 	adc_stm32_start_conversion(dev);
 }
@@ -1147,6 +1201,106 @@ static int adc_stm32_read_async(const struct device *dev,
 }
 #endif
 
+#if defined(CONFIG_ADC_STREAM) && defined(CONFIG_ADC_STM32_DMA)
+static int adc_stm32_stream_stop(const struct device *dev);
+
+static int adc_stm32_stream_start(const struct device *dev,
+				  const struct adc_sequence *sequence,
+				  adc_stream_callback_t callback,
+				  void *user_data)
+{
+	const struct adc_stm32_cfg *config = dev->config;
+	struct adc_stm32_data *data = dev->data;
+	ADC_TypeDef *adc = (ADC_TypeDef *)config->base;
+	size_t len;
+	int err;
+
+	if ((callback == NULL) || (sequence->options != NULL)) {
+		return -EINVAL;
+	}
+
+	/* The ADC stays locked until the stream is stopped */
+	adc_context_lock(&data->ctx, false, NULL);
+
+	err = adc_stm32_setup_sequence(dev, sequence);
+	if (err) {
+		adc_context_release(&data->ctx, err);
+		return err;
+	}
+
+	len = ROUND_DOWN(sequence->buffer_size,
+			 2 * data->channel_count * sizeof(int16_t));
+	if (len == 0) {
+		LOG_ERR("Buffer too small for streaming (%u)", sequence->buffer_size);
+		adc_context_release(&data->ctx, -ENOMEM);
+		return -ENOMEM;
+	}
+
+	pm_policy_state_lock_get(PM_STATE_SUSPEND_TO_IDLE, PM_ALL_SUBSTATES);
+	if (IS_ENABLED(CONFIG_PM_S2RAM)) {
+		pm_policy_state_lock_get(PM_STATE_SUSPEND_TO_RAM, PM_ALL_SUBSTATES);
+	}
+
+	data->stream_half = len / 2;
+	data->stream_user_data = user_data;
+	data->stream_cb = callback;
+
+	/* Conversions follow each other, the circular DMA never stops
+	 * and reports each half of the ring.
+	 */
+	LL_ADC_REG_SetContinuousMode(adc, LL_ADC_REG_CONV_CONTINUOUS);
+
+#if DT_HAS_COMPAT_STATUS_OKAY(st_stm32f4_adc)
+	/* Make sure DMA bit of ADC register CR2 is set to 0 before starting a DMA transfer */
+	LL_ADC_REG_SetDMATransfer(adc, LL_ADC_REG_DMA_TRANSFER_NONE);
+#endif
+	err = adc_stm32_dma_start(dev, data->buffer, len, true);
+	if (err) {
+		(void)adc_stm32_stream_stop(dev);
+		return err;
+	}
+
+	adc_stm32_start_conversion(dev);
+
+	return 0;
+}
+
+static int adc_stm32_stream_stop(const struct device *dev)
+{
+	const struct adc_stm32_cfg *config = dev->config;
+	struct adc_stm32_data *data = dev->data;
+	ADC_TypeDef *adc = (ADC_TypeDef *)config->base;
+
+	if (data->stream_cb == NULL) {
+		return -EALREADY;
+	}
+
+#if !DT_HAS_COMPAT_STATUS_OKAY(st_stm32f1_adc) && \
+	!DT_HAS_COMPAT_STATUS_OKAY(st_stm32f4_adc)
+	if (LL_ADC_REG_IsConversionOngoing(adc)) {
+		LL_ADC_REG_StopConversion(adc);
+		while (LL_ADC_REG_IsConversionOngoing(adc)) {
+		}
+	}
+#endif
+
+	LL_ADC_REG_SetContinuousMode(adc, LL_ADC_REG_CONV_SINGLE);
+	dma_stop(data->dma.dma_dev, data->dma.channel);
+
+	data->stream_cb = NULL;
+
+	pm_policy_state_lock_put(PM_STATE_SUSPEND_TO_IDLE, PM_ALL_SUBSTATES);
+	if (IS_ENABLED(CONFIG_PM_S2RAM)) {
+		pm_policy_state_lock_put(PM_STATE_SUSPEND_TO_RAM, PM_ALL_SUBSTATES);
+	}
+
+	adc_context_on_complete(&data->ctx, 0);
+	adc_context_release(&data->ctx, 0);
+
+	return 0;
+}
+#endif /* CONFIG_ADC_STREAM && CONFIG_ADC_STM32_DMA */
+
 static int adc_stm32_sampling_time_check(const struct device *dev, uint16_t acq_time)
 {
 	const struct adc_stm32_cfg *config =
@@ -1518,6 +1672,10 @@ static const struct adc_driver_api api_stm32_driver_api = {
 	.read = adc_stm32_read,
 #ifdef CONFIG_ADC_ASYNC
 	.read_async = adc_stm32_read_async,
+#endif
+#if defined(CONFIG_ADC_STREAM) && defined(CONFIG_ADC_STM32_DMA)
+	.stream_start = adc_stm32_stream_start,
+	.stream_stop = adc_stm32_stream_stop,
 #endif
 	.ref_internal = STM32_ADC_VREF_MV, /* VREF is usually connected to VDD */
 };
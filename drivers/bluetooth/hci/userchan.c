@@ -17,6 +17,7 @@
 #include <poll.h>
 #include <errno.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <string.h>
 #include <unistd.h>
 #include <stdio.h>
@@ -245,8 +246,14 @@ static void rx_thread(void *p1, void *p2, void *p3)
 	}
 }
 
+/* Maximum number of buffers in a chain given to uc_send() */
+#define UC_SEND_IOV_MAX 8
+
 static int uc_send(struct net_buf *buf)
 {
+	struct iovec iov[UC_SEND_IOV_MAX];
+	int iovcnt = 0;
+
 	LOG_DBG("buf %p type %u len %u", buf, bt_buf_get_type(buf), buf->len);
 
 	if (uc_fd < 0) {
@@ -272,7 +279,23 @@ static int uc_send(struct net_buf *buf)
 		return -EINVAL;
 	}
 
-	if (write(uc_fd, buf->data, buf->len) < 0) {
+	/* Send the whole chain in one write, so that it stays one packet */
+	for (struct net_buf *frag = buf; frag; frag = frag->frags) {
+		if (!frag->len) {
+			continue;
+		}
+
+		if (iovcnt == ARRAY_SIZE(iov)) {
+			LOG_ERR("Too many fragments");
+			return -EINVAL;
+		}
+
+		iov[iovcnt].iov_base = frag->data;
+		iov[iovcnt].iov_len = frag->len;
+		iovcnt++;
+	}
+
+	if (writev(uc_fd, iov, iovcnt) < 0) {
 		return -errno;
 	}
 
@@ -364,6 +387,7 @@ static const struct bt_hci_driver drv = {
 	.bus		= BT_HCI_DRIVER_BUS_UART,
 	.open		= uc_open,
 	.send		= uc_send,
+	.quirks		= BT_QUIRK_TX_FRAGS,
 };
 
 static int bt_uc_init(void)
@@ -409,8 +409,27 @@ void nvme_controller_data_swapbytes(struct nvme_controller_data *s)
 
 #define NVME_ADMINQ_ALLOCATE(n, n_entries)		\
 	NVME_QUEUE_ALLOCATE(admin_##n, n_entries)
-#define NVME_IOQ_ALLOCATE(n, n_entries)			\
-	NVME_QUEUE_ALLOCATE(io_##n, n_entries)
+
+/* One I/O queue pair per CPU at most, each with its own aligned rings */
+#define NVME_IOQ_INIT(idx, n, n_entries)				\
+	{								\
+		.num_entries = n_entries,				\
+		.cmd = cmd_io_##n[idx].cmd,				\
+		.cpl = cpl_io_##n[idx].cpl,				\
+	}
+
+#define NVME_IOQ_ALLOCATE(n, n_entries)					\
+	static struct {							\
+		struct nvme_command cmd[n_entries];			\
+	} __aligned(0x1000) cmd_io_##n[CONFIG_NVME_IO_QUEUES];		\
+	static struct {							\
+		struct nvme_completion cpl[n_entries];			\
+	} __aligned(0x1000) cpl_io_##n[CONFIG_NVME_IO_QUEUES];		\
+									\
+	static struct nvme_cmd_qpair io_##n[CONFIG_NVME_IO_QUEUES] = {	\
+		LISTIFY(CONFIG_NVME_IO_QUEUES, NVME_IOQ_INIT, (,),	\
+			n, n_entries)					\
+	}
 
 struct nvme_controller_config {
 	struct pcie_dev *pcie;
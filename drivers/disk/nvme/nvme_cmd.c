@@ -22,6 +22,9 @@ static struct nvme_request request_pool[NVME_REQUEST_AMOUNT];
 static sys_dlist_t free_request;
 static sys_dlist_t pending_request;
 
+/* Protects the pools and the pending list, requests complete in interrupts */
+static struct k_spinlock request_lock;
+
 static void request_timeout(struct k_work *work);
 
 static K_WORK_DELAYABLE_DEFINE(request_timer, request_timeout);
@@ -213,15 +216,18 @@ void nvme_cmd_init(void)
 
 static struct nvme_prp_list *nvme_prp_list_alloc(void)
 {
+	k_spinlock_key_t key = k_spin_lock(&request_lock);
 	sys_dnode_t *node;
 
 	node = sys_dlist_peek_head(&free_prp_list);
 	if (!node) {
+		k_spin_unlock(&request_lock, key);
 		LOG_ERR("Could not allocate PRP list");
 		return NULL;
 	}
 
 	sys_dlist_remove(node);
+	k_spin_unlock(&request_lock, key);
 
 	return CONTAINER_OF(node, struct nvme_prp_list, node);
 }
@@ -234,6 +240,8 @@ static void nvme_prp_list_free(struct nvme_prp_list *prp_list)
 
 void nvme_cmd_request_free(struct nvme_request *request)
 {
+	k_spinlock_key_t key = k_spin_lock(&request_lock);
+
 	if (sys_dnode_is_linked(&request->node)) {
 		sys_dlist_remove(&request->node);
 	}
@@ -244,26 +252,34 @@ void nvme_cmd_request_free(struct nvme_request *request)
 
 	memset(request, 0, sizeof(struct nvme_request));
 	sys_dlist_append(&free_request, &request->node);
+
+	k_spin_unlock(&request_lock, key);
 }
 
 struct nvme_request *nvme_cmd_request_alloc(void)
 {
+	k_spinlock_key_t key = k_spin_lock(&request_lock);
 	sys_dnode_t *node;
 
 	node = sys_dlist_peek_head(&free_request);
 	if (!node) {
+		k_spin_unlock(&request_lock, key);
 		LOG_ERR("Could not allocate request");
 		return NULL;
 	}
 
 	sys_dlist_remove(node);
+	k_spin_unlock(&request_lock, key);
 
 	return CONTAINER_OF(node, struct nvme_request, node);
 }
 
 static void nvme_cmd_register_request(struct nvme_request *request)
 {
+	k_spinlock_key_t key = k_spin_lock(&request_lock);
+
 	sys_dlist_append(&pending_request, &request->node);
+	k_spin_unlock(&request_lock, key);
 
 	request->req_start = k_uptime_get_32();
 
@@ -276,17 +292,27 @@ static void nvme_cmd_register_request(struct nvme_request *request)
 static void request_timeout(struct k_work *work)
 {
 	uint32_t current = k_uptime_get_32();
-	struct nvme_request *request, *next;
+	struct nvme_request *request;
+	k_spinlock_key_t key;
+	uint32_t req_start;
 
 	ARG_UNUSED(work);
 
-	SYS_DLIST_FOR_EACH_CONTAINER_SAFE(&pending_request,
-					  request, next, node) {
-		if ((int32_t)(request->req_start +
-			      CONFIG_NVME_REQUEST_TIMEOUT - current) > 0) {
+	while (true) {
+		key = k_spin_lock(&request_lock);
+		request = SYS_DLIST_PEEK_HEAD_CONTAINER(&pending_request,
+							request, node);
+		if ((request == NULL) ||
+		    ((int32_t)(request->req_start +
+			       CONFIG_NVME_REQUEST_TIMEOUT - current) > 0)) {
+			req_start = (request != NULL) ? request->req_start : 0;
+			k_spin_unlock(&request_lock, key);
 			break;
 		}
 
+		sys_dlist_remove(&request->node);
+		k_spin_unlock(&request_lock, key);
+
 		LOG_WRN("Request %p CID %u timed-out",
 			request, request->cmd.cdw0.cid);
 
@@ -305,7 +331,7 @@ static void request_timeout(struct k_work *work)
 
 	if (request) {
 		k_work_reschedule(&request_timer,
-				  K_SECONDS(request->req_start +
+				  K_SECONDS(req_start +
 					    CONFIG_NVME_REQUEST_TIMEOUT -
 					    current));
 	}
@@ -400,7 +426,10 @@ static void nvme_cmd_request_complete(struct nvme_request *request,
 	if (retry) {
 		LOG_DBG("Retrying CMD");
 		/* Let's remove it from pending... */
+		k_spinlock_key_t key = k_spin_lock(&request_lock);
+
 		sys_dlist_remove(&request->node);
+		k_spin_unlock(&request_lock, key);
 		/* ...and re-submit, thus re-adding to pending */
 		nvme_cmd_qpair_submit_request(request->qpair, request);
 		request->retries++;
@@ -635,6 +664,8 @@ int nvme_cmd_qpair_submit_request(struct nvme_cmd_qpair *qpair,
 				  struct nvme_request *request)
 {
 	mm_reg_t regs = DEVICE_MMIO_GET(qpair->ctrlr->dev);
+	k_spinlock_key_t key;
+	uint32_t sq_tail;
 	int ret;
 
 	request->qpair = qpair;
@@ -648,19 +679,33 @@ int nvme_cmd_qpair_submit_request(struct nvme_cmd_qpair *qpair,
 		return ret;
 	}
 
+	key = k_spin_lock(&qpair->lock);
+
+	sq_tail = qpair->sq_tail + 1;
+	if (sq_tail == qpair->num_entries) {
+		sq_tail = 0;
+	}
+
+	/* The submission queue is full, one entry is always kept free */
+	if (sq_tail == qpair->sq_head) {
+		k_spin_unlock(&qpair->lock, key);
+		LOG_WRN("Queue %u full", qpair->id);
+		nvme_cmd_request_free(request);
+		return -EBUSY;
+	}
+
 	nvme_cmd_register_request(request);
 
 	memcpy(&qpair->cmd[qpair->sq_tail],
 	       &request->cmd, sizeof(request->cmd));
 
-	qpair->sq_tail++;
-	if (qpair->sq_tail == qpair->num_entries) {
-		qpair->sq_tail = 0;
-	}
+	qpair->sq_tail = sq_tail;
 
 	sys_write32(qpair->sq_tail, regs + qpair->sq_tdbl_off);
 	qpair->num_cmds++;
 
+	k_spin_unlock(&qpair->lock, key);
+
 	LOG_DBG("Request %p %llu submitted: CID %u - sq_tail %u",
 		request, qpair->num_cmds, request->cmd.cdw0.cid,
 		qpair->sq_tail - 1);
@@ -344,6 +344,8 @@ struct nvme_cmd_qpair {
 	uintptr_t		cpl_bus_addr;
 
 	uint16_t		vector;
+
+	struct k_spinlock	lock;
 } __aligned(CACHE_LINE_SIZE);
 
 typedef void (*nvme_cb_fn_t)(void *, const struct nvme_completion *);
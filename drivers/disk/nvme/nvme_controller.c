@@ -351,12 +351,16 @@ static int nvme_controller_pcie_configure(const struct device *dev)
 					      CONFIG_NVME_INT_PRIORITY,
 					      nvme_ctrlr->vectors,
 					      NVME_PCIE_MSIX_VECTORS);
-	if (n_vectors == 0) {
+	if (n_vectors < 2) {
 		LOG_ERR("Could not allocate %u MSI-X vectors",
 			NVME_PCIE_MSIX_VECTORS);
 		return -EIO;
 	}
 
+	/* Each I/O queue has its own vector, after the admin queue one */
+	nvme_ctrlr->num_io_queues = MIN(nvme_ctrlr->num_io_queues,
+					n_vectors - 1);
+
 	/* Enabling MSI-X and the vectors */
 	if (!pcie_msi_enable(nvme_ctrlr_cfg->pcie->bdf,
 			     nvme_ctrlr->vectors, n_vectors, 0)) {
@@ -472,7 +476,7 @@ static int nvme_controller_init(const struct device *dev)
 		.id = n,						\
 		.num_io_queues = CONFIG_NVME_IO_QUEUES,			\
 		.adminq = &admin_##n,					\
-		.ioq = &io_##n,						\
+		.ioq = io_##n,						\
 	};								\
 									\
 	static struct nvme_controller_config nvme_ctrlr_cfg_##n =	\
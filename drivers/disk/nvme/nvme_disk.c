@@ -8,9 +8,20 @@ LOG_MODULE_DECLARE(nvme, CONFIG_NVME_LOG_LEVEL);
 
 #include <zephyr/kernel.h>
 #include <zephyr/sys/byteorder.h>
+#ifdef CONFIG_DISK_ACCESS_RTIO
+#include <zephyr/rtio/rtio.h>
+#endif
 
 #include "nvme.h"
 
+/* Submit to the I/O queue of the current CPU */
+static struct nvme_cmd_qpair *nvme_disk_ioq(struct nvme_namespace *ns)
+{
+	struct nvme_controller *ctrlr = ns->ctrlr;
+
+	return &ctrlr->ioq[arch_curr_cpu()->id % ctrlr->num_io_queues];
+}
+
 static int nvme_disk_init(struct disk_info *disk)
 {
 	return 0;
@@ -53,10 +64,10 @@ static int nvme_disk_read(struct disk_info *disk,
 	nvme_namespace_read_cmd(&request->cmd, ns->id,
 				start_sector, num_sector);
 
-	/* We use only the first ioq atm
-	 * ToDo: use smp cpu id and use it to select ioq
-	 */
-	nvme_cmd_qpair_submit_request(ns->ctrlr->ioq, request);
+	ret = nvme_cmd_qpair_submit_request(nvme_disk_ioq(ns), request);
+	if (ret != 0) {
+		goto out;
+	}
 
 	nvme_completion_poll(&status);
 	if (nvme_cpl_status_is_error(&status)) {
@@ -102,10 +113,10 @@ static int nvme_disk_write(struct disk_info *disk,
 	nvme_namespace_write_cmd(&request->cmd, ns->id,
 				 start_sector, num_sector);
 
-	/* We use only the first ioq atm
-	 * ToDo: use smp cpu id and use it to select ioq
-	 */
-	nvme_cmd_qpair_submit_request(ns->ctrlr->ioq, request);
+	ret = nvme_cmd_qpair_submit_request(nvme_disk_ioq(ns), request);
+	if (ret != 0) {
+		goto out;
+	}
 
 	nvme_completion_poll(&status);
 	if (nvme_cpl_status_is_error(&status)) {
@@ -124,6 +135,7 @@ static int nvme_disk_flush(struct nvme_namespace *ns)
 	struct nvme_completion_poll_status status =
 		NVME_CPL_STATUS_POLL_INIT(status);
 	struct nvme_request *request;
+	int ret;
 
 	request = nvme_allocate_request_null(nvme_completion_poll_cb, &status);
 	if (request == NULL) {
@@ -132,10 +144,10 @@ static int nvme_disk_flush(struct nvme_namespace *ns)
 
 	nvme_namespace_flush_cmd(&request->cmd, ns->id);
 
-	/* We use only the first ioq
-	 * ToDo: use smp cpu id and use it to select ioq
-	 */
-	nvme_cmd_qpair_submit_request(ns->ctrlr->ioq, request);
+	ret = nvme_cmd_qpair_submit_request(nvme_disk_ioq(ns), request);
+	if (ret != 0) {
+		return ret;
+	}
 
 	nvme_completion_poll(&status);
 	if (nvme_cpl_status_is_error(&status)) {
@@ -194,12 +206,77 @@ static int nvme_disk_ioctl(struct disk_info *disk, uint8_t cmd, void *buff)
 	return ret;
 }
 
+#ifdef CONFIG_DISK_ACCESS_RTIO
+static void nvme_disk_rtio_cb(void *arg, const struct nvme_completion *cpl)
+{
+	struct rtio_iodev_sqe *iodev_sqe = arg;
+
+	if (cpl == NULL) {
+		rtio_iodev_sqe_err(iodev_sqe, -ETIMEDOUT);
+	} else if (nvme_completion_is_error(cpl)) {
+		nvme_completion_print(cpl);
+		rtio_iodev_sqe_err(iodev_sqe, -EIO);
+	} else {
+		rtio_iodev_sqe_ok(iodev_sqe, 0);
+	}
+}
+
+/* Requests are submitted without waiting, up to the depth of the I/O queue */
+static void nvme_disk_submit(struct disk_info *disk,
+			     struct rtio_iodev_sqe *iodev_sqe)
+{
+	struct nvme_namespace *ns = CONTAINER_OF(disk->name,
+						 struct nvme_namespace, name[0]);
+	uint32_t sector_size = nvme_namespace_get_sector_size(ns);
+	struct nvme_request *request;
+	struct disk_rtio_req req;
+	int ret;
+
+	ret = disk_access_rtio_req_get(iodev_sqe, sector_size, &req);
+	if (ret != 0) {
+		goto err;
+	}
+
+	if (!NVME_IS_BUFFER_DWORD_ALIGNED(req.buf)) {
+		LOG_WRN("Data buffer pointer needs to be 4-bytes aligned");
+		ret = -EINVAL;
+		goto err;
+	}
+
+	request = nvme_allocate_request_vaddr((void *)req.buf,
+					      req.num_sector * sector_size,
+					      nvme_disk_rtio_cb, iodev_sqe);
+	if (request == NULL) {
+		ret = -ENOMEM;
+		goto err;
+	}
+
+	if (req.write) {
+		nvme_namespace_write_cmd(&request->cmd, ns->id,
+					 req.start_sector, req.num_sector);
+	} else {
+		nvme_namespace_read_cmd(&request->cmd, ns->id,
+					req.start_sector, req.num_sector);
+	}
+
+	ret = nvme_cmd_qpair_submit_request(nvme_disk_ioq(ns), request);
+	if (ret == 0) {
+		return;
+	}
+err:
+	rtio_iodev_sqe_err(iodev_sqe, ret);
+}
+#endif /* CONFIG_DISK_ACCESS_RTIO */
+
 static const struct disk_operations nvme_disk_ops = {
 	.init = nvme_disk_init,
 	.status = nvme_disk_status,
 	.read = nvme_disk_read,
 	.write = nvme_disk_write,
 	.ioctl = nvme_disk_ioctl,
+#ifdef CONFIG_DISK_ACCESS_RTIO
+	.submit = nvme_disk_submit,
+#endif
 };
 
 int nvme_namespace_disk_setup(struct nvme_namespace *ns,
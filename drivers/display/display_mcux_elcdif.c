@@ -22,6 +22,8 @@
 #include <zephyr/drivers/dma/dma_mcux_pxp.h>
 #endif
 
+#include <zephyr/sys/dma_memcpy.h>
+
 #include <zephyr/logging/log.h>
 #include <zephyr/irq.h>
 
@@ -117,7 +119,7 @@ static int mcux_elcdif_write(const struct device *dev, const uint16_t x,
 			 */
 			src = dev_data->active_fb;
 			dst = dev_data->fb[dev_data->next_idx];
-			memcpy(dst, src, config->fb_bytes);
+			(void)sys_dma_memcpy(dst, src, config->fb_bytes);
 		}
 		/* Now, write the display update into active framebuffer */
 		src = buf;
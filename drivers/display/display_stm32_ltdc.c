@@ -20,6 +20,7 @@
 #include <zephyr/pm/device.h>
 #include <zephyr/sys/barrier.h>
 #include <zephyr/cache.h>
+#include <zephyr/sys/dma_memcpy.h>
 
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(display_stm32_ltdc, CONFIG_DISPLAY_LOG_LEVEL);
@@ -189,7 +190,7 @@ static int stm32_ltdc_write(const struct device *dev, const uint16_t x,
 				dst = data->frame_buffer + data->frame_buffer_len;
 			}
 
-			memcpy(dst, data->front_buf, data->frame_buffer_len);
+			(void)sys_dma_memcpy(dst, data->front_buf, data->frame_buffer_len);
 		}
 
 		pend_buf = dst;
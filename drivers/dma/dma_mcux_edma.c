@@ -101,6 +101,9 @@ struct call_back {
 	dma_callback_t dma_callback;
 	struct dma_mcux_channel_transfer_edma_settings transfer_settings;
 	bool busy;
+	/* Transfer whose TCDs are held by the channel, see dma_prepare() */
+	struct dma_prepared *prepared;
+	int8_t prepared_tcds;
 };
 
 struct dma_mcux_edma_data {
@@ -266,6 +269,7 @@ static int dma_mcux_edma_configure(const struct device *dev, uint32_t channel,
 	dmamux_idx = DEV_DMAMUX_IDX(dev, channel);
 	dmamux_channel = DEV_DMAMUX_CHANNEL(dev, channel);
 	data->transfer_settings.valid = false;
+	data->prepared = NULL;
 
 	switch (config->channel_direction) {
 	case MEMORY_TO_MEMORY:
@@ -492,6 +496,9 @@ static int dma_mcux_edma_reload(const struct device *dev, uint32_t channel,
 		goto cleanup;
 	}
 
+	/* The TCDs no longer match the prepared transfer */
+	data->prepared = NULL;
+
 	EDMA_PrepareTransfer(
 		&(data->transferConfig),
 		(void *)src,
@@ -515,6 +522,81 @@ cleanup:
 	return ret;
 }
 
+static int dma_mcux_edma_prepare(const struct device *dev, struct dma_prepared *prep)
+{
+	struct call_back *data;
+	int ret;
+
+	if (prep->channel >= DT_INST_PROP(0, dma_channels)) {
+		return -EINVAL;
+	}
+
+	ret = dma_mcux_edma_configure(dev, prep->channel, prep->config);
+	if (ret == 0) {
+		data = DEV_CHANNEL_DATA(dev, prep->channel);
+		data->prepared = prep;
+		data->prepared_tcds = data->edma_handle.tcdUsed;
+	}
+
+	return ret;
+}
+
+static int dma_mcux_edma_submit(const struct device *dev, struct dma_prepared *prep)
+{
+	uint32_t channel = prep->channel;
+	struct call_back *data;
+	edma_handle_t *p_handle;
+	unsigned int key;
+	int ret = 0;
+
+	if (channel >= DT_INST_PROP(0, dma_channels)) {
+		return -EINVAL;
+	}
+
+	data = DEV_CHANNEL_DATA(dev, channel);
+	p_handle = DEV_EDMA_HANDLE(dev, channel);
+
+	if (data->prepared != prep) {
+		ret = dma_mcux_edma_prepare(dev, prep);
+		if (ret != 0) {
+			return ret;
+		}
+
+		return dma_mcux_edma_start(dev, channel);
+	}
+
+	key = irq_lock();
+
+	if (data->busy) {
+		irq_unlock(key);
+		return -EBUSY;
+	}
+
+	if (p_handle->tcdPool != NULL) {
+		/* A transfer leaves the TCD chain untouched in the pool, only
+		 * rewind the queue and load its first TCD in the channel.
+		 */
+		p_handle->header = 0;
+		p_handle->tail = data->prepared_tcds % CONFIG_DMA_TCD_QUEUE_SIZE;
+		p_handle->tcdUsed = data->prepared_tcds;
+		EDMA_ClearChannelStatusFlags(DEV_BASE(dev), p_handle->channel,
+					     kEDMA_DoneFlag);
+		EDMA_EnableChannelInterrupts(DEV_BASE(dev), p_handle->channel,
+					     kEDMA_ErrorInterruptEnable);
+		EDMA_InstallTCD(DEV_BASE(dev), p_handle->channel, &tcdpool[channel][0]);
+	} else if (EDMA_SubmitTransfer(p_handle, &(data->transferConfig)) != kStatus_Success) {
+		ret = -EFAULT;
+	}
+
+	irq_unlock(key);
+
+	if (ret != 0) {
+		return ret;
+	}
+
+	return dma_mcux_edma_start(dev, channel);
+}
+
 static int dma_mcux_edma_get_status(const struct device *dev, uint32_t channel,
 				    struct dma_status *status)
 {
@@ -576,6 +658,8 @@ static const struct dma_driver_api dma_mcux_edma_api = {
 	.resume = dma_mcux_edma_resume,
 	.get_status = dma_mcux_edma_get_status,
 	.chan_filter = dma_mcux_edma_channel_filter,
+	.prepare = dma_mcux_edma_prepare,
+	.submit = dma_mcux_edma_submit,
 };
 
 static int dma_mcux_edma_init(const struct device *dev)
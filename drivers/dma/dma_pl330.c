@@ -312,12 +312,15 @@ static int dma_pl330_wait(uint32_t reg_base, int ch)
 	return 0;
 }
 
-static int dma_pl330_xfer(const struct device *dev, uint64_t dst,
+/* Write the microcode of a transfer of up to size bytes to the channel */
+static int dma_pl330_prog(const struct device *dev, uint64_t dst,
 			  uint64_t src, uint32_t size, uint32_t channel,
 			  uint32_t *xfer_size)
 {
 	struct dma_pl330_dev_data *const dev_data = dev->data;
+#ifdef CONFIG_DMA_64BIT
 	const struct dma_pl330_config *const dev_cfg = dev->config;
+#endif
 	struct dma_pl330_ch_config *channel_cfg;
 	struct dma_pl330_ch_internal *ch_handle;
 	int ret;
@@ -352,27 +355,50 @@ static int dma_pl330_xfer(const struct device *dev, uint64_t dst,
 	ret = dma_pl330_setup_ch(dev, ch_handle, channel);
 	if (ret) {
 		LOG_ERR("Failed to setup channel for DMA PL330");
-		goto err;
+		return ret;
 	}
 
+	*xfer_size = size;
+
+	return 0;
+}
+
+/* Run the microcode of the channel to completion */
+static int dma_pl330_run(const struct device *dev, uint32_t channel)
+{
+	struct dma_pl330_dev_data *const dev_data = dev->data;
+	const struct dma_pl330_config *const dev_cfg = dev->config;
+	int ret;
+
 	ret = dma_pl330_start_dma_ch(dev, dev_cfg->reg_base, channel,
-				     ch_handle->nonsec_mode);
+				     dev_data->channels[channel].internal.nonsec_mode);
 	if (ret) {
 		LOG_ERR("Failed to start DMA PL330");
-		goto err;
+		return ret;
 	}
 
 	ret = dma_pl330_wait(dev_cfg->reg_base, channel);
 	if (ret) {
 		LOG_ERR("Failed waiting to finish DMA PL330");
-		goto err;
 	}
 
-	*xfer_size = size;
-err:
 	return ret;
 }
 
+static int dma_pl330_xfer(const struct device *dev, uint64_t dst,
+			  uint64_t src, uint32_t size, uint32_t channel,
+			  uint32_t *xfer_size)
+{
+	int ret;
+
+	ret = dma_pl330_prog(dev, dst, src, size, channel, xfer_size);
+	if (ret) {
+		return ret;
+	}
+
+	return dma_pl330_run(dev, channel);
+}
+
 #if CONFIG_DMA_64BIT
 static int dma_pl330_handle_boundary(const struct device *dev, uint64_t dst,
 				     uint64_t src, uint32_t channel,
@@ -479,6 +505,7 @@ static int dma_pl330_configure(const struct device *dev, uint32_t channel,
 		return -EBUSY;
 	}
 	channel_cfg->channel_active = 1;
+	channel_cfg->prepared = NULL;
 	k_mutex_unlock(&channel_cfg->ch_mutex);
 
 	if (cfg->channel_direction != MEMORY_TO_MEMORY) {
@@ -538,6 +565,85 @@ static int dma_pl330_transfer_start(const struct device *dev,
 	return ret;
 }
 
+static int dma_pl330_prepare(const struct device *dev, struct dma_prepared *prep)
+{
+	struct dma_pl330_dev_data *const dev_data = dev->data;
+	struct dma_pl330_ch_config *channel_cfg;
+	uint32_t xfer_size = 0;
+	int ret;
+
+	ret = dma_pl330_configure(dev, prep->channel, prep->config);
+	if (ret) {
+		return ret;
+	}
+
+	channel_cfg = &dev_data->channels[prep->channel];
+
+	/*
+	 * The microcode is kept only when a single program moves the whole
+	 * transfer, otherwise each submit generates the programs again.
+	 */
+#if CONFIG_DMA_64BIT
+	if ((channel_cfg->trans_size <= (PL330_MAX_OFFSET - (uint32_t)channel_cfg->dst_addr)) &&
+	    (channel_cfg->trans_size <= (PL330_MAX_OFFSET - (uint32_t)channel_cfg->src_addr)))
+#endif
+	{
+		ret = dma_pl330_prog(dev, channel_cfg->dst_addr,
+				     channel_cfg->src_addr, channel_cfg->trans_size,
+				     prep->channel, &xfer_size);
+	}
+
+	k_mutex_lock(&channel_cfg->ch_mutex, K_FOREVER);
+	if ((ret == 0) && (xfer_size == channel_cfg->trans_size)) {
+		channel_cfg->prepared = prep;
+	}
+	channel_cfg->channel_active = 0;
+	k_mutex_unlock(&channel_cfg->ch_mutex);
+
+	return ret;
+}
+
+static int dma_pl330_submit_prepared(const struct device *dev,
+				     struct dma_prepared *prep)
+{
+	struct dma_pl330_dev_data *const dev_data = dev->data;
+	struct dma_pl330_ch_config *channel_cfg;
+	int ret;
+
+	if (prep->channel >= MAX_DMA_CHANNELS) {
+		return -EINVAL;
+	}
+
+	channel_cfg = &dev_data->channels[prep->channel];
+
+	k_mutex_lock(&channel_cfg->ch_mutex, K_FOREVER);
+	if (channel_cfg->prepared != prep) {
+		k_mutex_unlock(&channel_cfg->ch_mutex);
+
+		ret = dma_pl330_configure(dev, prep->channel, prep->config);
+		if (ret) {
+			return ret;
+		}
+
+		return dma_pl330_transfer_start(dev, prep->channel);
+	}
+
+	if (channel_cfg->channel_active) {
+		k_mutex_unlock(&channel_cfg->ch_mutex);
+		return -EBUSY;
+	}
+	channel_cfg->channel_active = 1;
+	k_mutex_unlock(&channel_cfg->ch_mutex);
+
+	ret = dma_pl330_run(dev, prep->channel);
+
+	k_mutex_lock(&channel_cfg->ch_mutex, K_FOREVER);
+	channel_cfg->channel_active = 0;
+	k_mutex_unlock(&channel_cfg->ch_mutex);
+
+	return ret;
+}
+
 static int dma_pl330_transfer_stop(const struct device *dev, uint32_t channel)
 {
 	if (channel >= MAX_DMA_CHANNELS) {
@@ -569,6 +675,8 @@ static const struct dma_driver_api pl330_driver_api = {
 	.config = dma_pl330_configure,
 	.start = dma_pl330_transfer_start,
 	.stop = dma_pl330_transfer_stop,
+	.prepare = dma_pl330_prepare,
+	.submit = dma_pl330_submit_prepared,
 };
 
 static const struct dma_pl330_config pl330_config = {
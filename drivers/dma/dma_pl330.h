@@ -153,6 +153,8 @@ struct dma_pl330_ch_config {
 	mem_addr_t dma_exec_addr;
 	struct k_mutex ch_mutex;
 	int channel_active;
+	/* Transfer whose microcode is held by the channel */
+	struct dma_prepared *prepared;
 
 	/* Channel specific private data */
 	struct dma_pl330_ch_internal internal;
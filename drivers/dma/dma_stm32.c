@@ -298,6 +298,8 @@ DMA_STM32_EXPORT_API int dma_stm32_configure(const struct device *dev,
 		return -EBUSY;
 	}
 
+	stream->prepared = NULL;
+
 	if (dma_stm32_disable_stream(dma, id) != 0) {
 		LOG_ERR("could not disable dma stream %d.", id);
 		return -EBUSY;
@@ -685,12 +687,74 @@ DMA_STM32_EXPORT_API int dma_stm32_get_status(const struct device *dev,
 	return 0;
 }
 
+static int dma_stm32_prepare(const struct device *dev, struct dma_prepared *prep)
+{
+	const struct dma_stm32_config *config = dev->config;
+	uint32_t id = prep->channel - STM32_DMA_STREAM_OFFSET;
+	int ret;
+
+	if (id >= config->max_streams) {
+		return -EINVAL;
+	}
+
+	/* A stream moves a single block, its registers are the descriptor */
+	if (prep->config->block_count > 1) {
+		return -ENOTSUP;
+	}
+
+	ret = dma_stm32_configure(dev, prep->channel, prep->config);
+	if (ret == 0) {
+		config->streams[id].prepared = prep;
+		/* Nothing runs until the first submit */
+		config->streams[id].busy = false;
+	}
+
+	return ret;
+}
+
+static int dma_stm32_submit(const struct device *dev, struct dma_prepared *prep)
+{
+	const struct dma_stm32_config *config = dev->config;
+	DMA_TypeDef *dma = (DMA_TypeDef *)(config->base);
+	uint32_t id = prep->channel - STM32_DMA_STREAM_OFFSET;
+	struct dma_block_config *block = prep->config->head_block;
+	int ret;
+
+	if (id >= config->max_streams) {
+		return -EINVAL;
+	}
+
+	if (config->streams[id].prepared != prep) {
+		ret = dma_stm32_prepare(dev, prep);
+		if (ret != 0) {
+			return ret;
+		}
+
+		return dma_stm32_start(dev, prep->channel);
+	}
+
+	if (stm32_dma_is_enabled_stream(dma, id)) {
+		return -EBUSY;
+	}
+
+	/* Only the addresses and the length of the stream need to be set
+	 * again, the interrupt may have been disabled by a stop.
+	 */
+	dma_stm32_clear_stream_irq(dev, id);
+	LL_DMA_EnableIT_TC(dma, dma_stm32_id_to_stream(id));
+
+	return dma_stm32_reload(dev, prep->channel, block->source_address,
+				block->dest_address, block->block_size);
+}
+
 static const struct dma_driver_api dma_funcs = {
 	.reload		 = dma_stm32_reload,
 	.config		 = dma_stm32_configure,
 	.start		 = dma_stm32_start,
 	.stop		 = dma_stm32_stop,
 	.get_status	 = dma_stm32_get_status,
+	.prepare	 = dma_stm32_prepare,
+	.submit		 = dma_stm32_submit,
 };
 
 #define DMA_STM32_INIT_DEV(index)					\
@@ -28,6 +28,8 @@ struct dma_stm32_stream {
 	void *user_data; /* holds the client data */
 	dma_callback_t dma_callback;
 	bool cyclic;
+	/* Transfer the stream registers are set up for, see dma_prepare() */
+	struct dma_prepared *prepared;
 };
 
 struct dma_stm32_data {
@@ -57,6 +57,9 @@ LOG_MODULE_REGISTER(LOG_MODULE_NAME);
 #endif
 
 #include "eth.h"
+#if defined(CONFIG_ETH_RX_POLL)
+#include "eth_rx_poll.h"
+#endif
 
 #define PHY_OMS_OVERRIDE_REG 0x16U      /* The PHY Operation Mode Strap Override register. */
 #define PHY_OMS_STATUS_REG 0x17U        /* The PHY Operation Mode Strap Status register. */
@@ -181,7 +184,11 @@ struct eth_context {
 	struct k_sem tx_buf_sem;
 	phy_handle_t *phy_handle;
 	struct _phy_resource *phy_config;
+#if defined(CONFIG_ETH_RX_POLL)
+	struct eth_rx_poll rx_poll;
+#else
 	struct k_sem rx_thread_sem;
+#endif
 	enum eth_mcux_phy_state phy_state;
 	bool enabled;
 	bool link_up;
@@ -195,8 +202,10 @@ struct eth_context {
 	struct k_work phy_work;
 	struct k_work_delayable delayed_phy_work;
 
+#if !defined(CONFIG_ETH_RX_POLL)
 	K_KERNEL_STACK_MEMBER(rx_thread_stack, ETH_MCUX_RX_THREAD_STACK_SIZE);
 	struct k_thread rx_thread;
+#endif
 
 	/* TODO: FIXME. This Ethernet frame sized buffer is used for
 	 * interfacing with MCUX. How it works is that hardware uses
@@ -939,7 +948,11 @@ static void eth_callback(ENET_Type *base, enet_handle_t *handle,
 
 	switch (event) {
 	case kENET_RxEvent:
+#if defined(CONFIG_ETH_RX_POLL)
+		eth_rx_poll_schedule(&context->rx_poll);
+#else
 		k_sem_give(&context->rx_thread_sem);
+#endif
 		break;
 	case kENET_TxEvent:
 #if defined(CONFIG_PTP_CLOCK_MCUX) && defined(CONFIG_NET_L2_PTP)
@@ -966,6 +979,34 @@ static void eth_callback(ENET_Type *base, enet_handle_t *handle,
 	}
 }
 
+#if defined(CONFIG_ETH_RX_POLL)
+static int eth_rx_poll(struct eth_rx_poll *poll, int budget)
+{
+	struct eth_context *context =
+		CONTAINER_OF(poll, struct eth_context, rx_poll);
+	int count = 0;
+
+	while (count < budget && eth_rx(context) == 1) {
+		count++;
+	}
+
+	return count;
+}
+
+static void eth_rx_poll_irq(struct eth_rx_poll *poll, bool enable)
+{
+	struct eth_context *context =
+		CONTAINER_OF(poll, struct eth_context, rx_poll);
+
+	if (enable) {
+		ENET_EnableInterrupts(context->base,
+		  kENET_RxFrameInterrupt | kENET_RxBufferInterrupt);
+	} else {
+		ENET_DisableInterrupts(context->base,
+		  kENET_RxFrameInterrupt | kENET_RxBufferInterrupt);
+	}
+}
+#else
 static void eth_rx_thread(void *arg1, void *unused1, void *unused2)
 {
 	struct eth_context *context = (struct eth_context *)arg1;
@@ -981,6 +1022,7 @@ static void eth_rx_thread(void *arg1, void *unused1, void *unused2)
 		}
 	}
 }
+#endif /* CONFIG_ETH_RX_POLL */
 
 #if defined(CONFIG_ETH_MCUX_PHY_RESET)
 static int eth_phy_reset(const struct device *dev)
@@ -1136,13 +1178,18 @@ static int eth_init(const struct device *dev)
 	k_mutex_init(&context->rx_frame_buf_mutex);
 	k_mutex_init(&context->tx_frame_buf_mutex);
 
+#if !defined(CONFIG_ETH_RX_POLL)
 	k_sem_init(&context->rx_thread_sem, 0, CONFIG_ETH_MCUX_RX_BUFFERS);
+#endif
 	k_sem_init(&context->tx_buf_sem,
 		   CONFIG_ETH_MCUX_TX_BUFFERS, CONFIG_ETH_MCUX_TX_BUFFERS);
 	k_work_init(&context->phy_work, eth_mcux_phy_work);
 	k_work_init_delayable(&context->delayed_phy_work,
 			      eth_mcux_delayed_phy_work);
 
+#if defined(CONFIG_ETH_RX_POLL)
+	eth_rx_poll_init(&context->rx_poll, eth_rx_poll, eth_rx_poll_irq);
+#else
 	/* Start interruption-poll thread */
 	k_thread_create(&context->rx_thread, context->rx_thread_stack,
 			K_KERNEL_STACK_SIZEOF(context->rx_thread_stack),
@@ -1150,6 +1197,7 @@ static int eth_init(const struct device *dev)
 			K_PRIO_COOP(2),
 			0, K_NO_WAIT);
 	k_thread_name_set(&context->rx_thread, "mcux_eth_rx");
+#endif
 	if (context->generate_mac) {
 		context->generate_mac(context->mac_addr);
 	}
@@ -1236,6 +1284,9 @@ static enum ethernet_hw_caps eth_mcux_get_capabilities(const struct device *dev)
 #if defined(CONFIG_ETH_MCUX_HW_ACCELERATION)
 		ETHERNET_HW_TX_CHKSUM_OFFLOAD |
 		ETHERNET_HW_RX_CHKSUM_OFFLOAD |
+#endif
+#if defined(CONFIG_ETH_RX_POLL)
+		ETHERNET_RX_COALESCE |
 #endif
 		ETHERNET_AUTO_NEGOTIATION_SET |
 		ETHERNET_LINK_100BASE_T;
@@ -1262,12 +1313,36 @@ static int eth_mcux_set_config(const struct device *dev,
 			context->mac_addr[2], context->mac_addr[3],
 			context->mac_addr[4], context->mac_addr[5]);
 		return 0;
+#if defined(CONFIG_ETH_RX_POLL)
+	case ETHERNET_CONFIG_TYPE_RX_COALESCE:
+		return eth_rx_poll_set_config(&context->rx_poll,
+					      &config->rx_coalesce);
+#endif
+	default:
+		break;
+	}
+
+	return -ENOTSUP;
+}
+
+#if defined(CONFIG_ETH_RX_POLL)
+static int eth_mcux_get_config(const struct device *dev,
+			       enum ethernet_config_type type,
+			       struct ethernet_config *config)
+{
+	struct eth_context *context = dev->data;
+
+	switch (type) {
+	case ETHERNET_CONFIG_TYPE_RX_COALESCE:
+		eth_rx_poll_get_config(&context->rx_poll, &config->rx_coalesce);
+		return 0;
 	default:
 		break;
 	}
 
 	return -ENOTSUP;
 }
+#endif
 
 #if defined(CONFIG_PTP_CLOCK_MCUX)
 static const struct device *eth_mcux_get_ptp_clock(const struct device *dev)
@@ -1285,6 +1360,9 @@ static const struct ethernet_api api_funcs = {
 #endif
 	.get_capabilities	= eth_mcux_get_capabilities,
 	.set_config		= eth_mcux_set_config,
+#if defined(CONFIG_ETH_RX_POLL)
+	.get_config		= eth_mcux_get_config,
+#endif
 #if defined(CONFIG_NET_DSA)
 	.send                   = dsa_tx,
 #else
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <zephyr/sys/util.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(eth_rx_poll, CONFIG_ETHERNET_LOG_LEVEL);
+
+#include "eth_rx_poll.h"
+
+static K_KERNEL_STACK_DEFINE(rx_poll_stack, CONFIG_ETH_RX_POLL_STACK_SIZE);
+static struct k_work_q rx_poll_work_q;
+
+static uint32_t rx_poll_budget(const struct ethernet_rx_coalesce *config)
+{
+	return config->frames ? config->frames : CONFIG_ETH_RX_POLL_BUDGET;
+}
+
+/* With adaptive coalescing the delay is proportional to the number of
+ * frames found since the previous delay, so a single frame now and then
+ * unmasks the interrupt right away while a full budget waits usecs.
+ */
+static uint32_t rx_poll_delay(struct eth_rx_poll *poll, uint32_t budget)
+{
+	uint32_t delay = poll->config.usecs;
+
+	if (poll->config.adaptive) {
+		if (poll->frames <= 1U) {
+			delay = 0U;
+		} else {
+			delay = (uint64_t)delay * MIN(poll->frames, budget) / budget;
+		}
+	}
+
+	poll->frames = 0U;
+
+	return delay;
+}
+
+static void rx_poll_work(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct eth_rx_poll *poll = CONTAINER_OF(dwork, struct eth_rx_poll, work);
+	k_spinlock_key_t key;
+	uint32_t budget;
+	uint32_t delay;
+	int count;
+
+	key = k_spin_lock(&poll->lock);
+	budget = rx_poll_budget(&poll->config);
+	k_spin_unlock(&poll->lock, key);
+
+	count = poll->poll_cb(poll, budget);
+	if (count < 0) {
+		count = 0;
+	}
+
+	key = k_spin_lock(&poll->lock);
+
+	poll->frames += count;
+
+	if ((uint32_t)count >= budget) {
+		/* More frames are likely pending, yield and continue */
+		k_spin_unlock(&poll->lock, key);
+		k_work_schedule_for_queue(&rx_poll_work_q, &poll->work,
+					  K_NO_WAIT);
+		return;
+	}
+
+	delay = rx_poll_delay(poll, budget);
+
+	k_spin_unlock(&poll->lock, key);
+
+	if (count == 0 || delay == 0U) {
+		poll->irq_cb(poll, true);
+		return;
+	}
+
+	/* Leave the interrupt masked and collect what arrives meanwhile */
+	k_work_schedule_for_queue(&rx_poll_work_q, &poll->work, K_USEC(delay));
+}
+
+void eth_rx_poll_init(struct eth_rx_poll *poll, eth_rx_poll_cb_t poll_cb,
+		      eth_rx_poll_irq_cb_t irq_cb)
+{
+	k_work_init_delayable(&poll->work, rx_poll_work);
+	poll->poll_cb = poll_cb;
+	poll->irq_cb = irq_cb;
+	poll->config.usecs = CONFIG_ETH_RX_POLL_COALESCE_USECS;
+	poll->config.frames = 0U;
+	poll->config.adaptive = IS_ENABLED(CONFIG_ETH_RX_POLL_ADAPTIVE);
+	poll->frames = 0U;
+}
+
+void eth_rx_poll_schedule(struct eth_rx_poll *poll)
+{
+	poll->irq_cb(poll, false);
+
+	k_work_schedule_for_queue(&rx_poll_work_q, &poll->work, K_NO_WAIT);
+}
+
+int eth_rx_poll_set_config(struct eth_rx_poll *poll,
+			   const struct ethernet_rx_coalesce *config)
+{
+	k_spinlock_key_t key;
+
+	if (config->usecs > CONFIG_ETH_RX_POLL_COALESCE_MAX_USECS) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&poll->lock);
+	poll->config = *config;
+	poll->frames = 0U;
+	k_spin_unlock(&poll->lock, key);
+
+	LOG_DBG("RX coalescing %u us, %u frames%s", config->usecs,
+		config->frames, config->adaptive ? ", adaptive" : "");
+
+	return 0;
+}
+
+void eth_rx_poll_get_config(struct eth_rx_poll *poll,
+			    struct ethernet_rx_coalesce *config)
+{
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&poll->lock);
+	*config = poll->config;
+	k_spin_unlock(&poll->lock, key);
+}
+
+static int eth_rx_poll_work_q_init(void)
+{
+	struct k_work_queue_config cfg = {
+		.name = "eth_rx_poll",
+		.no_yield = false,
+	};
+
+	k_work_queue_start(&rx_poll_work_q, rx_poll_stack,
+			   K_KERNEL_STACK_SIZEOF(rx_poll_stack),
+			   CONFIG_ETH_RX_POLL_THREAD_PRIO, &cfg);
+
+	return 0;
+}
+
+SYS_INIT(eth_rx_poll_work_q_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_DRIVERS_ETHERNET_ETH_RX_POLL_H_
+#define ZEPHYR_DRIVERS_ETHERNET_ETH_RX_POLL_H_
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/ethernet.h>
+
+/*
+ * Interrupt mitigated RX polling shared by the Ethernet drivers.
+ *
+ * The RX interrupt handler calls eth_rx_poll_schedule(), which masks the
+ * RX interrupt and queues the poll work. The work calls the driver poll
+ * callback with a frame budget; as long as the budget is used up the work
+ * is queued again, so a busy port cannot starve the other work items.
+ * Once the ring is drained the interrupt is unmasked, optionally after a
+ * coalescing delay during which frames accumulate in the ring and are
+ * then fetched by one more poll.
+ */
+
+struct eth_rx_poll;
+
+/* Receive up to budget frames, return the number of frames received.
+ * Returning less than budget means the RX ring is empty.
+ */
+typedef int (*eth_rx_poll_cb_t)(struct eth_rx_poll *poll, int budget);
+
+/* Mask (enable == false) or unmask the RX interrupt of the device. A frame
+ * received while the interrupt was masked must raise the interrupt again
+ * once it is unmasked.
+ */
+typedef void (*eth_rx_poll_irq_cb_t)(struct eth_rx_poll *poll, bool enable);
+
+struct eth_rx_poll {
+	struct k_work_delayable work;
+	eth_rx_poll_cb_t poll_cb;
+	eth_rx_poll_irq_cb_t irq_cb;
+	struct k_spinlock lock;
+	struct ethernet_rx_coalesce config;
+	/* Frames received since the interrupt was last masked or the last
+	 * coalescing delay was computed.
+	 */
+	uint32_t frames;
+};
+
+void eth_rx_poll_init(struct eth_rx_poll *poll, eth_rx_poll_cb_t poll_cb,
+		      eth_rx_poll_irq_cb_t irq_cb);
+
+/* Called from the RX interrupt handler */
+void eth_rx_poll_schedule(struct eth_rx_poll *poll);
+
+int eth_rx_poll_set_config(struct eth_rx_poll *poll,
+			   const struct ethernet_rx_coalesce *config);
+
+void eth_rx_poll_get_config(struct eth_rx_poll *poll,
+			    struct ethernet_rx_coalesce *config);
+
+#endif /* ZEPHYR_DRIVERS_ETHERNET_ETH_RX_POLL_H_ */
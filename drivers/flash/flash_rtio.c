@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/flash.h>
+#include <zephyr/rtio/rtio.h>
+#include <zephyr/rtio/rtio_mpsc.h>
+#include <zephyr/sys/byteorder.h>
+
+/*
+ * A request is a transaction of two submission queue entries: a tiny write
+ * holding the operation and the offset, followed by the read or write of
+ * the data, or by an empty write giving the size of an erase.  The
+ * completion of the first entry reports the result, the second one
+ * produces no completion.
+ */
+
+#define FLASH_RTIO_READ  0
+#define FLASH_RTIO_WRITE 1
+#define FLASH_RTIO_ERASE 2
+
+#define FLASH_RTIO_HDR_LEN (1 + sizeof(uint32_t))
+
+struct flash_rtio_worker {
+	struct rtio_mpsc q;
+	struct k_sem sem;
+};
+
+/* Reads and the other operations are run by different threads, so a read
+ * does not wait for the end of an erase.
+ */
+static struct flash_rtio_worker flash_rtio_rd = {
+	.q = RTIO_MPSC_INIT(flash_rtio_rd.q),
+	.sem = Z_SEM_INITIALIZER(flash_rtio_rd.sem, 0, K_SEM_MAX_LIMIT),
+};
+
+static struct flash_rtio_worker flash_rtio_wr = {
+	.q = RTIO_MPSC_INIT(flash_rtio_wr.q),
+	.sem = Z_SEM_INITIALIZER(flash_rtio_wr.sem, 0, K_SEM_MAX_LIMIT),
+};
+
+static struct rtio_sqe *flash_rtio_prep(struct rtio *r, struct rtio_iodev *iodev,
+					uint8_t cmd, off_t offset, uint8_t *data,
+					size_t len, void *userdata)
+{
+	struct rtio_sqe *head, *sqe;
+	uint8_t hdr[FLASH_RTIO_HDR_LEN];
+
+	if ((offset < 0) || (offset > UINT32_MAX)) {
+		return NULL;
+	}
+
+	head = rtio_sqe_acquire(r);
+	sqe = rtio_sqe_acquire(r);
+	if ((head == NULL) || (sqe == NULL)) {
+		rtio_sqe_drop_all(r);
+		return NULL;
+	}
+
+	hdr[0] = cmd;
+	sys_put_le32((uint32_t)offset, &hdr[1]);
+	rtio_sqe_prep_tiny_write(head, iodev, RTIO_PRIO_NORM, hdr, sizeof(hdr),
+				 userdata);
+	head->flags |= RTIO_SQE_TRANSACTION;
+
+	if (cmd == FLASH_RTIO_READ) {
+		rtio_sqe_prep_read(sqe, iodev, RTIO_PRIO_NORM, data, len, userdata);
+	} else {
+		rtio_sqe_prep_write(sqe, iodev, RTIO_PRIO_NORM, data, len, userdata);
+	}
+	sqe->flags |= RTIO_SQE_NO_RESPONSE;
+
+	return sqe;
+}
+
+struct rtio_sqe *flash_rtio_read(struct rtio *r, struct rtio_iodev *iodev,
+				 off_t offset, void *data, size_t len,
+				 void *userdata)
+{
+	return flash_rtio_prep(r, iodev, FLASH_RTIO_READ, offset, data, len,
+			       userdata);
+}
+
+struct rtio_sqe *flash_rtio_write(struct rtio *r, struct rtio_iodev *iodev,
+				  off_t offset, const void *data, size_t len,
+				  void *userdata)
+{
+	return flash_rtio_prep(r, iodev, FLASH_RTIO_WRITE, offset,
+			       (uint8_t *)data, len, userdata);
+}
+
+struct rtio_sqe *flash_rtio_erase(struct rtio *r, struct rtio_iodev *iodev,
+				  off_t offset, size_t size, void *userdata)
+{
+	return flash_rtio_prep(r, iodev, FLASH_RTIO_ERASE, offset, NULL, size,
+			       userdata);
+}
+
+static void flash_rtio_exec(struct rtio_iodev_sqe *iodev_sqe)
+{
+	const struct device *dev = iodev_sqe->sqe.iodev->data;
+	const struct rtio_sqe *head = &iodev_sqe->sqe;
+	const struct rtio_iodev_sqe *data = rtio_txn_next(iodev_sqe);
+	off_t offset;
+	int rc;
+
+	if ((data == NULL) || (head->tiny_buf_len != FLASH_RTIO_HDR_LEN)) {
+		rtio_iodev_sqe_err(iodev_sqe, -EINVAL);
+		return;
+	}
+
+	offset = sys_get_le32(&head->tiny_buf[1]);
+
+	switch (head->tiny_buf[0]) {
+	case FLASH_RTIO_READ:
+		rc = flash_read(dev, offset, data->sqe.buf, data->sqe.buf_len);
+		break;
+	case FLASH_RTIO_WRITE:
+		rc = flash_write(dev, offset, data->sqe.buf, data->sqe.buf_len);
+		break;
+	case FLASH_RTIO_ERASE:
+		rc = flash_erase(dev, offset, data->sqe.buf_len);
+		break;
+	default:
+		rc = -EINVAL;
+		break;
+	}
+
+	if (rc == 0) {
+		rtio_iodev_sqe_ok(iodev_sqe, 0);
+	} else {
+		rtio_iodev_sqe_err(iodev_sqe, rc);
+	}
+}
+
+static void flash_iodev_submit(struct rtio_iodev_sqe *iodev_sqe)
+{
+	const struct rtio_sqe *head = &iodev_sqe->sqe;
+	struct flash_rtio_worker *worker;
+
+	if ((head->op != RTIO_OP_TINY_TX) || (head->tiny_buf_len == 0U)) {
+		rtio_iodev_sqe_err(iodev_sqe, -EINVAL);
+		return;
+	}
+
+	worker = (head->tiny_buf[0] == FLASH_RTIO_READ) ? &flash_rtio_rd : &flash_rtio_wr;
+
+	rtio_mpsc_push(&worker->q, &iodev_sqe->q);
+	k_sem_give(&worker->sem);
+}
+
+const struct rtio_iodev_api flash_iodev_api = {
+	.submit = flash_iodev_submit,
+};
+
+static void flash_rtio_thread(void *p1, void *p2, void *p3)
+{
+	struct flash_rtio_worker *worker = p1;
+	struct rtio_mpsc_node *node;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		k_sem_take(&worker->sem, K_FOREVER);
+
+		/* The push of a preempted submitter may not be visible yet */
+		while ((node = rtio_mpsc_pop(&worker->q)) == NULL) {
+			k_sleep(K_TICKS(1));
+		}
+
+		flash_rtio_exec(CONTAINER_OF(node, struct rtio_iodev_sqe, q));
+	}
+}
+
+K_THREAD_DEFINE(flash_rtio_rd_thread, CONFIG_FLASH_RTIO_STACK_SIZE,
+		flash_rtio_thread, &flash_rtio_rd, NULL, NULL,
+		CONFIG_FLASH_RTIO_THREAD_PRIORITY, 0, 0);
+
+K_THREAD_DEFINE(flash_rtio_wr_thread, CONFIG_FLASH_RTIO_STACK_SIZE,
+		flash_rtio_thread, &flash_rtio_wr, NULL, NULL,
+		CONFIG_FLASH_RTIO_THREAD_PRIORITY, 0, 0);
@@ -150,6 +150,17 @@ struct spi_nor_data {
 	 */
 	bool flag_access_32bit: 1;
 
+#ifdef CONFIG_SPI_NOR_ERASE_SUSPEND
+	/* Protects erase_busy and the status polls of a running erase */
+	struct k_mutex susp_lock;
+
+	/* Cycle count at which the running erase was last resumed */
+	uint32_t resume_cycles;
+
+	/* Set while a suspendable erase runs in the device */
+	bool erase_busy;
+#endif /* CONFIG_SPI_NOR_ERASE_SUSPEND */
+
 	/* Minimal SFDP stores no dynamic configuration.  Runtime and
 	 * devicetree store page size and erase_types; runtime also
 	 * stores flash size and layout.
@@ -192,6 +203,10 @@ static const struct jesd216_erase_type minimal_erase_types[JESD216_NUM_ERASE_TYP
 #define WAIT_READY_WRITE K_TICKS(1)
 /* Erases can range from 45ms to 240sec */
 #define WAIT_READY_ERASE K_MSEC(50)
+/* Time an erase runs between a resume and the next suspend, so that it
+ * still progresses under a stream of reads
+ */
+#define T_ERASE_RUN_US 100
 
 static int spi_nor_write_protection_set(const struct device *dev,
 					bool write_protect);
@@ -303,6 +318,11 @@ static inline void delay_until_exit_dpd_ok(const struct device *const dev)
  */
 #define NOR_ACCESS_32BIT_ADDR BIT(2)
 
+/* Indicates that a dummy byte follows the address, as needed by the
+ * Fast Read instruction.
+ */
+#define NOR_ACCESS_DUMMY_BYTE BIT(3)
+
 /* Indicates that an access command is performing a write.  If not
  * provided access is a read.
  */
@@ -328,7 +348,7 @@ static int spi_nor_access(const struct device *const dev,
 	struct spi_nor_data *const driver_data = dev->data;
 	bool is_addressed = (access & NOR_ACCESS_ADDRESSED) != 0U;
 	bool is_write = (access & NOR_ACCESS_WRITE) != 0U;
-	uint8_t buf[5] = { 0 };
+	uint8_t buf[6] = { 0 };
 	struct spi_buf spi_buf[2] = {
 		{
 			.buf = buf,
@@ -363,6 +383,11 @@ static int spi_nor_access(const struct device *const dev,
 		}
 	};
 
+	if ((access & NOR_ACCESS_DUMMY_BYTE) != 0U) {
+		/* buf is zero-initialized */
+		spi_buf[0].len += 1;
+	}
+
 	const struct spi_buf_set tx_set = {
 		.buffers = spi_buf,
 		.count = (length != 0) ? 2 : 1,
@@ -384,6 +409,14 @@ static int spi_nor_access(const struct device *const dev,
 	spi_nor_access(dev, opcode, 0, 0, dest, length)
 #define spi_nor_cmd_addr_read(dev, opcode, addr, dest, length) \
 	spi_nor_access(dev, opcode, NOR_ACCESS_ADDRESSED, addr, dest, length)
+#ifdef CONFIG_SPI_NOR_FAST_READ
+#define spi_nor_data_read(dev, addr, dest, length) \
+	spi_nor_access(dev, SPI_NOR_CMD_READ_FAST, \
+		       NOR_ACCESS_ADDRESSED | NOR_ACCESS_DUMMY_BYTE, addr, dest, length)
+#else
+#define spi_nor_data_read(dev, addr, dest, length) \
+	spi_nor_cmd_addr_read(dev, SPI_NOR_CMD_READ, addr, dest, length)
+#endif /* CONFIG_SPI_NOR_FAST_READ */
 #define spi_nor_cmd_write(dev, opcode) \
 	spi_nor_access(dev, opcode, NOR_ACCESS_WRITE, 0, NULL, 0)
 #define spi_nor_cmd_addr_write(dev, opcode, addr, src, length) \
@@ -534,6 +567,97 @@ static void release_device(const struct device *dev)
 	}
 }
 
+/* Wait for the end of an erase.  With CONFIG_SPI_NOR_ERASE_SUSPEND the
+ * status is polled under susp_lock, so that spi_nor_read_suspended() can
+ * suspend the erase between the polls.
+ *
+ * @note The device must be externally acquired before invoking this
+ * function.
+ */
+static int spi_nor_erase_wait(const struct device *dev, bool suspendable)
+{
+#ifdef CONFIG_SPI_NOR_ERASE_SUSPEND
+	struct spi_nor_data *const driver_data = dev->data;
+	uint8_t reg;
+	int ret;
+
+	if (!suspendable) {
+		return spi_nor_wait_until_ready(dev, WAIT_READY_ERASE);
+	}
+
+	k_mutex_lock(&driver_data->susp_lock, K_FOREVER);
+	driver_data->resume_cycles = k_cycle_get_32();
+	driver_data->erase_busy = true;
+
+	while (true) {
+		ret = spi_nor_cmd_read(dev, SPI_NOR_CMD_RDSR, &reg, sizeof(reg));
+		/* Exit on error or no longer WIP */
+		if (ret || !(reg & SPI_NOR_WIP_BIT)) {
+			break;
+		}
+
+		k_mutex_unlock(&driver_data->susp_lock);
+		k_sleep(WAIT_READY_ERASE);
+		k_mutex_lock(&driver_data->susp_lock, K_FOREVER);
+	}
+
+	driver_data->erase_busy = false;
+	k_mutex_unlock(&driver_data->susp_lock);
+
+	return ret;
+#else
+	ARG_UNUSED(suspendable);
+
+	return spi_nor_wait_until_ready(dev, WAIT_READY_ERASE);
+#endif /* CONFIG_SPI_NOR_ERASE_SUSPEND */
+}
+
+#ifdef CONFIG_SPI_NOR_ERASE_SUSPEND
+/* Read while another thread waits for the end of an erase, suspending the
+ * erase for the duration of the read.  Data read from the block being
+ * erased is undefined.
+ *
+ * @return false if no erase runs, the read must then acquire the device.
+ */
+static bool spi_nor_read_suspended(const struct device *dev, off_t addr,
+				   void *dest, size_t size, int *ret)
+{
+	struct spi_nor_data *const driver_data = dev->data;
+	uint32_t run_us;
+	int ret2;
+
+	k_mutex_lock(&driver_data->susp_lock, K_FOREVER);
+	if (!driver_data->erase_busy) {
+		k_mutex_unlock(&driver_data->susp_lock);
+		return false;
+	}
+
+	run_us = k_cyc_to_us_floor32(k_cycle_get_32() - driver_data->resume_cycles);
+	if (run_us < T_ERASE_RUN_US) {
+		k_busy_wait(T_ERASE_RUN_US - run_us);
+	}
+
+	*ret = spi_nor_cmd_write(dev, SPI_NOR_CMD_ERSUS);
+	if (*ret == 0) {
+		/* WIP is cleared once the erase is suspended */
+		*ret = spi_nor_wait_until_ready(dev, WAIT_READY_REGISTER);
+	}
+	if (*ret == 0) {
+		*ret = spi_nor_data_read(dev, addr, dest, size);
+	}
+
+	ret2 = spi_nor_cmd_write(dev, SPI_NOR_CMD_ERRES);
+	driver_data->resume_cycles = k_cycle_get_32();
+	k_mutex_unlock(&driver_data->susp_lock);
+
+	if (*ret == 0) {
+		*ret = ret2;
+	}
+
+	return true;
+}
+#endif /* CONFIG_SPI_NOR_ERASE_SUSPEND */
+
 /**
  * @brief Read the status register.
  *
@@ -712,9 +836,16 @@ static int spi_nor_read(const struct device *dev, off_t addr, void *dest,
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_SPI_NOR_ERASE_SUSPEND
+	/* Don't wait for the end of a running erase */
+	if (spi_nor_read_suspended(dev, addr, dest, size, &ret)) {
+		return ret;
+	}
+#endif /* CONFIG_SPI_NOR_ERASE_SUSPEND */
+
 	acquire_device(dev);
 
-	ret = spi_nor_cmd_addr_read(dev, SPI_NOR_CMD_READ, addr, dest, size);
+	ret = spi_nor_data_read(dev, addr, dest, size);
 
 	release_device(dev);
 	return ret;
@@ -827,6 +958,8 @@ static int spi_nor_erase(const struct device *dev, off_t addr, size_t size)
 	ret = spi_nor_write_protection_set(dev, false);
 
 	while ((size > 0) && (ret == 0)) {
+		bool suspendable = (size != flash_size);
+
 		spi_nor_cmd_write(dev, SPI_NOR_CMD_WREN);
 
 		if (size == flash_size) {
@@ -871,7 +1004,7 @@ static int spi_nor_erase(const struct device *dev, off_t addr, size_t size)
 		 */
 		volatile int xcc_ret =
 #endif
-		spi_nor_wait_until_ready(dev, WAIT_READY_ERASE);
+		spi_nor_erase_wait(dev, suspendable);
 	}
 
 	int ret2 = spi_nor_write_protection_set(dev, true);
@@ -1412,6 +1545,9 @@ static int spi_nor_init(const struct device *dev)
 		struct spi_nor_data *const driver_data = dev->data;
 
 		k_sem_init(&driver_data->sem, 1, K_SEM_MAX_LIMIT);
+#ifdef CONFIG_SPI_NOR_ERASE_SUSPEND
+		k_mutex_init(&driver_data->susp_lock);
+#endif
 	}
 
 #if ANY_INST_HAS_WP_GPIOS
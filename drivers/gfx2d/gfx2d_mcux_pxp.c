@@ -0,0 +1,297 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT nxp_pxp
+
+#include <zephyr/cache.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/gfx2d.h>
+#include <zephyr/irq.h>
+#include <zephyr/kernel.h>
+
+#include <fsl_pxp.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(gfx2d_mcux_pxp, CONFIG_GFX2D_LOG_LEVEL);
+
+/* Disabled surfaces are moved out of the output */
+#define PXP_SURFACE_OFF		0xFFFFU
+
+#define PXP_FORMATS		(PIXEL_FORMAT_ARGB_8888 | PIXEL_FORMAT_RGB_565)
+
+struct gfx2d_mcux_pxp_config {
+	PXP_Type *base;
+	void (*irq_config_func)(const struct device *dev);
+};
+
+struct gfx2d_mcux_pxp_data {
+	struct k_mutex lock;
+	struct k_sem done;
+};
+
+static uint8_t pxp_bpp(enum display_pixel_format format)
+{
+	switch (format) {
+	case PIXEL_FORMAT_ARGB_8888:
+		return 4;
+	case PIXEL_FORMAT_RGB_565:
+		return 2;
+	default:
+		return 0;
+	}
+}
+
+/* Bytes from the first to the last pixel of a rectangle */
+static size_t pxp_span(const struct gfx2d_surface *s)
+{
+	return ((size_t)(s->height - 1) * s->pitch + s->width) * pxp_bpp(s->format);
+}
+
+static int pxp_check(const struct gfx2d_surface *s)
+{
+	if (pxp_bpp(s->format) == 0) {
+		return -ENOTSUP;
+	}
+
+	if (s->width == 0 || s->height == 0 || s->pitch < s->width) {
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+static int pxp_check_pair(const struct gfx2d_surface *dst,
+			  const struct gfx2d_surface *src)
+{
+	int ret;
+
+	ret = pxp_check(dst);
+	if (ret == 0) {
+		ret = pxp_check(src);
+	}
+
+	if (ret == 0 && (src->width != dst->width || src->height != dst->height)) {
+		ret = -EINVAL;
+	}
+
+	return ret;
+}
+
+static void pxp_set_output(PXP_Type *base, const struct gfx2d_surface *dst)
+{
+	pxp_output_buffer_config_t cfg = {
+		.pixelFormat = (dst->format == PIXEL_FORMAT_ARGB_8888) ?
+			       kPXP_OutputPixelFormatARGB8888 : kPXP_OutputPixelFormatRGB565,
+		.interlacedMode = kPXP_OutputProgressive,
+		.buffer0Addr = (uint32_t)dst->buf,
+		.buffer1Addr = 0U,
+		.pitchBytes = dst->pitch * pxp_bpp(dst->format),
+		.width = dst->width,
+		.height = dst->height,
+	};
+
+	PXP_SetOutputBufferConfig(base, &cfg);
+}
+
+static void pxp_set_ps(PXP_Type *base, const struct gfx2d_surface *src)
+{
+	pxp_ps_buffer_config_t cfg = {
+		.pixelFormat = (src->format == PIXEL_FORMAT_ARGB_8888) ?
+			       kPXP_PsPixelFormatRGB888 : kPXP_PsPixelFormatRGB565,
+		.swapByte = false,
+		.bufferAddr = (uint32_t)src->buf,
+		.bufferAddrU = 0U,
+		.bufferAddrV = 0U,
+		.pitchBytes = src->pitch * pxp_bpp(src->format),
+	};
+
+	PXP_SetProcessSurfaceBufferConfig(base, &cfg);
+	PXP_SetProcessSurfacePosition(base, 0U, 0U, src->width - 1U, src->height - 1U);
+}
+
+static int pxp_run(const struct device *dev, const struct gfx2d_surface *dst)
+{
+	const struct gfx2d_mcux_pxp_config *config = dev->config;
+	struct gfx2d_mcux_pxp_data *data = dev->data;
+	size_t len = pxp_span(dst);
+	int ret = 0;
+
+	(void)sys_cache_data_flush_range(dst->buf, len);
+
+	k_sem_reset(&data->done);
+	PXP_Start(config->base);
+
+	if (k_sem_take(&data->done, K_MSEC(CONFIG_GFX2D_TIMEOUT_MS)) != 0) {
+		LOG_ERR("Operation timed out");
+		PXP_Reset(config->base);
+		PXP_EnableInterrupts(config->base, kPXP_CompleteInterruptEnable);
+		ret = -ETIMEDOUT;
+	}
+
+	(void)sys_cache_data_invd_range(dst->buf, len);
+
+	/* Leave the surfaces disabled for the next operation */
+	PXP_SetProcessSurfacePosition(config->base, PXP_SURFACE_OFF, PXP_SURFACE_OFF, 0U, 0U);
+	PXP_SetAlphaSurfacePosition(config->base, PXP_SURFACE_OFF, PXP_SURFACE_OFF, 0U, 0U);
+
+	return ret;
+}
+
+static void gfx2d_mcux_pxp_isr(const struct device *dev)
+{
+	const struct gfx2d_mcux_pxp_config *config = dev->config;
+	struct gfx2d_mcux_pxp_data *data = dev->data;
+
+	PXP_ClearStatusFlags(config->base, kPXP_CompleteFlag);
+	k_sem_give(&data->done);
+}
+
+static void gfx2d_mcux_pxp_get_capabilities(const struct device *dev,
+					    struct gfx2d_capabilities *caps)
+{
+	ARG_UNUSED(dev);
+
+	caps->pixel_formats = PXP_FORMATS;
+}
+
+static int gfx2d_mcux_pxp_fill(const struct device *dev,
+			       const struct gfx2d_surface *dst, uint32_t color)
+{
+	const struct gfx2d_mcux_pxp_config *config = dev->config;
+	struct gfx2d_mcux_pxp_data *data = dev->data;
+	int ret;
+
+	ret = pxp_check(dst);
+	if (ret < 0) {
+		return ret;
+	}
+
+	/* With both surfaces disabled, the output is the background color */
+	k_mutex_lock(&data->lock, K_FOREVER);
+	pxp_set_output(config->base, dst);
+	PXP_SetProcessSurfaceBackGroundColor(config->base, color & 0x00FFFFFFU);
+	ret = pxp_run(dev, dst);
+	k_mutex_unlock(&data->lock);
+
+	return ret;
+}
+
+static int gfx2d_mcux_pxp_copy(const struct device *dev,
+			       const struct gfx2d_surface *dst,
+			       const struct gfx2d_surface *src)
+{
+	const struct gfx2d_mcux_pxp_config *config = dev->config;
+	struct gfx2d_mcux_pxp_data *data = dev->data;
+	int ret;
+
+	ret = pxp_check_pair(dst, src);
+	if (ret < 0) {
+		return ret;
+	}
+
+	(void)sys_cache_data_flush_range(src->buf, pxp_span(src));
+
+	k_mutex_lock(&data->lock, K_FOREVER);
+	pxp_set_output(config->base, dst);
+	pxp_set_ps(config->base, src);
+	ret = pxp_run(dev, dst);
+	k_mutex_unlock(&data->lock);
+
+	return ret;
+}
+
+static int gfx2d_mcux_pxp_blend(const struct device *dev,
+				const struct gfx2d_surface *dst,
+				const struct gfx2d_surface *src, uint8_t opa)
+{
+	const struct gfx2d_mcux_pxp_config *config = dev->config;
+	struct gfx2d_mcux_pxp_data *data = dev->data;
+	pxp_as_buffer_config_t as_cfg = {
+		.pixelFormat = (src->format == PIXEL_FORMAT_ARGB_8888) ?
+			       kPXP_AsPixelFormatARGB8888 : kPXP_AsPixelFormatRGB565,
+		.bufferAddr = (uint32_t)src->buf,
+		.pitchBytes = src->pitch * pxp_bpp(src->format),
+	};
+	pxp_as_blend_config_t blend_cfg = {
+		.alpha = opa,
+		.invertAlpha = false,
+		/* Formats without alpha are blended with the opacity only */
+		.alphaMode = (src->format == PIXEL_FORMAT_ARGB_8888) ?
+			     kPXP_AlphaMultiply : kPXP_AlphaOverride,
+		.ropMode = kPXP_RopMergeAs,
+	};
+	int ret;
+
+	ret = pxp_check_pair(dst, src);
+	if (ret < 0) {
+		return ret;
+	}
+
+	(void)sys_cache_data_flush_range(src->buf, pxp_span(src));
+
+	/* The destination is also the process surface, under the alpha one */
+	k_mutex_lock(&data->lock, K_FOREVER);
+	pxp_set_output(config->base, dst);
+	pxp_set_ps(config->base, dst);
+	PXP_SetAlphaSurfaceBufferConfig(config->base, &as_cfg);
+	PXP_SetAlphaSurfaceBlendConfig(config->base, &blend_cfg);
+	PXP_SetAlphaSurfacePosition(config->base, 0U, 0U, src->width - 1U, src->height - 1U);
+	ret = pxp_run(dev, dst);
+	k_mutex_unlock(&data->lock);
+
+	return ret;
+}
+
+static const struct gfx2d_driver_api gfx2d_mcux_pxp_api = {
+	.get_capabilities = gfx2d_mcux_pxp_get_capabilities,
+	.fill = gfx2d_mcux_pxp_fill,
+	.copy = gfx2d_mcux_pxp_copy,
+	.blend = gfx2d_mcux_pxp_blend,
+};
+
+static int gfx2d_mcux_pxp_init(const struct device *dev)
+{
+	const struct gfx2d_mcux_pxp_config *config = dev->config;
+	struct gfx2d_mcux_pxp_data *data = dev->data;
+
+	k_mutex_init(&data->lock);
+	k_sem_init(&data->done, 0, 1);
+
+	PXP_Init(config->base);
+	PXP_SetProcessSurfaceBackGroundColor(config->base, 0U);
+	PXP_SetProcessSurfacePosition(config->base, PXP_SURFACE_OFF, PXP_SURFACE_OFF, 0U, 0U);
+	PXP_SetAlphaSurfacePosition(config->base, PXP_SURFACE_OFF, PXP_SURFACE_OFF, 0U, 0U);
+	PXP_SetRotateConfig(config->base, kPXP_RotateOutputBuffer, kPXP_Rotate0,
+			    kPXP_FlipDisable);
+	PXP_EnableCsc1(config->base, false);
+	PXP_EnableInterrupts(config->base, kPXP_CompleteInterruptEnable);
+	config->irq_config_func(dev);
+
+	return 0;
+}
+
+#define GFX2D_MCUX_PXP_INIT(n)							\
+	static void gfx2d_mcux_pxp_irq_config_##n(const struct device *dev)	\
+	{									\
+		IRQ_CONNECT(DT_INST_IRQN(n), DT_INST_IRQ(n, priority),		\
+			    gfx2d_mcux_pxp_isr, DEVICE_DT_INST_GET(n), 0);	\
+		irq_enable(DT_INST_IRQN(n));					\
+	}									\
+										\
+	static const struct gfx2d_mcux_pxp_config gfx2d_mcux_pxp_config_##n = {	\
+		.base = (PXP_Type *)DT_INST_REG_ADDR(n),			\
+		.irq_config_func = gfx2d_mcux_pxp_irq_config_##n,		\
+	};									\
+										\
+	static struct gfx2d_mcux_pxp_data gfx2d_mcux_pxp_data_##n;		\
+										\
+	DEVICE_DT_INST_DEFINE(n, gfx2d_mcux_pxp_init, NULL,			\
+			      &gfx2d_mcux_pxp_data_##n,				\
+			      &gfx2d_mcux_pxp_config_##n,			\
+			      POST_KERNEL, CONFIG_GFX2D_INIT_PRIORITY,		\
+			      &gfx2d_mcux_pxp_api);
+
+DT_INST_FOREACH_STATUS_OKAY(GFX2D_MCUX_PXP_INIT)
@@ -0,0 +1,327 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT st_stm32_dma2d
+
+#include <soc.h>
+#include <zephyr/cache.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/clock_control.h>
+#include <zephyr/drivers/clock_control/stm32_clock_control.h>
+#include <zephyr/drivers/gfx2d.h>
+#include <zephyr/irq.h>
+#include <zephyr/kernel.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(gfx2d_stm32_dma2d, CONFIG_GFX2D_LOG_LEVEL);
+
+/* CR.MODE values */
+#define DMA2D_MODE_M2M		0U
+#define DMA2D_MODE_M2M_PFC	1U
+#define DMA2D_MODE_M2M_BLEND	2U
+#define DMA2D_MODE_R2M		3U
+
+/* Color modes of the foreground, background and output */
+#define DMA2D_CM_ARGB8888	0U
+#define DMA2D_CM_RGB888		1U
+#define DMA2D_CM_RGB565		2U
+
+/* FGPFCCR.AM, the pixel alpha is multiplied by FGPFCCR.ALPHA */
+#define DMA2D_AM_MULTIPLY	2U
+
+/* Line offsets and pixels per line are 14-bit fields on all series */
+#define DMA2D_MAX_PITCH		0x3FFFU
+
+#define DMA2D_ISR_ERRORS	(DMA2D_ISR_TEIF | DMA2D_ISR_CEIF)
+
+#define DMA2D_FORMATS		(PIXEL_FORMAT_ARGB_8888 | PIXEL_FORMAT_RGB_888 | \
+				 PIXEL_FORMAT_RGB_565)
+
+struct gfx2d_stm32_dma2d_config {
+	DMA2D_TypeDef *regs;
+	struct stm32_pclken pclken;
+	void (*irq_config_func)(const struct device *dev);
+};
+
+struct gfx2d_stm32_dma2d_data {
+	struct k_mutex lock;
+	struct k_sem done;
+	int result;
+};
+
+static int dma2d_color_mode(enum display_pixel_format format, uint8_t *bpp)
+{
+	switch (format) {
+	case PIXEL_FORMAT_ARGB_8888:
+		*bpp = 4;
+		return DMA2D_CM_ARGB8888;
+	case PIXEL_FORMAT_RGB_888:
+		*bpp = 3;
+		return DMA2D_CM_RGB888;
+	case PIXEL_FORMAT_RGB_565:
+		*bpp = 2;
+		return DMA2D_CM_RGB565;
+	default:
+		return -ENOTSUP;
+	}
+}
+
+/* Bytes from the first to the last pixel of a rectangle */
+static size_t dma2d_span(const struct gfx2d_surface *s, uint8_t bpp)
+{
+	return ((size_t)(s->height - 1) * s->pitch + s->width) * bpp;
+}
+
+static int dma2d_check(const struct gfx2d_surface *s)
+{
+	if (s->width == 0 || s->height == 0 || s->pitch < s->width ||
+	    s->width > DMA2D_MAX_PITCH || s->pitch - s->width > DMA2D_MAX_PITCH) {
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+static void dma2d_set_output(DMA2D_TypeDef *regs, const struct gfx2d_surface *dst,
+			     uint32_t cm)
+{
+	regs->OPFCCR = cm;
+	regs->OMAR = (uint32_t)dst->buf;
+	regs->OOR = dst->pitch - dst->width;
+	regs->NLR = ((uint32_t)dst->width << DMA2D_NLR_PL_Pos) | dst->height;
+}
+
+static int dma2d_run(const struct device *dev, uint32_t mode,
+		     const struct gfx2d_surface *dst, size_t dst_len)
+{
+	const struct gfx2d_stm32_dma2d_config *config = dev->config;
+	struct gfx2d_stm32_dma2d_data *data = dev->data;
+	DMA2D_TypeDef *regs = config->regs;
+
+	/* The background of a blend is read from the destination */
+	(void)sys_cache_data_flush_range(dst->buf, dst_len);
+
+	k_sem_reset(&data->done);
+	regs->CR = (mode << DMA2D_CR_MODE_Pos) | DMA2D_CR_TCIE | DMA2D_CR_TEIE |
+		   DMA2D_CR_CEIE | DMA2D_CR_START;
+
+	if (k_sem_take(&data->done, K_MSEC(CONFIG_GFX2D_TIMEOUT_MS)) != 0) {
+		regs->CR |= DMA2D_CR_ABORT;
+		while (regs->CR & DMA2D_CR_START) {
+		}
+		regs->IFCR = regs->ISR;
+		LOG_ERR("Transfer timed out");
+		data->result = -ETIMEDOUT;
+	}
+
+	(void)sys_cache_data_invd_range(dst->buf, dst_len);
+
+	return data->result;
+}
+
+static void gfx2d_stm32_dma2d_isr(const struct device *dev)
+{
+	const struct gfx2d_stm32_dma2d_config *config = dev->config;
+	struct gfx2d_stm32_dma2d_data *data = dev->data;
+	uint32_t isr = config->regs->ISR;
+
+	config->regs->IFCR = isr & (DMA2D_ISR_TCIF | DMA2D_ISR_ERRORS);
+	data->result = (isr & DMA2D_ISR_ERRORS) ? -EIO : 0;
+	k_sem_give(&data->done);
+}
+
+static void gfx2d_stm32_dma2d_get_capabilities(const struct device *dev,
+					       struct gfx2d_capabilities *caps)
+{
+	ARG_UNUSED(dev);
+
+	caps->pixel_formats = DMA2D_FORMATS;
+}
+
+static int gfx2d_stm32_dma2d_fill(const struct device *dev,
+				  const struct gfx2d_surface *dst, uint32_t color)
+{
+	const struct gfx2d_stm32_dma2d_config *config = dev->config;
+	struct gfx2d_stm32_dma2d_data *data = dev->data;
+	uint8_t bpp;
+	int cm;
+	int ret;
+
+	cm = dma2d_color_mode(dst->format, &bpp);
+	if (cm < 0) {
+		return cm;
+	}
+
+	ret = dma2d_check(dst);
+	if (ret < 0) {
+		return ret;
+	}
+
+	/* OCOLR is in the output format */
+	if (cm == DMA2D_CM_RGB565) {
+		color = ((color >> 8) & 0xF800U) | ((color >> 5) & 0x07E0U) |
+			((color >> 3) & 0x001FU);
+	} else if (cm == DMA2D_CM_RGB888) {
+		color &= 0x00FFFFFFU;
+	}
+
+	k_mutex_lock(&data->lock, K_FOREVER);
+	dma2d_set_output(config->regs, dst, cm);
+	config->regs->OCOLR = color;
+	ret = dma2d_run(dev, DMA2D_MODE_R2M, dst, dma2d_span(dst, bpp));
+	k_mutex_unlock(&data->lock);
+
+	return ret;
+}
+
+static int dma2d_setup(const struct gfx2d_surface *dst,
+		       const struct gfx2d_surface *src, int *dst_cm, int *src_cm,
+		       uint8_t *dst_bpp)
+{
+	uint8_t src_bpp;
+	int ret;
+
+	*dst_cm = dma2d_color_mode(dst->format, dst_bpp);
+	*src_cm = dma2d_color_mode(src->format, &src_bpp);
+	if (*dst_cm < 0 || *src_cm < 0) {
+		return -ENOTSUP;
+	}
+
+	if (src->width != dst->width || src->height != dst->height) {
+		return -EINVAL;
+	}
+
+	ret = dma2d_check(dst);
+	if (ret == 0) {
+		ret = dma2d_check(src);
+	}
+
+	if (ret == 0) {
+		(void)sys_cache_data_flush_range(src->buf, dma2d_span(src, src_bpp));
+	}
+
+	return ret;
+}
+
+static int gfx2d_stm32_dma2d_copy(const struct device *dev,
+				  const struct gfx2d_surface *dst,
+				  const struct gfx2d_surface *src)
+{
+	const struct gfx2d_stm32_dma2d_config *config = dev->config;
+	struct gfx2d_stm32_dma2d_data *data = dev->data;
+	DMA2D_TypeDef *regs = config->regs;
+	uint8_t bpp;
+	int dst_cm;
+	int src_cm;
+	int ret;
+
+	ret = dma2d_setup(dst, src, &dst_cm, &src_cm, &bpp);
+	if (ret < 0) {
+		return ret;
+	}
+
+	k_mutex_lock(&data->lock, K_FOREVER);
+	dma2d_set_output(regs, dst, dst_cm);
+	regs->FGMAR = (uint32_t)src->buf;
+	regs->FGOR = src->pitch - src->width;
+	regs->FGPFCCR = src_cm;
+	ret = dma2d_run(dev, (src_cm == dst_cm) ? DMA2D_MODE_M2M : DMA2D_MODE_M2M_PFC,
+			dst, dma2d_span(dst, bpp));
+	k_mutex_unlock(&data->lock);
+
+	return ret;
+}
+
+static int gfx2d_stm32_dma2d_blend(const struct device *dev,
+				   const struct gfx2d_surface *dst,
+				   const struct gfx2d_surface *src, uint8_t opa)
+{
+	const struct gfx2d_stm32_dma2d_config *config = dev->config;
+	struct gfx2d_stm32_dma2d_data *data = dev->data;
+	DMA2D_TypeDef *regs = config->regs;
+	uint8_t bpp;
+	int dst_cm;
+	int src_cm;
+	int ret;
+
+	ret = dma2d_setup(dst, src, &dst_cm, &src_cm, &bpp);
+	if (ret < 0) {
+		return ret;
+	}
+
+	k_mutex_lock(&data->lock, K_FOREVER);
+	dma2d_set_output(regs, dst, dst_cm);
+	regs->FGMAR = (uint32_t)src->buf;
+	regs->FGOR = src->pitch - src->width;
+	regs->FGPFCCR = src_cm | (DMA2D_AM_MULTIPLY << DMA2D_FGPFCCR_AM_Pos) |
+			((uint32_t)opa << DMA2D_FGPFCCR_ALPHA_Pos);
+	regs->BGMAR = (uint32_t)dst->buf;
+	regs->BGOR = dst->pitch - dst->width;
+	regs->BGPFCCR = dst_cm;
+	ret = dma2d_run(dev, DMA2D_MODE_M2M_BLEND, dst, dma2d_span(dst, bpp));
+	k_mutex_unlock(&data->lock);
+
+	return ret;
+}
+
+static const struct gfx2d_driver_api gfx2d_stm32_dma2d_api = {
+	.get_capabilities = gfx2d_stm32_dma2d_get_capabilities,
+	.fill = gfx2d_stm32_dma2d_fill,
+	.copy = gfx2d_stm32_dma2d_copy,
+	.blend = gfx2d_stm32_dma2d_blend,
+};
+
+static int gfx2d_stm32_dma2d_init(const struct device *dev)
+{
+	const struct gfx2d_stm32_dma2d_config *config = dev->config;
+	const struct device *clk = DEVICE_DT_GET(STM32_CLOCK_CONTROL_NODE);
+	struct gfx2d_stm32_dma2d_data *data = dev->data;
+	int err;
+
+	if (!device_is_ready(clk)) {
+		LOG_ERR("clock control device not ready");
+		return -ENODEV;
+	}
+
+	err = clock_control_on(clk, (clock_control_subsys_t)&config->pclken);
+	if (err < 0) {
+		LOG_ERR("Could not enable DMA2D peripheral clock");
+		return err;
+	}
+
+	k_mutex_init(&data->lock);
+	k_sem_init(&data->done, 0, 1);
+	config->irq_config_func(dev);
+
+	return 0;
+}
+
+#define GFX2D_STM32_DMA2D_INIT(n)						\
+	static void gfx2d_stm32_dma2d_irq_config_##n(const struct device *dev)	\
+	{									\
+		IRQ_CONNECT(DT_INST_IRQN(n), DT_INST_IRQ(n, priority),		\
+			    gfx2d_stm32_dma2d_isr, DEVICE_DT_INST_GET(n), 0);	\
+		irq_enable(DT_INST_IRQN(n));					\
+	}									\
+										\
+	static const struct gfx2d_stm32_dma2d_config gfx2d_stm32_dma2d_config_##n = { \
+		.regs = (DMA2D_TypeDef *)DT_INST_REG_ADDR(n),			\
+		.pclken = {							\
+			.enr = DT_INST_CLOCKS_CELL(n, bits),			\
+			.bus = DT_INST_CLOCKS_CELL(n, bus),			\
+		},								\
+		.irq_config_func = gfx2d_stm32_dma2d_irq_config_##n,		\
+	};									\
+										\
+	static struct gfx2d_stm32_dma2d_data gfx2d_stm32_dma2d_data_##n;	\
+										\
+	DEVICE_DT_INST_DEFINE(n, gfx2d_stm32_dma2d_init, NULL,			\
+			      &gfx2d_stm32_dma2d_data_##n,			\
+			      &gfx2d_stm32_dma2d_config_##n,			\
+			      POST_KERNEL, CONFIG_GFX2D_INIT_PRIORITY,		\
+			      &gfx2d_stm32_dma2d_api);
+
+DT_INST_FOREACH_STATUS_OKAY(GFX2D_STM32_DMA2D_INIT)
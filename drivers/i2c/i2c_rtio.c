@@ -4,7 +4,11 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
 #include <zephyr/rtio/rtio.h>
+#include <zephyr/rtio/rtio_mpsc.h>
 #include <zephyr/drivers/i2c.h>
 #include <zephyr/rtio/rtio_spsc.h>
 #include <zephyr/sys/__assert.h>
@@ -47,3 +51,140 @@ struct rtio_sqe *i2c_rtio_copy(struct rtio *r,
 
 	return sqe;
 }
+
+#ifdef CONFIG_I2C_RTIO_FALLBACK
+
+/*
+ * Requests for the controllers without iodev_submit are queued per bus and
+ * run with i2c_transfer() by the work of the bus. As resubmitting a queued
+ * work does nothing, the requests queued while the bus is busy are all run
+ * by the next execution of the work.
+ */
+
+struct i2c_rtio_bus {
+	const struct device *dev;
+	struct rtio_mpsc q;
+	struct k_work work;
+};
+
+static struct i2c_rtio_bus i2c_rtio_buses[CONFIG_I2C_RTIO_FALLBACK_BUSES];
+static struct k_spinlock i2c_rtio_buses_lock;
+static struct k_work_q i2c_rtio_workq;
+static K_KERNEL_STACK_DEFINE(i2c_rtio_stack, CONFIG_I2C_RTIO_FALLBACK_STACK_SIZE);
+
+static int i2c_rtio_run(struct rtio_iodev_sqe *txn_head)
+{
+	const struct i2c_dt_spec *dt_spec = txn_head->sqe.iodev->data;
+	struct i2c_msg msgs[CONFIG_I2C_RTIO_FALLBACK_MSGS];
+	uint8_t num_msgs = 0;
+
+	for (struct rtio_iodev_sqe *curr = txn_head; curr != NULL; curr = rtio_txn_next(curr)) {
+		struct rtio_sqe *sqe = &curr->sqe;
+		struct i2c_msg *msg = &msgs[num_msgs];
+
+		if (num_msgs == ARRAY_SIZE(msgs)) {
+			return -ENOMEM;
+		}
+
+		switch (sqe->op) {
+		case RTIO_OP_RX:
+			msg->buf = sqe->buf;
+			msg->len = sqe->buf_len;
+			msg->flags = I2C_MSG_READ;
+			break;
+		case RTIO_OP_TX:
+			msg->buf = sqe->buf;
+			msg->len = sqe->buf_len;
+			msg->flags = I2C_MSG_WRITE;
+			break;
+		case RTIO_OP_TINY_TX:
+			msg->buf = sqe->tiny_buf;
+			msg->len = sqe->tiny_buf_len;
+			msg->flags = I2C_MSG_WRITE;
+			break;
+		default:
+			return -EINVAL;
+		}
+
+		msg->flags |= ((sqe->iodev_flags & RTIO_IODEV_I2C_STOP) ? I2C_MSG_STOP : 0) |
+			((sqe->iodev_flags & RTIO_IODEV_I2C_RESTART) ? I2C_MSG_RESTART : 0) |
+			((sqe->iodev_flags & RTIO_IODEV_I2C_10_BITS) ? I2C_MSG_ADDR_10_BITS : 0);
+		num_msgs++;
+	}
+
+	/* A transaction ends the access to its target */
+	msgs[num_msgs - 1].flags |= I2C_MSG_STOP;
+
+	return i2c_transfer(dt_spec->bus, msgs, num_msgs, dt_spec->addr);
+}
+
+static void i2c_rtio_work_handler(struct k_work *work)
+{
+	struct i2c_rtio_bus *bus = CONTAINER_OF(work, struct i2c_rtio_bus, work);
+	struct rtio_mpsc_node *node;
+
+	while ((node = rtio_mpsc_pop(&bus->q)) != NULL) {
+		struct rtio_iodev_sqe *iodev_sqe = CONTAINER_OF(node, struct rtio_iodev_sqe, q);
+		int rc = i2c_rtio_run(iodev_sqe);
+
+		if (rc == 0) {
+			rtio_iodev_sqe_ok(iodev_sqe, 0);
+		} else {
+			rtio_iodev_sqe_err(iodev_sqe, rc);
+		}
+	}
+}
+
+static struct i2c_rtio_bus *i2c_rtio_bus_get(const struct device *dev)
+{
+	k_spinlock_key_t key = k_spin_lock(&i2c_rtio_buses_lock);
+	struct i2c_rtio_bus *bus = NULL;
+
+	for (size_t i = 0; i < ARRAY_SIZE(i2c_rtio_buses); i++) {
+		if (i2c_rtio_buses[i].dev == dev) {
+			bus = &i2c_rtio_buses[i];
+			break;
+		}
+		if (i2c_rtio_buses[i].dev == NULL) {
+			bus = &i2c_rtio_buses[i];
+			bus->dev = dev;
+			rtio_mpsc_init(&bus->q);
+			k_work_init(&bus->work, i2c_rtio_work_handler);
+			break;
+		}
+	}
+
+	k_spin_unlock(&i2c_rtio_buses_lock, key);
+
+	return bus;
+}
+
+void i2c_iodev_submit_fallback(const struct device *dev, struct rtio_iodev_sqe *iodev_sqe)
+{
+	struct i2c_rtio_bus *bus = i2c_rtio_bus_get(dev);
+
+	if (bus == NULL) {
+		rtio_iodev_sqe_err(iodev_sqe, -ENOMEM);
+		return;
+	}
+
+	rtio_mpsc_push(&bus->q, &iodev_sqe->q);
+	k_work_submit_to_queue(&i2c_rtio_workq, &bus->work);
+}
+
+static int i2c_rtio_fallback_init(void)
+{
+	const struct k_work_queue_config cfg = {
+		.name = "i2c_rtio",
+	};
+
+	k_work_queue_start(&i2c_rtio_workq, i2c_rtio_stack,
+			   K_KERNEL_STACK_SIZEOF(i2c_rtio_stack),
+			   CONFIG_I2C_RTIO_FALLBACK_THREAD_PRIORITY, &cfg);
+
+	return 0;
+}
+
+SYS_INIT(i2c_rtio_fallback_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+
+#endif /* CONFIG_I2C_RTIO_FALLBACK */
@@ -83,7 +83,11 @@ struct plic_stats {
 };
 
 struct plic_data {
+	/* Entries of the local IRQs in _sw_isr_table */
+	struct _isr_table_entry *isr_table;
+#ifdef CONFIG_PLIC_SHELL
 	struct plic_stats stats;
+#endif /* CONFIG_PLIC_SHELL */
 };
 
 static uint32_t save_irq;
@@ -321,6 +325,7 @@ const struct device *riscv_plic_get_dev(void)
 static void plic_irq_handler(const struct device *dev)
 {
 	const struct plic_config *config = dev->config;
+	struct plic_data *data = dev->data;
 	mem_addr_t claim_complete_addr = get_claim_complete_addr(dev);
 	struct _isr_table_entry *ite;
 	uint32_t __maybe_unused trig_val;
@@ -329,7 +334,6 @@ static void plic_irq_handler(const struct device *dev)
 	const uint32_t local_irq = sys_read32(claim_complete_addr);
 
 #ifdef CONFIG_PLIC_SHELL
-	const struct plic_data *data = dev->data;
 	struct plic_stats stat = data->stats;
 
 	/* Cap the count at __UINT16_MAX__ */
@@ -366,15 +370,8 @@ static void plic_irq_handler(const struct device *dev)
 	}
 #endif
 
-	const uint32_t parent_irq = COND_CODE_1(IS_ENABLED(CONFIG_DYNAMIC_INTERRUPTS),
-						(z_get_sw_isr_irq_from_device(dev)), (0U));
-	const uint32_t irq = irq_to_level_2(local_irq) | parent_irq;
-	const unsigned int isr_offset =
-		COND_CODE_1(IS_ENABLED(CONFIG_DYNAMIC_INTERRUPTS), (z_get_sw_isr_table_idx(irq)),
-			    (irq_from_level_2(irq) + CONFIG_2ND_LVL_ISR_TBL_OFFSET));
-
 	/* Call the corresponding IRQ handler in _sw_isr_table */
-	ite = (struct _isr_table_entry *)&_sw_isr_table[isr_offset];
+	ite = &data->isr_table[local_irq];
 	ite->isr(ite->arg);
 
 	/*
@@ -402,9 +399,18 @@ static void plic_irq_handler(const struct device *dev)
 static int plic_init(const struct device *dev)
 {
 	const struct plic_config *config = dev->config;
+	struct plic_data *data = dev->data;
 	mem_addr_t en_addr, thres_prio_addr;
 	mem_addr_t prio_addr = config->prio;
 
+	/* Looked up once, the handler then indexes the entries with the local IRQ */
+#ifdef CONFIG_DYNAMIC_INTERRUPTS
+	data->isr_table = z_get_sw_isr_table_from_device(dev);
+	__ASSERT(data->isr_table != NULL, "%s is not a 2nd level aggregator", dev->name);
+#else
+	data->isr_table = &_sw_isr_table[CONFIG_2ND_LVL_ISR_TBL_OFFSET];
+#endif /* CONFIG_DYNAMIC_INTERRUPTS */
+
 	/* Iterate through each of the contexts, HART + PRIV */
 	for (uint32_t cpu_num = 0; cpu_num < arch_num_cpus(); cpu_num++) {
 		en_addr = get_context_en_addr(dev, cpu_num);
@@ -537,20 +543,24 @@ SHELL_CMD_ARG_REGISTER(plic, &plic_cmds, "PLIC shell commands",
 #define PLIC_INTC_IRQ_COUNT_BUF_DEFINE(n)                                                          \
 	static uint16_t local_irq_count_##n[PLIC_MIN_IRQ_NUM(n)];
 
+#define PLIC_INTC_STATS_INIT(n)                                                                    \
+	.stats = {                                                                                 \
+		.irq_count = local_irq_count_##n,                                                  \
+		.irq_count_len = PLIC_MIN_IRQ_NUM(n),                                              \
+	},
+#else
+#define PLIC_INTC_IRQ_COUNT_BUF_DEFINE(n)
+#define PLIC_INTC_STATS_INIT(n)
+#endif
+
 #define PLIC_INTC_DATA_INIT(n)                                                                     \
-	PLIC_INTC_IRQ_COUNT_BUF_DEFINE(n);                                                         \
+	PLIC_INTC_IRQ_COUNT_BUF_DEFINE(n)                                                          \
 	static struct plic_data plic_data_##n = {                                                  \
-		.stats = {                                                                         \
-			.irq_count = local_irq_count_##n,                                          \
-			.irq_count_len = PLIC_MIN_IRQ_NUM(n),                                      \
-		},                                                                                 \
+		.isr_table = NULL,                                                                 \
+		PLIC_INTC_STATS_INIT(n)                                                            \
 	};
 
 #define PLIC_INTC_DATA(n) &plic_data_##n
-#else
-#define PLIC_INTC_DATA_INIT(...)
-#define PLIC_INTC_DATA(n) (NULL)
-#endif
 
 #define PLIC_INTC_IRQ_FUNC_DECLARE(n) static void plic_irq_config_func_##n(void)
 
@@ -231,13 +231,13 @@ static inline q31_t icm42688_read_temperature_from_packet(const uint8_t *pkt)
 	return FIELD_PREP(GENMASK(31, 22), whole) | (fraction * GENMASK64(21, 0) / 1000000);
 }
 
-static int icm42688_read_imu_from_packet(const uint8_t *pkt, bool is_accel, int fs,
-					 uint8_t axis_offset, q31_t *out)
+/*
+ * Scale of the 16 bit readings of a packet, constant over the frames of a
+ * buffer so computed once per decode.
+ */
+static int64_t icm42688_imu_scale(bool is_accel, int fs)
 {
-	int32_t value;
 	int64_t scale = 0;
-	int32_t max = BIT(15);
-	int offset = 1 + (axis_offset * 2);
 
 	if (is_accel) {
 		switch (fs) {
@@ -283,6 +283,28 @@ static int icm42688_read_imu_from_packet(const uint8_t *pkt, bool is_accel, int
 		}
 	}
 
+	return scale;
+}
+
+/* Division by 2^shift rounding toward zero as the division operator does,
+ * without a call to the 64 bit division of the C library.
+ */
+static inline int64_t icm42688_div_pow2(int64_t value, unsigned int shift)
+{
+	if (value < 0) {
+		value += BIT64(shift) - 1;
+	}
+
+	return value >> shift;
+}
+
+static int icm42688_read_imu_from_packet(const uint8_t *pkt, bool is_accel, int64_t scale,
+					 uint8_t axis_offset, q31_t *out)
+{
+	int32_t value;
+	unsigned int max_shift = 15;
+	int offset = 1 + (axis_offset * 2);
+
 	if (!is_accel && FIELD_GET(FIFO_HEADER_ACCEL, pkt[0]) == 1) {
 		offset += 7;
 	}
@@ -296,7 +318,7 @@ static int icm42688_read_imu_from_packet(const uint8_t *pkt, bool is_accel, int
 		value = (value << 4) | FIELD_GET(mask, pkt[offset]);
 		/* In 20 bit mode, FS can only be +/-16g and +/-2000dps */
 		scale = is_accel ? (INT64_C(16) * BIT(8) * 9.80665) : 131;
-		max = is_accel ? BIT(18) : BIT(19);
+		max_shift = is_accel ? 18 : 19;
 		if (value == -524288) {
 			/* Invalid 20 bit value */
 			return -ENODATA;
@@ -308,7 +330,7 @@ static int icm42688_read_imu_from_packet(const uint8_t *pkt, bool is_accel, int
 		}
 	}
 
-	*out = (q31_t)(value * scale / max);
+	*out = (q31_t)icm42688_div_pow2(value * scale, max_shift);
 	return 0;
 }
 
@@ -351,6 +373,7 @@ static int icm42688_fifo_decode(const uint8_t *buffer, enum sensor_channel chann
 {
 	const struct icm42688_fifo_data *edata = (const struct icm42688_fifo_data *)buffer;
 	const uint8_t *buffer_end = buffer + sizeof(struct icm42688_fifo_data) + edata->fifo_count;
+	int64_t accel_scale, gyro_scale;
 	int accel_frame_count = 0;
 	int gyro_frame_count = 0;
 	int count = 0;
@@ -362,6 +385,19 @@ static int icm42688_fifo_decode(const uint8_t *buffer, enum sensor_channel chann
 
 	((struct sensor_data_header *)data_out)->base_timestamp_ns = edata->header.timestamp;
 
+	/* The full scales are the same for all the frames */
+	if (IS_ACCEL(channel)) {
+		icm42688_get_shift(SENSOR_CHAN_ACCEL_XYZ, edata->header.accel_fs,
+				   edata->header.gyro_fs,
+				   &((struct sensor_three_axis_data *)data_out)->shift);
+	} else if (IS_GYRO(channel)) {
+		icm42688_get_shift(SENSOR_CHAN_GYRO_XYZ, edata->header.accel_fs,
+				   edata->header.gyro_fs,
+				   &((struct sensor_three_axis_data *)data_out)->shift);
+	}
+	accel_scale = icm42688_imu_scale(true, edata->header.accel_fs);
+	gyro_scale = icm42688_imu_scale(false, edata->header.gyro_fs);
+
 	buffer += sizeof(struct icm42688_fifo_data);
 	while (count < max_count && buffer < buffer_end) {
 		const bool is_20b = FIELD_GET(FIFO_HEADER_20, buffer[0]) == 1;
@@ -407,15 +443,12 @@ static int icm42688_fifo_decode(const uint8_t *buffer, enum sensor_channel chann
 				(struct sensor_three_axis_data *)data_out;
 			uint64_t period_ns = accel_period_ns[edata->accel_odr];
 
-			icm42688_get_shift(SENSOR_CHAN_ACCEL_XYZ, edata->header.accel_fs,
-					   edata->header.gyro_fs, &data->shift);
-
 			data->readings[count].timestamp_delta = (accel_frame_count - 1) * period_ns;
-			rc = icm42688_read_imu_from_packet(buffer, true, edata->header.accel_fs, 0,
+			rc = icm42688_read_imu_from_packet(buffer, true, accel_scale, 0,
 							   &data->readings[count].x);
-			rc |= icm42688_read_imu_from_packet(buffer, true, edata->header.accel_fs, 1,
+			rc |= icm42688_read_imu_from_packet(buffer, true, accel_scale, 1,
 							    &data->readings[count].y);
-			rc |= icm42688_read_imu_from_packet(buffer, true, edata->header.accel_fs, 2,
+			rc |= icm42688_read_imu_from_packet(buffer, true, accel_scale, 2,
 							    &data->readings[count].z);
 			if (rc != 0) {
 				accel_frame_count--;
@@ -428,15 +461,12 @@ static int icm42688_fifo_decode(const uint8_t *buffer, enum sensor_channel chann
 				(struct sensor_three_axis_data *)data_out;
 			uint64_t period_ns = accel_period_ns[edata->gyro_odr];
 
-			icm42688_get_shift(SENSOR_CHAN_GYRO_XYZ, edata->header.accel_fs,
-					   edata->header.gyro_fs, &data->shift);
-
 			data->readings[count].timestamp_delta = (gyro_frame_count - 1) * period_ns;
-			rc = icm42688_read_imu_from_packet(buffer, false, edata->header.gyro_fs, 0,
+			rc = icm42688_read_imu_from_packet(buffer, false, gyro_scale, 0,
 							   &data->readings[count].x);
-			rc |= icm42688_read_imu_from_packet(buffer, false, edata->header.gyro_fs, 1,
+			rc |= icm42688_read_imu_from_packet(buffer, false, gyro_scale, 1,
 							    &data->readings[count].y);
-			rc |= icm42688_read_imu_from_packet(buffer, false, edata->header.gyro_fs, 2,
+			rc |= icm42688_read_imu_from_packet(buffer, false, gyro_scale, 2,
 							    &data->readings[count].z);
 			if (rc != 0) {
 				gyro_frame_count--;
@@ -1198,6 +1198,21 @@ static void uart_stm32_dma_rx_flush(const struct device *dev)
 				data->dma_rx.dma_channel, &stat) == 0) {
 		size_t rx_rcv_len = data->dma_rx.buffer_length -
 					stat.pending_length;
+#ifdef CONFIG_UART_STM32_DMA_RX_CIRCULAR
+		/* The DMA wrapped around since the last event: report the
+		 * end of the buffer first, then restart from its beginning.
+		 * Events come at least every half buffer, so a position
+		 * equal to the offset means no new data.
+		 */
+		if ((rx_rcv_len < data->dma_rx.offset) ||
+		    (rx_rcv_len == data->dma_rx.buffer_length)) {
+			data->dma_rx.counter = data->dma_rx.buffer_length;
+			async_evt_rx_rdy(data);
+			data->dma_rx.offset = 0;
+			data->dma_rx.counter = 0;
+			rx_rcv_len %= data->dma_rx.buffer_length;
+		}
+#endif
 		if (rx_rcv_len > data->dma_rx.offset) {
 			data->dma_rx.counter = rx_rcv_len;
 
@@ -1471,6 +1486,14 @@ void uart_stm32_dma_rx_cb(const struct device *dma_dev, void *user_data,
 		return;
 	}
 
+#ifdef CONFIG_UART_STM32_DMA_RX_CIRCULAR
+	/* Half or full transfer of the ring: the DMA keeps running into the
+	 * same buffer, only the new data is reported.
+	 */
+	uart_stm32_dma_rx_flush(uart_dev);
+	return;
+#endif
+
 	(void)k_work_cancel_delayable(&data->dma_rx.timeout_work);
 
 	/* true since this functions occurs when buffer if full */
@@ -1615,8 +1638,10 @@ static int uart_stm32_async_rx_enable(const struct device *dev,
 
 	LL_USART_EnableIT_ERROR(config->usart);
 
-	/* Request next buffer */
-	async_evt_rx_buf_request(data);
+	/* Request next buffer, none is needed by a ring */
+	if (!IS_ENABLED(CONFIG_UART_STM32_DMA_RX_CIRCULAR)) {
+		async_evt_rx_buf_request(data);
+	}
 
 	LOG_DBG("async rx enabled");
 
@@ -1750,8 +1775,10 @@ static int uart_stm32_async_init(const struct device *dev)
 	}
 
 	/* RX disable circular buffer */
-	data->dma_rx.blk_cfg.source_reload_en  = 0;
-	data->dma_rx.blk_cfg.dest_reload_en = 0;
+	data->dma_rx.blk_cfg.source_reload_en =
+		IS_ENABLED(CONFIG_UART_STM32_DMA_RX_CIRCULAR);
+	data->dma_rx.blk_cfg.dest_reload_en =
+		IS_ENABLED(CONFIG_UART_STM32_DMA_RX_CIRCULAR);
 	data->dma_rx.blk_cfg.fifo_mode_control = data->dma_rx.fifo_threshold;
 
 	data->dma_rx.dma_cfg.head_block = &data->dma_rx.blk_cfg;
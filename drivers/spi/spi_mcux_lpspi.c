@@ -85,6 +85,15 @@ struct spi_mcux_data {
 	/* dummy value used to read RX data into when rx buf is null */
 	uint32_t dummy_rx_buffer;
 #endif
+
+#ifdef CONFIG_SPI_MCUX_LPSPI_RTIO_DMA
+	struct dma_block_config rtio_tx_blks[CONFIG_SPI_MCUX_LPSPI_RTIO_DMA_BLOCKS];
+	struct dma_block_config rtio_rx_blks[CONFIG_SPI_MCUX_LPSPI_RTIO_DMA_BLOCKS];
+	/* zeros sent by reads, never written */
+	uint8_t rtio_dummy_tx[CONFIG_SPI_MCUX_LPSPI_RTIO_DMA_DUMMY_SIZE];
+	/* data received by writes, never read */
+	uint8_t rtio_dummy_rx[CONFIG_SPI_MCUX_LPSPI_RTIO_DMA_DUMMY_SIZE];
+#endif
 };
 
 static int spi_mcux_transfer_next_packet(const struct device *dev)
@@ -289,6 +298,11 @@ static int spi_mcux_configure(const struct device *dev,
 static int spi_mcux_dma_rxtx_load(const struct device *dev,
 				size_t *dma_size);
 
+#ifdef CONFIG_SPI_MCUX_LPSPI_RTIO_DMA
+static void spi_mcux_rtio_dma_callback(const struct device *dev, uint32_t channel,
+				       int status);
+#endif
+
 /* This function is executed in the interrupt context */
 static void spi_mcux_dma_callback(const struct device *dev, void *arg,
 			 uint32_t channel, int status)
@@ -297,6 +311,13 @@ static void spi_mcux_dma_callback(const struct device *dev, void *arg,
 	const struct device *spi_dev = arg;
 	struct spi_mcux_data *data = (struct spi_mcux_data *)spi_dev->data;
 
+#ifdef CONFIG_SPI_MCUX_LPSPI_RTIO_DMA
+	if (data->txn_head != NULL) {
+		spi_mcux_rtio_dma_callback(spi_dev, channel, status);
+		return;
+	}
+#endif
+
 	if (status < 0) {
 		LOG_ERR("DMA callback error with channel %d.", channel);
 		data->status_flags |= SPI_MCUX_LPSPI_DMA_ERROR_FLAG;
@@ -374,6 +395,7 @@ static int spi_mcux_dma_tx_load(const struct device *dev, const uint8_t *buf, si
 	stream->dma_cfg.source_burst_length = 1;
 
 	stream->dma_cfg.head_block = &stream->dma_blk_cfg;
+	stream->dma_cfg.block_count = 1;
 	/* give the client dev as arg, as the callback comes from the dma */
 	stream->dma_cfg.user_data = (struct device *)dev;
 	/* pass our client origin to the dma: data->dma_tx.dma_channel */
@@ -416,6 +438,7 @@ static int spi_mcux_dma_rx_load(const struct device *dev, uint8_t *buf,
 	stream->dma_cfg.source_burst_length = 1;
 
 	stream->dma_cfg.head_block = blk_cfg;
+	stream->dma_cfg.block_count = 1;
 	stream->dma_cfg.user_data = (struct device *)dev;
 
 	/* pass our client origin to the dma: data->dma_rx.channel */
@@ -720,6 +743,198 @@ static inline void spi_spin_unlock(const struct device *dev, k_spinlock_key_t ke
 
 static void spi_mcux_iodev_next(const struct device *dev, bool completion);
 
+#ifdef CONFIG_SPI_MCUX_LPSPI_RTIO_DMA
+/*
+ * Each submission of the transaction takes a block of both the TX and RX
+ * chains, the missing side of reads and writes using the dummy buffers,
+ * in as many blocks as needed.
+ */
+static bool spi_mcux_rtio_dma_prep(const struct device *dev)
+{
+	struct spi_mcux_data *data = dev->data;
+	LPSPI_Type *base = (LPSPI_Type *)DEVICE_MMIO_NAMED_GET(dev, reg_base);
+	struct rtio_iodev_sqe *curr = data->txn_head;
+	size_t n = 0;
+
+	for (; curr != NULL; curr = rtio_txn_next(curr)) {
+		const struct rtio_sqe *sqe = &curr->sqe;
+		const uint8_t *tx;
+		uint8_t *rx;
+		size_t len;
+
+		switch (sqe->op) {
+		case RTIO_OP_RX:
+			tx = NULL;
+			rx = sqe->buf;
+			len = sqe->buf_len;
+			break;
+		case RTIO_OP_TX:
+			tx = sqe->buf;
+			rx = NULL;
+			len = sqe->buf_len;
+			break;
+		case RTIO_OP_TINY_TX:
+			tx = sqe->tiny_buf;
+			rx = NULL;
+			len = sqe->tiny_buf_len;
+			break;
+		case RTIO_OP_TXRX:
+			tx = sqe->tx_buf;
+			rx = sqe->rx_buf;
+			len = sqe->txrx_buf_len;
+			break;
+		default:
+			return false;
+		}
+
+		while (len > 0) {
+			struct dma_block_config *tx_blk;
+			struct dma_block_config *rx_blk;
+			size_t blk_len = len;
+
+			if (n == CONFIG_SPI_MCUX_LPSPI_RTIO_DMA_BLOCKS) {
+				return false;
+			}
+
+			tx_blk = &data->rtio_tx_blks[n];
+			rx_blk = &data->rtio_rx_blks[n];
+
+			if ((tx == NULL) || (rx == NULL)) {
+				blk_len = MIN(len, CONFIG_SPI_MCUX_LPSPI_RTIO_DMA_DUMMY_SIZE);
+			}
+
+			memset(tx_blk, 0, sizeof(*tx_blk));
+			tx_blk->source_address =
+				(uint32_t)((tx != NULL) ? tx : data->rtio_dummy_tx);
+			tx_blk->dest_address = LPSPI_GetTxRegisterAddress(base);
+			tx_blk->block_size = blk_len;
+
+			memset(rx_blk, 0, sizeof(*rx_blk));
+			rx_blk->source_address = LPSPI_GetRxRegisterAddress(base);
+			rx_blk->dest_address =
+				(uint32_t)((rx != NULL) ? rx : data->rtio_dummy_rx);
+			rx_blk->block_size = blk_len;
+
+			if (n > 0) {
+				data->rtio_tx_blks[n - 1].next_block = tx_blk;
+				data->rtio_rx_blks[n - 1].next_block = rx_blk;
+			}
+			n++;
+
+			if (tx != NULL) {
+				tx += blk_len;
+			}
+			if (rx != NULL) {
+				rx += blk_len;
+			}
+			len -= blk_len;
+		}
+	}
+
+	if (n == 0) {
+		return false;
+	}
+
+	data->rtio_tx_blks[0].source_gather_en = 1;
+	data->rtio_rx_blks[0].dest_scatter_en = 1;
+
+	data->dma_tx.dma_cfg.channel_direction = MEMORY_TO_PERIPHERAL;
+	data->dma_tx.dma_cfg.source_burst_length = 1;
+	data->dma_tx.dma_cfg.block_count = n;
+	data->dma_tx.dma_cfg.head_block = data->rtio_tx_blks;
+	data->dma_tx.dma_cfg.user_data = (struct device *)dev;
+
+	data->dma_rx.dma_cfg.channel_direction = PERIPHERAL_TO_MEMORY;
+	data->dma_rx.dma_cfg.source_burst_length = 1;
+	data->dma_rx.dma_cfg.block_count = n;
+	data->dma_rx.dma_cfg.head_block = data->rtio_rx_blks;
+	data->dma_rx.dma_cfg.user_data = (struct device *)dev;
+
+	return true;
+}
+
+/*
+ * Starts the whole current transaction as DMA chains, returns false when
+ * it is to be run one submission at a time.
+ */
+static bool spi_mcux_rtio_dma_start(const struct device *dev)
+{
+	struct spi_mcux_data *data = dev->data;
+	LPSPI_Type *base = (LPSPI_Type *)DEVICE_MMIO_NAMED_GET(dev, reg_base);
+
+	if ((data->dma_tx.dma_dev == NULL) || (data->dma_rx.dma_dev == NULL) ||
+	    !spi_mcux_rtio_dma_prep(dev)) {
+		return false;
+	}
+
+	/* Restored by the next transfer not using DMA */
+	LPSPI_SetFifoWatermarks(base, 0U, 0U);
+
+	if ((dma_config(data->dma_tx.dma_dev, data->dma_tx.channel,
+			&data->dma_tx.dma_cfg) != 0) ||
+	    (dma_config(data->dma_rx.dma_dev, data->dma_rx.channel,
+			&data->dma_rx.dma_cfg) != 0)) {
+		/* Typically more blocks than DMA_TCD_QUEUE_SIZE */
+		return false;
+	}
+
+	if ((dma_start(data->dma_tx.dma_dev, data->dma_tx.channel) != 0) ||
+	    (dma_start(data->dma_rx.dma_dev, data->dma_rx.channel) != 0)) {
+		dma_stop(data->dma_tx.dma_dev, data->dma_tx.channel);
+		return false;
+	}
+
+	LPSPI_EnableDMA(base, kLPSPI_TxDmaEnable | kLPSPI_RxDmaEnable);
+
+	return true;
+}
+
+static void spi_mcux_rtio_dma_complete(const struct device *dev, int status)
+{
+	struct spi_mcux_data *data = dev->data;
+	LPSPI_Type *base = (LPSPI_Type *)DEVICE_MMIO_NAMED_GET(dev, reg_base);
+	struct rtio_iodev_sqe *txn_head = data->txn_head;
+
+	LPSPI_DisableDMA(base, kLPSPI_TxDmaEnable | kLPSPI_RxDmaEnable);
+
+	spi_context_cs_control(&data->ctx, false);
+	spi_mcux_iodev_next(dev, true);
+
+	if (status == 0) {
+		rtio_iodev_sqe_ok(txn_head, 0);
+	} else {
+		rtio_iodev_sqe_err(txn_head, status);
+	}
+}
+
+/* This function is executed in the interrupt context */
+static void spi_mcux_rtio_dma_callback(const struct device *dev, uint32_t channel,
+				       int status)
+{
+	struct spi_mcux_data *data = dev->data;
+	struct dma_status rx_status;
+
+	if (status < 0) {
+		LOG_ERR("DMA callback error with channel %d.", channel);
+		dma_stop(data->dma_tx.dma_dev, data->dma_tx.channel);
+		dma_stop(data->dma_rx.dma_dev, data->dma_rx.channel);
+		spi_mcux_rtio_dma_complete(dev, -EIO);
+		return;
+	}
+
+	/* The last byte received ends the transaction, the callback may also
+	 * come for every block of the chain.
+	 */
+	if ((channel != data->dma_rx.channel) ||
+	    (dma_get_status(data->dma_rx.dma_dev, data->dma_rx.channel, &rx_status) != 0) ||
+	    rx_status.busy) {
+		return;
+	}
+
+	spi_mcux_rtio_dma_complete(dev, 0);
+}
+#endif /* CONFIG_SPI_MCUX_LPSPI_RTIO_DMA */
+
 static void spi_mcux_iodev_start(const struct device *dev)
 {
 	/* const struct spi_mcux_config *config = dev->config; */
@@ -810,6 +1025,11 @@ static void spi_mcux_iodev_next(const struct device *dev, bool completion)
 
 		spi_mcux_configure(dev, spi_cfg);
 		spi_context_cs_control(&data->ctx, true);
+#ifdef CONFIG_SPI_MCUX_LPSPI_RTIO_DMA
+		if (spi_mcux_rtio_dma_start(dev)) {
+			return;
+		}
+#endif
 		spi_mcux_iodev_start(dev);
 	}
 }
@@ -7,65 +7,210 @@
 
 #include <zephyr/drivers/video.h>
 
+#if defined(CONFIG_DCACHE_LINE_SIZE) && \
+	(CONFIG_DCACHE_LINE_SIZE > CONFIG_VIDEO_BUFFER_POOL_ALIGN)
+#define VIDEO_BUFFER_ALIGN CONFIG_DCACHE_LINE_SIZE
+#else
+#define VIDEO_BUFFER_ALIGN CONFIG_VIDEO_BUFFER_POOL_ALIGN
+#endif
+
+#define VIDEO_BLOCK_NUM (CONFIG_VIDEO_BUFFER_POOL_NUM_MAX + CONFIG_VIDEO_BUFFER_IMPORT_NUM_MAX)
+#define VIDEO_BUF_NUM (VIDEO_BLOCK_NUM + CONFIG_VIDEO_BUFFER_SHARE_NUM_MAX)
+
+/* Room for the heap to align every buffer */
 K_HEAP_DEFINE(video_buffer_pool,
-	      CONFIG_VIDEO_BUFFER_POOL_SZ_MAX *
+	      (CONFIG_VIDEO_BUFFER_POOL_SZ_MAX + VIDEO_BUFFER_ALIGN) *
 	      CONFIG_VIDEO_BUFFER_POOL_NUM_MAX);
 
-static struct video_buffer video_buf[CONFIG_VIDEO_BUFFER_POOL_NUM_MAX];
-
+/*
+ * The memory of a frame is a block, which all the buffers queued to the
+ * consumers of this frame refer to. The block is given back to the pool,
+ * or to its owner when imported, once the last of them is released.
+ */
 struct mem_block {
 	void *data;
+	uint32_t size;
+	uint8_t refcount;
+	bool imported;
 };
 
-static struct mem_block video_block[CONFIG_VIDEO_BUFFER_POOL_NUM_MAX];
+struct video_buf_slot {
+	struct video_buffer vbuf;
+	struct mem_block *block;
+};
 
-struct video_buffer *video_buffer_alloc(size_t size)
+static struct video_buf_slot video_buf[VIDEO_BUF_NUM];
+static struct mem_block video_block[VIDEO_BLOCK_NUM];
+static struct k_spinlock video_buf_lock;
+
+static struct video_buf_slot *video_buf_slot(struct video_buffer *vbuf)
 {
-	struct video_buffer *vbuf = NULL;
-	struct mem_block *block;
-	int i;
+	struct video_buf_slot *slot = CONTAINER_OF(vbuf, struct video_buf_slot, vbuf);
+
+	if (slot < &video_buf[0] || slot >= &video_buf[ARRAY_SIZE(video_buf)]) {
+		return NULL;
+	}
+
+	return slot;
+}
+
+static struct video_buf_slot *video_buf_get(struct mem_block *block)
+{
+	k_spinlock_key_t key = k_spin_lock(&video_buf_lock);
+	struct video_buf_slot *slot = NULL;
+
+	for (size_t i = 0; i < ARRAY_SIZE(video_buf); i++) {
+		if (video_buf[i].block == NULL) {
+			slot = &video_buf[i];
+			slot->block = block;
+			block->refcount++;
+			break;
+		}
+	}
 
-	/* find available video buffer */
-	for (i = 0; i < ARRAY_SIZE(video_buf); i++) {
-		if (video_buf[i].buffer == NULL) {
-			vbuf = &video_buf[i];
+	k_spin_unlock(&video_buf_lock, key);
+
+	if (slot != NULL) {
+		slot->vbuf.driver_data = NULL;
+		slot->vbuf.buffer = block->data;
+		slot->vbuf.size = block->size;
+		slot->vbuf.bytesused = 0;
+		slot->vbuf.timestamp = 0;
+	}
+
+	return slot;
+}
+
+static struct mem_block *video_block_get(void *data, uint32_t size, bool imported)
+{
+	k_spinlock_key_t key = k_spin_lock(&video_buf_lock);
+	struct mem_block *block = NULL;
+
+	for (size_t i = 0; i < ARRAY_SIZE(video_block); i++) {
+		if (video_block[i].data == NULL) {
 			block = &video_block[i];
+			block->data = data;
+			block->size = size;
+			block->refcount = 0;
+			block->imported = imported;
 			break;
 		}
 	}
 
-	if (vbuf == NULL) {
+	k_spin_unlock(&video_buf_lock, key);
+
+	return block;
+}
+
+static struct video_buffer *video_block_wrap(void *data, uint32_t size, bool imported)
+{
+	struct video_buf_slot *slot;
+	struct mem_block *block;
+
+	block = video_block_get(data, size, imported);
+	if (block == NULL) {
 		return NULL;
 	}
 
+	slot = video_buf_get(block);
+	if (slot == NULL) {
+		/* Not visible to anyone yet */
+		block->data = NULL;
+		return NULL;
+	}
+
+	return &slot->vbuf;
+}
+
+struct video_buffer *video_buffer_alloc(size_t size)
+{
+	struct video_buffer *vbuf;
+	void *data;
+
+	/* Whole cache lines, so that the cache maintenance of DMA transfers
+	 * does not spill over the neighbouring buffers.
+	 */
+	size = ROUND_UP(size, VIDEO_BUFFER_ALIGN);
+
 	/* Alloc buffer memory */
-	block->data = k_heap_alloc(&video_buffer_pool, size, K_FOREVER);
-	if (block->data == NULL) {
+	data = k_heap_aligned_alloc(&video_buffer_pool, VIDEO_BUFFER_ALIGN, size, K_FOREVER);
+	if (data == NULL) {
 		return NULL;
 	}
 
-	vbuf->buffer = block->data;
-	vbuf->size = size;
-	vbuf->bytesused = 0;
+	vbuf = video_block_wrap(data, size, false);
+	if (vbuf == NULL) {
+		k_heap_free(&video_buffer_pool, data);
+	}
 
 	return vbuf;
 }
 
+struct video_buffer *video_buffer_import(void *data, size_t size)
+{
+	if (data == NULL || size == 0) {
+		return NULL;
+	}
+
+	if (((uintptr_t)data % VIDEO_BUFFER_ALIGN) != 0) {
+		return NULL;
+	}
+
+	return video_block_wrap(data, size, true);
+}
+
+struct video_buffer *video_buffer_share(struct video_buffer *vbuf)
+{
+	struct video_buf_slot *src = video_buf_slot(vbuf);
+	struct video_buf_slot *slot;
+
+	if (src == NULL || src->block == NULL) {
+		return NULL;
+	}
+
+	slot = video_buf_get(src->block);
+	if (slot == NULL) {
+		return NULL;
+	}
+
+	slot->vbuf.bytesused = vbuf->bytesused;
+	slot->vbuf.timestamp = vbuf->timestamp;
+
+	return &slot->vbuf;
+}
+
 void video_buffer_release(struct video_buffer *vbuf)
 {
-	struct mem_block *block = NULL;
-	int i;
+	struct video_buf_slot *slot = video_buf_slot(vbuf);
+	struct mem_block *block;
+	k_spinlock_key_t key;
+	void *data = NULL;
 
-	/* vbuf to block */
-	for (i = 0; i < ARRAY_SIZE(video_block); i++) {
-		if (video_block[i].data == vbuf->buffer) {
-			block = &video_block[i];
-			break;
-		}
+	if (slot == NULL) {
+		return;
+	}
+
+	key = k_spin_lock(&video_buf_lock);
+
+	block = slot->block;
+	if (block == NULL) {
+		k_spin_unlock(&video_buf_lock, key);
+		return;
 	}
 
+	slot->block = NULL;
 	vbuf->buffer = NULL;
-	if (block) {
-		k_heap_free(&video_buffer_pool, block->data);
+
+	if (--block->refcount == 0) {
+		if (!block->imported) {
+			data = block->data;
+		}
+		block->data = NULL;
+	}
+
+	k_spin_unlock(&video_buf_lock, key);
+
+	if (data != NULL) {
+		k_heap_free(&video_buffer_pool, data);
 	}
 }
@@ -97,7 +97,8 @@ struct k_mem_domain {
  * haven't been added to or inherited membership from some other domain.
  *
  * This memory domain has the z_libc_partition partition for the C library
- * added to it if exists.
+ * added to it if exists, and the z_vdso_partition partition if
+ * CONFIG_USERSPACE_VDSO is enabled.
  */
 extern struct k_mem_domain k_mem_domain_default;
 #else
@@ -72,6 +72,20 @@ struct arm_mpu_config {
  */
 extern const struct arm_mpu_config mpu_config;
 
+#if defined(CONFIG_ARM_MPU_DOMAIN_CACHE)
+/* MPU_RBAR and MPU_RASR values of the regions of a memory domain,
+ * computed when the domain is first programmed after a change.
+ */
+struct arch_mem_domain {
+	struct {
+		uint32_t rbar;
+		uint32_t rasr;
+	} regions[CONFIG_MAX_DOMAIN_PARTITIONS];
+	uint8_t num_regions;
+	bool valid;
+};
+#endif /* CONFIG_ARM_MPU_DOMAIN_CACHE */
+
 #endif /* _ASMLANGUAGE */
 
 #endif /* ZEPHYR_INCLUDE_ARCH_ARM_MPU_ARM_MPU_H_ */
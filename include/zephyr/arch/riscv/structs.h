@@ -22,6 +22,10 @@ struct _cpu_arch {
 	atomic_ptr_val_t fpu_owner;
 	uint32_t fpu_state;
 #endif
+#ifdef CONFIG_RISCV_VECTOR_SHARING
+	atomic_ptr_val_t vector_owner;
+	uint32_t vector_state;
+#endif
 };
 
 #endif /* ZEPHYR_INCLUDE_RISCV_STRUCTS_H_ */
@@ -63,6 +63,18 @@ struct z_riscv_fp_context {
 };
 typedef struct z_riscv_fp_context z_riscv_fp_context_t;
 
+#ifdef CONFIG_RISCV_VECTOR_SHARING
+struct z_riscv_vector_context {
+	unsigned long vstart;
+	unsigned long vl;
+	unsigned long vtype;
+	unsigned long vcsr;
+	/* v0 to v31 */
+	uint8_t v[32 * (CONFIG_RISCV_VECTOR_VLEN / 8)];
+};
+typedef struct z_riscv_vector_context z_riscv_vector_context_t;
+#endif
+
 #define PMP_M_MODE_SLOTS 8	/* 8 is plenty enough for m-mode */
 
 struct _thread_arch {
@@ -71,6 +83,10 @@ struct _thread_arch {
 	bool fpu_recently_used;
 	uint8_t exception_depth;
 #endif
+#ifdef CONFIG_RISCV_VECTOR_SHARING
+	struct z_riscv_vector_context saved_vector_context;
+	bool vector_recently_used;
+#endif
 #ifdef CONFIG_USERSPACE
 	unsigned long priv_stack_start;
 	unsigned long u_mode_pmpaddr_regs[CONFIG_PMP_SLOTS];
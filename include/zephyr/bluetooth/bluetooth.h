@@ -2065,6 +2065,23 @@ struct bt_le_scan_recv_info {
 	uint8_t secondary_phy;
 };
 
+/** Advertising report delivered as part of a batch. */
+struct bt_le_scan_report {
+	/** Advertiser packet and scan response information. The address
+	 *  points to @ref bt_le_scan_report.addr.
+	 */
+	struct bt_le_scan_recv_info info;
+
+	/** Advertiser LE address and type. */
+	bt_addr_le_t addr;
+
+	/** Advertising data. */
+	const uint8_t *data;
+
+	/** Length of the advertising data. */
+	uint16_t data_len;
+};
+
 /** Listener context for (LE) scanning. */
 struct bt_le_scan_cb {
 
@@ -2080,6 +2097,22 @@ struct bt_le_scan_cb {
 	/** @brief The scanner has stopped scanning after scan timeout. */
 	void (*timeout)(void);
 
+#if defined(CONFIG_BT_SCAN_BATCH)
+	/**
+	 * @brief Batch of advertisement packets and scan responses received.
+	 *
+	 * Reports are collected and given together, either when
+	 * @kconfig{CONFIG_BT_SCAN_BATCH_COUNT} reports have been received,
+	 * when the batch data buffer is full, or
+	 * @kconfig{CONFIG_BT_SCAN_BATCH_TIMEOUT} milliseconds after the first
+	 * report of the batch. The reports are only valid during the call.
+	 *
+	 * @param reports Received reports, oldest first.
+	 * @param count   Number of reports.
+	 */
+	void (*recv_batch)(const struct bt_le_scan_report *reports, size_t count);
+#endif /* CONFIG_BT_SCAN_BATCH */
+
 	sys_snode_t node;
 };
 
@@ -310,6 +310,14 @@ struct bt_conn_le_info {
 	/* Connection maximum single fragment parameters */
 	const struct bt_conn_le_data_len_info *data_len;
 #endif /* defined(CONFIG_BT_USER_DATA_LEN_UPDATE) */
+
+	/** Number of connected ATT bearers, including the unenhanced one.
+	 *
+	 *  GATT client requests are distributed over the bearers, so this is
+	 *  the number of GATT procedures that can be in progress at the same
+	 *  time.
+	 */
+	uint8_t att_bearers;
 };
 
 /** @brief Convert connection interval to milliseconds
@@ -537,6 +545,47 @@ enum bt_conn_auth_keypress {
  */
 int bt_conn_get_info(const struct bt_conn *conn, struct bt_conn_info *info);
 
+/** Connection TX statistics */
+struct bt_conn_tx_stats {
+	/** Bytes queued in the host and not yet given to the controller */
+	uint32_t queued_bytes;
+	/** Number of packets given to the controller */
+	uint32_t sent;
+	/** Average time packets waited in the host, in milliseconds */
+	uint32_t latency_avg;
+	/** Longest time a packet waited in the host, in milliseconds */
+	uint32_t latency_max;
+};
+
+/** @brief Set the TX weight of a connection.
+ *
+ *  Connections with data to send share the controller buffers in
+ *  proportion to their weight. The weight of a new connection is
+ *  @kconfig{CONFIG_BT_CONN_TX_SCHED_WEIGHT}, or
+ *  @kconfig{CONFIG_BT_CONN_TX_SCHED_ISO_WEIGHT} for ISO channels.
+ *
+ *  @note Requires @kconfig{CONFIG_BT_CONN_TX_SCHED}.
+ *
+ *  @param conn   Connection object.
+ *  @param weight Weight of the connection, 1 to 255.
+ *
+ *  @return Zero on success or (negative) error code on failure.
+ */
+int bt_conn_set_tx_weight(struct bt_conn *conn, uint8_t weight);
+
+/** @brief Get TX statistics of a connection.
+ *
+ *  The statistics are reset when the connection is established.
+ *
+ *  @note Requires @kconfig{CONFIG_BT_CONN_TX_SCHED}.
+ *
+ *  @param conn  Connection object.
+ *  @param stats TX statistics object.
+ *
+ *  @return Zero on success or (negative) error code on failure.
+ */
+int bt_conn_get_tx_stats(const struct bt_conn *conn, struct bt_conn_tx_stats *stats);
+
 /** @brief Get connection info for the remote device.
  *
  *  @param conn Connection object.
@@ -1030,6 +1030,103 @@ int bt_iso_chan_get_info(const struct bt_iso_chan *chan,
  */
 int bt_iso_chan_get_tx_sync(const struct bt_iso_chan *chan, struct bt_iso_tx_info *info);
 
+#if defined(CONFIG_BT_ISO_TX_STREAM) || defined(__DOXYGEN__)
+struct bt_iso_tx_stream;
+
+/** @brief ISO TX stream fill callback
+ *
+ *  Called once per SDU interval to write the next SDU, for example the
+ *  output of an audio encoder, directly into a preallocated buffer of the
+ *  stream with net_buf_add().
+ *
+ *  @param stream  Stream object.
+ *  @param buf     Empty buffer with room for one SDU.
+ *  @param seq_num Sequence number the SDU will be sent with.
+ *
+ *  @return 0 to send the SDU or (negative) error code to skip this SDU
+ *          interval.
+ */
+typedef int (*bt_iso_tx_stream_fill_t)(struct bt_iso_tx_stream *stream,
+				       struct net_buf *buf, uint16_t seq_num);
+
+/** @brief ISO TX stream structure
+ *
+ *  Sends one SDU per SDU interval on an ISO channel from a pool of
+ *  preallocated buffers. Once the controller has reported the timing of a
+ *  transmitted SDU, SDUs are sent with timestamps derived from it, so that
+ *  they are placed in the right SDU interval regardless of when the host
+ *  submits them. Define with @ref BT_ISO_TX_STREAM_DEFINE.
+ */
+struct bt_iso_tx_stream {
+	/** Pool of SDU buffers of the stream */
+	struct net_buf_pool *pool;
+	/** Fill callback */
+	bt_iso_tx_stream_fill_t fill;
+	/** Number of SDU intervals for which no buffer was available */
+	uint32_t underruns;
+
+	/** @internal Channel the stream is sending on */
+	struct bt_iso_chan *chan;
+	/** @internal SDU interval in microseconds */
+	uint32_t interval;
+	/** @internal Sequence number of the next SDU */
+	uint16_t seq_num;
+	/** @internal Sequence number and timestamp of the reference SDU */
+	uint16_t sync_seq_num;
+	uint32_t sync_ts;
+	/** @internal Number of SDUs sent since the last synchronization */
+	uint16_t since_sync;
+	/** @internal True when the reference SDU is valid */
+	bool synced;
+	/** @internal SDU interval timer */
+	struct k_timer timer;
+	/** @internal Work item sending the SDUs */
+	struct k_work work;
+};
+
+/** @brief Define an ISO TX stream
+ *
+ *  @param _name  Name of the stream object.
+ *  @param _count Number of preallocated SDU buffers.
+ *  @param _sdu   Maximum SDU size of the stream.
+ *  @param _fill  Fill callback, see @ref bt_iso_tx_stream_fill_t.
+ */
+#define BT_ISO_TX_STREAM_DEFINE(_name, _count, _sdu, _fill)                                 \
+	NET_BUF_POOL_FIXED_DEFINE(_name##_pool, _count, BT_ISO_SDU_BUF_SIZE(_sdu),           \
+				  CONFIG_BT_CONN_TX_USER_DATA_SIZE, NULL);                   \
+	static struct bt_iso_tx_stream _name = {                                             \
+		.pool = &_name##_pool,                                                       \
+		.fill = _fill,                                                               \
+	}
+
+/** @brief Start an ISO TX stream
+ *
+ *  The first SDU is filled and sent right away, and then every SDU
+ *  interval.
+ *
+ *  @param stream   Stream object.
+ *  @param chan     Connected channel to send on.
+ *  @param interval SDU interval in microseconds.
+ *  @param seq_num  Sequence number of the first SDU.
+ *
+ *  @return Zero on success or (negative) error code on failure.
+ */
+int bt_iso_tx_stream_start(struct bt_iso_tx_stream *stream, struct bt_iso_chan *chan,
+			   uint32_t interval, uint16_t seq_num);
+
+/** @brief Stop an ISO TX stream
+ *
+ *  SDUs already given to the channel are still sent. The stream is stopped
+ *  automatically when the channel is disconnected. Must not be called from
+ *  the fill callback.
+ *
+ *  @param stream Stream object.
+ *
+ *  @return Zero on success or (negative) error code on failure.
+ */
+int bt_iso_tx_stream_stop(struct bt_iso_tx_stream *stream);
+#endif /* CONFIG_BT_ISO_TX_STREAM */
+
 /** @brief Creates a BIG as a broadcaster
  *
  *  @param[in] padv      Pointer to the periodic advertising object the BIGInfo shall be sent on.
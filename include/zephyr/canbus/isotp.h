@@ -436,7 +436,7 @@ struct isotp_send_ctx {
 	};
 	struct isotp_fc_opts opts;
 	uint8_t state;
-	uint8_t tx_backlog;
+	atomic_t tx_backlog;
 	struct k_sem tx_sem;
 	struct isotp_msg_id rx_addr;
 	struct isotp_msg_id tx_addr;
@@ -51,6 +51,7 @@ enum cipher_mode {
 
 /* Forward declarations */
 struct cipher_aead_pkt;
+struct cipher_aead_req;
 struct cipher_ctx;
 struct cipher_pkt;
 
@@ -71,6 +72,10 @@ typedef int (*ccm_op_t)(struct cipher_ctx *ctx, struct cipher_aead_pkt *pkt,
 typedef int (*gcm_op_t)(struct cipher_ctx *ctx, struct cipher_aead_pkt *pkt,
 			 uint8_t *nonce);
 
+/* Function signature for submitting several CCM or GCM operations at once */
+typedef int (*aead_batch_op_t)(struct cipher_ctx *ctx, struct cipher_aead_req *reqs,
+			       size_t num_reqs);
+
 struct cipher_ops {
 
 	enum cipher_mode cipher_mode;
@@ -82,6 +87,11 @@ struct cipher_ops {
 		ccm_op_t	ccm_crypt_hndlr;
 		gcm_op_t	gcm_crypt_hndlr;
 	};
+
+	/** Optional, for CCM and GCM sessions of drivers able to queue
+	 * several operations to the hardware at once.
+	 */
+	aead_batch_op_t	aead_batch_hndlr;
 };
 
 struct ccm_params {
@@ -233,6 +243,25 @@ struct cipher_aead_pkt {
 	uint8_t *tag;
 };
 
+/**
+ * Structure encoding one operation of a batch of AEAD operations.
+ *
+ * App has to furnish pkt and nonce prior to making cipher_aead_batch_op()
+ * call.
+ */
+struct cipher_aead_req {
+	/** AEAD packet of the operation. This has to be supplied by the app. */
+	struct cipher_aead_pkt *pkt;
+
+	/** Nonce of the operation. This has to be supplied by the app. */
+	uint8_t *nonce;
+
+	/** Result of the operation, populated by the driver on return from
+	 * cipher_aead_batch_op() for sync sessions.
+	 */
+	int status;
+};
+
 /* Prototype for the application function to be invoked by the crypto driver
  * on completion of an async request. The app may get the session context
  * via the pkt->ctx field. For CCM ops the encompassing AEAD packet may be
@@ -185,6 +185,9 @@ static inline int cipher_begin_session(const struct device *dev,
 	__ASSERT(flags != (CAP_SYNC_OPS |  CAP_ASYNC_OPS),
 			"conflicting options for sync/async");
 
+	/* Only set by the drivers supporting it */
+	ctx->ops.aead_batch_hndlr = NULL;
+
 	return api->cipher_begin_session(dev, ctx, algo, mode, optype);
 }
 
@@ -349,6 +352,62 @@ static inline int cipher_gcm_op(struct cipher_ctx *ctx,
 	return ctx->ops.gcm_crypt_hndlr(ctx, pkt, nonce);
 }
 
+/**
+ * @brief Perform several CCM or GCM crypto operations
+ *
+ * Submits all the operations of a session in one call, such as the records
+ * or frames waiting to be sent, so that a driver that can queue them to the
+ * hardware does so without waiting for each to finish. Drivers without
+ * support for batches get the operations one after the other.
+ *
+ * For sync sessions, the status of each operation is stored in its request
+ * when this returns. For async sessions, the completion callback is called
+ * once per operation and the operations complete in the order given.
+ *
+ * @param  ctx       Pointer to the crypto context of this op.
+ * @param  reqs      Operations to perform, each with its AEAD packet and
+ *			 nonce. Nonces should not be reused across operations
+ *			 within a session context for security.
+ * @param  num_reqs  Number of operations.
+ *
+ * @return 0 if all the operations succeeded or were submitted, otherwise the
+ *	   error of the first that failed.
+ */
+static inline int cipher_aead_batch_op(struct cipher_ctx *ctx,
+				       struct cipher_aead_req *reqs,
+				       size_t num_reqs)
+{
+	int ret = 0;
+
+	__ASSERT(ctx->ops.cipher_mode == CRYPTO_CIPHER_MODE_CCM ||
+		 ctx->ops.cipher_mode == CRYPTO_CIPHER_MODE_GCM, "AEAD mode "
+		 "session expected for a batch");
+
+	for (size_t i = 0; i < num_reqs; i++) {
+		reqs[i].pkt->pkt->ctx = ctx;
+	}
+
+	if (ctx->ops.aead_batch_hndlr != NULL) {
+		return ctx->ops.aead_batch_hndlr(ctx, reqs, num_reqs);
+	}
+
+	for (size_t i = 0; i < num_reqs; i++) {
+		if (ctx->ops.cipher_mode == CRYPTO_CIPHER_MODE_CCM) {
+			reqs[i].status = ctx->ops.ccm_crypt_hndlr(ctx, reqs[i].pkt,
+								  reqs[i].nonce);
+		} else {
+			reqs[i].status = ctx->ops.gcm_crypt_hndlr(ctx, reqs[i].pkt,
+								  reqs[i].nonce);
+		}
+
+		if (reqs[i].status != 0 && ret == 0) {
+			ret = reqs[i].status;
+		}
+	}
+
+	return ret;
+}
+
 
 /**
  * @}
@@ -112,6 +112,65 @@ struct json_obj_descr {
 	};
 };
 
+#if defined(CONFIG_JSON_STREAM_PARSER) || defined(__DOXYGEN__)
+/** @cond INTERNAL_HIDDEN */
+struct json_stream_frame {
+	const struct json_obj_descr *descr;
+	void *val;
+	union {
+		struct {
+			size_t descr_len;
+			int64_t decoded;
+			int key;
+		} object;
+		struct {
+			char *field;
+			char *last;
+			size_t *elements;
+		} array;
+	};
+	uint8_t state;
+};
+/** @endcond */
+
+/**
+ * @brief Streaming JSON parser
+ *
+ * Use json_stream_parser_init() to initialize the parser and
+ * json_stream_parse() to feed it with data.
+ */
+struct json_stream_parser {
+	/** @cond INTERNAL_HIDDEN */
+	/* Objects and arrays being decoded, outermost first */
+	struct json_stream_frame stack[CONFIG_JSON_STREAM_PARSER_MAX_DEPTH];
+	int depth;
+
+	const struct json_obj_descr *descr;
+	size_t descr_len;
+	void *val;
+
+	/* Storage for decoded strings, also holding partial tokens */
+	char *buf;
+	size_t buf_size;
+	size_t buf_used;
+	size_t tok_start;
+
+	/* Value being lexed and where it is decoded to */
+	const struct json_obj_descr *value_descr;
+	void *field;
+	const char *literal;
+	size_t nest;
+	uint8_t lex;
+	uint8_t store;
+	uint8_t hex;
+	bool esc;
+	bool in_str;
+
+	int64_t result;
+	/** @endcond */
+};
+#endif /* CONFIG_JSON_STREAM_PARSER */
+
 /**
  * @brief Function pointer type to append bytes to a buffer while
  * encoding JSON data.
@@ -689,6 +748,64 @@ int json_arr_separate_object_parse_init(struct json_obj *json, char *payload, si
 int json_arr_separate_parse_object(struct json_obj *json, const struct json_obj_descr *descr,
 				   size_t descr_len, void *val);
 
+#if defined(CONFIG_JSON_STREAM_PARSER) || defined(__DOXYGEN__)
+/**
+ * @brief Initialize a streaming JSON object parser
+ *
+ * Unlike json_obj_parse(), the streaming parser does not need the whole
+ * JSON document at once: it is fed with consecutive chunks of it, as they
+ * are received, with json_stream_parse(). Values are decoded according to
+ * @a descr in the same way json_obj_parse() does, as soon as they are
+ * complete.
+ *
+ * As chunks do not have to be kept around once parsed, strings, opaque
+ * values, floats and object arrays (see JSON_OBJ_DESCR_PRIM(),
+ * JSON_TOK_OPAQUE, JSON_TOK_FLOAT and JSON_TOK_OBJ_ARRAY) are copied to
+ * @a buf, which must be kept until decoded values are not used anymore.
+ * The buffer also holds numbers and keys while they are being parsed, so
+ * it must have room for the longest of them.
+ *
+ * Objects and arrays can be nested up to
+ * @kconfig{CONFIG_JSON_STREAM_PARSER_MAX_DEPTH} levels, the top-level
+ * object included. This only concerns values matching a descriptor,
+ * unknown fields are skipped whatever their depth.
+ *
+ * @param parser Parser state.
+ * @param descr Pointer to the descriptor array
+ * @param descr_len Number of elements in the descriptor array. Must be less
+ * than 63 due to implementation detail reasons.
+ * @param val Pointer to the struct to hold the decoded values
+ * @param buf Storage for decoded strings.
+ * @param buf_size Size of @a buf.
+ */
+void json_stream_parser_init(struct json_stream_parser *parser,
+			     const struct json_obj_descr *descr, size_t descr_len,
+			     void *val, char *buf, size_t buf_size);
+
+/**
+ * @brief Parse a chunk of a JSON-encoded object
+ *
+ * Chunks are split arbitrarily, tokens can span several of them. Once the
+ * top-level object is complete, any data following it is ignored, and
+ * subsequent calls return the same value.
+ *
+ * @param parser Parser state, initialized with json_stream_parser_init().
+ * @param data Chunk of the JSON document.
+ * @param len Length of @a data.
+ *
+ * @retval -EAGAIN if the object is not complete yet and more data is
+ * expected.
+ * @retval -ENOMEM if the string storage is too small.
+ * @retval -E2BIG if values are nested too deep.
+ * @return Other negative values on other errors (as defined on errno.h),
+ * which are not recoverable, otherwise bitmap of decoded fields of the
+ * top-level object (bit 0 is set if first field in the descriptor has been
+ * properly decoded, etc).
+ */
+int64_t json_stream_parse(struct json_stream_parser *parser,
+			  const char *data, size_t len);
+#endif /* CONFIG_JSON_STREAM_PARSER */
+
 /**
  * @brief Escapes the string so it can be used to encode JSON objects
  *
@@ -801,6 +918,30 @@ int json_obj_encode(const struct json_obj_descr *descr, size_t descr_len,
 int json_arr_encode(const struct json_obj_descr *descr, const void *val,
 		    json_append_bytes_t append_bytes, void *data);
 
+#if defined(CONFIG_NET_BUF) || defined(__DOXYGEN__)
+struct net_buf;
+
+/**
+ * @brief Encodes an object into a chain of network buffers
+ *
+ * Encoded data is appended to @a buf, and once it is full to the next
+ * fragments of the fragment chain, so that large objects can be encoded
+ * without a contiguous buffer big enough to hold them. No fragment is
+ * allocated, the chain provided by the caller must be large enough.
+ *
+ * @param descr Pointer to the descriptor array
+ * @param descr_len Number of elements in the descriptor array
+ * @param val Struct holding the values
+ * @param buf First fragment of the chain receiving the JSON data
+ *
+ * @return 0 if object has been successfully encoded, -ENOMEM if the
+ * fragment chain is too small, or another negative value on other errors
+ * (as defined on errno.h).
+ */
+int json_obj_encode_net_buf(const struct json_obj_descr *descr, size_t descr_len,
+			    const void *val, struct net_buf *buf);
+#endif /* CONFIG_NET_BUF */
+
 #ifdef __cplusplus
 }
 #endif
@@ -136,6 +136,14 @@ struct coredump_cmd_copy_arg {
 #define	COREDUMP_MEM_HDR_ID		'M'
 #define COREDUMP_MEM_HDR_VER		1
 
+/* Memory block made of chunks, see struct coredump_mem_chunk_hdr_t */
+#define COREDUMP_MEM_HDR_VER_CHUNKED	2
+
+/* Chunk types */
+#define COREDUMP_MEM_CHUNK_RAW		'R'
+#define COREDUMP_MEM_CHUNK_LZ4		'L'
+#define COREDUMP_MEM_CHUNK_ZERO		'Z'
+
 /* Target code */
 enum coredump_tgt_code {
 	COREDUMP_TGT_UNKNOWN = 0,
@@ -194,6 +202,25 @@ struct coredump_mem_hdr_t {
 	uintptr_t	end;
 } __packed;
 
+/*
+ * Chunk header, in the memory blocks of version COREDUMP_MEM_HDR_VER_CHUNKED.
+ * The chunks follow each other until they cover the whole memory region.
+ */
+struct coredump_mem_chunk_hdr_t {
+	/* COREDUMP_MEM_CHUNK_* */
+	char		type;
+
+	/* Number of bytes of memory covered by the chunk */
+	uint16_t	size;
+
+	/*
+	 * Number of bytes following this header: the raw memory or the
+	 * LZ4 block of the memory, nothing for memory that was zero or
+	 * unused.
+	 */
+	uint16_t	data_size;
+} __packed;
+
 typedef void (*coredump_backend_start_t)(void);
 typedef void (*coredump_backend_end_t)(void);
 typedef void (*coredump_backend_buffer_output_t)(uint8_t *buf, size_t buflen);
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_DEBUG_INIT_PROFILE_H_
+#define ZEPHYR_INCLUDE_DEBUG_INIT_PROFILE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/init.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup init_profile Boot-time init profiling
+ * @ingroup os_services
+ * @brief Timing of every init entry run during boot
+ *
+ * With @kconfig{CONFIG_INIT_PROFILING}, the kernel records when each
+ * SYS_INIT() entry and device init function starts and returns, in
+ * hardware cycles as read by k_cycle_get_32(). Entries that run before
+ * the system timer driver is initialized may see a counter that is not
+ * yet running.
+ * @{
+ */
+
+/** Timing of one init entry */
+struct init_profile_record {
+	/** Init entry that was run */
+	const struct init_entry *entry;
+	/** Cycle count when the init function was called */
+	uint32_t start;
+	/** Cycle count when the init function returned */
+	uint32_t end;
+	/** Value returned by the init function */
+	int16_t result;
+	/** Init level, 0 for EARLY up to APPLICATION (or SMP) */
+	uint8_t level;
+};
+
+/** Cycle counts of the kernel boot milestones */
+struct init_profile_boot {
+	/** Entry of z_cstart() */
+	uint32_t cstart;
+	/** Call of main() */
+	uint32_t main;
+};
+
+/**
+ * @brief Get the recorded init entries
+ *
+ * Records are in the order the init functions were called. With
+ * @kconfig{CONFIG_DEVICE_INIT_PARALLEL}, the run times of devices
+ * initialized at the same time overlap.
+ *
+ * @param count Set to the number of records.
+ * @param dropped Optional, set to the number of entries that did not fit
+ *        in @kconfig{CONFIG_INIT_PROFILING_MAX_ENTRIES}.
+ *
+ * @return Array of records.
+ */
+const struct init_profile_record *init_profile_get(size_t *count,
+						   size_t *dropped);
+
+/**
+ * @brief Get the boot milestones
+ *
+ * @return Cycle counts of the boot milestones.
+ */
+const struct init_profile_boot *init_profile_boot_get(void);
+
+/**
+ * @brief Name of the entry of a record
+ *
+ * @param record Record to name.
+ *
+ * @return Device name, or name of the SYS_INIT() entry.
+ */
+const char *init_profile_name(const struct init_profile_record *record);
+
+/**
+ * @brief Print all records in a machine-readable format
+ *
+ * Prints one comma-separated line per record, prefixed by a header line:
+ * @code
+ * init_profile,level,prio,name,device,start,end,cycles,result
+ * @endcode
+ * followed by a line with the boot milestones and the number of dropped
+ * records:
+ * @code
+ * init_profile_boot,cstart,<cycles>,main,<cycles>,dropped,<count>
+ * @endcode
+ */
+void init_profile_dump(void);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DEBUG_INIT_PROFILE_H_ */
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_DEBUG_PROFILER_H_
+#define ZEPHYR_INCLUDE_DEBUG_PROFILER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/kernel/thread.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @defgroup profiler Sampling profiler
+ *  @ingroup os_services
+ *  @brief Statistical profiler sampling the interrupted code
+ *
+ *  The profiler records the program counter and the thread interrupted by
+ *  a periodic timer interrupt, optionally with the callers found by walking
+ *  the frame pointers. The samples are kept in a buffer per CPU and can be
+ *  dumped as folded stacks, one sample per line, as used by flame graph
+ *  tools.
+ *  @{
+ */
+
+/** @brief Profiler sample */
+struct profiler_sample {
+	/** Interrupted thread, NULL if an interrupt was interrupted */
+	k_tid_t thread;
+	/** Number of valid entries in @a pc */
+	uint8_t depth;
+	/** Interrupted program counter, followed by the return addresses */
+	uintptr_t pc[CONFIG_PROFILER_STACK_DEPTH];
+};
+
+/** @brief Profiler dump callback function
+ *
+ *  @param line One line of the folded stacks output, without newline.
+ *  @param user_data User data given to profiler_dump_folded().
+ */
+typedef void (*profiler_dump_cb)(const char *line, void *user_data);
+
+/** @brief Start sampling
+ *
+ *  @param period_us Sampling period in microseconds. With a kernel timer as
+ *		     sampling timer, the period is rounded to system ticks.
+ *
+ *  @retval 0 on success.
+ *  @retval -EALREADY if the profiler is running.
+ *  @retval -EINVAL if the period is invalid.
+ *  @retval -errno other negative errno code from the counter driver.
+ */
+int profiler_start(uint32_t period_us);
+
+/** @brief Stop sampling
+ *
+ *  The recorded samples are kept until profiler_reset() is called.
+ *
+ *  @retval 0 on success.
+ *  @retval -EALREADY if the profiler is not running.
+ */
+int profiler_stop(void);
+
+/** @brief Discard all the recorded samples */
+void profiler_reset(void);
+
+/** @brief Take a sample
+ *
+ *  Record the code interrupted by the calling interrupt handler. This is
+ *  called by the profiler timer and can be called from an application
+ *  interrupt, e.g. to sample the other CPUs of an SMP system. It must be
+ *  called directly from the interrupt handler, and does nothing if the
+ *  profiler is not running.
+ */
+void profiler_sample(void);
+
+/** @brief Get the profiler statistics
+ *
+ *  @param samples Number of recorded samples, can be NULL.
+ *  @param dropped Number of samples dropped because the buffer was full,
+ *		   can be NULL.
+ */
+void profiler_stats_get(size_t *samples, uint32_t *dropped);
+
+/** @brief Dump the recorded samples as folded stacks
+ *
+ *  Each sample is output as one line with the thread name, or "isr" for
+ *  interrupts, followed by the addresses from the outermost caller to the
+ *  interrupted program counter, separated by semicolons, and a count of 1.
+ *  The addresses are converted to function names on the host with
+ *  scripts/profiler/symbolize.py.
+ *
+ *  @param cb The callback called for every line.
+ *  @param user_data User data passed to the callback.
+ */
+void profiler_dump_folded(profiler_dump_cb cb, void *user_data);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DEBUG_PROFILER_H_ */
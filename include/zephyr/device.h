@@ -918,6 +918,34 @@ static inline bool z_impl_device_is_ready(const struct device *dev)
 #define Z_DEVICE_SECTION_NAME(level, prio)                                     \
 	_CONCAT(INIT_LEVEL_ORD(level), _##prio)
 
+#if defined(CONFIG_DEVICE_NAME_INDEX) || defined(__DOXYGEN__)
+/**
+ * @brief Entry of the device name index.
+ *
+ * Each static device has one entry, initialized to point to the device.
+ * The entries are sorted by device name at boot; see
+ * @kconfig{CONFIG_DEVICE_NAME_INDEX}.
+ */
+struct z_device_name_slot {
+	/** Device of the entry. */
+	const struct device *dev;
+};
+#endif
+
+/**
+ * @brief Define the name index entry of a device.
+ *
+ * @param node_id Devicetree node id for the device (DT_INVALID_NODE if a
+ * software device).
+ * @param dev_id Device identifier.
+ */
+#define Z_DEVICE_NAME_SLOT_DEFINE(node_id, dev_id)                             \
+	COND_CODE_1(Z_DEVICE_IS_MUTABLE(node_id), (),                          \
+		(static STRUCT_SECTION_ITERABLE(z_device_name_slot,            \
+			_CONCAT(__devname_, dev_id)) = {                       \
+			.dev = &DEVICE_NAME_GET(dev_id),                       \
+		};))
+
 /**
  * @brief Define a @ref device
  *
@@ -984,6 +1012,9 @@ static inline bool z_impl_device_is_ready(const struct device *dev)
 				COND_CODE_1(Z_DEVICE_IS_MUTABLE(node_id), (.dev_rw), (.dev)) =     \
 					&DEVICE_NAME_GET(dev_id),                                  \
 			},                                                                         \
+			IF_ENABLED(CONFIG_DEVICE_INIT_PARALLEL,                                    \
+				   (.serial = DT_PROP_OR(node_id, zephyr_serial_init, 0),))        \
+			IF_ENABLED(CONFIG_INIT_PROFILING, (.init_prio = (prio),))                  \
 	}
 
 /**
@@ -1017,6 +1048,9 @@ static inline bool z_impl_device_is_ready(const struct device *dev)
 	Z_DEVICE_BASE_DEFINE(node_id, dev_id, name, pm, data, config, level,   \
 			     prio, api, state, Z_DEVICE_DEPS_NAME(dev_id));    \
                                                                                \
+	IF_ENABLED(CONFIG_DEVICE_NAME_INDEX,                                   \
+		   (Z_DEVICE_NAME_SLOT_DEFINE(node_id, dev_id)))               \
+                                                                               \
 	Z_DEVICE_INIT_ENTRY_DEFINE(node_id, dev_id, init_fn, level, prio)
 
 /**
@@ -29,10 +29,118 @@
 extern "C" {
 #endif
 
+#if defined(CONFIG_IMG_LZ4) || defined(__DOXYGEN__)
+/** Magic number starting an LZ4 compressed image, "LZ4I" */
+#define FLASH_IMG_LZ4_MAGIC 0x49345a4cU
+
+/** Flag of a block header, set when the block is stored uncompressed */
+#define FLASH_IMG_LZ4_BLOCK_RAW BIT(31)
+
+/**
+ * @brief Header of an LZ4 compressed image
+ *
+ * The header is followed by blocks, each one made of a little endian 32 bit
+ * length, possibly with FLASH_IMG_LZ4_BLOCK_RAW set, and of the LZ4 block
+ * or raw data of that length.  Every block decompresses independently to at
+ * most CONFIG_IMG_LZ4_BLOCK_SIZE bytes.  All fields are little endian.
+ */
+struct flash_img_lz4_hdr {
+	/** FLASH_IMG_LZ4_MAGIC */
+	uint32_t magic;
+	/** Size of the decompressed image */
+	uint32_t size;
+	/** SHA-256 of the decompressed image */
+	uint8_t sha256[32];
+} __packed;
+
+/** @cond INTERNAL_HIDDEN */
+struct flash_img_lz4 {
+	uint8_t in[CONFIG_IMG_LZ4_BLOCK_SIZE];
+	uint8_t out[CONFIG_IMG_LZ4_BLOCK_SIZE];
+	size_t in_len;
+	size_t need;
+	size_t written;
+	uint32_t size;
+	uint8_t state;
+#ifdef CONFIG_IMG_DELTA
+	bool delta;
+#endif
+};
+/** @endcond */
+#endif
+
+#if defined(CONFIG_IMG_DELTA) || defined(__DOXYGEN__)
+/** Magic number starting a delta image, "DLTI" */
+#define FLASH_IMG_DELTA_MAGIC 0x49544c44U
+
+/** Copy bytes of the source image */
+#define FLASH_IMG_DELTA_COPY   0
+/** Add the bytes following the operation to bytes of the source image */
+#define FLASH_IMG_DELTA_ADD    1
+/** Insert the bytes following the operation */
+#define FLASH_IMG_DELTA_INSERT 2
+
+/**
+ * @brief Header of a delta image
+ *
+ * A delta image turns the source image into a new image.  The header is
+ * followed by operations, each made of a struct flash_img_delta_op and,
+ * for FLASH_IMG_DELTA_ADD and FLASH_IMG_DELTA_INSERT, of len bytes of
+ * data.  The operations produce the new image sequentially.  All fields
+ * are little endian.
+ */
+struct flash_img_delta_hdr {
+	/** FLASH_IMG_DELTA_MAGIC */
+	uint32_t magic;
+	/** Size of the source image */
+	uint32_t src_size;
+	/** Size of the new image */
+	uint32_t size;
+	/** SHA-256 of the source image */
+	uint8_t src_sha256[32];
+	/** SHA-256 of the new image */
+	uint8_t sha256[32];
+} __packed;
+
+/** Operation of a delta image */
+struct flash_img_delta_op {
+	/** FLASH_IMG_DELTA_COPY, FLASH_IMG_DELTA_ADD or FLASH_IMG_DELTA_INSERT */
+	uint8_t op;
+	/** Number of bytes produced */
+	uint32_t len;
+	/** Offset in the source image, unused by FLASH_IMG_DELTA_INSERT */
+	uint32_t src_off;
+} __packed;
+
+/** @cond INTERNAL_HIDDEN */
+struct flash_img_delta {
+	uint8_t in[sizeof(struct flash_img_delta_hdr)];
+	uint8_t buf[CONFIG_IMG_DELTA_BUF_SIZE];
+	const struct flash_area *src;
+	size_t in_len;
+	size_t need;
+	uint32_t written;
+	uint32_t size;
+	uint32_t src_size;
+	uint32_t op_len;
+	uint32_t op_src;
+	uint8_t op;
+	uint8_t state;
+	uint8_t src_id;
+};
+/** @endcond */
+#endif
+
 struct flash_img_context {
 	uint8_t buf[CONFIG_IMG_BLOCK_BUF_SIZE];
 	const struct flash_area *flash_area;
 	struct stream_flash_ctx stream;
+#ifdef CONFIG_IMG_LZ4
+	struct flash_img_lz4 lz4;
+#endif
+#ifdef CONFIG_IMG_DELTA
+	struct flash_img_delta delta;
+#endif
 };
 
 /**
@@ -94,6 +202,120 @@ size_t flash_img_bytes_written(struct flash_img_context *ctx);
 int flash_img_buffered_write(struct flash_img_context *ctx, const uint8_t *data,
 		    size_t len, bool flush);
 
+#if defined(CONFIG_IMG_LZ4) || defined(__DOXYGEN__)
+/**
+ * @brief Process buffers of an LZ4 compressed image
+ *
+ * Same as flash_img_buffered_write(), but the data is an LZ4 compressed
+ * image as described by @ref flash_img_lz4_hdr, and the decompressed image
+ * is written to flash.  The calls for one image must all go through this
+ * function.
+ *
+ * @param ctx context
+ * @param data compressed data
+ * @param len Number of bytes of compressed data
+ * @param flush true on the last call, checks that the image is complete
+ * and writes the remaining data to flash
+ *
+ * @return  0 on success, -EINVAL on malformed data, other negative errno
+ * code on fail
+ */
+int flash_img_lz4_buffered_write(struct flash_img_context *ctx, const uint8_t *data,
+				 size_t len, bool flush);
+
+/**
+ * @brief Decompress the start of an LZ4 compressed image
+ *
+ * Gives access to the image header before the image is written.
+ *
+ * @param data start of the compressed image, with at least the header and
+ * the beginning of the first block
+ * @param len Number of bytes of data
+ * @param hdr Header of the compressed image, set on success
+ * @param out Buffer receiving the start of the decompressed image
+ * @param out_len Maximum number of bytes to decompress
+ *
+ * @return  Number of bytes decompressed, at most out_len and less when the
+ * data ends first, or -EINVAL if the data is not the start of an LZ4
+ * compressed image
+ */
+int flash_img_lz4_peek(const uint8_t *data, size_t len, struct flash_img_lz4_hdr *hdr,
+		       void *out, size_t out_len);
+#endif
+
+#if defined(CONFIG_IMG_DELTA) || defined(__DOXYGEN__)
+/**
+ * @brief Set the source image of delta images
+ *
+ * The source defaults to the primary slot.  Must be called after
+ * flash_img_init_id() and before the first call to
+ * flash_img_delta_buffered_write().
+ *
+ * @param ctx context
+ * @param area_id flash area id of the partition holding the source image
+ */
+void flash_img_delta_source_set(struct flash_img_context *ctx, uint8_t area_id);
+
+/**
+ * @brief Process buffers of a delta image
+ *
+ * Same as flash_img_buffered_write(), but the data is a delta image as
+ * described by @ref flash_img_delta_hdr, applied to the source image, and
+ * the new image is written to flash.  The calls for one image must all go
+ * through this function.  The source image is not checked against the
+ * hash of the header, see flash_img_check().
+ *
+ * @param ctx context
+ * @param data delta image data
+ * @param len Number of bytes of data
+ * @param flush true on the last call, checks that the image is complete
+ * and writes the remaining data to flash
+ *
+ * @return  0 on success, -EINVAL on malformed data, other negative errno
+ * code on fail
+ */
+int flash_img_delta_buffered_write(struct flash_img_context *ctx, const uint8_t *data,
+				   size_t len, bool flush);
+
+/**
+ * @brief Apply the start of a delta image
+ *
+ * Gives access to the image header before the image is written.
+ *
+ * @param data start of the delta image
+ * @param len Number of bytes of data
+ * @param src_id flash area id of the partition holding the source image
+ * @param hdr Header of the delta image, set on success
+ * @param out Buffer receiving the start of the new image
+ * @param out_len Number of bytes to produce
+ *
+ * @return  0 on success, -EINVAL if the data is not the start of a delta
+ * image or is too short, other negative errno code on fail
+ */
+int flash_img_delta_peek(const uint8_t *data, size_t len, uint8_t src_id,
+			 struct flash_img_delta_hdr *hdr, void *out, size_t out_len);
+#endif
+
+#if (defined(CONFIG_IMG_LZ4) && defined(CONFIG_IMG_DELTA)) || defined(__DOXYGEN__)
+/**
+ * @brief Process buffers of an LZ4 compressed delta image
+ *
+ * Same as flash_img_lz4_buffered_write(), but the decompressed data is a
+ * delta image, processed as by flash_img_delta_buffered_write().
+ *
+ * @param ctx context
+ * @param data compressed data
+ * @param len Number of bytes of compressed data
+ * @param flush true on the last call, checks that the image is complete
+ * and writes the remaining data to flash
+ *
+ * @return  0 on success, -EINVAL on malformed data, other negative errno
+ * code on fail
+ */
+int flash_img_lz4_delta_buffered_write(struct flash_img_context *ctx, const uint8_t *data,
+				       size_t len, bool flush);
+#endif
+
 /**
  * @brief  Verify flash memory length bytes integrity from a flash area. The
  * start point is indicated by an offset value.
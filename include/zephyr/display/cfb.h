@@ -173,6 +173,8 @@ int cfb_invert_area(const struct device *dev, uint16_t x, uint16_t y,
  * @brief Finalize framebuffer and write it to display RAM,
  * invert or reorder pixels if necessary.
  *
+ * Only the rows of tiles changed since the last call are written.
+ *
  * @param dev Pointer to device structure for driver instance
  *
  * @return 0 on success, negative value otherwise
@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Public Display Framebuffer Manager API
+ */
+
+#ifndef ZEPHYR_INCLUDE_DISPLAY_FBM_H_
+#define ZEPHYR_INCLUDE_DISPLAY_FBM_H_
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/display.h>
+#include <zephyr/kernel.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Public Display Framebuffer Manager API
+ * @defgroup display_fbm Display Framebuffer Manager
+ * @ingroup utilities
+ * @{
+ */
+
+/**
+ * @brief The display scans its frame out of the buffers written in full
+ *
+ * Set for controllers taking a full frame write as their new frame buffer
+ * and returning once it is displayed, such as stm32_ltdc and mcux_elcdif.
+ * Every flush then writes the complete frame, and no rectangle is copied
+ * into the back buffer before the previous frame has been replaced.
+ */
+#define DISPLAY_FBM_FULL_FRAME BIT(0)
+
+/** @brief Rectangle of the screen, in pixels */
+struct display_fbm_rect {
+	uint16_t x;
+	uint16_t y;
+	uint16_t width;
+	uint16_t height;
+};
+
+/**
+ * @brief Framebuffer manager context
+ *
+ * All fields are private, the structure is only declared to let the user
+ * allocate it.
+ */
+struct display_fbm {
+	const struct device *dev;
+	uint8_t *bufs[2];
+	uint8_t num_bufs;
+	uint8_t front;
+	uint8_t back;
+	uint8_t bytes_per_pixel;
+	uint32_t flags;
+	uint16_t width;
+	uint16_t height;
+	struct display_fbm_rect dirty[CONFIG_DISPLAY_FBM_MAX_RECTS];
+	struct display_fbm_rect flushed[CONFIG_DISPLAY_FBM_MAX_RECTS];
+	uint8_t num_dirty;
+	uint8_t num_flushed;
+	int result;
+	struct k_sem idle;
+	struct k_work work;
+};
+
+/**
+ * @brief Initialize a framebuffer manager
+ *
+ * The buffers hold a full frame each, in the current pixel format of the
+ * display, without padding between the lines. With two buffers, the frame
+ * is drawn into one while the other is being flushed. Monochrome formats
+ * are not supported.
+ *
+ * @param fbm      Framebuffer manager context
+ * @param dev      Display device
+ * @param bufs     Frame buffers
+ * @param num_bufs Number of frame buffers, 1 or 2
+ * @param buf_size Size of each frame buffer in bytes
+ * @param flags    DISPLAY_FBM_* flags
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if the buffers are too small or their number invalid.
+ * @retval -ENOTSUP if the pixel format of the display is not supported.
+ */
+int display_fbm_init(struct display_fbm *fbm, const struct device *dev,
+		     uint8_t *const bufs[], uint8_t num_bufs, size_t buf_size,
+		     uint32_t flags);
+
+/**
+ * @brief Get the buffer to draw the next frame into
+ *
+ * The buffer holds the last flushed frame. It may change at every flush,
+ * and waits for a pending flush to be done with it.
+ *
+ * @param fbm Framebuffer manager context
+ *
+ * @return Frame buffer, with a pitch of the display width.
+ */
+uint8_t *display_fbm_get_buffer(struct display_fbm *fbm);
+
+/**
+ * @brief Mark a rectangle of the frame as changed
+ *
+ * The rectangle is clipped to the screen and merged with the ones it
+ * overlaps or touches. When too many rectangles are recorded, it is merged
+ * with the one growing the least.
+ *
+ * @param fbm  Framebuffer manager context
+ * @param rect Changed rectangle
+ */
+void display_fbm_invalidate(struct display_fbm *fbm,
+			    const struct display_fbm_rect *rect);
+
+/**
+ * @brief Draw a rectangle into the frame
+ *
+ * Copies the rectangle into the frame buffer and marks it as changed, as a
+ * replacement for display_write() of clients drawing rectangles.
+ *
+ * @param fbm  Framebuffer manager context
+ * @param x    x Coordinate of the upper left corner
+ * @param y    y Coordinate of the upper left corner
+ * @param desc Structure describing the buffer layout
+ * @param buf  Pixels of the rectangle
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if the rectangle is out of the screen.
+ */
+int display_fbm_write(struct display_fbm *fbm, const uint16_t x,
+		      const uint16_t y,
+		      const struct display_buffer_descriptor *desc,
+		      const void *buf);
+
+/**
+ * @brief Send the changed rectangles of the frame to the display
+ *
+ * Waits for the previous flush, then writes the changed rectangles, or the
+ * full frame with DISPLAY_FBM_FULL_FRAME. With two buffers and
+ * CONFIG_DISPLAY_FBM_FLUSH_THREAD, the write is done by the flush thread
+ * and the function returns once the back buffer has been updated, so that
+ * the next frame is drawn during the transfer.
+ *
+ * @param fbm Framebuffer manager context
+ *
+ * @retval 0 on success, or if nothing changed.
+ * @retval Negative errno code of the display driver.
+ */
+int display_fbm_flush(struct display_fbm *fbm);
+
+/**
+ * @brief Wait for a pending flush
+ *
+ * @param fbm     Framebuffer manager context
+ * @param timeout Time to wait for the flush
+ *
+ * @retval 0 once the last flush succeeded.
+ * @retval -EAGAIN if the flush is still pending.
+ * @retval Negative errno code of the display driver.
+ */
+int display_fbm_sync(struct display_fbm *fbm, k_timeout_t timeout);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DISPLAY_FBM_H_ */
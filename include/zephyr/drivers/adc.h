@@ -592,6 +592,34 @@ typedef int (*adc_api_read_async)(const struct device *dev,
 				  const struct adc_sequence *sequence,
 				  struct k_poll_signal *async);
 
+/**
+ * @brief Callback of a streaming conversion, see adc_stream_start().
+ *
+ * @param dev       Pointer to the device structure for the driver instance.
+ * @param buf       Half of the ring just filled with samples, NULL on error.
+ * @param len       Size of the half of the ring, in bytes.
+ * @param status    0 on success, negative errno code if the stream failed.
+ * @param user_data User data given to adc_stream_start().
+ */
+typedef void (*adc_stream_callback_t)(const struct device *dev,
+				      const void *buf, size_t len, int status,
+				      void *user_data);
+
+/**
+ * @brief Type definition of ADC API function for starting a stream.
+ * See adc_stream_start() for argument descriptions.
+ */
+typedef int (*adc_api_stream_start)(const struct device *dev,
+				    const struct adc_sequence *sequence,
+				    adc_stream_callback_t callback,
+				    void *user_data);
+
+/**
+ * @brief Type definition of ADC API function for stopping a stream.
+ * See adc_stream_stop() for argument descriptions.
+ */
+typedef int (*adc_api_stream_stop)(const struct device *dev);
+
 /**
  * @brief ADC driver API
  *
@@ -602,6 +630,10 @@ __subsystem struct adc_driver_api {
 	adc_api_read          read;
 #ifdef CONFIG_ADC_ASYNC
 	adc_api_read_async    read_async;
+#endif
+#ifdef CONFIG_ADC_STREAM
+	adc_api_stream_start  stream_start;
+	adc_api_stream_stop   stream_stop;
 #endif
 	uint16_t ref_internal;	/* mV */
 };
@@ -733,6 +765,67 @@ static inline int z_impl_adc_read_async(const struct device *dev,
 }
 #endif /* CONFIG_ADC_ASYNC */
 
+#if defined(CONFIG_ADC_STREAM) || defined(__DOXYGEN__)
+/**
+ * @brief Start converting continuously into a ring of samples.
+ *
+ * The channels of @p sequence are converted over and over by the hardware
+ * into the buffer of the sequence, used as a ring of two halves: while the
+ * hardware fills one half, @p callback is given the other one, so no
+ * re-arming happens between batches of samples. The samples of a half must
+ * be consumed before the hardware wraps around onto it.
+ *
+ * The buffer size is rounded down to a multiple of two full sequences.
+ * Sequence options are not supported. @p callback is called from an
+ * interrupt. The device is busy until adc_stream_stop().
+ *
+ * @param dev       Pointer to the device structure for the driver instance.
+ * @param sequence  Channels, resolution and buffer of the conversions.
+ * @param callback  Called for each half of the ring filled.
+ * @param user_data User data passed to @p callback.
+ *
+ * @retval 0        On success.
+ * @retval -EINVAL  If a parameter is invalid.
+ * @retval -ENOMEM  If the buffer cannot hold two sequences.
+ * @retval -ENOSYS  If the driver does not support streaming.
+ */
+static inline int adc_stream_start(const struct device *dev,
+				   const struct adc_sequence *sequence,
+				   adc_stream_callback_t callback,
+				   void *user_data)
+{
+	const struct adc_driver_api *api =
+				(const struct adc_driver_api *)dev->api;
+
+	if (api->stream_start == NULL) {
+		return -ENOSYS;
+	}
+
+	return api->stream_start(dev, sequence, callback, user_data);
+}
+
+/**
+ * @brief Stop a stream started by adc_stream_start().
+ *
+ * @param dev Pointer to the device structure for the driver instance.
+ *
+ * @retval 0         On success.
+ * @retval -EALREADY If no stream is running.
+ * @retval -ENOSYS   If the driver does not support streaming.
+ */
+static inline int adc_stream_stop(const struct device *dev)
+{
+	const struct adc_driver_api *api =
+				(const struct adc_driver_api *)dev->api;
+
+	if (api->stream_stop == NULL) {
+		return -ENOSYS;
+	}
+
+	return api->stream_stop(dev);
+}
+#endif /* CONFIG_ADC_STREAM */
+
 /**
  * @brief Get the internal reference voltage.
  *
@@ -35,6 +35,11 @@ enum {
 	 * default data length parameters. Therefore the host should initiate
 	 * the DLE procedure after connection establishment. */
 	BT_QUIRK_NO_AUTO_DLE = BIT(1),
+	/* The driver sends the fragments of the buffers given to its send()
+	 * callback as part of the same packet, so the host can hand it
+	 * buffer chains instead of copying the data into one buffer.
+	 */
+	BT_QUIRK_TX_FRAGS = BIT(2),
 };
 
 #define IS_BT_QUIRK_NO_AUTO_DLE(bt_dev) ((bt_dev)->drv->quirks & BT_QUIRK_NO_AUTO_DLE)
@@ -62,6 +62,7 @@ extern "C" {
 #define DISK_STATUS_WR_PROTECT		0x04
 
 struct disk_operations;
+struct rtio_iodev_sqe;
 
 /**
  * @brief Disk info
@@ -88,8 +89,47 @@ struct disk_operations {
 	int (*write)(struct disk_info *disk, const uint8_t *data_buf,
 		     uint32_t start_sector, uint32_t num_sector);
 	int (*ioctl)(struct disk_info *disk, uint8_t cmd, void *buff);
+#if defined(CONFIG_DISK_ACCESS_RTIO)
+	/**
+	 * Optional, start an asynchronous request without blocking and
+	 * complete it with rtio_iodev_sqe_ok() or rtio_iodev_sqe_err().
+	 * It can be called from an interrupt. Without it, the requests
+	 * are executed with the synchronous operations by a worker thread.
+	 */
+	void (*submit)(struct disk_info *disk, struct rtio_iodev_sqe *iodev_sqe);
+#endif
+};
+
+#if defined(CONFIG_DISK_ACCESS_RTIO) || defined(__DOXYGEN__)
+/**
+ * @brief Asynchronous disk request
+ */
+struct disk_rtio_req {
+	/** Data buffer */
+	uint8_t *buf;
+	/** First sector */
+	uint32_t start_sector;
+	/** Number of sectors */
+	uint32_t num_sector;
+	/** Write request, otherwise read request */
+	bool write;
 };
 
+/**
+ * @brief Decode an asynchronous disk request
+ *
+ * Used by the disk drivers implementing the submit operation.
+ *
+ * @param[in] iodev_sqe Submission queue entry given to the submit operation
+ * @param[in] sector_size Sector size of the disk in bytes
+ * @param[out] req Decoded request
+ *
+ * @return 0 on success, -EINVAL if the request is malformed
+ */
+int disk_access_rtio_req_get(const struct rtio_iodev_sqe *iodev_sqe,
+			     uint32_t sector_size, struct disk_rtio_req *req);
+#endif
+
 /**
  * @brief Register disk
  *
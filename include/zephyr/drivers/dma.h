@@ -267,6 +267,20 @@ struct dma_config {
 	dma_callback_t dma_callback;
 };
 
+/**
+ * Prepared DMA transfer
+ *
+ * Filled by dma_prepare() and started by dma_submit(), possibly many times.
+ * The configuration and its blocks must stay valid and unchanged as long as
+ * the transfer is submitted.
+ */
+struct dma_prepared {
+	/** Channel the transfer was prepared for */
+	uint32_t channel;
+	/** Configuration of the transfer */
+	struct dma_config *config;
+};
+
 /**
  * DMA runtime status structure
  */
@@ -334,6 +348,10 @@ typedef int (*dma_api_get_status)(const struct device *dev, uint32_t channel,
 
 typedef int (*dma_api_get_attribute)(const struct device *dev, uint32_t type, uint32_t *value);
 
+typedef int (*dma_api_prepare)(const struct device *dev, struct dma_prepared *prep);
+
+typedef int (*dma_api_submit)(const struct device *dev, struct dma_prepared *prep);
+
 /**
  * @typedef dma_chan_filter
  * @brief channel filter function call
@@ -360,6 +378,8 @@ __subsystem struct dma_driver_api {
 	dma_api_get_status get_status;
 	dma_api_get_attribute get_attribute;
 	dma_api_chan_filter chan_filter;
+	dma_api_prepare prepare;
+	dma_api_submit submit;
 };
 /**
  * @endcond
@@ -416,6 +436,74 @@ static inline int dma_reload(const struct device *dev, uint32_t channel,
 	return -ENOSYS;
 }
 
+/**
+ * @brief Prepare a DMA transfer for repeated submission
+ *
+ * Drivers supporting it translate the configuration, typically its chain of
+ * blocks, into hardware descriptors once, so that every dma_submit() of the
+ * transfer only has to point the channel at them. Others only record the
+ * configuration, which is then applied by each dma_submit().
+ *
+ * A channel holds the descriptors of the last transfer prepared on it:
+ * submitting another prepared transfer on the same channel, or calling
+ * dma_config() on it, makes the driver translate the configuration again.
+ *
+ * @param dev     Pointer to the device structure for the driver instance.
+ * @param channel Numeric identification of the channel of the transfer
+ * @param config  Configuration of the transfer
+ * @param prep    Prepared transfer to fill
+ *
+ * @retval 0 if successful.
+ * @retval Negative errno code if failure.
+ */
+static inline int dma_prepare(const struct device *dev, uint32_t channel,
+			      struct dma_config *config,
+			      struct dma_prepared *prep)
+{
+	const struct dma_driver_api *api =
+		(const struct dma_driver_api *)dev->api;
+
+	prep->channel = channel;
+	prep->config = config;
+
+	if (api->prepare) {
+		return api->prepare(dev, prep);
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Start a transfer prepared by dma_prepare()
+ *
+ * The previous transfer of the channel must be complete or stopped.
+ *
+ * @param dev     Pointer to the device structure for the driver instance.
+ * @param prep    Prepared transfer
+ *
+ * @retval 0 if successful.
+ * @retval -EBUSY if the channel is still running.
+ * @retval Negative errno code if failure.
+ */
+static inline int dma_submit(const struct device *dev,
+			     struct dma_prepared *prep)
+{
+	const struct dma_driver_api *api =
+		(const struct dma_driver_api *)dev->api;
+	int ret;
+
+	if (api->submit) {
+		return api->submit(dev, prep);
+	}
+
+	ret = api->config(dev, prep->channel, prep->config);
+	if (ret != 0) {
+		return ret;
+	}
+
+	return api->start(dev, prep->channel);
+}
+
 /**
  * @brief Enables DMA channel and starts the transfer, the channel must be
  *        configured beforehand.
@@ -503,6 +503,88 @@ static inline int z_impl_flash_ex_op(const struct device *dev, uint16_t code,
 #endif /* CONFIG_FLASH_EX_OP_ENABLED */
 }
 
+#if defined(CONFIG_FLASH_RTIO) || defined(__DOXYGEN__)
+
+#include <zephyr/rtio/rtio.h>
+
+/** @cond INTERNAL_HIDDEN */
+extern const struct rtio_iodev_api flash_iodev_api;
+/** @endcond */
+
+/**
+ * @brief Define an RTIO iodev for a flash device
+ *
+ * Requests to the flash device are queued in an RTIO context with
+ * flash_rtio_read(), flash_rtio_write() and flash_rtio_erase(), and executed
+ * by worker threads with the synchronous flash API.  Reads have their own
+ * worker thread, so they are not queued behind long erases; chain the
+ * requests with RTIO_SQE_CHAINED when a read must follow a write.
+ *
+ * @param name Symbolic name of the iodev to define
+ * @param dev Flash device, a constant expression like DEVICE_DT_GET()
+ */
+#define FLASH_IODEV_DEFINE(name, dev)						\
+	RTIO_IODEV_DEFINE(name, &flash_iodev_api, (void *)(dev))
+
+/**
+ * @brief Queue a read from a flash device in an RTIO context
+ *
+ * The request uses two submission queue entries of the context forming a
+ * transaction; a single completion with @p userdata and the result of the
+ * read is produced.
+ *
+ * @param r RTIO context
+ * @param iodev Flash iodev defined with FLASH_IODEV_DEFINE()
+ * @param offset Offset (byte aligned) to read
+ * @param data Buffer to store read data
+ * @param len Number of bytes to read
+ * @param userdata Userdata of the completion
+ *
+ * @retval sqe Last submission queue entry of the request, to chain it
+ * @retval NULL Not enough submission queue entries
+ */
+struct rtio_sqe *flash_rtio_read(struct rtio *r, struct rtio_iodev *iodev,
+				 off_t offset, void *data, size_t len,
+				 void *userdata);
+
+/**
+ * @brief Queue a write to a flash device in an RTIO context
+ *
+ * See flash_rtio_read() and flash_write().
+ *
+ * @param r RTIO context
+ * @param iodev Flash iodev defined with FLASH_IODEV_DEFINE()
+ * @param offset Starting offset for the write
+ * @param data Data to write
+ * @param len Number of bytes to write
+ * @param userdata Userdata of the completion
+ *
+ * @retval sqe Last submission queue entry of the request, to chain it
+ * @retval NULL Not enough submission queue entries
+ */
+struct rtio_sqe *flash_rtio_write(struct rtio *r, struct rtio_iodev *iodev,
+				  off_t offset, const void *data, size_t len,
+				  void *userdata);
+
+/**
+ * @brief Queue an erase of a flash device in an RTIO context
+ *
+ * See flash_rtio_read() and flash_erase().
+ *
+ * @param r RTIO context
+ * @param iodev Flash iodev defined with FLASH_IODEV_DEFINE()
+ * @param offset Erase area starting offset
+ * @param size Size of area to be erased
+ * @param userdata Userdata of the completion
+ *
+ * @retval sqe Last submission queue entry of the request, to chain it
+ * @retval NULL Not enough submission queue entries
+ */
+struct rtio_sqe *flash_rtio_erase(struct rtio *r, struct rtio_iodev *iodev,
+				  off_t offset, size_t size, void *userdata);
+
+#endif /* CONFIG_FLASH_RTIO */
+
 #ifdef __cplusplus
 }
 #endif
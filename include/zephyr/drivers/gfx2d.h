@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Public API for 2D graphics accelerators
+ */
+
+#ifndef ZEPHYR_INCLUDE_DRIVERS_GFX2D_H_
+#define ZEPHYR_INCLUDE_DRIVERS_GFX2D_H_
+
+/**
+ * @brief 2D Graphics Accelerator Interface
+ * @defgroup gfx2d_interface 2D Graphics Accelerator Interface
+ * @ingroup io_interfaces
+ * @{
+ */
+
+#include <errno.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/display.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Rectangle of pixels in memory
+ *
+ * RGB565 pixels are 16-bit words in the CPU byte order, ARGB8888 pixels
+ * 32-bit words with the alpha in the most significant byte.
+ */
+struct gfx2d_surface {
+	/** Upper left pixel of the rectangle */
+	void *buf;
+	/** Width of the rectangle in pixels */
+	uint16_t width;
+	/** Height of the rectangle in pixels */
+	uint16_t height;
+	/** Number of pixels between the starts of two lines in the buffer */
+	uint16_t pitch;
+	/** Pixel format */
+	enum display_pixel_format format;
+};
+
+/** @brief Capabilities of a 2D graphics accelerator */
+struct gfx2d_capabilities {
+	/** Bitmask of the pixel formats supported for sources and destinations */
+	uint32_t pixel_formats;
+};
+
+/**
+ * @typedef gfx2d_api_get_capabilities
+ * @brief Callback API to get the accelerator capabilities
+ * See gfx2d_get_capabilities() for argument description
+ */
+typedef void (*gfx2d_api_get_capabilities)(const struct device *dev,
+					   struct gfx2d_capabilities *caps);
+
+/**
+ * @typedef gfx2d_api_fill
+ * @brief Callback API to fill a rectangle
+ * See gfx2d_fill() for argument description
+ */
+typedef int (*gfx2d_api_fill)(const struct device *dev,
+			      const struct gfx2d_surface *dst, uint32_t color);
+
+/**
+ * @typedef gfx2d_api_copy
+ * @brief Callback API to copy a rectangle
+ * See gfx2d_copy() for argument description
+ */
+typedef int (*gfx2d_api_copy)(const struct device *dev,
+			      const struct gfx2d_surface *dst,
+			      const struct gfx2d_surface *src);
+
+/**
+ * @typedef gfx2d_api_blend
+ * @brief Callback API to blend a rectangle
+ * See gfx2d_blend() for argument description
+ */
+typedef int (*gfx2d_api_blend)(const struct device *dev,
+			       const struct gfx2d_surface *dst,
+			       const struct gfx2d_surface *src, uint8_t opa);
+
+/**
+ * @brief 2D graphics accelerator driver API
+ */
+__subsystem struct gfx2d_driver_api {
+	gfx2d_api_get_capabilities get_capabilities;
+	gfx2d_api_fill fill;
+	gfx2d_api_copy copy;
+	gfx2d_api_blend blend;
+};
+
+/**
+ * @brief Get the capabilities of a 2D graphics accelerator
+ *
+ * @param dev  Pointer to device structure
+ * @param caps Capabilities to fill
+ */
+static inline void gfx2d_get_capabilities(const struct device *dev,
+					  struct gfx2d_capabilities *caps)
+{
+	const struct gfx2d_driver_api *api = (const struct gfx2d_driver_api *)dev->api;
+
+	api->get_capabilities(dev, caps);
+}
+
+/**
+ * @brief Fill a rectangle with a color
+ *
+ * Returns once the rectangle is filled.
+ *
+ * @param dev   Pointer to device structure
+ * @param dst   Rectangle to fill
+ * @param color Color in ARGB8888, converted to the format of the rectangle
+ *
+ * @retval 0 on success.
+ * @retval -ENOTSUP if the pixel format is not supported.
+ * @retval -EINVAL if the rectangle is empty or too large.
+ * @retval -EIO if the accelerator reported an error.
+ */
+static inline int gfx2d_fill(const struct device *dev,
+			     const struct gfx2d_surface *dst, uint32_t color)
+{
+	const struct gfx2d_driver_api *api = (const struct gfx2d_driver_api *)dev->api;
+
+	return api->fill(dev, dst, color);
+}
+
+/**
+ * @brief Copy a rectangle, converting its pixel format
+ *
+ * Returns once the rectangle is copied. The rectangles must not overlap.
+ *
+ * @param dev Pointer to device structure
+ * @param dst Destination rectangle
+ * @param src Source rectangle of the same size
+ *
+ * @retval 0 on success.
+ * @retval -ENOTSUP if a pixel format or the conversion is not supported.
+ * @retval -EINVAL if the rectangles are empty, too large or of other sizes.
+ * @retval -EIO if the accelerator reported an error.
+ */
+static inline int gfx2d_copy(const struct device *dev,
+			     const struct gfx2d_surface *dst,
+			     const struct gfx2d_surface *src)
+{
+	const struct gfx2d_driver_api *api = (const struct gfx2d_driver_api *)dev->api;
+
+	return api->copy(dev, dst, src);
+}
+
+/**
+ * @brief Blend a rectangle over another one
+ *
+ * Each destination pixel becomes src * a + dst * (1 - a), where a is the
+ * alpha of the source pixel, if its format has one, scaled by @p opa.
+ * Returns once the rectangle is blended.
+ *
+ * @param dev Pointer to device structure
+ * @param dst Destination rectangle, also the background
+ * @param src Foreground rectangle of the same size
+ * @param opa Opacity of the foreground, 255 for opaque
+ *
+ * @retval 0 on success.
+ * @retval -ENOTSUP if a pixel format or blending is not supported.
+ * @retval -EINVAL if the rectangles are empty, too large or of other sizes.
+ * @retval -EIO if the accelerator reported an error.
+ */
+static inline int gfx2d_blend(const struct device *dev,
+			      const struct gfx2d_surface *dst,
+			      const struct gfx2d_surface *src, uint8_t opa)
+{
+	const struct gfx2d_driver_api *api = (const struct gfx2d_driver_api *)dev->api;
+
+	if (api->blend == NULL) {
+		return -ENOTSUP;
+	}
+
+	return api->blend(dev, dst, src, opa);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* ZEPHYR_INCLUDE_DRIVERS_GFX2D_H_ */
@@ -976,6 +976,18 @@ static inline int i2c_transfer_signal(const struct device *dev,
 
 #if defined(CONFIG_I2C_RTIO) || defined(__DOXYGEN__)
 
+/**
+ * @brief Submit request(s) to an I2C controller without native RTIO support
+ *
+ * Queues the request for a thread running it with i2c_transfer(), along
+ * with the other requests queued for the same controller.
+ *
+ * @param dev Controller device
+ * @param iodev_sqe Prepared submissions queue entry connected to an iodev
+ *                  defined by I2C_DT_IODEV_DEFINE.
+ */
+void i2c_iodev_submit_fallback(const struct device *dev, struct rtio_iodev_sqe *iodev_sqe);
+
 /**
  * @brief Submit request(s) to an I2C device with RTIO
  *
@@ -988,6 +1000,15 @@ static inline void i2c_iodev_submit(struct rtio_iodev_sqe *iodev_sqe)
 	const struct device *dev = dt_spec->bus;
 	const struct i2c_driver_api *api = (const struct i2c_driver_api *)dev->api;
 
+	if (api->iodev_submit == NULL) {
+#ifdef CONFIG_I2C_RTIO_FALLBACK
+		i2c_iodev_submit_fallback(dev, iodev_sqe);
+#else
+		rtio_iodev_sqe_err(iodev_sqe, -ENOSYS);
+#endif
+		return;
+	}
+
 	api->iodev_submit(dt_spec->bus, iodev_sqe);
 }
 
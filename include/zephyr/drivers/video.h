@@ -561,15 +561,49 @@ static inline int video_set_signal(const struct device *dev,
 /**
  * @brief Allocate video buffer.
  *
+ * The buffer is aligned to @kconfig{CONFIG_VIDEO_BUFFER_POOL_ALIGN} or to
+ * the data cache line if larger, and its size rounded up alike.
+ *
  * @param size Size of the video buffer.
  *
  * @retval pointer to allocated video buffer
  */
 struct video_buffer *video_buffer_alloc(size_t size);
 
+/**
+ * @brief Use external memory as a video buffer.
+ *
+ * The memory, for instance a display framebuffer, is not freed when the
+ * buffer is released.
+ *
+ * @param data Start of the memory, aligned as the buffers of the pool.
+ * @param size Size of the memory in bytes.
+ *
+ * @retval pointer to the video buffer, NULL if none is left or @p data is
+ *         not aligned.
+ */
+struct video_buffer *video_buffer_import(void *data, size_t size);
+
+/**
+ * @brief Share the frame of a video buffer.
+ *
+ * Return another buffer referring to the same memory, which can be queued
+ * to an endpoint of another device while @p buf is queued somewhere else.
+ * The memory is kept until all the buffers sharing it are released, and
+ * should not be modified while shared.
+ *
+ * @param buf Pointer to a video buffer, allocated or imported.
+ *
+ * @retval pointer to the new video buffer, NULL if none is left.
+ */
+struct video_buffer *video_buffer_share(struct video_buffer *buf);
+
 /**
  * @brief Release a video buffer.
  *
+ * The memory of the buffer is freed once the last buffer sharing it is
+ * released.
+ *
  * @param buf Pointer to the video buffer to release.
  */
 void video_buffer_release(struct video_buffer *buf);
@@ -37,6 +37,10 @@
 #include <zephyr/dsp/types.h>
 
 #include <zephyr/dsp/basicmath.h>
+#include <zephyr/dsp/filtering.h>
+#include <zephyr/dsp/matrix.h>
+#include <zephyr/dsp/statistics.h>
+#include <zephyr/dsp/transform.h>
 
 #include <zephyr/dsp/print_format.h>
 
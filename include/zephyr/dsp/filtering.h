@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file zephyr/dsp/filtering.h
+ *
+ * @brief Public APIs for DSP filtering
+ */
+
+#ifndef INCLUDE_ZEPHYR_DSP_FILTERING_H_
+#define INCLUDE_ZEPHYR_DSP_FILTERING_H_
+
+#include <zephyr/dsp/dsp.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @ingroup math_dsp
+ * @defgroup math_dsp_filtering Filtering Functions
+ *
+ * The filters keep their delay line in a state buffer provided by the
+ * caller, so that a signal can be processed in consecutive blocks. The
+ * instances are defined by the backend.
+ */
+
+/**
+ * @ingroup math_dsp_filtering
+ * @addtogroup math_dsp_filtering_fir FIR Filters
+ *
+ * Finite impulse response filters.
+ * <pre>
+ *     dst[n] = coeffs[0] * src[n] + coeffs[1] * src[n-1] + ... + coeffs[num_taps-1] * src[n-num_taps+1]
+ * </pre>
+ * The coefficients are stored in time reversed order, and the state buffer
+ * holds num_taps + block_size - 1 samples.
+ * @{
+ */
+
+/** FIR filter instance, floating-point */
+struct zdsp_fir_instance_f32;
+/** FIR filter instance, Q15 */
+struct zdsp_fir_instance_q15;
+
+/**
+ * @brief Initialize a floating-point FIR filter.
+ *
+ * @param[out] inst       instance to initialize
+ * @param[in]  num_taps   number of filter coefficients
+ * @param[in]  coeffs     points to the num_taps coefficients
+ * @param[in]  state      points to the state buffer
+ * @param[in]  block_size largest number of samples processed per call
+ */
+DSP_FUNC_SCOPE void zdsp_fir_init_f32(struct zdsp_fir_instance_f32 *inst, uint16_t num_taps,
+				      const float32_t *coeffs, float32_t *state,
+				      uint32_t block_size);
+
+/**
+ * @brief Floating-point FIR filter.
+ *
+ * @param[in]  inst       initialized instance
+ * @param[in]  src        points to the input block
+ * @param[out] dst        points to the output block
+ * @param[in]  block_size number of samples to process
+ */
+DSP_FUNC_SCOPE void zdsp_fir_f32(const struct zdsp_fir_instance_f32 *inst, const float32_t *src,
+				 float32_t *dst, uint32_t block_size);
+
+/**
+ * @brief Initialize a Q15 FIR filter.
+ *
+ * @param[out] inst       instance to initialize
+ * @param[in]  num_taps   number of filter coefficients, even and at least 4
+ * @param[in]  coeffs     points to the num_taps coefficients
+ * @param[in]  state      points to the state buffer
+ * @param[in]  block_size largest number of samples processed per call
+ *
+ * @retval 0 on success
+ * @retval -EINVAL if the number of taps is not supported
+ */
+DSP_FUNC_SCOPE int zdsp_fir_init_q15(struct zdsp_fir_instance_q15 *inst, uint16_t num_taps,
+				     const q15_t *coeffs, q15_t *state, uint32_t block_size);
+
+/**
+ * @brief Q15 FIR filter.
+ *
+ * @par Scaling and Overflow Behavior
+ *   The products are accumulated in a 64-bit accumulator, the result is
+ *   saturated to the Q15 range.
+ *
+ * @param[in]  inst       initialized instance
+ * @param[in]  src        points to the input block
+ * @param[out] dst        points to the output block
+ * @param[in]  block_size number of samples to process
+ */
+DSP_FUNC_SCOPE void zdsp_fir_q15(const struct zdsp_fir_instance_q15 *inst, const q15_t *src,
+				 q15_t *dst, uint32_t block_size);
+
+/**
+ * @}
+ */
+
+/**
+ * @ingroup math_dsp_filtering
+ * @addtogroup math_dsp_filtering_biquad Biquad Cascade IIR Filters
+ *
+ * Infinite impulse response filters made of a cascade of second order
+ * sections, each one configured by 5 coefficients:
+ * <pre>
+ *     y[n] = b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2]
+ * </pre>
+ * stored as {b0, b1, b2, a1, a2} for each stage. Note the sign of the
+ * feedback coefficients, opposite to the one of most design tools.
+ * @{
+ */
+
+/** Biquad cascade instance, direct form I, floating-point */
+struct zdsp_biquad_df1_instance_f32;
+/** Biquad cascade instance, direct form I, Q15 */
+struct zdsp_biquad_df1_instance_q15;
+/** Biquad cascade instance, direct form II transposed, floating-point */
+struct zdsp_biquad_df2t_instance_f32;
+
+/**
+ * @brief Initialize a floating-point direct form I biquad cascade.
+ *
+ * @param[out] inst       instance to initialize
+ * @param[in]  num_stages number of second order sections
+ * @param[in]  coeffs     points to the 5 * num_stages coefficients
+ * @param[in]  state      points to the state buffer of 4 * num_stages values
+ */
+DSP_FUNC_SCOPE void zdsp_biquad_df1_init_f32(struct zdsp_biquad_df1_instance_f32 *inst,
+					     uint8_t num_stages, const float32_t *coeffs,
+					     float32_t *state);
+
+/**
+ * @brief Floating-point direct form I biquad cascade.
+ *
+ * @param[in]  inst       initialized instance
+ * @param[in]  src        points to the input block
+ * @param[out] dst        points to the output block
+ * @param[in]  block_size number of samples to process
+ */
+DSP_FUNC_SCOPE void zdsp_biquad_df1_f32(const struct zdsp_biquad_df1_instance_f32 *inst,
+					const float32_t *src, float32_t *dst,
+					uint32_t block_size);
+
+/**
+ * @brief Initialize a Q15 direct form I biquad cascade.
+ *
+ * The coefficients of each stage are stored as {b0, 0, b1, b2, a1, a2},
+ * in the Q15 range once divided by 2^post_shift.
+ *
+ * @param[out] inst       instance to initialize
+ * @param[in]  num_stages number of second order sections
+ * @param[in]  coeffs     points to the 6 * num_stages coefficients
+ * @param[in]  state      points to the state buffer of 4 * num_stages values
+ * @param[in]  post_shift shift applied to the accumulator result
+ */
+DSP_FUNC_SCOPE void zdsp_biquad_df1_init_q15(struct zdsp_biquad_df1_instance_q15 *inst,
+					     uint8_t num_stages, const q15_t *coeffs,
+					     q15_t *state, int8_t post_shift);
+
+/**
+ * @brief Q15 direct form I biquad cascade.
+ *
+ * @par Scaling and Overflow Behavior
+ *   The products are accumulated in a 64-bit accumulator, the result of each
+ *   stage is shifted by post_shift and saturated to the Q15 range.
+ *
+ * @param[in]  inst       initialized instance
+ * @param[in]  src        points to the input block
+ * @param[out] dst        points to the output block
+ * @param[in]  block_size number of samples to process
+ */
+DSP_FUNC_SCOPE void zdsp_biquad_df1_q15(const struct zdsp_biquad_df1_instance_q15 *inst,
+					const q15_t *src, q15_t *dst, uint32_t block_size);
+
+/**
+ * @brief Initialize a floating-point direct form II transposed biquad cascade.
+ *
+ * @param[out] inst       instance to initialize
+ * @param[in]  num_stages number of second order sections
+ * @param[in]  coeffs     points to the 5 * num_stages coefficients
+ * @param[in]  state      points to the state buffer of 2 * num_stages values
+ */
+DSP_FUNC_SCOPE void zdsp_biquad_df2t_init_f32(struct zdsp_biquad_df2t_instance_f32 *inst,
+					      uint8_t num_stages, const float32_t *coeffs,
+					      float32_t *state);
+
+/**
+ * @brief Floating-point direct form II transposed biquad cascade.
+ *
+ * @param[in]  inst       initialized instance
+ * @param[in]  src        points to the input block
+ * @param[out] dst        points to the output block
+ * @param[in]  block_size number of samples to process
+ */
+DSP_FUNC_SCOPE void zdsp_biquad_df2t_f32(const struct zdsp_biquad_df2t_instance_f32 *inst,
+					 const float32_t *src, float32_t *dst,
+					 uint32_t block_size);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INCLUDE_ZEPHYR_DSP_FILTERING_H_ */
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file zephyr/dsp/matrix.h
+ *
+ * @brief Public APIs for DSP matrix operations
+ */
+
+#ifndef INCLUDE_ZEPHYR_DSP_MATRIX_H_
+#define INCLUDE_ZEPHYR_DSP_MATRIX_H_
+
+#include <zephyr/dsp/dsp.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @ingroup math_dsp
+ * @defgroup math_dsp_matrix Matrix Functions
+ *
+ * Operations on matrices stored in row-major order. The dimensions of the
+ * operands are checked before the operation, whatever the backend.
+ * @{
+ */
+
+/** @brief Floating-point matrix */
+struct zdsp_matrix_f32 {
+	/** Number of rows */
+	uint16_t num_rows;
+	/** Number of columns */
+	uint16_t num_cols;
+	/** num_rows * num_cols elements, in row-major order */
+	float32_t *data;
+};
+
+/**
+ * @brief Statically initialize a floating-point matrix.
+ *
+ * @param _rows number of rows
+ * @param _cols number of columns
+ * @param _data array of _rows * _cols elements
+ */
+#define ZDSP_MATRIX_F32_INIT(_rows, _cols, _data)                                                  \
+	{                                                                                          \
+		.num_rows = (_rows), .num_cols = (_cols), .data = (_data),                         \
+	}
+
+/**
+ * @brief Floating-point matrix addition.
+ *
+ * @param[in]  src_a first matrix
+ * @param[in]  src_b second matrix
+ * @param[out] dst   sum of the matrices
+ *
+ * @retval 0 on success
+ * @retval -EINVAL if the dimensions do not match
+ */
+DSP_FUNC_SCOPE int zdsp_mat_add_f32(const struct zdsp_matrix_f32 *src_a,
+				    const struct zdsp_matrix_f32 *src_b,
+				    struct zdsp_matrix_f32 *dst);
+
+/**
+ * @brief Floating-point matrix subtraction.
+ *
+ * @param[in]  src_a first matrix
+ * @param[in]  src_b second matrix
+ * @param[out] dst   src_a - src_b
+ *
+ * @retval 0 on success
+ * @retval -EINVAL if the dimensions do not match
+ */
+DSP_FUNC_SCOPE int zdsp_mat_sub_f32(const struct zdsp_matrix_f32 *src_a,
+				    const struct zdsp_matrix_f32 *src_b,
+				    struct zdsp_matrix_f32 *dst);
+
+/**
+ * @brief Floating-point matrix multiplication.
+ *
+ * @param[in]  src_a first matrix, of M rows and N columns
+ * @param[in]  src_b second matrix, of N rows and P columns
+ * @param[out] dst   product of M rows and P columns
+ *
+ * @retval 0 on success
+ * @retval -EINVAL if the dimensions do not match
+ */
+DSP_FUNC_SCOPE int zdsp_mat_mult_f32(const struct zdsp_matrix_f32 *src_a,
+				     const struct zdsp_matrix_f32 *src_b,
+				     struct zdsp_matrix_f32 *dst);
+
+/**
+ * @brief Floating-point matrix scaling.
+ *
+ * @param[in]  src   input matrix
+ * @param[in]  scale scale factor
+ * @param[out] dst   scaled matrix
+ *
+ * @retval 0 on success
+ * @retval -EINVAL if the dimensions do not match
+ */
+DSP_FUNC_SCOPE int zdsp_mat_scale_f32(const struct zdsp_matrix_f32 *src, float32_t scale,
+				      struct zdsp_matrix_f32 *dst);
+
+/**
+ * @brief Floating-point matrix transpose.
+ *
+ * @param[in]  src input matrix
+ * @param[out] dst transposed matrix
+ *
+ * @retval 0 on success
+ * @retval -EINVAL if the dimensions do not match
+ */
+DSP_FUNC_SCOPE int zdsp_mat_trans_f32(const struct zdsp_matrix_f32 *src,
+				      struct zdsp_matrix_f32 *dst);
+
+/**
+ * @brief Floating-point matrix inverse.
+ *
+ * @param[in,out] src square input matrix, its content is modified
+ * @param[out]    dst inverted matrix
+ *
+ * @retval 0 on success
+ * @retval -EINVAL if the dimensions do not match
+ * @retval -EDOM if the matrix is singular
+ */
+DSP_FUNC_SCOPE int zdsp_mat_inverse_f32(struct zdsp_matrix_f32 *src, struct zdsp_matrix_f32 *dst);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INCLUDE_ZEPHYR_DSP_MATRIX_H_ */
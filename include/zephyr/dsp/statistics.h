@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file zephyr/dsp/statistics.h
+ *
+ * @brief Public APIs for DSP statistics
+ */
+
+#ifndef INCLUDE_ZEPHYR_DSP_STATISTICS_H_
+#define INCLUDE_ZEPHYR_DSP_STATISTICS_H_
+
+#include <zephyr/dsp/dsp.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @ingroup math_dsp
+ * @defgroup math_dsp_stats Statistics Functions
+ *
+ * Reductions of a vector of block_size samples to a single value. The Q15
+ * functions accumulate in a 64-bit accumulator and saturate the result.
+ * @{
+ */
+
+/**
+ * @brief Floating-point mean value.
+ *
+ * @param[in]  src        points to the input vector
+ * @param[in]  block_size number of samples in the vector
+ * @param[out] result     mean value
+ */
+DSP_FUNC_SCOPE void zdsp_mean_f32(const float32_t *src, uint32_t block_size, float32_t *result);
+
+/**
+ * @brief Floating-point root mean square.
+ *
+ * @param[in]  src        points to the input vector
+ * @param[in]  block_size number of samples in the vector
+ * @param[out] result     root mean square value
+ */
+DSP_FUNC_SCOPE void zdsp_rms_f32(const float32_t *src, uint32_t block_size, float32_t *result);
+
+/**
+ * @brief Floating-point variance.
+ *
+ * @param[in]  src        points to the input vector
+ * @param[in]  block_size number of samples in the vector, at least 2
+ * @param[out] result     sample variance
+ */
+DSP_FUNC_SCOPE void zdsp_var_f32(const float32_t *src, uint32_t block_size, float32_t *result);
+
+/**
+ * @brief Floating-point standard deviation.
+ *
+ * @param[in]  src        points to the input vector
+ * @param[in]  block_size number of samples in the vector, at least 2
+ * @param[out] result     sample standard deviation
+ */
+DSP_FUNC_SCOPE void zdsp_std_f32(const float32_t *src, uint32_t block_size, float32_t *result);
+
+/**
+ * @brief Floating-point maximum value.
+ *
+ * @param[in]  src        points to the input vector
+ * @param[in]  block_size number of samples in the vector
+ * @param[out] result     maximum value
+ * @param[out] index      index of the first occurrence of the maximum value
+ */
+DSP_FUNC_SCOPE void zdsp_max_f32(const float32_t *src, uint32_t block_size, float32_t *result,
+				 uint32_t *index);
+
+/**
+ * @brief Floating-point minimum value.
+ *
+ * @param[in]  src        points to the input vector
+ * @param[in]  block_size number of samples in the vector
+ * @param[out] result     minimum value
+ * @param[out] index      index of the first occurrence of the minimum value
+ */
+DSP_FUNC_SCOPE void zdsp_min_f32(const float32_t *src, uint32_t block_size, float32_t *result,
+				 uint32_t *index);
+
+/**
+ * @brief Q15 mean value.
+ *
+ * @param[in]  src        points to the input vector
+ * @param[in]  block_size number of samples in the vector
+ * @param[out] result     mean value
+ */
+DSP_FUNC_SCOPE void zdsp_mean_q15(const q15_t *src, uint32_t block_size, q15_t *result);
+
+/**
+ * @brief Q15 root mean square.
+ *
+ * @param[in]  src        points to the input vector
+ * @param[in]  block_size number of samples in the vector
+ * @param[out] result     root mean square value
+ */
+DSP_FUNC_SCOPE void zdsp_rms_q15(const q15_t *src, uint32_t block_size, q15_t *result);
+
+/**
+ * @brief Q15 variance.
+ *
+ * @param[in]  src        points to the input vector
+ * @param[in]  block_size number of samples in the vector, at least 2
+ * @param[out] result     sample variance
+ */
+DSP_FUNC_SCOPE void zdsp_var_q15(const q15_t *src, uint32_t block_size, q15_t *result);
+
+/**
+ * @brief Q15 standard deviation.
+ *
+ * @param[in]  src        points to the input vector
+ * @param[in]  block_size number of samples in the vector, at least 2
+ * @param[out] result     sample standard deviation
+ */
+DSP_FUNC_SCOPE void zdsp_std_q15(const q15_t *src, uint32_t block_size, q15_t *result);
+
+/**
+ * @brief Q15 maximum value.
+ *
+ * @param[in]  src        points to the input vector
+ * @param[in]  block_size number of samples in the vector
+ * @param[out] result     maximum value
+ * @param[out] index      index of the first occurrence of the maximum value
+ */
+DSP_FUNC_SCOPE void zdsp_max_q15(const q15_t *src, uint32_t block_size, q15_t *result,
+				 uint32_t *index);
+
+/**
+ * @brief Q15 minimum value.
+ *
+ * @param[in]  src        points to the input vector
+ * @param[in]  block_size number of samples in the vector
+ * @param[out] result     minimum value
+ * @param[out] index      index of the first occurrence of the minimum value
+ */
+DSP_FUNC_SCOPE void zdsp_min_q15(const q15_t *src, uint32_t block_size, q15_t *result,
+				 uint32_t *index);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INCLUDE_ZEPHYR_DSP_STATISTICS_H_ */
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file zephyr/dsp/transform.h
+ *
+ * @brief Public APIs for DSP transforms
+ */
+
+#ifndef INCLUDE_ZEPHYR_DSP_TRANSFORM_H_
+#define INCLUDE_ZEPHYR_DSP_TRANSFORM_H_
+
+#include <stdbool.h>
+#include <zephyr/dsp/dsp.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @ingroup math_dsp
+ * @defgroup math_dsp_transform Transform Functions
+ *
+ * The instances hold the twiddle factors and bit reversal tables for one
+ * transform length. They are defined by the backend and only need to be
+ * initialized once for any number of transforms of that length.
+ * @{
+ */
+
+/** Real FFT instance, floating-point */
+struct zdsp_rfft_instance_f32;
+/** Complex FFT instance, floating-point */
+struct zdsp_cfft_instance_f32;
+/** Real FFT instance, Q15 */
+struct zdsp_rfft_instance_q15;
+/** Complex FFT instance, Q15 */
+struct zdsp_cfft_instance_q15;
+
+/**
+ * @brief Initialize a floating-point real FFT instance.
+ *
+ * @param[out] inst    instance to initialize
+ * @param[in]  fft_len length of the real sequence, a power of 2 from 32 to 4096
+ *
+ * @retval 0 on success
+ * @retval -EINVAL if the length is not supported
+ */
+DSP_FUNC_SCOPE int zdsp_rfft_init_f32(struct zdsp_rfft_instance_f32 *inst, uint16_t fft_len);
+
+/**
+ * @brief Floating-point real FFT.
+ *
+ * The forward transform of fft_len real samples outputs the first
+ * fft_len / 2 complex bins, the real part of the Nyquist bin being packed
+ * into the imaginary part of the DC bin. The inverse transform takes the
+ * same layout back to fft_len real samples.
+ *
+ * @param[in]     inst    initialized instance
+ * @param[in,out] src     input buffer of fft_len values, used as scratch
+ * @param[out]    dst     output buffer of fft_len values
+ * @param[in]     inverse compute the inverse transform
+ */
+DSP_FUNC_SCOPE void zdsp_rfft_f32(const struct zdsp_rfft_instance_f32 *inst, float32_t *src,
+				  float32_t *dst, bool inverse);
+
+/**
+ * @brief Initialize a floating-point complex FFT instance.
+ *
+ * @param[out] inst    instance to initialize
+ * @param[in]  fft_len number of complex samples, a power of 2 from 16 to 4096
+ *
+ * @retval 0 on success
+ * @retval -EINVAL if the length is not supported
+ */
+DSP_FUNC_SCOPE int zdsp_cfft_init_f32(struct zdsp_cfft_instance_f32 *inst, uint16_t fft_len);
+
+/**
+ * @brief Floating-point complex FFT, in place.
+ *
+ * @param[in]     inst    initialized instance
+ * @param[in,out] buf     fft_len interleaved {real, imag} samples, in natural order
+ * @param[in]     inverse compute the inverse transform
+ */
+DSP_FUNC_SCOPE void zdsp_cfft_f32(const struct zdsp_cfft_instance_f32 *inst, float32_t *buf,
+				  bool inverse);
+
+/**
+ * @brief Initialize a Q15 real FFT instance.
+ *
+ * Unlike the floating-point one, a Q15 real FFT instance computes either the
+ * forward or the inverse transform.
+ *
+ * @param[out] inst    instance to initialize
+ * @param[in]  fft_len length of the real sequence, a power of 2 from 32 to 8192
+ * @param[in]  inverse compute the inverse transform
+ *
+ * @retval 0 on success
+ * @retval -EINVAL if the length is not supported
+ */
+DSP_FUNC_SCOPE int zdsp_rfft_init_q15(struct zdsp_rfft_instance_q15 *inst, uint32_t fft_len,
+				      bool inverse);
+
+/**
+ * @brief Q15 real FFT.
+ *
+ * @par Scaling and Overflow Behavior
+ *   The input is downscaled by 2 on each stage to avoid saturations, the
+ *   output format depends on the length as described by the CMSIS-DSP
+ *   arm_rfft_q15() documentation.
+ *
+ * @param[in]     inst initialized instance
+ * @param[in,out] src  input buffer of fft_len values, used as scratch
+ * @param[out]    dst  output buffer of 2 * fft_len values
+ */
+DSP_FUNC_SCOPE void zdsp_rfft_q15(const struct zdsp_rfft_instance_q15 *inst, q15_t *src,
+				  q15_t *dst);
+
+/**
+ * @brief Initialize a Q15 complex FFT instance.
+ *
+ * @param[out] inst    instance to initialize
+ * @param[in]  fft_len number of complex samples, a power of 2 from 16 to 4096
+ *
+ * @retval 0 on success
+ * @retval -EINVAL if the length is not supported
+ */
+DSP_FUNC_SCOPE int zdsp_cfft_init_q15(struct zdsp_cfft_instance_q15 *inst, uint16_t fft_len);
+
+/**
+ * @brief Q15 complex FFT, in place.
+ *
+ * @param[in]     inst    initialized instance
+ * @param[in,out] buf     fft_len interleaved {real, imag} samples, in natural order
+ * @param[in]     inverse compute the inverse transform
+ */
+DSP_FUNC_SCOPE void zdsp_cfft_q15(const struct zdsp_cfft_instance_q15 *inst, q15_t *buf,
+				  bool inverse);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INCLUDE_ZEPHYR_DSP_TRANSFORM_H_ */
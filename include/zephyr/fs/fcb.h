@@ -82,6 +82,22 @@ struct fcb_entry_ctx {
  */
 #define FCB_FLAGS_CRC_DISABLED BIT(0)
 
+#if defined(CONFIG_FCB_INDEX) || defined(__DOXYGEN__)
+/**
+ * @brief Sparse index of the entries of a FCB sector
+ *
+ * Filled by the FCB, the user only provides the storage for it.
+ */
+struct fcb_sector_index {
+	uint32_t fi_cnt; /**< Number of valid entries in the sector */
+	uint32_t fi_off[CONFIG_FCB_INDEX_SLOTS];
+	/**< Offsets from the start of the sector of the entries
+	 * CONFIG_FCB_INDEX_INTERVAL, 2 * CONFIG_FCB_INDEX_INTERVAL, ...
+	 * counted from 0.
+	 */
+};
+#endif
+
 /**
  * @brief FCB instance structure
  *
@@ -139,6 +155,13 @@ struct fcb {
 	const uint8_t f_flags;
 	/**< Flags for configuring the FCB. */
 #endif
+#ifdef CONFIG_FCB_INDEX
+	struct fcb_sector_index *f_index;
+	/**< Array of f_sector_cnt sector indexes, rebuilt by fcb_init(), or
+	 * NULL to not index the entries. Entries are indexed in the order
+	 * of their fcb_append_finish() call.
+	 */
+#endif
 };
 
 /**
@@ -242,6 +265,22 @@ int fcb_walk(struct fcb *fcb, struct flash_sector *sector, fcb_walk_cb cb,
  */
 int fcb_getnext(struct fcb *fcb, struct fcb_entry *loc);
 
+/**
+ * Get the location of the n-th fcb entry.
+ *
+ * Entries are counted from the oldest one, which is entry 0. With the
+ * sparse index of @kconfig{CONFIG_FCB_INDEX} the entry is reached without
+ * reading all the entries before it.
+ *
+ * @param[in] fcb FCB instance structure.
+ * @param[in] n Number of the entry.
+ * @param[out] loc entry location information
+ *
+ * @return 0 on success; -ENOENT when there are not more than @p n entries,
+ *         other negative errno code on failure.
+ */
+int fcb_getnth(struct fcb *fcb, uint32_t n, struct fcb_entry *loc);
+
 /**
  * Rotate fcb sectors
  *
@@ -104,6 +104,10 @@ struct fs_mount_t {
 	const struct fs_file_system_t *fs;
 	/** Mount flags */
 	uint8_t flags;
+#if defined(CONFIG_FILE_SYSTEM_CACHE) || defined(__DOXYGEN__)
+	/** Cache of the file system, set with fs_cache_set() */
+	struct fs_cache *cache;
+#endif
 };
 
 /**
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_FS_FS_CACHE_H_
+#define ZEPHYR_INCLUDE_FS_FS_CACHE_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/types.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief File system cache
+ * @defgroup file_system_cache File System Cache
+ * @ingroup file_system_api
+ *
+ * A cache of file data in the virtual file system layer, shared by the
+ * files of one mount point.  Reads are served from pages of the cache and
+ * sequential reads fetch the next pages ahead of time; writes are collected
+ * in the pages and written back when a page is evicted, or when the file is
+ * synced or closed.  The file system driver sees fewer, larger accesses.
+ * @{
+ */
+
+struct fs_file_t;
+
+/** @brief File system cache statistics */
+struct fs_cache_stats {
+	/** Pages found in the cache */
+	uint32_t hits;
+	/** Pages read from the file system */
+	uint32_t misses;
+	/** Pages read ahead of a sequential read */
+	uint32_t read_ahead;
+	/** Reads and writes passed directly to the file system */
+	uint32_t bypass;
+	/** Writes collected in the cache */
+	uint32_t writes;
+	/** Page write backs to the file system */
+	uint32_t write_backs;
+};
+
+/** @cond INTERNAL_HIDDEN */
+struct fs_cache_page {
+	struct fs_file_t *zfp;
+	off_t off;
+	size_t len;
+	size_t dirty_lo;
+	size_t dirty_hi;
+	uint32_t used;
+	bool filled;
+};
+/** @endcond */
+
+/** @brief File system cache
+ *
+ * Define it with @ref FS_CACHE_DEFINE and attach it to a mount point with
+ * fs_cache_set().
+ */
+struct fs_cache {
+	/** @cond INTERNAL_HIDDEN */
+	struct k_mutex lock;
+	struct fs_cache_page *pages;
+	uint8_t *data;
+	uint16_t page_count;
+	uint16_t files;
+	uint32_t clock;
+	struct fs_cache_stats stats;
+	/** @endcond */
+	/** Page size in bytes */
+	size_t page_size;
+	/** Pages read ahead of a sequential read, 0 to disable */
+	uint8_t read_ahead;
+	/** Collect the writes in the cache, otherwise write through */
+	bool write_back;
+};
+
+/**
+ * @brief Define a file system cache
+ *
+ * @param _name Name of the cache.
+ * @param _page_size Page size in bytes, best a multiple of the block size of
+ *		     the file system.
+ * @param _page_count Number of pages.
+ */
+#define FS_CACHE_DEFINE(_name, _page_size, _page_count)				\
+	BUILD_ASSERT((_page_size) > 0 && (_page_count) > 0);			\
+	static uint8_t _CONCAT(_name, _data)[(_page_size) * (_page_count)]	\
+		__aligned(4);							\
+	static struct fs_cache_page _CONCAT(_name, _pages)[_page_count];	\
+	static struct fs_cache _name = {					\
+		.lock = Z_MUTEX_INITIALIZER(_name.lock),			\
+		.pages = _CONCAT(_name, _pages),				\
+		.data = _CONCAT(_name, _data),					\
+		.page_count = (_page_count),					\
+		.page_size = (_page_size),					\
+		.read_ahead = CONFIG_FILE_SYSTEM_CACHE_READ_AHEAD,		\
+		.write_back = IS_ENABLED(CONFIG_FILE_SYSTEM_CACHE_WRITE_BACK),	\
+	}
+
+/**
+ * @brief Attach a cache to a file system
+ *
+ * The cache must not be used by another mount point.  It can be set or
+ * removed only while no file of the mount point is open.
+ *
+ * @param mnt_point Mount point of the file system.
+ * @param cache Cache to use, or NULL to remove the cache.
+ *
+ * @retval 0 on success;
+ * @retval -ENOENT when no file system is mounted at @p mnt_point;
+ * @retval -EBUSY when files of the mount point are open.
+ */
+int fs_cache_set(const char *mnt_point, struct fs_cache *cache);
+
+/**
+ * @brief Set the read-ahead of a file system cache
+ *
+ * @param mnt_point Mount point of the file system.
+ * @param pages Pages read ahead of a sequential read, 0 to disable.
+ *
+ * @retval 0 on success;
+ * @retval -ENOENT when no file system is mounted at @p mnt_point;
+ * @retval -ENOTSUP when the file system has no cache.
+ */
+int fs_cache_read_ahead_set(const char *mnt_point, uint8_t pages);
+
+/**
+ * @brief Get the statistics of a file system cache
+ *
+ * @param mnt_point Mount point of the file system.
+ * @param stats Pointer to the structure to fill.
+ * @param reset Clear the statistics after reading them.
+ *
+ * @retval 0 on success;
+ * @retval -ENOENT when no file system is mounted at @p mnt_point;
+ * @retval -ENOTSUP when the file system has no cache.
+ */
+int fs_cache_stats_get(const char *mnt_point, struct fs_cache_stats *stats, bool reset);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_FS_FS_CACHE_H_ */
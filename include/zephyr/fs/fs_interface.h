@@ -8,6 +8,7 @@
 #define ZEPHYR_INCLUDE_FS_FS_INTERFACE_H_
 
 #include <stdint.h>
+#include <sys/types.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -49,6 +50,7 @@ extern "C" {
 typedef uint8_t fs_mode_t;
 
 struct fs_mount_t;
+struct fs_cache;
 
 /**
  * @addtogroup file_system_api
@@ -67,6 +69,16 @@ struct fs_file_t {
 	const struct fs_mount_t *mp;
 	/** Open/create flags */
 	fs_mode_t flags;
+#if defined(CONFIG_FILE_SYSTEM_CACHE) || defined(__DOXYGEN__)
+	/** Cache used for the file, NULL if the file is not cached */
+	struct fs_cache *cache;
+	/** File position, kept by the cache */
+	off_t cache_pos;
+	/** Position following the last read, to detect sequential reads */
+	off_t cache_next;
+	/** Hash of the file path, to find other handles of the file */
+	uint32_t cache_key;
+#endif
 };
 
 /**
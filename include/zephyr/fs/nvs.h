@@ -59,6 +59,18 @@ struct nvs_fs {
 	const struct flash_parameters *flash_parameters;
 #if CONFIG_NVS_LOOKUP_CACHE
 	uint32_t lookup_cache[CONFIG_NVS_LOOKUP_CACHE_SIZE];
+#ifdef CONFIG_NVS_LOOKUP_INDEX
+	uint16_t lookup_index_id[CONFIG_NVS_LOOKUP_CACHE_SIZE];
+	bool lookup_index_full;
+#endif
+#endif
+#ifdef CONFIG_NVS_BACKGROUND_GC
+	/** Work queue running the background garbage collection after writes,
+	 * NULL to only run it through nvs_gc_step(). Set it before mounting.
+	 */
+	struct k_work_q *gc_work_q;
+	struct k_work bg_gc_work;
+	uint32_t bg_gc_addr;
 #endif
 };
 
@@ -162,6 +174,23 @@ ssize_t nvs_read_hist(struct nvs_fs *fs, uint16_t id, void *data, size_t len, ui
  */
 ssize_t nvs_calc_free_space(struct nvs_fs *fs);
 
+/**
+ * @brief Run a step of the background garbage collection.
+ *
+ * Copies the data of at most @kconfig{CONFIG_NVS_BACKGROUND_GC_BUDGET} allocation
+ * table entries out of the oldest sector, and erases the sector once all its data
+ * has been copied, so that @kconfig{CONFIG_NVS_BACKGROUND_GC_RESERVE} erased
+ * sectors are kept ahead of the writes. Call it from a low priority context until
+ * it returns 0, or set @ref nvs_fs.gc_work_q to have it run after each write.
+ *
+ * @param fs Pointer to file system
+ * @retval 1 More steps are needed to complete the reserve.
+ * @retval 0 The reserve is complete, or the write sector has no room left for the
+ * copied data.
+ * @retval -ERRNO errno code if error
+ */
+int nvs_gc_step(struct nvs_fs *fs);
+
 /**
  * @}
  */
@@ -113,6 +113,19 @@ struct init_entry {
 		struct device *dev_rw;
 #endif
 	};
+#if defined(CONFIG_DEVICE_INIT_PARALLEL) || defined(__DOXYGEN__)
+	/**
+	 * Run the entry on the boot thread even with parallel device
+	 * initialization. Set from the zephyr,serial-init property.
+	 */
+	bool serial;
+#endif
+#if defined(CONFIG_INIT_PROFILING) || defined(__DOXYGEN__)
+	/** Name of a SYS_INIT() entry, NULL for devices. */
+	const char *init_name;
+	/** Priority of the entry within its level. */
+	uint8_t init_prio;
+#endif
 };
 
 /** @cond INTERNAL_HIDDEN */
@@ -205,7 +218,11 @@ struct init_entry {
 #define SYS_INIT_NAMED(name, init_fn_, level, prio)                                       \
 	static const Z_DECL_ALIGN(struct init_entry)                                      \
 		Z_INIT_ENTRY_SECTION(level, prio, 0) __used __noasan                      \
-		Z_INIT_ENTRY_NAME(name) = {{ (init_fn_) }, { NULL } }
+		Z_INIT_ENTRY_NAME(name) = {                                               \
+			.init_fn = { (init_fn_) },                                        \
+			IF_ENABLED(CONFIG_INIT_PROFILING,                                 \
+				   (.init_name = #name, .init_prio = (prio),))            \
+		}
 
 /** @} */
 
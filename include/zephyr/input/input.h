@@ -142,6 +142,55 @@ struct input_listener {
 		.callback = _callback,                                         \
 	}
 
+#if defined(CONFIG_INPUT_FRAMES) || defined(__DOXYGEN__)
+
+/**
+ * @brief Input frame structure.
+ *
+ * The events reported by a device up to one with the sync flag set. Motion
+ * events of an axis already in the frame are merged with the earlier one:
+ * @ref INPUT_EV_ABS values replace it and @ref INPUT_EV_REL values are added
+ * to it.
+ */
+struct input_frame {
+	/** Device generating the events or NULL. */
+	const struct device *dev;
+	/** Number of events in the frame. */
+	uint8_t num_events;
+	/** Events of the frame, in the order they were first reported. */
+	struct input_event events[CONFIG_INPUT_FRAME_MAX_EVENTS];
+};
+
+/**
+ * @brief Input frame listener callback structure.
+ */
+struct input_frame_listener {
+	/** @ref device pointer or NULL. */
+	const struct device *dev;
+	/** The callback function. */
+	void (*callback)(const struct input_frame *frame);
+};
+
+/**
+ * @brief Register a callback structure for input frames.
+ *
+ * The callback is invoked once per frame instead of once per event. A frame
+ * is also delivered before it is complete when it has no room left for an
+ * event, or as a single event if all the frames are in use, see
+ * @kconfig{CONFIG_INPUT_FRAME_DEVICES}.
+ *
+ * @param _dev @ref device pointer or NULL.
+ * @param _callback The callback function.
+ */
+#define INPUT_FRAME_CALLBACK_DEFINE(_dev, _callback)                           \
+	static const STRUCT_SECTION_ITERABLE(input_frame_listener,             \
+				_input_frame_listener__##_callback) = {        \
+		.dev = _dev,                                                   \
+		.callback = _callback,                                         \
+	}
+
+#endif /* CONFIG_INPUT_FRAMES */
+
 #ifdef __cplusplus
 }
 #endif
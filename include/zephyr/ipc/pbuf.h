@@ -201,6 +201,48 @@ int pbuf_write(struct pbuf *pb, const char *buf, uint16_t len);
  */
 int pbuf_read(struct pbuf *pb, char *buf, uint16_t len);
 
+/**
+ * @brief Claim the next message without copying it.
+ *
+ * The message stays in the buffer, and the writer cannot overwrite it, until
+ * it is freed with @ref pbuf_free. A message wrapping around the end of the
+ * buffer is returned in two parts: @p len bytes at @p buf, followed by the
+ * remaining bytes at the beginning of the data area, @c cfg->data_loc.
+ *
+ * The data cache is invalidated for the whole message.
+ *
+ * @param pb	A buffer from which data will be read.
+ * @param buf	Location where the address of the message is written.
+ * @param len	Location where the length of the message part at @p buf is
+ *		written.
+ * @retval int	Length of the message, 0 if the buffer is empty, negative
+ *		error code on fail.
+ *		-EINVAL, if any of input parameter is incorrect.
+ *		-EAGAIN, if not whole message is ready yet.
+ */
+int pbuf_claim(struct pbuf *pb, const char **buf, uint16_t *len);
+
+/**
+ * @brief Free a message claimed with @ref pbuf_claim.
+ *
+ * @param pb	A buffer from which data was claimed.
+ * @param len	Length of the message, as returned by @ref pbuf_claim.
+ * @retval 0 on success.
+ * @retval -EINVAL if no message was claimed or @p len does not match.
+ */
+int pbuf_free(struct pbuf *pb, uint16_t len);
+
+/**
+ * @brief Get the read index published by the reader.
+ *
+ * Intended for the writer, which can compare it with its own write index to
+ * find out whether the reader consumed everything written so far.
+ *
+ * @param pb	A buffer to which the caller writes.
+ * @retval uint32_t Current read index.
+ */
+uint32_t pbuf_rd_idx_get(struct pbuf *pb);
+
 /**
  * @}
  */
@@ -22,6 +22,9 @@
 #include <zephyr/tracing/tracing_macros.h>
 #include <zephyr/sys/mem_stats.h>
 #include <zephyr/sys/iterable_sections.h>
+#ifdef CONFIG_USERSPACE_VDSO
+#include <zephyr/kernel/vdso.h>
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -589,6 +592,13 @@ static inline k_tid_t k_current_get(void)
 	extern __thread k_tid_t z_tls_current;
 
 	return z_tls_current;
+#elif defined(CONFIG_USERSPACE_VDSO) && !defined(CONFIG_SMP)
+	/* Only a user thread is sure to be the one switched in last */
+	if (k_is_user_context()) {
+		return k_vdso_current_get();
+	}
+
+	return k_sched_current_thread_query();
 #else
 	return k_sched_current_thread_query();
 #endif
@@ -879,6 +889,89 @@ __syscall void k_thread_priority_set(k_tid_t thread, int prio);
  *
  */
 __syscall void k_thread_deadline_set(k_tid_t thread, int deadline);
+
+#ifdef CONFIG_SCHED_DEADLINE_SERVER
+/**
+ * @brief CPU time budget server
+ *
+ * A server reserves a budget of CPU time in every period for the threads
+ * attached to it, in the style of a constant bandwidth server.  The
+ * threads are scheduled by the deadline of their server among the other
+ * threads of the same static priority.  A thread that uses up the budget
+ * gets a new one with a deadline one period later, so it cannot delay
+ * threads with earlier deadlines by more than its budget per period.
+ *
+ * All values are kept in k_cycle_get_32() units.  The fields are
+ * internal and must not be accessed directly.
+ */
+struct k_sched_server {
+	uint32_t budget;
+	uint32_t period;
+	int32_t remaining;
+	uint32_t deadline;
+	uint32_t util;
+	sys_dlist_t threads;
+};
+
+/**
+ * @brief Initialize a budget server
+ *
+ * Reserves @a budget_us of CPU time in every @a period_us for the threads
+ * that will be attached to the server.  The reservation is refused if the
+ * sum of the budget to period ratios of all servers would exceed
+ * @kconfig{CONFIG_SCHED_DEADLINE_SERVER_MAX_UTIL} percent.
+ *
+ * @note The period converted to cycles must be less than 2^31, like any
+ * other deadline.
+ *
+ * @param server Server to initialize
+ * @param budget_us CPU time per period, in microseconds
+ * @param period_us Server period, in microseconds
+ *
+ * @retval 0 Server initialized
+ * @retval -EINVAL Budget is zero, longer than the period, or the period
+ *         is too long
+ * @retval -EBUSY The reservation would exceed the allowed utilization
+ */
+int k_sched_server_init(struct k_sched_server *server, uint32_t budget_us,
+			uint32_t period_us);
+
+/**
+ * @brief Release the reservation of a budget server
+ *
+ * @param server Server with no threads attached
+ *
+ * @retval 0 Reservation released
+ * @retval -EBUSY Threads are still attached to the server
+ */
+int k_sched_server_release(struct k_sched_server *server);
+
+/**
+ * @brief Attach a thread to a budget server
+ *
+ * From now on the deadline of the thread is managed by the server, and
+ * the budget is shared with the other threads attached to it.  Calling
+ * k_thread_deadline_set() on the thread only takes effect until the
+ * server next updates its deadline.
+ *
+ * @param server Initialized server
+ * @param thread Preemptible thread
+ *
+ * @retval 0 Thread attached
+ * @retval -EINVAL The thread is cooperative
+ * @retval -EALREADY The thread is attached to a server already
+ */
+int k_sched_server_attach(struct k_sched_server *server, k_tid_t thread);
+
+/**
+ * @brief Detach a thread from its budget server
+ *
+ * A thread is detached automatically when it exits.
+ *
+ * @param thread Thread attached to a server
+ */
+void k_sched_server_detach(k_tid_t thread);
+#endif /* CONFIG_SCHED_DEADLINE_SERVER */
 #endif
 
 #ifdef CONFIG_SCHED_CPU_MASK
@@ -1836,6 +1929,12 @@ struct k_queue {
 	sys_sflist_t data_q;
 	struct k_spinlock lock;
 	_wait_q_t wait_q;
+#ifdef CONFIG_QUEUE_LOCKLESS_APPEND
+	/* Items appended without the lock, newest first */
+	atomic_ptr_t append_head;
+	/* Threads about to block in k_queue_get() */
+	atomic_t getters;
+#endif
 
 	Z_DECL_POLL_EVENT
 
@@ -2075,6 +2174,11 @@ __syscall int k_queue_is_empty(struct k_queue *queue);
 
 static inline int z_impl_k_queue_is_empty(struct k_queue *queue)
 {
+#ifdef CONFIG_QUEUE_LOCKLESS_APPEND
+	if (atomic_ptr_get(&queue->append_head) != NULL) {
+		return 0;
+	}
+#endif
 	return (int)sys_sflist_is_empty(&queue->data_q);
 }
 
@@ -2209,6 +2313,13 @@ struct k_event {
 	uint32_t          events;
 	struct k_spinlock lock;
 
+#ifdef CONFIG_EVENTS_INDEXED_WAITERS
+	/* Threads waiting for all of a set of events, or for a single event,
+	 * indexed by an event they still need. Other threads wait on wait_q.
+	 */
+	_wait_q_t         bit_wait_q[32];
+#endif
+
 	SYS_PORT_TRACING_TRACKING_FIELD(k_event)
 
 #ifdef CONFIG_OBJ_CORE_EVENT
@@ -2217,11 +2328,22 @@ struct k_event {
 
 };
 
+#ifdef CONFIG_EVENTS_INDEXED_WAITERS
+#define Z_EVENT_BIT_WAIT_Q_INIT(bit, obj) Z_WAIT_Q_INIT(&obj.bit_wait_q[bit])
+
+#define Z_EVENT_INITIALIZER(obj) \
+	{ \
+	.wait_q = Z_WAIT_Q_INIT(&obj.wait_q), \
+	.events = 0, \
+	.bit_wait_q = { LISTIFY(32, Z_EVENT_BIT_WAIT_Q_INIT, (,), obj) } \
+	}
+#else
 #define Z_EVENT_INITIALIZER(obj) \
 	{ \
 	.wait_q = Z_WAIT_Q_INIT(&obj.wait_q), \
 	.events = 0 \
 	}
+#endif /* CONFIG_EVENTS_INDEXED_WAITERS */
 
 /**
  * @brief Initialize an event object
@@ -2914,6 +3036,13 @@ struct k_mutex {
 #ifdef CONFIG_OBJ_CORE_MUTEX
 	struct k_obj_core obj_core;
 #endif
+
+#ifdef CONFIG_OBJ_CORE_STATS_MUTEX
+	/** Contention statistics */
+	struct k_lock_stats stats;
+	/** Time (in cycles) when the current owner took the mutex */
+	uint32_t lock_time;
+#endif
 };
 
 /**
@@ -3466,6 +3595,100 @@ void k_work_queue_start(struct k_work_q *queue,
  */
 static inline k_tid_t k_work_queue_thread_get(struct k_work_q *queue);
 
+#if defined(CONFIG_WORKQUEUE_POOL) || defined(__DOXYGEN__)
+/** @brief Initialize a work queue served by several threads.
+ *
+ * This works like k_work_queue_start() except that @p num_threads threads
+ * take items from the same pending list, so up to @p num_threads handlers
+ * for different work items may run at the same time.  A work item is never
+ * run concurrently with itself, and k_work_flush(), k_work_cancel_sync()
+ * and k_work_queue_drain() behave as they do for a single-threaded queue.
+ * Items are started in submission order, but may complete in any order.
+ *
+ * The first worker is the queue's own thread (see
+ * k_work_queue_thread_get()); the remaining ones use @p threads.
+ *
+ * @param queue pointer to the queue structure. It must be initialized
+ *        in zeroed/bss memory or with @ref k_work_queue_init before
+ *        use.
+ *
+ * @param threads array of @p num_threads - 1 thread objects used for the
+ *        additional workers.  May be NULL if @p num_threads is 1.
+ *
+ * @param stacks array of @p num_threads stacks, defined with
+ *        K_THREAD_STACK_ARRAY_DEFINE() using @p stack_size.
+ *
+ * @param stack_size size of each stack as passed to
+ *        K_THREAD_STACK_ARRAY_DEFINE(), in bytes.
+ *
+ * @param num_threads number of worker threads, at least 1.
+ *
+ * @param prio initial priority of all worker threads
+ *
+ * @param cfg optional additional configuration parameters.  Pass @c
+ * NULL if not required, to use the defaults documented in
+ * k_work_queue_config.
+ */
+void k_work_queue_pool_start(struct k_work_q *queue,
+			     struct k_thread *threads,
+			     k_thread_stack_t *stacks, size_t stack_size,
+			     unsigned int num_threads, int prio,
+			     const struct k_work_queue_config *cfg);
+#endif /* CONFIG_WORKQUEUE_POOL */
+
+#if defined(CONFIG_WORKQUEUE_STATS) || defined(__DOXYGEN__)
+/** @brief Work queue statistics.
+ *
+ * Latencies and busy time are in hardware cycles, see k_cycle_get_32().
+ */
+struct k_work_queue_stats {
+	/** Number of work items whose handler has been run. */
+	uint32_t processed;
+
+	/** Items currently on the pending list. */
+	uint32_t pending;
+
+	/** Largest number of items seen on the pending list. */
+	uint32_t max_pending;
+
+	/** Largest number of handlers seen running at the same time. */
+	uint32_t max_busy;
+
+	/** Sum of the time items spent queued before their handler started. */
+	uint64_t total_latency;
+
+	/** Longest time an item spent queued before its handler started. */
+	uint32_t max_latency;
+
+	/** Sum of the time spent in handlers, over all worker threads. */
+	uint64_t busy_cycles;
+};
+
+/** @brief Get the statistics of a work queue.
+ *
+ * The average queueing latency is @c total_latency / @c processed.  The
+ * occupancy of the queue over an interval is the change in @c busy_cycles
+ * divided by the length of the interval times the number of worker threads.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param queue pointer to the queue.
+ * @param stats where to store the statistics.
+ */
+void k_work_queue_stats_get(struct k_work_q *queue,
+			    struct k_work_queue_stats *stats);
+
+/** @brief Reset the statistics of a work queue.
+ *
+ * Clears everything except the current number of pending items.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param queue pointer to the queue.
+ */
+void k_work_queue_stats_reset(struct k_work_q *queue);
+#endif /* CONFIG_WORKQUEUE_STATS */
+
 /** @brief Wait until the work queue has drained, optionally plugging it.
  *
  * This blocks submission to the work queue except when coming from queue
@@ -3879,6 +4102,11 @@ struct k_work {
 	 * It can be RUNNING and CANCELING simultaneously.
 	 */
 	uint32_t flags;
+
+#ifdef CONFIG_WORKQUEUE_STATS
+	/* Cycle count at which the item was last queued. */
+	uint32_t queued_at;
+#endif
 };
 
 #define Z_WORK_INITIALIZER(work_handler) { \
@@ -3938,6 +4166,12 @@ struct k_work_delayable {
 struct z_work_flusher {
 	struct k_work work;
 	struct k_sem sem;
+#ifdef CONFIG_WORKQUEUE_POOL
+	/* The item being flushed; the flusher must not be processed while
+	 * that item is running on another worker thread.
+	 */
+	struct k_work *target;
+#endif
 };
 
 /* Record used to wait for work to complete a cancellation.
@@ -4002,6 +4236,14 @@ struct k_work_queue_config {
 	 * control.
 	 */
 	bool no_yield;
+
+	/** Pin each worker thread of a work queue pool to its own CPU.
+	 *
+	 * Worker @em n is pinned to CPU @em n modulo the number of CPUs.
+	 * Only used by k_work_queue_pool_start(), and only when
+	 * CONFIG_SCHED_CPU_MASK is enabled.
+	 */
+	bool pin_cpus;
 };
 
 /** @brief A structure used to hold work until it can be processed. */
@@ -4024,6 +4266,21 @@ struct k_work_q {
 
 	/* Flags describing queue state. */
 	uint32_t flags;
+
+#ifdef CONFIG_WORKQUEUE_POOL
+	/* Worker threads in addition to thread. */
+	struct k_thread *extra_threads;
+
+	/* Number of extra_threads. */
+	uint16_t num_extra_threads;
+
+	/* Number of worker threads running a handler. */
+	uint16_t busy_threads;
+#endif
+
+#ifdef CONFIG_WORKQUEUE_STATS
+	struct k_work_queue_stats stats;
+#endif
 };
 
 /* Provide the implementation for inline functions declared above */
@@ -4589,6 +4846,46 @@ __syscall int k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t time
  */
 __syscall int k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout);
 
+/**
+ * @brief Send several messages to a message queue.
+ *
+ * This routine copies up to @a num_msgs consecutive messages from @a data
+ * to message queue @a msgq, taking the queue's lock only once and waking
+ * up all receivers served in a single pass.  Messages go directly to
+ * threads waiting to receive first, the rest into the ring buffer as long
+ * as there is space.  The routine never waits.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param data Pointer to an array of @a num_msgs messages.
+ * @param num_msgs Number of messages to send.
+ *
+ * @return Number of messages sent, from the start of @a data.  Zero if
+ *         the queue is full.
+ */
+__syscall int k_msgq_put_many(struct k_msgq *msgq, const void *data,
+			      uint32_t num_msgs);
+
+/**
+ * @brief Receive several messages from a message queue.
+ *
+ * This routine copies up to @a num_msgs messages from message queue @a
+ * msgq to @a data in "first in, first out" order, taking the queue's lock
+ * only once and waking up all senders served in a single pass.  The
+ * routine never waits.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param data Address of an area to hold @a num_msgs messages.
+ * @param num_msgs Maximum number of messages to receive.
+ *
+ * @return Number of messages received.  Zero if the queue is empty.
+ */
+__syscall int k_msgq_get_many(struct k_msgq *msgq, void *data,
+			      uint32_t num_msgs);
+
 /**
  * @brief Peek/read a message from a message queue.
  *
@@ -4872,6 +5169,8 @@ struct k_pipe {
  * @cond INTERNAL_HIDDEN
  */
 #define K_PIPE_FLAG_ALLOC	BIT(0)	/** Buffer was allocated */
+#define K_PIPE_FLAG_RESERVED	BIT(1)	/** Free space claimed by k_pipe_reserve() */
+#define K_PIPE_FLAG_PEEKED	BIT(2)	/** Data claimed by k_pipe_peek() */
 
 #define Z_PIPE_INITIALIZER(obj, pipe_buffer, pipe_buffer_size)     \
 	{                                                           \
@@ -4972,6 +5271,7 @@ __syscall int k_pipe_alloc_init(struct k_pipe *pipe, size_t size);
  * @retval -EIO Returned without waiting; zero data bytes were written.
  * @retval -EAGAIN Waiting period timed out; between zero and @a min_xfer
  *                 minus one data bytes were written.
+ * @retval -EBUSY The pipe's free space is reserved by k_pipe_reserve().
  */
 __syscall int k_pipe_put(struct k_pipe *pipe, const void *data,
 			 size_t bytes_to_write, size_t *bytes_written,
@@ -4995,6 +5295,7 @@ __syscall int k_pipe_put(struct k_pipe *pipe, const void *data,
  * @retval -EIO Returned without waiting; zero data bytes were read.
  * @retval -EAGAIN Waiting period timed out; between zero and @a min_xfer
  *                 minus one data bytes were read.
+ * @retval -EBUSY The pipe's data is claimed by k_pipe_peek().
  */
 __syscall int k_pipe_get(struct k_pipe *pipe, void *data,
 			 size_t bytes_to_read, size_t *bytes_read,
@@ -5045,6 +5346,100 @@ __syscall void k_pipe_flush(struct k_pipe *pipe);
  */
 __syscall void k_pipe_buffer_flush(struct k_pipe *pipe);
 
+/**
+ * @brief Reserve free space in a pipe's buffer for writing in place
+ *
+ * This routine claims up to @a size bytes of contiguous free space in the
+ * buffer of @a pipe, so a producer can generate data directly into it
+ * instead of copying it in with k_pipe_put(). The data becomes readable
+ * once the reservation is completed with k_pipe_commit(). Only one
+ * reservation may be outstanding; k_pipe_put() fails with -EBUSY until it
+ * is committed.
+ *
+ * Less than @a size bytes may be granted when the free space wraps around
+ * the end of the buffer. The routine never waits.
+ *
+ * @note Not available to user mode threads, as the pipe buffer is kernel
+ *       memory.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param pipe Address of the pipe.
+ * @param data Address of area to hold the start of the reserved space.
+ * @param size Maximum number of bytes to reserve on entry, number of bytes
+ *             reserved on return.
+ *
+ * @retval 0 Space reserved.
+ * @retval -EBUSY Another reservation is outstanding.
+ * @retval -EAGAIN The pipe buffer is full or the pipe has no buffer.
+ */
+int k_pipe_reserve(struct k_pipe *pipe, void **data, size_t *size);
+
+/**
+ * @brief Commit data written to space reserved with k_pipe_reserve()
+ *
+ * This routine makes the first @a size bytes of the reserved space
+ * readable and releases the reservation. Threads waiting in k_pipe_get()
+ * are handed the data, and poll events are signaled, just as for
+ * k_pipe_put(). Committing zero bytes cancels the reservation.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param pipe Address of the pipe.
+ * @param size Number of bytes written, at most the size reserved.
+ *
+ * @retval 0 Data committed.
+ * @retval -EINVAL No reservation is outstanding or @a size is too large.
+ */
+int k_pipe_commit(struct k_pipe *pipe, size_t size);
+
+/**
+ * @brief Access data in a pipe's buffer in place
+ *
+ * This routine claims up to @a size bytes of contiguous data at the head
+ * of the buffer of @a pipe, so a consumer can process it directly instead
+ * of copying it out with k_pipe_get(). The data is removed from the pipe
+ * only once k_pipe_consume() is called. Only one claim may be
+ * outstanding; k_pipe_get() fails with -EBUSY until it is consumed.
+ *
+ * Less than @a size bytes may be returned when the data wraps around the
+ * end of the buffer. Data of writers waiting in k_pipe_put() that has not
+ * made it into the buffer yet is not returned. The routine never waits.
+ *
+ * @note Not available to user mode threads, as the pipe buffer is kernel
+ *       memory.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param pipe Address of the pipe.
+ * @param data Address of area to hold the start of the data.
+ * @param size Maximum number of bytes to claim on entry, number of bytes
+ *             claimed on return.
+ *
+ * @retval 0 Data claimed.
+ * @retval -EBUSY Another claim is outstanding.
+ * @retval -EAGAIN The pipe buffer is empty or the pipe has no buffer.
+ */
+int k_pipe_peek(struct k_pipe *pipe, void **data, size_t *size);
+
+/**
+ * @brief Remove data accessed with k_pipe_peek() from a pipe
+ *
+ * This routine removes the first @a size bytes of the claimed data from
+ * the pipe and releases the claim. Data from threads waiting in
+ * k_pipe_put() then moves into the freed space, just as for k_pipe_get().
+ * Consuming zero bytes releases the claim and leaves the data in place.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param pipe Address of the pipe.
+ * @param size Number of bytes processed, at most the size claimed.
+ *
+ * @retval 0 Data removed.
+ * @retval -EINVAL No claim is outstanding or @a size is too large.
+ */
+int k_pipe_consume(struct k_pipe *pipe, size_t size);
+
 /** @} */
 
 /**
@@ -5060,6 +5455,14 @@ struct k_mem_slab_info {
 #endif
 };
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+struct z_mem_slab_cache {
+	struct k_spinlock lock;
+	char *free_list;
+	uint32_t count;
+};
+#endif
+
 struct k_mem_slab {
 	_wait_q_t wait_q;
 	struct k_spinlock lock;
@@ -5072,8 +5475,23 @@ struct k_mem_slab {
 #ifdef CONFIG_OBJ_CORE_MEM_SLAB
 	struct k_obj_core  obj_core;
 #endif
+
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	/* Threads about to wait for, or waiting for, a free block.  Blocks
+	 * are not cached while this is non-zero.
+	 */
+	atomic_t cache_waiters;
+
+	/* Free blocks held per CPU.  They are counted in info.num_used. */
+	struct z_mem_slab_cache cache[CONFIG_MP_MAX_NUM_CPUS];
+#endif
 };
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+/* Number of free blocks held in the CPU caches of a slab. */
+uint32_t z_mem_slab_num_cached(struct k_mem_slab *slab);
+#endif
+
 #define Z_MEM_SLAB_INITIALIZER(_slab, _slab_buffer, _slab_block_size, \
 			       _slab_num_blocks)                      \
 	{                                                             \
@@ -5220,7 +5638,15 @@ void k_mem_slab_free(struct k_mem_slab *slab, void *mem);
  */
 static inline uint32_t k_mem_slab_num_used_get(struct k_mem_slab *slab)
 {
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	uint32_t num_used = slab->info.num_used;
+	uint32_t cached = z_mem_slab_num_cached(slab);
+
+	/* Unlocked snapshot, a concurrent refill may be half seen */
+	return (num_used > cached) ? (num_used - cached) : 0U;
+#else
 	return slab->info.num_used;
+#endif
 }
 
 /**
@@ -5255,7 +5681,7 @@ static inline uint32_t k_mem_slab_max_used_get(struct k_mem_slab *slab)
  */
 static inline uint32_t k_mem_slab_num_free_get(struct k_mem_slab *slab)
 {
-	return slab->info.num_blocks - slab->info.num_used;
+	return slab->info.num_blocks - k_mem_slab_num_used_get(slab);
 }
 
 /**
@@ -5824,6 +6250,95 @@ __syscall void k_poll_signal_check(struct k_poll_signal *sig,
 
 __syscall int k_poll_signal_raise(struct k_poll_signal *sig, int result);
 
+#if defined(CONFIG_POLL_SET) || defined(__DOXYGEN__)
+/**
+ * @brief Persistent poll set
+ *
+ * Events added to a poll set stay registered with their objects between
+ * waits. Events becoming ready are queued on the set's ready list, so
+ * k_poll_set_wait() only deals with the events that are ready.
+ */
+struct k_poll_set {
+	/** PRIVATE - DO NOT TOUCH */
+	struct z_poller poller;
+
+	/** PRIVATE - DO NOT TOUCH */
+	sys_dlist_t ready;
+
+	/** PRIVATE - DO NOT TOUCH */
+	sys_dlist_t reported;
+
+	/** PRIVATE - DO NOT TOUCH */
+	_wait_q_t wait_q;
+};
+
+/**
+ * @brief Initialize a poll set.
+ *
+ * @param set Address of the poll set.
+ */
+void k_poll_set_init(struct k_poll_set *set);
+
+/**
+ * @brief Add an event to a poll set.
+ *
+ * This routine registers @a event with its object for as long as it is part
+ * of @a set. The event must have been initialized with k_poll_event_init()
+ * or K_POLL_EVENT_INITIALIZER() and must not be passed to k_poll() or
+ * another set while it is part of @a set. Its memory must remain valid until
+ * it is removed again.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param set Address of the poll set.
+ * @param event Address of the event to add.
+ *
+ * @retval 0 Event added.
+ * @retval -EALREADY The event is already being polled.
+ */
+int k_poll_set_add(struct k_poll_set *set, struct k_poll_event *event);
+
+/**
+ * @brief Remove an event from a poll set.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param set Address of the poll set.
+ * @param event Address of the event to remove.
+ *
+ * @retval 0 Event removed.
+ * @retval -EINVAL The event is not part of @a set.
+ */
+int k_poll_set_remove(struct k_poll_set *set, struct k_poll_event *event);
+
+/**
+ * @brief Wait for events of a poll set to become ready.
+ *
+ * This routine waits until at least one event of @a set is ready and
+ * returns up to @a max_events of the ready events in @a ready, with their
+ * state fields telling which conditions were met. The work done is
+ * proportional to the number of ready events, not to the size of the set.
+ *
+ * Events are level triggered: each event returned is checked again on the
+ * next call, and returned again if its condition still holds, until then
+ * its state is left untouched. Events that did not fit into @a ready stay
+ * queued for the next call.
+ *
+ * @note Poll sets are meant to be waited on by one thread at a time.
+ *
+ * @param set Address of the poll set.
+ * @param ready Array to hold the addresses of the ready events.
+ * @param max_events Size of the @a ready array.
+ * @param timeout Waiting period for an event to become ready,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @return Number of events stored in @a ready, greater than zero.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+int k_poll_set_wait(struct k_poll_set *set, struct k_poll_event **ready,
+		    int max_events, k_timeout_t timeout);
+#endif /* CONFIG_POLL_SET */
+
 /** @} */
 
 /**
@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Fibers, cooperatively scheduled within one thread
+ */
+
+#ifndef ZEPHYR_INCLUDE_KERNEL_FIBER_H_
+#define ZEPHYR_INCLUDE_KERNEL_FIBER_H_
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/dlist.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup fiber_apis Fiber APIs
+ * @ingroup kernel_apis
+ * @{
+ */
+
+/**
+ * @brief Fiber structure
+ *
+ * A fiber runs on its own stack, but within the thread running its fiber
+ * host, to which it yields whenever it waits.
+ */
+struct k_fiber {
+	/** @cond INTERNAL_HIDDEN */
+	/* Only holds the saved context of the fiber, it's never scheduled */
+	struct k_thread ctx;
+
+	/* In the ready or waiting list of the host */
+	sys_dnode_t node;
+	struct k_fiber_host *host;
+
+	k_thread_entry_t entry;
+	void *p1;
+	void *p2;
+	void *p3;
+
+	/* What the fiber waits for */
+	struct k_poll_event *events;
+	int num_events;
+	k_timepoint_t end;
+	/** @endcond */
+};
+
+/**
+ * @brief Fiber host structure
+ *
+ * Use K_FIBER_HOST_DEFINE() or k_fiber_host_init() to initialize a
+ * fiber host.
+ */
+struct k_fiber_host {
+	/** @cond INTERNAL_HIDDEN */
+	/* Saved context of k_fiber_host_run() */
+	struct k_thread ctx;
+
+	/* Fiber being run, NULL while in k_fiber_host_run() */
+	struct k_fiber *current;
+	sys_dlist_t ready;
+	sys_dlist_t waiting;
+	size_t num_fibers;
+
+	/* Events of all the waiting fibers, for k_poll() */
+	struct k_poll_event *events;
+	int max_events;
+	/** @endcond */
+};
+
+/**
+ * @brief Statically define and initialize a fiber host
+ *
+ * @param name Name of the fiber host.
+ * @param max_events Number of poll events the fibers of the host can
+ *                   wait for at the same time.
+ */
+#define K_FIBER_HOST_DEFINE(name, max_events) \
+	static struct k_poll_event _k_fiber_host_events_##name[max_events]; \
+	struct k_fiber_host name = { \
+		.ready = SYS_DLIST_STATIC_INIT(&name.ready), \
+		.waiting = SYS_DLIST_STATIC_INIT(&name.waiting), \
+		.events = _k_fiber_host_events_##name, \
+		.max_events = (max_events), \
+	}
+
+/**
+ * @brief Initialize a fiber host
+ *
+ * @param host Fiber host.
+ * @param events Storage for the poll events the fibers of the host wait
+ *               for.
+ * @param max_events Number of elements of @a events.
+ */
+void k_fiber_host_init(struct k_fiber_host *host, struct k_poll_event *events,
+		       int max_events);
+
+/**
+ * @brief Run the fibers of a fiber host
+ *
+ * The calling thread switches between the fibers of @a host whenever the
+ * running one yields or waits, and waits itself whenever all of them are
+ * waiting. This returns once all the fibers have returned from their
+ * entry point.
+ *
+ * A thread can only run one fiber host at a time.
+ *
+ * @param host Fiber host.
+ */
+void k_fiber_host_run(struct k_fiber_host *host);
+
+/**
+ * @brief Create a fiber
+ *
+ * The fiber is ready to run in @a host, but only starts running once the
+ * thread running the host switches to it. This must be called from the
+ * thread running @a host, or the thread which is going to.
+ *
+ * Fibers can have much smaller stacks than threads, as nothing runs on
+ * them but the fiber itself. Interrupts still do, on architectures which
+ * don't switch to an interrupt stack.
+ *
+ * @param host Fiber host.
+ * @param fiber Fiber.
+ * @param stack Stack of the fiber, defined with K_KERNEL_STACK_DEFINE().
+ * @param stack_size Size of @a stack, as returned by K_KERNEL_STACK_SIZEOF().
+ * @param entry Entry point of the fiber.
+ * @param p1 1st entry point parameter.
+ * @param p2 2nd entry point parameter.
+ * @param p3 3rd entry point parameter.
+ */
+void k_fiber_create(struct k_fiber_host *host, struct k_fiber *fiber,
+		    k_thread_stack_t *stack, size_t stack_size,
+		    k_thread_entry_t entry, void *p1, void *p2, void *p3);
+
+/**
+ * @brief Get the running fiber
+ *
+ * @return Fiber, or NULL when not called from a fiber.
+ */
+struct k_fiber *k_fiber_current_get(void);
+
+/**
+ * @brief Yield to the other ready fibers of the host
+ *
+ * Switches directly to the next ready fiber of the host, if any, without
+ * going through the kernel scheduler.
+ */
+void k_fiber_yield(void);
+
+/**
+ * @brief Put the running fiber to sleep
+ *
+ * The other fibers of the host keep running in the meantime.
+ *
+ * @param timeout Time to sleep.
+ */
+void k_fiber_sleep(k_timeout_t timeout);
+
+/**
+ * @brief Wait for poll events from a fiber
+ *
+ * Like k_poll(), but blocking only switches to the other fibers of the
+ * host, which keeps polling the events for the fiber. The events can be
+ * of any type k_poll() supports, and are only checked, without any
+ * object being acquired.
+ *
+ * @param events Events to wait for, in K_POLL_MODE_NOTIFY_ONLY mode.
+ * @param num_events Number of events.
+ * @param timeout Waiting period, or one of the special values K_NO_WAIT
+ *                and K_FOREVER.
+ *
+ * @retval 0 One or more events are ready.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EINTR Polling was cancelled, see k_poll().
+ */
+int k_fiber_poll(struct k_poll_event *events, int num_events,
+		 k_timeout_t timeout);
+
+/**
+ * @brief Take a semaphore from a fiber
+ *
+ * Like k_sem_take(), but blocking only switches to the other fibers of
+ * the host.
+ *
+ * @param sem Semaphore.
+ * @param timeout Waiting period, or one of the special values K_NO_WAIT
+ *                and K_FOREVER.
+ *
+ * @retval 0 Semaphore taken.
+ * @retval -EBUSY Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+int k_fiber_sem_take(struct k_sem *sem, k_timeout_t timeout);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_KERNEL_FIBER_H_ */
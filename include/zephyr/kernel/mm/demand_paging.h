@@ -57,6 +57,16 @@ struct k_mem_paging_stats_t {
 		/** Number of dirty pages selected for eviction */
 		unsigned long			dirty;
 	} eviction;
+
+#if (CONFIG_DEMAND_PAGING_READAHEAD > 0) || defined(__DOXYGEN__)
+	struct {
+		/** Number of page faults which read ahead */
+		unsigned long			faults;
+
+		/** Number of data pages read ahead */
+		unsigned long			pages;
+	} readahead;
+#endif /* CONFIG_DEMAND_PAGING_READAHEAD */
 #endif /* CONFIG_DEMAND_PAGING_STATS */
 };
 
@@ -327,6 +337,38 @@ void k_mem_paging_backing_store_page_out(uintptr_t location);
  */
 void k_mem_paging_backing_store_page_in(uintptr_t location);
 
+struct k_sem;
+/**
+ * Start fetching a data page from the provided location
+ *
+ * This is only used if CONFIG_DEMAND_PAGING_BACKING_STORE_ASYNC is enabled.
+ * When a preemptible thread takes a page fault with interrupts unlocked,
+ * this is called with interrupts locked before any page frame is selected
+ * for the data page. If the fetch is started, the faulting thread pends
+ * until @p done is given, and other threads run meanwhile. Page faults
+ * taken by them are serviced synchronously, so the backing store must be
+ * able to handle calls to k_mem_paging_backing_store_page_in() and
+ * k_mem_paging_backing_store_page_out() while a fetch is in progress.
+ *
+ * Once woken up, the faulting thread services its page fault again, and
+ * unless the data page has been paged in or moved meanwhile, this ends in
+ * a call to k_mem_paging_backing_store_page_in() with the same location.
+ * The backing store is expected to keep the fetched data page around so
+ * that call completes quickly.
+ *
+ * At most one fetch is in progress at any time.
+ *
+ * @param location Location token for the data page
+ * @param done Semaphore to give, from any context, once the fetch is over
+ * @retval 0 The fetch has been started
+ * @retval -EBUSY The fetch cannot be started now, the page fault will be
+ *         serviced synchronously
+ * @retval -ENOTSUP The data page at this location cannot be fetched
+ *         asynchronously, the page fault will be serviced synchronously
+ */
+int k_mem_paging_backing_store_page_in_async(uintptr_t location,
+					     struct k_sem *done);
+
 /**
  * Update internal accounting after a page-in
  *
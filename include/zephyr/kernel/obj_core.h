@@ -53,6 +53,8 @@
 #define K_OBJ_TYPE_PIPE_ID       K_OBJ_TYPE_ID_GEN("PIPE")
 /** Semaphore object type */
 #define K_OBJ_TYPE_SEM_ID        K_OBJ_TYPE_ID_GEN("SEM4")
+/** Spinlock object type */
+#define K_OBJ_TYPE_SPINLOCK_ID   K_OBJ_TYPE_ID_GEN("SPIN")
 /** Stack object type */
 #define K_OBJ_TYPE_STACK_ID      K_OBJ_TYPE_ID_GEN("STCK")
 /** Thread object type */
@@ -30,4 +30,66 @@ struct k_cycle_stats {
 	bool      track_usage;  /**< true if gathering usage stats */
 };
 
+#if defined(CONFIG_SCHED_THREAD_USAGE_LATENCY) || defined(__DOXYGEN__)
+/**
+ * Structure used to track the scheduling latency of a thread.
+ *
+ * Bucket 0 of @a hist counts latencies below
+ * 2^CONFIG_SCHED_THREAD_USAGE_LATENCY_SHIFT cycles, and every following
+ * bucket covers twice the range of the previous one.
+ */
+struct k_sched_latency {
+	uint32_t  ready;        /**< when the thread became ready, 0 if not */
+	uint32_t  max;          /**< longest latency in cycles */
+	uint32_t  preemptions;  /**< \# of times switched out while ready */
+	/** latency histogram */
+	uint32_t  hist[CONFIG_SCHED_THREAD_USAGE_LATENCY_BUCKETS];
+};
+#endif
+
+/**
+ * Structure used to track contention statistics of a spinlock or mutex.
+ * Times are in cycles, as read by k_cycle_get_32().
+ */
+
+struct k_lock_stats {
+	uint64_t  acquired;     /**< \# of times the lock was taken */
+	uint64_t  contended;    /**< \# of times the lock was held by another */
+	uint64_t  wait_total;   /**< total time spent waiting for the lock */
+	uint32_t  wait_max;     /**< longest wait for the lock */
+	uint32_t  hold_max;     /**< longest time the lock was held */
+};
+
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+
+/* Must be called with the lock held */
+static inline void z_lock_stats_acquired(struct k_lock_stats *stats,
+					 bool contended, uint32_t wait)
+{
+	stats->acquired++;
+
+	if (contended) {
+		stats->contended++;
+		stats->wait_total += wait;
+		if (wait > stats->wait_max) {
+			stats->wait_max = wait;
+		}
+	}
+}
+
+/* Must be called with the lock held */
+static inline void z_lock_stats_released(struct k_lock_stats *stats,
+					 uint32_t hold)
+{
+	if (hold > stats->hold_max) {
+		stats->hold_max = hold;
+	}
+}
+
+/**
+ * INTERNAL_HIDDEN @endcond
+ */
+
 #endif
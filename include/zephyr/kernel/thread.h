@@ -41,6 +41,7 @@ struct __thread_entry {
 #endif
 
 struct k_thread;
+struct k_sched_server;
 
 /*
  * This _pipe_desc structure is used by the pipes kernel module when
@@ -117,6 +118,11 @@ struct _thread_base {
 	/* Recursive count of irq_lock() calls */
 	uint8_t global_lock_count;
 
+#ifdef CONFIG_SCHED_CPU_RUNQ
+	/* CPU whose run queue holds this thread while it is queued */
+	uint8_t runq_cpu;
+#endif
+
 #endif
 
 #ifdef CONFIG_SCHED_CPU_MASK
@@ -142,9 +148,19 @@ struct _thread_base {
 	void *slice_data;
 #endif
 
+#ifdef CONFIG_SCHED_DEADLINE_SERVER
+	/* Budget server the thread is attached to, if any */
+	struct k_sched_server *server;
+	sys_dnode_t server_node;
+#endif
+
 #ifdef CONFIG_SCHED_THREAD_USAGE
 	struct k_cycle_stats  usage;   /* Track thread usage statistics */
 #endif
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+	struct k_sched_latency latency; /* Track scheduling latency */
+#endif
 };
 
 typedef struct _thread_base _thread_base_t;
@@ -171,6 +187,13 @@ struct _thread_stack_info {
 	 * is the initial stack pointer for a thread. May be 0.
 	 */
 	size_t delta;
+
+#ifdef CONFIG_THREAD_ANALYZER_INCREMENTAL
+	/* Unused stack space found by the last analysis of the thread
+	 * analyzer, 0 if the stack was not analyzed yet.
+	 */
+	size_t unused;
+#endif
 };
 
 typedef struct _thread_stack_info _thread_stack_info_t;
@@ -226,6 +249,28 @@ typedef struct k_thread_runtime_stats {
 	 */
 
 	uint64_t idle_cycles;
+
+#if defined(CONFIG_SMP) && defined(CONFIG_SCHED_IPI_SUPPORTED)
+	/*
+	 * These fields are also only used for CPU statistics: the number
+	 * of scheduler IPIs sent to the CPU, and how many of them did
+	 * not cause it to halt, time slice or switch threads.
+	 */
+
+	uint32_t ipi_received;
+	uint32_t ipi_useless;
+#endif
+#endif
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+	/*
+	 * Scheduling latency of a thread, always zero for CPUs.  See
+	 * struct k_sched_latency for the layout of the histogram.
+	 */
+
+	uint32_t latency_hist[CONFIG_SCHED_THREAD_USAGE_LATENCY_BUCKETS];
+	uint32_t latency_max;         /* longest latency in cycles */
+	uint32_t preemptions;         /* # of times switched out while ready */
 #endif
 
 #if defined(__cplusplus) && !defined(CONFIG_SCHED_THREAD_USAGE) &&                                 \
@@ -351,6 +396,11 @@ struct k_thread {
 	struct k_obj_core  obj_core;
 #endif
 
+#ifdef CONFIG_FIBER
+	/** Fiber host run by the thread, if any */
+	struct k_fiber_host *fiber_host;
+#endif
+
 #ifdef CONFIG_SMP
 	/** threads waiting in k_thread_suspend() */
 	_wait_q_t  halt_queue;
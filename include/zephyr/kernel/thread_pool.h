@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Pools of pre-created threads for short-lived jobs
+ */
+
+#ifndef ZEPHYR_INCLUDE_KERNEL_THREAD_POOL_H_
+#define ZEPHYR_INCLUDE_KERNEL_THREAD_POOL_H_
+
+#include <zephyr/kernel.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup thread_pool_apis Thread Pool APIs
+ * @ingroup kernel_apis
+ * @{
+ */
+
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+
+struct k_thread_pool;
+
+struct z_thread_pool_worker {
+	/* Reserved for the idle worker FIFO */
+	void *fifo_reserved;
+
+	struct k_thread thread;
+	struct k_sem start;
+	struct k_thread_pool *pool;
+
+	k_thread_entry_t entry;
+	void *p1;
+	void *p2;
+	void *p3;
+};
+
+/**
+ * INTERNAL_HIDDEN @endcond
+ */
+
+/**
+ * @brief Thread pool structure
+ *
+ * Use K_THREAD_POOL_DEFINE() to define a thread pool.
+ */
+struct k_thread_pool {
+	/** @cond INTERNAL_HIDDEN */
+	struct z_thread_pool_worker *workers;
+	k_thread_stack_t *stacks;
+	size_t stack_len;
+	size_t stack_size;
+	size_t count;
+	int prio;
+	const char *name;
+
+	/* Workers waiting for a job */
+	struct k_fifo idle;
+	/** @endcond */
+};
+
+/**
+ * @brief Statically define a thread pool
+ *
+ * The pool has @a count kernel threads with stacks of @a stack_size bytes,
+ * which are created by k_thread_pool_start().
+ *
+ * @param pool_name Name of the thread pool.
+ * @param count Number of threads in the pool.
+ * @param stack_size Stack size of each thread in bytes.
+ * @param prio Priority of the threads when they start a job.
+ */
+#define K_THREAD_POOL_DEFINE(pool_name, count, stack_size, prio) \
+	static struct z_thread_pool_worker \
+		_k_thread_pool_workers_##pool_name[count]; \
+	static K_KERNEL_STACK_ARRAY_DEFINE(_k_thread_pool_stacks_##pool_name, \
+					   count, stack_size); \
+	struct k_thread_pool pool_name = { \
+		.workers = _k_thread_pool_workers_##pool_name, \
+		.stacks = &_k_thread_pool_stacks_##pool_name[0][0], \
+		.stack_len = K_KERNEL_STACK_LEN(stack_size), \
+		.stack_size = K_KERNEL_STACK_SIZEOF( \
+			_k_thread_pool_stacks_##pool_name[0]), \
+		.count = (count), \
+		.prio = (prio), \
+		.name = STRINGIFY(pool_name), \
+	}
+
+/**
+ * @brief Create the threads of a thread pool
+ *
+ * This must be called once before jobs are spawned on the pool.
+ *
+ * @param pool Thread pool.
+ */
+void k_thread_pool_start(struct k_thread_pool *pool);
+
+/**
+ * @brief Run a function in a thread of a thread pool
+ *
+ * This hands @a entry to an idle thread of the pool, which runs it as if
+ * it had been created by k_thread_create() with that entry point, at the
+ * priority of the pool. When @a entry returns, the thread is idle again,
+ * ready for the next job.
+ *
+ * This is much cheaper than creating a thread: the thread object and
+ * stack are not initialized again, nor added to the list of threads or,
+ * with CONFIG_USERSPACE, registered as kernel objects.
+ *
+ * The thread being reused, anything it keeps between jobs, like any
+ * custom data, name, errno value or thread local storage, is seen by the
+ * next job. Jobs must return instead of aborting their thread. Threads
+ * can't be joined, as they don't exit.
+ *
+ * @param pool Thread pool.
+ * @param entry Function to run.
+ * @param p1 1st entry point parameter.
+ * @param p2 2nd entry point parameter.
+ * @param p3 3rd entry point parameter.
+ * @param timeout Waiting period for a thread of the pool to become idle,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @return ID of the thread running @a entry, or NULL if no thread became
+ *         idle in time.
+ */
+k_tid_t k_thread_pool_spawn(struct k_thread_pool *pool, k_thread_entry_t entry,
+			    void *p1, void *p2, void *p3, k_timeout_t timeout);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_KERNEL_THREAD_POOL_H_ */
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Kernel data readable by user threads without system calls
+ */
+
+#ifndef ZEPHYR_INCLUDE_KERNEL_VDSO_H_
+#define ZEPHYR_INCLUDE_KERNEL_VDSO_H_
+
+#include <stdint.h>
+#include <zephyr/sys/barrier.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/toolchain.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct k_thread;
+
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+
+/* The data is given its own memory partition, so it must be aligned and
+ * sized for the MMU or MPU.
+ */
+#if defined(CONFIG_MMU)
+#define Z_VDSO_ALIGN CONFIG_MMU_PAGE_SIZE
+#elif defined(CONFIG_ARM_MPU_REGION_MIN_ALIGN_AND_SIZE)
+#define Z_VDSO_ALIGN MAX(CONFIG_ARM_MPU_REGION_MIN_ALIGN_AND_SIZE, 64)
+#else
+#define Z_VDSO_ALIGN 64
+#endif
+
+struct z_vdso_data {
+	/* Odd while the kernel updates the fields below */
+	uint32_t seq;
+
+	/* Tick count and cycle count at the last sys_clock_announce() */
+	uint64_t ticks;
+	uint32_t cycles;
+
+#ifndef CONFIG_SMP
+	/* Thread running on the (single) CPU */
+	struct k_thread *current;
+#endif
+} __aligned(Z_VDSO_ALIGN);
+
+extern struct z_vdso_data z_vdso_data;
+
+/**
+ * INTERNAL_HIDDEN @endcond
+ */
+
+struct k_mem_partition;
+
+/**
+ * @brief Memory partition of the user readable kernel data
+ *
+ * This is part of the default memory domain. Threads in other memory
+ * domains can only use the functions below if it's added to theirs.
+ */
+extern struct k_mem_partition z_vdso_partition;
+
+/**
+ * @defgroup vdso_apis User Readable Kernel Data
+ * @ingroup kernel_apis
+ * @{
+ */
+
+/**
+ * @brief Read the system tick count at the last clock announcement
+ *
+ * This reads the tick count from a memory partition which the kernel
+ * shares read-only with user threads, so it doesn't need a system call
+ * in user mode.
+ *
+ * With a ticked kernel, this is the same as k_uptime_ticks(). With
+ * CONFIG_TICKLESS_KERNEL, the tick count is only updated when the timer
+ * driver announces elapsed ticks, so it may be behind k_uptime_ticks() by
+ * as much as the time since the last expired timeout.
+ *
+ * @return Tick count at the last clock announcement
+ */
+static inline int64_t k_vdso_ticks_get(void)
+{
+	volatile struct z_vdso_data *data = &z_vdso_data;
+	uint32_t seq;
+	uint64_t ticks;
+
+	do {
+		seq = data->seq;
+		barrier_dmem_fence_full();
+		ticks = data->ticks;
+		barrier_dmem_fence_full();
+	} while (((seq & 1U) != 0U) || (seq != data->seq));
+
+	return (int64_t)ticks;
+}
+
+/**
+ * @brief Read the tick and cycle counts at the last clock announcement
+ *
+ * Like k_vdso_ticks_get(), but also returns the value of k_cycle_get_32()
+ * when the tick count was last updated. Where the cycle counter can be
+ * read from user mode, this allows extrapolating the current time from a
+ * consistent pair of values.
+ *
+ * @param[out] ticks Tick count at the last clock announcement
+ * @param[out] cycles Cycle count at the last clock announcement
+ */
+static inline void k_vdso_clock_base_get(int64_t *ticks, uint32_t *cycles)
+{
+	volatile struct z_vdso_data *data = &z_vdso_data;
+	uint32_t seq;
+
+	do {
+		seq = data->seq;
+		barrier_dmem_fence_full();
+		*ticks = (int64_t)data->ticks;
+		*cycles = data->cycles;
+		barrier_dmem_fence_full();
+	} while (((seq & 1U) != 0U) || (seq != data->seq));
+}
+
+#if !defined(CONFIG_SMP) || defined(__DOXYGEN__)
+/**
+ * @brief Read the current thread without a system call
+ *
+ * Only available on uniprocessor systems. This is used by k_current_get()
+ * in user mode, unless CONFIG_CURRENT_THREAD_USE_TLS is enabled.
+ *
+ * @return ID of current thread.
+ */
+static inline struct k_thread *k_vdso_current_get(void)
+{
+	return ((volatile struct z_vdso_data *)&z_vdso_data)->current;
+}
+#endif
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_KERNEL_VDSO_H_ */
@@ -114,7 +114,7 @@ struct _cpu {
 	/* one assigned idle thread per CPU */
 	struct k_thread *idle_thread;
 
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#ifdef CONFIG_SCHED_PER_CPU_READY_Q
 	struct _ready_q ready_q;
 #endif
 
@@ -147,6 +147,14 @@ struct _cpu {
 #ifdef CONFIG_SCHED_THREAD_USAGE_ALL
 	struct k_cycle_stats *usage;
 #endif
+
+#if defined(CONFIG_SMP) && defined(CONFIG_SCHED_IPI_SUPPORTED)
+	/* Scheduler IPIs sent to this CPU, and how many of them did
+	 * not lead to a halt, time slice or context switch
+	 */
+	atomic_t ipi_received;
+	uint32_t ipi_useless;
+#endif
 #endif
 
 #ifdef CONFIG_OBJ_CORE_SYSTEM
@@ -170,7 +178,7 @@ struct z_kernel {
 	 * ready queue: can be big, keep after small fields, since some
 	 * assembly (e.g. ARC) are limited in the encoding of the offset
 	 */
-#ifndef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#ifndef CONFIG_SCHED_PER_CPU_READY_Q
 	struct _ready_q ready_q;
 #endif
 
@@ -200,8 +208,8 @@ struct z_kernel {
 #endif
 
 #if defined(CONFIG_SMP) && defined(CONFIG_SCHED_IPI_SUPPORTED)
-	/* Need to signal an IPI at the next scheduling point */
-	bool pending_ipi;
+	/* Bitmask of CPUs to signal an IPI at the next scheduling point */
+	atomic_t pending_ipi;
 #endif
 };
 
@@ -154,6 +154,9 @@ int llext_unload(struct llext **ext);
 /**
  * @brief Find the address for an arbitrary symbol name.
  *
+ * The tables of an extension are sorted by name when it is loaded and are
+ * binary searched, as is the base table when the linker sorted it.
+ *
  * @param[in] sym_table Symbol table to lookup symbol in, if NULL uses base table
  * @param[in] sym_name Symbol name to find
  *
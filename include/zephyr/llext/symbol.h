@@ -55,7 +55,7 @@ struct llext_symbol {
 /**
  * @brief A symbol table
  *
- * An array of symbols
+ * An array of symbols, sorted by name
  */
 struct llext_symtable {
 	/** Number of symbols in the table */
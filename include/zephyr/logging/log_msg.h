@@ -159,7 +159,9 @@ enum z_log_msg_mode {
 #define Z_LOG_MSG_CBPRINTF_FLAGS(_cstr_cnt) \
 	(CBPRINTF_PACKAGE_FIRST_RO_STR_CNT(_cstr_cnt) | \
 	(IS_ENABLED(CONFIG_LOG_MSG_APPEND_RO_STRING_LOC) ? \
-	 CBPRINTF_PACKAGE_ADD_STRING_IDXS : 0))
+	 CBPRINTF_PACKAGE_ADD_STRING_IDXS : 0) | \
+	(IS_ENABLED(CONFIG_LOG_MSG_CONST_CHAR_RO) ? \
+	 CBPRINTF_PACKAGE_CONST_CHAR_RO : 0))
 
 #ifdef CONFIG_LOG_USE_VLA
 #define Z_LOG_MSG_ON_STACK_ALLOC(ptr, len) \
@@ -23,6 +23,10 @@ extern "C" {
 enum log_dict_output_msg_type {
 	MSG_NORMAL = 0,
 	MSG_DROPPED_MSG = 1,
+	/** Compact message, see CONFIG_LOG_DICTIONARY_COMPACT. */
+	MSG_COMPACT = 2,
+	/** LZ4 compressed frame of messages, see CONFIG_LOG_DICTIONARY_COMPACT_LZ4. */
+	MSG_LZ4_FRAME = 3,
 };
 
 /**
@@ -15,11 +15,30 @@
  */
 
 #include <zephyr/mem_mgmt/mem_attr.h>
+#include <zephyr/sys/mem_stats.h>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * @brief Region placement policies
+ *
+ * In all cases the regions are tried in the order they are defined in the
+ * DT: the regions to allocate from first, usually the fastest ones, should
+ * come first.
+ */
+enum mem_attr_heap_policy {
+	/** Only allocate from regions with exactly the requested attributes */
+	MEM_ATTR_HEAP_POLICY_EXACT,
+	/**
+	 * Allocate from regions with exactly the requested attributes, or
+	 * spill over to the regions that have at least those attributes
+	 * when they are full.
+	 */
+	MEM_ATTR_HEAP_POLICY_SPILL,
+};
+
 /**
  * @brief Init the memory pool
  *
@@ -63,6 +82,25 @@ void *mem_attr_heap_alloc(uint32_t attr, size_t bytes);
  */
 void *mem_attr_heap_aligned_alloc(uint32_t attr, size_t align, size_t bytes);
 
+/**
+ * @brief Allocate memory following a placement policy.
+ *
+ * Allocates a block of memory of the specified size in bytes and alignment,
+ * from the regions selected by the attribute and the placement policy.
+ * With @ref MEM_ATTR_HEAP_POLICY_EXACT this is the same as
+ * @ref mem_attr_heap_aligned_alloc.
+ *
+ * @param attr capability / attribute requested for the memory block.
+ * @param policy placement policy.
+ * @param align power of two alignment for the returned pointer in bytes, or 0.
+ * @param bytes requested size of the allocation in bytes.
+ *
+ * @retval ptr a valid pointer to the allocated memory.
+ * @retval NULL if no memory is available with that attribute and size.
+ */
+void *mem_attr_heap_policy_alloc(uint32_t attr, enum mem_attr_heap_policy policy,
+				 size_t align, size_t bytes);
+
 /**
  * @brief Free the allocated memory
  *
@@ -87,6 +125,19 @@ void mem_attr_heap_free(void *block);
  */
 const struct mem_attr_region_t *mem_attr_heap_get_region(void *addr);
 
+/**
+ * @brief Get the utilization of the heap of a memory region
+ *
+ * @param region memory region, as returned by @ref mem_attr_heap_get_region
+ *	  or @ref mem_attr_get_regions.
+ * @param stats where to store the statistics of the heap.
+ *
+ * @retval 0 on success.
+ * @retval -ENOENT if there is no heap for the region.
+ */
+int mem_attr_heap_region_stats_get(const struct mem_attr_region_t *region,
+				   struct sys_memory_stats *stats);
+
 #ifdef __cplusplus
 }
 #endif
@@ -165,6 +165,9 @@ enum img_mgmt_err_code_t {
 
 	/** Current active slot for image cannot be determined */
 	IMG_MGMT_ERR_ACTIVE_SLOT_NOT_KNOWN,
+
+	/** Delta image does not apply to the image of the active slot */
+	IMG_MGMT_ERR_DELTA_SOURCE_MISMATCH,
 };
 
 /**
@@ -189,6 +192,20 @@ struct img_mgmt_upload_req {
 	bool upgrade;			/* Only allow greater version numbers. */
 };
 
+#ifdef CONFIG_IMG_DECODE
+/** Formats of the uploaded data. */
+enum img_mgmt_upload_format {
+	/** Image written as received. */
+	IMG_MGMT_UPLOAD_FORMAT_RAW,
+	/** LZ4 compressed image, see CONFIG_IMG_LZ4. */
+	IMG_MGMT_UPLOAD_FORMAT_LZ4,
+	/** Delta image, see CONFIG_IMG_DELTA. */
+	IMG_MGMT_UPLOAD_FORMAT_DELTA,
+	/** LZ4 compressed delta image. */
+	IMG_MGMT_UPLOAD_FORMAT_LZ4_DELTA,
+};
+#endif
+
 /** Global state for upload in progress. */
 struct img_mgmt_state {
 	/** Flash area being written; -1 if no upload in progress. */
@@ -200,6 +217,18 @@ struct img_mgmt_state {
 	/** Hash of image data; used for resumption of a partial upload. */
 	uint8_t data_sha_len;
 	uint8_t data_sha[IMG_MGMT_DATA_SHA_LEN];
+#ifdef CONFIG_IMG_DECODE
+	/** Format of the uploaded data, an img_mgmt_upload_format. */
+	uint8_t format;
+	/** Size of the decoded image. */
+	size_t image_size;
+	/** Hash of the decoded image. */
+	uint8_t image_sha[IMG_MGMT_DATA_SHA_LEN];
+#endif
+#ifdef CONFIG_IMG_DELTA
+	/** Flash area holding the source of a delta image. */
+	int src_area_id;
+#endif
 };
 
 /** Describes what to do during processing of an upload request. */
@@ -214,6 +243,18 @@ struct img_mgmt_upload_action {
 	bool proceed;
 	/** Whether to erase the destination flash area. */
 	bool erase;
+#ifdef CONFIG_IMG_DECODE
+	/** Format of the uploaded data, an img_mgmt_upload_format. */
+	uint8_t format;
+	/** Size of the decoded image. */
+	size_t image_size;
+	/** Hash of the decoded image. */
+	uint8_t image_sha[IMG_MGMT_DATA_SHA_LEN];
+#endif
+#ifdef CONFIG_IMG_DELTA
+	/** Flash area holding the source of a delta image. */
+	int src_area_id;
+#endif
 #ifdef CONFIG_MCUMGR_GRP_IMG_VERBOSE_ERR
 	/** "rsn" string to be sent as explanation for "rc" code */
 	const char *rc_rsn;
@@ -369,6 +410,7 @@ extern const char *img_mgmt_err_str_downgrade;
 extern const char *img_mgmt_err_str_image_bad_flash_addr;
 extern const char *img_mgmt_err_str_image_too_large;
 extern const char *img_mgmt_err_str_data_overrun;
+extern const char *img_mgmt_err_str_delta_source_mismatch;
 #else
 #define IMG_MGMT_UPLOAD_ACTION_SET_RC_RSN(action, rsn)
 #define IMG_MGMT_UPLOAD_ACTION_RC_RSN(action) NULL
@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Machine learning inference service
+ */
+
+#ifndef ZEPHYR_INCLUDE_ML_INFERENCE_H_
+#define ZEPHYR_INCLUDE_ML_INFERENCE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/dt-bindings/memory-attr/memory-attr-sw.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Machine learning inference service
+ * @defgroup ml_inference ML inference
+ * @ingroup os_services
+ *
+ * Runs TensorFlow Lite Micro models, offloaded to an Ethos-U NPU when
+ * available. The tensor arena of a model is only allocated while a session
+ * of that model is open, so that models with disjoint lifetimes share the
+ * same memory. Inferences are either run by the caller or submitted to the
+ * service threads, which report their completion with a callback.
+ * @{
+ */
+
+/**
+ * @brief Attribute for model weights
+ *
+ * The weights are read in place: declared const with this attribute, they
+ * stay in the flash of XIP targets instead of being copied to RAM. The
+ * alignment is the one required by the Ethos-U.
+ */
+#define ML_MODEL_WEIGHTS __aligned(16)
+
+/**
+ * @brief Default memory attributes of the tensor arenas
+ *
+ * The NPU accesses the arena as a bus master. The arena is allocated from
+ * the first memory region with these attributes that has room for it, in
+ * devicetree order, falling back to the regions with more attributes.
+ */
+#define ML_ARENA_ATTR_DEFAULT DT_MEM_SW_ALLOC_DMA
+
+/** @brief Model description */
+struct ml_model {
+	/** Model name, for logging */
+	const char *name;
+	/** Model flatbuffer, see @ref ML_MODEL_WEIGHTS */
+	const void *data;
+	/** Size of the tensor arena the model needs */
+	size_t arena_size;
+	/** Memory attributes of the tensor arena, for the mem_attr heap */
+	uint32_t arena_attr;
+	/**
+	 * The tflite::MicroOpResolver of the model operators, or NULL for
+	 * models compiled for the Ethos-U, made of the Ethos-U operator only.
+	 */
+	const void *op_resolver;
+};
+
+/**
+ * @brief Define a model with the default arena attributes
+ *
+ * @param _name Name of the struct ml_model variable
+ * @param _data Model flatbuffer
+ * @param _arena_size Size of the tensor arena the model needs
+ */
+#define ML_MODEL_DEFINE(_name, _data, _arena_size)                                                 \
+	const struct ml_model _name = {                                                            \
+		.name = #_name,                                                                    \
+		.data = (_data),                                                                   \
+		.arena_size = (_arena_size),                                                       \
+		.arena_attr = ML_ARENA_ATTR_DEFAULT,                                               \
+		.op_resolver = NULL,                                                               \
+	}
+
+/** @brief Open model, holding its interpreter and tensor arena */
+struct ml_session;
+
+/** @brief Input or output tensor of a session */
+struct ml_tensor {
+	/** Tensor data, in the tensor arena */
+	void *data;
+	/** Size of the tensor data in bytes */
+	size_t bytes;
+};
+
+struct ml_infer_req;
+
+/**
+ * @brief Inference completion callback
+ *
+ * Called from a service thread, the outputs of the session are valid until
+ * the next inference of the session.
+ *
+ * @param req Completed request
+ * @param result 0 on success, negative errno code otherwise
+ */
+typedef void (*ml_infer_cb_t)(struct ml_infer_req *req, int result);
+
+/** @brief Asynchronous inference request */
+struct ml_infer_req {
+	/** @cond INTERNAL_HIDDEN */
+	void *fifo_reserved;
+	/** @endcond */
+	/** Session to run the inference of */
+	struct ml_session *session;
+	/** Completion callback */
+	ml_infer_cb_t cb;
+	/** User data */
+	void *user_data;
+};
+
+/**
+ * @brief Open a session of a model
+ *
+ * Allocate the tensor arena of the model and its tensors, the arena is given
+ * back by @ref ml_session_close.
+ *
+ * @param model Model to open
+ * @param session Set to the opened session
+ *
+ * @retval 0 on success
+ * @retval -ENOMEM if no session or no arena memory is available
+ * @retval -ENOTSUP if the model schema version is not supported
+ * @retval -EINVAL if the tensors could not be allocated
+ */
+int ml_session_open(const struct ml_model *model, struct ml_session **session);
+
+/**
+ * @brief Close a session and free its tensor arena
+ *
+ * @param session Session without any pending inference
+ *
+ * @retval 0 on success
+ * @retval -EBUSY if an inference of the session is pending
+ */
+int ml_session_close(struct ml_session *session);
+
+/**
+ * @brief Get an input tensor of a session
+ *
+ * @param session Open session
+ * @param index Input index
+ * @param tensor Set to the input tensor
+ *
+ * @retval 0 on success
+ * @retval -EINVAL if there is no such input
+ */
+int ml_session_input(struct ml_session *session, size_t index, struct ml_tensor *tensor);
+
+/**
+ * @brief Get an output tensor of a session
+ *
+ * @param session Open session
+ * @param index Output index
+ * @param tensor Set to the output tensor
+ *
+ * @retval 0 on success
+ * @retval -EINVAL if there is no such output
+ */
+int ml_session_output(struct ml_session *session, size_t index, struct ml_tensor *tensor);
+
+/**
+ * @brief Get the part of the tensor arena used by a session
+ *
+ * Allows tuning the arena size of a model.
+ *
+ * @param session Open session
+ *
+ * @return Number of bytes of the arena in use
+ */
+size_t ml_session_arena_used(struct ml_session *session);
+
+/**
+ * @brief Run an inference in the calling thread
+ *
+ * @param session Open session, its inputs filled in
+ *
+ * @retval 0 on success
+ * @retval -EBUSY if an inference of the session is pending
+ * @retval -EIO if the inference failed
+ */
+int ml_infer(struct ml_session *session);
+
+/**
+ * @brief Submit an inference to the service threads
+ *
+ * The request and the inputs of its session must stay untouched until the
+ * completion callback is called.
+ *
+ * @param req Request, its session and callback set
+ *
+ * @retval 0 on success
+ * @retval -EBUSY if an inference of the session is pending
+ */
+int ml_infer_submit(struct ml_infer_req *req);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_ML_INFERENCE_H_ */
@@ -54,11 +54,18 @@ typedef int (*modem_pipe_api_receive)(void *data, uint8_t *buf, size_t size);
 
 typedef int (*modem_pipe_api_close)(void *data);
 
+typedef int (*modem_pipe_api_receive_claim)(void *data, uint8_t **buf);
+
+typedef int (*modem_pipe_api_receive_finish)(void *data, size_t size);
+
 struct modem_pipe_api {
 	modem_pipe_api_open open;
 	modem_pipe_api_transmit transmit;
 	modem_pipe_api_receive receive;
 	modem_pipe_api_close close;
+	/* Optional, used to process received data in place */
+	modem_pipe_api_receive_claim receive_claim;
+	modem_pipe_api_receive_finish receive_finish;
 };
 
 enum modem_pipe_state {
@@ -154,6 +161,38 @@ int modem_pipe_transmit(struct modem_pipe *pipe, const uint8_t *buf, size_t size
  */
 int modem_pipe_receive(struct modem_pipe *pipe, uint8_t *buf, size_t size);
 
+/**
+ * @brief Claim received data in place
+ *
+ * @details Gives access to received data stored in the buffer of the pipe
+ * implementation, avoiding copying it to a buffer of the caller. The claimed
+ * data stays valid until released with modem_pipe_receive_finish(), which
+ * must be called before the data is claimed again.
+ *
+ * @param pipe Pipe to receive from
+ * @param buf Set to point to the received data
+ *
+ * @return Number of contiguous bytes received from pipe if any
+ * @return -ENOTSUP if not supported by the pipe, use modem_pipe_receive()
+ * @return -EPERM if pipe is closed
+ * @return -errno code on error
+ *
+ * @warning This call must be non-blocking
+ */
+int modem_pipe_receive_claim(struct modem_pipe *pipe, uint8_t **buf);
+
+/**
+ * @brief Release received data claimed with modem_pipe_receive_claim()
+ *
+ * @param pipe Pipe to release data of
+ * @param size Number of claimed bytes which have been processed
+ *
+ * @return 0 if successful
+ * @return -ENOTSUP if not supported by the pipe
+ * @return -errno code on error
+ */
+int modem_pipe_receive_finish(struct modem_pipe *pipe, size_t size);
+
 /**
  * @brief Clear callback
  *
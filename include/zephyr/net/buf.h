@@ -968,6 +968,14 @@ struct net_buf_data_alloc {
 	size_t max_alloc_size;
 };
 
+/** @cond INTERNAL_HIDDEN */
+struct net_buf_pool_cache {
+	struct k_spinlock lock;
+	sys_slist_t list;
+	uint16_t count;
+};
+/** @endcond */
+
 /**
  * @brief Network buffer pool representation.
  *
@@ -1008,6 +1016,14 @@ struct net_buf_pool {
 
 	/** Start of buffer storage array */
 	struct net_buf * const __bufs;
+
+#if defined(CONFIG_NET_BUF_POOL_CACHE)
+	/** Per-CPU caches of free buffers, used by fixed size pools */
+	struct net_buf_pool_cache cache[CONFIG_MP_MAX_NUM_CPUS];
+
+	/** Number of allocations waiting for a buffer of the LIFO */
+	atomic_t cache_waiters;
+#endif /* CONFIG_NET_BUF_POOL_CACHE */
 };
 
 /** @cond INTERNAL_HIDDEN */
@@ -1301,6 +1317,29 @@ struct net_buf * __must_check net_buf_alloc_len(struct net_buf_pool *pool,
  *
  * @return New buffer or NULL if out of buffers.
  */
+/**
+ * @brief Allocate a chain of buffers from a pool.
+ *
+ * Allocate as many buffers as needed to hold @p len bytes and link them
+ * as fragments of the first one. The buffers are taken from the pool in
+ * bulk where possible, which is cheaper than allocating them one by one.
+ * Buffers of pools without a maximum allocation size get @p len bytes in
+ * a single buffer.
+ *
+ * @param pool Which pool to allocate the buffers from.
+ * @param len Amount of data the chain must be able to fit.
+ * @param timeout Affects the action taken should the pool be empty.
+ *        If K_NO_WAIT, then return immediately. If K_FOREVER, then
+ *        wait as long as necessary. Otherwise, wait until the specified
+ *        timeout, which applies to the whole chain.
+ *
+ * @return First buffer of the chain or NULL if out of buffers, in which
+ *         case no buffer is kept allocated.
+ */
+struct net_buf * __must_check net_buf_alloc_chain(struct net_buf_pool *pool,
+						  size_t len,
+						  k_timeout_t timeout);
+
 #if defined(CONFIG_NET_BUF_LOG)
 struct net_buf * __must_check net_buf_alloc_with_data_debug(struct net_buf_pool *pool,
 							    void *data, size_t size,
@@ -1339,6 +1378,10 @@ struct net_buf * __must_check net_buf_get(struct k_fifo *fifo,
 					  k_timeout_t timeout);
 #endif
 
+/** @cond INTERNAL_HIDDEN */
+bool net_buf_pool_cache_put(struct net_buf_pool *pool, struct net_buf *buf);
+/** @endcond */
+
 /**
  * @brief Destroy buffer from custom destroy callback
  *
@@ -1359,6 +1402,12 @@ static inline void net_buf_destroy(struct net_buf *buf)
 		buf->__buf = NULL;
 	}
 
+#if defined(CONFIG_NET_BUF_POOL_CACHE)
+	if (net_buf_pool_cache_put(pool, buf)) {
+		return;
+	}
+#endif
+
 	k_lifo_put(&pool->free, buf);
 }
 
@@ -1430,6 +1479,17 @@ void net_buf_unref_debug(struct net_buf *buf, const char *func, int line);
 void net_buf_unref(struct net_buf *buf);
 #endif
 
+/**
+ * @brief Decrements the reference count of a chain of buffers.
+ *
+ * Same as net_buf_unref(), but the buffers released from the same pool
+ * without a custom destroy callback are put back into the pool together,
+ * which makes freeing long fragment chains cheaper.
+ *
+ * @param buf A valid pointer on the first buffer of the chain
+ */
+void net_buf_unref_chain(struct net_buf *buf);
+
 /**
  * @brief Increment the reference count of a buffer.
  *
@@ -166,8 +166,146 @@ static inline int net_capture_disable(const struct device *dev)
 #endif
 }
 
+/**
+ * @brief Statistics of the capture ring
+ */
+struct net_capture_ring_stats {
+	/** Number of packets stored in the ring */
+	uint32_t captured;
+	/** Number of packets lost because the ring was full */
+	uint32_t dropped;
+	/** Number of bytes stored in the ring, pcapng framing included */
+	uint32_t bytes;
+};
+
+/**
+ * @brief Start capturing the packets of a network interface into the
+ *        capture ring.
+ *
+ * @details Instead of being cloned and sent through the IPIP tunnel, the
+ * first @a snaplen bytes of every packet are copied with a timestamp into
+ * a preallocated ring buffer, as pcapng Enhanced Packet Blocks. The ring
+ * never waits for its consumer; when it is full, packets are counted as
+ * dropped. Each call writes a new pcapng Section Header and Interface
+ * Description Block first, so the data read from the ring is always a
+ * valid pcapng stream.
+ *
+ * @param iface Network interface to capture.
+ * @param snaplen Maximum number of bytes stored per packet, 0 selects
+ *        CONFIG_NET_CAPTURE_RING_SNAPLEN.
+ *
+ * @return 0 if ok, -EALREADY if the ring capture is already enabled,
+ *         -ENOMEM if there is no room for the pcapng headers,
+ *         <0 on other errors.
+ */
+#if defined(CONFIG_NET_CAPTURE_RING)
+int net_capture_ring_enable(struct net_if *iface, uint32_t snaplen);
+#else
+static inline int net_capture_ring_enable(struct net_if *iface, uint32_t snaplen)
+{
+	ARG_UNUSED(iface);
+	ARG_UNUSED(snaplen);
+
+	return -ENOTSUP;
+}
+#endif
+
+/**
+ * @brief Stop capturing packets into the capture ring.
+ *
+ * @details The data already in the ring can still be read.
+ *
+ * @return 0 if ok, -EALREADY if the ring capture was not enabled.
+ */
+#if defined(CONFIG_NET_CAPTURE_RING)
+int net_capture_ring_disable(void);
+#else
+static inline int net_capture_ring_disable(void)
+{
+	return -ENOTSUP;
+}
+#endif
+
+/**
+ * @brief Get the network interface captured into the ring.
+ *
+ * @return Network interface, NULL if the ring capture is disabled.
+ */
+#if defined(CONFIG_NET_CAPTURE_RING)
+struct net_if *net_capture_ring_iface(void);
+#else
+static inline struct net_if *net_capture_ring_iface(void)
+{
+	return NULL;
+}
+#endif
+
+/**
+ * @brief Get a pointer to the captured data in the ring.
+ *
+ * @details The data is read in place, and stays valid until it is released
+ * with net_capture_ring_finish(). The ring has a single consumer; this must
+ * not be used when CONFIG_NET_CAPTURE_RING_UART drains the ring.
+ *
+ * @param data Pointer to the captured data, set by the call.
+ * @param size Maximum number of bytes wanted.
+ * @param timeout How long to wait for data when the ring is empty.
+ *
+ * @return Number of contiguous bytes at @a data, 0 on timeout.
+ */
+#if defined(CONFIG_NET_CAPTURE_RING)
+uint32_t net_capture_ring_claim(uint8_t **data, uint32_t size,
+				k_timeout_t timeout);
+#else
+static inline uint32_t net_capture_ring_claim(uint8_t **data, uint32_t size,
+					      k_timeout_t timeout)
+{
+	ARG_UNUSED(data);
+	ARG_UNUSED(size);
+	ARG_UNUSED(timeout);
+
+	return 0U;
+}
+#endif
+
+/**
+ * @brief Release data read with net_capture_ring_claim().
+ *
+ * @param size Number of bytes consumed.
+ *
+ * @return 0 if ok, -EINVAL if @a size exceeds the claimed data.
+ */
+#if defined(CONFIG_NET_CAPTURE_RING)
+int net_capture_ring_finish(uint32_t size);
+#else
+static inline int net_capture_ring_finish(uint32_t size)
+{
+	ARG_UNUSED(size);
+
+	return -ENOTSUP;
+}
+#endif
+
+/**
+ * @brief Get the statistics of the capture ring.
+ *
+ * @param stats Statistics, filled by the call.
+ */
+#if defined(CONFIG_NET_CAPTURE_RING)
+void net_capture_ring_stats_get(struct net_capture_ring_stats *stats);
+#else
+static inline void net_capture_ring_stats_get(struct net_capture_ring_stats *stats)
+{
+	*stats = (struct net_capture_ring_stats){ 0 };
+}
+#endif
+
 /** @cond INTERNAL_HIDDEN */
 
+#if defined(CONFIG_NET_CAPTURE_RING)
+void net_capture_ring_pkt(struct net_if *iface, struct net_pkt *pkt);
+#endif
+
 /**
  * @brief Send captured packet.
  *
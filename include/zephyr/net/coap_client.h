@@ -78,6 +78,17 @@ struct coap_client_option {
 };
 
 /** @cond INTERNAL_HIDDEN */
+#if defined(CONFIG_COAP_CLIENT_BLOCK2_PREFETCH)
+struct coap_client_block2_request {
+	uint8_t token[COAP_TOKEN_MAX_LEN];
+	uint16_t id;
+	bool ongoing;
+	bool answered;
+	size_t current;
+	struct coap_pending pending;
+};
+#endif
+
 struct coap_client_internal_request {
 	uint8_t request_token[COAP_TOKEN_MAX_LEN];
 	uint32_t offset;
@@ -90,6 +101,9 @@ struct coap_client_internal_request {
 	struct coap_client_request coap_request;
 	struct coap_packet request;
 	uint8_t request_tag[COAP_TOKEN_MAX_LEN];
+#if defined(CONFIG_COAP_CLIENT_BLOCK2_PREFETCH)
+	struct coap_client_block2_request prefetch[CONFIG_COAP_CLIENT_BLOCK2_WINDOW];
+#endif
 };
 
 struct coap_client {
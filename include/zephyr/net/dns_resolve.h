@@ -240,6 +240,19 @@ struct dns_resolve_context {
 		 * cannot be used to find correct pending query.
 		 */
 		uint16_t query_hash;
+
+#if defined(CONFIG_DNS_RESOLVER_CACHE)
+		/** Addresses received so far, stored in the answer cache
+		 * once the query completes.
+		 */
+		struct dns_addrinfo cache_info[CONFIG_DNS_RESOLVER_AI_MAX_ENTRIES];
+
+		/** Number of valid entries in cache_info */
+		uint8_t cache_count;
+
+		/** Smallest TTL of the answer records, including CNAMEs */
+		uint32_t cache_ttl;
+#endif /* CONFIG_DNS_RESOLVER_CACHE */
 	} queries[CONFIG_DNS_NUM_CONCUR_QUERIES];
 
 	/** Is this context in use */
@@ -455,6 +468,80 @@ static inline int dns_cancel_addr_info(uint16_t dns_id)
 	return dns_resolve_cancel(dns_resolve_get_default(), dns_id);
 }
 
+/**
+ * DNS answer cache entry, passed to dns_resolve_cache_foreach() callback.
+ */
+struct dns_resolve_cache_entry {
+	/** Queried name */
+	const char *name;
+
+	/** Query type */
+	enum dns_query_type type;
+
+	/** DNS_EAI_ALLDONE for a positive answer, DNS_EAI_NODATA for
+	 * a cached negative answer.
+	 */
+	enum dns_resolve_status status;
+
+	/** Cached addresses, valid for a positive answer */
+	const struct dns_addrinfo *info;
+
+	/** Number of cached addresses */
+	int count;
+
+	/** Remaining time to live in seconds */
+	uint32_t ttl;
+};
+
+/**
+ * DNS answer cache statistics.
+ */
+struct dns_resolve_cache_stats {
+	/** Queries answered with cached addresses */
+	uint32_t hits;
+
+	/** Queries answered with a cached negative answer */
+	uint32_t negative_hits;
+
+	/** Queries not found in the cache */
+	uint32_t misses;
+
+	/** Valid entries replaced to make room for a new answer */
+	uint32_t evictions;
+};
+
+/**
+ * @typedef dns_resolve_cache_cb_t
+ * @brief Callback used while iterating over the DNS answer cache.
+ *
+ * @param entry Cache entry, only valid during the callback.
+ * @param user_data A valid pointer to user data or NULL
+ */
+typedef void (*dns_resolve_cache_cb_t)(const struct dns_resolve_cache_entry *entry,
+				       void *user_data);
+
+#if defined(CONFIG_DNS_RESOLVER_CACHE) || defined(__DOXYGEN__)
+/**
+ * @brief Go through all the valid entries of the DNS answer cache.
+ *
+ * @param cb User-supplied callback function to call
+ * @param user_data User specified data
+ */
+void dns_resolve_cache_foreach(dns_resolve_cache_cb_t cb, void *user_data);
+
+/**
+ * @brief Remove all entries from the DNS answer cache.
+ */
+void dns_resolve_cache_flush(void);
+
+/**
+ * @brief Get the DNS answer cache statistics.
+ *
+ * @param stats Statistics are copied here.
+ */
+void dns_resolve_cache_stats_get(struct dns_resolve_cache_stats *stats);
+#endif /* CONFIG_DNS_RESOLVER_CACHE */
+
 /**
  * @}
  */
@@ -182,6 +182,16 @@ enum ethernet_hw_caps {
 
 	/** TX-Injection supported */
 	ETHERNET_TXINJECTION_MODE	= BIT(20),
+
+	/** TCP segmentation offload supported for IPv4 and IPv6. Packets with
+	 *  a non-zero net_pkt_tso_mss() carry a TCP payload larger than the
+	 *  MTU, which the driver splits in segments of that size, updating
+	 *  the headers and computing the checksums of each segment.
+	 */
+	ETHERNET_HW_TSO			= BIT(21),
+
+	/** RX interrupt coalescing supported, see struct ethernet_rx_coalesce */
+	ETHERNET_RX_COALESCE		= BIT(22),
 };
 
 /** @cond INTERNAL_HIDDEN */
@@ -201,6 +211,7 @@ enum ethernet_config_type {
 	ETHERNET_CONFIG_TYPE_PORTS_NUM,
 	ETHERNET_CONFIG_TYPE_T1S_PARAM,
 	ETHERNET_CONFIG_TYPE_TXINJECTION_MODE,
+	ETHERNET_CONFIG_TYPE_RX_COALESCE,
 };
 
 enum ethernet_qav_param_type {
@@ -440,6 +451,21 @@ struct ethernet_txtime_param {
 	bool enable_txtime;
 };
 
+/** RX interrupt coalescing parameters */
+struct ethernet_rx_coalesce {
+	/** Time in microseconds the RX interrupt is kept masked after the
+	 *  ring was drained, 0 re-enables it immediately. With adaptive
+	 *  coalescing this is the upper bound of the delay.
+	 */
+	uint32_t usecs;
+	/** Maximum number of frames processed in one poll before the
+	 *  driver yields, 0 selects the driver default.
+	 */
+	uint32_t frames;
+	/** Scale the delay with the observed RX rate */
+	bool adaptive;
+};
+
 /** @cond INTERNAL_HIDDEN */
 struct ethernet_config {
 	union {
@@ -461,6 +487,7 @@ struct ethernet_config {
 		struct ethernet_qbv_param qbv_param;
 		struct ethernet_qbu_param qbu_param;
 		struct ethernet_txtime_param txtime_param;
+		struct ethernet_rx_coalesce rx_coalesce;
 
 		int priority_queues_num;
 		int ports_num;
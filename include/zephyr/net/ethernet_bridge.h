@@ -29,12 +29,50 @@ extern "C" {
  * @{
  */
 
+/**
+ * @brief Bridge statistics
+ */
+struct eth_bridge_stats {
+	/** Frames received from the bridged interfaces */
+	uint32_t rx;
+	/** Frames sent to the single port found in the forwarding database */
+	uint32_t forwarded;
+	/** Frames sent to all the ports, for unknown or group destinations */
+	uint32_t flooded;
+	/** Frames dropped as their destination is on the incoming port */
+	uint32_t filtered;
+	/** Frames dropped, e.g. link-local ones or on allocation failure */
+	uint32_t dropped;
+	/** Addresses added to the forwarding database */
+	uint32_t learned;
+	/** Addresses removed from the forwarding database as they aged out
+	 *  or to make room for a new one.
+	 */
+	uint32_t aged;
+};
+
 /** @cond INTERNAL_HIDDEN */
 
+struct ethernet_context;
+struct net_eth_addr;
+
+struct eth_bridge_fdb_entry {
+	sys_snode_t node;
+	uint8_t addr[6];
+	struct ethernet_context *port;
+	uint32_t last_seen;
+};
+
 struct eth_bridge {
 	struct k_mutex lock;
 	sys_slist_t interfaces;
 	sys_slist_t listeners;
+	struct eth_bridge_stats stats;
+#if defined(CONFIG_NET_ETHERNET_BRIDGE_FDB)
+	sys_slist_t fdb_free;
+	sys_slist_t fdb[CONFIG_NET_ETHERNET_BRIDGE_FDB_SIZE];
+	struct eth_bridge_fdb_entry fdb_entries[CONFIG_NET_ETHERNET_BRIDGE_FDB_SIZE];
+#endif
 	bool initialized;
 };
 
@@ -180,6 +218,51 @@ typedef void (*eth_bridge_cb_t)(struct eth_bridge *br, void *user_data);
  */
 void net_eth_bridge_foreach(eth_bridge_cb_t cb, void *user_data);
 
+/**
+ * @brief Get bridge statistics
+ *
+ * @param br A pointer to an initialized bridge object
+ * @param stats Statistics are copied here
+ */
+void eth_bridge_stats_get(struct eth_bridge *br, struct eth_bridge_stats *stats);
+
+/**
+ * @typedef eth_bridge_fdb_cb_t
+ * @brief Callback used while iterating over the forwarding database
+ *
+ * @param br Pointer to bridge instance
+ * @param addr Learned MAC address
+ * @param iface Interface the address was last seen on
+ * @param age Time in milliseconds since the address was last seen
+ * @param user_data User supplied data
+ */
+typedef void (*eth_bridge_fdb_cb_t)(struct eth_bridge *br,
+				    const struct net_eth_addr *addr,
+				    struct net_if *iface, uint32_t age,
+				    void *user_data);
+
+/**
+ * @brief Go through the forwarding database of a bridge
+ *
+ * The bridge lock is held while the callback is called.
+ *
+ * @param br A pointer to an initialized bridge object
+ * @param cb Callback to call for each learned address
+ * @param user_data User supplied data
+ */
+void eth_bridge_fdb_foreach(struct eth_bridge *br, eth_bridge_fdb_cb_t cb,
+			    void *user_data);
+
+/**
+ * @brief Remove all the learned addresses of a bridge
+ *
+ * Frames are flooded to all the ports until the addresses are learned
+ * again.
+ *
+ * @param br A pointer to an initialized bridge object
+ */
+void eth_bridge_fdb_flush(struct eth_bridge *br);
+
 /**
  * @}
  */
@@ -54,6 +54,8 @@ enum net_request_ethernet_cmd {
 	NET_REQUEST_ETHERNET_CMD_SET_T1S_PARAM,
 	NET_REQUEST_ETHERNET_CMD_SET_TXINJECTION_MODE,
 	NET_REQUEST_ETHERNET_CMD_GET_TXINJECTION_MODE,
+	NET_REQUEST_ETHERNET_CMD_SET_RX_COALESCE,
+	NET_REQUEST_ETHERNET_CMD_GET_RX_COALESCE,
 };
 
 #define NET_REQUEST_ETHERNET_SET_AUTO_NEGOTIATION			\
@@ -146,11 +148,22 @@ NET_MGMT_DEFINE_REQUEST_HANDLER(NET_REQUEST_ETHERNET_SET_TXINJECTION_MODE);
 
 NET_MGMT_DEFINE_REQUEST_HANDLER(NET_REQUEST_ETHERNET_GET_TXINJECTION_MODE);
 
+#define NET_REQUEST_ETHERNET_SET_RX_COALESCE				\
+	(_NET_ETHERNET_BASE | NET_REQUEST_ETHERNET_CMD_SET_RX_COALESCE)
+
+NET_MGMT_DEFINE_REQUEST_HANDLER(NET_REQUEST_ETHERNET_SET_RX_COALESCE);
+
+#define NET_REQUEST_ETHERNET_GET_RX_COALESCE				\
+	(_NET_ETHERNET_BASE | NET_REQUEST_ETHERNET_CMD_GET_RX_COALESCE)
+
+NET_MGMT_DEFINE_REQUEST_HANDLER(NET_REQUEST_ETHERNET_GET_RX_COALESCE);
+
 struct net_eth_addr;
 struct ethernet_qav_param;
 struct ethernet_qbv_param;
 struct ethernet_qbu_param;
 struct ethernet_txtime_param;
+struct ethernet_rx_coalesce;
 
 struct ethernet_req_params {
 	union {
@@ -172,6 +185,7 @@ struct ethernet_req_params {
 		struct ethernet_qbu_param qbu_param;
 		struct ethernet_txtime_param txtime_param;
 		struct ethernet_t1s_param t1s_param;
+		struct ethernet_rx_coalesce rx_coalesce;
 
 		int priority_queues_num;
 		int ports_num;
@@ -22,6 +22,7 @@
 
 #include <zephyr/kernel.h>
 #include <zephyr/net/net_ip.h>
+#include <zephyr/net/tls_credentials.h>
 #include <zephyr/net/http/parser.h>
 
 #ifdef __cplusplus
@@ -215,6 +216,14 @@ struct http_client_internal_data {
 
 	/** HTTP socket */
 	int sock;
+
+	/** Data received after the end of the response, i.e. the beginning
+	 * of the next response of a pipeline. Points into recv_buf.
+	 */
+	uint8_t *next_data;
+
+	/** Length of the data in next_data */
+	size_t next_len;
 };
 
 /**
@@ -304,6 +313,14 @@ struct http_request {
 	 * headers will be placed into this field.
 	 */
 	const char **optional_headers;
+
+	/** Call the response callback with HTTP_DATA_MORE as soon as any
+	 * data is received, instead of only when recv_buf is full. This
+	 * lets the application process the body while it is being
+	 * received, recv_buf then only holds the most recently received
+	 * data.
+	 */
+	bool stream_response;
 };
 
 /**
@@ -324,6 +341,98 @@ struct http_request {
 int http_client_req(int sock, struct http_request *req,
 		    int32_t timeout, void *user_data);
 
+/**
+ * @brief Do several HTTP requests over one connection without waiting for
+ * the responses in between (HTTP/1.1 pipelining). All the requests are sent
+ * first, then the responses are given to the callbacks of the requests in
+ * order. The server must support persistent connections, and the requests
+ * should be idempotent, as the responses to the last requests are lost if
+ * the server closes the connection early.
+ *
+ * The requests may share one receive buffer. As the beginning of the next
+ * response may be received together with the end of the previous one, the
+ * response callback must not modify the receive buffer.
+ *
+ * @param sock Socket id of the connection.
+ * @param reqs Array of HTTP requests
+ * @param count Number of requests in the array
+ * @param timeout Max timeout to wait for each of the responses, in
+ *        milliseconds.
+ * @param user_data User specified data that is passed to the callbacks.
+ *
+ * @return <0 if error, >=0 amount of data sent to the server
+ */
+int http_client_req_pipeline(int sock, struct http_request **reqs,
+			     size_t count, int32_t timeout, void *user_data);
+
+/**
+ * Server of a pooled HTTP connection.
+ */
+struct http_client_endpoint {
+	/** Host name or address of the server */
+	const char *host;
+
+	/** Port of the server, "80" or "443" if NULL */
+	const char *port;
+
+	/** Protocol of the connection, IPPROTO_TCP for HTTP or one of the
+	 * IPPROTO_TLS_* values for HTTPS.
+	 */
+	int proto;
+
+	/** TLS credentials of the connection, only used with TLS */
+	const sec_tag_t *sec_tag_list;
+
+	/** Number of entries in sec_tag_list */
+	size_t sec_tag_count;
+};
+
+/**
+ * @brief Get a connection to a server from the connection pool.
+ *
+ * An idle connection to the same host, port and protocol is returned if
+ * there is one, otherwise a new connection is created.
+ * The connection must be returned with http_client_pool_put().
+ *
+ * @param ep Server to connect to.
+ *
+ * @return Socket id of the connection, <0 if error.
+ */
+int http_client_pool_get(const struct http_client_endpoint *ep);
+
+/**
+ * @brief Return a connection to the connection pool.
+ *
+ * @param sock Socket id returned by http_client_pool_get().
+ * @param reuse True if the connection can be used for another request,
+ *        false to close it.
+ */
+void http_client_pool_put(int sock, bool reuse);
+
+/**
+ * @brief Do a HTTP request over a pooled connection.
+ *
+ * Same as http_client_req(), but the connection is taken from the pool and
+ * given back once the response is received, so that the next request to the
+ * same server does not need to set up a new TCP and TLS connection.
+ * The connection is closed if the server does not keep it alive.
+ *
+ * @param ep Server of the request.
+ * @param req HTTP request information
+ * @param timeout Max timeout to wait for the data, in milliseconds.
+ * @param user_data User specified data that is passed to the callback.
+ *
+ * @return <0 if error, >=0 amount of data sent to the server
+ */
+int http_client_pool_req(const struct http_client_endpoint *ep,
+			 struct http_request *req, int32_t timeout,
+			 void *user_data);
+
+/**
+ * @brief Close all the idle connections of the connection pool.
+ */
+void http_client_pool_flush(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,205 @@
+/** @file
+ * @brief HTTP server API
+ *
+ * An API for applications to serve HTTP resources
+ */
+
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_NET_HTTP_SERVER_H_
+#define ZEPHYR_INCLUDE_NET_HTTP_SERVER_H_
+
+/**
+ * @brief HTTP server API
+ * @defgroup http_server HTTP server API
+ * @ingroup networking
+ * @{
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include <zephyr/sys/util.h>
+#include <zephyr/net/http/method.h>
+#include <zephyr/net/http/service.h>
+#include <zephyr/net/http/status.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Type of an HTTP resource */
+enum http_resource_type {
+	/** Constant data, for example a file stored in flash */
+	HTTP_RESOURCE_TYPE_STATIC,
+	/** Data handled and generated by an application callback */
+	HTTP_RESOURCE_TYPE_DYNAMIC,
+};
+
+/**
+ * Common part of the detail of an HTTP resource, the @p _detail of
+ * HTTP_RESOURCE_DEFINE() points to one of the http_resource_detail_*
+ * structures starting with this one.
+ */
+struct http_resource_detail {
+	/** Bitmask of the methods the resource supports, BIT(HTTP_GET) etc. */
+	uint32_t bitmask_of_supported_http_methods;
+
+	/** Type of the resource */
+	enum http_resource_type type;
+
+	/** Value of the Content-Type header of the response, may be NULL */
+	const char *content_type;
+
+	/** Value of the Content-Encoding header of the response, may be
+	 * NULL. Setting this to "gzip" allows serving pre-compressed data.
+	 */
+	const char *content_encoding;
+};
+
+/**
+ * Detail of a static resource. The data is sent directly from where it is
+ * stored, so it can be placed in flash or in XIP memory without being
+ * copied to RAM.
+ */
+struct http_resource_detail_static {
+	/** Common resource detail */
+	struct http_resource_detail common;
+
+	/** Content of the resource */
+	const void *static_data;
+
+	/** Length of the content */
+	size_t static_data_len;
+};
+
+/** Status of the request data given to a dynamic resource callback */
+enum http_data_status {
+	/** The connection was closed before the request was received */
+	HTTP_SERVER_DATA_ABORTED = -1,
+	/** More request data is to come */
+	HTTP_SERVER_DATA_MORE = 0,
+	/** The request has been received, the response should be sent */
+	HTTP_SERVER_DATA_FINAL = 1,
+};
+
+struct http_client_ctx;
+
+/**
+ * @typedef http_resource_dynamic_cb_t
+ * @brief Callback of a dynamic resource.
+ *
+ * The callback is called with the body of the request as it is received,
+ * and finally with the status HTTP_SERVER_DATA_FINAL. The response is sent
+ * with http_server_send_response() or with http_server_send_chunk(), at the
+ * latest from the final call.
+ *
+ * @param client Client connection of the request.
+ * @param status Status of the request data.
+ * @param data Part of the request body, valid during the call only.
+ * @param len Length of the data.
+ * @param user_data User data of the resource.
+ *
+ * @return 0 if ok, <0 to reply with 500 Internal Server Error if no
+ *         response was sent yet.
+ */
+typedef int (*http_resource_dynamic_cb_t)(struct http_client_ctx *client,
+					  enum http_data_status status,
+					  const uint8_t *data, size_t len,
+					  void *user_data);
+
+/** Detail of a dynamic resource */
+struct http_resource_detail_dynamic {
+	/** Common resource detail */
+	struct http_resource_detail common;
+
+	/** Callback handling the requests */
+	http_resource_dynamic_cb_t cb;
+
+	/** User data given to the callback */
+	void *user_data;
+};
+
+/**
+ * @brief Start the HTTP server.
+ *
+ * Start listening on the ports of all the services defined with
+ * HTTP_SERVICE_DEFINE() or HTTP_SERVICE_DEFINE_EMPTY(). The @p _detail of
+ * each of their resources must point to an http_resource_detail_static or
+ * an http_resource_detail_dynamic structure.
+ *
+ * @return 0 if ok, <0 if error.
+ */
+int http_server_start(void);
+
+/**
+ * @brief Stop the HTTP server and close all the connections.
+ *
+ * @return 0 if ok, <0 if error.
+ */
+int http_server_stop(void);
+
+/**
+ * @brief Get the method of the request being handled.
+ *
+ * @param client Client connection of the request.
+ *
+ * @return Method of the request.
+ */
+enum http_method http_server_get_method(const struct http_client_ctx *client);
+
+/**
+ * @brief Get the URL of the request being handled.
+ *
+ * @param client Client connection of the request.
+ *
+ * @return URL of the request, including the query string if any.
+ */
+const char *http_server_get_url(const struct http_client_ctx *client);
+
+/**
+ * @brief Send a complete response to a request.
+ *
+ * @param client Client connection of the request.
+ * @param status HTTP status code of the response.
+ * @param content_type Value of the Content-Type header, may be NULL.
+ * @param body Body of the response, may be NULL.
+ * @param len Length of the body.
+ *
+ * @return 0 if ok, <0 if error.
+ */
+int http_server_send_response(struct http_client_ctx *client,
+			      enum http_status status,
+			      const char *content_type, const void *body,
+			      size_t len);
+
+/**
+ * @brief Send a part of a response with chunked transfer encoding.
+ *
+ * The first call sends the header of the response, with status 200 and
+ * the content type of the resource. Sending a zero length part ends the
+ * response; it is ended by the server otherwise when the final call of the
+ * resource callback returns.
+ *
+ * @param client Client connection of the request.
+ * @param data Part of the response body.
+ * @param len Length of the data.
+ *
+ * @return 0 if ok, <0 if error.
+ */
+int http_server_send_chunk(struct http_client_ctx *client, const void *data,
+			   size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* ZEPHYR_INCLUDE_NET_HTTP_SERVER_H_ */
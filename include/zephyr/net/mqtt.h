@@ -450,6 +450,32 @@ struct mqtt_transport {
 #endif
 };
 
+#if defined(CONFIG_MQTT_INFLIGHT)
+/** @brief Internal. Publish message kept until it is acknowledged. */
+struct mqtt_inflight_msg {
+	/** Internal. Encoded message, len bytes from the start offset. */
+	uint8_t buf[CONFIG_MQTT_INFLIGHT_MSG_SIZE];
+
+	/** Internal. Publication order of the message. */
+	uint32_t seq;
+
+	/** Internal. Message id of the message. */
+	uint16_t message_id;
+
+	/** Internal. Length of the encoded message. */
+	uint16_t len;
+
+	/** Internal. Offset of the encoded message in buf. */
+	uint8_t start;
+
+	/** Internal. QoS of the message. */
+	uint8_t qos;
+
+	/** Internal. State of the message in the QoS flow. */
+	uint8_t state;
+};
+#endif
+
 /** @brief MQTT internal state. */
 struct mqtt_internal {
 	/** Internal. Mutex to protect access to the client instance. */
@@ -468,6 +494,17 @@ struct mqtt_internal {
 
 	/** Internal. Remaining payload length to read. */
 	uint32_t remaining_payload;
+
+#if defined(CONFIG_MQTT_INFLIGHT)
+	/** Internal. Publish messages waiting to be sent or acknowledged. */
+	struct mqtt_inflight_msg inflight[CONFIG_MQTT_INFLIGHT_WINDOW];
+
+	/** Internal. Publication order of the next message. */
+	uint32_t inflight_seq;
+
+	/** Internal. Publish messages are batched. */
+	bool batch;
+#endif
 };
 
 /**
@@ -597,6 +634,13 @@ int mqtt_connect(struct mqtt_client *client);
 /**
  * @brief API to publish messages on topics.
  *
+ * @note With @kconfig{CONFIG_MQTT_INFLIGHT}, QoS 1 and QoS 2 messages are
+ *       copied in the in-flight window until they are acknowledged, and
+ *       sent again with the DUP flag when reconnecting to a persistent
+ *       session. -EAGAIN is returned when the window is full, -EMSGSIZE
+ *       when the message does not fit
+ *       @kconfig{CONFIG_MQTT_INFLIGHT_MSG_SIZE}.
+ *
  * @param[in] client Client instance for which the procedure is requested.
  *                   Shall not be NULL.
  * @param[in] param Parameters to be used for the publish message.
@@ -607,6 +651,35 @@ int mqtt_connect(struct mqtt_client *client);
 int mqtt_publish(struct mqtt_client *client,
 		 const struct mqtt_publish_param *param);
 
+/**
+ * @brief API to start batching publish messages.
+ *
+ * @details Requires @kconfig{CONFIG_MQTT_INFLIGHT}. Until
+ *          @ref mqtt_publish_batch_end is called, messages published with
+ *          @ref mqtt_publish are queued in the in-flight window instead of
+ *          being written to the transport one by one. They are then written
+ *          in a single transport send. Messages which do not fit the
+ *          in-flight message size are only allowed with QoS 0; they are
+ *          written right away, after the queued messages.
+ *
+ * @param[in] client Client instance for which the procedure is requested.
+ *                   Shall not be NULL.
+ *
+ * @return 0 or a negative error code (errno.h) indicating reason of failure.
+ */
+int mqtt_publish_batch_begin(struct mqtt_client *client);
+
+/**
+ * @brief API to write the publish messages batched since
+ *        @ref mqtt_publish_batch_begin.
+ *
+ * @param[in] client Client instance for which the procedure is requested.
+ *                   Shall not be NULL.
+ *
+ * @return 0 or a negative error code (errno.h) indicating reason of failure.
+ */
+int mqtt_publish_batch_end(struct mqtt_client *client);
+
 /**
  * @brief API used by client to send acknowledgment on receiving QoS1 publish
  *        message. Should be called on reception of @ref MQTT_EVT_PUBLISH with
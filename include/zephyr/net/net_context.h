@@ -282,6 +282,11 @@ __net_socket struct net_context {
 		/** Mutex used by condition variable */
 		struct k_mutex *lock;
 	} cond;
+
+#if defined(CONFIG_NET_SOCKETS_EPOLL)
+	/** epoll instances this socket has been added to */
+	sys_slist_t epoll_items;
+#endif /* CONFIG_NET_SOCKETS_EPOLL */
 #endif /* CONFIG_NET_SOCKETS */
 
 #if defined(CONFIG_NET_OFFLOAD)
@@ -293,6 +298,24 @@ __net_socket struct net_context {
 	int can_filter_id;
 #endif /* CONFIG_NET_SOCKETS_CAN */
 
+#if defined(CONFIG_NET_PKT_TX_ZEROCOPY)
+	/** Zero-copy send completions */
+	struct {
+		/** Available when a completion has not been read yet */
+		struct k_sem done;
+		/** Identifier of the next zero-copy send */
+		uint32_t next_id;
+		/** First identifier not reported to the application */
+		uint32_t report_id;
+		/** First identifier not completed */
+		uint32_t done_id;
+		/** Sends after done_id which completed out of order */
+		uint32_t done_map;
+		/** Some of the unreported sends copied the data */
+		bool copied;
+	} zerocopy;
+#endif /* CONFIG_NET_PKT_TX_ZEROCOPY */
+
 	/** Option values */
 	struct {
 #if defined(CONFIG_NET_CONTEXT_PRIORITY)
@@ -1166,6 +1189,11 @@ int net_context_sendto(struct net_context *context,
  * After the network buffer is sent, a caller-supplied callback is called.
  * Note that the callback might be called after this function has returned.
  *
+ * If CONFIG_NET_PKT_TX_ZEROCOPY is enabled and ZSOCK_MSG_ZEROCOPY is set
+ * in @a flags, the data of an UDP context is sent without copying it. The
+ * caller must then keep the iovec data unchanged until the send is
+ * reported by net_context_get_zerocopy_done().
+ *
  * @param context The network context to use.
  * @param msghdr The data to send
  * @param flags Flags for the sending.
@@ -1182,6 +1210,39 @@ int net_context_sendmsg(struct net_context *context,
 			k_timeout_t timeout,
 			void *user_data);
 
+/**
+ * @brief Get the zero-copy sends completed since the previous call.
+ *
+ * @details Zero-copy sends are numbered from 0, in the order they were
+ * accepted by net_context_sendmsg(). Failed sends do not use a number.
+ * When a range is returned, the data of all the sends in it is no longer
+ * used by the stack.
+ *
+ * @param context The network context to use.
+ * @param lo First completed send
+ * @param hi Last completed send
+ * @param copied Set if the data of some send in the range was copied
+ *
+ * @return 0 if a range was returned, -EAGAIN if no new send completed,
+ *         -ENOTSUP if zero-copy is not supported.
+ */
+#if defined(CONFIG_NET_PKT_TX_ZEROCOPY)
+int net_context_get_zerocopy_done(struct net_context *context,
+				  uint32_t *lo, uint32_t *hi, bool *copied);
+#else
+static inline int net_context_get_zerocopy_done(struct net_context *context,
+						uint32_t *lo, uint32_t *hi,
+						bool *copied)
+{
+	ARG_UNUSED(context);
+	ARG_UNUSED(lo);
+	ARG_UNUSED(hi);
+	ARG_UNUSED(copied);
+
+	return -ENOTSUP;
+}
+#endif
+
 /**
  * @brief Receive network data from a peer specified by context.
  *
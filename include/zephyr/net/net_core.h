@@ -118,6 +118,24 @@ enum net_verdict {
  */
 int net_recv_data(struct net_if *iface, struct net_pkt *pkt);
 
+/**
+ * @brief Called by a network device driver with several hardware RX queues
+ * when a network packet has been received. The packet is handed to the RX
+ * queue given by the driver instead of the one selected by the flow hash,
+ * see @kconfig{CONFIG_NET_RX_RSS}. The driver must use the same queue for all
+ * the packets of a flow, which is the case when the hardware queue is
+ * selected by the flow hash of the controller.
+ *
+ * @param iface Network interface where the packet was received.
+ * @param pkt Network packet data.
+ * @param queue RX queue index. The value is reduced modulo the number of
+ *        RX queues, use a negative value to select the queue from the flow
+ *        hash of the packet.
+ *
+ * @return 0 if ok, <0 if error.
+ */
+int net_recv_data_queue(struct net_if *iface, struct net_pkt *pkt, int queue);
+
 /**
  * @brief Send data to network.
  *
@@ -150,6 +168,13 @@ int net_send_data(struct net_pkt *pkt);
 #define NET_TC_COUNT 0
 #endif /* CONFIG_NET_TC_TX_COUNT && CONFIG_NET_TC_RX_COUNT */
 
+/* Number of RX queues, each with its own set of traffic class threads */
+#if defined(CONFIG_NET_RX_RSS) && NET_TC_RX_COUNT > 0
+#define NET_RX_QUEUES CONFIG_NET_RX_RSS_QUEUES
+#else
+#define NET_RX_QUEUES 1
+#endif
+
 /* @endcond */
 
 /**
@@ -272,6 +272,14 @@ struct net_pkt {
 	uint16_t vlan_tci;
 #endif /* CONFIG_NET_VLAN */
 
+#if defined(CONFIG_NET_TCP_TSO)
+	/* Segment size of a TCP segmentation offload packet, whose payload
+	 * is split in segments of this size by the driver or the L2.
+	 * Zero for regular packets.
+	 */
+	uint16_t tso_mss;
+#endif /* CONFIG_NET_TCP_TSO */
+
 #if defined(NET_PKT_HAS_CONTROL_BLOCK)
 	/* TODO: Evolve this into a union of orthogonal
 	 *       control block declarations if further L2
@@ -488,6 +496,27 @@ static inline void net_pkt_set_tcp_1st_msg(struct net_pkt *pkt, bool is_1st)
 #endif
 }
 
+static inline uint16_t net_pkt_tso_mss(struct net_pkt *pkt)
+{
+#if defined(CONFIG_NET_TCP_TSO)
+	return pkt->tso_mss;
+#else
+	ARG_UNUSED(pkt);
+
+	return 0;
+#endif
+}
+
+static inline void net_pkt_set_tso_mss(struct net_pkt *pkt, uint16_t mss)
+{
+#if defined(CONFIG_NET_TCP_TSO)
+	pkt->tso_mss = mss;
+#else
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(mss);
+#endif
+}
+
 static inline uint8_t net_pkt_eof(struct net_pkt *pkt)
 {
 	return pkt->eof;
@@ -1887,6 +1916,58 @@ struct net_pkt *net_pkt_rx_alloc_with_buffer(struct net_if *iface,
  */
 void net_pkt_append_buffer(struct net_pkt *pkt, struct net_buf *buffer);
 
+/**
+ * @typedef net_pkt_ext_cb_t
+ * @brief Callback called when the stack releases caller owned data
+ *
+ * @param user_data The user data given to net_pkt_append_external()
+ */
+typedef void (*net_pkt_ext_cb_t)(void *user_data);
+
+/**
+ * @brief Append caller owned data to a packet without copying it
+ *
+ * @details The data is referenced by a buffer appended to the packet.
+ *          The stack does not modify the data, but the caller must keep
+ *          it valid and unchanged until @a cb is called, which happens
+ *          when the last reference to the buffer is dropped (the packet
+ *          was sent, or dropped). Empty buffers are trimmed from the
+ *          packet first, and the cursor is left at the end of the
+ *          appended data so nothing can be written after it.
+ *
+ * @param pkt       Network packet where to append the data
+ * @param data      Caller owned data
+ * @param length    Length of the data
+ * @param cb        Callback called once the data is no longer used
+ * @param user_data User data given to the callback
+ * @param timeout   Maximum time to wait for a buffer descriptor
+ *
+ * @return 0 on success, -ENOMEM if no buffer descriptor was available,
+ *         -ENOTSUP if CONFIG_NET_PKT_TX_ZEROCOPY is not enabled. The
+ *         callback is not called on failure.
+ */
+#if defined(CONFIG_NET_PKT_TX_ZEROCOPY)
+int net_pkt_append_external(struct net_pkt *pkt, const void *data,
+			    size_t length, net_pkt_ext_cb_t cb,
+			    void *user_data, k_timeout_t timeout);
+#else
+static inline int net_pkt_append_external(struct net_pkt *pkt,
+					  const void *data, size_t length,
+					  net_pkt_ext_cb_t cb,
+					  void *user_data,
+					  k_timeout_t timeout)
+{
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(data);
+	ARG_UNUSED(length);
+	ARG_UNUSED(cb);
+	ARG_UNUSED(user_data);
+	ARG_UNUSED(timeout);
+
+	return -ENOTSUP;
+}
+#endif
+
 /**
  * @brief Get available buffer space from a pkt
  *
@@ -2156,6 +2237,26 @@ int net_pkt_read_be32(struct net_pkt *pkt, uint32_t *data);
  */
 int net_pkt_write(struct net_pkt *pkt, const void *data, size_t length);
 
+/**
+ * @brief Write data into a net_pkt and add it to an Internet checksum
+ *
+ * @details Same as net_pkt_write() but the data is also added to a 16-bit
+ *          one's complement sum while it is copied, so that the data does
+ *          not need to be read again to compute the checksum.
+ *          The sum is in host byte order and covers the packet data from
+ *          the beginning of the packet, i.e. a byte written at an even
+ *          offset is the most significant byte of a 16-bit word.
+ *
+ * @param pkt    The network packet where to write
+ * @param data   Data to be written
+ * @param length Length of the data to be written
+ * @param sum    Sum to which the written data is added
+ *
+ * @return 0 on success, negative errno code otherwise.
+ */
+int net_pkt_write_chksum(struct net_pkt *pkt, const void *data, size_t length,
+			 uint16_t *sum);
+
 /* Write uint8_t data into a net_pkt. */
 static inline int net_pkt_write_u8(struct net_pkt *pkt, uint8_t data)
 {
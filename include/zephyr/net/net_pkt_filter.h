@@ -543,6 +543,174 @@ extern npf_test_fn_t npf_eth_type_unmatch;
 
 /** @} */
 
+/**
+ * @defgroup npf_bpf_cond Bytecode Filter Conditions
+ * @ingroup net_pkt_filter
+ * @{
+ */
+
+/**
+ * @brief Bytecode filter instruction
+ *
+ * The instruction set is a subset of classic BPF, with the same encoding,
+ * so existing tools can be used to write the programs. Packet offsets are
+ * relative to the first byte of the packet data as seen at the hook, i.e.
+ * the link layer header for the send and receive rule lists, and multi
+ * byte loads are in network byte order.
+ */
+struct npf_bpf_insn {
+	uint16_t code;	/**< operation code */
+	uint8_t jt;	/**< jump offset if the condition is true */
+	uint8_t jf;	/**< jump offset if the condition is false */
+	uint32_t k;	/**< generic field, e.g. constant or packet offset */
+};
+
+/** @cond INTERNAL_HIDDEN */
+
+/* Instruction classes */
+#define NPF_BPF_LD    0x00
+#define NPF_BPF_LDX   0x01
+#define NPF_BPF_ST    0x02
+#define NPF_BPF_STX   0x03
+#define NPF_BPF_ALU   0x04
+#define NPF_BPF_JMP   0x05
+#define NPF_BPF_RET   0x06
+#define NPF_BPF_MISC  0x07
+
+/* Load sizes */
+#define NPF_BPF_W     0x00
+#define NPF_BPF_H     0x08
+#define NPF_BPF_B     0x10
+
+/* Load modes */
+#define NPF_BPF_IMM   0x00
+#define NPF_BPF_ABS   0x20
+#define NPF_BPF_IND   0x40
+#define NPF_BPF_MEM   0x60
+#define NPF_BPF_LEN   0x80
+#define NPF_BPF_MSH   0xa0
+
+/* ALU operations */
+#define NPF_BPF_ADD   0x00
+#define NPF_BPF_SUB   0x10
+#define NPF_BPF_MUL   0x20
+#define NPF_BPF_DIV   0x30
+#define NPF_BPF_OR    0x40
+#define NPF_BPF_AND   0x50
+#define NPF_BPF_LSH   0x60
+#define NPF_BPF_RSH   0x70
+#define NPF_BPF_NEG   0x80
+#define NPF_BPF_MOD   0x90
+#define NPF_BPF_XOR   0xa0
+
+/* Jump operations */
+#define NPF_BPF_JA    0x00
+#define NPF_BPF_JEQ   0x10
+#define NPF_BPF_JGT   0x20
+#define NPF_BPF_JGE   0x30
+#define NPF_BPF_JSET  0x40
+
+/* Operand source, constant or X register */
+#define NPF_BPF_K     0x00
+#define NPF_BPF_X     0x08
+
+/* Return value source */
+#define NPF_BPF_A     0x10
+
+/* Register transfers */
+#define NPF_BPF_TAX   0x00
+#define NPF_BPF_TXA   0x80
+
+/* Number of scratch memory words */
+#define NPF_BPF_MEMWORDS 16
+
+struct npf_test_bpf {
+	struct npf_test test;
+	const struct npf_bpf_insn *prog;
+	size_t len;
+};
+
+extern npf_test_fn_t npf_bpf_match;
+
+/** @endcond */
+
+/** @brief Bytecode filter statement */
+#define NPF_BPF_STMT(_code, _k) \
+	{ .code = (_code), .jt = 0, .jf = 0, .k = (_k) }
+
+/** @brief Bytecode filter conditional jump */
+#define NPF_BPF_JUMP(_code, _k, _jt, _jf) \
+	{ .code = (_code), .jt = (_jt), .jf = (_jf), .k = (_k) }
+
+/**
+ * @brief Run a bytecode filter program over a packet
+ *
+ * Loads outside of the packet and invalid instructions end the program
+ * with a return value of 0.
+ *
+ * @param prog the program
+ * @param len number of instructions in the program
+ * @param pkt the packet to examine
+ * @return the value returned by the program
+ */
+uint32_t npf_bpf_run(const struct npf_bpf_insn *prog, size_t len,
+		     struct net_pkt *pkt);
+
+/**
+ * @brief Check a bytecode filter program
+ *
+ * Programs coming from outside of the firmware should be checked before
+ * they are installed. A valid program only jumps forward, stays within
+ * the scratch memory, does not divide by a zero constant and ends with
+ * a return instruction.
+ *
+ * @param prog the program
+ * @param len number of instructions in the program
+ * @retval 0 if the program is valid
+ * @retval -EINVAL otherwise
+ */
+int npf_bpf_validate(const struct npf_bpf_insn *prog, size_t len);
+
+/**
+ * @brief Statically define a bytecode packet filter condition
+ *
+ * The condition is true if the program returns a non-zero value.
+ * A single program can replace a chain of conditions, and filter on any
+ * packet offset.
+ *
+ * Example, matching UDP over IPv4 packets to port 1900:
+ *
+ * @code{.c}
+ *
+ *     static const struct npf_bpf_insn ssdp_prog[] = {
+ *         NPF_BPF_STMT(NPF_BPF_LD | NPF_BPF_H | NPF_BPF_ABS, 12),
+ *         NPF_BPF_JUMP(NPF_BPF_JMP | NPF_BPF_JEQ | NPF_BPF_K, NET_ETH_PTYPE_IP, 0, 5),
+ *         NPF_BPF_STMT(NPF_BPF_LD | NPF_BPF_B | NPF_BPF_ABS, 23),
+ *         NPF_BPF_JUMP(NPF_BPF_JMP | NPF_BPF_JEQ | NPF_BPF_K, IPPROTO_UDP, 0, 3),
+ *         NPF_BPF_STMT(NPF_BPF_LDX | NPF_BPF_B | NPF_BPF_MSH, 14),
+ *         NPF_BPF_STMT(NPF_BPF_LD | NPF_BPF_H | NPF_BPF_IND, 16),
+ *         NPF_BPF_JUMP(NPF_BPF_JMP | NPF_BPF_JEQ | NPF_BPF_K, 1900, 1, 0),
+ *         NPF_BPF_STMT(NPF_BPF_RET | NPF_BPF_K, 0),
+ *         NPF_BPF_STMT(NPF_BPF_RET | NPF_BPF_K, 1),
+ *     };
+ *
+ *     static NPF_BPF_MATCH(ssdp, ssdp_prog);
+ *     static NPF_RULE(drop_ssdp, NET_DROP, ssdp);
+ *
+ * @endcode
+ *
+ * @param _name Name of the condition
+ * @param _prog Array of <tt>struct npf_bpf_insn</tt> instructions
+ */
+#define NPF_BPF_MATCH(_name, _prog) \
+	struct npf_test_bpf _name = { \
+		.prog = (_prog), \
+		.len = ARRAY_SIZE(_prog), \
+		.test.fn = npf_bpf_match, \
+	}
+
+/** @} */
+
 #ifdef __cplusplus
 }
 #endif
@@ -82,6 +82,14 @@ struct zsock_pollfd {
 #define ZSOCK_MSG_DONTWAIT 0x40
 /** zsock_recv: block until the full amount of data can be returned */
 #define ZSOCK_MSG_WAITALL 0x100
+/** zsock_recvmsg: Read zero-copy send completions instead of data */
+#define ZSOCK_MSG_ERRQUEUE 0x2000
+/** zsock_recvmmsg: only wait for the first message */
+#define ZSOCK_MSG_WAITFORONE 0x10000
+/** zsock_sendmsg: Send the data without copying it, see
+ *  CONFIG_NET_PKT_TX_ZEROCOPY
+ */
+#define ZSOCK_MSG_ZEROCOPY 0x4000000
 /** @} */
 
 /**
@@ -208,6 +216,10 @@ struct zsock_pollfd {
  *  - 2 - DTLS CID will be enabled, and the most recent value set with
  *        TLS_DTLS_CID_VALUE will be sent to the peer. Otherwise, a random value
  *        will be used.
+ *  Once a non-empty CID was sent to the peer, records carrying that CID are
+ *  accepted from any source address, and the peer address is updated after
+ *  such a record was authenticated. This lets the session survive NAT
+ *  rebinding without a new handshake.
  */
 #define TLS_DTLS_CID 14
 /** Read-only socket option to get DTLS CID status.
@@ -240,6 +252,17 @@ struct zsock_pollfd {
  *  will take place in consecutive send()/recv() call.
  */
 #define TLS_DTLS_HANDSHAKE_ON_CONNECT 18
+/** Socket option to control TLS session tickets (RFC 5077) on a socket.
+ *  Accepted values:
+ *  - 0 - Disabled.
+ *  - 1 - Enabled.
+ *  A client requests a ticket from the server and keeps it in the session
+ *  cache, so @ref TLS_SESSION_CACHE has to be enabled as well. A server
+ *  issues tickets and resumes the sessions they carry, without keeping
+ *  any per client state.
+ *  Effective when set before connecting or listening on the socket.
+ */
+#define TLS_SESSION_TICKETS 19
 
 /* Valid values for @ref TLS_PEER_VERIFY option */
 #define TLS_PEER_VERIFY_NONE 0     /**< Peer verification disabled. */
@@ -258,6 +281,10 @@ struct zsock_pollfd {
 #define TLS_SESSION_CACHE_DISABLED 0 /**< Disable TLS session caching. */
 #define TLS_SESSION_CACHE_ENABLED 1 /**< Enable TLS session caching. */
 
+/* Valid values for @ref TLS_SESSION_TICKETS option */
+#define TLS_SESSION_TICKETS_DISABLED 0 /**< Disable TLS session tickets. */
+#define TLS_SESSION_TICKETS_ENABLED 1 /**< Enable TLS session tickets. */
+
 /* Valid values for @ref TLS_DTLS_CID (Connection ID) option */
 #define TLS_DTLS_CID_DISABLED		0 /**< CID is disabled  */
 #define TLS_DTLS_CID_SUPPORTED		1 /**< CID is supported */
@@ -529,6 +556,63 @@ __syscall ssize_t zsock_recvfrom(int sock, void *buf, size_t max_len,
  */
 __syscall ssize_t zsock_recvmsg(int sock, struct msghdr *msg, int flags);
 
+/**
+ * @brief Message header for zsock_sendmmsg() and zsock_recvmmsg()
+ */
+struct mmsghdr {
+	struct msghdr msg_hdr; /**< Message */
+	unsigned int msg_len;  /**< Number of bytes sent or received */
+};
+
+/**
+ * @brief Send multiple messages with a single call
+ *
+ * @details
+ * Each message is sent as with zsock_sendmsg(), and the number of bytes
+ * sent is stored in its @c msg_len field. Sending stops at the first
+ * message which cannot be sent.
+ * This function is also exposed as ``sendmmsg()``
+ * if :kconfig:option:`CONFIG_NET_SOCKETS_POSIX_NAMES` is defined.
+ *
+ * @param sock Socket
+ * @param msgvec Messages to send
+ * @param vlen Number of messages
+ * @param flags Flags, as for zsock_sendmsg()
+ *
+ * @return Number of messages sent. If no message could be sent, -1 is
+ *         returned and errno is set.
+ */
+__syscall int zsock_sendmmsg(int sock, struct mmsghdr *msgvec,
+			     unsigned int vlen, int flags);
+
+/**
+ * @brief Receive multiple messages with a single call
+ *
+ * @details
+ * Each message is received as with zsock_recvmsg(), and the number of
+ * bytes received is stored in its @c msg_len field. The call waits for
+ * the @a vlen messages unless ZSOCK_MSG_DONTWAIT is given, or unless
+ * ZSOCK_MSG_WAITFORONE is given in which case only the first message is
+ * waited for. If @a timeout is given, it limits the whole call and the
+ * messages received so far are returned when it expires. Note that
+ * unlike Linux, the timeout is a timeval like for zsock_select().
+ * This function is also exposed as ``recvmmsg()``
+ * if :kconfig:option:`CONFIG_NET_SOCKETS_POSIX_NAMES` is defined.
+ *
+ * @param sock Socket
+ * @param msgvec Buffers for the received messages
+ * @param vlen Number of messages
+ * @param flags Flags, as for zsock_recvmsg(), and ZSOCK_MSG_WAITFORONE
+ * @param timeout Maximum time to wait, or NULL to wait as set by the
+ *        SO_RCVTIMEO socket option.
+ *
+ * @return Number of messages received. If no message was received, -1 is
+ *         returned and errno is set.
+ */
+__syscall int zsock_recvmmsg(int sock, struct mmsghdr *msgvec,
+			     unsigned int vlen, int flags,
+			     struct zsock_timeval *timeout);
+
 /**
  * @brief Receive data from a connected peer
  *
@@ -950,6 +1034,21 @@ static inline ssize_t recvmsg(int sock, struct msghdr *msg, int flags)
 	return zsock_recvmsg(sock, msg, flags);
 }
 
+/** POSIX wrapper for @ref zsock_sendmmsg */
+static inline int sendmmsg(int sock, struct mmsghdr *msgvec,
+			   unsigned int vlen, int flags)
+{
+	return zsock_sendmmsg(sock, msgvec, vlen, flags);
+}
+
+/** POSIX wrapper for @ref zsock_recvmmsg */
+static inline int recvmmsg(int sock, struct mmsghdr *msgvec,
+			   unsigned int vlen, int flags,
+			   struct zsock_timeval *timeout)
+{
+	return zsock_recvmmsg(sock, msgvec, vlen, flags, timeout);
+}
+
 /** POSIX wrapper for @ref zsock_poll */
 static inline int poll(struct zsock_pollfd *fds, int nfds, int timeout)
 {
@@ -1056,6 +1155,12 @@ static inline char *inet_ntop(sa_family_t family, const void *src, char *dst,
 #define MSG_DONTWAIT ZSOCK_MSG_DONTWAIT
 /** POSIX wrapper for @ref ZSOCK_MSG_WAITALL */
 #define MSG_WAITALL ZSOCK_MSG_WAITALL
+/** POSIX wrapper for @ref ZSOCK_MSG_ERRQUEUE */
+#define MSG_ERRQUEUE ZSOCK_MSG_ERRQUEUE
+/** POSIX wrapper for @ref ZSOCK_MSG_WAITFORONE */
+#define MSG_WAITFORONE ZSOCK_MSG_WAITFORONE
+/** POSIX wrapper for @ref ZSOCK_MSG_ZEROCOPY */
+#define MSG_ZEROCOPY ZSOCK_MSG_ZEROCOPY
 
 /** POSIX wrapper for @ref ZSOCK_SHUT_RD */
 #define SHUT_RD ZSOCK_SHUT_RD
@@ -1192,6 +1297,8 @@ struct ifreq {
 #define TCP_KEEPINTVL 3
 /** Number of keepalives before dropping connection */
 #define TCP_KEEPCNT 4
+/** Congestion control algorithm, by name (e.g. "reno" or "cubic") */
+#define TCP_CONGESTION 5
 
 /** @} */
 
@@ -1224,6 +1331,11 @@ struct in_pktinfo {
 	struct in_addr ipi_addr;     /**< Header Destination address */
 };
 
+/** Ancillary message type of the extended errors read with the
+ *  ZSOCK_MSG_ERRQUEUE flag of recvmsg() on an IPv4 socket.
+ */
+#define IP_RECVERR 11
+
 /** Set IPv4 multicast TTL value. */
 #define IP_MULTICAST_TTL 33
 /** Join IPv4 multicast group. */
@@ -1292,8 +1404,34 @@ struct in6_pktinfo {
 
 /** Set or receive the traffic class value for an outgoing packet. */
 #define IPV6_TCLASS 67
+
+/** Ancillary message type of the extended errors read with the
+ *  ZSOCK_MSG_ERRQUEUE flag of recvmsg() on an IPv6 socket.
+ */
+#define IPV6_RECVERR 25
 /** @} */
 
+/**
+ * @brief Extended error reported by recvmsg() with ZSOCK_MSG_ERRQUEUE.
+ *
+ * For zero-copy send completions, ee_origin is SO_EE_ORIGIN_ZEROCOPY and
+ * the sends from ee_info to ee_data (inclusive) are done.
+ */
+struct sock_extended_err {
+	uint32_t ee_errno;  /**< Error number, 0 for completions */
+	uint8_t  ee_origin; /**< Where the error originated */
+	uint8_t  ee_type;   /**< Type */
+	uint8_t  ee_code;   /**< Code */
+	uint8_t  ee_pad;    /**< Padding */
+	uint32_t ee_info;   /**< Additional information */
+	uint32_t ee_data;   /**< Other data */
+};
+
+/** Origin of zero-copy send completions */
+#define SO_EE_ORIGIN_ZEROCOPY 5
+/** Zero-copy send completion code: the data was copied */
+#define SO_EE_CODE_ZEROCOPY_COPIED 1
+
 /**
  * @name Backlog size for listen()
  * @{
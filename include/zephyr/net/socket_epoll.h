@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_NET_SOCKET_EPOLL_H_
+#define ZEPHYR_INCLUDE_NET_SOCKET_EPOLL_H_
+
+/**
+ * @brief BSD Sockets compatible API
+ * @defgroup bsd_sockets BSD Sockets compatible API
+ * @ingroup networking
+ * @{
+ */
+
+#include <errno.h>
+#include <stdint.h>
+#include <zephyr/toolchain.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/net/socket.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Register a file descriptor in the epoll instance */
+#define ZSOCK_EPOLL_CTL_ADD 1
+/** Remove a file descriptor from the epoll instance */
+#define ZSOCK_EPOLL_CTL_DEL 2
+/** Change the events of a registered file descriptor */
+#define ZSOCK_EPOLL_CTL_MOD 3
+
+/** Close the epoll file descriptor on exec (accepted for compatibility) */
+#define ZSOCK_EPOLL_CLOEXEC 0x80000
+
+/** Data available for reading */
+#define ZSOCK_EPOLLIN ZSOCK_POLLIN
+/** Urgent data available */
+#define ZSOCK_EPOLLPRI ZSOCK_POLLPRI
+/** Writing possible without blocking */
+#define ZSOCK_EPOLLOUT ZSOCK_POLLOUT
+/** Error condition, always reported */
+#define ZSOCK_EPOLLERR ZSOCK_POLLERR
+/** Hang up, always reported */
+#define ZSOCK_EPOLLHUP ZSOCK_POLLHUP
+/** Peer closed the connection */
+#define ZSOCK_EPOLLRDHUP 0x2000
+/** Disable the file descriptor after one event has been reported */
+#define ZSOCK_EPOLLONESHOT BIT(30)
+/** Report only changes of the readiness state */
+#define ZSOCK_EPOLLET BIT(31)
+
+/** User data associated with a registered file descriptor */
+typedef union zsock_epoll_data {
+	void *ptr;
+	int fd;
+	uint32_t u32;
+	uint64_t u64;
+} zsock_epoll_data_t;
+
+/** Event registered with, and reported by, an epoll instance */
+struct zsock_epoll_event {
+	uint32_t events;         /**< Event mask */
+	zsock_epoll_data_t data; /**< User data */
+};
+
+/**
+ * @brief Create an epoll instance
+ *
+ * @details
+ * @rst
+ * See `Linux man page <https://man7.org/linux/man-pages/man2/epoll_create.2.html>`__
+ * for normative description. The returned file descriptor is released with
+ * zsock_close(), and it can itself be monitored with zsock_poll().
+ * This function is also exposed as ``epoll_create1()``
+ * if :kconfig:option:`CONFIG_NET_SOCKETS_POSIX_NAMES` is defined.
+ * @endrst
+ */
+__syscall int zsock_epoll_create1(int flags);
+
+/**
+ * @brief Create an epoll instance
+ *
+ * @details
+ * @rst
+ * Same as zsock_epoll_create1() with no flags, ``size`` must be positive
+ * but is otherwise ignored.
+ * This function is also exposed as ``epoll_create()``
+ * if :kconfig:option:`CONFIG_NET_SOCKETS_POSIX_NAMES` is defined.
+ * @endrst
+ */
+static inline int zsock_epoll_create(int size)
+{
+	if (size <= 0) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	return zsock_epoll_create1(0);
+}
+
+/**
+ * @brief Add, modify or remove a file descriptor of an epoll instance
+ *
+ * @details
+ * @rst
+ * See `Linux man page <https://man7.org/linux/man-pages/man2/epoll_ctl.2.html>`__
+ * for normative description. Native sockets notify the epoll instance
+ * directly; other file descriptors, and ``ZSOCK_EPOLLOUT`` on stream
+ * sockets, are polled and limited to
+ * :kconfig:option:`CONFIG_NET_SOCKETS_POLL_MAX` - 1 entries per instance.
+ * Closing a socket removes it from all the epoll instances.
+ * This function is also exposed as ``epoll_ctl()``
+ * if :kconfig:option:`CONFIG_NET_SOCKETS_POSIX_NAMES` is defined.
+ * @endrst
+ */
+__syscall int zsock_epoll_ctl(int epfd, int op, int fd,
+			      struct zsock_epoll_event *event);
+
+/**
+ * @brief Wait for events on an epoll instance
+ *
+ * @details
+ * @rst
+ * See `Linux man page <https://man7.org/linux/man-pages/man2/epoll_wait.2.html>`__
+ * for normative description. ``timeout`` is in milliseconds, -1 waits
+ * forever.
+ * This function is also exposed as ``epoll_wait()``
+ * if :kconfig:option:`CONFIG_NET_SOCKETS_POSIX_NAMES` is defined.
+ * @endrst
+ */
+__syscall int zsock_epoll_wait(int epfd, struct zsock_epoll_event *events,
+			       int maxevents, int timeout);
+
+#ifdef CONFIG_NET_SOCKETS_POSIX_NAMES
+
+#define EPOLL_CTL_ADD ZSOCK_EPOLL_CTL_ADD
+#define EPOLL_CTL_DEL ZSOCK_EPOLL_CTL_DEL
+#define EPOLL_CTL_MOD ZSOCK_EPOLL_CTL_MOD
+#define EPOLL_CLOEXEC ZSOCK_EPOLL_CLOEXEC
+
+#define EPOLLIN ZSOCK_EPOLLIN
+#define EPOLLPRI ZSOCK_EPOLLPRI
+#define EPOLLOUT ZSOCK_EPOLLOUT
+#define EPOLLERR ZSOCK_EPOLLERR
+#define EPOLLHUP ZSOCK_EPOLLHUP
+#define EPOLLRDHUP ZSOCK_EPOLLRDHUP
+#define EPOLLONESHOT ZSOCK_EPOLLONESHOT
+#define EPOLLET ZSOCK_EPOLLET
+
+#define epoll_data_t zsock_epoll_data_t
+#define epoll_event zsock_epoll_event
+
+static inline int epoll_create(int size)
+{
+	return zsock_epoll_create(size);
+}
+
+static inline int epoll_create1(int flags)
+{
+	return zsock_epoll_create1(flags);
+}
+
+static inline int epoll_ctl(int epfd, int op, int fd,
+			    struct zsock_epoll_event *event)
+{
+	return zsock_epoll_ctl(epfd, op, fd, event);
+}
+
+static inline int epoll_wait(int epfd, struct zsock_epoll_event *events,
+			     int maxevents, int timeout)
+{
+	return zsock_epoll_wait(epfd, events, maxevents, timeout);
+}
+
+#endif /* CONFIG_NET_SOCKETS_POSIX_NAMES */
+
+#ifdef __cplusplus
+}
+#endif
+
+#include <syscalls/socket_epoll.h>
+
+/**
+ * @}
+ */
+
+#endif /* ZEPHYR_INCLUDE_NET_SOCKET_EPOLL_H_ */
@@ -16,6 +16,7 @@
 #include <zephyr/kernel.h>
 
 #include <zephyr/net/net_ip.h>
+#include <zephyr/net/buf.h>
 #include <zephyr/net/http/parser.h>
 #include <zephyr/net/http/client.h>
 
@@ -60,6 +61,26 @@ enum websocket_opcode  {
 typedef int (*websocket_connect_cb_t)(int ws_sock, struct http_request *req,
 				      void *user_data);
 
+/**
+ * @typedef websocket_frame_cb_t
+ * @brief Callback called with the payload of received Websocket frames.
+ *
+ * @param ws_sock Websocket id
+ * @param message_type Type of the message, WEBSOCKET_FLAG_* values.
+ * @param data Unmasked payload, pointing to the receive buffer of the
+ *        Websocket. Valid during the call only. NULL if the frame has no
+ *        payload.
+ * @param len Length of the payload.
+ * @param remaining How much payload of the frame is left after this part.
+ *        This is 0 unless the frame does not fit into the receive buffer.
+ * @param user_data A valid pointer on some user data or NULL
+ *
+ * @return 0 if ok, <0 to stop receiving and return the error.
+ */
+typedef int (*websocket_frame_cb_t)(int ws_sock, uint32_t message_type,
+				    uint8_t *data, size_t len,
+				    uint64_t remaining, void *user_data);
+
 /**
  * Websocket client connection request. This contains all the data that is
  * needed when doing a Websocket connection request.
@@ -151,6 +172,29 @@ int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
 		       enum websocket_opcode opcode, bool mask, bool final,
 		       int32_t timeout);
 
+/**
+ * @brief Send websocket msg to peer from a net_buf chain.
+ *
+ * @details The buffers of the chain are sent as they are, as one frame,
+ * without copying them to a temporary buffer first. A masked frame is masked
+ * in place, so the data of the buffers is modified. The caller keeps the
+ * ownership of the buffers.
+ *
+ * @param ws_sock Websocket id returned by websocket_connect().
+ * @param payload Websocket data to send, may be NULL.
+ * @param opcode Operation code (text, binary, ping, pong, close)
+ * @param mask Mask the data, see RFC 6455 for details
+ * @param final Is this final message for this message send, see
+ *        websocket_send_msg().
+ * @param timeout How long to try to send the message. The value is in
+ *        milliseconds. Value SYS_FOREVER_MS means to wait forever.
+ *
+ * @return <0 if error, >=0 amount of bytes sent
+ */
+int websocket_send_msg_buf(int ws_sock, struct net_buf *payload,
+			   enum websocket_opcode opcode, bool mask, bool final,
+			   int32_t timeout);
+
 /**
  * @brief Receive websocket msg from peer.
  *
@@ -175,6 +219,31 @@ int websocket_recv_msg(int ws_sock, uint8_t *buf, size_t buf_len,
 		       uint32_t *message_type, uint64_t *remaining,
 		       int32_t timeout);
 
+/**
+ * @brief Receive websocket frames from peer and hand them to a callback.
+ *
+ * @details The payload of the frames is unmasked in the receive buffer of
+ * the Websocket and given to the callback from there, without copying it.
+ * The callback gets whole frames, or parts of the frames that are larger
+ * than the receive buffer. One call receives once from the socket and
+ * handles all the complete frames that were received.
+ *
+ * @param ws_sock Websocket id returned by websocket_connect().
+ * @param cb Callback to call with the received frames.
+ * @param user_data User data given to the callback.
+ * @param timeout How long to wait for data.
+ *        The value is in milliseconds. Value SYS_FOREVER_MS means to wait
+ *        forever.
+ *
+ * @retval >=0 amount of payload bytes given to the callback.
+ * @retval -EAGAIN on timeout.
+ * @retval -ENOTCONN on socket close.
+ * @retval -errno other negative errno value in case of failure, or the
+ *         error returned by the callback.
+ */
+int websocket_recv_frames(int ws_sock, websocket_frame_cb_t cb,
+			  void *user_data, int32_t timeout);
+
 /**
  * @brief Close websocket.
  *
@@ -25,6 +25,7 @@ extern "C" {
 
 enum zperf_status {
 	ZPERF_SESSION_STARTED,
+	ZPERF_SESSION_PERIODIC_RESULT,
 	ZPERF_SESSION_FINISHED,
 	ZPERF_SESSION_ERROR
 } __packed;
@@ -34,6 +35,19 @@ struct zperf_upload_params {
 	uint32_t duration_ms;
 	uint32_t rate_kbps;
 	uint16_t packet_size;
+	/** Number of parallel streams, 0 or 1 for a single one. For UDP, the
+	 * rate applies to each of the streams.
+	 */
+	uint8_t num_streams;
+	/** Interval of the ZPERF_SESSION_PERIODIC_RESULT reports of an
+	 * asynchronous upload in milliseconds, 0 to report the end result only.
+	 */
+	uint32_t report_interval_ms;
+	/** Local port the peer sends traffic back to during the upload (iPerf 2
+	 * dual test). A download server of the same protocol must be
+	 * listening on it. 0 to upload only.
+	 */
+	uint16_t dual_port;
 	struct {
 		uint8_t tos;
 		int tcp_nodelay;
@@ -57,13 +71,19 @@ struct zperf_results {
 	uint32_t client_time_in_us;
 	uint32_t packet_size;
 	uint32_t nb_packets_errors;
+	/** CPU load during the session in percent, if
+	 * CONFIG_NET_ZPERF_CPU_LOAD is enabled.
+	 */
+	uint32_t cpu_load;
 };
 
 /**
  * @brief Zperf callback function used for asynchronous operations.
  *
  * @param status Session status.
- * @param result Session results. May be NULL for certain events.
+ * @param result Session results. May be NULL for certain events. With
+ *        ZPERF_SESSION_PERIODIC_RESULT, the results of the last report
+ *        interval of an upload.
  * @param user_data A pointer to the user provided data.
  */
 typedef void (*zperf_callback)(enum zperf_status status,
@@ -22,6 +22,29 @@ extern "C" {
  * @{
  */
 
+/**
+ * @brief Completion callback of pm_device_runtime_get_async().
+ *
+ * @param dev Device instance.
+ * @param ret Result of pm_device_runtime_get().
+ * @param user_data User data given with the request.
+ */
+typedef void (*pm_device_runtime_cb_t)(const struct device *dev, int ret, void *user_data);
+
+/**
+ * @brief Asynchronous resume request.
+ *
+ * @note All fields in this structure are meant for private usage.
+ */
+struct pm_device_runtime_async {
+	/** @cond INTERNAL_HIDDEN */
+	struct k_work work;
+	const struct device *dev;
+	pm_device_runtime_cb_t cb;
+	void *user_data;
+	/** @endcond */
+};
+
 #if defined(CONFIG_PM_DEVICE_RUNTIME) || defined(__DOXYGEN__)
 /**
  * @brief Automatically enable device runtime based on devicetree properties
@@ -158,6 +181,49 @@ int pm_device_runtime_put_async(const struct device *dev, k_timeout_t delay);
  */
 bool pm_device_runtime_is_enabled(const struct device *dev);
 
+#if defined(CONFIG_PM_DEVICE_RUNTIME_ASYNC) || defined(__DOXYGEN__)
+/**
+ * @brief Resume a device based on usage count (asynchronously).
+ *
+ * Same as pm_device_runtime_get(), run from one of the runtime PM work queues
+ * so that the caller can go on with its own setup while the device and its
+ * power domains are resumed. @p cb is called with the result once done, or
+ * before returning if resuming can't block (runtime PM not enabled, ISR safe
+ * device or pre-kernel mode).
+ *
+ * @funcprops \pre_kernel_ok, \async, \isr_ok
+ *
+ * @param dev Device instance.
+ * @param req Request, must be left untouched until @p cb is called.
+ * @param cb Completion callback.
+ * @param user_data User data passed to @p cb.
+ *
+ * @retval 0 If the request was queued or completed.
+ * @retval -errno Negative errno if the request could not be queued, @p cb will
+ * not be called.
+ */
+int pm_device_runtime_get_async(const struct device *dev,
+				struct pm_device_runtime_async *req,
+				pm_device_runtime_cb_t cb, void *user_data);
+
+/**
+ * @brief Resume a set of devices.
+ *
+ * Same as calling pm_device_runtime_get() on each device, resuming up to
+ * @kconfig{CONFIG_PM_DEVICE_RUNTIME_ASYNC_THREADS} devices at the same time
+ * so that the independent branches of the power domain tree are powered up
+ * in parallel.
+ *
+ * @param devs Device instances.
+ * @param count Number of devices.
+ *
+ * @retval 0 If all the devices were resumed.
+ * @retval -errno Negative errno of a failed resume, the usage count of the
+ * other devices is left unchanged.
+ */
+int pm_device_runtime_get_batch(const struct device *const *devs, size_t count);
+#endif /* CONFIG_PM_DEVICE_RUNTIME_ASYNC */
+
 #else
 
 static inline int pm_device_runtime_auto_enable(const struct device *dev)
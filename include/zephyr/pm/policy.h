@@ -11,6 +11,7 @@
 #include <stdint.h>
 
 #include <zephyr/pm/state.h>
+#include <zephyr/sys/rb.h>
 #include <zephyr/sys/slist.h>
 #include <zephyr/toolchain.h>
 
@@ -53,8 +54,9 @@ struct pm_policy_latency_subscription {
  */
 struct pm_policy_latency_request {
 	/** @cond INTERNAL_HIDDEN */
-	sys_snode_t node;
+	struct rbnode node;
 	uint32_t value_us;
+	uint8_t set;
 	/** @endcond */
 };
 
@@ -148,6 +150,23 @@ bool pm_policy_state_lock_is_active(enum pm_state state, uint8_t substate_id);
 void pm_policy_latency_request_add(struct pm_policy_latency_request *req,
 				   uint32_t value_us);
 
+#if defined(CONFIG_PM_POLICY_LATENCY_PER_CPU) || defined(__DOXYGEN__)
+/**
+ * @brief Add a new latency requirement of a single CPU.
+ *
+ * Only the power states of @p cpu are constrained, the other CPUs may still
+ * enter states of a higher exit latency. Latency change subscribers are not
+ * notified of such requirements. The request is updated and removed with
+ * pm_policy_latency_request_update() and pm_policy_latency_request_remove().
+ *
+ * @param req Latency request.
+ * @param cpu CPU index.
+ * @param value_us Maximum allowed latency in microseconds.
+ */
+void pm_policy_latency_cpu_request_add(struct pm_policy_latency_request *req,
+				       uint8_t cpu, uint32_t value_us);
+#endif
+
 /**
  * @brief Update a latency requirement.
  *
@@ -167,6 +186,9 @@ void pm_policy_latency_request_remove(struct pm_policy_latency_request *req);
 /**
  * @brief Subscribe to maximum latency changes.
  *
+ * The callback is only invoked when the maximum latency changes, for the
+ * requirements of all the CPUs.
+ *
  * @param req Subscription request.
  * @param cb Callback function (NULL to disable).
  */
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_POSIX_AIO_H_
+#define ZEPHYR_INCLUDE_POSIX_AIO_H_
+
+#include <sys/types.h>
+
+#include <zephyr/posix/signal.h>
+#include <zephyr/posix/time.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define AIO_ALLDONE 0
+#define AIO_CANCELED 1
+#define AIO_NOTCANCELED 2
+
+#define LIO_NOP 0
+#define LIO_READ 1
+#define LIO_WRITE 2
+
+#define LIO_NOWAIT 0
+#define LIO_WAIT 1
+
+struct aiocb {
+	int aio_fildes;
+	off_t aio_offset;
+	volatile void *aio_buf;
+	size_t aio_nbytes;
+	int aio_reqprio;
+	struct sigevent aio_sigevent;
+	int aio_lio_opcode;
+
+	/* Reserved for the implementation */
+	int _aio_error;
+	ssize_t _aio_return;
+	void *_aio_list;
+};
+
+int aio_cancel(int fildes, struct aiocb *aiocbp);
+int aio_error(const struct aiocb *aiocbp);
+int aio_read(struct aiocb *aiocbp);
+ssize_t aio_return(struct aiocb *aiocbp);
+int aio_suspend(const struct aiocb *const list[], int nent,
+		const struct timespec *timeout);
+int aio_write(struct aiocb *aiocbp);
+int lio_listio(int mode, struct aiocb *const list[], int nent,
+	       struct sigevent *sig);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_POSIX_AIO_H_ */
@@ -43,6 +43,76 @@ int mq_timedsend(mqd_t mqdes, const char *msg_ptr, size_t msg_len,
 		 unsigned int msg_prio, const struct timespec *abstime);
 int mq_notify(mqd_t mqdes, const struct sigevent *notification);
 
+/**
+ * @brief Loan a message buffer from a message queue.
+ *
+ * Zephyr extension. The buffer is taken from the storage of the queue and
+ * can hold a message of up to @c mq_msgsize bytes. It is either sent with
+ * mq_send_loaned_np(), or given back with mq_return_np(). A loaned buffer
+ * takes the place of a message in the queue until then.
+ *
+ * @param mqdes Message queue descriptor.
+ * @param msg_ptr Where to store the address of the buffer.
+ * @param abstime Time to wait for a buffer until, or NULL to wait forever.
+ *                The queue doesn't wait if it is non-blocking.
+ *
+ * @retval 0 on success.
+ * @retval -1 with errno set to EAGAIN or ETIMEDOUT if no buffer was free.
+ */
+int mq_loan_np(mqd_t mqdes, char **msg_ptr, const struct timespec *abstime);
+
+/**
+ * @brief Send a loaned message buffer to a message queue.
+ *
+ * Zephyr extension. The message isn't copied, the buffer is owned by the
+ * queue again once sent. This never blocks.
+ *
+ * @param mqdes Message queue descriptor.
+ * @param msg_ptr Buffer from mq_loan_np() or mq_timedreceive_loaned_np().
+ * @param msg_len Length of the message.
+ * @param msg_prio Priority of the message, ignored.
+ *
+ * @retval 0 on success.
+ * @retval -1 with errno set to EINVAL if @p msg_ptr isn't a buffer of the
+ *         queue, or EMSGSIZE if the message is too long.
+ */
+int mq_send_loaned_np(mqd_t mqdes, char *msg_ptr, size_t msg_len,
+		      unsigned int msg_prio);
+
+/**
+ * @brief Receive a message from a message queue without copying it.
+ *
+ * Zephyr extension. The buffer of the message is loaned to the caller,
+ * which gives it back with mq_return_np(), or sends it again with
+ * mq_send_loaned_np(). Nothing is allocated or copied.
+ *
+ * @param mqdes Message queue descriptor.
+ * @param msg_ptr Where to store the address of the message.
+ * @param msg_prio Where to store the priority of the message, or NULL.
+ * @param abstime Time to wait for a message until, or NULL to wait forever.
+ *                The queue doesn't wait if it is non-blocking.
+ *
+ * @return Length of the message on success, or -1 with errno set to EAGAIN
+ *         or ETIMEDOUT if no message was received.
+ */
+ssize_t mq_timedreceive_loaned_np(mqd_t mqdes, char **msg_ptr,
+				  unsigned int *msg_prio,
+				  const struct timespec *abstime);
+
+/**
+ * @brief Return a loaned message buffer to its message queue.
+ *
+ * Zephyr extension.
+ *
+ * @param mqdes Message queue descriptor.
+ * @param msg_ptr Buffer from mq_loan_np() or mq_timedreceive_loaned_np().
+ *
+ * @retval 0 on success.
+ * @retval -1 with errno set to EINVAL if @p msg_ptr isn't a buffer of the
+ *         queue.
+ */
+int mq_return_np(mqd_t mqdes, char *msg_ptr);
+
 #ifdef __cplusplus
 }
 #endif
@@ -36,7 +36,7 @@ extern "C" {
 
 /* Constants for Opitions and Option Groups */
 #define _POSIX_ADVISORY_INFO		  (-1L)
-#define _POSIX_ASYNCHRONOUS_IO		  (-1L)
+#define _POSIX_ASYNCHRONOUS_IO		  Z_SC_VAL_IFDEF(CONFIG_POSIX_ASYNCHRONOUS_IO, _POSIX_VERSION)
 #define _POSIX_BARRIERS			  Z_SC_VAL_IFDEF(CONFIG_PTHREAD_IPC, _POSIX_VERSION)
 #define _POSIX_CHOWN_RESTRICTED		  (-1L)
 #define _POSIX_CLOCK_SELECTION		  Z_SC_VAL_IFDEF(CONFIG_POSIX_CLOCK, _POSIX_VERSION)
@@ -180,8 +180,12 @@ extern "C" {
 #define NZERO	   (20)
 
 /* Runtime invariant values */
-#define AIO_LISTIO_MAX		      _POSIX_AIO_LISTIO_MAX
-#define AIO_MAX			      _POSIX_AIO_MAX
+#define AIO_LISTIO_MAX		      COND_CODE_1(CONFIG_POSIX_ASYNCHRONOUS_IO, \
+						  (CONFIG_POSIX_AIO_MAX),	  \
+						  (_POSIX_AIO_LISTIO_MAX))
+#define AIO_MAX			      COND_CODE_1(CONFIG_POSIX_ASYNCHRONOUS_IO, \
+						  (CONFIG_POSIX_AIO_MAX),	  \
+						  (_POSIX_AIO_MAX))
 #define AIO_PRIO_DELTA_MAX	      (0)
 #define DELAYTIMER_MAX		      _POSIX_DELAYTIMER_MAX
 #define HOST_NAME_MAX		      COND_CODE_1(CONFIG_NETWORKING,	  \
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Buffered entropy pool
+ */
+
+#ifndef ZEPHYR_INCLUDE_RANDOM_ENTROPY_POOL_H_
+#define ZEPHYR_INCLUDE_RANDOM_ENTROPY_POOL_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Buffered entropy pool
+ * @defgroup entropy_pool Entropy Pool
+ * @ingroup random_api
+ * @{
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Statistics of the entropy pool */
+struct entropy_pool_stats {
+	/** Requests that the pool could not serve in full */
+	uint32_t underruns;
+	/** Bytes read from the entropy device by the background refill */
+	uint32_t refilled;
+};
+
+/**
+ * @brief Get entropy from the pool
+ *
+ * Bytes are taken from the pool of the current CPU, which is refilled in
+ * the background. Whatever the pool cannot provide is read from the
+ * entropy device directly, busy waiting for it in interrupt context.
+ * Can be called from any context.
+ *
+ * @param dst Buffer to fill
+ * @param len Number of bytes to get
+ *
+ * @return 0 on success, negative error code from the entropy device
+ *         otherwise.
+ */
+int entropy_pool_get(void *dst, size_t len);
+
+/**
+ * @brief Get the statistics of the entropy pool
+ *
+ * @param stats Statistics to fill, summed over all the CPUs
+ */
+void entropy_pool_stats_get(struct entropy_pool_stats *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* ZEPHYR_INCLUDE_RANDOM_ENTROPY_POOL_H_ */
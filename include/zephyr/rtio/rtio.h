@@ -1005,6 +1005,44 @@ static inline struct rtio_cqe *rtio_cqe_consume_block(struct rtio *r)
 	return cqe;
 }
 
+/**
+ * @brief Poll for a single completion queue event
+ *
+ * Spins on the completion queue, with an exponential backoff between polls
+ * bounded by @kconfig{CONFIG_RTIO_CONSUME_SPIN_BACKOFF}, and never sleeps
+ * nor yields. This avoids the context switches of rtio_cqe_consume_block()
+ * for consumers expecting a completion very soon, typically from an ISR,
+ * but starves the threads of lower priority while spinning.
+ *
+ * If a completion queue event is returned rtio_cq_release(r) must be called
+ * at some point to release the cqe spot for the cqe producer.
+ *
+ * @param r RTIO context
+ * @param timeout Time to spin for at most
+ *
+ * @retval cqe A valid completion queue event consumed from the completion queue
+ * @retval NULL No completion queue event available before the timeout
+ */
+static inline struct rtio_cqe *rtio_cqe_consume_spin(struct rtio *r, k_timeout_t timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	uint32_t backoff = 1;
+	struct rtio_cqe *cqe;
+
+	while ((cqe = rtio_cqe_consume(r)) == NULL) {
+		if (sys_timepoint_expired(end)) {
+			break;
+		}
+		for (uint32_t i = 0; i < backoff; i++) {
+			arch_nop();
+		}
+		Z_SPIN_DELAY(1);
+		backoff = MIN(backoff * 2, CONFIG_RTIO_CONSUME_SPIN_BACKOFF);
+	}
+
+	return cqe;
+}
+
 /**
  * @brief Release consumed completion queue event
  *
@@ -1137,17 +1175,18 @@ static inline void rtio_iodev_cancel_all(struct rtio_iodev *iodev)
 }
 
 /**
- * Submit a completion queue event with a given result and userdata
+ * Queue a completion queue event with a given result and userdata
  *
- * Called by the executor to produce a completion queue event, no inherent
- * locking is performed and this is not safe to do from multiple callers.
+ * The event is not accounted for by the waiters of rtio_submit() and
+ * rtio_cqe_consume_block() until rtio_cqe_publish() is called, which lets
+ * the executor publish all the completions of a transaction at once.
  *
  * @param r RTIO context
  * @param result Integer result code (could be -errno)
  * @param userdata Userdata to pass along to completion
  * @param flags Flags to use for the CEQ see RTIO_CQE_FLAG_*
  */
-static inline void rtio_cqe_submit(struct rtio *r, int result, void *userdata, uint32_t flags)
+static inline void rtio_cqe_queue(struct rtio *r, int result, void *userdata, uint32_t flags)
 {
 	struct rtio_cqe *cqe = rtio_cqe_acquire(r);
 
@@ -1159,21 +1198,53 @@ static inline void rtio_cqe_submit(struct rtio *r, int result, void *userdata, u
 		cqe->flags = flags;
 		rtio_cqe_produce(r, cqe);
 	}
+}
 
-	atomic_inc(&r->cq_count);
+/**
+ * Publish completion queue events queued with rtio_cqe_queue()
+ *
+ * @param r RTIO context
+ * @param count Number of completion queue events queued
+ */
+static inline void rtio_cqe_publish(struct rtio *r, uint32_t count)
+{
+	if (count == 0) {
+		return;
+	}
+
+	atomic_add(&r->cq_count, count);
 #ifdef CONFIG_RTIO_SUBMIT_SEM
 	if (r->submit_count > 0) {
-		r->submit_count--;
+		r->submit_count -= MIN(count, r->submit_count);
 		if (r->submit_count == 0) {
 			k_sem_give(r->submit_sem);
 		}
 	}
 #endif
 #ifdef CONFIG_RTIO_CONSUME_SEM
-	k_sem_give(r->consume_sem);
+	for (uint32_t i = 0; i < count; i++) {
+		k_sem_give(r->consume_sem);
+	}
 #endif
 }
 
+/**
+ * Submit a completion queue event with a given result and userdata
+ *
+ * Called by the executor to produce a completion queue event, no inherent
+ * locking is performed and this is not safe to do from multiple callers.
+ *
+ * @param r RTIO context
+ * @param result Integer result code (could be -errno)
+ * @param userdata Userdata to pass along to completion
+ * @param flags Flags to use for the CEQ see RTIO_CQE_FLAG_*
+ */
+static inline void rtio_cqe_submit(struct rtio *r, int result, void *userdata, uint32_t flags)
+{
+	rtio_cqe_queue(r, result, userdata, flags);
+	rtio_cqe_publish(r, 1);
+}
+
 #define __RTIO_MEMPOOL_GET_NUM_BLKS(num_bytes, blk_size) (((num_bytes) + (blk_size)-1) / (blk_size))
 
 /**
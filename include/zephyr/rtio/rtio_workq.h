@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_RTIO_WORKQ_H_
+#define ZEPHYR_RTIO_WORKQ_H_
+
+#include <stdint.h>
+#include <zephyr/rtio/rtio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief RTIO Work Queue API
+ * @defgroup rtio_workq RTIO Work Queue API
+ * @ingroup rtio
+ * @{
+ */
+
+/**
+ * @brief Blocking handler of a submission
+ *
+ * Runs in a worker thread and may block. It must complete the submission
+ * with rtio_iodev_sqe_ok() or rtio_iodev_sqe_err().
+ *
+ * @param iodev_sqe Submission to handle
+ */
+typedef void (*rtio_workq_handler_t)(struct rtio_iodev_sqe *iodev_sqe);
+
+/**
+ * @brief Handle a submission in a worker thread
+ *
+ * Lets the submit function of an iodev without native asynchronous
+ * support run its blocking implementation. Submissions are handled in
+ * order of arrival by a pool of CONFIG_RTIO_WORKQ_THREADS threads, so
+ * up to that many run concurrently, possibly for the same iodev. When
+ * all the CONFIG_RTIO_WORKQ_ITEMS requests are in use, the submission
+ * completes with -ENOMEM.
+ *
+ * May be called from an ISR.
+ *
+ * @param iodev_sqe Submission to handle
+ * @param handler Blocking handler of the submission
+ */
+void rtio_workq_submit(struct rtio_iodev_sqe *iodev_sqe, rtio_workq_handler_t handler);
+
+/**
+ * @brief Get the number of requests queued or being handled
+ *
+ * @return Number of requests in use
+ */
+uint32_t rtio_workq_used_count_get(void);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_RTIO_WORKQ_H_ */
@@ -79,6 +79,10 @@ struct sensing_connection {
 	void *data;
 	/* client(sink) next consume time */
 	uint64_t next_consume_time;
+#ifdef CONFIG_SENSING_BATCH
+	/* maximum delay of the data to client(sink), batched when not 0 */
+	uint64_t latency;
+#endif
 	/* post data to application */
 	struct sensing_callback_list *callback_list;
 };
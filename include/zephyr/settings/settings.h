@@ -314,6 +314,32 @@ int settings_save(void);
  */
 int settings_save_one(const char *name, const void *value, size_t val_len);
 
+/**
+ * Item of a settings_save_many() operation.
+ */
+struct settings_save_item {
+	/** Name/key of the settings item. */
+	const char *name;
+	/** Pointer to the value of the settings item, NULL to delete it. */
+	const void *value;
+	/** Length of the value. */
+	size_t val_len;
+};
+
+/**
+ * Write several serialized values to persisted storage in one operation.
+ *
+ * Like calling settings_save_one() for each item, but the storage back-end
+ * can defer its own bookkeeping writes to the end of the operation.
+ *
+ * @param items Items to save.
+ * @param count Number of items.
+ *
+ * @return 0 on success, non-zero on failure. The items before the failing
+ * one are saved.
+ */
+int settings_save_many(const struct settings_save_item *items, size_t count);
+
 /**
  * Delete a single serialized in persisted storage.
  *
@@ -697,6 +697,10 @@ struct shell_transport {
  */
 struct shell_stats {
 	atomic_t log_lost_cnt; /*!< Lost log counter.*/
+	atomic_t tx_bytes_cnt; /*!< Bytes written to the transport.*/
+	atomic_t tx_write_cnt; /*!< Write calls to the transport.*/
+	atomic_t tx_pend_cnt; /*!< Waits for the transport to be ready.*/
+	int64_t reset_time; /*!< Uptime of the last reset, in milliseconds.*/
 };
 
 #ifdef CONFIG_SHELL_STATS
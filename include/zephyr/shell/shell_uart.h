@@ -59,7 +59,9 @@ struct shell_uart_int_driven {
 
 struct shell_uart_async {
 	struct shell_uart_common common;
-	struct k_sem tx_sem;
+	struct ring_buf tx_ringbuf;
+	uint8_t tx_buf[CONFIG_SHELL_BACKEND_SERIAL_TX_RING_BUFFER_SIZE];
+	atomic_t tx_busy;
 	struct uart_async_rx async_rx;
 	struct uart_async_rx_config async_rx_config;
 	atomic_t pending_rx_req;
@@ -20,6 +20,11 @@
 #include <zephyr/sys/__assert.h>
 #include <zephyr/sys/time_units.h>
 
+#ifdef CONFIG_OBJ_CORE_STATS_SPINLOCK
+#include <zephyr/kernel/obj_core.h>
+#include <zephyr/kernel/stats.h>
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -35,6 +40,27 @@ struct z_spinlock_key {
 	int key;
 };
 
+#if defined(CONFIG_MCS_SPINLOCKS) || defined(__DOXYGEN__)
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+
+/* Queue node of an MCS spinlock. Each CPU waiting for, or holding, an MCS
+ * lock uses one node from a small per-CPU pool, and spins on its own node
+ * only.
+ */
+struct z_spin_mcs_node {
+	/* Next CPU in the queue */
+	atomic_ptr_t next;
+	/* Non-zero while the previous CPU holds the lock */
+	atomic_t wait;
+};
+
+/**
+ * INTERNAL_HIDDEN @endcond
+ */
+#endif /* CONFIG_MCS_SPINLOCKS */
+
 /**
  * @brief Kernel Spin Lock
  *
@@ -61,6 +87,16 @@ struct k_spinlock {
 	 */
 	atomic_t owner;
 	atomic_t tail;
+#elif defined(CONFIG_MCS_SPINLOCKS)
+	/*
+	 * MCS spinlocks keep a queue of the waiting CPUs. The lock points
+	 * to the node of the last CPU that queued itself, or is NULL when
+	 * unlocked. Each CPU spins on its own node until its predecessor
+	 * hands the lock over, so waiters don't share a cache line.
+	 */
+	atomic_ptr_t tail;
+	/* Node of the CPU holding the lock */
+	struct z_spin_mcs_node *holder;
 #else
 	atomic_t locked;
 #endif /* CONFIG_TICKET_SPINLOCKS */
@@ -78,8 +114,16 @@ struct k_spinlock {
 #endif /* CONFIG_SPIN_LOCK_TIME_LIMIT */
 #endif /* CONFIG_SPIN_VALIDATE */
 
+#ifdef CONFIG_OBJ_CORE_STATS_SPINLOCK
+	/* Time (in cycles) when the lock was taken, and contention
+	 * statistics. Both are only written with the lock held.
+	 */
+	uint32_t stats_lock_time;
+	struct k_lock_stats stats;
+#endif /* CONFIG_OBJ_CORE_STATS_SPINLOCK */
+
 #if defined(CONFIG_CPP) && !defined(CONFIG_SMP) && \
-	!defined(CONFIG_SPIN_VALIDATE)
+	!defined(CONFIG_SPIN_VALIDATE) && !defined(CONFIG_OBJ_CORE_STATS_SPINLOCK)
 	/* If CONFIG_SMP and CONFIG_SPIN_VALIDATE are both not defined
 	 * the k_spinlock struct will have no members. The result
 	 * is that in C sizeof(k_spinlock) is 0 and in C++ it is 1.
@@ -116,6 +160,81 @@ bool z_spin_lock_mem_coherent(struct k_spinlock *l);
 
 #endif /* CONFIG_SPIN_VALIDATE */
 
+#ifdef CONFIG_MCS_SPINLOCKS
+bool z_spin_mcs_lock(struct k_spinlock *l);
+bool z_spin_mcs_trylock(struct k_spinlock *l);
+void z_spin_mcs_unlock(struct k_spinlock *l);
+#endif /* CONFIG_MCS_SPINLOCKS */
+
+#if defined(CONFIG_OBJ_CORE_STATS_SPINLOCK) || defined(__DOXYGEN__)
+/**
+ * @brief Spinlock reported through the object core
+ *
+ * With @kconfig{CONFIG_OBJ_CORE_STATS_SPINLOCK}, every spinlock counts its
+ * acquisitions and contention. A spinlock registered with
+ * k_spinlock_obj_register() is linked to the object core type
+ * @ref K_OBJ_TYPE_SPINLOCK_ID, through which its statistics, a
+ * struct k_lock_stats, can be read and reset.
+ */
+struct k_spinlock_obj {
+	/** Object core of the spinlock */
+	struct k_obj_core obj_core;
+	/** Registered spinlock */
+	struct k_spinlock *lock;
+	/** Name of the spinlock, for reporting */
+	const char *name;
+};
+
+/**
+ * @brief Register a spinlock with the object core
+ *
+ * The statistics of the spinlock can then be read with
+ * k_obj_core_stats_raw() and reset with k_obj_core_stats_reset(). Those
+ * take the spinlock, so they must not be called with it held, nor can
+ * object core functions be called while holding it.
+ *
+ * @param obj Object core entry, which must stay valid until the spinlock
+ *        is unregistered with k_obj_core_unlink().
+ * @param lock Spinlock to register.
+ * @param name Name of the spinlock.
+ */
+void k_spinlock_obj_register(struct k_spinlock_obj *obj,
+			     struct k_spinlock *lock, const char *name);
+#endif /* CONFIG_OBJ_CORE_STATS_SPINLOCK */
+
+static ALWAYS_INLINE uint32_t z_spinlock_stats_start(void)
+{
+#ifdef CONFIG_OBJ_CORE_STATS_SPINLOCK
+	return sys_clock_cycle_get_32();
+#else
+	return 0;
+#endif
+}
+
+static ALWAYS_INLINE void z_spinlock_stats_acquired(struct k_spinlock *l,
+						    uint32_t start,
+						    bool contended)
+{
+	ARG_UNUSED(l);
+	ARG_UNUSED(start);
+	ARG_UNUSED(contended);
+#ifdef CONFIG_OBJ_CORE_STATS_SPINLOCK
+	uint32_t now = sys_clock_cycle_get_32();
+
+	z_lock_stats_acquired(&l->stats, contended, now - start);
+	l->stats_lock_time = now;
+#endif
+}
+
+static ALWAYS_INLINE void z_spinlock_stats_released(struct k_spinlock *l)
+{
+	ARG_UNUSED(l);
+#ifdef CONFIG_OBJ_CORE_STATS_SPINLOCK
+	z_lock_stats_released(&l->stats,
+			      sys_clock_cycle_get_32() - l->stats_lock_time);
+#endif
+}
+
 /**
  * @brief Spinlock key type
  *
@@ -191,6 +310,10 @@ static ALWAYS_INLINE k_spinlock_key_t k_spin_lock(struct k_spinlock *l)
 	k.key = arch_irq_lock();
 
 	z_spinlock_validate_pre(l);
+
+	uint32_t stats_start = z_spinlock_stats_start();
+	bool contended = false;
+
 #ifdef CONFIG_SMP
 #ifdef CONFIG_TICKET_SPINLOCKS
 	/*
@@ -200,15 +323,25 @@ static ALWAYS_INLINE k_spinlock_key_t k_spin_lock(struct k_spinlock *l)
 	atomic_val_t ticket = atomic_inc(&l->tail);
 	/* Spin until our ticket is served */
 	while (atomic_get(&l->owner) != ticket) {
+		contended = true;
 		arch_spin_relax();
 	}
+#elif defined(CONFIG_MCS_SPINLOCKS)
+	contended = z_spin_mcs_lock(l);
 #else
 	while (!atomic_cas(&l->locked, 0, 1)) {
-		arch_spin_relax();
+		contended = true;
+		/* Wait with plain loads, so that the cache line stays
+		 * shared until the lock looks free.
+		 */
+		while (atomic_get(&l->locked) != 0) {
+			arch_spin_relax();
+		}
 	}
 #endif /* CONFIG_TICKET_SPINLOCKS */
 #endif /* CONFIG_SMP */
 	z_spinlock_validate_post(l);
+	z_spinlock_stats_acquired(l, stats_start, contended);
 
 	return k;
 }
@@ -257,6 +390,10 @@ static ALWAYS_INLINE int k_spin_trylock(struct k_spinlock *l, k_spinlock_key_t *
 	if (!atomic_cas(&l->tail, ticket_val, ticket_val + 1)) {
 		goto busy;
 	}
+#elif defined(CONFIG_MCS_SPINLOCKS)
+	if (!z_spin_mcs_trylock(l)) {
+		goto busy;
+	}
 #else
 	if (!atomic_cas(&l->locked, 0, 1)) {
 		goto busy;
@@ -264,6 +401,7 @@ static ALWAYS_INLINE int k_spin_trylock(struct k_spinlock *l, k_spinlock_key_t *
 #endif /* CONFIG_TICKET_SPINLOCKS */
 #endif /* CONFIG_SMP */
 	z_spinlock_validate_post(l);
+	z_spinlock_stats_acquired(l, z_spinlock_stats_start(), false);
 
 	k->key = key;
 
@@ -312,11 +450,15 @@ static ALWAYS_INLINE void k_spin_unlock(struct k_spinlock *l,
 		 l, delta, CONFIG_SPIN_LOCK_TIME_LIMIT);
 #endif /* CONFIG_SPIN_LOCK_TIME_LIMIT */
 #endif /* CONFIG_SPIN_VALIDATE */
+	z_spinlock_stats_released(l);
 
 #ifdef CONFIG_SMP
 #ifdef CONFIG_TICKET_SPINLOCKS
 	/* Give the spinlock to the next CPU in a FIFO */
 	atomic_inc(&l->owner);
+#elif defined(CONFIG_MCS_SPINLOCKS)
+	/* Hand the lock over to the next queued CPU, if any */
+	z_spin_mcs_unlock(l);
 #else
 	/* Strictly we don't need atomic_clear() here (which is an
 	 * exchange operation that returns the old value).  We are always
@@ -349,6 +491,8 @@ static ALWAYS_INLINE bool z_spin_is_locked(struct k_spinlock *l)
 	atomic_val_t ticket_val = atomic_get(&l->owner);
 
 	return !atomic_cas(&l->tail, ticket_val, ticket_val);
+#elif defined(CONFIG_MCS_SPINLOCKS)
+	return atomic_ptr_get(&l->tail) != NULL;
 #else
 	return l->locked;
 #endif /* CONFIG_TICKET_SPINLOCKS */
@@ -362,9 +506,12 @@ static ALWAYS_INLINE void k_spin_release(struct k_spinlock *l)
 #ifdef CONFIG_SPIN_VALIDATE
 	__ASSERT(z_spin_unlock_valid(l), "Not my spinlock %p", l);
 #endif
+	z_spinlock_stats_released(l);
 #ifdef CONFIG_SMP
 #ifdef CONFIG_TICKET_SPINLOCKS
 	atomic_inc(&l->owner);
+#elif defined(CONFIG_MCS_SPINLOCKS)
+	z_spin_mcs_unlock(l);
 #else
 	atomic_clear(&l->locked);
 #endif /* CONFIG_TICKET_SPINLOCKS */
@@ -107,6 +107,81 @@ int disk_access_write(const char *pdrv, const uint8_t *data_buf,
  */
 int disk_access_ioctl(const char *pdrv, uint8_t cmd, void *buff);
 
+#if defined(CONFIG_DISK_ACCESS_RTIO) || defined(__DOXYGEN__)
+
+#include <zephyr/rtio/rtio.h>
+
+/** @cond INTERNAL_HIDDEN */
+struct disk_access_iodev {
+	const char *name;
+	struct disk_info *disk;
+	uint32_t sector_size;
+};
+
+extern const struct rtio_iodev_api disk_access_iodev_api;
+/** @endcond */
+
+/**
+ * @brief Define an RTIO iodev for a disk
+ *
+ * Requests to the disk are queued in an RTIO context with
+ * disk_access_rtio_read() and disk_access_rtio_write(). Many requests
+ * can be submitted at once; disks with a native asynchronous interface,
+ * like NVMe, process them in parallel, the others execute them in order
+ * in a worker thread.
+ *
+ * @param name Symbolic name of the iodev to define
+ * @param pdrv Disk name
+ */
+#define DISK_ACCESS_IODEV_DEFINE(name, pdrv)					\
+	static struct disk_access_iodev _disk_access_iodev_##name = {		\
+		.name = (pdrv),							\
+	};									\
+	RTIO_IODEV_DEFINE(name, &disk_access_iodev_api,			\
+			  &_disk_access_iodev_##name)
+
+/**
+ * @brief Queue a read from a disk in an RTIO context
+ *
+ * The request uses two submission queue entries of the context forming a
+ * transaction; a single completion with @p userdata and the result of the
+ * read is produced. It must be called from a thread.
+ *
+ * @param[in] r RTIO context
+ * @param[in] iodev Disk iodev defined with DISK_ACCESS_IODEV_DEFINE()
+ * @param[in] data_buf Pointer to the memory buffer to put data
+ * @param[in] start_sector Start disk sector to read from
+ * @param[in] num_sector Number of disk sectors to read
+ * @param[in] userdata Userdata of the completion
+ *
+ * @retval sqe Last submission queue entry of the request, to chain it
+ * @retval NULL Not enough submission queue entries, or the disk is unknown
+ */
+struct rtio_sqe *disk_access_rtio_read(struct rtio *r, struct rtio_iodev *iodev,
+				       uint8_t *data_buf, uint32_t start_sector,
+				       uint32_t num_sector, void *userdata);
+
+/**
+ * @brief Queue a write to a disk in an RTIO context
+ *
+ * See disk_access_rtio_read().
+ *
+ * @param[in] r RTIO context
+ * @param[in] iodev Disk iodev defined with DISK_ACCESS_IODEV_DEFINE()
+ * @param[in] data_buf Pointer to the memory buffer
+ * @param[in] start_sector Start disk sector to write to
+ * @param[in] num_sector Number of disk sectors to write
+ * @param[in] userdata Userdata of the completion
+ *
+ * @retval sqe Last submission queue entry of the request, to chain it
+ * @retval NULL Not enough submission queue entries, or the disk is unknown
+ */
+struct rtio_sqe *disk_access_rtio_write(struct rtio *r, struct rtio_iodev *iodev,
+					const uint8_t *data_buf, uint32_t start_sector,
+					uint32_t num_sector, void *userdata);
+
+#endif /* CONFIG_DISK_ACCESS_RTIO */
+
 #ifdef __cplusplus
 }
 #endif
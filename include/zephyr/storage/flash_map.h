@@ -271,6 +271,34 @@ const char *flash_area_label(const struct flash_area *fa);
  */
 uint8_t flash_area_erased_val(const struct flash_area *fa);
 
+#if defined(CONFIG_FLASH_MAP_READ_CACHE) || defined(__DOXYGEN__)
+/** Statistics of the flash area read cache */
+struct flash_area_cache_stats {
+	/** Reads of a line found in the cache */
+	uint32_t hits;
+	/** Reads of a line loaded into the cache */
+	uint32_t misses;
+	/** Reads of whole lines done without the cache */
+	uint32_t bypass;
+};
+
+/**
+ * @brief Get the statistics of the flash area read cache
+ *
+ * @param[out] stats Statistics
+ * @param[in]  reset Clear the statistics after reading them
+ */
+void flash_area_cache_stats_get(struct flash_area_cache_stats *stats, bool reset);
+
+/**
+ * @brief Drop the content of the flash area read cache
+ *
+ * Must be called after the flash was modified without going through
+ * flash_area_write() or flash_area_erase().
+ */
+void flash_area_cache_invalidate(void);
+#endif
+
 /**
  * Returns non-0 value if fixed-partition of given DTS node label exists.
  *
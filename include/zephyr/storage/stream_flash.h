@@ -23,6 +23,9 @@
 
 #include <stdbool.h>
 #include <zephyr/drivers/flash.h>
+#ifdef CONFIG_STREAM_FLASH_BACKGROUND
+#include <zephyr/kernel.h>
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -63,6 +66,13 @@ struct stream_flash_ctx {
 #ifdef CONFIG_STREAM_FLASH_ERASE
 	off_t last_erased_page_start_offset; /* Last erased offset */
 #endif
+#ifdef CONFIG_STREAM_FLASH_BACKGROUND
+	uint8_t *bg_buf; /* Buffer written in the background */
+	size_t bg_bytes; /* Number of bytes written in the background */
+	int bg_rc; /* Result of the last background write */
+	struct k_work bg_work; /* Background write */
+	struct k_sem bg_idle; /* Available when no background write runs */
+#endif
 };
 
 /**
@@ -115,6 +125,28 @@ size_t stream_flash_bytes_written(struct stream_flash_ctx *ctx);
 int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *data,
 				size_t len, bool flush);
 
+/**
+ * @brief Write to the flash in the background.
+ *
+ * The write buffer given to @ref stream_flash_init is split in two halves:
+ * while one is written to the flash by a work queue thread, the other one
+ * is filled by @ref stream_flash_buffered_write, which only waits when both
+ * are full.  With @kconfig{CONFIG_STREAM_FLASH_ERASE} the page the next
+ * buffer goes to is erased ahead, while it is filled.
+ *
+ * A flush write waits for the background write to complete.  The callback
+ * given to @ref stream_flash_init is invoked from the work queue thread, and
+ * @ref stream_flash_bytes_written does not count the bytes still being
+ * written.  Not for use where the kernel cannot schedule, like a fatal error
+ * handler.
+ *
+ * @param ctx context, initialized and not written to yet
+ * @return 0 on success, -EINVAL if the halves of the write buffer are not a
+ *         multiple of the flash device write-block-size, negative errno code
+ *         on other fail
+ */
+int stream_flash_background_enable(struct stream_flash_ctx *ctx);
+
 /**
  * @brief Erase the flash page to which a given offset belongs.
  *
@@ -495,6 +495,18 @@ static inline uint32_t arch_proc_id(void);
  */
 void arch_sched_ipi(void);
 
+/**
+ * Send an interrupt to a set of CPUs
+ *
+ * This will invoke z_sched_ipi() on the CPUs whose bits are set in
+ * @a cpu_bitmap.  The bit for the calling CPU is never set.  Only
+ * available when the architecture selects
+ * CONFIG_ARCH_HAS_DIRECTED_IPIS.
+ *
+ * @param cpu_bitmap Bitmask of the CPU ids to interrupt
+ */
+void arch_sched_directed_ipi(uint32_t cpu_bitmap);
+
 
 int arch_smp_init(void);
 
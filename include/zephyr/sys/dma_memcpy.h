@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Memory copies offloaded to a DMA controller
+ *
+ * @details See CONFIG_SYS_DMA_MEMCPY and the zephyr,dma-memcpy chosen node.
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_DMA_MEMCPY_H_
+#define ZEPHYR_INCLUDE_SYS_DMA_MEMCPY_H_
+
+#include <stddef.h>
+#include <string.h>
+#include <zephyr/sys/slist.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct sys_dma_memcpy;
+
+/**
+ * @brief Completion callback of a copy
+ *
+ * Called from the interrupt of the DMA controller, or from
+ * sys_dma_memcpy_submit() for copies done with the CPU.
+ *
+ * @param req    Completed copy
+ * @param result 0 on success, negative errno code on failure
+ */
+typedef void (*sys_dma_memcpy_done_t)(struct sys_dma_memcpy *req, int result);
+
+/**
+ * @brief Copy request
+ *
+ * Owned by the service from its submission to its completion.
+ */
+struct sys_dma_memcpy {
+	/** @cond INTERNAL_HIDDEN */
+	sys_snode_t node;
+	/** @endcond */
+	/** Destination buffer */
+	void *dst;
+	/** Source buffer */
+	const void *src;
+	/** Number of bytes to copy */
+	size_t len;
+	/** Completion callback */
+	sys_dma_memcpy_done_t done;
+};
+
+#if defined(CONFIG_SYS_DMA_MEMCPY) || defined(__DOXYGEN__)
+
+/**
+ * @brief Queue a copy
+ *
+ * Copies shorter than CONFIG_SYS_DMA_MEMCPY_THRESHOLD, or whose destination
+ * shares data cache lines with other data, are done with the CPU before
+ * returning. The caches are maintained by the service: the CPU must not
+ * access the buffers until the completion.
+ *
+ * @param req Copy to do
+ *
+ * @retval 0 if the copy was queued or done.
+ */
+int sys_dma_memcpy_submit(struct sys_dma_memcpy *req);
+
+/**
+ * @brief Copy a buffer, waiting for the DMA transfer
+ *
+ * Same as memcpy(), using the DMA controller for large copies. From an ISR
+ * the copy is always done with the CPU.
+ *
+ * @param dst Destination buffer
+ * @param src Source buffer
+ * @param len Number of bytes to copy
+ *
+ * @retval 0 on success.
+ * @retval Negative errno code if the DMA transfer failed.
+ */
+int sys_dma_memcpy(void *dst, const void *src, size_t len);
+
+#else
+
+static inline int sys_dma_memcpy_submit(struct sys_dma_memcpy *req)
+{
+	(void)memcpy(req->dst, req->src, req->len);
+	req->done(req, 0);
+
+	return 0;
+}
+
+static inline int sys_dma_memcpy(void *dst, const void *src, size_t len)
+{
+	(void)memcpy(dst, src, len);
+
+	return 0;
+}
+
+#endif /* CONFIG_SYS_DMA_MEMCPY */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_SYS_DMA_MEMCPY_H_ */
@@ -20,6 +20,7 @@
 #include <zephyr/kernel.h>
 #include <zephyr/sys/hash_map_api.h>
 #include <zephyr/sys/hash_map_cxx.h>
+#include <zephyr/sys/hash_map_oa_gp.h>
 #include <zephyr/sys/hash_map_oa_lp.h>
 #include <zephyr/sys/hash_map_sc.h>
 
@@ -240,6 +240,44 @@ const union mpsc_pbuf_generic *mpsc_pbuf_claim(struct mpsc_pbuf_buffer *buffer);
 void mpsc_pbuf_free(struct mpsc_pbuf_buffer *buffer,
 		    const union mpsc_pbuf_generic *packet);
 
+/** @brief Claim a batch of pending packets.
+ *
+ * Claims up to @p max_cnt of the oldest pending packets at once, which is
+ * cheaper than calling mpsc_pbuf_claim() for each of them. Claiming stops
+ * at the first packet which is not committed yet, so returned packets are
+ * consecutive in the buffer.
+ *
+ * Packets must be freed in the order they were claimed, preferably with
+ * mpsc_pbuf_free_batch(), before any other packet is claimed.
+ *
+ * @param buffer Buffer.
+ *
+ * @param[out] items Array where pointers to claimed packets are written.
+ *
+ * @param max_cnt Maximum number of packets to claim.
+ *
+ * @return Number of claimed packets.
+ */
+uint32_t mpsc_pbuf_claim_batch(struct mpsc_pbuf_buffer *buffer,
+			       const union mpsc_pbuf_generic **items,
+			       uint32_t max_cnt);
+
+/** @brief Free a batch of packets.
+ *
+ * Frees packets claimed with mpsc_pbuf_claim_batch(). Unless packets were
+ * overrun by the writers in the meantime, the whole area is released at
+ * once.
+ *
+ * @param buffer Buffer.
+ *
+ * @param items Packets, as returned by mpsc_pbuf_claim_batch().
+ *
+ * @param cnt Number of packets.
+ */
+void mpsc_pbuf_free_batch(struct mpsc_pbuf_buffer *buffer,
+			  const union mpsc_pbuf_generic **items,
+			  uint32_t cnt);
+
 /** @brief Check if there are any message pending.
  *
  * @param buffer Buffer.
@@ -41,12 +41,34 @@ struct k_p4wq_work {
 	};
 	struct k_thread *thread;
 	struct k_p4wq *queue;
+#ifdef CONFIG_P4WQ_CPU_QUEUES
+	struct z_p4wq_cpu_queue *cpu_queue;
+#endif
 };
 
 #define K_P4WQ_QUEUE_PER_THREAD		BIT(0)
 #define K_P4WQ_DELAYED_START		BIT(1)
 #define K_P4WQ_USER_CPU_MASK		BIT(2)
 
+#ifdef CONFIG_P4WQ_CPU_QUEUES
+/* Work items submitted from one CPU, see CONFIG_P4WQ_CPU_QUEUES */
+struct z_p4wq_cpu_queue {
+	struct k_spinlock lock;
+
+	/* Work items waiting for processing */
+	struct rbtree queue;
+
+	/* Work items in progress, taken from this queue */
+	sys_dlist_t active;
+
+	/* Priority and deadline of the first item of the queue, read
+	 * without the lock by the threads looking for work
+	 */
+	atomic_t head_prio;
+	atomic_t head_deadline;
+};
+#endif
+
 /**
  * @brief P4 Queue
  *
@@ -66,11 +88,16 @@ struct k_p4wq {
 	 */
 	_wait_q_t waitq;
 
+#ifdef CONFIG_P4WQ_CPU_QUEUES
+	/* Work items, queued on the CPU which submitted them */
+	struct z_p4wq_cpu_queue cpu_queues[CONFIG_MP_MAX_NUM_CPUS];
+#else
 	/* Work items waiting for processing */
 	struct rbtree queue;
 
 	/* Work items in progress */
 	sys_dlist_t active;
+#endif
 
 	/* K_P4WQ_* flags above */
 	uint32_t flags;
@@ -85,6 +85,21 @@ struct rbnode {
  */
 typedef bool (*rb_lessthan_t)(struct rbnode *a, struct rbnode *b);
 
+/**
+ * @typedef rb_augment_t
+ * @brief Red/black tree augmentation callback
+ *
+ * Recomputes the data a node keeps about its subtree (e.g. its size, or
+ * the maximum end of the intervals below it) from the node itself and
+ * its children, either of which may be NULL.  The children are always
+ * up to date when it is called.
+ *
+ * It is called by the tree for every node whose subtree changes on insert
+ * and remove, including the rotations done to rebalance the tree.
+ */
+typedef void (*rb_augment_t)(struct rbnode *node, struct rbnode *left,
+			     struct rbnode *right);
+
 /**
  * @brief Balanced red/black tree structure
  */
@@ -93,6 +108,8 @@ struct rbtree {
 	struct rbnode *root;
 	/** Comparison function for nodes in the tree */
 	rb_lessthan_t lessthan_fn;
+	/** Optional callback updating augmented node data, or NULL */
+	rb_augment_t augment_fn;
 	/** @cond INTERNAL_HIDDEN */
 	int max_depth;
 #ifdef CONFIG_MISRA_SANE
@@ -126,6 +143,33 @@ void rb_insert(struct rbtree *tree, struct rbnode *node);
  */
 void rb_remove(struct rbtree *tree, struct rbnode *node);
 
+/**
+ * @brief Update the augmented data of a node and its ancestors
+ *
+ * To be called after changing the data of a node in the tree that its
+ * augmented data depends on, without changing its position in the tree.
+ */
+void rb_augment_update(struct rbtree *tree, struct rbnode *node);
+
+/**
+ * @brief Returns the left child of a node, or NULL
+ *
+ * Used to walk down the tree, e.g. in searches making use of augmented
+ * data.
+ */
+static inline struct rbnode *rb_node_left(struct rbnode *node)
+{
+	return z_rb_child(node, 0U);
+}
+
+/**
+ * @brief Returns the right child of a node, or NULL
+ */
+static inline struct rbnode *rb_node_right(struct rbnode *node)
+{
+	return z_rb_child(node, 1U);
+}
+
 /**
  * @brief Returns the lowest-sorted member of the tree
  */
@@ -153,6 +197,27 @@ static inline struct rbnode *rb_get_max(struct rbtree *tree)
  */
 bool rb_contains(struct rbtree *tree, struct rbnode *node);
 
+/**
+ * @brief Returns the lowest-sorted node not less than a key
+ *
+ * The key is a node compared to the members of the tree, which doesn't
+ * need to be in the tree itself.  This is O(log2(N)).
+ *
+ * @return The first node in order that @p key is not greater than, or
+ *         NULL if there is none.
+ */
+struct rbnode *rb_find_ge(struct rbtree *tree, struct rbnode *key);
+
+/**
+ * @brief Returns the highest-sorted node not greater than a key
+ *
+ * The counterpart of rb_find_ge(), also O(log2(N)).
+ *
+ * @return The last node in order that @p key is not less than, or NULL
+ *         if there is none.
+ */
+struct rbnode *rb_find_le(struct rbtree *tree, struct rbnode *key);
+
 #ifndef CONFIG_MISRA_SANE
 /**
  * @brief Walk/enumerate a rbtree
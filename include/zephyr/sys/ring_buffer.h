@@ -486,6 +486,284 @@ int ring_buf_item_put(struct ring_buf *buf, uint16_t type, uint8_t value,
 int ring_buf_item_get(struct ring_buf *buf, uint16_t *type, uint8_t *value,
 		      uint32_t *data, uint8_t *size32);
 
+/**
+ * @brief A segment of a ring buffer, returned by vectored claims.
+ */
+struct ring_buf_vec {
+	/** Start of the segment within the ring buffer. */
+	uint8_t *data;
+	/** Size of the segment (in bytes). */
+	uint32_t size;
+};
+
+/** @cond INTERNAL_HIDDEN */
+/* Indexes are kept modulo 2^24, the upper bits of the put state count the
+ * pending claims.
+ */
+#define RING_BUF_MPSC_IDX_MASK BIT_MASK(24)
+#define RING_BUF_MPSC_PENDING_ONE BIT(24)
+
+#define RING_BUF_MPSC_SIZE_ASSERT_MSG \
+	"Size must be a power of two, at most RING_BUF_MPSC_MAX_SIZE"
+/** @endcond */
+
+/** Maximum size of a multi-producer ring buffer (in bytes). */
+#define RING_BUF_MPSC_MAX_SIZE BIT(23)
+
+/**
+ * @brief A structure to represent a multi-producer ring buffer
+ *
+ * Any number of producers, in threads or ISRs, can put data into it
+ * concurrently without any lock, as space is reserved atomically. Data
+ * becomes visible to the single consumer once all the pending claims
+ * are finished.
+ */
+struct ring_buf_mpsc {
+	/** @cond INTERNAL_HIDDEN */
+	uint8_t *buffer;
+	/* Reserved head and number of pending claims */
+	atomic_t put_state;
+	/* End of the data visible to the consumer */
+	atomic_t put_tail;
+	uint32_t get_head;
+	atomic_t get_tail;
+	uint32_t size;
+	/** @endcond */
+};
+
+/**
+ * @brief Define and initialize a multi-producer ring buffer.
+ *
+ * The ring buffer can be accessed outside the module where it is defined
+ * using:
+ *
+ * @code extern struct ring_buf_mpsc <name>; @endcode
+ *
+ * @param name  Name of the ring buffer.
+ * @param size8 Size of ring buffer (in bytes), a power of two.
+ */
+#define RING_BUF_MPSC_DECLARE(name, size8) \
+	BUILD_ASSERT(IS_POWER_OF_TWO(size8) && \
+		     (size8) <= RING_BUF_MPSC_MAX_SIZE, \
+		     RING_BUF_MPSC_SIZE_ASSERT_MSG); \
+	static uint8_t __noinit _ring_buffer_data_##name[size8]; \
+	struct ring_buf_mpsc name = { \
+		.buffer = _ring_buffer_data_##name, \
+		.size = size8 \
+	}
+
+/**
+ * @brief Initialize a multi-producer ring buffer.
+ *
+ * This routine initializes a ring buffer, prior to its first use. It is only
+ * used for ring buffers not defined using RING_BUF_MPSC_DECLARE.
+ *
+ * @param buf Address of ring buffer.
+ * @param size Ring buffer size (in bytes), a power of two.
+ * @param data Ring buffer data area (uint8_t data[size]).
+ */
+static inline void ring_buf_mpsc_init(struct ring_buf_mpsc *buf,
+				      uint32_t size,
+				      uint8_t *data)
+{
+	__ASSERT(IS_POWER_OF_TWO(size) && size <= RING_BUF_MPSC_MAX_SIZE,
+		 RING_BUF_MPSC_SIZE_ASSERT_MSG);
+
+	buf->size = size;
+	buf->buffer = data;
+	atomic_set(&buf->put_state, 0);
+	atomic_set(&buf->put_tail, 0);
+	buf->get_head = 0;
+	atomic_set(&buf->get_tail, 0);
+}
+
+/**
+ * @brief Determine used space in a multi-producer ring buffer.
+ *
+ * Data of claims which are not finished is not counted.
+ *
+ * @param buf Address of ring buffer.
+ *
+ * @return Ring buffer space used (in bytes).
+ */
+static inline uint32_t ring_buf_mpsc_size_get(struct ring_buf_mpsc *buf)
+{
+	return ((uint32_t)atomic_get(&buf->put_tail) - buf->get_head) &
+	       RING_BUF_MPSC_IDX_MASK;
+}
+
+/**
+ * @brief Determine if a multi-producer ring buffer is empty.
+ *
+ * @param buf Address of ring buffer.
+ *
+ * @return true if the ring buffer is empty, or false if not.
+ */
+static inline bool ring_buf_mpsc_is_empty(struct ring_buf_mpsc *buf)
+{
+	return ring_buf_mpsc_size_get(buf) == 0;
+}
+
+/**
+ * @brief Determine free space in a multi-producer ring buffer.
+ *
+ * @param buf Address of ring buffer.
+ *
+ * @return Ring buffer free space (in bytes).
+ */
+static inline uint32_t ring_buf_mpsc_space_get(struct ring_buf_mpsc *buf)
+{
+	uint32_t head = (uint32_t)atomic_get(&buf->put_state);
+
+	return buf->size - ((head - (uint32_t)atomic_get(&buf->get_tail)) &
+			    RING_BUF_MPSC_IDX_MASK);
+}
+
+/**
+ * @brief Return multi-producer ring buffer capacity.
+ *
+ * @param buf Address of ring buffer.
+ *
+ * @return Ring buffer capacity (in bytes).
+ */
+static inline uint32_t ring_buf_mpsc_capacity_get(struct ring_buf_mpsc *buf)
+{
+	return buf->size;
+}
+
+/**
+ * @brief Allocate buffer for writing data to a multi-producer ring buffer.
+ *
+ * Like @ref ring_buf_put_claim, but it can be called concurrently from any
+ * number of threads and ISRs. The allocated space is reserved for the
+ * caller until it calls @ref ring_buf_mpsc_put_finish, which must follow
+ * every claim, even when nothing was allocated.
+ *
+ * The consumer only gets data once all the claims being written are
+ * finished, so claims should be short and must not block.
+ *
+ * @param[in]  buf  Address of ring buffer.
+ * @param[out] data Pointer to the address. It is set to a location within
+ *		    ring buffer.
+ * @param[in]  size Requested allocation size (in bytes).
+ *
+ * @return Size of allocated buffer which can be smaller than requested if
+ *	   there is not enough free space or buffer wraps.
+ */
+uint32_t ring_buf_mpsc_put_claim(struct ring_buf_mpsc *buf, uint8_t **data,
+				 uint32_t size);
+
+/**
+ * @brief Allocate buffers for writing data to a multi-producer ring buffer.
+ *
+ * Like @ref ring_buf_mpsc_put_claim, but the allocation is not limited by
+ * the end of the ring buffer: it is returned as two segments, the second
+ * one starting at the beginning of the ring buffer, and being empty when
+ * the allocation doesn't wrap.
+ *
+ * @param[in]  buf  Address of ring buffer.
+ * @param[out] vec  Segments of the allocated buffer.
+ * @param[in]  size Requested allocation size (in bytes).
+ *
+ * @return Size of allocated buffer which can be smaller than requested if
+ *	   there is not enough free space.
+ */
+uint32_t ring_buf_mpsc_put_claim_vec(struct ring_buf_mpsc *buf,
+				     struct ring_buf_vec vec[2], uint32_t size);
+
+/**
+ * @brief Indicate that data was written to an allocated buffer.
+ *
+ * Unlike @ref ring_buf_put_finish, every claim must be finished on its own,
+ * with the size it returned: as other producers may have allocated space
+ * after it in the meantime, none of it can be returned to the free space.
+ *
+ * @param buf  Address of ring buffer.
+ * @param size Number of valid bytes in the allocated buffer, which must be
+ *	       the size returned by the claim.
+ *
+ * @retval 0 Successful operation.
+ * @retval -EINVAL There is no claim to finish, or @a size exceeds the
+ *	   allocated buffers.
+ */
+int ring_buf_mpsc_put_finish(struct ring_buf_mpsc *buf, uint32_t size);
+
+/**
+ * @brief Write (copy) data to a multi-producer ring buffer.
+ *
+ * This routine can be called concurrently from any number of threads and
+ * ISRs.
+ *
+ * @param buf Address of ring buffer.
+ * @param data Address of data.
+ * @param size Data size (in bytes).
+ *
+ * @retval Number of bytes written.
+ */
+uint32_t ring_buf_mpsc_put(struct ring_buf_mpsc *buf, const uint8_t *data,
+			   uint32_t size);
+
+/**
+ * @brief Get address of a valid data in a multi-producer ring buffer.
+ *
+ * Like @ref ring_buf_get_claim, from the single consumer of the ring buffer.
+ *
+ * @param[in]  buf  Address of ring buffer.
+ * @param[out] data Pointer to the address. It is set to a location within
+ *		    ring buffer.
+ * @param[in]  size Requested size (in bytes).
+ *
+ * @return Number of valid bytes in the provided buffer which can be smaller
+ *	   than requested if there is not enough free space or buffer wraps.
+ */
+uint32_t ring_buf_mpsc_get_claim(struct ring_buf_mpsc *buf, uint8_t **data,
+				 uint32_t size);
+
+/**
+ * @brief Get addresses of valid data in a multi-producer ring buffer.
+ *
+ * Like @ref ring_buf_mpsc_get_claim, but the data is not limited by the end
+ * of the ring buffer: it is returned as two segments, the second one being
+ * empty when the data doesn't wrap.
+ *
+ * @param[in]  buf  Address of ring buffer.
+ * @param[out] vec  Segments of valid data.
+ * @param[in]  size Requested size (in bytes).
+ *
+ * @return Number of valid bytes in the segments which can be smaller than
+ *	   requested if there is not enough data.
+ */
+uint32_t ring_buf_mpsc_get_claim_vec(struct ring_buf_mpsc *buf,
+				     struct ring_buf_vec vec[2], uint32_t size);
+
+/**
+ * @brief Indicate number of bytes read from claimed buffers.
+ *
+ * Like @ref ring_buf_get_finish, from the single consumer of the ring
+ * buffer.
+ *
+ * @param buf  Address of ring buffer.
+ * @param size Number of bytes that can be freed.
+ *
+ * @retval 0 Successful operation.
+ * @retval -EINVAL Provided @a size exceeds valid bytes in the ring buffer.
+ */
+int ring_buf_mpsc_get_finish(struct ring_buf_mpsc *buf, uint32_t size);
+
+/**
+ * @brief Read data from a multi-producer ring buffer.
+ *
+ * Like @ref ring_buf_get, from the single consumer of the ring buffer.
+ *
+ * @param buf  Address of ring buffer.
+ * @param data Address of the output buffer. Can be NULL to discard data.
+ * @param size Data size (in bytes).
+ *
+ * @retval Number of bytes written to the output buffer.
+ */
+uint32_t ring_buf_mpsc_get(struct ring_buf_mpsc *buf, uint8_t *data,
+			   uint32_t size);
+
 /**
  * @}
  */
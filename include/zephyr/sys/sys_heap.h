@@ -64,6 +64,8 @@ struct z_heap_stress_result {
 	uint32_t successful_allocs;
 	uint32_t total_frees;
 	uint64_t accumulated_in_use_bytes;
+	uint64_t accumulated_failed_in_use_bytes;
+	uint64_t op_cycles;
 };
 
 #ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
@@ -219,7 +221,12 @@ bool sys_heap_validate(struct sys_heap *heap);
  * target_percent full.  Allocation and free operations are provided
  * by the caller as callbacks (i.e. this can in theory test any heap).
  * Results, including counts of frees and successful/unsuccessful
- * allocations, are returned via the @a result struct.
+ * allocations, are returned via the @a result struct.  The bytes in
+ * use are summed both over all iterations and over the failed
+ * allocations only, the latter being a measure of fragmentation (the
+ * lower the fill at which allocations start failing, the worse).  The
+ * hardware cycles spent in the callbacks are summed in @a op_cycles,
+ * giving the throughput of the allocator under test.
  *
  * @param alloc_fn Callback to perform an allocation.  Passes back the @a
  *              arg parameter as a context handle.
@@ -257,6 +264,30 @@ void sys_heap_stress(void *(*alloc_fn)(void *arg, size_t bytes),
  */
 void sys_heap_print_info(struct sys_heap *heap, bool dump_chunks);
 
+/** @brief Callback for @ref sys_heap_free_foreach
+ *
+ * @param start Start address of the free memory
+ * @param size Size of the free memory in bytes
+ * @param user_data User data given to sys_heap_free_foreach
+ */
+typedef void (*sys_heap_free_cb_t)(uintptr_t start, size_t size, void *user_data);
+
+/** @brief Walk the free memory of a heap
+ *
+ * Call @p cb for the memory of each free chunk, minus the heap metadata
+ * it holds. The heap is not locked: this is meant for the fatal error
+ * path, e.g. to leave the free memory out of a core dump, and the walk
+ * stops at the first chunk that looks corrupted.
+ *
+ * @param heap Heap to walk
+ * @param cb Callback called for each free chunk
+ * @param user_data User data passed to the callback
+ *
+ * @retval 0 once all the chunks were walked
+ * @retval -EINVAL if a corrupted chunk stopped the walk
+ */
+int sys_heap_free_foreach(struct sys_heap *heap, sys_heap_free_cb_t cb, void *user_data);
+
 
 #ifdef __cplusplus
 }
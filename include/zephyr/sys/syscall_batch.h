@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Batched system calls
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_SYSCALL_BATCH_H_
+#define ZEPHYR_INCLUDE_SYS_SYSCALL_BATCH_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/sys/util_macro.h>
+#include <zephyr/toolchain.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup syscall_batch_apis Batched System Call APIs
+ * @ingroup usermode_apis
+ * @{
+ */
+
+/**
+ * @brief One system call of a batch
+ *
+ * Like a submission queue entry, this names the system call by its
+ * K_SYSCALL_* identifier from the generated syscall_list.h and holds its
+ * arguments as they are passed to the system call handler. Like a
+ * completion queue entry, it gets the value returned by the handler.
+ */
+struct k_syscall_batch_entry {
+	/** System call identifier, K_SYSCALL_* */
+	uintptr_t id;
+
+	/** Arguments, one register-sized word each */
+	uintptr_t args[6];
+
+	/** Return value of the system call, set by k_syscall_batch() */
+	uintptr_t ret;
+};
+
+/** @cond INTERNAL_HIDDEN */
+#define Z_SYSCALL_BATCH_ARG(arg) ((uintptr_t)(arg))
+/** @endcond */
+
+/**
+ * @brief Initializer for a batch entry
+ *
+ * Every argument is cast to uintptr_t, so this only works for system
+ * calls whose arguments each fit in a register. Use
+ * k_syscall_batch_arg64_set() for wider arguments.
+ *
+ * @param _id System call identifier, K_SYSCALL_*
+ * @param ... Up to six arguments of the system call
+ */
+#define K_SYSCALL_BATCH_ENTRY(_id, ...) \
+	{ \
+		.id = (_id), \
+		.args = { FOR_EACH(Z_SYSCALL_BATCH_ARG, (,), __VA_ARGS__) }, \
+	}
+
+/**
+ * @brief Set a 64-bit argument of a batch entry
+ *
+ * On 32-bit targets, 64-bit arguments, which include k_timeout_t with
+ * CONFIG_TIMEOUT_64BIT, are passed to system call handlers in two words,
+ * the same way the generated system call wrappers pass them. Set the
+ * ticks of a k_timeout_t argument this way.
+ *
+ * @param entry Batch entry
+ * @param idx Index of the first argument word taken by the value
+ * @param value Value of the argument
+ */
+static inline void k_syscall_batch_arg64_set(struct k_syscall_batch_entry *entry,
+					     size_t idx, uint64_t value)
+{
+	if (sizeof(uintptr_t) >= sizeof(uint64_t)) {
+		entry->args[idx] = (uintptr_t)value;
+	} else {
+		union {
+			struct {
+				uintptr_t lo, hi;
+			} split;
+			uint64_t val;
+		} parm = { .val = value };
+
+		entry->args[idx] = parm.split.lo;
+		entry->args[idx + 1] = parm.split.hi;
+	}
+}
+
+/**
+ * @brief Invoke several system calls with one privilege transition
+ *
+ * Runs the system calls of @a entries in order, each with the same
+ * argument checks as if it were invoked on its own, and stores the
+ * value each one returns in its entry. If one of the system calls fails
+ * its checks, the calling thread is terminated as it would be by that
+ * system call, and the later entries are not run.
+ *
+ * Where a system call returns a 64-bit value on a 32-bit target, its
+ * last argument word is taken as a pointer to where the value is
+ * stored, as the generated wrappers do. Where a system call needs more
+ * than six argument words, the sixth is a pointer to the remaining
+ * words.
+ *
+ * Only user threads can batch system calls, as supervisor threads call
+ * the kernel directly.
+ *
+ * @param entries System calls to invoke
+ * @param count Number of entries, at most CONFIG_SYSCALL_BATCH_MAX_ENTRIES
+ *
+ * @retval 0 All the system calls of the batch were invoked
+ * @retval -EINVAL Too many entries
+ * @retval -ENOTSUP Called from supervisor mode
+ */
+__syscall int k_syscall_batch(struct k_syscall_batch_entry *entries,
+			      size_t count);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#include <syscalls/syscall_batch.h>
+
+#endif /* ZEPHYR_INCLUDE_SYS_SYSCALL_BATCH_H_ */
@@ -1994,6 +1994,29 @@
 
 /** @} */ /* end of subsys_tracing_apis_pm_device_runtime */
 
+/**
+ * @brief System Init Tracing APIs
+ * @defgroup subsys_tracing_apis_sys_init System Init Tracing APIs
+ * @{
+ */
+
+/**
+ * @brief Trace running an init entry entry.
+ * @param entry Init entry, for a device or a SYS_INIT() function.
+ * @param level Init level.
+ */
+#define sys_port_trace_sys_init_enter(entry, level)
+
+/**
+ * @brief Trace running an init entry exit.
+ * @param entry Init entry, for a device or a SYS_INIT() function.
+ * @param level Init level.
+ * @param result Return value of the init function.
+ */
+#define sys_port_trace_sys_init_exit(entry, level, result)
+
+/** @} */ /* end of subsys_tracing_apis_sys_init */
+
 #if defined(CONFIG_PERCEPIO_TRACERECORDER)
 #include "tracing_tracerecorder.h"
 #else
@@ -28,12 +28,19 @@
 #define ACM_SUBCLASS			0x02
 #define ECM_SUBCLASS			0x06
 #define EEM_SUBCLASS			0x0c
+#define NCM_SUBCLASS			0x0d
 
 /** Communications Class Protocol Codes */
 #define AT_CMD_V250_PROTOCOL		0x01
 #define EEM_PROTOCOL			0x07
 #define ACM_VENDOR_PROTOCOL		0xFF
 
+/**
+ * @brief Data Class Protocol Code of the NCM data interface
+ * @note NCM10.pdf, 4.2, Table 4-2
+ */
+#define NCM_DATA_PROTOCOL		0x01
+
 /**
  * @brief Data Class Interface Codes
  * @note CDC120-20101103-track.pdf, 4.5, Table 6
@@ -50,6 +57,7 @@
 #define ACM_FUNC_DESC			0x02
 #define UNION_FUNC_DESC			0x06
 #define ETHERNET_FUNC_DESC		0x0F
+#define NCM_FUNC_DESC			0x1A
 
 /**
  * @brief PSTN Subclass Specific Requests
@@ -139,6 +147,22 @@
 #define SET_ETHERNET_PACKET_FILTER	0x43
 #define GET_ETHERNET_STATISTIC		0x44
 
+/**
+ * @brief Class-Specific Request Codes for NCM subclass
+ * @note NCM10.pdf, 6.2, Table 6-2
+ */
+#define GET_NTB_PARAMETERS		0x80
+#define GET_NET_ADDRESS			0x81
+#define SET_NET_ADDRESS			0x82
+#define GET_NTB_FORMAT			0x83
+#define SET_NTB_FORMAT			0x84
+#define GET_NTB_INPUT_SIZE		0x85
+#define SET_NTB_INPUT_SIZE		0x86
+#define GET_MAX_DATAGRAM_SIZE		0x87
+#define SET_MAX_DATAGRAM_SIZE		0x88
+#define GET_CRC_MODE			0x89
+#define SET_CRC_MODE			0x8A
+
 /** Ethernet Packet Filter Bitmap */
 #define PACKET_TYPE_MULTICAST		0x10
 #define PACKET_TYPE_BROADCAST		0x08
@@ -210,4 +234,13 @@ struct cdc_ecm_descriptor {
 	uint8_t bNumberPowerFilters;
 } __packed;
 
+/** NCM Functional Descriptor */
+struct cdc_ncm_descriptor {
+	uint8_t bFunctionLength;
+	uint8_t bDescriptorType;
+	uint8_t bDescriptorSubtype;
+	uint16_t bcdNcmVersion;
+	uint8_t bmNetworkCapabilities;
+} __packed;
+
 #endif /* ZEPHYR_INCLUDE_USB_CLASS_USB_CDC_H_ */
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief USBD CDC ACM raw bulk API public header
+ *
+ * Header exposes API to exchange net_buf buffers directly with the bulk
+ * endpoints of a CDC ACM instance, bypassing the UART FIFOs.
+ */
+
+#ifndef ZEPHYR_INCLUDE_USB_CLASS_USBD_CDC_ACM_H_
+#define ZEPHYR_INCLUDE_USB_CLASS_USBD_CDC_ACM_H_
+
+#include <zephyr/device.h>
+#include <zephyr/kernel.h>
+#include <zephyr/net/buf.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Raw RX callback
+ *
+ * Called from the USB device stack thread with the data of a completed
+ * bulk OUT transfer. The callback owns the buffer and must release it with
+ * net_buf_unref() once done, the next transfers being queued as buffers
+ * return to the pool.
+ *
+ * @param dev       CDC ACM device
+ * @param buf       Received data
+ * @param user_data User data given to usbd_cdc_acm_rx_cb_set()
+ */
+typedef void (*usbd_cdc_acm_rx_cb_t)(const struct device *dev,
+				     struct net_buf *buf, void *user_data);
+
+/**
+ * @brief Allocate a buffer for the bulk IN endpoint
+ *
+ * The buffer comes from the bulk transfer pool of the class, sized by
+ * CONFIG_USBD_CDC_ACM_BULK_BUFS, and holds up to 512 bytes.
+ *
+ * @param dev     CDC ACM device
+ * @param timeout Time to wait for a free buffer
+ *
+ * @return Buffer, or NULL if none was available in time.
+ */
+struct net_buf *usbd_cdc_acm_buf_alloc(const struct device *dev,
+				       k_timeout_t timeout);
+
+/**
+ * @brief Queue a buffer on the bulk IN endpoint without copying it
+ *
+ * The buffer must have been allocated with usbd_cdc_acm_buf_alloc() and is
+ * owned by the class from then on, also on failure. Transfers queued this
+ * way delay the data of the UART TX FIFO until they complete.
+ *
+ * @param dev CDC ACM device
+ * @param buf Data to send
+ *
+ * @retval 0 on success.
+ * @retval -EACCES if the USB configuration is not enabled or suspended.
+ * @retval Negative errno code if the transfer could not be queued.
+ */
+int usbd_cdc_acm_submit(const struct device *dev, struct net_buf *buf);
+
+/**
+ * @brief Receive the bulk OUT transfers with a callback
+ *
+ * With a callback set, the data received from the host is passed to it
+ * instead of being copied in the UART RX FIFO, and the transfers are not
+ * throttled by the space left in the FIFO. Pass NULL to go back to the
+ * UART API.
+ *
+ * @param dev       CDC ACM device
+ * @param cb        Raw RX callback, or NULL
+ * @param user_data User data passed to the callback
+ */
+void usbd_cdc_acm_rx_cb_set(const struct device *dev, usbd_cdc_acm_rx_cb_t cb,
+			    void *user_data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_USB_CLASS_USBD_CDC_ACM_H_ */
@@ -48,8 +48,18 @@ struct zbus_channel_data {
 	 * notification process avoiding preemptions.
 	 */
 	int highest_observer_priority;
+
+	/** Priority the loaning thread had before it was boosted. */
+	int loan_priority;
 #endif /* CONFIG_ZBUS_PRIORITY_BOOST */
 
+#if defined(CONFIG_ZBUS_CHANNEL_SEQLOCK) || defined(__DOXYGEN__)
+	/** Sequence counter of the message. Odd while the message is being written, used by the
+	 * lock-free readers to detect a concurrent write.
+	 */
+	atomic_t seq;
+#endif /* CONFIG_ZBUS_CHANNEL_SEQLOCK */
+
 #if defined(CONFIG_ZBUS_RUNTIME_OBSERVERS) || defined(__DOXYGEN__)
 	/** Channel observer list. Represents the channel's observers list, it can be empty
 	 * or have listeners and subscribers mixed in any sequence. It can be changed in runtime.
@@ -533,6 +543,73 @@ int zbus_chan_pub(const struct zbus_channel *chan, const void *msg, k_timeout_t
  */
 int zbus_chan_read(const struct zbus_channel *chan, void *msg, k_timeout_t timeout);
 
+#if defined(CONFIG_ZBUS_CHANNEL_SEQLOCK) || defined(__DOXYGEN__)
+
+/**
+ * @brief Read a channel without locking it
+ *
+ * This routine copies the message of a channel without taking the channel semaphore, so the
+ * reader never delays a publisher. The copy is retried when a write happened meanwhile. If the
+ * channel is still being written after a few attempts, the routine falls back to zbus_chan_read.
+ *
+ * @param[in] chan The channel's reference.
+ * @param[out] msg Reference to the message where the read function copies the channel's
+ * message data to.
+ * @param[in] timeout Waiting period to read the channel in the fallback case,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Channel read.
+ * @retval -EBUSY The channel is busy.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EFAULT A parameter is incorrect. The function only returns this value when the
+ * CONFIG_ZBUS_ASSERT_MOCK is enabled.
+ */
+int zbus_chan_read_lockfree(const struct zbus_channel *chan, void *msg, k_timeout_t timeout);
+
+#endif /* CONFIG_ZBUS_CHANNEL_SEQLOCK */
+
+/**
+ * @brief Loan the message of a channel for an in place publication
+ *
+ * This routine locks the channel like zbus_chan_pub does and gives the channel's message to the
+ * caller, which writes the new message directly into it and publishes it with
+ * zbus_chan_loan_pub. It saves the copy of the message done by zbus_chan_pub.
+ *
+ * Channels with a validator cannot be loaned, since the message is changed before it could be
+ * validated.
+ *
+ * @param[in] chan The channel's reference.
+ * @param[out] msg Reference to the channel's message.
+ * @param[in] timeout Waiting period to lock the channel,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Channel loaned.
+ * @retval -ENOTSUP The channel has a validator.
+ * @retval -EBUSY The channel is busy.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EFAULT A parameter is incorrect. The function only returns this value when the
+ * CONFIG_ZBUS_ASSERT_MOCK is enabled.
+ */
+int zbus_chan_loan(const struct zbus_channel *chan, void **msg, k_timeout_t timeout);
+
+/**
+ * @brief Publish the message written in a loaned channel
+ *
+ * This routine notifies the channel's observers of the message written after zbus_chan_loan,
+ * and unlocks the channel. It must be called from the thread that loaned the channel.
+ *
+ * @param[in] chan The channel's reference.
+ * @param[in] timeout Waiting period to notify the observers,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Channel published.
+ * @retval -ENOMEM Some of the message subscribers could not receive the message.
+ * @retval -EAGAIN Waiting period timed out for some of the subscribers.
+ * @retval -EFAULT A parameter is incorrect. The function only returns this value when the
+ * CONFIG_ZBUS_ASSERT_MOCK is enabled.
+ */
+int zbus_chan_loan_pub(const struct zbus_channel *chan, k_timeout_t timeout);
+
 /**
  * @brief Claim a channel
  *
@@ -893,6 +970,29 @@ int zbus_sub_wait(const struct zbus_observer *sub, const struct zbus_channel **c
 int zbus_sub_wait_msg(const struct zbus_observer *sub, const struct zbus_channel **chan, void *msg,
 		      k_timeout_t timeout);
 
+struct net_buf;
+
+/**
+ * @brief Wait for a channel message, without copying it.
+ *
+ * This routine works like zbus_sub_wait_msg, but gives the buffer holding the message instead of
+ * a copy. The buffer data is shared by all the message subscribers of the publication and must
+ * not be modified. The caller releases it with net_buf_unref.
+ *
+ * @param[in] sub The subscriber's reference.
+ * @param[out] chan The notification channel's reference.
+ * @param[out] buf The buffer holding the published message.
+ * @param[in] timeout Waiting period for a notification arrival,
+ *                or one of the special values, K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Message received.
+ * @retval -ENOMSG Could not retrieve the net_buf from the subscriber FIFO.
+ * @retval -EFAULT A parameter is incorrect, or the function context is invalid (inside an ISR). The
+ * function only returns this value when the @kconfig{CONFIG_ZBUS_ASSERT_MOCK} is enabled.
+ */
+int zbus_sub_wait_msg_buf(const struct zbus_observer *sub, const struct zbus_channel **chan,
+			  struct net_buf **buf, k_timeout_t timeout);
+
 #endif /* CONFIG_ZBUS_MSG_SUBSCRIBER */
 
 /**
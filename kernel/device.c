@@ -12,6 +12,91 @@
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/toolchain.h>
 
+#ifdef CONFIG_DEVICE_NAME_INDEX
+/* Order of the name index: by name, then by position in the device
+ * section, so that the first ready device of a duplicated name is the one
+ * the linear lookup would return.
+ */
+static int device_name_cmp(const struct device *a, const struct device *b)
+{
+	int ret = strcmp(a->name, b->name);
+
+	if (ret != 0) {
+		return ret;
+	}
+
+	return (a < b) ? -1 : ((a > b) ? 1 : 0);
+}
+
+/* Binary insertion sort: the number of name comparisons is O(n log n),
+ * and moving the pointers is cheap next to them.
+ */
+static void device_name_index_sort(void)
+{
+	struct z_device_name_slot *slots;
+	size_t cnt;
+
+	STRUCT_SECTION_GET(z_device_name_slot, 0, &slots);
+	STRUCT_SECTION_COUNT(z_device_name_slot, &cnt);
+
+	for (size_t i = 1; i < cnt; i++) {
+		const struct device *dev = slots[i].dev;
+		size_t lo = 0;
+		size_t hi = i;
+
+		while (lo < hi) {
+			size_t mid = lo + (hi - lo) / 2;
+
+			if (device_name_cmp(slots[mid].dev, dev) < 0) {
+				lo = mid + 1;
+			} else {
+				hi = mid;
+			}
+		}
+
+		memmove(&slots[lo + 1], &slots[lo], (i - lo) * sizeof(slots[0]));
+		slots[lo].dev = dev;
+	}
+}
+
+static const struct device *device_name_index_find(const char *name)
+{
+	struct z_device_name_slot *slots;
+	size_t cnt;
+	size_t lo = 0;
+	size_t hi;
+
+	STRUCT_SECTION_GET(z_device_name_slot, 0, &slots);
+	STRUCT_SECTION_COUNT(z_device_name_slot, &cnt);
+
+	/* Find the first entry not ordered before name */
+	hi = cnt;
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+
+		if (strcmp(slots[mid].dev->name, name) < 0) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	for (; lo < cnt; lo++) {
+		const struct device *dev = slots[lo].dev;
+
+		if (strcmp(dev->name, name) != 0) {
+			break;
+		}
+
+		if (z_device_is_ready(dev)) {
+			return dev;
+		}
+	}
+
+	return NULL;
+}
+#endif /* CONFIG_DEVICE_NAME_INDEX */
+
 /**
  * @brief Initialize state for all static devices.
  *
@@ -23,6 +108,10 @@ void z_device_state_init(void)
 	STRUCT_SECTION_FOREACH(device, dev) {
 		k_object_init(dev);
 	}
+
+#ifdef CONFIG_DEVICE_NAME_INDEX
+	device_name_index_sort();
+#endif
 }
 
 const struct device *z_impl_device_get_binding(const char *name)
@@ -34,6 +123,9 @@ const struct device *z_impl_device_get_binding(const char *name)
 		return NULL;
 	}
 
+#ifdef CONFIG_DEVICE_NAME_INDEX
+	return device_name_index_find(name);
+#else
 	/* Split the search into two loops: in the common scenario, where
 	 * device names are stored in ROM (and are referenced by the user
 	 * with CONFIG_* macros), only cheap pointer comparisons will be
@@ -52,6 +144,7 @@ const struct device *z_impl_device_get_binding(const char *name)
 	}
 
 	return NULL;
+#endif /* CONFIG_DEVICE_NAME_INDEX */
 }
 
 #ifdef CONFIG_USERSPACE
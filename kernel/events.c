@@ -18,6 +18,10 @@
  * Threads waiting on an event object have the option of either waking once
  * any or all of the events it desires have been posted to the event object.
  *
+ * With CONFIG_EVENTS_INDEXED_WAITERS, threads waiting for all of a set of
+ * events, or for a single event, wait on the wait queue of one event they
+ * still need, and only the wait queues of newly posted events are walked.
+ *
  * @brief Kernel event object
  */
 
@@ -30,6 +34,7 @@
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/tracing/tracing.h>
 #include <zephyr/sys/check.h>
+#include <zephyr/sys/math_extras.h>
 /* private kernel APIs */
 #include <wait_q.h>
 #include <ksched.h>
@@ -43,6 +48,9 @@
 struct event_walk_data {
 	struct k_thread  *head;
 	uint32_t events;
+#ifdef CONFIG_EVENTS_INDEXED_WAITERS
+	struct k_thread  *move_head;
+#endif
 };
 
 #ifdef CONFIG_OBJ_CORE_EVENT
@@ -57,6 +65,11 @@ void z_impl_k_event_init(struct k_event *event)
 	SYS_PORT_TRACING_OBJ_INIT(k_event, event);
 
 	z_waitq_init(&event->wait_q);
+#ifdef CONFIG_EVENTS_INDEXED_WAITERS
+	for (unsigned int i = 0; i < ARRAY_SIZE(event->bit_wait_q); i++) {
+		z_waitq_init(&event->bit_wait_q[i]);
+	}
+#endif
 
 	k_object_init(event);
 
@@ -128,6 +141,80 @@ static int event_walk_op(struct k_thread *thread, void *data)
 	return 0;
 }
 
+/**
+ * @brief get the wait queue to wait on for a desired set of events
+ *
+ * Threads waiting for all of the desired events are queued by the lowest
+ * of them which is not set yet, and threads waiting for a single event by
+ * that event. As a pending thread is not satisfied with the current set of
+ * events, it can then only be woken by setting the event it's queued by.
+ */
+static _wait_q_t *event_wait_q_get(struct k_event *event, uint32_t desired,
+				   unsigned int wait_condition)
+{
+#ifdef CONFIG_EVENTS_INDEXED_WAITERS
+	if (wait_condition == K_EVENT_WAIT_ALL) {
+		desired &= ~event->events;
+	}
+
+	if ((wait_condition == K_EVENT_WAIT_ALL) || IS_POWER_OF_TWO(desired)) {
+		return &event->bit_wait_q[u32_count_trailing_zeros(desired)];
+	}
+#else
+	ARG_UNUSED(desired);
+	ARG_UNUSED(wait_condition);
+#endif
+
+	return &event->wait_q;
+}
+
+#ifdef CONFIG_EVENTS_INDEXED_WAITERS
+static int event_bit_walk_op(struct k_thread *thread, void *data)
+{
+	struct event_walk_data *event_data = data;
+	struct k_thread *head = event_data->head;
+
+	(void)event_walk_op(thread, data);
+
+	if (event_data->head == head) {
+		/*
+		 * The thread still needs more events. It can't be moved to
+		 * their wait queue while the wait queue is being walked, so
+		 * add it to the list of threads to move.
+		 */
+		thread->next_event_link = event_data->move_head;
+		event_data->move_head = thread;
+	}
+
+	return 0;
+}
+
+/* Walk the wait queues of the newly set events */
+static void event_bit_walk(struct k_event *event, uint32_t new_events,
+			   struct event_walk_data *data)
+{
+	struct k_thread *thread;
+	struct k_thread *next;
+	_wait_q_t *wait_q;
+
+	while (new_events != 0U) {
+		wait_q = &event->bit_wait_q[u32_count_trailing_zeros(new_events)];
+		new_events &= new_events - 1U;
+
+		data->move_head = NULL;
+		z_sched_waitq_walk(wait_q, event_bit_walk_op, data);
+
+		/* The events these threads are moved by were not newly set */
+		for (thread = data->move_head; thread != NULL; thread = next) {
+			next = thread->next_event_link;
+			z_sched_waitq_move(thread, wait_q,
+					   event_wait_q_get(event, thread->events,
+							    K_EVENT_WAIT_ALL));
+		}
+	}
+}
+#endif /* CONFIG_EVENTS_INDEXED_WAITERS */
+
 static uint32_t k_event_post_internal(struct k_event *event, uint32_t events,
 				  uint32_t events_mask)
 {
@@ -135,6 +222,9 @@ static uint32_t k_event_post_internal(struct k_event *event, uint32_t events,
 	struct k_thread  *thread;
 	struct event_walk_data data;
 	uint32_t previous_events;
+#ifdef CONFIG_EVENTS_INDEXED_WAITERS
+	uint32_t new_events;
+#endif
 
 	data.head = NULL;
 	key = k_spin_lock(&event->lock);
@@ -145,6 +235,9 @@ static uint32_t k_event_post_internal(struct k_event *event, uint32_t events,
 	previous_events = event->events & events_mask;
 	events = (event->events & ~events_mask) |
 		 (events & events_mask);
+#ifdef CONFIG_EVENTS_INDEXED_WAITERS
+	new_events = events & ~event->events;
+#endif
 	event->events = events;
 	data.events = events;
 	/*
@@ -157,7 +250,18 @@ static uint32_t k_event_post_internal(struct k_event *event, uint32_t events,
 	 * 3. Ready each of the threads in the linked list
 	 */
 
+#ifdef CONFIG_EVENTS_INDEXED_WAITERS
+	/*
+	 * Pending threads are not satisfied with the previous set of events,
+	 * so only newly set events can wake any of them.
+	 */
+	if (new_events != 0U) {
+		z_sched_waitq_walk(&event->wait_q, event_walk_op, &data);
+		event_bit_walk(event, new_events, &data);
+	}
+#else
 	z_sched_waitq_walk(&event->wait_q, event_walk_op, &data);
+#endif
 
 	if (data.head != NULL) {
 		thread = data.head;
@@ -291,7 +395,9 @@ static uint32_t k_event_wait_internal(struct k_event *event, uint32_t events,
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_event, wait, event, events,
 					   options, timeout);
 
-	if (z_pend_curr(&event->lock, key, &event->wait_q, timeout) == 0) {
+	if (z_pend_curr(&event->lock, key,
+			event_wait_q_get(event, events, wait_condition),
+			timeout) == 0) {
 		/* Retrieve the set of events that woke the thread */
 		rv = thread->events;
 	}
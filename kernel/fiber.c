@@ -0,0 +1,256 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/kernel/fiber.h>
+#include <kernel_arch_interface.h>
+
+/* Fibers are switched with the same primitive as threads, but without
+ * going through the scheduler: the kernel only ever sees the thread
+ * running the host, whichever fiber that thread currently runs.
+ */
+static void fiber_switch(struct k_thread *from, struct k_thread *to)
+{
+	unsigned int key = arch_irq_lock();
+
+#ifdef CONFIG_THREAD_LOCAL_STORAGE
+	/* Fibers use the thread local storage of the host thread */
+	to->tls = _current->tls;
+#endif
+
+	arch_switch(to->switch_handle, &from->switch_handle);
+
+	arch_irq_unlock(key);
+}
+
+/* Switch from @a from to the next ready fiber, or to the host thread if
+ * there is none.
+ */
+static void fiber_schedule(struct k_fiber_host *host, struct k_thread *from)
+{
+	sys_dnode_t *node = sys_dlist_get(&host->ready);
+	struct k_fiber *next = NULL;
+	struct k_thread *to = &host->ctx;
+
+	if (node != NULL) {
+		next = CONTAINER_OF(node, struct k_fiber, node);
+		to = &next->ctx;
+	}
+
+	host->current = next;
+
+	if (to != from) {
+		fiber_switch(from, to);
+	}
+}
+
+static void fiber_entry(void *p1, void *p2, void *p3)
+{
+	struct k_fiber *fiber = p1;
+	struct k_fiber_host *host = fiber->host;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	fiber->entry(fiber->p1, fiber->p2, fiber->p3);
+
+	host->num_fibers--;
+	fiber_schedule(host, &fiber->ctx);
+
+	CODE_UNREACHABLE;
+}
+
+static void fiber_wait(struct k_fiber_host *host, struct k_fiber *fiber,
+		       struct k_poll_event *events, int num_events,
+		       k_timepoint_t end)
+{
+	fiber->events = events;
+	fiber->num_events = num_events;
+	fiber->end = end;
+
+	sys_dlist_append(&host->waiting, &fiber->node);
+	fiber_schedule(host, &fiber->ctx);
+}
+
+/* Wait until any of the waiting fibers can run again */
+static void fiber_host_wait(struct k_fiber_host *host)
+{
+	k_timepoint_t end = sys_timepoint_calc(K_FOREVER);
+	k_timeout_t timeout;
+	struct k_fiber *fiber, *next;
+	int num_events = 0;
+	int i = 0;
+
+	SYS_DLIST_FOR_EACH_CONTAINER(&host->waiting, fiber, node) {
+		if (num_events + fiber->num_events > host->max_events) {
+			/* No room to poll its events, fall back to the fiber
+			 * polling them itself
+			 */
+			end = sys_timepoint_calc(K_NO_WAIT);
+			continue;
+		}
+
+		(void)memcpy(&host->events[num_events], fiber->events,
+			     fiber->num_events * sizeof(*fiber->events));
+		for (int j = 0; j < fiber->num_events; j++) {
+			host->events[num_events + j].state =
+				K_POLL_STATE_NOT_READY;
+		}
+		num_events += fiber->num_events;
+
+		if (sys_timepoint_cmp(fiber->end, end) < 0) {
+			end = fiber->end;
+		}
+	}
+
+	timeout = sys_timepoint_timeout(end);
+	if (num_events > 0) {
+		(void)k_poll(host->events, num_events, timeout);
+	} else if (!K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		(void)k_sleep(timeout);
+	}
+
+	SYS_DLIST_FOR_EACH_CONTAINER_SAFE(&host->waiting, fiber, next, node) {
+		bool ready = sys_timepoint_expired(fiber->end);
+
+		if (i + fiber->num_events > host->max_events) {
+			ready = true;
+		} else {
+			for (int j = 0; j < fiber->num_events; j++) {
+				if (host->events[i + j].state !=
+				    K_POLL_STATE_NOT_READY) {
+					ready = true;
+				}
+			}
+			i += fiber->num_events;
+		}
+
+		if (ready) {
+			sys_dlist_remove(&fiber->node);
+			sys_dlist_append(&host->ready, &fiber->node);
+		}
+	}
+}
+
+void k_fiber_host_init(struct k_fiber_host *host, struct k_poll_event *events,
+		       int max_events)
+{
+	(void)memset(host, 0, sizeof(*host));
+	sys_dlist_init(&host->ready);
+	sys_dlist_init(&host->waiting);
+	host->events = events;
+	host->max_events = max_events;
+}
+
+void k_fiber_host_run(struct k_fiber_host *host)
+{
+	__ASSERT(_current->fiber_host == NULL, "thread already runs a fiber host");
+
+	_current->fiber_host = host;
+
+	while (host->num_fibers > 0) {
+		/* Returns once no fiber is ready */
+		fiber_schedule(host, &host->ctx);
+
+		if (host->num_fibers > 0) {
+			fiber_host_wait(host);
+		}
+	}
+
+	_current->fiber_host = NULL;
+}
+
+void k_fiber_create(struct k_fiber_host *host, struct k_fiber *fiber,
+		    k_thread_stack_t *stack, size_t stack_size,
+		    k_thread_entry_t entry, void *p1, void *p2, void *p3)
+{
+	char *stack_ptr = (char *)stack + Z_KERNEL_STACK_SIZE_ADJUST(stack_size);
+
+	(void)memset(&fiber->ctx, 0, sizeof(fiber->ctx));
+	arch_new_thread(&fiber->ctx, stack, stack_ptr, fiber_entry,
+			fiber, NULL, NULL);
+
+	fiber->host = host;
+	fiber->entry = entry;
+	fiber->p1 = p1;
+	fiber->p2 = p2;
+	fiber->p3 = p3;
+
+	host->num_fibers++;
+	sys_dlist_append(&host->ready, &fiber->node);
+}
+
+struct k_fiber *k_fiber_current_get(void)
+{
+	struct k_fiber_host *host = _current->fiber_host;
+
+	return (host != NULL) ? host->current : NULL;
+}
+
+void k_fiber_yield(void)
+{
+	struct k_fiber *fiber = k_fiber_current_get();
+
+	__ASSERT(fiber != NULL, "not called from a fiber");
+
+	sys_dlist_append(&fiber->host->ready, &fiber->node);
+	fiber_schedule(fiber->host, &fiber->ctx);
+}
+
+void k_fiber_sleep(k_timeout_t timeout)
+{
+	struct k_fiber *fiber = k_fiber_current_get();
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+
+	__ASSERT(fiber != NULL, "not called from a fiber");
+
+	while (!sys_timepoint_expired(end)) {
+		fiber_wait(fiber->host, fiber, NULL, 0, end);
+	}
+}
+
+int k_fiber_poll(struct k_poll_event *events, int num_events,
+		 k_timeout_t timeout)
+{
+	struct k_fiber *fiber = k_fiber_current_get();
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	int ret;
+
+	__ASSERT(fiber != NULL, "not called from a fiber");
+
+	for (;;) {
+		ret = k_poll(events, num_events, K_NO_WAIT);
+		if ((ret != -EAGAIN) || sys_timepoint_expired(end)) {
+			return ret;
+		}
+
+		fiber_wait(fiber->host, fiber, events, num_events, end);
+	}
+}
+
+int k_fiber_sem_take(struct k_sem *sem, k_timeout_t timeout)
+{
+	struct k_poll_event event;
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	int ret;
+
+	k_poll_event_init(&event, K_POLL_TYPE_SEM_AVAILABLE,
+			  K_POLL_MODE_NOTIFY_ONLY, sem);
+
+	while (k_sem_take(sem, K_NO_WAIT) != 0) {
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			return -EBUSY;
+		}
+
+		ret = k_fiber_poll(&event, 1, sys_timepoint_timeout(end));
+		if (ret != 0) {
+			return ret;
+		}
+	}
+
+	return 0;
+}
@@ -223,6 +223,16 @@ void z_thread_mark_switched_out(void);
 
 #endif /* CONFIG_INSTRUMENT_THREAD_SWITCHING */
 
+#ifdef CONFIG_USERSPACE_VDSO
+/* Publish the tick count in the user readable kernel data */
+void z_vdso_ticks_update(uint64_t ticks);
+
+#ifndef CONFIG_SMP
+/* Publish the thread switched in, in the user readable kernel data */
+void z_vdso_current_update(struct k_thread *thread);
+#endif
+#endif /* CONFIG_USERSPACE_VDSO */
+
 /* Init hook for page frame management, invoked immediately upon entry of
  * main thread, before POST_KERNEL tasks
  */
@@ -311,6 +321,43 @@ int z_kernel_stats_raw(struct k_obj_core *obj_core, void *stats);
 int z_kernel_stats_query(struct k_obj_core *obj_core, void *stats);
 #endif
 
+struct init_entry;
+struct init_profile_record;
+
+#ifdef CONFIG_INIT_PROFILING
+struct init_profile_record *z_init_profile_start(const struct init_entry *entry,
+						 int level);
+void z_init_profile_end(struct init_profile_record *record, int result);
+void z_init_profile_cstart(void);
+void z_init_profile_main(void);
+#else
+static inline struct init_profile_record *
+z_init_profile_start(const struct init_entry *entry, int level)
+{
+	ARG_UNUSED(entry);
+	ARG_UNUSED(level);
+
+	return NULL;
+}
+
+static inline void z_init_profile_end(struct init_profile_record *record,
+				      int result)
+{
+	ARG_UNUSED(record);
+	ARG_UNUSED(result);
+}
+
+static inline void z_init_profile_cstart(void) {}
+static inline void z_init_profile_main(void) {}
+#endif
+
+#ifdef CONFIG_SYS_MUTEX_FAST_PATH
+/* Kernel side of a sys_mutex whose uncontended state lives in @a state */
+int z_mutex_lock_shared(struct k_mutex *mutex, atomic_t *state,
+			k_timeout_t timeout);
+int z_mutex_unlock_shared(struct k_mutex *mutex, atomic_t *state);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -389,6 +389,19 @@ int z_sched_wait(struct k_spinlock *lock, k_spinlock_key_t key,
 int z_sched_waitq_walk(_wait_q_t *wait_q,
 		       int (*func)(struct k_thread *, void *), void *data);
 
+/**
+ * @brief Move a pending thread to another wait queue
+ *
+ * The thread keeps its timeout. Nothing is done if the thread is no
+ * longer pending on @a from, e.g. because it timed out in the meantime.
+ *
+ * @param thread Thread to move
+ * @param from   Wait queue the thread is expected to pend on
+ * @param to     Wait queue to move the thread to
+ */
+void z_sched_waitq_move(struct k_thread *thread, _wait_q_t *from,
+			_wait_q_t *to);
+
 /** @brief Halt thread cycle usage accounting.
  *
  * Halts the accumulation of thread cycle usage and adds the current
@@ -410,6 +423,14 @@ void z_sched_usage_stop(void);
 
 void z_sched_usage_start(struct k_thread *thread);
 
+/**
+ * @brief Note that a thread became ready to run
+ *
+ * Starts the scheduling latency measurement that ends when the thread
+ * is switched in.  Called with the scheduler lock held.
+ */
+void z_sched_usage_ready(struct k_thread *thread);
+
 /**
  * @brief Retrieves CPU cycle usage data for specified core
  */
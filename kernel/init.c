@@ -249,6 +249,180 @@ extern volatile uintptr_t __stack_chk_guard;
 __pinned_bss
 bool z_sys_post_kernel;
 
+static int do_device_init(const struct init_entry *entry)
+{
+	const struct device *dev = entry->dev;
+	int rc = 0;
+
+	if (entry->init_fn.dev != NULL) {
+		rc = entry->init_fn.dev(dev);
+		/* Mark device initialized. If initialization
+		 * failed, record the error condition.
+		 */
+		if (rc != 0) {
+			if (rc < 0) {
+				rc = -rc;
+			}
+			if (rc > UINT8_MAX) {
+				rc = UINT8_MAX;
+			}
+			dev->state->init_res = rc;
+		}
+	}
+
+	dev->state->initialized = true;
+
+	if (rc == 0) {
+		/* Run automatic device runtime enablement */
+		(void)pm_device_runtime_auto_enable(dev);
+	}
+
+	return rc;
+}
+
+static void run_init_entry(const struct init_entry *entry,
+			   enum init_level level)
+{
+	struct init_profile_record *record;
+	int rc;
+
+	sys_port_trace_sys_init_enter(entry, level);
+	record = z_init_profile_start(entry, level);
+
+	if (entry->dev != NULL) {
+		rc = do_device_init(entry);
+	} else {
+		rc = entry->init_fn.sys();
+	}
+
+	z_init_profile_end(record, rc);
+	sys_port_trace_sys_init_exit(entry, level, rc);
+}
+
+#ifdef CONFIG_DEVICE_INIT_PARALLEL
+/*
+ * Devices with devicetree dependency information are handed to a pool of
+ * boot worker threads, as soon as all of the devices they require that
+ * are initialized at the same level are done. Any other entry waits for
+ * everything dispatched before it, then runs on the boot thread.
+ */
+static K_KERNEL_STACK_ARRAY_DEFINE(init_worker_stacks,
+				   CONFIG_DEVICE_INIT_PARALLEL_THREADS,
+				   CONFIG_DEVICE_INIT_PARALLEL_STACK_SIZE);
+static struct k_thread init_workers[CONFIG_DEVICE_INIT_PARALLEL_THREADS];
+K_MSGQ_DEFINE(z_init_work_q, sizeof(const struct init_entry *),
+	      CONFIG_DEVICE_INIT_PARALLEL_THREADS, sizeof(void *));
+static K_SEM_DEFINE(init_done_sem, 0, K_SEM_MAX_LIMIT);
+
+struct init_dep_check {
+	const struct init_entry *start;
+	const struct init_entry *end;
+};
+
+static void init_worker(void *p1, void *p2, void *p3)
+{
+	enum init_level level = (enum init_level)(uintptr_t)p1;
+	const struct init_entry *entry;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		(void)k_msgq_get(&z_init_work_q, &entry, K_FOREVER);
+		if (entry == NULL) {
+			break;
+		}
+
+		run_init_entry(entry, level);
+		k_sem_give(&init_done_sem);
+	}
+}
+
+static bool init_entry_is_parallel(const struct init_entry *entry)
+{
+	return (entry->dev != NULL) && !entry->serial &&
+	       (device_handle_get(entry->dev) != DEVICE_HANDLE_NULL);
+}
+
+static int dep_pending(const struct device *dep, void *user_data)
+{
+	const struct init_dep_check *check = user_data;
+
+	if (dep->state->initialized) {
+		return 0;
+	}
+
+	/* Only wait for devices that were already dispatched, anything
+	 * else does not belong to this level.
+	 */
+	for (const struct init_entry *e = check->start; e < check->end; e++) {
+		if (e->dev == dep) {
+			return -EAGAIN;
+		}
+	}
+
+	return 0;
+}
+
+static void run_level_parallel(enum init_level level,
+			       const struct init_entry *start,
+			       const struct init_entry *end)
+{
+	struct init_dep_check check = { .start = start };
+	unsigned int num_workers;
+	unsigned int in_flight = 0U;
+
+	num_workers = MIN(CONFIG_DEVICE_INIT_PARALLEL_THREADS, end - start);
+	for (unsigned int i = 0U; i < num_workers; i++) {
+		k_thread_create(&init_workers[i], init_worker_stacks[i],
+				K_KERNEL_STACK_SIZEOF(init_worker_stacks[i]),
+				init_worker, (void *)(uintptr_t)level, NULL, NULL,
+				CONFIG_MAIN_THREAD_PRIORITY, 0, K_NO_WAIT);
+		k_thread_name_set(&init_workers[i], "init_worker");
+	}
+
+	for (const struct init_entry *entry = start; entry < end; entry++) {
+		if (init_entry_is_parallel(entry)) {
+			/* Wait for the devices this one requires */
+			check.end = entry;
+			while (device_required_foreach(entry->dev, dep_pending,
+						       &check) < 0) {
+				(void)k_sem_take(&init_done_sem, K_FOREVER);
+				in_flight--;
+			}
+
+			(void)k_msgq_put(&z_init_work_q, &entry, K_FOREVER);
+			in_flight++;
+			continue;
+		}
+
+		/* Everything before this entry must be done */
+		while (in_flight > 0U) {
+			(void)k_sem_take(&init_done_sem, K_FOREVER);
+			in_flight--;
+		}
+		check.start = entry + 1;
+
+		run_init_entry(entry, level);
+	}
+
+	/* The level is a barrier */
+	while (in_flight > 0U) {
+		(void)k_sem_take(&init_done_sem, K_FOREVER);
+		in_flight--;
+	}
+
+	for (unsigned int i = 0U; i < num_workers; i++) {
+		const struct init_entry *stop = NULL;
+
+		(void)k_msgq_put(&z_init_work_q, &stop, K_FOREVER);
+	}
+	for (unsigned int i = 0U; i < num_workers; i++) {
+		(void)k_thread_join(&init_workers[i], K_FOREVER);
+	}
+}
+#endif /* CONFIG_DEVICE_INIT_PARALLEL */
+
 /**
  * @brief Execute all the init entry initialization functions at a given level
  *
@@ -276,37 +450,17 @@ static void z_sys_init_run_level(enum init_level level)
 	};
 	const struct init_entry *entry;
 
-	for (entry = levels[level]; entry < levels[level+1]; entry++) {
-		const struct device *dev = entry->dev;
-
-		if (dev != NULL) {
-			int rc = 0;
-
-			if (entry->init_fn.dev != NULL) {
-				rc = entry->init_fn.dev(dev);
-				/* Mark device initialized. If initialization
-				 * failed, record the error condition.
-				 */
-				if (rc != 0) {
-					if (rc < 0) {
-						rc = -rc;
-					}
-					if (rc > UINT8_MAX) {
-						rc = UINT8_MAX;
-					}
-					dev->state->init_res = rc;
-				}
-			}
-
-			dev->state->initialized = true;
+#ifdef CONFIG_DEVICE_INIT_PARALLEL
+	/* Worker threads can only run once the kernel is up */
+	if ((level == INIT_LEVEL_POST_KERNEL) ||
+	    (level == INIT_LEVEL_APPLICATION)) {
+		run_level_parallel(level, levels[level], levels[level+1]);
+		return;
+	}
+#endif
 
-			if (rc == 0) {
-				/* Run automatic device runtime enablement */
-				(void)pm_device_runtime_auto_enable(dev);
-			}
-		} else {
-			(void)entry->init_fn.sys();
-		}
+	for (entry = levels[level]; entry < levels[level+1]; entry++) {
+		run_init_entry(entry, level);
 	}
 }
 
@@ -368,6 +522,7 @@ static void bg_thread_main(void *unused1, void *unused2, void *unused3)
 
 	extern int main(void);
 
+	z_init_profile_main();
 	(void)main();
 
 	/* Mark nonessential since main() has no more work to do */
@@ -550,6 +705,8 @@ __boot_func
 FUNC_NO_STACK_PROTECTOR
 FUNC_NORETURN void z_cstart(void)
 {
+	z_init_profile_cstart();
+
 	/* gcov hook needed to get the coverage report.*/
 	gcov_static_init();
 
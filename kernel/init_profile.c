@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/linker/sections.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/debug/init_profile.h>
+#include <kernel_internal.h>
+
+__pinned_bss
+static struct init_profile_record records[CONFIG_INIT_PROFILING_MAX_ENTRIES];
+
+__pinned_bss
+static atomic_t num_records;
+
+__pinned_bss
+static struct init_profile_boot boot;
+
+__boot_func
+struct init_profile_record *z_init_profile_start(const struct init_entry *entry,
+						 int level)
+{
+	/* Parallel device initialization records from several threads */
+	atomic_val_t idx = atomic_inc(&num_records);
+	struct init_profile_record *record;
+
+	if (idx >= CONFIG_INIT_PROFILING_MAX_ENTRIES) {
+		return NULL;
+	}
+
+	record = &records[idx];
+	record->entry = entry;
+	record->level = level;
+	record->start = k_cycle_get_32();
+
+	return record;
+}
+
+__boot_func
+void z_init_profile_end(struct init_profile_record *record, int result)
+{
+	if (record != NULL) {
+		record->end = k_cycle_get_32();
+		record->result = CLAMP(result, INT16_MIN, INT16_MAX);
+	}
+}
+
+__boot_func
+void z_init_profile_cstart(void)
+{
+	boot.cstart = k_cycle_get_32();
+}
+
+__boot_func
+void z_init_profile_main(void)
+{
+	boot.main = k_cycle_get_32();
+}
+
+const struct init_profile_record *init_profile_get(size_t *count,
+						   size_t *dropped)
+{
+	size_t total = atomic_get(&num_records);
+
+	*count = MIN(total, CONFIG_INIT_PROFILING_MAX_ENTRIES);
+	if (dropped != NULL) {
+		*dropped = total - *count;
+	}
+
+	return records;
+}
+
+const struct init_profile_boot *init_profile_boot_get(void)
+{
+	return &boot;
+}
+
+const char *init_profile_name(const struct init_profile_record *record)
+{
+	const struct init_entry *entry = record->entry;
+
+	return (entry->dev != NULL) ? entry->dev->name : entry->init_name;
+}
+
+void init_profile_dump(void)
+{
+	const struct init_profile_record *record;
+	size_t count;
+	size_t dropped;
+
+	record = init_profile_get(&count, &dropped);
+
+	printk("init_profile,level,prio,name,device,start,end,cycles,result\n");
+	for (size_t i = 0; i < count; i++, record++) {
+		printk("init_profile,%u,%u,%s,%u,%u,%u,%u,%d\n",
+		       record->level, record->entry->init_prio,
+		       init_profile_name(record),
+		       (record->entry->dev != NULL) ? 1U : 0U,
+		       record->start, record->end,
+		       record->end - record->start, record->result);
+	}
+	printk("init_profile_boot,cstart,%u,main,%u,dropped,%zu\n",
+	       boot.cstart, boot.main, dropped);
+}
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/kernel/obj_core.h>
+#include <zephyr/kernel/stats.h>
+#include <kswap.h>
+
+static struct k_obj_type obj_type_spinlock;
+
+static int k_spinlock_stats_raw(struct k_obj_core *obj_core, void *stats)
+{
+	struct k_spinlock_obj *obj;
+	k_spinlock_key_t key;
+
+	obj = CONTAINER_OF(obj_core, struct k_spinlock_obj, obj_core);
+	key = k_spin_lock(obj->lock);
+	memcpy(stats, &obj->lock->stats, sizeof(obj->lock->stats));
+	k_spin_unlock(obj->lock, key);
+
+	return 0;
+}
+
+static int k_spinlock_stats_reset(struct k_obj_core *obj_core)
+{
+	struct k_spinlock_obj *obj;
+	k_spinlock_key_t key;
+
+	obj = CONTAINER_OF(obj_core, struct k_spinlock_obj, obj_core);
+	key = k_spin_lock(obj->lock);
+	memset(&obj->lock->stats, 0, sizeof(obj->lock->stats));
+	k_spin_unlock(obj->lock, key);
+
+	return 0;
+}
+
+static struct k_obj_core_stats_desc spinlock_stats_desc = {
+	.raw_size = sizeof(struct k_lock_stats),
+	.query_size = sizeof(struct k_lock_stats),
+	.raw   = k_spinlock_stats_raw,
+	.query = k_spinlock_stats_raw,
+	.reset = k_spinlock_stats_reset,
+	.disable = NULL,
+	.enable = NULL,
+};
+
+void k_spinlock_obj_register(struct k_spinlock_obj *obj,
+			     struct k_spinlock *lock, const char *name)
+{
+	obj->lock = lock;
+	obj->name = name;
+
+	k_obj_core_init_and_link(K_OBJ_CORE(obj), &obj_type_spinlock);
+	k_obj_core_stats_register(K_OBJ_CORE(obj), &lock->stats,
+				  sizeof(struct k_lock_stats));
+}
+
+static struct k_spinlock_obj sched_spinlock_obj;
+
+static int init_spinlock_obj_core_list(void)
+{
+	z_obj_type_init(&obj_type_spinlock, K_OBJ_TYPE_SPINLOCK_ID,
+			offsetof(struct k_spinlock_obj, obj_core));
+	k_obj_type_stats_init(&obj_type_spinlock, &spinlock_stats_desc);
+
+	k_spinlock_obj_register(&sched_spinlock_obj, &sched_spinlock,
+				"sched");
+
+	return 0;
+}
+
+/* Before any other spinlock is registered */
+SYS_INIT(init_spinlock_obj_core_list, PRE_KERNEL_1, 0);
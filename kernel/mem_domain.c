@@ -361,6 +361,12 @@ static int init_mem_domain_module(void)
 	__ASSERT(ret == 0, "failed to add default libc mem partition");
 #endif /* Z_LIBC_PARTITION_EXISTS */
 
+#ifdef CONFIG_USERSPACE_VDSO
+	ret = k_mem_domain_add_partition(&k_mem_domain_default,
+					 &z_vdso_partition);
+	__ASSERT(ret == 0, "failed to add vdso mem partition");
+#endif /* CONFIG_USERSPACE_VDSO */
+
 	return 0;
 }
 
@@ -18,6 +18,8 @@
 #include <ksched.h>
 #include <wait_q.h>
 
+static uint32_t num_used_locked(struct k_mem_slab *slab);
+
 #ifdef CONFIG_OBJ_CORE_MEM_SLAB
 static struct k_obj_type obj_type_mem_slab;
 
@@ -33,6 +35,7 @@ static int k_mem_slab_stats_raw(struct k_obj_core *obj_core, void *stats)
 	slab = CONTAINER_OF(obj_core, struct k_mem_slab, obj_core);
 	key = k_spin_lock(&slab->lock);
 	memcpy(stats, &slab->info, sizeof(slab->info));
+	((struct k_mem_slab_info *)stats)->num_used = num_used_locked(slab);
 	k_spin_unlock(&slab->lock, key);
 
 	return 0;
@@ -48,9 +51,9 @@ static int k_mem_slab_stats_query(struct k_obj_core *obj_core, void *stats)
 
 	slab = CONTAINER_OF(obj_core, struct k_mem_slab, obj_core);
 	key = k_spin_lock(&slab->lock);
-	ptr->free_bytes = (slab->info.num_blocks - slab->info.num_used) *
+	ptr->free_bytes = (slab->info.num_blocks - num_used_locked(slab)) *
 			  slab->info.block_size;
-	ptr->allocated_bytes = slab->info.num_used * slab->info.block_size;
+	ptr->allocated_bytes = num_used_locked(slab) * slab->info.block_size;
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 	ptr->max_allocated_bytes = slab->info.max_used * slab->info.block_size;
 #else
@@ -92,6 +95,187 @@ static struct k_obj_core_stats_desc mem_slab_stats_desc = {
 #endif
 #endif
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+
+/* Blocks moved between a CPU cache and the shared free list at a time. */
+#define CACHE_BATCH (CONFIG_MEM_SLAB_CPU_CACHE_SIZE / 2)
+
+/* Lock ordering: a CPU cache lock may be held while taking the slab lock,
+ * never the other way round.  Blocks in a CPU cache are counted in
+ * info.num_used, so the slab lock alone gives a consistent view of the
+ * shared list, and the cache lock of the local CPU makes the common
+ * alloc/free paths avoid the slab lock entirely.
+ */
+
+uint32_t z_mem_slab_num_cached(struct k_mem_slab *slab)
+{
+	uint32_t cached = 0U;
+
+	for (unsigned int i = 0; i < arch_num_cpus(); i++) {
+		cached += slab->cache[i].count;
+	}
+
+	return cached;
+}
+
+/* Move blocks from a CPU cache to the slab, first handing them to any
+ * threads waiting for a block.
+ *
+ * Invoked with the cache lock held.
+ *
+ * @return true if a waiting thread was made ready.
+ */
+static bool cache_flush(struct k_mem_slab *slab,
+			struct z_mem_slab_cache *cache, uint32_t count)
+{
+	k_spinlock_key_t key = k_spin_lock(&slab->lock);
+	bool readied = false;
+
+	while ((count > 0U) && (cache->free_list != NULL)) {
+		char *block = cache->free_list;
+		struct k_thread *pending_thread = z_unpend_first_thread(&slab->wait_q);
+
+		cache->free_list = *(char **)block;
+		cache->count--;
+		count--;
+
+		if (pending_thread != NULL) {
+			z_thread_return_value_set_with_data(pending_thread, 0, block);
+			z_ready_thread(pending_thread);
+			readied = true;
+		} else {
+			*(char **)block = slab->free_list;
+			slab->free_list = block;
+			slab->info.num_used--;
+		}
+	}
+
+	k_spin_unlock(&slab->lock, key);
+
+	return readied;
+}
+
+/* Return the cached blocks of all CPUs to the slab. */
+static bool cache_flush_all(struct k_mem_slab *slab)
+{
+	bool readied = false;
+
+	for (unsigned int i = 0; i < arch_num_cpus(); i++) {
+		struct z_mem_slab_cache *cache = &slab->cache[i];
+
+		K_SPINLOCK(&cache->lock) {
+			if (cache_flush(slab, cache, cache->count)) {
+				readied = true;
+			}
+		}
+	}
+
+	return readied;
+}
+
+/* Move a batch of blocks from the shared free list to a CPU cache.
+ *
+ * Invoked with the cache lock held.
+ */
+static void cache_refill(struct k_mem_slab *slab,
+			 struct z_mem_slab_cache *cache)
+{
+	k_spinlock_key_t key = k_spin_lock(&slab->lock);
+
+	while ((cache->count < CACHE_BATCH) && (slab->free_list != NULL)) {
+		char *block = slab->free_list;
+
+		slab->free_list = *(char **)block;
+		*(char **)block = cache->free_list;
+		cache->free_list = block;
+		cache->count++;
+		slab->info.num_used++;
+	}
+
+#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+	slab->info.max_used = MAX(slab->info.num_used,
+				  slab->info.max_used);
+#endif
+
+	k_spin_unlock(&slab->lock, key);
+}
+
+/* Try to allocate a block from the cache of the current CPU. */
+static bool cache_alloc(struct k_mem_slab *slab, void **mem)
+{
+	/* Keep the thread on this CPU while using its cache */
+	unsigned int irq_key = arch_irq_lock();
+	struct z_mem_slab_cache *cache = &slab->cache[_current_cpu->id];
+	k_spinlock_key_t key = k_spin_lock(&cache->lock);
+	bool ret = false;
+
+	if (cache->free_list == NULL) {
+		cache_refill(slab, cache);
+	}
+
+	if (cache->free_list != NULL) {
+		*mem = cache->free_list;
+		cache->free_list = *(char **)(cache->free_list);
+		cache->count--;
+		ret = true;
+	}
+
+	k_spin_unlock(&cache->lock, key);
+	arch_irq_unlock(irq_key);
+
+	return ret;
+}
+
+/* Try to free a block to the cache of the current CPU.
+ *
+ * Fails when a thread may be waiting for a block, so that freed blocks go
+ * to waiters instead of a cache.  The waiter count is read under the cache
+ * lock: a thread that is about to wait increments it before flushing every
+ * cache, so any block cached before that flush is returned by it.
+ */
+static bool cache_free(struct k_mem_slab *slab, void *mem)
+{
+	unsigned int irq_key = arch_irq_lock();
+	struct z_mem_slab_cache *cache = &slab->cache[_current_cpu->id];
+	k_spinlock_key_t key = k_spin_lock(&cache->lock);
+	bool ret = false;
+
+	if (atomic_get(&slab->cache_waiters) == 0) {
+		if (cache->count >= CONFIG_MEM_SLAB_CPU_CACHE_SIZE) {
+			(void)cache_flush(slab, cache, CACHE_BATCH);
+		}
+
+		*(char **)mem = cache->free_list;
+		cache->free_list = (char *)mem;
+		cache->count++;
+		ret = true;
+	}
+
+	k_spin_unlock(&cache->lock, key);
+	arch_irq_unlock(irq_key);
+
+	return ret;
+}
+
+static void cache_init(struct k_mem_slab *slab)
+{
+	atomic_clear(&slab->cache_waiters);
+	for (unsigned int i = 0; i < ARRAY_SIZE(slab->cache); i++) {
+		slab->cache[i] = (struct z_mem_slab_cache) {};
+	}
+}
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+
+/* Number of blocks handed out to users.  Invoked with slab lock held. */
+static uint32_t num_used_locked(struct k_mem_slab *slab)
+{
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	return slab->info.num_used - z_mem_slab_num_cached(slab);
+#else
+	return slab->info.num_used;
+#endif
+}
+
 /**
  * @brief Initialize kernel memory slab subsystem.
  *
@@ -115,6 +299,10 @@ static int create_free_list(struct k_mem_slab *slab)
 	slab->free_list = NULL;
 	p = slab->buffer;
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	cache_init(slab);
+#endif
+
 	for (j = 0U; j < slab->info.num_blocks; j++) {
 		*(char **)p = slab->free_list;
 		slab->free_list = p;
@@ -207,6 +395,28 @@ out:
 
 int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 {
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	bool waiting = !K_TIMEOUT_EQ(timeout, K_NO_WAIT);
+
+	if (cache_alloc(slab, mem)) {
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, alloc, slab, timeout);
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, 0);
+
+		return 0;
+	}
+
+	/* The shared list is empty, but other CPUs may still cache free
+	 * blocks.  Return them to the shared list, and if we may have to
+	 * wait keep blocks from being cached until we are done.
+	 */
+	if (waiting) {
+		atomic_inc(&slab->cache_waiters);
+	}
+	if (cache_flush_all(slab)) {
+		z_reschedule_unlocked();
+	}
+#endif
+
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
 	int result;
 
@@ -238,6 +448,10 @@ int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 			*mem = _current->base.swap_data;
 		}
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+		atomic_dec(&slab->cache_waiters);
+#endif
+
 		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, result);
 
 		return result;
@@ -245,6 +459,12 @@ int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, result);
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	if (waiting) {
+		atomic_dec(&slab->cache_waiters);
+	}
+#endif
+
 	k_spin_unlock(&slab->lock, key);
 
 	return result;
@@ -252,14 +472,23 @@ int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 
 void k_mem_slab_free(struct k_mem_slab *slab, void *mem)
 {
-	k_spinlock_key_t key = k_spin_lock(&slab->lock);
-
 	__ASSERT(((char *)mem >= slab->buffer) &&
 		 ((((char *)mem - slab->buffer) % slab->info.block_size) == 0) &&
 		 ((char *)mem <= (slab->buffer + (slab->info.block_size *
 						  (slab->info.num_blocks - 1)))),
 		 "Invalid memory pointer provided");
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	if (cache_free(slab, mem)) {
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, free, slab);
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
+
+		return;
+	}
+#endif
+
+	k_spinlock_key_t key = k_spin_lock(&slab->lock);
+
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, free, slab);
 	if (slab->free_list == NULL && IS_ENABLED(CONFIG_MULTITHREADING)) {
 		struct k_thread *pending_thread = z_unpend_first_thread(&slab->wait_q);
@@ -289,9 +518,10 @@ int k_mem_slab_runtime_stats_get(struct k_mem_slab *slab, struct sys_memory_stat
 	}
 
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
+	uint32_t num_used = num_used_locked(slab);
 
-	stats->allocated_bytes = slab->info.num_used * slab->info.block_size;
-	stats->free_bytes = (slab->info.num_blocks - slab->info.num_used) *
+	stats->allocated_bytes = num_used * slab->info.block_size;
+	stats->free_bytes = (slab->info.num_blocks - num_used) *
 			    slab->info.block_size;
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 	stats->max_allocated_bytes = slab->info.max_used *
@@ -314,7 +544,7 @@ int k_mem_slab_runtime_stats_reset_max(struct k_mem_slab *slab)
 
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
 
-	slab->info.max_used = slab->info.num_used;
+	slab->info.max_used = num_used_locked(slab);
 
 	k_spin_unlock(&slab->lock, key);
 
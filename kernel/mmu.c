@@ -1382,6 +1382,169 @@ static inline struct z_page_frame *do_eviction_select(bool *dirty)
 	return pf;
 }
 
+#ifdef CONFIG_DEMAND_PAGING_BACKING_STORE_ASYNC
+/* Only one asynchronous fetch is started at a time, so that the semaphore
+ * is never given for a fetch other than the one its taker waits for.
+ * Both are used from the backing store's completion context, so pinned.
+ */
+__pinned_bss
+static bool fetch_in_progress;
+
+__pinned_data
+static struct k_sem fetch_done = Z_SEM_INITIALIZER(fetch_done, 0, 1);
+
+/*
+ * Have the backing store fetch the data page at location asynchronously,
+ * and pend the faulting thread until it is done. Called with interrupts and
+ * the scheduler locked; both are unlocked while pending.
+ *
+ * Returns true if the thread pended, in which case the page fault must be
+ * serviced again from the start: other threads have run meanwhile and
+ * may have paged in the data page or moved it elsewhere.
+ */
+static bool do_backing_store_fetch(uintptr_t location, int key)
+{
+	int ret;
+
+	if (fetch_in_progress) {
+		return false;
+	}
+
+	ret = k_mem_paging_backing_store_page_in_async(location, &fetch_done);
+	if (ret != 0) {
+		return false;
+	}
+	fetch_in_progress = true;
+
+	irq_unlock(key);
+	k_sched_unlock();
+
+	(void)k_sem_take(&fetch_done, K_FOREVER);
+
+	k_sched_lock();
+	key = irq_lock();
+	fetch_in_progress = false;
+	irq_unlock(key);
+
+	return true;
+}
+#endif /* CONFIG_DEMAND_PAGING_BACKING_STORE_ASYNC */
+
+#if CONFIG_DEMAND_PAGING_READAHEAD > 0
+/* Data page following the last one paged in by a page fault, including
+ * the pages it read ahead. A page fault on it means that the data pages
+ * are being accessed sequentially.
+ */
+static uint8_t *readahead_next;
+
+static inline void paging_stats_readahead_inc(struct k_thread *faulting_thread,
+					      unsigned int pages)
+{
+#ifdef CONFIG_DEMAND_PAGING_STATS
+	if (pages == 0U) {
+		return;
+	}
+
+	paging_stats.readahead.faults++;
+	paging_stats.readahead.pages += pages;
+#ifdef CONFIG_DEMAND_PAGING_THREAD_STATS
+	faulting_thread->paging_stats.readahead.faults++;
+	faulting_thread->paging_stats.readahead.pages += pages;
+#else
+	ARG_UNUSED(faulting_thread);
+#endif /* CONFIG_DEMAND_PAGING_THREAD_STATS */
+#else
+	ARG_UNUSED(faulting_thread);
+	ARG_UNUSED(pages);
+#endif /* CONFIG_DEMAND_PAGING_STATS */
+}
+
+/*
+ * Page in up to CONFIG_DEMAND_PAGING_READAHEAD data pages following the one
+ * in fault_pf, which has just been paged in by a page fault. Called with
+ * interrupts locked, which like in do_page_fault() are unlocked around the
+ * backing store transfers if CONFIG_DEMAND_PAGING_ALLOW_IRQ is enabled.
+ *
+ * Reading ahead is speculative, so no dirty data page is ever written back
+ * to make room: this stops at the first data page which isn't paged out, or
+ * when neither a free page frame nor a clean one to evict is available.
+ *
+ * Returns the number of data pages read ahead.
+ */
+static unsigned int do_readahead(struct z_page_frame *fault_pf,
+				 struct k_thread *faulting_thread, int *key)
+{
+	struct z_page_frame *pf;
+	uint8_t *addr = fault_pf->addr;
+	uintptr_t page_in_location, page_out_location, phys;
+	enum arch_page_location status;
+	unsigned int count;
+	bool dirty;
+	int ret;
+
+	/* None of the data pages paged in by this page fault has been
+	 * accessed yet, so keep the eviction algorithm from picking them
+	 * until it is over.
+	 */
+	fault_pf->flags |= Z_PAGE_FRAME_PINNED;
+
+	for (count = 0U; count < CONFIG_DEMAND_PAGING_READAHEAD; count++) {
+		addr += CONFIG_MMU_PAGE_SIZE;
+		if ((POINTER_TO_UINT(addr) - POINTER_TO_UINT(Z_VIRT_RAM_START)) >=
+		    Z_VIRT_RAM_SIZE) {
+			break;
+		}
+
+		status = arch_page_location_get(addr, &page_in_location);
+		if (status != ARCH_PAGE_LOCATION_PAGED_OUT) {
+			break;
+		}
+
+		dirty = false;
+		pf = free_page_frame_list_get();
+		if (pf == NULL) {
+			pf = do_eviction_select(&dirty);
+			if ((pf == NULL) || dirty || !z_page_frame_is_backed(pf)) {
+				break;
+			}
+			LOG_DBG("evicting %p at 0x%lx for readahead", pf->addr,
+				z_page_frame_to_phys(pf));
+
+			paging_stats_eviction_inc(faulting_thread, false);
+		}
+		ret = page_frame_prepare_locked(pf, &dirty, true,
+						&page_out_location);
+		__ASSERT(ret == 0, "failed to prepare page frame");
+
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+		irq_unlock(*key);
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+		do_backing_store_page_in(page_in_location);
+
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+		*key = irq_lock();
+		pf->flags &= ~Z_PAGE_FRAME_BUSY;
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+		pf->flags |= Z_PAGE_FRAME_MAPPED;
+		pf->addr = addr;
+
+		arch_mem_page_in(addr, z_page_frame_to_phys(pf));
+		k_mem_paging_backing_store_page_finalize(pf, page_in_location);
+		pf->flags |= Z_PAGE_FRAME_PINNED;
+	}
+
+	for (unsigned int i = 0U; i <= count; i++) {
+		addr = (uint8_t *)fault_pf->addr + (i * CONFIG_MMU_PAGE_SIZE);
+		status = arch_page_location_get(addr, &phys);
+		__ASSERT(status == ARCH_PAGE_LOCATION_PAGED_IN,
+			 "read ahead page %p not paged in", addr);
+		z_phys_to_page_frame(phys)->flags &= ~Z_PAGE_FRAME_PINNED;
+	}
+
+	return count;
+}
+#endif /* CONFIG_DEMAND_PAGING_READAHEAD */
+
 static bool do_page_fault(void *addr, bool pin)
 {
 	struct z_page_frame *pf;
@@ -1391,6 +1554,12 @@ static bool do_page_fault(void *addr, bool pin)
 	bool result;
 	bool dirty = false;
 	struct k_thread *faulting_thread = _current_cpu->current;
+#ifdef CONFIG_DEMAND_PAGING_BACKING_STORE_ASYNC
+	/* Only threads which could be preempted anyway may pend on the
+	 * backing store.
+	 */
+	bool can_pend = !k_is_pre_kernel() && k_is_preempt_thread();
+#endif /* CONFIG_DEMAND_PAGING_BACKING_STORE_ASYNC */
 
 	__ASSERT(page_frames_initialized, "page fault at %p happened too early",
 		 addr);
@@ -1433,6 +1602,9 @@ static bool do_page_fault(void *addr, bool pin)
 	__ASSERT(!k_is_in_isr(), "ISR page faults are forbidden");
 #endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
 
+#ifdef CONFIG_DEMAND_PAGING_BACKING_STORE_ASYNC
+again:
+#endif /* CONFIG_DEMAND_PAGING_BACKING_STORE_ASYNC */
 	key = irq_lock();
 	status = arch_page_location_get(addr, &page_in_location);
 	if (status == ARCH_PAGE_LOCATION_BAD) {
@@ -1461,6 +1633,16 @@ static bool do_page_fault(void *addr, bool pin)
 	__ASSERT(status == ARCH_PAGE_LOCATION_PAGED_OUT,
 		 "unexpected status value %d", status);
 
+#ifdef CONFIG_DEMAND_PAGING_BACKING_STORE_ASYNC
+	if (can_pend && arch_irq_unlocked(key)) {
+		/* Fetch at most once per page fault */
+		can_pend = false;
+		if (do_backing_store_fetch(page_in_location, key)) {
+			goto again;
+		}
+	}
+#endif /* CONFIG_DEMAND_PAGING_BACKING_STORE_ASYNC */
+
 	paging_stats_faults_inc(faulting_thread, key);
 
 	pf = free_page_frame_list_get();
@@ -1501,6 +1683,19 @@ static bool do_page_fault(void *addr, bool pin)
 
 	arch_mem_page_in(addr, z_page_frame_to_phys(pf));
 	k_mem_paging_backing_store_page_finalize(pf, page_in_location);
+
+#if CONFIG_DEMAND_PAGING_READAHEAD > 0
+	if (!pin) {
+		uint8_t *page = pf->addr;
+		unsigned int count = 0U;
+
+		if (page == readahead_next) {
+			count = do_readahead(pf, faulting_thread, &key);
+			paging_stats_readahead_inc(faulting_thread, count);
+		}
+		readahead_next = page + ((count + 1U) * CONFIG_MMU_PAGE_SIZE);
+	}
+#endif /* CONFIG_DEMAND_PAGING_READAHEAD */
 out:
 	irq_unlock(key);
 #ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
@@ -293,6 +293,187 @@ static inline int z_vrfy_k_msgq_get(struct k_msgq *msgq, void *data,
 #include <syscalls/k_msgq_get_mrsh.c>
 #endif
 
+/* Copy as many of @a num messages as fit into the ring buffer, using at
+ * most two copies: one up to the end of the buffer and one for the part
+ * that wraps around to its start.
+ */
+static uint32_t ring_put_locked(struct k_msgq *msgq, const char *data,
+				uint32_t num)
+{
+	uint32_t n = MIN(num, msgq->max_msgs - msgq->used_msgs);
+	uint32_t first = MIN(n, (uint32_t)((msgq->buffer_end - msgq->write_ptr) /
+					   msgq->msg_size));
+
+	__ASSERT_NO_MSG(msgq->write_ptr >= msgq->buffer_start &&
+			msgq->write_ptr < msgq->buffer_end);
+
+	(void)memcpy(msgq->write_ptr, data, first * msgq->msg_size);
+	msgq->write_ptr += first * msgq->msg_size;
+	if (msgq->write_ptr == msgq->buffer_end) {
+		msgq->write_ptr = msgq->buffer_start;
+	}
+
+	if (n > first) {
+		size_t rest = (n - first) * msgq->msg_size;
+
+		(void)memcpy(msgq->write_ptr, data + first * msgq->msg_size, rest);
+		msgq->write_ptr += rest;
+	}
+
+	msgq->used_msgs += n;
+
+	return n;
+}
+
+/* Counterpart of ring_put_locked() for taking messages out */
+static uint32_t ring_get_locked(struct k_msgq *msgq, char *data, uint32_t num)
+{
+	uint32_t n = MIN(num, msgq->used_msgs);
+	uint32_t first = MIN(n, (uint32_t)((msgq->buffer_end - msgq->read_ptr) /
+					   msgq->msg_size));
+
+	(void)memcpy(data, msgq->read_ptr, first * msgq->msg_size);
+	msgq->read_ptr += first * msgq->msg_size;
+	if (msgq->read_ptr == msgq->buffer_end) {
+		msgq->read_ptr = msgq->buffer_start;
+	}
+
+	if (n > first) {
+		size_t rest = (n - first) * msgq->msg_size;
+
+		(void)memcpy(data + first * msgq->msg_size, msgq->read_ptr, rest);
+		msgq->read_ptr += rest;
+	}
+
+	msgq->used_msgs -= n;
+
+	return n;
+}
+
+int z_impl_k_msgq_put_many(struct k_msgq *msgq, const void *data,
+			   uint32_t num_msgs)
+{
+	const char *src = data;
+	struct k_thread *pending_thread;
+	bool woken = false;
+	uint32_t n = 0;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&msgq->lock);
+
+	/* Threads can only be waiting to read while the queue is empty,
+	 * hand them their messages directly.
+	 */
+	while (n < num_msgs && msgq->used_msgs == 0U) {
+		pending_thread = z_unpend_first_thread(&msgq->wait_q);
+		if (pending_thread == NULL) {
+			break;
+		}
+
+		(void)memcpy(pending_thread->base.swap_data,
+			     src + n * msgq->msg_size, msgq->msg_size);
+		arch_thread_return_value_set(pending_thread, 0);
+		z_ready_thread(pending_thread);
+		woken = true;
+		n++;
+	}
+
+	if (n < num_msgs) {
+		uint32_t queued = ring_put_locked(msgq, src + n * msgq->msg_size,
+						  num_msgs - n);
+
+#ifdef CONFIG_POLL
+		if (queued != 0U) {
+			handle_poll_events(msgq, K_POLL_STATE_MSGQ_DATA_AVAILABLE);
+		}
+#endif /* CONFIG_POLL */
+		n += queued;
+	}
+
+	if (woken) {
+		z_reschedule(&msgq->lock, key);
+	} else {
+		k_spin_unlock(&msgq->lock, key);
+	}
+
+	return (int)n;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_msgq_put_many(struct k_msgq *msgq, const void *data,
+					 uint32_t num_msgs)
+{
+	K_OOPS(K_SYSCALL_OBJ(msgq, K_OBJ_MSGQ));
+	K_OOPS(K_SYSCALL_MEMORY_ARRAY_READ(data, num_msgs, msgq->msg_size));
+
+	return z_impl_k_msgq_put_many(msgq, data, num_msgs);
+}
+#include <syscalls/k_msgq_put_many_mrsh.c>
+#endif
+
+int z_impl_k_msgq_get_many(struct k_msgq *msgq, void *data, uint32_t num_msgs)
+{
+	char *dst = data;
+	struct k_thread *pending_thread;
+	bool woken = false;
+	uint32_t n;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&msgq->lock);
+
+	n = ring_get_locked(msgq, dst, num_msgs);
+
+	/* Threads can only be waiting to write while the queue was full.
+	 * Once the ring buffer is empty take their messages directly, then
+	 * move the rest of them into the space freed up above.
+	 */
+	while (n < num_msgs) {
+		pending_thread = z_unpend_first_thread(&msgq->wait_q);
+		if (pending_thread == NULL) {
+			break;
+		}
+
+		(void)memcpy(dst + n * msgq->msg_size,
+			     pending_thread->base.swap_data, msgq->msg_size);
+		arch_thread_return_value_set(pending_thread, 0);
+		z_ready_thread(pending_thread);
+		woken = true;
+		n++;
+	}
+
+	while (n != 0U && msgq->used_msgs < msgq->max_msgs) {
+		pending_thread = z_unpend_first_thread(&msgq->wait_q);
+		if (pending_thread == NULL) {
+			break;
+		}
+
+		(void)ring_put_locked(msgq, pending_thread->base.swap_data, 1);
+		arch_thread_return_value_set(pending_thread, 0);
+		z_ready_thread(pending_thread);
+		woken = true;
+	}
+
+	if (woken) {
+		z_reschedule(&msgq->lock, key);
+	} else {
+		k_spin_unlock(&msgq->lock, key);
+	}
+
+	return (int)n;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_msgq_get_many(struct k_msgq *msgq, void *data,
+					 uint32_t num_msgs)
+{
+	K_OOPS(K_SYSCALL_OBJ(msgq, K_OBJ_MSGQ));
+	K_OOPS(K_SYSCALL_MEMORY_ARRAY_WRITE(data, num_msgs, msgq->msg_size));
+
+	return z_impl_k_msgq_get_many(msgq, data, num_msgs);
+}
+#include <syscalls/k_msgq_get_many_mrsh.c>
+#endif
+
 int z_impl_k_msgq_peek(struct k_msgq *msgq, void *data)
 {
 	k_spinlock_key_t key;
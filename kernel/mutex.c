@@ -31,6 +31,7 @@
 #include <zephyr/toolchain.h>
 #include <ksched.h>
 #include <wait_q.h>
+#include <kernel_internal.h>
 #include <errno.h>
 #include <zephyr/init.h>
 #include <zephyr/internal/syscall_handler.h>
@@ -38,6 +39,7 @@
 #include <zephyr/sys/check.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/llext/symbol.h>
+#include <string.h>
 LOG_MODULE_DECLARE(os, CONFIG_KERNEL_LOG_LEVEL);
 
 /* We use a global spinlock here because some of the synchronization
@@ -49,7 +51,70 @@ static struct k_spinlock lock;
 
 #ifdef CONFIG_OBJ_CORE_MUTEX
 static struct k_obj_type obj_type_mutex;
+
+#ifdef CONFIG_OBJ_CORE_STATS_MUTEX
+static int k_mutex_stats_raw(struct k_obj_core *obj_core, void *stats)
+{
+	struct k_mutex *mutex = CONTAINER_OF(obj_core, struct k_mutex, obj_core);
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	memcpy(stats, &mutex->stats, sizeof(mutex->stats));
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+
+static int k_mutex_stats_reset(struct k_obj_core *obj_core)
+{
+	struct k_mutex *mutex = CONTAINER_OF(obj_core, struct k_mutex, obj_core);
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	memset(&mutex->stats, 0, sizeof(mutex->stats));
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+
+static struct k_obj_core_stats_desc mutex_stats_desc = {
+	.raw_size = sizeof(struct k_lock_stats),
+	.query_size = sizeof(struct k_lock_stats),
+	.raw   = k_mutex_stats_raw,
+	.query = k_mutex_stats_raw,
+	.reset = k_mutex_stats_reset,
+	.disable = NULL,
+	.enable = NULL,
+};
+#endif /* CONFIG_OBJ_CORE_STATS_MUTEX */
+#endif /* CONFIG_OBJ_CORE_MUTEX */
+
+/* Update the statistics of a mutex that was just taken, must be called
+ * with the lock held. start is the time at which the thread started to
+ * lock the mutex.
+ */
+static inline void mutex_stats_acquired(struct k_mutex *mutex, uint32_t start,
+					bool contended)
+{
+#ifdef CONFIG_OBJ_CORE_STATS_MUTEX
+	uint32_t now = k_cycle_get_32();
+
+	z_lock_stats_acquired(&mutex->stats, contended, now - start);
+	mutex->lock_time = now;
+#else
+	ARG_UNUSED(mutex);
+	ARG_UNUSED(start);
+	ARG_UNUSED(contended);
 #endif
+}
+
+/* must be called with the lock held */
+static inline void mutex_stats_released(struct k_mutex *mutex)
+{
+#ifdef CONFIG_OBJ_CORE_STATS_MUTEX
+	z_lock_stats_released(&mutex->stats, k_cycle_get_32() - mutex->lock_time);
+#else
+	ARG_UNUSED(mutex);
+#endif
+}
 
 int z_impl_k_mutex_init(struct k_mutex *mutex)
 {
@@ -63,6 +128,11 @@ int z_impl_k_mutex_init(struct k_mutex *mutex)
 #ifdef CONFIG_OBJ_CORE_MUTEX
 	k_obj_core_init_and_link(K_OBJ_CORE(mutex), &obj_type_mutex);
 #endif
+#ifdef CONFIG_OBJ_CORE_STATS_MUTEX
+	memset(&mutex->stats, 0, sizeof(mutex->stats));
+	k_obj_core_stats_register(K_OBJ_CORE(mutex), &mutex->stats,
+				  sizeof(struct k_lock_stats));
+#endif
 
 	SYS_PORT_TRACING_OBJ_INIT(k_mutex, mutex, 0);
 
@@ -101,20 +171,21 @@ static bool adjust_owner_prio(struct k_mutex *mutex, int32_t new_prio)
 	return false;
 }
 
-int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
+/* must be called with the lock held, releases it */
+static int mutex_lock_locked(struct k_mutex *mutex, k_spinlock_key_t key,
+			     k_timeout_t timeout)
 {
 	int new_prio;
-	k_spinlock_key_t key;
 	bool resched = false;
-
-	__ASSERT(!arch_is_in_isr(), "mutexes cannot be used inside ISRs");
-
-	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mutex, lock, mutex, timeout);
-
-	key = k_spin_lock(&lock);
+	uint32_t start = IS_ENABLED(CONFIG_OBJ_CORE_STATS_MUTEX) ?
+			 k_cycle_get_32() : 0U;
 
 	if (likely((mutex->lock_count == 0U) || (mutex->owner == _current))) {
 
+		if (mutex->lock_count == 0U) {
+			mutex_stats_acquired(mutex, start, false);
+		}
+
 		mutex->owner_orig_prio = (mutex->lock_count == 0U) ?
 					_current->base.prio :
 					mutex->owner_orig_prio;
@@ -160,6 +231,12 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 		got_mutex ? 'y' : 'n');
 
 	if (got_mutex == 0) {
+		if (IS_ENABLED(CONFIG_OBJ_CORE_STATS_MUTEX)) {
+			key = k_spin_lock(&lock);
+			mutex_stats_acquired(mutex, start, true);
+			k_spin_unlock(&lock, key);
+		}
+
 		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mutex, lock, mutex, timeout, 0);
 		return 0;
 	}
@@ -196,6 +273,19 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 
 	return -EAGAIN;
 }
+
+int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
+{
+	k_spinlock_key_t key;
+
+	__ASSERT(!arch_is_in_isr(), "mutexes cannot be used inside ISRs");
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mutex, lock, mutex, timeout);
+
+	key = k_spin_lock(&lock);
+
+	return mutex_lock_locked(mutex, key, timeout);
+}
 EXPORT_SYSCALL(k_mutex_lock);
 
 #ifdef CONFIG_USERSPACE
@@ -208,10 +298,50 @@ static inline int z_vrfy_k_mutex_lock(struct k_mutex *mutex,
 #include <syscalls/k_mutex_lock_mrsh.c>
 #endif
 
-int z_impl_k_mutex_unlock(struct k_mutex *mutex)
+/* must be called with the lock held, releases it */
+static void mutex_release_locked(struct k_mutex *mutex, k_spinlock_key_t key,
+				 atomic_t *state)
 {
 	struct k_thread *new_owner;
 
+	mutex_stats_released(mutex);
+
+	adjust_owner_prio(mutex, mutex->owner_orig_prio);
+
+	/* Get the new owner, if any */
+	new_owner = z_unpend_first_thread(&mutex->wait_q);
+
+	mutex->owner = new_owner;
+
+	LOG_DBG("new owner of mutex %p: %p (prio: %d)",
+		mutex, new_owner, new_owner ? new_owner->base.prio : -1000);
+
+	if (new_owner != NULL) {
+		/*
+		 * new owner is already of higher or equal prio than first
+		 * waiter since the wait queue is priority-based: no need to
+		 * adjust its priority
+		 */
+		mutex->owner_orig_prio = new_owner->base.prio;
+		arch_thread_return_value_set(new_owner, 0);
+		z_ready_thread(new_owner);
+		z_reschedule(&lock, key);
+	} else {
+		mutex->lock_count = 0U;
+#ifdef CONFIG_SYS_MUTEX_FAST_PATH
+		/* Nobody is left waiting, go back to the fast path */
+		if (state != NULL) {
+			atomic_clear(state);
+		}
+#else
+		ARG_UNUSED(state);
+#endif
+		k_spin_unlock(&lock, key);
+	}
+}
+
+int z_impl_k_mutex_unlock(struct k_mutex *mutex)
+{
 	__ASSERT(!arch_is_in_isr(), "mutexes cannot be used inside ISRs");
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mutex, unlock, mutex);
@@ -249,32 +379,7 @@ int z_impl_k_mutex_unlock(struct k_mutex *mutex)
 		goto k_mutex_unlock_return;
 	}
 
-	k_spinlock_key_t key = k_spin_lock(&lock);
-
-	adjust_owner_prio(mutex, mutex->owner_orig_prio);
-
-	/* Get the new owner, if any */
-	new_owner = z_unpend_first_thread(&mutex->wait_q);
-
-	mutex->owner = new_owner;
-
-	LOG_DBG("new owner of mutex %p: %p (prio: %d)",
-		mutex, new_owner, new_owner ? new_owner->base.prio : -1000);
-
-	if (new_owner != NULL) {
-		/*
-		 * new owner is already of higher or equal prio than first
-		 * waiter since the wait queue is priority-based: no need to
-		 * adjust its priority
-		 */
-		mutex->owner_orig_prio = new_owner->base.prio;
-		arch_thread_return_value_set(new_owner, 0);
-		z_ready_thread(new_owner);
-		z_reschedule(&lock, key);
-	} else {
-		mutex->lock_count = 0U;
-		k_spin_unlock(&lock, key);
-	}
+	mutex_release_locked(mutex, k_spin_lock(&lock), NULL);
 
 
 k_mutex_unlock_return:
@@ -293,6 +398,132 @@ static inline int z_vrfy_k_mutex_unlock(struct k_mutex *mutex)
 #include <syscalls/k_mutex_unlock_mrsh.c>
 #endif
 
+#ifdef CONFIG_SYS_MUTEX_FAST_PATH
+/*
+ * A sys_mutex keeps its state in a word of user memory: zero when it is
+ * free, or the owning thread while it is held without contention. These
+ * two transitions are done by user threads with atomic operations alone.
+ *
+ * A thread that finds the mutex held by someone else enters the kernel,
+ * installs the owner recorded in the word as owner of the kernel mutex
+ * and sets the contended bit. From then on every lock and unlock takes
+ * the kernel mutex path, with priority inheritance, until the kernel
+ * mutex is released with no waiters and the word is cleared again.
+ */
+#define SYS_MUTEX_CONTENDED BIT(0)
+
+static struct k_thread *shared_owner(atomic_val_t val)
+{
+	struct k_thread *thread = (struct k_thread *)val;
+	struct k_object *ko = k_object_find(thread);
+
+	/* The word is in user memory and may have been clobbered */
+	if ((ko == NULL) || (ko->type != K_OBJ_THREAD) ||
+	    ((ko->flags & K_OBJ_FLAG_INITIALIZED) == 0U)) {
+		return NULL;
+	}
+
+	return thread;
+}
+
+int z_mutex_lock_shared(struct k_mutex *mutex, atomic_t *state,
+			k_timeout_t timeout)
+{
+	k_spinlock_key_t key;
+	atomic_val_t val;
+
+	__ASSERT(!arch_is_in_isr(), "mutexes cannot be used inside ISRs");
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mutex, lock, mutex, timeout);
+
+	key = k_spin_lock(&lock);
+
+	do {
+		val = atomic_get(state);
+
+		if ((val & SYS_MUTEX_CONTENDED) != 0) {
+			break;
+		}
+
+		if (val == 0) {
+			if (atomic_cas(state, 0, (atomic_val_t)_current)) {
+				k_spin_unlock(&lock, key);
+
+				SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mutex, lock, mutex,
+							       timeout, 0);
+
+				return 0;
+			}
+			continue;
+		}
+
+		struct k_thread *owner = shared_owner(val);
+
+		if (owner == NULL) {
+			k_spin_unlock(&lock, key);
+
+			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mutex, lock, mutex, timeout,
+						       -EINVAL);
+
+			return -EINVAL;
+		}
+
+		/* The owner may release the mutex at the same time */
+		if (atomic_cas(state, val, val | SYS_MUTEX_CONTENDED)) {
+			mutex->owner = owner;
+			mutex->lock_count = 1U;
+			mutex->owner_orig_prio = owner->base.prio;
+			/* The owner's hold time is counted from here */
+			mutex_stats_acquired(mutex, k_cycle_get_32(), false);
+			break;
+		}
+	} while (true);
+
+	return mutex_lock_locked(mutex, key, timeout);
+}
+
+int z_mutex_unlock_shared(struct k_mutex *mutex, atomic_t *state)
+{
+	k_spinlock_key_t key;
+	atomic_val_t val;
+	int ret = 0;
+
+	__ASSERT(!arch_is_in_isr(), "mutexes cannot be used inside ISRs");
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mutex, unlock, mutex);
+
+	key = k_spin_lock(&lock);
+
+	val = atomic_get(state);
+
+	if ((val & SYS_MUTEX_CONTENDED) == 0) {
+		if (val == 0) {
+			ret = -EINVAL;
+		} else if (val != (atomic_val_t)_current) {
+			ret = -EPERM;
+		} else {
+			atomic_clear(state);
+		}
+	} else if (mutex->owner != _current) {
+		ret = -EPERM;
+	} else if (mutex->lock_count > 1U) {
+		mutex->lock_count--;
+	} else {
+		mutex_release_locked(mutex, key, state);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mutex, unlock, mutex, 0);
+
+		return 0;
+	}
+
+	k_spin_unlock(&lock, key);
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mutex, unlock, mutex, ret);
+
+	return ret;
+}
+#endif /* CONFIG_SYS_MUTEX_FAST_PATH */
+
 #ifdef CONFIG_OBJ_CORE_MUTEX
 static int init_mutex_obj_core_list(void)
 {
@@ -300,11 +531,18 @@ static int init_mutex_obj_core_list(void)
 
 	z_obj_type_init(&obj_type_mutex, K_OBJ_TYPE_MUTEX_ID,
 			offsetof(struct k_mutex, obj_core));
+#ifdef CONFIG_OBJ_CORE_STATS_MUTEX
+	k_obj_type_stats_init(&obj_type_mutex, &mutex_stats_desc);
+#endif
 
 	/* Initialize and link statically defined mutexs */
 
 	STRUCT_SECTION_FOREACH(k_mutex, mutex) {
 		k_obj_core_init_and_link(K_OBJ_CORE(mutex), &obj_type_mutex);
+#ifdef CONFIG_OBJ_CORE_STATS_MUTEX
+		k_obj_core_stats_register(K_OBJ_CORE(mutex), &mutex->stats,
+					  sizeof(struct k_lock_stats));
+#endif
 	}
 
 	return 0;
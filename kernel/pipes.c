@@ -346,6 +346,17 @@ static size_t pipe_write(struct k_pipe *pipe, sys_dlist_t *src_list,
 		src->buffer         += bytes_copied;
 		src->bytes_to_xfer  -= bytes_copied;
 
+		if (src->thread == NULL) {
+
+			/* Reading from the pipe buffer. Update details. */
+
+			pipe->bytes_used -= bytes_copied;
+			pipe->read_index += bytes_copied;
+			if (pipe->read_index >= pipe->size) {
+				pipe->read_index -= pipe->size;
+			}
+		}
+
 		if (dest->thread == NULL) {
 
 			/* Writing to the pipe buffer. Update details. */
@@ -366,6 +377,16 @@ static size_t pipe_write(struct k_pipe *pipe, sys_dlist_t *src_list,
 		}
 
 		if (src->bytes_to_xfer == 0U) {
+			if ((src->thread != NULL) &&
+			    z_is_thread_pending(src->thread)) {
+
+				/* A waiting writer's request has been satisfied. */
+
+				z_unpend_thread(src->thread);
+				z_ready_thread(src->thread);
+
+				*reschedule = true;
+			}
 			src = (struct _pipe_desc *)sys_dlist_get(src_list);
 		}
 
@@ -377,6 +398,62 @@ static size_t pipe_write(struct k_pipe *pipe, sys_dlist_t *src_list,
 	return num_bytes_written;
 }
 
+/**
+ * @brief Refill the pipe buffer from the waiting writer(s), if any
+ */
+static void pipe_buffer_refill(struct k_pipe *pipe, bool *reschedule)
+{
+	struct _pipe_desc  pipe_desc[2];
+	sys_dlist_t        src_list;
+	sys_dlist_t        pipe_list;
+
+	if (pipe->bytes_used == pipe->size) {
+		return;
+	}
+
+	sys_dlist_init(&src_list);
+	sys_dlist_init(&pipe_list);
+
+	(void) pipe_waiter_list_populate(&src_list,
+					 &pipe->wait_q.writers,
+					 pipe->size - pipe->bytes_used);
+
+	(void) pipe_buffer_list_populate(&pipe_list, pipe_desc,
+					 pipe->buffer, pipe->size,
+					 pipe->write_index,
+					 pipe->read_index);
+
+	(void) pipe_write(pipe, &src_list, &pipe_list, reschedule);
+}
+
+/**
+ * @brief Hand data in the pipe buffer over to the waiting reader(s), if any
+ */
+static void pipe_buffer_drain(struct k_pipe *pipe, bool *reschedule)
+{
+	struct _pipe_desc  pipe_desc[2];
+	sys_dlist_t        src_list;
+	sys_dlist_t        dest_list;
+
+	if (pipe->bytes_used == 0U) {
+		return;
+	}
+
+	sys_dlist_init(&src_list);
+	sys_dlist_init(&dest_list);
+
+	(void) pipe_waiter_list_populate(&dest_list,
+					 &pipe->wait_q.readers,
+					 pipe->bytes_used);
+
+	(void) pipe_buffer_list_populate(&src_list, pipe_desc,
+					 pipe->buffer, pipe->size,
+					 pipe->read_index,
+					 pipe->write_index);
+
+	(void) pipe_write(pipe, &src_list, &dest_list, reschedule);
+}
+
 int z_impl_k_pipe_put(struct k_pipe *pipe, const void *data,
 		      size_t bytes_to_write, size_t *bytes_written,
 		      size_t min_xfer, k_timeout_t timeout)
@@ -406,6 +483,19 @@ int z_impl_k_pipe_put(struct k_pipe *pipe, const void *data,
 
 	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
 
+	if ((pipe->flags & K_PIPE_FLAG_RESERVED) != 0U) {
+
+		/* The producer side is claimed by k_pipe_reserve(). */
+
+		k_spin_unlock(&pipe->lock, key);
+		*bytes_written = 0U;
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, put, pipe,
+					       timeout, -EBUSY);
+
+		return -EBUSY;
+	}
+
 	/*
 	 * First, write to any waiting readers, if any exist.
 	 * Second, write to the pipe buffer, if it exists.
@@ -543,6 +633,16 @@ static int pipe_get_internal(k_spinlock_key_t key, struct k_pipe *pipe,
 	size_t         bytes_can_read = 0U;
 	bool           reschedule_needed = false;
 
+	if ((pipe->flags & K_PIPE_FLAG_PEEKED) != 0U) {
+
+		/* The consumer side is claimed by k_pipe_peek(). */
+
+		k_spin_unlock(&pipe->lock, key);
+		*bytes_read = 0;
+
+		return -EBUSY;
+	}
+
 	/*
 	 * Data copying takes place in the following order.
 	 * 1. Copy data from the pipe buffer to the receive buffer.
@@ -625,28 +725,13 @@ static int pipe_get_internal(k_spinlock_key_t key, struct k_pipe *pipe,
 		src_desc = (struct _pipe_desc *)sys_dlist_get(&src_list);
 	}
 
-	if (pipe->bytes_used != pipe->size) {
-		sys_dlist_t         pipe_list;
-
-		/*
-		 * The pipe is not full. If there are any waiting writers,
-		 * refill the pipe.
-		 */
-
-		sys_dlist_init(&src_list);
-		sys_dlist_init(&pipe_list);
-
-		(void) pipe_waiter_list_populate(&src_list,
-						 &pipe->wait_q.writers,
-						 pipe->size - pipe->bytes_used);
-
-		(void) pipe_buffer_list_populate(&pipe_list, pipe_desc,
-						 pipe->buffer, pipe->size,
-						 pipe->write_index,
-						 pipe->read_index);
+	/*
+	 * If the pipe is not full and there are any waiting writers,
+	 * refill the pipe. Not while the free space is reserved though.
+	 */
 
-		(void) pipe_write(pipe, &src_list,
-				  &pipe_list, &reschedule_needed);
+	if ((pipe->flags & K_PIPE_FLAG_RESERVED) == 0U) {
+		pipe_buffer_refill(pipe, &reschedule_needed);
 	}
 
 	/*
@@ -736,6 +821,157 @@ int z_vrfy_k_pipe_get(struct k_pipe *pipe, void *data, size_t bytes_to_read,
 #include <syscalls/k_pipe_get_mrsh.c>
 #endif
 
+int k_pipe_reserve(struct k_pipe *pipe, void **data, size_t *size)
+{
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+	size_t avail;
+	int ret = 0;
+
+	if ((pipe->flags & K_PIPE_FLAG_RESERVED) != 0U) {
+		ret = -EBUSY;
+		goto out;
+	}
+
+	/* Contiguous free space from the write index on */
+	if (pipe->bytes_used == pipe->size) {
+		avail = 0U;
+	} else if (pipe->write_index < pipe->read_index) {
+		avail = pipe->read_index - pipe->write_index;
+	} else {
+		avail = pipe->size - pipe->write_index;
+	}
+
+	if (avail == 0U) {
+		ret = -EAGAIN;
+		goto out;
+	}
+
+	*data = &pipe->buffer[pipe->write_index];
+	*size = MIN(*size, avail);
+	pipe->flags |= K_PIPE_FLAG_RESERVED;
+
+out:
+	k_spin_unlock(&pipe->lock, key);
+
+	return ret;
+}
+
+int k_pipe_commit(struct k_pipe *pipe, size_t size)
+{
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+	bool reschedule_needed = false;
+
+	CHECKIF(((pipe->flags & K_PIPE_FLAG_RESERVED) == 0U) ||
+		(size > pipe->size - pipe->bytes_used) ||
+		(size > pipe->size - pipe->write_index)) {
+		k_spin_unlock(&pipe->lock, key);
+
+		return -EINVAL;
+	}
+
+	pipe->flags &= ~K_PIPE_FLAG_RESERVED;
+	pipe->bytes_used += size;
+	pipe->write_index += size;
+	if (pipe->write_index >= pipe->size) {
+		pipe->write_index -= pipe->size;
+	}
+
+	/*
+	 * Readers only wait while the pipe buffer is empty, so none of its
+	 * remaining data can be ahead of the committed data.
+	 */
+
+	if ((pipe->flags & K_PIPE_FLAG_PEEKED) == 0U) {
+		pipe_buffer_drain(pipe, &reschedule_needed);
+	}
+
+	/* Writers may have been left waiting by a k_pipe_consume() while
+	 * the free space was reserved.
+	 */
+
+	pipe_buffer_refill(pipe, &reschedule_needed);
+
+	if ((pipe->bytes_used != 0U) && (size != 0U)) {
+		handle_poll_events(pipe);
+	}
+
+	if (reschedule_needed) {
+		z_reschedule(&pipe->lock, key);
+	} else {
+		k_spin_unlock(&pipe->lock, key);
+	}
+
+	return 0;
+}
+
+int k_pipe_peek(struct k_pipe *pipe, void **data, size_t *size)
+{
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+	size_t avail;
+	int ret = 0;
+
+	if ((pipe->flags & K_PIPE_FLAG_PEEKED) != 0U) {
+		ret = -EBUSY;
+		goto out;
+	}
+
+	/* Contiguous data from the read index on */
+	if (pipe->bytes_used == 0U) {
+		avail = 0U;
+	} else if (pipe->read_index < pipe->write_index) {
+		avail = pipe->write_index - pipe->read_index;
+	} else {
+		avail = pipe->size - pipe->read_index;
+	}
+
+	if (avail == 0U) {
+		ret = -EAGAIN;
+		goto out;
+	}
+
+	*data = &pipe->buffer[pipe->read_index];
+	*size = MIN(*size, avail);
+	pipe->flags |= K_PIPE_FLAG_PEEKED;
+
+out:
+	k_spin_unlock(&pipe->lock, key);
+
+	return ret;
+}
+
+int k_pipe_consume(struct k_pipe *pipe, size_t size)
+{
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+	bool reschedule_needed = false;
+
+	CHECKIF(((pipe->flags & K_PIPE_FLAG_PEEKED) == 0U) ||
+		(size > pipe->bytes_used) ||
+		(size > pipe->size - pipe->read_index)) {
+		k_spin_unlock(&pipe->lock, key);
+
+		return -EINVAL;
+	}
+
+	pipe->flags &= ~K_PIPE_FLAG_PEEKED;
+	pipe->bytes_used -= size;
+	pipe->read_index += size;
+	if (pipe->read_index >= pipe->size) {
+		pipe->read_index -= pipe->size;
+	}
+
+	if ((pipe->flags & K_PIPE_FLAG_RESERVED) == 0U) {
+		pipe_buffer_refill(pipe, &reschedule_needed);
+	}
+
+	if (reschedule_needed) {
+		z_reschedule(&pipe->lock, key);
+	} else {
+		k_spin_unlock(&pipe->lock, key);
+	}
+
+	return 0;
+}
+
 size_t z_impl_k_pipe_read_avail(struct k_pipe *pipe)
 {
 	size_t res;
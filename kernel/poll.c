@@ -24,6 +24,7 @@
 #include <zephyr/sys/dlist.h>
 #include <zephyr/sys/util.h>
 #include <zephyr/sys/__assert.h>
+#include <zephyr/sys/barrier.h>
 #include <stdbool.h>
 
 /* Single subsystem lock.  Locking per-event would be better on highly
@@ -35,10 +36,14 @@
  */
 static struct k_spinlock lock;
 
-enum POLL_MODE { MODE_NONE, MODE_POLL, MODE_TRIGGERED };
+enum POLL_MODE { MODE_NONE, MODE_POLL, MODE_TRIGGERED, MODE_SET };
 
 static int signal_poller(struct k_poll_event *event, uint32_t state);
 static int signal_triggered_work(struct k_poll_event *event, uint32_t status);
+static int signal_poll_event(struct k_poll_event *event, uint32_t state);
+#ifdef CONFIG_POLL_SET
+static int signal_set(struct k_poll_event *event, uint32_t state);
+#endif
 
 void k_poll_event_init(struct k_poll_event *event, uint32_t type,
 		       int mode, void *obj)
@@ -109,13 +114,20 @@ static struct k_thread *poller_thread(struct z_poller *p)
 	return p ? CONTAINER_OF(p, struct k_thread, poller) : NULL;
 }
 
+/* Poll sets have no thread to order their events by, they go last */
+static inline bool poller_is_set(struct z_poller *poller)
+{
+	return IS_ENABLED(CONFIG_POLL_SET) && (poller->mode == MODE_SET);
+}
+
 static inline void add_event(sys_dlist_t *events, struct k_poll_event *event,
 			     struct z_poller *poller)
 {
 	struct k_poll_event *pending;
 
 	pending = (struct k_poll_event *)sys_dlist_peek_tail(events);
-	if ((pending == NULL) ||
+	if ((pending == NULL) || poller_is_set(poller) ||
+		poller_is_set(pending->poller) ||
 		(z_sched_prio_cmp(poller_thread(pending->poller),
 							   poller_thread(poller)) > 0)) {
 		sys_dlist_append(events, &event->_node);
@@ -123,7 +135,8 @@ static inline void add_event(sys_dlist_t *events, struct k_poll_event *event,
 	}
 
 	SYS_DLIST_FOR_EACH_CONTAINER(events, pending, _node) {
-		if (z_sched_prio_cmp(poller_thread(poller),
+		if (poller_is_set(pending->poller) ||
+		    z_sched_prio_cmp(poller_thread(poller),
 					poller_thread(pending->poller)) > 0) {
 			sys_dlist_insert(&pending->_node, &event->_node);
 			return;
@@ -169,6 +182,21 @@ static inline void register_event(struct k_poll_event *event,
 	}
 
 	event->poller = poller;
+
+#ifdef CONFIG_QUEUE_LOCKLESS_APPEND
+	/* An append that didn't see the event linked yet did not take
+	 * the queue lock to signal it, look for its data once more.
+	 */
+	if (event->type == K_POLL_TYPE_DATA_AVAILABLE) {
+		barrier_dmem_fence_full();
+
+		if (!k_queue_is_empty(event->queue)) {
+			sys_dlist_remove(&event->_node);
+			(void)signal_poll_event(event,
+						K_POLL_STATE_FIFO_DATA_AVAILABLE);
+		}
+	}
+#endif
 }
 
 /* must be called with interrupts locked */
@@ -443,6 +471,13 @@ static int signal_poll_event(struct k_poll_event *event, uint32_t state)
 	struct z_poller *poller = event->poller;
 	int retcode = 0;
 
+#ifdef CONFIG_POLL_SET
+	/* Events of a poll set stay owned by the set */
+	if ((poller != NULL) && (poller->mode == MODE_SET)) {
+		return signal_set(event, state);
+	}
+#endif
+
 	if (poller != NULL) {
 		if (poller->mode == MODE_POLL) {
 			retcode = signal_poller(event, state);
@@ -813,3 +848,165 @@ int k_work_poll_cancel(struct k_work_poll *work)
 
 	return retval;
 }
+
+#ifdef CONFIG_POLL_SET
+static struct k_poll_set *poller_to_set(struct z_poller *poller)
+{
+	return CONTAINER_OF(poller, struct k_poll_set, poller);
+}
+
+/* must be called with interrupts locked */
+static int signal_set(struct k_poll_event *event, uint32_t state)
+{
+	struct k_poll_set *set = poller_to_set(event->poller);
+	struct k_thread *thread;
+
+	/* The object already unlinked the event from its own list */
+	event->state |= state;
+	sys_dlist_append(&set->ready, &event->_node);
+
+	thread = z_unpend_first_thread(&set->wait_q);
+	if (thread != NULL) {
+		arch_thread_return_value_set(thread, 0);
+		z_ready_thread(thread);
+	}
+
+	return 0;
+}
+
+/* must be called with interrupts locked */
+static void poll_set_arm(struct k_poll_set *set, struct k_poll_event *event)
+{
+	uint32_t state;
+
+	event->state = K_POLL_STATE_NOT_READY;
+
+	if (is_condition_met(event, &state)) {
+		event->poller = &set->poller;
+		event->state = state;
+		sys_dlist_append(&set->ready, &event->_node);
+	} else {
+		register_event(event, &set->poller);
+	}
+}
+
+void k_poll_set_init(struct k_poll_set *set)
+{
+	set->poller.is_polling = false;
+	set->poller.mode = MODE_SET;
+	sys_dlist_init(&set->ready);
+	sys_dlist_init(&set->reported);
+	z_waitq_init(&set->wait_q);
+}
+
+int k_poll_set_add(struct k_poll_set *set, struct k_poll_event *event)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	int ret = 0;
+
+	if (event->poller != NULL) {
+		ret = -EALREADY;
+	} else {
+		poll_set_arm(set, event);
+
+		/* Let a waiter see an event that is ready right away */
+		if (event->state != K_POLL_STATE_NOT_READY) {
+			struct k_thread *thread;
+
+			thread = z_unpend_first_thread(&set->wait_q);
+			if (thread != NULL) {
+				arch_thread_return_value_set(thread, 0);
+				z_ready_thread(thread);
+			}
+		}
+	}
+
+	z_reschedule(&lock, key);
+
+	return ret;
+}
+
+int k_poll_set_remove(struct k_poll_set *set, struct k_poll_event *event)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	int ret = 0;
+
+	if (event->poller != &set->poller) {
+		ret = -EINVAL;
+	} else {
+		/* The event is linked into its object's list, or into the
+		 * set's ready or reported list.
+		 */
+		if (sys_dnode_is_linked(&event->_node)) {
+			sys_dlist_remove(&event->_node);
+		}
+		event->poller = NULL;
+	}
+
+	k_spin_unlock(&lock, key);
+
+	return ret;
+}
+
+int k_poll_set_wait(struct k_poll_set *set, struct k_poll_event **ready,
+		    int max_events, k_timeout_t timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	struct k_poll_event *event;
+	k_spinlock_key_t key;
+	int num_ready = 0;
+
+	__ASSERT(!arch_is_in_isr(), "");
+	__ASSERT(ready != NULL, "NULL ready\n");
+	__ASSERT(max_events > 0, "no room for events\n");
+
+	key = k_spin_lock(&lock);
+
+	/* Re-arm the events handed out by the previous wait.  Release the
+	 * lock in between for latency control, like for registrations.
+	 */
+	while ((event = (struct k_poll_event *)sys_dlist_get(&set->reported)) != NULL) {
+		poll_set_arm(set, event);
+		k_spin_unlock(&lock, key);
+		key = k_spin_lock(&lock);
+	}
+
+	while (true) {
+		while (num_ready < max_events) {
+			event = (struct k_poll_event *)sys_dlist_get(&set->ready);
+			if (event == NULL) {
+				break;
+			}
+
+			ready[num_ready++] = event;
+			sys_dlist_append(&set->reported, &event->_node);
+		}
+
+		if (num_ready > 0) {
+			break;
+		}
+
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			k_spin_unlock(&lock, key);
+
+			return -EAGAIN;
+		}
+
+		int swap_rc = z_pend_curr(&lock, key, &set->wait_q, timeout);
+
+		if (swap_rc != 0) {
+			return swap_rc;
+		}
+
+		/* Another waiter may have taken the events, wait for the
+		 * rest of the period then.
+		 */
+		key = k_spin_lock(&lock);
+		timeout = sys_timepoint_timeout(end);
+	}
+
+	k_spin_unlock(&lock, key);
+
+	return num_ready;
+}
+#endif /* CONFIG_POLL_SET */
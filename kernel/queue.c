@@ -60,6 +60,10 @@ void z_impl_k_queue_init(struct k_queue *queue)
 	sys_sflist_init(&queue->data_q);
 	queue->lock = (struct k_spinlock) {};
 	z_waitq_init(&queue->wait_q);
+#ifdef CONFIG_QUEUE_LOCKLESS_APPEND
+	(void)atomic_ptr_clear(&queue->append_head);
+	(void)atomic_clear(&queue->getters);
+#endif
 #if defined(CONFIG_POLL)
 	sys_dlist_init(&queue->poll_events);
 #endif
@@ -94,6 +98,110 @@ static inline void handle_poll_events(struct k_queue *queue, uint32_t state)
 #endif
 }
 
+#ifdef CONFIG_QUEUE_LOCKLESS_APPEND
+/*
+ * k_queue_append() pushes its item onto append_head with a compare and
+ * swap, and only takes the lock when somebody may be waiting for it.
+ * Every other operation moves the pushed items to data_q first, with the
+ * lock held.
+ *
+ * A producer pushes and then looks for waiters, while a getter counts
+ * itself in getters and a poller links its event before looking for
+ * data. Both sides order the two steps with a full barrier, so at least
+ * one of them sees the other.
+ */
+
+/* must be called with queue->lock held */
+static void queue_collect(struct k_queue *queue)
+{
+	sys_sfnode_t *node = atomic_ptr_clear(&queue->append_head);
+	sys_sfnode_t *tail = sys_sflist_peek_tail(&queue->data_q);
+	sys_sfnode_t *next;
+
+	/* The items were pushed newest first, inserting each of them right
+	 * after the old tail restores the order they were appended in.
+	 */
+	while (node != NULL) {
+		next = (sys_sfnode_t *)node->next_and_flags;
+		sys_sflist_insert(&queue->data_q, tail, node);
+		node = next;
+	}
+}
+
+static inline bool queue_has_waiters(struct k_queue *queue)
+{
+	if (atomic_get(&queue->getters) != 0) {
+		return true;
+	}
+#ifdef CONFIG_POLL
+	return !sys_dlist_is_empty(&queue->poll_events);
+#else
+	return false;
+#endif
+}
+
+static void queue_wake_waiters(struct k_queue *queue)
+{
+	k_spinlock_key_t key = k_spin_lock(&queue->lock);
+	struct k_thread *thread;
+	sys_sfnode_t *node;
+
+	queue_collect(queue);
+
+	while (!sys_sflist_is_empty(&queue->data_q)) {
+		thread = z_unpend_first_thread(&queue->wait_q);
+		if (thread == NULL) {
+			break;
+		}
+
+		node = sys_sflist_get_not_empty(&queue->data_q);
+		prepare_thread_to_run(thread, z_queue_node_peek(node, true));
+	}
+
+	if (!sys_sflist_is_empty(&queue->data_q)) {
+		handle_poll_events(queue, K_POLL_STATE_DATA_AVAILABLE);
+	}
+
+	z_reschedule(&queue->lock, key);
+}
+
+static void queue_lockless_append(struct k_queue *queue, void *data)
+{
+	sys_sfnode_t *node = data;
+	void *head;
+
+	do {
+		head = atomic_ptr_get(&queue->append_head);
+		node->next_and_flags = (unative_t)head;
+	} while (!atomic_ptr_cas(&queue->append_head, head, node));
+
+	if (queue_has_waiters(queue)) {
+		queue_wake_waiters(queue);
+	}
+}
+
+/* For readers that don't take the lock */
+static inline void queue_collect_unlocked(struct k_queue *queue)
+{
+	if (atomic_ptr_get(&queue->append_head) != NULL) {
+		k_spinlock_key_t key = k_spin_lock(&queue->lock);
+
+		queue_collect(queue);
+		k_spin_unlock(&queue->lock, key);
+	}
+}
+#else
+static inline void queue_collect(struct k_queue *queue)
+{
+	ARG_UNUSED(queue);
+}
+
+static inline void queue_collect_unlocked(struct k_queue *queue)
+{
+	ARG_UNUSED(queue);
+}
+#endif /* CONFIG_QUEUE_LOCKLESS_APPEND */
+
 void z_impl_k_queue_cancel_wait(struct k_queue *queue)
 {
 	SYS_PORT_TRACING_OBJ_FUNC(k_queue, cancel_wait, queue);
@@ -128,6 +236,8 @@ static int32_t queue_insert(struct k_queue *queue, void *prev, void *data,
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_queue, queue_insert, queue, alloc);
 
+	queue_collect(queue);
+
 	if (is_append) {
 		prev = sys_sflist_peek_tail(&queue->data_q);
 	}
@@ -188,7 +298,11 @@ void k_queue_append(struct k_queue *queue, void *data)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_queue, append, queue);
 
+#ifdef CONFIG_QUEUE_LOCKLESS_APPEND
+	queue_lockless_append(queue, data);
+#else
 	(void)queue_insert(queue, NULL, data, false, true);
+#endif
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_queue, append, queue);
 }
@@ -258,6 +372,8 @@ int k_queue_append_list(struct k_queue *queue, void *head, void *tail)
 	k_spinlock_key_t key = k_spin_lock(&queue->lock);
 	struct k_thread *thread = NULL;
 
+	queue_collect(queue);
+
 	if (head != NULL) {
 		thread = z_unpend_first_thread(&queue->wait_q);
 	}
@@ -321,6 +437,8 @@ void *z_impl_k_queue_get(struct k_queue *queue, k_timeout_t timeout)
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_queue, get, queue, timeout);
 
+	queue_collect(queue);
+
 	if (likely(!sys_sflist_is_empty(&queue->data_q))) {
 		sys_sfnode_t *node;
 
@@ -343,8 +461,31 @@ void *z_impl_k_queue_get(struct k_queue *queue, k_timeout_t timeout)
 		return NULL;
 	}
 
+#ifdef CONFIG_QUEUE_LOCKLESS_APPEND
+	/* Make producers take the lock and wake us, then look once more for
+	 * an item pushed before they could see that.
+	 */
+	(void)atomic_inc(&queue->getters);
+	queue_collect(queue);
+
+	if (!sys_sflist_is_empty(&queue->data_q)) {
+		(void)atomic_dec(&queue->getters);
+		data = z_queue_node_peek(sys_sflist_get_not_empty(&queue->data_q),
+					 true);
+		k_spin_unlock(&queue->lock, key);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_queue, get, queue, timeout, data);
+
+		return data;
+	}
+#endif
+
 	int ret = z_pend_curr(&queue->lock, key, &queue->wait_q, timeout);
 
+#ifdef CONFIG_QUEUE_LOCKLESS_APPEND
+	(void)atomic_dec(&queue->getters);
+#endif
+
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_queue, get, queue, timeout,
 		(ret != 0) ? NULL : _current->base.swap_data);
 
@@ -355,6 +496,8 @@ bool k_queue_remove(struct k_queue *queue, void *data)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_queue, remove, queue);
 
+	queue_collect_unlocked(queue);
+
 	bool ret = sys_sflist_find_and_remove(&queue->data_q, (sys_sfnode_t *)data);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_queue, remove, queue, ret);
@@ -368,6 +511,8 @@ bool k_queue_unique_append(struct k_queue *queue, void *data)
 
 	sys_sfnode_t *test;
 
+	queue_collect_unlocked(queue);
+
 	SYS_SFLIST_FOR_EACH_NODE(&queue->data_q, test) {
 		if (test == (sys_sfnode_t *) data) {
 			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_queue, unique_append, queue, false);
@@ -385,6 +530,8 @@ bool k_queue_unique_append(struct k_queue *queue, void *data)
 
 void *z_impl_k_queue_peek_head(struct k_queue *queue)
 {
+	queue_collect_unlocked(queue);
+
 	void *ret = z_queue_node_peek(sys_sflist_peek_head(&queue->data_q), false);
 
 	SYS_PORT_TRACING_OBJ_FUNC(k_queue, peek_head, queue, ret);
@@ -394,6 +541,8 @@ void *z_impl_k_queue_peek_head(struct k_queue *queue)
 
 void *z_impl_k_queue_peek_tail(struct k_queue *queue)
 {
+	queue_collect_unlocked(queue);
+
 	void *ret = z_queue_node_peek(sys_sflist_peek_tail(&queue->data_q), false);
 
 	SYS_PORT_TRACING_OBJ_FUNC(k_queue, peek_tail, queue, ret);
@@ -220,6 +220,8 @@ static ALWAYS_INLINE void *thread_runq(struct k_thread *thread)
 	cpu = m == 0 ? 0 : u32_count_trailing_zeros(m);
 
 	return &_kernel.cpus[cpu].ready_q.runq;
+#elif defined(CONFIG_SCHED_CPU_RUNQ)
+	return &_kernel.cpus[thread->base.runq_cpu].ready_q.runq;
 #else
 	ARG_UNUSED(thread);
 	return &_kernel.ready_q.runq;
@@ -228,15 +230,93 @@ static ALWAYS_INLINE void *thread_runq(struct k_thread *thread)
 
 static ALWAYS_INLINE void *curr_cpu_runq(void)
 {
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#ifdef CONFIG_SCHED_PER_CPU_READY_Q
 	return &arch_curr_cpu()->ready_q.runq;
 #else
 	return &_kernel.ready_q.runq;
 #endif
 }
 
+#ifdef CONFIG_SCHED_CPU_RUNQ
+static ALWAYS_INLINE bool cpu_allowed(struct k_thread *thread, int cpu)
+{
+#ifdef CONFIG_SCHED_CPU_MASK
+	return (thread->base.cpu_mask & BIT(cpu)) != 0;
+#else
+	ARG_UNUSED(thread);
+	ARG_UNUSED(cpu);
+	return true;
+#endif
+}
+
+/* Selects the CPU whose run queue a newly runnable thread goes to.
+ * The CPU it last ran on is preferred to keep its caches warm, as
+ * long as that CPU would pick it up right away.  Otherwise the first
+ * allowed CPU that is idle or running something of lower priority
+ * gets it, so that queuing on one CPU never starves a thread that
+ * another CPU could run now.  Anything else falls back to the
+ * preferred CPU, where it waits its turn or gets stolen.
+ */
+static int runq_pick_cpu(struct k_thread *thread)
+{
+	unsigned int num_cpus = arch_num_cpus();
+	int pref = thread->base.cpu < num_cpus ? thread->base.cpu : 0;
+
+	if (!cpu_allowed(thread, pref)) {
+#ifdef CONFIG_SCHED_CPU_MASK
+		int m = thread->base.cpu_mask & BIT_MASK(num_cpus);
+
+		/* As with CPU_MASK_PIN_ONLY, a thread with every CPU
+		 * masked off is legal and simply never runs.
+		 */
+		pref = m == 0 ? pref : u32_count_trailing_zeros(m);
+#endif
+	}
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		int cpu = (pref + i) % num_cpus;
+		struct k_thread *curr = _kernel.cpus[cpu].current;
+
+		if (!cpu_allowed(thread, cpu) || (curr == NULL)) {
+			continue;
+		}
+
+		if ((curr == thread) || z_is_idle_thread_object(curr) ||
+		    (z_sched_prio_cmp(thread, curr) > 0)) {
+			return cpu;
+		}
+	}
+
+	return pref;
+}
+
+/* Called with an empty local run queue: take the best thread queued
+ * on another CPU that this CPU is allowed to run.
+ */
+static struct k_thread *runq_steal(void)
+{
+	unsigned int num_cpus = arch_num_cpus();
+	struct k_thread *best = NULL;
+
+	for (unsigned int i = 1; i < num_cpus; i++) {
+		int cpu = (_current_cpu->id + i) % num_cpus;
+		struct k_thread *thread = _priq_run_best(&_kernel.cpus[cpu].ready_q.runq);
+
+		if ((thread != NULL) &&
+		    ((best == NULL) || (z_sched_prio_cmp(thread, best) > 0))) {
+			best = thread;
+		}
+	}
+
+	return best;
+}
+#endif /* CONFIG_SCHED_CPU_RUNQ */
+
 static ALWAYS_INLINE void runq_add(struct k_thread *thread)
 {
+#ifdef CONFIG_SCHED_CPU_RUNQ
+	thread->base.runq_cpu = runq_pick_cpu(thread);
+#endif
 	_priq_run_add(thread_runq(thread), thread);
 }
 
@@ -247,7 +327,15 @@ static ALWAYS_INLINE void runq_remove(struct k_thread *thread)
 
 static ALWAYS_INLINE struct k_thread *runq_best(void)
 {
-	return _priq_run_best(curr_cpu_runq());
+	struct k_thread *thread = _priq_run_best(curr_cpu_runq());
+
+#ifdef CONFIG_SCHED_CPU_RUNQ
+	if (thread == NULL) {
+		thread = runq_steal();
+	}
+#endif
+
+	return thread;
 }
 
 /* _current is never in the run queue until context switch on
@@ -280,20 +368,45 @@ static ALWAYS_INLINE void dequeue_thread(struct k_thread *thread)
 	}
 }
 
+static void send_ipi(uint32_t cpu_bitmap)
+{
+#if defined(CONFIG_SMP) && defined(CONFIG_SCHED_IPI_SUPPORTED)
+#ifdef CONFIG_SCHED_THREAD_USAGE
+	unsigned int num_cpus = arch_num_cpus();
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		if ((cpu_bitmap & BIT(i)) != 0U) {
+			atomic_inc(&_kernel.cpus[i].ipi_received);
+		}
+	}
+#endif
+
+#ifdef CONFIG_ARCH_HAS_DIRECTED_IPIS
+	arch_sched_directed_ipi(cpu_bitmap);
+#else
+	ARG_UNUSED(cpu_bitmap);
+	arch_sched_ipi();
+#endif
+#else
+	ARG_UNUSED(cpu_bitmap);
+#endif
+}
+
 static void signal_pending_ipi(void)
 {
 	/* Synchronization note: you might think we need to lock these
 	 * two steps, but an IPI is idempotent.  It's OK if we do it
-	 * twice.  All we require is that if a CPU sees the flag true,
+	 * twice.  All we require is that if a CPU sees its bit set,
 	 * it is guaranteed to send the IPI, and if a core sets
 	 * pending_ipi, the IPI will be sent the next time through
 	 * this code.
 	 */
 #if defined(CONFIG_SMP) && defined(CONFIG_SCHED_IPI_SUPPORTED)
 	if (arch_num_cpus() > 1) {
-		if (_kernel.pending_ipi) {
-			_kernel.pending_ipi = false;
-			arch_sched_ipi();
+		uint32_t cpu_bitmap = (uint32_t)atomic_clear(&_kernel.pending_ipi);
+
+		if (cpu_bitmap != 0U) {
+			send_ipi(cpu_bitmap);
 		}
 	}
 #endif
@@ -428,12 +541,53 @@ static void move_thread_to_end_of_prio_q(struct k_thread *thread)
 	update_cache(thread == _current);
 }
 
-static void flag_ipi(void)
+static void flag_ipi(uint32_t ipi_mask)
 {
 #if defined(CONFIG_SMP) && defined(CONFIG_SCHED_IPI_SUPPORTED)
-	if (arch_num_cpus() > 1) {
-		_kernel.pending_ipi = true;
+	if ((arch_num_cpus() > 1) && (ipi_mask != 0U)) {
+		atomic_or(&_kernel.pending_ipi, (atomic_val_t)ipi_mask);
+	}
+#else
+	ARG_UNUSED(ipi_mask);
+#endif
+}
+
+/* Bitmask of the other CPUs that would switch to @a thread if it
+ * became runnable now: those it may run on that are running a lower
+ * priority thread they can be preempted out of.  CPUs running
+ * something of equal or higher priority would just take the
+ * interrupt and return to what they were doing.
+ */
+static uint32_t ipi_mask_create(struct k_thread *thread)
+{
+#if defined(CONFIG_SMP) && defined(CONFIG_SCHED_IPI_SUPPORTED)
+	uint32_t ipi_mask = 0U;
+	uint32_t id = _current_cpu->id;
+	unsigned int num_cpus = arch_num_cpus();
+
+	for (uint32_t i = 0; i < num_cpus; i++) {
+		struct k_thread *cpu_thread = _kernel.cpus[i].current;
+
+		if ((i == id) || (cpu_thread == NULL)) {
+			continue;
+		}
+
+#ifdef CONFIG_SCHED_CPU_MASK
+		if ((thread->base.cpu_mask & BIT(i)) == 0) {
+			continue;
+		}
+#endif
+
+		if ((z_sched_prio_cmp(cpu_thread, thread) < 0) &&
+		    (is_preempt(cpu_thread) || is_metairq(thread))) {
+			ipi_mask |= BIT(i);
+		}
 	}
+
+	return ipi_mask;
+#else
+	ARG_UNUSED(thread);
+	return 0U;
 #endif
 }
 
@@ -453,6 +607,93 @@ static bool slice_expired[CONFIG_MP_MAX_NUM_CPUS];
 static struct k_thread *pending_current;
 #endif
 
+#ifdef CONFIG_SCHED_DEADLINE_SERVER
+/* Utilization reserved by all servers, in parts per million */
+static uint32_t server_util;
+
+/* Server of the thread running on each CPU, and since when it runs */
+static struct k_sched_server *served[CONFIG_MP_MAX_NUM_CPUS];
+static uint32_t served_since[CONFIG_MP_MAX_NUM_CPUS];
+
+/* Charge the server running on a CPU for the time since the last call */
+static void server_charge(int cpu)
+{
+	uint32_t now = k_cycle_get_32();
+
+	if (served[cpu] != NULL) {
+		served[cpu]->remaining -= (int32_t)(now - served_since[cpu]);
+	}
+	served_since[cpu] = now;
+}
+
+static void server_set_deadline(struct k_sched_server *server,
+				uint32_t deadline)
+{
+	struct k_thread *thread;
+
+	server->deadline = deadline;
+
+	SYS_DLIST_FOR_EACH_CONTAINER(&server->threads, thread, base.server_node) {
+		thread->base.prio_deadline = deadline;
+		if (z_is_thread_queued(thread)) {
+			dequeue_thread(thread);
+			queue_thread(thread);
+		}
+	}
+}
+
+/* The budget is used up: replenish it, and postpone the deadline by a
+ * period for each budget consumed.
+ */
+static void server_replenish(struct k_sched_server *server)
+{
+	uint32_t deadline = server->deadline;
+
+	while (server->remaining <= 0) {
+		server->remaining += server->budget;
+		deadline += server->period;
+	}
+	server_set_deadline(server, deadline);
+}
+
+/* A thread of the server becomes runnable.  Keep the current budget and
+ * deadline unless using them would exceed the reserved bandwidth, that
+ * is unless remaining / (deadline - now) > budget / period.
+ */
+static void server_wakeup(struct k_sched_server *server)
+{
+	uint32_t now = k_cycle_get_32();
+	int32_t left = (int32_t)(server->deadline - now);
+
+	if ((left <= 0) ||
+	    ((uint64_t)MAX(server->remaining, 0) * server->period >
+	     (uint64_t)left * server->budget)) {
+		server->remaining = server->budget;
+		server_set_deadline(server, now + server->period);
+	} else if (server->remaining <= 0) {
+		server_replenish(server);
+	} else {
+		/* Keep going with the current budget */
+	}
+}
+
+static void server_detach(struct k_thread *thread)
+{
+	struct k_sched_server *server = thread->base.server;
+
+	if (server == NULL) {
+		return;
+	}
+
+	if (thread == _current) {
+		server_charge(_current_cpu->id);
+		served[_current_cpu->id] = NULL;
+	}
+	sys_dlist_remove(&thread->base.server_node);
+	thread->base.server = NULL;
+}
+#endif /* CONFIG_SCHED_DEADLINE_SERVER */
+
 static inline int slice_time(struct k_thread *thread)
 {
 	int ret = slice_ticks;
@@ -464,6 +705,16 @@ static inline int slice_time(struct k_thread *thread)
 #else
 	ARG_UNUSED(thread);
 #endif
+
+#ifdef CONFIG_SCHED_DEADLINE_SERVER
+	/* End the slice when the budget is used up */
+	if (thread->base.server != NULL) {
+		int budget = MAX(k_cyc_to_ticks_ceil32(
+				 MAX(thread->base.server->remaining, 1)), 1);
+
+		ret = (ret == 0) ? budget : MIN(ret, budget);
+	}
+#endif
 	return ret;
 }
 
@@ -479,6 +730,10 @@ static inline bool sliceable(struct k_thread *thread)
 	ret |= thread->base.slice_ticks != 0;
 #endif
 
+#ifdef CONFIG_SCHED_DEADLINE_SERVER
+	ret |= thread->base.server != NULL;
+#endif
+
 	return ret;
 }
 
@@ -489,11 +744,10 @@ static void slice_timeout(struct _timeout *t)
 	slice_expired[cpu] = true;
 
 	/* We need an IPI if we just handled a timeslice expiration
-	 * for a different CPU.  Ideally this would be able to target
-	 * the specific core, but that's not part of the API yet.
+	 * for a different CPU.
 	 */
 	if (IS_ENABLED(CONFIG_SMP) && cpu != _current_cpu->id) {
-		flag_ipi();
+		flag_ipi(BIT(cpu));
 	}
 }
 
@@ -503,6 +757,15 @@ void z_reset_time_slice(struct k_thread *curr)
 
 	z_abort_timeout(&slice_timeouts[cpu]);
 	slice_expired[cpu] = false;
+
+#ifdef CONFIG_SCHED_DEADLINE_SERVER
+	server_charge(cpu);
+	served[cpu] = curr->base.server;
+	if ((served[cpu] != NULL) && (served[cpu]->remaining <= 0)) {
+		server_replenish(served[cpu]);
+	}
+#endif
+
 	if (sliceable(curr)) {
 		z_add_timeout(&slice_timeouts[cpu], slice_timeout,
 			      K_TICKS(slice_time(curr) - 1));
@@ -554,12 +817,120 @@ void z_time_slice(void)
 		}
 #endif
 		if (!z_is_thread_prevented_from_running(curr)) {
+#ifdef CONFIG_SCHED_DEADLINE_SERVER
+			server_charge(_current_cpu->id);
+			if ((curr->base.server != NULL) &&
+			    (curr->base.server->remaining <= 0)) {
+				server_replenish(curr->base.server);
+			}
+#endif
 			move_thread_to_end_of_prio_q(curr);
 		}
 		z_reset_time_slice(curr);
 	}
 	k_spin_unlock(&sched_spinlock, key);
 }
+
+#ifdef CONFIG_SCHED_DEADLINE_SERVER
+int k_sched_server_init(struct k_sched_server *server, uint32_t budget_us,
+			uint32_t period_us)
+{
+	uint32_t util;
+	int ret = 0;
+
+	if ((budget_us == 0U) || (budget_us > period_us) ||
+	    (k_us_to_cyc_ceil64(period_us) > INT32_MAX)) {
+		return -EINVAL;
+	}
+
+	util = (uint32_t)(((uint64_t)budget_us * 1000000U) / period_us);
+
+	K_SPINLOCK(&sched_spinlock) {
+		if ((server_util + util) >
+		    (CONFIG_SCHED_DEADLINE_SERVER_MAX_UTIL * 10000U)) {
+			ret = -EBUSY;
+			K_SPINLOCK_BREAK;
+		}
+
+		server_util += util;
+		server->util = util;
+		server->budget = k_us_to_cyc_ceil32(budget_us);
+		server->period = k_us_to_cyc_ceil32(period_us);
+		server->remaining = (int32_t)server->budget;
+		server->deadline = k_cycle_get_32() + server->period;
+		sys_dlist_init(&server->threads);
+	}
+
+	return ret;
+}
+
+int k_sched_server_release(struct k_sched_server *server)
+{
+	int ret = 0;
+
+	K_SPINLOCK(&sched_spinlock) {
+		if (!sys_dlist_is_empty(&server->threads)) {
+			ret = -EBUSY;
+			K_SPINLOCK_BREAK;
+		}
+
+		/* A detached thread may still run on another CPU */
+		for (int i = 0; i < ARRAY_SIZE(served); i++) {
+			if (served[i] == server) {
+				served[i] = NULL;
+			}
+		}
+
+		server_util -= server->util;
+		server->util = 0U;
+	}
+
+	return ret;
+}
+
+int k_sched_server_attach(struct k_sched_server *server, k_tid_t thread)
+{
+	int ret = 0;
+
+	K_SPINLOCK(&sched_spinlock) {
+		if (!is_preempt(thread)) {
+			ret = -EINVAL;
+			K_SPINLOCK_BREAK;
+		}
+
+		if (thread->base.server != NULL) {
+			ret = -EALREADY;
+			K_SPINLOCK_BREAK;
+		}
+
+		thread->base.server = server;
+		sys_dlist_append(&server->threads, &thread->base.server_node);
+		server_wakeup(server);
+
+		thread->base.prio_deadline = server->deadline;
+		if (z_is_thread_queued(thread)) {
+			dequeue_thread(thread);
+			queue_thread(thread);
+		}
+
+		if (thread == _current) {
+			z_reset_time_slice(thread);
+		}
+	}
+
+	return ret;
+}
+
+void k_sched_server_detach(k_tid_t thread)
+{
+	K_SPINLOCK(&sched_spinlock) {
+		server_detach(thread);
+		if (thread == _current) {
+			z_reset_time_slice(thread);
+		}
+	}
+}
+#endif /* CONFIG_SCHED_DEADLINE_SERVER */
 #endif
 
 /* Track cooperative threads preempted by metairqs so we can return to
@@ -611,11 +982,11 @@ static void update_cache(int preempt_ok)
 #endif
 }
 
-static bool thread_active_elsewhere(struct k_thread *thread)
+static struct _cpu *thread_active_elsewhere(struct k_thread *thread)
 {
-	/* True if the thread is currently running on another CPU.
-	 * There are more scalable designs to answer this question in
-	 * constant time, but this is fine for now.
+	/* Returns the other CPU the thread is currently running on,
+	 * or NULL.  There are more scalable designs to answer this
+	 * question in constant time, but this is fine for now.
 	 */
 #ifdef CONFIG_SMP
 	int currcpu = _current_cpu->id;
@@ -625,12 +996,12 @@ static bool thread_active_elsewhere(struct k_thread *thread)
 	for (int i = 0; i < num_cpus; i++) {
 		if ((i != currcpu) &&
 		    (_kernel.cpus[i].current == thread)) {
-			return true;
+			return &_kernel.cpus[i];
 		}
 	}
 #endif
 	ARG_UNUSED(thread);
-	return false;
+	return NULL;
 }
 
 static void ready_thread(struct k_thread *thread)
@@ -645,9 +1016,19 @@ static void ready_thread(struct k_thread *thread)
 	if (!z_is_thread_queued(thread) && z_is_thread_ready(thread)) {
 		SYS_PORT_TRACING_OBJ_FUNC(k_thread, sched_ready, thread);
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+		z_sched_usage_ready(thread);
+#endif
+
+#ifdef CONFIG_SCHED_DEADLINE_SERVER
+		if (thread->base.server != NULL) {
+			server_wakeup(thread->base.server);
+		}
+#endif
+
 		queue_thread(thread);
 		update_cache(0);
-		flag_ipi();
+		flag_ipi(ipi_mask_create(thread));
 	}
 }
 
@@ -711,9 +1092,9 @@ static void z_thread_halt(struct k_thread *thread, k_spinlock_key_t key,
 						  : _THREAD_SUSPENDED);
 	}
 
-	bool active = thread_active_elsewhere(thread);
+	struct _cpu *cpu = thread_active_elsewhere(thread);
 
-	if (active) {
+	if (cpu != NULL) {
 		/* It's running somewhere else, flag and poke */
 		thread->base.thread_state |= (terminate ? _THREAD_ABORTING
 							: _THREAD_SUSPENDING);
@@ -721,9 +1102,7 @@ static void z_thread_halt(struct k_thread *thread, k_spinlock_key_t key,
 		/* We might spin to wait, so a true synchronous IPI is needed
 		 * here, not deferred!
 		 */
-#ifdef CONFIG_SCHED_IPI_SUPPORTED
-		arch_sched_ipi();
-#endif
+		send_ipi(BIT(cpu->id));
 	}
 
 	if (is_halting(thread) && (thread != _current)) {
@@ -1048,7 +1427,17 @@ void z_thread_priority_set(struct k_thread *thread, int prio)
 {
 	bool need_sched = z_set_prio(thread, prio);
 
-	flag_ipi();
+#if defined(CONFIG_SMP) && defined(CONFIG_SCHED_IPI_SUPPORTED)
+	K_SPINLOCK(&sched_spinlock) {
+		struct _cpu *cpu = thread_active_elsewhere(thread);
+
+		/* A thread running elsewhere may now be outranked by
+		 * something queued; a queued one may now outrank
+		 * what other CPUs are running.
+		 */
+		flag_ipi(cpu != NULL ? BIT(cpu->id) : ipi_mask_create(thread));
+	}
+#endif
 
 	if (need_sched && _current->base.sched_locked == 0U) {
 		z_reschedule_unlocked();
@@ -1152,6 +1541,9 @@ struct k_thread *z_swap_next_thread(void)
 static inline void set_current(struct k_thread *new_thread)
 {
 	z_thread_mark_switched_out();
+#ifdef CONFIG_SCHED_CPU_RUNQ
+	new_thread->base.cpu = _current_cpu->id;
+#endif
 	_current_cpu->current = new_thread;
 }
 
@@ -1402,7 +1794,7 @@ void init_ready_q(struct _ready_q *rq)
 		}
 	};
 #elif defined(CONFIG_SCHED_MULTIQ)
-	for (int i = 0; i < ARRAY_SIZE(_kernel.ready_q.runq.queues); i++) {
+	for (int i = 0; i < ARRAY_SIZE(rq->runq.queues); i++) {
 		sys_dlist_init(&rq->runq.queues[i]);
 	}
 #else
@@ -1412,7 +1804,7 @@ void init_ready_q(struct _ready_q *rq)
 
 void z_sched_init(void)
 {
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#ifdef CONFIG_SCHED_PER_CPU_READY_Q
 	for (int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
 		init_ready_q(&_kernel.cpus[i].ready_q);
 	}
@@ -1656,8 +2048,6 @@ void z_impl_k_wakeup(k_tid_t thread)
 	z_mark_thread_as_not_suspended(thread);
 	z_ready_thread(thread);
 
-	flag_ipi();
-
 	if (!arch_is_in_isr()) {
 		z_reschedule_unlocked();
 	}
@@ -1667,6 +2057,41 @@ void z_impl_k_wakeup(k_tid_t thread)
 extern void z_trace_sched_ipi(void);
 #endif
 
+#if defined(CONFIG_SMP) && defined(CONFIG_SCHED_IPI_SUPPORTED) && \
+	defined(CONFIG_SCHED_THREAD_USAGE)
+/* An IPI is useful if it makes this CPU halt its thread, end its
+ * time slice or switch to a better thread on the way out of the
+ * interrupt.
+ */
+static bool ipi_is_useful(void)
+{
+	bool useful = false;
+
+	K_SPINLOCK(&sched_spinlock) {
+		struct k_thread *thread;
+
+		if (is_halting(_current)) {
+			useful = true;
+			K_SPINLOCK_BREAK;
+		}
+
+#ifdef CONFIG_TIMESLICING
+		if (slice_expired[_current_cpu->id]) {
+			useful = true;
+			K_SPINLOCK_BREAK;
+		}
+#endif
+
+		thread = runq_best();
+		useful = (thread != NULL) &&
+			 (z_sched_prio_cmp(thread, _current) > 0) &&
+			 should_preempt(thread, 0);
+	}
+
+	return useful;
+}
+#endif
+
 #ifdef CONFIG_SMP
 void z_sched_ipi(void)
 {
@@ -1677,6 +2102,12 @@ void z_sched_ipi(void)
 	z_trace_sched_ipi();
 #endif
 
+#if defined(CONFIG_SCHED_IPI_SUPPORTED) && defined(CONFIG_SCHED_THREAD_USAGE)
+	if (!ipi_is_useful()) {
+		_current_cpu->ipi_useless++;
+	}
+#endif
+
 #ifdef CONFIG_TIMESLICING
 	if (sliceable(_current)) {
 		z_time_slice();
@@ -1843,6 +2274,9 @@ static void halt_thread(struct k_thread *thread, uint8_t new_state)
 			}
 			(void)z_abort_thread_timeout(thread);
 			unpend_all(&thread->join_queue);
+#ifdef CONFIG_SCHED_DEADLINE_SERVER
+			server_detach(thread);
+#endif
 		}
 #ifdef CONFIG_SMP
 		unpend_all(&thread->halt_queue);
@@ -2057,3 +2491,18 @@ int z_sched_waitq_walk(_wait_q_t  *wait_q,
 
 	return status;
 }
+
+#ifdef CONFIG_EVENTS_INDEXED_WAITERS
+void z_sched_waitq_move(struct k_thread *thread, _wait_q_t *from,
+			_wait_q_t *to)
+{
+	K_SPINLOCK(&sched_spinlock) {
+		/* Leave the thread alone if it timed out or was aborted */
+		if (thread->base.pended_on == from) {
+			_priq_wait_remove(&from->waitq, thread);
+			thread->base.pended_on = to;
+			z_priq_wait_add(&to->waitq, thread);
+		}
+	}
+}
+#endif /* CONFIG_EVENTS_INDEXED_WAITERS */
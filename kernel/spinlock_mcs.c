@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/kernel_structs.h>
+#include <zephyr/linker/sections.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/sys/__assert.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/util.h>
+
+BUILD_ASSERT(CONFIG_MCS_SPINLOCK_NODES <= 32, "Too many nodes for mask");
+
+/* Nodes are only ever used by their own CPU, with interrupts locked, so
+ * the allocation mask needs no atomics. Nodes are not necessarily
+ * released in the order they were taken: z_swap() releases the caller's
+ * lock before the scheduler lock it takes afterwards.
+ *
+ * Each CPU's pool is kept on its own cache line, so that a CPU spinning
+ * on its node doesn't share the line with another CPU's nodes.
+ */
+struct mcs_cpu_nodes {
+	struct z_spin_mcs_node node[CONFIG_MCS_SPINLOCK_NODES];
+	uint32_t used;
+} __aligned(64);
+
+__pinned_bss
+static struct mcs_cpu_nodes mcs_nodes[CONFIG_MP_MAX_NUM_CPUS];
+
+static ALWAYS_INLINE struct z_spin_mcs_node *mcs_node_get(void)
+{
+	struct mcs_cpu_nodes *pool = &mcs_nodes[arch_curr_cpu()->id];
+	unsigned int idx = find_lsb_set(~pool->used);
+
+	__ASSERT((idx != 0U) && (idx <= CONFIG_MCS_SPINLOCK_NODES),
+		 "More than %d spinlocks held or waited for on CPU %d",
+		 CONFIG_MCS_SPINLOCK_NODES, arch_curr_cpu()->id);
+
+	pool->used |= BIT(idx - 1U);
+
+	return &pool->node[idx - 1U];
+}
+
+static ALWAYS_INLINE void mcs_node_put(struct z_spin_mcs_node *node)
+{
+	struct mcs_cpu_nodes *pool = &mcs_nodes[arch_curr_cpu()->id];
+
+	pool->used &= ~BIT(node - pool->node);
+}
+
+__pinned_func
+bool z_spin_mcs_lock(struct k_spinlock *l)
+{
+	struct z_spin_mcs_node *node = mcs_node_get();
+	struct z_spin_mcs_node *prev;
+
+	(void)atomic_ptr_clear(&node->next);
+	(void)atomic_set(&node->wait, 1);
+
+	/* Queue ourselves. A NULL previous tail means the lock was free. */
+	prev = atomic_ptr_set(&l->tail, node);
+	if (prev != NULL) {
+		(void)atomic_ptr_set(&prev->next, node);
+
+		while (atomic_get(&node->wait) != 0) {
+			arch_spin_relax();
+		}
+	}
+
+	l->holder = node;
+
+	return prev != NULL;
+}
+
+__pinned_func
+bool z_spin_mcs_trylock(struct k_spinlock *l)
+{
+	struct z_spin_mcs_node *node = mcs_node_get();
+
+	(void)atomic_ptr_clear(&node->next);
+
+	if (!atomic_ptr_cas(&l->tail, NULL, node)) {
+		mcs_node_put(node);
+		return false;
+	}
+
+	l->holder = node;
+
+	return true;
+}
+
+__pinned_func
+void z_spin_mcs_unlock(struct k_spinlock *l)
+{
+	struct z_spin_mcs_node *node = l->holder;
+	struct z_spin_mcs_node *next = atomic_ptr_get(&node->next);
+
+	if (next == NULL) {
+		/* Nobody queued behind us: mark the lock free */
+		if (atomic_ptr_cas(&l->tail, node, NULL)) {
+			mcs_node_put(node);
+			return;
+		}
+
+		/* A CPU has swapped the tail but not linked itself yet */
+		do {
+			arch_spin_relax();
+			next = atomic_ptr_get(&node->next);
+		} while (next == NULL);
+	}
+
+	(void)atomic_clear(&next->wait);
+	mcs_node_put(node);
+}
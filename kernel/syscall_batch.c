@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/internal/syscall_handler.h>
+#include <zephyr/sys/syscall_batch.h>
+
+int z_impl_k_syscall_batch(struct k_syscall_batch_entry *entries, size_t count)
+{
+	ARG_UNUSED(entries);
+	ARG_UNUSED(count);
+
+	return -ENOTSUP;
+}
+
+static inline int z_vrfy_k_syscall_batch(struct k_syscall_batch_entry *entries,
+					 size_t count)
+{
+	/* Frame of the batch system call, which the marshalling function of
+	 * each system call of the batch takes, sets and clears again.
+	 */
+	void *ssf = _current->syscall_frame;
+	struct k_syscall_batch_entry entry;
+
+	if (count > CONFIG_SYSCALL_BATCH_MAX_ENTRIES) {
+		return -EINVAL;
+	}
+
+	K_OOPS(K_SYSCALL_MEMORY_ARRAY_WRITE(entries, count, sizeof(*entries)));
+
+	for (size_t i = 0; i < count; i++) {
+		/* Work on a copy, so other user threads can't change the
+		 * identifier once it's been checked.
+		 */
+		(void)memcpy(&entry, &entries[i], sizeof(entry));
+
+		K_OOPS(K_SYSCALL_VERIFY_MSG(entry.id < K_SYSCALL_BAD,
+					    "bad system call id %lu in batch",
+					    (unsigned long)entry.id));
+		K_OOPS(K_SYSCALL_VERIFY_MSG(entry.id != K_SYSCALL_K_SYSCALL_BATCH,
+					    "nested system call batch"));
+
+		entry.ret = _k_syscall_table[entry.id](entry.args[0],
+						       entry.args[1],
+						       entry.args[2],
+						       entry.args[3],
+						       entry.args[4],
+						       entry.args[5], ssf);
+		_current->syscall_frame = ssf;
+
+		entries[i].ret = entry.ret;
+	}
+
+	return 0;
+}
+#include <syscalls/k_syscall_batch_mrsh.c>
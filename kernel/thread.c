@@ -588,6 +588,9 @@ static char *setup_thread_stack(struct k_thread *new_thread,
 	new_thread->stack_info.start = (uintptr_t)stack_buf_start;
 	new_thread->stack_info.size = stack_buf_size;
 	new_thread->stack_info.delta = delta;
+#ifdef CONFIG_THREAD_ANALYZER_INCREMENTAL
+	new_thread->stack_info.unused = 0;
+#endif
 #endif
 	stack_ptr -= delta;
 
@@ -729,6 +732,10 @@ char *z_setup_new_thread(struct k_thread *new_thread,
 		CONFIG_SCHED_THREAD_USAGE_AUTO_ENABLE;
 #endif
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+	new_thread->base.latency = (struct k_sched_latency) {};
+#endif
+
 	SYS_PORT_TRACING_OBJ_FUNC(k_thread, create, new_thread);
 
 	return stack_ptr;
@@ -908,6 +915,10 @@ void z_init_thread_base(struct _thread_base *thread_base, int priority,
 	thread_base->slice_expired = NULL;
 #endif
 
+#ifdef CONFIG_SCHED_DEADLINE_SERVER
+	thread_base->server = NULL;
+#endif
+
 	/* swap_data does not need to be initialized */
 
 	z_init_thread_timeout(thread_base);
@@ -1148,6 +1159,10 @@ void z_thread_mark_switched_in(void)
 	z_sched_usage_start(_current);
 #endif
 
+#if defined(CONFIG_USERSPACE_VDSO) && !defined(CONFIG_SMP)
+	z_vdso_current_update(_current);
+#endif
+
 #ifdef CONFIG_TRACING
 	SYS_PORT_TRACING_FUNC(k_thread, switched_in);
 #endif
@@ -1215,6 +1230,10 @@ int k_thread_runtime_stats_all_get(k_thread_runtime_stats_t *stats)
 		stats->average_cycles   += tmp_stats.average_cycles;
 #endif
 		stats->idle_cycles      += tmp_stats.idle_cycles;
+#if defined(CONFIG_SMP) && defined(CONFIG_SCHED_IPI_SUPPORTED)
+		stats->ipi_received     += tmp_stats.ipi_received;
+		stats->ipi_useless      += tmp_stats.ipi_useless;
+#endif
 	}
 #endif
 
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/kernel/thread_pool.h>
+
+static void thread_pool_worker(void *p1, void *p2, void *p3)
+{
+	struct z_thread_pool_worker *worker = p1;
+	struct k_thread_pool *pool = worker->pool;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (;;) {
+		(void)k_sem_take(&worker->start, K_FOREVER);
+
+		worker->entry(worker->p1, worker->p2, worker->p3);
+
+		/* Undo what the job may have changed for the next one */
+		if (k_thread_priority_get(&worker->thread) != pool->prio) {
+			k_thread_priority_set(&worker->thread, pool->prio);
+		}
+
+		k_fifo_put(&pool->idle, worker);
+	}
+}
+
+void k_thread_pool_start(struct k_thread_pool *pool)
+{
+	struct z_thread_pool_worker *worker;
+
+	k_fifo_init(&pool->idle);
+
+	for (size_t i = 0; i < pool->count; i++) {
+		worker = &pool->workers[i];
+		worker->pool = pool;
+		k_sem_init(&worker->start, 0, 1);
+
+		k_thread_create(&worker->thread,
+				&pool->stacks[i * pool->stack_len],
+				pool->stack_size, thread_pool_worker,
+				worker, NULL, NULL, pool->prio, 0, K_NO_WAIT);
+		(void)k_thread_name_set(&worker->thread, pool->name);
+
+		/* Idle from the start, even before it first runs */
+		k_fifo_put(&pool->idle, worker);
+	}
+}
+
+k_tid_t k_thread_pool_spawn(struct k_thread_pool *pool, k_thread_entry_t entry,
+			    void *p1, void *p2, void *p3, k_timeout_t timeout)
+{
+	struct z_thread_pool_worker *worker;
+
+	worker = k_fifo_get(&pool->idle, timeout);
+	if (worker == NULL) {
+		return NULL;
+	}
+
+	worker->entry = entry;
+	worker->p1 = p1;
+	worker->p2 = p2;
+	worker->p3 = p3;
+	k_sem_give(&worker->start);
+
+	return &worker->thread;
+}
@@ -11,13 +11,25 @@
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/drivers/timer/system_timer.h>
 #include <zephyr/sys_clock.h>
+#include <zephyr/sys/math_extras.h>
 
 static uint64_t curr_tick;
 
-static sys_dlist_t timeout_list = SYS_DLIST_STATIC_INIT(&timeout_list);
-
 static struct k_spinlock timeout_lock;
 
+#ifdef CONFIG_OBJ_CORE_STATS_SPINLOCK
+static struct k_spinlock_obj timeout_lock_obj;
+
+static int timeout_lock_obj_init(void)
+{
+	k_spinlock_obj_register(&timeout_lock_obj, &timeout_lock, "timeout");
+
+	return 0;
+}
+
+SYS_INIT(timeout_lock_obj_init, PRE_KERNEL_1, CONFIG_KERNEL_INIT_PRIORITY_OBJECTS);
+#endif
+
 #define MAX_WAIT (IS_ENABLED(CONFIG_SYSTEM_CLOCK_SLOPPY_IDLE) \
 		  ? K_TICKS_FOREVER : INT_MAX)
 
@@ -36,6 +48,264 @@ static inline int z_vrfy_sys_clock_hw_cycles_per_sec_runtime_get(void)
 #endif /* CONFIG_USERSPACE */
 #endif /* CONFIG_TIMER_READS_ITS_FREQUENCY_AT_RUNTIME */
 
+static int32_t elapsed(void)
+{
+	/* While sys_clock_announce() is executing, new relative timeouts will be
+	 * scheduled relatively to the currently firing timeout's original tick
+	 * value (=curr_tick) rather than relative to the current
+	 * sys_clock_elapsed().
+	 *
+	 * This means that timeouts being scheduled from within timeout callbacks
+	 * will be scheduled at well-defined offsets from the currently firing
+	 * timeout.
+	 *
+	 * As a side effect, the same will happen if an ISR with higher priority
+	 * preempts a timeout callback and schedules a timeout.
+	 *
+	 * The distinction is implemented by looking at announce_remaining which
+	 * will be non-zero while sys_clock_announce() is executing and zero
+	 * otherwise.
+	 */
+	return announce_remaining == 0 ? sys_clock_elapsed() : 0U;
+}
+
+#ifdef CONFIG_TIMEOUT_WHEEL
+
+/* Hierarchical timer wheel.
+ *
+ * The wheel has CONFIG_TIMEOUT_WHEEL_LEVELS levels of WHEEL_SLOTS
+ * buckets each.  Level N buckets are WHEEL_SLOTS^N ticks wide.  A
+ * timeout is stored (as an absolute tick in its dticks field) in the
+ * lowest level at which its expiry shares all more significant
+ * digits with curr_tick, so that level 0 buckets hold timeouts for
+ * exactly one tick.  When curr_tick reaches the start of a higher
+ * level bucket, its contents are redistributed ("cascaded") into the
+ * lower levels.  Timeouts too far in the future for the top level
+ * wait in wheel_overflow and are cascaded every time the top level
+ * wraps.
+ *
+ * A bitmap per level tracks non-empty buckets, which makes finding
+ * the next event O(levels) and lets sys_clock_announce() skip idle
+ * ticks.  Buckets are only initialized when they become non-empty.
+ */
+#define WHEEL_SLOT_BITS 6
+#define WHEEL_SLOTS BIT(WHEEL_SLOT_BITS)
+#define WHEEL_LEVELS CONFIG_TIMEOUT_WHEEL_LEVELS
+
+static sys_dlist_t wheel_slots[WHEEL_LEVELS * WHEEL_SLOTS];
+static uint64_t wheel_bitmap[WHEEL_LEVELS];
+static sys_dlist_t wheel_overflow = SYS_DLIST_STATIC_INIT(&wheel_overflow);
+
+static void wheel_insert(struct _timeout *to)
+{
+	uint64_t exp = (uint64_t)to->dticks;
+	sys_dlist_t *list = &wheel_overflow;
+	int level = 0;
+	int slot;
+
+	if (exp > curr_tick) {
+		level = (63 - u64_count_leading_zeros(exp ^ curr_tick)) /
+			WHEEL_SLOT_BITS;
+	} else {
+		/* Already due, file it under the current tick */
+		exp = curr_tick;
+	}
+
+	if (level < WHEEL_LEVELS) {
+		slot = (exp >> (level * WHEEL_SLOT_BITS)) & (WHEEL_SLOTS - 1);
+		list = &wheel_slots[level * WHEEL_SLOTS + slot];
+
+		if ((wheel_bitmap[level] & BIT64(slot)) == 0U) {
+			sys_dlist_init(list);
+			wheel_bitmap[level] |= BIT64(slot);
+		}
+	}
+
+	sys_dlist_append(list, &to->node);
+}
+
+static void remove_timeout(struct _timeout *t)
+{
+	/* A node whose neighbors are identical is alone in its list,
+	 * and that neighbor is the list head: clear the bucket bit.
+	 */
+	if (t->node.next == t->node.prev) {
+		uintptr_t head = (uintptr_t)t->node.next;
+		uintptr_t base = (uintptr_t)&wheel_slots[0];
+
+		if ((head >= base) && (head < (uintptr_t)&wheel_slots[ARRAY_SIZE(wheel_slots)])) {
+			size_t idx = (head - base) / sizeof(sys_dlist_t);
+
+			wheel_bitmap[idx / WHEEL_SLOTS] &= ~BIT64(idx % WHEEL_SLOTS);
+		}
+	}
+
+	sys_dlist_remove(&t->node);
+}
+
+/* Absolute tick of the next expiry or cascade, UINT64_MAX if none */
+static uint64_t wheel_next_event(void)
+{
+	for (int level = 0; level < WHEEL_LEVELS; level++) {
+		int shift = level * WHEEL_SLOT_BITS;
+		int digit = (curr_tick >> shift) & (WHEEL_SLOTS - 1);
+		uint64_t pending;
+
+		/* Level 0 can hold timeouts due at the current tick,
+		 * higher levels only hold buckets that start later.
+		 */
+		if (level == 0) {
+			pending = wheel_bitmap[level] & ~BIT64_MASK(digit);
+		} else {
+			pending = wheel_bitmap[level] & ~BIT64_MASK(digit) & ~BIT64(digit);
+		}
+
+		/* Each level's buckets all start after the ones of the
+		 * level below, so the first non-empty level wins.
+		 */
+		if (pending != 0U) {
+			uint64_t base = curr_tick & ~BIT64_MASK(shift + WHEEL_SLOT_BITS);
+
+			return base | ((uint64_t)u64_count_trailing_zeros(pending) << shift);
+		}
+	}
+
+	if (!sys_dlist_is_empty(&wheel_overflow)) {
+		int shift = WHEEL_LEVELS * WHEEL_SLOT_BITS;
+
+		return ((curr_tick >> shift) + 1) << shift;
+	}
+
+	return UINT64_MAX;
+}
+
+static void wheel_requeue(sys_dlist_t *list)
+{
+	sys_dlist_t pending;
+	sys_dnode_t *node;
+
+	sys_dlist_init(&pending);
+
+	while ((node = sys_dlist_peek_head(list)) != NULL) {
+		remove_timeout(CONTAINER_OF(node, struct _timeout, node));
+		sys_dlist_append(&pending, node);
+	}
+
+	while ((node = sys_dlist_get(&pending)) != NULL) {
+		wheel_insert(CONTAINER_OF(node, struct _timeout, node));
+	}
+}
+
+/* Redistribute the buckets starting at curr_tick, top level first */
+static void wheel_cascade(void)
+{
+	if ((curr_tick & BIT64_MASK(WHEEL_LEVELS * WHEEL_SLOT_BITS)) == 0U) {
+		wheel_requeue(&wheel_overflow);
+	}
+
+	for (int level = WHEEL_LEVELS - 1; level > 0; level--) {
+		int shift = level * WHEEL_SLOT_BITS;
+		int digit = (curr_tick >> shift) & (WHEEL_SLOTS - 1);
+
+		if (((curr_tick & BIT64_MASK(shift)) == 0U) &&
+		    ((wheel_bitmap[level] & BIT64(digit)) != 0U)) {
+			wheel_requeue(&wheel_slots[level * WHEEL_SLOTS + digit]);
+		}
+	}
+}
+
+static struct _timeout *wheel_pop_due(void)
+{
+	int digit = curr_tick & (WHEEL_SLOTS - 1);
+	struct _timeout *t;
+
+	if ((wheel_bitmap[0] & BIT64(digit)) == 0U) {
+		return NULL;
+	}
+
+	t = CONTAINER_OF(sys_dlist_peek_head(&wheel_slots[digit]),
+			 struct _timeout, node);
+	remove_timeout(t);
+
+	return t;
+}
+
+static int32_t next_timeout(void)
+{
+	uint64_t next = wheel_next_event();
+	int32_t ticks_elapsed = elapsed();
+	int32_t ret;
+
+	if ((next == UINT64_MAX) ||
+	    ((int64_t)(next - curr_tick - ticks_elapsed) > (int64_t)INT_MAX)) {
+		ret = MAX_WAIT;
+	} else {
+		ret = MAX(0, (int64_t)(next - curr_tick - ticks_elapsed));
+	}
+
+	return ret;
+}
+
+void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
+		   k_timeout_t timeout)
+{
+	if (K_TIMEOUT_EQ(timeout, K_FOREVER)) {
+		return;
+	}
+
+#ifdef CONFIG_KERNEL_COHERENCE
+	__ASSERT_NO_MSG(arch_mem_coherent(to));
+#endif
+
+	__ASSERT(!sys_dnode_is_linked(&to->node), "");
+	to->fn = fn;
+
+	K_SPINLOCK(&timeout_lock) {
+		uint64_t next = wheel_next_event();
+
+		if (Z_TICK_ABS(timeout.ticks) >= 0) {
+			to->dticks = MAX((int64_t)curr_tick + 1,
+					 Z_TICK_ABS(timeout.ticks));
+		} else {
+			to->dticks = curr_tick + timeout.ticks + 1 + elapsed();
+		}
+
+		wheel_insert(to);
+
+		if (wheel_next_event() != next) {
+			sys_clock_set_timeout(next_timeout(), false);
+		}
+	}
+}
+
+int z_abort_timeout(struct _timeout *to)
+{
+	int ret = -EINVAL;
+
+	K_SPINLOCK(&timeout_lock) {
+		if (sys_dnode_is_linked(&to->node)) {
+			remove_timeout(to);
+			ret = 0;
+		}
+	}
+
+	return ret;
+}
+
+/* must be locked */
+static k_ticks_t timeout_rem(const struct _timeout *timeout)
+{
+	if (z_is_inactive_timeout(timeout)) {
+		return 0;
+	}
+
+	return timeout->dticks - (int64_t)curr_tick - elapsed();
+}
+
+#else /* CONFIG_TIMEOUT_WHEEL */
+
+static sys_dlist_t timeout_list = SYS_DLIST_STATIC_INIT(&timeout_list);
+
 static struct _timeout *first(void)
 {
 	sys_dnode_t *t = sys_dlist_peek_head(&timeout_list);
@@ -59,27 +329,6 @@ static void remove_timeout(struct _timeout *t)
 	sys_dlist_remove(&t->node);
 }
 
-static int32_t elapsed(void)
-{
-	/* While sys_clock_announce() is executing, new relative timeouts will be
-	 * scheduled relatively to the currently firing timeout's original tick
-	 * value (=curr_tick) rather than relative to the current
-	 * sys_clock_elapsed().
-	 *
-	 * This means that timeouts being scheduled from within timeout callbacks
-	 * will be scheduled at well-defined offsets from the currently firing
-	 * timeout.
-	 *
-	 * As a side effect, the same will happen if an ISR with higher priority
-	 * preempts a timeout callback and schedules a timeout.
-	 *
-	 * The distinction is implemented by looking at announce_remaining which
-	 * will be non-zero while sys_clock_announce() is executing and zero
-	 * otherwise.
-	 */
-	return announce_remaining == 0 ? sys_clock_elapsed() : 0U;
-}
-
 static int32_t next_timeout(void)
 {
 	struct _timeout *to = first();
@@ -174,6 +423,8 @@ static k_ticks_t timeout_rem(const struct _timeout *timeout)
 	return ticks - elapsed();
 }
 
+#endif /* CONFIG_TIMEOUT_WHEEL */
+
 k_ticks_t z_timeout_remaining(const struct _timeout *timeout)
 {
 	k_ticks_t ticks = 0;
@@ -224,6 +475,25 @@ void sys_clock_announce(int32_t ticks)
 
 	announce_remaining = ticks;
 
+#ifdef CONFIG_TIMEOUT_WHEEL
+	for (uint64_t next = wheel_next_event();
+	     next <= curr_tick + announce_remaining;
+	     next = wheel_next_event()) {
+		int dt = next - curr_tick;
+		struct _timeout *t;
+
+		curr_tick = next;
+		wheel_cascade();
+
+		while ((t = wheel_pop_due()) != NULL) {
+			k_spin_unlock(&timeout_lock, key);
+			t->fn(t);
+			key = k_spin_lock(&timeout_lock);
+		}
+
+		announce_remaining -= dt;
+	}
+#else
 	struct _timeout *t;
 
 	for (t = first();
@@ -244,10 +514,15 @@ void sys_clock_announce(int32_t ticks)
 	if (t != NULL) {
 		t->dticks -= announce_remaining;
 	}
+#endif /* CONFIG_TIMEOUT_WHEEL */
 
 	curr_tick += announce_remaining;
 	announce_remaining = 0;
 
+#ifdef CONFIG_USERSPACE_VDSO
+	z_vdso_ticks_update(curr_tick);
+#endif
+
 	sys_clock_set_timeout(next_timeout(), false);
 
 	k_spin_unlock(&timeout_lock, key);
@@ -329,7 +604,42 @@ k_timeout_t sys_timepoint_timeout(k_timepoint_t timepoint)
 #ifdef CONFIG_ZTEST
 void z_impl_sys_clock_tick_set(uint64_t tick)
 {
+#ifdef CONFIG_TIMEOUT_WHEEL
+	K_SPINLOCK(&timeout_lock) {
+		int64_t delta = (int64_t)(tick - curr_tick);
+		sys_dlist_t all;
+		sys_dnode_t *node;
+
+		/* Keep the remaining time of armed timeouts the same as
+		 * the delta-list backend does, re-filing them relative
+		 * to the new tick.
+		 */
+		sys_dlist_init(&all);
+		for (size_t i = 0; i < ARRAY_SIZE(wheel_slots); i++) {
+			if ((wheel_bitmap[i / WHEEL_SLOTS] & BIT64(i % WHEEL_SLOTS)) != 0U) {
+				while ((node = sys_dlist_get(&wheel_slots[i])) != NULL) {
+					sys_dlist_append(&all, node);
+				}
+			}
+		}
+		while ((node = sys_dlist_get(&wheel_overflow)) != NULL) {
+			sys_dlist_append(&all, node);
+		}
+		for (int level = 0; level < WHEEL_LEVELS; level++) {
+			wheel_bitmap[level] = 0U;
+		}
+
+		curr_tick = tick;
+		while ((node = sys_dlist_get(&all)) != NULL) {
+			struct _timeout *t = CONTAINER_OF(node, struct _timeout, node);
+
+			t->dticks += delta;
+			wheel_insert(t);
+		}
+	}
+#else
 	curr_tick = tick;
+#endif
 }
 
 void z_vrfy_sys_clock_tick_set(uint64_t tick)
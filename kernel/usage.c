@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <string.h>
 #include <zephyr/kernel.h>
 
 #include <zephyr/timing/timing.h>
@@ -71,6 +72,58 @@ static void sched_thread_update_usage(struct k_thread *thread, uint32_t cycles)
 #endif
 }
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+BUILD_ASSERT(CONFIG_SCHED_THREAD_USAGE_LATENCY_SHIFT +
+	     CONFIG_SCHED_THREAD_USAGE_LATENCY_BUCKETS <= 33,
+	     "Latency histogram buckets beyond 32 bit cycles");
+
+void z_sched_usage_ready(struct k_thread *thread)
+{
+	if (thread->base.latency.ready == 0U) {
+		thread->base.latency.ready = usage_now();
+	}
+}
+
+/* The thread is switched in: record how long it waited for that */
+static void sched_thread_latency_end(struct k_thread *thread, uint32_t now)
+{
+	struct k_sched_latency *latency = &thread->base.latency;
+	uint32_t cycles;
+	unsigned int bucket;
+
+	if (latency->ready == 0U) {
+		return;
+	}
+
+	cycles = now - latency->ready;
+	latency->ready = 0U;
+
+	bucket = find_msb_set(cycles >> CONFIG_SCHED_THREAD_USAGE_LATENCY_SHIFT);
+	bucket = MIN(bucket, CONFIG_SCHED_THREAD_USAGE_LATENCY_BUCKETS - 1);
+	latency->hist[bucket]++;
+
+	if (latency->max < cycles) {
+		latency->max = cycles;
+	}
+}
+
+/* The thread is switched out: if it can still run, it was preempted
+ * (or yielded) and waits to be switched in again from now on.
+ */
+static void sched_thread_latency_start(struct k_thread *thread, uint32_t now)
+{
+	if (z_is_thread_ready(thread) && !z_is_idle_thread_object(thread)) {
+		thread->base.latency.preemptions++;
+		thread->base.latency.ready = now;
+	} else {
+		thread->base.latency.ready = 0U;
+	}
+}
+#else
+#define sched_thread_latency_end(thread, now)   do { } while (0)
+#define sched_thread_latency_start(thread, now) do { } while (0)
+#endif
+
 void z_sched_usage_start(struct k_thread *thread)
 {
 #ifdef CONFIG_SCHED_THREAD_USAGE_ANALYSIS
@@ -79,6 +132,7 @@ void z_sched_usage_start(struct k_thread *thread)
 	key = k_spin_lock(&usage_lock);
 
 	_current_cpu->usage0 = usage_now();   /* Always update */
+	sched_thread_latency_end(thread, _current_cpu->usage0);
 
 	if (thread->base.usage.track_usage) {
 		thread->base.usage.num_windows++;
@@ -93,6 +147,7 @@ void z_sched_usage_start(struct k_thread *thread)
 	 */
 
 	_current_cpu->usage0 = usage_now();
+	sched_thread_latency_end(thread, _current_cpu->usage0);
 #endif
 }
 
@@ -103,9 +158,10 @@ void z_sched_usage_stop(void)
 	struct _cpu     *cpu = _current_cpu;
 
 	uint32_t u0 = cpu->usage0;
+	uint32_t now = usage_now();
 
 	if (u0 != 0) {
-		uint32_t cycles = usage_now() - u0;
+		uint32_t cycles = now - u0;
 
 		if (cpu->current->base.usage.track_usage) {
 			sched_thread_update_usage(cpu->current, cycles);
@@ -114,6 +170,8 @@ void z_sched_usage_stop(void)
 		sched_cpu_update_usage(cpu, cycles);
 	}
 
+	sched_thread_latency_start(cpu->current, now);
+
 	cpu->usage0 = 0;
 	k_spin_unlock(&usage_lock, k);
 }
@@ -166,6 +224,17 @@ void z_sched_cpu_usage(uint8_t cpu_id, struct k_thread_runtime_stats *stats)
 
 	stats->execution_cycles = stats->total_cycles + stats->idle_cycles;
 
+#if defined(CONFIG_SMP) && defined(CONFIG_SCHED_IPI_SUPPORTED)
+	stats->ipi_received = (uint32_t)atomic_get(&_kernel.cpus[cpu_id].ipi_received);
+	stats->ipi_useless = _kernel.cpus[cpu_id].ipi_useless;
+#endif
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+	memset(stats->latency_hist, 0, sizeof(stats->latency_hist));
+	stats->latency_max = 0;
+	stats->preemptions = 0;
+#endif
+
 	k_spin_unlock(&usage_lock, key);
 }
 #endif
@@ -219,9 +288,20 @@ void z_sched_thread_usage(struct k_thread *thread,
 
 #ifdef CONFIG_SCHED_THREAD_USAGE_ALL
 	stats->idle_cycles = 0;
+#if defined(CONFIG_SMP) && defined(CONFIG_SCHED_IPI_SUPPORTED)
+	stats->ipi_received = 0;
+	stats->ipi_useless = 0;
+#endif
 #endif
 	stats->execution_cycles = thread->base.usage.total;
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+	memcpy(stats->latency_hist, thread->base.latency.hist,
+	       sizeof(stats->latency_hist));
+	stats->latency_max = thread->base.latency.max;
+	stats->preemptions = thread->base.latency.preemptions;
+#endif
+
 	k_spin_unlock(&usage_lock, key);
 }
 
@@ -384,6 +464,12 @@ int z_thread_stats_reset(struct k_obj_core *obj_core)
 	stats->num_windows = (thread->base.usage.track_usage) ?  1U : 0U;
 #endif
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+	thread->base.latency.max = 0U;
+	thread->base.latency.preemptions = 0U;
+	memset(thread->base.latency.hist, 0, sizeof(thread->base.latency.hist));
+#endif
+
 	if (thread != _current_cpu->current) {
 
 		/*
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <zephyr/kernel/vdso.h>
+#include <zephyr/kernel/internal/mm.h>
+#include <zephyr/sys/barrier.h>
+#include <kernel_internal.h>
+
+struct z_vdso_data z_vdso_data;
+
+/* Page tables can't make memory writable by supervisor mode only. On
+ * such architectures, user threads get a read-only view of the data, and
+ * the kernel writes through a second, supervisor-only mapping of it.
+ */
+#ifdef K_MEM_PARTITION_P_RW_U_RO
+K_MEM_PARTITION_DEFINE(z_vdso_partition, &z_vdso_data, sizeof(z_vdso_data),
+		       K_MEM_PARTITION_P_RW_U_RO);
+
+static struct z_vdso_data *const vdso = &z_vdso_data;
+#else
+BUILD_ASSERT(IS_ENABLED(CONFIG_MMU),
+	     "Read-only user data needs an MMU or K_MEM_PARTITION_P_RW_U_RO");
+
+K_MEM_PARTITION_DEFINE(z_vdso_partition, &z_vdso_data, sizeof(z_vdso_data),
+		       K_MEM_PARTITION_P_RO_U_RO);
+
+static struct z_vdso_data *vdso;
+#endif
+
+void z_vdso_ticks_update(uint64_t ticks)
+{
+	/* Only ever called with the timeout lock held */
+	vdso->seq++;
+	barrier_dmem_fence_full();
+	vdso->ticks = ticks;
+	vdso->cycles = k_cycle_get_32();
+	barrier_dmem_fence_full();
+	vdso->seq++;
+}
+
+#ifndef CONFIG_SMP
+void z_vdso_current_update(struct k_thread *thread)
+{
+	vdso->current = thread;
+}
+#endif
+
+static int vdso_init(void)
+{
+#ifndef K_MEM_PARTITION_P_RW_U_RO
+	uint8_t *alias;
+
+	z_phys_map(&alias, z_mem_phys_addr(&z_vdso_data), sizeof(z_vdso_data),
+		   K_MEM_PERM_RW | K_MEM_CACHE_WB);
+	vdso = (struct z_vdso_data *)alias;
+#endif
+
+#ifndef CONFIG_SMP
+	vdso->current = _current;
+#endif
+
+	return 0;
+}
+
+/* Before the timer driver announces any tick */
+SYS_INIT(vdso_init, PRE_KERNEL_1, 0);
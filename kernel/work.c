@@ -76,6 +76,99 @@ static inline void init_flusher(struct z_work_flusher *flusher)
 /* List of pending cancellations. */
 static sys_slist_t pending_cancels;
 
+/* Determine whether a thread is one of the threads serving a queue.
+ *
+ * @param queue the queue
+ * @param thread the thread to check
+ */
+static inline bool is_queue_thread(const struct k_work_q *queue,
+				   const struct k_thread *thread)
+{
+	if (thread == &queue->thread) {
+		return true;
+	}
+
+#ifdef CONFIG_WORKQUEUE_POOL
+	for (unsigned int i = 0; i < queue->num_extra_threads; i++) {
+		if (thread == &queue->extra_threads[i]) {
+			return true;
+		}
+	}
+#endif
+
+	return false;
+}
+
+/* Mark a queue thread as having started, or finished, running a handler.
+ *
+ * Invoked with work lock held.
+ *
+ * @param queue the queue served by the thread
+ * @param busy true if a handler is about to be run, false if it has
+ * returned
+ */
+static inline void queue_busy_update_locked(struct k_work_q *queue,
+					    bool busy)
+{
+#ifdef CONFIG_WORKQUEUE_POOL
+	if (busy) {
+		queue->busy_threads++;
+	} else {
+		__ASSERT_NO_MSG(queue->busy_threads > 0U);
+		queue->busy_threads--;
+	}
+	busy = (queue->busy_threads != 0U);
+#endif
+
+	if (busy) {
+		flag_set(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+	} else {
+		flag_clear(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+	}
+
+#ifdef CONFIG_WORKQUEUE_STATS
+#ifdef CONFIG_WORKQUEUE_POOL
+	uint32_t nbusy = queue->busy_threads;
+#else
+	uint32_t nbusy = busy ? 1U : 0U;
+#endif
+
+	queue->stats.max_busy = MAX(queue->stats.max_busy, nbusy);
+#endif
+}
+
+/* Account for an item added to the pending list of a queue.
+ *
+ * Invoked with work lock held.
+ */
+static inline void stats_queued_locked(struct k_work_q *queue,
+				       struct k_work *work)
+{
+#ifdef CONFIG_WORKQUEUE_STATS
+	work->queued_at = k_cycle_get_32();
+	queue->stats.pending++;
+	queue->stats.max_pending = MAX(queue->stats.max_pending,
+				       queue->stats.pending);
+#else
+	ARG_UNUSED(queue);
+	ARG_UNUSED(work);
+#endif
+}
+
+/* Account for an item removed from the pending list of a queue.
+ *
+ * Invoked with work lock held.
+ */
+static inline void stats_dequeued_locked(struct k_work_q *queue)
+{
+#ifdef CONFIG_WORKQUEUE_STATS
+	__ASSERT_NO_MSG(queue->stats.pending > 0U);
+	queue->stats.pending--;
+#else
+	ARG_UNUSED(queue);
+#endif
+}
+
 /* Initialize a canceler record and add it to the list of pending
  * cancels.
  *
@@ -200,6 +293,10 @@ static void queue_flusher_locked(struct k_work_q *queue,
 	}
 
 	init_flusher(flusher);
+#ifdef CONFIG_WORKQUEUE_POOL
+	flusher->target = work;
+#endif
+	stats_queued_locked(queue, &flusher->work);
 	if (in_list) {
 		sys_slist_insert(&queue->pending, &work->node,
 				 &flusher->work.node);
@@ -219,7 +316,9 @@ static inline void queue_remove_locked(struct k_work_q *queue,
 				       struct k_work *work)
 {
 	if (flag_test_and_clear(&work->flags, K_WORK_QUEUED_BIT)) {
-		(void)sys_slist_find_and_remove(&queue->pending, &work->node);
+		if (sys_slist_find_and_remove(&queue->pending, &work->node)) {
+			stats_dequeued_locked(queue);
+		}
 	}
 }
 
@@ -272,7 +371,7 @@ static inline int queue_submit_locked(struct k_work_q *queue,
 	}
 
 	int ret = -EBUSY;
-	bool chained = (_current == &queue->thread) && !k_is_in_isr();
+	bool chained = is_queue_thread(queue, _current) && !k_is_in_isr();
 	bool draining = flag_test(&queue->flags, K_WORK_QUEUE_DRAIN_BIT);
 	bool plugged = flag_test(&queue->flags, K_WORK_QUEUE_PLUGGED_BIT);
 
@@ -291,6 +390,7 @@ static inline int queue_submit_locked(struct k_work_q *queue,
 		ret = -EBUSY;
 	} else {
 		sys_slist_append(&queue->pending, &work->node);
+		stats_queued_locked(queue, work);
 		ret = 1;
 		(void)notify_queue_locked(queue);
 	}
@@ -609,6 +709,57 @@ bool k_work_cancel_sync(struct k_work *work,
 	return pending;
 }
 
+/* Take the next work item that can be processed from a queue.
+ *
+ * Invoked with work lock held.
+ *
+ * @param queue the queue to take work from
+ *
+ * @return the work item, removed from the pending list, or NULL if there is
+ * nothing that can be processed now.
+ */
+static struct k_work *queue_take_locked(struct k_work_q *queue)
+{
+#ifdef CONFIG_WORKQUEUE_POOL
+	sys_snode_t *prev = NULL;
+	struct k_work *work;
+
+	/* With several threads an item resubmitted while running is on the
+	 * list while another thread is still in its handler, as is a flusher
+	 * for an item that is running.  Leave those for the thread running
+	 * the item, which will look for work again once the handler returns.
+	 */
+	SYS_SLIST_FOR_EACH_CONTAINER(&queue->pending, work, node) {
+		const struct k_work *busy = work;
+
+		if (flag_test(&work->flags, K_WORK_FLUSHING_BIT)) {
+			busy = CONTAINER_OF(work, struct z_work_flusher,
+					    work)->target;
+		}
+
+		if (!flag_test(&busy->flags, K_WORK_RUNNING_BIT)) {
+			sys_slist_remove(&queue->pending, prev, &work->node);
+			stats_dequeued_locked(queue);
+			return work;
+		}
+
+		prev = &work->node;
+	}
+
+	return NULL;
+#else
+	sys_snode_t *node = sys_slist_get(&queue->pending);
+
+	if (node == NULL) {
+		return NULL;
+	}
+
+	stats_dequeued_locked(queue);
+
+	return CONTAINER_OF(node, struct k_work, node);
+#endif
+}
+
 /* Loop executed by a work queue thread.
  *
  * @param workq_ptr pointer to the work queue structure
@@ -621,38 +772,44 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 	struct k_work_q *queue = (struct k_work_q *)workq_ptr;
 
 	while (true) {
-		sys_snode_t *node;
-		struct k_work *work = NULL;
+		struct k_work *work;
 		k_work_handler_t handler = NULL;
 		k_spinlock_key_t key = k_spin_lock(&lock);
 		bool yield;
+#ifdef CONFIG_WORKQUEUE_STATS
+		bool counted = false;
+		uint32_t started = 0U;
+#endif
 
 		/* Check for and prepare any new work. */
-		node = sys_slist_get(&queue->pending);
-		if (node != NULL) {
+		work = queue_take_locked(queue);
+		if (work != NULL) {
 			/* Mark that there's some work active that's
 			 * not on the pending list.
 			 */
-			flag_set(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
-			work = CONTAINER_OF(node, struct k_work, node);
+			queue_busy_update_locked(queue, true);
 			flag_set(&work->flags, K_WORK_RUNNING_BIT);
 			flag_clear(&work->flags, K_WORK_QUEUED_BIT);
-
-			/* Static code analysis tool can raise a false-positive violation
-			 * in the line below that 'work' is checked for null after being
-			 * dereferenced.
-			 *
-			 * The work is figured out by CONTAINER_OF, as a container
-			 * of type struct k_work that contains the node.
-			 * The only way for it to be NULL is if node would be a member
-			 * of struct k_work object that has been placed at address NULL,
-			 * which should never happen, even line 'if (work != NULL)'
-			 * ensures that.
-			 * This means that if node is not NULL, then work will not be NULL.
-			 */
 			handler = work->handler;
-		} else if (flag_test_and_clear(&queue->flags,
-					       K_WORK_QUEUE_DRAIN_BIT)) {
+
+#ifdef CONFIG_WORKQUEUE_STATS
+			started = k_cycle_get_32();
+
+			/* Flushers are internal, leave them out. */
+			counted = !flag_test(&work->flags, K_WORK_FLUSHING_BIT);
+			if (counted) {
+				uint32_t latency = started - work->queued_at;
+
+				queue->stats.processed++;
+				queue->stats.total_latency += latency;
+				queue->stats.max_latency =
+					MAX(queue->stats.max_latency, latency);
+			}
+#endif
+		} else if (!flag_test(&queue->flags, K_WORK_QUEUE_BUSY_BIT)
+			   && sys_slist_is_empty(&queue->pending)
+			   && flag_test_and_clear(&queue->flags,
+						  K_WORK_QUEUE_DRAIN_BIT)) {
 			/* Not busy and draining: move threads waiting for
 			 * drain to ready state.  The held spinlock inhibits
 			 * immediate reschedule; released threads get their
@@ -694,6 +851,12 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 		 */
 		key = k_spin_lock(&lock);
 
+#ifdef CONFIG_WORKQUEUE_STATS
+		if (counted) {
+			queue->stats.busy_cycles += k_cycle_get_32() - started;
+		}
+#endif
+
 		flag_clear(&work->flags, K_WORK_RUNNING_BIT);
 		if (flag_test(&work->flags, K_WORK_FLUSHING_BIT)) {
 			finalize_flush_locked(work);
@@ -702,7 +865,7 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 			finalize_cancel_locked(work);
 		}
 
-		flag_clear(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+		queue_busy_update_locked(queue, false);
 		yield = !flag_test(&queue->flags, K_WORK_QUEUE_NO_YIELD_BIT);
 		k_spin_unlock(&lock, key);
 
@@ -726,23 +889,24 @@ void k_work_queue_init(struct k_work_q *queue)
 	SYS_PORT_TRACING_OBJ_INIT(k_work_queue, queue);
 }
 
-void k_work_queue_start(struct k_work_q *queue,
-			k_thread_stack_t *stack,
-			size_t stack_size,
-			int prio,
-			const struct k_work_queue_config *cfg)
+/* Set up the state of a queue so that it accepts submissions.
+ *
+ * @param queue the queue
+ * @param cfg optional configuration
+ */
+static void work_queue_setup(struct k_work_q *queue,
+			     const struct k_work_queue_config *cfg)
 {
-	__ASSERT_NO_MSG(queue);
-	__ASSERT_NO_MSG(stack);
-	__ASSERT_NO_MSG(!flag_test(&queue->flags, K_WORK_QUEUE_STARTED_BIT));
 	uint32_t flags = K_WORK_QUEUE_STARTED;
 
-	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work_queue, start, queue);
-
 	sys_slist_init(&queue->pending);
 	z_waitq_init(&queue->notifyq);
 	z_waitq_init(&queue->drainq);
 
+#ifdef CONFIG_WORKQUEUE_STATS
+	queue->stats = (struct k_work_queue_stats) { 0 };
+#endif
+
 	if ((cfg != NULL) && cfg->no_yield) {
 		flags |= K_WORK_QUEUE_NO_YIELD;
 	}
@@ -752,20 +916,145 @@ void k_work_queue_start(struct k_work_q *queue,
 	 * to roll.
 	 */
 	flags_set(&queue->flags, flags);
+}
 
-	(void)k_thread_create(&queue->thread, stack, stack_size,
+/* Create and start a thread serving a queue.
+ *
+ * @param queue the queue
+ * @param thread the thread object
+ * @param stack the thread stack
+ * @param stack_size size of @p stack
+ * @param prio thread priority
+ * @param name optional thread name
+ * @param cpu CPU to pin the thread to, or -1 to not pin it
+ */
+static void work_queue_thread_start(struct k_work_q *queue,
+				    struct k_thread *thread,
+				    k_thread_stack_t *stack,
+				    size_t stack_size, int prio,
+				    const char *name, int cpu)
+{
+	(void)k_thread_create(thread, stack, stack_size,
 			      work_queue_main, queue, NULL, NULL,
 			      prio, 0, K_FOREVER);
 
-	if ((cfg != NULL) && (cfg->name != NULL)) {
-		k_thread_name_set(&queue->thread, cfg->name);
+	if (name != NULL) {
+		k_thread_name_set(thread, name);
+	}
+
+#ifdef CONFIG_SCHED_CPU_MASK
+	if (cpu >= 0) {
+		(void)k_thread_cpu_pin(thread, cpu);
 	}
+#else
+	ARG_UNUSED(cpu);
+#endif
+
+	k_thread_start(thread);
+}
+
+void k_work_queue_start(struct k_work_q *queue,
+			k_thread_stack_t *stack,
+			size_t stack_size,
+			int prio,
+			const struct k_work_queue_config *cfg)
+{
+	__ASSERT_NO_MSG(queue);
+	__ASSERT_NO_MSG(stack);
+	__ASSERT_NO_MSG(!flag_test(&queue->flags, K_WORK_QUEUE_STARTED_BIT));
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work_queue, start, queue);
+
+#ifdef CONFIG_WORKQUEUE_POOL
+	queue->extra_threads = NULL;
+	queue->num_extra_threads = 0U;
+	queue->busy_threads = 0U;
+#endif
 
-	k_thread_start(&queue->thread);
+	work_queue_setup(queue, cfg);
+
+	work_queue_thread_start(queue, &queue->thread, stack, stack_size, prio,
+				(cfg != NULL) ? cfg->name : NULL, -1);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work_queue, start, queue);
 }
 
+#ifdef CONFIG_WORKQUEUE_POOL
+void k_work_queue_pool_start(struct k_work_q *queue,
+			     struct k_thread *threads,
+			     k_thread_stack_t *stacks, size_t stack_size,
+			     unsigned int num_threads, int prio,
+			     const struct k_work_queue_config *cfg)
+{
+	__ASSERT_NO_MSG(queue);
+	__ASSERT_NO_MSG(stacks);
+	__ASSERT_NO_MSG((num_threads > 0U) && (num_threads <= UINT16_MAX));
+	__ASSERT_NO_MSG((threads != NULL) || (num_threads == 1U));
+	__ASSERT_NO_MSG(!flag_test(&queue->flags, K_WORK_QUEUE_STARTED_BIT));
+
+	const char *name = (cfg != NULL) ? cfg->name : NULL;
+	bool pin = (cfg != NULL) && cfg->pin_cpus;
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work_queue, start, queue);
+
+	/* All threads must be known before any of them runs, so that
+	 * chained submission is recognized from each of them.
+	 */
+	queue->extra_threads = threads;
+	queue->num_extra_threads = num_threads - 1U;
+	queue->busy_threads = 0U;
+
+	work_queue_setup(queue, cfg);
+
+	for (unsigned int i = 0; i < num_threads; i++) {
+		struct k_thread *thread = (i == 0U) ? &queue->thread
+						    : &threads[i - 1U];
+		k_thread_stack_t *stack =
+			&stacks[i * K_THREAD_STACK_LEN(stack_size)];
+		const char *tname = name;
+		int cpu = pin ? (int)(i % arch_num_cpus()) : -1;
+#ifdef CONFIG_THREAD_NAME
+		char buf[CONFIG_THREAD_MAX_NAME_LEN];
+
+		if ((name != NULL) && (i > 0U)) {
+			snprintk(buf, sizeof(buf), "%s#%u", name, i);
+			tname = buf;
+		}
+#endif
+
+		work_queue_thread_start(queue, thread, stack, stack_size,
+					prio, tname, cpu);
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work_queue, start, queue);
+}
+#endif /* CONFIG_WORKQUEUE_POOL */
+
+#ifdef CONFIG_WORKQUEUE_STATS
+void k_work_queue_stats_get(struct k_work_q *queue,
+			    struct k_work_queue_stats *stats)
+{
+	__ASSERT_NO_MSG(queue);
+	__ASSERT_NO_MSG(stats);
+
+	K_SPINLOCK(&lock) {
+		*stats = queue->stats;
+	}
+}
+
+void k_work_queue_stats_reset(struct k_work_q *queue)
+{
+	__ASSERT_NO_MSG(queue);
+
+	K_SPINLOCK(&lock) {
+		queue->stats = (struct k_work_queue_stats) {
+			.pending = queue->stats.pending,
+			.max_pending = queue->stats.pending,
+		};
+	}
+}
+#endif /* CONFIG_WORKQUEUE_STATS */
+
 int k_work_queue_drain(struct k_work_q *queue,
 		       bool plug)
 {
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_LIB_CRC_CRC32_PRIV_H_
+#define ZEPHYR_LIB_CRC_CRC32_PRIV_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Helpers folding data into the state of a reflected CRC32, which is
+ * neither inverted at the start nor at the end.
+ */
+
+#if defined(CONFIG_CRC32_ARM_INSTRUCTIONS) && defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+
+#define CRC32_USE_ARM_INSTRUCTIONS 1
+
+static inline uint32_t crc32_arm_update(uint32_t crc, const uint8_t *data,
+					size_t len, bool castagnoli)
+{
+	while ((len > 0) && (((uintptr_t)data & (sizeof(uint64_t) - 1)) != 0)) {
+		crc = castagnoli ? __crc32cb(crc, *data) : __crc32b(crc, *data);
+		data++;
+		len--;
+	}
+
+	while (len >= sizeof(uint64_t)) {
+		uint64_t dword = *(const uint64_t *)data;
+
+		crc = castagnoli ? __crc32cd(crc, dword) : __crc32d(crc, dword);
+		data += sizeof(uint64_t);
+		len -= sizeof(uint64_t);
+	}
+
+	while (len > 0) {
+		crc = castagnoli ? __crc32cb(crc, *data) : __crc32b(crc, *data);
+		data++;
+		len--;
+	}
+
+	return crc;
+}
+
+#elif defined(CONFIG_CRC32_SLICING_BY_8)
+#include <zephyr/sys/byteorder.h>
+
+static inline uint32_t crc32_slicing_by_8(const uint32_t table[8][256],
+					  uint32_t crc, const uint8_t *data,
+					  size_t len)
+{
+	while (len >= 8) {
+		uint32_t lo = crc ^ sys_get_le32(data);
+		uint32_t hi = sys_get_le32(data + 4);
+
+		crc = table[7][lo & 0xff] ^ table[6][(lo >> 8) & 0xff] ^
+		      table[5][(lo >> 16) & 0xff] ^ table[4][lo >> 24] ^
+		      table[3][hi & 0xff] ^ table[2][(hi >> 8) & 0xff] ^
+		      table[1][(hi >> 16) & 0xff] ^ table[0][hi >> 24];
+		data += 8;
+		len -= 8;
+	}
+
+	while (len > 0) {
+		crc = (crc >> 8) ^ table[0][(crc ^ *data) & 0xff];
+		data++;
+		len--;
+	}
+
+	return crc;
+}
+#endif
+
+#endif /* ZEPHYR_LIB_CRC_CRC32_PRIV_H_ */
@@ -6,6 +6,12 @@
 
 #include <zephyr/sys/crc.h>
 
+#include "crc32_priv.h"
+
+#if !defined(CRC32_USE_ARM_INSTRUCTIONS) && defined(CONFIG_CRC32_SLICING_BY_8)
+/* crc tables generated from polynomial 0x1EDC6F41UL (Castagnoli) */
+#include "crc/crc32c_table.h"
+#elif !defined(CRC32_USE_ARM_INSTRUCTIONS)
 /* crc table generated from polynomial 0x1EDC6F41UL (Castagnoli) */
 static const uint32_t crc32c_table[16] = {
 	0x00000000UL, 0x105EC76FUL, 0x20BD8EDEUL, 0x30E349B1UL,
@@ -13,6 +19,7 @@ static const uint32_t crc32c_table[16] = {
 	0x82F63B78UL, 0x92A8FC17UL, 0xA24BB5A6UL, 0xB21572C9UL,
 	0xC38D26C4UL, 0xD3D3E1ABUL, 0xE330A81AUL, 0xF36E6F75UL
 };
+#endif
 
 /* This value needs to be XORed with the final crc value once crc for
  * the entire stream is calculated. This is a requirement of crc32c algo.
@@ -31,10 +38,16 @@ uint32_t crc32_c(uint32_t crc, const uint8_t *data,
 		crc = CRC32C_INIT;
 	}
 
+#if defined(CRC32_USE_ARM_INSTRUCTIONS)
+	crc = crc32_arm_update(crc, data, len, true);
+#elif defined(CONFIG_CRC32_SLICING_BY_8)
+	crc = crc32_slicing_by_8(crc32c_table, crc, data, len);
+#else
 	for (size_t i = 0; i < len; i++) {
 		crc = crc32c_table[(crc ^ data[i]) & 0x0F] ^ (crc >> 4);
 		crc = crc32c_table[(crc ^ ((uint32_t)data[i] >> 4)) & 0x0F] ^ (crc >> 4);
 	}
+#endif
 
 	return last_pkt ? (crc ^ CRC32C_XOR_OUT) : crc;
 }
@@ -0,0 +1,408 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/hash_map.h>
+#include <zephyr/sys/hash_map_oa_gp.h>
+#include <zephyr/sys/math_extras.h>
+#include <zephyr/sys/util.h>
+
+/*
+ * Every bucket has a control byte, which is either EMPTY, DELETED or, for
+ * a used bucket, the lowest 7 bits of the hash of its key. The control
+ * bytes are stored after the entries, and are read a group of GROUP_SIZE
+ * at a time as a little-endian word, in which all the buckets matching
+ * a hash, all the empty buckets or all the free buckets are found with a
+ * few word operations (SIMD within a register).
+ *
+ * Groups are probed one after the other, in a triangular sequence which
+ * visits each of them once since the number of groups is a power of two.
+ * A lookup stops at the first group with an empty bucket.
+ */
+
+#define GROUP_SIZE 8
+
+#define CTRL_EMPTY   0x80
+#define CTRL_DELETED 0xfe
+
+#define GROUP_LSBS 0x0101010101010101ULL
+#define GROUP_MSBS 0x8080808080808080ULL
+
+typedef uint64_t group_mask_t;
+
+struct oagp_entry {
+	uint64_t key;
+	uint64_t value;
+};
+
+BUILD_ASSERT(offsetof(struct sys_hashmap_oa_gp_data, buckets) ==
+	     offsetof(struct sys_hashmap_data, buckets));
+BUILD_ASSERT(offsetof(struct sys_hashmap_oa_gp_data, n_buckets) ==
+	     offsetof(struct sys_hashmap_data, n_buckets));
+BUILD_ASSERT(offsetof(struct sys_hashmap_oa_gp_data, size) ==
+	     offsetof(struct sys_hashmap_data, size));
+
+static inline uint8_t *sys_hashmap_oa_gp_ctrl(const struct sys_hashmap_oa_gp_data *data)
+{
+	return (uint8_t *)((struct oagp_entry *)data->buckets + data->n_buckets);
+}
+
+static inline bool ctrl_is_used(uint8_t ctrl)
+{
+	return (ctrl & CTRL_EMPTY) == 0;
+}
+
+/* Buckets of a group whose control byte is @p h2, possibly with false positives */
+static inline group_mask_t group_match(uint64_t group, uint8_t h2)
+{
+	uint64_t x = group ^ (GROUP_LSBS * h2);
+
+	return (x - GROUP_LSBS) & ~x & GROUP_MSBS;
+}
+
+static inline group_mask_t group_match_empty(uint64_t group)
+{
+	return group & ~(group << 6) & GROUP_MSBS;
+}
+
+static inline group_mask_t group_match_free(uint64_t group)
+{
+	return group & ~(group << 7) & GROUP_MSBS;
+}
+
+/* Index in its group of the first bucket of a non-zero @p mask, and remove it from @p mask */
+static inline size_t group_mask_next(group_mask_t *mask)
+{
+	size_t i = u64_count_trailing_zeros(*mask) / 8;
+
+	*mask &= *mask - 1;
+
+	return i;
+}
+
+static inline uint64_t sys_hashmap_oa_gp_group(const uint8_t *ctrl, size_t g)
+{
+	return sys_get_le64(&ctrl[g * GROUP_SIZE]);
+}
+
+static inline size_t sys_hashmap_oa_gp_probe(size_t g, size_t i, size_t n_groups)
+{
+	return (g + i) & (n_groups - 1);
+}
+
+static struct oagp_entry *sys_hashmap_oa_gp_find(const struct sys_hashmap *map, uint64_t key,
+						 uint32_t hash)
+{
+	const struct sys_hashmap_oa_gp_data *data =
+		(const struct sys_hashmap_oa_gp_data *)map->data;
+	const size_t n_groups = data->n_buckets / GROUP_SIZE;
+	struct oagp_entry *const buckets = data->buckets;
+	const uint8_t *ctrl = sys_hashmap_oa_gp_ctrl(data);
+	const uint8_t h2 = hash & 0x7f;
+	size_t g = hash >> 7;
+
+	for (size_t i = 0; i < n_groups; ++i) {
+		g = sys_hashmap_oa_gp_probe(g, i, n_groups);
+
+		uint64_t group = sys_hashmap_oa_gp_group(ctrl, g);
+		group_mask_t mask = group_match(group, h2);
+
+		while (mask != 0) {
+			size_t j = g * GROUP_SIZE + group_mask_next(&mask);
+
+			if (buckets[j].key == key && ctrl[j] == h2) {
+				return &buckets[j];
+			}
+		}
+
+		if (group_match_empty(group) != 0) {
+			break;
+		}
+	}
+
+	return NULL;
+}
+
+static size_t sys_hashmap_oa_gp_find_free(const struct sys_hashmap *map, uint32_t hash)
+{
+	const struct sys_hashmap_oa_gp_data *data =
+		(const struct sys_hashmap_oa_gp_data *)map->data;
+	const size_t n_groups = data->n_buckets / GROUP_SIZE;
+	const uint8_t *ctrl = sys_hashmap_oa_gp_ctrl(data);
+	size_t g = hash >> 7;
+
+	for (size_t i = 0; i < n_groups; ++i) {
+		g = sys_hashmap_oa_gp_probe(g, i, n_groups);
+
+		group_mask_t mask = group_match_free(sys_hashmap_oa_gp_group(ctrl, g));
+
+		if (mask != 0) {
+			return g * GROUP_SIZE + group_mask_next(&mask);
+		}
+	}
+
+	__ASSERT(false, "No free bucket in the Hashmap");
+
+	return 0;
+}
+
+static int sys_hashmap_oa_gp_insert_no_rehash(struct sys_hashmap *map, uint64_t key, uint64_t value,
+					      uint64_t *old_value)
+{
+	int ret;
+	size_t i;
+	struct oagp_entry *entry;
+	struct sys_hashmap_oa_gp_data *data = (struct sys_hashmap_oa_gp_data *)map->data;
+	uint8_t *ctrl = sys_hashmap_oa_gp_ctrl(data);
+	uint32_t hash = map->hash_func(&key, sizeof(key));
+
+	entry = sys_hashmap_oa_gp_find(map, key, hash);
+	if (entry != NULL) {
+		if (old_value != NULL) {
+			*old_value = entry->value;
+		}
+
+		entry->value = value;
+
+		return 0;
+	}
+
+	i = sys_hashmap_oa_gp_find_free(map, hash);
+	if (ctrl[i] == CTRL_DELETED) {
+		--data->n_tombstones;
+		ret = 0;
+	} else {
+		ret = 1;
+	}
+
+	ctrl[i] = hash & 0x7f;
+	entry = &((struct oagp_entry *)data->buckets)[i];
+	entry->key = key;
+	entry->value = value;
+	++data->size;
+
+	return ret;
+}
+
+static int sys_hashmap_oa_gp_rehash(struct sys_hashmap *map, bool grow)
+{
+	size_t old_size;
+	size_t old_n_buckets;
+	size_t new_n_buckets = 0;
+	uint8_t *old_ctrl;
+	struct oagp_entry *old_buckets;
+	struct oagp_entry *new_buckets;
+	struct sys_hashmap_oa_gp_data *data = (struct sys_hashmap_oa_gp_data *)map->data;
+
+	if (!sys_hashmap_should_rehash(map, grow, data->n_tombstones, &new_n_buckets)) {
+		return 0;
+	}
+
+	if (map->data->size != SIZE_MAX && map->data->size == map->config->max_size) {
+		return -ENOSPC;
+	}
+
+	/* buckets are probed in whole groups */
+	if (new_n_buckets != 0) {
+		new_n_buckets = MAX(new_n_buckets, GROUP_SIZE);
+	}
+
+	if (new_n_buckets == data->n_buckets && data->n_tombstones == 0) {
+		return 0;
+	}
+
+	/* extract all entries from the hashmap */
+	old_size = data->size;
+	old_n_buckets = data->n_buckets;
+	old_buckets = (struct oagp_entry *)data->buckets;
+	old_ctrl = sys_hashmap_oa_gp_ctrl(data);
+
+	new_buckets = (struct oagp_entry *)map->alloc_func(
+		NULL, new_n_buckets * (sizeof(*new_buckets) + sizeof(*old_ctrl)));
+	if (new_buckets == NULL && new_n_buckets != 0) {
+		return -ENOMEM;
+	}
+
+	data->size = 0;
+	data->n_tombstones = 0;
+	data->buckets = new_buckets;
+	data->n_buckets = new_n_buckets;
+
+	if (new_buckets != NULL) {
+		/* ensure all buckets are empty */
+		memset(sys_hashmap_oa_gp_ctrl(data), CTRL_EMPTY, new_n_buckets);
+	}
+
+	/* re-insert all entries into the hashmap */
+	for (size_t i = 0, j = 0; i < old_n_buckets && j < old_size; ++i) {
+		if (ctrl_is_used(old_ctrl[i])) {
+			sys_hashmap_oa_gp_insert_no_rehash(map, old_buckets[i].key,
+							   old_buckets[i].value, NULL);
+			++j;
+		}
+	}
+
+	/* free the old Hashmap */
+	map->alloc_func(old_buckets, 0);
+
+	return 0;
+}
+
+static void sys_hashmap_oa_gp_iter_next(struct sys_hashmap_iterator *it)
+{
+	size_t i;
+	const struct sys_hashmap *map = (const struct sys_hashmap *)it->map;
+	const struct sys_hashmap_oa_gp_data *data =
+		(const struct sys_hashmap_oa_gp_data *)map->data;
+	struct oagp_entry *buckets = data->buckets;
+	const uint8_t *ctrl = sys_hashmap_oa_gp_ctrl(data);
+
+	__ASSERT(it->size == map->data->size, "Concurrent modification!");
+	__ASSERT(sys_hashmap_iterator_has_next(it), "Attempt to access beyond current bound!");
+
+	if (it->pos == 0) {
+		it->state = buckets;
+	}
+
+	i = (struct oagp_entry *)it->state - buckets;
+	__ASSERT(i < map->data->n_buckets, "Invalid iterator state %p", it->state);
+
+	for (; i < map->data->n_buckets; ++i) {
+		if (ctrl_is_used(ctrl[i])) {
+			it->state = &buckets[i + 1];
+			it->key = buckets[i].key;
+			it->value = buckets[i].value;
+			++it->pos;
+			return;
+		}
+	}
+
+	__ASSERT(false, "Entire Hashmap traversed and no entry was found");
+}
+
+/*
+ * Open Addressing / Group Probe Hashmap API
+ */
+
+static void sys_hashmap_oa_gp_iter(const struct sys_hashmap *map, struct sys_hashmap_iterator *it)
+{
+	it->map = map;
+	it->next = sys_hashmap_oa_gp_iter_next;
+	it->pos = 0;
+	*((size_t *)&it->size) = map->data->size;
+}
+
+static void sys_hashmap_oa_gp_clear(struct sys_hashmap *map, sys_hashmap_callback_t cb,
+				    void *cookie)
+{
+	struct sys_hashmap_oa_gp_data *data = (struct sys_hashmap_oa_gp_data *)map->data;
+	struct oagp_entry *buckets = data->buckets;
+	const uint8_t *ctrl = sys_hashmap_oa_gp_ctrl(data);
+
+	for (size_t i = 0, j = 0; cb != NULL && i < data->n_buckets && j < data->size; ++i) {
+		if (ctrl_is_used(ctrl[i])) {
+			cb(buckets[i].key, buckets[i].value, cookie);
+			++j;
+		}
+	}
+
+	if (data->buckets != NULL) {
+		map->alloc_func(data->buckets, 0);
+		data->buckets = NULL;
+	}
+
+	data->n_buckets = 0;
+	data->size = 0;
+	data->n_tombstones = 0;
+}
+
+static inline int sys_hashmap_oa_gp_insert(struct sys_hashmap *map, uint64_t key, uint64_t value,
+					   uint64_t *old_value)
+{
+	int ret;
+
+	ret = sys_hashmap_oa_gp_rehash(map, true);
+	if (ret < 0) {
+		return ret;
+	}
+
+	return sys_hashmap_oa_gp_insert_no_rehash(map, key, value, old_value);
+}
+
+static bool sys_hashmap_oa_gp_remove(struct sys_hashmap *map, uint64_t key, uint64_t *value)
+{
+	size_t i;
+	struct oagp_entry *entry;
+	struct sys_hashmap_oa_gp_data *data = (struct sys_hashmap_oa_gp_data *)map->data;
+	uint8_t *ctrl = sys_hashmap_oa_gp_ctrl(data);
+
+	if (data->size == 0) {
+		return false;
+	}
+
+	entry = sys_hashmap_oa_gp_find(map, key, map->hash_func(&key, sizeof(key)));
+	if (entry == NULL) {
+		return false;
+	}
+
+	if (value != NULL) {
+		*value = entry->value;
+	}
+
+	/*
+	 * No lookup ever went past a group which still has an empty bucket,
+	 * so the bucket can be made empty again instead of a tombstone.
+	 */
+	i = entry - (struct oagp_entry *)data->buckets;
+	if (group_match_empty(sys_hashmap_oa_gp_group(ctrl, i / GROUP_SIZE)) != 0) {
+		ctrl[i] = CTRL_EMPTY;
+	} else {
+		ctrl[i] = CTRL_DELETED;
+		++data->n_tombstones;
+	}
+
+	--data->size;
+
+	/* ignore a possible -ENOMEM since the table will remain intact */
+	(void)sys_hashmap_oa_gp_rehash(map, false);
+
+	return true;
+}
+
+static bool sys_hashmap_oa_gp_get(const struct sys_hashmap *map, uint64_t key, uint64_t *value)
+{
+	struct oagp_entry *entry;
+
+	if (map->data->size == 0) {
+		return false;
+	}
+
+	entry = sys_hashmap_oa_gp_find(map, key, map->hash_func(&key, sizeof(key)));
+	if (entry == NULL) {
+		return false;
+	}
+
+	if (value != NULL) {
+		*value = entry->value;
+	}
+
+	return true;
+}
+
+const struct sys_hashmap_api sys_hashmap_oa_gp_api = {
+	.iter = sys_hashmap_oa_gp_iter,
+	.clear = sys_hashmap_oa_gp_clear,
+	.insert = sys_hashmap_oa_gp_insert,
+	.remove = sys_hashmap_oa_gp_remove,
+	.get = sys_hashmap_oa_gp_get,
+};
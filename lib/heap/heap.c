@@ -148,6 +148,86 @@ static void free_chunk(struct z_heap *h, chunkid_t c)
 	free_list_add(h, c);
 }
 
+#ifdef CONFIG_SYS_HEAP_FAST_BINS
+/* Fast bins are singly linked lists of freed chunks of one exact size
+ * each, linked through their FREE_NEXT field.  Binned chunks remain
+ * marked used so that neither the allocator nor coalescing of their
+ * neighbors sees them, but the runtime stats count them as free.  They
+ * are only merged back into the free lists by fast_bins_flush() when
+ * an allocation would otherwise fail.
+ */
+static bool fast_bin_put(struct z_heap *h, chunkid_t c)
+{
+	chunksz_t sz = chunk_size(h, c);
+	int i = fast_bin_idx(h, sz);
+
+	/* Don't let the bins hold on to more than an eighth of the heap */
+	if (i < 0 || h->fast_chunks + sz > h->end_chunk / 8U) {
+		return false;
+	}
+
+	set_next_free_chunk(h, c, h->fast_bins[i]);
+	h->fast_bins[i] = c;
+	h->fast_chunks += sz;
+
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+	h->free_bytes += chunksz_to_bytes(h, sz);
+#endif
+	return true;
+}
+
+static chunkid_t fast_bin_take_idx(struct z_heap *h, int i)
+{
+	chunkid_t c = h->fast_bins[i];
+
+	CHECK(c != 0U && chunk_used(h, c));
+
+	h->fast_bins[i] = next_free_chunk(h, c);
+	h->fast_chunks -= chunk_size(h, c);
+
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+	h->free_bytes -= chunksz_to_bytes(h, chunk_size(h, c));
+#endif
+	return c;
+}
+
+static chunkid_t fast_bin_take(struct z_heap *h, chunksz_t sz)
+{
+	int i = fast_bin_idx(h, sz);
+
+	if (i < 0 || h->fast_bins[i] == 0U) {
+		return 0;
+	}
+	return fast_bin_take_idx(h, i);
+}
+
+static void fast_bins_flush(struct z_heap *h)
+{
+	for (int i = 0; i < CONFIG_SYS_HEAP_FAST_BIN_COUNT; i++) {
+		while (h->fast_bins[i] != 0U) {
+			chunkid_t c = fast_bin_take_idx(h, i);
+
+			set_chunk_used(h, c, false);
+			free_chunk(h, c);
+		}
+	}
+}
+#else
+static inline bool fast_bin_put(struct z_heap *h, chunkid_t c)
+{
+	ARG_UNUSED(h);
+	ARG_UNUSED(c);
+	return false;
+}
+
+static inline chunkid_t fast_bin_take(struct z_heap *h, chunksz_t sz)
+{
+	ARG_UNUSED(h);
+	ARG_UNUSED(sz);
+	return 0;
+}
+#endif
+
 /*
  * Return the closest chunk ID corresponding to given memory pointer.
  * Here "closest" is only meaningful in the context of sys_heap_aligned_alloc()
@@ -184,7 +264,6 @@ void sys_heap_free(struct sys_heap *heap, void *mem)
 		 "corrupted heap bounds (buffer overflow?) for memory at %p",
 		 mem);
 
-	set_chunk_used(h, c, false);
 #ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
 	h->allocated_bytes -= chunksz_to_bytes(h, chunk_size(h, c));
 #endif
@@ -194,7 +273,10 @@ void sys_heap_free(struct sys_heap *heap, void *mem)
 				  chunksz_to_bytes(h, chunk_size(h, c)));
 #endif
 
-	free_chunk(h, c);
+	if (!fast_bin_put(h, c)) {
+		set_chunk_used(h, c, false);
+		free_chunk(h, c);
+	}
 }
 
 size_t sys_heap_usable_size(struct sys_heap *heap, void *mem)
@@ -208,7 +290,7 @@ size_t sys_heap_usable_size(struct sys_heap *heap, void *mem)
 	return chunk_sz - (addr - chunk_base);
 }
 
-static chunkid_t alloc_chunk(struct z_heap *h, chunksz_t sz)
+static chunkid_t alloc_free_chunk(struct z_heap *h, chunksz_t sz)
 {
 	int bi = bucket_idx(h, sz);
 	struct z_heap_bucket *b = &h->buckets[bi];
@@ -260,6 +342,21 @@ static chunkid_t alloc_chunk(struct z_heap *h, chunksz_t sz)
 	return 0;
 }
 
+static chunkid_t alloc_chunk(struct z_heap *h, chunksz_t sz)
+{
+	chunkid_t c = alloc_free_chunk(h, sz);
+
+#ifdef CONFIG_SYS_HEAP_FAST_BINS
+	/* Coalesce the binned chunks and retry before giving up */
+	if (c == 0U && h->fast_chunks != 0U) {
+		fast_bins_flush(h);
+		c = alloc_free_chunk(h, sz);
+	}
+#endif
+
+	return c;
+}
+
 void *sys_heap_alloc(struct sys_heap *heap, size_t bytes)
 {
 	struct z_heap *h = heap->heap;
@@ -270,18 +367,22 @@ void *sys_heap_alloc(struct sys_heap *heap, size_t bytes)
 	}
 
 	chunksz_t chunk_sz = bytes_to_chunksz(h, bytes);
-	chunkid_t c = alloc_chunk(h, chunk_sz);
+	chunkid_t c = fast_bin_take(h, chunk_sz);
+
 	if (c == 0U) {
-		return NULL;
-	}
+		c = alloc_chunk(h, chunk_sz);
+		if (c == 0U) {
+			return NULL;
+		}
 
-	/* Split off remainder if any */
-	if (chunk_size(h, c) > chunk_sz) {
-		split_chunks(h, c, c + chunk_sz);
-		free_list_add(h, c + chunk_sz);
-	}
+		/* Split off remainder if any */
+		if (chunk_size(h, c) > chunk_sz) {
+			split_chunks(h, c, c + chunk_sz);
+			free_list_add(h, c + chunk_sz);
+		}
 
-	set_chunk_used(h, c, true);
+		set_chunk_used(h, c, true);
+	}
 
 	mem = chunk_mem(h, c);
 
@@ -511,6 +612,13 @@ void sys_heap_init(struct sys_heap *heap, void *mem, size_t bytes)
 	h->end_chunk = heap_sz;
 	h->avail_buckets = 0;
 
+#ifdef CONFIG_SYS_HEAP_FAST_BINS
+	for (int i = 0; i < CONFIG_SYS_HEAP_FAST_BIN_COUNT; i++) {
+		h->fast_bins[i] = 0;
+	}
+	h->fast_chunks = 0;
+#endif
+
 #ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
 	h->free_bytes = 0;
 	h->allocated_bytes = 0;
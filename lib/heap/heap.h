@@ -69,6 +69,10 @@ struct z_heap {
 	chunkid_t chunk0_hdr[2];
 	chunkid_t end_chunk;
 	uint32_t avail_buckets;
+#ifdef CONFIG_SYS_HEAP_FAST_BINS
+	chunkid_t fast_bins[CONFIG_SYS_HEAP_FAST_BIN_COUNT];
+	chunksz_t fast_chunks;
+#endif
 #ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
 	size_t free_bytes;
 	size_t allocated_bytes;
@@ -253,6 +257,18 @@ static inline int bucket_idx(struct z_heap *h, chunksz_t sz)
 	return 31 - __builtin_clz(usable_sz);
 }
 
+#ifdef CONFIG_SYS_HEAP_FAST_BINS
+/* Fast bin index for a chunk size, or -1 if chunks of that size are
+ * not binned.
+ */
+static inline int fast_bin_idx(struct z_heap *h, chunksz_t sz)
+{
+	chunksz_t idx = sz - min_chunk_size(h);
+
+	return (idx < CONFIG_SYS_HEAP_FAST_BIN_COUNT) ? (int)idx : -1;
+}
+#endif
+
 static inline bool size_too_big(struct z_heap *h, size_t bytes)
 {
 	/*
@@ -277,6 +293,16 @@ static inline void get_alloc_info(struct z_heap *h, size_t *alloc_bytes,
 			*free_bytes += chunksz_to_bytes(h, chunk_size(h, c));
 		}
 	}
+
+#ifdef CONFIG_SYS_HEAP_FAST_BINS
+	/* Chunks in fast bins are marked used but count as free */
+	for (int i = 0; i < CONFIG_SYS_HEAP_FAST_BIN_COUNT; i++) {
+		for (c = h->fast_bins[i]; c != 0U; c = next_free_chunk(h, c)) {
+			*alloc_bytes -= chunksz_to_bytes(h, chunk_size(h, c));
+			*free_bytes += chunksz_to_bytes(h, chunk_size(h, c));
+		}
+	}
+#endif
 }
 
 #endif /* ZEPHYR_INCLUDE_LIB_OS_HEAP_H_ */
@@ -74,3 +74,28 @@ void sys_heap_print_info(struct sys_heap *heap, bool dump_chunks)
 {
 	heap_print_info(heap->heap, dump_chunks);
 }
+
+int sys_heap_free_foreach(struct sys_heap *heap, sys_heap_free_cb_t cb, void *user_data)
+{
+	struct z_heap *h = heap->heap;
+	/* Up to the free list links, which stay in the dump */
+	size_t meta_bytes = (FREE_NEXT + 1) * (big_heap(h) ? sizeof(uint32_t) : sizeof(uint16_t));
+	chunkid_t c = right_chunk(h, 0);
+
+	while (c < h->end_chunk) {
+		chunksz_t sz = chunk_size(h, c);
+
+		if (sz == 0 || sz > h->end_chunk - c || left_chunk(h, c + sz) != c) {
+			return -EINVAL;
+		}
+
+		if (!chunk_used(h, c) && sz * CHUNK_UNIT > meta_bytes) {
+			cb(POINTER_TO_UINT(&chunk_buf(h)[c]) + meta_bytes,
+			   sz * CHUNK_UNIT - meta_bytes, user_data);
+		}
+
+		c += sz;
+	}
+
+	return 0;
+}
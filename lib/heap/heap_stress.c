@@ -127,8 +127,10 @@ void sys_heap_stress(void *(*alloc_fn)(void *arg, size_t bytes),
 	for (uint32_t i = 0; i < op_count; i++) {
 		if (rand_alloc_choice(&sr)) {
 			size_t sz = rand_alloc_size(&sr);
+			uint32_t t0 = k_cycle_get_32();
 			void *p = sr.alloc_fn(sr.arg, sz);
 
+			result->op_cycles += k_cycle_get_32() - t0;
 			result->total_allocs++;
 			if (p != NULL) {
 				result->successful_allocs++;
@@ -136,6 +138,9 @@ void sys_heap_stress(void *(*alloc_fn)(void *arg, size_t bytes),
 				sr.blocks[sr.blocks_alloced].sz = sz;
 				sr.blocks_alloced++;
 				sr.bytes_alloced += sz;
+			} else {
+				result->accumulated_failed_in_use_bytes +=
+					sr.bytes_alloced;
 			}
 		} else {
 			int b = rand_free_choice(&sr);
@@ -146,7 +151,11 @@ void sys_heap_stress(void *(*alloc_fn)(void *arg, size_t bytes),
 			sr.blocks[b] = sr.blocks[sr.blocks_alloced - 1];
 			sr.blocks_alloced--;
 			sr.bytes_alloced -= sz;
+
+			uint32_t t0 = k_cycle_get_32();
+
 			sr.free_fn(sr.arg, p);
+			result->op_cycles += k_cycle_get_32() - t0;
 		}
 		result->accumulated_in_use_bytes += sr.bytes_alloced;
 	}
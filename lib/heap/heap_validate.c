@@ -85,6 +85,32 @@ bool sys_heap_validate(struct sys_heap *heap)
 		return false;  /* Should have exactly consumed the buffer */
 	}
 
+#ifdef CONFIG_SYS_HEAP_FAST_BINS
+	/* Fast bin entries are valid chunks still marked USED, each of
+	 * the exact size of its bin, and their sizes add up to the
+	 * binned total.
+	 */
+	chunksz_t fast_chunks = 0;
+
+	for (int i = 0; i < CONFIG_SYS_HEAP_FAST_BIN_COUNT; i++) {
+		for (c = h->fast_bins[i]; c != 0; c = next_free_chunk(h, c)) {
+			if (!valid_chunk(h, c) || !chunk_used(h, c)) {
+				return false;
+			}
+			if (fast_bin_idx(h, chunk_size(h, c)) != i) {
+				return false;
+			}
+			fast_chunks += chunk_size(h, c);
+			if (fast_chunks > h->fast_chunks) {
+				return false;  /* Also catches loops */
+			}
+		}
+	}
+	if (fast_chunks != h->fast_chunks) {
+		return false;
+	}
+#endif
+
 #ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
 	/*
 	 * Validate sys_heap_runtime_stats_get API.
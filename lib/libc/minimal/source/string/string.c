@@ -211,6 +211,32 @@ char *strncat(char *ZRESTRICT dest, const char *ZRESTRICT src,
 	return orig_dest;
 }
 
+#if !defined(CONFIG_MINIMAL_LIBC_OPTIMIZE_STRING_FOR_SIZE)
+/* Number of words handled per iteration of the unrolled loops, which the
+ * compiler can turn into load and store multiple or pair instructions.
+ */
+#define MEM_WORDS_PER_BLOCK 4
+
+#define MEM_WORD_MASK ((uintptr_t)sizeof(mem_word_t) - 1)
+
+/*
+ * Merge the last bytes of word <w0> with the first bytes of word <w1>,
+ * both read from aligned addresses, into the word starting <offset>
+ * bytes into <w0>.
+ */
+static inline mem_word_t mem_word_merge(mem_word_t w0, mem_word_t w1,
+					unsigned int offset)
+{
+	unsigned int shift = offset * 8U;
+
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	return (w0 << shift) | (w1 >> (Z_MEM_WORD_T_WIDTH - shift));
+#else
+	return (w0 >> shift) | (w1 << (Z_MEM_WORD_T_WIDTH - shift));
+#endif
+}
+#endif
+
 /**
  *
  * @brief Compare two memory areas
@@ -226,6 +252,35 @@ int memcmp(const void *m1, const void *m2, size_t n)
 		return 0;
 	}
 
+#if !defined(CONFIG_MINIMAL_LIBC_OPTIMIZE_STRING_FOR_SIZE)
+	/* skip equal words if both areas have identical alignment */
+
+	if ((((uintptr_t)c1 ^ (uintptr_t)c2) & MEM_WORD_MASK) == 0) {
+		while ((((uintptr_t)c1) & MEM_WORD_MASK) && (n > 1) &&
+		       (*c1 == *c2)) {
+			c1++;
+			c2++;
+			n--;
+		}
+
+		if ((((uintptr_t)c1) & MEM_WORD_MASK) == 0) {
+			const mem_word_t *w1 = (const mem_word_t *)c1;
+			const mem_word_t *w2 = (const mem_word_t *)c2;
+
+			/* keep the last byte for the comparison below */
+
+			while ((n > sizeof(mem_word_t)) && (*w1 == *w2)) {
+				w1++;
+				w2++;
+				n -= sizeof(mem_word_t);
+			}
+
+			c1 = (const char *)w1;
+			c2 = (const char *)w2;
+		}
+	}
+#endif
+
 	while ((--n > 0) && (*c1 == *c2)) {
 		c1++;
 		c2++;
@@ -252,12 +307,53 @@ void *memmove(void *d, const void *s, size_t n)
 		 * Copy backwards to prevent the premature corruption of <src>.
 		 */
 
+#if !defined(CONFIG_MINIMAL_LIBC_OPTIMIZE_STRING_FOR_SIZE)
+		/* copy word-sized from the end if buffers have identical alignment */
+
+		if ((((uintptr_t)dest ^ (uintptr_t)src) & MEM_WORD_MASK) == 0) {
+			while (((uintptr_t)(dest + n)) & MEM_WORD_MASK) {
+				if (n == 0) {
+					return d;
+				}
+				n--;
+				dest[n] = src[n];
+			}
+
+			while (n >= sizeof(mem_word_t)) {
+				n -= sizeof(mem_word_t);
+				*(mem_word_t *)(dest + n) =
+					*(const mem_word_t *)(src + n);
+			}
+		}
+#endif
+
 		while (n > 0) {
 			n--;
 			dest[n] = src[n];
 		}
 	} else {
 		/* It is safe to perform a forward-copy */
+#if !defined(CONFIG_MINIMAL_LIBC_OPTIMIZE_STRING_FOR_SIZE)
+		if ((((uintptr_t)dest ^ (uintptr_t)src) & MEM_WORD_MASK) == 0) {
+			while (((uintptr_t)dest) & MEM_WORD_MASK) {
+				if (n == 0) {
+					return d;
+				}
+				*dest = *src;
+				dest++;
+				src++;
+				n--;
+			}
+
+			while (n >= sizeof(mem_word_t)) {
+				*(mem_word_t *)dest = *(const mem_word_t *)src;
+				dest += sizeof(mem_word_t);
+				src += sizeof(mem_word_t);
+				n -= sizeof(mem_word_t);
+			}
+		}
+#endif
+
 		while (n > 0) {
 			*dest = *src;
 			dest++;
@@ -278,38 +374,72 @@ void *memmove(void *d, const void *s, size_t n)
 
 void *memcpy(void *ZRESTRICT d, const void *ZRESTRICT s, size_t n)
 {
-	/* attempt word-sized copying only if buffers have identical alignment */
-
 	unsigned char *d_byte = (unsigned char *)d;
 	const unsigned char *s_byte = (const unsigned char *)s;
 
 #if !defined(CONFIG_MINIMAL_LIBC_OPTIMIZE_STRING_FOR_SIZE)
-	const uintptr_t mask = sizeof(mem_word_t) - 1;
-
-	if ((((uintptr_t)d ^ (uintptr_t)s_byte) & mask) == 0) {
+	if (n >= 2 * sizeof(mem_word_t)) {
 
-		/* do byte-sized copying until word-aligned or finished */
+		/* do byte-sized copying until the destination is word-aligned */
 
-		while (((uintptr_t)d_byte) & mask) {
-			if (n == 0) {
-				return d;
-			}
+		while (((uintptr_t)d_byte) & MEM_WORD_MASK) {
 			*(d_byte++) = *(s_byte++);
 			n--;
 		}
 
-		/* do word-sized copying as long as possible */
-
 		mem_word_t *d_word = (mem_word_t *)d_byte;
-		const mem_word_t *s_word = (const mem_word_t *)s_byte;
+		unsigned int offset = (uintptr_t)s_byte & MEM_WORD_MASK;
+
+		if (offset == 0) {
+			const mem_word_t *s_word = (const mem_word_t *)s_byte;
+
+			/* do word-sized copying, a block at a time */
+
+			while (n >= MEM_WORDS_PER_BLOCK * sizeof(mem_word_t)) {
+				mem_word_t w0 = s_word[0];
+				mem_word_t w1 = s_word[1];
+				mem_word_t w2 = s_word[2];
+				mem_word_t w3 = s_word[3];
+
+				d_word[0] = w0;
+				d_word[1] = w1;
+				d_word[2] = w2;
+				d_word[3] = w3;
+				d_word += MEM_WORDS_PER_BLOCK;
+				s_word += MEM_WORDS_PER_BLOCK;
+				n -= MEM_WORDS_PER_BLOCK * sizeof(mem_word_t);
+			}
 
-		while (n >= sizeof(mem_word_t)) {
-			*(d_word++) = *(s_word++);
-			n -= sizeof(mem_word_t);
+			while (n >= sizeof(mem_word_t)) {
+				*(d_word++) = *(s_word++);
+				n -= sizeof(mem_word_t);
+			}
+
+			s_byte = (const unsigned char *)s_word;
+		} else {
+			/*
+			 * The source is not word-aligned: read aligned words
+			 * and shift them into place, so each destination word
+			 * takes one load. Every word read holds at least one
+			 * byte being copied.
+			 */
+			const mem_word_t *s_word =
+				(const mem_word_t *)(s_byte - offset);
+			mem_word_t w0 = *(s_word++);
+
+			while (n >= sizeof(mem_word_t)) {
+				mem_word_t w1 = *(s_word++);
+
+				*(d_word++) = mem_word_merge(w0, w1, offset);
+				w0 = w1;
+				n -= sizeof(mem_word_t);
+			}
+
+			s_byte = (const unsigned char *)s_word -
+				 sizeof(mem_word_t) + offset;
 		}
 
 		d_byte = (unsigned char *)d_word;
-		s_byte = (unsigned char *)s_word;
 	}
 #endif
 
@@ -357,6 +487,15 @@ void *memset(void *buf, int c, size_t n)
 	c_word |= c_word << 32;
 #endif
 
+	while (n >= MEM_WORDS_PER_BLOCK * sizeof(mem_word_t)) {
+		d_word[0] = c_word;
+		d_word[1] = c_word;
+		d_word[2] = c_word;
+		d_word[3] = c_word;
+		d_word += MEM_WORDS_PER_BLOCK;
+		n -= MEM_WORDS_PER_BLOCK * sizeof(mem_word_t);
+	}
+
 	while (n >= sizeof(mem_word_t)) {
 		*(d_word++) = c_word;
 		n -= sizeof(mem_word_t);
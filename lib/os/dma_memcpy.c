@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/cache.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/dma.h>
+#include <zephyr/init.h>
+#include <zephyr/sys/dma_memcpy.h>
+#include <zephyr/sys/util.h>
+
+/*
+ * Copies are queued and run one at a time on a single memory to memory
+ * channel, in chunks of up to CONFIG_SYS_DMA_MEMCPY_MAX_BLOCK bytes.  A copy
+ * the DMA fails to start is finished with the CPU.
+ */
+
+#define DMA_MEMCPY_DEV DEVICE_DT_GET(DT_CHOSEN(zephyr_dma_memcpy))
+
+struct dma_memcpy_sync {
+	struct sys_dma_memcpy req;
+	struct k_sem sem;
+	int result;
+};
+
+static struct k_spinlock dma_memcpy_lock;
+static sys_slist_t dma_memcpy_queue;
+static struct sys_dma_memcpy *dma_memcpy_cur;
+static size_t dma_memcpy_pos;
+static size_t dma_memcpy_chunk;
+static int dma_memcpy_channel = -1;
+static struct dma_config dma_memcpy_cfg;
+static struct dma_block_config dma_memcpy_blk;
+
+static bool dma_memcpy_use_cpu(const struct sys_dma_memcpy *req)
+{
+	size_t line = sys_cache_data_line_size_get();
+
+	if ((dma_memcpy_channel < 0) || (req->len < CONFIG_SYS_DMA_MEMCPY_THRESHOLD)) {
+		return true;
+	}
+
+	/* Invalidating the destination must not drop data of its neighbours */
+	return IS_ENABLED(CONFIG_DCACHE) && (line > 0) &&
+	       ((((uintptr_t)req->dst | req->len) & (line - 1)) != 0);
+}
+
+/* Start the next chunk of the current copy, with the lock held */
+static int dma_memcpy_start(void)
+{
+	const struct sys_dma_memcpy *req = dma_memcpy_cur;
+	uintptr_t src = (uintptr_t)req->src + dma_memcpy_pos;
+	uintptr_t dst = (uintptr_t)req->dst + dma_memcpy_pos;
+	size_t left = req->len - dma_memcpy_pos;
+	uint32_t width = (((src | dst | left) & 3) == 0) ? 4 : 1;
+	int rc;
+
+	dma_memcpy_chunk = MIN(left, ROUND_DOWN(CONFIG_SYS_DMA_MEMCPY_MAX_BLOCK, width));
+
+	dma_memcpy_blk.source_address = src;
+	dma_memcpy_blk.dest_address = dst;
+	dma_memcpy_blk.block_size = dma_memcpy_chunk;
+	dma_memcpy_cfg.source_data_size = width;
+	dma_memcpy_cfg.dest_data_size = width;
+	dma_memcpy_cfg.source_burst_length = width;
+	dma_memcpy_cfg.dest_burst_length = width;
+
+	rc = dma_config(DMA_MEMCPY_DEV, dma_memcpy_channel, &dma_memcpy_cfg);
+	if (rc == 0) {
+		rc = dma_start(DMA_MEMCPY_DEV, dma_memcpy_channel);
+	}
+
+	return rc;
+}
+
+/*
+ * Move to the next queued copy once the current one is over, with the lock
+ * held.  Copies finished with the CPU are appended to done.
+ */
+static void dma_memcpy_next(sys_slist_t *done)
+{
+	struct sys_dma_memcpy *req;
+	sys_snode_t *node;
+
+	while ((dma_memcpy_cur == NULL) &&
+	       ((node = sys_slist_get(&dma_memcpy_queue)) != NULL)) {
+		req = CONTAINER_OF(node, struct sys_dma_memcpy, node);
+		dma_memcpy_cur = req;
+		dma_memcpy_pos = 0;
+
+		if (dma_memcpy_start() != 0) {
+			(void)memcpy(req->dst, req->src, req->len);
+			sys_slist_append(done, &req->node);
+			dma_memcpy_cur = NULL;
+		}
+	}
+}
+
+static void dma_memcpy_complete(sys_slist_t *done, int result)
+{
+	struct sys_dma_memcpy *req;
+	sys_snode_t *node;
+
+	while ((node = sys_slist_get(done)) != NULL) {
+		req = CONTAINER_OF(node, struct sys_dma_memcpy, node);
+		req->done(req, result);
+		result = 0;
+	}
+}
+
+static void dma_memcpy_callback(const struct device *dev, void *user_data,
+				uint32_t channel, int status)
+{
+	struct sys_dma_memcpy *req;
+	sys_slist_t done;
+	k_spinlock_key_t key;
+
+	ARG_UNUSED(dev);
+	ARG_UNUSED(user_data);
+	ARG_UNUSED(channel);
+
+	if (status == DMA_STATUS_BLOCK) {
+		return;
+	}
+
+	sys_slist_init(&done);
+	key = k_spin_lock(&dma_memcpy_lock);
+
+	req = dma_memcpy_cur;
+	if (req == NULL) {
+		k_spin_unlock(&dma_memcpy_lock, key);
+		return;
+	}
+
+	if (status == DMA_STATUS_COMPLETE) {
+		dma_memcpy_pos += dma_memcpy_chunk;
+		if ((dma_memcpy_pos < req->len) && (dma_memcpy_start() == 0)) {
+			k_spin_unlock(&dma_memcpy_lock, key);
+			return;
+		}
+
+		if (dma_memcpy_pos < req->len) {
+			(void)memcpy((uint8_t *)req->dst + dma_memcpy_pos,
+				     (const uint8_t *)req->src + dma_memcpy_pos,
+				     req->len - dma_memcpy_pos);
+		}
+	}
+
+	/* Lines of the destination may have been fetched during the transfer */
+	(void)sys_cache_data_invd_range(req->dst, req->len);
+
+	sys_slist_prepend(&done, &req->node);
+	dma_memcpy_cur = NULL;
+	dma_memcpy_next(&done);
+
+	k_spin_unlock(&dma_memcpy_lock, key);
+
+	dma_memcpy_complete(&done, (status < 0) ? status : 0);
+}
+
+int sys_dma_memcpy_submit(struct sys_dma_memcpy *req)
+{
+	sys_slist_t done;
+	k_spinlock_key_t key;
+
+	if (dma_memcpy_use_cpu(req)) {
+		(void)memcpy(req->dst, req->src, req->len);
+		req->done(req, 0);
+		return 0;
+	}
+
+	(void)sys_cache_data_flush_range((void *)req->src, req->len);
+	(void)sys_cache_data_flush_and_invd_range(req->dst, req->len);
+
+	sys_slist_init(&done);
+	key = k_spin_lock(&dma_memcpy_lock);
+	sys_slist_append(&dma_memcpy_queue, &req->node);
+	dma_memcpy_next(&done);
+	k_spin_unlock(&dma_memcpy_lock, key);
+
+	dma_memcpy_complete(&done, 0);
+
+	return 0;
+}
+
+static void dma_memcpy_sync_done(struct sys_dma_memcpy *req, int result)
+{
+	struct dma_memcpy_sync *sync = CONTAINER_OF(req, struct dma_memcpy_sync, req);
+
+	sync->result = result;
+	k_sem_give(&sync->sem);
+}
+
+int sys_dma_memcpy(void *dst, const void *src, size_t len)
+{
+	struct dma_memcpy_sync sync = {
+		.req = {
+			.dst = dst,
+			.src = src,
+			.len = len,
+			.done = dma_memcpy_sync_done,
+		},
+	};
+
+	if (k_is_in_isr() || dma_memcpy_use_cpu(&sync.req)) {
+		(void)memcpy(dst, src, len);
+		return 0;
+	}
+
+	k_sem_init(&sync.sem, 0, 1);
+	(void)sys_dma_memcpy_submit(&sync.req);
+	k_sem_take(&sync.sem, K_FOREVER);
+
+	return sync.result;
+}
+
+static int dma_memcpy_init(void)
+{
+	const struct device *dev = DMA_MEMCPY_DEV;
+
+	if (!device_is_ready(dev)) {
+		return 0;
+	}
+
+	dma_memcpy_channel = CONFIG_SYS_DMA_MEMCPY_CHANNEL;
+	if (dma_memcpy_channel < 0) {
+		/* Copies are done with the CPU when no channel is free */
+		dma_memcpy_channel = dma_request_channel(dev, NULL);
+	}
+
+	dma_memcpy_cfg.channel_direction = MEMORY_TO_MEMORY;
+	dma_memcpy_cfg.block_count = 1;
+	dma_memcpy_cfg.head_block = &dma_memcpy_blk;
+	dma_memcpy_cfg.dma_callback = dma_memcpy_callback;
+
+	return 0;
+}
+
+SYS_INIT(dma_memcpy_init, POST_KERNEL, CONFIG_SYS_DMA_MEMCPY_INIT_PRIORITY);
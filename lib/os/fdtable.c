@@ -91,14 +91,52 @@ static int z_fd_unref(int fd)
 		}
 	} while (!atomic_cas(&fdtable[fd].refcount, old_rc, old_rc - 1));
 
-	if (old_rc != 1) {
-		return old_rc - 1;
+	/* The object and vtable are left in place: lookups may still be
+	 * reading them, they are reset when the entry is reserved again.
+	 */
+	return old_rc - 1;
+}
+
+/* Lookups take a reference on the entry for as long as they use it, so it
+ * can't be freed and reused under them by a concurrent close(). Entries
+ * are never moved, so this doesn't need the table lock.
+ */
+static struct fd_entry *fd_entry_get(int fd)
+{
+	struct fd_entry *entry;
+	atomic_val_t old_rc;
+
+	if (fd < 0 || fd >= ARRAY_SIZE(fdtable)) {
+		errno = EBADF;
+		return NULL;
 	}
 
-	fdtable[fd].obj = NULL;
-	fdtable[fd].vtable = NULL;
+	entry = &fdtable[k_array_index_sanitize(fd, ARRAY_SIZE(fdtable))];
 
-	return 0;
+	/* Free entries must stay free, only take a reference if there
+	 * is one already.
+	 */
+	do {
+		old_rc = atomic_get(&entry->refcount);
+		if (!old_rc) {
+			errno = EBADF;
+			return NULL;
+		}
+	} while (!atomic_cas(&entry->refcount, old_rc, old_rc + 1));
+
+	if (entry->vtable == NULL) {
+		/* Reserved, but not finalized yet */
+		(void)z_fd_unref(entry - fdtable);
+		errno = EBADF;
+		return NULL;
+	}
+
+	return entry;
+}
+
+static void fd_entry_put(struct fd_entry *entry)
+{
+	(void)z_fd_unref(entry - fdtable);
 }
 
 static int _find_fd_entry(void)
@@ -179,7 +217,8 @@ static int z_get_fd_by_obj_and_vtable(void *obj, const struct fd_op_vtable *vtab
 	int fd;
 
 	for (fd = 0; fd < ARRAY_SIZE(fdtable); fd++) {
-		if (fdtable[fd].obj == obj && fdtable[fd].vtable == vtable) {
+		if (fdtable[fd].obj == obj && fdtable[fd].vtable == vtable &&
+		    atomic_get(&fdtable[fd].refcount)) {
 			return fd;
 		}
 	}
@@ -300,17 +339,20 @@ int z_alloc_fd(void *obj, const struct fd_op_vtable *vtable)
 
 ssize_t read(int fd, void *buf, size_t sz)
 {
+	struct fd_entry *entry = fd_entry_get(fd);
 	ssize_t res;
 
-	if (_check_fd(fd) < 0) {
+	if (entry == NULL) {
 		return -1;
 	}
 
-	(void)k_mutex_lock(&fdtable[fd].lock, K_FOREVER);
+	(void)k_mutex_lock(&entry->lock, K_FOREVER);
+
+	res = entry->vtable->read(entry->obj, buf, sz);
 
-	res = fdtable[fd].vtable->read(fdtable[fd].obj, buf, sz);
+	k_mutex_unlock(&entry->lock);
 
-	k_mutex_unlock(&fdtable[fd].lock);
+	fd_entry_put(entry);
 
 	return res;
 }
@@ -318,17 +360,20 @@ FUNC_ALIAS(read, _read, ssize_t);
 
 ssize_t write(int fd, const void *buf, size_t sz)
 {
+	struct fd_entry *entry = fd_entry_get(fd);
 	ssize_t res;
 
-	if (_check_fd(fd) < 0) {
+	if (entry == NULL) {
 		return -1;
 	}
 
-	(void)k_mutex_lock(&fdtable[fd].lock, K_FOREVER);
+	(void)k_mutex_lock(&entry->lock, K_FOREVER);
 
-	res = fdtable[fd].vtable->write(fdtable[fd].obj, buf, sz);
+	res = entry->vtable->write(entry->obj, buf, sz);
 
-	k_mutex_unlock(&fdtable[fd].lock);
+	k_mutex_unlock(&entry->lock);
+
+	fd_entry_put(entry);
 
 	return res;
 }
@@ -336,19 +381,24 @@ FUNC_ALIAS(write, _write, ssize_t);
 
 int close(int fd)
 {
+	struct fd_entry *entry = fd_entry_get(fd);
 	int res;
 
-	if (_check_fd(fd) < 0) {
+	if (entry == NULL) {
 		return -1;
 	}
 
-	(void)k_mutex_lock(&fdtable[fd].lock, K_FOREVER);
+	(void)k_mutex_lock(&entry->lock, K_FOREVER);
 
-	res = fdtable[fd].vtable->close(fdtable[fd].obj);
+	res = entry->vtable->close(entry->obj);
 
-	k_mutex_unlock(&fdtable[fd].lock);
+	k_mutex_unlock(&entry->lock);
 
+	/* Drop the reference of the descriptor itself, the entry is freed
+	 * once the last lookup still using it is done.
+	 */
 	z_free_fd(fd);
+	fd_entry_put(entry);
 
 	return res;
 }
@@ -356,61 +406,86 @@ FUNC_ALIAS(close, _close, int);
 
 int fsync(int fd)
 {
-	if (_check_fd(fd) < 0) {
+	struct fd_entry *entry = fd_entry_get(fd);
+	int res;
+
+	if (entry == NULL) {
 		return -1;
 	}
 
-	return z_fdtable_call_ioctl(fdtable[fd].vtable, fdtable[fd].obj, ZFD_IOCTL_FSYNC);
+	res = z_fdtable_call_ioctl(entry->vtable, entry->obj, ZFD_IOCTL_FSYNC);
+
+	fd_entry_put(entry);
+
+	return res;
 }
 
 off_t lseek(int fd, off_t offset, int whence)
 {
-	if (_check_fd(fd) < 0) {
+	struct fd_entry *entry = fd_entry_get(fd);
+	off_t res;
+
+	if (entry == NULL) {
 		return -1;
 	}
 
-	return z_fdtable_call_ioctl(fdtable[fd].vtable, fdtable[fd].obj, ZFD_IOCTL_LSEEK,
-			  offset, whence);
+	res = z_fdtable_call_ioctl(entry->vtable, entry->obj, ZFD_IOCTL_LSEEK,
+				   offset, whence);
+
+	fd_entry_put(entry);
+
+	return res;
 }
 FUNC_ALIAS(lseek, _lseek, off_t);
 
 int ioctl(int fd, unsigned long request, ...)
 {
+	struct fd_entry *entry = fd_entry_get(fd);
 	va_list args;
 	int res;
 
-	if (_check_fd(fd) < 0) {
+	if (entry == NULL) {
 		return -1;
 	}
 
 	va_start(args, request);
-	res = fdtable[fd].vtable->ioctl(fdtable[fd].obj, request, args);
+	res = entry->vtable->ioctl(entry->obj, request, args);
 	va_end(args);
 
+	fd_entry_put(entry);
+
 	return res;
 }
 
 int fcntl(int fd, int cmd, ...)
 {
+	struct fd_entry *entry;
 	va_list args;
 	int res;
 
-	if (_check_fd(fd) < 0) {
-		return -1;
-	}
-
 	/* Handle fdtable commands. */
 	if (cmd == F_DUPFD) {
+		if (_check_fd(fd) < 0) {
+			return -1;
+		}
+
 		/* Not implemented so far. */
 		errno = EINVAL;
 		return -1;
 	}
 
+	entry = fd_entry_get(fd);
+	if (entry == NULL) {
+		return -1;
+	}
+
 	/* The rest of commands are per-fd, handled by ioctl vmethod. */
 	va_start(args, cmd);
-	res = fdtable[fd].vtable->ioctl(fdtable[fd].obj, cmd, args);
+	res = entry->vtable->ioctl(entry->obj, cmd, args);
 	va_end(args);
 
+	fd_entry_put(entry);
+
 	return res;
 }
 
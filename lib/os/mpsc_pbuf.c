@@ -209,8 +209,18 @@ static bool drop_item_locked(struct mpsc_pbuf_buffer *buffer,
 			add_skip_item(buffer, free_wlen);
 			MPSC_PBUF_DBG(buffer, "no space: Added skip packet (len:%d)", free_wlen);
 		}
-		/* Move all indexes forward, after claimed packet. */
-		buffer->wr_idx = idx_inc(buffer, buffer->wr_idx, rd_wlen);
+		/* Move all indexes forward, after claimed packets. When more
+		 * than one packet is claimed (see mpsc_pbuf_claim_batch()),
+		 * they span from rd_idx to tmp_rd_idx.
+		 */
+		if (buffer->rd_idx != buffer->tmp_rd_idx) {
+			uint32_t claimed_wlen = idx_inc(buffer, buffer->tmp_rd_idx,
+							buffer->size - buffer->rd_idx);
+
+			buffer->wr_idx = idx_inc(buffer, buffer->wr_idx, claimed_wlen);
+		} else {
+			buffer->wr_idx = idx_inc(buffer, buffer->wr_idx, rd_wlen);
+		}
 
 		/* If allocation wrapped around the buffer and found busy packet
 		 * that was already ommited, skip it again.
@@ -571,17 +581,60 @@ const union mpsc_pbuf_generic *mpsc_pbuf_claim(struct mpsc_pbuf_buffer *buffer)
 	return item;
 }
 
-void mpsc_pbuf_free(struct mpsc_pbuf_buffer *buffer,
-		     const union mpsc_pbuf_generic *item)
+uint32_t mpsc_pbuf_claim_batch(struct mpsc_pbuf_buffer *buffer,
+			       const union mpsc_pbuf_generic **items,
+			       uint32_t max_cnt)
 {
-	uint32_t wlen = buffer->get_wlen(item);
+	union mpsc_pbuf_generic *item;
+	uint32_t cnt = 0;
+	uint32_t a;
 	k_spinlock_key_t key = k_spin_lock(&buffer->lock);
-	union mpsc_pbuf_generic *witem = (union mpsc_pbuf_generic *)item;
 
-	witem->hdr.valid = 0;
+	while (cnt < max_cnt) {
+		(void)available(buffer, &a);
+		item = (union mpsc_pbuf_generic *)
+			&buffer->buf[buffer->tmp_rd_idx];
+
+		if (!a || is_invalid(item)) {
+			break;
+		}
+
+		uint32_t skip = get_skip(item);
+
+		if (skip || !is_valid(item)) {
+			/* Skipped space can only be released as long as rd_idx
+			 * is not held back by an already claimed packet.
+			 */
+			if (cnt) {
+				break;
+			}
+
+			uint32_t inc = skip ? skip : buffer->get_wlen(item);
+
+			buffer->tmp_rd_idx = idx_inc(buffer, buffer->tmp_rd_idx, inc);
+			rd_idx_inc(buffer, inc);
+			continue;
+		}
+
+		item->hdr.busy = 1;
+		buffer->tmp_rd_idx = idx_inc(buffer, buffer->tmp_rd_idx,
+					     buffer->get_wlen(item));
+		items[cnt++] = item;
+	}
+
+	MPSC_PBUF_DBG(buffer, ">>claimed batch of %d", cnt);
+	k_spin_unlock(&buffer->lock, key);
+
+	return cnt;
+}
+
+static void free_locked(struct mpsc_pbuf_buffer *buffer,
+			union mpsc_pbuf_generic *item, uint32_t wlen)
+{
+	item->hdr.valid = 0;
 	if (!(buffer->flags & MPSC_PBUF_MODE_OVERWRITE) ||
 		 ((uint32_t *)item == &buffer->buf[buffer->rd_idx])) {
-		witem->hdr.busy = 0;
+		item->hdr.busy = 0;
 		if (buffer->rd_idx == buffer->tmp_rd_idx) {
 			/* There is a chance that there are so many new packets
 			 * added between claim and free that rd_idx points again
@@ -595,9 +648,65 @@ void mpsc_pbuf_free(struct mpsc_pbuf_buffer *buffer,
 		rd_idx_inc(buffer, wlen);
 	} else {
 		MPSC_PBUF_DBG(buffer, "Allocation occurred during claim");
-		witem->skip.len = wlen;
+		item->skip.len = wlen;
 	}
 	MPSC_PBUF_DBG(buffer, "<<freed: %p", item);
+}
+
+void mpsc_pbuf_free(struct mpsc_pbuf_buffer *buffer,
+		     const union mpsc_pbuf_generic *item)
+{
+	uint32_t wlen = buffer->get_wlen(item);
+	k_spinlock_key_t key = k_spin_lock(&buffer->lock);
+
+	free_locked(buffer, (union mpsc_pbuf_generic *)item, wlen);
+
+	k_spin_unlock(&buffer->lock, key);
+	k_sem_give(&buffer->sem);
+}
+
+void mpsc_pbuf_free_batch(struct mpsc_pbuf_buffer *buffer,
+			  const union mpsc_pbuf_generic **items,
+			  uint32_t cnt)
+{
+	uint32_t wlen = 0;
+	k_spinlock_key_t key;
+
+	if (cnt == 0) {
+		return;
+	}
+
+	for (uint32_t i = 0; i < cnt; i++) {
+		wlen += buffer->get_wlen(items[i]);
+	}
+
+	key = k_spin_lock(&buffer->lock);
+
+	if (!(buffer->flags & MPSC_PBUF_MODE_OVERWRITE) ||
+	    ((uint32_t *)items[0] == &buffer->buf[buffer->rd_idx])) {
+		/* Packets were not overrun by the writers, they still form
+		 * a contiguous area starting at rd_idx which is released at
+		 * once.
+		 */
+		for (uint32_t i = 0; i < cnt; i++) {
+			union mpsc_pbuf_generic *witem = (union mpsc_pbuf_generic *)items[i];
+
+			witem->hdr.valid = 0;
+			witem->hdr.busy = 0;
+		}
+
+		if (buffer->rd_idx == buffer->tmp_rd_idx) {
+			/* See free_locked(). */
+			buffer->tmp_rd_idx = idx_inc(buffer, buffer->tmp_rd_idx, wlen);
+		}
+		rd_idx_inc(buffer, wlen);
+		MPSC_PBUF_DBG(buffer, "<<freed batch of %d", cnt);
+	} else {
+		for (uint32_t i = 0; i < cnt; i++) {
+			free_locked(buffer, (union mpsc_pbuf_generic *)items[i],
+				    buffer->get_wlen(items[i]));
+		}
+	}
 
 	k_spin_unlock(&buffer->lock, key);
 	k_sem_give(&buffer->sem);
@@ -72,6 +72,151 @@ static inline bool item_lessthan(struct k_p4wq_work *a, struct k_p4wq_work *b)
 	return false;
 }
 
+#ifdef CONFIG_P4WQ_CPU_QUEUES
+/* No item queued, as priority is never this low */
+#define HEAD_NONE INT32_MAX
+
+static void cpu_queue_update_head(struct z_p4wq_cpu_queue *cq)
+{
+	struct rbnode *r = rb_get_max(&cq->queue);
+	struct k_p4wq_work *w;
+
+	if (r == NULL) {
+		atomic_set(&cq->head_prio, HEAD_NONE);
+		return;
+	}
+
+	w = CONTAINER_OF(r, struct k_p4wq_work, rbnode);
+	atomic_set(&cq->head_deadline, w->deadline);
+	atomic_set(&cq->head_prio, w->priority);
+}
+
+/* As rb_lessthan() on the first items of two CPU queues, but without
+ * their locks: the result is only a hint as they may change anytime.
+ */
+static bool cpu_queue_head_lessthan(struct z_p4wq_cpu_queue *a,
+				    struct z_p4wq_cpu_queue *b)
+{
+	int32_t a_prio = (int32_t)atomic_get(&a->head_prio);
+	int32_t b_prio = (int32_t)atomic_get(&b->head_prio);
+
+	if (a_prio != b_prio) {
+		return a_prio > b_prio;
+	}
+
+	if (a_prio == HEAD_NONE) {
+		return false;
+	}
+
+	return (int32_t)atomic_get(&a->head_deadline) -
+	       (int32_t)atomic_get(&b->head_deadline) > 0;
+}
+
+static bool cpu_queues_empty(struct k_p4wq *queue)
+{
+	unsigned int num_cpus = arch_num_cpus();
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		if (atomic_get(&queue->cpu_queues[i].head_prio) != HEAD_NONE) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/* Take the best item of all the CPU queues, stealing it from another CPU
+ * only when it's better than the best item of the current one.
+ */
+static struct k_p4wq_work *p4wq_take(struct k_p4wq *queue,
+				     struct z_p4wq_cpu_queue **cqp)
+{
+	unsigned int num_cpus = arch_num_cpus();
+	struct z_p4wq_cpu_queue *cq;
+	struct k_p4wq_work *w = NULL;
+	struct rbnode *r;
+	k_spinlock_key_t k;
+
+	while (w == NULL) {
+		/* The thread may move to another CPU anytime, it only
+		 * makes it look at another queue first
+		 */
+		cq = &queue->cpu_queues[arch_curr_cpu()->id];
+
+		for (unsigned int i = 0; i < num_cpus; i++) {
+			if (cpu_queue_head_lessthan(cq, &queue->cpu_queues[i])) {
+				cq = &queue->cpu_queues[i];
+			}
+		}
+
+		if (atomic_get(&cq->head_prio) == HEAD_NONE) {
+			return NULL;
+		}
+
+		k = k_spin_lock(&cq->lock);
+
+		/* Another thread may have taken the item already */
+		r = rb_get_max(&cq->queue);
+		if (r != NULL) {
+			w = CONTAINER_OF(r, struct k_p4wq_work, rbnode);
+
+			rb_remove(&cq->queue, r);
+			cpu_queue_update_head(cq);
+			w->thread = _current;
+			sys_dlist_append(&cq->active, &w->dlnode);
+			set_prio(_current, w);
+			thread_clear_requeued(_current);
+		}
+
+		k_spin_unlock(&cq->lock, k);
+	}
+
+	*cqp = cq;
+	return w;
+}
+
+static FUNC_NORETURN void p4wq_loop(void *p0, void *p1, void *p2)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	struct k_p4wq *queue = p0;
+	struct z_p4wq_cpu_queue *cq;
+	struct k_p4wq_work *w;
+	k_spinlock_key_t k;
+
+	while (true) {
+		w = p4wq_take(queue, &cq);
+		if (w != NULL) {
+			w->handler(w);
+
+			k = k_spin_lock(&cq->lock);
+
+			/* Remove from the active list only if it
+			 * wasn't resubmitted already
+			 */
+			if (!thread_was_requeued(_current)) {
+				sys_dlist_remove(&w->dlnode);
+				w->thread = NULL;
+				k_sem_give(&w->done_sem);
+			}
+
+			k_spin_unlock(&cq->lock, k);
+		} else {
+			k = k_spin_lock(&queue->lock);
+
+			/* Items are queued before the queue lock is taken
+			 * to wake a thread up, check again with it held
+			 */
+			if (cpu_queues_empty(queue)) {
+				z_pend_curr(&queue->lock, k, &queue->waitq,
+					    K_FOREVER);
+			} else {
+				k_spin_unlock(&queue->lock, k);
+			}
+		}
+	}
+}
+#else
 static FUNC_NORETURN void p4wq_loop(void *p0, void *p1, void *p2)
 {
 	ARG_UNUSED(p1);
@@ -112,6 +257,7 @@ static FUNC_NORETURN void p4wq_loop(void *p0, void *p1, void *p2)
 		}
 	}
 }
+#endif /* CONFIG_P4WQ_CPU_QUEUES */
 
 /* Must be called to regain ownership of the work item */
 int k_p4wq_wait(struct k_p4wq_work *work, k_timeout_t timeout)
@@ -127,8 +273,16 @@ void k_p4wq_init(struct k_p4wq *queue)
 {
 	memset(queue, 0, sizeof(*queue));
 	z_waitq_init(&queue->waitq);
+#ifdef CONFIG_P4WQ_CPU_QUEUES
+	for (size_t i = 0; i < ARRAY_SIZE(queue->cpu_queues); i++) {
+		queue->cpu_queues[i].queue.lessthan_fn = rb_lessthan;
+		sys_dlist_init(&queue->cpu_queues[i].active);
+		atomic_set(&queue->cpu_queues[i].head_prio, HEAD_NONE);
+	}
+#else
 	queue->queue.lessthan_fn = rb_lessthan;
 	sys_dlist_init(&queue->active);
+#endif
 }
 
 void k_p4wq_add_thread(struct k_p4wq *queue, struct k_thread *thread,
@@ -215,6 +369,127 @@ void k_p4wq_enable_static_thread(struct k_p4wq *queue, struct k_thread *thread,
  */
 SYS_INIT(static_init, APPLICATION, 99);
 
+#ifdef CONFIG_P4WQ_CPU_QUEUES
+/* Number of items in progress which the new item doesn't beat */
+static uint32_t p4wq_beaten_by(struct k_p4wq *queue, struct k_p4wq_work *item)
+{
+	unsigned int num_cpus = arch_num_cpus();
+	struct z_p4wq_cpu_queue *cq;
+	struct k_p4wq_work *wi;
+	uint32_t n_beaten_by = 0;
+	k_spinlock_key_t k;
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		cq = &queue->cpu_queues[i];
+		k = k_spin_lock(&cq->lock);
+
+		SYS_DLIST_FOR_EACH_CONTAINER(&cq->active, wi, dlnode) {
+			if (!item_lessthan(wi, item)) {
+				n_beaten_by++;
+			}
+		}
+
+		k_spin_unlock(&cq->lock, k);
+	}
+
+	return n_beaten_by;
+}
+
+void k_p4wq_submit(struct k_p4wq *queue, struct k_p4wq_work *item)
+{
+	/* Migrating right after reading the CPU is harmless, the item
+	 * is then only queued on another CPU
+	 */
+	struct z_p4wq_cpu_queue *cq = &queue->cpu_queues[arch_curr_cpu()->id];
+	struct k_thread *th;
+	k_spinlock_key_t k;
+	bool head;
+
+	/* Input is a delta time from now (to match
+	 * k_thread_deadline_set()), but we store and use the absolute
+	 * cycle count.
+	 */
+	item->deadline += k_cycle_get_32();
+
+	/* Resubmission from within handler?  Remove from active list */
+	if (item->thread == _current) {
+		k = k_spin_lock(&item->cpu_queue->lock);
+		sys_dlist_remove(&item->dlnode);
+		thread_set_requeued(_current);
+		item->thread = NULL;
+		k_spin_unlock(&item->cpu_queue->lock, k);
+	} else {
+		k_sem_init(&item->done_sem, 0, 1);
+	}
+	__ASSERT_NO_MSG(item->thread == NULL);
+
+	k = k_spin_lock(&cq->lock);
+
+	rb_insert(&cq->queue, &item->rbnode);
+	item->queue = queue;
+	item->cpu_queue = cq;
+
+	head = rb_get_max(&cq->queue) == &item->rbnode;
+	if (head) {
+		cpu_queue_update_head(cq);
+	}
+
+	k_spin_unlock(&cq->lock, k);
+
+	/* If there were other items already ahead of it in the queue,
+	 * a thread is already going to look for them, or they wait for
+	 * higher priority ones.
+	 */
+	if (!head) {
+		return;
+	}
+
+	/* As below, no preemption needed when at least as many higher
+	 * priority items than CPUs are in progress
+	 */
+	if (p4wq_beaten_by(queue, item) >= arch_num_cpus()) {
+		return;
+	}
+
+	k = k_spin_lock(&queue->lock);
+
+	th = z_unpend_first_thread(&queue->waitq);
+	if (th == NULL) {
+		LOG_WRN("Out of worker threads, priority guarantee violated");
+		k_spin_unlock(&queue->lock, k);
+		return;
+	}
+
+	set_prio(th, item);
+	z_ready_thread(th);
+	z_reschedule(&queue->lock, k);
+}
+
+bool k_p4wq_cancel(struct k_p4wq *queue, struct k_p4wq_work *item)
+{
+	struct z_p4wq_cpu_queue *cq = item->cpu_queue;
+	k_spinlock_key_t k;
+	bool ret;
+
+	/* Never submitted, or to another queue */
+	if ((cq < &queue->cpu_queues[0]) ||
+	    (cq >= &queue->cpu_queues[ARRAY_SIZE(queue->cpu_queues)])) {
+		return false;
+	}
+
+	k = k_spin_lock(&cq->lock);
+
+	ret = rb_contains(&cq->queue, &item->rbnode);
+	if (ret) {
+		rb_remove(&cq->queue, &item->rbnode);
+		cpu_queue_update_head(cq);
+		k_sem_give(&item->done_sem);
+	}
+
+	k_spin_unlock(&cq->lock, k);
+	return ret;
+}
+#else
 void k_p4wq_submit(struct k_p4wq *queue, struct k_p4wq_work *item)
 {
 	k_spinlock_key_t k = k_spin_lock(&queue->lock);
@@ -305,3 +580,4 @@ bool k_p4wq_cancel(struct k_p4wq *queue, struct k_p4wq_work *item)
 	k_spin_unlock(&queue->lock, k);
 	return ret;
 }
+#endif /* CONFIG_P4WQ_CPU_QUEUES */
@@ -0,0 +1,553 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <stdio.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/posix/aio.h>
+#include <zephyr/posix/unistd.h>
+#include <zephyr/rtio/rtio.h>
+#include <zephyr/sys/fdtable.h>
+
+/* Requests are submitted to the aio_rtio context for the aio_iodev
+ * device, whose threads perform them on the file descriptors. Requests
+ * are only tracked by the RTIO context and their aiocb once queued, so
+ * that only the I/O in progress takes one of the threads.
+ *
+ * The RTIO context and the state of the requests are protected by
+ * aio_lock, which is never held while performing I/O or notifying.
+ */
+
+struct aio_request {
+	/* NULL once canceled */
+	struct aiocb *aiocbp;
+	bool used;
+	bool started;
+};
+
+/* Requests of a lio_listio() call */
+struct aio_list {
+	int pending;
+	bool waited;
+	struct sigevent sig;
+};
+
+/* Notifications to send, once aio_lock is released */
+struct aio_notify {
+	int count;
+	struct sigevent sig[2];
+};
+
+static void aio_iodev_submit(struct rtio_iodev_sqe *iodev_sqe);
+
+static const struct rtio_iodev_api aio_iodev_api = {
+	.submit = aio_iodev_submit,
+};
+
+RTIO_IODEV_DEFINE(aio_iodev, &aio_iodev_api, NULL);
+RTIO_DEFINE(aio_rtio, CONFIG_POSIX_AIO_MAX, CONFIG_POSIX_AIO_MAX);
+
+static K_MUTEX_DEFINE(aio_lock);
+static K_CONDVAR_DEFINE(aio_done);
+static K_SEM_DEFINE(aio_sem, 0, K_SEM_MAX_LIMIT);
+
+static struct aio_request aio_requests[CONFIG_POSIX_AIO_MAX];
+
+K_MEM_SLAB_DEFINE_STATIC(aio_list_slab, sizeof(struct aio_list),
+			 CONFIG_POSIX_AIO_MAX, __alignof__(struct aio_list));
+
+static K_THREAD_STACK_ARRAY_DEFINE(aio_stacks, CONFIG_POSIX_AIO_THREADS,
+				   CONFIG_POSIX_AIO_THREAD_STACK_SIZE);
+static struct k_thread aio_threads[CONFIG_POSIX_AIO_THREADS];
+
+/* Submissions are only made with aio_lock held, see aio_thread() */
+static void aio_iodev_submit(struct rtio_iodev_sqe *iodev_sqe)
+{
+	rtio_mpsc_push(&aio_iodev.iodev_sq, &iodev_sqe->q);
+	k_sem_give(&aio_sem);
+}
+
+static void aio_notify_add(struct aio_notify *notify,
+			   const struct sigevent *sig)
+{
+	if (sig->sigev_notify == SIGEV_THREAD) {
+		notify->sig[notify->count++] = *sig;
+	}
+}
+
+static void aio_notify_send(struct aio_notify *notify)
+{
+	for (int i = 0; i < notify->count; i++) {
+		notify->sig[i].sigev_notify_function(notify->sig[i].sigev_value);
+	}
+
+	notify->count = 0;
+}
+
+/* Set the result of a request, which can't be accessed anymore once
+ * aio_lock is released
+ */
+static void aio_finish(struct aiocb *aiocbp, int result,
+		       struct aio_notify *notify)
+{
+	struct aio_list *list = aiocbp->_aio_list;
+
+	aio_notify_add(notify, &aiocbp->aio_sigevent);
+
+	if (result < 0) {
+		aiocbp->_aio_return = -1;
+		aiocbp->_aio_error = -result;
+	} else {
+		aiocbp->_aio_return = result;
+		aiocbp->_aio_error = 0;
+	}
+
+	if ((list != NULL) && (--list->pending == 0) && !list->waited) {
+		aio_notify_add(notify, &list->sig);
+		k_mem_slab_free(&aio_list_slab, list);
+	}
+
+	k_condvar_broadcast(&aio_done);
+}
+
+static ssize_t aio_perform(const struct rtio_sqe *sqe,
+			   const struct aiocb *aiocbp)
+{
+	const struct fd_op_vtable *vtable;
+	struct k_mutex *lock;
+	ssize_t ret;
+	void *obj;
+
+	obj = z_get_fd_obj_and_vtable(aiocbp->aio_fildes, &vtable, &lock);
+	if (obj == NULL) {
+		return -errno;
+	}
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+
+	/* Objects which can't seek, such as sockets, ignore the offset */
+	if (vtable->ioctl != NULL) {
+		(void)z_fdtable_call_ioctl(vtable, obj, ZFD_IOCTL_LSEEK,
+					   aiocbp->aio_offset, SEEK_SET);
+	}
+
+	if (sqe->op == RTIO_OP_RX) {
+		ret = vtable->read(obj, sqe->buf, sqe->buf_len);
+	} else {
+		ret = vtable->write(obj, sqe->buf, sqe->buf_len);
+	}
+
+	k_mutex_unlock(lock);
+
+	return (ret < 0) ? -errno : ret;
+}
+
+static void aio_thread(void *p1, void *p2, void *p3)
+{
+	struct rtio_iodev_sqe *iodev_sqe;
+	struct aio_request *req;
+	struct aio_notify notify = { 0 };
+	struct rtio_cqe *cqe;
+	ssize_t ret;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (;;) {
+		(void)k_sem_take(&aio_sem, K_FOREVER);
+
+		/* The queue of the iodev has a single consumer, and taking
+		 * the lock also makes sure no push is in progress
+		 */
+		(void)k_mutex_lock(&aio_lock, K_FOREVER);
+
+		iodev_sqe = CONTAINER_OF(rtio_mpsc_pop(&aio_iodev.iodev_sq),
+					 struct rtio_iodev_sqe, q);
+		req = iodev_sqe->sqe.userdata;
+		req->started = true;
+
+		if (req->aiocbp != NULL) {
+			k_mutex_unlock(&aio_lock);
+			ret = aio_perform(&iodev_sqe->sqe, req->aiocbp);
+			(void)k_mutex_lock(&aio_lock, K_FOREVER);
+		} else {
+			ret = -ECANCELED;
+		}
+
+		if (ret < 0) {
+			rtio_iodev_sqe_err(iodev_sqe, ret);
+		} else {
+			rtio_iodev_sqe_ok(iodev_sqe, ret);
+		}
+
+		while ((cqe = rtio_cqe_consume(&aio_rtio)) != NULL) {
+			req = cqe->userdata;
+
+			if (req->aiocbp != NULL) {
+				aio_finish(req->aiocbp, cqe->result, &notify);
+			}
+
+			req->used = false;
+			rtio_cqe_release(&aio_rtio, cqe);
+
+			if (notify.count > 0) {
+				k_mutex_unlock(&aio_lock);
+				aio_notify_send(&notify);
+				(void)k_mutex_lock(&aio_lock, K_FOREVER);
+			}
+		}
+
+		k_mutex_unlock(&aio_lock);
+	}
+}
+
+static int aio_check(const struct aiocb *aiocbp)
+{
+	const struct sigevent *sig = &aiocbp->aio_sigevent;
+
+	if ((aiocbp->aio_reqprio < 0) ||
+	    (aiocbp->aio_reqprio > AIO_PRIO_DELTA_MAX) ||
+	    (aiocbp->aio_offset < 0) || (aiocbp->aio_nbytes > UINT32_MAX)) {
+		return -EINVAL;
+	}
+
+	if (!((sig->sigev_notify == SIGEV_NONE) ||
+	      ((sig->sigev_notify == SIGEV_THREAD) &&
+	       (sig->sigev_notify_function != NULL)))) {
+		/* Signals are not supported */
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+/* Queue a request, submitted with rtio_submit() afterwards */
+static int aio_queue(struct aiocb *aiocbp, int opcode, struct aio_list *list)
+{
+	struct aio_request *req = NULL;
+	struct rtio_sqe *sqe;
+
+	for (size_t i = 0; i < ARRAY_SIZE(aio_requests); i++) {
+		if (!aio_requests[i].used) {
+			req = &aio_requests[i];
+			break;
+		}
+	}
+
+	if (req == NULL) {
+		return -EAGAIN;
+	}
+
+	/* Submission queue entries are released before the requests */
+	sqe = rtio_sqe_acquire(&aio_rtio);
+	__ASSERT_NO_MSG(sqe != NULL);
+
+	if (opcode == LIO_READ) {
+		rtio_sqe_prep_read(sqe, &aio_iodev, RTIO_PRIO_NORM,
+				   (uint8_t *)aiocbp->aio_buf,
+				   aiocbp->aio_nbytes, req);
+	} else {
+		rtio_sqe_prep_write(sqe, &aio_iodev, RTIO_PRIO_NORM,
+				    (uint8_t *)aiocbp->aio_buf,
+				    aiocbp->aio_nbytes, req);
+	}
+
+	req->aiocbp = aiocbp;
+	req->used = true;
+	req->started = false;
+
+	aiocbp->_aio_error = EINPROGRESS;
+	aiocbp->_aio_return = 0;
+	aiocbp->_aio_list = list;
+
+	return 0;
+}
+
+static int aio_submit(struct aiocb *aiocbp, int opcode)
+{
+	int ret;
+
+	if (aiocbp == NULL) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	ret = aio_check(aiocbp);
+	if (ret < 0) {
+		errno = -ret;
+		return -1;
+	}
+
+	(void)k_mutex_lock(&aio_lock, K_FOREVER);
+
+	ret = aio_queue(aiocbp, opcode, NULL);
+	if (ret == 0) {
+		(void)rtio_submit(&aio_rtio, 0);
+	}
+
+	k_mutex_unlock(&aio_lock);
+
+	if (ret < 0) {
+		errno = -ret;
+		return -1;
+	}
+
+	return 0;
+}
+
+int aio_read(struct aiocb *aiocbp)
+{
+	return aio_submit(aiocbp, LIO_READ);
+}
+
+int aio_write(struct aiocb *aiocbp)
+{
+	return aio_submit(aiocbp, LIO_WRITE);
+}
+
+int aio_error(const struct aiocb *aiocbp)
+{
+	int ret;
+
+	if (aiocbp == NULL) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	(void)k_mutex_lock(&aio_lock, K_FOREVER);
+	ret = aiocbp->_aio_error;
+	k_mutex_unlock(&aio_lock);
+
+	return ret;
+}
+
+ssize_t aio_return(struct aiocb *aiocbp)
+{
+	ssize_t ret;
+
+	if (aiocbp == NULL) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	(void)k_mutex_lock(&aio_lock, K_FOREVER);
+
+	if (aiocbp->_aio_error == EINPROGRESS) {
+		ret = -1;
+		errno = EINVAL;
+	} else {
+		ret = aiocbp->_aio_return;
+		if (ret < 0) {
+			errno = aiocbp->_aio_error;
+		}
+	}
+
+	k_mutex_unlock(&aio_lock);
+
+	return ret;
+}
+
+int aio_suspend(const struct aiocb *const list[], int nent,
+		const struct timespec *timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(K_FOREVER);
+	int ret = -1;
+
+	if ((list == NULL) || (nent <= 0) || (nent > AIO_LISTIO_MAX)) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if (timeout != NULL) {
+		end = sys_timepoint_calc(K_NSEC((int64_t)timeout->tv_sec * NSEC_PER_SEC +
+						timeout->tv_nsec));
+	}
+
+	(void)k_mutex_lock(&aio_lock, K_FOREVER);
+
+	while (ret < 0) {
+		for (int i = 0; i < nent; i++) {
+			if ((list[i] != NULL) &&
+			    (list[i]->_aio_error != EINPROGRESS)) {
+				ret = 0;
+			}
+		}
+
+		if ((ret < 0) &&
+		    (k_condvar_wait(&aio_done, &aio_lock,
+				    sys_timepoint_timeout(end)) != 0)) {
+			errno = EAGAIN;
+			break;
+		}
+	}
+
+	k_mutex_unlock(&aio_lock);
+
+	return ret;
+}
+
+int lio_listio(int mode, struct aiocb *const list[], int nent,
+	       struct sigevent *sig)
+{
+	struct aio_list wait_list = { .waited = true };
+	struct aio_list *lio = &wait_list;
+	bool queue_failed = false;
+	bool failed = false;
+
+	if (((mode != LIO_WAIT) && (mode != LIO_NOWAIT)) || (list == NULL) ||
+	    (nent <= 0) || (nent > AIO_LISTIO_MAX)) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	for (int i = 0; i < nent; i++) {
+		if ((list[i] == NULL) || (list[i]->aio_lio_opcode == LIO_NOP)) {
+			continue;
+		}
+
+		if (((list[i]->aio_lio_opcode != LIO_READ) &&
+		     (list[i]->aio_lio_opcode != LIO_WRITE)) ||
+		    (aio_check(list[i]) < 0)) {
+			errno = EINVAL;
+			return -1;
+		}
+	}
+
+	if (mode == LIO_NOWAIT) {
+		lio = NULL;
+
+		if ((sig != NULL) && (sig->sigev_notify == SIGEV_THREAD)) {
+			if (sig->sigev_notify_function == NULL) {
+				errno = EINVAL;
+				return -1;
+			}
+
+			if (k_mem_slab_alloc(&aio_list_slab, (void **)&lio,
+					     K_NO_WAIT) != 0) {
+				errno = EAGAIN;
+				return -1;
+			}
+
+			*lio = (struct aio_list){ .sig = *sig };
+		}
+	}
+
+	(void)k_mutex_lock(&aio_lock, K_FOREVER);
+
+	for (int i = 0; i < nent; i++) {
+		if ((list[i] == NULL) || (list[i]->aio_lio_opcode == LIO_NOP)) {
+			continue;
+		}
+
+		if (aio_queue(list[i], list[i]->aio_lio_opcode, lio) < 0) {
+			list[i]->_aio_error = EAGAIN;
+			list[i]->_aio_return = -1;
+			queue_failed = true;
+		} else if (lio != NULL) {
+			lio->pending++;
+		}
+	}
+
+	/* All the requests queued at once */
+	(void)rtio_submit(&aio_rtio, 0);
+
+	if ((lio != NULL) && !lio->waited && (lio->pending == 0)) {
+		/* Nothing queued to notify the completion of */
+		k_mem_slab_free(&aio_list_slab, lio);
+	}
+
+	if (mode == LIO_WAIT) {
+		while (wait_list.pending > 0) {
+			(void)k_condvar_wait(&aio_done, &aio_lock, K_FOREVER);
+		}
+
+		for (int i = 0; i < nent; i++) {
+			if ((list[i] != NULL) &&
+			    (list[i]->aio_lio_opcode != LIO_NOP) &&
+			    (list[i]->_aio_error != 0)) {
+				failed = true;
+			}
+		}
+	}
+
+	k_mutex_unlock(&aio_lock);
+
+	if (queue_failed) {
+		errno = EAGAIN;
+		return -1;
+	}
+
+	if (failed) {
+		errno = EIO;
+		return -1;
+	}
+
+	return 0;
+}
+
+int aio_cancel(int fildes, struct aiocb *aiocbp)
+{
+	struct aio_notify notify = { 0 };
+	struct aio_request *req;
+	bool not_canceled = false;
+	bool canceled = false;
+
+	if ((aiocbp != NULL) && (aiocbp->aio_fildes != fildes)) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	(void)k_mutex_lock(&aio_lock, K_FOREVER);
+
+	for (size_t i = 0; i < ARRAY_SIZE(aio_requests); i++) {
+		req = &aio_requests[i];
+
+		if (!req->used || (req->aiocbp == NULL) ||
+		    ((aiocbp != NULL) && (req->aiocbp != aiocbp)) ||
+		    (req->aiocbp->aio_fildes != fildes)) {
+			continue;
+		}
+
+		if (req->started) {
+			not_canceled = true;
+			continue;
+		}
+
+		/* The thread taking the request only releases it */
+		aio_finish(req->aiocbp, -ECANCELED, &notify);
+		req->aiocbp = NULL;
+		canceled = true;
+
+		k_mutex_unlock(&aio_lock);
+		aio_notify_send(&notify);
+		(void)k_mutex_lock(&aio_lock, K_FOREVER);
+	}
+
+	k_mutex_unlock(&aio_lock);
+
+	if (not_canceled) {
+		return AIO_NOTCANCELED;
+	}
+
+	return canceled ? AIO_CANCELED : AIO_ALLDONE;
+}
+
+static int aio_init(void)
+{
+	for (int i = 0; i < CONFIG_POSIX_AIO_THREADS; i++) {
+		k_thread_create(&aio_threads[i], aio_stacks[i],
+				K_THREAD_STACK_SIZEOF(aio_stacks[i]), aio_thread,
+				NULL, NULL, NULL,
+				CONFIG_POSIX_AIO_THREAD_PRIORITY, 0, K_NO_WAIT);
+		(void)k_thread_name_set(&aio_threads[i], "aio");
+	}
+
+	return 0;
+}
+
+SYS_INIT(aio_init, APPLICATION, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
@@ -13,11 +13,25 @@
 
 #define SIGEV_MASK (SIGEV_NONE | SIGEV_SIGNAL | SIGEV_THREAD)
 
+/*
+ * Messages are stored in blocks of a per-queue slab, and the blocks
+ * themselves are queued: a loaned buffer is the data of a block, so it can
+ * be sent and received without copying it.
+ */
+struct mqueue_msg {
+	void *fifo_reserved;
+	size_t len;
+	char data[];
+};
+
 typedef struct mqueue_object {
 	sys_snode_t snode;
 	char *mem_buffer;
 	char *mem_obj;
-	struct k_msgq queue;
+	struct k_mem_slab slab;
+	struct k_fifo queue;
+	atomic_t num_msgs;
+	size_t msg_size;
 	atomic_t ref_count;
 	char *name;
 	struct sigevent not;
@@ -40,6 +54,8 @@ static int32_t send_message(mqueue_desc *mqd, const char *msg_ptr, size_t msg_le
 			  k_timeout_t timeout);
 static int32_t receive_message(mqueue_desc *mqd, char *msg_ptr, size_t msg_len,
 			   k_timeout_t timeout);
+static int queue_message(mqueue_desc *mqd, struct mqueue_msg *msg);
+static struct mqueue_msg *dequeue_message(mqueue_desc *mqd, k_timeout_t timeout);
 static void remove_notification(mqueue_object *msg_queue);
 static void remove_mq(mqueue_object *msg_queue);
 static void *mq_notify_thread(void *arg);
@@ -58,6 +74,7 @@ mqd_t mq_open(const char *name, int oflags, ...)
 	mode_t mode;
 	struct mq_attr *attrs = NULL;
 	long msg_size = 0U, max_msgs = 0U;
+	size_t block_size;
 	mqueue_object *msg_queue;
 	mqueue_desc *msg_queue_desc = NULL, *mqd = (mqueue_desc *)(-1);
 	char *mq_desc_ptr, *mq_obj_ptr, *mq_buf_ptr, *mq_name_ptr;
@@ -143,19 +160,21 @@ mqd_t mq_open(const char *name, int oflags, ...)
 
 		strcpy(msg_queue->name, name);
 
-		mq_buf_ptr = k_malloc(msg_size * max_msgs * sizeof(uint8_t));
+		block_size = WB_UP(sizeof(struct mqueue_msg) + msg_size);
+		mq_buf_ptr = k_malloc(block_size * max_msgs);
 		if (mq_buf_ptr != NULL) {
-			(void)memset(mq_buf_ptr, 0,
-				     msg_size * max_msgs * sizeof(uint8_t));
+			(void)memset(mq_buf_ptr, 0, block_size * max_msgs);
 			msg_queue->mem_buffer = mq_buf_ptr;
 		} else {
 			goto free_mq_buffer;
 		}
 
 		(void)atomic_set(&msg_queue->ref_count, 1);
-		/* initialize zephyr message queue */
-		k_msgq_init(&msg_queue->queue, msg_queue->mem_buffer, msg_size,
-			    max_msgs);
+		/* initialize message storage and queue */
+		(void)k_mem_slab_init(&msg_queue->slab, msg_queue->mem_buffer,
+				      block_size, max_msgs);
+		k_fifo_init(&msg_queue->queue);
+		msg_queue->msg_size = msg_size;
 		k_sem_take(&mq_sem, K_FOREVER);
 		sys_slist_append(&mq_list, (sys_snode_t *)&(msg_queue->snode));
 		k_sem_give(&mq_sem);
@@ -291,6 +310,147 @@ int mq_timedreceive(mqd_t mqdes, char *msg_ptr, size_t msg_len,
 	return receive_message(mqd, msg_ptr, msg_len, K_MSEC(timeout));
 }
 
+static k_timeout_t mq_timeout(mqueue_desc *mqd, const struct timespec *abstime)
+{
+	if ((mqd->flags & O_NONBLOCK) != 0U) {
+		return K_NO_WAIT;
+	}
+
+	if (abstime == NULL) {
+		return K_FOREVER;
+	}
+
+	return K_MSEC((int32_t)timespec_to_timeoutms(abstime));
+}
+
+/* Get the message of a loaned buffer, or NULL if it isn't one */
+static struct mqueue_msg *loaned_message(mqueue_desc *mqd, char *msg_ptr)
+{
+	struct k_mem_slab *slab = &mqd->mqueue->slab;
+	char *block = msg_ptr - offsetof(struct mqueue_msg, data);
+	size_t offset = block - slab->buffer;
+
+	if ((msg_ptr == NULL) || (block < slab->buffer) ||
+	    (offset >= slab->info.block_size * slab->info.num_blocks) ||
+	    ((offset % slab->info.block_size) != 0)) {
+		return NULL;
+	}
+
+	return (struct mqueue_msg *)block;
+}
+
+/**
+ * @brief Loan a message buffer from a message queue.
+ *
+ * Zephyr extension, see mqueue.h.
+ */
+int mq_loan_np(mqd_t mqdes, char **msg_ptr, const struct timespec *abstime)
+{
+	mqueue_desc *mqd = (mqueue_desc *)mqdes;
+	k_timeout_t timeout;
+	void *block;
+
+	if (mqd == NULL) {
+		errno = EBADF;
+		return -1;
+	}
+
+	timeout = mq_timeout(mqd, abstime);
+	if (k_mem_slab_alloc(&mqd->mqueue->slab, &block, timeout) != 0) {
+		errno = K_TIMEOUT_EQ(timeout, K_NO_WAIT) ? EAGAIN : ETIMEDOUT;
+		return -1;
+	}
+
+	*msg_ptr = ((struct mqueue_msg *)block)->data;
+	return 0;
+}
+
+/**
+ * @brief Send a loaned message buffer to a message queue.
+ *
+ * Zephyr extension, see mqueue.h.
+ */
+int mq_send_loaned_np(mqd_t mqdes, char *msg_ptr, size_t msg_len,
+		      unsigned int msg_prio)
+{
+	mqueue_desc *mqd = (mqueue_desc *)mqdes;
+	struct mqueue_msg *msg;
+
+	if (mqd == NULL) {
+		errno = EBADF;
+		return -1;
+	}
+
+	msg = loaned_message(mqd, msg_ptr);
+	if (msg == NULL) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if (msg_len > mqd->mqueue->msg_size) {
+		errno = EMSGSIZE;
+		return -1;
+	}
+
+	msg->len = msg_len;
+	return queue_message(mqd, msg);
+}
+
+/**
+ * @brief Receive a message from a message queue without copying it.
+ *
+ * Zephyr extension, see mqueue.h.
+ */
+ssize_t mq_timedreceive_loaned_np(mqd_t mqdes, char **msg_ptr,
+				  unsigned int *msg_prio,
+				  const struct timespec *abstime)
+{
+	mqueue_desc *mqd = (mqueue_desc *)mqdes;
+	struct mqueue_msg *msg;
+
+	if (mqd == NULL) {
+		errno = EBADF;
+		return -1;
+	}
+
+	msg = dequeue_message(mqd, mq_timeout(mqd, abstime));
+	if (msg == NULL) {
+		return -1;
+	}
+
+	if (msg_prio != NULL) {
+		*msg_prio = 0;
+	}
+
+	*msg_ptr = msg->data;
+	return msg->len;
+}
+
+/**
+ * @brief Return a loaned message buffer to its message queue.
+ *
+ * Zephyr extension, see mqueue.h.
+ */
+int mq_return_np(mqd_t mqdes, char *msg_ptr)
+{
+	mqueue_desc *mqd = (mqueue_desc *)mqdes;
+	struct mqueue_msg *msg;
+
+	if (mqd == NULL) {
+		errno = EBADF;
+		return -1;
+	}
+
+	msg = loaned_message(mqd, msg_ptr);
+	if (msg == NULL) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	k_mem_slab_free(&mqd->mqueue->slab, msg);
+	return 0;
+}
+
 /**
  * @brief Get message queue attributes.
  *
@@ -299,7 +459,6 @@ int mq_timedreceive(mqd_t mqdes, char *msg_ptr, size_t msg_len,
 int mq_getattr(mqd_t mqdes, struct mq_attr *mqstat)
 {
 	mqueue_desc *mqd = (mqueue_desc *)mqdes;
-	struct k_msgq_attrs attrs;
 
 	if (mqd == NULL) {
 		errno = EBADF;
@@ -307,11 +466,10 @@ int mq_getattr(mqd_t mqdes, struct mq_attr *mqstat)
 	}
 
 	k_sem_take(&mq_sem, K_FOREVER);
-	k_msgq_get_attrs(&mqd->mqueue->queue, &attrs);
 	mqstat->mq_flags = mqd->flags;
-	mqstat->mq_maxmsg = attrs.max_msgs;
-	mqstat->mq_msgsize = attrs.msg_size;
-	mqstat->mq_curmsgs = attrs.used_msgs;
+	mqstat->mq_maxmsg = mqd->mqueue->slab.info.num_blocks;
+	mqstat->mq_msgsize = mqd->mqueue->msg_size;
+	mqstat->mq_curmsgs = atomic_get(&mqd->mqueue->num_msgs);
 	k_sem_give(&mq_sem);
 	return 0;
 }
@@ -435,10 +593,51 @@ static mqueue_object *find_in_list(const char *name)
 	return NULL;
 }
 
+static int queue_message(mqueue_desc *mqd, struct mqueue_msg *msg)
+{
+	/* The message is counted before it can be received */
+	bool was_empty = atomic_inc(&mqd->mqueue->num_msgs) == 0;
+
+	k_fifo_put(&mqd->mqueue->queue, msg);
+
+	if (was_empty) {
+		struct sigevent *sevp = &mqd->mqueue->not;
+
+		if (sevp->sigev_notify == SIGEV_NONE) {
+			sevp->sigev_notify_function(sevp->sigev_value);
+		} else if (sevp->sigev_notify == SIGEV_THREAD) {
+			pthread_t th;
+
+			(void)pthread_create(&th,
+					     sevp->sigev_notify_attributes,
+					     mq_notify_thread,
+					     mqd->mqueue);
+		}
+	}
+
+	return 0;
+}
+
+static struct mqueue_msg *dequeue_message(mqueue_desc *mqd, k_timeout_t timeout)
+{
+	struct mqueue_msg *msg;
+
+	msg = k_fifo_get(&mqd->mqueue->queue, timeout);
+	if (msg == NULL) {
+		errno = K_TIMEOUT_EQ(timeout, K_NO_WAIT) ? EAGAIN : ETIMEDOUT;
+		return NULL;
+	}
+
+	(void)atomic_dec(&mqd->mqueue->num_msgs);
+
+	return msg;
+}
+
 static int32_t send_message(mqueue_desc *mqd, const char *msg_ptr, size_t msg_len,
 			  k_timeout_t timeout)
 {
 	int32_t ret = -1;
+	struct mqueue_msg *msg;
 
 	if (mqd == NULL) {
 		errno = EBADF;
@@ -449,47 +648,34 @@ static int32_t send_message(mqueue_desc *mqd, const char *msg_ptr, size_t msg_le
 		timeout = K_NO_WAIT;
 	}
 
-	if (msg_len >  mqd->mqueue->queue.msg_size) {
+	if (msg_len >  mqd->mqueue->msg_size) {
 		errno = EMSGSIZE;
 		return ret;
 	}
 
-	uint32_t msgq_num = k_msgq_num_used_get(&mqd->mqueue->queue);
-
-	if (k_msgq_put(&mqd->mqueue->queue, (void *)msg_ptr, timeout) != 0) {
+	if (k_mem_slab_alloc(&mqd->mqueue->slab, (void **)&msg, timeout) != 0) {
 		errno = K_TIMEOUT_EQ(timeout, K_NO_WAIT) ? EAGAIN : ETIMEDOUT;
 		return ret;
 	}
 
-	if (k_msgq_num_used_get(&mqd->mqueue->queue) - msgq_num > 0) {
-		struct sigevent *sevp = &mqd->mqueue->not;
-
-		if (sevp->sigev_notify == SIGEV_NONE) {
-			sevp->sigev_notify_function(sevp->sigev_value);
-		} else if (sevp->sigev_notify == SIGEV_THREAD) {
-			pthread_t th;
-
-			ret = pthread_create(&th,
-					     sevp->sigev_notify_attributes,
-					     mq_notify_thread,
-					     mqd->mqueue);
-		}
-	}
+	(void)memcpy(msg->data, msg_ptr, msg_len);
+	msg->len = msg_len;
 
-	return 0;
+	return queue_message(mqd, msg);
 }
 
 static int32_t receive_message(mqueue_desc *mqd, char *msg_ptr, size_t msg_len,
 			     k_timeout_t timeout)
 {
 	int ret = -1;
+	struct mqueue_msg *msg;
 
 	if (mqd == NULL) {
 		errno = EBADF;
 		return ret;
 	}
 
-	if (msg_len < mqd->mqueue->queue.msg_size) {
+	if (msg_len < mqd->mqueue->msg_size) {
 		errno = EMSGSIZE;
 		return ret;
 	}
@@ -498,10 +684,11 @@ static int32_t receive_message(mqueue_desc *mqd, char *msg_ptr, size_t msg_len,
 		timeout = K_NO_WAIT;
 	}
 
-	if (k_msgq_get(&mqd->mqueue->queue, (void *)msg_ptr, timeout) != 0) {
-		errno = K_TIMEOUT_EQ(timeout, K_NO_WAIT) ? EAGAIN : ETIMEDOUT;
-	} else {
-		ret = mqd->mqueue->queue.msg_size;
+	msg = dequeue_message(mqd, timeout);
+	if (msg != NULL) {
+		(void)memcpy(msg_ptr, msg->data, msg->len);
+		ret = msg->len;
+		k_mem_slab_free(&mqd->mqueue->slab, msg);
 	}
 
 	return ret;
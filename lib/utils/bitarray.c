@@ -210,6 +210,78 @@ static void set_region(sys_bitarray_t *bitarray, size_t offset,
 	}
 }
 
+/*
+ * Find the first region of cleared bits large enough.
+ *
+ * Bundles are looked at as a whole, keeping track of the cleared bits
+ * at the end of the previous ones: a region either spans bundles, and
+ * is made of these bits, some entirely cleared bundles and the cleared
+ * bits at the start of the next one, or lies within a single bundle.
+ *
+ * @param[in]  bitarray Bitarray struct
+ * @param[in]  num_bits Number of bits in the region
+ * @param[out] offset   Starting bit location of the region found
+ *
+ * @retval     true     If a region is found
+ * @retval     false    If there is no region large enough
+ */
+static bool find_cleared_region(sys_bitarray_t *bitarray, size_t num_bits,
+				size_t *offset)
+{
+	size_t run = 0;
+	size_t idx, bundle_off, len, shift;
+	uint32_t bundle, cleared;
+
+	for (idx = 0; idx < bitarray->num_bundles; idx++) {
+		bundle = bitarray->bundles[idx];
+		bundle_off = idx * bundle_bitness(bitarray);
+
+		if ((bitarray->num_bits - bundle_off) < bundle_bitness(bitarray)) {
+			/* Bits past the end of the bitarray can't be allocated */
+			bundle |= ~(uint32_t)(BIT(bitarray->num_bits - bundle_off) - 1);
+		}
+
+		if (bundle == 0U) {
+			run += bundle_bitness(bitarray);
+			if (run >= num_bits) {
+				*offset = bundle_off + bundle_bitness(bitarray) - run;
+				return true;
+			}
+
+			continue;
+		}
+
+		/* Region continuing into the cleared bits at the start of
+		 * this bundle
+		 */
+		if ((run + find_lsb_set(bundle) - 1) >= num_bits) {
+			*offset = bundle_off - run;
+			return true;
+		}
+
+		/* Region within this bundle: fold the cleared bits so that
+		 * bit n remains set only if bits n to n + num_bits - 1 are
+		 * all cleared.
+		 */
+		if (num_bits < bundle_bitness(bitarray)) {
+			cleared = ~bundle;
+			for (len = 1; (len < num_bits) && (cleared != 0U); len += shift) {
+				shift = MIN(len, num_bits - len);
+				cleared &= cleared >> shift;
+			}
+
+			if (cleared != 0U) {
+				*offset = bundle_off + find_lsb_set(cleared) - 1;
+				return true;
+			}
+		}
+
+		run = bundle_bitness(bitarray) - find_msb_set(bundle);
+	}
+
+	return false;
+}
+
 int sys_bitarray_set_bit(sys_bitarray_t *bitarray, size_t bit)
 {
 	k_spinlock_key_t key;
@@ -385,11 +457,7 @@ int sys_bitarray_alloc(sys_bitarray_t *bitarray, size_t num_bits,
 		       size_t *offset)
 {
 	k_spinlock_key_t key;
-	uint32_t bit_idx;
 	int ret;
-	struct bundle_data bd;
-	size_t off_start, off_end;
-	size_t mismatch;
 
 	__ASSERT_NO_MSG(bitarray != NULL);
 	__ASSERT_NO_MSG(bitarray->num_bits > 0);
@@ -406,46 +474,11 @@ int sys_bitarray_alloc(sys_bitarray_t *bitarray, size_t num_bits,
 		goto out;
 	}
 
-	bit_idx = 0;
-
-	/* Find the first non-allocated bit by looking at bundles
-	 * instead of individual bits.
-	 *
-	 * On RISC-V 64-bit, it complains about undefined reference to `ffs`.
-	 * So don't use this on RISCV64.
-	 */
-	for (size_t idx = 0; idx < bitarray->num_bundles; idx++) {
-		if (~bitarray->bundles[idx] == 0U) {
-			/* bundle is all 1s => all allocated, skip */
-			bit_idx += bundle_bitness(bitarray);
-			continue;
-		}
-
-		if (bitarray->bundles[idx] != 0U) {
-			/* Find the first free bit in bundle if not all free */
-			off_start = find_lsb_set(~bitarray->bundles[idx]) - 1;
-			bit_idx += off_start;
-		}
-
-		break;
-	}
-
-	off_end = bitarray->num_bits - num_bits;
-	ret = -ENOSPC;
-	while (bit_idx <= off_end) {
-		if (match_region(bitarray, bit_idx, num_bits, false,
-				 &bd, &mismatch)) {
-			set_region(bitarray, bit_idx, num_bits, true, &bd);
-
-			*offset = bit_idx;
-			ret = 0;
-			break;
-		}
-
-		/* Fast-forward to the bit just after
-		 * the mismatched bit.
-		 */
-		bit_idx = mismatch + 1;
+	if (find_cleared_region(bitarray, num_bits, offset)) {
+		set_region(bitarray, *offset, num_bits, true, NULL);
+		ret = 0;
+	} else {
+		ret = -ENOSPC;
 	}
 
 out:
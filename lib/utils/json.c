@@ -17,6 +17,10 @@
 
 #include <zephyr/data/json.h>
 
+#ifdef CONFIG_NET_BUF
+#include <zephyr/net/buf.h>
+#endif
+
 struct json_obj_key_value {
 	const char *key;
 	size_t key_len;
@@ -779,6 +783,622 @@ int json_arr_separate_parse_object(struct json_obj *json, const struct json_obj_
 	return obj_parse(json, descr, descr_len, val);
 }
 
+#ifdef CONFIG_JSON_STREAM_PARSER
+
+/* States of an object or array frame, telling what comes next */
+enum {
+	STREAM_OBJ_KEY_OR_END,
+	STREAM_OBJ_KEY,
+	STREAM_OBJ_COLON,
+	STREAM_OBJ_VALUE,
+	STREAM_OBJ_COMMA_OR_END,
+	STREAM_ARR_VALUE_OR_END,
+	STREAM_ARR_VALUE,
+	STREAM_ARR_COMMA_OR_END,
+};
+
+/* Token being lexed */
+enum {
+	STREAM_LEX_NONE,
+	STREAM_LEX_STRING,
+	STREAM_LEX_NUMBER,
+	STREAM_LEX_LITERAL,
+	/* Object or array of an unknown field */
+	STREAM_LEX_SKIP,
+	/* Raw array data of a JSON_TOK_OBJ_ARRAY field */
+	STREAM_LEX_RAW,
+};
+
+/* What is done with the characters of the token being lexed */
+enum {
+	STREAM_STORE_NONE,
+	STREAM_STORE_KEY,
+	STREAM_STORE_VALUE,
+};
+
+/* Longest key which can match a descriptor, see struct json_obj_descr */
+#define STREAM_KEY_MAX_LEN 127
+
+static int stream_put(struct json_stream_parser *parser, char chr)
+{
+	if (parser->buf_used >= parser->buf_size) {
+		return -ENOMEM;
+	}
+
+	parser->buf[parser->buf_used++] = chr;
+
+	return 0;
+}
+
+static void stream_token_start(struct json_stream_parser *parser, uint8_t lex,
+			       uint8_t store)
+{
+	parser->lex = lex;
+	parser->store = store;
+	parser->tok_start = parser->buf_used;
+}
+
+static int stream_push(struct json_stream_parser *parser,
+		       const struct json_obj_descr *descr, void *val,
+		       uint8_t state)
+{
+	struct json_stream_frame *frame;
+
+	if ((size_t)parser->depth >= ARRAY_SIZE(parser->stack)) {
+		return -E2BIG;
+	}
+
+	frame = &parser->stack[parser->depth++];
+	frame->descr = descr;
+	frame->val = val;
+	frame->state = state;
+
+	return 0;
+}
+
+static int stream_push_object(struct json_stream_parser *parser,
+			      const struct json_obj_descr *descr,
+			      size_t descr_len, void *val)
+{
+	struct json_stream_frame *frame;
+	int ret;
+
+	ret = stream_push(parser, descr, val, STREAM_OBJ_KEY_OR_END);
+	if (ret < 0) {
+		return ret;
+	}
+
+	frame = &parser->stack[parser->depth - 1];
+	frame->object.descr_len = descr_len;
+	frame->object.decoded = 0;
+	frame->object.key = -1;
+
+	return 0;
+}
+
+/* Same as the first part of arr_parse() */
+static int stream_push_array(struct json_stream_parser *parser,
+			     const struct json_obj_descr *elem_descr,
+			     size_t max_elements, void *field, void *val)
+{
+	struct json_stream_frame *frame;
+	size_t *elements = (size_t *)((char *)val + elem_descr->offset);
+	ptrdiff_t elem_size;
+	int ret;
+
+	/* For nested arrays, skip parent descriptor to get elements */
+	if (elem_descr->type == JSON_TOK_ARRAY_START) {
+		elem_descr = elem_descr->array.element_descr;
+	}
+
+	elem_size = get_elem_size(elem_descr);
+	__ASSERT_NO_MSG(elem_size > 0);
+
+	ret = stream_push(parser, elem_descr, val, STREAM_ARR_VALUE_OR_END);
+	if (ret < 0) {
+		return ret;
+	}
+
+	frame = &parser->stack[parser->depth - 1];
+	frame->array.field = field;
+	frame->array.last = (char *)field + elem_size * max_elements;
+	frame->array.elements = elements;
+	*elements = 0;
+
+	return 0;
+}
+
+static void stream_pop(struct json_stream_parser *parser)
+{
+	parser->depth--;
+
+	if (parser->depth == 0) {
+		parser->result = parser->stack[0].object.decoded;
+	}
+}
+
+static void stream_key_lookup(struct json_stream_parser *parser)
+{
+	struct json_stream_frame *frame = &parser->stack[parser->depth - 1];
+	const char *key = &parser->buf[parser->tok_start];
+	size_t key_len = parser->buf_used - parser->tok_start;
+
+	for (size_t i = 0; i < frame->object.descr_len; i++) {
+		const struct json_obj_descr *descr = &frame->descr[i];
+
+		/* Field has been decoded already, skip */
+		if (frame->object.decoded & ((int64_t)1 << i)) {
+			continue;
+		}
+
+		if (key_len == descr->field_name_len &&
+		    !memcmp(key, descr->field_name, key_len)) {
+			frame->object.key = i;
+			break;
+		}
+	}
+
+	parser->buf_used = parser->tok_start;
+}
+
+static int stream_string_end(struct json_stream_parser *parser)
+{
+	const struct json_obj_descr *descr = parser->value_descr;
+	int ret;
+
+	switch (parser->store) {
+	case STREAM_STORE_KEY:
+		stream_key_lookup(parser);
+		return 0;
+	case STREAM_STORE_VALUE:
+		break;
+	default:
+		return 0;
+	}
+
+	if (descr->type == JSON_TOK_OPAQUE) {
+		struct json_obj_token *obj_token = parser->field;
+
+		obj_token->start = &parser->buf[parser->tok_start];
+		obj_token->length = parser->buf_used - parser->tok_start;
+
+		return 0;
+	}
+
+	ret = stream_put(parser, '\0');
+	if (ret < 0) {
+		return ret;
+	}
+
+	*(char **)parser->field = &parser->buf[parser->tok_start];
+
+	return 0;
+}
+
+static int stream_string(struct json_stream_parser *parser, char chr)
+{
+	if (chr == '\0') {
+		return -EINVAL;
+	}
+
+	if (parser->hex > 0) {
+		if (isxdigit((unsigned char)chr) == 0) {
+			return -EINVAL;
+		}
+
+		parser->hex--;
+	} else if (parser->esc) {
+		parser->esc = false;
+
+		if (chr == 'u') {
+			parser->hex = 4;
+		} else if (strchr("\"\\/bfnrt", chr) == NULL) {
+			return -EINVAL;
+		}
+	} else if (chr == '\\') {
+		parser->esc = true;
+	} else if (chr == '"') {
+		parser->lex = STREAM_LEX_NONE;
+
+		return stream_string_end(parser);
+	}
+
+	if (parser->store == STREAM_STORE_KEY &&
+	    parser->buf_used - parser->tok_start >= STREAM_KEY_MAX_LEN) {
+		/* Can't match any field, no need to store it */
+		parser->store = STREAM_STORE_NONE;
+		parser->buf_used = parser->tok_start;
+	}
+
+	if (parser->store != STREAM_STORE_NONE) {
+		return stream_put(parser, chr);
+	}
+
+	return 0;
+}
+
+static int stream_number_end(struct json_stream_parser *parser)
+{
+	const struct json_obj_descr *descr = parser->value_descr;
+	char *start = &parser->buf[parser->tok_start];
+	char *endptr;
+	int ret;
+
+	if (parser->store == STREAM_STORE_NONE) {
+		return 0;
+	}
+
+	if (descr->type == JSON_TOK_FLOAT) {
+		struct json_obj_token *obj_token = parser->field;
+
+		obj_token->start = start;
+		obj_token->length = parser->buf_used - parser->tok_start;
+
+		return 0;
+	}
+
+	ret = stream_put(parser, '\0');
+	if (ret < 0) {
+		return ret;
+	}
+
+	/* Number is not needed past this point */
+	parser->buf_used = parser->tok_start;
+
+	errno = 0;
+	*(int32_t *)parser->field = strtol(start, &endptr, 10);
+
+	if (errno != 0) {
+		return -errno;
+	}
+
+	if (*endptr != '\0') {
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+/* Returns 1 if the character ending the number has to be processed again */
+static int stream_number(struct json_stream_parser *parser, char chr)
+{
+	int ret;
+
+	if (isdigit((unsigned char)chr) != 0 || chr == '.') {
+		if (parser->store == STREAM_STORE_NONE) {
+			return 0;
+		}
+
+		return stream_put(parser, chr);
+	}
+
+	parser->lex = STREAM_LEX_NONE;
+
+	ret = stream_number_end(parser);
+	if (ret < 0) {
+		return ret;
+	}
+
+	return 1;
+}
+
+static int stream_literal(struct json_stream_parser *parser, char chr)
+{
+	if (*parser->literal != chr) {
+		return -EINVAL;
+	}
+
+	parser->literal++;
+	if (*parser->literal != '\0') {
+		return 0;
+	}
+
+	parser->lex = STREAM_LEX_NONE;
+
+	return 0;
+}
+
+static int stream_nested(struct json_stream_parser *parser, char chr)
+{
+	if (parser->lex == STREAM_LEX_RAW) {
+		int ret = stream_put(parser, chr);
+
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	if (parser->in_str) {
+		if (parser->esc) {
+			parser->esc = false;
+		} else if (chr == '\\') {
+			parser->esc = true;
+		} else if (chr == '"') {
+			parser->in_str = false;
+		}
+
+		return 0;
+	}
+
+	switch (chr) {
+	case '"':
+		parser->in_str = true;
+		break;
+	case '{':
+	case '[':
+		parser->nest++;
+		break;
+	case '}':
+	case ']':
+		parser->nest--;
+		break;
+	default:
+		break;
+	}
+
+	if (parser->nest == 0) {
+		if (parser->lex == STREAM_LEX_RAW) {
+			struct json_obj_token *obj_token = parser->field;
+
+			obj_token->start = &parser->buf[parser->tok_start];
+			obj_token->length = parser->buf_used - parser->tok_start;
+		}
+
+		parser->lex = STREAM_LEX_NONE;
+	}
+
+	return 0;
+}
+
+static enum json_tokens stream_value_type(char chr)
+{
+	switch (chr) {
+	case '{':
+	case '[':
+	case '"':
+	case 't':
+	case 'f':
+	case 'n':
+		return (enum json_tokens)chr;
+	default:
+		if (chr == '-' || isdigit((unsigned char)chr) != 0) {
+			return JSON_TOK_NUMBER;
+		}
+
+		return JSON_TOK_ERROR;
+	}
+}
+
+static int stream_value_start(struct json_stream_parser *parser,
+			      struct json_stream_frame *frame, char chr)
+{
+	enum json_tokens type = stream_value_type(chr);
+	const struct json_obj_descr *descr = NULL;
+	uint8_t store = STREAM_STORE_NONE;
+	void *field = NULL;
+	void *val = frame->val;
+
+	if (element_token(type) < 0) {
+		return -EINVAL;
+	}
+
+	/* Frame state was already moved past the value */
+	if (frame->state == STREAM_OBJ_COMMA_OR_END) {
+		if (frame->object.key >= 0) {
+			descr = &frame->descr[frame->object.key];
+			field = (char *)val + descr->offset;
+			frame->object.decoded |= (int64_t)1 << frame->object.key;
+		}
+	} else {
+		if (frame->array.field == frame->array.last) {
+			return -ENOSPC;
+		}
+
+		descr = frame->descr;
+		field = frame->array.field;
+		frame->array.field += get_elem_size(descr);
+		(*frame->array.elements)++;
+
+		/* For nested arrays, update value to current field,
+		 * so it matches descriptor's offset to length field
+		 */
+		if (descr->type == JSON_TOK_ARRAY_START) {
+			val = field;
+		}
+	}
+
+	if (descr != NULL) {
+		if (!equivalent_types(type, descr->type)) {
+			return -EINVAL;
+		}
+
+		switch (descr->type) {
+		case JSON_TOK_OBJECT_START:
+			return stream_push_object(parser, descr->object.sub_descr,
+						  descr->object.sub_descr_len,
+						  field);
+		case JSON_TOK_ARRAY_START:
+			return stream_push_array(parser, descr->array.element_descr,
+						 descr->array.n_elements, field,
+						 val);
+		default:
+			break;
+		}
+
+		parser->value_descr = descr;
+		parser->field = field;
+		store = STREAM_STORE_VALUE;
+	}
+
+	switch (type) {
+	case JSON_TOK_OBJECT_START:
+	case JSON_TOK_ARRAY_START:
+		stream_token_start(parser, store == STREAM_STORE_VALUE ?
+				   STREAM_LEX_RAW : STREAM_LEX_SKIP, store);
+		parser->nest = 0;
+		parser->in_str = false;
+		parser->esc = false;
+		return stream_nested(parser, chr);
+	case JSON_TOK_STRING:
+		stream_token_start(parser, STREAM_LEX_STRING, store);
+		parser->esc = false;
+		parser->hex = 0;
+		return 0;
+	case JSON_TOK_NUMBER:
+		stream_token_start(parser, STREAM_LEX_NUMBER, store);
+		if (store == STREAM_STORE_NONE) {
+			return 0;
+		}
+		return stream_put(parser, chr);
+	default:
+		if (store == STREAM_STORE_VALUE) {
+			*(bool *)field = (type == JSON_TOK_TRUE);
+		}
+
+		stream_token_start(parser, STREAM_LEX_LITERAL, store);
+		parser->literal = (type == JSON_TOK_TRUE) ? "true" : "false";
+		return stream_literal(parser, chr);
+	}
+}
+
+/* Returns 1 if the character has to be processed again */
+static int stream_char(struct json_stream_parser *parser, char chr)
+{
+	struct json_stream_frame *frame;
+
+	switch (parser->lex) {
+	case STREAM_LEX_STRING:
+		return stream_string(parser, chr);
+	case STREAM_LEX_NUMBER:
+		return stream_number(parser, chr);
+	case STREAM_LEX_LITERAL:
+		return stream_literal(parser, chr);
+	case STREAM_LEX_SKIP:
+	case STREAM_LEX_RAW:
+		return stream_nested(parser, chr);
+	default:
+		break;
+	}
+
+	if (isspace((unsigned char)chr) != 0) {
+		return 0;
+	}
+
+	if (parser->depth == 0) {
+		if (chr != '{') {
+			return -EINVAL;
+		}
+
+		return stream_push_object(parser, parser->descr,
+					  parser->descr_len, parser->val);
+	}
+
+	frame = &parser->stack[parser->depth - 1];
+
+	switch (frame->state) {
+	case STREAM_OBJ_KEY_OR_END:
+		if (chr == '}') {
+			stream_pop(parser);
+			return 0;
+		}
+
+		__fallthrough;
+	case STREAM_OBJ_KEY:
+		if (chr != '"') {
+			return -EINVAL;
+		}
+
+		frame->object.key = -1;
+		frame->state = STREAM_OBJ_COLON;
+		stream_token_start(parser, STREAM_LEX_STRING, STREAM_STORE_KEY);
+		parser->esc = false;
+		parser->hex = 0;
+		return 0;
+	case STREAM_OBJ_COLON:
+		if (chr != ':') {
+			return -EINVAL;
+		}
+
+		frame->state = STREAM_OBJ_VALUE;
+		return 0;
+	case STREAM_OBJ_VALUE:
+		frame->state = STREAM_OBJ_COMMA_OR_END;
+		return stream_value_start(parser, frame, chr);
+	case STREAM_OBJ_COMMA_OR_END:
+		if (chr == '}') {
+			stream_pop(parser);
+			return 0;
+		}
+
+		if (chr != ',') {
+			return -EINVAL;
+		}
+
+		frame->state = STREAM_OBJ_KEY;
+		return 0;
+	case STREAM_ARR_VALUE_OR_END:
+		if (chr == ']') {
+			stream_pop(parser);
+			return 0;
+		}
+
+		__fallthrough;
+	case STREAM_ARR_VALUE:
+		frame->state = STREAM_ARR_COMMA_OR_END;
+		return stream_value_start(parser, frame, chr);
+	case STREAM_ARR_COMMA_OR_END:
+		if (chr == ']') {
+			stream_pop(parser);
+			return 0;
+		}
+
+		if (chr != ',') {
+			return -EINVAL;
+		}
+
+		frame->state = STREAM_ARR_VALUE;
+		return 0;
+	default:
+		return -EINVAL;
+	}
+}
+
+void json_stream_parser_init(struct json_stream_parser *parser,
+			     const struct json_obj_descr *descr, size_t descr_len,
+			     void *val, char *buf, size_t buf_size)
+{
+	__ASSERT_NO_MSG(descr_len < (sizeof(parser->result) * CHAR_BIT - 1));
+
+	memset(parser, 0, sizeof(*parser));
+	parser->descr = descr;
+	parser->descr_len = descr_len;
+	parser->val = val;
+	parser->buf = buf;
+	parser->buf_size = buf_size;
+	parser->lex = STREAM_LEX_NONE;
+	parser->result = -EAGAIN;
+}
+
+int64_t json_stream_parse(struct json_stream_parser *parser,
+			  const char *data, size_t len)
+{
+	int ret;
+
+	for (size_t i = 0; i < len && parser->result == -EAGAIN; i++) {
+		do {
+			ret = stream_char(parser, data[i]);
+		} while (ret == 1);
+
+		if (ret < 0) {
+			parser->result = ret;
+		}
+	}
+
+	return parser->result;
+}
+
+#endif /* CONFIG_JSON_STREAM_PARSER */
+
 static char escape_as(char chr)
 {
 	switch (chr) {
@@ -806,20 +1426,32 @@ static int json_escape_internal(const char *str,
 				void *data)
 {
 	const char *cur;
+	const char *run = str;
 	int ret = 0;
 
+	/* Characters not needing escaping are appended by runs */
 	for (cur = str; ret == 0 && *cur; cur++) {
 		char escaped = escape_as(*cur);
 
 		if (escaped) {
 			char bytes[2] = { '\\', escaped };
 
+			if (cur != run) {
+				ret = append_bytes(run, cur - run, data);
+				if (ret < 0) {
+					return ret;
+				}
+			}
+
 			ret = append_bytes(bytes, 2, data);
-		} else {
-			ret = append_bytes(cur, 1, data);
+			run = cur + 1;
 		}
 	}
 
+	if (ret == 0 && cur != run) {
+		ret = append_bytes(run, cur - run, data);
+	}
+
 	return ret;
 }
 
@@ -1128,6 +1760,39 @@ int json_arr_encode_buf(const struct json_obj_descr *descr, const void *val,
 	return json_arr_encode(descr, val, append_bytes_to_buf, &appender);
 }
 
+#ifdef CONFIG_NET_BUF
+static int append_bytes_to_net_buf(const char *bytes, size_t len, void *data)
+{
+	struct net_buf **frag = data;
+
+	while (len > 0) {
+		size_t chunk = MIN(len, net_buf_tailroom(*frag));
+
+		if (chunk == 0) {
+			if ((*frag)->frags == NULL) {
+				return -ENOMEM;
+			}
+
+			*frag = (*frag)->frags;
+			continue;
+		}
+
+		net_buf_add_mem(*frag, bytes, chunk);
+		bytes += chunk;
+		len -= chunk;
+	}
+
+	return 0;
+}
+
+int json_obj_encode_net_buf(const struct json_obj_descr *descr, size_t descr_len,
+			    const void *val, struct net_buf *buf)
+{
+	return json_obj_encode(descr, descr_len, val, append_bytes_to_net_buf,
+			       &buf);
+}
+#endif /* CONFIG_NET_BUF */
+
 static int measure_bytes(const char *bytes, size_t len, void *data)
 {
 	ssize_t *total = data;
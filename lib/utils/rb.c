@@ -115,6 +115,24 @@ static uint8_t get_side(struct rbnode *parent, struct rbnode *child)
 	return (get_child(parent, 1U) == child) ? 1U : 0U;
 }
 
+static void augment(struct rbtree *tree, struct rbnode *n)
+{
+	tree->augment_fn(n, get_child(n, 0U), get_child(n, 1U));
+}
+
+/* Updates the augmented data of the node and of all its ancestors,
+ * bottom up.  The stack must have room for tree->max_depth entries.
+ */
+static void augment_path(struct rbtree *tree, struct rbnode *node,
+			 struct rbnode **stack)
+{
+	int stacksz = find_and_stack(tree, node, stack);
+
+	while (stacksz > 0) {
+		augment(tree, stack[--stacksz]);
+	}
+}
+
 /* Swaps the position of the two nodes at the top of the provided
  * stack, modifying the stack accordingly. Does not change the color
  * of either node.  That is, it effects the following transition (or
@@ -125,7 +143,7 @@ static uint8_t get_side(struct rbnode *parent, struct rbnode *child)
  * a b            b c
  *
  */
-static void rotate(struct rbnode **stack, int stacksz)
+static void rotate(struct rbtree *tree, struct rbnode **stack, int stacksz)
 {
 	CHECK(stacksz >= 2);
 
@@ -146,13 +164,23 @@ static void rotate(struct rbnode **stack, int stacksz)
 	set_child(parent, side, b);
 	stack[stacksz - 2] = child;
 	stack[stacksz - 1] = parent;
+
+	/* The parent is now below the child.  Any of their subtrees that
+	 * is out of date is on the path updated once the whole operation
+	 * is done.
+	 */
+	if (tree->augment_fn != NULL) {
+		augment(tree, parent);
+		augment(tree, child);
+	}
 }
 
 /* The node at the top of the provided stack is red, and its parent is
  * too.  Iteratively fix the tree so it becomes a valid red black tree
  * again
  */
-static void fix_extra_red(struct rbnode **stack, int stacksz)
+static void fix_extra_red(struct rbtree *tree, struct rbnode **stack,
+			  int stacksz)
 {
 	while (stacksz > 1) {
 		struct rbnode *node = stack[stacksz - 1];
@@ -198,11 +226,11 @@ static void fix_extra_red(struct rbnode **stack, int stacksz)
 		uint8_t parent_side = get_side(parent, node);
 
 		if (parent_side != side) {
-			rotate(stack, stacksz);
+			rotate(tree, stack, stacksz);
 		}
 
 		/* Rotate the grandparent with parent, swapping colors */
-		rotate(stack, stacksz - 1);
+		rotate(tree, stack, stacksz - 1);
 		set_color(stack[stacksz - 3], BLACK);
 		set_color(stack[stacksz - 2], RED);
 		return;
@@ -223,6 +251,9 @@ void rb_insert(struct rbtree *tree, struct rbnode *node)
 		tree->root = node;
 		tree->max_depth = 1;
 		set_color(node, BLACK);
+		if (tree->augment_fn != NULL) {
+			augment(tree, node);
+		}
 		return;
 	}
 
@@ -242,7 +273,7 @@ void rb_insert(struct rbtree *tree, struct rbnode *node)
 	set_color(node, RED);
 
 	stack[stacksz++] = node;
-	fix_extra_red(stack, stacksz);
+	fix_extra_red(tree, stack, stacksz);
 
 	if (stacksz > tree->max_depth) {
 		tree->max_depth = stacksz;
@@ -251,6 +282,10 @@ void rb_insert(struct rbtree *tree, struct rbnode *node)
 	/* We may have rotated up into the root! */
 	tree->root = stack[0];
 	CHECK(is_black(tree->root));
+
+	if (tree->augment_fn != NULL) {
+		augment_path(tree, node, stack);
+	}
 }
 
 /* Called for a node N (at the top of the stack) which after a
@@ -263,8 +298,8 @@ void rb_insert(struct rbtree *tree, struct rbnode *node)
  * then clean it up (replace it with a simple NULL child in the
  * parent) when finished.
  */
-static void fix_missing_black(struct rbnode **stack, int stacksz,
-			      struct rbnode *null_node)
+static void fix_missing_black(struct rbtree *tree, struct rbnode **stack,
+			      int stacksz, struct rbnode *null_node)
 {
 	/* Loop upward until we reach the root */
 	while (stacksz > 1) {
@@ -284,7 +319,7 @@ static void fix_missing_black(struct rbnode **stack, int stacksz,
 		 */
 		if (!is_black(sib)) {
 			stack[stacksz - 1] = sib;
-			rotate(stack, stacksz);
+			rotate(tree, stack, stacksz);
 			set_color(parent, RED);
 			set_color(sib, BLACK);
 			stack[stacksz++] = n;
@@ -334,7 +369,7 @@ static void fix_missing_black(struct rbnode **stack, int stacksz,
 
 			stack[stacksz - 1] = sib;
 			stack[stacksz++] = inner;
-			rotate(stack, stacksz);
+			rotate(tree, stack, stacksz);
 			set_color(sib, RED);
 			set_color(inner, BLACK);
 
@@ -356,7 +391,7 @@ static void fix_missing_black(struct rbnode **stack, int stacksz,
 		set_color(parent, BLACK);
 		set_color(outer, BLACK);
 		stack[stacksz - 1] = sib;
-		rotate(stack, stacksz);
+		rotate(tree, stack, stacksz);
 		if (n == null_node) {
 			set_child(parent, n_side, NULL);
 		}
@@ -472,7 +507,7 @@ void rb_remove(struct rbtree *tree, struct rbnode *node)
 	 */
 	if (child == NULL) {
 		if (is_black(node)) {
-			fix_missing_black(stack, stacksz, node);
+			fix_missing_black(tree, stack, stacksz, node);
 		} else {
 			/* Red childless nodes can just be dropped */
 			set_child(parent, get_side(parent, node), NULL);
@@ -491,6 +526,27 @@ void rb_remove(struct rbtree *tree, struct rbnode *node)
 
 	/* We may have rotated up into the root! */
 	tree->root = stack[0];
+
+	/* The node was removed below its parent at the time, which
+	 * stayed in the tree: all the subtrees that changed are on the
+	 * path to it.
+	 */
+	if (tree->augment_fn != NULL) {
+		augment_path(tree, parent, stack);
+	}
+}
+
+void rb_augment_update(struct rbtree *tree, struct rbnode *node)
+{
+#ifdef CONFIG_MISRA_SANE
+	struct rbnode **stack = &tree->iter_stack[0];
+#else
+	struct rbnode *stack[tree->max_depth + 1];
+#endif
+
+	if ((tree->root != NULL) && (tree->augment_fn != NULL)) {
+		augment_path(tree, node, stack);
+	}
 }
 
 #ifndef CONFIG_MISRA_SANE
@@ -525,6 +581,40 @@ bool rb_contains(struct rbtree *tree, struct rbnode *node)
 	return n == node;
 }
 
+struct rbnode *rb_find_ge(struct rbtree *tree, struct rbnode *key)
+{
+	struct rbnode *n = tree->root;
+	struct rbnode *found = NULL;
+
+	while (n != NULL) {
+		if (tree->lessthan_fn(n, key)) {
+			n = get_child(n, 1U);
+		} else {
+			found = n;
+			n = get_child(n, 0U);
+		}
+	}
+
+	return found;
+}
+
+struct rbnode *rb_find_le(struct rbtree *tree, struct rbnode *key)
+{
+	struct rbnode *n = tree->root;
+	struct rbnode *found = NULL;
+
+	while (n != NULL) {
+		if (tree->lessthan_fn(key, n)) {
+			n = get_child(n, 0U);
+		} else {
+			found = n;
+			n = get_child(n, 1U);
+		}
+	}
+
+	return found;
+}
+
 /* Pushes the node and its chain of left-side children onto the stack
  * in the foreach struct, returning the last node, which is the next
  * node to iterate.  By construction node will always be a right child
@@ -268,3 +268,211 @@ int ring_buf_item_get(struct ring_buf *buf, uint16_t *type, uint8_t *value,
 
 	return 0;
 }
+
+/*
+ * Multi-producer ring buffer.
+ *
+ * Producers reserve space by moving the head of the put state, which also
+ * counts the pending claims, with a compare-and-swap. The producer which
+ * finishes the last pending claim makes everything up to the head it saw
+ * visible to the consumer, so claims can be finished in any order.
+ */
+
+#define MPSC_PENDING_MASK (~(uint32_t)RING_BUF_MPSC_IDX_MASK)
+
+static inline uint32_t mpsc_idx(struct ring_buf_mpsc *buf, uint32_t idx)
+{
+	return idx & (buf->size - 1);
+}
+
+static uint32_t mpsc_put_reserve(struct ring_buf_mpsc *buf, uint32_t size,
+				 bool contiguous, uint32_t *start)
+{
+	atomic_val_t old_state;
+	uint32_t state, head, used;
+
+	do {
+		old_state = atomic_get(&buf->put_state);
+		state = (uint32_t)old_state;
+		head = state & RING_BUF_MPSC_IDX_MASK;
+		used = (head - (uint32_t)atomic_get(&buf->get_tail)) &
+		       RING_BUF_MPSC_IDX_MASK;
+		if (unlikely(used > buf->size)) {
+			/* The put state changed since it was read */
+			continue;
+		}
+
+		size = MIN(size, buf->size - used);
+		if (contiguous) {
+			size = MIN(size, buf->size - mpsc_idx(buf, head));
+		}
+
+		__ASSERT((state & MPSC_PENDING_MASK) != MPSC_PENDING_MASK,
+			 "Too many pending claims");
+
+		state = ((state & MPSC_PENDING_MASK) + RING_BUF_MPSC_PENDING_ONE) |
+			((head + size) & RING_BUF_MPSC_IDX_MASK);
+	} while (!atomic_cas(&buf->put_state, old_state, (atomic_val_t)state));
+
+	*start = head;
+
+	return size;
+}
+
+uint32_t ring_buf_mpsc_put_claim(struct ring_buf_mpsc *buf, uint8_t **data,
+				 uint32_t size)
+{
+	uint32_t head;
+
+	size = mpsc_put_reserve(buf, size, true, &head);
+	*data = &buf->buffer[mpsc_idx(buf, head)];
+
+	return size;
+}
+
+uint32_t ring_buf_mpsc_put_claim_vec(struct ring_buf_mpsc *buf,
+				     struct ring_buf_vec vec[2], uint32_t size)
+{
+	uint32_t head, idx;
+
+	size = mpsc_put_reserve(buf, size, false, &head);
+	idx = mpsc_idx(buf, head);
+
+	vec[0].data = &buf->buffer[idx];
+	vec[0].size = MIN(size, buf->size - idx);
+	vec[1].data = buf->buffer;
+	vec[1].size = size - vec[0].size;
+
+	return size;
+}
+
+int ring_buf_mpsc_put_finish(struct ring_buf_mpsc *buf, uint32_t size)
+{
+	atomic_val_t old_state, tail;
+	uint32_t state, head;
+
+	do {
+		old_state = atomic_get(&buf->put_state);
+		state = (uint32_t)old_state;
+		head = state & RING_BUF_MPSC_IDX_MASK;
+
+		if (unlikely((state & MPSC_PENDING_MASK) == 0U) ||
+		    unlikely(size > ((head - (uint32_t)atomic_get(&buf->put_tail)) &
+				     RING_BUF_MPSC_IDX_MASK))) {
+			return -EINVAL;
+		}
+
+		state -= RING_BUF_MPSC_PENDING_ONE;
+	} while (!atomic_cas(&buf->put_state, old_state, (atomic_val_t)state));
+
+	if ((state & MPSC_PENDING_MASK) != 0U) {
+		/* The last pending claim will make this one visible */
+		return 0;
+	}
+
+	/* Everything up to head is written, unless another producer already
+	 * published further after claiming and finishing more.
+	 */
+	do {
+		tail = atomic_get(&buf->put_tail);
+		if (((head - (uint32_t)tail) & RING_BUF_MPSC_IDX_MASK) > buf->size) {
+			break;
+		}
+	} while (!atomic_cas(&buf->put_tail, tail, (atomic_val_t)head));
+
+	return 0;
+}
+
+uint32_t ring_buf_mpsc_put(struct ring_buf_mpsc *buf, const uint8_t *data,
+			   uint32_t size)
+{
+	struct ring_buf_vec vec[2];
+	int err;
+
+	size = ring_buf_mpsc_put_claim_vec(buf, vec, size);
+	memcpy(vec[0].data, data, vec[0].size);
+	memcpy(vec[1].data, data + vec[0].size, vec[1].size);
+
+	err = ring_buf_mpsc_put_finish(buf, size);
+	__ASSERT_NO_MSG(err == 0);
+	ARG_UNUSED(err);
+
+	return size;
+}
+
+static uint32_t mpsc_get_reserve(struct ring_buf_mpsc *buf, uint32_t size,
+				 bool contiguous, uint32_t *start)
+{
+	uint32_t head = buf->get_head;
+
+	size = MIN(size, ring_buf_mpsc_size_get(buf));
+	if (contiguous) {
+		size = MIN(size, buf->size - mpsc_idx(buf, head));
+	}
+
+	buf->get_head = (head + size) & RING_BUF_MPSC_IDX_MASK;
+	*start = head;
+
+	return size;
+}
+
+uint32_t ring_buf_mpsc_get_claim(struct ring_buf_mpsc *buf, uint8_t **data,
+				 uint32_t size)
+{
+	uint32_t head;
+
+	size = mpsc_get_reserve(buf, size, true, &head);
+	*data = &buf->buffer[mpsc_idx(buf, head)];
+
+	return size;
+}
+
+uint32_t ring_buf_mpsc_get_claim_vec(struct ring_buf_mpsc *buf,
+				     struct ring_buf_vec vec[2], uint32_t size)
+{
+	uint32_t head, idx;
+
+	size = mpsc_get_reserve(buf, size, false, &head);
+	idx = mpsc_idx(buf, head);
+
+	vec[0].data = &buf->buffer[idx];
+	vec[0].size = MIN(size, buf->size - idx);
+	vec[1].data = buf->buffer;
+	vec[1].size = size - vec[0].size;
+
+	return size;
+}
+
+int ring_buf_mpsc_get_finish(struct ring_buf_mpsc *buf, uint32_t size)
+{
+	uint32_t tail = (uint32_t)atomic_get(&buf->get_tail);
+
+	if (unlikely(size > ((buf->get_head - tail) & RING_BUF_MPSC_IDX_MASK))) {
+		return -EINVAL;
+	}
+
+	tail = (tail + size) & RING_BUF_MPSC_IDX_MASK;
+	buf->get_head = tail;
+	atomic_set(&buf->get_tail, (atomic_val_t)tail);
+
+	return 0;
+}
+
+uint32_t ring_buf_mpsc_get(struct ring_buf_mpsc *buf, uint8_t *data,
+			   uint32_t size)
+{
+	struct ring_buf_vec vec[2];
+	int err;
+
+	size = ring_buf_mpsc_get_claim_vec(buf, vec, size);
+	if (data) {
+		memcpy(data, vec[0].data, vec[0].size);
+		memcpy(data + vec[0].size, vec[1].data, vec[1].size);
+	}
+
+	err = ring_buf_mpsc_get_finish(buf, size);
+	__ASSERT_NO_MSG(err == 0);
+	ARG_UNUSED(err);
+
+	return size;
+}
@@ -12,10 +12,228 @@
  */
 #include <ff.h>
 #include <diskio.h>	/* FatFs lower layer API */
+#include <string.h>
+#include <zephyr/kernel.h>
 #include <zephyr/storage/disk_access.h>
 
 static const char * const pdrv_str[] = {FF_VOLUME_STRS};
 
+#if defined(CONFIG_FS_FATFS_SECTOR_CACHE)
+/*
+ * FatFs moves its one sector window between the FAT, the directories and
+ * the file data, and reads at most one cluster at a time.  The cache keeps
+ * a few windows of consecutive sectors, each filled with a single
+ * multi-sector read, so that walking the FAT, scanning directories and
+ * reading files with small clusters or in small pieces need few commands.
+ * Writes go through to the disk and update the cached sectors.
+ */
+#define CACHE_SECTORS CONFIG_FS_FATFS_SECTOR_CACHE_SECTORS
+
+struct cache_window {
+	uint8_t data[CACHE_SECTORS * FF_MAX_SS] __aligned(CONFIG_FS_FATFS_WINDOW_ALIGNMENT);
+	LBA_t start;
+	UINT count;
+	BYTE pdrv;
+	uint32_t used;
+};
+
+struct cache_drive {
+	uint32_t sector_size;
+	LBA_t sector_count;
+};
+
+static struct cache_window cache_windows[CONFIG_FS_FATFS_SECTOR_CACHE_WINDOWS];
+static struct cache_drive cache_drives[ARRAY_SIZE(pdrv_str)];
+static uint32_t cache_clock;
+static K_MUTEX_DEFINE(cache_lock);
+
+static inline bool buf_aligned(const void *buff)
+{
+	return ((uintptr_t)buff % CONFIG_FS_FATFS_WINDOW_ALIGNMENT) == 0;
+}
+
+static void cache_drive_init(BYTE pdrv)
+{
+	struct cache_drive *drive = &cache_drives[pdrv];
+	uint32_t sector_count = 0;
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	/* The medium may have been changed */
+	for (size_t i = 0; i < ARRAY_SIZE(cache_windows); i++) {
+		if (cache_windows[i].pdrv == pdrv) {
+			cache_windows[i].count = 0;
+		}
+	}
+
+	/* The cache is not used for disks of unknown geometry */
+	if ((disk_access_ioctl(pdrv_str[pdrv], DISK_IOCTL_GET_SECTOR_SIZE,
+			       &drive->sector_size) != 0) ||
+	    (drive->sector_size > FF_MAX_SS) ||
+	    (disk_access_ioctl(pdrv_str[pdrv], DISK_IOCTL_GET_SECTOR_COUNT,
+			       &sector_count) != 0)) {
+		drive->sector_size = 0;
+	}
+	drive->sector_count = sector_count;
+
+	k_mutex_unlock(&cache_lock);
+}
+
+static struct cache_window *cache_find(BYTE pdrv, LBA_t sector)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(cache_windows); i++) {
+		struct cache_window *win = &cache_windows[i];
+
+		if ((win->count > 0) && (win->pdrv == pdrv) && (sector >= win->start) &&
+		    (sector < (win->start + win->count))) {
+			return win;
+		}
+	}
+
+	return NULL;
+}
+
+static struct cache_window *cache_lru(void)
+{
+	struct cache_window *lru = &cache_windows[0];
+
+	for (size_t i = 0; i < ARRAY_SIZE(cache_windows); i++) {
+		struct cache_window *win = &cache_windows[i];
+
+		if (win->count == 0) {
+			return win;
+		}
+
+		if (win->used < lru->used) {
+			lru = win;
+		}
+	}
+
+	return lru;
+}
+
+/* Copy the written sectors into the windows holding them */
+static void cache_update(BYTE pdrv, const BYTE *buff, LBA_t sector, UINT count)
+{
+	uint32_t ss = cache_drives[pdrv].sector_size;
+
+	for (size_t i = 0; i < ARRAY_SIZE(cache_windows); i++) {
+		struct cache_window *win = &cache_windows[i];
+		LBA_t start = MAX(sector, win->start);
+		LBA_t end = MIN(sector + count, win->start + win->count);
+
+		if ((win->count == 0) || (win->pdrv != pdrv) || (start >= end)) {
+			continue;
+		}
+
+		memcpy(&win->data[(start - win->start) * ss], &buff[(start - sector) * ss],
+		       (end - start) * ss);
+	}
+}
+
+static int cache_read(BYTE pdrv, BYTE *buff, LBA_t sector, UINT count)
+{
+	const struct cache_drive *drive = &cache_drives[pdrv];
+	uint32_t ss = drive->sector_size;
+	int ret = 0;
+
+	/* Large reads go directly to the buffer if the disk can use it */
+	if ((ss == 0) || ((count >= CACHE_SECTORS) && buf_aligned(buff))) {
+		return disk_access_read(pdrv_str[pdrv], buff, sector, count);
+	}
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	while (count > 0) {
+		struct cache_window *win = cache_find(pdrv, sector);
+		UINT n;
+
+		if (win == NULL) {
+			if (sector >= drive->sector_count) {
+				ret = -EIO;
+				break;
+			}
+
+			/* Read ahead up to the end of the disk */
+			win = cache_lru();
+			win->pdrv = pdrv;
+			win->start = sector;
+			win->count = MIN(CACHE_SECTORS, drive->sector_count - sector);
+
+			ret = disk_access_read(pdrv_str[pdrv], win->data, sector, win->count);
+			if (ret != 0) {
+				win->count = 0;
+				break;
+			}
+		}
+
+		n = MIN(count, win->start + win->count - sector);
+		memcpy(buff, &win->data[(sector - win->start) * ss], n * ss);
+		win->used = ++cache_clock;
+
+		buff += n * ss;
+		sector += n;
+		count -= n;
+	}
+
+	k_mutex_unlock(&cache_lock);
+
+	return ret;
+}
+
+static int cache_write(BYTE pdrv, const BYTE *buff, LBA_t sector, UINT count)
+{
+	uint32_t ss = cache_drives[pdrv].sector_size;
+	const BYTE *src = buff;
+	LBA_t next = sector;
+	UINT left = count;
+	int ret = 0;
+
+	if (ss == 0) {
+		return disk_access_write(pdrv_str[pdrv], buff, sector, count);
+	}
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	if (buf_aligned(buff)) {
+		ret = disk_access_write(pdrv_str[pdrv], buff, sector, count);
+	} else {
+		/* Write through aligned windows, that keep the written sectors */
+		while ((ret == 0) && (left > 0)) {
+			struct cache_window *win = cache_lru();
+			UINT n = MIN(left, CACHE_SECTORS);
+
+			memcpy(win->data, src, n * ss);
+			win->pdrv = pdrv;
+			win->start = next;
+			win->count = n;
+			win->used = ++cache_clock;
+
+			ret = disk_access_write(pdrv_str[pdrv], win->data, next, n);
+
+			src += n * ss;
+			next += n;
+			left -= n;
+		}
+	}
+
+	if (ret == 0) {
+		cache_update(pdrv, buff, sector, count);
+	} else {
+		/* The content of the disk is unknown */
+		for (size_t i = 0; i < ARRAY_SIZE(cache_windows); i++) {
+			if (cache_windows[i].pdrv == pdrv) {
+				cache_windows[i].count = 0;
+			}
+		}
+	}
+
+	k_mutex_unlock(&cache_lock);
+
+	return ret;
+}
+#endif /* CONFIG_FS_FATFS_SECTOR_CACHE */
+
 /* Get Drive Status */
 DSTATUS disk_status(BYTE pdrv)
 {
@@ -35,9 +253,13 @@ DSTATUS disk_initialize(BYTE pdrv)
 
 	if (disk_access_init(pdrv_str[pdrv]) != 0) {
 		return STA_NOINIT;
-	} else {
-		return RES_OK;
 	}
+
+#if defined(CONFIG_FS_FATFS_SECTOR_CACHE)
+	cache_drive_init(pdrv);
+#endif
+
+	return RES_OK;
 }
 
 /* Read Sector(s) */
@@ -45,7 +267,11 @@ DRESULT disk_read(BYTE pdrv, BYTE *buff, LBA_t sector, UINT count)
 {
 	__ASSERT(pdrv < ARRAY_SIZE(pdrv_str), "pdrv out-of-range\n");
 
+#if defined(CONFIG_FS_FATFS_SECTOR_CACHE)
+	if (cache_read(pdrv, buff, sector, count) != 0) {
+#else
 	if (disk_access_read(pdrv_str[pdrv], buff, sector, count) != 0) {
+#endif
 		return RES_ERROR;
 	} else {
 		return RES_OK;
@@ -58,7 +284,11 @@ DRESULT disk_write(BYTE pdrv, const BYTE *buff, LBA_t sector, UINT count)
 {
 	__ASSERT(pdrv < ARRAY_SIZE(pdrv_str), "pdrv out-of-range\n");
 
+#if defined(CONFIG_FS_FATFS_SECTOR_CACHE)
+	if (cache_write(pdrv, buff, sector, count) != 0) {
+#else
 	if (disk_access_write(pdrv_str[pdrv], buff, sector, count) != 0) {
+#endif
 		return RES_ERROR;
 	} else {
 		return RES_OK;
@@ -0,0 +1,22 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_MODULES_LVGL_GFX2D_H_
+#define ZEPHYR_MODULES_LVGL_GFX2D_H_
+
+#include <lvgl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void lvgl_gfx2d_init(lv_disp_drv_t *disp_drv);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_MODULES_LVGL_GFX2D_H_ */
@@ -15,6 +15,9 @@
 #ifdef CONFIG_LV_Z_MEM_POOL_SYS_HEAP
 #include "lvgl_mem.h"
 #endif
+#ifdef CONFIG_LV_Z_GFX2D
+#include "lvgl_gfx2d.h"
+#endif
 #include LV_MEM_CUSTOM_INCLUDE
 
 #include <zephyr/logging/log.h>
@@ -229,6 +232,10 @@ static int lvgl_init(void)
 	disp_drv.full_refresh = 1;
 #endif
 
+#ifdef CONFIG_LV_Z_GFX2D
+	lvgl_gfx2d_init(&disp_drv);
+#endif
+
 	err = lvgl_allocate_rendering_buffers(&disp_drv);
 	if (err != 0) {
 		return err;
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/gfx2d.h>
+#include <lvgl.h>
+#include "lvgl_gfx2d.h"
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(lvgl, CONFIG_LV_Z_LOG_LEVEL);
+
+#define GFX2D_DEV DEVICE_DT_GET(DT_CHOSEN(zephyr_gfx2d))
+
+#ifdef CONFIG_LV_COLOR_DEPTH_32
+#define LVGL_GFX2D_FORMAT PIXEL_FORMAT_ARGB_8888
+#else
+#define LVGL_GFX2D_FORMAT PIXEL_FORMAT_RGB_565
+#endif
+
+static int lvgl_gfx2d_draw(const lv_draw_ctx_t *draw_ctx,
+			   const lv_draw_sw_blend_dsc_t *dsc,
+			   const lv_area_t *area)
+{
+	lv_coord_t dst_stride = lv_area_get_width(draw_ctx->buf_area);
+	struct gfx2d_surface dst = {
+		.buf = (lv_color_t *)draw_ctx->buf +
+		       dst_stride * (area->y1 - draw_ctx->buf_area->y1) +
+		       (area->x1 - draw_ctx->buf_area->x1),
+		.width = lv_area_get_width(area),
+		.height = lv_area_get_height(area),
+		.pitch = dst_stride,
+		.format = LVGL_GFX2D_FORMAT,
+	};
+	struct gfx2d_surface src;
+	lv_coord_t src_stride;
+
+	if (dsc->src_buf == NULL) {
+		if (dsc->opa < LV_OPA_MAX) {
+			return -ENOTSUP;
+		}
+
+		return gfx2d_fill(GFX2D_DEV, &dst, lv_color_to32(dsc->color));
+	}
+
+	src_stride = lv_area_get_width(dsc->blend_area);
+	src = dst;
+	src.buf = (lv_color_t *)dsc->src_buf +
+		  src_stride * (area->y1 - dsc->blend_area->y1) +
+		  (area->x1 - dsc->blend_area->x1);
+	src.pitch = src_stride;
+
+	if (dsc->opa >= LV_OPA_MAX) {
+		return gfx2d_copy(GFX2D_DEV, &dst, &src);
+	}
+
+	return gfx2d_blend(GFX2D_DEV, &dst, &src, dsc->opa);
+}
+
+static void lvgl_gfx2d_blend(lv_draw_ctx_t *draw_ctx, const lv_draw_sw_blend_dsc_t *dsc)
+{
+	lv_area_t area;
+
+	if (dsc->mask_buf != NULL && dsc->mask_res == LV_DRAW_MASK_RES_TRANSP) {
+		return;
+	}
+
+	if (!_lv_area_intersect(&area, dsc->blend_area, draw_ctx->clip_area)) {
+		return;
+	}
+
+	/* Masked areas and other blend modes are drawn in software */
+	if ((dsc->mask_buf == NULL || dsc->mask_res == LV_DRAW_MASK_RES_FULL_COVER) &&
+	    dsc->blend_mode == LV_BLEND_MODE_NORMAL &&
+	    lv_area_get_size(&area) >= CONFIG_LV_Z_GFX2D_MIN_PIXELS &&
+	    lvgl_gfx2d_draw(draw_ctx, dsc, &area) == 0) {
+		return;
+	}
+
+	lv_draw_sw_blend_basic(draw_ctx, dsc);
+}
+
+static void lvgl_gfx2d_ctx_init(lv_disp_drv_t *drv, lv_draw_ctx_t *draw_ctx)
+{
+	lv_draw_sw_ctx_t *sw_ctx = (lv_draw_sw_ctx_t *)draw_ctx;
+
+	lv_draw_sw_init_ctx(drv, draw_ctx);
+	sw_ctx->blend = lvgl_gfx2d_blend;
+}
+
+void lvgl_gfx2d_init(lv_disp_drv_t *disp_drv)
+{
+	struct gfx2d_capabilities caps;
+
+	if (!device_is_ready(GFX2D_DEV)) {
+		LOG_WRN("2D graphics accelerator not ready, drawing in software");
+		return;
+	}
+
+	gfx2d_get_capabilities(GFX2D_DEV, &caps);
+	if ((caps.pixel_formats & LVGL_GFX2D_FORMAT) == 0) {
+		LOG_WRN("2D graphics accelerator does not support LVGL colors");
+		return;
+	}
+
+	disp_drv->draw_ctx_init = lvgl_gfx2d_ctx_init;
+	disp_drv->draw_ctx_deinit = lv_draw_sw_deinit_ctx;
+	disp_drv->draw_ctx_size = sizeof(lv_draw_sw_ctx_t);
+}
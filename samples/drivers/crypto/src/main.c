@@ -483,6 +483,71 @@ out:
 	cipher_free_session(dev, &ini);
 }
 
+#define CCM_BATCH_SIZE 2
+
+void ccm_batch_mode(const struct device *dev)
+{
+	uint8_t encrypted[CCM_BATCH_SIZE][sizeof(ccm_expected)];
+	struct cipher_pkt encrypt[CCM_BATCH_SIZE];
+	struct cipher_aead_pkt ccm_ops[CCM_BATCH_SIZE];
+	struct cipher_aead_req reqs[CCM_BATCH_SIZE];
+	struct cipher_ctx ini = {
+		.keylen = sizeof(ccm_key),
+		.key.bit_stream = ccm_key,
+		.mode_params.ccm_info = {
+			.nonce_len = sizeof(ccm_nonce),
+			.tag_len = 8,
+		},
+		.flags = cap_flags,
+	};
+	int i;
+
+	/* The same record twice, to compare both against the test vector */
+	for (i = 0; i < CCM_BATCH_SIZE; i++) {
+		encrypt[i] = (struct cipher_pkt) {
+			.in_buf = ccm_data,
+			.in_len = sizeof(ccm_data),
+			.out_buf_max = sizeof(encrypted[i]),
+			.out_buf = encrypted[i],
+		};
+		ccm_ops[i] = (struct cipher_aead_pkt) {
+			.ad = ccm_hdr,
+			.ad_len = sizeof(ccm_hdr),
+			.pkt = &encrypt[i],
+			.tag = encrypted[i] + sizeof(ccm_data),
+		};
+		reqs[i] = (struct cipher_aead_req) {
+			.pkt = &ccm_ops[i],
+			.nonce = ccm_nonce,
+		};
+	}
+
+	if (cipher_begin_session(dev, &ini, CRYPTO_CIPHER_ALGO_AES,
+				 CRYPTO_CIPHER_MODE_CCM,
+				 CRYPTO_CIPHER_OP_ENCRYPT)) {
+		return;
+	}
+
+	if (cipher_aead_batch_op(&ini, reqs, CCM_BATCH_SIZE)) {
+		LOG_ERR("CCM batch ENCRYPT - Failed");
+		goto out;
+	}
+
+	for (i = 0; i < CCM_BATCH_SIZE; i++) {
+		if (memcmp(encrypt[i].out_buf, ccm_expected, sizeof(ccm_expected))) {
+			LOG_ERR("CCM batch ENCRYPT - Mismatch between expected "
+				"and returned cipher text of op %d", i);
+			print_buffer_comparison(ccm_expected,
+						encrypt[i].out_buf, sizeof(ccm_expected));
+			goto out;
+		}
+	}
+
+	LOG_INF("CCM batch ENCRYPT - Match");
+out:
+	cipher_free_session(dev, &ini);
+}
+
 /*  MACsec GCM-AES test vector 2.4.1 */
 static uint8_t gcm_key[16] = {
 	0x07, 0x1b, 0x11, 0x3b, 0x0c, 0xa7, 0x43, 0xfe, 0xcc, 0xcf, 0x3d, 0x05,
@@ -627,6 +692,7 @@ int main(void)
 		{ .mode = "CBC Mode", .mode_func = cbc_mode },
 		{ .mode = "CTR Mode", .mode_func = ctr_mode },
 		{ .mode = "CCM Mode", .mode_func = ccm_mode },
+		{ .mode = "CCM Batch Mode", .mode_func = ccm_batch_mode },
 		{ .mode = "GCM Mode", .mode_func = gcm_mode },
 		{ },
 	};
@@ -0,0 +1,98 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2024 The Zephyr Project Contributors
+#
+# SPDX-License-Identifier: Apache-2.0
+
+"""Concurrency and throughput benchmark of the HTTP server sample.
+
+Runs a number of clients in parallel, each doing requests over its own
+connection, and reports request rate, throughput and latency.
+"""
+
+import argparse
+import http.client
+import statistics
+import threading
+import time
+
+
+def client(args, count, results):
+    latencies = []
+    received = 0
+    errors = 0
+    conn = None
+
+    for _ in range(count):
+        if conn is None:
+            conn = http.client.HTTPConnection(args.host, args.port,
+                                              timeout=args.timeout)
+        start = time.perf_counter()
+        try:
+            headers = {} if args.keep_alive else {"Connection": "close"}
+            conn.request("GET", args.path, headers=headers)
+            rsp = conn.getresponse()
+            body = rsp.read()
+            if rsp.status != 200:
+                errors += 1
+            received += len(body)
+            if not args.keep_alive or rsp.will_close:
+                conn.close()
+                conn = None
+        except (OSError, http.client.HTTPException):
+            errors += 1
+            conn.close()
+            conn = None
+            continue
+        latencies.append(time.perf_counter() - start)
+
+    if conn is not None:
+        conn.close()
+
+    results.append((latencies, received, errors))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("--host", default="192.0.2.1")
+    parser.add_argument("--port", type=int, default=80)
+    parser.add_argument("--path", default="/",
+                        help="resource to request, e.g. /big for throughput")
+    parser.add_argument("-c", "--concurrency", type=int, default=4,
+                        help="number of parallel connections")
+    parser.add_argument("-n", "--requests", type=int, default=1000,
+                        help="total number of requests")
+    parser.add_argument("--no-keep-alive", dest="keep_alive",
+                        action="store_false",
+                        help="use a new connection for each request")
+    parser.add_argument("--timeout", type=float, default=5.0)
+    args = parser.parse_args()
+
+    results = []
+    per_client = args.requests // args.concurrency
+    threads = [threading.Thread(target=client,
+                                args=(args, per_client, results))
+               for _ in range(args.concurrency)]
+
+    start = time.perf_counter()
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+    elapsed = time.perf_counter() - start
+
+    latencies = sorted(l for r in results for l in r[0])
+    received = sum(r[1] for r in results)
+    errors = sum(r[2] for r in results)
+
+    print(f"Requests:    {len(latencies)} ok, {errors} failed in {elapsed:.2f} s")
+    print(f"Rate:        {len(latencies) / elapsed:.1f} requests/s")
+    print(f"Throughput:  {received / elapsed / 1024:.1f} KiB/s")
+    if latencies:
+        print(f"Latency:     mean {statistics.mean(latencies) * 1000:.2f} ms, "
+              f"p50 {latencies[len(latencies) // 2] * 1000:.2f} ms, "
+              f"p99 {latencies[int(len(latencies) * 0.99)] * 1000:.2f} ms")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_http_server_sample, LOG_LEVEL_DBG);
+
+#include <stdio.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/http/server.h>
+
+#define BIG_SIZE (64 * 1024)
+
+static uint16_t http_port = 80;
+HTTP_SERVICE_DEFINE(sample_service, "0.0.0.0", &http_port, 4, 4, NULL);
+
+/* Compressed at build time, served from flash as it is */
+static const uint8_t index_html_gz[] = {
+#include "index.html.gz.inc"
+};
+
+static struct http_resource_detail_static index_detail = {
+	.common = {
+		.bitmask_of_supported_http_methods = BIT(HTTP_GET),
+		.type = HTTP_RESOURCE_TYPE_STATIC,
+		.content_type = "text/html",
+		.content_encoding = "gzip",
+	},
+	.static_data = index_html_gz,
+	.static_data_len = sizeof(index_html_gz),
+};
+
+HTTP_RESOURCE_DEFINE(index_resource, sample_service, "/", &index_detail);
+HTTP_RESOURCE_DEFINE(index_html_resource, sample_service, "/index.html",
+		     &index_detail);
+
+/* Constant data for throughput measurements */
+static const uint8_t big_data[BIG_SIZE] = { [0 ... (BIG_SIZE - 1)] = 'z' };
+
+static struct http_resource_detail_static big_detail = {
+	.common = {
+		.bitmask_of_supported_http_methods = BIT(HTTP_GET),
+		.type = HTTP_RESOURCE_TYPE_STATIC,
+		.content_type = "application/octet-stream",
+	},
+	.static_data = big_data,
+	.static_data_len = sizeof(big_data),
+};
+
+HTTP_RESOURCE_DEFINE(big_resource, sample_service, "/big", &big_detail);
+
+static int uptime_handler(struct http_client_ctx *client,
+			  enum http_data_status status, const uint8_t *data,
+			  size_t len, void *user_data)
+{
+	char buf[sizeof("18446744073709551615")];
+	int ret;
+
+	if (status != HTTP_SERVER_DATA_FINAL) {
+		return 0;
+	}
+
+	ret = snprintf(buf, sizeof(buf), "%lld", k_uptime_get());
+
+	return http_server_send_response(client, HTTP_200_OK, "text/plain",
+					 buf, ret);
+}
+
+static struct http_resource_detail_dynamic uptime_detail = {
+	.common = {
+		.bitmask_of_supported_http_methods = BIT(HTTP_GET),
+		.type = HTTP_RESOURCE_TYPE_DYNAMIC,
+	},
+	.cb = uptime_handler,
+};
+
+HTTP_RESOURCE_DEFINE(uptime_resource, sample_service, "/uptime",
+		     &uptime_detail);
+
+/* Echo the request body back, with chunked transfer encoding */
+static int echo_handler(struct http_client_ctx *client,
+			enum http_data_status status, const uint8_t *data,
+			size_t len, void *user_data)
+{
+	if (status == HTTP_SERVER_DATA_MORE && len > 0) {
+		return http_server_send_chunk(client, data, len);
+	}
+
+	return 0;
+}
+
+static struct http_resource_detail_dynamic echo_detail = {
+	.common = {
+		.bitmask_of_supported_http_methods = BIT(HTTP_POST) | BIT(HTTP_PUT),
+		.type = HTTP_RESOURCE_TYPE_DYNAMIC,
+		.content_type = "application/octet-stream",
+	},
+	.cb = echo_handler,
+};
+
+HTTP_RESOURCE_DEFINE(echo_resource, sample_service, "/echo", &echo_detail);
+
+int main(void)
+{
+	int ret;
+
+	ret = http_server_start();
+	if (ret < 0) {
+		LOG_ERR("Cannot start the HTTP server (%d)", ret);
+		return 0;
+	}
+
+	LOG_INF("HTTP server listening on port %u", http_port);
+
+	return 0;
+}
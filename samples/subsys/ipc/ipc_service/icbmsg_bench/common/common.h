@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef __COMMON_H__
+#define __COMMON_H__
+
+#include <stdint.h>
+
+/* Echoed back by the remote */
+#define MSG_PING	(1)
+/* Counted by the remote */
+#define MSG_DATA	(2)
+/* Answered with the number of bytes received since the last one */
+#define MSG_REPORT	(3)
+
+#define SENDING_TIME_MS	(1000)
+#define PING_COUNT	(1000)
+
+struct msg_hdr {
+	uint32_t type;
+	uint32_t value;
+};
+
+#endif /* __COMMON_H__ */
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+
+#include <zephyr/ipc/ipc_service.h>
+
+#include "common.h"
+
+static struct ipc_ept ep;
+static uint32_t received_bytes;
+
+static void ep_bound(void *priv)
+{
+	printk("Ep bounded\n");
+}
+
+static void ep_recv(const void *data, size_t len, void *priv)
+{
+	struct msg_hdr msg = *(const struct msg_hdr *)data;
+	int ret;
+
+	switch (msg.type) {
+	case MSG_PING:
+		ret = ipc_service_send(&ep, &msg, sizeof(msg));
+		break;
+	case MSG_DATA:
+		received_bytes += len;
+		ret = 0;
+		break;
+	case MSG_REPORT:
+		msg.value = received_bytes;
+		received_bytes = 0;
+		ret = ipc_service_send(&ep, &msg, sizeof(msg));
+		break;
+	default:
+		ret = 0;
+		break;
+	}
+
+	if (ret < 0) {
+		printk("send_message(%u) failed with ret %d\n", msg.type, ret);
+	}
+}
+
+static struct ipc_ept_cfg ep_cfg = {
+	.name = "bench",
+	.cb = {
+		.bound    = ep_bound,
+		.received = ep_recv,
+	},
+};
+
+int main(void)
+{
+	const struct device *ipc0_instance;
+	int ret;
+
+	printk("IPC-service REMOTE benchmark started\n");
+
+	ipc0_instance = DEVICE_DT_GET(DT_NODELABEL(ipc0));
+
+	ret = ipc_service_open_instance(ipc0_instance);
+	if ((ret < 0) && (ret != -EALREADY)) {
+		printk("ipc_service_open_instance() failure\n");
+		return ret;
+	}
+
+	ret = ipc_service_register_endpoint(ipc0_instance, &ep, &ep_cfg);
+	if (ret < 0) {
+		printk("ipc_service_register_endpoint() failure\n");
+		return ret;
+	}
+
+	return 0;
+}
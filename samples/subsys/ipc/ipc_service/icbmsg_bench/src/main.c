@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+
+#include <zephyr/ipc/ipc_service.h>
+
+#include "common.h"
+
+static struct ipc_ept ep;
+static uint32_t reply_value;
+
+static K_SEM_DEFINE(bound_sem, 0, 1);
+static K_SEM_DEFINE(reply_sem, 0, 1);
+
+/* Payloads of the throughput test, the last ones spanning several blocks */
+static const uint32_t sizes[] = { 16, 128, 512, 2048, 8192 };
+
+static void ep_bound(void *priv)
+{
+	k_sem_give(&bound_sem);
+}
+
+static void ep_recv(const void *data, size_t len, void *priv)
+{
+	const struct msg_hdr *msg = data;
+
+	reply_value = msg->value;
+	k_sem_give(&reply_sem);
+}
+
+static struct ipc_ept_cfg ep_cfg = {
+	.name = "bench",
+	.cb = {
+		.bound    = ep_bound,
+		.received = ep_recv,
+	},
+};
+
+static int send_nocopy(uint32_t type, uint32_t len)
+{
+	struct msg_hdr *msg;
+	uint32_t size = len;
+	void *data;
+	int ret;
+
+	ret = ipc_service_get_tx_buffer(&ep, &data, &size, K_MSEC(100));
+	if (ret < 0) {
+		return ret;
+	}
+
+	msg = data;
+	msg->type = type;
+	msg->value = len;
+
+	return ipc_service_send_nocopy(&ep, data, len);
+}
+
+static int measure_latency(void)
+{
+	uint32_t min = UINT32_MAX;
+	uint32_t max = 0;
+	uint64_t total = 0;
+	uint32_t start;
+	uint32_t cycles;
+	int ret;
+
+	for (int i = 0; i < PING_COUNT; i++) {
+		start = k_cycle_get_32();
+
+		ret = send_nocopy(MSG_PING, sizeof(struct msg_hdr));
+		if (ret < 0) {
+			return ret;
+		}
+
+		if (k_sem_take(&reply_sem, K_MSEC(100)) != 0) {
+			return -ETIMEDOUT;
+		}
+
+		cycles = k_cycle_get_32() - start;
+		min = MIN(min, cycles);
+		max = MAX(max, cycles);
+		total += cycles;
+	}
+
+	printk("Round trip: min %u us, avg %u us, max %u us\n",
+	       k_cyc_to_us_floor32(min), k_cyc_to_us_floor32(total / PING_COUNT),
+	       k_cyc_to_us_floor32(max));
+
+	return 0;
+}
+
+static int measure_throughput(uint32_t len)
+{
+	int64_t end = k_uptime_get() + SENDING_TIME_MS;
+	uint32_t count = 0;
+	int ret;
+
+	while (k_uptime_get() < end) {
+		ret = send_nocopy(MSG_DATA, len);
+		if (ret < 0) {
+			return ret;
+		}
+		count++;
+	}
+
+	ret = send_nocopy(MSG_REPORT, sizeof(struct msg_hdr));
+	if (ret < 0) {
+		return ret;
+	}
+
+	if (k_sem_take(&reply_sem, K_MSEC(1000)) != 0) {
+		return -ETIMEDOUT;
+	}
+
+	printk("%5u B: %6u msg/s, %5u kB/s, %u of %u bytes received\n", len,
+	       count * MSEC_PER_SEC / SENDING_TIME_MS,
+	       reply_value / SENDING_TIME_MS, reply_value, count * len);
+
+	return 0;
+}
+
+int main(void)
+{
+	const struct device *ipc0_instance;
+	int ret;
+
+	printk("IPC-service HOST benchmark started\n");
+
+	ipc0_instance = DEVICE_DT_GET(DT_NODELABEL(ipc0));
+
+	ret = ipc_service_open_instance(ipc0_instance);
+	if ((ret < 0) && (ret != -EALREADY)) {
+		printk("ipc_service_open_instance() failure\n");
+		return ret;
+	}
+
+	ret = ipc_service_register_endpoint(ipc0_instance, &ep, &ep_cfg);
+	if (ret < 0) {
+		printk("ipc_service_register_endpoint() failure\n");
+		return ret;
+	}
+
+	k_sem_take(&bound_sem, K_FOREVER);
+
+	ret = measure_latency();
+	if (ret < 0) {
+		printk("Latency test failed with ret %d\n", ret);
+		return ret;
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(sizes); i++) {
+		ret = measure_throughput(sizes[i]);
+		if (ret < 0) {
+			printk("Throughput test of %u bytes failed with ret %d\n",
+			       sizes[i], ret);
+			return ret;
+		}
+	}
+
+	printk("IPC-service HOST benchmark ended\n");
+
+	return 0;
+}
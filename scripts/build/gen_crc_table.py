@@ -0,0 +1,92 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2024 The Zephyr Project Contributors
+#
+# SPDX-License-Identifier: Apache-2.0
+
+"""Generate the lookup tables of a slicing-by-N reflected CRC32.
+
+Table 0 is the usual byte-wise table of the polynomial, and table k gives
+the CRC of a byte followed by k zero bytes, so that N bytes can be folded
+into the CRC with N lookups.
+"""
+
+import argparse
+import os
+
+
+def gen_tables(poly, slices):
+    tables = [[0] * 256 for _ in range(slices)]
+
+    for i in range(256):
+        crc = i
+        for _ in range(8):
+            crc = (crc >> 1) ^ (poly if crc & 1 else 0)
+        tables[0][i] = crc
+
+    for k in range(1, slices):
+        for i in range(256):
+            prev = tables[k - 1][i]
+            tables[k][i] = (prev >> 8) ^ tables[0][prev & 0xff]
+
+    return tables
+
+
+def write_tables(output, name, poly, tables):
+    os.makedirs(os.path.dirname(os.path.abspath(output)), exist_ok=True)
+
+    with open(output, 'w') as outf:
+        print(f'/*\n * This file generated by {__file__}\n */\n', file=outf)
+        print('#include <stdint.h>\n', file=outf)
+        print(f'/* Slicing-by-{len(tables)} tables of reflected polynomial '
+              f'0x{poly:08x} */', file=outf)
+        print(f'static const uint32_t {name}[{len(tables)}][256] = {{', file=outf)
+        for table in tables:
+            print('\t{', file=outf)
+            for i in range(0, 256, 4):
+                row = ', '.join(f'0x{v:08x}U' for v in table[i:i + 4])
+                print(f'\t\t{row},', file=outf)
+            print('\t},', file=outf)
+        print('};', file=outf)
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(allow_abbrev=False)
+    parser.add_argument(
+        '-p',
+        '--poly',
+        dest='poly',
+        required=True,
+        type=lambda s: int(s, 0),
+        help='reflected polynomial (e.g. 0xedb88320)')
+    parser.add_argument(
+        '-s',
+        '--slices',
+        dest='slices',
+        default=8,
+        type=int,
+        help='number of tables, i.e. bytes processed per step')
+    parser.add_argument(
+        '-n',
+        '--name',
+        dest='name',
+        required=True,
+        help='name of the table array')
+    parser.add_argument(
+        '-o',
+        '--output',
+        dest='output',
+        required=True,
+        help='output file (e.g. build/zephyr/include/generated/crc/crc32_ieee_table.h)')
+
+    return parser.parse_args()
+
+
+def main():
+    args = parse_args()
+    write_tables(args.output, args.name, args.poly,
+                 gen_tables(args.poly, args.slices))
+
+
+if __name__ == '__main__':
+    main()
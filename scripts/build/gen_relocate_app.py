@@ -35,6 +35,8 @@ Configuration that needs to be sent to the python script.
   code_relocation.c or not
 - NOKEEP will suppress the default behavior of marking every relocated symbol
   with KEEP() in the generated linker script.
+- FILTER=<hex> only relocates the sections whose name matches the hex encoded
+  regular expression.
 
 Multiple regions can be appended together like SRAM2_DATA_BSS
 this will place data and bss inside SRAM2.
@@ -45,6 +47,7 @@ import sys
 import argparse
 import os
 import glob
+import re
 import warnings
 from collections import defaultdict
 from enum import Enum
@@ -225,12 +228,13 @@ def region_is_default_ram(region_name: str) -> bool:
     return region_name == args.default_ram_region
 
 
-def find_sections(filename: str) -> 'dict[SectionKind, list[OutputSection]]':
+def find_sections(filename: str, section_filter=None) -> 'dict[SectionKind, list[OutputSection]]':
     """
     Locate relocatable sections in the given object file.
 
     The output value maps categories of sections to the list of actual sections
-    located in the object file that fit in that category.
+    located in the object file that fit in that category. If a filter is given,
+    only the sections whose name matches it are located.
     """
     obj_file_path = Path(filename)
 
@@ -247,6 +251,9 @@ def find_sections(filename: str) -> 'dict[SectionKind, list[OutputSection]]':
             if section_kind is None:
                 continue
 
+            if section_filter is not None and not section_filter.search(section.name):
+                continue
+
             out[section_kind].append(
                 OutputSection(obj_file_path.name, section.name)
             )
@@ -519,7 +526,23 @@ def parse_input_string(line):
     return mem_region, phdr, flag_list, file_list
 
 
-# Create a dict with key as memory type and files as a list of values.
+# Remove the section filter from the flags, return the remaining flags and the
+# compiled filter, or None if there is no filter
+def parse_section_filter(flag_list):
+    section_filter = None
+    flags = []
+
+    for flag in flag_list:
+        if flag.startswith('FILTER='):
+            section_filter = re.compile(bytes.fromhex(flag[len('FILTER='):]).decode())
+        else:
+            flags.append(flag)
+
+    return flags, section_filter
+
+
+# Create a dict with key as memory type and (file, section filter) tuples as
+# a list of values.
 # Also, return another dict with program headers for memory regions
 def create_dict_wrt_mem():
     # need to support wild card *
@@ -534,6 +557,7 @@ def create_dict_wrt_mem():
             continue
 
         mem_region, phdr, flag_list, file_list = parse_input_string(line)
+        flag_list, section_filter = parse_section_filter(flag_list)
 
         # Handle any program header
         if phdr != '':
@@ -548,7 +572,7 @@ def create_dict_wrt_mem():
                 continue
             elif len(glob_results) > 1:
                 warnings.warn("Regex in file lists is deprecated, please use file(GLOB) instead")
-            file_name_list.extend(glob_results)
+            file_name_list.extend((f, section_filter) for f in glob_results)
         if len(file_name_list) == 0:
             continue
         if mem_region == '':
@@ -585,13 +609,13 @@ def main():
     for memory_type, files in rel_dict.items():
         full_list_of_sections: 'dict[SectionKind, list[OutputSection]]' = defaultdict(list)
 
-        for filename in files:
+        for filename, section_filter in files:
             obj_filename = get_obj_filename(searchpath, filename)
             # the obj file wasn't found. Probably not compiled.
             if not obj_filename:
                 continue
 
-            file_sections = find_sections(obj_filename)
+            file_sections = find_sections(obj_filename, section_filter)
             # Merge sections from file into collection of sections for all files
             for category, sections in file_sections.items():
                 full_list_of_sections[category].extend(sections)
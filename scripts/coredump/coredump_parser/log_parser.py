@@ -20,9 +20,16 @@ LOG_ARCH_HDR_SIZE = struct.calcsize(LOG_ARCH_HDR_STRUCT)
 
 COREDUMP_MEM_HDR_ID = b'M'
 COREDUMP_MEM_HDR_VER = 1
+COREDUMP_MEM_HDR_VER_CHUNKED = 2
 LOG_MEM_HDR_STRUCT = "<cH"
 LOG_MEM_HDR_SIZE = struct.calcsize(LOG_MEM_HDR_STRUCT)
 
+COREDUMP_MEM_CHUNK_RAW = b'R'
+COREDUMP_MEM_CHUNK_LZ4 = b'L'
+COREDUMP_MEM_CHUNK_ZERO = b'Z'
+LOG_MEM_CHUNK_HDR_STRUCT = "<cHH"
+LOG_MEM_CHUNK_HDR_SIZE = struct.calcsize(LOG_MEM_CHUNK_HDR_STRUCT)
+
 
 logger = logging.getLogger("parser")
 
@@ -45,6 +52,52 @@ def reason_string(reason):
     return ret
 
 
+def lz4_block_decompress(src, size):
+    """
+    Decompress a LZ4 block of the given decompressed size.
+    """
+    dst = bytearray()
+    idx = 0
+
+    def read_length(length):
+        nonlocal idx
+        if length == 15:
+            while True:
+                byte = src[idx]
+                idx += 1
+                length += byte
+                if byte != 255:
+                    break
+        return length
+
+    while idx < len(src):
+        token = src[idx]
+        idx += 1
+
+        literals = read_length(token >> 4)
+        dst += src[idx:idx + literals]
+        idx += literals
+
+        # The last sequence only has literals
+        if idx >= len(src):
+            break
+
+        offset = src[idx] | (src[idx + 1] << 8)
+        idx += 2
+        if offset == 0 or offset > len(dst):
+            raise ValueError("Invalid LZ4 match offset")
+
+        # Matches may overlap the bytes they produce
+        match = len(dst) - offset
+        for i in range(read_length(token & 0xf) + 4):
+            dst.append(dst[match + i])
+
+    if len(dst) != size:
+        raise ValueError(f"LZ4 block of {len(dst)} bytes, expected {size}")
+
+    return bytes(dst)
+
+
 class CoredumpLogFile:
     """
     Process the binary coredump file for register block
@@ -85,8 +138,9 @@ class CoredumpLogFile:
         hdr = self.fd.read(LOG_MEM_HDR_SIZE)
         _, hdr_ver = struct.unpack(LOG_MEM_HDR_STRUCT, hdr)
 
-        if hdr_ver != COREDUMP_MEM_HDR_VER:
-            logger.error(f"Memory block version: {hdr_ver}, expected {COREDUMP_MEM_HDR_VER}!")
+        if hdr_ver not in (COREDUMP_MEM_HDR_VER, COREDUMP_MEM_HDR_VER_CHUNKED):
+            logger.error(f"Memory block version: {hdr_ver}, expected {COREDUMP_MEM_HDR_VER}"
+                         f" or {COREDUMP_MEM_HDR_VER_CHUNKED}!")
             return False
 
         # Figure out how to read the start and end addresses
@@ -103,7 +157,12 @@ class CoredumpLogFile:
 
         size = eaddr - saddr
 
-        data = self.fd.read(size)
+        if hdr_ver == COREDUMP_MEM_HDR_VER_CHUNKED:
+            data = self.read_memory_chunks(size)
+            if data is None:
+                return False
+        else:
+            data = self.fd.read(size)
 
         mem = {"start": saddr, "end": eaddr, "data": data}
         self.memory_regions.append(mem)
@@ -113,6 +172,39 @@ class CoredumpLogFile:
 
         return True
 
+    def read_memory_chunks(self, size):
+        data = bytearray()
+
+        while len(data) < size:
+            hdr = self.fd.read(LOG_MEM_CHUNK_HDR_SIZE)
+            if len(hdr) != LOG_MEM_CHUNK_HDR_SIZE:
+                logger.error("Truncated memory chunk")
+                return None
+
+            chunk_type, chunk_size, data_size = struct.unpack(LOG_MEM_CHUNK_HDR_STRUCT, hdr)
+            chunk_data = self.fd.read(data_size)
+
+            if chunk_type == COREDUMP_MEM_CHUNK_ZERO:
+                # Zero or unused memory
+                data += bytes(chunk_size)
+            elif chunk_type == COREDUMP_MEM_CHUNK_RAW:
+                data += chunk_data
+            elif chunk_type == COREDUMP_MEM_CHUNK_LZ4:
+                try:
+                    data += lz4_block_decompress(chunk_data, chunk_size)
+                except (ValueError, IndexError) as e:
+                    logger.error(f"Cannot decompress memory chunk: {e}")
+                    return None
+            else:
+                logger.error(f"Unknown memory chunk type {chunk_type}")
+                return None
+
+        if len(data) != size:
+            logger.error("Memory chunks do not match the memory block size")
+            return None
+
+        return bytes(data)
+
     def parse(self):
         if self.fd is None:
             self.open()
@@ -59,6 +59,28 @@ FMT_MSG_TIMESTAMP_64 = "Q"
 # Keep message types in sync with include/logging/log_output_dict.h
 MSG_TYPE_NORMAL = 0
 MSG_TYPE_DROPPED = 1
+MSG_TYPE_COMPACT = 2
+MSG_TYPE_LZ4_FRAME = 3
+
+# Compact message (CONFIG_LOG_DICTIONARY_COMPACT), all fields are
+# LEB128 varints unless noted:
+#
+#   timestamp delta from previous compact message
+#   (source_id << 6) | (domain << 3) | level
+#   length of package without string table, followed by these bytes
+#   for each string of the package string table:
+#     string index (byte), location (byte), then depending on location:
+#       INTERN_INLINE: null-terminated string
+#       INTERN_DEFINE: cache slot, null-terminated string
+#       INTERN_REF:    cache slot
+#   length of hexdump data, followed by these bytes
+#
+# LZ4 frame (CONFIG_LOG_DICTIONARY_COMPACT_LZ4):
+#
+#   uncompressed length, compressed length, LZ4 block
+INTERN_INLINE = 0
+INTERN_DEFINE = 1
+INTERN_REF = 2
 
 # Number of dropped messages
 FMT_DROPPED_CNT = "H"
@@ -190,8 +212,14 @@ class LogParserV1(LogParser):
         else:
             self.fmt_msg_timestamp = endian + FMT_MSG_TIMESTAMP_32
 
+        self.timestamp_mask = (1 << (8 * struct.calcsize(self.fmt_msg_timestamp))) - 1
+
         self.data_types = DataTypes(self.database)
 
+        # State of compact messages
+        self.compact_timestamp = 0
+        self.intern_tbl = {}
+
 
     def __get_string(self, arg, arg_offset, string_tbl):
         one_str = self.database.find_string(arg)
@@ -374,20 +402,33 @@ class LogParserV1(LogParser):
         pkg_len = (log_desc >> 6) & int(math.pow(2, 10) - 1)
         data_len = (log_desc >> 16) & int(math.pow(2, 12) - 1)
 
+        # Skip over data to point to next message (save as return value)
+        next_msg_offset = offset + pkg_len + data_len
+
+        ret = self.print_one_msg(logdata[offset:(offset + pkg_len)],
+                                 logdata[(offset + pkg_len):next_msg_offset],
+                                 level, timestamp, domain_id, source_id)
+        if not ret:
+            return None
+
+        # Point to next message
+        return next_msg_offset
+
+
+    def print_one_msg(self, logdata, extra_data, level, timestamp, domain_id, source_id):
+        """Print one log message from its package and hexdump data"""
         level_str, color = get_log_level_str_color(level)
         source_id_str = self.database.get_log_source_string(domain_id, source_id)
 
-        # Skip over data to point to next message (save as return value)
-        next_msg_offset = offset + pkg_len + data_len
+        offset = 0
+        pkg_len = len(logdata)
+        data_len = len(extra_data)
 
         # Offset from beginning of cbprintf_packaged data to end of va_list arguments
         offset_end_of_args = struct.unpack_from("B", logdata, offset)[0]
         offset_end_of_args *= self.data_types.get_sizeof(DataTypes.INT)
         offset_end_of_args += offset
 
-        # Extra data after packaged log
-        extra_data = logdata[(offset + pkg_len):next_msg_offset]
-
         # Number of appended strings in package
         num_packed_strings = struct.unpack_from("B", logdata, offset+1)[0]
 
@@ -404,7 +445,7 @@ class LogParserV1(LogParser):
 
         if len(string_tbl) != num_packed_strings:
             logger.error("------ Error extracting string table")
-            return None
+            return False
 
         # Skip packaged string header
         offset += self.data_types.get_sizeof(DataTypes.PTR)
@@ -424,7 +465,7 @@ class LogParserV1(LogParser):
 
         if not fmt_str:
             logger.error("------ Error getting format string at 0x%x", fmt_str_ptr)
-            return None
+            return False
 
         args = self.process_one_fmt_str(fmt_str, logdata[offset:offset_end_of_args], string_tbl)
 
@@ -441,8 +482,102 @@ class LogParserV1(LogParser):
             # Has hexdump data
             self.print_hexdump(extra_data, len(log_prefix), color)
 
-        # Point to next message
-        return next_msg_offset
+        return True
+
+
+    @staticmethod
+    def get_varint(logdata, offset):
+        """Decode one LEB128 varint, return value and offset after it"""
+        val = 0
+        shift = 0
+
+        while True:
+            byte = logdata[offset]
+            offset += 1
+            val |= (byte & 0x7f) << shift
+            shift += 7
+
+            if byte & 0x80 == 0:
+                return val, offset
+
+
+    @staticmethod
+    def get_cstring(logdata, offset):
+        """Get one null-terminated string, return it and offset after it"""
+        end = logdata.index(0, offset)
+
+        return logdata[offset:end], end + 1
+
+
+    def parse_one_compact_msg(self, logdata, offset):
+        """Parse one compact log message and print the encoded message"""
+        delta, offset = self.get_varint(logdata, offset)
+        self.compact_timestamp = (self.compact_timestamp + delta) & self.timestamp_mask
+
+        desc, offset = self.get_varint(logdata, offset)
+        level = desc & 0x07
+        domain_id = (desc >> 3) & 0x07
+        source_id = desc >> 6
+
+        head_len, offset = self.get_varint(logdata, offset)
+        pkg = bytearray(logdata[offset:(offset + head_len)])
+        offset += head_len
+
+        # Rebuild the string table of the package
+        num_packed_strings = pkg[1] if head_len > 1 else 0
+        for _ in range(num_packed_strings):
+            str_idx = logdata[offset]
+            location = logdata[offset + 1]
+            offset += 2
+
+            if location == INTERN_REF:
+                slot, offset = self.get_varint(logdata, offset)
+                if slot not in self.intern_tbl:
+                    logger.error("------ Unknown string cache slot %d", slot)
+                    return None
+
+                one_str = self.intern_tbl[slot]
+            elif location == INTERN_DEFINE:
+                slot, offset = self.get_varint(logdata, offset)
+                one_str, offset = self.get_cstring(logdata, offset)
+                self.intern_tbl[slot] = one_str
+            elif location == INTERN_INLINE:
+                one_str, offset = self.get_cstring(logdata, offset)
+            else:
+                logger.error("------ Unknown string location: %s", location)
+                return None
+
+            pkg += bytes([str_idx]) + one_str + b'\0'
+
+        data_len, offset = self.get_varint(logdata, offset)
+        extra_data = logdata[offset:(offset + data_len)]
+        offset += data_len
+
+        if not self.print_one_msg(bytes(pkg), extra_data, level, self.compact_timestamp,
+                                  domain_id, source_id):
+            return None
+
+        return offset
+
+
+    def parse_one_lz4_frame(self, logdata, offset, debug):
+        """Decompress one LZ4 frame and parse the messages in it"""
+        try:
+            import lz4.block  # pylint: disable=import-outside-toplevel
+        except ImportError:
+            logger.error("------ Python lz4 module is required for compressed log data")
+            return None
+
+        raw_len, offset = self.get_varint(logdata, offset)
+        comp_len, offset = self.get_varint(logdata, offset)
+
+        frame = lz4.block.decompress(logdata[offset:(offset + comp_len)],
+                                     uncompressed_size=raw_len)
+
+        if not self.parse_log_data(frame, debug):
+            return None
+
+        return offset + comp_len
 
 
     def parse_log_data(self, logdata, debug=False):
@@ -467,6 +602,20 @@ class LogParserV1(LogParser):
 
                 offset = ret
 
+            elif msg_type == MSG_TYPE_COMPACT:
+                ret = self.parse_one_compact_msg(logdata, offset)
+                if ret is None:
+                    return False
+
+                offset = ret
+
+            elif msg_type == MSG_TYPE_LZ4_FRAME:
+                ret = self.parse_one_lz4_frame(logdata, offset, debug)
+                if ret is None:
+                    return False
+
+                offset = ret
+
             else:
                 logger.error("------ Unknown message type: %s", msg_type)
                 return False
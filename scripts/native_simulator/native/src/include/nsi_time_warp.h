@@ -0,0 +1,25 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef NATIVE_SIMULATOR_NATIVE_SRC_NSI_TIME_WARP_H
+#define NATIVE_SIMULATOR_NATIVE_SRC_NSI_TIME_WARP_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+bool nsi_time_warp_enabled(void);
+uint64_t nsi_time_warp_get_offset(void);
+void nsi_time_warp_sleep_until(uint64_t wake_time);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NATIVE_SIMULATOR_NATIVE_SRC_NSI_TIME_WARP_H */
@@ -0,0 +1,373 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Time warp of a group of native simulator instances running in real time
+ *
+ * The instances of a group exchange data through host bridges (e.g. TAP
+ * interfaces or pseudo-terminals), so that they must run in real time to see
+ * each other at the right time. But when all of them sleep, waiting for the
+ * real time of their next tick, nothing can happen in the group until the
+ * earliest of these ticks: the group then jumps to it right away.
+ *
+ * The group time is the host monotonic time plus an offset, which only
+ * grows with each jump. It is kept in a file mapped in memory by all the
+ * instances, with the time each sleeping instance waits for. As the
+ * instances are started one after the other, the group does not jump until
+ * the expected number of them has joined.
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "nsi_cmdline.h"
+#include "nsi_hw_scheduler.h"
+#include "nsi_tasks.h"
+#include "nsi_timer_model.h"
+#include "nsi_time_warp.h"
+#include "nsi_tracing.h"
+#include "nsi_utils.h"
+
+#define WARP_GROUP_MAGIC 0x4e535457U
+#define WARP_GROUP_MAX_MEMBERS 64
+
+/* Defined in timer_model.c */
+uint64_t get_host_us_time(void);
+
+struct warp_member {
+	pid_t pid;		/* 0 if the slot is free */
+	uint64_t wake_time;	/* Group time the member sleeps until, or NSI_NEVER */
+};
+
+struct warp_group {
+	uint32_t magic;
+	pthread_mutex_t lock;
+	pthread_cond_t cond;
+	uint64_t offset;	/* Group time - host time, in microseconds */
+	uint32_t members;
+	uint32_t sleeping;
+	uint32_t joined;	/* Members which ever joined */
+	uint32_t expected;	/* Members to wait for before the first jump */
+	struct warp_member member[WARP_GROUP_MAX_MEMBERS];
+};
+
+static char *warp_file;
+static uint32_t warp_members;
+static struct warp_group *group;
+static struct warp_member *self;
+
+bool nsi_time_warp_enabled(void)
+{
+	return group != NULL;
+}
+
+/**
+ * Return the time skipped so far by the group, in microseconds
+ */
+uint64_t nsi_time_warp_get_offset(void)
+{
+	if (group == NULL) {
+		return 0;
+	}
+
+	return __atomic_load_n(&group->offset, __ATOMIC_ACQUIRE);
+}
+
+/* Free the slots of the members which exited without leaving the group */
+static void group_purge(void)
+{
+	for (int i = 0; i < WARP_GROUP_MAX_MEMBERS; i++) {
+		struct warp_member *m = &group->member[i];
+
+		if (m->pid == 0 || m == self) {
+			continue;
+		}
+
+		if (kill(m->pid, 0) != 0 && errno == ESRCH) {
+			if (m->wake_time != NSI_NEVER) {
+				group->sleeping--;
+			}
+			m->pid = 0;
+			m->wake_time = NSI_NEVER;
+			group->members--;
+		}
+	}
+}
+
+static void group_lock(void)
+{
+	int ret = pthread_mutex_lock(&group->lock);
+
+	if (ret == EOWNERDEAD) {
+		/* A member died while holding the lock */
+		group_purge();
+		pthread_mutex_consistent(&group->lock);
+	} else if (ret != 0) {
+		nsi_print_error_and_exit("%s: Could not lock the time warp group (%i)\n",
+					 __func__, ret);
+	}
+}
+
+static void group_unlock(void)
+{
+	pthread_mutex_unlock(&group->lock);
+}
+
+static void group_init(void)
+{
+	pthread_mutexattr_t mattr;
+	pthread_condattr_t cattr;
+
+	memset(group, 0, sizeof(*group));
+
+	pthread_mutexattr_init(&mattr);
+	pthread_mutexattr_setpshared(&mattr, PTHREAD_PROCESS_SHARED);
+	pthread_mutexattr_setrobust(&mattr, PTHREAD_MUTEX_ROBUST);
+	pthread_mutex_init(&group->lock, &mattr);
+	pthread_mutexattr_destroy(&mattr);
+
+	pthread_condattr_init(&cattr);
+	pthread_condattr_setpshared(&cattr, PTHREAD_PROCESS_SHARED);
+	pthread_condattr_setclock(&cattr, CLOCK_MONOTONIC);
+	pthread_cond_init(&group->cond, &cattr);
+	pthread_condattr_destroy(&cattr);
+
+	for (int i = 0; i < WARP_GROUP_MAX_MEMBERS; i++) {
+		group->member[i].wake_time = NSI_NEVER;
+	}
+
+	group->magic = WARP_GROUP_MAGIC;
+}
+
+/*
+ * Jump to the earliest wake up time of the members when all of them sleep.
+ * Return true if the group time moved.
+ */
+static bool group_warp(uint64_t now)
+{
+	uint64_t earliest = NSI_NEVER;
+
+	if (group->sleeping != group->members || group->joined < group->expected) {
+		return false;
+	}
+
+	for (int i = 0; i < WARP_GROUP_MAX_MEMBERS; i++) {
+		if (group->member[i].pid != 0) {
+			earliest = NSI_MIN(earliest, group->member[i].wake_time);
+		}
+	}
+
+	/* A member may already be due but not have woken up yet */
+	if (earliest == NSI_NEVER || earliest <= now) {
+		return false;
+	}
+
+	__atomic_store_n(&group->offset, group->offset + (earliest - now), __ATOMIC_RELEASE);
+	pthread_cond_broadcast(&group->cond);
+
+	return true;
+}
+
+/* Wait for up to <delay> microseconds, or until another member changed the group */
+static void group_wait(uint64_t delay)
+{
+	struct timespec ts;
+	int ret;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	ts.tv_sec += delay / 1000000U;
+	ts.tv_nsec += (delay % 1000000U) * 1000U;
+	if (ts.tv_nsec >= 1000000000L) {
+		ts.tv_sec += 1;
+		ts.tv_nsec -= 1000000000L;
+	}
+
+	ret = pthread_cond_timedwait(&group->cond, &group->lock, &ts);
+	if (ret == EOWNERDEAD) {
+		group_purge();
+		pthread_mutex_consistent(&group->lock);
+	} else if (ret == ETIMEDOUT) {
+		/* A member which does not sleep may be dead */
+		group_purge();
+	}
+}
+
+/**
+ * Sleep until the group time <wake_time>, in microseconds, which comes
+ * right away if all the other members of the group sleep longer
+ */
+void nsi_time_warp_sleep_until(uint64_t wake_time)
+{
+	uint64_t now;
+
+	group_lock();
+
+	self->wake_time = wake_time;
+	group->sleeping++;
+
+	while (true) {
+		now = get_host_us_time() + group->offset;
+		if (now >= wake_time) {
+			break;
+		}
+
+		if (group_warp(now)) {
+			continue;
+		}
+
+		group_wait(wake_time - now);
+	}
+
+	self->wake_time = NSI_NEVER;
+	group->sleeping--;
+
+	group_unlock();
+}
+
+static void time_warp_join(void)
+{
+	struct flock fl = {
+		.l_type = F_WRLCK,
+		.l_whence = SEEK_SET,
+	};
+	struct stat st;
+	int fd;
+
+	if (warp_file == NULL) {
+		return;
+	}
+
+	fd = open(warp_file, O_RDWR | O_CREAT, 0600);
+	if (fd < 0) {
+		nsi_print_error_and_exit("%s: Could not open %s (%s)\n",
+					 __func__, warp_file, strerror(errno));
+	}
+
+	/* Serialize the creation of the group with the other instances */
+	if (fcntl(fd, F_SETLKW, &fl) != 0 || fstat(fd, &st) != 0) {
+		nsi_print_error_and_exit("%s: Could not lock %s (%s)\n",
+					 __func__, warp_file, strerror(errno));
+	}
+
+	if (st.st_size == 0) {
+		if (ftruncate(fd, sizeof(*group)) != 0) {
+			nsi_print_error_and_exit("%s: Could not size %s (%s)\n",
+						 __func__, warp_file, strerror(errno));
+		}
+	} else if (st.st_size != sizeof(*group)) {
+		nsi_print_error_and_exit("%s: %s is not the time warp group of a "
+					 "compatible instance\n", __func__, warp_file);
+	}
+
+	group = mmap(NULL, sizeof(*group), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	if (group == MAP_FAILED) {
+		nsi_print_error_and_exit("%s: Could not map %s (%s)\n",
+					 __func__, warp_file, strerror(errno));
+	}
+
+	if (group->magic != WARP_GROUP_MAGIC) {
+		group_init();
+	}
+
+	group_lock();
+	group_purge();
+
+	for (int i = 0; i < WARP_GROUP_MAX_MEMBERS; i++) {
+		if (group->member[i].pid == 0) {
+			self = &group->member[i];
+			break;
+		}
+	}
+
+	if (self == NULL) {
+		nsi_print_error_and_exit("%s: The time warp group is limited to %i instances\n",
+					 __func__, WARP_GROUP_MAX_MEMBERS);
+	}
+
+	self->pid = getpid();
+	self->wake_time = NSI_NEVER;
+	group->members++;
+	group->joined++;
+
+	if (warp_members != UINT32_MAX) {
+		group->expected = NSI_MAX(group->expected, warp_members);
+	}
+
+	/* The members waiting for this one to join may jump now */
+	pthread_cond_broadcast(&group->cond);
+
+	group_unlock();
+
+	fl.l_type = F_UNLCK;
+	(void)fcntl(fd, F_SETLK, &fl);
+	close(fd);
+}
+
+NSI_TASK(time_warp_join, PRE_BOOT_2, 10);
+
+static void time_warp_leave(void)
+{
+	if (self == NULL) {
+		return;
+	}
+
+	group_lock();
+
+	self->pid = 0;
+	self->wake_time = NSI_NEVER;
+	group->members--;
+	self = NULL;
+
+	/* The remaining members may all be sleeping now */
+	pthread_cond_broadcast(&group->cond);
+
+	group_unlock();
+}
+
+NSI_TASK(time_warp_leave, ON_EXIT_PRE, 10);
+
+static void cmd_time_warp_found(char *argv, int offset)
+{
+	NSI_ARG_UNUSED(argv);
+	NSI_ARG_UNUSED(offset);
+	hwtimer_set_real_time_mode(true);
+}
+
+static void nsi_add_time_warp_options(void)
+{
+	static struct args_struct_t time_warp_options[] = {
+		{
+			.option = "time-warp",
+			.name = "file",
+			.type = 's',
+			.dest = (void *)&warp_file,
+			.call_when_found = cmd_time_warp_found,
+			.descript = "Run in real time (as with --rt) in a group of instances "
+				    "given the same file, skipping the idle periods during which "
+				    "all of them sleep. The file is created if needed"
+		},
+		{
+			.option = "time-warp-members",
+			.name = "count",
+			.type = 'u',
+			.dest = (void *)&warp_members,
+			.descript = "Number of instances of the time warp group to wait for "
+				    "before skipping any idle period (1 by default)"
+		},
+		ARG_TABLE_ENDMARKER};
+
+	nsi_add_command_line_opts(time_warp_options);
+}
+
+NSI_TASK(nsi_add_time_warp_options, PRE_BOOT_1, 2);
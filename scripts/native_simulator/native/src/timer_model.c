@@ -25,6 +25,7 @@
 #include "irq_ctrl.h"
 #include "nsi_tasks.h"
 #include "nsi_hws_models_if.h"
+#include "nsi_time_warp.h"
 
 #define DEBUG_NP_TIMER 0
 
@@ -139,6 +140,15 @@ uint64_t get_host_us_time(void)
 	return (uint64_t)tv.tv_sec * 1e6 + tv.tv_nsec / 1000;
 }
 
+/*
+ * Real time as seen by this model: the host time, plus the idle time skipped
+ * so far by the time warp group, if any
+ */
+static uint64_t get_real_us_time(void)
+{
+	return get_host_us_time() + nsi_time_warp_get_offset();
+}
+
 static void hwtimer_init(void)
 {
 	silent_ticks = 0;
@@ -146,7 +156,7 @@ static void hwtimer_init(void)
 	hw_timer_awake_timer = NSI_NEVER;
 	hwtimer_update_timer();
 	if (real_time_mode) {
-		boot_time = get_host_us_time();
+		boot_time = get_real_us_time();
 		last_radj_rtime = boot_time;
 		last_radj_stime = 0U;
 	}
@@ -180,7 +190,7 @@ static void hwtimer_tick_timer_reached(void)
 		uint64_t expected_rt = (hw_timer_tick_timer - last_radj_stime)
 				    / clock_ratio
 				    + last_radj_rtime;
-		uint64_t real_time = get_host_us_time();
+		uint64_t real_time = get_real_us_time();
 
 		int64_t diff = expected_rt - real_time;
 
@@ -195,7 +205,9 @@ static void hwtimer_tick_timer_reached(void)
 			hw_timer_tick_timer/1000U, diff, es, rs);
 #endif
 
-		if (diff > 0) { /* we need to slow down */
+		if (diff > 0 && nsi_time_warp_enabled()) {
+			nsi_time_warp_sleep_until(expected_rt);
+		} else if (diff > 0) { /* we need to slow down */
 			struct timespec requested_time;
 			struct timespec remaining;
 
@@ -389,7 +401,8 @@ void hwtimer_get_pseudohost_rtc_time(uint32_t *nsec, uint64_t *sec)
 
 	host_clock_gettime(&tv);
 
-	uint64_t rt_us = (uint64_t)tv.tv_sec * 1000000ULL + tv.tv_nsec / 1000;
+	uint64_t rt_us = (uint64_t)tv.tv_sec * 1000000ULL + tv.tv_nsec / 1000 +
+			 nsi_time_warp_get_offset();
 	uint32_t rt_ns = tv.tv_nsec % 1000;
 
 	long double drt_us = (long double)rt_us - last_radj_rtime;
@@ -0,0 +1,170 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2024 The Zephyr Project Contributors
+#
+# SPDX-License-Identifier: Apache-2.0
+
+"""Generate code relocation directives for the hottest functions.
+
+Reads function level hit counts, either as the folded stacks written by
+symbolize.py, where the samples are counted for the interrupted functions,
+or as "<function> <count>" lines from any other source. The functions are
+looked up in the object files of a build done with -ffunction-sections, and
+the hottest ones are selected by hits per byte until the budget is used.
+
+The output is a CMake file with zephyr_code_relocate() calls, one per
+library, relocating the selected functions with a section FILTER, e.g.:
+
+    hot_relocate.py -d build --location ITCM_TEXT --budget 16384 \\
+        --flash-location FLASH_TEXT profile.folded > hot.cmake
+
+and in the CMakeLists.txt of the application, with
+CONFIG_CODE_DATA_RELOCATION=y:
+
+    include(hot.cmake)
+
+With --flash-location, the sampled functions which do not fit in the budget
+are relocated without copy to the start of the flash text, next to each
+other, which improves the locality in the cache of XIP flash.
+"""
+
+import argparse
+import collections
+import os
+import re
+import sys
+
+from elftools.elf.elffile import ELFFile
+
+FOLDED_RE = re.compile(r"^(\S+) (\d+)\s*$")
+LIB_DIR_RE = re.compile(r"CMakeFiles[/\\]([^/\\]+)\.dir([/\\]|$)")
+
+# Functions are aligned in the relocated section
+ALIGNMENT = 4
+
+
+def read_hits(stream, folded):
+    hits = collections.Counter()
+
+    for line in stream:
+        m = FOLDED_RE.match(line)
+        if m is None:
+            continue
+        frames, count = m.group(1).split(";"), int(m.group(2))
+        if folded:
+            # The first frame is the thread, the last one was interrupted
+            if len(frames) < 2:
+                continue
+        hits[frames[-1]] += count
+
+    return hits
+
+
+def scan_objects(build_dir):
+    """Map the function sections to the libraries and sizes of their objects"""
+    functions = collections.defaultdict(list)
+
+    for dirpath, _, files in os.walk(build_dir):
+        m = LIB_DIR_RE.search(dirpath)
+        if m is None:
+            continue
+        lib = m.group(1)
+        for name in files:
+            if not name.endswith(".obj"):
+                continue
+            with open(os.path.join(dirpath, name), "rb") as f:
+                try:
+                    elf = ELFFile(f)
+                except Exception:
+                    continue
+                for section in elf.iter_sections():
+                    if section.name.startswith(".text."):
+                        functions[section.name[len(".text."):]].append(
+                            (lib, name, section["sh_size"]))
+
+    return functions
+
+
+def select(hits, functions, budget):
+    candidates = []
+
+    for name, count in hits.items():
+        if name not in functions:
+            print(f"warning: no section for {name}, not built with "
+                  "-ffunction-sections or not a function", file=sys.stderr)
+            continue
+        objs = functions[name]
+        if len(objs) > 1:
+            print(f"warning: {name} is defined in {len(objs)} objects, "
+                  "relocating all of them", file=sys.stderr)
+        size = sum(-(-s // ALIGNMENT) * ALIGNMENT for _, _, s in objs)
+        candidates.append((count / max(size, 1), count, size, name))
+
+    selected, rest = [], []
+    used = 0
+
+    for _, count, size, name in sorted(candidates, reverse=True):
+        if used + size <= budget:
+            selected.append(name)
+            used += size
+        else:
+            rest.append(name)
+
+    return selected, rest, used
+
+
+def directives(names, functions, location, extra=""):
+    by_lib = collections.defaultdict(set)
+
+    for name in names:
+        for lib, _, _ in functions[name]:
+            by_lib[lib].add(name)
+
+    out = []
+    for lib, libnames in sorted(by_lib.items()):
+        regex = "^\\.text\\.(" + "|".join(re.escape(n) for n in sorted(libnames)) + ")$"
+        regex = regex.replace("\\", "\\\\")
+        out.append(f'zephyr_code_relocate(LIBRARY {lib} LOCATION {location}{extra}\n'
+                   f'  FILTER "{regex}")')
+
+    return out
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("-d", "--build-dir", required=True,
+                        help="build directory of the profiled application")
+    parser.add_argument("--location", default="ITCM_TEXT",
+                        help="relocation location of the hottest functions")
+    parser.add_argument("--budget", type=int, required=True,
+                        help="maximum size in bytes of the relocated functions")
+    parser.add_argument("--flash-location",
+                        help="location of the other sampled functions, e.g. FLASH_TEXT")
+    parser.add_argument("--counts", action="store_true",
+                        help="the input has \"<function> <count>\" lines")
+    parser.add_argument("input", nargs="?", type=argparse.FileType("r"),
+                        default=sys.stdin, help="profile data, default stdin")
+    args = parser.parse_args()
+
+    hits = read_hits(args.input, not args.counts)
+    functions = scan_objects(args.build_dir)
+    selected, rest, used = select(hits, functions, args.budget)
+
+    total = sum(hits.values())
+    covered = sum(hits[n] for n in selected)
+
+    print("# Generated by scripts/profiler/hot_relocate.py, do not edit")
+    print(f"# {len(selected)} functions, {used} of {args.budget} bytes, "
+          f"{covered} of {total} samples")
+    for line in directives(selected, functions, args.location):
+        print(line)
+
+    if args.flash_location and rest:
+        print(f"# Link order: {len(rest)} sampled functions outside of the budget")
+        for line in directives(rest, functions, args.flash_location, " NOCOPY"):
+            print(line)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,84 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2024 The Zephyr Project Contributors
+#
+# SPDX-License-Identifier: Apache-2.0
+
+"""Convert the folded stacks dumped by the profiler to function names.
+
+Reads the output of the "profiler dump" shell command, ignoring the lines
+which are not folded stacks, and writes the folded stacks with the addresses
+replaced by the names of the functions found in the ELF file. The output is
+the input of flame graph tools, e.g.:
+
+    symbolize.py build/zephyr/zephyr.elf dump.txt | flamegraph.pl > cpu.svg
+"""
+
+import argparse
+import bisect
+import re
+import sys
+
+from elftools.elf.elffile import ELFFile
+from elftools.elf.sections import SymbolTableSection
+
+FOLDED_RE = re.compile(r"(\S+?)((?:;0x[0-9a-fA-F]+)*) (\d+)\s*$")
+
+
+def load_functions(path):
+    functions = []
+
+    with open(path, "rb") as f:
+        elf = ELFFile(f)
+        thumb = elf["e_machine"] == "EM_ARM"
+        for section in elf.iter_sections():
+            if not isinstance(section, SymbolTableSection):
+                continue
+            for sym in section.iter_symbols():
+                if sym["st_info"]["type"] != "STT_FUNC" or sym["st_value"] == 0:
+                    continue
+                addr = sym["st_value"] & ~1 if thumb else sym["st_value"]
+                functions.append((addr, sym["st_size"], sym.name))
+
+    functions.sort()
+    return functions
+
+
+def lookup(functions, starts, addr):
+    i = bisect.bisect_right(starts, addr) - 1
+    if i >= 0:
+        start, size, name = functions[i]
+        if addr < start + max(size, 1):
+            return name
+    return f"0x{addr:x}"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("elf", help="ELF file of the profiled application")
+    parser.add_argument("input", nargs="?", type=argparse.FileType("r"),
+                        default=sys.stdin, help="profiler dump, default stdin")
+    args = parser.parse_args()
+
+    functions = load_functions(args.elf)
+    starts = [f[0] for f in functions]
+
+    for line in args.input:
+        m = FOLDED_RE.search(line)
+        if m is None:
+            continue
+        thread, addrs, count = m.groups()
+        addrs = [int(a, 16) for a in addrs.split(";")[1:]]
+        frames = []
+        for i, addr in enumerate(addrs):
+            # The callers are recorded by their return address, which may
+            # be past the end of the calling function
+            if i < len(addrs) - 1:
+                addr -= 1
+            frames.append(lookup(functions, starts, addr))
+        print(";".join([thread] + frames) + f" {count}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,61 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2024 The Zephyr Project Contributors
+#
+# SPDX-License-Identifier: Apache-2.0
+"""
+Script to split tracing data captured with CONFIG_TRACING_BUFFER_PER_CPU into
+one stream file per CPU.
+
+The data is a sequence of chunks, each preceded by the CPU number (1 byte)
+and the length of the chunk (2 bytes, little endian). The chunks of each CPU
+are written to <output>/channel0_<cpu>. With the compact CTF format, trace
+viewers merge the streams by their timestamps:
+
+    ./scripts/tracing/split_cpu_streams.py -i channel0_0 -o ctf
+    cp subsys/tracing/ctf/tsdl/metadata_compact ctf/metadata
+    ./scripts/tracing/parse_ctf.py -t ctf
+"""
+
+import argparse
+import os
+import struct
+import sys
+
+def parse_args():
+    parser = argparse.ArgumentParser(
+        description=__doc__,
+        formatter_class=argparse.RawDescriptionHelpFormatter, allow_abbrev=False)
+    parser.add_argument("-i", "--input", required=True,
+                        help="captured tracing data")
+    parser.add_argument("-o", "--output", required=True,
+                        help="output directory")
+    return parser.parse_args()
+
+def main():
+    args = parse_args()
+
+    with open(args.input, "rb") as f:
+        data = f.read()
+
+    os.makedirs(args.output, exist_ok=True)
+    streams = {}
+    pos = 0
+
+    while pos + 3 <= len(data):
+        cpu, length = struct.unpack_from("<BH", data, pos)
+        pos += 3
+        if pos + length > len(data):
+            print(f"Truncated chunk of CPU {cpu} ignored", file=sys.stderr)
+            break
+        if cpu not in streams:
+            streams[cpu] = open(os.path.join(args.output, f"channel0_{cpu}"), "wb")
+        streams[cpu].write(data[pos:pos + length])
+        pos += length
+
+    for cpu, stream in sorted(streams.items()):
+        print(f"CPU {cpu}: {stream.tell()} bytes")
+        stream.close()
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,137 @@
+#!/usr/bin/env python3
+
+# Copyright (c) 2024 The Zephyr Project Contributors
+# SPDX-License-Identifier: Apache-2.0
+
+"""Make a delta image for CONFIG_IMG_DELTA.
+
+The output is a header holding the magic number, the sizes and the SHA-256
+of the source and new images, followed by operations building the new image
+from the source image: copies of source bytes, additions of data to source
+bytes and insertions of data.  See struct flash_img_delta_hdr.
+
+The source is the signed image of the primary slot of the device.  With
+--lz4, the delta image is compressed as by lz4_dfu_image.py, which also
+needs CONFIG_IMG_LZ4 on the device; additions are only used then, as their
+data is mostly zeros and only pays off once compressed.
+"""
+
+import argparse
+import hashlib
+import os
+import struct
+import sys
+
+MAGIC = 0x49544c44
+OP_COPY = 0
+OP_ADD = 1
+OP_INSERT = 2
+
+SEED = 8
+MIN_MATCH = 16
+MAX_CANDIDATES = 32
+
+
+def match_len(old, o, new, n):
+    """Length of the common run of old[o:] and new[n:]."""
+    end = min(len(old) - o, len(new) - n)
+    length = 0
+    while length + 64 <= end and old[o + length:o + length + 64] == new[n + length:n + length + 64]:
+        length += 64
+    while length < end and old[o + length] == new[n + length]:
+        length += 1
+    return length
+
+
+class Delta:
+    def __init__(self, old, new, add):
+        self.old = old
+        self.new = new
+        self.add = add
+        self.ops = bytearray()
+
+    def op(self, op, length, src_off=0, data=b''):
+        self.ops += struct.pack('<BII', op, length, src_off) + data
+
+    def gap(self, start, end, shift):
+        """Emits new[start:end], close to the source at start + shift."""
+        if start == end:
+            return
+        src = start + shift
+        if self.add and src >= 0 and src + end - start <= len(self.old):
+            diff = bytes((self.new[start + i] - self.old[src + i]) & 0xff
+                         for i in range(end - start))
+            if diff.count(0) * 2 >= len(diff):
+                self.op(OP_ADD, end - start, src, diff)
+                return
+        self.op(OP_INSERT, end - start, 0, self.new[start:end])
+
+    def build(self):
+        old, new = self.old, self.new
+        index = {}
+        for o in range(len(old) - SEED + 1):
+            index.setdefault(old[o:o + SEED], []).append(o)
+
+        i = 0
+        start = 0
+        shift = 0
+        while i < len(new):
+            best, best_src = 0, 0
+            # The alignment of the previous copy is the likeliest one
+            candidates = [i + shift] if 0 <= i + shift < len(old) else []
+            candidates += index.get(new[i:i + SEED], [])[:MAX_CANDIDATES]
+            for o in candidates:
+                length = match_len(old, o, new, i)
+                if length > best:
+                    best, best_src = length, o
+
+            if best < MIN_MATCH:
+                i += 1
+                continue
+
+            self.gap(start, i, shift)
+            self.op(OP_COPY, best, best_src)
+            shift = best_src - i
+            i += best
+            start = i
+
+        self.gap(start, len(new), shift)
+        return self.ops
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('source', help='signed image of the primary slot')
+    parser.add_argument('input', help='new signed image, e.g. zephyr.signed.bin')
+    parser.add_argument('output', help='delta image')
+    parser.add_argument('--lz4', action='store_true',
+                        help='compress the delta image with LZ4')
+    parser.add_argument('--block-size', type=int, default=4096,
+                        help='CONFIG_IMG_LZ4_BLOCK_SIZE of the target (default 4096)')
+    args = parser.parse_args()
+
+    with open(args.source, 'rb') as f:
+        old = f.read()
+    with open(args.input, 'rb') as f:
+        new = f.read()
+
+    out = bytearray(struct.pack('<III', MAGIC, len(old), len(new)))
+    out += hashlib.sha256(old).digest()
+    out += hashlib.sha256(new).digest()
+    out += Delta(old, new, args.lz4).build()
+
+    if args.lz4:
+        sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+        import lz4_dfu_image
+        out = lz4_dfu_image.compress(bytes(out), args.block_size)
+
+    with open(args.output, 'wb') as f:
+        f.write(out)
+
+    print(f'{len(new)} -> {len(out)} bytes ({100 * len(out) // max(len(new), 1)}%)',
+          file=sys.stderr)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,65 @@
+#!/usr/bin/env python3
+
+# Copyright (c) 2024 The Zephyr Project Contributors
+# SPDX-License-Identifier: Apache-2.0
+
+"""Compress a signed image for CONFIG_IMG_LZ4.
+
+The output is a header holding the magic number, the size and the SHA-256
+of the image, followed by blocks compressed independently with LZ4.  Each
+block is preceded by its little endian 32 bit length, bit 31 being set when
+the block is stored uncompressed.  See struct flash_img_lz4_hdr.
+
+Requires the lz4 Python package.
+"""
+
+import argparse
+import hashlib
+import struct
+import sys
+
+import lz4.block
+
+MAGIC = 0x49345a4c
+BLOCK_RAW = 1 << 31
+
+
+def compress(data, block_size):
+    out = bytearray(struct.pack('<II', MAGIC, len(data)))
+    out += hashlib.sha256(data).digest()
+
+    for off in range(0, len(data), block_size):
+        block = data[off:off + block_size]
+        packed = lz4.block.compress(block, mode='high_compression',
+                                    store_size=False)
+        if len(packed) < len(block):
+            out += struct.pack('<I', len(packed)) + packed
+        else:
+            out += struct.pack('<I', len(block) | BLOCK_RAW) + block
+
+    return out
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('input', help='signed image, e.g. zephyr.signed.bin')
+    parser.add_argument('output', help='compressed image')
+    parser.add_argument('--block-size', type=int, default=4096,
+                        help='CONFIG_IMG_LZ4_BLOCK_SIZE of the target (default 4096)')
+    args = parser.parse_args()
+
+    with open(args.input, 'rb') as f:
+        data = f.read()
+
+    out = compress(data, args.block_size)
+
+    with open(args.output, 'wb') as f:
+        f.write(out)
+
+    print(f'{len(data)} -> {len(out)} bytes ({100 * len(out) // max(len(data), 1)}%)',
+          file=sys.stderr)
+
+
+if __name__ == '__main__':
+    main()
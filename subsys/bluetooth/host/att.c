@@ -831,9 +831,12 @@ static void att_req_send_process(struct bt_att *att)
 	struct bt_att_req *req = NULL;
 	struct bt_att_chan *chan, *tmp, *prev = NULL;
 
+	/* Hand out pending requests to every idle bearer, so that independent
+	 * GATT procedures run concurrently when EATT channels are connected.
+	 */
 	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&att->chans, chan, tmp, node) {
 		/* If there is an ongoing transaction, do not use the channel */
-		if (chan->req) {
+		if (chan->req || !atomic_test_bit(chan->flags, ATT_CONNECTED)) {
 			continue;
 		}
 
@@ -854,7 +857,7 @@ static void att_req_send_process(struct bt_att *att)
 		}
 
 		if (bt_att_chan_req_send(chan, req) >= 0) {
-			return;
+			continue;
 		}
 
 		/* Prepend back to the list as it could not be sent */
@@ -3115,6 +3118,11 @@ static void bt_att_connected(struct bt_l2cap_chan *chan)
 	k_work_init_delayable(&att_chan->timeout_work, att_timeout);
 
 	bt_gatt_connected(le_chan->chan.conn);
+
+	/* Requests queued while the bearer was being set up can now use it */
+	if (bt_att_is_enhanced(att_chan) && att_chan->att) {
+		att_req_send_process(att_chan->att);
+	}
 }
 
 static void bt_att_disconnected(struct bt_l2cap_chan *chan)
@@ -3336,6 +3344,26 @@ static struct bt_att_chan *att_chan_new(struct bt_att *att, atomic_val_t flags)
 	return chan;
 }
 
+size_t bt_att_bearer_count(struct bt_conn *conn)
+{
+	struct bt_att *att;
+	struct bt_att_chan *chan;
+	size_t count = 0;
+
+	att = att_get(conn);
+	if (!att) {
+		return 0;
+	}
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&att->chans, chan, node) {
+		if (atomic_test_bit(chan->flags, ATT_CONNECTED)) {
+			count++;
+		}
+	}
+
+	return count;
+}
+
 #if defined(CONFIG_BT_EATT)
 size_t bt_eatt_count(struct bt_conn *conn)
 {
@@ -321,6 +321,9 @@ int bt_eatt_disconnect(struct bt_conn *conn);
  */
 struct bt_att_req *bt_att_find_req_by_user_data(struct bt_conn *conn, const void *user_data);
 
+/* Get the number of connected ATT bearers, enhanced and unenhanced */
+size_t bt_att_bearer_count(struct bt_conn *conn);
+
 /* Checks if only the fixed ATT channel is connected */
 bool bt_att_fixed_chan_only(struct bt_conn *conn);
 
@@ -37,6 +37,7 @@
 #include "conn_internal.h"
 #include "l2cap_internal.h"
 #include "keys.h"
+#include "settings.h"
 #include "smp.h"
 #include "ssp.h"
 #include "att_internal.h"
@@ -56,12 +57,18 @@ struct tx_meta {
 	bool is_cont;
 	/* Indicates whether the ISO PDU contains a timestamp */
 	bool iso_has_ts;
+#if defined(CONFIG_BT_CONN_TX_SCHED)
+	/* Uptime in milliseconds when the buffer was queued, truncated */
+	uint16_t timestamp;
+#endif /* CONFIG_BT_CONN_TX_SCHED */
 };
 
 BUILD_ASSERT(sizeof(struct tx_meta) == CONFIG_BT_CONN_TX_USER_DATA_SIZE,
 	     "User data size is wrong!");
 
 #define tx_data(buf) ((struct tx_meta *)net_buf_user_data(buf))
+
+static size_t tx_len(struct net_buf *buf);
 K_FIFO_DEFINE(free_tx);
 
 static void tx_free(struct bt_conn_tx *tx);
@@ -113,6 +120,22 @@ NET_BUF_POOL_FIXED_DEFINE(frag_pool, CONFIG_BT_L2CAP_TX_FRAG_COUNT,
 
 #endif /* CONFIG_BT_L2CAP_TX_FRAG_COUNT > 0 */
 
+#if defined(CONFIG_BT_CONN_TX_GATHER)
+static void tx_view_destroy(struct net_buf *view)
+{
+	struct net_buf **parent = net_buf_user_data(view);
+
+	net_buf_unref(*parent);
+	net_buf_destroy(view);
+}
+
+/* Buffers that point to the data of other TX buffers, each one holding a
+ * reference to the buffer it points into.
+ */
+NET_BUF_POOL_FIXED_DEFINE(tx_view_pool, CONFIG_BT_CONN_TX_VIEW_COUNT, 0,
+			  sizeof(struct net_buf *), tx_view_destroy);
+#endif /* CONFIG_BT_CONN_TX_GATHER */
+
 #if defined(CONFIG_BT_SMP) || defined(CONFIG_BT_BREDR)
 const struct bt_conn_auth_cb *bt_auth;
 sys_slist_t bt_auth_info_cbs = SYS_SLIST_STATIC_INIT(&bt_auth_info_cbs);
@@ -486,10 +509,53 @@ int bt_conn_send_cb(struct bt_conn *conn, struct net_buf *buf,
 
 	tx_data(buf)->is_cont = false;
 
+#if defined(CONFIG_BT_CONN_TX_SCHED)
+	tx_data(buf)->timestamp = (uint16_t)k_uptime_get_32();
+	atomic_add(&conn->tx_queued_bytes, tx_len(buf));
+#endif /* CONFIG_BT_CONN_TX_SCHED */
+
 	net_buf_put(&conn->tx_queue, buf);
 	return 0;
 }
 
+bool bt_conn_tx_gather(void)
+{
+	return IS_ENABLED(CONFIG_BT_CONN_TX_GATHER) &&
+	       (bt_dev.drv->quirks & BT_QUIRK_TX_FRAGS);
+}
+
+struct net_buf *bt_conn_tx_view(struct net_buf *buf, size_t len)
+{
+#if defined(CONFIG_BT_CONN_TX_GATHER)
+	struct net_buf *view;
+
+	__ASSERT_NO_MSG(len <= buf->len);
+
+	view = net_buf_alloc_with_data(&tx_view_pool, buf->data, len, K_NO_WAIT);
+	if (!view) {
+		return NULL;
+	}
+
+	*(struct net_buf **)net_buf_user_data(view) = net_buf_ref(buf);
+
+	return view;
+#else
+	return NULL;
+#endif /* CONFIG_BT_CONN_TX_GATHER */
+}
+
+/* Length of the data to be sent from `buf`. Fragments are only sent by
+ * drivers that take buffer chains.
+ */
+static size_t tx_len(struct net_buf *buf)
+{
+	if (bt_conn_tx_gather()) {
+		return net_buf_frags_len(buf);
+	}
+
+	return buf->len;
+}
+
 enum {
 	FRAG_START,
 	FRAG_CONT,
@@ -516,7 +582,7 @@ static int send_acl(struct bt_conn *conn, struct net_buf *buf, uint8_t flags)
 
 	hdr = net_buf_push(buf, sizeof(*hdr));
 	hdr->handle = sys_cpu_to_le16(bt_acl_handle_pack(conn->handle, flags));
-	hdr->len = sys_cpu_to_le16(buf->len - sizeof(*hdr));
+	hdr->len = sys_cpu_to_le16(tx_len(buf) - sizeof(*hdr));
 
 	bt_buf_set_type(buf, BT_BUF_ACL_OUT);
 
@@ -552,7 +618,7 @@ static int send_iso(struct bt_conn *conn, struct net_buf *buf, uint8_t flags)
 
 	hdr->handle = sys_cpu_to_le16(bt_iso_handle_pack(conn->handle, flags, ts));
 
-	hdr->len = sys_cpu_to_le16(buf->len - sizeof(*hdr));
+	hdr->len = sys_cpu_to_le16(tx_len(buf) - sizeof(*hdr));
 
 	bt_buf_set_type(buf, BT_BUF_ISO_OUT);
 
@@ -653,10 +719,145 @@ fail:
 	return err;
 }
 
+/* Fill `frag` with views onto the first `len` bytes of the `buf` chain. The
+ * data is only consumed from `buf` if all the views could be created.
+ */
+static int add_views(struct net_buf *frag, struct net_buf *buf, size_t len)
+{
+	struct net_buf *view;
+	size_t rem, chunk;
+
+	rem = len;
+	for (struct net_buf *piece = buf; piece && rem; piece = piece->frags) {
+		chunk = MIN(rem, piece->len);
+		if (!chunk) {
+			continue;
+		}
+
+		view = bt_conn_tx_view(piece, chunk);
+		if (!view) {
+			while (frag->frags) {
+				net_buf_frag_del(frag, frag->frags);
+			}
+
+			return -ENOBUFS;
+		}
+
+		net_buf_frag_add(frag, view);
+		rem -= chunk;
+	}
+
+	rem = len;
+	for (struct net_buf *piece = buf; piece && rem; piece = piece->frags) {
+		chunk = MIN(rem, piece->len);
+		net_buf_pull(piece, chunk);
+		rem -= chunk;
+	}
+
+	return 0;
+}
+
+/* Copy the first `len` bytes of the `buf` chain to `frag` */
+static void add_data(struct net_buf *frag, struct net_buf *buf, size_t len)
+{
+	size_t chunk;
+
+	for (struct net_buf *piece = buf; piece && len; piece = piece->frags) {
+		chunk = MIN(len, piece->len);
+		net_buf_add_mem(frag, piece->data, chunk);
+		net_buf_pull(piece, chunk);
+		len -= chunk;
+	}
+}
+
+#if defined(CONFIG_BT_CONN_TX_SCHED)
+/* Account for `len` bytes of the queued data being given to the controller */
+static void tx_sched_sent(struct bt_conn *conn, size_t len)
+{
+	conn->tx_deficit -= len;
+	atomic_sub(&conn->tx_queued_bytes, len);
+}
+
+/* Account for the last part of `buf` leaving the queue */
+static void tx_sched_dequeued(struct bt_conn *conn, struct net_buf *buf)
+{
+	uint32_t latency = (uint16_t)((uint16_t)k_uptime_get_32() - tx_data(buf)->timestamp);
+
+	tx_sched_sent(conn, tx_len(buf));
+
+	if (conn->tx_sent++ == 0U) {
+		conn->tx_latency_avg = latency;
+	} else {
+		conn->tx_latency_avg = (conn->tx_latency_avg * 7U + latency) / 8U;
+	}
+
+	conn->tx_latency_max = MAX(conn->tx_latency_max, latency);
+}
+
+static void tx_sched_reset(struct bt_conn *conn)
+{
+	if (IS_ENABLED(CONFIG_BT_ISO) && conn->type == BT_CONN_TYPE_ISO) {
+		conn->tx_weight = CONFIG_BT_CONN_TX_SCHED_ISO_WEIGHT;
+	} else {
+		conn->tx_weight = CONFIG_BT_CONN_TX_SCHED_WEIGHT;
+	}
+
+	conn->tx_deficit = 0;
+	atomic_set(&conn->tx_queued_bytes, 0);
+	conn->tx_sent = 0U;
+	conn->tx_latency_avg = 0U;
+	conn->tx_latency_max = 0U;
+}
+
+/* Deficit round robin: every time the TX thread visits a connection, it may
+ * send up to its weight times the quantum in bytes. Bytes sent in excess,
+ * when the last packet did not fit, are taken off the next round.
+ */
+static void tx_sched_round(struct bt_conn *conn)
+{
+	int32_t quantum = conn->tx_weight * CONFIG_BT_CONN_TX_SCHED_QUANTUM;
+
+	conn->tx_deficit = MIN(conn->tx_deficit + quantum, quantum);
+}
+
+static bool tx_sched_more(struct bt_conn *conn)
+{
+	if (k_fifo_is_empty(&conn->tx_queue)) {
+		conn->tx_deficit = 0;
+		return false;
+	}
+
+	return conn->tx_deficit > 0;
+}
+#else
+static inline void tx_sched_sent(struct bt_conn *conn, size_t len)
+{
+}
+
+static inline void tx_sched_dequeued(struct bt_conn *conn, struct net_buf *buf)
+{
+}
+
+static inline void tx_sched_reset(struct bt_conn *conn)
+{
+}
+
+static inline void tx_sched_round(struct bt_conn *conn)
+{
+}
+
+static inline bool tx_sched_more(struct bt_conn *conn)
+{
+	return false;
+}
+#endif /* CONFIG_BT_CONN_TX_SCHED */
+
 static int send_frag(struct bt_conn *conn,
 		     struct net_buf *buf, struct net_buf *frag,
 		     uint8_t flags)
 {
+	size_t len;
+
 	/* Check if the controller can accept ACL packets */
 	if (k_sem_take(bt_conn_get_pkts(conn), K_NO_WAIT)) {
 		LOG_DBG("no controller bufs");
@@ -672,7 +873,15 @@ static int send_frag(struct bt_conn *conn,
 	}
 
 	/* Add the data to the buffer */
-	if (frag) {
+	len = tx_len(buf);
+	if (frag && bt_conn_tx_gather()) {
+		/* Point to the data instead of copying it, unless there are no
+		 * views left.
+		 */
+		if (add_views(frag, buf, conn_mtu(conn))) {
+			add_data(frag, buf, MIN(conn_mtu(conn), net_buf_tailroom(frag)));
+		}
+	} else if (frag) {
 		uint16_t frag_len = MIN(conn_mtu(conn), net_buf_tailroom(frag));
 
 		net_buf_add_mem(frag, buf->data, frag_len);
@@ -685,6 +894,11 @@ static int send_frag(struct bt_conn *conn,
 		 */
 		buf = net_buf_get(&conn->tx_queue, K_NO_WAIT);
 		frag = buf;
+		tx_sched_dequeued(conn, buf);
+	}
+
+	if (frag != buf) {
+		tx_sched_sent(conn, len - tx_len(buf));
 	}
 
 	return do_send_frag(conn, frag, flags);
@@ -748,7 +962,7 @@ static int send_buf(struct bt_conn *conn, struct net_buf *buf)
 	LOG_DBG("conn %p buf %p len %u", conn, buf, buf->len);
 
 	/* Send directly if the packet fits the ACL MTU */
-	if (buf->len <= conn_mtu(conn) && !tx_data(buf)->is_cont) {
+	if (tx_len(buf) <= conn_mtu(conn) && !tx_data(buf)->is_cont) {
 		LOG_DBG("send single");
 		return send_frag(conn, buf, NULL, FRAG_SINGLE);
 	}
@@ -763,7 +977,7 @@ static int send_buf(struct bt_conn *conn, struct net_buf *buf)
 		flags = FRAG_CONT;
 	}
 
-	while (buf->len > conn_mtu(conn)) {
+	while (tx_len(buf) > conn_mtu(conn)) {
 		frag = create_frag(conn, buf);
 		if (!frag) {
 			return -ENOMEM;
@@ -887,6 +1101,12 @@ int bt_conn_prepare_events(struct k_poll_event events[])
 {
 	int i, ev_count = 0;
 	struct bt_conn *conn;
+#if defined(CONFIG_BT_CONN_TX_SCHED)
+	/* Rotate the connection that is served first */
+	static uint8_t first;
+#else
+	const uint8_t first = 0U;
+#endif /* CONFIG_BT_CONN_TX_SCHED */
 
 	LOG_DBG("");
 
@@ -897,7 +1117,7 @@ int bt_conn_prepare_events(struct k_poll_event events[])
 
 #if defined(CONFIG_BT_CONN)
 	for (i = 0; i < ARRAY_SIZE(acl_conns); i++) {
-		conn = &acl_conns[i];
+		conn = &acl_conns[(first + i) % ARRAY_SIZE(acl_conns)];
 
 		if (!conn_prepare_events(conn, &events[ev_count])) {
 			ev_count++;
@@ -907,7 +1127,7 @@ int bt_conn_prepare_events(struct k_poll_event events[])
 
 #if defined(CONFIG_BT_ISO)
 	for (i = 0; i < ARRAY_SIZE(iso_conns); i++) {
-		conn = &iso_conns[i];
+		conn = &iso_conns[(first + i) % ARRAY_SIZE(iso_conns)];
 
 		if (!conn_prepare_events(conn, &events[ev_count])) {
 			ev_count++;
@@ -915,23 +1135,18 @@ int bt_conn_prepare_events(struct k_poll_event events[])
 	}
 #endif
 
+#if defined(CONFIG_BT_CONN_TX_SCHED)
+	first++;
+#endif /* CONFIG_BT_CONN_TX_SCHED */
+
 	return ev_count;
 }
 
-void bt_conn_process_tx(struct bt_conn *conn)
+static int conn_tx_one(struct bt_conn *conn)
 {
 	struct net_buf *buf;
 	int err;
 
-	LOG_DBG("conn %p", conn);
-
-	if (conn->state == BT_CONN_DISCONNECTED &&
-	    atomic_test_and_clear_bit(conn->flags, BT_CONN_CLEANUP)) {
-		LOG_DBG("handle %u disconnected - cleaning up", conn->handle);
-		conn_cleanup(conn);
-		return;
-	}
-
 	/* Get next ACL packet for connection. The buffer will only get dequeued
 	 * if there is a free controller buffer to put it in.
 	 *
@@ -967,6 +1182,28 @@ void bt_conn_process_tx(struct bt_conn *conn)
 			conn_tx_destroy(conn, tx);
 		}
 	}
+
+	return err;
+}
+
+void bt_conn_process_tx(struct bt_conn *conn)
+{
+	LOG_DBG("conn %p", conn);
+
+	if (conn->state == BT_CONN_DISCONNECTED &&
+	    atomic_test_and_clear_bit(conn->flags, BT_CONN_CLEANUP)) {
+		LOG_DBG("handle %u disconnected - cleaning up", conn->handle);
+		conn_cleanup(conn);
+		return;
+	}
+
+	tx_sched_round(conn);
+
+	do {
+		if (conn_tx_one(conn)) {
+			break;
+		}
+	} while (tx_sched_more(conn));
 }
 
 static void process_unack_tx(struct bt_conn *conn)
@@ -1078,6 +1315,7 @@ void bt_conn_set_state(struct bt_conn *conn, bt_conn_state_t state)
 			break;
 		}
 		k_fifo_init(&conn->tx_queue);
+		tx_sched_reset(conn);
 		k_poll_signal_raise(&conn_change, 0);
 
 		if (IS_ENABLED(CONFIG_BT_ISO) &&
@@ -1847,6 +2085,9 @@ static void deferred_work(struct k_work *work)
 		bt_l2cap_disconnected(conn);
 		notify_disconnected(conn);
 
+		/* Write the bonding and GATT data stored during the connection */
+		bt_settings_flush();
+
 		/* Release the reference we took for the very first
 		 * state transition.
 		 */
@@ -2616,6 +2857,12 @@ int bt_conn_get_info(const struct bt_conn *conn, struct bt_conn_info *info)
 #if defined(CONFIG_BT_USER_DATA_LEN_UPDATE)
 		info->le.data_len = &conn->le.data_len;
 #endif
+#if defined(CONFIG_BT_CONN)
+		info->le.att_bearers = 0U;
+		if (conn->state == BT_CONN_CONNECTED) {
+			info->le.att_bearers = bt_att_bearer_count((struct bt_conn *)conn);
+		}
+#endif /* CONFIG_BT_CONN */
 		if (conn->le.keys && (conn->le.keys->flags & BT_KEYS_SC)) {
 			info->security.flags |= BT_SECURITY_FLAG_SC;
 		}
@@ -2647,6 +2894,33 @@ int bt_conn_get_info(const struct bt_conn *conn, struct bt_conn_info *info)
 	return -EINVAL;
 }
 
+#if defined(CONFIG_BT_CONN_TX_SCHED)
+int bt_conn_set_tx_weight(struct bt_conn *conn, uint8_t weight)
+{
+	CHECKIF(conn == NULL || weight == 0U) {
+		return -EINVAL;
+	}
+
+	conn->tx_weight = weight;
+
+	return 0;
+}
+
+int bt_conn_get_tx_stats(const struct bt_conn *conn, struct bt_conn_tx_stats *stats)
+{
+	CHECKIF(conn == NULL || stats == NULL) {
+		return -EINVAL;
+	}
+
+	stats->queued_bytes = atomic_get(&conn->tx_queued_bytes);
+	stats->sent = conn->tx_sent;
+	stats->latency_avg = conn->tx_latency_avg;
+	stats->latency_max = conn->tx_latency_max;
+
+	return 0;
+}
+#endif /* CONFIG_BT_CONN_TX_SCHED */
+
 int bt_conn_get_remote_info(struct bt_conn *conn,
 			    struct bt_conn_remote_info *remote_info)
 {
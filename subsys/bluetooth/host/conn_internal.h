@@ -205,6 +205,20 @@ struct bt_conn {
 	/* Queue for outgoing ACL data */
 	struct k_fifo		tx_queue;
 
+#if defined(CONFIG_BT_CONN_TX_SCHED)
+	/* Share of the controller buffers and bytes that may still be sent
+	 * in the current scheduling round.
+	 */
+	uint8_t			tx_weight;
+	int32_t			tx_deficit;
+
+	/* TX statistics, see bt_conn_get_tx_stats() */
+	atomic_t		tx_queued_bytes;
+	uint32_t		tx_sent;
+	uint32_t		tx_latency_avg;
+	uint32_t		tx_latency_max;
+#endif /* CONFIG_BT_CONN_TX_SCHED */
+
 	/* Active L2CAP channels */
 	sys_slist_t		channels;
 
@@ -268,6 +282,20 @@ static inline int bt_conn_send(struct bt_conn *conn, struct net_buf *buf)
 	return bt_conn_send_cb(conn, buf, NULL, NULL);
 }
 
+/* Check if buffers given to `bt_conn_send_cb` are sent with their fragments,
+ * i.e. if @kconfig{CONFIG_BT_CONN_TX_GATHER} is enabled and the HCI driver
+ * takes buffer chains.
+ */
+bool bt_conn_tx_gather(void);
+
+/* Create a buffer pointing to the first `len` bytes of `buf`, which holds a
+ * reference to `buf` until it is destroyed.
+ *
+ * Returns NULL if @kconfig{CONFIG_BT_CONN_TX_GATHER} is disabled or no view
+ * buffer is available.
+ */
+struct net_buf *bt_conn_tx_view(struct net_buf *buf, size_t len);
+
 /* Check if a connection object with the peer already exists */
 bool bt_conn_exists_le(uint8_t id, const bt_addr_le_t *peer);
 
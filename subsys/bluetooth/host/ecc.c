@@ -7,11 +7,14 @@
 
 #include <stdint.h>
 
+#include <zephyr/init.h>
+#include <zephyr/kernel.h>
 #include <zephyr/sys/check.h>
 #include <zephyr/bluetooth/hci.h>
 
 #include "ecc.h"
 #include "hci_core.h"
+#include "hci_ecc.h"
 
 #define LOG_LEVEL CONFIG_BT_HCI_CORE_LOG_LEVEL
 #include <zephyr/logging/log.h>
@@ -202,6 +205,82 @@ int bt_dh_key_gen(const uint8_t remote_pk[BT_PUB_KEY_LEN], bt_dh_key_cb_t cb)
 	return 0;
 }
 
+#if defined(CONFIG_BT_ECC_ASYNC)
+static K_FIFO_DEFINE(dh_key_reqs);
+static K_THREAD_STACK_ARRAY_DEFINE(dh_key_stacks, CONFIG_BT_ECC_ASYNC_WORKERS,
+				   CONFIG_BT_ECC_ASYNC_STACK_SIZE);
+static struct k_thread dh_key_threads[CONFIG_BT_ECC_ASYNC_WORKERS];
+
+static void dh_key_done(struct k_work *work)
+{
+	struct bt_dh_key_req *req = CONTAINER_OF(work, struct bt_dh_key_req, work);
+
+	req->pending = false;
+	req->func(req, req->err ? NULL : req->dhkey);
+}
+
+static void dh_key_worker(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		struct bt_dh_key_req *req = k_fifo_get(&dh_key_reqs, K_FOREVER);
+
+		req->err = bt_hci_ecc_dhkey(req->remote_pk, req->debug, req->dhkey);
+		if (req->err) {
+			LOG_WRN("Failed to generate DHKey (err %d)", req->err);
+		}
+
+		k_work_submit(&req->work);
+	}
+}
+
+int bt_dh_key_gen_async(struct bt_dh_key_req *req, const uint8_t remote_pk[BT_PUB_KEY_LEN])
+{
+	CHECKIF(req == NULL || req->func == NULL) {
+		return -EINVAL;
+	}
+
+	if (req->pending) {
+		return -EALREADY;
+	}
+
+	if (atomic_test_bit(bt_dev.flags, BT_DEV_PUB_KEY_BUSY)) {
+		return -EBUSY;
+	}
+
+	if (!atomic_test_bit(bt_dev.flags, BT_DEV_HAS_PUB_KEY)) {
+		return -EADDRNOTAVAIL;
+	}
+
+	memcpy(req->remote_pk, remote_pk, BT_PUB_KEY_LEN);
+	req->debug = IS_ENABLED(CONFIG_BT_USE_DEBUG_KEYS);
+	req->pending = true;
+	k_work_init(&req->work, dh_key_done);
+
+	k_fifo_put(&dh_key_reqs, req);
+
+	return 0;
+}
+
+static int dh_key_workers_init(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(dh_key_threads); i++) {
+		k_thread_create(&dh_key_threads[i], dh_key_stacks[i],
+				K_THREAD_STACK_SIZEOF(dh_key_stacks[i]), dh_key_worker,
+				NULL, NULL, NULL, CONFIG_BT_LONG_WQ_PRIO,
+				0, K_NO_WAIT);
+		k_thread_name_set(&dh_key_threads[i], "BT DHKey");
+	}
+
+	return 0;
+}
+
+SYS_INIT(dh_key_workers_init, POST_KERNEL, CONFIG_BT_LONG_WQ_INIT_PRIO);
+#endif /* CONFIG_BT_ECC_ASYNC */
+
 void bt_hci_evt_le_pkey_complete(struct net_buf *buf)
 {
 	struct bt_hci_evt_le_p256_public_key_complete *evt = (void *)buf->data;
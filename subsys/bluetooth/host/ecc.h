@@ -92,3 +92,40 @@ typedef void (*bt_dh_key_cb_t)(const uint8_t key[BT_DH_KEY_LEN]);
  *  @return Zero on success or negative error code otherwise
  */
 int bt_dh_key_gen(const uint8_t remote_pk[BT_PUB_KEY_LEN], bt_dh_key_cb_t cb);
+
+/*  @brief Container for an asynchronous DH Key calculation */
+struct bt_dh_key_req {
+	/* Internal, must be first */
+	sys_snode_t node;
+
+	/** @brief Callback type for completed DH Key calculation.
+	 *
+	 *  Called from the system workqueue.
+	 *
+	 *  @param req The request.
+	 *  @param key The DH Key, or NULL in case of failure.
+	 */
+	void (*func)(struct bt_dh_key_req *req, const uint8_t key[BT_DH_KEY_LEN]);
+
+	/* Internal */
+	struct k_work work;
+	uint8_t remote_pk[BT_PUB_KEY_LEN];
+	uint8_t dhkey[BT_DH_KEY_LEN];
+	bool debug;
+	bool pending;
+	int err;
+};
+
+/*  @brief Calculate a DH Key from a remote Public Key in the Host.
+ *
+ *  Unlike bt_dh_key_gen(), several calculations can be in progress at
+ *  the same time, each with its own request object. They are run by
+ *  CONFIG_BT_ECC_ASYNC_WORKERS threads. The request must persist until its
+ *  callback is called.
+ *
+ *  @param req Request object with the callback set.
+ *  @param remote_pk Remote Public Key.
+ *
+ *  @return Zero on success or negative error code otherwise
+ */
+int bt_dh_key_gen_async(struct bt_dh_key_req *req, const uint8_t remote_pk[BT_PUB_KEY_LEN]);
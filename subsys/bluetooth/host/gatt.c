@@ -95,6 +95,113 @@ enum gatt_global_flags {
 
 static ATOMIC_DEFINE(gatt_flags, GATT_NUM_FLAGS);
 
+#if defined(CONFIG_BT_GATT_ATTR_INDEX)
+/* Index of the whole database: attributes sorted by handle, and the same
+ * attributes sorted by 16-bit type then handle. The index is only used when
+ * the complete database fits in it.
+ */
+static struct {
+	const struct bt_gatt_attr *attrs[CONFIG_BT_GATT_ATTR_INDEX_SIZE];
+	uint16_t handles[CONFIG_BT_GATT_ATTR_INDEX_SIZE];
+	uint16_t by_type[CONFIG_BT_GATT_ATTR_INDEX_SIZE];
+	uint16_t type[CONFIG_BT_GATT_ATTR_INDEX_SIZE];
+	uint16_t count;
+	bool valid;
+} attr_index;
+
+/* Type key of an attribute: its UUID as a 16-bit UUID, or 0 if the UUID has
+ * no 16-bit form.
+ */
+static uint16_t attr_index_type(const struct bt_uuid *uuid)
+{
+	struct bt_uuid_16 uuid16 = BT_UUID_INIT_16(0);
+
+	switch (uuid->type) {
+	case BT_UUID_TYPE_16:
+		return BT_UUID_16(uuid)->val;
+	case BT_UUID_TYPE_32:
+		if (BT_UUID_32(uuid)->val > UINT16_MAX) {
+			return 0U;
+		}
+
+		return BT_UUID_32(uuid)->val;
+	case BT_UUID_TYPE_128:
+		uuid16.val = sys_get_le16(&BT_UUID_128(uuid)->val[12]);
+		if (bt_uuid_cmp(uuid, &uuid16.uuid)) {
+			return 0U;
+		}
+
+		return uuid16.val;
+	}
+
+	return 0U;
+}
+
+static bool attr_index_add(const struct bt_gatt_attr *attr, uint16_t handle)
+{
+	uint16_t i = attr_index.count;
+	uint16_t type = attr_index_type(attr->uuid);
+	uint16_t j;
+
+	if (i >= ARRAY_SIZE(attr_index.attrs) ||
+	    (i && attr_index.handles[i - 1] >= handle)) {
+		return false;
+	}
+
+	attr_index.attrs[i] = attr;
+	attr_index.handles[i] = handle;
+	attr_index.type[i] = type;
+
+	/* Attributes are added in handle order so inserting after entries of
+	 * the same type keeps handle order within a type.
+	 */
+	for (j = i; j > 0 && attr_index.type[attr_index.by_type[j - 1]] > type; j--) {
+		attr_index.by_type[j] = attr_index.by_type[j - 1];
+	}
+
+	attr_index.by_type[j] = i;
+	attr_index.count++;
+
+	return true;
+}
+
+static void attr_index_build(void)
+{
+	uint16_t handle = 1;
+	bool fits = true;
+
+	attr_index.valid = false;
+	attr_index.count = 0U;
+
+	STRUCT_SECTION_FOREACH(bt_gatt_service_static, static_svc) {
+		for (size_t i = 0; fits && i < static_svc->attr_count; i++, handle++) {
+			fits = attr_index_add(&static_svc->attrs[i], handle);
+		}
+	}
+
+#if defined(CONFIG_BT_GATT_DYNAMIC_DB)
+	struct bt_gatt_service *svc;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&db, svc, node) {
+		for (size_t i = 0; fits && i < svc->attr_count; i++) {
+			fits = attr_index_add(&svc->attrs[i], svc->attrs[i].handle);
+		}
+	}
+#endif /* CONFIG_BT_GATT_DYNAMIC_DB */
+
+	if (!fits) {
+		LOG_WRN("Attribute index not used, database too large or out of order");
+		return;
+	}
+
+	attr_index.valid = true;
+}
+#else
+static inline void attr_index_build(void)
+{
+}
+#endif /* CONFIG_BT_GATT_ATTR_INDEX */
+
 static ssize_t read_name(struct bt_conn *conn, const struct bt_gatt_attr *attr,
 			 void *buf, uint16_t len, uint16_t offset)
 {
@@ -1452,6 +1559,8 @@ static void bt_gatt_service_init(void)
 	STRUCT_SECTION_FOREACH(bt_gatt_service_static, svc) {
 		last_static_handle += svc->attr_count;
 	}
+
+	attr_index_build();
 }
 
 void bt_gatt_init(void)
@@ -1670,6 +1779,8 @@ int bt_gatt_service_register(struct bt_gatt_service *svc)
 		return err;
 	}
 
+	attr_index_build();
+
 	/* Don't submit any work until the stack is initialized */
 	if (!atomic_test_bit(gatt_flags, GATT_INITIALIZED)) {
 		k_sched_unlock();
@@ -1700,6 +1811,8 @@ int bt_gatt_service_unregister(struct bt_gatt_service *svc)
 		return err;
 	}
 
+	attr_index_build();
+
 	/* Don't submit any work until the stack is initialized */
 	if (!atomic_test_bit(gatt_flags, GATT_INITIALIZED)) {
 		k_sched_unlock();
@@ -1987,6 +2100,78 @@ static void foreach_attr_type_dyndb(uint16_t start_handle, uint16_t end_handle,
 #endif /* CONFIG_BT_GATT_DYNAMIC_DB */
 }
 
+#if defined(CONFIG_BT_GATT_ATTR_INDEX)
+static bool foreach_attr_type_index(uint16_t start_handle, uint16_t end_handle,
+				    const struct bt_uuid *uuid,
+				    const void *attr_data, uint16_t num_matches,
+				    bt_gatt_attr_func_t func, void *user_data)
+{
+	uint16_t type = 0U;
+	size_t lo = 0;
+	size_t hi = attr_index.count;
+	size_t mid, i;
+
+	if (!attr_index.valid) {
+		return false;
+	}
+
+	if (uuid) {
+		type = attr_index_type(uuid);
+	}
+
+	if (!type) {
+		/* Find the first attribute at or after the start handle */
+		while (lo < hi) {
+			mid = (lo + hi) / 2;
+			if (attr_index.handles[mid] < start_handle) {
+				lo = mid + 1;
+			} else {
+				hi = mid;
+			}
+		}
+
+		for (i = lo; i < attr_index.count; i++) {
+			if (gatt_foreach_iter(attr_index.attrs[i], attr_index.handles[i],
+					      start_handle, end_handle, uuid, attr_data,
+					      &num_matches, func, user_data) ==
+			    BT_GATT_ITER_STOP) {
+				break;
+			}
+		}
+
+		return true;
+	}
+
+	/* Find the first attribute of the type at or after the start handle */
+	while (lo < hi) {
+		mid = (lo + hi) / 2;
+		i = attr_index.by_type[mid];
+		if (attr_index.type[i] < type ||
+		    (attr_index.type[i] == type && attr_index.handles[i] < start_handle)) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	for (; lo < attr_index.count; lo++) {
+		i = attr_index.by_type[lo];
+		if (attr_index.type[i] != type) {
+			break;
+		}
+
+		if (gatt_foreach_iter(attr_index.attrs[i], attr_index.handles[i],
+				      start_handle, end_handle, uuid, attr_data,
+				      &num_matches, func, user_data) ==
+		    BT_GATT_ITER_STOP) {
+			break;
+		}
+	}
+
+	return true;
+}
+#endif /* CONFIG_BT_GATT_ATTR_INDEX */
+
 void bt_gatt_foreach_attr_type(uint16_t start_handle, uint16_t end_handle,
 			       const struct bt_uuid *uuid,
 			       const void *attr_data, uint16_t num_matches,
@@ -1998,6 +2183,13 @@ void bt_gatt_foreach_attr_type(uint16_t start_handle, uint16_t end_handle,
 		num_matches = UINT16_MAX;
 	}
 
+#if defined(CONFIG_BT_GATT_ATTR_INDEX)
+	if (foreach_attr_type_index(start_handle, end_handle, uuid, attr_data,
+				    num_matches, func, user_data)) {
+		return;
+	}
+#endif /* CONFIG_BT_GATT_ATTR_INDEX */
+
 	if (start_handle <= last_static_handle) {
 		uint16_t handle = 1;
 
@@ -2300,6 +2300,74 @@ static void hci_reset_complete(struct net_buf *buf)
 	atomic_set(bt_dev.flags, flags);
 }
 
+/* Protects the list of sent commands and the command credits */
+static struct k_spinlock sent_cmds_lock;
+
+/* Take a sent command out of the list: `evt_buf` itself if it is a sent
+ * command, otherwise the oldest sent command with the given opcode.
+ */
+static struct net_buf *sent_cmd_get(uint16_t opcode, struct net_buf *evt_buf)
+{
+	struct net_buf *buf, *found = NULL;
+	sys_snode_t *prev = NULL, *found_prev = NULL;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&sent_cmds_lock);
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&bt_dev.sent_cmds, buf, node) {
+		if (buf == evt_buf) {
+			found = buf;
+			found_prev = prev;
+			break;
+		}
+
+		if (!found && cmd(buf)->opcode == opcode) {
+			found = buf;
+			found_prev = prev;
+		}
+
+		prev = &buf->node;
+	}
+
+	if (found) {
+		sys_slist_remove(&bt_dev.sent_cmds, found_prev, &found->node);
+		bt_dev.sent_cmd_count--;
+	}
+
+	k_spin_unlock(&sent_cmds_lock, key);
+
+	return found;
+}
+
+/* Set the number of commands that can be sent from the Num_HCI_Command_Packets
+ * of a Command Complete or Command Status event, not counting the commands
+ * still waiting for their own event.
+ */
+static void update_ncmd(uint8_t ncmd)
+{
+	unsigned int credits = MIN(ncmd, CONFIG_BT_HCI_CMD_PENDING_MAX);
+	unsigned int avail, give = 0U;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&sent_cmds_lock);
+
+	credits = (credits > bt_dev.sent_cmd_count) ? credits - bt_dev.sent_cmd_count : 0U;
+
+	for (avail = k_sem_count_get(&bt_dev.ncmd_sem); avail > credits; avail--) {
+		(void)k_sem_take(&bt_dev.ncmd_sem, K_NO_WAIT);
+	}
+
+	if (credits > avail) {
+		give = credits - avail;
+	}
+
+	k_spin_unlock(&sent_cmds_lock, key);
+
+	while (give--) {
+		k_sem_give(&bt_dev.ncmd_sem);
+	}
+}
+
 static void hci_cmd_done(uint16_t opcode, uint8_t status, struct net_buf *evt_buf)
 {
 	/* Original command buffer. */
@@ -2315,21 +2383,13 @@ static void hci_cmd_done(uint16_t opcode, uint8_t status, struct net_buf *evt_bu
 	}
 
 	/* Take the original command buffer reference. */
-	buf = atomic_ptr_clear((atomic_ptr_t *)&bt_dev.sent_cmd);
+	buf = sent_cmd_get(opcode, evt_buf);
 
 	if (!buf) {
 		LOG_ERR("No command sent for cmd complete 0x%04x", opcode);
 		goto exit;
 	}
 
-	if (cmd(buf)->opcode != opcode) {
-		LOG_ERR("OpCode 0x%04x completed instead of expected 0x%04x", opcode,
-			cmd(buf)->opcode);
-		buf = atomic_ptr_set((atomic_ptr_t *)&bt_dev.sent_cmd, buf);
-		__ASSERT_NO_MSG(!buf);
-		goto exit;
-	}
-
 	/* Response data is to be delivered in the original command
 	 * buffer.
 	 */
@@ -2385,10 +2445,8 @@ static void hci_cmd_complete(struct net_buf *buf)
 
 	hci_cmd_done(opcode, status, buf);
 
-	/* Allow next command to be sent */
-	if (ncmd) {
-		k_sem_give(&bt_dev.ncmd_sem);
-	}
+	/* Allow next commands to be sent */
+	update_ncmd(ncmd);
 }
 
 static void hci_cmd_status(struct net_buf *buf)
@@ -2405,10 +2463,8 @@ static void hci_cmd_status(struct net_buf *buf)
 
 	hci_cmd_done(opcode, evt->status, buf);
 
-	/* Allow next command to be sent */
-	if (ncmd) {
-		k_sem_give(&bt_dev.ncmd_sem);
-	}
+	/* Allow next commands to be sent */
+	update_ncmd(ncmd);
 }
 
 int bt_hci_get_conn_handle(const struct bt_conn *conn, uint16_t *conn_handle)
@@ -2747,6 +2803,10 @@ static void hci_event(struct net_buf *buf)
 
 static void send_cmd(void)
 {
+	struct k_poll_event ncmd_event = K_POLL_EVENT_INITIALIZER(K_POLL_TYPE_SEM_AVAILABLE,
+								  K_POLL_MODE_NOTIFY_ONLY,
+								  &bt_dev.ncmd_sem);
+	k_spinlock_key_t key;
 	struct net_buf *buf;
 	int err;
 
@@ -2755,18 +2815,25 @@ static void send_cmd(void)
 	buf = net_buf_get(&bt_dev.cmd_tx_queue, K_NO_WAIT);
 	BT_ASSERT(buf);
 
-	/* Wait until ncmd > 0 */
+	/* Wait until ncmd > 0. The credit is taken together with adding the
+	 * command to the sent list, so that update_ncmd() sees both or none.
+	 */
 	LOG_DBG("calling sem_take_wait");
-	k_sem_take(&bt_dev.ncmd_sem, K_FOREVER);
+	while (true) {
+		key = k_spin_lock(&sent_cmds_lock);
+		if (!k_sem_take(&bt_dev.ncmd_sem, K_NO_WAIT)) {
+			break;
+		}
+
+		k_spin_unlock(&sent_cmds_lock, key);
 
-	/* Clear out any existing sent command */
-	if (bt_dev.sent_cmd) {
-		LOG_ERR("Uncleared pending sent_cmd");
-		net_buf_unref(bt_dev.sent_cmd);
-		bt_dev.sent_cmd = NULL;
+		ncmd_event.state = K_POLL_STATE_NOT_READY;
+		(void)k_poll(&ncmd_event, 1, K_FOREVER);
 	}
 
-	bt_dev.sent_cmd = net_buf_ref(buf);
+	sys_slist_append(&bt_dev.sent_cmds, &net_buf_ref(buf)->node);
+	bt_dev.sent_cmd_count++;
+	k_spin_unlock(&sent_cmds_lock, key);
 
 	LOG_DBG("Sending command 0x%04x (buf %p) to driver", cmd(buf)->opcode, buf);
 
@@ -4082,9 +4149,9 @@ int bt_enable(bt_ready_cb_t cb)
 	 * initial Command Complete for NOP.
 	 */
 	if (!IS_ENABLED(CONFIG_BT_WAIT_NOP)) {
-		k_sem_init(&bt_dev.ncmd_sem, 1, 1);
+		k_sem_init(&bt_dev.ncmd_sem, 1, CONFIG_BT_HCI_CMD_PENDING_MAX);
 	} else {
-		k_sem_init(&bt_dev.ncmd_sem, 0, 1);
+		k_sem_init(&bt_dev.ncmd_sem, 0, CONFIG_BT_HCI_CMD_PENDING_MAX);
 	}
 	k_fifo_init(&bt_dev.cmd_tx_queue);
 	/* TX thread */
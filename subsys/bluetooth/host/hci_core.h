@@ -363,8 +363,11 @@ struct bt_dev {
 	/* Number of commands controller can accept */
 	struct k_sem		ncmd_sem;
 
-	/* Last sent HCI command */
-	struct net_buf		*sent_cmd;
+	/* Sent HCI commands waiting for Command Complete or Command Status */
+	sys_slist_t		sent_cmds;
+
+	/* Number of commands in sent_cmds */
+	uint8_t			sent_cmd_count;
 
 #if !defined(CONFIG_BT_RECV_BLOCKING)
 	/* Queue for incoming HCI events & ACL data */
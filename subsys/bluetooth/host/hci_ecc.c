@@ -57,6 +57,8 @@ enum {
 
 	USE_DEBUG_KEY,
 
+	NEXT_KEY_READY,
+
 	/* Total number of flags - must be at the end of the enum */
 	NUM_FLAGS,
 };
@@ -72,6 +74,19 @@ static struct {
 	};
 } ecc;
 
+/* Protects the private key, which is also read outside of the long workqueue
+ * by bt_hci_ecc_dhkey().
+ */
+static struct k_spinlock key_lock;
+
+#if defined(CONFIG_BT_ECC_PRECOMPUTE_KEY)
+/* Key pair for the next LE Read Local P-256 Public Key command */
+static struct {
+	uint8_t private_key_be[BT_PRIV_KEY_LEN];
+	uint8_t public_key_be[BT_PUB_KEY_LEN];
+} next_key;
+#endif /* CONFIG_BT_ECC_PRECOMPUTE_KEY */
+
 static void send_cmd_status(uint16_t opcode, uint8_t status)
 {
 	struct bt_hci_evt_cmd_status *evt;
@@ -99,27 +114,72 @@ static void send_cmd_status(uint16_t opcode, uint8_t status)
 	}
 }
 
-static uint8_t generate_keys(void)
+static uint8_t make_keys(uint8_t public_key_be[BT_PUB_KEY_LEN],
+			 uint8_t private_key_be[BT_PRIV_KEY_LEN])
 {
 	do {
 		int rc;
 
-		rc = uECC_make_key(ecc.public_key_be, ecc.private_key_be,
-				   &curve_secp256r1);
+		rc = uECC_make_key(public_key_be, private_key_be, &curve_secp256r1);
 		if (rc == TC_CRYPTO_FAIL) {
 			LOG_ERR("Failed to create ECC public/private pair");
 			return BT_HCI_ERR_UNSPECIFIED;
 		}
 
 	/* make sure generated key isn't debug key */
-	} while (memcmp(ecc.private_key_be, debug_private_key_be, BT_PRIV_KEY_LEN) == 0);
+	} while (memcmp(private_key_be, debug_private_key_be, BT_PRIV_KEY_LEN) == 0);
+
+	return 0;
+}
+
+static void set_keys(const uint8_t public_key_be[BT_PUB_KEY_LEN],
+		     const uint8_t private_key_be[BT_PRIV_KEY_LEN])
+{
+	k_spinlock_key_t key = k_spin_lock(&key_lock);
+
+	memcpy(ecc.private_key_be, private_key_be, BT_PRIV_KEY_LEN);
+	k_spin_unlock(&key_lock, key);
+
+	memcpy(ecc.public_key_be, public_key_be, BT_PUB_KEY_LEN);
 
 	if (IS_ENABLED(CONFIG_BT_LOG_SNIFFER_INFO)) {
-		LOG_INF("SC private key 0x%s", bt_hex(ecc.private_key_be, BT_PRIV_KEY_LEN));
+		LOG_INF("SC private key 0x%s", bt_hex(private_key_be, BT_PRIV_KEY_LEN));
 	}
+}
 
-	return 0;
+static uint8_t generate_keys(void)
+{
+	uint8_t public_key_be[BT_PUB_KEY_LEN];
+	uint8_t private_key_be[BT_PRIV_KEY_LEN];
+	uint8_t status;
+
+#if defined(CONFIG_BT_ECC_PRECOMPUTE_KEY)
+	if (atomic_test_and_clear_bit(flags, NEXT_KEY_READY)) {
+		set_keys(next_key.public_key_be, next_key.private_key_be);
+		return 0;
+	}
+#endif /* CONFIG_BT_ECC_PRECOMPUTE_KEY */
+
+	status = make_keys(public_key_be, private_key_be);
+	if (!status) {
+		set_keys(public_key_be, private_key_be);
+	}
+
+	return status;
+}
+
+#if defined(CONFIG_BT_ECC_PRECOMPUTE_KEY)
+static void precompute_keys(void)
+{
+	if (atomic_test_bit(flags, NEXT_KEY_READY)) {
+		return;
+	}
+
+	if (!make_keys(next_key.public_key_be, next_key.private_key_be)) {
+		atomic_set_bit(flags, NEXT_KEY_READY);
+	}
 }
+#endif /* CONFIG_BT_ECC_PRECOMPUTE_KEY */
 
 static void emulate_le_p256_public_key_cmd(void)
 {
@@ -213,6 +273,10 @@ static void ecc_process(struct k_work *work)
 {
 	if (atomic_test_bit(flags, PENDING_PUB_KEY)) {
 		emulate_le_p256_public_key_cmd();
+#if defined(CONFIG_BT_ECC_PRECOMPUTE_KEY)
+		/* Have a key pair ready for when the key is regenerated */
+		precompute_keys();
+#endif /* CONFIG_BT_ECC_PRECOMPUTE_KEY */
 	} else if (atomic_test_bit(flags, PENDING_DHKEY)) {
 		emulate_le_generate_dhkey();
 	} else {
@@ -344,6 +408,50 @@ void bt_hci_ecc_supported_commands(uint8_t *supported_commands)
 	supported_commands[41] |= BIT(2);
 }
 
+#if defined(CONFIG_BT_ECC_ASYNC)
+int bt_hci_ecc_dhkey(const uint8_t *remote_pk, bool debug, uint8_t *dhkey)
+{
+	uint8_t public_key_be[BT_PUB_KEY_LEN];
+	uint8_t private_key_be[BT_PRIV_KEY_LEN];
+	uint8_t dhkey_be[BT_DH_KEY_LEN];
+	k_spinlock_key_t key;
+	int ret;
+
+	/* Convert X and Y coordinates from little-endian HCI to
+	 * big-endian (expected by the crypto API).
+	 */
+	sys_memcpy_swap(public_key_be, remote_pk, BT_PUB_KEY_COORD_LEN);
+	sys_memcpy_swap(&public_key_be[BT_PUB_KEY_COORD_LEN],
+			&remote_pk[BT_PUB_KEY_COORD_LEN], BT_PUB_KEY_COORD_LEN);
+
+	ret = uECC_valid_public_key(public_key_be, &curve_secp256r1);
+	if (ret < 0) {
+		LOG_ERR("public key is not valid (ret %d)", ret);
+		return -EINVAL;
+	}
+
+	if (debug) {
+		memcpy(private_key_be, debug_private_key_be, BT_PRIV_KEY_LEN);
+	} else {
+		key = k_spin_lock(&key_lock);
+		memcpy(private_key_be, ecc.private_key_be, BT_PRIV_KEY_LEN);
+		k_spin_unlock(&key_lock, key);
+	}
+
+	ret = uECC_shared_secret(public_key_be, private_key_be, dhkey_be, &curve_secp256r1);
+	if (ret == TC_CRYPTO_FAIL) {
+		return -EIO;
+	}
+
+	/* Convert from big-endian (provided by crypto API) to
+	 * little-endian HCI.
+	 */
+	sys_memcpy_swap(dhkey, dhkey_be, BT_DH_KEY_LEN);
+
+	return 0;
+}
+#endif /* CONFIG_BT_ECC_ASYNC */
+
 int default_CSPRNG(uint8_t *dst, unsigned int len)
 {
 	return !bt_rand(dst, len);
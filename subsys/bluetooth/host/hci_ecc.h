@@ -8,3 +8,10 @@
 
 int bt_hci_ecc_send(struct net_buf *buf);
 void bt_hci_ecc_supported_commands(uint8_t *supported_commands);
+
+/* Calculate a DH Key with the current emulated key pair, or the debug key
+ * pair, without going through HCI. Can be called from several threads at
+ * once. The 64 byte remote public key and the 32 byte DH Key are in HCI
+ * (little-endian) byte order.
+ */
+int bt_hci_ecc_dhkey(const uint8_t *remote_pk, bool debug, uint8_t *dhkey);
@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/check.h>
+
+#include <zephyr/bluetooth/iso.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(bt_iso_tx_stream, CONFIG_BT_ISO_LOG_LEVEL);
+
+/* (Re)read the TX timing of the controller and record the SDU it reported as
+ * the timestamp reference of the stream.
+ *
+ * Returns the number of queued SDUs above the wanted lead, or 0 if the
+ * timing could not be read yet.
+ */
+static int tx_stream_sync(struct bt_iso_tx_stream *stream)
+{
+	struct bt_iso_tx_info info;
+	int err;
+
+	err = bt_iso_chan_get_tx_sync(stream->chan, &info);
+	if (err != 0) {
+		LOG_DBG("stream %p: no TX sync (err %d)", stream, err);
+		return 0;
+	}
+
+	stream->sync_seq_num = info.seq_num;
+	stream->sync_ts = info.ts;
+	stream->since_sync = 0U;
+	stream->synced = true;
+
+	/* The SDUs after the reported one are still queued */
+	return (int16_t)(stream->seq_num - info.seq_num - 1U) - CONFIG_BT_ISO_TX_STREAM_LEAD;
+}
+
+static int tx_stream_send(struct bt_iso_tx_stream *stream)
+{
+	uint16_t seq_num = stream->seq_num++;
+	struct net_buf *buf;
+	int err;
+
+	buf = net_buf_alloc(stream->pool, K_NO_WAIT);
+	if (buf == NULL) {
+		/* The sequence number still advances with the SDU interval */
+		stream->underruns++;
+		return 0;
+	}
+
+	net_buf_reserve(buf, BT_ISO_CHAN_SEND_RESERVE);
+
+	err = stream->fill(stream, buf, seq_num);
+	if (err != 0) {
+		net_buf_unref(buf);
+		return 0;
+	}
+
+	if (stream->synced) {
+		uint32_t ts = stream->sync_ts +
+			      (uint16_t)(seq_num - stream->sync_seq_num) * stream->interval;
+
+		err = bt_iso_chan_send_ts(stream->chan, buf, seq_num, ts);
+	} else {
+		err = bt_iso_chan_send(stream->chan, buf, seq_num);
+	}
+
+	if (err < 0) {
+		net_buf_unref(buf);
+		return err;
+	}
+
+	stream->since_sync++;
+
+	return 0;
+}
+
+static void tx_stream_halt(struct bt_iso_tx_stream *stream)
+{
+	k_timer_stop(&stream->timer);
+	stream->chan = NULL;
+}
+
+static void tx_stream_work(struct k_work *work)
+{
+	struct bt_iso_tx_stream *stream = CONTAINER_OF(work, struct bt_iso_tx_stream, work);
+	int excess = 0;
+	int count;
+
+	if (stream->chan == NULL) {
+		return;
+	}
+
+	if (stream->synced ? stream->since_sync >= CONFIG_BT_ISO_TX_STREAM_RESYNC :
+			     stream->since_sync > CONFIG_BT_ISO_TX_STREAM_LEAD) {
+		excess = tx_stream_sync(stream);
+	}
+
+	if (excess > 0) {
+		/* The host timer runs ahead of the controller */
+		LOG_DBG("stream %p: %d SDUs ahead, skipping", stream, excess);
+		return;
+	}
+
+	/* Catch up by one SDU if the host timer runs behind */
+	count = (excess < 0) ? 2 : 1;
+
+	while (count--) {
+		int err = tx_stream_send(stream);
+
+		if (err == -ENOTCONN) {
+			LOG_DBG("stream %p: channel disconnected", stream);
+			tx_stream_halt(stream);
+			return;
+		} else if (err != 0) {
+			LOG_WRN("stream %p: unable to send SDU (err %d)", stream, err);
+		}
+	}
+}
+
+static void tx_stream_expiry(struct k_timer *timer)
+{
+	struct bt_iso_tx_stream *stream = CONTAINER_OF(timer, struct bt_iso_tx_stream, timer);
+
+	k_work_submit(&stream->work);
+}
+
+int bt_iso_tx_stream_start(struct bt_iso_tx_stream *stream, struct bt_iso_chan *chan,
+			   uint32_t interval, uint16_t seq_num)
+{
+	CHECKIF(stream == NULL || stream->pool == NULL || stream->fill == NULL) {
+		LOG_DBG("Invalid stream %p", stream);
+		return -EINVAL;
+	}
+
+	CHECKIF(chan == NULL || interval == 0U) {
+		LOG_DBG("Invalid parameters: chan %p interval %u", chan, interval);
+		return -EINVAL;
+	}
+
+	if (stream->chan != NULL) {
+		return -EALREADY;
+	}
+
+	if (chan->state != BT_ISO_STATE_CONNECTED) {
+		return -ENOTCONN;
+	}
+
+	stream->chan = chan;
+	stream->interval = interval;
+	stream->seq_num = seq_num;
+	stream->since_sync = 0U;
+	stream->synced = false;
+	stream->underruns = 0U;
+
+	k_work_init(&stream->work, tx_stream_work);
+	k_timer_init(&stream->timer, tx_stream_expiry, NULL);
+	k_timer_start(&stream->timer, K_NO_WAIT, K_USEC(interval));
+
+	return 0;
+}
+
+int bt_iso_tx_stream_stop(struct bt_iso_tx_stream *stream)
+{
+	struct k_work_sync sync;
+
+	CHECKIF(stream == NULL) {
+		return -EINVAL;
+	}
+
+	if (stream->chan == NULL) {
+		return -EALREADY;
+	}
+
+	tx_stream_halt(stream);
+	(void)k_work_cancel_sync(&stream->work, &sync);
+
+	return 0;
+}
@@ -353,14 +353,6 @@ static int keys_set(const char *name, size_t len_rd, settings_read_cb read_cb,
 		return -EINVAL;
 	}
 
-	len = read_cb(cb_arg, val, sizeof(val));
-	if (len < 0) {
-		LOG_ERR("Failed to read value (err %zd)", len);
-		return -EINVAL;
-	}
-
-	LOG_DBG("name %s val %s", name, (len) ? bt_hex(val, sizeof(val)) : "(null)");
-
 	err = bt_settings_decode_key(name, &addr);
 	if (err) {
 		LOG_ERR("Unable to decode address %s", name);
@@ -382,6 +374,22 @@ static int keys_set(const char *name, size_t len_rd, settings_read_cb read_cb,
 		id = (uint8_t)next_id;
 	}
 
+	/* Don't read the keys of identities that don't exist. If the
+	 * identities have not been loaded yet, the keys are dropped on commit.
+	 */
+	if (bt_dev.id_count && id >= bt_dev.id_count) {
+		LOG_DBG("Skipping keys of unused identity %u", id);
+		return 0;
+	}
+
+	len = read_cb(cb_arg, val, sizeof(val));
+	if (len < 0) {
+		LOG_ERR("Failed to read value (err %zd)", len);
+		return -EINVAL;
+	}
+
+	LOG_DBG("name %s val %s", name, (len) ? bt_hex(val, sizeof(val)) : "(null)");
+
 	if (!len) {
 		keys = bt_keys_find(BT_KEYS_ALL, id, &addr);
 		if (keys) {
@@ -433,8 +441,20 @@ static void id_add(struct bt_keys *keys, void *user_data)
 	bt_id_add(keys);
 }
 
+static void drop_unused_id(struct bt_keys *keys, void *user_data)
+{
+	if (keys->id >= bt_dev.id_count) {
+		LOG_DBG("Dropping keys of unused identity %u", keys->id);
+		(void)memset(keys, 0, sizeof(*keys));
+	}
+}
+
 static int keys_commit(void)
 {
+	if (bt_dev.id_count) {
+		bt_keys_foreach_type(BT_KEYS_ALL, drop_unused_id, NULL);
+	}
+
 	/* We do this in commit() rather than add() since add() may get
 	 * called multiple times for the same address, especially if
 	 * the keys were already removed.
@@ -1895,7 +1895,9 @@ static int l2cap_chan_le_send(struct bt_l2cap_le_chan *ch,
 			      struct net_buf *buf, uint16_t sdu_hdr_len)
 {
 	struct net_buf *seg;
+	struct net_buf *view = NULL;
 	struct net_buf_simple_state state;
+	bool gather = bt_conn_tx_gather();
 	int len, err;
 	bt_conn_tx_cb_t cb;
 
@@ -1908,11 +1910,29 @@ static int l2cap_chan_le_send(struct bt_l2cap_le_chan *ch,
 	net_buf_simple_save(&buf->b, &state);
 
 	if ((buf->len <= ch->tx.mps) &&
-	    (net_buf_headroom(buf) >= BT_L2CAP_BUF_SIZE(0))) {
+	    (net_buf_headroom(buf) >= BT_L2CAP_BUF_SIZE(0)) &&
+	    !(gather && buf->frags)) {
 		LOG_DBG("len <= MPS, not allocating seg for %p", buf);
 		seg = net_buf_ref(buf);
 
 		len = seg->len;
+	} else if (gather &&
+		   (view = bt_conn_tx_view(buf, MIN(buf->len, ch->tx.mps)))) {
+		LOG_DBG("segment view for %p (%u bytes left)", buf, buf->len);
+		seg = l2cap_alloc_seg(ch);
+		if (!seg) {
+			LOG_DBG("failed to allocate seg for %p", buf);
+			net_buf_unref(view);
+			atomic_inc(&ch->tx.credits);
+
+			return -EAGAIN;
+		}
+
+		/* The segment only holds the headers, the data stays in the
+		 * original buffer.
+		 */
+		net_buf_frag_add(seg, view);
+		net_buf_pull(buf, view->len);
 	} else {
 		LOG_DBG("allocating segment for %p (%u bytes left)", buf, buf->len);
 		seg = l2cap_alloc_seg(ch);
@@ -1933,10 +1953,10 @@ static int l2cap_chan_le_send(struct bt_l2cap_le_chan *ch,
 		net_buf_pull(buf, len);
 	}
 
-	LOG_DBG("ch %p cid 0x%04x len %u credits %lu", ch, ch->tx.cid, seg->len,
-		atomic_get(&ch->tx.credits));
+	LOG_DBG("ch %p cid 0x%04x len %u credits %lu", ch, ch->tx.cid,
+		seg->len + (view ? view->len : 0U), atomic_get(&ch->tx.credits));
 
-	len = seg->len - sdu_hdr_len;
+	len = seg->len + (view ? view->len : 0U) - sdu_hdr_len;
 
 	/* SDU will be considered sent when there is no data left in the
 	 * buffers, or if there will be no data left, if we are sending `buf`
@@ -1955,8 +1975,19 @@ static int l2cap_chan_le_send(struct bt_l2cap_le_chan *ch,
 	 * considered lost, as the lower layers are free to re-use it as they
 	 * see fit. Reading from it later is obviously a no-no.
 	 */
-	err = bt_l2cap_send_cb(ch->chan.conn, ch->tx.cid, seg,
-			       cb, UINT_TO_POINTER(ch->tx.cid));
+	if (view) {
+		struct bt_l2cap_hdr *hdr;
+
+		hdr = net_buf_push(seg, sizeof(*hdr));
+		hdr->len = sys_cpu_to_le16(net_buf_frags_len(seg) - sizeof(*hdr));
+		hdr->cid = sys_cpu_to_le16(ch->tx.cid);
+
+		err = bt_conn_send_cb(ch->chan.conn, seg, cb,
+				      UINT_TO_POINTER(ch->tx.cid));
+	} else {
+		err = bt_l2cap_send_cb(ch->chan.conn, ch->tx.cid, seg,
+				       cb, UINT_TO_POINTER(ch->tx.cid));
+	}
 
 	if (err) {
 		LOG_DBG("Unable to send seg %d", err);
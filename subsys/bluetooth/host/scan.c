@@ -4,10 +4,13 @@
  *
  * SPDX-License-Identifier: Apache-2.0
  */
+#include <stdlib.h>
+#include <string.h>
 #include <sys/types.h>
 
 #include <zephyr/sys/byteorder.h>
 #include <zephyr/sys/check.h>
+#include <zephyr/sys/hash_function.h>
 
 #include <zephyr/bluetooth/bluetooth.h>
 #include <zephyr/bluetooth/iso.h>
@@ -32,6 +35,176 @@ LOG_MODULE_REGISTER(bt_scan);
 static bt_le_scan_cb_t *scan_dev_found_cb;
 static sys_slist_t scan_cbs = SYS_SLIST_STATIC_INIT(&scan_cbs);
 
+#if defined(CONFIG_BT_SCAN_DUP_FILTER)
+/* Last delivered report of an advertiser, in a table indexed by a hash of
+ * the advertiser. Colliding advertisers replace each other, which can only
+ * let duplicates through, never drop a new report.
+ */
+struct dup_filter_entry {
+	bt_addr_le_t addr;
+	uint8_t sid;
+	uint8_t adv_type;
+	int8_t rssi;
+	bool used;
+	uint32_t data_hash;
+	uint32_t timestamp;
+};
+
+static struct dup_filter_entry dup_filter[CONFIG_BT_SCAN_DUP_FILTER_SIZE];
+
+static void dup_filter_reset(void)
+{
+	(void)memset(dup_filter, 0, sizeof(dup_filter));
+}
+
+static bool dup_filter_check(const bt_addr_le_t *addr,
+			     const struct bt_le_scan_recv_info *info,
+			     const uint8_t *data, uint16_t len)
+{
+	struct {
+		bt_addr_le_t addr;
+		uint8_t sid;
+		uint8_t adv_type;
+	} key = {
+		.sid = info->sid,
+		.adv_type = info->adv_type,
+	};
+	struct dup_filter_entry *entry;
+	uint32_t now = k_uptime_get_32();
+	uint32_t data_hash = sys_hash32(data, len);
+
+	bt_addr_le_copy(&key.addr, addr);
+	entry = &dup_filter[sys_hash32(&key, sizeof(key)) % ARRAY_SIZE(dup_filter)];
+
+	if (entry->used && entry->sid == key.sid && entry->adv_type == key.adv_type &&
+	    bt_addr_le_eq(&entry->addr, addr) && entry->data_hash == data_hash &&
+	    (CONFIG_BT_SCAN_DUP_FILTER_RESET == 0 ||
+	     now - entry->timestamp < CONFIG_BT_SCAN_DUP_FILTER_RESET) &&
+	    (CONFIG_BT_SCAN_DUP_FILTER_RSSI_DELTA == 0 ||
+	     abs(info->rssi - entry->rssi) < CONFIG_BT_SCAN_DUP_FILTER_RSSI_DELTA)) {
+		return true;
+	}
+
+	bt_addr_le_copy(&entry->addr, addr);
+	entry->sid = key.sid;
+	entry->adv_type = key.adv_type;
+	entry->rssi = info->rssi;
+	entry->used = true;
+	entry->data_hash = data_hash;
+	entry->timestamp = now;
+
+	return false;
+}
+#else
+static inline void dup_filter_reset(void)
+{
+}
+
+static inline bool dup_filter_check(const bt_addr_le_t *addr,
+				    const struct bt_le_scan_recv_info *info,
+				    const uint8_t *data, uint16_t len)
+{
+	return false;
+}
+#endif /* CONFIG_BT_SCAN_DUP_FILTER */
+
+#if defined(CONFIG_BT_SCAN_BATCH)
+static struct bt_le_scan_report batch[CONFIG_BT_SCAN_BATCH_COUNT];
+static uint8_t batch_data[CONFIG_BT_SCAN_BATCH_DATA_SIZE];
+static size_t batch_count;
+static size_t batch_data_len;
+static K_MUTEX_DEFINE(batch_lock);
+
+static void batch_flush_locked(void)
+{
+	struct bt_le_scan_cb *listener, *next;
+
+	if (!batch_count) {
+		return;
+	}
+
+	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&scan_cbs, listener, next, node) {
+		if (listener->recv_batch) {
+			listener->recv_batch(batch, batch_count);
+		}
+	}
+
+	batch_count = 0;
+	batch_data_len = 0;
+}
+
+static void batch_flush(void)
+{
+	k_mutex_lock(&batch_lock, K_FOREVER);
+	batch_flush_locked();
+	k_mutex_unlock(&batch_lock);
+}
+
+static void batch_timeout(struct k_work *work)
+{
+	batch_flush();
+}
+
+static K_WORK_DELAYABLE_DEFINE(batch_work, batch_timeout);
+
+static void batch_add(const struct bt_le_scan_recv_info *info,
+		      const uint8_t *data, uint16_t len)
+{
+	struct bt_le_scan_cb *listener;
+	struct bt_le_scan_report *report;
+	bool batched = false;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&scan_cbs, listener, node) {
+		if (listener->recv_batch) {
+			batched = true;
+			break;
+		}
+	}
+
+	if (!batched) {
+		return;
+	}
+
+	if (len > sizeof(batch_data)) {
+		LOG_WRN("Report of %u bytes does not fit in a batch", len);
+		return;
+	}
+
+	k_mutex_lock(&batch_lock, K_FOREVER);
+
+	if (batch_data_len + len > sizeof(batch_data)) {
+		batch_flush_locked();
+	}
+
+	report = &batch[batch_count++];
+	report->info = *info;
+	bt_addr_le_copy(&report->addr, info->addr);
+	report->info.addr = &report->addr;
+	report->data = &batch_data[batch_data_len];
+	report->data_len = len;
+	(void)memcpy(&batch_data[batch_data_len], data, len);
+	batch_data_len += len;
+
+	if (batch_count == ARRAY_SIZE(batch)) {
+		batch_flush_locked();
+		(void)k_work_cancel_delayable(&batch_work);
+	} else if (batch_count == 1) {
+		(void)k_work_schedule(&batch_work, K_MSEC(CONFIG_BT_SCAN_BATCH_TIMEOUT));
+	}
+
+	k_mutex_unlock(&batch_lock);
+}
+#else
+static inline void batch_flush(void)
+{
+}
+
+static inline void batch_add(const struct bt_le_scan_recv_info *info,
+			     const uint8_t *data, uint16_t len)
+{
+}
+#endif /* CONFIG_BT_SCAN_BATCH */
+
 #if defined(CONFIG_BT_EXT_ADV)
 /* A buffer used to reassemble advertisement data from the controller. */
 NET_BUF_SIMPLE_DEFINE(ext_scan_buf, CONFIG_BT_EXT_SCAN_BUF_SIZE);
@@ -79,6 +252,7 @@ static sys_slist_t pa_sync_cbs = SYS_SLIST_STATIC_INIT(&pa_sync_cbs);
 void bt_scan_reset(void)
 {
 	scan_dev_found_cb = NULL;
+	batch_flush();
 #if defined(CONFIG_BT_EXT_ADV)
 	reset_reassembling_advertiser();
 #endif
@@ -463,6 +637,11 @@ static void le_adv_recv(bt_addr_le_t *addr, struct bt_le_scan_recv_info *info,
 				bt_lookup_id_addr(BT_ID_DEFAULT, addr));
 	}
 
+	if (dup_filter_check(addr, info, buf->data, len)) {
+		LOG_DBG("Dropped duplicate report");
+		goto check_conn;
+	}
+
 	if (scan_dev_found_cb) {
 		net_buf_simple_save(buf, &state);
 
@@ -485,9 +664,13 @@ static void le_adv_recv(bt_addr_le_t *addr, struct bt_le_scan_recv_info *info,
 		}
 	}
 
+	batch_add(info, buf->data, len);
+
 	/* Clear pointer to this stack frame before returning to calling function */
 	info->addr = NULL;
 
+check_conn:
+
 #if defined(CONFIG_BT_CENTRAL)
 	check_pending_conn(&id_addr, addr, info->adv_props);
 #endif /* CONFIG_BT_CENTRAL */
@@ -1535,6 +1718,7 @@ int bt_le_scan_start(const struct bt_le_scan_param *param, bt_le_scan_cb_t cb)
 		return err;
 	}
 
+	dup_filter_reset();
 	scan_dev_found_cb = cb;
 
 	return 0;
@@ -298,6 +298,117 @@ int bt_settings_init(void)
 	return 0;
 }
 
+#if defined(CONFIG_BT_SETTINGS_BATCH)
+/* Stores and deletes that have not been written yet. A later store of the
+ * same key replaces the pending one, so a value that changes several times
+ * in a row is only written once.
+ */
+struct pending_store {
+	char key[BT_SETTINGS_KEY_MAX];
+	uint8_t value[CONFIG_BT_SETTINGS_BATCH_VALUE_SIZE];
+	size_t len;
+	bool used;
+};
+
+static struct pending_store pending[CONFIG_BT_SETTINGS_BATCH_COUNT];
+static K_MUTEX_DEFINE(pending_lock);
+
+static void pending_flush_locked(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(pending); i++) {
+		struct pending_store *entry = &pending[i];
+		int err;
+
+		if (!entry->used) {
+			continue;
+		}
+
+		err = settings_save_one(entry->key, entry->len ? entry->value : NULL, entry->len);
+		if (err) {
+			LOG_ERR("Failed to store %s (err %d)", entry->key, err);
+		}
+
+		entry->used = false;
+	}
+}
+
+static void pending_flush(struct k_work *work)
+{
+	k_mutex_lock(&pending_lock, K_FOREVER);
+	pending_flush_locked();
+	k_mutex_unlock(&pending_lock);
+}
+
+static K_WORK_DELAYABLE_DEFINE(pending_work, pending_flush);
+
+static int save_one(const char *key, const void *value, size_t val_len)
+{
+	struct pending_store *entry = NULL;
+
+	k_mutex_lock(&pending_lock, K_FOREVER);
+
+	for (size_t i = 0; i < ARRAY_SIZE(pending); i++) {
+		if (pending[i].used && !strcmp(pending[i].key, key)) {
+			entry = &pending[i];
+			break;
+		}
+
+		if (!pending[i].used && !entry) {
+			entry = &pending[i];
+		}
+	}
+
+	if (val_len > sizeof(pending[0].value)) {
+		int err;
+
+		/* Too large to be deferred, drop an older pending value and
+		 * write it right away.
+		 */
+		if (entry && entry->used && !strcmp(entry->key, key)) {
+			entry->used = false;
+		}
+
+		k_mutex_unlock(&pending_lock);
+
+		err = settings_save_one(key, value, val_len);
+
+		return err;
+	}
+
+	if (!entry) {
+		pending_flush_locked();
+		entry = &pending[0];
+	}
+
+	if (!entry->used) {
+		strcpy(entry->key, key);
+		entry->used = true;
+	}
+
+	if (val_len) {
+		memcpy(entry->value, value, val_len);
+	}
+	entry->len = val_len;
+
+	k_mutex_unlock(&pending_lock);
+
+	/* Write once the stores have been idle for a while */
+	k_work_reschedule(&pending_work, K_MSEC(CONFIG_BT_SETTINGS_BATCH_IDLE_MS));
+
+	return 0;
+}
+
+void bt_settings_flush(void)
+{
+	k_work_reschedule(&pending_work, K_NO_WAIT);
+}
+#else
+static int save_one(const char *key, const void *value, size_t val_len)
+{
+	return settings_save_one(key, value, val_len);
+}
+#endif /* CONFIG_BT_SETTINGS_BATCH */
+
 int bt_settings_store(const char *key, uint8_t id, const bt_addr_le_t *addr, const void *value,
 		      size_t val_len)
 {
@@ -318,7 +429,7 @@ int bt_settings_store(const char *key, uint8_t id, const bt_addr_le_t *addr, con
 		}
 	}
 
-	return settings_save_one(key_str, value, val_len);
+	return save_one(key_str, value, val_len);
 }
 
 int bt_settings_delete(const char *key, uint8_t id, const bt_addr_le_t *addr)
@@ -340,7 +451,7 @@ int bt_settings_delete(const char *key, uint8_t id, const bt_addr_le_t *addr)
 		}
 	}
 
-	return settings_delete(key_str);
+	return save_one(key_str, NULL, 0);
 }
 
 int bt_settings_store_sc(uint8_t id, const bt_addr_le_t *addr, const void *value, size_t val_len)
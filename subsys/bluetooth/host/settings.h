@@ -30,6 +30,17 @@ void bt_settings_save_id(void);
 
 int bt_settings_init(void);
 
+#if defined(CONFIG_BT_SETTINGS_BATCH)
+/* Write the pending stores from the system workqueue without waiting for
+ * the stores to be idle.
+ */
+void bt_settings_flush(void);
+#else
+static inline void bt_settings_flush(void)
+{
+}
+#endif /* CONFIG_BT_SETTINGS_BATCH */
+
 int bt_settings_store_sc(uint8_t id, const bt_addr_le_t *addr, const void *value, size_t val_len);
 int bt_settings_delete_sc(uint8_t id, const bt_addr_le_t *addr);
 
@@ -279,6 +279,13 @@ static struct bt_smp_br bt_smp_br_pool[CONFIG_BT_MAX_CONN];
 #endif /* CONFIG_BT_BREDR */
 
 static struct bt_smp bt_smp_pool[CONFIG_BT_MAX_CONN];
+
+#if defined(CONFIG_BT_ECC_ASYNC)
+/* DHKey calculations of the SMP contexts. Kept out of struct bt_smp since a
+ * calculation can still be in progress when the context is cleared.
+ */
+static struct bt_dh_key_req smp_dhkey_reqs[ARRAY_SIZE(bt_smp_pool)];
+#endif /* CONFIG_BT_ECC_ASYNC */
 static bool bondable = IS_ENABLED(CONFIG_BT_BONDABLE);
 static bool sc_oobd_present;
 static bool legacy_oobd_present;
@@ -3398,13 +3405,25 @@ static uint8_t compute_and_check_and_send_periph_dhcheck(struct bt_smp *smp)
 }
 #endif /* CONFIG_BT_PERIPHERAL */
 
+#if defined(CONFIG_BT_ECC_ASYNC)
+static void smp_dhkey_req_done(struct bt_dh_key_req *req, const uint8_t *dhkey);
+#else
 static void bt_smp_dhkey_ready(const uint8_t *dhkey);
+#endif /* CONFIG_BT_ECC_ASYNC */
+
 static uint8_t smp_dhkey_generate(struct bt_smp *smp)
 {
 	int err;
 
 	atomic_set_bit(smp->flags, SMP_FLAG_DHKEY_GEN);
+#if defined(CONFIG_BT_ECC_ASYNC)
+	struct bt_dh_key_req *req = &smp_dhkey_reqs[smp - bt_smp_pool];
+
+	req->func = smp_dhkey_req_done;
+	err = bt_dh_key_gen_async(req, smp->pkey);
+#else
 	err = bt_dh_key_gen(smp->pkey, bt_smp_dhkey_ready);
+#endif /* CONFIG_BT_ECC_ASYNC */
 	if (err) {
 		atomic_clear_bit(smp->flags, SMP_FLAG_DHKEY_GEN);
 
@@ -3463,6 +3482,25 @@ static struct bt_smp *smp_find(int flag)
 	return NULL;
 }
 
+#if defined(CONFIG_BT_ECC_ASYNC)
+static void smp_dhkey_req_done(struct bt_dh_key_req *req, const uint8_t *dhkey)
+{
+	struct bt_smp *smp = &bt_smp_pool[req - smp_dhkey_reqs];
+	uint8_t err;
+
+	LOG_DBG("%p", (void *)dhkey);
+
+	/* The pairing may have been cancelled during the calculation */
+	if (!atomic_test_and_clear_bit(smp->flags, SMP_FLAG_DHKEY_GEN)) {
+		return;
+	}
+
+	err = smp_dhkey_ready(smp, dhkey);
+	if (err) {
+		smp_error(smp, err);
+	}
+}
+#else
 static void bt_smp_dhkey_ready(const uint8_t *dhkey)
 {
 	LOG_DBG("%p", (void *)dhkey);
@@ -3488,6 +3526,7 @@ static void bt_smp_dhkey_ready(const uint8_t *dhkey)
 		}
 	} while (smp && err);
 }
+#endif /* CONFIG_BT_ECC_ASYNC */
 
 static uint8_t sc_smp_check_confirm(struct bt_smp *smp)
 {
@@ -4083,7 +4122,9 @@ static uint8_t generate_dhkey(struct bt_smp *smp)
 	}
 
 	atomic_set_bit(smp->flags, SMP_FLAG_DHKEY_PENDING);
-	if (!smp_find(SMP_FLAG_DHKEY_GEN)) {
+
+	/* Without concurrent calculations, wait for the one in progress */
+	if (IS_ENABLED(CONFIG_BT_ECC_ASYNC) || !smp_find(SMP_FLAG_DHKEY_GEN)) {
 		return smp_dhkey_generate(smp);
 	}
 
@@ -268,9 +268,15 @@ static void send_pending_adv(struct k_work *work)
 			ext_adv->adv = NULL;
 		}
 
-		(void)schedule_send(ext_adv);
+		/* Continue with the next queued message right away instead of
+		 * resubmitting the work, so that queued messages, e.g. relayed
+		 * ones, are sent back to back.
+		 */
+		if (atomic_test_and_set_bit(ext_adv->flags, ADV_FLAG_SCHEDULED)) {
+			return;
+		}
 
-		return;
+		atomic_clear_bit(ext_adv->flags, ADV_FLAG_SCHEDULE_PENDING);
 	}
 
 	atomic_clear_bit(ext_adv->flags, ADV_FLAG_SCHEDULED);
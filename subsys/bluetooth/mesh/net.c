@@ -137,10 +137,93 @@ static bool check_dup(struct net_buf_simple *data)
 	return false;
 }
 
+#if defined(CONFIG_BT_MESH_MSG_CACHE_HASH)
+#define MSG_CACHE_NONE UINT16_MAX
+
+/* Heads of the hash chains, and the next entry in the chain of each
+ * msg_cache entry.
+ */
+static uint16_t msg_cache_bucket[CONFIG_BT_MESH_MSG_CACHE_SIZE];
+static uint16_t msg_cache_chain[CONFIG_BT_MESH_MSG_CACHE_SIZE];
+
+static uint16_t *msg_cache_head(uint16_t src, uint32_t seq)
+{
+	uint32_t key = ((uint32_t)src << 17) | (seq & BIT_MASK(17));
+
+	return &msg_cache_bucket[((key * 0x9e3779b1U) >> 16) % ARRAY_SIZE(msg_cache_bucket)];
+}
+
+static void msg_cache_link(uint16_t idx)
+{
+	uint16_t *head = msg_cache_head(msg_cache[idx].src, msg_cache[idx].seq);
+
+	msg_cache_chain[idx] = *head;
+	*head = idx;
+}
+
+static void msg_cache_unlink(uint16_t idx)
+{
+	uint16_t *next;
+
+	if (msg_cache[idx].src == BT_MESH_ADDR_UNASSIGNED) {
+		return;
+	}
+
+	for (next = msg_cache_head(msg_cache[idx].src, msg_cache[idx].seq);
+	     *next != MSG_CACHE_NONE; next = &msg_cache_chain[*next]) {
+		if (*next == idx) {
+			*next = msg_cache_chain[idx];
+			return;
+		}
+	}
+}
+
+static bool msg_cache_find(uint16_t src, uint32_t seq)
+{
+	uint16_t i;
+
+	seq &= BIT_MASK(17);
+
+	for (i = *msg_cache_head(src, seq); i != MSG_CACHE_NONE; i = msg_cache_chain[i]) {
+		if (msg_cache[i].src == src && msg_cache[i].seq == seq) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static void msg_cache_hash_reset(void)
+{
+	(void)memset(msg_cache_bucket, 0xff, sizeof(msg_cache_bucket));
+}
+#else
+static inline void msg_cache_link(uint16_t idx)
+{
+}
+
+static inline void msg_cache_unlink(uint16_t idx)
+{
+}
+
+static inline bool msg_cache_find(uint16_t src, uint32_t seq)
+{
+	return false;
+}
+
+static inline void msg_cache_hash_reset(void)
+{
+}
+#endif /* CONFIG_BT_MESH_MSG_CACHE_HASH */
+
 static bool msg_cache_match(struct net_buf_simple *pdu)
 {
 	uint16_t i;
 
+	if (IS_ENABLED(CONFIG_BT_MESH_MSG_CACHE_HASH)) {
+		return msg_cache_find(SRC(pdu->data), SEQ(pdu->data));
+	}
+
 	for (i = msg_cache_next; i > 0U;) {
 		if (msg_cache[--i].src == SRC(pdu->data) &&
 		    msg_cache[i].seq == (SEQ(pdu->data) & BIT_MASK(17))) {
@@ -161,11 +244,27 @@ static bool msg_cache_match(struct net_buf_simple *pdu)
 static void msg_cache_add(struct bt_mesh_net_rx *rx)
 {
 	msg_cache_next %= ARRAY_SIZE(msg_cache);
+	msg_cache_unlink(msg_cache_next);
 	msg_cache[msg_cache_next].src = rx->ctx.addr;
 	msg_cache[msg_cache_next].seq = rx->seq;
+	msg_cache_link(msg_cache_next);
 	msg_cache_next++;
 }
 
+static void msg_cache_remove_last(void)
+{
+	msg_cache_next--;
+	msg_cache_unlink(msg_cache_next);
+	msg_cache[msg_cache_next].src = BT_MESH_ADDR_UNASSIGNED;
+}
+
+static void msg_cache_reset(void)
+{
+	(void)memset(msg_cache, 0, sizeof(msg_cache));
+	msg_cache_hash_reset();
+	msg_cache_next = 0U;
+}
+
 static void store_iv(bool only_duration)
 {
 	bt_mesh_settings_store_schedule(BT_MESH_SETTINGS_IV_PENDING);
@@ -207,8 +306,7 @@ int bt_mesh_net_create(uint16_t idx, uint8_t flags, const struct bt_mesh_key *ke
 		return err;
 	}
 
-	(void)memset(msg_cache, 0, sizeof(msg_cache));
-	msg_cache_next = 0U;
+	msg_cache_reset();
 
 	bt_mesh.iv_index = iv_index;
 	atomic_set_bit_to(bt_mesh.flags, BT_MESH_IVU_IN_PROGRESS,
@@ -693,6 +791,15 @@ static void bt_mesh_net_relay(struct net_buf_simple *sbuf,
 		return;
 	}
 
+	/* Skip the re-encryption if the packet would not be sent on any
+	 * bearer, e.g. a GATT Proxy without connected clients.
+	 */
+	if (!relay_to_adv(rx->net_if) && !rx->friend_cred &&
+	    (!IS_ENABLED(CONFIG_BT_MESH_GATT_PROXY) ||
+	     bt_mesh_proxy_srv_connected_cnt() == 0U)) {
+		return;
+	}
+
 	LOG_DBG("TTL %u CTL %u dst 0x%04x", rx->ctx.recv_ttl, rx->ctl, rx->ctx.recv_dst);
 
 	/* The Relay Retransmit state is only applied to adv-adv relaying.
@@ -877,7 +984,7 @@ void bt_mesh_net_recv(struct net_buf_simple *data, int8_t rssi,
 		 */
 		LOG_WRN("Removing rejected message from Network Message Cache");
 		/* Rewind the next index now that we're not using this entry */
-		msg_cache[--msg_cache_next].src = BT_MESH_ADDR_UNASSIGNED;
+		msg_cache_remove_last();
 		dup_cache[--dup_cache_next] = 0;
 		return;
 	} else if (err == -EBADMSG) {
@@ -941,6 +1048,8 @@ void bt_mesh_net_init(void)
 	k_work_init_delayable(&bt_mesh.ivu_timer, ivu_refresh);
 
 	k_work_init(&bt_mesh.local_work, bt_mesh_net_local);
+
+	msg_cache_hash_reset();
 }
 
 static int net_set(const char *name, size_t len_rd, settings_read_cb read_cb,
@@ -148,7 +148,7 @@ static void receive_send_fc(struct isotp_recv_ctx *rctx, uint8_t fs)
 	}
 
 	*data++ = ISOTP_PCI_TYPE_FC | fs;
-	*data++ = rctx->opts.bs;
+	*data++ = rctx->bs;
 	*data++ = rctx->opts.stmin;
 	payload_len = data - frame.data;
 
@@ -220,16 +220,34 @@ static void receive_timeout_handler(struct k_timer *timer)
 	k_work_submit(&rctx->work);
 }
 
+/* Number of CFs of the next block, announced in the FC */
+static uint8_t receive_block_size(struct isotp_recv_ctx *rctx)
+{
+#ifdef CONFIG_ISOTP_RX_BS_AUTO
+	/* As many as the free buffers can take, but at least the configured BS */
+	uint32_t free_len = atomic_get(&isotp_rx_pool.avail_count) * CONFIG_ISOTP_RX_BUF_SIZE;
+	uint32_t frames = free_len / (rctx->rx_addr.dl - 1);
+
+	return CLAMP(frames, rctx->opts.bs, UINT8_MAX);
+#else
+	return rctx->opts.bs;
+#endif
+}
+
 static int receive_alloc_buffer(struct isotp_recv_ctx *rctx)
 {
 	struct net_buf *buf = NULL;
 
 	if (rctx->opts.bs == 0) {
 		/* Alloc all buffers because we can't wait during reception */
+		rctx->bs = 0;
 		buf = receive_alloc_buffer_chain(rctx->length);
 	} else {
 		/* Alloc the minimum of the remaining length and bytes of one block */
-		uint32_t len = MIN(rctx->length, rctx->opts.bs * (rctx->rx_addr.dl - 1));
+		uint32_t len;
+
+		rctx->bs = receive_block_size(rctx);
+		len = MIN(rctx->length, rctx->bs * (rctx->rx_addr.dl - 1));
 
 		buf = receive_alloc_buffer_chain(len);
 	}
@@ -297,7 +315,6 @@ static void receive_state_machine(struct isotp_recv_ctx *rctx)
 		}
 
 		if (rctx->opts.bs) {
-			rctx->bs = rctx->opts.bs;
 			ud_rem_len = net_buf_user_data(rctx->buf);
 			*ud_rem_len = rctx->length;
 			net_buf_put(&rctx->fifo, rctx->buf);
@@ -544,7 +561,6 @@ static void process_cf(struct isotp_recv_ctx *rctx, struct can_frame *frame)
 
 	if (rctx->opts.bs && !--rctx->bs) {
 		LOG_DBG("Block is complete. Allocate new buffer");
-		rctx->bs = rctx->opts.bs;
 		*ud_rem_len = rctx->length;
 		net_buf_put(&rctx->fifo, rctx->buf);
 		rctx->state = ISOTP_RX_STATE_TRY_ALLOC;
@@ -758,13 +774,15 @@ static void send_can_tx_cb(const struct device *dev, int error, void *arg)
 {
 	struct isotp_send_ctx *sctx = (struct isotp_send_ctx *)arg;
 
+	atomic_val_t backlog;
+
 	ARG_UNUSED(dev);
 
-	sctx->tx_backlog--;
+	backlog = atomic_dec(&sctx->tx_backlog) - 1;
 	k_sem_give(&sctx->tx_sem);
 
 	if (sctx->state == ISOTP_TX_WAIT_BACKLOG) {
-		if (sctx->tx_backlog > 0) {
+		if (backlog > 0) {
 			return;
 		}
 
@@ -815,7 +833,6 @@ static void send_process_fc(struct isotp_send_ctx *sctx, struct can_frame *frame
 	case ISOTP_PCI_FS_CTS:
 		sctx->state = ISOTP_TX_SEND_CF;
 		sctx->wft = 0;
-		sctx->tx_backlog = 0;
 		k_sem_reset(&sctx->tx_sem);
 		sctx->opts.bs = *data++;
 		sctx->opts.stmin = *data++;
@@ -890,6 +907,21 @@ static void pull_send_ctx_data(struct isotp_send_ctx *sctx, size_t len)
 	}
 }
 
+static int send_frame(struct isotp_send_ctx *sctx, const struct can_frame *frame)
+{
+	int ret;
+
+	/* Counted first, the frame may be sent before can_send() returns */
+	atomic_inc(&sctx->tx_backlog);
+
+	ret = can_send(sctx->can_dev, frame, K_MSEC(ISOTP_A_TIMEOUT_MS), send_can_tx_cb, sctx);
+	if (ret != 0) {
+		atomic_dec(&sctx->tx_backlog);
+	}
+
+	return ret;
+}
+
 static inline int send_sf(struct isotp_send_ctx *sctx)
 {
 	struct can_frame frame;
@@ -937,7 +969,7 @@ static inline int send_sf(struct isotp_send_ctx *sctx)
 	}
 
 	sctx->state = ISOTP_TX_SEND_SF;
-	ret = can_send(sctx->can_dev, &frame, K_MSEC(ISOTP_A_TIMEOUT_MS), send_can_tx_cb, sctx);
+	ret = send_frame(sctx, &frame);
 	return ret;
 }
 
@@ -977,7 +1009,7 @@ static inline int send_ff(struct isotp_send_ctx *sctx)
 	pull_send_ctx_data(sctx, sctx->tx_addr.dl - index);
 	memcpy(&frame.data[index], data, sctx->tx_addr.dl - index);
 
-	ret = can_send(sctx->can_dev, &frame, K_MSEC(ISOTP_A_TIMEOUT_MS), send_can_tx_cb, sctx);
+	ret = send_frame(sctx, &frame);
 	return ret;
 }
 
@@ -1019,12 +1051,11 @@ static inline int send_cf(struct isotp_send_ctx *sctx)
 		frame.dlc = can_bytes_to_dlc(len + index);
 	}
 
-	ret = can_send(sctx->can_dev, &frame, K_MSEC(ISOTP_A_TIMEOUT_MS), send_can_tx_cb, sctx);
+	ret = send_frame(sctx, &frame);
 	if (ret == 0) {
 		sctx->sn++;
 		pull_send_ctx_data(sctx, len);
 		sctx->bs--;
-		sctx->tx_backlog++;
 	}
 
 	ret = ret ? ret : rem_len;
@@ -1096,6 +1127,12 @@ static void send_state_machine(struct isotp_send_ctx *sctx)
 			ret = send_cf(sctx);
 			if (!ret) {
 				sctx->state = ISOTP_TX_WAIT_BACKLOG;
+
+				/* The frames may all be out already */
+				if (atomic_get(&sctx->tx_backlog) == 0) {
+					sctx->state = ISOTP_TX_WAIT_FIN;
+					k_work_submit(&sctx->work);
+				}
 				break;
 			}
 
@@ -1117,8 +1154,12 @@ static void send_state_machine(struct isotp_send_ctx *sctx)
 				break;
 			}
 
-			/* Ensure FIFO style transmission of CF */
-			k_sem_take(&sctx->tx_sem, K_FOREVER);
+			/* Ensure FIFO style transmission of CF, keeping at most
+			 * CONFIG_ISOTP_TX_BATCH_SIZE of them queued to the controller.
+			 */
+			while (atomic_get(&sctx->tx_backlog) >= CONFIG_ISOTP_TX_BATCH_SIZE) {
+				k_sem_take(&sctx->tx_sem, K_FOREVER);
+			}
 		} while (ret > 0);
 
 		break;
@@ -1211,6 +1252,7 @@ static int send(struct isotp_send_ctx *sctx, const struct device *can_dev,
 	}
 
 	k_sem_init(&sctx->tx_sem, 0, 1);
+	atomic_set(&sctx->tx_backlog, 0);
 	sctx->can_dev = can_dev;
 	sctx->tx_addr = *tx_addr;
 	sctx->rx_addr = *rx_addr;
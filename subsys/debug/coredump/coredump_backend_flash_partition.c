@@ -5,6 +5,7 @@
  */
 
 #include <errno.h>
+#include <zephyr/init.h>
 #include <zephyr/kernel.h>
 #include <string.h>
 #include <zephyr/toolchain.h>
@@ -30,6 +31,10 @@ LOG_MODULE_REGISTER(coredump, CONFIG_KERNEL_LOG_LEVEL);
  * coredump data follows. The padding is to simplify the data read
  * function so that the first read of a data stream is always
  * aligned to flash write size.
+ *
+ * With CONFIG_DEBUG_COREDUMP_FLASH_PREERASE, the partition is erased
+ * ahead of time, once its core dump is erased or at boot when it holds
+ * none, so that it only needs to be programmed in the fatal error path.
  */
 #define FLASH_PARTITION		coredump_partition
 #define FLASH_PARTITION_ID	FIXED_PARTITION_ID(FLASH_PARTITION)
@@ -64,6 +69,9 @@ static struct {
 
 	/* Error encountered */
 	int				error;
+
+	/* Whole partition known to be erased */
+	bool				erased;
 } backend_ctx;
 
 /* Buffer used in stream flash context */
@@ -355,6 +363,9 @@ static int erase_coredump_header(void)
 {
 	int ret;
 
+	/* The coredump data is left behind */
+	backend_ctx.erased = false;
+
 	ret = partition_open();
 	if (ret == 0) {
 		/* Erase header block */
@@ -386,6 +397,8 @@ static int erase_flash_partition(void)
 				       backend_ctx.flash_area->fa_size);
 	}
 
+	backend_ctx.erased = (ret == 0);
+
 	partition_close();
 
 	return ret;
@@ -404,12 +417,15 @@ static void coredump_flash_backend_start(void)
 
 	ret = partition_open();
 
-	if (ret == 0) {
+	if (ret == 0 && !backend_ctx.erased) {
 		/* Erase whole flash partition */
 		ret = flash_area_erase(backend_ctx.flash_area, 0,
 				       backend_ctx.flash_area->fa_size);
 	}
 
+	/* From now on, the partition is being written */
+	backend_ctx.erased = false;
+
 	if (ret == 0) {
 		backend_ctx.checksum = 0;
 
@@ -613,6 +629,84 @@ static int coredump_flash_backend_cmd(enum coredump_cmd_id cmd_id,
 }
 
 
+#ifdef CONFIG_DEBUG_COREDUMP_FLASH_PREERASE
+/**
+ * @brief Check whether the whole flash partition is erased.
+ *
+ * @return 1 if erased, 0 if not, error otherwise
+ */
+static int partition_check_erased(void)
+{
+	uint8_t erased_val = flash_area_erased_val(backend_ctx.flash_area);
+	uint8_t buf[64];
+	off_t off;
+	size_t len;
+	int ret;
+
+	for (off = 0; off < backend_ctx.flash_area->fa_size; off += len) {
+		len = MIN(sizeof(buf), backend_ctx.flash_area->fa_size - off);
+
+		ret = flash_area_read(backend_ctx.flash_area, off, buf, len);
+		if (ret != 0) {
+			return ret;
+		}
+
+		for (size_t i = 0; i < len; i++) {
+			if (buf[i] != erased_val) {
+				return 0;
+			}
+		}
+	}
+
+	return 1;
+}
+
+/**
+ * @brief Erase the flash partition at boot unless it holds a core dump.
+ *
+ * The partition of a stored core dump is erased with the erase command,
+ * once the core dump has been retrieved.
+ *
+ * @return 0 if successful; error otherwise
+ */
+static int coredump_flash_backend_init(void)
+{
+	struct flash_hdr_t hdr;
+	int ret;
+
+	ret = partition_open();
+	if (ret != 0) {
+		return ret;
+	}
+
+	ret = data_read(0, (uint8_t *)&hdr, sizeof(hdr), NULL, NULL);
+	if (ret != 0) {
+		goto out;
+	}
+
+	if ((hdr.id[0] == 'C') && (hdr.id[1] == 'D') && (hdr.error == 0)) {
+		goto out;
+	}
+
+	ret = partition_check_erased();
+	if (ret == 0) {
+		ret = flash_area_erase(backend_ctx.flash_area, 0,
+				       backend_ctx.flash_area->fa_size);
+	} else if (ret == 1) {
+		ret = 0;
+	}
+
+	backend_ctx.erased = (ret == 0);
+
+out:
+	partition_close();
+
+	return ret;
+}
+
+SYS_INIT(coredump_flash_backend_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
+#endif /* CONFIG_DEBUG_COREDUMP_FLASH_PREERASE */
+
 struct coredump_backend_api coredump_backend_flash_partition = {
 	.start = coredump_flash_backend_start,
 	.end = coredump_flash_backend_end,
@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/debug/coredump.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/iterable_sections.h>
+#include <zephyr/sys/util.h>
+
+#include <lz4.h>
+
+#include "coredump_internal.h"
+
+/*
+ * The memory blocks are cut into chunks, each one compressed as an
+ * independent LZ4 block so that only one chunk needs to be buffered. The
+ * chunks that are all zero, and the free memory of the heaps, are only
+ * described by their size.
+ */
+
+#define CHUNK_SIZE	CONFIG_DEBUG_COREDUMP_COMPRESS_CHUNK_SIZE
+
+/* Longest run of zero or unused memory described by one chunk */
+#define ZERO_RUN_MAX	UINT16_MAX
+
+/* Copy of the chunk, as the memory keeps changing while being dumped */
+static uint8_t chunk_buf[CHUNK_SIZE];
+static uint8_t lz4_buf[LZ4_COMPRESSBOUND(CHUNK_SIZE)];
+static LZ4_stream_t lz4_state;
+
+#ifdef CONFIG_DEBUG_COREDUMP_SKIP_FREE_HEAP
+struct free_range {
+	uintptr_t start;
+	uintptr_t end;
+};
+
+static struct free_range free_ranges[CONFIG_DEBUG_COREDUMP_FREE_HEAP_RANGES];
+static size_t num_free_ranges;
+
+/* Keep the largest free ranges when there are more than fit */
+static void add_free_range(uintptr_t start, size_t size, void *user_data)
+{
+	size_t smallest = 0;
+
+	ARG_UNUSED(user_data);
+
+	if (size < CONFIG_DEBUG_COREDUMP_FREE_HEAP_MIN_SIZE) {
+		return;
+	}
+
+	if (num_free_ranges < ARRAY_SIZE(free_ranges)) {
+		smallest = num_free_ranges++;
+	} else {
+		for (size_t i = 1; i < num_free_ranges; i++) {
+			if (free_ranges[i].end - free_ranges[i].start <
+			    free_ranges[smallest].end - free_ranges[smallest].start) {
+				smallest = i;
+			}
+		}
+
+		if (free_ranges[smallest].end - free_ranges[smallest].start >= size) {
+			return;
+		}
+	}
+
+	free_ranges[smallest].start = start;
+	free_ranges[smallest].end = start + size;
+}
+
+void z_coredump_compress_start(void)
+{
+	num_free_ranges = 0;
+
+	STRUCT_SECTION_FOREACH(k_heap, h) {
+		(void)sys_heap_free_foreach(&h->heap, add_free_range, NULL);
+	}
+}
+
+/* End of the free range at @p addr, or 0 if @p addr is in use */
+static uintptr_t free_range_end(uintptr_t addr)
+{
+	for (size_t i = 0; i < num_free_ranges; i++) {
+		if (addr >= free_ranges[i].start && addr < free_ranges[i].end) {
+			return free_ranges[i].end;
+		}
+	}
+
+	return 0;
+}
+
+/* Start of the first free range after @p addr, or @p limit */
+static uintptr_t next_free_range(uintptr_t addr, uintptr_t limit)
+{
+	for (size_t i = 0; i < num_free_ranges; i++) {
+		if (free_ranges[i].start > addr && free_ranges[i].start < limit) {
+			limit = free_ranges[i].start;
+		}
+	}
+
+	return limit;
+}
+#else
+void z_coredump_compress_start(void)
+{
+}
+
+static uintptr_t free_range_end(uintptr_t addr)
+{
+	ARG_UNUSED(addr);
+
+	return 0;
+}
+
+static uintptr_t next_free_range(uintptr_t addr, uintptr_t limit)
+{
+	ARG_UNUSED(addr);
+
+	return limit;
+}
+#endif /* CONFIG_DEBUG_COREDUMP_SKIP_FREE_HEAP */
+
+static void chunk_output(char type, size_t size, uint8_t *data, size_t data_size)
+{
+	struct coredump_mem_chunk_hdr_t c = {
+		.type = type,
+		.size = sys_cpu_to_le16(size),
+		.data_size = sys_cpu_to_le16(data_size),
+	};
+
+	coredump_buffer_output((uint8_t *)&c, sizeof(c));
+	coredump_buffer_output(data, data_size);
+}
+
+static void zero_run_output(size_t run)
+{
+	while (run > 0) {
+		size_t size = MIN(run, ZERO_RUN_MAX);
+
+		chunk_output(COREDUMP_MEM_CHUNK_ZERO, size, NULL, 0);
+		run -= size;
+	}
+}
+
+static bool chunk_is_zero(const uint8_t *buf, size_t len)
+{
+	for (size_t i = 0; i < len; i++) {
+		if (buf[i] != 0U) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void z_coredump_compressed_memory_dump(uintptr_t start_addr, uintptr_t end_addr)
+{
+	uintptr_t addr = start_addr;
+	size_t zero_run = 0;
+
+	while (addr < end_addr) {
+		uintptr_t free_end = free_range_end(addr);
+		size_t len;
+		int comp;
+
+		if (free_end != 0) {
+			free_end = MIN(free_end, end_addr);
+			zero_run += free_end - addr;
+			addr = free_end;
+			continue;
+		}
+
+		len = MIN(CHUNK_SIZE, next_free_range(addr, end_addr) - addr);
+		(void)memcpy(chunk_buf, UINT_TO_POINTER(addr), len);
+		addr += len;
+
+		if (chunk_is_zero(chunk_buf, len)) {
+			zero_run += len;
+			continue;
+		}
+
+		zero_run_output(zero_run);
+		zero_run = 0;
+
+		comp = LZ4_compress_fast_extState(&lz4_state, (const char *)chunk_buf,
+						  (char *)lz4_buf, len, sizeof(lz4_buf), 1);
+		if (comp > 0 && (size_t)comp < len) {
+			chunk_output(COREDUMP_MEM_CHUNK_LZ4, len, lz4_buf, comp);
+		} else {
+			chunk_output(COREDUMP_MEM_CHUNK_RAW, len, chunk_buf, len);
+		}
+	}
+
+	zero_run_output(zero_run);
+}
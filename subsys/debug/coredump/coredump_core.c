@@ -122,6 +122,10 @@ void coredump(unsigned int reason, const z_arch_esf_t *esf,
 {
 	z_coredump_start();
 
+	if (IS_ENABLED(CONFIG_DEBUG_COREDUMP_COMPRESS)) {
+		z_coredump_compress_start();
+	}
+
 	dump_header(reason);
 
 	if (esf != NULL) {
@@ -174,7 +178,8 @@ void coredump_memory_dump(uintptr_t start_addr, uintptr_t end_addr)
 	len = end_addr - start_addr;
 
 	m.id = COREDUMP_MEM_HDR_ID;
-	m.hdr_version = COREDUMP_MEM_HDR_VER;
+	m.hdr_version = IS_ENABLED(CONFIG_DEBUG_COREDUMP_COMPRESS) ?
+			COREDUMP_MEM_HDR_VER_CHUNKED : COREDUMP_MEM_HDR_VER;
 
 	if (sizeof(uintptr_t) == 8) {
 		m.start	= sys_cpu_to_le64(start_addr);
@@ -186,7 +191,11 @@ void coredump_memory_dump(uintptr_t start_addr, uintptr_t end_addr)
 
 	coredump_buffer_output((uint8_t *)&m, sizeof(m));
 
-	coredump_buffer_output((uint8_t *)start_addr, len);
+	if (IS_ENABLED(CONFIG_DEBUG_COREDUMP_COMPRESS)) {
+		z_coredump_compressed_memory_dump(start_addr, end_addr);
+	} else {
+		coredump_buffer_output((uint8_t *)start_addr, len);
+	}
 }
 
 int coredump_query(enum coredump_query_id query_id, void *arg)
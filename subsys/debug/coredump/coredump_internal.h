@@ -53,6 +53,21 @@ void z_coredump_start(void);
  */
 void z_coredump_end(void);
 
+/**
+ * @brief Prepare the compression of the memory blocks
+ *
+ * This collects the free memory of the heaps, left out of the dump.
+ */
+void z_coredump_compress_start(void);
+
+/**
+ * @brief Output a memory block as compressed chunks
+ *
+ * @param start_addr Start address of the memory block
+ * @param end_addr End address of the memory block
+ */
+void z_coredump_compressed_memory_dump(uintptr_t start_addr, uintptr_t end_addr);
+
 /**
  * @endcond
  */
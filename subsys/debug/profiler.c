@@ -0,0 +1,471 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <stdlib.h>
+#include <zephyr/kernel.h>
+#include <zephyr/kernel_structs.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/debug/profiler.h>
+
+#if defined(CONFIG_CPU_CORTEX_M)
+#include <cmsis_core.h>
+#endif
+
+#if defined(CONFIG_PROFILER_COUNTER)
+#include <zephyr/drivers/counter.h>
+#endif
+
+#if defined(CONFIG_PROFILER_SHELL)
+#include <zephyr/shell/shell.h>
+#endif
+
+struct profiler_cpu {
+	size_t count;
+	uint32_t dropped;
+	struct profiler_sample samples[CONFIG_PROFILER_SAMPLES];
+};
+
+static struct profiler_cpu profiler_cpus[CONFIG_MP_MAX_NUM_CPUS];
+static atomic_t profiler_running;
+
+#if defined(CONFIG_PROFILER_FRAME_POINTER)
+/* Collect the return addresses of the frame pointer chain starting at fp,
+ * as long as the frames are within the stack of the interrupted thread.
+ */
+static uint8_t walk_frames(struct k_thread *thread, uintptr_t fp, uintptr_t *pc,
+			   uint8_t max)
+{
+	uintptr_t start = thread->stack_info.start;
+	uintptr_t end = start + thread->stack_info.size;
+	uint8_t depth = 0;
+
+	while ((depth < max) && ((fp & (sizeof(uintptr_t) - 1)) == 0)) {
+		uintptr_t *frame;
+		uintptr_t next;
+
+#if defined(CONFIG_RISCV)
+		/* The return address and the previous frame pointer are
+		 * saved just below the frame pointer
+		 */
+		if ((fp < (start + 2 * sizeof(uintptr_t))) || (fp > end)) {
+			break;
+		}
+		frame = (uintptr_t *)fp;
+		pc[depth++] = frame[-1];
+		next = frame[-2];
+#else
+		/* The frame pointer points to the previous frame pointer,
+		 * followed by the return address
+		 */
+		if ((fp < start) || (fp > (end - 2 * sizeof(uintptr_t)))) {
+			break;
+		}
+		frame = (uintptr_t *)fp;
+		pc[depth++] = frame[1];
+		next = frame[0];
+#endif
+		/* The stack grows down, the callers have higher frames */
+		if (next <= fp) {
+			break;
+		}
+		fp = next;
+	}
+
+	return depth;
+}
+#endif
+
+/* Record the interrupted program counter and the callers in pc, return the
+ * number of recorded addresses. in_isr is set if the interrupted code is
+ * another interrupt.
+ */
+static uint8_t sample_stack(struct k_thread *thread, uintptr_t *pc, bool *in_isr)
+{
+#if defined(CONFIG_CPU_CORTEX_M)
+	const z_arch_esf_t *esf;
+
+	ARG_UNUSED(thread);
+
+	/* Without other active exceptions, the interrupted code is a thread
+	 * and its exception frame is on the process stack
+	 */
+	if ((SCB->ICSR & SCB_ICSR_RETTOBASE_Msk) == 0) {
+		*in_isr = true;
+		return 0;
+	}
+
+	esf = (const z_arch_esf_t *)__get_PSP();
+	pc[0] = esf->basic.pc;
+
+	return 1;
+#elif defined(CONFIG_RISCV)
+	const z_arch_esf_t *esf;
+	uint8_t depth = 1;
+
+	if (arch_curr_cpu()->nested > 1) {
+		*in_isr = true;
+		return 0;
+	}
+
+	/* The interrupt entry saves the stack pointer of the thread, which
+	 * points to its exception frame, at the top of the interrupt stack
+	 */
+	esf = *(const z_arch_esf_t **)(arch_curr_cpu()->irq_stack - 16);
+	pc[0] = esf->mepc;
+
+#if defined(CONFIG_PROFILER_FRAME_POINTER)
+	depth += walk_frames(thread, esf->s0, &pc[1], CONFIG_PROFILER_STACK_DEPTH - 1);
+#endif
+
+	return depth;
+#elif defined(CONFIG_X86)
+	const uintptr_t *frame;
+	uint8_t depth = 1;
+
+	if (arch_curr_cpu()->nested > 1) {
+		*in_isr = true;
+		return 0;
+	}
+
+	/* The interrupt entry saves the stack pointer of the thread at the
+	 * top of the interrupt stack. It points to the saved EDI, ECX, EDX
+	 * and EAX, followed by the EIP pushed by the CPU.
+	 */
+	frame = ((const uintptr_t **)arch_curr_cpu()->irq_stack)[-1];
+	pc[0] = frame[4];
+
+#if defined(CONFIG_PROFILER_FRAME_POINTER)
+	/* EBP is not saved by the interrupt entry, the frames of the
+	 * interrupt handlers are chained to the frame of the interrupted code
+	 */
+	uintptr_t top = (uintptr_t)arch_curr_cpu()->irq_stack;
+	uintptr_t fp = (uintptr_t)__builtin_frame_address(0);
+
+	while ((fp < top) && (fp >= (top - CONFIG_ISR_STACK_SIZE))) {
+		fp = *(const uintptr_t *)fp;
+	}
+
+	depth += walk_frames(thread, fp, &pc[1], CONFIG_PROFILER_STACK_DEPTH - 1);
+#endif
+
+	return depth;
+#endif
+}
+
+void profiler_sample(void)
+{
+	struct profiler_cpu *cpu;
+	struct profiler_sample *sample;
+	struct k_thread *thread;
+	bool in_isr = false;
+
+	if (!atomic_get(&profiler_running)) {
+		return;
+	}
+
+	cpu = &profiler_cpus[arch_curr_cpu()->id];
+	if (cpu->count >= CONFIG_PROFILER_SAMPLES) {
+		cpu->dropped++;
+		return;
+	}
+
+	thread = arch_curr_cpu()->current;
+	sample = &cpu->samples[cpu->count];
+	sample->depth = sample_stack(thread, sample->pc, &in_isr);
+	sample->thread = in_isr ? NULL : thread;
+
+	cpu->count++;
+}
+
+#if defined(CONFIG_PROFILER_COUNTER)
+static const struct device *const profiler_counter =
+	DEVICE_DT_GET(DT_CHOSEN(zephyr_profiler_counter));
+
+static void profiler_counter_top(const struct device *dev, void *user_data)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(user_data);
+
+	profiler_sample();
+}
+
+static int profiler_timer_start(uint32_t period_us)
+{
+	struct counter_top_cfg cfg = {
+		.ticks = counter_us_to_ticks(profiler_counter, period_us),
+		.callback = profiler_counter_top,
+		.user_data = NULL,
+		.flags = 0,
+	};
+	int err;
+
+	if (!device_is_ready(profiler_counter)) {
+		return -ENODEV;
+	}
+
+	if (cfg.ticks == 0) {
+		return -EINVAL;
+	}
+
+	err = counter_set_top_value(profiler_counter, &cfg);
+	if (err) {
+		return err;
+	}
+
+	return counter_start(profiler_counter);
+}
+
+static void profiler_timer_stop(void)
+{
+	(void)counter_stop(profiler_counter);
+}
+#else
+static void profiler_timer_expiry(struct k_timer *timer)
+{
+	ARG_UNUSED(timer);
+
+	profiler_sample();
+}
+
+static K_TIMER_DEFINE(profiler_timer, profiler_timer_expiry, NULL);
+
+static int profiler_timer_start(uint32_t period_us)
+{
+	k_timer_start(&profiler_timer, K_USEC(period_us), K_USEC(period_us));
+
+	return 0;
+}
+
+static void profiler_timer_stop(void)
+{
+	k_timer_stop(&profiler_timer);
+}
+#endif
+
+int profiler_start(uint32_t period_us)
+{
+	int err;
+
+	if (period_us == 0) {
+		return -EINVAL;
+	}
+
+	if (!atomic_cas(&profiler_running, 0, 1)) {
+		return -EALREADY;
+	}
+
+	err = profiler_timer_start(period_us);
+	if (err) {
+		atomic_clear(&profiler_running);
+	}
+
+	return err;
+}
+
+int profiler_stop(void)
+{
+	if (!atomic_cas(&profiler_running, 1, 0)) {
+		return -EALREADY;
+	}
+
+	profiler_timer_stop();
+
+	return 0;
+}
+
+void profiler_reset(void)
+{
+	for (int i = 0; i < ARRAY_SIZE(profiler_cpus); i++) {
+		unsigned int key = irq_lock();
+
+		profiler_cpus[i].count = 0;
+		profiler_cpus[i].dropped = 0;
+
+		irq_unlock(key);
+	}
+}
+
+void profiler_stats_get(size_t *samples, uint32_t *dropped)
+{
+	size_t count = 0;
+	uint32_t lost = 0;
+
+	for (int i = 0; i < ARRAY_SIZE(profiler_cpus); i++) {
+		count += profiler_cpus[i].count;
+		lost += profiler_cpus[i].dropped;
+	}
+
+	if (samples != NULL) {
+		*samples = count;
+	}
+
+	if (dropped != NULL) {
+		*dropped = lost;
+	}
+}
+
+struct thread_find {
+	k_tid_t thread;
+	bool found;
+};
+
+static void thread_find_cb(const struct k_thread *thread, void *user_data)
+{
+	struct thread_find *find = user_data;
+
+	if (thread == find->thread) {
+		find->found = true;
+	}
+}
+
+/* The thread may have exited since the sample was taken */
+static int thread_label(k_tid_t thread, char *buf, size_t size)
+{
+	struct thread_find find = {
+		.thread = thread,
+	};
+	const char *name = NULL;
+
+	if (thread == NULL) {
+		return snprintk(buf, size, "isr");
+	}
+
+	k_thread_foreach_unlocked(thread_find_cb, &find);
+	if (find.found) {
+		name = k_thread_name_get(thread);
+	}
+
+	if ((name != NULL) && (name[0] != '\0')) {
+		return snprintk(buf, size, "%s", name);
+	}
+
+	return snprintk(buf, size, "%p", thread);
+}
+
+#define LABEL_SIZE 32
+#define ADDR_SIZE (sizeof(";0x") + 2 * sizeof(uintptr_t))
+
+void profiler_dump_folded(profiler_dump_cb cb, void *user_data)
+{
+	char line[LABEL_SIZE + CONFIG_PROFILER_STACK_DEPTH * ADDR_SIZE + sizeof(" 1")];
+
+	for (int i = 0; i < ARRAY_SIZE(profiler_cpus); i++) {
+		const struct profiler_cpu *cpu = &profiler_cpus[i];
+		size_t count = cpu->count;
+
+		for (size_t j = 0; j < count; j++) {
+			const struct profiler_sample *sample = &cpu->samples[j];
+			int pos;
+
+			pos = MIN(thread_label(sample->thread, line, LABEL_SIZE), LABEL_SIZE - 1);
+
+			/* Folded stacks start with the outermost caller */
+			for (int k = sample->depth - 1; k >= 0; k--) {
+				pos += snprintk(&line[pos], sizeof(line) - pos, ";0x%lx",
+						(unsigned long)sample->pc[k]);
+			}
+
+			snprintk(&line[pos], sizeof(line) - pos, " 1");
+			cb(line, user_data);
+		}
+	}
+}
+
+#if defined(CONFIG_PROFILER_SHELL)
+static int cmd_start(const struct shell *sh, size_t argc, char **argv)
+{
+	uint32_t period_us = 1000;
+	int err;
+
+	if (argc > 1) {
+		char *end;
+
+		period_us = strtoul(argv[1], &end, 0);
+		if (*end != '\0') {
+			shell_error(sh, "Invalid period: %s", argv[1]);
+			return -EINVAL;
+		}
+	}
+
+	err = profiler_start(period_us);
+	if (err) {
+		shell_error(sh, "Unable to start the profiler (err %d)", err);
+		return err;
+	}
+
+	return 0;
+}
+
+static int cmd_stop(const struct shell *sh, size_t argc, char **argv)
+{
+	int err;
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	err = profiler_stop();
+	if (err) {
+		shell_error(sh, "Profiler is not running");
+		return err;
+	}
+
+	return 0;
+}
+
+static int cmd_reset(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(sh);
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	profiler_reset();
+
+	return 0;
+}
+
+static int cmd_status(const struct shell *sh, size_t argc, char **argv)
+{
+	size_t samples;
+	uint32_t dropped;
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	profiler_stats_get(&samples, &dropped);
+	shell_print(sh, "%s, %zu samples, %u dropped",
+		    atomic_get(&profiler_running) ? "running" : "stopped", samples, dropped);
+
+	return 0;
+}
+
+static void shell_dump_cb(const char *line, void *user_data)
+{
+	shell_print((const struct shell *)user_data, "%s", line);
+}
+
+static int cmd_dump(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	profiler_dump_folded(shell_dump_cb, (void *)sh);
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_profiler,
+	SHELL_CMD_ARG(start, NULL, "Start sampling [period_us]", cmd_start, 1, 1),
+	SHELL_CMD(stop, NULL, "Stop sampling", cmd_stop),
+	SHELL_CMD(reset, NULL, "Discard the samples", cmd_reset),
+	SHELL_CMD(status, NULL, "Show the number of samples", cmd_status),
+	SHELL_CMD(dump, NULL, "Dump the samples as folded stacks", cmd_dump),
+	SHELL_SUBCMD_SET_END
+);
+
+SHELL_CMD_REGISTER(profiler, &sub_profiler, "Sampling profiler", NULL);
+#endif /* CONFIG_PROFILER_SHELL */
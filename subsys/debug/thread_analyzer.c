@@ -71,6 +71,67 @@ static void thread_print_cb(struct thread_analyzer_info *info)
 #endif
 }
 
+#if defined(CONFIG_THREAD_ANALYZER_INCREMENTAL)
+#define STACK_PAINT_WORD 0xaaaaaaaaU
+
+/* The stack only grows down into the unused space, so the boundary found by
+ * the last analysis is moved down to the lowest word written since then,
+ * until enough untouched words are found in a row.
+ */
+static size_t stack_unused_resume(const uint8_t *start, size_t unused)
+{
+	const uint32_t *words = (const uint32_t *)start;
+	size_t pos = DIV_ROUND_UP(unused, sizeof(uint32_t));
+	size_t boundary = unused;
+	unsigned int run = 0;
+
+	while ((pos > 0) && (run < CONFIG_THREAD_ANALYZER_INCREMENTAL_RUN)) {
+		pos--;
+		if (words[pos] == STACK_PAINT_WORD) {
+			run++;
+			continue;
+		}
+
+		run = 0;
+		boundary = pos * sizeof(uint32_t);
+		while (start[boundary] == 0xaaU) {
+			boundary++;
+		}
+	}
+
+	return boundary;
+}
+#endif
+
+static int stack_unused_get(const uint8_t *start, size_t size, size_t *known, size_t *unused)
+{
+#if defined(CONFIG_THREAD_ANALYZER_INCREMENTAL)
+	/* Same layout as seen by z_stack_space_get() */
+	const uint8_t *checked = start + (IS_ENABLED(CONFIG_STACK_SENTINEL) ? 4 : 0);
+	const uint8_t *stack_pointer = (const uint8_t *)&start;
+	bool own_stack = (stack_pointer > start) && (stack_pointer <= (start + size));
+	int err;
+
+	if ((*known == 0) || !IS_PTR_ALIGNED(checked, uint32_t) ||
+	    (own_stack && IS_ENABLED(CONFIG_NO_UNUSED_STACK_INSPECTION))) {
+		err = z_stack_space_get(start, size, unused);
+	} else {
+		*unused = stack_unused_resume(checked, *known);
+		err = 0;
+	}
+
+	if (err == 0) {
+		*known = *unused;
+	}
+
+	return err;
+#else
+	ARG_UNUSED(known);
+
+	return z_stack_space_get(start, size, unused);
+#endif
+}
+
 static void thread_analyze_cb(const struct k_thread *cthread, void *user_data)
 {
 	struct k_thread *thread = (struct k_thread *)cthread;
@@ -84,9 +145,14 @@ static void thread_analyze_cb(const struct k_thread *cthread, void *user_data)
 	char hexname[PTR_STR_MAXLEN + 1];
 	const char *name;
 	size_t unused;
+	size_t *known;
 	int err;
 
-
+#if defined(CONFIG_THREAD_ANALYZER_INCREMENTAL)
+	known = &thread->stack_info.unused;
+#else
+	known = NULL;
+#endif
 
 	name = k_thread_name_get((k_tid_t)thread);
 	if (!name || name[0] == '\0') {
@@ -94,7 +160,7 @@ static void thread_analyze_cb(const struct k_thread *cthread, void *user_data)
 		snprintk(hexname, sizeof(hexname), "%p", (void *)thread);
 	}
 
-	err = k_thread_stack_space_get(thread, &unused);
+	err = stack_unused_get((const uint8_t *)thread->stack_info.start, size, known, &unused);
 	if (err) {
 		THREAD_ANALYZER_PRINT(
 			THREAD_ANALYZER_FMT(
@@ -131,6 +197,7 @@ K_KERNEL_STACK_ARRAY_DECLARE(z_interrupt_stacks, CONFIG_MP_MAX_NUM_CPUS,
 
 static void isr_stacks(void)
 {
+	static size_t known_unused[CONFIG_MP_MAX_NUM_CPUS];
 	unsigned int num_cpus = arch_num_cpus();
 
 	for (int i = 0; i < num_cpus; i++) {
@@ -139,7 +206,7 @@ static void isr_stacks(void)
 		size_t unused;
 		int err;
 
-		err = z_stack_space_get(buf, size, &unused);
+		err = stack_unused_get(buf, size, &known_unused[i], &unused);
 		if (err == 0) {
 			THREAD_ANALYZER_PRINT(
 				THREAD_ANALYZER_FMT(
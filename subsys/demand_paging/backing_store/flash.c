@@ -0,0 +1,275 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Backing store on a flash partition, e.g. on QSPI or SPI-NOR flash
+ *
+ * The "backing_store_partition" fixed partition holds the image of the
+ * paged kernel sections, laid out from CONFIG_KERNEL_VM_BASE +
+ * CONFIG_KERNEL_VM_OFFSET like on qemu_x86_tiny, and location tokens for
+ * its data pages are their virtual addresses. The flash is never written:
+ * code and read-only data pages are simply dropped when evicted and read
+ * back from flash, while any other evicted data page is kept in one of
+ * CONFIG_BACKING_STORE_FLASH_RAM_PAGES pages of RAM, whose own address is
+ * used as location token.
+ *
+ * With CONFIG_DEMAND_PAGING_BACKING_STORE_ASYNC, reads from flash on behalf
+ * of preemptible threads are done by a fetch thread into a buffer, while
+ * the faulting thread pends. The flash driver, and the drivers it relies
+ * on, must be pinned.
+ */
+
+#include <mmu.h>
+#include <string.h>
+#include <kernel_arch_interface.h>
+#include <zephyr/drivers/flash.h>
+#include <zephyr/init.h>
+#include <zephyr/linker/linker-defs.h>
+#include <zephyr/linker/sections.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/kernel/mm/demand_paging.h>
+
+#define IMAGE_BASE	(CONFIG_KERNEL_VM_BASE + CONFIG_KERNEL_VM_OFFSET)
+#define IMAGE_OFFSET	FIXED_PARTITION_OFFSET(backing_store_partition)
+#define IMAGE_SIZE	FIXED_PARTITION_SIZE(backing_store_partition)
+
+__pinned_rodata
+static const struct device *const flash_dev =
+	FIXED_PARTITION_DEVICE(backing_store_partition);
+
+__pinned_bss
+static char ram_store[CONFIG_MMU_PAGE_SIZE *
+		      CONFIG_BACKING_STORE_FLASH_RAM_PAGES]
+	__aligned(CONFIG_MMU_PAGE_SIZE);
+__pinned_bss
+static struct k_mem_slab ram_slabs;
+__pinned_bss
+static unsigned int free_slabs;
+
+static bool location_is_ram(uintptr_t location)
+{
+	return (location >= POINTER_TO_UINT(ram_store)) &&
+	       (location < POINTER_TO_UINT(ram_store + sizeof(ram_store)));
+}
+
+static off_t location_to_flash(uintptr_t location)
+{
+	__ASSERT(location >= IMAGE_BASE &&
+		 location - IMAGE_BASE <= IMAGE_SIZE - CONFIG_MMU_PAGE_SIZE,
+		 "bad location 0x%lx, past bounds of backing store", location);
+
+	return IMAGE_OFFSET + (off_t)(location - IMAGE_BASE);
+}
+
+/* Only code and read-only data pages are never modified, so only they
+ * stay backed by the image in flash.
+ */
+static bool page_is_read_only(void *addr)
+{
+	uintptr_t start = POINTER_TO_UINT(addr);
+	uintptr_t end = start + CONFIG_MMU_PAGE_SIZE;
+
+	return ((start >= POINTER_TO_UINT(__text_region_start)) &&
+		(end <= POINTER_TO_UINT(__text_region_end))) ||
+	       ((start >= POINTER_TO_UINT(__rodata_region_start)) &&
+		(end <= POINTER_TO_UINT(__rodata_region_end)));
+}
+
+#ifdef CONFIG_DEMAND_PAGING_BACKING_STORE_ASYNC
+/* The buffer holds the data page at fetched_location if fetched is set.
+ * All of this is only accessed with interrupts locked, except the buffer
+ * while the fetch thread reads into it.
+ */
+__pinned_bss
+static char fetch_buf[CONFIG_MMU_PAGE_SIZE] __aligned(sizeof(void *));
+__pinned_bss
+static uintptr_t fetch_location;
+__pinned_bss
+static uintptr_t fetched_location;
+__pinned_bss
+static bool fetched;
+__pinned_bss
+static struct k_sem *fetch_done;
+__pinned_bss
+static bool fetch_ready;
+
+__pinned_bss
+static struct k_sem fetch_start;
+__pinned_bss
+static struct k_thread fetch_thread;
+static K_KERNEL_PINNED_STACK_DEFINE(fetch_stack,
+				    CONFIG_BACKING_STORE_FLASH_FETCH_STACK_SIZE);
+
+__pinned_func
+static void fetch_thread_entry(void *p1, void *p2, void *p3)
+{
+	struct k_sem *done;
+	unsigned int key;
+	int ret;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (;;) {
+		(void)k_sem_take(&fetch_start, K_FOREVER);
+
+		ret = flash_read(flash_dev, location_to_flash(fetch_location),
+				 fetch_buf, CONFIG_MMU_PAGE_SIZE);
+
+		key = irq_lock();
+		fetched = (ret == 0);
+		fetched_location = fetch_location;
+		done = fetch_done;
+		fetch_done = NULL;
+		irq_unlock(key);
+
+		k_sem_give(done);
+	}
+}
+
+int k_mem_paging_backing_store_page_in_async(uintptr_t location,
+					     struct k_sem *done)
+{
+	if (location_is_ram(location)) {
+		/* Nothing to wait for */
+		return -ENOTSUP;
+	}
+
+	if (!fetch_ready || (fetch_done != NULL)) {
+		return -EBUSY;
+	}
+
+	fetched = false;
+	fetch_location = location;
+	fetch_done = done;
+	k_sem_give(&fetch_start);
+
+	return 0;
+}
+
+static int fetch_thread_init(void)
+{
+	k_sem_init(&fetch_start, 0, 1);
+	k_thread_create(&fetch_thread, fetch_stack,
+			K_KERNEL_STACK_SIZEOF(fetch_stack),
+			fetch_thread_entry, NULL, NULL, NULL,
+			CONFIG_BACKING_STORE_FLASH_FETCH_PRIORITY, 0, K_NO_WAIT);
+	k_thread_name_set(&fetch_thread, "paging_fetch");
+	fetch_ready = true;
+
+	return 0;
+}
+
+SYS_INIT(fetch_thread_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+#endif /* CONFIG_DEMAND_PAGING_BACKING_STORE_ASYNC */
+
+int k_mem_paging_backing_store_location_get(struct z_page_frame *pf,
+					    uintptr_t *location,
+					    bool page_fault)
+{
+	int ret;
+	void *slab;
+
+	if (z_page_frame_is_backed(pf)) {
+		*location = POINTER_TO_UINT(pf->addr);
+		return 0;
+	}
+
+	if ((!page_fault && free_slabs == 1) || free_slabs == 0) {
+		return -ENOMEM;
+	}
+
+	ret = k_mem_slab_alloc(&ram_slabs, &slab, K_NO_WAIT);
+	__ASSERT(ret == 0, "slab count mismatch");
+	(void)ret;
+	*location = POINTER_TO_UINT(slab);
+	free_slabs--;
+
+	return 0;
+}
+
+void k_mem_paging_backing_store_location_free(uintptr_t location)
+{
+	if (location_is_ram(location)) {
+		k_mem_slab_free(&ram_slabs, UINT_TO_POINTER(location));
+		free_slabs++;
+	}
+}
+
+void k_mem_paging_backing_store_page_out(uintptr_t location)
+{
+	__ASSERT(location_is_ram(location),
+		 "page out to flash location 0x%lx", location);
+
+	(void)memcpy(UINT_TO_POINTER(location), Z_SCRATCH_PAGE,
+		     CONFIG_MMU_PAGE_SIZE);
+}
+
+void k_mem_paging_backing_store_page_in(uintptr_t location)
+{
+#ifdef CONFIG_DEMAND_PAGING_BACKING_STORE_ASYNC
+	unsigned int key;
+#endif
+	int ret;
+
+	if (location_is_ram(location)) {
+		(void)memcpy(Z_SCRATCH_PAGE, UINT_TO_POINTER(location),
+			     CONFIG_MMU_PAGE_SIZE);
+		return;
+	}
+
+#ifdef CONFIG_DEMAND_PAGING_BACKING_STORE_ASYNC
+	/* Use the data page fetched for a pending thread, if it's this one */
+	key = irq_lock();
+	if (fetched && (fetched_location == location)) {
+		(void)memcpy(Z_SCRATCH_PAGE, fetch_buf, CONFIG_MMU_PAGE_SIZE);
+		fetched = false;
+		irq_unlock(key);
+		return;
+	}
+	irq_unlock(key);
+#endif /* CONFIG_DEMAND_PAGING_BACKING_STORE_ASYNC */
+
+	ret = flash_read(flash_dev, location_to_flash(location),
+			 Z_SCRATCH_PAGE, CONFIG_MMU_PAGE_SIZE);
+	__ASSERT(ret == 0, "flash read at 0x%lx failed: %d", location, ret);
+	(void)ret;
+}
+
+void k_mem_paging_backing_store_page_finalize(struct z_page_frame *pf,
+					      uintptr_t location)
+{
+	if (location_is_ram(location)) {
+		k_mem_paging_backing_store_location_free(location);
+		pf->flags &= ~Z_PAGE_FRAME_BACKED;
+	} else if (page_is_read_only(pf->addr)) {
+		pf->flags |= Z_PAGE_FRAME_BACKED;
+	} else {
+		pf->flags &= ~Z_PAGE_FRAME_BACKED;
+	}
+}
+
+void k_mem_paging_backing_store_init(void)
+{
+	uintptr_t phys;
+	struct z_page_frame *pf;
+
+	k_mem_slab_init(&ram_slabs, ram_store, CONFIG_MMU_PAGE_SIZE,
+			CONFIG_BACKING_STORE_FLASH_RAM_PAGES);
+	free_slabs = CONFIG_BACKING_STORE_FLASH_RAM_PAGES;
+
+	/* Code and read-only data loaded at boot are identical to the
+	 * image in flash, so they can be dropped without a page-out.
+	 */
+	Z_PAGE_FRAME_FOREACH(phys, pf) {
+		if (z_page_frame_is_mapped(pf) && page_is_read_only(pf->addr)) {
+			pf->flags |= Z_PAGE_FRAME_BACKED;
+		}
+	}
+}
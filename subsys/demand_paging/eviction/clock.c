@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Clock (second chance) eviction algorithm for demand paging
+ */
+#include <zephyr/kernel.h>
+#include <mmu.h>
+#include <kernel_arch_interface.h>
+
+#include <zephyr/kernel/mm/demand_paging.h>
+
+/* The page frames form a circular list, and the clock hand points at the
+ * next candidate for eviction. When an evictable page frame has been
+ * accessed since the hand last passed over it, its accessed state is
+ * cleared and the hand moves on, giving the page a second chance;
+ * otherwise it is selected.
+ *
+ * Every accessed bit cleared by a sweep is one that has to be set again
+ * by an access before the hand comes back, so the cost of a selection is
+ * amortized over the accesses in between, and no periodic timer walking
+ * all the page frames is needed. A selection never takes more than two
+ * sweeps: the first one clears every accessed bit it finds.
+ *
+ * The hand is only ever moved with interrupts locked, by the page fault
+ * and eviction code calling k_mem_paging_eviction_select().
+ */
+static size_t clock_hand;
+
+struct z_page_frame *k_mem_paging_eviction_select(bool *dirty_ptr)
+{
+	struct z_page_frame *pf;
+	uintptr_t flags;
+
+	for (size_t i = 0; i < 2 * Z_NUM_PAGE_FRAMES; i++) {
+		pf = &z_page_frames[clock_hand];
+
+		clock_hand++;
+		if (clock_hand == Z_NUM_PAGE_FRAMES) {
+			clock_hand = 0;
+		}
+
+		if (!z_page_frame_is_evictable(pf)) {
+			continue;
+		}
+
+		/* Get and clear the accessed bit in the page tables */
+		flags = arch_page_info_get(pf->addr, NULL, true);
+
+		/* Implies a mismatch with page frame ontology and page
+		 * tables
+		 */
+		__ASSERT((flags & ARCH_DATA_PAGE_LOADED) != 0U,
+			 "non-present page, %s",
+			 ((flags & ARCH_DATA_PAGE_NOT_MAPPED) != 0U) ?
+			 "un-mapped" : "paged out");
+
+		if ((flags & ARCH_DATA_PAGE_ACCESSED) == 0UL) {
+			*dirty_ptr = (flags & ARCH_DATA_PAGE_DIRTY) != 0UL;
+			return pf;
+		}
+	}
+
+	/* Shouldn't ever happen unless every page is pinned */
+	__ASSERT(false, "no page to evict");
+
+	return NULL;
+}
+
+void k_mem_paging_eviction_init(void)
+{
+	clock_hand = 0;
+}
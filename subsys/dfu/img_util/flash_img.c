@@ -18,6 +18,15 @@
 #include <zephyr/dfu/mcuboot.h>
 #endif
 
+#ifdef CONFIG_IMG_DECODE
+#include <errno.h>
+#include <zephyr/sys/byteorder.h>
+#endif
+
+#ifdef CONFIG_IMG_LZ4
+#include <lz4.h>
+#endif
+
 #include <zephyr/devicetree.h>
 #ifdef CONFIG_TRUSTED_EXECUTION_NONSECURE
 	#define UPLOAD_FLASH_AREA_LABEL slot1_ns_partition
@@ -31,6 +40,14 @@
 
 /* FIXED_PARTITION_ID() values used below are auto-generated by DT */
 #define UPLOAD_FLASH_AREA_ID FIXED_PARTITION_ID(UPLOAD_FLASH_AREA_LABEL)
+
+#ifdef CONFIG_IMG_DELTA
+#ifdef CONFIG_TRUSTED_EXECUTION_NONSECURE
+#define DELTA_SOURCE_AREA_ID FIXED_PARTITION_ID(slot0_ns_partition)
+#else
+#define DELTA_SOURCE_AREA_ID FIXED_PARTITION_ID(slot0_partition)
+#endif
+#endif
 #define UPLOAD_FLASH_AREA_CONTROLLER \
 	DT_GPARENT(DT_NODELABEL(UPLOAD_FLASH_AREA_LABEL))
 
@@ -70,6 +87,430 @@ int flash_img_buffered_write(struct flash_img_context *ctx, const uint8_t *data,
 	return rc;
 }
 
+#ifdef CONFIG_IMG_LZ4
+enum {
+	LZ4_STATE_HDR,
+	LZ4_STATE_BLOCK_HDR,
+	LZ4_STATE_BLOCK,
+	LZ4_STATE_RAW_BLOCK,
+};
+
+static void lz4_reset(struct flash_img_lz4 *lz4)
+{
+	lz4->state = LZ4_STATE_HDR;
+	lz4->need = sizeof(struct flash_img_lz4_hdr);
+	lz4->in_len = 0;
+	lz4->written = 0;
+}
+
+static int lz4_hdr_get(const uint8_t *data, struct flash_img_lz4_hdr *hdr)
+{
+	memcpy(hdr, data, sizeof(*hdr));
+	hdr->magic = sys_le32_to_cpu(hdr->magic);
+	hdr->size = sys_le32_to_cpu(hdr->size);
+
+	return (hdr->magic == FLASH_IMG_LZ4_MAGIC) ? 0 : -EINVAL;
+}
+
+static int lz4_out(struct flash_img_context *ctx, const uint8_t *data, size_t len)
+{
+#ifdef CONFIG_IMG_DELTA
+	if (ctx->lz4.delta) {
+		return flash_img_delta_buffered_write(ctx, data, len, false);
+	}
+#endif
+	return (flash_img_buffered_write(ctx, data, len, false) == 0) ? 0 : -EIO;
+}
+
+/* Handles the element of the stream gathered in the input buffer */
+static int lz4_process(struct flash_img_context *ctx)
+{
+	struct flash_img_lz4 *lz4 = &ctx->lz4;
+	struct flash_img_lz4_hdr hdr;
+	uint32_t blk;
+	int len;
+	int rc;
+
+	switch (lz4->state) {
+	case LZ4_STATE_HDR:
+		if (lz4_hdr_get(lz4->in, &hdr) != 0) {
+			return -EINVAL;
+		}
+		lz4->size = hdr.size;
+		break;
+	case LZ4_STATE_BLOCK_HDR:
+		blk = sys_get_le32(lz4->in);
+		lz4->need = blk & ~FLASH_IMG_LZ4_BLOCK_RAW;
+		if ((lz4->need == 0) || (lz4->need > sizeof(lz4->in))) {
+			return -EINVAL;
+		}
+		lz4->state = (blk & FLASH_IMG_LZ4_BLOCK_RAW) ? LZ4_STATE_RAW_BLOCK
+							     : LZ4_STATE_BLOCK;
+		lz4->in_len = 0;
+		return 0;
+	case LZ4_STATE_BLOCK:
+		len = LZ4_decompress_safe((const char *)lz4->in, (char *)lz4->out,
+					  lz4->in_len, sizeof(lz4->out));
+		if ((len <= 0) || ((lz4->written + len) > lz4->size)) {
+			return -EINVAL;
+		}
+		lz4->written += len;
+		rc = lz4_out(ctx, lz4->out, len);
+		if (rc != 0) {
+			return rc;
+		}
+		break;
+	case LZ4_STATE_RAW_BLOCK:
+		if ((lz4->written + lz4->in_len) > lz4->size) {
+			return -EINVAL;
+		}
+		lz4->written += lz4->in_len;
+		rc = lz4_out(ctx, lz4->in, lz4->in_len);
+		if (rc != 0) {
+			return rc;
+		}
+		break;
+	default:
+		return -EINVAL;
+	}
+
+	lz4->state = LZ4_STATE_BLOCK_HDR;
+	lz4->need = sizeof(uint32_t);
+	lz4->in_len = 0;
+
+	return 0;
+}
+
+static int lz4_write(struct flash_img_context *ctx, const uint8_t *data,
+		     size_t len, bool flush)
+{
+	struct flash_img_lz4 *lz4 = &ctx->lz4;
+	size_t chunk;
+	int rc = 0;
+
+	while ((len > 0) && (rc == 0)) {
+		chunk = MIN(len, lz4->need - lz4->in_len);
+		memcpy(&lz4->in[lz4->in_len], data, chunk);
+		lz4->in_len += chunk;
+		data += chunk;
+		len -= chunk;
+
+		if (lz4->in_len == lz4->need) {
+			rc = lz4_process(ctx);
+		}
+	}
+
+	if ((rc != 0) || !flush) {
+		return rc;
+	}
+
+	if ((lz4->state != LZ4_STATE_BLOCK_HDR) || (lz4->in_len != 0) ||
+	    (lz4->written != lz4->size)) {
+		/* Truncated image */
+		return -EINVAL;
+	}
+
+#ifdef CONFIG_IMG_DELTA
+	if (lz4->delta) {
+		return flash_img_delta_buffered_write(ctx, NULL, 0, true);
+	}
+#endif
+	return flash_img_buffered_write(ctx, NULL, 0, true);
+}
+
+int flash_img_lz4_buffered_write(struct flash_img_context *ctx, const uint8_t *data,
+				 size_t len, bool flush)
+{
+#ifdef CONFIG_IMG_DELTA
+	ctx->lz4.delta = false;
+#endif
+	return lz4_write(ctx, data, len, flush);
+}
+
+int flash_img_lz4_peek(const uint8_t *data, size_t len, struct flash_img_lz4_hdr *hdr,
+		       void *out, size_t out_len)
+{
+	uint32_t blk;
+	int rc;
+
+	if ((len < (sizeof(*hdr) + sizeof(blk))) || (lz4_hdr_get(data, hdr) != 0)) {
+		return -EINVAL;
+	}
+
+	data += sizeof(*hdr);
+	len -= sizeof(*hdr);
+	blk = sys_get_le32(data);
+	data += sizeof(blk);
+	len = MIN(len - sizeof(blk), blk & ~FLASH_IMG_LZ4_BLOCK_RAW);
+
+	if (blk & FLASH_IMG_LZ4_BLOCK_RAW) {
+		len = MIN(len, out_len);
+		memcpy(out, data, len);
+		return len;
+	}
+
+	/* Partial decoding stops at the end of the input as well */
+	rc = LZ4_decompress_safe_partial((const char *)data, out, len, out_len, out_len);
+
+	return (rc >= 0) ? rc : -EINVAL;
+}
+#endif
+
+#ifdef CONFIG_IMG_DELTA
+enum {
+	DELTA_STATE_HDR,
+	DELTA_STATE_OP,
+	DELTA_STATE_DATA,
+};
+
+/* Receives the new image, a positive return value stops the processing */
+typedef int (*delta_sink_t)(void *arg, const uint8_t *data, size_t len);
+
+static void delta_reset(struct flash_img_delta *delta, uint8_t src_id)
+{
+	delta->state = DELTA_STATE_HDR;
+	delta->need = sizeof(struct flash_img_delta_hdr);
+	delta->in_len = 0;
+	delta->written = 0;
+	delta->src = NULL;
+	delta->src_id = src_id;
+}
+
+static int delta_hdr_get(const uint8_t *data, struct flash_img_delta_hdr *hdr)
+{
+	memcpy(hdr, data, sizeof(*hdr));
+	hdr->magic = sys_le32_to_cpu(hdr->magic);
+	hdr->src_size = sys_le32_to_cpu(hdr->src_size);
+	hdr->size = sys_le32_to_cpu(hdr->size);
+
+	return (hdr->magic == FLASH_IMG_DELTA_MAGIC) ? 0 : -EINVAL;
+}
+
+static int delta_src_read(struct flash_img_delta *delta, size_t len)
+{
+	int rc;
+
+	if (delta->src == NULL) {
+		rc = flash_area_open(delta->src_id, &delta->src);
+		if (rc != 0) {
+			delta->src = NULL;
+			return rc;
+		}
+	}
+
+	return flash_area_read(delta->src, delta->op_src, delta->buf, len);
+}
+
+/* Handles a complete header or operation gathered in the input buffer */
+static int delta_parse(struct flash_img_delta *delta)
+{
+	struct flash_img_delta_hdr hdr;
+	struct flash_img_delta_op op;
+
+	delta->in_len = 0;
+
+	if (delta->state == DELTA_STATE_HDR) {
+		if (delta_hdr_get(delta->in, &hdr) != 0) {
+			return -EINVAL;
+		}
+		delta->size = hdr.size;
+		delta->src_size = hdr.src_size;
+		delta->state = DELTA_STATE_OP;
+		delta->need = sizeof(op);
+		return 0;
+	}
+
+	memcpy(&op, delta->in, sizeof(op));
+	delta->op = op.op;
+	delta->op_len = sys_le32_to_cpu(op.len);
+	delta->op_src = sys_le32_to_cpu(op.src_off);
+
+	if ((delta->op > FLASH_IMG_DELTA_INSERT) ||
+	    (delta->op_len > (delta->size - delta->written))) {
+		return -EINVAL;
+	}
+
+	if ((delta->op != FLASH_IMG_DELTA_INSERT) &&
+	    ((delta->op_src > delta->src_size) ||
+	     (delta->op_len > (delta->src_size - delta->op_src)))) {
+		return -EINVAL;
+	}
+
+	delta->state = DELTA_STATE_DATA;
+
+	return 0;
+}
+
+static int delta_run(struct flash_img_delta *delta, const uint8_t *data, size_t len,
+		     delta_sink_t sink, void *arg)
+{
+	const uint8_t *out;
+	size_t chunk;
+	int rc = 0;
+
+	while (rc == 0) {
+		if (delta->state != DELTA_STATE_DATA) {
+			if (len == 0) {
+				break;
+			}
+
+			chunk = MIN(len, delta->need - delta->in_len);
+			memcpy(&delta->in[delta->in_len], data, chunk);
+			delta->in_len += chunk;
+			data += chunk;
+			len -= chunk;
+
+			if (delta->in_len == delta->need) {
+				rc = delta_parse(delta);
+			}
+			continue;
+		}
+
+		if (delta->op_len == 0) {
+			delta->state = DELTA_STATE_OP;
+			delta->need = sizeof(struct flash_img_delta_op);
+			continue;
+		}
+
+		switch (delta->op) {
+		case FLASH_IMG_DELTA_COPY:
+			chunk = MIN(delta->op_len, sizeof(delta->buf));
+			rc = delta_src_read(delta, chunk);
+			out = delta->buf;
+			break;
+		case FLASH_IMG_DELTA_ADD:
+			chunk = MIN(MIN(delta->op_len, sizeof(delta->buf)), len);
+			if (chunk > 0) {
+				rc = delta_src_read(delta, chunk);
+			}
+			for (size_t i = 0; (rc == 0) && (i < chunk); i++) {
+				delta->buf[i] += data[i];
+			}
+			out = delta->buf;
+			data += chunk;
+			len -= chunk;
+			break;
+		default:
+			chunk = MIN(delta->op_len, len);
+			out = data;
+			data += chunk;
+			len -= chunk;
+			break;
+		}
+
+		if (chunk == 0) {
+			/* Waiting for the data of the operation */
+			break;
+		}
+
+		if (rc == 0) {
+			rc = sink(arg, out, chunk);
+		}
+
+		delta->written += chunk;
+		delta->op_len -= chunk;
+		delta->op_src += chunk;
+	}
+
+	return rc;
+}
+
+static void delta_src_close(struct flash_img_delta *delta)
+{
+	if (delta->src != NULL) {
+		flash_area_close(delta->src);
+		delta->src = NULL;
+	}
+}
+
+static int delta_flash_sink(void *arg, const uint8_t *data, size_t len)
+{
+	return (flash_img_buffered_write(arg, data, len, false) == 0) ? 0 : -EIO;
+}
+
+void flash_img_delta_source_set(struct flash_img_context *ctx, uint8_t area_id)
+{
+	ctx->delta.src_id = area_id;
+}
+
+int flash_img_delta_buffered_write(struct flash_img_context *ctx, const uint8_t *data,
+				   size_t len, bool flush)
+{
+	struct flash_img_delta *delta = &ctx->delta;
+	int rc;
+
+	rc = delta_run(delta, data, len, delta_flash_sink, ctx);
+
+	if ((rc == 0) && flush) {
+		if ((delta->state != DELTA_STATE_OP) || (delta->in_len != 0) ||
+		    (delta->written != delta->size)) {
+			/* Truncated image */
+			rc = -EINVAL;
+		} else {
+			rc = flash_img_buffered_write(ctx, NULL, 0, true);
+		}
+	}
+
+	if ((rc != 0) || flush) {
+		delta_src_close(delta);
+	}
+
+	return rc;
+}
+
+struct delta_peek {
+	uint8_t *out;
+	size_t len;
+	size_t pos;
+};
+
+static int delta_peek_sink(void *arg, const uint8_t *data, size_t len)
+{
+	struct delta_peek *peek = arg;
+	size_t chunk = MIN(len, peek->len - peek->pos);
+
+	memcpy(&peek->out[peek->pos], data, chunk);
+	peek->pos += chunk;
+
+	return (peek->pos == peek->len) ? 1 : 0;
+}
+
+int flash_img_delta_peek(const uint8_t *data, size_t len, uint8_t src_id,
+			 struct flash_img_delta_hdr *hdr, void *out, size_t out_len)
+{
+	struct delta_peek peek = {
+		.out = out,
+		.len = out_len,
+	};
+	struct flash_img_delta delta;
+	int rc;
+
+	if ((len < sizeof(*hdr)) || (delta_hdr_get(data, hdr) != 0)) {
+		return -EINVAL;
+	}
+
+	delta_reset(&delta, src_id);
+	rc = delta_run(&delta, data, len, delta_peek_sink, &peek);
+	delta_src_close(&delta);
+
+	if (rc > 0) {
+		return 0;
+	}
+
+	return (rc < 0) ? rc : -EINVAL;
+}
+
+#ifdef CONFIG_IMG_LZ4
+int flash_img_lz4_delta_buffered_write(struct flash_img_context *ctx, const uint8_t *data,
+				       size_t len, bool flush)
+{
+	ctx->lz4.delta = true;
+
+	return lz4_write(ctx, data, len, flush);
+}
+#endif
+#endif
+
 size_t flash_img_bytes_written(struct flash_img_context *ctx)
 {
 	return stream_flash_bytes_written(&ctx->stream);
@@ -88,9 +529,24 @@ int flash_img_init_id(struct flash_img_context *ctx, uint8_t area_id)
 
 	flash_dev = flash_area_get_device(ctx->flash_area);
 
-	return stream_flash_init(&ctx->stream, flash_dev, ctx->buf,
+#ifdef CONFIG_IMG_LZ4
+	lz4_reset(&ctx->lz4);
+#endif
+#ifdef CONFIG_IMG_DELTA
+	delta_reset(&ctx->delta, DELTA_SOURCE_AREA_ID);
+#endif
+
+	rc = stream_flash_init(&ctx->stream, flash_dev, ctx->buf,
 			CONFIG_IMG_BLOCK_BUF_SIZE, ctx->flash_area->fa_off,
 			ctx->flash_area->fa_size, NULL);
+
+#ifdef CONFIG_STREAM_FLASH_BACKGROUND
+	if (rc == 0) {
+		rc = stream_flash_background_enable(&ctx->stream);
+	}
+#endif
+
+	return rc;
 }
 
 int flash_img_init(struct flash_img_context *ctx)
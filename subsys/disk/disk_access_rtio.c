@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/rtio/rtio.h>
+#include <zephyr/rtio/rtio_mpsc.h>
+#include <zephyr/storage/disk_access.h>
+#include <zephyr/sys/byteorder.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(disk, CONFIG_DISK_LOG_LEVEL);
+
+/*
+ * A request is a transaction of two submission queue entries: a tiny write
+ * holding the start sector, followed by the read or write of the data.
+ * The completion of the first entry reports the result, the second one
+ * produces no completion.
+ */
+
+struct disk_info *disk_access_get_di(const char *name);
+
+/* Requests of the disks without a native asynchronous interface */
+static struct rtio_mpsc disk_rtio_q = RTIO_MPSC_INIT(disk_rtio_q);
+static K_SEM_DEFINE(disk_rtio_sem, 0, K_SEM_MAX_LIMIT);
+
+int disk_access_rtio_req_get(const struct rtio_iodev_sqe *iodev_sqe,
+			     uint32_t sector_size, struct disk_rtio_req *req)
+{
+	const struct rtio_sqe *head = &iodev_sqe->sqe;
+	const struct rtio_iodev_sqe *data = rtio_txn_next(iodev_sqe);
+
+	if ((head->op != RTIO_OP_TINY_TX) ||
+	    (head->tiny_buf_len != sizeof(uint32_t)) || (data == NULL)) {
+		return -EINVAL;
+	}
+
+	if (((data->sqe.op != RTIO_OP_RX) && (data->sqe.op != RTIO_OP_TX)) ||
+	    (sector_size == 0U) || (data->sqe.buf_len % sector_size) != 0U) {
+		return -EINVAL;
+	}
+
+	req->buf = data->sqe.buf;
+	req->start_sector = sys_get_le32(head->tiny_buf);
+	req->num_sector = data->sqe.buf_len / sector_size;
+	req->write = (data->sqe.op == RTIO_OP_TX);
+
+	return 0;
+}
+
+static struct disk_info *disk_rtio_get_di(struct disk_access_iodev *data)
+{
+	struct disk_info *disk = data->disk;
+	uint32_t sector_size;
+
+	if (disk != NULL) {
+		return disk;
+	}
+
+	disk = disk_access_get_di(data->name);
+	if ((disk == NULL) ||
+	    (disk_access_ioctl(data->name, DISK_IOCTL_GET_SECTOR_SIZE,
+			       &sector_size) != 0)) {
+		LOG_ERR("disk %s not available", data->name);
+		return NULL;
+	}
+
+	/* Published last, the submit path only reads it once set */
+	data->sector_size = sector_size;
+	compiler_barrier();
+	data->disk = disk;
+
+	return disk;
+}
+
+static struct rtio_sqe *disk_rtio_prep(struct rtio *r, struct rtio_iodev *iodev,
+				       uint8_t op, uint8_t *data_buf,
+				       uint32_t start_sector, uint32_t num_sector,
+				       void *userdata)
+{
+	struct disk_access_iodev *data = iodev->data;
+	struct rtio_sqe *head, *sqe;
+	uint8_t sector[sizeof(uint32_t)];
+
+	if (disk_rtio_get_di(data) == NULL) {
+		return NULL;
+	}
+
+	head = rtio_sqe_acquire(r);
+	sqe = rtio_sqe_acquire(r);
+	if ((head == NULL) || (sqe == NULL)) {
+		rtio_sqe_drop_all(r);
+		return NULL;
+	}
+
+	sys_put_le32(start_sector, sector);
+	rtio_sqe_prep_tiny_write(head, iodev, RTIO_PRIO_NORM, sector,
+				 sizeof(sector), userdata);
+	head->flags |= RTIO_SQE_TRANSACTION;
+
+	if (op == RTIO_OP_RX) {
+		rtio_sqe_prep_read(sqe, iodev, RTIO_PRIO_NORM, data_buf,
+				   num_sector * data->sector_size, userdata);
+	} else {
+		rtio_sqe_prep_write(sqe, iodev, RTIO_PRIO_NORM, data_buf,
+				    num_sector * data->sector_size, userdata);
+	}
+	sqe->flags |= RTIO_SQE_NO_RESPONSE;
+
+	return sqe;
+}
+
+struct rtio_sqe *disk_access_rtio_read(struct rtio *r, struct rtio_iodev *iodev,
+				       uint8_t *data_buf, uint32_t start_sector,
+				       uint32_t num_sector, void *userdata)
+{
+	return disk_rtio_prep(r, iodev, RTIO_OP_RX, data_buf, start_sector,
+			      num_sector, userdata);
+}
+
+struct rtio_sqe *disk_access_rtio_write(struct rtio *r, struct rtio_iodev *iodev,
+					const uint8_t *data_buf, uint32_t start_sector,
+					uint32_t num_sector, void *userdata)
+{
+	return disk_rtio_prep(r, iodev, RTIO_OP_TX, (uint8_t *)data_buf,
+			      start_sector, num_sector, userdata);
+}
+
+static void disk_rtio_exec(struct rtio_iodev_sqe *iodev_sqe)
+{
+	struct disk_access_iodev *data = iodev_sqe->sqe.iodev->data;
+	struct disk_info *disk = data->disk;
+	struct disk_rtio_req req;
+	int rc;
+
+	rc = disk_access_rtio_req_get(iodev_sqe, data->sector_size, &req);
+	if (rc == 0) {
+		if (req.write) {
+			rc = (disk->ops->write != NULL) ?
+			     disk->ops->write(disk, req.buf, req.start_sector,
+					      req.num_sector) : -ENOTSUP;
+		} else {
+			rc = (disk->ops->read != NULL) ?
+			     disk->ops->read(disk, req.buf, req.start_sector,
+					     req.num_sector) : -ENOTSUP;
+		}
+	}
+
+	if (rc == 0) {
+		rtio_iodev_sqe_ok(iodev_sqe, 0);
+	} else {
+		rtio_iodev_sqe_err(iodev_sqe, rc);
+	}
+}
+
+static void disk_access_iodev_submit(struct rtio_iodev_sqe *iodev_sqe)
+{
+	struct disk_access_iodev *data = iodev_sqe->sqe.iodev->data;
+	struct disk_info *disk = data->disk;
+
+	if ((disk == NULL) || (disk->ops == NULL)) {
+		rtio_iodev_sqe_err(iodev_sqe, -ENODEV);
+		return;
+	}
+
+	if (disk->ops->submit != NULL) {
+		disk->ops->submit(disk, iodev_sqe);
+		return;
+	}
+
+	rtio_mpsc_push(&disk_rtio_q, &iodev_sqe->q);
+	k_sem_give(&disk_rtio_sem);
+}
+
+const struct rtio_iodev_api disk_access_iodev_api = {
+	.submit = disk_access_iodev_submit,
+};
+
+static void disk_rtio_thread(void *p1, void *p2, void *p3)
+{
+	struct rtio_mpsc_node *node;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		k_sem_take(&disk_rtio_sem, K_FOREVER);
+
+		/* The push of a preempted submitter may not be visible yet */
+		while ((node = rtio_mpsc_pop(&disk_rtio_q)) == NULL) {
+			k_sleep(K_TICKS(1));
+		}
+
+		disk_rtio_exec(CONTAINER_OF(node, struct rtio_iodev_sqe, q));
+	}
+}
+
+K_THREAD_DEFINE(disk_rtio, CONFIG_DISK_ACCESS_RTIO_STACK_SIZE,
+		disk_rtio_thread, NULL, NULL, NULL,
+		CONFIG_DISK_ACCESS_RTIO_THREAD_PRIORITY, 0, 0);
@@ -286,6 +286,300 @@ static inline void zdsp_not_u32(const DSP_DATA uint32_t *src, DSP_DATA uint32_t
 	arm_not_u32(src, dst, block_size);
 }
 
+/*
+ * The transform, filtering, statistics and matrix functions are implemented
+ * with the CMSIS-DSP kernels, which this backend already depends on.
+ */
+
+static inline int z_zdsp_status(arm_status status)
+{
+	switch (status) {
+	case ARM_MATH_SUCCESS:
+		return 0;
+	case ARM_MATH_SINGULAR:
+		return -EDOM;
+	default:
+		return -EINVAL;
+	}
+}
+
+struct zdsp_rfft_instance_f32 {
+	arm_rfft_fast_instance_f32 arm;
+};
+struct zdsp_cfft_instance_f32 {
+	arm_cfft_instance_f32 arm;
+};
+struct zdsp_rfft_instance_q15 {
+	arm_rfft_instance_q15 arm;
+};
+struct zdsp_cfft_instance_q15 {
+	arm_cfft_instance_q15 arm;
+};
+
+static inline int zdsp_rfft_init_f32(struct zdsp_rfft_instance_f32 *inst, uint16_t fft_len)
+{
+	return z_zdsp_status(arm_rfft_fast_init_f32(&inst->arm, fft_len));
+}
+static inline void zdsp_rfft_f32(const struct zdsp_rfft_instance_f32 *inst, float32_t *src,
+				 float32_t *dst, bool inverse)
+{
+	arm_rfft_fast_f32(&inst->arm, src, dst, inverse ? 1 : 0);
+}
+
+static inline int zdsp_cfft_init_f32(struct zdsp_cfft_instance_f32 *inst, uint16_t fft_len)
+{
+	return z_zdsp_status(arm_cfft_init_f32(&inst->arm, fft_len));
+}
+static inline void zdsp_cfft_f32(const struct zdsp_cfft_instance_f32 *inst, float32_t *buf,
+				 bool inverse)
+{
+	arm_cfft_f32(&inst->arm, buf, inverse ? 1 : 0, 1);
+}
+
+static inline int zdsp_rfft_init_q15(struct zdsp_rfft_instance_q15 *inst, uint32_t fft_len,
+				     bool inverse)
+{
+	return z_zdsp_status(arm_rfft_init_q15(&inst->arm, fft_len, inverse ? 1 : 0, 1));
+}
+static inline void zdsp_rfft_q15(const struct zdsp_rfft_instance_q15 *inst, q15_t *src,
+				 q15_t *dst)
+{
+	arm_rfft_q15(&inst->arm, src, dst);
+}
+
+static inline int zdsp_cfft_init_q15(struct zdsp_cfft_instance_q15 *inst, uint16_t fft_len)
+{
+	return z_zdsp_status(arm_cfft_init_q15(&inst->arm, fft_len));
+}
+static inline void zdsp_cfft_q15(const struct zdsp_cfft_instance_q15 *inst, q15_t *buf,
+				 bool inverse)
+{
+	arm_cfft_q15(&inst->arm, buf, inverse ? 1 : 0, 1);
+}
+
+struct zdsp_fir_instance_f32 {
+	arm_fir_instance_f32 arm;
+};
+struct zdsp_fir_instance_q15 {
+	arm_fir_instance_q15 arm;
+};
+struct zdsp_biquad_df1_instance_f32 {
+	arm_biquad_casd_df1_inst_f32 arm;
+};
+struct zdsp_biquad_df1_instance_q15 {
+	arm_biquad_casd_df1_inst_q15 arm;
+};
+struct zdsp_biquad_df2t_instance_f32 {
+	arm_biquad_cascade_df2T_instance_f32 arm;
+};
+
+static inline void zdsp_fir_init_f32(struct zdsp_fir_instance_f32 *inst, uint16_t num_taps,
+				     const float32_t *coeffs, float32_t *state,
+				     uint32_t block_size)
+{
+	arm_fir_init_f32(&inst->arm, num_taps, coeffs, state, block_size);
+}
+static inline void zdsp_fir_f32(const struct zdsp_fir_instance_f32 *inst, const float32_t *src,
+				float32_t *dst, uint32_t block_size)
+{
+	arm_fir_f32(&inst->arm, src, dst, block_size);
+}
+
+static inline int zdsp_fir_init_q15(struct zdsp_fir_instance_q15 *inst, uint16_t num_taps,
+				    const q15_t *coeffs, q15_t *state, uint32_t block_size)
+{
+	return z_zdsp_status(arm_fir_init_q15(&inst->arm, num_taps, coeffs, state, block_size));
+}
+static inline void zdsp_fir_q15(const struct zdsp_fir_instance_q15 *inst, const q15_t *src,
+				q15_t *dst, uint32_t block_size)
+{
+	arm_fir_q15(&inst->arm, src, dst, block_size);
+}
+
+static inline void zdsp_biquad_df1_init_f32(struct zdsp_biquad_df1_instance_f32 *inst,
+					    uint8_t num_stages, const float32_t *coeffs,
+					    float32_t *state)
+{
+	arm_biquad_cascade_df1_init_f32(&inst->arm, num_stages, coeffs, state);
+}
+static inline void zdsp_biquad_df1_f32(const struct zdsp_biquad_df1_instance_f32 *inst,
+				       const float32_t *src, float32_t *dst, uint32_t block_size)
+{
+	arm_biquad_cascade_df1_f32(&inst->arm, src, dst, block_size);
+}
+
+static inline void zdsp_biquad_df1_init_q15(struct zdsp_biquad_df1_instance_q15 *inst,
+					    uint8_t num_stages, const q15_t *coeffs,
+					    q15_t *state, int8_t post_shift)
+{
+	arm_biquad_cascade_df1_init_q15(&inst->arm, num_stages, coeffs, state, post_shift);
+}
+static inline void zdsp_biquad_df1_q15(const struct zdsp_biquad_df1_instance_q15 *inst,
+				       const q15_t *src, q15_t *dst, uint32_t block_size)
+{
+	arm_biquad_cascade_df1_q15(&inst->arm, src, dst, block_size);
+}
+
+static inline void zdsp_biquad_df2t_init_f32(struct zdsp_biquad_df2t_instance_f32 *inst,
+					     uint8_t num_stages, const float32_t *coeffs,
+					     float32_t *state)
+{
+	arm_biquad_cascade_df2T_init_f32(&inst->arm, num_stages, coeffs, state);
+}
+static inline void zdsp_biquad_df2t_f32(const struct zdsp_biquad_df2t_instance_f32 *inst,
+					const float32_t *src, float32_t *dst, uint32_t block_size)
+{
+	arm_biquad_cascade_df2T_f32(&inst->arm, src, dst, block_size);
+}
+
+static inline void zdsp_mean_f32(const float32_t *src, uint32_t block_size, float32_t *result)
+{
+	arm_mean_f32(src, block_size, result);
+}
+static inline void zdsp_rms_f32(const float32_t *src, uint32_t block_size, float32_t *result)
+{
+	arm_rms_f32(src, block_size, result);
+}
+static inline void zdsp_var_f32(const float32_t *src, uint32_t block_size, float32_t *result)
+{
+	arm_var_f32(src, block_size, result);
+}
+static inline void zdsp_std_f32(const float32_t *src, uint32_t block_size, float32_t *result)
+{
+	arm_std_f32(src, block_size, result);
+}
+static inline void zdsp_max_f32(const float32_t *src, uint32_t block_size, float32_t *result,
+				uint32_t *index)
+{
+	arm_max_f32(src, block_size, result, index);
+}
+static inline void zdsp_min_f32(const float32_t *src, uint32_t block_size, float32_t *result,
+				uint32_t *index)
+{
+	arm_min_f32(src, block_size, result, index);
+}
+
+static inline void zdsp_mean_q15(const q15_t *src, uint32_t block_size, q15_t *result)
+{
+	arm_mean_q15(src, block_size, result);
+}
+static inline void zdsp_rms_q15(const q15_t *src, uint32_t block_size, q15_t *result)
+{
+	arm_rms_q15(src, block_size, result);
+}
+static inline void zdsp_var_q15(const q15_t *src, uint32_t block_size, q15_t *result)
+{
+	arm_var_q15(src, block_size, result);
+}
+static inline void zdsp_std_q15(const q15_t *src, uint32_t block_size, q15_t *result)
+{
+	arm_std_q15(src, block_size, result);
+}
+static inline void zdsp_max_q15(const q15_t *src, uint32_t block_size, q15_t *result,
+				uint32_t *index)
+{
+	arm_max_q15(src, block_size, result, index);
+}
+static inline void zdsp_min_q15(const q15_t *src, uint32_t block_size, q15_t *result,
+				uint32_t *index)
+{
+	arm_min_q15(src, block_size, result, index);
+}
+
+/*
+ * CMSIS-DSP only checks the matrix dimensions with ARM_MATH_MATRIX_CHECK,
+ * the zdsp API always does.
+ */
+#define Z_ZDSP_MATRIX(_m)                                                                          \
+	{                                                                                          \
+		.numRows = (_m)->num_rows, .numCols = (_m)->num_cols, .pData = (_m)->data,         \
+	}
+
+static inline bool z_zdsp_mat_same_dims(const struct zdsp_matrix_f32 *a,
+					const struct zdsp_matrix_f32 *b)
+{
+	return a->num_rows == b->num_rows && a->num_cols == b->num_cols;
+}
+
+static inline int zdsp_mat_add_f32(const struct zdsp_matrix_f32 *src_a,
+				   const struct zdsp_matrix_f32 *src_b,
+				   struct zdsp_matrix_f32 *dst)
+{
+	const arm_matrix_instance_f32 a = Z_ZDSP_MATRIX(src_a);
+	const arm_matrix_instance_f32 b = Z_ZDSP_MATRIX(src_b);
+	arm_matrix_instance_f32 d = Z_ZDSP_MATRIX(dst);
+
+	if (!z_zdsp_mat_same_dims(src_a, src_b) || !z_zdsp_mat_same_dims(src_a, dst)) {
+		return -EINVAL;
+	}
+
+	return z_zdsp_status(arm_mat_add_f32(&a, &b, &d));
+}
+static inline int zdsp_mat_sub_f32(const struct zdsp_matrix_f32 *src_a,
+				   const struct zdsp_matrix_f32 *src_b,
+				   struct zdsp_matrix_f32 *dst)
+{
+	const arm_matrix_instance_f32 a = Z_ZDSP_MATRIX(src_a);
+	const arm_matrix_instance_f32 b = Z_ZDSP_MATRIX(src_b);
+	arm_matrix_instance_f32 d = Z_ZDSP_MATRIX(dst);
+
+	if (!z_zdsp_mat_same_dims(src_a, src_b) || !z_zdsp_mat_same_dims(src_a, dst)) {
+		return -EINVAL;
+	}
+
+	return z_zdsp_status(arm_mat_sub_f32(&a, &b, &d));
+}
+static inline int zdsp_mat_mult_f32(const struct zdsp_matrix_f32 *src_a,
+				    const struct zdsp_matrix_f32 *src_b,
+				    struct zdsp_matrix_f32 *dst)
+{
+	const arm_matrix_instance_f32 a = Z_ZDSP_MATRIX(src_a);
+	const arm_matrix_instance_f32 b = Z_ZDSP_MATRIX(src_b);
+	arm_matrix_instance_f32 d = Z_ZDSP_MATRIX(dst);
+
+	if (src_a->num_cols != src_b->num_rows || dst->num_rows != src_a->num_rows ||
+	    dst->num_cols != src_b->num_cols) {
+		return -EINVAL;
+	}
+
+	return z_zdsp_status(arm_mat_mult_f32(&a, &b, &d));
+}
+static inline int zdsp_mat_scale_f32(const struct zdsp_matrix_f32 *src, float32_t scale,
+				     struct zdsp_matrix_f32 *dst)
+{
+	const arm_matrix_instance_f32 s = Z_ZDSP_MATRIX(src);
+	arm_matrix_instance_f32 d = Z_ZDSP_MATRIX(dst);
+
+	if (!z_zdsp_mat_same_dims(src, dst)) {
+		return -EINVAL;
+	}
+
+	return z_zdsp_status(arm_mat_scale_f32(&s, scale, &d));
+}
+static inline int zdsp_mat_trans_f32(const struct zdsp_matrix_f32 *src,
+				     struct zdsp_matrix_f32 *dst)
+{
+	const arm_matrix_instance_f32 s = Z_ZDSP_MATRIX(src);
+	arm_matrix_instance_f32 d = Z_ZDSP_MATRIX(dst);
+
+	if (src->num_rows != dst->num_cols || src->num_cols != dst->num_rows) {
+		return -EINVAL;
+	}
+
+	return z_zdsp_status(arm_mat_trans_f32(&s, &d));
+}
+static inline int zdsp_mat_inverse_f32(struct zdsp_matrix_f32 *src, struct zdsp_matrix_f32 *dst)
+{
+	const arm_matrix_instance_f32 s = Z_ZDSP_MATRIX(src);
+	arm_matrix_instance_f32 d = Z_ZDSP_MATRIX(dst);
+
+	if (src->num_rows != src->num_cols || !z_zdsp_mat_same_dims(src, dst)) {
+		return -EINVAL;
+	}
+
+	return z_zdsp_status(arm_mat_inverse_f32(&s, &d));
+}
+
 #ifdef __cplusplus
 }
 #endif
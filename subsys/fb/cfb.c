@@ -59,6 +59,15 @@ struct char_framebuffer {
 
 	/** Inverted */
 	bool inverted;
+
+	/** First tile row changed since the last finalize */
+	uint16_t dirty_first;
+
+	/** Last tile row changed since the last finalize */
+	uint16_t dirty_last;
+
+	/** Current font converted for the display, if it fits the cache */
+	const uint8_t *glyph_cache;
 };
 
 static struct char_framebuffer char_fb;
@@ -83,23 +92,110 @@ static inline uint8_t get_glyph_byte(uint8_t *glyph_ptr, const struct cfb_font *
 	return 0;
 }
 
+static void mark_dirty(struct char_framebuffer *fb, int first, int last)
+{
+	first = MAX(first, 0);
+	last = MIN(last, (int)(fb->y_res / fb->ppt) - 1);
+	if (first > last) {
+		return;
+	}
+
+	fb->dirty_first = MIN(fb->dirty_first, first);
+	fb->dirty_last = MAX(fb->dirty_last, last);
+}
+
+static inline void mark_all_dirty(struct char_framebuffer *fb)
+{
+	mark_dirty(fb, 0, fb->y_res / fb->ppt - 1);
+}
+
+/*
+ * Convert the current font into vertically packed glyphs in the bit order
+ * of the display, so that they can be copied without further processing.
+ */
+static void glyph_cache_load(struct char_framebuffer *fb)
+{
+	fb->glyph_cache = NULL;
+
+#if CONFIG_CHARACTER_FRAMEBUFFER_GLYPH_CACHE_SIZE > 0
+	static uint8_t cache[CONFIG_CHARACTER_FRAMEBUFFER_GLYPH_CACHE_SIZE];
+	const struct cfb_font *fptr = &(fb->fonts[fb->font_idx]);
+	const bool need_reverse = (((fb->screen_info & SCREEN_INFO_MONO_MSB_FIRST) != 0)
+			     != ((fptr->caps & CFB_FONT_MSB_FIRST) != 0));
+	const size_t pages = fptr->height / 8U;
+	const size_t glyph_size = fptr->width * pages;
+	uint8_t *dst = cache;
+
+	if ((fptr->height % 8) ||
+	    (fptr->last_char - fptr->first_char + 1) * glyph_size > sizeof(cache)) {
+		LOG_DBG("Font %u does not fit in the glyph cache", fb->font_idx);
+		return;
+	}
+
+	for (int c = fptr->first_char; c <= fptr->last_char; c++) {
+		uint8_t *glyph_ptr = get_glyph_ptr(fptr, c);
+
+		for (size_t g_x = 0; g_x < fptr->width; g_x++) {
+			for (size_t page = 0; page < pages; page++) {
+				uint8_t byte = get_glyph_byte(glyph_ptr, fptr, g_x, page);
+
+				*dst++ = need_reverse ? byte_reverse(byte) : byte;
+			}
+		}
+	}
+
+	fb->glyph_cache = cache;
+#endif
+}
+
+static inline void put_byte(struct char_framebuffer *fb, int page, int16_t x,
+			    uint8_t byte, uint8_t mask, bool draw_bg)
+{
+	uint8_t *dst;
+
+	if (page < 0 || page >= fb->y_res / 8U) {
+		return;
+	}
+
+	dst = &fb->buf[page * fb->x_res + x];
+
+	if (draw_bg) {
+		*dst &= ~mask;
+	}
+
+	*dst |= byte & mask;
+}
+
 /*
  * Draw the monochrome character in the monochrome tiled framebuffer,
  * a byte is interpreted as 8 pixels ordered vertically among each other.
+ *
+ * Each glyph byte is written to the two framebuffer bytes it straddles when
+ * the character does not start on an 8-line boundary, using the bit order
+ * of the display so that the tiles can be shifted as a whole.
  */
-static uint8_t draw_char_vtmono(const struct char_framebuffer *fb,
-				char c, uint16_t x, uint16_t y,
+static uint8_t draw_char_vtmono(struct char_framebuffer *fb,
+				char c, int16_t x, int16_t y,
 				bool draw_bg)
 {
 	const struct cfb_font *fptr = &(fb->fonts[fb->font_idx]);
-	const bool need_reverse = (((fb->screen_info & SCREEN_INFO_MONO_MSB_FIRST) != 0)
-			     != ((fptr->caps & CFB_FONT_MSB_FIRST) != 0));
+	const bool msb_first = ((fb->screen_info & SCREEN_INFO_MONO_MSB_FIRST) != 0);
+	const bool need_reverse = (msb_first != ((fptr->caps & CFB_FONT_MSB_FIRST) != 0));
+	const uint8_t pages = fptr->height / 8U;
+	const int page0 = y >> 3;
+	const uint8_t offset = y & 7;
+	const uint8_t first_mask = msb_first ? (0xFF >> offset) : ((0xFF << offset) & 0xFF);
+	const uint8_t *cached = NULL;
 	uint8_t *glyph_ptr;
 
 	if (c < fptr->first_char || c > fptr->last_char) {
 		c = ' ';
 	}
 
+	if (fb->glyph_cache) {
+		cached = fb->glyph_cache + (c - fptr->first_char) * fptr->width * pages;
+	}
+
 	glyph_ptr = get_glyph_ptr(fptr, c);
 	if (!glyph_ptr) {
 		return 0;
@@ -107,79 +203,48 @@ static uint8_t draw_char_vtmono(const struct char_framebuffer *fb,
 
 	for (size_t g_x = 0; g_x < fptr->width; g_x++) {
 		const int16_t fb_x = x + g_x;
+		uint8_t carry = 0;
 
-		for (size_t g_y = 0; g_y < fptr->height; g_y++) {
-			/*
-			 * Process glyph rendering in the y direction
-			 * by separating per 8-line boundaries.
-			 */
+		if (fb_x < 0 || fb->x_res <= fb_x) {
+			continue;
+		}
 
-			const int16_t fb_y = y + g_y;
-			const size_t fb_index = (fb_y / 8U) * fb->x_res + fb_x;
-			const size_t offset = y % 8;
-			uint8_t bg_mask;
+		for (uint8_t page = 0; page < pages; page++) {
 			uint8_t byte;
 
-			if (fb_x < 0 || fb->x_res <= fb_x || fb_y < 0 || fb->y_res <= fb_y) {
-				continue;
-			}
-
-			byte = get_glyph_byte(glyph_ptr, fptr, g_x, g_y / 8);
-
-			if (offset == 0) {
-				/*
-				 * The start row is on an 8-line boundary.
-				 * Therefore, it can set the value directly.
-				 */
-				bg_mask = 0;
-				g_y += 7;
-			} else if (g_y == 0) {
-				/*
-				 * If the starting row is not on the 8-line boundary,
-				 * shift the glyph to the starting line, and create a mask
-				 * from the 8-line boundary to the starting line.
-				 */
-				byte = byte << offset;
-				bg_mask = BIT_MASK(offset);
-				g_y += (7 - offset);
+			if (cached) {
+				byte = cached[g_x * pages + page];
 			} else {
-				/*
-				 * After the starting row, read and concatenate the next 8-rows
-				 * glyph and clip to the 8-line boundary and write 8-lines
-				 * at the time.
-				 * Create a mask to prevent overwriting the drawing contents
-				 * after the end row.
-				 */
-				const size_t lines = ((fptr->height - g_y) < 8) ? offset : 8;
-
-				if (lines == 8) {
-					uint16_t byte2 = byte;
-
-					byte2 |= (get_glyph_byte(glyph_ptr, fptr, g_x,
-								 (g_y + 8) / 8))
-						  << 8;
-					byte = (byte2 >> (8 - offset)) & BIT_MASK(lines);
-				} else {
-					byte = (byte >> (8 - offset)) & BIT_MASK(lines);
+				byte = get_glyph_byte(glyph_ptr, fptr, g_x, page);
+				if (need_reverse) {
+					byte = byte_reverse(byte);
 				}
-
-				bg_mask = (BIT_MASK(8 - lines) << (lines)) & 0xFF;
-				g_y += (lines - 1);
 			}
 
-			if (need_reverse) {
-				byte = byte_reverse(byte);
-				bg_mask = byte_reverse(bg_mask);
+			if (offset == 0) {
+				put_byte(fb, page0 + page, fb_x, byte, 0xFF, draw_bg);
+				continue;
 			}
 
-			if (draw_bg) {
-				fb->buf[fb_index] &= bg_mask;
+			/* Lines after the first tile move on into the next one */
+			if (msb_first) {
+				put_byte(fb, page0 + page, fb_x, carry | (byte >> offset),
+					 page == 0 ? first_mask : 0xFF, draw_bg);
+				carry = byte << (8 - offset);
+			} else {
+				put_byte(fb, page0 + page, fb_x, carry | (byte << offset),
+					 page == 0 ? first_mask : 0xFF, draw_bg);
+				carry = byte >> (8 - offset);
 			}
+		}
 
-			fb->buf[fb_index] |= byte;
+		if (offset != 0) {
+			put_byte(fb, page0 + pages, fb_x, carry, ~first_mask, draw_bg);
 		}
 	}
 
+	mark_dirty(fb, page0, page0 + pages - (offset == 0 ? 1 : 0));
+
 	return fptr->width;
 }
 
@@ -202,6 +267,7 @@ static inline void draw_point(struct char_framebuffer *fb, int16_t x, int16_t y)
 	}
 
 	fb->buf[index + x] |= m;
+	mark_dirty(fb, y / 8, y / 8);
 }
 
 static void draw_line(struct char_framebuffer *fb, int16_t x0, int16_t y0, int16_t x1, int16_t y1)
@@ -237,7 +303,7 @@ static void draw_line(struct char_framebuffer *fb, int16_t x0, int16_t y0, int16
 static int draw_text(const struct device *dev, const char *const str, int16_t x, int16_t y,
 		     bool wrap)
 {
-	const struct char_framebuffer *fb = &char_fb;
+	struct char_framebuffer *fb = &char_fb;
 	const struct cfb_font *fptr;
 
 	if (!fb->fonts || !fb->buf) {
@@ -311,7 +377,7 @@ int cfb_print(const struct device *dev, const char *const str, uint16_t x, uint1
 int cfb_invert_area(const struct device *dev, uint16_t x, uint16_t y,
 		    uint16_t width, uint16_t height)
 {
-	const struct char_framebuffer *fb = &char_fb;
+	struct char_framebuffer *fb = &char_fb;
 	const bool need_reverse = ((fb->screen_info & SCREEN_INFO_MONO_MSB_FIRST) != 0);
 
 	if (x >= fb->x_res || y >= fb->y_res) {
@@ -388,6 +454,10 @@ int cfb_invert_area(const struct device *dev, uint16_t x, uint16_t y,
 			}
 		}
 
+		if (width > 0 && height > 0) {
+			mark_dirty(fb, y / 8, (y + height - 1) / 8);
+		}
+
 		return 0;
 	}
 
@@ -395,9 +465,9 @@ int cfb_invert_area(const struct device *dev, uint16_t x, uint16_t y,
 	return -EINVAL;
 }
 
-static int cfb_invert(const struct char_framebuffer *fb)
+static int cfb_invert(const struct char_framebuffer *fb, size_t start, size_t len)
 {
-	for (size_t i = 0; i < fb->x_res * fb->y_res / 8U; i++) {
+	for (size_t i = start; i < start + len; i++) {
 		fb->buf[i] = ~fb->buf[i];
 	}
 
@@ -406,13 +476,14 @@ static int cfb_invert(const struct char_framebuffer *fb)
 
 int cfb_framebuffer_clear(const struct device *dev, bool clear_display)
 {
-	const struct char_framebuffer *fb = &char_fb;
+	struct char_framebuffer *fb = &char_fb;
 
 	if (!fb || !fb->buf) {
 		return -ENODEV;
 	}
 
 	memset(fb->buf, 0, fb->size);
+	mark_all_dirty(fb);
 
 	if (clear_display) {
 		cfb_framebuffer_finalize(dev);
@@ -430,6 +501,7 @@ int cfb_framebuffer_invert(const struct device *dev)
 	}
 
 	fb->inverted = !fb->inverted;
+	mark_all_dirty(fb);
 
 	return 0;
 }
@@ -437,27 +509,51 @@ int cfb_framebuffer_invert(const struct device *dev)
 int cfb_framebuffer_finalize(const struct device *dev)
 {
 	const struct display_driver_api *api = dev->api;
-	const struct char_framebuffer *fb = &char_fb;
+	struct char_framebuffer *fb = &char_fb;
 	struct display_buffer_descriptor desc;
+	size_t start;
+	uint16_t rows;
 	int err;
 
 	if (!fb || !fb->buf) {
 		return -ENODEV;
 	}
 
-	desc.buf_size = fb->size;
+	if (fb->dirty_first > fb->dirty_last) {
+		return 0;
+	}
+
+	/*
+	 * Only the tile rows changed since the last call are written, as a
+	 * band of the full width that is contiguous in the framebuffer.
+	 */
+	rows = fb->dirty_last - fb->dirty_first + 1;
+	start = fb->dirty_first * fb->x_res;
+
+	desc.buf_size = rows * fb->x_res;
 	desc.width = fb->x_res;
-	desc.height = fb->y_res;
+	desc.height = rows * fb->ppt;
 	desc.pitch = fb->x_res;
 
+	if (rows == fb->y_res / fb->ppt) {
+		desc.buf_size = fb->size;
+		desc.height = fb->y_res;
+	}
+
 	if (!(fb->pixel_format & PIXEL_FORMAT_MONO10) != !(fb->inverted)) {
-		cfb_invert(fb);
-		err = api->write(dev, 0, 0, &desc, fb->buf);
-		cfb_invert(fb);
-		return err;
+		cfb_invert(fb, start, desc.buf_size);
+		err = api->write(dev, 0, fb->dirty_first * fb->ppt, &desc, fb->buf + start);
+		cfb_invert(fb, start, desc.buf_size);
+	} else {
+		err = api->write(dev, 0, fb->dirty_first * fb->ppt, &desc, fb->buf + start);
+	}
+
+	if (err == 0) {
+		fb->dirty_first = UINT16_MAX;
+		fb->dirty_last = 0;
 	}
 
-	return api->write(dev, 0, 0, &desc, fb->buf);
+	return err;
 }
 
 int cfb_get_display_parameter(const struct device *dev,
@@ -495,6 +591,7 @@ int cfb_framebuffer_set_font(const struct device *dev, uint8_t idx)
 	}
 
 	fb->font_idx = idx;
+	glyph_cache_load(fb);
 
 	return 0;
 }
@@ -553,6 +650,8 @@ int cfb_framebuffer_init(const struct device *dev)
 	fb->buf = NULL;
 	fb->kerning = 0;
 	fb->inverted = false;
+	fb->dirty_first = UINT16_MAX;
+	fb->dirty_last = 0;
 
 	fb->fonts = TYPE_SECTION_START(cfb_font);
 	fb->font_idx = 0U;
@@ -564,6 +663,8 @@ int cfb_framebuffer_init(const struct device *dev)
 	}
 
 	memset(fb->buf, 0, fb->size);
+	mark_all_dirty(fb);
+	glyph_cache_load(fb);
 
 	return 0;
 }
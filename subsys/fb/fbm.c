@@ -0,0 +1,343 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/cache.h>
+#include <zephyr/init.h>
+#include <zephyr/display/fbm.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(display_fbm, CONFIG_DISPLAY_FBM_LOG_LEVEL);
+
+/*
+ * With two buffers, the frame is drawn into the back buffer while the front
+ * one is being written to the display. At every flush the buffers are
+ * swapped, and the rectangles just flushed are copied into the new back
+ * buffer so that it holds the complete frame again.
+ */
+
+#ifdef CONFIG_DISPLAY_FBM_FLUSH_THREAD
+static K_THREAD_STACK_DEFINE(fbm_workq_stack, CONFIG_DISPLAY_FBM_FLUSH_THREAD_STACK_SIZE);
+static struct k_work_q fbm_workq;
+#endif
+
+static inline uint32_t rect_area(const struct display_fbm_rect *r)
+{
+	return (uint32_t)r->width * r->height;
+}
+
+static void rect_union(const struct display_fbm_rect *a,
+		       const struct display_fbm_rect *b,
+		       struct display_fbm_rect *out)
+{
+	uint16_t x0 = MIN(a->x, b->x);
+	uint16_t y0 = MIN(a->y, b->y);
+	uint16_t x1 = MAX(a->x + a->width, b->x + b->width);
+	uint16_t y1 = MAX(a->y + a->height, b->y + b->height);
+
+	out->x = x0;
+	out->y = y0;
+	out->width = x1 - x0;
+	out->height = y1 - y0;
+}
+
+/* Overlapping or adjacent rectangles are merged without cost */
+static bool rect_touch(const struct display_fbm_rect *a,
+		       const struct display_fbm_rect *b)
+{
+	return a->x <= b->x + b->width && b->x <= a->x + a->width &&
+	       a->y <= b->y + b->height && b->y <= a->y + a->height;
+}
+
+static inline uint8_t *fbm_pixel(const struct display_fbm *fbm, uint8_t idx,
+				 uint16_t x, uint16_t y)
+{
+	return fbm->bufs[idx] + ((size_t)y * fbm->width + x) * fbm->bytes_per_pixel;
+}
+
+static void fbm_copy_flushed(struct display_fbm *fbm)
+{
+	const size_t pitch = (size_t)fbm->width * fbm->bytes_per_pixel;
+
+	for (uint8_t i = 0; i < fbm->num_flushed; i++) {
+		const struct display_fbm_rect *r = &fbm->flushed[i];
+		const uint8_t *src = fbm_pixel(fbm, fbm->front, r->x, r->y);
+		uint8_t *dst = fbm_pixel(fbm, fbm->back, r->x, r->y);
+
+		for (uint16_t row = 0; row < r->height; row++) {
+			memcpy(dst, src, (size_t)r->width * fbm->bytes_per_pixel);
+			src += pitch;
+			dst += pitch;
+		}
+	}
+}
+
+static int fbm_write_front(struct display_fbm *fbm)
+{
+	const size_t pitch = (size_t)fbm->width * fbm->bytes_per_pixel;
+	struct display_buffer_descriptor desc = {
+		.pitch = fbm->width,
+	};
+	int ret;
+
+	if (fbm->flags & DISPLAY_FBM_FULL_FRAME) {
+		desc.width = fbm->width;
+		desc.height = fbm->height;
+		desc.buf_size = pitch * fbm->height;
+		(void)sys_cache_data_flush_range(fbm->bufs[fbm->front], desc.buf_size);
+
+		return display_write(fbm->dev, 0, 0, &desc, fbm->bufs[fbm->front]);
+	}
+
+	for (uint8_t i = 0; i < fbm->num_flushed; i++) {
+		const struct display_fbm_rect *r = &fbm->flushed[i];
+		uint8_t *start = fbm_pixel(fbm, fbm->front, r->x, r->y);
+
+		desc.width = r->width;
+		desc.height = r->height;
+		desc.buf_size = pitch * r->height;
+		(void)sys_cache_data_flush_range(start, desc.buf_size -
+						 (fbm->width - r->width) * fbm->bytes_per_pixel);
+
+		ret = display_write(fbm->dev, r->x, r->y, &desc, start);
+		if (ret < 0) {
+			LOG_ERR("Failed to write %ux%u at %u,%u (%d)",
+				r->width, r->height, r->x, r->y, ret);
+			return ret;
+		}
+	}
+
+	return 0;
+}
+
+static void fbm_flush_handler(struct k_work *work)
+{
+	struct display_fbm *fbm = CONTAINER_OF(work, struct display_fbm, work);
+
+	fbm->result = fbm_write_front(fbm);
+
+	/* The new back buffer was on the screen until the write returned */
+	if ((fbm->flags & DISPLAY_FBM_FULL_FRAME) && fbm->num_bufs == 2) {
+		fbm_copy_flushed(fbm);
+	}
+
+	k_sem_give(&fbm->idle);
+}
+
+static bool fbm_async(const struct display_fbm *fbm)
+{
+	return IS_ENABLED(CONFIG_DISPLAY_FBM_FLUSH_THREAD) && fbm->num_bufs == 2;
+}
+
+/* Wait until the back buffer may be drawn into */
+static void fbm_wait_back(struct display_fbm *fbm)
+{
+	if (fbm_async(fbm) && (fbm->flags & DISPLAY_FBM_FULL_FRAME)) {
+		k_sem_take(&fbm->idle, K_FOREVER);
+		k_sem_give(&fbm->idle);
+	}
+}
+
+int display_fbm_init(struct display_fbm *fbm, const struct device *dev,
+		     uint8_t *const bufs[], uint8_t num_bufs, size_t buf_size,
+		     uint32_t flags)
+{
+	struct display_capabilities caps;
+	uint32_t bpp;
+
+	if (num_bufs < 1 || num_bufs > ARRAY_SIZE(fbm->bufs)) {
+		return -EINVAL;
+	}
+
+	display_get_capabilities(dev, &caps);
+	bpp = DISPLAY_BITS_PER_PIXEL(caps.current_pixel_format);
+	if (bpp < 8) {
+		LOG_ERR("Pixel format %u not supported", caps.current_pixel_format);
+		return -ENOTSUP;
+	}
+
+	if (buf_size < (size_t)caps.x_resolution * caps.y_resolution * (bpp / 8)) {
+		LOG_ERR("Buffers of %zu bytes too small for %ux%u", buf_size,
+			caps.x_resolution, caps.y_resolution);
+		return -EINVAL;
+	}
+
+	memset(fbm, 0, sizeof(*fbm));
+	fbm->dev = dev;
+	fbm->num_bufs = num_bufs;
+	for (uint8_t i = 0; i < num_bufs; i++) {
+		fbm->bufs[i] = bufs[i];
+	}
+
+	fbm->back = 0;
+	fbm->front = num_bufs - 1;
+	fbm->bytes_per_pixel = bpp / 8;
+	fbm->flags = flags;
+	fbm->width = caps.x_resolution;
+	fbm->height = caps.y_resolution;
+	k_sem_init(&fbm->idle, 1, 1);
+	k_work_init(&fbm->work, fbm_flush_handler);
+
+	return 0;
+}
+
+uint8_t *display_fbm_get_buffer(struct display_fbm *fbm)
+{
+	fbm_wait_back(fbm);
+
+	return fbm->bufs[fbm->back];
+}
+
+void display_fbm_invalidate(struct display_fbm *fbm,
+			    const struct display_fbm_rect *rect)
+{
+	struct display_fbm_rect r = *rect;
+	uint32_t best_cost = UINT32_MAX;
+	uint8_t best = 0;
+
+	if (r.x >= fbm->width || r.y >= fbm->height || r.width == 0 || r.height == 0) {
+		return;
+	}
+
+	r.width = MIN(r.width, fbm->width - r.x);
+	r.height = MIN(r.height, fbm->height - r.y);
+
+	/*
+	 * Most of a line is as fast to send as all of it, and a full width
+	 * rectangle is contiguous in the buffer.
+	 */
+	if (r.width * 4U >= fbm->width * 3U) {
+		r.x = 0;
+		r.width = fbm->width;
+	}
+
+again:
+	for (uint8_t i = 0; i < fbm->num_dirty; i++) {
+		if (rect_touch(&fbm->dirty[i], &r)) {
+			rect_union(&fbm->dirty[i], &r, &r);
+			fbm->dirty[i] = fbm->dirty[--fbm->num_dirty];
+			goto again;
+		}
+	}
+
+	if (fbm->num_dirty < ARRAY_SIZE(fbm->dirty)) {
+		fbm->dirty[fbm->num_dirty++] = r;
+		return;
+	}
+
+	/* No room left, grow the rectangle that costs the least */
+	for (uint8_t i = 0; i < fbm->num_dirty; i++) {
+		struct display_fbm_rect u;
+		uint32_t cost;
+
+		rect_union(&fbm->dirty[i], &r, &u);
+		cost = rect_area(&u) - rect_area(&fbm->dirty[i]);
+		if (cost < best_cost) {
+			best_cost = cost;
+			best = i;
+		}
+	}
+
+	rect_union(&fbm->dirty[best], &r, &r);
+	fbm->dirty[best] = fbm->dirty[--fbm->num_dirty];
+	goto again;
+}
+
+int display_fbm_write(struct display_fbm *fbm, const uint16_t x,
+		      const uint16_t y,
+		      const struct display_buffer_descriptor *desc,
+		      const void *buf)
+{
+	const struct display_fbm_rect r = {
+		.x = x,
+		.y = y,
+		.width = desc->width,
+		.height = desc->height,
+	};
+	const size_t len = (size_t)desc->width * fbm->bytes_per_pixel;
+	const uint8_t *src = buf;
+	uint8_t *dst;
+
+	if ((uint32_t)x + desc->width > fbm->width ||
+	    (uint32_t)y + desc->height > fbm->height ||
+	    desc->pitch < desc->width) {
+		return -EINVAL;
+	}
+
+	fbm_wait_back(fbm);
+
+	dst = fbm_pixel(fbm, fbm->back, x, y);
+	for (uint16_t row = 0; row < desc->height; row++) {
+		memcpy(dst, src, len);
+		src += (size_t)desc->pitch * fbm->bytes_per_pixel;
+		dst += (size_t)fbm->width * fbm->bytes_per_pixel;
+	}
+
+	display_fbm_invalidate(fbm, &r);
+
+	return 0;
+}
+
+int display_fbm_flush(struct display_fbm *fbm)
+{
+	k_sem_take(&fbm->idle, K_FOREVER);
+
+	if (fbm->num_dirty == 0) {
+		k_sem_give(&fbm->idle);
+		return 0;
+	}
+
+	memcpy(fbm->flushed, fbm->dirty, fbm->num_dirty * sizeof(fbm->dirty[0]));
+	fbm->num_flushed = fbm->num_dirty;
+	fbm->num_dirty = 0;
+
+	fbm->front = fbm->back;
+	if (fbm->num_bufs == 2) {
+		fbm->back ^= 1;
+
+		/* The new back buffer has been sent by the previous flush */
+		if (!(fbm->flags & DISPLAY_FBM_FULL_FRAME)) {
+			fbm_copy_flushed(fbm);
+		}
+	}
+
+#ifdef CONFIG_DISPLAY_FBM_FLUSH_THREAD
+	if (fbm_async(fbm)) {
+		k_work_submit_to_queue(&fbm_workq, &fbm->work);
+		return 0;
+	}
+#endif
+
+	fbm_flush_handler(&fbm->work);
+
+	return fbm->result;
+}
+
+int display_fbm_sync(struct display_fbm *fbm, k_timeout_t timeout)
+{
+	if (k_sem_take(&fbm->idle, timeout) != 0) {
+		return -EAGAIN;
+	}
+
+	k_sem_give(&fbm->idle);
+
+	return fbm->result;
+}
+
+#ifdef CONFIG_DISPLAY_FBM_FLUSH_THREAD
+static int display_fbm_workq_init(void)
+{
+	k_work_queue_start(&fbm_workq, fbm_workq_stack,
+			   K_THREAD_STACK_SIZEOF(fbm_workq_stack),
+			   K_PRIO_COOP(CONFIG_DISPLAY_FBM_FLUSH_THREAD_PRIO), NULL);
+	k_thread_name_set(&fbm_workq.thread, "display_fbm");
+
+	return 0;
+}
+
+SYS_INIT(display_fbm_workq_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+#endif
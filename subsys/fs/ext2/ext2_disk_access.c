@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <string.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/device.h>
 #include <zephyr/storage/disk_access.h>
@@ -86,13 +87,14 @@ static int disk_prepare_range(struct disk_data *disk, uint32_t addr, uint32_t si
 	return 0;
 }
 
-static int disk_access_read_block(struct ext2_data *fs, void *buf, uint32_t block)
+static int disk_read_block(struct ext2_data *fs, void *buf, uint32_t block,
+		uint32_t block_size)
 {
 	int rc;
 	struct disk_data *disk = fs->backend;
 	uint32_t sector_start, sector_count;
 
-	rc = disk_prepare_range(disk, block * fs->block_size, fs->block_size,
+	rc = disk_prepare_range(disk, block * block_size, block_size,
 			&sector_start, &sector_count);
 	if (rc < 0) {
 		return rc;
@@ -100,13 +102,14 @@ static int disk_access_read_block(struct ext2_data *fs, void *buf, uint32_t bloc
 	return disk_read(disk->name, buf, sector_start, sector_count);
 }
 
-static int disk_access_write_block(struct ext2_data *fs, const void *buf, uint32_t block)
+static int disk_write_block(struct ext2_data *fs, const void *buf, uint32_t block,
+		uint32_t block_size)
 {
 	int rc;
 	struct disk_data *disk = fs->backend;
 	uint32_t sector_start, sector_count;
 
-	rc = disk_prepare_range(disk, block * fs->block_size, fs->block_size,
+	rc = disk_prepare_range(disk, block * block_size, block_size,
 			&sector_start, &sector_count);
 	if (rc < 0) {
 		return rc;
@@ -114,12 +117,221 @@ static int disk_access_write_block(struct ext2_data *fs, const void *buf, uint32
 	return disk_write(disk->name, buf, sector_start, sector_count);
 }
 
+#if defined(CONFIG_EXT2_BLOCK_CACHE)
+/*
+ * Least recently used cache of the blocks of the file system. The blocks
+ * given to the file system are copies of the cached ones, so the cache is
+ * transparent to the ownership of the ext2_block structures. With write
+ * back, writes only update the cache and the dirty blocks are written to
+ * the disk when evicted or when the file system is synced.
+ */
+static struct block_cache {
+	uint32_t block;
+	uint32_t used;
+	bool valid;
+	bool dirty;
+} block_cache[CONFIG_EXT2_BLOCK_CACHE_SIZE];
+
+static uint8_t __aligned(sizeof(void *))
+	block_cache_data[CONFIG_EXT2_BLOCK_CACHE_SIZE][CONFIG_EXT2_MAX_BLOCK_SIZE];
+static uint32_t block_cache_clock;
+static uint32_t block_cache_block_size;
+
+static inline uint8_t *cache_data(struct block_cache *c)
+{
+	return block_cache_data[c - block_cache];
+}
+
+static void cache_invalidate(void)
+{
+	memset(block_cache, 0, sizeof(block_cache));
+	block_cache_clock = 0;
+	block_cache_block_size = 0;
+}
+
+static int cache_write_back(struct ext2_data *fs, struct block_cache *c)
+{
+	int rc;
+
+	rc = disk_write_block(fs, cache_data(c), c->block, block_cache_block_size);
+	if (rc < 0) {
+		LOG_ERR("cache: write back of block %d failed (%d)", c->block, rc);
+		return rc;
+	}
+	c->dirty = false;
+	return 0;
+}
+
+/* Write the dirty blocks back in ascending order, to keep the disk accesses sequential. */
+static int cache_flush(struct ext2_data *fs)
+{
+	struct block_cache *next;
+	int rc;
+
+	for (;;) {
+		next = NULL;
+		for (int i = 0; i < CONFIG_EXT2_BLOCK_CACHE_SIZE; i++) {
+			struct block_cache *c = &block_cache[i];
+
+			if (c->valid && c->dirty && (next == NULL || c->block < next->block)) {
+				next = c;
+			}
+		}
+		if (next == NULL) {
+			return 0;
+		}
+
+		rc = cache_write_back(fs, next);
+		if (rc < 0) {
+			return rc;
+		}
+	}
+}
+
+/* Drop the cache when the block size changed, e.g. when the disk was formatted. */
+static int cache_check_block_size(struct ext2_data *fs)
+{
+	int rc;
+
+	if (block_cache_block_size == fs->block_size) {
+		return 0;
+	}
+
+	rc = cache_flush(fs);
+	if (rc < 0) {
+		return rc;
+	}
+	cache_invalidate();
+
+	if (fs->block_size > CONFIG_EXT2_MAX_BLOCK_SIZE) {
+		return -ENOTSUP;
+	}
+	block_cache_block_size = fs->block_size;
+	return 0;
+}
+
+static struct block_cache *cache_find(uint32_t block)
+{
+	for (int i = 0; i < CONFIG_EXT2_BLOCK_CACHE_SIZE; i++) {
+		if (block_cache[i].valid && block_cache[i].block == block) {
+			return &block_cache[i];
+		}
+	}
+	return NULL;
+}
+
+static struct block_cache *cache_victim(struct ext2_data *fs, int *rc)
+{
+	struct block_cache *victim = &block_cache[0];
+
+	for (int i = 0; i < CONFIG_EXT2_BLOCK_CACHE_SIZE; i++) {
+		struct block_cache *c = &block_cache[i];
+
+		if (!c->valid) {
+			return c;
+		}
+		if (c->used < victim->used) {
+			victim = c;
+		}
+	}
+
+	if (victim->dirty) {
+		*rc = cache_write_back(fs, victim);
+		if (*rc < 0) {
+			return NULL;
+		}
+	}
+	victim->valid = false;
+	return victim;
+}
+
+static int disk_access_read_block(struct ext2_data *fs, void *buf, uint32_t block)
+{
+	struct block_cache *c;
+	int rc = cache_check_block_size(fs);
+
+	if (rc < 0) {
+		return rc;
+	}
+
+	c = cache_find(block);
+	if (c == NULL) {
+		c = cache_victim(fs, &rc);
+		if (c == NULL) {
+			return rc;
+		}
+
+		rc = disk_read_block(fs, cache_data(c), block, fs->block_size);
+		if (rc < 0) {
+			return rc;
+		}
+		c->block = block;
+		c->valid = true;
+	}
+
+	c->used = ++block_cache_clock;
+	memcpy(buf, cache_data(c), fs->block_size);
+	return 0;
+}
+
+static int disk_access_write_block(struct ext2_data *fs, const void *buf, uint32_t block)
+{
+	struct block_cache *c;
+	int rc = cache_check_block_size(fs);
+
+	if (rc < 0) {
+		return rc;
+	}
+
+	c = cache_find(block);
+	if (c == NULL) {
+		c = cache_victim(fs, &rc);
+		if (c == NULL) {
+			return rc;
+		}
+	}
+
+	if (!IS_ENABLED(CONFIG_EXT2_BLOCK_CACHE_WRITE_BACK)) {
+		rc = disk_write_block(fs, buf, block, fs->block_size);
+		if (rc < 0) {
+			c->valid = false;
+			return rc;
+		}
+	}
+
+	memcpy(cache_data(c), buf, fs->block_size);
+	c->block = block;
+	c->valid = true;
+	c->dirty = IS_ENABLED(CONFIG_EXT2_BLOCK_CACHE_WRITE_BACK);
+	c->used = ++block_cache_clock;
+	return 0;
+}
+#else
+static int disk_access_read_block(struct ext2_data *fs, void *buf, uint32_t block)
+{
+	return disk_read_block(fs, buf, block, fs->block_size);
+}
+
+static int disk_access_write_block(struct ext2_data *fs, const void *buf, uint32_t block)
+{
+	return disk_write_block(fs, buf, block, fs->block_size);
+}
+#endif /* CONFIG_EXT2_BLOCK_CACHE */
+
 static int disk_access_read_superblock(struct ext2_data *fs, struct ext2_disk_superblock *sb)
 {
 	int rc;
 	struct disk_data *disk = fs->backend;
 	uint32_t sector_start, sector_count;
 
+#if defined(CONFIG_EXT2_BLOCK_CACHE)
+	/* The superblock is read from the disk, it must be up to date */
+	rc = cache_flush(fs);
+	if (rc < 0) {
+		return rc;
+	}
+#endif
+
 	rc = disk_prepare_range(disk, EXT2_SUPERBLOCK_OFFSET, sizeof(struct ext2_disk_superblock),
 			&sector_start, &sector_count);
 	if (rc < 0) {
@@ -132,6 +344,14 @@ static int disk_access_sync(struct ext2_data *fs)
 {
 	struct disk_data *disk = fs->backend;
 
+#if defined(CONFIG_EXT2_BLOCK_CACHE)
+	int rc = cache_flush(fs);
+
+	if (rc < 0) {
+		return rc;
+	}
+#endif
+
 	LOG_DBG("Sync disk %s", disk->name);
 	return disk_access_ioctl(disk->name, DISK_IOCTL_CTRL_SYNC, NULL);
 }
@@ -169,6 +389,10 @@ int ext2_init_disk_access_backend(struct ext2_data *fs, const void *storage_dev,
 		return rc;
 	}
 
+#if defined(CONFIG_EXT2_BLOCK_CACHE)
+	cache_invalidate();
+#endif
+
 	disk_data = (struct disk_data) {
 		.name = storage_dev,
 		.sector_size = sector_size,
@@ -179,6 +179,76 @@ int ext2_assign_block_num(struct ext2_data *fs, struct ext2_block *b)
 }
 
 
+/* Directory entry cache ---------------------------------------------------- */
+
+#if defined(CONFIG_EXT2_DENTRY_CACHE)
+/* Longer names are looked up in the directory each time */
+#define DENTRY_CACHE_NAME_LEN 32
+
+/* Entries found by lookups, dropped on every change of a directory. */
+static struct dentry_cache {
+	uint32_t dir;
+	uint32_t ino;      /* 0 for a free entry */
+	uint32_t offset;
+	uint32_t used;
+	uint8_t name_len;
+	char name[DENTRY_CACHE_NAME_LEN];
+} dentry_cache[CONFIG_EXT2_DENTRY_CACHE_SIZE];
+
+static uint32_t dentry_cache_clock;
+
+static void dentry_cache_invalidate(void)
+{
+	memset(dentry_cache, 0, sizeof(dentry_cache));
+	dentry_cache_clock = 0;
+}
+
+static struct dentry_cache *dentry_cache_find(uint32_t dir, const char *name, size_t len)
+{
+	for (int i = 0; i < CONFIG_EXT2_DENTRY_CACHE_SIZE; i++) {
+		struct dentry_cache *d = &dentry_cache[i];
+
+		if (d->ino != 0 && d->dir == dir && d->name_len == len &&
+		    memcmp(d->name, name, len) == 0) {
+			d->used = ++dentry_cache_clock;
+			return d;
+		}
+	}
+	return NULL;
+}
+
+static void dentry_cache_add(uint32_t dir, const char *name, size_t len, uint32_t ino,
+		uint32_t offset)
+{
+	struct dentry_cache *d = &dentry_cache[0];
+
+	if (len > DENTRY_CACHE_NAME_LEN || ino == 0) {
+		return;
+	}
+
+	for (int i = 0; i < CONFIG_EXT2_DENTRY_CACHE_SIZE; i++) {
+		if (dentry_cache[i].ino == 0) {
+			d = &dentry_cache[i];
+			break;
+		}
+		if (dentry_cache[i].used < d->used) {
+			d = &dentry_cache[i];
+		}
+	}
+
+	d->dir = dir;
+	d->ino = ino;
+	d->offset = offset;
+	d->used = ++dentry_cache_clock;
+	d->name_len = len;
+	memcpy(d->name, name, len);
+}
+#else
+static inline void dentry_cache_invalidate(void)
+{
+}
+#endif /* CONFIG_EXT2_DENTRY_CACHE */
+
 /* FS operations ------------------------------------------------------------ */
 
 int ext2_init_storage(struct ext2_data **fsp, const void *storage_dev, int flags)
@@ -309,6 +379,8 @@ int ext2_init_fs(struct ext2_data *fs)
 {
 	int ret = 0;
 
+	dentry_cache_invalidate();
+
 	/* Fetch superblock */
 	ret = ext2_fetch_superblock(fs);
 	if (ret < 0) {
@@ -363,6 +435,8 @@ int ext2_close_fs(struct ext2_data *fs)
 {
 	int ret = 0;
 
+	dentry_cache_invalidate();
+
 	/* Close all open inodes */
 	for (int32_t i = 0; i < fs->open_inodes; ++i) {
 		if (fs->inode_pool[i] != NULL) {
@@ -568,6 +642,17 @@ static int64_t find_dir_entry(struct ext2_inode *inode, const char *name, size_t
 	struct ext2_data *fs = inode->i_fs;
 	struct ext2_direntry *de;
 
+#if defined(CONFIG_EXT2_DENTRY_CACHE)
+	struct dentry_cache *d = dentry_cache_find(inode->i_id, name, len);
+
+	if (d != NULL) {
+		if (r_offset) {
+			*r_offset = d->offset;
+		}
+		return (int64_t)d->ino;
+	}
+#endif
+
 	while (offset < inode->i_size) {
 		block = offset / fs->block_size;
 		block_off = offset % fs->block_size;
@@ -601,6 +686,9 @@ static int64_t find_dir_entry(struct ext2_inode *inode, const char *name, size_t
 	return -EINVAL;
 success:
 	k_heap_free(&direntry_heap, de);
+#if defined(CONFIG_EXT2_DENTRY_CACHE)
+	dentry_cache_add(inode->i_id, name, len, ino, offset);
+#endif
 	return (int64_t)ino;
 }
 
@@ -938,6 +1026,8 @@ static int ext2_add_direntry(struct ext2_inode *dir, struct ext2_direntry *entry
 	uint32_t block_size = dir->i_fs->block_size;
 	uint32_t entry_size = sizeof(struct ext2_disk_direntry) + entry->de_name_len;
 
+	dentry_cache_invalidate();
+
 	if (entry_size > block_size) {
 		return -EINVAL;
 	}
@@ -1140,6 +1230,8 @@ static int ext2_del_direntry(struct ext2_inode *parent, uint32_t offset)
 	int rc = 0;
 	uint32_t block_size = parent->i_fs->block_size;
 
+	dentry_cache_invalidate();
+
 	uint32_t blk = offset / block_size;
 	uint32_t blk_off = offset % block_size;
 
@@ -1314,6 +1406,8 @@ int ext2_replace_file(struct ext2_lookup_args *args_from, struct ext2_lookup_arg
 	int rc = 0;
 	struct ext2_disk_direntry *de;
 
+	dentry_cache_invalidate();
+
 	uint32_t block_size = args_from->parent->i_fs->block_size;
 	uint32_t from_offset = args_from->offset;
 	uint32_t from_blk = from_offset / block_size;
@@ -171,9 +171,41 @@ fcb_init(int f_area_id, struct fcb *fcb)
 		}
 	}
 	k_mutex_init(&fcb->f_mtx);
+
+#ifdef CONFIG_FCB_INDEX
+	if ((rc == 0) && (fcb->f_index != NULL)) {
+		struct fcb_entry loc = {0};
+
+		memset(fcb->f_index, 0, fcb->f_sector_cnt * sizeof(fcb->f_index[0]));
+		while (fcb_getnext_nolock(fcb, &loc) == 0) {
+			fcb_index_add(fcb, &loc);
+		}
+	}
+#endif
 	return rc;
 }
 
+#ifdef CONFIG_FCB_INDEX
+void
+fcb_index_add(struct fcb *fcb, const struct fcb_entry *loc)
+{
+	struct fcb_sector_index *idx;
+	uint32_t slot;
+
+	if (fcb->f_index == NULL) {
+		return;
+	}
+
+	idx = &fcb->f_index[loc->fe_sector - fcb->f_sectors];
+	slot = idx->fi_cnt / CONFIG_FCB_INDEX_INTERVAL;
+	if ((idx->fi_cnt % CONFIG_FCB_INDEX_INTERVAL) == 0U && slot > 0U &&
+	    slot <= CONFIG_FCB_INDEX_SLOTS) {
+		idx->fi_off[slot - 1U] = loc->fe_elem_off;
+	}
+	idx->fi_cnt++;
+}
+#endif
+
 int
 fcb_free_sector_cnt(struct fcb *fcb)
 {
@@ -270,6 +302,12 @@ fcb_sector_hdr_init(struct fcb *fcb, struct flash_sector *sector, uint16_t id)
 	if (rc != 0) {
 		return -EIO;
 	}
+
+#ifdef CONFIG_FCB_INDEX
+	if (fcb->f_index != NULL) {
+		fcb->f_index[sector - fcb->f_sectors].fi_cnt = 0U;
+	}
+#endif
 	return 0;
 }
 
@@ -321,6 +359,31 @@ fcb_offset_last_n(struct fcb *fcb, uint8_t entries,
 		entries = 1U;
 	}
 
+#ifdef CONFIG_FCB_INDEX
+	if (fcb->f_index != NULL) {
+		struct flash_sector *sector;
+		uint32_t cnt = 0U;
+
+		rc = k_mutex_lock(&fcb->f_mtx, K_FOREVER);
+		if (rc) {
+			return -EINVAL;
+		}
+		for (sector = fcb->f_oldest; ; sector = fcb_getnext_sector(fcb, sector)) {
+			cnt += fcb->f_index[sector - fcb->f_sectors].fi_cnt;
+			if (sector == fcb->f_active.fe_sector) {
+				break;
+			}
+		}
+		k_mutex_unlock(&fcb->f_mtx);
+
+		if (cnt == 0U) {
+			return -ENOENT;
+		}
+
+		return fcb_getnth(fcb, (cnt > entries) ? (cnt - entries) : 0U, last_n_entry);
+	}
+#endif
+
 	i = 0;
 	(void)memset(&loc, 0, sizeof(loc));
 	while (!fcb_getnext(fcb, &loc)) {
@@ -105,6 +105,83 @@ next_sector:
 	return 0;
 }
 
+static int
+fcb_getnth_nolock(struct fcb *fcb, uint32_t n, struct fcb_entry *loc)
+{
+	int rc;
+
+	loc->fe_sector = NULL;
+	loc->fe_elem_off = 0U;
+
+#ifdef CONFIG_FCB_INDEX
+	if (fcb->f_index != NULL) {
+		struct fcb_sector_index *idx;
+		uint32_t slot;
+
+		/* Skip the whole sectors, then jump to the closest indexed
+		 * entry before the wanted one.
+		 */
+		loc->fe_sector = fcb->f_oldest;
+		while (true) {
+			idx = &fcb->f_index[loc->fe_sector - fcb->f_sectors];
+			if (n < idx->fi_cnt) {
+				break;
+			}
+			if (loc->fe_sector == fcb->f_active.fe_sector) {
+				return -ENOENT;
+			}
+			n -= idx->fi_cnt;
+			loc->fe_sector = fcb_getnext_sector(fcb, loc->fe_sector);
+		}
+
+		slot = MIN(n / CONFIG_FCB_INDEX_INTERVAL, CONFIG_FCB_INDEX_SLOTS);
+		if (slot > 0U) {
+			loc->fe_elem_off = idx->fi_off[slot - 1U];
+			rc = fcb_elem_info(fcb, loc);
+			if (rc) {
+				return rc;
+			}
+			n -= slot * CONFIG_FCB_INDEX_INTERVAL;
+		} else {
+			rc = fcb_getnext_nolock(fcb, loc);
+			if (rc) {
+				return rc;
+			}
+		}
+	} else
+#endif
+	{
+		rc = fcb_getnext_nolock(fcb, loc);
+		if (rc) {
+			return (rc == -ENOTSUP) ? -ENOENT : rc;
+		}
+	}
+
+	while (n-- > 0U) {
+		rc = fcb_getnext_nolock(fcb, loc);
+		if (rc) {
+			return (rc == -ENOTSUP) ? -ENOENT : rc;
+		}
+	}
+
+	return 0;
+}
+
+int
+fcb_getnth(struct fcb *fcb, uint32_t n, struct fcb_entry *loc)
+{
+	int rc;
+
+	rc = k_mutex_lock(&fcb->f_mtx, K_FOREVER);
+	if (rc) {
+		return -EINVAL;
+	}
+	rc = fcb_getnth_nolock(fcb, n, loc);
+	k_mutex_unlock(&fcb->f_mtx);
+
+	return rc;
+}
+
 int
 fcb_getnext(struct fcb *fcb, struct fcb_entry *loc)
 {
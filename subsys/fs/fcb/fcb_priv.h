@@ -73,6 +73,10 @@ int fcb_elem_info(struct fcb *fcb, struct fcb_entry *loc);
 int fcb_elem_endmarker(struct fcb *fcb, struct fcb_entry *loc, uint8_t *crc8p);
 
 int fcb_sector_hdr_init(struct fcb *fcb, struct flash_sector *sector, uint16_t id);
+
+#ifdef CONFIG_FCB_INDEX
+void fcb_index_add(struct fcb *fcb, const struct fcb_entry *loc);
+#endif
 int fcb_sector_hdr_read(struct fcb *fcb, struct flash_sector *sector,
 			struct fcb_disk_area *fdap);
 
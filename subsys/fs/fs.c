@@ -16,6 +16,9 @@
 #include <zephyr/fs/fs_sys.h>
 #include <zephyr/sys/check.h>
 
+#if defined(CONFIG_FILE_SYSTEM_CACHE)
+#include "fs_cache_impl.h"
+#endif
 
 #define LOG_LEVEL CONFIG_FS_LOG_LEVEL
 #include <zephyr/logging/log.h>
@@ -171,6 +174,10 @@ int fs_open(struct fs_file_t *zfp, const char *file_name, fs_mode_t flags)
 	/* Copy flags to zfp for use with other fs_ API calls */
 	zfp->flags = flags;
 
+#if defined(CONFIG_FILE_SYSTEM_CACHE)
+	fs_cache_file_open(zfp, file_name);
+#endif
+
 	return rc;
 }
 
@@ -186,12 +193,28 @@ int fs_close(struct fs_file_t *zfp)
 		return -ENOTSUP;
 	}
 
+#if defined(CONFIG_FILE_SYSTEM_CACHE)
+	int cache_rc = 0;
+
+	if (zfp->cache != NULL) {
+		/* The file is closed even if the cached data is lost */
+		cache_rc = fs_cache_file_close(zfp);
+	}
+#endif
+
 	rc = zfp->mp->fs->close(zfp);
 	if (rc < 0) {
 		LOG_ERR("file close error (%d)", rc);
 		return rc;
 	}
 
+#if defined(CONFIG_FILE_SYSTEM_CACHE)
+	if (zfp->cache != NULL) {
+		fs_cache_file_release(zfp);
+		rc = cache_rc;
+	}
+#endif
+
 	zfp->mp = NULL;
 
 	return rc;
@@ -209,7 +232,15 @@ ssize_t fs_read(struct fs_file_t *zfp, void *ptr, size_t size)
 		return -ENOTSUP;
 	}
 
+#if defined(CONFIG_FILE_SYSTEM_CACHE)
+	if (zfp->cache != NULL) {
+		rc = fs_cache_file_read(zfp, ptr, size);
+	} else {
+		rc = zfp->mp->fs->read(zfp, ptr, size);
+	}
+#else
 	rc = zfp->mp->fs->read(zfp, ptr, size);
+#endif
 	if (rc < 0) {
 		LOG_ERR("file read error (%d)", rc);
 	}
@@ -229,7 +260,15 @@ ssize_t fs_write(struct fs_file_t *zfp, const void *ptr, size_t size)
 		return -ENOTSUP;
 	}
 
+#if defined(CONFIG_FILE_SYSTEM_CACHE)
+	if (zfp->cache != NULL) {
+		rc = fs_cache_file_write(zfp, ptr, size);
+	} else {
+		rc = zfp->mp->fs->write(zfp, ptr, size);
+	}
+#else
 	rc = zfp->mp->fs->write(zfp, ptr, size);
+#endif
 	if (rc < 0) {
 		LOG_ERR("file write error (%d)", rc);
 	}
@@ -249,7 +288,15 @@ int fs_seek(struct fs_file_t *zfp, off_t offset, int whence)
 		return -ENOTSUP;
 	}
 
+#if defined(CONFIG_FILE_SYSTEM_CACHE)
+	if (zfp->cache != NULL) {
+		rc = fs_cache_file_seek(zfp, offset, whence);
+	} else {
+		rc = zfp->mp->fs->lseek(zfp, offset, whence);
+	}
+#else
 	rc = zfp->mp->fs->lseek(zfp, offset, whence);
+#endif
 	if (rc < 0) {
 		LOG_ERR("file seek error (%d)", rc);
 	}
@@ -269,7 +316,15 @@ off_t fs_tell(struct fs_file_t *zfp)
 		return -ENOTSUP;
 	}
 
+#if defined(CONFIG_FILE_SYSTEM_CACHE)
+	if (zfp->cache != NULL) {
+		rc = fs_cache_file_tell(zfp);
+	} else {
+		rc = zfp->mp->fs->tell(zfp);
+	}
+#else
 	rc = zfp->mp->fs->tell(zfp);
+#endif
 	if (rc < 0) {
 		LOG_ERR("file tell error (%d)", rc);
 	}
@@ -289,7 +344,15 @@ int fs_truncate(struct fs_file_t *zfp, off_t length)
 		return -ENOTSUP;
 	}
 
+#if defined(CONFIG_FILE_SYSTEM_CACHE)
+	if (zfp->cache != NULL) {
+		rc = fs_cache_file_truncate(zfp, length);
+	} else {
+		rc = zfp->mp->fs->truncate(zfp, length);
+	}
+#else
 	rc = zfp->mp->fs->truncate(zfp, length);
+#endif
 	if (rc < 0) {
 		LOG_ERR("file truncate error (%d)", rc);
 	}
@@ -309,7 +372,15 @@ int fs_sync(struct fs_file_t *zfp)
 		return -ENOTSUP;
 	}
 
+#if defined(CONFIG_FILE_SYSTEM_CACHE)
+	if (zfp->cache != NULL) {
+		rc = fs_cache_file_sync(zfp);
+	} else {
+		rc = zfp->mp->fs->sync(zfp);
+	}
+#else
 	rc = zfp->mp->fs->sync(zfp);
+#endif
 	if (rc < 0) {
 		LOG_ERR("file sync error (%d)", rc);
 	}
@@ -794,6 +865,10 @@ int fs_unmount(struct fs_mount_t *mp)
 	/* clear file system interface */
 	mp->fs = NULL;
 
+#if defined(CONFIG_FILE_SYSTEM_CACHE)
+	mp->cache = NULL;
+#endif
+
 	/* remove mount node from the list */
 	sys_dlist_remove(&mp->node);
 	LOG_DBG("fs unmounted from %s", mp->mnt_point);
@@ -875,3 +950,79 @@ int fs_unregister(int type, const struct fs_file_system_t *fs)
 	LOG_DBG("fs unregister %d: %d", type, rc);
 	return rc;
 }
+
+#if defined(CONFIG_FILE_SYSTEM_CACHE)
+
+int fs_cache_set(const char *mnt_point, struct fs_cache *cache)
+{
+	struct fs_mount_t *mp;
+	int rc;
+
+	rc = fs_get_mnt_point(&mp, mnt_point, NULL);
+	if (rc < 0) {
+		return rc;
+	}
+
+	k_mutex_lock(&mutex, K_FOREVER);
+
+	if (((mp->cache != NULL) && (mp->cache->files > 0)) ||
+	    ((cache != NULL) && (cache->files > 0))) {
+		rc = -EBUSY;
+	} else {
+		if (cache != NULL) {
+			memset(cache->pages, 0, cache->page_count * sizeof(cache->pages[0]));
+		}
+		mp->cache = cache;
+	}
+
+	k_mutex_unlock(&mutex);
+
+	return rc;
+}
+
+int fs_cache_read_ahead_set(const char *mnt_point, uint8_t pages)
+{
+	struct fs_mount_t *mp;
+	int rc;
+
+	rc = fs_get_mnt_point(&mp, mnt_point, NULL);
+	if (rc < 0) {
+		return rc;
+	}
+
+	if (mp->cache == NULL) {
+		return -ENOTSUP;
+	}
+
+	k_mutex_lock(&mp->cache->lock, K_FOREVER);
+	mp->cache->read_ahead = pages;
+	k_mutex_unlock(&mp->cache->lock);
+
+	return 0;
+}
+
+int fs_cache_stats_get(const char *mnt_point, struct fs_cache_stats *stats, bool reset)
+{
+	struct fs_mount_t *mp;
+	int rc;
+
+	rc = fs_get_mnt_point(&mp, mnt_point, NULL);
+	if (rc < 0) {
+		return rc;
+	}
+
+	if (mp->cache == NULL) {
+		return -ENOTSUP;
+	}
+
+	k_mutex_lock(&mp->cache->lock, K_FOREVER);
+	*stats = mp->cache->stats;
+	if (reset) {
+		mp->cache->stats = (struct fs_cache_stats){ 0 };
+	}
+	k_mutex_unlock(&mp->cache->lock);
+
+	return 0;
+}
+
+#endif /* CONFIG_FILE_SYSTEM_CACHE */
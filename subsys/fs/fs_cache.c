@@ -0,0 +1,632 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/fs/fs.h>
+#include <zephyr/fs/fs_sys.h>
+#include <zephyr/fs/fs_cache.h>
+#include <zephyr/sys/hash_function.h>
+#include "fs_cache_impl.h"
+
+#define LOG_LEVEL CONFIG_FS_LOG_LEVEL
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(fs);
+
+/* Flush all the dirty pages of a file */
+#define FLUSH_ALL ((off_t)-1)
+
+static inline uint8_t *page_data(struct fs_cache *cache, struct fs_cache_page *page)
+{
+	return &cache->data[(page - cache->pages) * cache->page_size];
+}
+
+static inline bool page_dirty(const struct fs_cache_page *page)
+{
+	return page->dirty_hi > page->dirty_lo;
+}
+
+static inline void page_drop(struct fs_cache_page *page)
+{
+	page->zfp = NULL;
+	page->dirty_lo = 0;
+	page->dirty_hi = 0;
+}
+
+static inline off_t page_base(struct fs_cache *cache, off_t pos)
+{
+	return pos - (pos % (off_t)cache->page_size);
+}
+
+static ssize_t fs_backend_read(struct fs_file_t *zfp, off_t off, void *ptr, size_t size)
+{
+	int rc = zfp->mp->fs->lseek(zfp, off, FS_SEEK_SET);
+
+	if (rc < 0) {
+		return rc;
+	}
+
+	return zfp->mp->fs->read(zfp, ptr, size);
+}
+
+static ssize_t fs_backend_write(struct fs_file_t *zfp, off_t off, const void *ptr, size_t size)
+{
+	int rc = zfp->mp->fs->lseek(zfp, off, FS_SEEK_SET);
+
+	if (rc < 0) {
+		return rc;
+	}
+
+	return zfp->mp->fs->write(zfp, ptr, size);
+}
+
+static struct fs_cache_page *page_find(struct fs_cache *cache, const struct fs_file_t *zfp,
+				       off_t off)
+{
+	for (size_t i = 0; i < cache->page_count; i++) {
+		struct fs_cache_page *page = &cache->pages[i];
+
+		if ((page->zfp == zfp) && (page->off == off)) {
+			return page;
+		}
+	}
+
+	return NULL;
+}
+
+static int page_flush(struct fs_cache *cache, struct fs_cache_page *page)
+{
+	size_t len = page->dirty_hi - page->dirty_lo;
+	ssize_t rc;
+
+	if (len == 0) {
+		return 0;
+	}
+
+	rc = fs_backend_write(page->zfp, page->off + page->dirty_lo,
+			      page_data(cache, page) + page->dirty_lo, len);
+	if (rc < 0) {
+		return rc;
+	}
+
+	if ((size_t)rc < len) {
+		return -ENOSPC;
+	}
+
+	page->dirty_lo = 0;
+	page->dirty_hi = 0;
+	cache->stats.write_backs++;
+
+	return 0;
+}
+
+/* Write back the dirty pages of a file below end in offset order, so that
+ * the file is never extended across a hole.
+ */
+static int file_flush(struct fs_cache *cache, struct fs_file_t *zfp, off_t end)
+{
+	while (true) {
+		struct fs_cache_page *first = NULL;
+		int rc;
+
+		for (size_t i = 0; i < cache->page_count; i++) {
+			struct fs_cache_page *page = &cache->pages[i];
+
+			if ((page->zfp != zfp) || !page_dirty(page) ||
+			    ((end != FLUSH_ALL) && (page->off >= end))) {
+				continue;
+			}
+
+			if ((first == NULL) || (page->off < first->off)) {
+				first = page;
+			}
+		}
+
+		if (first == NULL) {
+			return 0;
+		}
+
+		rc = page_flush(cache, first);
+		if (rc < 0) {
+			LOG_ERR("cache write back error (%d)", rc);
+			return rc;
+		}
+	}
+}
+
+/* Drop the pages of a file overlapping [start, end) */
+static void file_drop(struct fs_cache *cache, const struct fs_file_t *zfp, off_t start, off_t end)
+{
+	for (size_t i = 0; i < cache->page_count; i++) {
+		struct fs_cache_page *page = &cache->pages[i];
+
+		if ((page->zfp == zfp) && (page->off + (off_t)cache->page_size > start) &&
+		    ((end == FLUSH_ALL) || (page->off < end))) {
+			page_drop(page);
+		}
+	}
+}
+
+/* Make the other handles of the file see the data of zfp: write back their
+ * dirty pages and, if zfp is going to modify the file, drop their pages.
+ */
+static int others_sync(struct fs_cache *cache, const struct fs_file_t *zfp, bool drop)
+{
+	for (size_t i = 0; i < cache->page_count; i++) {
+		struct fs_cache_page *page = &cache->pages[i];
+		int rc;
+
+		if ((page->zfp == NULL) || (page->zfp == zfp) ||
+		    (page->zfp->cache_key != zfp->cache_key)) {
+			continue;
+		}
+
+		rc = file_flush(cache, page->zfp, page->off + 1);
+		if (rc < 0) {
+			return rc;
+		}
+
+		if (drop) {
+			page_drop(page);
+		}
+	}
+
+	return 0;
+}
+
+/* Get a page for the file, evicting the least recently used one if needed */
+static int page_alloc(struct fs_cache *cache, struct fs_file_t *zfp, off_t off,
+		      struct fs_cache_page **pagep)
+{
+	struct fs_cache_page *victim = NULL;
+	int rc;
+
+	for (size_t i = 0; i < cache->page_count; i++) {
+		struct fs_cache_page *page = &cache->pages[i];
+
+		if (page->zfp == NULL) {
+			victim = page;
+			break;
+		}
+
+		if ((victim == NULL) || (page->used < victim->used)) {
+			victim = page;
+		}
+	}
+
+	if ((victim->zfp != NULL) && page_dirty(victim)) {
+		rc = file_flush(cache, victim->zfp, victim->off + 1);
+		if (rc < 0) {
+			return rc;
+		}
+	}
+
+	victim->zfp = zfp;
+	victim->off = off;
+	victim->len = 0;
+	victim->dirty_lo = 0;
+	victim->dirty_hi = 0;
+	victim->filled = false;
+	victim->used = ++cache->clock;
+
+	*pagep = victim;
+
+	return 0;
+}
+
+static int page_fill(struct fs_cache *cache, struct fs_cache_page *page)
+{
+	ssize_t rc;
+
+	rc = fs_backend_read(page->zfp, page->off, page_data(cache, page), cache->page_size);
+	if (rc < 0) {
+		page_drop(page);
+		return rc;
+	}
+
+	page->len = rc;
+	page->filled = true;
+
+	return 0;
+}
+
+static void read_ahead(struct fs_cache *cache, struct fs_file_t *zfp, off_t off)
+{
+	/* Never evict the page being read */
+	size_t count = MIN(cache->read_ahead, cache->page_count - 1);
+
+	for (size_t i = 0; i < count; i++, off += cache->page_size) {
+		struct fs_cache_page *page = page_find(cache, zfp, off);
+
+		if (page != NULL) {
+			continue;
+		}
+
+		if ((page_alloc(cache, zfp, off, &page) < 0) || (page_fill(cache, page) < 0)) {
+			return;
+		}
+
+		cache->stats.read_ahead++;
+
+		if (page->len < cache->page_size) {
+			/* End of file, the page is kept to answer the next read */
+			return;
+		}
+	}
+}
+
+void fs_cache_file_open(struct fs_file_t *zfp, const char *file_name)
+{
+	struct fs_cache *cache = zfp->mp->cache;
+
+	/* Appending writes go to the end of the file, wherever it is */
+	if ((cache == NULL) || ((zfp->flags & FS_O_APPEND) != 0) ||
+	    (zfp->mp->fs->lseek == NULL) || (zfp->mp->fs->tell == NULL)) {
+		zfp->cache = NULL;
+		return;
+	}
+
+	k_mutex_lock(&cache->lock, K_FOREVER);
+
+	zfp->cache = cache;
+	zfp->cache_pos = 0;
+	zfp->cache_next = 0;
+	zfp->cache_key = sys_hash32_djb2(file_name, strlen(file_name));
+	cache->files++;
+
+	k_mutex_unlock(&cache->lock);
+}
+
+int fs_cache_file_close(struct fs_file_t *zfp)
+{
+	struct fs_cache *cache = zfp->cache;
+	int rc;
+
+	k_mutex_lock(&cache->lock, K_FOREVER);
+
+	rc = file_flush(cache, zfp, FLUSH_ALL);
+
+	k_mutex_unlock(&cache->lock);
+
+	return rc;
+}
+
+void fs_cache_file_release(struct fs_file_t *zfp)
+{
+	struct fs_cache *cache = zfp->cache;
+
+	k_mutex_lock(&cache->lock, K_FOREVER);
+
+	file_drop(cache, zfp, 0, FLUSH_ALL);
+	cache->files--;
+	zfp->cache = NULL;
+
+	k_mutex_unlock(&cache->lock);
+}
+
+ssize_t fs_cache_file_read(struct fs_file_t *zfp, void *ptr, size_t size)
+{
+	struct fs_cache *cache = zfp->cache;
+	const size_t psize = cache->page_size;
+	uint8_t *dst = ptr;
+	size_t done = 0;
+	bool sequential;
+	ssize_t rc;
+
+	k_mutex_lock(&cache->lock, K_FOREVER);
+
+	sequential = (zfp->cache_pos == zfp->cache_next);
+
+	rc = others_sync(cache, zfp, false);
+
+	while ((rc >= 0) && (done < size)) {
+		off_t base = page_base(cache, zfp->cache_pos);
+		size_t in = zfp->cache_pos - base;
+		struct fs_cache_page *page = page_find(cache, zfp, base);
+		size_t len;
+
+		if ((page == NULL) && (in == 0) && ((size - done) >= psize)) {
+			/* Whole pages are read directly into the buffer */
+			len = ROUND_DOWN(size - done, psize);
+
+			rc = file_flush(cache, zfp, zfp->cache_pos + len);
+			if (rc == 0) {
+				rc = fs_backend_read(zfp, zfp->cache_pos, &dst[done], len);
+			}
+			if (rc < 0) {
+				break;
+			}
+
+			cache->stats.bypass++;
+			done += rc;
+			zfp->cache_pos += rc;
+			if ((size_t)rc < len) {
+				break;
+			}
+			continue;
+		}
+
+		if (page == NULL) {
+			rc = page_alloc(cache, zfp, base, &page);
+			if (rc == 0) {
+				rc = page_fill(cache, page);
+			}
+			if (rc < 0) {
+				break;
+			}
+
+			cache->stats.misses++;
+			if (sequential && (page->len == psize)) {
+				read_ahead(cache, zfp, base + psize);
+			}
+		} else if (!page->filled) {
+			/* Only written so far, write back and read it */
+			rc = file_flush(cache, zfp, base + 1);
+			if (rc == 0) {
+				rc = page_fill(cache, page);
+			}
+			if (rc < 0) {
+				break;
+			}
+
+			cache->stats.misses++;
+		} else {
+			cache->stats.hits++;
+		}
+
+		page->used = ++cache->clock;
+
+		if (in >= page->len) {
+			/* End of file */
+			break;
+		}
+
+		len = MIN(page->len - in, size - done);
+		memcpy(&dst[done], page_data(cache, page) + in, len);
+		done += len;
+		zfp->cache_pos += len;
+	}
+
+	zfp->cache_next = zfp->cache_pos;
+
+	k_mutex_unlock(&cache->lock);
+
+	return ((done > 0) || (rc >= 0)) ? done : rc;
+}
+
+/* A page at the end of the file does not hold the data written after it,
+ * drop the ones before off so that they are read again.
+ */
+static int tail_drop(struct fs_cache *cache, struct fs_file_t *zfp, off_t off)
+{
+	for (size_t i = 0; i < cache->page_count; i++) {
+		struct fs_cache_page *page = &cache->pages[i];
+		int rc;
+
+		if ((page->zfp != zfp) || (page->off >= off) || !page->filled ||
+		    (page->len == cache->page_size)) {
+			continue;
+		}
+
+		rc = file_flush(cache, zfp, page->off + 1);
+		if (rc < 0) {
+			return rc;
+		}
+
+		page_drop(page);
+	}
+
+	return 0;
+}
+
+/* Write the data directly to the file system */
+static ssize_t write_through(struct fs_cache *cache, struct fs_file_t *zfp, const void *ptr,
+			     size_t size)
+{
+	ssize_t rc;
+
+	rc = tail_drop(cache, zfp, zfp->cache_pos);
+	if (rc == 0) {
+		rc = file_flush(cache, zfp, zfp->cache_pos + size);
+	}
+	if (rc < 0) {
+		return rc;
+	}
+
+	file_drop(cache, zfp, zfp->cache_pos, zfp->cache_pos + size);
+
+	rc = fs_backend_write(zfp, zfp->cache_pos, ptr, size);
+	if (rc > 0) {
+		zfp->cache_pos += rc;
+	}
+
+	cache->stats.bypass++;
+
+	return rc;
+}
+
+ssize_t fs_cache_file_write(struct fs_file_t *zfp, const void *ptr, size_t size)
+{
+	struct fs_cache *cache = zfp->cache;
+	const size_t psize = cache->page_size;
+	const uint8_t *src = ptr;
+	size_t done = 0;
+	ssize_t rc;
+
+	k_mutex_lock(&cache->lock, K_FOREVER);
+
+	rc = others_sync(cache, zfp, true);
+
+	if ((rc >= 0) && !cache->write_back) {
+		rc = write_through(cache, zfp, ptr, size);
+		k_mutex_unlock(&cache->lock);
+		return rc;
+	}
+
+	while ((rc >= 0) && (done < size)) {
+		off_t base = page_base(cache, zfp->cache_pos);
+		size_t in = zfp->cache_pos - base;
+		size_t len = MIN(psize - in, size - done);
+		struct fs_cache_page *page = page_find(cache, zfp, base);
+		size_t lo = in;
+
+		if ((page == NULL) && (in == 0) && ((size - done) >= psize)) {
+			/* Whole pages are written directly from the buffer */
+			len = ROUND_DOWN(size - done, psize);
+
+			rc = write_through(cache, zfp, &src[done], len);
+			if (rc < 0) {
+				break;
+			}
+
+			done += rc;
+			if ((size_t)rc < len) {
+				break;
+			}
+			continue;
+		}
+
+		if (page == NULL) {
+			rc = tail_drop(cache, zfp, base);
+			if (rc == 0) {
+				rc = page_alloc(cache, zfp, base, &page);
+			}
+			if (rc < 0) {
+				break;
+			}
+		}
+
+		/* A page holds a single dirty range, write back a disjoint one */
+		if (page_dirty(page) && ((in > page->dirty_hi) || ((in + len) < page->dirty_lo))) {
+			rc = file_flush(cache, zfp, base + 1);
+			if (rc < 0) {
+				break;
+			}
+		}
+
+		if (page->filled && (in > page->len)) {
+			/* Writing past the end of the file fills the gap with zeros */
+			memset(page_data(cache, page) + page->len, 0, in - page->len);
+			lo = page->len;
+		}
+
+		memcpy(page_data(cache, page) + in, &src[done], len);
+
+		if (page_dirty(page)) {
+			page->dirty_lo = MIN(page->dirty_lo, lo);
+			page->dirty_hi = MAX(page->dirty_hi, in + len);
+		} else {
+			page->dirty_lo = lo;
+			page->dirty_hi = in + len;
+		}
+
+		if (page->filled) {
+			page->len = MAX(page->len, in + len);
+		}
+
+		page->used = ++cache->clock;
+		cache->stats.writes++;
+		done += len;
+		zfp->cache_pos += len;
+	}
+
+	k_mutex_unlock(&cache->lock);
+
+	return ((done > 0) || (rc >= 0)) ? done : rc;
+}
+
+int fs_cache_file_seek(struct fs_file_t *zfp, off_t offset, int whence)
+{
+	struct fs_cache *cache = zfp->cache;
+	off_t pos;
+	int rc;
+
+	k_mutex_lock(&cache->lock, K_FOREVER);
+
+	/* The file system checks the new position against the file size */
+	rc = file_flush(cache, zfp, FLUSH_ALL);
+	if (rc < 0) {
+		goto out;
+	}
+
+	switch (whence) {
+	case FS_SEEK_SET:
+		pos = offset;
+		break;
+	case FS_SEEK_CUR:
+		pos = zfp->cache_pos + offset;
+		break;
+	case FS_SEEK_END:
+		rc = zfp->mp->fs->lseek(zfp, offset, FS_SEEK_END);
+		if (rc < 0) {
+			goto out;
+		}
+
+		pos = zfp->mp->fs->tell(zfp);
+		if (pos < 0) {
+			rc = pos;
+			goto out;
+		}
+		break;
+	default:
+		rc = -EINVAL;
+		goto out;
+	}
+
+	rc = zfp->mp->fs->lseek(zfp, pos, FS_SEEK_SET);
+	if (rc == 0) {
+		zfp->cache_pos = pos;
+	}
+
+out:
+	k_mutex_unlock(&cache->lock);
+
+	return rc;
+}
+
+off_t fs_cache_file_tell(struct fs_file_t *zfp)
+{
+	return zfp->cache_pos;
+}
+
+int fs_cache_file_truncate(struct fs_file_t *zfp, off_t length)
+{
+	struct fs_cache *cache = zfp->cache;
+	int rc;
+
+	k_mutex_lock(&cache->lock, K_FOREVER);
+
+	rc = others_sync(cache, zfp, true);
+	if (rc == 0) {
+		rc = file_flush(cache, zfp, FLUSH_ALL);
+	}
+	if (rc == 0) {
+		file_drop(cache, zfp, 0, FLUSH_ALL);
+		rc = zfp->mp->fs->truncate(zfp, length);
+	}
+
+	k_mutex_unlock(&cache->lock);
+
+	return rc;
+}
+
+int fs_cache_file_sync(struct fs_file_t *zfp)
+{
+	struct fs_cache *cache = zfp->cache;
+	int rc;
+
+	k_mutex_lock(&cache->lock, K_FOREVER);
+
+	rc = file_flush(cache, zfp, FLUSH_ALL);
+	if (rc == 0) {
+		rc = zfp->mp->fs->sync(zfp);
+	}
+
+	k_mutex_unlock(&cache->lock);
+
+	return rc;
+}
@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* File operations of the file system cache, used by the VFS. */
+
+#ifndef ZEPHYR_SUBSYS_FS_FS_CACHE_IMPL_H_
+#define ZEPHYR_SUBSYS_FS_FS_CACHE_IMPL_H_
+
+#include <zephyr/fs/fs.h>
+#include <zephyr/fs/fs_cache.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Set up the caching of a file opened on a mount point with a cache */
+void fs_cache_file_open(struct fs_file_t *zfp, const char *file_name);
+
+/* Write back the cached data of a file before closing it */
+int fs_cache_file_close(struct fs_file_t *zfp);
+
+/* Release the cache of a closed file */
+void fs_cache_file_release(struct fs_file_t *zfp);
+
+ssize_t fs_cache_file_read(struct fs_file_t *zfp, void *ptr, size_t size);
+ssize_t fs_cache_file_write(struct fs_file_t *zfp, const void *ptr, size_t size);
+int fs_cache_file_seek(struct fs_file_t *zfp, off_t offset, int whence);
+off_t fs_cache_file_tell(struct fs_file_t *zfp);
+int fs_cache_file_truncate(struct fs_file_t *zfp, off_t length);
+int fs_cache_file_sync(struct fs_file_t *zfp);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_SUBSYS_FS_FS_CACHE_IMPL_H_ */
@@ -168,13 +168,134 @@ static int errno_to_lfs(int error)
 
 #ifdef CONFIG_FS_LITTLEFS_FMP_DEV
 
+#ifdef CONFIG_FS_LITTLEFS_FMP_READ_CACHE
+#define RC_LINE_SIZE CONFIG_FS_LITTLEFS_FMP_READ_CACHE_LINE_SIZE
+#define RC_LINES CONFIG_FS_LITTLEFS_FMP_READ_CACHE_LINES
+
+/* Read cache shared by the files and directories of all the mounted
+ * flash partitions.  A line holds an aligned chunk of a partition;
+ * programs update the lines they overlap and erases drop them, so the
+ * lines always match the flash content.
+ */
+struct rc_line {
+	const struct flash_area *fa;
+	size_t off;
+	size_t len;
+	uint32_t used;
+};
+
+static struct rc_line rc_lines[RC_LINES];
+static uint8_t __aligned(4) rc_data[RC_LINES][RC_LINE_SIZE];
+static uint32_t rc_clock;
+static K_MUTEX_DEFINE(rc_mutex);
+
+static struct rc_line *rc_line_get(const struct flash_area *fa, size_t line_off)
+{
+	struct rc_line *victim = &rc_lines[0];
+	struct rc_line *line;
+	int rc;
+
+	for (line = rc_lines; line < &rc_lines[RC_LINES]; line++) {
+		if ((line->fa == fa) && (line->off == line_off)) {
+			return line;
+		}
+		if (line->used < victim->used) {
+			victim = line;
+		}
+	}
+
+	/* Replace the least recently used line */
+	victim->fa = NULL;
+	victim->used = 0;
+	victim->len = MIN(RC_LINE_SIZE, fa->fa_size - line_off);
+	rc = flash_area_read(fa, line_off, rc_data[victim - rc_lines], victim->len);
+	if (rc < 0) {
+		return NULL;
+	}
+	victim->fa = fa;
+	victim->off = line_off;
+
+	return victim;
+}
+
+static int rc_read(const struct flash_area *fa, size_t offset, void *buffer,
+		   size_t size)
+{
+	uint8_t *dst = buffer;
+	int rc = 0;
+
+	/* Large reads gain nothing from the cache */
+	if (size >= RC_LINE_SIZE) {
+		return flash_area_read(fa, offset, buffer, size);
+	}
+
+	k_mutex_lock(&rc_mutex, K_FOREVER);
+	while (size > 0) {
+		size_t skip = offset % RC_LINE_SIZE;
+		size_t len = MIN(size, RC_LINE_SIZE - skip);
+		struct rc_line *line = rc_line_get(fa, offset - skip);
+
+		if (line == NULL) {
+			rc = -EIO;
+			break;
+		}
+		if ((skip + len) > line->len) {
+			rc = -EINVAL;
+			break;
+		}
+
+		line->used = ++rc_clock;
+		memcpy(dst, &rc_data[line - rc_lines][skip], len);
+		dst += len;
+		offset += len;
+		size -= len;
+	}
+	k_mutex_unlock(&rc_mutex);
+
+	return rc;
+}
+
+/* Copy the programmed data to the cached lines, or drop the lines when
+ * data is NULL.
+ */
+static void rc_update(const struct flash_area *fa, size_t offset,
+		      const uint8_t *data, size_t size)
+{
+	k_mutex_lock(&rc_mutex, K_FOREVER);
+	for (struct rc_line *line = rc_lines; line < &rc_lines[RC_LINES]; line++) {
+		size_t start, end;
+
+		if ((line->fa != fa) || (line->off >= (offset + size)) ||
+		    ((line->off + line->len) <= offset)) {
+			continue;
+		}
+
+		if (data == NULL) {
+			line->fa = NULL;
+			line->used = 0;
+			continue;
+		}
+
+		start = MAX(line->off, offset);
+		end = MIN(line->off + line->len, offset + size);
+		memcpy(&rc_data[line - rc_lines][start - line->off],
+		       &data[start - offset], end - start);
+	}
+	k_mutex_unlock(&rc_mutex);
+}
+#endif /* CONFIG_FS_LITTLEFS_FMP_READ_CACHE */
+
 static int lfs_api_read(const struct lfs_config *c, lfs_block_t block,
 			lfs_off_t off, void *buffer, lfs_size_t size)
 {
 	const struct flash_area *fa = c->context;
 	size_t offset = block * c->block_size + off;
 
+#ifdef CONFIG_FS_LITTLEFS_FMP_READ_CACHE
+	int rc = rc_read(fa, offset, buffer, size);
+#else
 	int rc = flash_area_read(fa, offset, buffer, size);
+#endif
 
 	return errno_to_lfs(rc);
 }
@@ -187,14 +308,55 @@ static int lfs_api_prog(const struct lfs_config *c, lfs_block_t block,
 
 	int rc = flash_area_write(fa, offset, buffer, size);
 
+#ifdef CONFIG_FS_LITTLEFS_FMP_READ_CACHE
+	rc_update(fa, offset, (rc == 0) ? buffer : NULL, size);
+#endif
+
 	return errno_to_lfs(rc);
 }
 
+#ifdef CONFIG_FS_LITTLEFS_FMP_ERASE_SKIP_BLANK
+static bool flash_range_is_blank(const struct flash_area *fa, size_t offset,
+				 size_t size)
+{
+	const struct device *dev = flash_area_get_device(fa);
+	uint8_t erase_value = flash_get_parameters(dev)->erase_value;
+	uint8_t buf[64] __aligned(4);
+
+	while (size > 0) {
+		size_t len = MIN(size, sizeof(buf));
+
+		if (flash_area_read(fa, offset, buf, len) < 0) {
+			return false;
+		}
+		for (size_t i = 0; i < len; i++) {
+			if (buf[i] != erase_value) {
+				return false;
+			}
+		}
+		offset += len;
+		size -= len;
+	}
+
+	return true;
+}
+#endif /* CONFIG_FS_LITTLEFS_FMP_ERASE_SKIP_BLANK */
+
 static int lfs_api_erase(const struct lfs_config *c, lfs_block_t block)
 {
 	const struct flash_area *fa = c->context;
 	size_t offset = block * c->block_size;
 
+#ifdef CONFIG_FS_LITTLEFS_FMP_READ_CACHE
+	rc_update(fa, offset, NULL, c->block_size);
+#endif
+
+#ifdef CONFIG_FS_LITTLEFS_FMP_ERASE_SKIP_BLANK
+	if (flash_range_is_blank(fa, offset, c->block_size)) {
+		return LFS_ERR_OK;
+	}
+#endif
+
 	int rc = flash_area_erase(fa, offset, c->block_size);
 
 	return errno_to_lfs(rc);
@@ -656,8 +818,49 @@ static int littlefs_flash_init(struct fs_littlefs *fs, void *dev_id)
 	}
 
 	fs->backend = (void *) *fap;
+
+#ifdef CONFIG_FS_LITTLEFS_FMP_READ_CACHE
+	/* The partition may have been written while it was not mounted */
+	rc_update(*fap, 0, NULL, (*fap)->fa_size);
+#endif
+
 	return 0;
 }
+
+#ifdef CONFIG_FS_LITTLEFS_FMP_AUTO_TUNE
+/* Make the read, program and cache sizes fit the flash device: programs
+ * are a multiple of the write block size, and the cache is the largest
+ * that fits the buffers and divides the block size.
+ */
+static int littlefs_flash_tune(const struct flash_area *fa, lfs_size_t block_size,
+			       lfs_size_t *read_size, lfs_size_t *prog_size,
+			       lfs_size_t *cache_size)
+{
+	const struct device *dev = flash_area_get_device(fa);
+	lfs_size_t wbs = MAX(flash_get_write_block_size(dev), 1U);
+	lfs_size_t cache;
+
+	*prog_size = ROUND_UP(*prog_size, wbs);
+	if ((*prog_size % *read_size) != 0) {
+		*read_size = *prog_size;
+	}
+
+	cache = *cache_size - (*cache_size % *prog_size);
+	while ((cache >= *prog_size) && ((block_size % cache) != 0)) {
+		cache -= *prog_size;
+	}
+
+	if (cache < *prog_size) {
+		LOG_ERR("cache size %u too small for %u-byte writes",
+			*cache_size, *prog_size);
+		return -EINVAL;
+	}
+
+	*cache_size = cache;
+
+	return 0;
+}
+#endif /* CONFIG_FS_LITTLEFS_FMP_AUTO_TUNE */
 #endif /* CONFIG_FS_LITTLEFS_FMP_DEV */
 
 static int littlefs_init_backend(struct fs_littlefs *fs, void *dev_id, int flags)
@@ -793,6 +996,14 @@ static int littlefs_init_cfg(struct fs_littlefs *fs, int flags)
 
 #ifdef CONFIG_FS_LITTLEFS_FMP_DEV
 	if (!littlefs_on_blkdev(flags)) {
+#ifdef CONFIG_FS_LITTLEFS_FMP_AUTO_TUNE
+		int ret = littlefs_flash_tune((struct flash_area *)fs->backend,
+					      block_size, &read_size, &prog_size,
+					      &cache_size);
+		if (ret < 0) {
+			return ret;
+		}
+#endif /* CONFIG_FS_LITTLEFS_FMP_AUTO_TUNE */
 		block_count = ((struct flash_area *)fs->backend)->fa_size
 			/ block_size;
 		const struct device *dev =
@@ -983,6 +1194,11 @@ static int littlefs_unmount(struct fs_mount_t *mountp)
 
 #ifdef CONFIG_FS_LITTLEFS_FMP_DEV
 	if (!littlefs_on_blkdev(mountp->flags)) {
+#ifdef CONFIG_FS_LITTLEFS_FMP_READ_CACHE
+		const struct flash_area *fa = fs->backend;
+
+		rc_update(fa, 0, NULL, fa->fa_size);
+#endif
 		flash_area_close(fs->backend);
 	}
 #endif /* CONFIG_FS_LITTLEFS_FMP_DEV */
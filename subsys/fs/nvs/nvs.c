@@ -36,14 +36,101 @@ static inline size_t nvs_lookup_cache_pos(uint16_t id)
 	return hash % CONFIG_NVS_LOOKUP_CACHE_SIZE;
 }
 
+#ifdef CONFIG_NVS_LOOKUP_INDEX
+
+/* The index is a hash table with linear probing. An entry with an erased
+ * address but a valid ID is a removed entry, it still tells that the ID has no
+ * ATE and can be reused for another ID. Returns the position of the ID, or
+ * the position where it can be added, or CONFIG_NVS_LOOKUP_CACHE_SIZE when the
+ * index is full.
+ */
+static size_t nvs_lookup_index_find(struct nvs_fs *fs, uint16_t id, bool *found)
+{
+	size_t pos = nvs_lookup_cache_pos(id);
+	size_t free_pos = CONFIG_NVS_LOOKUP_CACHE_SIZE;
+
+	*found = false;
+
+	for (size_t n = 0; n < CONFIG_NVS_LOOKUP_CACHE_SIZE; n++) {
+		if (fs->lookup_index_id[pos] == id) {
+			*found = true;
+			return pos;
+		}
+
+		if ((fs->lookup_cache[pos] == NVS_LOOKUP_CACHE_NO_ADDR) &&
+		    (free_pos == CONFIG_NVS_LOOKUP_CACHE_SIZE)) {
+			free_pos = pos;
+		}
+
+		if (fs->lookup_index_id[pos] == 0xFFFF) {
+			/* end of the probe sequence */
+			break;
+		}
+
+		pos = (pos + 1) % CONFIG_NVS_LOOKUP_CACHE_SIZE;
+	}
+
+	return free_pos;
+}
+
+#endif /* CONFIG_NVS_LOOKUP_INDEX */
+
+/* Get the address to start the search of the most recent ATE of 'id' from,
+ * NVS_LOOKUP_CACHE_NO_ADDR when there is no ATE for 'id'.
+ */
+static uint32_t nvs_lookup_cache_get(struct nvs_fs *fs, uint16_t id)
+{
+#ifdef CONFIG_NVS_LOOKUP_INDEX
+	size_t pos;
+	bool found;
+
+	/* 0xFFFF is a special-purpose identifier, it is never in the index */
+	if (id == 0xFFFF) {
+		return fs->ate_wra;
+	}
+
+	pos = nvs_lookup_index_find(fs, id, &found);
+	if (found) {
+		return fs->lookup_cache[pos];
+	}
+
+	/* IDs left out of a full index are only found by walking all ATEs */
+	return fs->lookup_index_full ? fs->ate_wra : NVS_LOOKUP_CACHE_NO_ADDR;
+#else
+	return fs->lookup_cache[nvs_lookup_cache_pos(id)];
+#endif
+}
+
+static void nvs_lookup_cache_set(struct nvs_fs *fs, uint16_t id, uint32_t addr)
+{
+#ifdef CONFIG_NVS_LOOKUP_INDEX
+	size_t pos;
+	bool found;
+
+	pos = nvs_lookup_index_find(fs, id, &found);
+	if (pos == CONFIG_NVS_LOOKUP_CACHE_SIZE) {
+		fs->lookup_index_full = true;
+		return;
+	}
+
+	fs->lookup_index_id[pos] = id;
+	fs->lookup_cache[pos] = addr;
+#else
+	fs->lookup_cache[nvs_lookup_cache_pos(id)] = addr;
+#endif
+}
+
 static int nvs_lookup_cache_rebuild(struct nvs_fs *fs)
 {
 	int rc;
 	uint32_t addr, ate_addr;
-	uint32_t *cache_entry;
 	struct nvs_ate ate;
 
 	memset(fs->lookup_cache, 0xff, sizeof(fs->lookup_cache));
+#ifdef CONFIG_NVS_LOOKUP_INDEX
+	memset(fs->lookup_index_id, 0xff, sizeof(fs->lookup_index_id));
+	fs->lookup_index_full = false;
+#endif
 	addr = fs->ate_wra;
 
 	while (true) {
@@ -55,11 +142,10 @@ static int nvs_lookup_cache_rebuild(struct nvs_fs *fs)
 			return rc;
 		}
 
-		cache_entry = &fs->lookup_cache[nvs_lookup_cache_pos(ate.id)];
-
-		if (ate.id != 0xFFFF && *cache_entry == NVS_LOOKUP_CACHE_NO_ADDR &&
+		if (ate.id != 0xFFFF &&
+		    nvs_lookup_cache_get(fs, ate.id) == NVS_LOOKUP_CACHE_NO_ADDR &&
 		    nvs_ate_valid(fs, &ate)) {
-			*cache_entry = ate_addr;
+			nvs_lookup_cache_set(fs, ate.id, ate_addr);
 		}
 
 		if (addr == fs->ate_wra) {
@@ -166,7 +252,7 @@ static int nvs_flash_ate_wrt(struct nvs_fs *fs, const struct nvs_ate *entry)
 #ifdef CONFIG_NVS_LOOKUP_CACHE
 	/* 0xFFFF is a special-purpose identifier. Exclude it from the cache */
 	if (entry->id != 0xFFFF) {
-		fs->lookup_cache[nvs_lookup_cache_pos(entry->id)] = fs->ate_wra;
+		nvs_lookup_cache_set(fs, entry->id, fs->ate_wra);
 	}
 #endif
 	fs->ate_wra -= nvs_al_size(fs, sizeof(struct nvs_ate));
@@ -301,6 +387,11 @@ static int nvs_flash_erase_sector(struct nvs_fs *fs, uint32_t addr)
 
 #ifdef CONFIG_NVS_LOOKUP_CACHE
 	nvs_lookup_cache_invalidate(fs, addr >> ADDR_SECT_SHIFT);
+#endif
+#ifdef CONFIG_NVS_BACKGROUND_GC
+	if ((fs->bg_gc_addr & ADDR_SECT_MASK) == addr) {
+		fs->bg_gc_addr = NVS_BG_GC_NO_ADDR;
+	}
 #endif
 	rc = flash_erase(fs->flash_device, offset, fs->sector_size);
 
@@ -573,6 +664,73 @@ static int nvs_add_gc_done_ate(struct nvs_fs *fs)
 	return nvs_flash_ate_wrt(fs, &gc_done_ate);
 }
 
+/* check if gc_ate, read from gc_addr, is the most recent ate of its id and
+ * holds data, so that gc needs to copy it.
+ */
+static int nvs_gc_ate_live(struct nvs_fs *fs, const struct nvs_ate *gc_ate,
+			   uint32_t gc_addr, bool *live)
+{
+	int rc;
+	struct nvs_ate wlk_ate;
+	uint32_t wlk_addr, wlk_prev_addr;
+
+#ifdef CONFIG_NVS_LOOKUP_CACHE
+	wlk_addr = nvs_lookup_cache_get(fs, gc_ate->id);
+
+	if (wlk_addr == NVS_LOOKUP_CACHE_NO_ADDR) {
+		wlk_addr = fs->ate_wra;
+	}
+#else
+	wlk_addr = fs->ate_wra;
+#endif
+	do {
+		wlk_prev_addr = wlk_addr;
+		rc = nvs_prev_ate(fs, &wlk_addr, &wlk_ate);
+		if (rc) {
+			return rc;
+		}
+		/* if ate with same id is reached we might need to copy.
+		 * only consider valid wlk_ate's. Something wrong might
+		 * have been written that has the same ate but is
+		 * invalid, don't consider these as a match.
+		 */
+		if ((wlk_ate.id == gc_ate->id) &&
+		    (nvs_ate_valid(fs, &wlk_ate))) {
+			break;
+		}
+	} while (wlk_addr != fs->ate_wra);
+
+	/* if walk has reached the same address as gc_addr copy is
+	 * needed unless it is a deleted item.
+	 */
+	*live = (wlk_prev_addr == gc_addr) && gc_ate->len;
+
+	return 0;
+}
+
+/* copy the data of gc_ate, read from gc_addr, to the write sector */
+static int nvs_gc_ate_move(struct nvs_fs *fs, struct nvs_ate *gc_ate,
+			   uint32_t gc_addr)
+{
+	int rc;
+	uint32_t data_addr;
+
+	LOG_DBG("Moving %d, len %d", gc_ate->id, gc_ate->len);
+
+	data_addr = (gc_addr & ADDR_SECT_MASK);
+	data_addr += gc_ate->offset;
+
+	gc_ate->offset = (uint16_t)(fs->data_wra & ADDR_OFFS_MASK);
+	nvs_ate_crc8_update(gc_ate);
+
+	rc = nvs_flash_block_move(fs, data_addr, gc_ate->len);
+	if (rc) {
+		return rc;
+	}
+
+	return nvs_flash_ate_wrt(fs, gc_ate);
+}
+
 /* garbage collection: the address ate_wra has been updated to the new sector
  * that has just been started. The data to gc is in the sector after this new
  * sector.
@@ -580,10 +738,10 @@ static int nvs_add_gc_done_ate(struct nvs_fs *fs)
 static int nvs_gc(struct nvs_fs *fs)
 {
 	int rc;
-	struct nvs_ate close_ate, gc_ate, wlk_ate;
-	uint32_t sec_addr, gc_addr, gc_prev_addr, wlk_addr, wlk_prev_addr,
-	      data_addr, stop_addr;
+	struct nvs_ate close_ate, gc_ate;
+	uint32_t sec_addr, gc_addr, gc_prev_addr, stop_addr;
 	size_t ate_size;
+	bool live, close_ate_erased = false;
 
 	ate_size = nvs_al_size(fs, sizeof(struct nvs_ate));
 
@@ -600,6 +758,7 @@ static int nvs_gc(struct nvs_fs *fs)
 
 	rc = nvs_ate_cmp_const(&close_ate, fs->flash_parameters->erase_value);
 	if (!rc) {
+		close_ate_erased = true;
 		goto gc_done;
 	}
 
@@ -626,51 +785,14 @@ static int nvs_gc(struct nvs_fs *fs)
 			continue;
 		}
 
-#ifdef CONFIG_NVS_LOOKUP_CACHE
-		wlk_addr = fs->lookup_cache[nvs_lookup_cache_pos(gc_ate.id)];
-
-		if (wlk_addr == NVS_LOOKUP_CACHE_NO_ADDR) {
-			wlk_addr = fs->ate_wra;
+		rc = nvs_gc_ate_live(fs, &gc_ate, gc_prev_addr, &live);
+		if (rc) {
+			return rc;
 		}
-#else
-		wlk_addr = fs->ate_wra;
-#endif
-		do {
-			wlk_prev_addr = wlk_addr;
-			rc = nvs_prev_ate(fs, &wlk_addr, &wlk_ate);
-			if (rc) {
-				return rc;
-			}
-			/* if ate with same id is reached we might need to copy.
-			 * only consider valid wlk_ate's. Something wrong might
-			 * have been written that has the same ate but is
-			 * invalid, don't consider these as a match.
-			 */
-			if ((wlk_ate.id == gc_ate.id) &&
-			    (nvs_ate_valid(fs, &wlk_ate))) {
-				break;
-			}
-		} while (wlk_addr != fs->ate_wra);
 
-		/* if walk has reached the same address as gc_addr copy is
-		 * needed unless it is a deleted item.
-		 */
-		if ((wlk_prev_addr == gc_prev_addr) && gc_ate.len) {
+		if (live) {
 			/* copy needed */
-			LOG_DBG("Moving %d, len %d", gc_ate.id, gc_ate.len);
-
-			data_addr = (gc_prev_addr & ADDR_SECT_MASK);
-			data_addr += gc_ate.offset;
-
-			gc_ate.offset = (uint16_t)(fs->data_wra & ADDR_OFFS_MASK);
-			nvs_ate_crc8_update(&gc_ate);
-
-			rc = nvs_flash_block_move(fs, data_addr, gc_ate.len);
-			if (rc) {
-				return rc;
-			}
-
-			rc = nvs_flash_ate_wrt(fs, &gc_ate);
+			rc = nvs_gc_ate_move(fs, &gc_ate, gc_prev_addr);
 			if (rc) {
 				return rc;
 			}
@@ -692,6 +814,15 @@ gc_done:
 		}
 	}
 
+#ifdef CONFIG_NVS_BACKGROUND_GC
+	/* The sector may already have been erased by the background gc */
+	if ((close_ate_erased) &&
+	    (nvs_flash_cmp_const(fs, sec_addr, fs->flash_parameters->erase_value,
+				 fs->sector_size) == 0)) {
+		return 0;
+	}
+#endif
+
 	/* Erase the gc'ed sector */
 	rc = nvs_flash_erase_sector(fs, sec_addr);
 	if (rc) {
@@ -700,6 +831,141 @@ gc_done:
 	return 0;
 }
 
+#ifdef CONFIG_NVS_BACKGROUND_GC
+
+/* background garbage collection: the oldest closed sector is collected ahead
+ * of need, a few ate's at a time, by copying its data to the write sector and
+ * erasing it. This keeps CONFIG_NVS_BACKGROUND_GC_RESERVE erased sectors on
+ * top of the one that always follows the write sector, so that nvs_write() only
+ * needs the full gc when the reserve has run out.
+ */
+static int nvs_bg_gc_step(struct nvs_fs *fs)
+{
+	int rc;
+	struct nvs_ate close_ate, gc_ate;
+	uint32_t sec_addr, gc_prev_addr, stop_addr;
+	size_t ate_size, budget;
+	uint16_t free_sectors = 0U;
+	bool live;
+
+	ate_size = nvs_al_size(fs, sizeof(struct nvs_ate));
+
+	/* find the oldest closed sector, after the erased ones */
+	sec_addr = fs->ate_wra & ADDR_SECT_MASK;
+	while (true) {
+		nvs_sector_advance(fs, &sec_addr);
+		if (sec_addr == (fs->ate_wra & ADDR_SECT_MASK)) {
+			return 0;
+		}
+
+		rc = nvs_flash_ate_rd(fs, sec_addr + fs->sector_size - ate_size,
+				      &close_ate);
+		if (rc) {
+			return rc;
+		}
+
+		if (nvs_ate_cmp_const(&close_ate, fs->flash_parameters->erase_value)) {
+			break;
+		}
+
+		if (++free_sectors > CONFIG_NVS_BACKGROUND_GC_RESERVE) {
+			/* reserve complete */
+			return 0;
+		}
+	}
+
+	stop_addr = sec_addr + fs->sector_size - 2 * ate_size;
+
+	if ((fs->bg_gc_addr & ADDR_SECT_MASK) != sec_addr) {
+		/* start on a new sector */
+		fs->bg_gc_addr = sec_addr + fs->sector_size - ate_size;
+		if (nvs_close_ate_valid(fs, &close_ate)) {
+			fs->bg_gc_addr &= ADDR_SECT_MASK;
+			fs->bg_gc_addr += close_ate.offset;
+		} else {
+			rc = nvs_recover_last_ate(fs, &fs->bg_gc_addr);
+			if (rc) {
+				return rc;
+			}
+		}
+	}
+
+	for (budget = CONFIG_NVS_BACKGROUND_GC_BUDGET; budget > 0; budget--) {
+		gc_prev_addr = fs->bg_gc_addr;
+		rc = nvs_prev_ate(fs, &fs->bg_gc_addr, &gc_ate);
+		if (rc) {
+			return rc;
+		}
+
+		if (nvs_ate_valid(fs, &gc_ate)) {
+			rc = nvs_gc_ate_live(fs, &gc_ate, gc_prev_addr, &live);
+			if (rc) {
+				return rc;
+			}
+
+			if (live) {
+				/* keep the space for a delete ate, leave the
+				 * rest to the gc of nvs_write()
+				 */
+				if (fs->ate_wra < (fs->data_wra + ate_size +
+						   nvs_al_size(fs, gc_ate.len))) {
+					fs->bg_gc_addr = gc_prev_addr;
+					return 0;
+				}
+
+				rc = nvs_gc_ate_move(fs, &gc_ate, gc_prev_addr);
+				if (rc) {
+					return rc;
+				}
+			}
+		}
+
+		if (gc_prev_addr == stop_addr) {
+			/* all data copied, the sector can be erased */
+			fs->bg_gc_addr = NVS_BG_GC_NO_ADDR;
+			rc = nvs_flash_erase_sector(fs, sec_addr);
+			if (rc) {
+				return rc;
+			}
+			break;
+		}
+	}
+
+	return 1;
+}
+
+int nvs_gc_step(struct nvs_fs *fs)
+{
+	int rc;
+
+	if (!fs->ready) {
+		LOG_ERR("NVS not initialized");
+		return -EACCES;
+	}
+
+	k_mutex_lock(&fs->nvs_lock, K_FOREVER);
+	rc = nvs_bg_gc_step(fs);
+	k_mutex_unlock(&fs->nvs_lock);
+
+	return rc;
+}
+
+static void nvs_bg_gc_work(struct k_work *work)
+{
+	struct nvs_fs *fs = CONTAINER_OF(work, struct nvs_fs, bg_gc_work);
+	int rc;
+
+	rc = nvs_gc_step(fs);
+	if (rc < 0) {
+		LOG_ERR("Background gc failed: %d", rc);
+	} else if (rc > 0) {
+		/* yield to the other work items before the next step */
+		(void)k_work_submit_to_queue(fs->gc_work_q, &fs->bg_gc_work);
+	}
+}
+
+#endif /* CONFIG_NVS_BACKGROUND_GC */
+
 static int nvs_startup(struct nvs_fs *fs)
 {
 	int rc;
@@ -715,6 +981,10 @@ static int nvs_startup(struct nvs_fs *fs)
 
 	k_mutex_lock(&fs->nvs_lock, K_FOREVER);
 
+#ifdef CONFIG_NVS_BACKGROUND_GC
+	fs->bg_gc_addr = NVS_BG_GC_NO_ADDR;
+#endif
+
 	ate_size = nvs_al_size(fs, sizeof(struct nvs_ate));
 	/* step through the sectors to find a open sector following
 	 * a closed sector, this is where NVS can write.
@@ -865,9 +1135,15 @@ static int nvs_startup(struct nvs_fs *fs)
 		 * So, temporarily, we set the lookup cache to the end of the fs.
 		 * The cache will be rebuilt afterwards
 		 **/
+#ifdef CONFIG_NVS_LOOKUP_INDEX
+		memset(fs->lookup_cache, 0xff, sizeof(fs->lookup_cache));
+		memset(fs->lookup_index_id, 0xff, sizeof(fs->lookup_index_id));
+		fs->lookup_index_full = true;
+#else
 		for (i = 0; i < CONFIG_NVS_LOOKUP_CACHE_SIZE; i++) {
 			fs->lookup_cache[i] = fs->ate_wra;
 		}
+#endif
 #endif
 		rc = nvs_gc(fs);
 		goto end;
@@ -953,6 +1229,9 @@ int nvs_mount(struct nvs_fs *fs)
 	size_t write_block_size;
 
 	k_mutex_init(&fs->nvs_lock);
+#ifdef CONFIG_NVS_BACKGROUND_GC
+	k_work_init(&fs->bg_gc_work, nvs_bg_gc_work);
+#endif
 
 	fs->flash_parameters = flash_get_parameters(fs->flash_device);
 	if (fs->flash_parameters == NULL) {
@@ -1032,7 +1311,7 @@ ssize_t nvs_write(struct nvs_fs *fs, uint16_t id, const void *data, size_t len)
 
 	/* find latest entry with same id */
 #ifdef CONFIG_NVS_LOOKUP_CACHE
-	wlk_addr = fs->lookup_cache[nvs_lookup_cache_pos(id)];
+	wlk_addr = nvs_lookup_cache_get(fs, id);
 
 	if (wlk_addr == NVS_LOOKUP_CACHE_NO_ADDR) {
 		goto no_cached_entry;
@@ -1131,6 +1410,11 @@ no_cached_entry:
 	rc = len;
 end:
 	k_mutex_unlock(&fs->nvs_lock);
+#ifdef CONFIG_NVS_BACKGROUND_GC
+	if ((rc > 0) && (fs->gc_work_q != NULL)) {
+		(void)k_work_submit_to_queue(fs->gc_work_q, &fs->bg_gc_work);
+	}
+#endif
 	return rc;
 }
 
@@ -1162,7 +1446,7 @@ ssize_t nvs_read_hist(struct nvs_fs *fs, uint16_t id, void *data, size_t len,
 	cnt_his = 0U;
 
 #ifdef CONFIG_NVS_LOOKUP_CACHE
-	wlk_addr = fs->lookup_cache[nvs_lookup_cache_pos(id)];
+	wlk_addr = nvs_lookup_cache_get(fs, id);
 
 	if (wlk_addr == NVS_LOOKUP_CACHE_NO_ADDR) {
 		rc = -ENOENT;
@@ -30,6 +30,8 @@ extern "C" {
 
 #define NVS_LOOKUP_CACHE_NO_ADDR 0xFFFFFFFF
 
+#define NVS_BG_GC_NO_ADDR 0xFFFFFFFF
+
 /* Allocation Table Entry */
 struct nvs_ate {
 	uint16_t id;	/* data id */
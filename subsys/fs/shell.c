@@ -11,6 +11,7 @@
 #include <zephyr/shell/shell.h>
 #include <zephyr/init.h>
 #include <zephyr/fs/fs.h>
+#include <zephyr/fs/fs_cache.h>
 #include <zephyr/sd/sd_spec.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -442,6 +443,65 @@ static int cmd_statvfs(const struct shell *sh, size_t argc, char **argv)
 	return 0;
 }
 
+#if defined(CONFIG_FILE_SYSTEM_CACHE)
+static int cmd_cache_stats(const struct shell *sh, size_t argc, char **argv)
+{
+	int err;
+	char path[MAX_PATH_LEN];
+	struct fs_cache_stats stats;
+	bool reset = (argc > 2) && (strcmp(argv[2], "reset") == 0);
+
+	create_abs_path(argv[1], path, sizeof(path));
+
+	err = fs_cache_stats_get(path, &stats, reset);
+	if (err < 0) {
+		shell_error(sh, "Failed to get the cache stats of %s (%d)", path, err);
+		return -ENOEXEC;
+	}
+
+	shell_fprintf(sh, SHELL_NORMAL,
+		      "hits %u, misses %u, read-ahead %u, bypass %u, writes %u, write-backs %u\n",
+		      stats.hits, stats.misses, stats.read_ahead, stats.bypass, stats.writes,
+		      stats.write_backs);
+
+	return 0;
+}
+
+static int cmd_cache_ra(const struct shell *sh, size_t argc, char **argv)
+{
+	int err;
+	char path[MAX_PATH_LEN];
+	unsigned long pages;
+	char *endptr;
+
+	create_abs_path(argv[1], path, sizeof(path));
+
+	pages = strtoul(argv[2], &endptr, 0);
+	if ((*endptr != '\0') || (pages > UINT8_MAX)) {
+		shell_error(sh, "Invalid number of pages: %s", argv[2]);
+		return -ENOEXEC;
+	}
+
+	err = fs_cache_read_ahead_set(path, pages);
+	if (err < 0) {
+		shell_error(sh, "Failed to set the read-ahead of %s (%d)", path, err);
+		return -ENOEXEC;
+	}
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_fs_cache,
+	SHELL_CMD_ARG(stats, NULL,
+		      "Show cache statistics. fs cache stats <mount-point> [reset]",
+		      cmd_cache_stats, 2, 1),
+	SHELL_CMD_ARG(ra, NULL,
+		      "Set read-ahead. fs cache ra <mount-point> <pages>",
+		      cmd_cache_ra, 3, 0),
+	SHELL_SUBCMD_SET_END
+);
+#endif
+
 static int cmd_write(const struct shell *sh, size_t argc, char **argv)
 {
 	char path[MAX_PATH_LEN];
@@ -835,6 +895,9 @@ SHELL_STATIC_SUBCMD_SET_CREATE(sub_fs_mount,
 #endif
 
 SHELL_STATIC_SUBCMD_SET_CREATE(sub_fs,
+#if defined(CONFIG_FILE_SYSTEM_CACHE)
+	SHELL_CMD(cache, &sub_fs_cache, "File system cache commands", NULL),
+#endif
 	SHELL_CMD(cd, NULL, "Change working directory", cmd_cd),
 	SHELL_CMD(ls, NULL, "List files in current directory", cmd_ls),
 	SHELL_CMD_ARG(mkdir, NULL, "Create directory", cmd_mkdir, 2, 0),
@@ -18,6 +18,97 @@ K_MSGQ_DEFINE(input_msgq, sizeof(struct input_event),
 
 #endif
 
+#ifdef CONFIG_INPUT_FRAMES
+
+/* Frames being built, a frame with no events is free */
+static struct input_frame input_frames[CONFIG_INPUT_FRAME_DEVICES];
+static struct k_spinlock input_frames_lock;
+
+static struct input_frame *input_frame_get(const struct device *dev)
+{
+	struct input_frame *free_frame = NULL;
+
+	for (size_t i = 0; i < ARRAY_SIZE(input_frames); i++) {
+		if (input_frames[i].num_events == 0) {
+			if (free_frame == NULL) {
+				free_frame = &input_frames[i];
+			}
+		} else if (input_frames[i].dev == dev) {
+			return &input_frames[i];
+		}
+	}
+
+	return free_frame;
+}
+
+static bool input_frame_merge(struct input_frame *frame, const struct input_event *evt)
+{
+	if (evt->type != INPUT_EV_ABS && evt->type != INPUT_EV_REL) {
+		return false;
+	}
+
+	for (uint8_t i = 0; i < frame->num_events; i++) {
+		struct input_event *prev = &frame->events[i];
+
+		if (prev->type == evt->type && prev->code == evt->code) {
+			if (evt->type == INPUT_EV_REL) {
+				prev->value += evt->value;
+			} else {
+				prev->value = evt->value;
+			}
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static void input_frame_process(const struct input_event *evt)
+{
+	struct input_frame *frame;
+	struct input_frame out;
+	k_spinlock_key_t key;
+	bool full = false;
+
+	key = k_spin_lock(&input_frames_lock);
+
+	frame = input_frame_get(evt->dev);
+	if (frame == NULL) {
+		/* No frame left, the event makes one on its own */
+		out.dev = evt->dev;
+		out.num_events = 1;
+		out.events[0] = *evt;
+	} else if (!input_frame_merge(frame, evt)) {
+		full = frame->num_events == ARRAY_SIZE(frame->events);
+		if (!full) {
+			frame->dev = evt->dev;
+			frame->events[frame->num_events++] = *evt;
+		}
+	}
+
+	if (frame != NULL && (full || evt->sync)) {
+		out = *frame;
+		frame->num_events = 0;
+	}
+
+	k_spin_unlock(&input_frames_lock, key);
+
+	if (frame == NULL || full || evt->sync) {
+		STRUCT_SECTION_FOREACH(input_frame_listener, listener) {
+			if (listener->dev == NULL || listener->dev == out.dev) {
+				listener->callback(&out);
+			}
+		}
+	}
+
+	if (full) {
+		/* The event starts the next frame */
+		input_frame_process(evt);
+	}
+}
+
+#endif /* CONFIG_INPUT_FRAMES */
+
 static void input_process(struct input_event *evt)
 {
 	STRUCT_SECTION_FOREACH(input_listener, listener) {
@@ -25,8 +116,40 @@ static void input_process(struct input_event *evt)
 			listener->callback(evt);
 		}
 	}
+
+#ifdef CONFIG_INPUT_FRAMES
+	input_frame_process(evt);
+#endif
+}
+
+#ifdef CONFIG_INPUT_QUEUE_DROP_OLDEST_MOTION
+
+static bool input_is_motion(const struct input_event *evt)
+{
+	return evt->type == INPUT_EV_ABS || evt->type == INPUT_EV_REL;
 }
 
+/*
+ * Interrupts are locked so that the input thread can't take the oldest event
+ * between the peek and the get, nor another reporter drop it first.
+ */
+static void input_queue_drop_oldest(void)
+{
+	struct input_event oldest;
+	unsigned int key;
+
+	key = irq_lock();
+
+	if (k_msgq_peek(&input_msgq, &oldest) == 0 && input_is_motion(&oldest)) {
+		(void)k_msgq_get(&input_msgq, &oldest, K_NO_WAIT);
+		LOG_DBG("queue full, oldest motion event dropped");
+	}
+
+	irq_unlock(key);
+}
+
+#endif /* CONFIG_INPUT_QUEUE_DROP_OLDEST_MOTION */
+
 bool input_queue_empty(void)
 {
 #ifdef CONFIG_INPUT_MODE_THREAD
@@ -50,6 +173,11 @@ int input_report(const struct device *dev,
 	};
 
 #ifdef CONFIG_INPUT_MODE_THREAD
+#ifdef CONFIG_INPUT_QUEUE_DROP_OLDEST_MOTION
+	if (input_is_motion(&evt) && k_msgq_num_free_get(&input_msgq) == 0) {
+		input_queue_drop_oldest();
+	}
+#endif
 	return k_msgq_put(&input_msgq, &evt, timeout);
 #else
 	input_process(&evt);
@@ -43,6 +43,12 @@ struct backend_data_t {
 	struct k_work mbox_work;
 	struct k_work_q mbox_wq;
 
+#if CONFIG_IPC_SERVICE_BACKEND_RPMSG_KICK_DELAY_US > 0
+	/* Deferred notification of the remote */
+	struct k_work_delayable kick_work;
+	const struct mbox_channel *kick_mbox;
+#endif
+
 	/* General */
 	unsigned int role;
 	atomic_t state;
@@ -289,13 +295,34 @@ static int vr_shm_configure(struct ipc_static_vrings *vr, const struct backend_c
 
 static void virtio_notify_cb(struct virtqueue *vq, void *priv)
 {
-	struct backend_config_t *conf = priv;
+	const struct device *instance = priv;
+	const struct backend_config_t *conf = instance->config;
 
-	if (conf->mbox_tx.dev) {
-		mbox_send(&conf->mbox_tx, NULL);
+	if (!conf->mbox_tx.dev) {
+		return;
 	}
+
+#if CONFIG_IPC_SERVICE_BACKEND_RPMSG_KICK_DELAY_US > 0
+	struct backend_data_t *data = instance->data;
+
+	/* Kicks requested while one is pending are merged into it */
+	(void)k_work_schedule_for_queue(&data->mbox_wq, &data->kick_work,
+					K_USEC(CONFIG_IPC_SERVICE_BACKEND_RPMSG_KICK_DELAY_US));
+#else
+	mbox_send(&conf->mbox_tx, NULL);
+#endif
 }
 
+#if CONFIG_IPC_SERVICE_BACKEND_RPMSG_KICK_DELAY_US > 0
+static void kick_work_process(struct k_work *item)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(item);
+	struct backend_data_t *data = CONTAINER_OF(dwork, struct backend_data_t, kick_work);
+
+	mbox_send(data->kick_mbox, NULL);
+}
+#endif
+
 static void mbox_callback_process(struct k_work *item)
 {
 	struct backend_data_t *data;
@@ -329,6 +356,11 @@ static int mbox_init(const struct device *instance)
 
 	k_work_init(&data->mbox_work, mbox_callback_process);
 
+#if CONFIG_IPC_SERVICE_BACKEND_RPMSG_KICK_DELAY_US > 0
+	k_work_init_delayable(&data->kick_work, kick_work_process);
+	data->kick_mbox = &conf->mbox_tx;
+#endif
+
 	err = mbox_register_callback(&conf->mbox_rx, mbox_callback, data);
 	if (err != 0) {
 		return err;
@@ -349,6 +381,13 @@ static int mbox_deinit(const struct device *instance)
 		return err;
 	}
 
+#if CONFIG_IPC_SERVICE_BACKEND_RPMSG_KICK_DELAY_US > 0
+	struct k_work_sync sync;
+
+	/* Send the last notification */
+	(void)k_work_flush_delayable(&data->kick_work, &sync);
+#endif
+
 	k_work_queue_drain(&data->mbox_wq, 1);
 
 	wq_thread = k_work_queue_thread_get(&data->mbox_wq);
@@ -562,7 +601,7 @@ static int open(const struct device *instance)
 	}
 
 	data->vr.notify_cb = virtio_notify_cb;
-	data->vr.priv = (void *) conf;
+	data->vr.priv = (void *) instance;
 	data->vr.shm_device.name = instance->name;
 
 	err = ipc_static_vrings_init(&data->vr, conf->role);
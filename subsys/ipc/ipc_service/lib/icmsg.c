@@ -127,29 +127,48 @@ static void mbox_callback_process(struct k_work *item)
 	struct icmsg_data_t *dev_data = CONTAINER_OF(item, struct icmsg_data_t, mbox_work);
 
 	atomic_t state = atomic_get(&dev_data->state);
+	const char *data;
+	uint16_t part;
 
-	uint32_t len = data_available(dev_data);
+	int len = pbuf_claim(dev_data->rx_pb, &data, &part);
 
-	if (len == 0) {
+	if (len <= 0) {
 		/* Unlikely, no data in buffer. */
 		return;
 	}
 
-	uint8_t rx_buffer[len];
-
-	len = pbuf_read(dev_data->rx_pb, rx_buffer, len);
+	/* Messages are copied out of the shared memory, unless callbacks may
+	 * use it in place and the message does not wrap around.
+	 */
+	bool copy = !IS_ENABLED(CONFIG_IPC_SERVICE_ICMSG_RX_NOCOPY) || (part < len);
+	uint8_t rx_buffer[copy ? len : 1];
+
+	if (copy) {
+		memcpy(rx_buffer, data, part);
+		memcpy(&rx_buffer[part], dev_data->rx_pb->cfg->data_loc, len - part);
+		(void)pbuf_free(dev_data->rx_pb, len);
+		data = (const char *)rx_buffer;
+	}
 
 	if (state == ICMSG_STATE_READY) {
 		if (dev_data->cb->received) {
-			dev_data->cb->received(rx_buffer, len,
+			dev_data->cb->received(data, len,
 					       dev_data->ctx);
 		}
+
+		if (!copy) {
+			(void)pbuf_free(dev_data->rx_pb, len);
+		}
 	} else {
 		__ASSERT_NO_MSG(state == ICMSG_STATE_BUSY);
 
 		/* Allow magic number longer than sizeof(magic) for future protocol version. */
 		bool endpoint_invalid = (len < sizeof(magic) ||
-					memcmp(magic, rx_buffer, sizeof(magic)));
+					memcmp(magic, data, sizeof(magic)));
+
+		if (!copy) {
+			(void)pbuf_free(dev_data->rx_pb, len);
+		}
 
 		if (endpoint_invalid) {
 			__ASSERT_NO_MSG(false);
@@ -265,6 +284,7 @@ int icmsg_send(const struct icmsg_config_t *conf,
 	int write_ret;
 	int release_ret;
 	int sent_bytes;
+	bool notify = true;
 
 	if (!is_endpoint_ready(dev_data)) {
 		return -EBUSY;
@@ -280,7 +300,23 @@ int icmsg_send(const struct icmsg_config_t *conf,
 		return -ENOBUFS;
 	}
 
+#ifdef CONFIG_IPC_SERVICE_ICMSG_NOTIFY_COALESCE
+	uint32_t prev_wr_idx = dev_data->tx_pb->data.wr_idx;
+#endif
+
 	write_ret = pbuf_write(dev_data->tx_pb, msg, len);
+
+#ifdef CONFIG_IPC_SERVICE_ICMSG_NOTIFY_COALESCE
+	/* pbuf_write() publishes the write index before this reads the read
+	 * index, and the reader does the opposite before checking for more
+	 * data. If the reader did not reach the previous message yet, it is
+	 * bound to see this one too without a new notification.
+	 */
+	if (write_ret > 0) {
+		notify = (pbuf_rd_idx_get(dev_data->tx_pb) == prev_wr_idx);
+	}
+#endif
+
 	release_ret = release_tx_buffer(dev_data);
 	__ASSERT_NO_MSG(!release_ret);
 
@@ -293,6 +329,10 @@ int icmsg_send(const struct icmsg_config_t *conf,
 
 	__ASSERT_NO_MSG(conf->mbox_tx.dev != NULL);
 
+	if (!notify) {
+		return sent_bytes;
+	}
+
 	ret = mbox_send(&conf->mbox_tx, NULL);
 	if (ret) {
 		return ret;
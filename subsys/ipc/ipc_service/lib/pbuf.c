@@ -115,10 +115,10 @@ int pbuf_write(struct pbuf *pb, const char *data, uint16_t len)
 	/* Clear packet len with zeros and update. Clearing is done for possible versioning in the
 	 * future. Writing is allowed now, because shared wr_idx value is updated at the very end.
 	 */
+	uint32_t hdr_idx = wr_idx;
+
 	*((uint32_t *)(&data_loc[wr_idx])) = 0;
 	sys_put_be16(len, &data_loc[wr_idx]);
-	__sync_synchronize();
-	sys_cache_data_flush_range(&data_loc[wr_idx], PBUF_PACKET_LEN_SZ);
 
 	wr_idx = idx_wrap(blen, wr_idx + PBUF_PACKET_LEN_SZ);
 
@@ -126,7 +126,17 @@ int pbuf_write(struct pbuf *pb, const char *data, uint16_t len)
 	uint32_t tail = MIN(len, blen - wr_idx);
 
 	memcpy(&data_loc[wr_idx], data, tail);
-	sys_cache_data_flush_range(&data_loc[wr_idx], tail);
+	__sync_synchronize();
+
+	/* The header is followed by the data unless it ends the buffer, one
+	 * flush then covers both.
+	 */
+	if (wr_idx == 0) {
+		sys_cache_data_flush_range(&data_loc[hdr_idx], PBUF_PACKET_LEN_SZ);
+		sys_cache_data_flush_range(&data_loc[0], tail);
+	} else {
+		sys_cache_data_flush_range(&data_loc[hdr_idx], PBUF_PACKET_LEN_SZ + tail);
+	}
 
 	if (len > tail) {
 		/* Copy remaining data to buffer front. */
@@ -144,13 +154,11 @@ int pbuf_write(struct pbuf *pb, const char *data, uint16_t len)
 	return len;
 }
 
-int pbuf_read(struct pbuf *pb, char *buf, uint16_t len)
+/* Get the length of the next packet and the index of its data. Returns 0 if
+ * the buffer is empty.
+ */
+static int rx_packet(struct pbuf *pb, uint32_t *data_idx)
 {
-	if (pb == NULL) {
-		/* Incorrect call. */
-		return -EINVAL;
-	}
-
 	/* Invalidate wr_idx only, local rd_idx is used to increase buffer security. */
 	sys_cache_data_invd_range((void *)(pb->cfg->wr_idx_loc), sizeof(*(pb->cfg->wr_idx_loc)));
 	__sync_synchronize();
@@ -178,14 +186,6 @@ int pbuf_read(struct pbuf *pb, char *buf, uint16_t len)
 	sys_cache_data_invd_range(&data_loc[rd_idx], PBUF_PACKET_LEN_SZ);
 	uint16_t plen = sys_get_be16(&data_loc[rd_idx]);
 
-	if (!buf) {
-		return (int)plen;
-	}
-
-	if (plen > len) {
-		return -ENOMEM;
-	}
-
 	uint32_t occupied_space = idx_occupied(blen, wr_idx, rd_idx);
 
 	if (occupied_space < plen + PBUF_PACKET_LEN_SZ) {
@@ -193,31 +193,142 @@ int pbuf_read(struct pbuf *pb, char *buf, uint16_t len)
 		return -EAGAIN;
 	}
 
-	rd_idx = idx_wrap(blen, rd_idx + PBUF_PACKET_LEN_SZ);
+	*data_idx = idx_wrap(blen, rd_idx + PBUF_PACKET_LEN_SZ);
 
-	/* Packet will fit into provided buffer, truncate len if provided len
-	 * is bigger than necessary.
-	 */
-	len = MIN(plen, len);
+	return plen;
+}
 
-	/* Read until end of the buffer, if data are wrapped. */
-	uint32_t tail = MIN(blen - rd_idx, len);
+/* Invalidate the data of the packet whose header was just read. The lines
+ * holding the header were fetched after the writer published the packet, so
+ * only the data beyond them needs to be invalidated.
+ */
+static void rx_invd(struct pbuf *pb, uint32_t data_idx, uint32_t len)
+{
+	uint8_t *const data_loc = pb->cfg->data_loc;
+	const uint32_t blen = pb->cfg->len;
+	size_t line = sys_cache_data_line_size_get();
+	uint32_t tail = MIN(blen - data_idx, len);
+	uint32_t skip = 0;
+
+	if ((data_idx != 0) && (line > 0)) {
+		uintptr_t hdr_end = (uintptr_t)&data_loc[data_idx];
+
+		skip = MIN(ROUND_UP(hdr_end, line) - hdr_end, tail);
+	}
 
-	sys_cache_data_invd_range(&data_loc[rd_idx], tail);
-	memcpy(buf, &data_loc[rd_idx], tail);
+	if (tail > skip) {
+		sys_cache_data_invd_range(&data_loc[data_idx + skip], tail - skip);
+	}
 
 	if (len > tail) {
 		sys_cache_data_invd_range(&data_loc[0], len - tail);
-		memcpy(&buf[tail], &pb->cfg->data_loc[0], len - tail);
 	}
+}
 
+static void rx_free(struct pbuf *pb, uint32_t data_idx, uint32_t len)
+{
 	/* Update rd_idx. */
-	rd_idx = idx_wrap(blen, ROUND_UP(rd_idx + len, _PBUF_IDX_SIZE));
+	uint32_t rd_idx = idx_wrap(pb->cfg->len, ROUND_UP(data_idx + len, _PBUF_IDX_SIZE));
 
 	pb->data.rd_idx = rd_idx;
 	*(pb->cfg->rd_idx_loc) = rd_idx;
 	__sync_synchronize();
 	sys_cache_data_flush_range((void *)pb->cfg->rd_idx_loc, sizeof(*(pb->cfg->rd_idx_loc)));
+}
+
+int pbuf_read(struct pbuf *pb, char *buf, uint16_t len)
+{
+	uint32_t data_idx;
+	int plen;
+
+	if (pb == NULL) {
+		/* Incorrect call. */
+		return -EINVAL;
+	}
+
+	plen = rx_packet(pb, &data_idx);
+	if ((plen <= 0) || !buf) {
+		return plen;
+	}
+
+	if (plen > len) {
+		return -ENOMEM;
+	}
+
+	/* Packet will fit into provided buffer, truncate len if provided len
+	 * is bigger than necessary.
+	 */
+	len = plen;
+
+	/* Read until end of the buffer, if data are wrapped. */
+	uint32_t tail = MIN(pb->cfg->len - data_idx, len);
+
+	rx_invd(pb, data_idx, len);
+	memcpy(buf, &pb->cfg->data_loc[data_idx], tail);
+
+	if (len > tail) {
+		memcpy(&buf[tail], &pb->cfg->data_loc[0], len - tail);
+	}
+
+	rx_free(pb, data_idx, len);
 
 	return len;
 }
+
+int pbuf_claim(struct pbuf *pb, const char **buf, uint16_t *len)
+{
+	uint32_t data_idx;
+	int plen;
+
+	if (pb == NULL || buf == NULL || len == NULL) {
+		/* Incorrect call. */
+		return -EINVAL;
+	}
+
+	plen = rx_packet(pb, &data_idx);
+	if (plen <= 0) {
+		return plen;
+	}
+
+	rx_invd(pb, data_idx, plen);
+
+	*buf = (const char *)&pb->cfg->data_loc[data_idx];
+	*len = MIN(pb->cfg->len - data_idx, plen);
+
+	return plen;
+}
+
+int pbuf_free(struct pbuf *pb, uint16_t len)
+{
+	uint32_t data_idx;
+	int plen;
+
+	if (pb == NULL) {
+		/* Incorrect call. */
+		return -EINVAL;
+	}
+
+	if (*(pb->cfg->wr_idx_loc) == pb->data.rd_idx) {
+		/* Nothing was claimed. */
+		return -EINVAL;
+	}
+
+	/* The claimed packet is still cached, check it is the one given. */
+	data_idx = idx_wrap(pb->cfg->len, pb->data.rd_idx + PBUF_PACKET_LEN_SZ);
+	plen = sys_get_be16(&pb->cfg->data_loc[pb->data.rd_idx]);
+	if ((len == 0) || (plen != len)) {
+		return -EINVAL;
+	}
+
+	rx_free(pb, data_idx, len);
+
+	return 0;
+}
+
+uint32_t pbuf_rd_idx_get(struct pbuf *pb)
+{
+	sys_cache_data_invd_range((void *)(pb->cfg->rd_idx_loc), sizeof(*(pb->cfg->rd_idx_loc)));
+	__sync_synchronize();
+
+	return *(pb->cfg->rd_idx_loc);
+}
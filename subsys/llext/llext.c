@@ -107,21 +107,130 @@ int llext_iterate(int (*fn)(struct llext *ext, void *arg), void *arg)
 	return ret;
 }
 
-const void * const llext_find_sym(const struct llext_symtable *sym_table, const char *sym_name)
+/*
+ * The linker sorts the built-in symbols by the names of their sections,
+ * which end with the symbol name followed by "_sym_". Compare two names the
+ * same way.
+ */
+static int llext_const_sym_cmp(const char *a, const char *b)
 {
-	if (sym_table == NULL) {
-		/* Built-in symbol table */
+	static const char suffix[] = "_sym_";
+	size_t len_a = strlen(a);
+	size_t len_b = strlen(b);
+	unsigned char ca, cb;
+
+	for (size_t i = 0; ; i++) {
+		ca = (i < len_a) ? a[i] : suffix[i - len_a];
+		cb = (i < len_b) ? b[i] : suffix[i - len_b];
+		if ((ca != cb) || (ca == '\0')) {
+			return ca - cb;
+		}
+	}
+}
+
+/*
+ * Not every linker sorts the iterable sections, so check the order once
+ * before relying on it.
+ */
+static bool llext_const_syms_sorted(void)
+{
+	static int sorted = -1;
+
+	if (sorted < 0) {
+		const struct llext_const_symbol *prev = NULL;
+
+		sorted = 1;
+		STRUCT_SECTION_FOREACH(llext_const_symbol, sym) {
+			if ((prev != NULL) && (llext_const_sym_cmp(prev->name, sym->name) >= 0)) {
+				LOG_WRN("Built-in symbols are not sorted, using linear lookups");
+				sorted = 0;
+				break;
+			}
+			prev = sym;
+		}
+	}
+
+	return sorted == 1;
+}
+
+static const void *llext_find_const_sym(const char *sym_name)
+{
+	const struct llext_const_symbol *syms;
+	size_t lo = 0;
+	size_t hi;
+	size_t mid;
+	int cmp;
+
+	if (!llext_const_syms_sorted()) {
 		STRUCT_SECTION_FOREACH(llext_const_symbol, sym) {
 			if (strcmp(sym->name, sym_name) == 0) {
 				return sym->addr;
 			}
 		}
-	} else {
-		/* find symbols in module */
-		for (size_t i = 0; i < sym_table->sym_cnt; i++) {
-			if (strcmp(sym_table->syms[i].name, sym_name) == 0) {
-				return sym_table->syms[i].addr;
+
+		return NULL;
+	}
+
+	STRUCT_SECTION_GET(llext_const_symbol, 0, &syms);
+	STRUCT_SECTION_COUNT(llext_const_symbol, &hi);
+
+	while (lo < hi) {
+		mid = lo + (hi - lo) / 2;
+		cmp = llext_const_sym_cmp(syms[mid].name, sym_name);
+		if (cmp == 0) {
+			return syms[mid].addr;
+		} else if (cmp < 0) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	return NULL;
+}
+
+/* Sort a table of an extension by name for llext_find_sym() */
+static void llext_sort_symtab(struct llext_symtable *sym_tab)
+{
+	struct llext_symbol tmp;
+	size_t gap, i, j;
+
+	/* Shell sort: in place and at most a few hundred entries */
+	for (gap = sym_tab->sym_cnt / 2; gap > 0; gap /= 2) {
+		for (i = gap; i < sym_tab->sym_cnt; i++) {
+			tmp = sym_tab->syms[i];
+			for (j = i; (j >= gap) &&
+				    (strcmp(sym_tab->syms[j - gap].name, tmp.name) > 0); j -= gap) {
+				sym_tab->syms[j] = sym_tab->syms[j - gap];
 			}
+			sym_tab->syms[j] = tmp;
+		}
+	}
+}
+
+const void * const llext_find_sym(const struct llext_symtable *sym_table, const char *sym_name)
+{
+	size_t lo = 0;
+	size_t hi;
+	size_t mid;
+	int cmp;
+
+	if (sym_table == NULL) {
+		/* Built-in symbol table */
+		return llext_find_const_sym(sym_name);
+	}
+
+	/* find symbols in module, its tables are sorted by name */
+	hi = sym_table->sym_cnt;
+	while (lo < hi) {
+		mid = lo + (hi - lo) / 2;
+		cmp = strcmp(sym_table->syms[mid].name, sym_name);
+		if (cmp == 0) {
+			return sym_table->syms[mid].addr;
+		} else if (cmp < 0) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
 		}
 	}
 
@@ -290,6 +399,35 @@ static void llext_init_mem_part(struct llext *ext, enum llext_mem mem_idx,
 #endif
 }
 
+/*
+ * With CONFIG_LLEXT_STORAGE_XIP, read-only sections are used in place unless
+ * relocations still have to be applied to them.
+ */
+static bool llext_xip_section(struct llext_loader *ldr, enum llext_mem mem_idx)
+{
+	const char *rel, *rela;
+
+	if (!IS_ENABLED(CONFIG_LLEXT_STORAGE_XIP)) {
+		return false;
+	}
+
+	switch (mem_idx) {
+	case LLEXT_MEM_TEXT:
+		rel = ".rel.text";
+		rela = ".rela.text";
+		break;
+	case LLEXT_MEM_RODATA:
+		rel = ".rel.rodata";
+		rela = ".rela.rodata";
+		break;
+	default:
+		return false;
+	}
+
+	return llext_find_section(ldr, rel) == -ENOENT &&
+	       llext_find_section(ldr, rela) == -ENOENT;
+}
+
 static int llext_copy_section(struct llext_loader *ldr, struct llext *ext,
 			      enum llext_mem mem_idx)
 {
@@ -301,7 +439,7 @@ static int llext_copy_section(struct llext_loader *ldr, struct llext *ext,
 	ext->mem_size[mem_idx] = ldr->sects[mem_idx].sh_size;
 
 	if (ldr->sects[mem_idx].sh_type != SHT_NOBITS &&
-	    IS_ENABLED(CONFIG_LLEXT_STORAGE_WRITABLE)) {
+	    (IS_ENABLED(CONFIG_LLEXT_STORAGE_WRITABLE) || llext_xip_section(ldr, mem_idx))) {
 		ext->mem[mem_idx] = llext_peek(ldr, ldr->sects[mem_idx].sh_offset);
 		if (ext->mem[mem_idx]) {
 			llext_init_mem_part(ext, mem_idx, (uintptr_t)ext->mem[mem_idx],
@@ -484,6 +622,8 @@ static int llext_export_symbols(struct llext_loader *ldr, struct llext *ext)
 		LOG_DBG("sym %p name %s in %p", sym->addr, sym->name, exp_tab->syms + i);
 	}
 
+	llext_sort_symtab(exp_tab);
+
 	return 0;
 }
 
@@ -536,6 +676,8 @@ static int llext_copy_symbols(struct llext_loader *ldr, struct llext *ext)
 		}
 	}
 
+	llext_sort_symtab(sym_tab);
+
 	return 0;
 }
 
@@ -58,4 +58,59 @@ config LOG_BACKEND_FS_FILES_LIMIT
 	  Limit of number of files with logs. It is also limited by
 	  size of file system partition.
 
+config LOG_BACKEND_FS_ROTATE_INTERVAL
+	int "Log file rotation interval (in seconds)"
+	default 0
+	help
+	  When the current log file has been used for longer than this
+	  interval, the next message is written to a new log file.
+	  0 disables time based rotation, files are then rotated only
+	  when they reach LOG_BACKEND_FS_FILE_SIZE.
+
+config LOG_BACKEND_FS_BUFFERED
+	bool "Buffered writes"
+	help
+	  When enabled, log output is collected in a write buffer and written
+	  to the file by a dedicated thread in whole blocks, with a single
+	  file sync per flush. Otherwise, each message is written and synced
+	  separately. This reduces the number of flash writes and the time
+	  spent in the logging thread. Buffered data that is not yet written
+	  is lost on reset, unless it happens through a panic.
+
+if LOG_BACKEND_FS_BUFFERED
+
+config LOG_BACKEND_FS_BLOCK_SIZE
+	int "Write block size"
+	default 512
+	help
+	  Size of the blocks in which buffered data is written. It should
+	  match the program or cache size of the file system, for example
+	  the cache size of littlefs or the sector size of FAT.
+	  LOG_BACKEND_FS_FILE_SIZE should be a multiple of it.
+
+config LOG_BACKEND_FS_BUFFER_SIZE
+	int "Write buffer size"
+	default 2048
+	help
+	  Size of the write buffer (in bytes). Must be a multiple of
+	  LOG_BACKEND_FS_BLOCK_SIZE. When the buffer is full, logging waits
+	  for the flush thread for up to LOG_BACKEND_FS_FLUSH_TIMEOUT_MS
+	  and then drops the output.
+
+config LOG_BACKEND_FS_FLUSH_TIMEOUT_MS
+	int "Flush timeout (in milliseconds)"
+	default 1000
+	help
+	  Buffered data which does not fill a whole block is written after
+	  this timeout.
+
+config LOG_BACKEND_FS_THREAD_STACK_SIZE
+	int "Flush thread stack size"
+	default 2048
+	help
+	  Stack size of the thread which writes the buffered data to the
+	  file system.
+
+endif # LOG_BACKEND_FS_BUFFERED
+
 endif # LOG_BACKEND_FS
@@ -6,6 +6,8 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/ring_buffer.h>
 #include <zephyr/logging/log_backend.h>
 #include <zephyr/logging/log_output_dict.h>
 #include <zephyr/logging/log_backend_std.h>
@@ -27,6 +29,7 @@ enum backend_fs_state {
 static struct fs_file_t fs_file;
 static enum backend_fs_state backend_state = BACKEND_FS_NOT_INITIALIZED;
 static int file_ctr, newest, oldest;
+static int64_t file_opened;
 
 static int allocate_new_file(struct fs_file_t *file);
 static int del_oldest_log(void);
@@ -146,7 +149,17 @@ close_dir:
 	return rc;
 }
 
-int write_log_to_file(uint8_t *data, size_t length, void *ctx)
+/* Check if the current log file is open for longer than the rotation
+ * interval.
+ */
+static bool log_file_expired(void)
+{
+	return (CONFIG_LOG_BACKEND_FS_ROTATE_INTERVAL > 0) &&
+	       ((k_uptime_get() - file_opened) >=
+		(int64_t)CONFIG_LOG_BACKEND_FS_ROTATE_INTERVAL * MSEC_PER_SEC);
+}
+
+static int file_write(const uint8_t *data, size_t length, bool sync)
 {
 	int rc;
 	struct fs_file_t *f = &fs_file;
@@ -164,8 +177,8 @@ int write_log_to_file(uint8_t *data, size_t length, void *ctx)
 
 	if (backend_state == BACKEND_FS_OK) {
 
-		/* Check if new data overwrites max file size.
-		 * If so, create new log file.
+		/* Check if new data overwrites max file size or the file
+		 * is due for rotation. If so, create new log file.
 		 */
 		int size = fs_tell(f);
 
@@ -173,7 +186,8 @@ int write_log_to_file(uint8_t *data, size_t length, void *ctx)
 			backend_state = BACKEND_FS_CORRUPTED;
 
 			return length;
-		} else if ((size + length) > CONFIG_LOG_BACKEND_FS_FILE_SIZE) {
+		} else if (((size + length) > CONFIG_LOG_BACKEND_FS_FILE_SIZE) ||
+			   ((size > 0) && log_file_expired())) {
 			rc = allocate_new_file(f);
 
 			if (rc < 0) {
@@ -211,10 +225,12 @@ int write_log_to_file(uint8_t *data, size_t length, void *ctx)
 			length = 0;
 		}
 
-		rc = fs_sync(f);
-		if (rc < 0) {
-			/* Something is wrong */
-			goto on_error;
+		if (sync) {
+			rc = fs_sync(f);
+			if (rc < 0) {
+				/* Something is wrong */
+				goto on_error;
+			}
 		}
 	}
 
@@ -225,6 +241,11 @@ on_error:
 	return length;
 }
 
+int write_log_to_file(uint8_t *data, size_t length, void *ctx)
+{
+	return file_write(data, length, true);
+}
+
 static int get_log_file_id(struct fs_dirent *ent)
 {
 	size_t len;
@@ -355,6 +376,7 @@ static int allocate_new_file(struct fs_file_t *file)
 			if (file_ctr == 0) {
 				++file_ctr;
 			}
+			file_opened = k_uptime_get();
 			backend_state = BACKEND_FS_OK;
 			goto out;
 		} else {
@@ -412,6 +434,7 @@ static int allocate_new_file(struct fs_file_t *file)
 	}
 	++file_ctr;
 	newest = curr_file_num;
+	file_opened = k_uptime_get();
 
 out:
 	return rc;
@@ -451,15 +474,173 @@ BUILD_ASSERT(!IS_ENABLED(CONFIG_LOG_MODE_IMMEDIATE),
 
 #ifndef CONFIG_LOG_BACKEND_FS_TESTSUITE
 
+#if defined(CONFIG_LOG_BACKEND_FS_BUFFERED)
+#define BLOCK_SIZE CONFIG_LOG_BACKEND_FS_BLOCK_SIZE
+#define FLUSH_TIMEOUT K_MSEC(CONFIG_LOG_BACKEND_FS_FLUSH_TIMEOUT_MS)
+
+BUILD_ASSERT((CONFIG_LOG_BACKEND_FS_BUFFER_SIZE % BLOCK_SIZE) == 0,
+	     "Write buffer size must be a multiple of the block size.");
+
+RING_BUF_DECLARE(wbuf, CONFIG_LOG_BACKEND_FS_BUFFER_SIZE);
+static struct k_spinlock wbuf_lock;
+static K_SEM_DEFINE(wbuf_data, 0, 1);
+static K_SEM_DEFINE(wbuf_space, 0, 1);
+static atomic_t wbuf_busy;
+static bool wbuf_panic;
+
+static K_KERNEL_STACK_DEFINE(flush_stack, CONFIG_LOG_BACKEND_FS_THREAD_STACK_SIZE);
+static struct k_thread flush_thread;
+
+/* Get the number of buffered bytes to write to the file now. Unless all
+ * data is requested, only whole blocks are written so that writes stay
+ * aligned to the blocks of the file. The end of the file is aligned as well
+ * if the file size is a multiple of the block size.
+ */
+static uint32_t wbuf_flush_len(bool all)
+{
+	k_spinlock_key_t key = k_spin_lock(&wbuf_lock);
+	uint32_t len = ring_buf_size_get(&wbuf);
+	uint32_t pos = 0;
+	uint32_t room;
+
+	k_spin_unlock(&wbuf_lock, key);
+
+	if (backend_state == BACKEND_FS_OK && !log_file_expired()) {
+		off_t size = fs_tell(&fs_file);
+
+		pos = (size > 0) ? size : 0;
+	}
+
+	room = CONFIG_LOG_BACKEND_FS_FILE_SIZE - MIN(pos, CONFIG_LOG_BACKEND_FS_FILE_SIZE);
+	if (room == 0) {
+		/* Data goes to the next file */
+		pos = 0;
+		room = CONFIG_LOG_BACKEND_FS_FILE_SIZE;
+	}
+
+	if (len >= room) {
+		return room;
+	}
+
+	if (!all) {
+		uint32_t end = ROUND_DOWN(pos + len, BLOCK_SIZE);
+
+		len = (end > pos) ? (end - pos) : 0;
+	}
+
+	return len;
+}
+
+static void wbuf_flush(bool all)
+{
+	bool written = false;
+	uint32_t len;
+
+	while ((len = wbuf_flush_len(all)) > 0) {
+		k_spinlock_key_t key;
+		uint8_t *data;
+		int rc;
+
+		key = k_spin_lock(&wbuf_lock);
+		len = ring_buf_get_claim(&wbuf, &data, len);
+		k_spin_unlock(&wbuf_lock, key);
+
+		rc = file_write(data, len, false);
+
+		key = k_spin_lock(&wbuf_lock);
+		(void)ring_buf_get_finish(&wbuf, rc);
+		k_spin_unlock(&wbuf_lock, key);
+
+		k_sem_give(&wbuf_space);
+		written = true;
+	}
+
+	if (written && backend_state == BACKEND_FS_OK) {
+		if (fs_sync(&fs_file) < 0) {
+			backend_state = BACKEND_FS_CORRUPTED;
+		}
+	}
+}
+
+static void flush_thread_func(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		k_timeout_t timeout = ring_buf_is_empty(&wbuf) ? K_FOREVER : FLUSH_TIMEOUT;
+		int rc = k_sem_take(&wbuf_data, timeout);
+
+		atomic_set(&wbuf_busy, 1);
+		/* On timeout, write out the partial block as well */
+		wbuf_flush(rc != 0);
+		atomic_set(&wbuf_busy, 0);
+	}
+}
+
+static int buffered_out(uint8_t *data, size_t length, void *ctx)
+{
+	k_spinlock_key_t key;
+	uint32_t used;
+	uint32_t put;
+	bool was_empty;
+
+	if (wbuf_panic) {
+		return write_log_to_file(data, length, ctx);
+	}
+
+	key = k_spin_lock(&wbuf_lock);
+	was_empty = ring_buf_is_empty(&wbuf);
+	put = ring_buf_put(&wbuf, data, length);
+	used = ring_buf_size_get(&wbuf);
+	k_spin_unlock(&wbuf_lock, key);
+
+	/* Wake up the flush thread to start the flush timeout or to write out
+	 * the complete blocks.
+	 */
+	if (was_empty || used >= BLOCK_SIZE) {
+		k_sem_give(&wbuf_data);
+	}
+
+	if ((put == 0) && (k_sem_take(&wbuf_space, FLUSH_TIMEOUT) != 0)) {
+		/* Drop the data rather than block logging for longer */
+		return length;
+	}
+
+	return put;
+}
+
+#define LOG_FS_OUTPUT_FUNC buffered_out
+#else
+#define LOG_FS_OUTPUT_FUNC write_log_to_file
+#endif /* CONFIG_LOG_BACKEND_FS_BUFFERED */
+
 static uint8_t __aligned(4) buf[MAX_FLASH_WRITE_SIZE];
-LOG_OUTPUT_DEFINE(log_output, write_log_to_file, buf, MAX_FLASH_WRITE_SIZE);
+LOG_OUTPUT_DEFINE(log_output, LOG_FS_OUTPUT_FUNC, buf, MAX_FLASH_WRITE_SIZE);
 
 static void log_backend_fs_init(const struct log_backend *const backend)
 {
+#if defined(CONFIG_LOG_BACKEND_FS_BUFFERED)
+	k_thread_create(&flush_thread, flush_stack, K_KERNEL_STACK_SIZEOF(flush_stack),
+			flush_thread_func, NULL, NULL, NULL,
+			K_LOWEST_APPLICATION_THREAD_PRIO, 0, K_NO_WAIT);
+	k_thread_name_set(&flush_thread, "log_fs_flush");
+#endif
 }
 
 static void panic(struct log_backend const *const backend)
 {
+#if defined(CONFIG_LOG_BACKEND_FS_BUFFERED)
+	/* Write out the buffered data and continue with synchronous writes
+	 * unless the flush thread was interrupted in the middle of a write.
+	 */
+	if (!atomic_get(&wbuf_busy)) {
+		wbuf_flush(true);
+		wbuf_panic = true;
+		return;
+	}
+#endif
 	/* In case of panic deinitialize backend. It is better to keep
 	 * current data rather than log new and risk of failure.
 	 */
@@ -12,6 +12,7 @@ LOG_MODULE_REGISTER(log_backend_net, CONFIG_LOG_DEFAULT_LEVEL);
 #include <zephyr/logging/log_output.h>
 #include <zephyr/logging/log_backend_net.h>
 #include <zephyr/net/socket.h>
+#include <zephyr/net/tls_credentials.h>
 
 /* Set this to 1 if you want to see what is being sent to server */
 #define DEBUG_PRINTING 0
@@ -28,6 +29,30 @@ LOG_MODULE_REGISTER(log_backend_net, CONFIG_LOG_DEFAULT_LEVEL);
 #define MAX_HOSTNAME_LEN NET_IPV4_ADDR_LEN
 #endif
 
+#if defined(CONFIG_LOG_BACKEND_NET_USE_TLS)
+#define SYSLOG_PORT 6514
+#define SYSLOG_PROTO IPPROTO_TLS_1_2
+#elif defined(CONFIG_LOG_BACKEND_NET_USE_TCP)
+#define SYSLOG_PORT 601
+#define SYSLOG_PROTO IPPROTO_TCP
+#else
+#define SYSLOG_PORT 514
+#define SYSLOG_PROTO IPPROTO_UDP
+#endif
+
+#if defined(CONFIG_LOG_BACKEND_NET_STREAM)
+/* Room for the RFC 6587 octet count and the space following it */
+#define FRAME_HDR_LEN sizeof(STRINGIFY(CONFIG_LOG_BACKEND_NET_MAX_BUF_SIZE))
+#else
+#define FRAME_HDR_LEN 0
+#endif
+
+#if defined(CONFIG_LOG_BACKEND_NET_STREAM) || defined(CONFIG_LOG_BACKEND_NET_BATCH)
+#define MSG_BUFFERED 1
+#else
+#define MSG_BUFFERED 0
+#endif
+
 static char dev_hostname[MAX_HOSTNAME_LEN + 1];
 
 static uint8_t output_buf[CONFIG_LOG_BACKEND_NET_MAX_BUF_SIZE];
@@ -38,12 +63,134 @@ static uint32_t log_format_current = CONFIG_LOG_BACKEND_NET_OUTPUT_DEFAULT;
 
 static struct log_backend_net_ctx {
 	int sock;
+#if MSG_BUFFERED
+	/* Message being formatted, after room for the frame header */
+	uint8_t msg_buf[FRAME_HDR_LEN + CONFIG_LOG_BACKEND_NET_MAX_BUF_SIZE];
+	size_t msg_len;
+#endif
+#if defined(CONFIG_LOG_BACKEND_NET_BATCH)
+	struct k_mutex lock;
+	struct k_work_delayable flush_work;
+	uint8_t batch_buf[CONFIG_LOG_BACKEND_NET_BATCH_SIZE];
+	size_t batch_len;
+#endif
 } ctx = {
 	.sock = -1,
 };
 
 const struct log_backend *log_backend_net_get(void);
 
+static void net_reset(struct log_backend_net_ctx *ctx)
+{
+	(void)zsock_close(ctx->sock);
+	ctx->sock = -1;
+	net_init_done = false;
+}
+
+static int sock_send(struct log_backend_net_ctx *ctx, const uint8_t *data, size_t len)
+{
+	ssize_t ret;
+
+	if (!IS_ENABLED(CONFIG_LOG_BACKEND_NET_STREAM)) {
+		ret = zsock_send(ctx->sock, data, len, ZSOCK_MSG_DONTWAIT);
+
+		return ret < 0 ? -errno : 0;
+	}
+
+	/* Partial writes would break the framing, send everything */
+	while (len > 0) {
+		ret = zsock_send(ctx->sock, data, len, 0);
+		if (ret < 0) {
+			ret = -errno;
+			DBG("Connection lost (%d)\n", (int)ret);
+
+			/* Reconnect when the next message is processed */
+			net_reset(ctx);
+			return ret;
+		}
+
+		data += ret;
+		len -= ret;
+	}
+
+	return 0;
+}
+
+#if defined(CONFIG_LOG_BACKEND_NET_BATCH)
+static void batch_flush(struct log_backend_net_ctx *ctx)
+{
+	if (ctx->batch_len > 0 && ctx->sock >= 0) {
+		(void)sock_send(ctx, ctx->batch_buf, ctx->batch_len);
+	}
+
+	ctx->batch_len = 0;
+}
+
+static void batch_flush_work(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct log_backend_net_ctx *ctx = CONTAINER_OF(dwork, struct log_backend_net_ctx,
+						       flush_work);
+
+	k_mutex_lock(&ctx->lock, K_FOREVER);
+	batch_flush(ctx);
+	k_mutex_unlock(&ctx->lock);
+}
+
+static void batch_add(struct log_backend_net_ctx *ctx, const uint8_t *data, size_t len)
+{
+	k_mutex_lock(&ctx->lock, K_FOREVER);
+
+	if (len > sizeof(ctx->batch_buf) - ctx->batch_len) {
+		batch_flush(ctx);
+	}
+
+	if (len > sizeof(ctx->batch_buf)) {
+		(void)sock_send(ctx, data, len);
+	} else {
+		if (ctx->batch_len == 0) {
+			(void)k_work_schedule(&ctx->flush_work,
+					      K_MSEC(CONFIG_LOG_BACKEND_NET_BATCH_TIMEOUT_MS));
+		}
+
+		memcpy(&ctx->batch_buf[ctx->batch_len], data, len);
+		ctx->batch_len += len;
+	}
+
+	k_mutex_unlock(&ctx->lock);
+}
+#endif /* CONFIG_LOG_BACKEND_NET_BATCH */
+
+#if MSG_BUFFERED
+/* Frame the formatted message and send it or add it to the batch. */
+static void msg_done(struct log_backend_net_ctx *ctx)
+{
+	uint8_t *frame = &ctx->msg_buf[FRAME_HDR_LEN];
+	size_t len = ctx->msg_len;
+
+	if (len == 0) {
+		return;
+	}
+
+	ctx->msg_len = 0;
+
+	if (IS_ENABLED(CONFIG_LOG_BACKEND_NET_STREAM)) {
+		char hdr[FRAME_HDR_LEN + 1];
+		int hdr_len = snprintk(hdr, sizeof(hdr), "%u ", (unsigned int)len);
+
+		frame -= hdr_len;
+		memcpy(frame, hdr, hdr_len);
+		len += hdr_len;
+	}
+
+#if defined(CONFIG_LOG_BACKEND_NET_BATCH)
+	batch_add(ctx, frame, len);
+#else
+	(void)sock_send(ctx, frame, len);
+#endif
+}
+#endif /* MSG_BUFFERED */
+
 static int line_out(uint8_t *data, size_t length, void *output_ctx)
 {
 	struct log_backend_net_ctx *ctx = (struct log_backend_net_ctx *)output_ctx;
@@ -53,6 +200,14 @@ static int line_out(uint8_t *data, size_t length, void *output_ctx)
 		return length;
 	}
 
+#if MSG_BUFFERED
+	/* The message is sent once complete, longer messages are truncated */
+	size_t len = MIN(length, sizeof(ctx->msg_buf) - FRAME_HDR_LEN - ctx->msg_len);
+
+	memcpy(&ctx->msg_buf[FRAME_HDR_LEN + ctx->msg_len], data, len);
+	ctx->msg_len += len;
+	ARG_UNUSED(ret);
+#else
 	ret = zsock_send(ctx->sock, data, length, ZSOCK_MSG_DONTWAIT);
 	if (ret < 0) {
 		goto fail;
@@ -60,6 +215,7 @@ static int line_out(uint8_t *data, size_t length, void *output_ctx)
 
 	DBG(data);
 fail:
+#endif
 	return length;
 }
 
@@ -92,7 +248,9 @@ static int do_net_init(struct log_backend_net_ctx *ctx)
 
 	local_addr->sa_family = server_addr.sa_family;
 
-	ret = zsock_socket(server_addr.sa_family, SOCK_DGRAM, IPPROTO_UDP);
+	ret = zsock_socket(server_addr.sa_family,
+			   IS_ENABLED(CONFIG_LOG_BACKEND_NET_STREAM) ? SOCK_STREAM : SOCK_DGRAM,
+			   SYSLOG_PROTO);
 	if (ret < 0) {
 		ret = -errno;
 		DBG("Cannot get socket (%d)\n", ret);
@@ -101,6 +259,28 @@ static int do_net_init(struct log_backend_net_ctx *ctx)
 
 	ctx->sock = ret;
 
+#if defined(CONFIG_LOG_BACKEND_NET_USE_TLS)
+	sec_tag_t sec_tag = CONFIG_LOG_BACKEND_NET_TLS_SEC_TAG;
+
+	ret = zsock_setsockopt(ctx->sock, SOL_TLS, TLS_SEC_TAG_LIST, &sec_tag, sizeof(sec_tag));
+	if (ret < 0) {
+		ret = -errno;
+		DBG("Cannot set TLS credentials (%d)\n", ret);
+		goto err;
+	}
+
+	if (strlen(CONFIG_LOG_BACKEND_NET_TLS_HOSTNAME) > 0) {
+		ret = zsock_setsockopt(ctx->sock, SOL_TLS, TLS_HOSTNAME,
+				       CONFIG_LOG_BACKEND_NET_TLS_HOSTNAME,
+				       strlen(CONFIG_LOG_BACKEND_NET_TLS_HOSTNAME));
+		if (ret < 0) {
+			ret = -errno;
+			DBG("Cannot set TLS hostname (%d)\n", ret);
+			goto err;
+		}
+	}
+#endif
+
 	if (IS_ENABLED(CONFIG_NET_HOSTNAME_ENABLE)) {
 		(void)strncpy(dev_hostname, net_hostname_get(), MAX_HOSTNAME_LEN);
 
@@ -177,6 +357,11 @@ static void process(const struct log_backend *const backend,
 		return;
 	}
 
+#if defined(CONFIG_LOG_BACKEND_NET_BATCH)
+	/* Keep the flush work from using the socket while it is set up */
+	k_mutex_lock(&ctx.lock, K_FOREVER);
+#endif
+
 	if (!net_init_done && do_net_init(&ctx) == 0) {
 		net_init_done = true;
 	}
@@ -184,6 +369,13 @@ static void process(const struct log_backend *const backend,
 	log_format_func_t log_output_func = log_format_func_t_get(log_format_current);
 
 	log_output_func(&log_output_net, &msg->log, flags);
+
+#if MSG_BUFFERED
+	msg_done(&ctx);
+#endif
+#if defined(CONFIG_LOG_BACKEND_NET_BATCH)
+	k_mutex_unlock(&ctx.lock);
+#endif
 }
 
 static int format_set(const struct log_backend *const backend, uint32_t log_type)
@@ -203,6 +395,12 @@ bool log_backend_net_set_addr(const char *addr)
 		struct log_backend_net_ctx *ctx = log_output_net.control_block->ctx;
 		int released;
 
+#if defined(CONFIG_LOG_BACKEND_NET_BATCH)
+		k_mutex_lock(&ctx->lock, K_FOREVER);
+		batch_flush(ctx);
+		k_mutex_unlock(&ctx->lock);
+#endif
+
 		released = zsock_close(ctx->sock);
 		if (released < 0) {
 			LOG_ERR("Cannot release socket (%d)", ret);
@@ -222,7 +420,7 @@ bool log_backend_net_set_addr(const char *addr)
 		}
 	}
 
-	net_sin(&server_addr)->sin_port = htons(514);
+	net_sin(&server_addr)->sin_port = htons(SYSLOG_PORT);
 
 	ret = net_ipaddr_parse(addr, strlen(addr), &server_addr);
 	if (!ret) {
@@ -245,6 +443,11 @@ static void init_net(struct log_backend const *const backend)
 {
 	ARG_UNUSED(backend);
 
+#if defined(CONFIG_LOG_BACKEND_NET_BATCH)
+	k_mutex_init(&ctx.lock);
+	k_work_init_delayable(&ctx.flush_work, batch_flush_work);
+#endif
+
 	if (strlen(CONFIG_LOG_BACKEND_NET_SERVER) != 0) {
 		bool ret = log_backend_net_set_addr(CONFIG_LOG_BACKEND_NET_SERVER);
 
@@ -17,6 +17,8 @@
 #include <zephyr/sys/__assert.h>
 #include <zephyr/pm/device.h>
 #include <zephyr/pm/device_runtime.h>
+#include <zephyr/spinlock.h>
+#include <string.h>
 LOG_MODULE_REGISTER(log_uart);
 
 struct lbu_data {
@@ -24,6 +26,16 @@ struct lbu_data {
 	uint32_t log_format_current;
 	volatile bool in_panic;
 	bool use_async;
+#if defined(CONFIG_LOG_BACKEND_UART_ASYNC_BUFFERED)
+	/* Output is collected in one buffer while the other one is being
+	 * transmitted.
+	 */
+	struct k_spinlock lock;
+	uint8_t tx_buf[2][CONFIG_LOG_BACKEND_UART_ASYNC_BUFFER_SIZE];
+	size_t fill_len;
+	uint8_t fill_idx;
+	bool tx_active;
+#endif
 };
 
 struct lbu_cb_ctx {
@@ -43,6 +55,110 @@ struct lbu_cb_ctx {
  */
 static const char LOG_HEX_SEP[10] = "##ZLOGV1##";
 
+#if defined(CONFIG_LOG_BACKEND_UART_ASYNC_BUFFERED)
+/* Start transmission of the buffer being filled and swap buffers. Must be
+ * called with the lock held and no transmission in progress.
+ */
+static void buffered_tx_start(const struct device *uart_dev, struct lbu_data *data)
+{
+	int err;
+
+	if (data->fill_len == 0) {
+		return;
+	}
+
+	err = uart_tx(uart_dev, data->tx_buf[data->fill_idx], data->fill_len,
+		      SYS_FOREVER_US);
+	if (err == 0) {
+		data->tx_active = true;
+		data->fill_idx ^= 1U;
+	}
+
+	/* Output that cannot be transmitted is dropped */
+	data->fill_len = 0;
+}
+
+static void buffered_tx_done(const struct device *uart_dev, struct lbu_data *data)
+{
+	k_spinlock_key_t key = k_spin_lock(&data->lock);
+	bool active;
+
+	data->tx_active = false;
+	buffered_tx_start(uart_dev, data);
+	active = data->tx_active;
+
+	k_spin_unlock(&data->lock, key);
+
+	if (!active) {
+		/* Release the reference taken when transmission started */
+		(void)pm_device_runtime_put_async(uart_dev, K_MSEC(1));
+	}
+
+	k_sem_give(&data->sem);
+}
+
+/* Start transmission from idle. Transmission is then continued from the
+ * completion callback as long as there is collected output.
+ */
+static void buffered_tx_kick(const struct device *uart_dev, struct lbu_data *data)
+{
+	k_spinlock_key_t key;
+	bool active;
+
+	/* Keep the UART active until the transmissions are completed */
+	(void)pm_device_runtime_get(uart_dev);
+	k_sem_reset(&data->sem);
+
+	key = k_spin_lock(&data->lock);
+	buffered_tx_start(uart_dev, data);
+	active = data->tx_active;
+	k_spin_unlock(&data->lock, key);
+
+	if (!active) {
+		(void)pm_device_runtime_put_async(uart_dev, K_MSEC(1));
+	}
+}
+
+static void buffered_out(const struct device *uart_dev, struct lbu_data *data,
+			 const uint8_t *src, size_t length)
+{
+	while (length > 0) {
+		k_spinlock_key_t key = k_spin_lock(&data->lock);
+		size_t len = MIN(length, sizeof(data->tx_buf[0]) - data->fill_len);
+		bool idle;
+
+		if (len == 0) {
+			/* Both buffers are in use, wait for transmission to complete */
+			k_spin_unlock(&data->lock, key);
+			(void)k_sem_take(&data->sem, K_FOREVER);
+			continue;
+		}
+
+		memcpy(&data->tx_buf[data->fill_idx][data->fill_len], src, len);
+		data->fill_len += len;
+		src += len;
+		length -= len;
+		idle = !data->tx_active;
+
+		k_spin_unlock(&data->lock, key);
+
+		if (idle) {
+			buffered_tx_kick(uart_dev, data);
+		}
+	}
+}
+
+/* Output the collected data which has not been transmitted yet. */
+static void buffered_panic_flush(const struct device *uart_dev, struct lbu_data *data)
+{
+	for (size_t i = 0; i < data->fill_len; i++) {
+		uart_poll_out(uart_dev, data->tx_buf[data->fill_idx][i]);
+	}
+
+	data->fill_len = 0;
+}
+#endif /* CONFIG_LOG_BACKEND_UART_ASYNC_BUFFERED */
+
 static void uart_callback(const struct device *dev,
 			  struct uart_event *evt,
 			  void *user_data)
@@ -54,7 +170,12 @@ static void uart_callback(const struct device *dev,
 
 	switch (evt->type) {
 	case UART_TX_DONE:
+	case UART_TX_ABORTED:
+#if defined(CONFIG_LOG_BACKEND_UART_ASYNC_BUFFERED)
+		buffered_tx_done(dev, data);
+#else
 		k_sem_give(&data->sem);
+#endif
 		break;
 	default:
 		break;
@@ -106,6 +227,11 @@ static int char_out(uint8_t *data, size_t length, void *ctx)
 		goto cleanup;
 	}
 
+#if defined(CONFIG_LOG_BACKEND_UART_ASYNC_BUFFERED)
+	buffered_out(uart_dev, lb_data, data, length);
+	goto cleanup;
+#endif
+
 	err = uart_tx(uart_dev, data, length, SYS_FOREVER_US);
 	__ASSERT_NO_MSG(err == 0);
 
@@ -203,6 +329,11 @@ static void panic(struct log_backend const *const backend)
 #endif /* CONFIG_PM_DEVICE */
 
 	data->in_panic = true;
+#if defined(CONFIG_LOG_BACKEND_UART_ASYNC_BUFFERED)
+	if (data->use_async) {
+		buffered_panic_flush(uart_dev, data);
+	}
+#endif
 	log_backend_std_panic(ctx->output);
 }
 
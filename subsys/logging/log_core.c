@@ -134,6 +134,21 @@ static const struct mpsc_pbuf_buffer_config mpsc_config = {
 };
 #endif
 
+#ifdef CONFIG_LOG_PER_CPU_BUFFER
+#define LOG_CPU_BUFFERS (CONFIG_MP_MAX_NUM_CPUS - 1)
+
+/* Buffers of the CPUs other than CPU 0, which uses the default buffer. Names
+ * are sorted after the default buffer and message pointer so that indexes of
+ * both sections match.
+ */
+static STRUCT_SECTION_ITERABLE_ARRAY(log_msg_ptr, log_msg_ptr_cpu, LOG_CPU_BUFFERS);
+static STRUCT_SECTION_ITERABLE_ARRAY_ALTERNATE(log_mpsc_pbuf, mpsc_pbuf_buffer,
+					       log_buffer_cpu, LOG_CPU_BUFFERS);
+
+static uint32_t __aligned(Z_LOG_MSG_ALIGNMENT)
+	cpu_buf32[LOG_CPU_BUFFERS][CONFIG_LOG_PER_CPU_BUFFER_SIZE / sizeof(int)];
+#endif
+
 /* Check that default tag can fit in tag buffer. */
 COND_CODE_0(CONFIG_LOG_TAG_MAX_LEN, (),
 	(BUILD_ASSERT(sizeof(CONFIG_LOG_TAG_DEFAULT) <= CONFIG_LOG_TAG_MAX_LEN + 1,
@@ -512,6 +527,59 @@ static inline bool z_log_unordered_pending(void)
 	return IS_ENABLED(CONFIG_LOG_MULTIDOMAIN) && unordered_cnt;
 }
 
+#if defined(CONFIG_MPSC_PBUF) && defined(CONFIG_LOG_PROCESS_BATCH_SIZE) && \
+	(CONFIG_LOG_PROCESS_BATCH_SIZE > 1)
+#define LOG_PROCESS_BATCH 1
+#else
+#define LOG_PROCESS_BATCH 0
+#endif
+
+/* Process a batch of messages from the local buffer. Batching is not used
+ * when there are dedicated buffers for links as messages must then be
+ * picked one by one from the buffer holding the oldest one.
+ */
+static void msg_process_batch(void)
+{
+#if LOG_PROCESS_BATCH
+	const union mpsc_pbuf_generic *items[CONFIG_LOG_PROCESS_BATCH_SIZE];
+	uint32_t cnt;
+
+	cnt = mpsc_pbuf_claim_batch(&log_buffer, items, ARRAY_SIZE(items));
+	if (cnt == 0) {
+		return;
+	}
+
+	atomic_sub(&buffered_cnt, cnt);
+	for (uint32_t i = 0; i < cnt; i++) {
+		msg_process((union log_msg_generic *)items[i]);
+	}
+
+	mpsc_pbuf_free_batch(&log_buffer, items, cnt);
+#endif
+}
+
+/* Messages must be merged from multiple buffers if links have dedicated
+ * buffers or if each CPU has its own buffer.
+ */
+static bool msg_multi_buffer(void)
+{
+	size_t len;
+
+	STRUCT_SECTION_COUNT(log_mpsc_pbuf, &len);
+
+	return (IS_ENABLED(CONFIG_LOG_MULTIDOMAIN) ||
+		IS_ENABLED(CONFIG_LOG_PER_CPU_BUFFER)) && len > 1;
+}
+
+static bool msg_batch_enabled(void)
+{
+	if (!LOG_PROCESS_BATCH) {
+		return false;
+	}
+
+	return !msg_multi_buffer();
+}
+
 bool z_impl_log_process(void)
 {
 	if (!IS_ENABLED(CONFIG_LOG_MODE_DEFERRED)) {
@@ -525,7 +593,12 @@ bool z_impl_log_process(void)
 		return false;
 	}
 
-	msg = z_log_msg_claim(&backoff);
+	if (msg_batch_enabled()) {
+		msg_process_batch();
+		msg = NULL;
+	} else {
+		msg = z_log_msg_claim(&backoff);
+	}
 
 	if (msg) {
 		atomic_dec(&buffered_cnt);
@@ -607,6 +680,44 @@ void z_log_msg_init(void)
 	mpsc_pbuf_init(&log_buffer, &mpsc_config);
 	curr_log_buffer = &log_buffer;
 #endif
+#ifdef CONFIG_LOG_PER_CPU_BUFFER
+	struct mpsc_pbuf_buffer_config cpu_config = mpsc_config;
+
+	for (int i = 0; i < LOG_CPU_BUFFERS; i++) {
+		cpu_config.buf = cpu_buf32[i];
+		cpu_config.size = ARRAY_SIZE(cpu_buf32[i]);
+		mpsc_pbuf_init(&log_buffer_cpu[i], &cpu_config);
+	}
+#endif
+}
+
+/* Get the buffer of the CPU on which the caller runs. The thread may migrate
+ * to another CPU afterwards, which is harmless as buffers accept messages
+ * from any context.
+ */
+static struct mpsc_pbuf_buffer *cpu_buffer_get(void)
+{
+#ifdef CONFIG_LOG_PER_CPU_BUFFER
+	uint8_t id = arch_curr_cpu()->id;
+
+	if (id > 0) {
+		return &log_buffer_cpu[id - 1];
+	}
+#endif
+	return &log_buffer;
+}
+
+/* Get the buffer from which the message has been allocated. */
+static struct mpsc_pbuf_buffer *msg_buffer_get(const struct log_msg *msg)
+{
+#ifdef CONFIG_LOG_PER_CPU_BUFFER
+	uintptr_t offset = (uintptr_t)msg - (uintptr_t)cpu_buf32;
+
+	if (offset < sizeof(cpu_buf32)) {
+		return &log_buffer_cpu[offset / sizeof(cpu_buf32[0])];
+	}
+#endif
+	return &log_buffer;
 }
 
 static struct log_msg *msg_alloc(struct mpsc_pbuf_buffer *buffer, uint32_t wlen)
@@ -624,7 +735,7 @@ static struct log_msg *msg_alloc(struct mpsc_pbuf_buffer *buffer, uint32_t wlen)
 
 struct log_msg *z_log_msg_alloc(uint32_t wlen)
 {
-	return msg_alloc(&log_buffer, wlen);
+	return msg_alloc(cpu_buffer_get(), wlen);
 }
 
 static void msg_commit(struct mpsc_pbuf_buffer *buffer, struct log_msg *msg)
@@ -646,7 +757,7 @@ static void msg_commit(struct mpsc_pbuf_buffer *buffer, struct log_msg *msg)
 void z_log_msg_commit(struct log_msg *msg)
 {
 	msg->hdr.timestamp = timestamp_func();
-	msg_commit(&log_buffer, msg);
+	msg_commit(msg_buffer_get(msg), msg);
 }
 
 union log_msg_generic *z_log_msg_local_claim(void)
@@ -728,12 +839,8 @@ union log_msg_generic *z_log_msg_claim_oldest(k_timeout_t *backoff)
 
 union log_msg_generic *z_log_msg_claim(k_timeout_t *backoff)
 {
-	size_t len;
-
-	STRUCT_SECTION_COUNT(log_mpsc_pbuf, &len);
-
 	/* Use only one buffer if others are not registered. */
-	if (IS_ENABLED(CONFIG_LOG_MULTIDOMAIN) && len > 1) {
+	if (msg_multi_buffer()) {
 		return z_log_msg_claim_oldest(backoff);
 	}
 
@@ -763,12 +870,9 @@ static bool msg_pending(struct mpsc_pbuf_buffer *buffer)
 
 bool z_log_msg_pending(void)
 {
-	size_t len;
 	int i = 0;
 
-	STRUCT_SECTION_COUNT(log_mpsc_pbuf, &len);
-
-	if (!IS_ENABLED(CONFIG_LOG_MULTIDOMAIN) || (len == 1)) {
+	if (!msg_multi_buffer()) {
 		return msg_pending(&log_buffer);
 	}
 
@@ -257,8 +257,13 @@ void z_impl_z_log_msg_static_create(const void *source,
 	struct log_msg *msg;
 
 	if (inlen > 0) {
+		/* Strings validated at compile time cannot have character
+		 * pointers used for %p, so there is no need to parse the
+		 * format string again to find them.
+		 */
 		uint32_t flags = CBPRINTF_PACKAGE_CONVERT_RW_STR |
-				 (IS_ENABLED(CONFIG_LOG_FMT_SECTION_STRIP) ?
+				 ((IS_ENABLED(CONFIG_LOG_FMT_SECTION_STRIP) ||
+				   IS_ENABLED(CONFIG_LOG_FMT_STRING_VALIDATE)) ?
 				 0 : CBPRINTF_PACKAGE_CONVERT_PTR_CHECK);
 		uint16_t strl[4];
 		int len;
@@ -10,7 +10,18 @@
 #include <zephyr/logging/log_output.h>
 #include <zephyr/logging/log_output_dict.h>
 #include <zephyr/sys/__assert.h>
+#include <zephyr/sys/cbprintf.h>
 #include <zephyr/sys/util.h>
+#include <string.h>
+
+#if defined(CONFIG_LOG_DICTIONARY_COMPACT)
+#include <zephyr/sys/hash_function.h>
+#include "log_cache.h"
+#endif
+
+#if defined(CONFIG_LOG_DICTIONARY_COMPACT_LZ4)
+#include <lz4.h>
+#endif
 
 static void buffer_write(log_output_func_t outf, uint8_t *buf, size_t len,
 			 void *ctx)
@@ -24,12 +35,22 @@ static void buffer_write(log_output_func_t outf, uint8_t *buf, size_t len,
 	} while (len != 0);
 }
 
-void log_dict_output_msg_process(const struct log_output *output,
-				 struct log_msg *msg, uint32_t flags)
+static uint32_t msg_source_id(struct log_msg *msg)
 {
-	struct log_dict_output_normal_msg_hdr_t output_hdr;
 	void *source = (void *)log_msg_get_source(msg);
 
+	if (source == NULL) {
+		return 0U;
+	}
+
+	return IS_ENABLED(CONFIG_LOG_RUNTIME_FILTERING) ?
+		log_dynamic_source_id(source) : log_const_source_id(source);
+}
+
+static void normal_msg_process(const struct log_output *output, struct log_msg *msg)
+{
+	struct log_dict_output_normal_msg_hdr_t output_hdr;
+
 	/* Keep sync with header in struct log_msg */
 	output_hdr.type = MSG_NORMAL;
 	output_hdr.domain = msg->hdr.desc.domain;
@@ -38,11 +59,7 @@ void log_dict_output_msg_process(const struct log_output *output,
 	output_hdr.data_len = msg->hdr.desc.data_len;
 	output_hdr.timestamp = msg->hdr.timestamp;
 
-	output_hdr.source = (source != NULL) ?
-				(IS_ENABLED(CONFIG_LOG_RUNTIME_FILTERING) ?
-					log_dynamic_source_id(source) :
-					log_const_source_id(source)) :
-				0U;
+	output_hdr.source = msg_source_id(msg);
 
 	buffer_write(output->func, (uint8_t *)&output_hdr, sizeof(output_hdr),
 		     (void *)output->control_block->ctx);
@@ -62,6 +79,290 @@ void log_dict_output_msg_process(const struct log_output *output,
 	log_output_flush(output);
 }
 
+#if defined(CONFIG_LOG_DICTIONARY_COMPACT)
+/* Location of an interned string when it is written to the output. */
+enum {
+	INTERN_INLINE,
+	INTERN_DEFINE,
+	INTERN_REF,
+};
+
+#define INTERN_ENTRY_SIZE							\
+	ROUND_UP(sizeof(struct log_cache_entry) + CONFIG_LOG_DICTIONARY_COMPACT_INTERN_LEN, \
+		 sizeof(uintptr_t))
+
+struct compact_ctx {
+	const struct log_output *output;
+	/* Timestamp of the last compact message, deltas are relative to it */
+	log_timestamp_t timestamp;
+	struct log_cache intern;
+	uint8_t __aligned(sizeof(uintptr_t))
+		intern_buf[CONFIG_LOG_DICTIONARY_COMPACT_INTERN_COUNT * INTERN_ENTRY_SIZE];
+#if defined(CONFIG_LOG_DICTIONARY_COMPACT_LZ4)
+	uint8_t frame[CONFIG_LOG_DICTIONARY_COMPACT_FRAME_SIZE];
+	size_t frame_len;
+#endif
+};
+
+struct compact_writer {
+	uint8_t *buf;
+	size_t len;
+	size_t size;
+	bool overflow;
+};
+
+static struct compact_ctx compact_ctxs[CONFIG_LOG_DICTIONARY_COMPACT_INSTANCES];
+
+/* Messages are processed from a single context so buffers can be shared. */
+static uint8_t compact_buf[CONFIG_LOG_DICTIONARY_COMPACT_BUF_SIZE];
+
+#if defined(CONFIG_LOG_DICTIONARY_COMPACT_LZ4)
+BUILD_ASSERT(CONFIG_LOG_DICTIONARY_COMPACT_FRAME_SIZE >= CONFIG_LOG_DICTIONARY_COMPACT_BUF_SIZE,
+	     "Frame must be able to hold any compact message");
+
+static LZ4_stream_t lz4_state;
+static char lz4_buf[LZ4_COMPRESSBOUND(CONFIG_LOG_DICTIONARY_COMPACT_FRAME_SIZE)];
+#endif
+
+static bool intern_cmp(uintptr_t id0, uintptr_t id1)
+{
+	return id0 == id1;
+}
+
+static struct compact_ctx *compact_ctx_get(const struct log_output *output)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(compact_ctxs); i++) {
+		struct compact_ctx *ctx = &compact_ctxs[i];
+
+		if (ctx->output == output) {
+			return ctx;
+		}
+
+		if (ctx->output == NULL) {
+			const struct log_cache_config config = {
+				.buf = ctx->intern_buf,
+				.buf_len = sizeof(ctx->intern_buf),
+				.item_size = CONFIG_LOG_DICTIONARY_COMPACT_INTERN_LEN,
+				.cmp = intern_cmp,
+			};
+
+			(void)log_cache_init(&ctx->intern, &config);
+			ctx->output = output;
+
+			return ctx;
+		}
+	}
+
+	/* Out of contexts, the output uses the normal format */
+	return NULL;
+}
+
+static void writer_put(struct compact_writer *w, const void *data, size_t len)
+{
+	if (len > w->size - w->len) {
+		w->overflow = true;
+		return;
+	}
+
+	memcpy(&w->buf[w->len], data, len);
+	w->len += len;
+}
+
+static void writer_put_u8(struct compact_writer *w, uint8_t val)
+{
+	writer_put(w, &val, sizeof(val));
+}
+
+static void writer_put_varint(struct compact_writer *w, uint64_t val)
+{
+	do {
+		uint8_t byte = val & BIT_MASK(7);
+
+		val >>= 7;
+		writer_put_u8(w, (val != 0U) ? (byte | BIT(7)) : byte);
+	} while (val != 0U);
+}
+
+static uint32_t intern_slot(struct compact_ctx *ctx, uint8_t *data)
+{
+	struct log_cache_entry *entry = CONTAINER_OF(data, struct log_cache_entry, data[0]);
+
+	return ((uintptr_t)entry - (uintptr_t)ctx->intern_buf) / INTERN_ENTRY_SIZE;
+}
+
+/* Write one string of the package string table. Strings already sent are
+ * replaced with their slot in the intern cache. New cache entries are added
+ * to @p pending and only put into the cache once the message is output.
+ */
+static void compact_string(struct compact_ctx *ctx, struct compact_writer *w,
+			   uint8_t **pending, size_t *pending_cnt,
+			   uint8_t idx, const char *str)
+{
+	size_t len = strlen(str);
+	uint8_t *data;
+
+	writer_put_u8(w, idx);
+
+	if (len < CONFIG_LOG_DICTIONARY_COMPACT_INTERN_LEN &&
+	    *pending_cnt < CONFIG_LOG_DICTIONARY_COMPACT_INTERN_COUNT) {
+		if (!log_cache_get(&ctx->intern, sys_hash32(str, len), &data)) {
+			memcpy(data, str, len + 1);
+			pending[(*pending_cnt)++] = data;
+
+			writer_put_u8(w, INTERN_DEFINE);
+			writer_put_varint(w, intern_slot(ctx, data));
+			writer_put(w, str, len + 1);
+			return;
+		}
+
+		if (strcmp((const char *)data, str) == 0) {
+			writer_put_u8(w, INTERN_REF);
+			writer_put_varint(w, intern_slot(ctx, data));
+			return;
+		}
+
+		/* Hash collision, send the string as it is */
+	}
+
+	writer_put_u8(w, INTERN_INLINE);
+	writer_put(w, str, len + 1);
+}
+
+static void compact_msg_encode(struct compact_ctx *ctx, struct compact_writer *w,
+			       struct log_msg *msg, uint8_t **pending, size_t *pending_cnt)
+{
+	size_t pkg_len;
+	size_t data_len;
+	uint8_t *pkg = log_msg_get_package(msg, &pkg_len);
+	uint8_t *data = log_msg_get_data(msg, &data_len);
+	struct cbprintf_package_desc *desc = (struct cbprintf_package_desc *)pkg;
+	size_t head_len = 0;
+	size_t str_cnt = 0;
+
+	if (pkg_len > 0U) {
+		head_len = desc->len * sizeof(int) + desc->ro_str_cnt + desc->rw_str_cnt;
+		str_cnt = desc->str_cnt;
+	}
+
+	writer_put_u8(w, MSG_COMPACT);
+	writer_put_varint(w, (log_timestamp_t)(log_msg_get_timestamp(msg) - ctx->timestamp));
+	writer_put_varint(w, ((uint64_t)msg_source_id(msg) << 6) |
+			     (msg->hdr.desc.domain << 3) | msg->hdr.desc.level);
+	writer_put_varint(w, head_len);
+	writer_put(w, pkg, head_len);
+
+	for (const char *str = (const char *)&pkg[head_len]; str_cnt > 0U; str_cnt--) {
+		uint8_t idx = *str++;
+
+		compact_string(ctx, w, pending, pending_cnt, idx, str);
+		str += strlen(str) + 1;
+	}
+
+	writer_put_varint(w, data_len);
+	writer_put(w, data, data_len);
+}
+
+static void compact_frame_flush(struct compact_ctx *ctx)
+{
+#if defined(CONFIG_LOG_DICTIONARY_COMPACT_LZ4)
+	uint8_t hdr[1 + 2 * 10];
+	struct compact_writer w = { .buf = hdr, .size = sizeof(hdr) };
+	int len;
+
+	if (ctx->frame_len == 0) {
+		return;
+	}
+
+	len = LZ4_compress_fast_extState(&lz4_state, (const char *)ctx->frame, lz4_buf,
+					 ctx->frame_len, sizeof(lz4_buf), 1);
+	if (len > 0) {
+		writer_put_u8(&w, MSG_LZ4_FRAME);
+		writer_put_varint(&w, ctx->frame_len);
+		writer_put_varint(&w, len);
+
+		buffer_write(ctx->output->func, hdr, w.len,
+			     (void *)ctx->output->control_block->ctx);
+		buffer_write(ctx->output->func, (uint8_t *)lz4_buf, len,
+			     (void *)ctx->output->control_block->ctx);
+	} else {
+		/* Frame holds complete messages, which can be output as they are */
+		buffer_write(ctx->output->func, ctx->frame, ctx->frame_len,
+			     (void *)ctx->output->control_block->ctx);
+	}
+
+	ctx->frame_len = 0;
+	log_output_flush(ctx->output);
+#else
+	ARG_UNUSED(ctx);
+#endif
+}
+
+static void compact_emit(struct compact_ctx *ctx, const uint8_t *data, size_t len)
+{
+#if defined(CONFIG_LOG_DICTIONARY_COMPACT_LZ4)
+	if (len > sizeof(ctx->frame) - ctx->frame_len) {
+		compact_frame_flush(ctx);
+	}
+
+	memcpy(&ctx->frame[ctx->frame_len], data, len);
+	ctx->frame_len += len;
+
+	/* Compress as many messages as possible into one frame */
+	if (!log_data_pending()) {
+		compact_frame_flush(ctx);
+	}
+#else
+	buffer_write(ctx->output->func, (uint8_t *)data, len,
+		     (void *)ctx->output->control_block->ctx);
+	log_output_flush(ctx->output);
+#endif
+}
+
+static void compact_msg_process(struct compact_ctx *ctx, struct log_msg *msg)
+{
+	struct compact_writer w = { .buf = compact_buf, .size = sizeof(compact_buf) };
+	uint8_t *pending[CONFIG_LOG_DICTIONARY_COMPACT_INTERN_COUNT];
+	size_t pending_cnt = 0;
+
+	compact_msg_encode(ctx, &w, msg, pending, &pending_cnt);
+
+	for (size_t i = 0; i < pending_cnt; i++) {
+		if (w.overflow) {
+			log_cache_release(&ctx->intern, pending[i]);
+		} else {
+			log_cache_put(&ctx->intern, pending[i]);
+		}
+	}
+
+	if (w.overflow) {
+		/* Too large for a compact message, use the normal format */
+		compact_frame_flush(ctx);
+		normal_msg_process(ctx->output, msg);
+		return;
+	}
+
+	ctx->timestamp = log_msg_get_timestamp(msg);
+	compact_emit(ctx, w.buf, w.len);
+}
+#endif /* CONFIG_LOG_DICTIONARY_COMPACT */
+
+void log_dict_output_msg_process(const struct log_output *output,
+				 struct log_msg *msg, uint32_t flags)
+{
+	ARG_UNUSED(flags);
+
+#if defined(CONFIG_LOG_DICTIONARY_COMPACT)
+	struct compact_ctx *ctx = compact_ctx_get(output);
+
+	if (ctx != NULL) {
+		compact_msg_process(ctx, msg);
+		return;
+	}
+#endif
+
+	normal_msg_process(output, msg);
+}
+
 void log_dict_output_dropped_process(const struct log_output *output, uint32_t cnt)
 {
 	struct log_dict_output_dropped_msg_t msg;
@@ -69,6 +370,15 @@ void log_dict_output_dropped_process(const struct log_output *output, uint32_t c
 	msg.type = MSG_DROPPED_MSG;
 	msg.num_dropped_messages = MIN(cnt, 9999);
 
+#if defined(CONFIG_LOG_DICTIONARY_COMPACT)
+	struct compact_ctx *ctx = compact_ctx_get(output);
+
+	if (ctx != NULL) {
+		compact_emit(ctx, (uint8_t *)&msg, sizeof(msg));
+		return;
+	}
+#endif
+
 	buffer_write(output->func, (uint8_t *)&msg, sizeof(msg),
 		     (void *)output->control_block->ctx);
 }
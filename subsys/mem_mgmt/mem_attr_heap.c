@@ -8,6 +8,7 @@
 #include <zephyr/device.h>
 #include <zephyr/sys/sys_heap.h>
 #include <zephyr/mem_mgmt/mem_attr.h>
+#include <zephyr/mem_mgmt/mem_attr_heap.h>
 #include <zephyr/sys/multi_heap.h>
 #include <zephyr/dt-bindings/memory-attr/memory-attr.h>
 #include <zephyr/dt-bindings/memory-attr/memory-attr-sw.h>
@@ -15,6 +16,12 @@
 struct ma_heap {
 	struct sys_heap heap;
 	uint32_t attr;
+	const struct mem_attr_region_t *region;
+};
+
+struct ma_cfg {
+	uint32_t attr;
+	enum mem_attr_heap_policy policy;
 };
 
 struct {
@@ -23,35 +30,44 @@ struct {
 	int nheaps;
 } mah_data;
 
-static void *mah_choice(struct sys_multi_heap *m_heap, void *cfg, size_t align, size_t size)
+static void *mah_alloc(uint32_t attr, bool exact, size_t align, size_t size)
 {
-	uint32_t attr;
-	void *block;
-
-	if (size == 0) {
-		return NULL;
-	}
-
-	attr = (uint32_t)(long) cfg;
-
-	/* Set in case the user requested a non-existing attr */
-	block = NULL;
-
 	for (size_t hdx = 0; hdx < mah_data.nheaps; hdx++) {
 		struct ma_heap *h;
+		void *block;
 
 		h = &mah_data.ma_heaps[hdx];
 
-		if (h->attr != attr) {
+		if (exact ? (h->attr != attr) :
+			    ((h->attr == attr) || ((h->attr & attr) != attr))) {
 			continue;
 		}
 
 		block = sys_heap_aligned_alloc(&h->heap, align, size);
 		if (block != NULL) {
-			break;
+			return block;
 		}
 	}
 
+	return NULL;
+}
+
+static void *mah_choice(struct sys_multi_heap *m_heap, void *cfg, size_t align, size_t size)
+{
+	const struct ma_cfg *ma_cfg = cfg;
+	void *block;
+
+	if (size == 0) {
+		return NULL;
+	}
+
+	block = mah_alloc(ma_cfg->attr, true, align, size);
+
+	/* Spill over to the regions that have more attributes */
+	if ((block == NULL) && (ma_cfg->policy == MEM_ATTR_HEAP_POLICY_SPILL)) {
+		block = mah_alloc(ma_cfg->attr, false, align, size);
+	}
+
 	return block;
 }
 
@@ -62,14 +78,24 @@ void mem_attr_heap_free(void *block)
 
 void *mem_attr_heap_alloc(uint32_t attr, size_t bytes)
 {
-	return sys_multi_heap_alloc(&mah_data.multi_heap,
-				    (void *)(long) attr, bytes);
+	struct ma_cfg cfg = { .attr = attr, .policy = MEM_ATTR_HEAP_POLICY_EXACT };
+
+	return sys_multi_heap_alloc(&mah_data.multi_heap, &cfg, bytes);
 }
 
 void *mem_attr_heap_aligned_alloc(uint32_t attr, size_t align, size_t bytes)
 {
-	return sys_multi_heap_aligned_alloc(&mah_data.multi_heap,
-					    (void *)(long) attr, align, bytes);
+	struct ma_cfg cfg = { .attr = attr, .policy = MEM_ATTR_HEAP_POLICY_EXACT };
+
+	return sys_multi_heap_aligned_alloc(&mah_data.multi_heap, &cfg, align, bytes);
+}
+
+void *mem_attr_heap_policy_alloc(uint32_t attr, enum mem_attr_heap_policy policy,
+				 size_t align, size_t bytes)
+{
+	struct ma_cfg cfg = { .attr = attr, .policy = policy };
+
+	return sys_multi_heap_aligned_alloc(&mah_data.multi_heap, &cfg, align, bytes);
 }
 
 const struct mem_attr_region_t *mem_attr_heap_get_region(void *addr)
@@ -81,6 +107,22 @@ const struct mem_attr_region_t *mem_attr_heap_get_region(void *addr)
 	return (const struct mem_attr_region_t *) heap_rec->user_data;
 }
 
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+int mem_attr_heap_region_stats_get(const struct mem_attr_region_t *region,
+				   struct sys_memory_stats *stats)
+{
+	for (size_t hdx = 0; hdx < mah_data.nheaps; hdx++) {
+		struct ma_heap *h = &mah_data.ma_heaps[hdx];
+
+		if (h->region == region) {
+			return sys_heap_runtime_stats_get(&h->heap, stats);
+		}
+	}
+
+	return -ENOENT;
+}
+#endif /* CONFIG_SYS_HEAP_RUNTIME_STATS */
+
 static int ma_heap_add(const struct mem_attr_region_t *region, uint32_t attr)
 {
 	struct ma_heap *mh;
@@ -95,6 +137,7 @@ static int ma_heap_add(const struct mem_attr_region_t *region, uint32_t attr)
 	h = &mh->heap;
 
 	mh->attr = attr;
+	mh->region = region;
 
 	sys_heap_init(h, (void *) region->dt_addr, region->dt_size);
 	sys_multi_heap_add_heap(&mah_data.multi_heap, h, (void *) region);
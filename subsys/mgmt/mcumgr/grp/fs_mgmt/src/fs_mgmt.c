@@ -106,6 +106,20 @@ static struct {
 
 	/** Delayed workqueue used to close the file after a period of inactivity. */
 	struct k_work_delayable file_close_work;
+
+#if defined(CONFIG_MCUMGR_GRP_FS_DL_READ_AHEAD)
+	/** Work reading the next download chunk. */
+	struct k_work read_ahead_work;
+
+	/** Offset of the chunk read ahead, SIZE_MAX if none. */
+	size_t read_ahead_off;
+
+	/** Result of the read ahead. */
+	ssize_t read_ahead_len;
+
+	/** Download chunk, read ahead or not. */
+	uint8_t read_ahead_data[MCUMGR_GRP_FS_DL_CHUNK_SIZE];
+#endif
 } fs_mgmt_ctxt;
 
 static const struct mgmt_handler fs_mgmt_handlers[];
@@ -118,9 +132,65 @@ struct fs_mgmt_hash_checksum_iterator_info {
 };
 #endif
 
+#if defined(CONFIG_MCUMGR_GRP_FS_DL_READ_AHEAD)
+static void read_ahead_work_handler(struct k_work *work)
+{
+	fs_mgmt_ctxt.read_ahead_len = fs_read(&fs_mgmt_ctxt.file, fs_mgmt_ctxt.read_ahead_data,
+					      sizeof(fs_mgmt_ctxt.read_ahead_data));
+}
+
+/* Drops the chunk read ahead, if any */
+static void fs_mgmt_read_ahead_cancel(void)
+{
+	struct k_work_sync sync;
+
+	if (fs_mgmt_ctxt.read_ahead_off != SIZE_MAX) {
+		(void)k_work_cancel_sync(&fs_mgmt_ctxt.read_ahead_work, &sync);
+		fs_mgmt_ctxt.read_ahead_off = SIZE_MAX;
+
+		/* The file position is unknown, force a seek */
+		fs_mgmt_ctxt.off = SIZE_MAX;
+	}
+}
+
+/* Returns the length of the chunk read ahead at off, or -1 if not available */
+static ssize_t fs_mgmt_read_ahead_take(uint64_t off)
+{
+	struct k_work_sync sync;
+
+	if ((fs_mgmt_ctxt.read_ahead_off == SIZE_MAX) || (fs_mgmt_ctxt.read_ahead_off != off)) {
+		fs_mgmt_read_ahead_cancel();
+		return -1;
+	}
+
+	(void)k_work_flush(&fs_mgmt_ctxt.read_ahead_work, &sync);
+	fs_mgmt_ctxt.read_ahead_off = SIZE_MAX;
+
+	if (fs_mgmt_ctxt.read_ahead_len < 0) {
+		/* Read again in the handler, which reports the error */
+		fs_mgmt_ctxt.off = SIZE_MAX;
+		return -1;
+	}
+
+	return fs_mgmt_ctxt.read_ahead_len;
+}
+
+static void fs_mgmt_read_ahead_start(void)
+{
+	if (fs_mgmt_ctxt.state == STATE_DOWNLOAD) {
+		fs_mgmt_ctxt.read_ahead_off = fs_mgmt_ctxt.off;
+		k_work_submit(&fs_mgmt_ctxt.read_ahead_work);
+	}
+}
+#endif
+
 /* Clean up open file state */
 static void fs_mgmt_cleanup(void)
 {
+#if defined(CONFIG_MCUMGR_GRP_FS_DL_READ_AHEAD)
+	fs_mgmt_read_ahead_cancel();
+#endif
+
 	if (fs_mgmt_ctxt.state != STATE_NO_UPLOAD_OR_DOWNLOAD) {
 		fs_mgmt_ctxt.state = STATE_NO_UPLOAD_OR_DOWNLOAD;
 		fs_mgmt_ctxt.off = 0;
@@ -203,10 +273,14 @@ static void fs_mgmt_upload_download_finish_check(void)
  */
 static int fs_mgmt_file_download(struct smp_streamer *ctxt)
 {
+#if defined(CONFIG_MCUMGR_GRP_FS_DL_READ_AHEAD)
+	uint8_t *file_data = fs_mgmt_ctxt.read_ahead_data;
+#else
 	uint8_t file_data[MCUMGR_GRP_FS_DL_CHUNK_SIZE];
+#endif
 	char path[CONFIG_MCUMGR_GRP_FS_PATH_LEN + 1];
 	uint64_t off = ULLONG_MAX;
-	ssize_t bytes_read = 0;
+	ssize_t bytes_read = -1;
 	int rc;
 	zcbor_state_t *zse = ctxt->writer->zs;
 	zcbor_state_t *zsd = ctxt->reader->zs;
@@ -298,33 +372,39 @@ static int fs_mgmt_file_download(struct smp_streamer *ctxt)
 		fs_mgmt_ctxt.transport = ctxt->smpt;
 	}
 
-	/* Seek to desired offset */
-	if (off != fs_mgmt_ctxt.off) {
-		rc = fs_seek(&fs_mgmt_ctxt.file, off, FS_SEEK_SET);
+#if defined(CONFIG_MCUMGR_GRP_FS_DL_READ_AHEAD)
+	bytes_read = fs_mgmt_read_ahead_take(off);
+#endif
 
-		if (rc != 0) {
-			ok = smp_add_cmd_err(zse, MGMT_GROUP_ID_FS,
-					     FS_MGMT_ERR_FILE_SEEK_FAILED);
+	if (bytes_read < 0) {
+		/* Seek to desired offset */
+		if (off != fs_mgmt_ctxt.off) {
+			rc = fs_seek(&fs_mgmt_ctxt.file, off, FS_SEEK_SET);
+
+			if (rc != 0) {
+				ok = smp_add_cmd_err(zse, MGMT_GROUP_ID_FS,
+						     FS_MGMT_ERR_FILE_SEEK_FAILED);
+				fs_mgmt_cleanup();
+				goto end;
+			}
+
+			fs_mgmt_ctxt.off = off;
+		}
+
+		/* Read the requested chunk from the file. */
+		bytes_read = fs_read(&fs_mgmt_ctxt.file, file_data, MCUMGR_GRP_FS_DL_CHUNK_SIZE);
+
+		if (bytes_read < 0) {
+			ok = smp_add_cmd_err(zse, MGMT_GROUP_ID_FS, FS_MGMT_ERR_FILE_READ_FAILED);
 			fs_mgmt_cleanup();
 			goto end;
 		}
-
-		fs_mgmt_ctxt.off = off;
 	}
 
 	/* Only the response to the first download request contains the total file
 	 * length.
 	 */
 
-	/* Read the requested chunk from the file. */
-	bytes_read = fs_read(&fs_mgmt_ctxt.file, file_data, MCUMGR_GRP_FS_DL_CHUNK_SIZE);
-
-	if (bytes_read < 0) {
-		ok = smp_add_cmd_err(zse, MGMT_GROUP_ID_FS, FS_MGMT_ERR_FILE_READ_FAILED);
-		fs_mgmt_cleanup();
-		goto end;
-	}
-
 	/* Increment offset */
 	fs_mgmt_ctxt.off += bytes_read;
 
@@ -337,6 +417,11 @@ static int fs_mgmt_file_download(struct smp_streamer *ctxt)
 
 	fs_mgmt_upload_download_finish_check();
 
+#if defined(CONFIG_MCUMGR_GRP_FS_DL_READ_AHEAD)
+	/* The chunk has been copied to the response */
+	fs_mgmt_read_ahead_start();
+#endif
+
 end:
 	rc = (ok ? MGMT_ERR_EOK : MGMT_ERR_EMSGSIZE);
 	k_sem_give(&fs_mgmt_ctxt.lock_sem);
@@ -991,6 +1076,10 @@ static void fs_mgmt_register_group(void)
 	fs_mgmt_ctxt.state = STATE_NO_UPLOAD_OR_DOWNLOAD;
 	k_sem_init(&fs_mgmt_ctxt.lock_sem, 1, 1);
 	k_work_init_delayable(&fs_mgmt_ctxt.file_close_work, file_close_work_handler);
+#if defined(CONFIG_MCUMGR_GRP_FS_DL_READ_AHEAD)
+	k_work_init(&fs_mgmt_ctxt.read_ahead_work, read_ahead_work_handler);
+	fs_mgmt_ctxt.read_ahead_off = SIZE_MAX;
+#endif
 
 	mgmt_register_group(&fs_mgmt_group);
 
@@ -25,7 +25,7 @@
 #include <mgmt/mcumgr/util/zcbor_bulk.h>
 #include <mgmt/mcumgr/grp/img_mgmt/img_mgmt_priv.h>
 
-#ifdef CONFIG_IMG_ENABLE_IMAGE_CHECK
+#if defined(CONFIG_IMG_ENABLE_IMAGE_CHECK) || defined(CONFIG_IMG_DECODE)
 #include <zephyr/dfu/flash_img.h>
 #endif
 
@@ -93,6 +93,7 @@ const char *img_mgmt_err_str_downgrade = "downgrade";
 const char *img_mgmt_err_str_image_bad_flash_addr = "img addr mismatch";
 const char *img_mgmt_err_str_image_too_large = "img too large";
 const char *img_mgmt_err_str_data_overrun = "data overrun";
+const char *img_mgmt_err_str_delta_source_mismatch = "delta source mismatch";
 #endif
 
 void img_mgmt_take_lock(void)
@@ -302,6 +303,94 @@ img_mgmt_find_by_hash(uint8_t *find, struct image_version *ver)
 	return -1;
 }
 
+#if CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW > 0
+/*
+ * Chunks received ahead of the write offset, a chunk of zero length is free.
+ */
+struct img_mgmt_window_chunk {
+	size_t off;
+	size_t len;
+	uint8_t data[CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW_CHUNK_SIZE];
+};
+
+static struct img_mgmt_window_chunk img_mgmt_window[CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW];
+
+static void img_mgmt_window_clear(void)
+{
+	for (int i = 0; i < ARRAY_SIZE(img_mgmt_window); i++) {
+		img_mgmt_window[i].len = 0;
+	}
+}
+
+/*
+ * Keeps a chunk of the ongoing upload that is past the write offset, the
+ * chunk is silently dropped if it can not be kept.
+ */
+static void img_mgmt_window_store(const struct img_mgmt_upload_req *req)
+{
+	struct img_mgmt_window_chunk *free_chunk = NULL;
+
+	if ((g_img_mgmt_state.area_id == -1) || (req->off <= g_img_mgmt_state.off) ||
+	    (req->img_data.len == 0) ||
+	    (req->img_data.len > CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW_CHUNK_SIZE) ||
+	    ((req->off + req->img_data.len) > g_img_mgmt_state.size)) {
+		return;
+	}
+
+	for (int i = 0; i < ARRAY_SIZE(img_mgmt_window); i++) {
+		struct img_mgmt_window_chunk *chunk = &img_mgmt_window[i];
+
+		if ((chunk->len == 0) || (chunk->off < g_img_mgmt_state.off)) {
+			chunk->len = 0;
+			free_chunk = free_chunk ? free_chunk : chunk;
+		} else if (chunk->off == req->off) {
+			/* Retransmission of a chunk already kept */
+			return;
+		}
+	}
+
+	if (free_chunk != NULL) {
+		free_chunk->off = req->off;
+		free_chunk->len = req->img_data.len;
+		memcpy(free_chunk->data, req->img_data.value, req->img_data.len);
+	}
+}
+
+/*
+ * Writes the kept chunks that continue the data written so far.
+ */
+static int img_mgmt_window_drain(bool *last)
+{
+	bool found = true;
+	int rc = IMG_MGMT_ERR_OK;
+
+	while (found && (rc == IMG_MGMT_ERR_OK) &&
+	       (g_img_mgmt_state.off < g_img_mgmt_state.size)) {
+		found = false;
+
+		for (int i = 0; i < ARRAY_SIZE(img_mgmt_window); i++) {
+			struct img_mgmt_window_chunk *chunk = &img_mgmt_window[i];
+
+			if ((chunk->len == 0) || (chunk->off != g_img_mgmt_state.off)) {
+				continue;
+			}
+
+			*last = (chunk->off + chunk->len == g_img_mgmt_state.size);
+			rc = img_mgmt_write_image_data(chunk->off, chunk->data, chunk->len,
+						       *last);
+			if (rc == IMG_MGMT_ERR_OK) {
+				g_img_mgmt_state.off += chunk->len;
+			}
+			chunk->len = 0;
+			found = true;
+			break;
+		}
+	}
+
+	return rc;
+}
+#endif
+
 /*
  * Resets upload status to defaults (no upload in progress)
  */
@@ -314,6 +403,9 @@ static void img_mgmt_reset_upload(void)
 	img_mgmt_take_lock();
 	memset(&g_img_mgmt_state, 0, sizeof(g_img_mgmt_state));
 	g_img_mgmt_state.area_id = -1;
+#if CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW > 0
+	img_mgmt_window_clear();
+#endif
 	img_mgmt_release_lock();
 }
 
@@ -405,6 +497,44 @@ img_mgmt_upload_good_rsp(struct smp_streamer *ctxt)
 	return ok ? MGMT_ERR_EOK : MGMT_ERR_EMSGSIZE;
 }
 
+#ifndef CONFIG_IMG_ERASE_PROGRESSIVELY
+/*
+ * Size of the image once written to flash.
+ */
+static size_t img_mgmt_upload_image_size(void)
+{
+#ifdef CONFIG_IMG_DECODE
+	if (g_img_mgmt_state.format != IMG_MGMT_UPLOAD_FORMAT_RAW) {
+		return g_img_mgmt_state.image_size;
+	}
+#endif
+
+	return g_img_mgmt_state.size;
+}
+#endif
+
+#ifdef CONFIG_IMG_ENABLE_IMAGE_CHECK
+/*
+ * Gets the hash the written image is checked against, returns false when
+ * the client did not provide a full hash.
+ */
+static bool img_mgmt_upload_check_get(struct flash_img_check *fic)
+{
+#ifdef CONFIG_IMG_DECODE
+	if (g_img_mgmt_state.format != IMG_MGMT_UPLOAD_FORMAT_RAW) {
+		fic->match = g_img_mgmt_state.image_sha;
+		fic->clen = g_img_mgmt_state.image_size;
+		return true;
+	}
+#endif
+
+	fic->match = g_img_mgmt_state.data_sha;
+	fic->clen = g_img_mgmt_state.size;
+
+	return g_img_mgmt_state.data_sha_len == IMG_MGMT_DATA_SHA_LEN;
+}
+#endif
+
 /**
  * Logs an upload request if necessary.
  *
@@ -524,6 +654,9 @@ defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 		/* Request specifies incorrect offset.  Respond with a success code and
 		 * the correct offset.
 		 */
+#if CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW > 0
+		img_mgmt_window_store(&req);
+#endif
 		rc = img_mgmt_upload_good_rsp(ctxt);
 		img_mgmt_release_lock();
 		return rc;
@@ -560,11 +693,14 @@ defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 		 * New upload.
 		 */
 #ifdef CONFIG_IMG_ENABLE_IMAGE_CHECK
-		struct flash_img_context ctx;
+		static struct flash_img_context ctx;
 		struct flash_img_check fic;
 #endif
 
 		g_img_mgmt_state.off = 0;
+#if CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW > 0
+		img_mgmt_window_clear();
+#endif
 
 #if defined(CONFIG_MCUMGR_GRP_IMG_STATUS_HOOKS)
 		(void)mgmt_callback_notify(MGMT_EVT_OP_IMG_MGMT_DFU_STARTED, NULL, 0, &err_rc,
@@ -585,16 +721,23 @@ defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 		memset(&g_img_mgmt_state.data_sha[req.data_sha.len], 0,
 			   IMG_MGMT_DATA_SHA_LEN - req.data_sha.len);
 
+#ifdef CONFIG_IMG_DECODE
+		/* Verification is made on the decoded image */
+		g_img_mgmt_state.format = action.format;
+		g_img_mgmt_state.image_size = action.image_size;
+		memcpy(g_img_mgmt_state.image_sha, action.image_sha, IMG_MGMT_DATA_SHA_LEN);
+#endif
+#ifdef CONFIG_IMG_DELTA
+		g_img_mgmt_state.src_area_id = action.src_area_id;
+#endif
+
 #ifdef CONFIG_IMG_ENABLE_IMAGE_CHECK
 		/* Check if the existing image hash matches the hash of the underlying data,
 		 * this check can only be performed if the provided hash is a full SHA256 hash
 		 * of the file that is being uploaded, do not attempt the check if the length
 		 * of the provided hash is less.
 		 */
-		if (g_img_mgmt_state.data_sha_len == IMG_MGMT_DATA_SHA_LEN) {
-			fic.match = g_img_mgmt_state.data_sha;
-			fic.clen = g_img_mgmt_state.size;
-
+		if (img_mgmt_upload_check_get(&fic)) {
 			if (flash_img_check(&ctx, &fic, g_img_mgmt_state.area_id) == 0) {
 				/* Underlying data already matches, no need to upload any more,
 				 * set offset to image size so client knows upload has finished.
@@ -616,7 +759,7 @@ defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 #ifndef CONFIG_IMG_ERASE_PROGRESSIVELY
 		/* erase the entire req.size all at once */
 		if (action.erase) {
-			rc = img_mgmt_erase_image_data(0, req.size);
+			rc = img_mgmt_erase_image_data(0, img_mgmt_upload_image_size());
 			if (rc != 0) {
 				IMG_MGMT_UPLOAD_ACTION_SET_RC_RSN(&action,
 					img_mgmt_err_str_flash_erase_failed);
@@ -642,7 +785,12 @@ defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 						    last);
 		if (rc == 0) {
 			g_img_mgmt_state.off += action.write_bytes;
-		} else {
+#if CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW > 0
+			rc = img_mgmt_window_drain(&last);
+#endif
+		}
+
+		if (rc != 0) {
 			/* Write failed, currently not able to recover from this */
 #if defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 			cmd_status_arg.status = IMG_MGMT_ID_UPLOAD_STATUS_COMPLETE;
@@ -666,13 +814,10 @@ defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 
 #ifdef CONFIG_IMG_ENABLE_IMAGE_CHECK
 			static struct flash_img_context ctx;
+			struct flash_img_check fic;
 
+			(void)img_mgmt_upload_check_get(&fic);
 			if (flash_img_init_id(&ctx, g_img_mgmt_state.area_id) == 0) {
-				struct flash_img_check fic = {
-					.match = g_img_mgmt_state.data_sha,
-					.clen = g_img_mgmt_state.size,
-				};
-
 				if (flash_img_check(&ctx, &fic, g_img_mgmt_state.area_id) == 0) {
 					data_match = true;
 				} else {
@@ -13,6 +13,7 @@
 #include <zephyr/logging/log.h>
 #include <bootutil/bootutil_public.h>
 #include <assert.h>
+#include <zephyr/sys/byteorder.h>
 
 #include <zephyr/mgmt/mcumgr/mgmt/mgmt.h>
 #include <zephyr/mgmt/mcumgr/grp/img_mgmt/img_mgmt.h>
@@ -51,6 +52,13 @@ BUILD_ASSERT(FIXED_PARTITION_EXISTS(SLOT4_PARTITION) &&
 	     "Missing partitions?");
 #endif
 
+#ifdef CONFIG_IMG_LZ4
+/* Decompressed to inspect an LZ4 compressed image: enough for the header of
+ * a delta image followed by the insertion of the image header.
+ */
+#define IMG_MGMT_DECODE_PEEK_LEN 160
+#endif
+
 /**
  * Determines if the specified area of flash is completely unwritten.
  *
@@ -372,6 +380,28 @@ int img_mgmt_read(int slot, unsigned int offset, void *dst, unsigned int num_byt
 	return 0;
 }
 
+static int img_mgmt_flash_img_write(struct flash_img_context *ctx, const uint8_t *data,
+				    size_t len, bool last)
+{
+#ifdef CONFIG_IMG_LZ4
+	if (g_img_mgmt_state.format == IMG_MGMT_UPLOAD_FORMAT_LZ4) {
+		return flash_img_lz4_buffered_write(ctx, data, len, last);
+	}
+#endif
+#ifdef CONFIG_IMG_DELTA
+	if (g_img_mgmt_state.format == IMG_MGMT_UPLOAD_FORMAT_DELTA) {
+		return flash_img_delta_buffered_write(ctx, data, len, last);
+	}
+#endif
+#if defined(CONFIG_IMG_LZ4) && defined(CONFIG_IMG_DELTA)
+	if (g_img_mgmt_state.format == IMG_MGMT_UPLOAD_FORMAT_LZ4_DELTA) {
+		return flash_img_lz4_delta_buffered_write(ctx, data, len, last);
+	}
+#endif
+
+	return flash_img_buffered_write(ctx, data, len, last);
+}
+
 #if defined(CONFIG_MCUMGR_GRP_IMG_USE_HEAP_FOR_FLASH_IMG_CONTEXT)
 int img_mgmt_write_image_data(unsigned int offset, const void *data, unsigned int num_bytes,
 			      bool last)
@@ -405,9 +435,12 @@ int img_mgmt_write_image_data(unsigned int offset, const void *data, unsigned in
 			rc = IMG_MGMT_ERR_FLASH_OPEN_FAILED;
 			goto out;
 		}
+#ifdef CONFIG_IMG_DELTA
+		flash_img_delta_source_set(ctx, g_img_mgmt_state.src_area_id);
+#endif
 	}
 
-	if (flash_img_buffered_write(ctx, data, num_bytes, last) != 0) {
+	if (img_mgmt_flash_img_write(ctx, data, num_bytes, last) != 0) {
 		rc = IMG_MGMT_ERR_FLASH_WRITE_FAILED;
 		goto out;
 	}
@@ -430,9 +463,12 @@ int img_mgmt_write_image_data(unsigned int offset, const void *data, unsigned in
 		if (flash_img_init_id(&ctx, g_img_mgmt_state.area_id) != 0) {
 			return IMG_MGMT_ERR_FLASH_OPEN_FAILED;
 		}
+#ifdef CONFIG_IMG_DELTA
+		flash_img_delta_source_set(&ctx, g_img_mgmt_state.src_area_id);
+#endif
 	}
 
-	if (flash_img_buffered_write(&ctx, data, num_bytes, last) != 0) {
+	if (img_mgmt_flash_img_write(&ctx, data, num_bytes, last) != 0) {
 		return IMG_MGMT_ERR_FLASH_WRITE_FAILED;
 	}
 
@@ -538,6 +574,55 @@ int img_mgmt_swap_type(int slot)
 	}
 }
 
+#ifdef CONFIG_IMG_DELTA
+/*
+ * Checks that a delta image applies to the image of the active slot, and gets
+ * the header, the size and the hash of the image it produces.
+ */
+static int img_mgmt_delta_inspect(int image, const uint8_t *data, size_t len,
+				  struct img_mgmt_upload_action *action,
+				  struct image_header *img_hdr)
+{
+	static struct flash_img_context ctx;
+	struct flash_img_delta_hdr delta_hdr;
+	struct flash_img_check fic;
+	int src_area_id;
+
+#if defined(CONFIG_MCUMGR_GRP_IMG_DIRECT_UPLOAD)
+	/* Image numbers are slot numbers shifted by one, 0 selects image 0 */
+	if (image > 0) {
+		image = (image - 1) >> 1;
+	}
+#endif
+
+	src_area_id = img_mgmt_flash_area_id(img_mgmt_active_slot(image));
+	if (src_area_id < 0) {
+		return IMG_MGMT_ERR_ACTIVE_SLOT_NOT_KNOWN;
+	}
+
+	if (flash_img_delta_peek(data, len, src_area_id, &delta_hdr, img_hdr,
+				 sizeof(*img_hdr)) != 0) {
+		IMG_MGMT_UPLOAD_ACTION_SET_RC_RSN(action, img_mgmt_err_str_hdr_malformed);
+		return IMG_MGMT_ERR_INVALID_IMAGE_HEADER;
+	}
+
+	fic.match = delta_hdr.src_sha256;
+	fic.clen = delta_hdr.src_size;
+	if (flash_img_check(&ctx, &fic, src_area_id) != 0) {
+		IMG_MGMT_UPLOAD_ACTION_SET_RC_RSN(action,
+			img_mgmt_err_str_delta_source_mismatch);
+		LOG_ERR("Delta image does not apply to the active image");
+		return IMG_MGMT_ERR_DELTA_SOURCE_MISMATCH;
+	}
+
+	action->src_area_id = src_area_id;
+	action->image_size = delta_hdr.size;
+	memcpy(action->image_sha, delta_hdr.sha256, IMG_MGMT_DATA_SHA_LEN);
+
+	return IMG_MGMT_ERR_OK;
+}
+#endif
+
 /**
  * Verifies an upload request and indicates the actions that should be taken
  * during processing of the request.  This is a "read only" function in the
@@ -556,6 +641,7 @@ int img_mgmt_upload_inspect(const struct img_mgmt_upload_req *req,
 {
 	const struct image_header *hdr;
 	struct image_version cur_ver;
+	size_t image_size;
 	int rc;
 
 	memset(action, 0, sizeof(*action));
@@ -595,8 +681,56 @@ int img_mgmt_upload_inspect(const struct img_mgmt_upload_req *req,
 		}
 
 		action->size = req->size;
+		image_size = req->size;
 
 		hdr = (struct image_header *)req->img_data.value;
+#ifdef CONFIG_IMG_DECODE
+		/* Checks are made on the decoded image */
+		const uint8_t *data = req->img_data.value;
+		size_t data_len = req->img_data.len;
+		struct image_header decoded_hdr;
+#endif
+#ifdef CONFIG_IMG_LZ4
+		struct flash_img_lz4_hdr lz4_hdr;
+		uint8_t lz4_data[IMG_MGMT_DECODE_PEEK_LEN];
+		int lz4_len;
+
+		if (sys_get_le32(data) == FLASH_IMG_LZ4_MAGIC) {
+			lz4_len = flash_img_lz4_peek(data, data_len, &lz4_hdr, lz4_data,
+						     sizeof(lz4_data));
+			if (lz4_len < (int)sizeof(decoded_hdr)) {
+				IMG_MGMT_UPLOAD_ACTION_SET_RC_RSN(action,
+					img_mgmt_err_str_hdr_malformed);
+				return IMG_MGMT_ERR_INVALID_IMAGE_HEADER;
+			}
+
+			memcpy(&decoded_hdr, lz4_data, sizeof(decoded_hdr));
+			hdr = &decoded_hdr;
+			image_size = lz4_hdr.size;
+			action->format = IMG_MGMT_UPLOAD_FORMAT_LZ4;
+			action->image_size = lz4_hdr.size;
+			memcpy(action->image_sha, lz4_hdr.sha256, IMG_MGMT_DATA_SHA_LEN);
+
+			/* A compressed delta image is inspected as a delta image */
+			data = lz4_data;
+			data_len = lz4_len;
+		}
+#endif
+#ifdef CONFIG_IMG_DELTA
+		if (sys_get_le32(data) == FLASH_IMG_DELTA_MAGIC) {
+			rc = img_mgmt_delta_inspect(req->image, data, data_len, action,
+						    &decoded_hdr);
+			if (rc != 0) {
+				return rc;
+			}
+
+			hdr = &decoded_hdr;
+			image_size = action->image_size;
+			action->format = (action->format == IMG_MGMT_UPLOAD_FORMAT_LZ4) ?
+					 IMG_MGMT_UPLOAD_FORMAT_LZ4_DELTA :
+					 IMG_MGMT_UPLOAD_FORMAT_DELTA;
+		}
+#endif
 		if (hdr->ih_magic != IMAGE_MAGIC) {
 			IMG_MGMT_UPLOAD_ACTION_SET_RC_RSN(action, img_mgmt_err_str_magic_mismatch);
 			return IMG_MGMT_ERR_INVALID_IMAGE_HEADER_MAGIC;
@@ -636,11 +770,11 @@ int img_mgmt_upload_inspect(const struct img_mgmt_upload_req *req,
 		}
 
 		/* Check that the area is of sufficient size to store the new image */
-		if (req->size > fa->fa_size) {
+		if (image_size > fa->fa_size) {
 			IMG_MGMT_UPLOAD_ACTION_SET_RC_RSN(action,
 				img_mgmt_err_str_image_too_large);
 			flash_area_close(fa);
-			LOG_ERR("Upload too large for slot: %u > %u", req->size, fa->fa_size);
+			LOG_ERR("Upload too large for slot: %u > %u", image_size, fa->fa_size);
 			return IMG_MGMT_ERR_INVALID_IMAGE_TOO_LARGE;
 		}
 
@@ -685,11 +819,11 @@ int img_mgmt_upload_inspect(const struct img_mgmt_upload_req *req,
 			goto skip_size_check;
 		}
 
-		if (req->size > (fa->fa_size - CONFIG_MCUBOOT_UPDATE_FOOTER_SIZE)) {
+		if (image_size > (fa->fa_size - CONFIG_MCUBOOT_UPDATE_FOOTER_SIZE)) {
 			IMG_MGMT_UPLOAD_ACTION_SET_RC_RSN(action,
 				img_mgmt_err_str_image_too_large);
 			flash_area_close(fa);
-			LOG_ERR("Upload too large for slot (with end offset): %u > %u", req->size,
+			LOG_ERR("Upload too large for slot (with end offset): %u > %u", image_size,
 				(fa->fa_size - CONFIG_MCUBOOT_UPDATE_FOOTER_SIZE));
 			return IMG_MGMT_ERR_INVALID_IMAGE_TOO_LARGE;
 		}
@@ -700,12 +834,12 @@ skip_size_check:
 				   sizeof(max_image_size));
 
 		if (rc == sizeof(max_image_size) && max_image_size > 0 &&
-		    req->size > max_image_size) {
+		    image_size > max_image_size) {
 			IMG_MGMT_UPLOAD_ACTION_SET_RC_RSN(action,
 				img_mgmt_err_str_image_too_large);
 			flash_area_close(fa);
 			LOG_ERR("Upload too large for slot (with max image size): %u > %u",
-				req->size, max_image_size);
+				image_size, max_image_size);
 			return IMG_MGMT_ERR_INVALID_IMAGE_TOO_LARGE;
 		}
 #endif
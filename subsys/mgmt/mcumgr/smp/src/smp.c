@@ -339,6 +339,10 @@ static void smp_on_err(struct smp_streamer *streamer, const struct smp_hdr *req_
 	 * response buffer was allocated, use the request buffer instead.
 	 */
 	if (rsp == NULL) {
+		if (req == NULL) {
+			/* Both were released when the response was sent */
+			return;
+		}
 		rsp = req;
 		req = NULL;
 	}
@@ -396,7 +400,7 @@ int smp_process_request_packet(struct smp_streamer *streamer, void *vreq)
 
 	rsp = NULL;
 
-	while (req->len > 0) {
+	while ((req != NULL) && (req->len > 0)) {
 		handler_found = false;
 		valid_hdr = false;
 
@@ -433,6 +437,15 @@ int smp_process_request_packet(struct smp_streamer *streamer, void *vreq)
 				break;
 			}
 
+			/* Release the request ahead of the response when it holds no other
+			 * message: a transport blocking in output() until the response is
+			 * transmitted can then reassemble the next request in the buffer.
+			 */
+			if (req->len == req_hdr.nh_len) {
+				smp_free_buf(req, streamer->smpt);
+				req = NULL;
+			}
+
 			/* Send the response. */
 			rc = streamer->smpt->functions.output(rsp);
 			rsp = NULL;
@@ -455,7 +468,9 @@ int smp_process_request_packet(struct smp_streamer *streamer, void *vreq)
 			break;
 		}
 		/* Trim processed request to free up space for subsequent responses. */
-		net_buf_pull(req, req_hdr.nh_len);
+		if (req != NULL) {
+			net_buf_pull(req, req_hdr.nh_len);
+		}
 
 #if defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 		cmd_done_arg.group = req_hdr.nh_group;
@@ -0,0 +1,291 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <new>
+
+#include <zephyr/init.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ml/inference.h>
+#include <zephyr/sys/atomic.h>
+
+#ifdef CONFIG_MEM_ATTR_HEAP
+#include <zephyr/mem_mgmt/mem_attr_heap.h>
+#endif
+
+#include <tensorflow/lite/micro/micro_interpreter.h>
+#include <tensorflow/lite/micro/micro_mutable_op_resolver.h>
+#include <tensorflow/lite/schema/schema_generated.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(ml_inference, CONFIG_ML_INFERENCE_LOG_LEVEL);
+
+#define ML_ARENA_ALIGN 16
+
+struct ml_session {
+	const struct ml_model *model;
+	uint8_t *arena;
+	tflite::MicroInterpreter *interpreter;
+	/* Set while an inference is pending or running */
+	atomic_t busy;
+	alignas(tflite::MicroInterpreter) uint8_t storage[sizeof(tflite::MicroInterpreter)];
+};
+
+static struct ml_session sessions[CONFIG_ML_INFERENCE_MAX_SESSIONS];
+static K_MUTEX_DEFINE(sessions_lock);
+static K_FIFO_DEFINE(infer_fifo);
+
+#ifdef CONFIG_ARM_ETHOS_U
+static tflite::MicroMutableOpResolver<1> ethosu_resolver;
+#endif
+
+#ifndef CONFIG_MEM_ATTR_HEAP
+K_HEAP_DEFINE(ml_arena_pool, CONFIG_ML_INFERENCE_ARENA_POOL_SIZE);
+#endif
+
+/*
+ * The arenas only live as long as their session: the memory of a closed
+ * session goes to the next model opened.
+ */
+static uint8_t *arena_alloc(const struct ml_model *model)
+{
+#ifdef CONFIG_MEM_ATTR_HEAP
+	return static_cast<uint8_t *>(mem_attr_heap_policy_alloc(model->arena_attr,
+								 MEM_ATTR_HEAP_POLICY_SPILL,
+								 ML_ARENA_ALIGN,
+								 model->arena_size));
+#else
+	return static_cast<uint8_t *>(k_heap_aligned_alloc(&ml_arena_pool, ML_ARENA_ALIGN,
+							   model->arena_size, K_NO_WAIT));
+#endif
+}
+
+static void arena_free(uint8_t *arena)
+{
+#ifdef CONFIG_MEM_ATTR_HEAP
+	mem_attr_heap_free(arena);
+#else
+	k_heap_free(&ml_arena_pool, arena);
+#endif
+}
+
+static const tflite::MicroOpResolver *model_resolver(const struct ml_model *model)
+{
+	if (model->op_resolver != NULL) {
+		return static_cast<const tflite::MicroOpResolver *>(model->op_resolver);
+	}
+
+#ifdef CONFIG_ARM_ETHOS_U
+	return &ethosu_resolver;
+#else
+	return nullptr;
+#endif
+}
+
+int ml_session_open(const struct ml_model *model, struct ml_session **session)
+{
+	const tflite::MicroOpResolver *resolver = model_resolver(model);
+	const tflite::Model *tfl_model = tflite::GetModel(model->data);
+	struct ml_session *s = NULL;
+	int ret;
+
+	if (tfl_model->version() != TFLITE_SCHEMA_VERSION) {
+		LOG_ERR("%s: unsupported schema version %u", model->name, tfl_model->version());
+		return -ENOTSUP;
+	}
+
+	if (resolver == nullptr) {
+		LOG_ERR("%s: no operator resolver", model->name);
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&sessions_lock, K_FOREVER);
+
+	for (size_t i = 0; i < ARRAY_SIZE(sessions); i++) {
+		if (sessions[i].model == NULL) {
+			s = &sessions[i];
+			break;
+		}
+	}
+
+	if (s == NULL) {
+		ret = -ENOMEM;
+		goto out;
+	}
+
+	s->arena = arena_alloc(model);
+	if (s->arena == NULL) {
+		LOG_ERR("%s: no memory for a %zu bytes arena", model->name, model->arena_size);
+		ret = -ENOMEM;
+		goto out;
+	}
+
+	s->interpreter = new (s->storage) tflite::MicroInterpreter(tfl_model, *resolver, s->arena,
+								    model->arena_size);
+	if (s->interpreter->AllocateTensors() != kTfLiteOk) {
+		LOG_ERR("%s: tensor allocation failed", model->name);
+		s->interpreter->~MicroInterpreter();
+		arena_free(s->arena);
+		ret = -EINVAL;
+		goto out;
+	}
+
+	LOG_DBG("%s: %zu bytes of the arena used", model->name,
+		s->interpreter->arena_used_bytes());
+
+	atomic_clear(&s->busy);
+	s->model = model;
+	*session = s;
+	ret = 0;
+
+out:
+	k_mutex_unlock(&sessions_lock);
+
+	return ret;
+}
+
+int ml_session_close(struct ml_session *session)
+{
+	if (!atomic_cas(&session->busy, 0, 1)) {
+		return -EBUSY;
+	}
+
+	k_mutex_lock(&sessions_lock, K_FOREVER);
+
+	session->interpreter->~MicroInterpreter();
+	session->interpreter = nullptr;
+	arena_free(session->arena);
+	session->arena = NULL;
+	session->model = NULL;
+
+	k_mutex_unlock(&sessions_lock);
+
+	return 0;
+}
+
+static int tensor_get(TfLiteTensor *t, struct ml_tensor *tensor)
+{
+	if (t == nullptr) {
+		return -EINVAL;
+	}
+
+	tensor->data = t->data.data;
+	tensor->bytes = t->bytes;
+
+	return 0;
+}
+
+int ml_session_input(struct ml_session *session, size_t index, struct ml_tensor *tensor)
+{
+	if (index >= session->interpreter->inputs_size()) {
+		return -EINVAL;
+	}
+
+	return tensor_get(session->interpreter->input(index), tensor);
+}
+
+int ml_session_output(struct ml_session *session, size_t index, struct ml_tensor *tensor)
+{
+	if (index >= session->interpreter->outputs_size()) {
+		return -EINVAL;
+	}
+
+	return tensor_get(session->interpreter->output(index), tensor);
+}
+
+size_t ml_session_arena_used(struct ml_session *session)
+{
+	return session->interpreter->arena_used_bytes();
+}
+
+static int session_invoke(struct ml_session *session)
+{
+	if (session->interpreter->Invoke() != kTfLiteOk) {
+		LOG_ERR("%s: inference failed", session->model->name);
+		return -EIO;
+	}
+
+	return 0;
+}
+
+int ml_infer(struct ml_session *session)
+{
+	int ret;
+
+	if (!atomic_cas(&session->busy, 0, 1)) {
+		return -EBUSY;
+	}
+
+	ret = session_invoke(session);
+	atomic_clear(&session->busy);
+
+	return ret;
+}
+
+int ml_infer_submit(struct ml_infer_req *req)
+{
+	if (!atomic_cas(&req->session->busy, 0, 1)) {
+		return -EBUSY;
+	}
+
+	k_fifo_put(&infer_fifo, req);
+
+	return 0;
+}
+
+/*
+ * The Ethos-U operator waits for the NPU on a semaphore given by its IRQ:
+ * one thread per NPU keeps them all busy.
+ */
+static void infer_thread(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		struct ml_infer_req *req =
+			static_cast<struct ml_infer_req *>(k_fifo_get(&infer_fifo, K_FOREVER));
+		struct ml_session *session = req->session;
+		int ret;
+
+		ret = session_invoke(session);
+
+		/* The request may be submitted again from its callback */
+		atomic_clear(&session->busy);
+		req->cb(req, ret);
+	}
+}
+
+static K_THREAD_STACK_ARRAY_DEFINE(infer_stacks, CONFIG_ML_INFERENCE_THREADS,
+				   CONFIG_ML_INFERENCE_THREAD_STACK_SIZE);
+static struct k_thread infer_threads[CONFIG_ML_INFERENCE_THREADS];
+
+static int ml_inference_init(void)
+{
+#ifdef CONFIG_MEM_ATTR_HEAP
+	int ret = mem_attr_heap_pool_init();
+
+	if (ret < 0 && ret != -EALREADY) {
+		return ret;
+	}
+#endif
+
+#ifdef CONFIG_ARM_ETHOS_U
+	ethosu_resolver.AddEthosU();
+#endif
+
+	for (size_t i = 0; i < ARRAY_SIZE(infer_threads); i++) {
+		k_thread_create(&infer_threads[i], infer_stacks[i],
+				K_THREAD_STACK_SIZEOF(infer_stacks[i]), infer_thread, NULL, NULL,
+				NULL, CONFIG_ML_INFERENCE_THREAD_PRIORITY, 0, K_NO_WAIT);
+		k_thread_name_set(&infer_threads[i], "ml_infer");
+	}
+
+	return 0;
+}
+
+SYS_INIT(ml_inference_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
@@ -212,6 +212,38 @@ static int modem_backend_uart_async_receive(void *data, uint8_t *buf, size_t siz
 	return (int)received;
 }
 
+static int modem_backend_uart_async_receive_claim(void *data, uint8_t **buf)
+{
+	struct modem_backend_uart *backend = (struct modem_backend_uart *)data;
+	k_spinlock_key_t key;
+	uint32_t claimed;
+
+	key = k_spin_lock(&backend->async.receive_rb_lock);
+	claimed = ring_buf_get_claim(&backend->async.receive_rb, buf, UINT32_MAX);
+	k_spin_unlock(&backend->async.receive_rb_lock, key);
+
+	return (int)claimed;
+}
+
+static int modem_backend_uart_async_receive_finish(void *data, size_t size)
+{
+	struct modem_backend_uart *backend = (struct modem_backend_uart *)data;
+	k_spinlock_key_t key;
+	bool empty;
+	int ret;
+
+	key = k_spin_lock(&backend->async.receive_rb_lock);
+	ret = ring_buf_get_finish(&backend->async.receive_rb, size);
+	empty = ring_buf_is_empty(&backend->async.receive_rb);
+	k_spin_unlock(&backend->async.receive_rb_lock, key);
+
+	if (!empty) {
+		k_work_submit(&backend->receive_ready_work);
+	}
+
+	return ret;
+}
+
 static int modem_backend_uart_async_close(void *data)
 {
 	struct modem_backend_uart *backend = (struct modem_backend_uart *)data;
@@ -226,6 +258,8 @@ struct modem_pipe_api modem_backend_uart_async_api = {
 	.transmit = modem_backend_uart_async_transmit,
 	.receive = modem_backend_uart_async_receive,
 	.close = modem_backend_uart_async_close,
+	.receive_claim = modem_backend_uart_async_receive_claim,
+	.receive_finish = modem_backend_uart_async_receive_finish,
 };
 
 bool modem_backend_uart_async_is_supported(struct modem_backend_uart *backend)
@@ -8,12 +8,10 @@
 LOG_MODULE_REGISTER(modem_cmux, CONFIG_MODEM_CMUX_LOG_LEVEL);
 
 #include <zephyr/kernel.h>
-#include <zephyr/sys/crc.h>
 #include <zephyr/modem/cmux.h>
 
 #include <string.h>
 
-#define MODEM_CMUX_FCS_POLYNOMIAL		(0xE0)
 #define MODEM_CMUX_FCS_INIT_VALUE		(0xFF)
 #define MODEM_CMUX_EA				(0x01)
 #define MODEM_CMUX_CR				(0x02)
@@ -192,6 +190,51 @@ static void modem_cmux_raise_event(struct modem_cmux *cmux, enum modem_cmux_even
 	cmux->callback(cmux, event, cmux->user_data);
 }
 
+/* Reversed CRC-8 with polynomial 0xE0, table from 3GPP TS 27.010 Annex B */
+static const uint8_t modem_cmux_fcs_table[256] = {
+	0x00, 0x91, 0xE3, 0x72, 0x07, 0x96, 0xE4, 0x75,
+	0x0E, 0x9F, 0xED, 0x7C, 0x09, 0x98, 0xEA, 0x7B,
+	0x1C, 0x8D, 0xFF, 0x6E, 0x1B, 0x8A, 0xF8, 0x69,
+	0x12, 0x83, 0xF1, 0x60, 0x15, 0x84, 0xF6, 0x67,
+	0x38, 0xA9, 0xDB, 0x4A, 0x3F, 0xAE, 0xDC, 0x4D,
+	0x36, 0xA7, 0xD5, 0x44, 0x31, 0xA0, 0xD2, 0x43,
+	0x24, 0xB5, 0xC7, 0x56, 0x23, 0xB2, 0xC0, 0x51,
+	0x2A, 0xBB, 0xC9, 0x58, 0x2D, 0xBC, 0xCE, 0x5F,
+	0x70, 0xE1, 0x93, 0x02, 0x77, 0xE6, 0x94, 0x05,
+	0x7E, 0xEF, 0x9D, 0x0C, 0x79, 0xE8, 0x9A, 0x0B,
+	0x6C, 0xFD, 0x8F, 0x1E, 0x6B, 0xFA, 0x88, 0x19,
+	0x62, 0xF3, 0x81, 0x10, 0x65, 0xF4, 0x86, 0x17,
+	0x48, 0xD9, 0xAB, 0x3A, 0x4F, 0xDE, 0xAC, 0x3D,
+	0x46, 0xD7, 0xA5, 0x34, 0x41, 0xD0, 0xA2, 0x33,
+	0x54, 0xC5, 0xB7, 0x26, 0x53, 0xC2, 0xB0, 0x21,
+	0x5A, 0xCB, 0xB9, 0x28, 0x5D, 0xCC, 0xBE, 0x2F,
+	0xE0, 0x71, 0x03, 0x92, 0xE7, 0x76, 0x04, 0x95,
+	0xEE, 0x7F, 0x0D, 0x9C, 0xE9, 0x78, 0x0A, 0x9B,
+	0xFC, 0x6D, 0x1F, 0x8E, 0xFB, 0x6A, 0x18, 0x89,
+	0xF2, 0x63, 0x11, 0x80, 0xF5, 0x64, 0x16, 0x87,
+	0xD8, 0x49, 0x3B, 0xAA, 0xDF, 0x4E, 0x3C, 0xAD,
+	0xD6, 0x47, 0x35, 0xA4, 0xD1, 0x40, 0x32, 0xA3,
+	0xC4, 0x55, 0x27, 0xB6, 0xC3, 0x52, 0x20, 0xB1,
+	0xCA, 0x5B, 0x29, 0xB8, 0xCD, 0x5C, 0x2E, 0xBF,
+	0x90, 0x01, 0x73, 0xE2, 0x97, 0x06, 0x74, 0xE5,
+	0x9E, 0x0F, 0x7D, 0xEC, 0x99, 0x08, 0x7A, 0xEB,
+	0x8C, 0x1D, 0x6F, 0xFE, 0x8B, 0x1A, 0x68, 0xF9,
+	0x82, 0x13, 0x61, 0xF0, 0x85, 0x14, 0x66, 0xF7,
+	0xA8, 0x39, 0x4B, 0xDA, 0xAF, 0x3E, 0x4C, 0xDD,
+	0xA6, 0x37, 0x45, 0xD4, 0xA1, 0x30, 0x42, 0xD3,
+	0xB4, 0x25, 0x57, 0xC6, 0xB3, 0x22, 0x50, 0xC1,
+	0xBA, 0x2B, 0x59, 0xC8, 0xBD, 0x2C, 0x5E, 0xCF,
+};
+
+static uint8_t modem_cmux_fcs(const uint8_t *buf, size_t len, uint8_t fcs)
+{
+	for (size_t i = 0; i < len; i++) {
+		fcs = modem_cmux_fcs_table[fcs ^ buf[i]];
+	}
+
+	return fcs;
+}
+
 static void modem_cmux_bus_callback(struct modem_pipe *pipe, enum modem_pipe_event event,
 				    void *user_data)
 {
@@ -243,14 +286,13 @@ static uint16_t modem_cmux_transmit_frame(struct modem_cmux *cmux,
 	}
 
 	/* Compute FCS for the header (exclude SOF) */
-	fcs = crc8(&buf[1], (buf_idx - 1), MODEM_CMUX_FCS_POLYNOMIAL, MODEM_CMUX_FCS_INIT_VALUE,
-		   true);
+	fcs = modem_cmux_fcs(&buf[1], (buf_idx - 1), MODEM_CMUX_FCS_INIT_VALUE);
 
 	/* FCS final */
 	if (frame->type == MODEM_CMUX_FRAME_TYPE_UIH) {
 		fcs = 0xFF - fcs;
 	} else {
-		fcs = 0xFF - crc8(frame->data, data_len, MODEM_CMUX_FCS_POLYNOMIAL, fcs, true);
+		fcs = 0xFF - modem_cmux_fcs(frame->data, data_len, fcs);
 	}
 
 	/* Frame header */
@@ -263,7 +305,6 @@ static uint16_t modem_cmux_transmit_frame(struct modem_cmux *cmux,
 	buf[0] = fcs;
 	buf[1] = 0xF9;
 	ring_buf_put(&cmux->transmit_rb, buf, 2);
-	k_work_schedule(&cmux->transmit_work, K_NO_WAIT);
 	return data_len;
 }
 
@@ -287,6 +328,9 @@ static bool modem_cmux_transmit_cmd_frame(struct modem_cmux *cmux,
 	}
 
 	modem_cmux_transmit_frame(cmux, frame);
+
+	/* Command frames are not delayed, this also flushes pending data frames */
+	k_work_reschedule(&cmux->transmit_work, K_NO_WAIT);
 	k_mutex_unlock(&cmux->transmit_rb_lock);
 	return true;
 }
@@ -320,6 +364,19 @@ static int16_t modem_cmux_transmit_data_frame(struct modem_cmux *cmux,
 
 	modem_cmux_log_transmit_frame(frame);
 	ret = modem_cmux_transmit_frame(cmux, frame);
+
+	/*
+	 * Data frames are held back for a short while to be transmitted together with
+	 * frames which follow, unless the transmit buffer is filling up.
+	 */
+	if (ring_buf_size_get(&cmux->transmit_rb) <
+	    (ring_buf_capacity_get(&cmux->transmit_rb) / 2)) {
+		k_work_schedule(&cmux->transmit_work,
+				K_MSEC(CONFIG_MODEM_CMUX_TRANSMIT_BATCH_DELAY_MS));
+	} else {
+		k_work_reschedule(&cmux->transmit_work, K_NO_WAIT);
+	}
+
 	k_mutex_unlock(&cmux->transmit_rb_lock);
 	return ret;
 }
@@ -775,15 +832,13 @@ static void modem_cmux_process_received_byte(struct modem_cmux *cmux, uint8_t by
 	case MODEM_CMUX_RECEIVE_STATE_FCS:
 		/* Compute FCS */
 		if (cmux->frame.type == MODEM_CMUX_FRAME_TYPE_UIH) {
-			fcs = 0xFF - crc8(cmux->frame_header, cmux->frame_header_len,
-					  MODEM_CMUX_FCS_POLYNOMIAL, MODEM_CMUX_FCS_INIT_VALUE,
-					  true);
+			fcs = 0xFF - modem_cmux_fcs(cmux->frame_header, cmux->frame_header_len,
+						    MODEM_CMUX_FCS_INIT_VALUE);
 		} else {
-			fcs = crc8(cmux->frame_header, cmux->frame_header_len,
-				   MODEM_CMUX_FCS_POLYNOMIAL, MODEM_CMUX_FCS_INIT_VALUE, true);
+			fcs = modem_cmux_fcs(cmux->frame_header, cmux->frame_header_len,
+					     MODEM_CMUX_FCS_INIT_VALUE);
 
-			fcs = 0xFF - crc8(cmux->frame.data, cmux->frame.data_len,
-					  MODEM_CMUX_FCS_POLYNOMIAL, fcs, true);
+			fcs = 0xFF - modem_cmux_fcs(cmux->receive_buf, cmux->frame.data_len, fcs);
 		}
 
 		/* Validate FCS */
@@ -824,13 +879,59 @@ static void modem_cmux_process_received_byte(struct modem_cmux *cmux, uint8_t by
 	}
 }
 
+static void modem_cmux_process_received_data(struct modem_cmux *cmux, const uint8_t *data,
+					     size_t size)
+{
+	size_t i = 0;
+	size_t copy;
+
+	while (i < size) {
+		if ((cmux->receive_state != MODEM_CMUX_RECEIVE_STATE_DATA) ||
+		    (cmux->frame.data_len <= cmux->receive_buf_len)) {
+			modem_cmux_process_received_byte(cmux, data[i]);
+			i++;
+			continue;
+		}
+
+		/*
+		 * Copy the data field in bulk, the last byte of the run is passed
+		 * through the state machine which checks for end of data and overrun.
+		 */
+		copy = MIN(size - i, cmux->frame.data_len - cmux->receive_buf_len);
+		copy = MIN(copy, cmux->receive_buf_size - cmux->receive_buf_len);
+
+		if (copy > 1) {
+			memcpy(&cmux->receive_buf[cmux->receive_buf_len], &data[i], copy - 1);
+			cmux->receive_buf_len += copy - 1;
+			i += copy - 1;
+		}
+
+		modem_cmux_process_received_byte(cmux, data[i]);
+		i++;
+	}
+}
+
 static void modem_cmux_receive_handler(struct k_work *item)
 {
 	struct k_work_delayable *dwork = k_work_delayable_from_work(item);
 	struct modem_cmux *cmux = CONTAINER_OF(dwork, struct modem_cmux, receive_work);
+	uint8_t *claimed;
 	uint8_t buf[16];
 	int ret;
 
+	/* Process received data in place if supported by pipe */
+	ret = modem_pipe_receive_claim(cmux->pipe, &claimed);
+	if (ret != -ENOTSUP) {
+		if (ret < 1) {
+			return;
+		}
+
+		modem_cmux_process_received_data(cmux, claimed, (size_t)ret);
+		modem_pipe_receive_finish(cmux->pipe, (size_t)ret);
+		k_work_schedule(&cmux->receive_work, K_NO_WAIT);
+		return;
+	}
+
 	/* Receive data from pipe */
 	ret = modem_pipe_receive(cmux->pipe, buf, sizeof(buf));
 	if (ret < 1) {
@@ -838,9 +939,7 @@ static void modem_cmux_receive_handler(struct k_work *item)
 	}
 
 	/* Process received data */
-	for (uint16_t i = 0; i < (uint16_t)ret; i++) {
-		modem_cmux_process_received_byte(cmux, buf[i]);
-	}
+	modem_cmux_process_received_data(cmux, buf, (size_t)ret);
 
 	/* Reschedule received work */
 	k_work_schedule(&cmux->receive_work, K_NO_WAIT);
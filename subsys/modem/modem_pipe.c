@@ -124,6 +124,41 @@ int modem_pipe_receive(struct modem_pipe *pipe, uint8_t *buf, size_t size)
 	return ret;
 }
 
+int modem_pipe_receive_claim(struct modem_pipe *pipe, uint8_t **buf)
+{
+	int ret;
+
+	if (pipe->api->receive_claim == NULL) {
+		return -ENOTSUP;
+	}
+
+	k_mutex_lock(&pipe->lock, K_FOREVER);
+
+	if (pipe->state == MODEM_PIPE_STATE_CLOSED) {
+		k_mutex_unlock(&pipe->lock);
+		return -EPERM;
+	}
+
+	ret = pipe->api->receive_claim(pipe->data, buf);
+	pipe->receive_ready_pending = false;
+	k_mutex_unlock(&pipe->lock);
+	return ret;
+}
+
+int modem_pipe_receive_finish(struct modem_pipe *pipe, size_t size)
+{
+	int ret;
+
+	if (pipe->api->receive_finish == NULL) {
+		return -ENOTSUP;
+	}
+
+	k_mutex_lock(&pipe->lock, K_FOREVER);
+	ret = pipe->api->receive_finish(pipe->data, size);
+	k_mutex_unlock(&pipe->lock);
+	return ret;
+}
+
 void modem_pipe_release(struct modem_pipe *pipe)
 {
 	k_mutex_lock(&pipe->lock, K_FOREVER);
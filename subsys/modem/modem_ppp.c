@@ -19,6 +19,10 @@ LOG_MODULE_REGISTER(modem_ppp, CONFIG_MODEM_MODULES_LOG_LEVEL);
 #define MODEM_PPP_CODE_ESCAPE		(0x7D)
 #define MODEM_PPP_VALUE_ESCAPE		(0x20)
 
+/* Set if any byte of the 32-bit word is zero, or less than n (n <= 0x80) */
+#define MODEM_PPP_WORD_HAS_ZERO(_w)	(((_w) - 0x01010101UL) & ~(_w) & 0x80808080UL)
+#define MODEM_PPP_WORD_HAS_LESS(_w, _n)	(((_w) - (0x01010101UL * (_n))) & ~(_w) & 0x80808080UL)
+
 static uint16_t modem_ppp_fcs_init(uint8_t byte)
 {
 	return crc16_ccitt(0xFFFF, &byte, 1);
@@ -34,6 +38,42 @@ static uint16_t modem_ppp_fcs_final(uint16_t fcs)
 	return fcs ^ 0xFFFF;
 }
 
+static bool modem_ppp_is_byte_escaped(uint8_t byte)
+{
+	return (byte == MODEM_PPP_CODE_DELIMITER) || (byte == MODEM_PPP_CODE_ESCAPE) ||
+	       (byte < MODEM_PPP_VALUE_ESCAPE);
+}
+
+/*
+ * Get the number of leading bytes which are neither delimiter nor escape codes, nor
+ * control characters if control is set. Most bytes need no escaping, so the buffer
+ * is scanned a word at a time.
+ */
+static size_t modem_ppp_scan_plain(const uint8_t *buf, size_t size, bool control)
+{
+	uint32_t word;
+	size_t i;
+
+	for (i = 0; (i + sizeof(word)) <= size; i += sizeof(word)) {
+		memcpy(&word, &buf[i], sizeof(word));
+
+		if (MODEM_PPP_WORD_HAS_ZERO(word ^ 0x7E7E7E7EUL) ||
+		    MODEM_PPP_WORD_HAS_ZERO(word ^ 0x7D7D7D7DUL) ||
+		    (control && MODEM_PPP_WORD_HAS_LESS(word, MODEM_PPP_VALUE_ESCAPE))) {
+			break;
+		}
+	}
+
+	for (; i < size; i++) {
+		if ((buf[i] == MODEM_PPP_CODE_DELIMITER) || (buf[i] == MODEM_PPP_CODE_ESCAPE) ||
+		    (control && (buf[i] < MODEM_PPP_VALUE_ESCAPE))) {
+			break;
+		}
+	}
+
+	return i;
+}
+
 static uint16_t modem_ppp_ppp_protocol(struct net_pkt *pkt)
 {
 	if (net_pkt_family(pkt) == AF_INET) {
@@ -88,8 +128,7 @@ static uint8_t modem_ppp_wrap_net_pkt_byte(struct modem_ppp *ppp)
 		byte = (ppp->tx_pkt_protocol >> 8) & 0xFF;
 		ppp->tx_pkt_fcs = modem_ppp_fcs_update(ppp->tx_pkt_fcs, byte);
 
-		if ((byte == MODEM_PPP_CODE_DELIMITER) || (byte == MODEM_PPP_CODE_ESCAPE) ||
-		    (byte < MODEM_PPP_VALUE_ESCAPE)) {
+		if (modem_ppp_is_byte_escaped(byte)) {
 			ppp->tx_pkt_escaped = byte ^ MODEM_PPP_VALUE_ESCAPE;
 			ppp->transmit_state = MODEM_PPP_TRANSMIT_STATE_ESCAPING_PROTOCOL_HIGH;
 			return MODEM_PPP_CODE_ESCAPE;
@@ -106,8 +145,7 @@ static uint8_t modem_ppp_wrap_net_pkt_byte(struct modem_ppp *ppp)
 		byte = ppp->tx_pkt_protocol & 0xFF;
 		ppp->tx_pkt_fcs = modem_ppp_fcs_update(ppp->tx_pkt_fcs, byte);
 
-		if ((byte == MODEM_PPP_CODE_DELIMITER) || (byte == MODEM_PPP_CODE_ESCAPE) ||
-		    (byte < MODEM_PPP_VALUE_ESCAPE)) {
+		if (modem_ppp_is_byte_escaped(byte)) {
 			ppp->tx_pkt_escaped = byte ^ MODEM_PPP_VALUE_ESCAPE;
 			ppp->transmit_state = MODEM_PPP_TRANSMIT_STATE_ESCAPING_PROTOCOL_LOW;
 			return MODEM_PPP_CODE_ESCAPE;
@@ -125,8 +163,7 @@ static uint8_t modem_ppp_wrap_net_pkt_byte(struct modem_ppp *ppp)
 		net_pkt_read_u8(ppp->tx_pkt, &byte);
 		ppp->tx_pkt_fcs = modem_ppp_fcs_update(ppp->tx_pkt_fcs, byte);
 
-		if ((byte == MODEM_PPP_CODE_DELIMITER) || (byte == MODEM_PPP_CODE_ESCAPE) ||
-		    (byte < MODEM_PPP_VALUE_ESCAPE)) {
+		if (modem_ppp_is_byte_escaped(byte)) {
 			ppp->tx_pkt_escaped = byte ^ MODEM_PPP_VALUE_ESCAPE;
 			ppp->transmit_state = MODEM_PPP_TRANSMIT_STATE_ESCAPING_DATA;
 			return MODEM_PPP_CODE_ESCAPE;
@@ -152,8 +189,7 @@ static uint8_t modem_ppp_wrap_net_pkt_byte(struct modem_ppp *ppp)
 		ppp->tx_pkt_fcs = modem_ppp_fcs_final(ppp->tx_pkt_fcs);
 		byte = ppp->tx_pkt_fcs & 0xFF;
 
-		if ((byte == MODEM_PPP_CODE_DELIMITER) || (byte == MODEM_PPP_CODE_ESCAPE) ||
-		    (byte < MODEM_PPP_VALUE_ESCAPE)) {
+		if (modem_ppp_is_byte_escaped(byte)) {
 			ppp->tx_pkt_escaped = byte ^ MODEM_PPP_VALUE_ESCAPE;
 			ppp->transmit_state = MODEM_PPP_TRANSMIT_STATE_ESCAPING_FCS_LOW;
 			return MODEM_PPP_CODE_ESCAPE;
@@ -169,8 +205,7 @@ static uint8_t modem_ppp_wrap_net_pkt_byte(struct modem_ppp *ppp)
 	case MODEM_PPP_TRANSMIT_STATE_FCS_HIGH:
 		byte = (ppp->tx_pkt_fcs >> 8) & 0xFF;
 
-		if ((byte == MODEM_PPP_CODE_DELIMITER) || (byte == MODEM_PPP_CODE_ESCAPE) ||
-		    (byte < MODEM_PPP_VALUE_ESCAPE)) {
+		if (modem_ppp_is_byte_escaped(byte)) {
 			ppp->tx_pkt_escaped = byte ^ MODEM_PPP_VALUE_ESCAPE;
 			ppp->transmit_state = MODEM_PPP_TRANSMIT_STATE_ESCAPING_FCS_HIGH;
 			return MODEM_PPP_CODE_ESCAPE;
@@ -192,6 +227,65 @@ static uint8_t modem_ppp_wrap_net_pkt_byte(struct modem_ppp *ppp)
 	return 0;
 }
 
+/*
+ * Wrap data of the current fragment of the net_pkt directly into the transmit ring
+ * buffer. Returns the number of data bytes wrapped, 0 if the byte by byte path must
+ * be used, like at the end of a fragment or of the ring buffer.
+ */
+static size_t modem_ppp_wrap_net_pkt_data(struct modem_ppp *ppp)
+{
+	struct net_pkt_cursor *cursor = &ppp->tx_pkt->cursor;
+	const uint8_t *data;
+	size_t data_len;
+	uint8_t *reserved;
+	uint32_t reserved_size;
+	uint32_t written = 0;
+	size_t read = 0;
+	size_t plain;
+
+	if (cursor->buf == NULL) {
+		return 0;
+	}
+
+	data = cursor->pos;
+	data_len = cursor->buf->len - (cursor->pos - cursor->buf->data);
+	if (data_len == 0) {
+		return 0;
+	}
+
+	reserved_size = ring_buf_put_claim(&ppp->transmit_rb, &reserved, UINT32_MAX);
+
+	while ((read < data_len) && ((reserved_size - written) >= 2)) {
+		if (modem_ppp_is_byte_escaped(data[read])) {
+			reserved[written++] = MODEM_PPP_CODE_ESCAPE;
+			reserved[written++] = data[read++] ^ MODEM_PPP_VALUE_ESCAPE;
+			continue;
+		}
+
+		plain = modem_ppp_scan_plain(&data[read],
+					     MIN(data_len - read, reserved_size - written), true);
+
+		memcpy(&reserved[written], &data[read], plain);
+		written += plain;
+		read += plain;
+	}
+
+	ring_buf_put_finish(&ppp->transmit_rb, written);
+
+	if (read == 0) {
+		return 0;
+	}
+
+	ppp->tx_pkt_fcs = crc16_ccitt(ppp->tx_pkt_fcs, data, read);
+	net_pkt_skip(ppp->tx_pkt, read);
+
+	if (net_pkt_remaining_data(ppp->tx_pkt) == 0) {
+		ppp->transmit_state = MODEM_PPP_TRANSMIT_STATE_FCS_LOW;
+	}
+
+	return read;
+}
+
 static void modem_ppp_process_received_byte(struct modem_ppp *ppp, uint8_t byte)
 {
 	switch (ppp->receive_state) {
@@ -309,6 +403,56 @@ static void modem_ppp_process_received_byte(struct modem_ppp *ppp, uint8_t byte)
 	}
 }
 
+static void modem_ppp_write_received_data(struct modem_ppp *ppp, const uint8_t *data,
+					  size_t size)
+{
+	/* Keep a byte of buffer available, like when writing byte by byte */
+	if (net_pkt_available_buffer(ppp->rx_pkt) <= size) {
+		if (net_pkt_alloc_buffer(ppp->rx_pkt,
+					 MAX(size + 1, CONFIG_MODEM_PPP_NET_BUF_FRAG_SIZE),
+					 AF_INET, K_NO_WAIT) < 0) {
+			LOG_WRN("Failed to alloc buffer");
+			net_pkt_unref(ppp->rx_pkt);
+			ppp->rx_pkt = NULL;
+			ppp->receive_state = MODEM_PPP_RECEIVE_STATE_HDR_SOF;
+			return;
+		}
+	}
+
+	if (net_pkt_write(ppp->rx_pkt, data, size) < 0) {
+		LOG_WRN("Dropped PPP frame");
+		net_pkt_unref(ppp->rx_pkt);
+		ppp->rx_pkt = NULL;
+		ppp->receive_state = MODEM_PPP_RECEIVE_STATE_HDR_SOF;
+#if defined(CONFIG_NET_STATISTICS_PPP)
+		ppp->stats.drop++;
+#endif
+	}
+}
+
+static void modem_ppp_process_received_data(struct modem_ppp *ppp, const uint8_t *data,
+					    size_t size)
+{
+	size_t plain;
+	size_t i = 0;
+
+	while (i < size) {
+		/* Write runs of bytes which need no unescaping in one go */
+		if (ppp->receive_state == MODEM_PPP_RECEIVE_STATE_WRITING) {
+			plain = modem_ppp_scan_plain(&data[i], size - i, false);
+
+			if (plain > 0) {
+				modem_ppp_write_received_data(ppp, &data[i], plain);
+				i += plain;
+				continue;
+			}
+		}
+
+		modem_ppp_process_received_byte(ppp, data[i]);
+		i++;
+	}
+}
+
 static void modem_ppp_pipe_callback(struct modem_pipe *pipe, enum modem_pipe_event event,
 				    void *user_data)
 {
@@ -340,23 +484,25 @@ static void modem_ppp_send_handler(struct k_work *item)
 		ppp->tx_pkt = k_fifo_get(&ppp->tx_pkt_fifo, K_NO_WAIT);
 	}
 
-	if (ppp->tx_pkt != NULL) {
+	/* Fill transmit ring buffer, with as many frames as fit */
+	while ((ppp->tx_pkt != NULL) && (ring_buf_space_get(&ppp->transmit_rb) > 0)) {
 		/* Initialize wrap */
 		if (ppp->transmit_state == MODEM_PPP_TRANSMIT_STATE_IDLE) {
 			ppp->transmit_state = MODEM_PPP_TRANSMIT_STATE_SOF;
 		}
 
-		/* Fill transmit ring buffer */
-		while (ring_buf_space_get(&ppp->transmit_rb) > 0) {
-			byte = modem_ppp_wrap_net_pkt_byte(ppp);
+		if ((ppp->transmit_state == MODEM_PPP_TRANSMIT_STATE_DATA) &&
+		    (modem_ppp_wrap_net_pkt_data(ppp) > 0)) {
+			continue;
+		}
 
-			ring_buf_put(&ppp->transmit_rb, &byte, 1);
+		byte = modem_ppp_wrap_net_pkt_byte(ppp);
 
-			if (ppp->transmit_state == MODEM_PPP_TRANSMIT_STATE_IDLE) {
-				net_pkt_unref(ppp->tx_pkt);
-				ppp->tx_pkt = k_fifo_get(&ppp->tx_pkt_fifo, K_NO_WAIT);
-				break;
-			}
+		ring_buf_put(&ppp->transmit_rb, &byte, 1);
+
+		if (ppp->transmit_state == MODEM_PPP_TRANSMIT_STATE_IDLE) {
+			net_pkt_unref(ppp->tx_pkt);
+			ppp->tx_pkt = k_fifo_get(&ppp->tx_pkt_fifo, K_NO_WAIT);
 		}
 	}
 
@@ -380,16 +526,28 @@ static void modem_ppp_send_handler(struct k_work *item)
 static void modem_ppp_process_handler(struct k_work *item)
 {
 	struct modem_ppp *ppp = CONTAINER_OF(item, struct modem_ppp, process_work);
+	uint8_t *claimed;
 	int ret;
 
+	/* Process received data in place if supported by pipe */
+	ret = modem_pipe_receive_claim(ppp->pipe, &claimed);
+	if (ret != -ENOTSUP) {
+		if (ret < 1) {
+			return;
+		}
+
+		modem_ppp_process_received_data(ppp, claimed, (size_t)ret);
+		modem_pipe_receive_finish(ppp->pipe, (size_t)ret);
+		k_work_submit(&ppp->process_work);
+		return;
+	}
+
 	ret = modem_pipe_receive(ppp->pipe, ppp->receive_buf, ppp->buf_size);
 	if (ret < 1) {
 		return;
 	}
 
-	for (int i = 0; i < ret; i++) {
-		modem_ppp_process_received_byte(ppp, ppp->receive_buf[i]);
-	}
+	modem_ppp_process_received_data(ppp, ppp->receive_buf, (size_t)ret);
 
 	k_work_submit(&ppp->process_work);
 }
@@ -222,6 +222,182 @@ static uint8_t *data_ref(struct net_buf *buf, uint8_t *data)
 	return pool->alloc->cb->ref(buf, data);
 }
 
+#if defined(CONFIG_NET_BUF_POOL_CACHE)
+/* Number of free buffers each CPU may keep, small pools are not cached
+ * so that the buffers are not hoarded by one CPU.
+ */
+static uint16_t pool_cache_limit(struct net_buf_pool *pool)
+{
+	if (pool->alloc->cb != &net_buf_fixed_cb) {
+		return 0;
+	}
+
+	return MIN(CONFIG_NET_BUF_POOL_CACHE_SIZE,
+		   pool->buf_count / (2U * arch_num_cpus()));
+}
+
+/* Interrupts stay locked while the cache of the current CPU is used so
+ * that the thread cannot migrate, the spinlock serializes with the flush
+ * done by another CPU.
+ */
+static struct net_buf_pool_cache *pool_cache_lock(struct net_buf_pool *pool,
+						  unsigned int *irq_key,
+						  k_spinlock_key_t *key)
+{
+	struct net_buf_pool_cache *cache;
+
+	*irq_key = arch_irq_lock();
+	cache = &pool->cache[arch_curr_cpu()->id];
+	*key = k_spin_lock(&cache->lock);
+
+	return cache;
+}
+
+static void pool_cache_unlock(struct net_buf_pool_cache *cache,
+			      unsigned int irq_key, k_spinlock_key_t key)
+{
+	k_spin_unlock(&cache->lock, key);
+	arch_irq_unlock(irq_key);
+}
+
+/* Move up to count buffers of the cache of the current CPU to list */
+static size_t pool_cache_get(struct net_buf_pool *pool, sys_slist_t *list,
+			     size_t count)
+{
+	struct net_buf_pool_cache *cache;
+	unsigned int irq_key;
+	k_spinlock_key_t key;
+	size_t got = 0;
+
+	if (pool_cache_limit(pool) == 0U) {
+		return 0;
+	}
+
+	cache = pool_cache_lock(pool, &irq_key, &key);
+
+	while (got < count && cache->count > 0U) {
+		sys_slist_append(list, sys_slist_get_not_empty(&cache->list));
+		cache->count--;
+		got++;
+	}
+
+	pool_cache_unlock(cache, irq_key, key);
+
+	return got;
+}
+
+/* Move buffers of list to the cache of the current CPU while it has room,
+ * return the number of buffers moved.
+ */
+static size_t pool_cache_put_list(struct net_buf_pool *pool, sys_slist_t *list)
+{
+	uint16_t limit = pool_cache_limit(pool);
+	struct net_buf_pool_cache *cache;
+	unsigned int irq_key;
+	k_spinlock_key_t key;
+	size_t put = 0;
+
+	if (limit == 0U || atomic_get(&pool->cache_waiters) > 0) {
+		return 0;
+	}
+
+	cache = pool_cache_lock(pool, &irq_key, &key);
+
+	/* Checked again under the lock, see pool_cache_flush() */
+	if (atomic_get(&pool->cache_waiters) == 0) {
+		while (cache->count < limit && !sys_slist_is_empty(list)) {
+			sys_slist_prepend(&cache->list,
+					  sys_slist_get_not_empty(list));
+			cache->count++;
+			put++;
+		}
+	}
+
+	pool_cache_unlock(cache, irq_key, key);
+
+	return put;
+}
+
+bool net_buf_pool_cache_put(struct net_buf_pool *pool, struct net_buf *buf)
+{
+	sys_slist_t list;
+
+	sys_slist_init(&list);
+	sys_slist_append(&list, &buf->node);
+
+	return pool_cache_put_list(pool, &list) == 1U;
+}
+
+/* Return the buffers of all the caches to the LIFO. The caller has
+ * registered itself in cache_waiters before, so a buffer freed after its
+ * cache was flushed goes to the LIFO as well.
+ */
+static void pool_cache_flush(struct net_buf_pool *pool)
+{
+	for (unsigned int i = 0; i < arch_num_cpus(); i++) {
+		struct net_buf_pool_cache *cache = &pool->cache[i];
+		k_spinlock_key_t key;
+		sys_slist_t list;
+
+		key = k_spin_lock(&cache->lock);
+		list = cache->list;
+		sys_slist_init(&cache->list);
+		cache->count = 0U;
+		k_spin_unlock(&cache->lock, key);
+
+		if (!sys_slist_is_empty(&list)) {
+			k_queue_merge_slist(&pool->free._queue, &list);
+		}
+	}
+}
+#endif /* CONFIG_NET_BUF_POOL_CACHE */
+
+/* Put a list of free buffers of the same pool back into it */
+static void pool_put_list(struct net_buf_pool *pool, sys_slist_t *list)
+{
+#if defined(CONFIG_NET_BUF_POOL_CACHE)
+	(void)pool_cache_put_list(pool, list);
+#endif
+
+	if (!sys_slist_is_empty(list)) {
+		k_queue_merge_slist(&pool->free._queue, list);
+	}
+}
+
+/* Initialize a buffer taken from the pool, with size bytes of data */
+static int buf_setup(struct net_buf *buf, size_t size, k_timeout_t timeout)
+{
+	if (size) {
+#if __ASSERT_ON
+		size_t req_size = size;
+#endif
+		buf->__buf = data_alloc(buf, &size, timeout);
+		if (!buf->__buf) {
+			return -ENOMEM;
+		}
+
+#if __ASSERT_ON
+		NET_BUF_ASSERT(req_size <= size);
+#endif
+	} else {
+		buf->__buf = NULL;
+	}
+
+	buf->ref   = 1U;
+	buf->flags = 0U;
+	buf->frags = NULL;
+	buf->size  = size;
+	net_buf_reset(buf);
+
+#if defined(CONFIG_NET_BUF_POOL_USAGE)
+	struct net_buf_pool *pool = net_buf_pool_get(buf->pool_id);
+
+	atomic_dec(&pool->avail_count);
+	__ASSERT_NO_MSG(atomic_get(&pool->avail_count) >= 0);
+#endif
+	return 0;
+}
+
 #if defined(CONFIG_NET_BUF_LOG)
 struct net_buf *net_buf_alloc_len_debug(struct net_buf_pool *pool, size_t size,
 					k_timeout_t timeout, const char *func,
@@ -239,6 +415,16 @@ struct net_buf *net_buf_alloc_len(struct net_buf_pool *pool, size_t size,
 
 	NET_BUF_DBG("%s():%d: pool %p size %zu", func, line, pool, size);
 
+#if defined(CONFIG_NET_BUF_POOL_CACHE)
+	sys_slist_t cached;
+
+	sys_slist_init(&cached);
+	if (pool_cache_get(pool, &cached, 1)) {
+		buf = CONTAINER_OF(sys_slist_peek_head(&cached), struct net_buf, node);
+		goto success;
+	}
+#endif
+
 	/* We need to prevent race conditions
 	 * when accessing pool->uninit_count.
 	 */
@@ -271,6 +457,16 @@ struct net_buf *net_buf_alloc_len(struct net_buf_pool *pool, size_t size,
 
 	k_spin_unlock(&pool->lock, key);
 
+#if defined(CONFIG_NET_BUF_POOL_CACHE)
+	/* Buffers kept by the caches of the other CPUs are not seen by the
+	 * LIFO, hand them back before waiting on it.
+	 */
+	if (pool_cache_limit(pool)) {
+		atomic_inc(&pool->cache_waiters);
+		pool_cache_flush(pool);
+	}
+#endif
+
 #if defined(CONFIG_NET_BUF_LOG) && (CONFIG_NET_BUF_LOG_LEVEL >= LOG_LEVEL_WRN)
 	if (K_TIMEOUT_EQ(timeout, K_FOREVER)) {
 		uint32_t ref = k_uptime_get_32();
@@ -299,6 +495,11 @@ struct net_buf *net_buf_alloc_len(struct net_buf_pool *pool, size_t size,
 	}
 #else
 	buf = k_lifo_get(&pool->free, timeout);
+#endif
+#if defined(CONFIG_NET_BUF_POOL_CACHE)
+	if (pool_cache_limit(pool)) {
+		atomic_dec(&pool->cache_waiters);
+	}
 #endif
 	if (!buf) {
 		NET_BUF_ERR("%s():%d: Failed to get free buffer", func, line);
@@ -308,37 +509,116 @@ struct net_buf *net_buf_alloc_len(struct net_buf_pool *pool, size_t size,
 success:
 	NET_BUF_DBG("allocated buf %p", buf);
 
-	if (size) {
-#if __ASSERT_ON
-		size_t req_size = size;
+	if (buf_setup(buf, size, sys_timepoint_timeout(end))) {
+		NET_BUF_ERR("%s():%d: Failed to allocate data", func, line);
+		net_buf_destroy(buf);
+		return NULL;
+	}
+
+	return buf;
+}
+
+/* Take up to count buffers from the pool without blocking, under one
+ * lock each for the cache and the uninitialized buffers.
+ */
+static size_t pool_get_bulk(struct net_buf_pool *pool, sys_slist_t *list,
+			    size_t count)
+{
+	k_spinlock_key_t key;
+	uint16_t uninit_count;
+	size_t got = 0;
+
+#if defined(CONFIG_NET_BUF_POOL_CACHE)
+	got = pool_cache_get(pool, list, count);
 #endif
-		timeout = sys_timepoint_timeout(end);
-		buf->__buf = data_alloc(buf, &size, timeout);
-		if (!buf->__buf) {
-			NET_BUF_ERR("%s():%d: Failed to allocate data",
-				    func, line);
+
+	key = k_spin_lock(&pool->lock);
+
+	while (got < count && pool->uninit_count) {
+		uninit_count = pool->uninit_count--;
+		sys_slist_append(list, &pool_get_uninit(pool, uninit_count)->node);
+		got++;
+	}
+
+	k_spin_unlock(&pool->lock, key);
+
+	return got;
+}
+
+struct net_buf *net_buf_alloc_chain(struct net_buf_pool *pool, size_t len,
+				    k_timeout_t timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	size_t frag_size = pool->alloc->max_alloc_size;
+	struct net_buf *head = NULL;
+	struct net_buf *tail = NULL;
+	struct net_buf *buf;
+	sys_snode_t *node;
+	sys_slist_t list;
+	size_t count = 1;
+	size_t got;
+
+	__ASSERT_NO_MSG(pool);
+
+	if (frag_size == 0U) {
+		frag_size = len;
+	} else if (len > frag_size) {
+		count = DIV_ROUND_UP(len, frag_size);
+	}
+
+	sys_slist_init(&list);
+	got = pool_get_bulk(pool, &list, count);
+
+	NET_BUF_DBG("pool %p len %zu count %zu bulk %zu", pool, len, count, got);
+
+	while ((node = sys_slist_get(&list)) != NULL) {
+		buf = CONTAINER_OF(node, struct net_buf, node);
+
+		if (buf_setup(buf, frag_size, K_NO_WAIT)) {
 			net_buf_destroy(buf);
-			return NULL;
+			goto fail;
 		}
 
-#if __ASSERT_ON
-		NET_BUF_ASSERT(req_size <= size);
-#endif
-	} else {
+		if (tail) {
+			tail->frags = buf;
+		} else {
+			head = buf;
+		}
+
+		tail = buf;
+	}
+
+	/* The rest one by one, waiting if needed */
+	for (; got < count; got++) {
+		buf = net_buf_alloc_len(pool, frag_size,
+					sys_timepoint_timeout(end));
+		if (!buf) {
+			goto fail;
+		}
+
+		if (tail) {
+			tail->frags = buf;
+		} else {
+			head = buf;
+		}
+
+		tail = buf;
+	}
+
+	return head;
+
+fail:
+	while ((node = sys_slist_get(&list)) != NULL) {
+		buf = CONTAINER_OF(node, struct net_buf, node);
 		buf->__buf = NULL;
+		k_lifo_put(&pool->free, buf);
 	}
 
-	buf->ref   = 1U;
-	buf->flags = 0U;
-	buf->frags = NULL;
-	buf->size  = size;
-	net_buf_reset(buf);
+	if (head) {
+		net_buf_unref_chain(head);
+	}
 
-#if defined(CONFIG_NET_BUF_POOL_USAGE)
-	atomic_dec(&pool->avail_count);
-	__ASSERT_NO_MSG(atomic_get(&pool->avail_count) >= 0);
-#endif
-	return buf;
+	return NULL;
 }
 
 #if defined(CONFIG_NET_BUF_LOG)
@@ -490,6 +770,66 @@ void net_buf_unref(struct net_buf *buf)
 	}
 }
 
+void net_buf_unref_chain(struct net_buf *buf)
+{
+	struct net_buf_pool *list_pool = NULL;
+	sys_slist_t list;
+
+	__ASSERT_NO_MSG(buf);
+
+	sys_slist_init(&list);
+
+	while (buf) {
+		struct net_buf *frags = buf->frags;
+		struct net_buf_pool *pool;
+
+		NET_BUF_DBG("buf %p ref %u pool_id %u frags %p", buf, buf->ref,
+			    buf->pool_id, buf->frags);
+
+		if (--buf->ref > 0) {
+			break;
+		}
+
+		buf->data = NULL;
+		buf->frags = NULL;
+
+		pool = net_buf_pool_get(buf->pool_id);
+
+#if defined(CONFIG_NET_BUF_POOL_USAGE)
+		atomic_inc(&pool->avail_count);
+		__ASSERT_NO_MSG(atomic_get(&pool->avail_count) <= pool->buf_count);
+#endif
+
+		if (pool->destroy) {
+			pool->destroy(buf);
+			buf = frags;
+			continue;
+		}
+
+		if (pool != list_pool && list_pool) {
+			pool_put_list(list_pool, &list);
+			sys_slist_init(&list);
+		}
+
+		list_pool = pool;
+
+		if (buf->__buf) {
+			if (!(buf->flags & NET_BUF_EXTERNAL_DATA)) {
+				pool->alloc->cb->unref(buf, buf->__buf);
+			}
+			buf->__buf = NULL;
+		}
+
+		sys_slist_append(&list, &buf->node);
+
+		buf = frags;
+	}
+
+	if (list_pool) {
+		pool_put_list(list_pool, &list);
+	}
+}
+
 struct net_buf *net_buf_ref(struct net_buf *buf)
 {
 	__ASSERT_NO_MSG(buf);
@@ -832,9 +832,9 @@ sa_end:
 
 	compressed = inline_pos - pkt->buffer->data;
 
+	/* Only the head fragment is adjusted, the payload is not moved */
+	net_buf_pull(pkt->buffer, compressed);
 	net_pkt_cursor_init(pkt);
-	net_pkt_pull(pkt, compressed);
-	net_pkt_compact(pkt);
 
 	return compressed;
 }
@@ -1344,6 +1344,34 @@ static inline void uncompress_cid(struct net_pkt *pkt, uint8_t cid,
 }
 #endif
 
+/* Check if the head fragment has len bytes of headroom, not holding the link
+ * layer addresses which point to the frame header of received packets.
+ */
+static bool headroom_is_free(struct net_pkt *pkt, size_t len)
+{
+	struct net_linkaddr *lladdr[] = {
+		net_pkt_lladdr_src(pkt),
+		net_pkt_lladdr_dst(pkt),
+	};
+	uint8_t *start;
+
+	if (net_buf_headroom(pkt->buffer) < len) {
+		return false;
+	}
+
+	start = pkt->buffer->data - len;
+
+	for (size_t i = 0; i < ARRAY_SIZE(lladdr); i++) {
+		if (lladdr[i]->addr != NULL &&
+		    lladdr[i]->addr < pkt->buffer->data &&
+		    lladdr[i]->addr + lladdr[i]->len > start) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
 static bool uncompress_IPHC_header(struct net_pkt *pkt)
 {
 	struct net_udp_hdr *udp = NULL;
@@ -1389,7 +1417,12 @@ static bool uncompress_IPHC_header(struct net_pkt *pkt)
 		return false;
 	}
 
-	if (net_buf_tailroom(pkt->buffer) >= diff) {
+	if (headroom_is_free(pkt, diff)) {
+		NET_DBG("Enough headroom. Uncompress inplace");
+		frag = pkt->buffer;
+		net_buf_push(frag, diff);
+		cursor = frag->data + diff;
+	} else if (net_buf_tailroom(pkt->buffer) >= diff) {
 		NET_DBG("Enough tailroom. Uncompress inplace");
 		frag = pkt->buffer;
 		net_buf_add(frag, diff);
@@ -1534,6 +1567,11 @@ static inline int compress_ipv6_header(struct net_pkt *pkt)
 {
 	struct net_buf *buffer = pkt->buffer;
 
+	if (headroom_is_free(pkt, 1U)) {
+		net_buf_push_u8(buffer, NET_6LO_DISPATCH_IPV6);
+		return 0;
+	}
+
 	if (net_buf_tailroom(buffer) >= 1U) {
 		memmove(buffer->data + 1U, buffer->data, buffer->len);
 		net_buf_add(buffer, 1U);
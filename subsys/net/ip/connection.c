@@ -64,6 +64,17 @@ static struct net_conn conns[CONFIG_NET_MAX_CONN];
 static sys_slist_t conn_unused;
 static sys_slist_t conn_used;
 
+#if defined(CONFIG_NET_CONN_HASH)
+/** All the address and port fields specified */
+#define NET_CONN_FULLY_SPEC		0x78
+
+/* IP connections are also found from one of these. The fully specified ones
+ * are hashed on proto, addresses and ports, the rest on the local port.
+ */
+static sys_slist_t conn_hash[CONFIG_NET_CONN_HASH_SIZE];
+static sys_slist_t conn_wild[CONFIG_NET_CONN_HASH_SIZE];
+#endif
+
 #if (CONFIG_NET_CONN_LOG_LEVEL >= LOG_LEVEL_DBG)
 static inline
 void conn_register_debug(struct net_conn *conn,
@@ -116,6 +127,71 @@ void conn_register_debug(struct net_conn *conn,
 
 static K_MUTEX_DEFINE(conn_lock);
 
+#if defined(CONFIG_NET_CONN_HASH)
+/* FNV-1a */
+static uint32_t conn_hash_mix(uint32_t hash, const void *data, size_t len)
+{
+	const uint8_t *ptr = data;
+
+	while (len--) {
+		hash = (hash ^ *ptr++) * 16777619U;
+	}
+
+	return hash;
+}
+
+/* Ports are in network byte order */
+static sys_slist_t *conn_hash_bucket(uint16_t proto, uint8_t family,
+				     const uint8_t *remote, const uint8_t *local,
+				     uint16_t remote_port, uint16_t local_port)
+{
+	size_t addr_len = family == AF_INET6 ? NET_IPV6_ADDR_SIZE : NET_IPV4_ADDR_SIZE;
+	uint32_t hash = 2166136261U;
+
+	hash = conn_hash_mix(hash, &proto, sizeof(proto));
+	hash = conn_hash_mix(hash, remote, addr_len);
+	hash = conn_hash_mix(hash, local, addr_len);
+	hash = conn_hash_mix(hash, &remote_port, sizeof(remote_port));
+	hash = conn_hash_mix(hash, &local_port, sizeof(local_port));
+
+	return &conn_hash[hash % CONFIG_NET_CONN_HASH_SIZE];
+}
+
+static inline sys_slist_t *conn_wild_bucket(uint16_t local_port)
+{
+	return &conn_wild[ntohs(local_port) % CONFIG_NET_CONN_HASH_SIZE];
+}
+
+static const uint8_t *conn_sockaddr_raw(struct sockaddr *addr)
+{
+	if (IS_ENABLED(CONFIG_NET_IPV6) && addr->sa_family == AF_INET6) {
+		return (const uint8_t *)&net_sin6(addr)->sin6_addr;
+	}
+
+	return (const uint8_t *)&net_sin(addr)->sin_addr;
+}
+
+static sys_slist_t *conn_hash_list(struct net_conn *conn)
+{
+	if (conn->family != AF_INET && conn->family != AF_INET6 &&
+	    conn->family != AF_UNSPEC) {
+		return NULL;
+	}
+
+	if (NET_CONN_RANK(conn->flags) == NET_CONN_FULLY_SPEC &&
+	    conn->remote_addr.sa_family == conn->family &&
+	    conn->local_addr.sa_family == conn->family) {
+		return conn_hash_bucket(conn->proto, conn->family,
+					conn_sockaddr_raw(&conn->remote_addr),
+					conn_sockaddr_raw(&conn->local_addr),
+					net_sin(&conn->remote_addr)->sin_port,
+					net_sin(&conn->local_addr)->sin_port);
+	}
+
+	return conn_wild_bucket(net_sin(&conn->local_addr)->sin_port);
+}
+#endif /* CONFIG_NET_CONN_HASH */
+
 static struct net_conn *conn_get_unused(void)
 {
 	sys_snode_t *node;
@@ -141,6 +217,15 @@ static void conn_set_used(struct net_conn *conn)
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 	sys_slist_prepend(&conn_used, &conn->node);
+
+#if defined(CONFIG_NET_CONN_HASH)
+	sys_slist_t *list = conn_hash_list(conn);
+
+	if (list != NULL) {
+		sys_slist_prepend(list, &conn->hash_node);
+	}
+#endif
+
 	k_mutex_unlock(&conn_lock);
 }
 
@@ -415,6 +500,15 @@ int net_conn_unregister(struct net_conn_handle *handle)
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 	sys_slist_find_and_remove(&conn_used, &conn->node);
+
+#if defined(CONFIG_NET_CONN_HASH)
+	sys_slist_t *list = conn_hash_list(conn);
+
+	if (list != NULL) {
+		sys_slist_find_and_remove(list, &conn->hash_node);
+	}
+#endif
+
 	k_mutex_unlock(&conn_lock);
 
 	conn_set_unused(conn);
@@ -495,6 +589,138 @@ static bool conn_addr_cmp(struct net_pkt *pkt,
 	return true;
 }
 
+static bool conn_ip_match(struct net_conn *conn, struct net_pkt *pkt,
+			  union net_ip_header *ip_hdr,
+			  uint16_t src_port, uint16_t dst_port)
+{
+	if (net_sin(&conn->remote_addr)->sin_port &&
+	    net_sin(&conn->remote_addr)->sin_port != src_port) {
+		return false; /* wrong remote port */
+	}
+
+	if (net_sin(&conn->local_addr)->sin_port &&
+	    net_sin(&conn->local_addr)->sin_port != dst_port) {
+		return false; /* wrong local port */
+	}
+
+	if ((conn->flags & NET_CONN_REMOTE_ADDR_SET) &&
+	    !conn_addr_cmp(pkt, ip_hdr, &conn->remote_addr, true)) {
+		return false; /* wrong remote address */
+	}
+
+	if ((conn->flags & NET_CONN_LOCAL_ADDR_SET) &&
+	    !conn_addr_cmp(pkt, ip_hdr, &conn->local_addr, false)) {
+
+		/* Check if we could do a v4-mapping-to-v6 and the IPv6 socket
+		 * has no IPV6_V6ONLY option set and if the local IPV6 address
+		 * is unspecified, then we could accept a connection from IPv4
+		 * address by mapping it to IPv6 address.
+		 */
+		if (IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6)) {
+			if (!(conn->family == AF_INET6 && net_pkt_family(pkt) == AF_INET &&
+			      !conn->v6only &&
+			      net_ipv6_is_addr_unspecified(
+				      &net_sin6(&conn->local_addr)->sin6_addr))) {
+				return false; /* wrong local address */
+			}
+		} else {
+			return false; /* wrong local address */
+		}
+
+		/* We might have a match for v4-to-v6 mapping */
+	}
+
+	return true;
+}
+
+#if defined(CONFIG_NET_CONN_HASH)
+static bool conn_hash_match(struct net_conn *conn, struct net_pkt *pkt,
+			    union net_ip_header *ip_hdr, uint8_t proto,
+			    uint16_t src_port, uint16_t dst_port)
+{
+	uint8_t pkt_family = net_pkt_family(pkt);
+
+	if (conn->context != NULL &&
+	    net_context_is_bound_to_iface(conn->context) &&
+	    net_pkt_iface(pkt) != net_context_get_iface(conn->context)) {
+		return false;
+	}
+
+	if (conn->family != AF_UNSPEC && conn->family != pkt_family &&
+	    !(IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6) &&
+	      conn->family == AF_INET6 && pkt_family == AF_INET && !conn->v6only)) {
+		return false;
+	}
+
+	if (conn->proto != proto) {
+		return false;
+	}
+
+	return conn_ip_match(conn, pkt, ip_hdr, src_port, dst_port);
+}
+
+/* Find the same connection for a unicast TCP or UDP packet as the scan of
+ * the used list does. The fully specified connections have the highest rank
+ * so an exact match wins, otherwise the connections bound to the
+ * destination port and the ones without a local port are ranked.
+ */
+static struct net_conn *conn_hash_lookup(struct net_pkt *pkt,
+					 union net_ip_header *ip_hdr,
+					 uint8_t proto,
+					 uint16_t src_port, uint16_t dst_port)
+{
+	struct net_conn *best_match = NULL;
+	int16_t best_rank = -1;
+	struct net_conn *conn;
+	sys_slist_t *lists[2];
+	const uint8_t *src;
+	const uint8_t *dst;
+
+	if (IS_ENABLED(CONFIG_NET_IPV6) && net_pkt_family(pkt) == AF_INET6) {
+		src = ip_hdr->ipv6->src;
+		dst = ip_hdr->ipv6->dst;
+	} else {
+		src = ip_hdr->ipv4->src;
+		dst = ip_hdr->ipv4->dst;
+	}
+
+	SYS_SLIST_FOR_EACH_CONTAINER(conn_hash_bucket(proto, net_pkt_family(pkt),
+						      src, dst, src_port, dst_port),
+				     conn, hash_node) {
+		if (conn_hash_match(conn, pkt, ip_hdr, proto, src_port, dst_port)) {
+			return conn;
+		}
+	}
+
+	lists[0] = conn_wild_bucket(dst_port);
+	lists[1] = conn_wild_bucket(0);
+
+	for (size_t i = 0; i < ARRAY_SIZE(lists); i++) {
+		if (i > 0 && lists[i] == lists[0]) {
+			break;
+		}
+
+		SYS_SLIST_FOR_EACH_CONTAINER(lists[i], conn, hash_node) {
+			if (best_rank < NET_CONN_RANK(conn->flags) &&
+			    conn_hash_match(conn, pkt, ip_hdr, proto, src_port, dst_port)) {
+				best_rank = NET_CONN_RANK(conn->flags);
+				best_match = conn;
+			}
+		}
+	}
+
+	return best_match;
+}
+#else
+static inline struct net_conn *conn_hash_lookup(struct net_pkt *pkt,
+						union net_ip_header *ip_hdr,
+						uint8_t proto,
+						uint16_t src_port, uint16_t dst_port)
+{
+	return NULL;
+}
+#endif /* CONFIG_NET_CONN_HASH */
+
 static inline void conn_send_icmp_error(struct net_pkt *pkt)
 {
 	if (IS_ENABLED(CONFIG_NET_DISABLE_ICMP_DESTINATION_UNREACHABLE)) {
@@ -661,6 +887,13 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 
+	if (IS_ENABLED(CONFIG_NET_CONN_HASH) && !is_mcast_pkt &&
+	    (pkt_family == AF_INET || pkt_family == AF_INET6) &&
+	    (proto == IPPROTO_UDP || proto == IPPROTO_TCP)) {
+		best_match = conn_hash_lookup(pkt, ip_hdr, proto, src_port, dst_port);
+		goto lookup_done;
+	}
+
 	SYS_SLIST_FOR_EACH_CONTAINER(&conn_used, conn, node) {
 		/* Is the candidate connection matching the packet's interface? */
 		if (conn->context != NULL &&
@@ -749,43 +982,8 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 			/* Is the candidate connection matching the packet's TCP/UDP
 			 * address and port?
 			 */
-			if (net_sin(&conn->remote_addr)->sin_port &&
-			    net_sin(&conn->remote_addr)->sin_port != src_port) {
-				continue; /* wrong remote port */
-			}
-
-			if (net_sin(&conn->local_addr)->sin_port &&
-			    net_sin(&conn->local_addr)->sin_port != dst_port) {
-				continue; /* wrong local port */
-			}
-
-			if ((conn->flags & NET_CONN_REMOTE_ADDR_SET) &&
-			    !conn_addr_cmp(pkt, ip_hdr, &conn->remote_addr, true)) {
-				continue; /* wrong remote address */
-			}
-
-			if ((conn->flags & NET_CONN_LOCAL_ADDR_SET) &&
-			    !conn_addr_cmp(pkt, ip_hdr, &conn->local_addr, false)) {
-
-				/* Check if we could do a v4-mapping-to-v6 and the IPv6 socket
-				 * has no IPV6_V6ONLY option set and if the local IPV6 address
-				 * is unspecified, then we could accept a connection from IPv4
-				 * address by mapping it to IPv6 address.
-				 */
-				if (IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6)) {
-					if (!(conn->family == AF_INET6 && pkt_family == AF_INET &&
-					      !conn->v6only &&
-					      net_ipv6_is_addr_unspecified(
-						      &net_sin6(&conn->local_addr)->sin6_addr))) {
-						continue; /* wrong local address */
-					}
-				} else {
-					continue; /* wrong local address */
-				}
-
-				/* We might have a match for v4-to-v6 mapping,
-				 * continue with rank checking.
-				 */
+			if (!conn_ip_match(conn, pkt, ip_hdr, src_port, dst_port)) {
+				continue;
 			}
 
 			if (best_rank < NET_CONN_RANK(conn->flags)) {
@@ -829,6 +1027,7 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 		}
 	} /* loop end */
 
+lookup_done:
 	if (best_match) {
 		cb = best_match->cb;
 		user_data = best_match->user_data;
@@ -916,6 +1115,13 @@ void net_conn_init(void)
 	sys_slist_init(&conn_unused);
 	sys_slist_init(&conn_used);
 
+#if defined(CONFIG_NET_CONN_HASH)
+	for (i = 0; i < CONFIG_NET_CONN_HASH_SIZE; i++) {
+		sys_slist_init(&conn_hash[i]);
+		sys_slist_init(&conn_wild[i]);
+	}
+#endif
+
 	for (i = 0; i < CONFIG_NET_MAX_CONN; i++) {
 		sys_slist_prepend(&conn_unused, &conns[i].node);
 	}
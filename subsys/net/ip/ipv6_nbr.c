@@ -134,6 +134,63 @@ static inline struct net_nbr *get_nbr(int idx)
 	return &net_neighbor_pool[idx].nbr;
 }
 
+#if defined(CONFIG_NET_IPV6_NBR_HASH)
+/* Chains of neighbor pool indexes, one per bucket of the address hash */
+#define NBR_HASH_END 0xff
+
+static uint8_t nbr_hash_head[CONFIG_NET_IPV6_NBR_HASH_BUCKETS] = {
+	[0 ... (CONFIG_NET_IPV6_NBR_HASH_BUCKETS - 1)] = NBR_HASH_END
+};
+static uint8_t nbr_hash_next[CONFIG_NET_IPV6_MAX_NEIGHBORS];
+
+static inline uint8_t get_nbr_index(struct net_nbr *nbr)
+{
+	return ((uint8_t *)nbr - (uint8_t *)net_neighbor_pool) /
+		sizeof(net_neighbor_pool[0]);
+}
+
+static uint8_t *nbr_hash_bucket(const struct in6_addr *addr)
+{
+	/* The interface identifier varies the most between neighbors. The
+	 * address may come straight from a packet header, so no aligned
+	 * access.
+	 */
+	uint32_t hash = sys_get_be32(&addr->s6_addr[12]) ^
+			sys_get_be32(&addr->s6_addr[8]);
+
+	hash ^= hash >> 16;
+	hash ^= hash >> 8;
+
+	return &nbr_hash_head[hash % CONFIG_NET_IPV6_NBR_HASH_BUCKETS];
+}
+
+/* Must be invoked with neighbor lock held */
+static void nbr_hash_add(struct net_nbr *nbr)
+{
+	uint8_t *head = nbr_hash_bucket(&net_ipv6_nbr_data(nbr)->addr);
+	uint8_t idx = get_nbr_index(nbr);
+
+	nbr_hash_next[idx] = *head;
+	*head = idx;
+}
+
+/* Must be invoked with neighbor lock held */
+static void nbr_hash_remove(struct net_nbr *nbr)
+{
+	uint8_t *link = nbr_hash_bucket(&net_ipv6_nbr_data(nbr)->addr);
+	uint8_t idx = get_nbr_index(nbr);
+
+	while (*link != NBR_HASH_END) {
+		if (*link == idx) {
+			*link = nbr_hash_next[idx];
+			return;
+		}
+
+		link = &nbr_hash_next[*link];
+	}
+}
+#endif /* CONFIG_NET_IPV6_NBR_HASH */
+
 static inline struct net_nbr *get_nbr_from_data(struct net_ipv6_nbr_data *data)
 {
 	int i;
@@ -272,7 +329,11 @@ static struct net_nbr *nbr_lookup(struct net_nbr_table *table,
 {
 	int i;
 
+#if defined(CONFIG_NET_IPV6_NBR_HASH)
+	for (i = *nbr_hash_bucket(addr); i != NBR_HASH_END; i = nbr_hash_next[i]) {
+#else
 	for (i = 0; i < CONFIG_NET_IPV6_MAX_NEIGHBORS; i++) {
+#endif
 		struct net_nbr *nbr = get_nbr(i);
 
 		if (!nbr->ref) {
@@ -426,6 +487,9 @@ static void nbr_init(struct net_nbr *nbr, struct net_if *iface,
 	nbr->iface = iface;
 
 	net_ipaddr_copy(&net_ipv6_nbr_data(nbr)->addr, addr);
+#if defined(CONFIG_NET_IPV6_NBR_HASH)
+	nbr_hash_add(nbr);
+#endif
 	ipv6_nbr_set_state(nbr, state);
 	net_ipv6_nbr_data(nbr)->is_router = is_router;
 	net_ipv6_nbr_data(nbr)->pending = NULL;
@@ -669,7 +733,9 @@ void net_neighbor_data_remove(struct net_nbr *nbr)
 {
 	NET_DBG("Neighbor %p removed", nbr);
 
-	return;
+#if defined(CONFIG_NET_IPV6_NBR_HASH)
+	nbr_hash_remove(nbr);
+#endif
 }
 
 void net_neighbor_table_clear(struct net_nbr_table *table)
@@ -807,9 +873,11 @@ enum net_verdict net_ipv6_prepare_for_send(struct net_pkt *pkt)
 
 #if defined(CONFIG_NET_IPV6_FRAGMENT)
 	/* If we have already fragmented the packet, the fragment id will
-	 * contain a proper value and we can skip other checks.
+	 * contain a proper value and we can skip other checks. TCP
+	 * segmentation offload packets are split in segments by the L2
+	 * instead.
 	 */
-	if (net_pkt_ipv6_fragment_id(pkt) == 0U) {
+	if (net_pkt_ipv6_fragment_id(pkt) == 0U && net_pkt_tso_mss(pkt) == 0U) {
 		uint16_t mtu = net_if_get_mtu(net_pkt_iface(pkt));
 		size_t pkt_len = net_pkt_get_len(pkt);
 
@@ -1455,6 +1523,7 @@ static void ipv6_nd_restart_reachable_timer(struct net_nbr *nbr, int64_t time)
 static void ipv6_nd_reachable_timeout(struct k_work *work)
 {
 	int64_t current = k_uptime_get();
+	int64_t next_timeout = INT64_MAX;
 	struct net_nbr *nbr = NULL;
 	struct net_ipv6_nbr_data *data = NULL;
 	int ret;
@@ -1462,6 +1531,11 @@ static void ipv6_nd_reachable_timeout(struct k_work *work)
 
 	net_ipv6_nbr_lock();
 
+	/* All the neighbors share this timer. Collect the earliest pending
+	 * expiry while scanning and reschedule once at the end, instead of
+	 * touching the work queue for every neighbor.
+	 */
+
 	for (i = 0; i < CONFIG_NET_IPV6_MAX_NEIGHBORS; i++) {
 		int64_t remaining;
 
@@ -1481,7 +1555,7 @@ static void ipv6_nd_reachable_timeout(struct k_work *work)
 
 		remaining = data->reachable + data->reachable_timeout - current;
 		if (remaining > 0) {
-			ipv6_nd_restart_reachable_timer(NULL, remaining);
+			next_timeout = MIN(next_timeout, remaining);
 			continue;
 		}
 
@@ -1554,13 +1628,18 @@ static void ipv6_nd_reachable_timeout(struct k_work *work)
 					NET_DBG("Cannot send NS (%d)", ret);
 				}
 
-				ipv6_nd_restart_reachable_timer(nbr,
-								RETRANS_TIMER);
+				data->reachable = current;
+				data->reachable_timeout = RETRANS_TIMER;
+				next_timeout = MIN(next_timeout, RETRANS_TIMER);
 			}
 			break;
 		}
 	}
 
+	if (next_timeout != INT64_MAX) {
+		ipv6_nd_restart_reachable_timer(NULL, next_timeout);
+	}
+
 	net_ipv6_nbr_unlock();
 }
 
@@ -518,6 +518,10 @@ int net_context_get(sa_family_t family, enum net_sock_type type, uint16_t proto,
 
 		k_mutex_init(&contexts[i].lock);
 
+#if defined(CONFIG_NET_PKT_TX_ZEROCOPY)
+		k_sem_init(&contexts[i].zerocopy.done, 0, 1);
+#endif
+
 		contexts[i].flags |= NET_CONTEXT_IN_USE;
 		*context = &contexts[i];
 
@@ -1711,6 +1715,186 @@ static int get_context_recv_pktinfo(struct net_context *context,
 #endif
 }
 
+#if defined(CONFIG_NET_PKT_TX_ZEROCOPY)
+/* One record per zero-copy send. It is referenced by the sender until the
+ * outcome of the send is known, and by each buffer pointing to the caller
+ * data. The last one to release it reports the completion.
+ */
+struct zerocopy_send {
+	struct k_work work;
+	struct net_context *context;
+	atomic_t refs;
+	uint32_t id;
+	bool copied;
+	bool dropped;
+};
+
+K_MEM_SLAB_DEFINE_STATIC(zerocopy_sends, sizeof(struct zerocopy_send),
+			 CONFIG_NET_PKT_TX_ZEROCOPY_COUNT, 4);
+
+/* Sends completing out of order are tracked in a 32 bit map */
+#define ZEROCOPY_MAX_PENDING 32U
+
+static void zerocopy_send_report(struct k_work *work)
+{
+	struct zerocopy_send *zc = CONTAINER_OF(work, struct zerocopy_send,
+						work);
+	struct net_context *context = zc->context;
+
+	if (!zc->dropped) {
+		k_mutex_lock(&context->lock, K_FOREVER);
+
+		context->zerocopy.done_map |=
+			BIT(zc->id - context->zerocopy.done_id);
+		context->zerocopy.copied |= zc->copied;
+
+		/* Only whole ranges are reported */
+		while (context->zerocopy.done_map & BIT(0)) {
+			context->zerocopy.done_map >>= 1;
+			context->zerocopy.done_id++;
+		}
+
+		if (context->zerocopy.done_id != context->zerocopy.report_id) {
+			k_sem_give(&context->zerocopy.done);
+		}
+
+		k_mutex_unlock(&context->lock);
+	}
+
+	net_context_unref(context);
+	k_mem_slab_free(&zerocopy_sends, zc);
+}
+
+static void zerocopy_send_release(struct zerocopy_send *zc)
+{
+	if (atomic_dec(&zc->refs) == 1) {
+		k_work_submit(&zc->work);
+	}
+}
+
+static void zerocopy_buf_released(void *user_data)
+{
+	zerocopy_send_release(user_data);
+}
+
+static struct zerocopy_send *zerocopy_send_alloc(struct net_context *context,
+						 bool copied)
+{
+	struct zerocopy_send *zc;
+
+	if (context->zerocopy.next_id - context->zerocopy.done_id >=
+	    ZEROCOPY_MAX_PENDING) {
+		return NULL;
+	}
+
+	if (k_mem_slab_alloc(&zerocopy_sends, (void **)&zc, K_NO_WAIT) < 0) {
+		return NULL;
+	}
+
+	k_work_init(&zc->work, zerocopy_send_report);
+	zc->context = context;
+	atomic_set(&zc->refs, 1);
+	zc->id = 0U;
+	zc->copied = copied;
+	zc->dropped = false;
+
+	net_context_ref(context);
+
+	return zc;
+}
+
+/* Called with the context locked, once the send either failed or was
+ * handed to the stack.
+ */
+static void zerocopy_send_done(struct net_context *context,
+			       struct zerocopy_send *zc, bool dropped)
+{
+	if (zc == NULL) {
+		return;
+	}
+
+	if (dropped) {
+		zc->dropped = true;
+	} else {
+		zc->id = context->zerocopy.next_id++;
+	}
+
+	zerocopy_send_release(zc);
+}
+
+static int context_append_zerocopy(struct net_pkt *pkt,
+				   const struct msghdr *msghdr,
+				   struct zerocopy_send *zc)
+{
+	int ret;
+
+	for (int i = 0; i < msghdr->msg_iovlen; i++) {
+		if (msghdr->msg_iov[i].iov_len == 0) {
+			continue;
+		}
+
+		atomic_inc(&zc->refs);
+
+		ret = net_pkt_append_external(pkt, msghdr->msg_iov[i].iov_base,
+					      msghdr->msg_iov[i].iov_len,
+					      zerocopy_buf_released, zc,
+					      PKT_WAIT_TIME);
+		if (ret < 0) {
+			/* The sender still holds its own reference */
+			atomic_dec(&zc->refs);
+			return ret;
+		}
+	}
+
+	return 0;
+}
+
+int net_context_get_zerocopy_done(struct net_context *context,
+				  uint32_t *lo, uint32_t *hi, bool *copied)
+{
+	int ret = -EAGAIN;
+
+	k_mutex_lock(&context->lock, K_FOREVER);
+
+	if (context->zerocopy.done_id != context->zerocopy.report_id) {
+		*lo = context->zerocopy.report_id;
+		*hi = context->zerocopy.done_id - 1U;
+		*copied = context->zerocopy.copied;
+
+		context->zerocopy.report_id = context->zerocopy.done_id;
+		context->zerocopy.copied = false;
+		ret = 0;
+	}
+
+	k_sem_reset(&context->zerocopy.done);
+
+	k_mutex_unlock(&context->lock);
+
+	return ret;
+}
+#else
+struct zerocopy_send;
+
+static inline void zerocopy_send_done(struct net_context *context,
+				      struct zerocopy_send *zc, bool dropped)
+{
+	ARG_UNUSED(context);
+	ARG_UNUSED(zc);
+	ARG_UNUSED(dropped);
+}
+
+static inline int context_append_zerocopy(struct net_pkt *pkt,
+					  const struct msghdr *msghdr,
+					  struct zerocopy_send *zc)
+{
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(msghdr);
+	ARG_UNUSED(zc);
+
+	return -ENOTSUP;
+}
+#endif /* CONFIG_NET_PKT_TX_ZEROCOPY */
+
 /* If buf is not NULL, then use it. Otherwise read the data to be written
  * to net_pkt from msghdr.
  */
@@ -1750,7 +1934,8 @@ static int context_setup_udp_packet(struct net_context *context,
 				    size_t len,
 				    const struct msghdr *msg,
 				    const struct sockaddr *dst_addr,
-				    socklen_t addrlen)
+				    socklen_t addrlen,
+				    struct zerocopy_send *zc)
 {
 	int ret = -EINVAL;
 	uint16_t dst_port = 0U;
@@ -1788,7 +1973,12 @@ static int context_setup_udp_packet(struct net_context *context,
 		return ret;
 	}
 
-	ret = context_write_data(pkt, buf, len, msg);
+	if (zc != NULL) {
+		ret = context_append_zerocopy(pkt, msg, zc);
+	} else {
+		ret = context_write_data(pkt, buf, len, msg);
+	}
+
 	if (ret) {
 		return ret;
 	}
@@ -1875,9 +2065,12 @@ static int context_sendto(struct net_context *context,
 			  net_context_send_cb_t cb,
 			  k_timeout_t timeout,
 			  void *user_data,
+			  int flags,
 			  bool sendto)
 {
 	const struct msghdr *msghdr = NULL;
+	struct zerocopy_send *zc = NULL;
+	bool zerocopy = false;
 	struct net_if *iface;
 	struct net_pkt *pkt = NULL;
 	sa_family_t family;
@@ -2113,21 +2306,42 @@ static int context_sendto(struct net_context *context,
 	context->send_cb = cb;
 	context->user_data = user_data;
 
+#if defined(CONFIG_NET_PKT_TX_ZEROCOPY)
+	if ((flags & ZSOCK_MSG_ZEROCOPY) && msghdr) {
+		/* Only UDP sends the caller data as is, the other protocols
+		 * copy it and the send completes right away.
+		 */
+		zerocopy = IS_ENABLED(CONFIG_NET_UDP) &&
+			   net_context_get_proto(context) == IPPROTO_UDP &&
+			   !net_if_is_ip_offloaded(net_context_get_iface(context));
+
+		zc = zerocopy_send_alloc(context, !zerocopy);
+		if (!zc) {
+			return -ENOBUFS;
+		}
+	}
+#else
+	ARG_UNUSED(flags);
+#endif
+
 	if (IS_ENABLED(CONFIG_NET_TCP) &&
 	    net_context_get_proto(context) == IPPROTO_TCP &&
 	    !net_if_is_ip_offloaded(net_context_get_iface(context))) {
 		goto skip_alloc;
 	}
 
-	pkt = context_alloc_pkt(context, family, len, PKT_WAIT_TIME);
+	/* Zero-copy data is appended after the headers */
+	pkt = context_alloc_pkt(context, family, zerocopy ? 0 : len,
+				PKT_WAIT_TIME);
 	if (!pkt) {
 		NET_ERR("Failed to allocate net_pkt");
-		return -ENOBUFS;
+		ret = -ENOBUFS;
+		goto fail;
 	}
 
 	tmp_len = net_pkt_available_payload_buffer(
 				pkt, net_context_get_proto(context));
-	if (tmp_len < len) {
+	if (!zerocopy && tmp_len < len) {
 		if (net_context_get_type(context) == SOCK_DGRAM) {
 			NET_ERR("Available payload buffer (%zu) is not enough for requested DGRAM (%zu)",
 				tmp_len, len);
@@ -2179,7 +2393,8 @@ skip_alloc:
 	} else if (IS_ENABLED(CONFIG_NET_UDP) &&
 	    net_context_get_proto(context) == IPPROTO_UDP) {
 		ret = context_setup_udp_packet(context, family, pkt, buf, len, msghdr,
-					       dst_addr, addrlen);
+					       dst_addr, addrlen,
+					       zerocopy ? zc : NULL);
 		if (ret < 0) {
 			goto fail;
 		}
@@ -2247,12 +2462,16 @@ skip_alloc:
 		goto fail;
 	}
 
+	zerocopy_send_done(context, zc, false);
+
 	return len;
 fail:
 	if (pkt != NULL) {
 		net_pkt_unref(pkt);
 	}
 
+	zerocopy_send_done(context, zc, true);
+
 	return ret;
 }
 
@@ -2292,7 +2511,7 @@ int net_context_send(struct net_context *context,
 	}
 
 	ret = context_sendto(context, buf, len, &context->remote,
-			     addrlen, cb, timeout, user_data, false);
+			     addrlen, cb, timeout, user_data, 0, false);
 unlock:
 	k_mutex_unlock(&context->lock);
 
@@ -2311,7 +2530,7 @@ int net_context_sendmsg(struct net_context *context,
 	k_mutex_lock(&context->lock, K_FOREVER);
 
 	ret = context_sendto(context, msghdr, 0, NULL, 0,
-			     cb, timeout, user_data, true);
+			     cb, timeout, user_data, flags, true);
 
 	k_mutex_unlock(&context->lock);
 
@@ -2332,7 +2551,7 @@ int net_context_sendto(struct net_context *context,
 	k_mutex_lock(&context->lock, K_FOREVER);
 
 	ret = context_sendto(context, buf, len, dst_addr, addrlen,
-			     cb, timeout, user_data, true);
+			     cb, timeout, user_data, 0, true);
 
 	k_mutex_unlock(&context->lock);
 
@@ -463,7 +463,7 @@ void net_process_rx_packet(struct net_pkt *pkt)
 	net_rx(net_pkt_iface(pkt), pkt);
 }
 
-static void net_queue_rx(struct net_if *iface, struct net_pkt *pkt)
+static void net_queue_rx(struct net_if *iface, struct net_pkt *pkt, int queue)
 {
 	uint8_t prio = net_pkt_priority(pkt);
 	uint8_t tc = net_rx_priority2tc(prio);
@@ -481,12 +481,15 @@ static void net_queue_rx(struct net_if *iface, struct net_pkt *pkt)
 	if (NET_TC_RX_COUNT == 0) {
 		net_process_rx_packet(pkt);
 	} else {
-		net_tc_submit_to_rx_queue(tc, pkt);
+		if (queue < 0) {
+			queue = net_rx_flow2queue(pkt);
+		}
+
+		net_tc_submit_to_rx_queue(tc, queue % NET_RX_QUEUES, pkt);
 	}
 }
 
-/* Called by driver when a packet has been received */
-int net_recv_data(struct net_if *iface, struct net_pkt *pkt)
+static int recv_data(struct net_if *iface, struct net_pkt *pkt, int queue)
 {
 	if (!pkt || !iface) {
 		return -EINVAL;
@@ -516,12 +519,23 @@ int net_recv_data(struct net_if *iface, struct net_pkt *pkt)
 		/* silently drop the packet */
 		net_pkt_unref(pkt);
 	} else {
-		net_queue_rx(iface, pkt);
+		net_queue_rx(iface, pkt, queue);
 	}
 
 	return 0;
 }
 
+/* Called by driver when a packet has been received */
+int net_recv_data(struct net_if *iface, struct net_pkt *pkt)
+{
+	return recv_data(iface, pkt, -1);
+}
+
+int net_recv_data_queue(struct net_if *iface, struct net_pkt *pkt, int queue)
+{
+	return recv_data(iface, pkt, queue);
+}
+
 static inline void l3_init(void)
 {
 	net_icmpv4_init();
@@ -136,6 +136,19 @@ NET_BUF_POOL_VAR_DEFINE(tx_bufs, CONFIG_NET_BUF_TX_COUNT, CONFIG_NET_BUF_DATA_PO
 
 #endif /* CONFIG_NET_BUF_FIXED_DATA_SIZE */
 
+#if defined(CONFIG_NET_PKT_TX_ZEROCOPY)
+struct tx_ext_data {
+	net_pkt_ext_cb_t cb;
+	void *user_data;
+};
+
+static void tx_ext_destroy(struct net_buf *buf);
+
+/* Buffer descriptors only, the data is owned by the caller */
+NET_BUF_POOL_DEFINE(tx_ext_bufs, CONFIG_NET_PKT_TX_ZEROCOPY_COUNT, 0,
+		    sizeof(struct tx_ext_data), tx_ext_destroy);
+#endif /* CONFIG_NET_PKT_TX_ZEROCOPY */
+
 /* Allocation tracking is only available if separately enabled */
 #if defined(CONFIG_NET_DEBUG_NET_PKT_ALLOC)
 struct net_pkt_alloc {
@@ -959,17 +972,23 @@ static size_t pkt_buffer_length(struct net_pkt *pkt,
 
 	/* Family vs iface MTU */
 	if (IS_ENABLED(CONFIG_NET_IPV6) && family == AF_INET6) {
-		if (IS_ENABLED(CONFIG_NET_IPV6_FRAGMENT) && (size > max_len)) {
-			/* We support larger packets if IPv6 fragmentation is
-			 * enabled.
+		if ((IS_ENABLED(CONFIG_NET_IPV6_FRAGMENT) ||
+		     (IS_ENABLED(CONFIG_NET_TCP_TSO) && proto == IPPROTO_TCP)) &&
+		    (size > max_len)) {
+			/* We support larger packets if IPv6 fragmentation or
+			 * TCP segmentation offload is enabled.
 			 */
 			max_len = size;
 		}
 
 		max_len = MAX(max_len, NET_IPV6_MTU);
 	} else if (IS_ENABLED(CONFIG_NET_IPV4) && family == AF_INET) {
-		if (IS_ENABLED(CONFIG_NET_IPV4_FRAGMENT) && (size > max_len)) {
-			/* We support larger packets if IPv4 fragmentation is enabled */
+		if ((IS_ENABLED(CONFIG_NET_IPV4_FRAGMENT) ||
+		     (IS_ENABLED(CONFIG_NET_TCP_TSO) && proto == IPPROTO_TCP)) &&
+		    (size > max_len)) {
+			/* We support larger packets if IPv4 fragmentation or TCP
+			 * segmentation offload is enabled
+			 */
 			max_len = size;
 		}
 
@@ -1551,6 +1570,55 @@ void net_pkt_append_buffer(struct net_pkt *pkt, struct net_buf *buffer)
 	}
 }
 
+#if defined(CONFIG_NET_PKT_TX_ZEROCOPY)
+static void tx_ext_destroy(struct net_buf *buf)
+{
+	struct tx_ext_data *ext = net_buf_user_data(buf);
+	net_pkt_ext_cb_t cb = ext->cb;
+	void *user_data = ext->user_data;
+
+	net_buf_destroy(buf);
+
+	if (cb) {
+		cb(user_data);
+	}
+}
+
+int net_pkt_append_external(struct net_pkt *pkt, const void *data,
+			    size_t length, net_pkt_ext_cb_t cb,
+			    void *user_data, k_timeout_t timeout)
+{
+	struct tx_ext_data *ext;
+	struct net_buf *buf;
+
+	if (k_is_in_isr()) {
+		timeout = K_NO_WAIT;
+	}
+
+	buf = net_buf_alloc_with_data(&tx_ext_bufs, (void *)data, length,
+				      timeout);
+	if (!buf) {
+		NET_DBG("No external buffer descriptor for pkt %p", pkt);
+		return -ENOMEM;
+	}
+
+	ext = net_buf_user_data(buf);
+	ext->cb = cb;
+	ext->user_data = user_data;
+
+	/* Unused space left in front of the data could not be written
+	 * anymore, so drop it.
+	 */
+	net_pkt_trim_buffer(pkt);
+	net_pkt_append_buffer(pkt, buf);
+
+	pkt->cursor.buf = buf;
+	pkt->cursor.pos = buf->data + buf->len;
+
+	return 0;
+}
+#endif /* CONFIG_NET_PKT_TX_ZEROCOPY */
+
 void net_pkt_cursor_init(struct net_pkt *pkt)
 {
 	pkt->cursor.buf = pkt->buffer;
@@ -1750,6 +1818,72 @@ int net_pkt_write(struct net_pkt *pkt, const void *data, size_t length)
 	return net_pkt_cursor_operate(pkt, (void *)data, length, true, true);
 }
 
+int net_pkt_write_chksum(struct net_pkt *pkt, const void *data, size_t length,
+			 uint16_t *sum)
+{
+	struct net_pkt_cursor *c_op = &pkt->cursor;
+	bool overwrite = net_pkt_is_being_overwritten(pkt);
+	bool odd = net_pkt_get_current_offset(pkt) & 1;
+	const uint8_t *src = data;
+
+	NET_DBG("pkt %p data %p length %zu", pkt, data, length);
+
+	while (c_op->buf && length) {
+		size_t d_len, len;
+		uint16_t chunk;
+
+		pkt_cursor_advance(pkt, !overwrite);
+		if (c_op->buf == NULL) {
+			break;
+		}
+
+		if (!overwrite) {
+			d_len = net_buf_max_len(c_op->buf) -
+				(c_op->pos - c_op->buf->data);
+		} else {
+			d_len = c_op->buf->len - (c_op->pos - c_op->buf->data);
+		}
+
+		if (!d_len) {
+			break;
+		}
+
+		len = MIN(length, d_len);
+
+		chunk = calc_chksum_copy(0U, c_op->pos, src, len);
+
+		/* Data starting at an odd offset has its bytes swapped
+		 * within the 16-bit words.
+		 */
+		if (odd) {
+			chunk = BSWAP_16(chunk);
+		}
+
+		*sum += chunk;
+		if (*sum < chunk) {
+			(*sum)++;
+		}
+
+		odd ^= len & 1;
+
+		if (!overwrite) {
+			net_buf_add(c_op->buf, len);
+		}
+
+		pkt_cursor_update(pkt, len, true);
+
+		src += len;
+		length -= len;
+	}
+
+	if (length) {
+		NET_DBG("Still some length to go %zu", length);
+		return -ENOBUFS;
+	}
+
+	return 0;
+}
+
 int net_pkt_copy(struct net_pkt *pkt_dst,
 		 struct net_pkt *pkt_src,
 		 size_t length)
@@ -1874,6 +2008,7 @@ static void clone_pkt_attributes(struct net_pkt *pkt, struct net_pkt *clone_pkt)
 	net_pkt_set_ptp(clone_pkt, net_pkt_is_ptp(pkt));
 	net_pkt_set_forwarding(clone_pkt, net_pkt_forwarding(pkt));
 	net_pkt_set_chksum_done(clone_pkt, net_pkt_is_chksum_done(pkt));
+	net_pkt_set_tso_mss(clone_pkt, net_pkt_tso_mss(pkt));
 	net_pkt_set_ip_reassembled(pkt, net_pkt_is_ip_reassembled(pkt));
 
 	net_pkt_set_l2_bridged(clone_pkt, net_pkt_is_l2_bridged(pkt));
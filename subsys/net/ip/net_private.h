@@ -129,9 +129,32 @@ static inline enum net_verdict net_ipv6_input(struct net_pkt *pkt,
 }
 #endif
 extern bool net_tc_submit_to_tx_queue(uint8_t tc, struct net_pkt *pkt);
-extern void net_tc_submit_to_rx_queue(uint8_t tc, struct net_pkt *pkt);
+extern void net_tc_submit_to_rx_queue(uint8_t tc, uint8_t queue,
+				      struct net_pkt *pkt);
+#if NET_RX_QUEUES > 1
+extern uint8_t net_rx_flow2queue(struct net_pkt *pkt);
+#else
+static inline uint8_t net_rx_flow2queue(struct net_pkt *pkt)
+{
+	ARG_UNUSED(pkt);
+
+	return 0;
+}
+#endif
 extern enum net_verdict net_promisc_mode_input(struct net_pkt *pkt);
 
+#if defined(CONFIG_NET_TCP_GRO)
+extern struct net_pkt *net_tcp_gro(struct k_fifo *fifo, struct net_pkt *pkt);
+#else
+static inline struct net_pkt *net_tcp_gro(struct k_fifo *fifo,
+					  struct net_pkt *pkt)
+{
+	ARG_UNUSED(fifo);
+
+	return pkt;
+}
+#endif
+
 char *net_sprint_addr(sa_family_t af, const void *addr);
 
 #define net_sprint_ipv4_addr(_addr) net_sprint_addr(AF_INET, _addr)
@@ -206,6 +229,8 @@ extern char *net_byte_to_hex(char *ptr, uint8_t byte, char base, bool pad);
 extern char *net_sprint_ll_addr_buf(const uint8_t *ll, uint8_t ll_len,
 				    char *buf, int buflen);
 extern uint16_t calc_chksum(uint16_t sum_in, const uint8_t *data, size_t len);
+extern uint16_t calc_chksum_copy(uint16_t sum, uint8_t *dst, const uint8_t *src,
+				 size_t len);
 extern uint16_t net_calc_chksum(struct net_pkt *pkt, uint8_t proto);
 
 /**
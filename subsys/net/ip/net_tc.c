@@ -8,11 +8,13 @@
 LOG_MODULE_REGISTER(net_tc, CONFIG_NET_TC_LOG_LEVEL);
 
 #include <zephyr/kernel.h>
+#include <zephyr/sys/byteorder.h>
 #include <string.h>
 
 #include <zephyr/net/net_core.h>
 #include <zephyr/net/net_pkt.h>
 #include <zephyr/net/net_stats.h>
+#include <zephyr/net/ethernet.h>
 
 #include "net_private.h"
 #include "net_stats.h"
@@ -21,15 +23,19 @@ LOG_MODULE_REGISTER(net_tc, CONFIG_NET_TC_LOG_LEVEL);
 /* Template for thread name. The "xx" is either "TX" denoting transmit thread,
  * or "RX" denoting receive thread. The "q[y]" denotes the traffic class queue
  * where y indicates the traffic class id. The value of y can be from 0 to 7.
+ * With several RX queues, ".z" is the RX queue index.
  */
-#define MAX_NAME_LEN sizeof("xx_q[y]")
+#define MAX_NAME_LEN sizeof("xx_q[y.zz]")
+
+/* There is a full set of RX traffic class threads for each RX queue */
+#define NET_TC_RX_THREADS (NET_TC_RX_COUNT * NET_RX_QUEUES)
 
 /* Stacks for TX work queue */
 K_KERNEL_STACK_ARRAY_DEFINE(tx_stack, NET_TC_TX_COUNT,
 			    CONFIG_NET_TX_STACK_SIZE);
 
 /* Stacks for RX work queue */
-K_KERNEL_STACK_ARRAY_DEFINE(rx_stack, NET_TC_RX_COUNT,
+K_KERNEL_STACK_ARRAY_DEFINE(rx_stack, NET_TC_RX_THREADS,
 			    CONFIG_NET_RX_STACK_SIZE);
 
 #if NET_TC_TX_COUNT > 0
@@ -37,7 +43,7 @@ static struct net_traffic_class tx_classes[NET_TC_TX_COUNT];
 #endif
 
 #if NET_TC_RX_COUNT > 0
-static struct net_traffic_class rx_classes[NET_TC_RX_COUNT];
+static struct net_traffic_class rx_classes[NET_TC_RX_THREADS];
 #endif
 
 #if NET_TC_RX_COUNT > 0 || NET_TC_TX_COUNT > 0
@@ -60,18 +66,131 @@ bool net_tc_submit_to_tx_queue(uint8_t tc, struct net_pkt *pkt)
 	return true;
 }
 
-void net_tc_submit_to_rx_queue(uint8_t tc, struct net_pkt *pkt)
+void net_tc_submit_to_rx_queue(uint8_t tc, uint8_t queue, struct net_pkt *pkt)
 {
 #if NET_TC_RX_COUNT > 0
 	net_pkt_set_rx_stats_tick(pkt, k_cycle_get_32());
 
-	submit_to_queue(&rx_classes[tc].fifo, pkt);
+	submit_to_queue(&rx_classes[tc * NET_RX_QUEUES + queue].fifo, pkt);
 #else
 	ARG_UNUSED(tc);
+	ARG_UNUSED(queue);
 	ARG_UNUSED(pkt);
 #endif
 }
 
+#if NET_RX_QUEUES > 1
+/* Enough for an Ethernet header with a VLAN tag, an IPv4 header with
+ * options and the TCP ports.
+ */
+#define FLOW_HDR_MAX (sizeof(struct net_eth_vlan_hdr) + 60 + 4)
+
+static uint32_t flow_hash_mix(uint32_t hash, const uint8_t *data, size_t len)
+{
+	while (len--) {
+		hash = (hash ^ *data++) * 16777619U;
+	}
+
+	return hash;
+}
+
+static inline bool flow_l2_is_ethernet(const struct net_l2 *l2)
+{
+#if defined(CONFIG_NET_L2_ETHERNET)
+	return l2 == &NET_L2_GET_NAME(ETHERNET);
+#else
+	ARG_UNUSED(l2);
+
+	return false;
+#endif
+}
+
+static inline bool flow_l2_is_raw_ip(const struct net_l2 *l2)
+{
+#if defined(CONFIG_NET_L2_DUMMY)
+	return l2 == &NET_L2_GET_NAME(DUMMY);
+#else
+	ARG_UNUSED(l2);
+
+	return false;
+#endif
+}
+
+/* Software RSS. The hash covers the addresses, and the ports for TCP, so
+ * that all the packets of a flow use the same queue and stay in order.
+ * UDP and the other protocols are hashed on the addresses only, as IP
+ * fragments do not carry the ports. Packets that cannot be parsed, and
+ * L2 types other than Ethernet and raw IP, all use the first queue.
+ */
+uint8_t net_rx_flow2queue(struct net_pkt *pkt)
+{
+	const struct net_l2 *l2 = net_if_l2(net_pkt_iface(pkt));
+	uint32_t hash = 2166136261U;
+	uint8_t hdr[FLOW_HDR_MAX];
+	size_t len, off = 0;
+	uint8_t *ip;
+	int ret;
+
+	len = MIN(net_pkt_get_len(pkt), sizeof(hdr));
+	ret = net_pkt_read(pkt, hdr, len);
+	net_pkt_cursor_init(pkt);
+
+	if (ret < 0) {
+		return 0;
+	}
+
+	if (flow_l2_is_ethernet(l2)) {
+		uint16_t type;
+
+		if (len < sizeof(struct net_eth_hdr)) {
+			return 0;
+		}
+
+		type = sys_get_be16(&hdr[12]);
+		off = sizeof(struct net_eth_hdr);
+
+		if (type == NET_ETH_PTYPE_VLAN &&
+		    len >= sizeof(struct net_eth_vlan_hdr)) {
+			type = sys_get_be16(&hdr[16]);
+			off = sizeof(struct net_eth_vlan_hdr);
+		}
+
+		if (type != NET_ETH_PTYPE_IP && type != NET_ETH_PTYPE_IPV6) {
+			return 0;
+		}
+	} else if (!flow_l2_is_raw_ip(l2)) {
+		return 0;
+	}
+
+	ip = &hdr[off];
+	len -= off;
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && len >= NET_IPV4H_LEN &&
+	    (ip[0] >> 4) == 4) {
+		size_t hdr_len = (ip[0] & 0x0f) * 4U;
+		uint16_t frag = sys_get_be16(&ip[6]);
+
+		hash = flow_hash_mix(hash, &ip[12], 2 * sizeof(struct in_addr));
+
+		if (ip[9] == IPPROTO_TCP && len >= hdr_len + 4 &&
+		    !(frag & (NET_IPV4_MORE_FRAG_MASK | NET_IPV4_FRAGH_OFFSET_MASK))) {
+			hash = flow_hash_mix(hash, &ip[hdr_len], 4);
+		}
+	} else if (IS_ENABLED(CONFIG_NET_IPV6) && len >= NET_IPV6H_LEN &&
+		   (ip[0] >> 4) == 6) {
+		hash = flow_hash_mix(hash, &ip[8], 2 * sizeof(struct in6_addr));
+
+		if (ip[6] == IPPROTO_TCP && len >= NET_IPV6H_LEN + 4) {
+			hash = flow_hash_mix(hash, &ip[NET_IPV6H_LEN], 4);
+		}
+	} else {
+		return 0;
+	}
+
+	return hash % NET_RX_QUEUES;
+}
+#endif /* NET_RX_QUEUES > 1 */
+
 int net_tx_priority2tc(enum net_priority prio)
 {
 #if NET_TC_TX_COUNT > 0
@@ -251,6 +370,9 @@ static void tc_rx_handler(void *p1, void *p2, void *p3)
 			continue;
 		}
 
+		/* Coalesce the segments of a TCP flow queued behind it */
+		pkt = net_tcp_gro(fifo, pkt);
+
 		net_process_rx_packet(pkt);
 	}
 }
@@ -351,12 +473,13 @@ void net_tc_rx_init(void)
 	net_if_foreach(net_tc_rx_stats_priority_setup, NULL);
 #endif
 
-	for (i = 0; i < NET_TC_RX_COUNT; i++) {
+	for (i = 0; i < NET_TC_RX_THREADS; i++) {
+		uint8_t queue = i % NET_RX_QUEUES;
 		uint8_t thread_priority;
 		int priority;
 		k_tid_t tid;
 
-		thread_priority = rx_tc2thread(i);
+		thread_priority = rx_tc2thread(i / NET_RX_QUEUES);
 
 		priority = IS_ENABLED(CONFIG_NET_TC_THREAD_COOPERATIVE) ?
 			K_PRIO_COOP(thread_priority) :
@@ -386,10 +509,25 @@ void net_tc_rx_init(void)
 		if (IS_ENABLED(CONFIG_THREAD_NAME)) {
 			char name[MAX_NAME_LEN];
 
-			snprintk(name, sizeof(name), "rx_q[%d]", i);
+			if (NET_RX_QUEUES > 1) {
+				snprintk(name, sizeof(name), "rx_q[%d.%d]",
+					 i / NET_RX_QUEUES, queue);
+			} else {
+				snprintk(name, sizeof(name), "rx_q[%d]", i);
+			}
+
 			k_thread_name_set(tid, name);
 		}
 
+#if defined(CONFIG_SMP) && defined(CONFIG_SCHED_CPU_MASK)
+		/* Keep the RX queues on different CPUs */
+		if (NET_RX_QUEUES > 1) {
+			(void)k_thread_cpu_pin(tid, queue % arch_num_cpus());
+		}
+#else
+		ARG_UNUSED(queue);
+#endif
+
 		k_thread_start(tid);
 	}
 #endif
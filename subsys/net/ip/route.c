@@ -273,15 +273,216 @@ static inline void update_route_access(struct net_route_entry *route)
 	sys_slist_prepend(&routes, &route->node);
 }
 
-struct net_route_entry *net_route_lookup(struct net_if *iface,
-					 struct in6_addr *dst)
+#if defined(CONFIG_NET_ROUTE_TRIE)
+/* Path compressed binary trie of the route prefixes. A node either has
+ * routes for its prefix or branches to two children.
+ */
+struct net_route_trie_node {
+	struct net_route_trie_node *parent;
+	struct net_route_trie_node *child[2];
+
+	/** Routes with this prefix, one per interface */
+	sys_slist_t routes;
+
+	struct in6_addr prefix;
+	uint8_t len;
+	bool in_use;
+};
+
+static struct net_route_trie_node route_trie_nodes[2 * CONFIG_NET_MAX_ROUTES];
+static struct net_route_trie_node *route_trie_root;
+
+static inline uint8_t route_prefix_bit(const struct in6_addr *addr, uint8_t pos)
+{
+	return (addr->s6_addr[pos / 8U] >> (7U - pos % 8U)) & 1U;
+}
+
+static uint8_t route_prefix_common_len(const struct in6_addr *a,
+				       const struct in6_addr *b,
+				       uint8_t max_len)
+{
+	uint8_t len = 0U;
+	int i;
+
+	for (i = 0; i < sizeof(a->s6_addr) && len < max_len; i++) {
+		uint8_t diff = a->s6_addr[i] ^ b->s6_addr[i];
+
+		if (diff == 0U) {
+			len += 8U;
+			continue;
+		}
+
+		while (!(diff & 0x80)) {
+			diff <<= 1;
+			len++;
+		}
+
+		break;
+	}
+
+	return MIN(len, max_len);
+}
+
+static struct net_route_trie_node *route_trie_node_alloc(const struct in6_addr *prefix,
+							 uint8_t len,
+							 struct net_route_trie_node *parent)
+{
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(route_trie_nodes); i++) {
+		struct net_route_trie_node *node = &route_trie_nodes[i];
+
+		if (node->in_use) {
+			continue;
+		}
+
+		(void)memset(node, 0, sizeof(*node));
+		net_ipaddr_copy(&node->prefix, prefix);
+		node->len = len;
+		node->parent = parent;
+		node->in_use = true;
+		sys_slist_init(&node->routes);
+
+		return node;
+	}
+
+	return NULL;
+}
+
+static int route_trie_insert(struct net_route_entry *route)
+{
+	struct net_route_trie_node **link = &route_trie_root;
+	struct net_route_trie_node *parent = NULL;
+	struct net_route_trie_node *node, *new, *branch;
+	uint8_t len = route->prefix_len;
+	uint8_t common = 0U;
+
+	while ((node = *link) != NULL) {
+		common = route_prefix_common_len(&route->addr, &node->prefix,
+						 MIN(len, node->len));
+		if (common < node->len) {
+			break;
+		}
+
+		if (node->len == len) {
+			goto add;
+		}
+
+		parent = node;
+		link = &node->child[route_prefix_bit(&route->addr, node->len)];
+	}
+
+	new = route_trie_node_alloc(&route->addr, len, parent);
+	if (!new) {
+		return -ENOMEM;
+	}
+
+	if (node == NULL) {
+		*link = new;
+	} else if (common == len) {
+		/* The new prefix covers the existing node */
+		new->child[route_prefix_bit(&node->prefix, len)] = node;
+		node->parent = new;
+		*link = new;
+	} else {
+		branch = route_trie_node_alloc(&route->addr, common, parent);
+		if (!branch) {
+			new->in_use = false;
+			return -ENOMEM;
+		}
+
+		branch->child[route_prefix_bit(&node->prefix, common)] = node;
+		branch->child[route_prefix_bit(&route->addr, common)] = new;
+		node->parent = branch;
+		new->parent = branch;
+		*link = branch;
+	}
+
+	node = new;
+add:
+	sys_slist_append(&node->routes, &route->trie_entry);
+	route->trie = node;
+
+	return 0;
+}
+
+static void route_trie_remove(struct net_route_entry *route)
+{
+	struct net_route_trie_node *node = route->trie;
+
+	if (!node) {
+		return;
+	}
+
+	sys_slist_find_and_remove(&node->routes, &route->trie_entry);
+	route->trie = NULL;
+
+	/* Nodes without routes are only needed for branching */
+	while (node && sys_slist_is_empty(&node->routes) &&
+	       (node->child[0] == NULL || node->child[1] == NULL)) {
+		struct net_route_trie_node *parent = node->parent;
+		struct net_route_trie_node *child;
+
+		child = node->child[0] ? node->child[0] : node->child[1];
+		if (child) {
+			child->parent = parent;
+		}
+
+		if (parent) {
+			parent->child[parent->child[1] == node] = child;
+		} else {
+			route_trie_root = child;
+		}
+
+		node->in_use = false;
+		node = parent;
+	}
+}
+
+static struct net_route_entry *route_find(struct net_if *iface,
+					  struct in6_addr *dst)
+{
+	struct net_route_trie_node *node = route_trie_root;
+	struct net_route_entry *route, *found = NULL;
+
+	while (node && net_ipv6_is_prefix(dst->s6_addr, node->prefix.s6_addr,
+					  node->len)) {
+		SYS_SLIST_FOR_EACH_CONTAINER(&node->routes, route, trie_entry) {
+			if (!iface || route->iface == iface) {
+				found = route;
+				break;
+			}
+		}
+
+		if (node->len == 128U) {
+			break;
+		}
+
+		node = node->child[route_prefix_bit(dst, node->len)];
+	}
+
+	return found;
+}
+#else
+static inline int route_trie_insert(struct net_route_entry *route)
+{
+	ARG_UNUSED(route);
+
+	return 0;
+}
+
+static inline void route_trie_remove(struct net_route_entry *route)
+{
+	ARG_UNUSED(route);
+}
+
+static struct net_route_entry *route_find(struct net_if *iface,
+					  struct in6_addr *dst)
 {
 	struct net_route_entry *route, *found = NULL;
 	uint8_t longest_match = 0U;
 	int i;
 
-	net_ipv6_nbr_lock();
-
 	for (i = 0; i < CONFIG_NET_MAX_ROUTES && longest_match < 128; i++) {
 		struct net_nbr *nbr = get_nbr(i);
 
@@ -304,6 +505,81 @@ struct net_route_entry *net_route_lookup(struct net_if *iface,
 		}
 	}
 
+	return found;
+}
+#endif /* CONFIG_NET_ROUTE_TRIE */
+
+#if CONFIG_NET_ROUTE_CACHE_SIZE > 0
+struct route_cache_entry {
+	struct in6_addr dst;
+	struct net_if *iface;
+	struct net_route_entry *route;
+	uint32_t generation;
+};
+
+static struct route_cache_entry route_cache[CONFIG_NET_ROUTE_CACHE_SIZE];
+
+/* Bumped on every routing table change, the cache entries of older
+ * generations are stale. Entries start at 0 which is never valid.
+ */
+static uint32_t route_generation = 1U;
+
+static inline void route_table_changed(void)
+{
+	if (++route_generation == 0U) {
+		(void)memset(route_cache, 0, sizeof(route_cache));
+		route_generation = 1U;
+	}
+}
+
+static inline struct route_cache_entry *route_cache_slot(struct net_if *iface,
+							 struct in6_addr *dst)
+{
+	uint32_t hash = dst->s6_addr32[2] ^ dst->s6_addr32[3] ^ (uintptr_t)iface;
+
+	hash ^= hash >> 16;
+	hash ^= hash >> 8;
+
+	return &route_cache[hash % CONFIG_NET_ROUTE_CACHE_SIZE];
+}
+
+static struct net_route_entry *route_cache_find(struct net_if *iface,
+						struct in6_addr *dst)
+{
+	struct route_cache_entry *entry = route_cache_slot(iface, dst);
+
+	if (entry->generation == route_generation && entry->iface == iface &&
+	    net_ipv6_addr_cmp(&entry->dst, dst)) {
+		return entry->route;
+	}
+
+	entry->route = route_find(iface, dst);
+	entry->iface = iface;
+	entry->generation = route_generation;
+	net_ipaddr_copy(&entry->dst, dst);
+
+	return entry->route;
+}
+#else
+static inline void route_table_changed(void)
+{
+}
+
+static inline struct net_route_entry *route_cache_find(struct net_if *iface,
+						       struct in6_addr *dst)
+{
+	return route_find(iface, dst);
+}
+#endif /* CONFIG_NET_ROUTE_CACHE_SIZE > 0 */
+
+struct net_route_entry *net_route_lookup(struct net_if *iface,
+					 struct in6_addr *dst)
+{
+	struct net_route_entry *found;
+
+	net_ipv6_nbr_lock();
+
+	found = route_cache_find(iface, dst);
 	if (found) {
 		net_route_info("Found", found, dst);
 
@@ -452,6 +728,12 @@ struct net_route_entry *net_route_add(struct net_if *iface,
 
 	sys_slist_prepend(&routes, &route->node);
 
+	if (route_trie_insert(route) < 0) {
+		NET_ERR("No prefix trie node available!");
+	}
+
+	route_table_changed();
+
 	tmp = nbr_nexthop_get(iface, nexthop);
 
 	NET_ASSERT(tmp == nbr_nexthop);
@@ -602,6 +884,9 @@ int net_route_del(struct net_route_entry *route)
 
 	net_route_info("Deleted", route, &route->addr);
 
+	route_trie_remove(route);
+	route_table_changed();
+
 	SYS_SLIST_FOR_EACH_CONTAINER(&route->nexthop, nexthop_route, node) {
 		if (!nexthop_route->nbr) {
 			continue;
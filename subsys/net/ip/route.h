@@ -38,6 +38,8 @@ struct net_route_nexthop {
 	struct net_nbr *nbr;
 };
 
+struct net_route_trie_node;
+
 /**
  * @brief Route entry to a specific neighbor.
  */
@@ -52,6 +54,14 @@ struct net_route_entry {
 	/** List of neighbors that the routes go through. */
 	sys_slist_t nexthop;
 
+#if defined(CONFIG_NET_ROUTE_TRIE)
+	/** Node in the list of routes of a prefix trie node. */
+	sys_snode_t trie_entry;
+
+	/** Prefix trie node having this route, NULL if not in the trie. */
+	struct net_route_trie_node *trie;
+#endif
+
 	/** Network interface for the route. */
 	struct net_if *iface;
 
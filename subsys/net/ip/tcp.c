@@ -64,10 +64,6 @@ static int tcp_tx_window =
 #define TCP_RTO_MS (tcp_rto)
 #endif
 
-/* Define the number of MSS sections the congestion window is initialized at */
-#define TCP_CONGESTION_INITIAL_WIN 1
-#define TCP_CONGESTION_INITIAL_SSTHRESH 3
-
 static sys_slist_t tcp_conns = SYS_SLIST_STATIC_INIT(&tcp_conns);
 
 static K_MUTEX_DEFINE(tcp_lock);
@@ -400,64 +396,123 @@ static void tcp_derive_rto(struct tcp *conn)
 
 #ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
 
-/* Implementation according to RFC6582 */
+/* Window growth is left to the congestion control algorithm of the
+ * connection, slow start and the fast recovery of RFC6582 are common to
+ * all of them.
+ */
 
-static void tcp_new_reno_log(struct tcp *conn, char *step)
+static void tcp_ca_log(struct tcp *conn, char *step)
 {
-	NET_DBG("conn: %p, ca %s, cwnd=%d, ssthres=%d, fast_pend=%i",
-		conn, step, conn->ca.cwnd, conn->ca.ssthresh,
+	NET_DBG("conn: %p, ca %s %s, cwnd=%d, ssthres=%d, fast_pend=%i",
+		conn, conn->ca.ops->name, step, conn->ca.cwnd, conn->ca.ssthresh,
 		conn->ca.pending_fast_retransmit_bytes);
 }
 
-static void tcp_new_reno_init(struct tcp *conn)
+/* Implementation according to RFC6582 */
+
+static uint32_t tcp_new_reno_ssthresh(struct tcp *conn)
+{
+	return MAX(conn_mss(conn) * 2, conn->unacked_len / 2);
+}
+
+static void tcp_new_reno_cong_avoid(struct tcp *conn, uint32_t acked_len)
+{
+	int32_t new_win = conn->ca.cwnd;
+	int32_t win_inc = MIN(acked_len, conn_mss(conn));
+
+	/* Implement a div_ceil	to avoid rounding to 0 */
+	new_win += ((win_inc * win_inc) + conn->ca.cwnd - 1) / conn->ca.cwnd;
+	conn->ca.cwnd = MIN(new_win, TCP_MAX_WIN);
+}
+
+TCP_CA_DEFINE(tcp_ca_new_reno, "reno", NULL, tcp_new_reno_ssthresh,
+	      tcp_new_reno_cong_avoid);
+
+static const struct tcp_ca_ops *tcp_ca_find(const char *name, size_t len)
+{
+	STRUCT_SECTION_FOREACH(tcp_ca_ops, ops) {
+		if (strlen(ops->name) == len && strncmp(ops->name, name, len) == 0) {
+			return ops;
+		}
+	}
+
+	return NULL;
+}
+
+static void tcp_ca_select_default(struct tcp *conn)
+{
+	conn->ca.ops = tcp_ca_find(CONFIG_NET_TCP_CONGESTION_DEFAULT,
+				   sizeof(CONFIG_NET_TCP_CONGESTION_DEFAULT) - 1);
+	if (conn->ca.ops == NULL) {
+		NET_WARN("Unknown congestion control %s, using %s",
+			 CONFIG_NET_TCP_CONGESTION_DEFAULT, tcp_ca_new_reno.name);
+		conn->ca.ops = &tcp_ca_new_reno;
+	}
+
+	/* Initially set the congestion window at its max size, since only the MSS
+	 * is available as soon as the connection is established
+	 */
+	conn->ca.cwnd = TCP_MAX_WIN;
+}
+
+static void tcp_ca_copy(struct tcp *to, struct tcp *from)
+{
+	to->ca.ops = from->ca.ops;
+}
+
+static void tcp_ca_init(struct tcp *conn)
 {
-	conn->ca.cwnd = conn_mss(conn) * TCP_CONGESTION_INITIAL_WIN;
-	conn->ca.ssthresh = conn_mss(conn) * TCP_CONGESTION_INITIAL_SSTHRESH;
+	conn->ca.cwnd = conn_mss(conn) * CONFIG_NET_TCP_CONGESTION_INITIAL_WIN;
+	/* RFC5681 ch 3.1: the initial ssthresh should be arbitrarily high */
+	conn->ca.ssthresh = conn->send_win_max;
 	conn->ca.pending_fast_retransmit_bytes = 0;
-	tcp_new_reno_log(conn, "init");
+
+	if (conn->ca.ops->init != NULL) {
+		conn->ca.ops->init(conn);
+	}
+
+	tcp_ca_log(conn, "init");
 }
 
-static void tcp_new_reno_fast_retransmit(struct tcp *conn)
+static void tcp_ca_fast_retransmit(struct tcp *conn)
 {
 	if (conn->ca.pending_fast_retransmit_bytes == 0) {
-		conn->ca.ssthresh = MAX(conn_mss(conn) * 2, conn->unacked_len / 2);
+		conn->ca.ssthresh = conn->ca.ops->ssthresh(conn);
 		/* Account for the lost segments */
 		conn->ca.cwnd = conn_mss(conn) * 3 + conn->ca.ssthresh;
 		conn->ca.pending_fast_retransmit_bytes = conn->unacked_len;
-		tcp_new_reno_log(conn, "fast_retransmit");
+		tcp_ca_log(conn, "fast_retransmit");
 	}
 }
 
-static void tcp_new_reno_timeout(struct tcp *conn)
+static void tcp_ca_timeout(struct tcp *conn)
 {
-	conn->ca.ssthresh = MAX(conn_mss(conn) * 2, conn->unacked_len / 2);
+	conn->ca.ssthresh = conn->ca.ops->ssthresh(conn);
 	conn->ca.cwnd = conn_mss(conn);
-	tcp_new_reno_log(conn, "timeout");
+	tcp_ca_log(conn, "timeout");
 }
 
 /* For every duplicate ack increment the cwnd by mss */
-static void tcp_new_reno_dup_ack(struct tcp *conn)
+static void tcp_ca_dup_ack(struct tcp *conn)
 {
 	int32_t new_win = conn->ca.cwnd;
 
 	new_win += conn_mss(conn);
-	conn->ca.cwnd = MIN(new_win, UINT16_MAX);
-	tcp_new_reno_log(conn, "dup_ack");
+	conn->ca.cwnd = MIN(new_win, TCP_MAX_WIN);
+	tcp_ca_log(conn, "dup_ack");
 }
 
-static void tcp_new_reno_pkts_acked(struct tcp *conn, uint32_t acked_len)
+static void tcp_ca_pkts_acked(struct tcp *conn, uint32_t acked_len)
 {
-	int32_t new_win = conn->ca.cwnd;
-	int32_t win_inc = MIN(acked_len, conn_mss(conn));
-
 	if (conn->ca.pending_fast_retransmit_bytes == 0) {
 		if (conn->ca.cwnd < conn->ca.ssthresh) {
-			new_win += win_inc;
+			int32_t new_win = conn->ca.cwnd;
+
+			new_win += MIN(acked_len, conn_mss(conn));
+			conn->ca.cwnd = MIN(new_win, TCP_MAX_WIN);
 		} else {
-			/* Implement a div_ceil	to avoid rounding to 0 */
-			new_win += ((win_inc * win_inc) + conn->ca.cwnd - 1) / conn->ca.cwnd;
+			conn->ca.ops->cong_avoid(conn, acked_len);
 		}
-		conn->ca.cwnd = MIN(new_win, UINT16_MAX);
 	} else {
 		/* Check if it is still in fast recovery mode */
 		if (conn->ca.pending_fast_retransmit_bytes <= acked_len) {
@@ -468,35 +523,56 @@ static void tcp_new_reno_pkts_acked(struct tcp *conn, uint32_t acked_len)
 			conn->ca.cwnd -= acked_len;
 		}
 	}
-	tcp_new_reno_log(conn, "pkts_acked");
+	tcp_ca_log(conn, "pkts_acked");
 }
 
-static void tcp_ca_init(struct tcp *conn)
+static int set_tcp_congestion(struct tcp *conn, const void *value, size_t len)
 {
-	tcp_new_reno_init(conn);
-}
+	const struct tcp_ca_ops *ops;
 
-static void tcp_ca_fast_retransmit(struct tcp *conn)
-{
-	tcp_new_reno_fast_retransmit(conn);
-}
+	if (value == NULL) {
+		return -EINVAL;
+	}
 
-static void tcp_ca_timeout(struct tcp *conn)
-{
-	tcp_new_reno_timeout(conn);
-}
+	/* The name may or may not be NUL terminated */
+	len = strnlen(value, len);
 
-static void tcp_ca_dup_ack(struct tcp *conn)
-{
-	tcp_new_reno_dup_ack(conn);
+	ops = tcp_ca_find(value, len);
+	if (ops == NULL) {
+		return -ENOENT;
+	}
+
+	if (ops != conn->ca.ops) {
+		conn->ca.ops = ops;
+
+		/* Keep the current window, only reset the algorithm state */
+		if (conn->state == TCP_ESTABLISHED && ops->init != NULL) {
+			ops->init(conn);
+		}
+	}
+
+	return 0;
 }
 
-static void tcp_ca_pkts_acked(struct tcp *conn, uint32_t acked_len)
+static int get_tcp_congestion(struct tcp *conn, void *value, size_t *len)
 {
-	tcp_new_reno_pkts_acked(conn, acked_len);
+	size_t name_len = strlen(conn->ca.ops->name) + 1;
+
+	if (value == NULL || len == NULL) {
+		return -EINVAL;
+	}
+
+	*len = MIN(*len, name_len);
+	memcpy(value, conn->ca.ops->name, *len);
+
+	return 0;
 }
 #else
 
+static void tcp_ca_select_default(struct tcp *conn) { }
+
+static void tcp_ca_copy(struct tcp *to, struct tcp *from) { }
+
 static void tcp_ca_init(struct tcp *conn) { }
 
 static void tcp_ca_fast_retransmit(struct tcp *conn) { }
@@ -507,6 +583,16 @@ static void tcp_ca_dup_ack(struct tcp *conn) { }
 
 static void tcp_ca_pkts_acked(struct tcp *conn, uint32_t acked_len) { }
 
+static int set_tcp_congestion(struct tcp *conn, const void *value, size_t len)
+{
+	return -ENOPROTOOPT;
+}
+
+static int get_tcp_congestion(struct tcp *conn, void *value, size_t *len)
+{
+	return -ENOPROTOOPT;
+}
+
 #endif
 
 #if defined(CONFIG_NET_TCP_KEEPALIVE)
@@ -1054,6 +1140,10 @@ static bool tcp_options_check(struct tcp_options *recv_options,
 
 	recv_options->mss_found = false;
 	recv_options->wnd_found = false;
+	recv_options->sack_perm_found = false;
+#ifdef CONFIG_NET_TCP_SACK
+	recv_options->sack_count = 0;
+#endif
 
 	for ( ; options && len >= 1; options += opt_len, len -= opt_len) {
 		opt = options[0];
@@ -1099,9 +1189,42 @@ static bool tcp_options_check(struct tcp_options *recv_options,
 				goto end;
 			}
 
-			recv_options->window = opt;
+			/* RFC 7323: larger shifts are treated as 14 */
+			recv_options->window = MIN(options[2],
+						   NET_TCP_MAX_WINDOW_SCALE);
 			recv_options->wnd_found = true;
 			break;
+		case NET_TCP_SACK_PERM_OPT:
+			if (opt_len != NET_TCP_SACK_PERM_SIZE) {
+				result = false;
+				goto end;
+			}
+
+			recv_options->sack_perm_found = true;
+			break;
+#ifdef CONFIG_NET_TCP_SACK
+		case NET_TCP_SACK_OPT:
+			if ((opt_len < 2 + sizeof(struct tcp_sack_block)) ||
+			    ((opt_len - 2) % sizeof(struct tcp_sack_block))) {
+				result = false;
+				goto end;
+			}
+
+			recv_options->sack_count =
+				MIN((opt_len - 2) / sizeof(struct tcp_sack_block),
+				    NET_TCP_MAX_SACK_BLOCKS);
+
+			for (int i = 0; i < recv_options->sack_count; i++) {
+				uint8_t *block = options + 2 +
+						 i * sizeof(struct tcp_sack_block);
+
+				recv_options->sack[i].left =
+					ntohl(UNALIGNED_GET((uint32_t *)block));
+				recv_options->sack[i].right =
+					ntohl(UNALIGNED_GET((uint32_t *)(block + 4)));
+			}
+			break;
+#endif
 		default:
 			continue;
 		}
@@ -1275,8 +1398,22 @@ static int tcp_finalize_pkt(struct net_pkt *pkt)
 	return -EINVAL;
 }
 
+/* Window to advertise, the window in SYN segments is never scaled */
+static uint16_t tcp_adv_window(struct tcp *conn, uint8_t flags)
+{
+	uint32_t win = conn->recv_win;
+
+#ifdef CONFIG_NET_TCP_WINDOW_SCALE
+	if (!(flags & SYN)) {
+		win >>= conn->recv_wscale;
+	}
+#endif
+
+	return MIN(win, UINT16_MAX);
+}
+
 static int tcp_header_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags,
-			  uint32_t seq)
+			  uint32_t seq, size_t opts_len)
 {
 	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct tcphdr);
 	struct tcphdr *th;
@@ -1290,14 +1427,10 @@ static int tcp_header_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags,
 
 	UNALIGNED_PUT(conn->src.sin.sin_port, &th->th_sport);
 	UNALIGNED_PUT(conn->dst.sin.sin_port, &th->th_dport);
-	th->th_off = 5;
-
-	if (conn->send_options.mss_found) {
-		th->th_off++;
-	}
+	th->th_off = 5 + opts_len / 4;
 
 	UNALIGNED_PUT(flags, &th->th_flags);
-	UNALIGNED_PUT(htons(conn->recv_win), &th->th_win);
+	UNALIGNED_PUT(htons(tcp_adv_window(conn, flags)), &th->th_win);
 	UNALIGNED_PUT(htonl(seq), &th->th_seq);
 
 	if (ACK & flags) {
@@ -1374,6 +1507,52 @@ static int net_tcp_set_mss_opt(struct tcp *conn, struct net_pkt *pkt)
 	return net_pkt_set_data(pkt, &mss_opt_access);
 }
 
+/* Fill in the options that follow the MSS, each one padded to a multiple
+ * of 4 bytes with NOPs, and return their length.
+ */
+static size_t tcp_ext_options_get(struct tcp *conn, uint8_t flags, uint8_t *buf)
+{
+	size_t len = 0;
+
+#ifdef CONFIG_NET_TCP_WINDOW_SCALE
+	if ((flags & SYN) && conn->send_options.wnd_found) {
+		buf[len++] = NET_TCP_NOP_OPT;
+		buf[len++] = NET_TCP_WINDOW_SCALE_OPT;
+		buf[len++] = NET_TCP_WINDOW_SCALE_SIZE;
+		buf[len++] = conn->send_options.window;
+	}
+#endif
+
+#ifdef CONFIG_NET_TCP_SACK
+	if ((flags & SYN) && conn->send_options.sack_perm_found) {
+		buf[len++] = NET_TCP_NOP_OPT;
+		buf[len++] = NET_TCP_NOP_OPT;
+		buf[len++] = NET_TCP_SACK_PERM_OPT;
+		buf[len++] = NET_TCP_SACK_PERM_SIZE;
+	}
+
+	/* Report the out-of-order data waiting in the receive queue */
+	if (!(flags & SYN) && (flags & ACK) && conn->sack_permitted &&
+	    conn->queue_recv_data != NULL &&
+	    !net_pkt_is_empty(conn->queue_recv_data)) {
+		uint32_t left = tcp_get_seq(conn->queue_recv_data->buffer);
+		uint32_t right = left + net_pkt_get_len(conn->queue_recv_data);
+
+		if (net_tcp_seq_greater(left, conn->ack)) {
+			buf[len++] = NET_TCP_NOP_OPT;
+			buf[len++] = NET_TCP_NOP_OPT;
+			buf[len++] = NET_TCP_SACK_OPT;
+			buf[len++] = 2 + sizeof(struct tcp_sack_block);
+			UNALIGNED_PUT(htonl(left), (uint32_t *)&buf[len]);
+			UNALIGNED_PUT(htonl(right), (uint32_t *)&buf[len + 4]);
+			len += sizeof(struct tcp_sack_block);
+		}
+	}
+#endif
+
+	return len;
+}
+
 static bool is_destination_local(struct net_pkt *pkt)
 {
 	if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(pkt) == AF_INET) {
@@ -1477,13 +1656,20 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		       uint32_t seq)
 {
 	size_t alloc_len = sizeof(struct tcphdr);
+	uint8_t ext_opts[36]; /* TCP header max options size is 40, minus MSS */
+	size_t ext_opts_len;
+	size_t opts_len = 0;
 	struct net_pkt *pkt;
 	int ret = 0;
 
 	if (conn->send_options.mss_found) {
-		alloc_len += sizeof(uint32_t);
+		opts_len += sizeof(uint32_t);
 	}
 
+	ext_opts_len = tcp_ext_options_get(conn, flags, ext_opts);
+	opts_len += ext_opts_len;
+	alloc_len += opts_len;
+
 	pkt = tcp_pkt_alloc(conn, alloc_len);
 	if (!pkt) {
 		ret = -ENOBUFS;
@@ -1493,6 +1679,7 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 	if (data) {
 		/* Append the data buffer to the pkt */
 		net_pkt_append_buffer(pkt, data->buffer);
+		net_pkt_set_tso_mss(pkt, net_pkt_tso_mss(data));
 		data->buffer = NULL;
 	}
 
@@ -1502,7 +1689,7 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		goto out;
 	}
 
-	ret = tcp_header_add(conn, pkt, flags, seq);
+	ret = tcp_header_add(conn, pkt, flags, seq, opts_len);
 	if (ret < 0) {
 		tcp_pkt_unref(pkt);
 		goto out;
@@ -1516,6 +1703,14 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		}
 	}
 
+	if (ext_opts_len > 0) {
+		ret = net_pkt_write(pkt, ext_opts, ext_opts_len);
+		if (ret < 0) {
+			tcp_pkt_unref(pkt);
+			goto out;
+		}
+	}
+
 	ret = tcp_finalize_pkt(pkt);
 	if (ret < 0) {
 		tcp_pkt_unref(pkt);
@@ -1669,24 +1864,212 @@ static int tcp_unsent_len(struct tcp *conn)
 	return unsent_len;
 }
 
+#ifdef CONFIG_NET_TCP_SACK
+/* Add a block SACKed by the peer to the scoreboard, merging it with the
+ * blocks it overlaps. When the scoreboard is full, the highest block is
+ * forgotten, which only costs a needless retransmission.
+ */
+static void tcp_sack_insert(struct tcp *conn, uint32_t left, uint32_t right)
+{
+	struct tcp_sack_block *sacked = conn->sacked;
+	int count = conn->sacked_count;
+	int i = 0;
+	int j;
+
+	while (i < count && net_tcp_seq_cmp(sacked[i].right, left) < 0) {
+		i++;
+	}
+
+	for (j = i; j < count && net_tcp_seq_cmp(sacked[j].left, right) <= 0; j++) {
+		if (net_tcp_seq_cmp(sacked[j].left, left) < 0) {
+			left = sacked[j].left;
+		}
+
+		if (net_tcp_seq_cmp(sacked[j].right, right) > 0) {
+			right = sacked[j].right;
+		}
+	}
+
+	if (j > i) {
+		/* Blocks i to j - 1 are replaced by the merged one */
+		memmove(&sacked[i + 1], &sacked[j], (count - j) * sizeof(*sacked));
+		count -= j - i - 1;
+	} else {
+		if (count == NET_TCP_MAX_SACK_BLOCKS) {
+			if (i == count) {
+				return;
+			}
+
+			count--;
+		}
+
+		memmove(&sacked[i + 1], &sacked[i], (count - i) * sizeof(*sacked));
+		count++;
+	}
+
+	sacked[i].left = left;
+	sacked[i].right = right;
+	conn->sacked_count = count;
+}
+
+/* Merge the SACK blocks of a received ACK into the scoreboard */
+static void tcp_sack_update(struct tcp *conn, uint32_t ack)
+{
+	uint32_t snd_max = conn->seq + conn->send_data_total;
+	struct tcp_options *opts = &conn->recv_options;
+
+	if (!conn->sack_permitted) {
+		return;
+	}
+
+	if (net_tcp_seq_greater(conn->seq, ack)) {
+		ack = conn->seq;
+	}
+
+	for (int i = 0; i < opts->sack_count; i++) {
+		uint32_t left = opts->sack[i].left;
+		uint32_t right = opts->sack[i].right;
+
+		/* Ignore the blocks already acknowledged or never sent */
+		if (!net_tcp_seq_greater(right, ack) ||
+		    net_tcp_seq_greater(right, snd_max) ||
+		    !net_tcp_seq_greater(right, left)) {
+			continue;
+		}
+
+		if (net_tcp_seq_greater(ack, left)) {
+			left = ack;
+		}
+
+		NET_DBG("conn: %p SACK %u-%u", conn, left, right);
+
+		tcp_sack_insert(conn, left, right);
+	}
+}
+
+/* Drop the part of the scoreboard covered by the cumulative ACK */
+static void tcp_sack_trim(struct tcp *conn)
+{
+	struct tcp_sack_block *sacked = conn->sacked;
+	int i = 0;
+
+	while (i < conn->sacked_count &&
+	       !net_tcp_seq_greater(sacked[i].right, conn->seq)) {
+		i++;
+	}
+
+	conn->sacked_count -= i;
+	memmove(sacked, &sacked[i], conn->sacked_count * sizeof(*sacked));
+
+	if (conn->sacked_count > 0 &&
+	    net_tcp_seq_greater(conn->seq, sacked[0].left)) {
+		sacked[0].left = conn->seq;
+	}
+}
+
+static void tcp_sack_reset(struct tcp *conn)
+{
+	conn->sacked_count = 0;
+	conn->sack_recovery = false;
+}
+
+/* Skip the SACKed data at the send position. It stays accounted as
+ * unacknowledged until the cumulative ACK covers it.
+ */
+static void tcp_sack_skip(struct tcp *conn)
+{
+	uint32_t next = conn->seq + conn->unacked_len;
+
+	for (int i = 0; i < conn->sacked_count; i++) {
+		struct tcp_sack_block *block = &conn->sacked[i];
+
+		if (net_tcp_seq_greater(block->left, next)) {
+			break;
+		}
+
+		if (net_tcp_seq_greater(block->right, next)) {
+			NET_DBG("conn: %p skipping SACKed %u-%u", conn, next,
+				block->right);
+			conn->unacked_len += block->right - next;
+			next = block->right;
+		}
+	}
+}
+
+/* Limit a segment at the send position so it ends before the next
+ * SACKed block.
+ */
+static int tcp_sack_clip(struct tcp *conn, int len)
+{
+	uint32_t next = conn->seq + conn->unacked_len;
+
+	for (int i = 0; i < conn->sacked_count; i++) {
+		if (net_tcp_seq_greater(conn->sacked[i].left, next)) {
+			return MIN(len, (int)(conn->sacked[i].left - next));
+		}
+	}
+
+	return len;
+}
+#endif /* CONFIG_NET_TCP_SACK */
+
+/* Size of a segment to send. With TCP segmentation offload, several
+ * segments are sent at once to the L2, which splits them in hardware or
+ * in software. Retransmissions always go one segment at a time.
+ */
+static int tcp_seg_len(struct tcp *conn)
+{
+	int mss = conn_mss(conn);
+
+#if defined(CONFIG_NET_TCP_TSO)
+	if (conn->data_mode == TCP_DATA_MODE_SEND && conn->iface != NULL &&
+	    net_if_l2(conn->iface) == &NET_L2_GET_NAME(ETHERNET)) {
+		return MAX(mss, ROUND_DOWN(CONFIG_NET_TCP_TSO_MAX_SIZE, mss));
+	}
+#endif
+
+	return mss;
+}
+
 static int tcp_send_data(struct tcp *conn)
 {
 	int ret = 0;
 	int len;
-	struct net_pkt *pkt;
+	struct net_pkt *pkt = NULL;
+
+#ifdef CONFIG_NET_TCP_SACK
+	tcp_sack_skip(conn);
+#endif
 
-	len = MIN(tcp_unsent_len(conn), conn_mss(conn));
+	len = MIN(tcp_unsent_len(conn), tcp_seg_len(conn));
 	if (len < 0) {
 		ret = len;
 		goto out;
 	}
+
+#ifdef CONFIG_NET_TCP_SACK
+	len = tcp_sack_clip(conn, len);
+#endif
 	if (len == 0) {
 		NET_DBG("conn: %p no data to send", conn);
 		ret = -ENODATA;
 		goto out;
 	}
 
-	pkt = tcp_pkt_alloc(conn, len);
+	if (len > conn_mss(conn)) {
+		/* Do not wait for buffers to send several segments at once,
+		 * rather send a single one.
+		 */
+		pkt = tcp_pkt_alloc_timeout(conn, len, K_NO_WAIT);
+		if (!pkt) {
+			len = conn_mss(conn);
+		}
+	}
+
+	if (len <= conn_mss(conn)) {
+		pkt = tcp_pkt_alloc(conn, len);
+	}
+
 	if (!pkt) {
 		NET_ERR("conn: %p packet allocation failed, len=%d", conn, len);
 		ret = -ENOBUFS;
@@ -1700,6 +2083,10 @@ static int tcp_send_data(struct tcp *conn)
 		goto out;
 	}
 
+	if (len > conn_mss(conn)) {
+		net_pkt_set_tso_mss(pkt, conn_mss(conn));
+	}
+
 	ret = tcp_out_ext(conn, PSH | ACK, pkt, conn->seq + conn->unacked_len);
 	if (ret == 0) {
 		conn->unacked_len += len;
@@ -1816,6 +2203,11 @@ static void tcp_resend_data(struct k_work *work)
 		}
 	}
 
+#ifdef CONFIG_NET_TCP_SACK
+	/* The peer may have discarded the data it SACKed, RFC 2018 ch 8 */
+	tcp_sack_reset(conn);
+#endif
+
 	conn->data_mode = TCP_DATA_MODE_RESEND;
 	conn->unacked_len = 0;
 
@@ -2058,20 +2450,15 @@ static struct tcp *tcp_conn_alloc(void)
 
 	conn->in_connect = false;
 	conn->state = TCP_LISTEN;
-	conn->recv_win_max = tcp_rx_window;
+	conn->recv_win_max = MIN(tcp_rx_window, TCP_MAX_WIN);
 	conn->recv_win = conn->recv_win_max;
-	conn->send_win_max = MAX(tcp_tx_window, NET_IPV6_MTU);
+	conn->send_win_max = MIN(MAX(tcp_tx_window, NET_IPV6_MTU), TCP_MAX_WIN);
 	conn->send_win = conn->send_win_max;
 	conn->tcp_nodelay = false;
 #ifdef CONFIG_NET_TCP_FAST_RETRANSMIT
 	conn->dup_ack_cnt = 0;
 #endif
-#ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
-	/* Initially set the congestion window at its max size, since only the MSS
-	 * is available as soon as the connection is established
-	 */
-	conn->ca.cwnd = UINT16_MAX;
-#endif
+	tcp_ca_select_default(conn);
 
 	/* The ISN value will be set when we get the connection attempt or
 	 * when trying to create a connection.
@@ -2675,6 +3062,51 @@ static void tcp_out_of_order_data(struct tcp *conn, struct net_pkt *pkt,
 	tcp_queue_recv_data(conn, pkt, data_len, seq);
 }
 
+/* Options we offer in our SYN */
+static void tcp_syn_options_offer(struct tcp *conn)
+{
+#ifdef CONFIG_NET_TCP_WINDOW_SCALE
+	uint8_t shift = 0;
+
+	while ((conn->recv_win_max >> shift) > UINT16_MAX &&
+	       shift < NET_TCP_MAX_WINDOW_SCALE) {
+		shift++;
+	}
+
+	conn->send_options.window = shift;
+	conn->send_options.wnd_found = true;
+#endif
+#ifdef CONFIG_NET_TCP_SACK
+	conn->send_options.sack_perm_found = true;
+#endif
+}
+
+/* Options are only used if both sides sent them in their SYN */
+static void tcp_syn_options_accept(struct tcp *conn)
+{
+#ifdef CONFIG_NET_TCP_WINDOW_SCALE
+	if (conn->send_options.wnd_found && conn->recv_options.wnd_found) {
+		conn->recv_wscale = conn->send_options.window;
+		conn->send_wscale = conn->recv_options.window;
+	} else {
+		conn->send_options.wnd_found = false;
+		conn->recv_wscale = 0;
+		conn->send_wscale = 0;
+	}
+
+	NET_DBG("conn: %p window scale %u/%u", conn, conn->recv_wscale,
+		conn->send_wscale);
+#endif
+#ifdef CONFIG_NET_TCP_SACK
+	conn->sack_permitted = conn->send_options.sack_perm_found &&
+			       conn->recv_options.sack_perm_found;
+	conn->send_options.sack_perm_found = conn->sack_permitted;
+
+	NET_DBG("conn: %p SACK %s", conn,
+		conn->sack_permitted ? "permitted" : "not permitted");
+#endif
+}
+
 static void tcp_check_sock_options(struct tcp *conn)
 {
 	int sndbuf_opt = 0;
@@ -2690,6 +3122,9 @@ static void tcp_check_sock_options(struct tcp *conn)
 					     &rcvbuf_opt, NULL);
 	}
 
+	sndbuf_opt = MIN(sndbuf_opt, TCP_MAX_WIN);
+	rcvbuf_opt = MIN(rcvbuf_opt, TCP_MAX_WIN);
+
 	if (sndbuf_opt > 0 && sndbuf_opt != conn->send_win_max) {
 		k_mutex_lock(&conn->lock, K_FOREVER);
 
@@ -2811,6 +3246,12 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 
 	if (th) {
 		conn->send_win = ntohs(th_win(th));
+#ifdef CONFIG_NET_TCP_WINDOW_SCALE
+		/* The window in SYN segments is never scaled */
+		if (!(th_flags(th) & SYN)) {
+			conn->send_win <<= conn->send_wscale;
+		}
+#endif
 		if (conn->send_win > conn->send_win_max) {
 			NET_DBG("Lowering send window from %u to %u",
 				conn->send_win, conn->send_win_max);
@@ -2844,6 +3285,8 @@ next_state:
 		if (FL(&fl, ==, SYN)) {
 			/* Make sure our MSS is also sent in the ACK */
 			conn->send_options.mss_found = true;
+			tcp_syn_options_offer(conn);
+			tcp_syn_options_accept(conn);
 			conn_ack(conn, th_seq(th) + 1); /* capture peer's isn */
 			tcp_out(conn, SYN | ACK);
 			conn->send_options.mss_found = false;
@@ -2858,6 +3301,7 @@ next_state:
 			verdict = NET_OK;
 		} else {
 			conn->send_options.mss_found = true;
+			tcp_syn_options_offer(conn);
 			tcp_out(conn, SYN);
 			conn->send_options.mss_found = false;
 			conn_seq(conn, + 1);
@@ -2875,6 +3319,7 @@ next_state:
 				accept_cb = conn->accepted_conn->accept_cb;
 				context = conn->accepted_conn->context;
 				keep_alive_param_copy(conn, conn->accepted_conn);
+				tcp_ca_copy(conn, conn->accepted_conn);
 			}
 
 			k_work_cancel_delayable(&conn->establish_timer);
@@ -2964,6 +3409,7 @@ next_state:
 		 */
 		if (FL(&fl, &, SYN | ACK, th && th_ack(th) == conn->seq)) {
 			tcp_send_timer_cancel(conn);
+			tcp_syn_options_accept(conn);
 			conn_ack(conn, th_seq(th) + 1);
 			if (len) {
 				verdict = tcp_data_get(conn, pkt, &len);
@@ -3049,6 +3495,12 @@ next_state:
 		 */
 		keep_alive_timer_restart(conn);
 
+#ifdef CONFIG_NET_TCP_SACK
+		if (th && tcp_options_len) {
+			tcp_sack_update(conn, th_ack(th));
+		}
+#endif
+
 #ifdef CONFIG_NET_TCP_FAST_RETRANSMIT
 		if (th && (net_tcp_seq_cmp(th_ack(th), conn->seq) == 0)) {
 			/* Only if there is pending data, increment the duplicate ack count */
@@ -3072,6 +3524,10 @@ next_state:
 				/* Apply a fast retransmit */
 				int temp_unacked_len = conn->unacked_len;
 
+#ifdef CONFIG_NET_TCP_SACK
+				conn->sack_recovery = true;
+				conn->sack_recover = conn->seq + conn->unacked_len;
+#endif
 				conn->unacked_len = 0;
 
 				(void)tcp_send_data(conn);
@@ -3129,6 +3585,14 @@ next_state:
 			conn_seq(conn, + len_acked);
 			net_stats_update_tcp_seg_recv(conn->iface);
 
+#ifdef CONFIG_NET_TCP_SACK
+			tcp_sack_trim(conn);
+			if (conn->sack_recovery &&
+			    !net_tcp_seq_greater(conn->sack_recover, conn->seq)) {
+				conn->sack_recovery = false;
+			}
+#endif
+
 			/* Receipt of an acknowledgment that covers a sequence number
 			 * not previously acknowledged indicates that the connection
 			 * makes a "forward progress".
@@ -3164,6 +3628,19 @@ next_state:
 				break;
 			}
 
+#ifdef CONFIG_NET_TCP_SACK
+			/* A partial ACK during a recovery, the data up to the
+			 * first SACKed block is missing as well.
+			 */
+			if (conn->sack_recovery && conn->sacked_count > 0) {
+				int temp_unacked_len = conn->unacked_len;
+
+				conn->unacked_len = 0;
+				(void)tcp_send_data(conn);
+				conn->unacked_len = temp_unacked_len;
+			}
+#endif
+
 			ret = tcp_send_queued_data(conn);
 			if (ret < 0 && ret != -ENOBUFS) {
 				tcp_out(conn, RST);
@@ -3982,7 +4459,9 @@ int net_tcp_finalize(struct net_pkt *pkt, bool force_chksum)
 
 	tcp_hdr->chksum = 0U;
 
-	if (net_if_need_calc_tx_checksum(net_pkt_iface(pkt)) || force_chksum) {
+	/* The checksums of offloaded segments are computed once split */
+	if ((net_if_need_calc_tx_checksum(net_pkt_iface(pkt)) &&
+	     net_pkt_tso_mss(pkt) == 0U) || force_chksum) {
 		tcp_hdr->chksum = net_calc_chksum_tcp(pkt);
 		net_pkt_set_chksum_done(pkt, true);
 	}
@@ -4359,6 +4838,9 @@ int net_tcp_set_option(struct net_context *context,
 	case TCP_OPT_KEEPCNT:
 		ret = set_tcp_keep_cnt(conn, value, len);
 		break;
+	case TCP_OPT_CONGESTION:
+		ret = set_tcp_congestion(conn, value, len);
+		break;
 	}
 
 	k_mutex_unlock(&conn->lock);
@@ -4396,6 +4878,9 @@ int net_tcp_get_option(struct net_context *context,
 	case TCP_OPT_KEEPCNT:
 		ret = get_tcp_keep_cnt(conn, value, len);
 		break;
+	case TCP_OPT_CONGESTION:
+		ret = get_tcp_congestion(conn, value, len);
+		break;
 	}
 
 	k_mutex_unlock(&conn->lock);
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* CUBIC congestion control, implementation according to RFC9438.
+ *
+ * Windows are in bytes and times in milliseconds. The round trip time is
+ * not added to the time elapsed in the congestion avoidance stage, as it
+ * is not tracked by the stack.
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_tcp, CONFIG_NET_TCP_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+
+#include "tcp_internal.h"
+
+/* beta_cubic = 0.7 and C = 0.4, see RFC9438 ch 4.6 and ch 5 */
+#define CUBIC_BETA_NUM 7
+#define CUBIC_BETA_DEN 10
+
+/* Reno friendly additive increase, alpha_cubic = 3 * (1 - beta) / (1 + beta) */
+#define CUBIC_ALPHA_NUM 9
+#define CUBIC_ALPHA_DEN 17
+
+/* Bound the time from the origin point, so the cubic term cannot overflow */
+#define CUBIC_MAX_DELTA_MS 60000
+
+static uint32_t tcp_cubic_root(uint64_t a)
+{
+	uint32_t x = 0;
+
+	/* (2^21 - 1)^3 is the largest cube that fits */
+	for (int bit = 20; bit >= 0; bit--) {
+		uint64_t y = x | BIT(bit);
+
+		if (y * y * y <= a) {
+			x = y;
+		}
+	}
+
+	return x;
+}
+
+static void tcp_cubic_init(struct tcp *conn)
+{
+	memset(&conn->ca.cubic, 0, sizeof(conn->ca.cubic));
+}
+
+static uint32_t tcp_cubic_ssthresh(struct tcp *conn)
+{
+	uint32_t mss = conn_mss(conn);
+	uint32_t win = conn->unacked_len;
+
+	/* Fast convergence, ch 4.7: release bandwidth when the window at
+	 * loss keeps shrinking.
+	 */
+	if (win < conn->ca.cubic.w_max) {
+		conn->ca.cubic.w_max = win * (CUBIC_BETA_DEN + CUBIC_BETA_NUM) /
+				       (2 * CUBIC_BETA_DEN);
+	} else {
+		conn->ca.cubic.w_max = win;
+	}
+
+	/* A new congestion avoidance stage starts after the recovery */
+	conn->ca.cubic.epoch_start = 0;
+
+	NET_DBG("conn: %p w_max=%u", conn, conn->ca.cubic.w_max);
+
+	return MAX(mss * 2, win * CUBIC_BETA_NUM / CUBIC_BETA_DEN);
+}
+
+static void tcp_cubic_cong_avoid(struct tcp *conn, uint32_t acked_len)
+{
+	struct tcp_congestion_avoidance *ca = &conn->ca;
+	uint32_t mss = conn_mss(conn);
+	uint32_t cwnd = ca->cwnd;
+	int64_t now = k_uptime_get();
+	int64_t w_cubic;
+	int64_t target;
+	int64_t delta;
+
+	if (ca->cubic.epoch_start == 0) {
+		ca->cubic.epoch_start = MAX(now, 1);
+
+		if (cwnd < ca->cubic.w_max) {
+			/* K = cbrt((W_max - cwnd) / C), ch 4.2 */
+			ca->cubic.k = tcp_cubic_root(
+				(uint64_t)(ca->cubic.w_max - cwnd) * 2500000000ULL / mss);
+			ca->cubic.origin = ca->cubic.w_max;
+		} else {
+			ca->cubic.k = 0;
+			ca->cubic.origin = cwnd;
+		}
+
+		ca->cubic.w_est = cwnd;
+	}
+
+	/* W_cubic(t) = C * (t - K)^3 + W_max, ch 4.2 */
+	delta = CLAMP(now - ca->cubic.epoch_start - ca->cubic.k,
+		      -CUBIC_MAX_DELTA_MS, CUBIC_MAX_DELTA_MS);
+	w_cubic = ca->cubic.origin +
+		  (4 * delta * delta * delta / 10000) * mss / 1000000;
+
+	/* W_est grows like the window of New Reno would, ch 4.3 */
+	ca->cubic.w_est += (uint64_t)CUBIC_ALPHA_NUM * acked_len * mss /
+			   ((uint64_t)CUBIC_ALPHA_DEN * cwnd);
+
+	if (w_cubic < ca->cubic.w_est) {
+		target = ca->cubic.w_est;
+	} else {
+		/* Grow by at most half the window per round trip, ch 4.2 */
+		target = MIN(w_cubic, (int64_t)cwnd + cwnd / 2);
+		if (target > cwnd) {
+			target = cwnd + (target - cwnd) * acked_len / cwnd;
+		}
+	}
+
+	if (target > cwnd) {
+		ca->cwnd = MIN(target, TCP_MAX_WIN);
+	}
+}
+
+TCP_CA_DEFINE(tcp_ca_cubic, "cubic", tcp_cubic_init, tcp_cubic_ssthresh,
+	      tcp_cubic_cong_avoid);
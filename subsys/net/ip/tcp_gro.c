@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Receive side coalescing of TCP segments. In-order segments of a flow
+ * which are next to each other in an RX queue are merged into a single
+ * packet, so that the L2, IP and TCP layers process them only once.
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_tc, CONFIG_NET_TC_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+#include <string.h>
+
+#include <zephyr/net/ethernet.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_ip.h>
+#include <zephyr/net/net_pkt.h>
+
+#include "net_private.h"
+
+#define GRO_TCP_PSH BIT(3)
+#define GRO_TCP_ACK BIT(4)
+
+struct gro_hdrs {
+	struct net_eth_hdr *eth;
+	union {
+		struct net_ipv4_hdr *ipv4;
+		struct net_ipv6_hdr *ipv6;
+	};
+	struct net_tcp_hdr *tcp;
+	uint16_t ip_len;
+	uint16_t tcp_len;
+	uint16_t payload_len;
+};
+
+static inline uint16_t gro_hdrs_len(const struct gro_hdrs *h)
+{
+	return sizeof(struct net_eth_hdr) + h->ip_len + h->tcp_len;
+}
+
+/* Only plain data segments are merged: no IP options, extension headers or
+ * fragments, and no TCP flag besides ACK and PSH. The headers must be in the
+ * first buffer.
+ */
+static bool gro_parse(struct net_pkt *pkt, struct gro_hdrs *h)
+{
+	struct net_buf *buf = pkt->buffer;
+	uint16_t ip_total;
+
+	if (buf == NULL || buf->len < sizeof(struct net_eth_hdr)) {
+		return false;
+	}
+
+	h->eth = (struct net_eth_hdr *)buf->data;
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && h->eth->type == htons(NET_ETH_PTYPE_IP)) {
+		h->ip_len = NET_IPV4H_LEN;
+		if (buf->len < sizeof(struct net_eth_hdr) + h->ip_len) {
+			return false;
+		}
+
+		h->ipv4 = (struct net_ipv4_hdr *)(h->eth + 1);
+		if (h->ipv4->vhl != 0x45 || h->ipv4->proto != IPPROTO_TCP ||
+		    (sys_get_be16(h->ipv4->offset) &
+		     (NET_IPV4_MORE_FRAG_MASK | NET_IPV4_FRAGH_OFFSET_MASK))) {
+			return false;
+		}
+
+		ip_total = ntohs(h->ipv4->len);
+	} else if (IS_ENABLED(CONFIG_NET_IPV6) &&
+		   h->eth->type == htons(NET_ETH_PTYPE_IPV6)) {
+		h->ip_len = NET_IPV6H_LEN;
+		if (buf->len < sizeof(struct net_eth_hdr) + h->ip_len) {
+			return false;
+		}
+
+		h->ipv6 = (struct net_ipv6_hdr *)(h->eth + 1);
+		if (h->ipv6->nexthdr != IPPROTO_TCP) {
+			return false;
+		}
+
+		ip_total = ntohs(h->ipv6->len) + NET_IPV6H_LEN;
+	} else {
+		return false;
+	}
+
+	if (buf->len < sizeof(struct net_eth_hdr) + h->ip_len + NET_TCPH_LEN) {
+		return false;
+	}
+
+	h->tcp = (struct net_tcp_hdr *)((uint8_t *)h->eth +
+					sizeof(struct net_eth_hdr) + h->ip_len);
+	h->tcp_len = (h->tcp->offset >> 4) * 4U;
+
+	if (h->tcp_len < NET_TCPH_LEN || buf->len < gro_hdrs_len(h) ||
+	    ip_total <= h->ip_len + h->tcp_len ||
+	    net_pkt_get_len(pkt) != sizeof(struct net_eth_hdr) + ip_total) {
+		/* Pure ACKs and padded frames are left alone */
+		return false;
+	}
+
+	if ((h->tcp->flags & ~GRO_TCP_PSH) != GRO_TCP_ACK) {
+		return false;
+	}
+
+	h->payload_len = ip_total - h->ip_len - h->tcp_len;
+
+	return true;
+}
+
+/* Same flow and headers, apart from the sequence number, the window and the
+ * lengths and checksums.
+ */
+static bool gro_same_flow(const struct gro_hdrs *a, const struct gro_hdrs *b)
+{
+	if (a->eth->type != b->eth->type || a->tcp_len != b->tcp_len ||
+	    memcmp(a->eth, b->eth, sizeof(struct net_eth_addr) * 2) != 0) {
+		return false;
+	}
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && a->eth->type == htons(NET_ETH_PTYPE_IP)) {
+		if (a->ipv4->tos != b->ipv4->tos || a->ipv4->ttl != b->ipv4->ttl ||
+		    memcmp(a->ipv4->src, b->ipv4->src, NET_IPV4_ADDR_SIZE * 2) != 0) {
+			return false;
+		}
+	} else if (memcmp(a->ipv6, b->ipv6, offsetof(struct net_ipv6_hdr, len)) != 0 ||
+		   a->ipv6->hop_limit != b->ipv6->hop_limit ||
+		   memcmp(a->ipv6->src, b->ipv6->src, NET_IPV6_ADDR_SIZE * 2) != 0) {
+		return false;
+	}
+
+	return a->tcp->src_port == b->tcp->src_port &&
+	       a->tcp->dst_port == b->tcp->dst_port &&
+	       memcmp(a->tcp->ack, b->tcp->ack, sizeof(a->tcp->ack)) == 0 &&
+	       memcmp(a->tcp->optdata, b->tcp->optdata, a->tcp_len - NET_TCPH_LEN) == 0;
+}
+
+/* Merged packets would be forwarded over the MTU, only the ones for us are
+ * coalesced.
+ */
+static bool gro_is_local(struct net_if *iface, const struct gro_hdrs *h)
+{
+	if (IS_ENABLED(CONFIG_NET_IPV4) && h->eth->type == htons(NET_ETH_PTYPE_IP)) {
+		struct in_addr dst;
+
+		memcpy(&dst, h->ipv4->dst, sizeof(dst));
+
+		return net_if_ipv4_addr_lookup(&dst, &iface) != NULL;
+	}
+
+	if (IS_ENABLED(CONFIG_NET_IPV6)) {
+		struct in6_addr dst;
+
+		memcpy(&dst, h->ipv6->dst, sizeof(dst));
+
+		return net_if_ipv6_addr_lookup(&dst, &iface) != NULL;
+	}
+
+	return false;
+}
+
+/* Update a 16-bit header field along with the IPv4 header checksum,
+ * RFC 1624 eqn. 3.
+ */
+static void gro_ipv4_set_len(struct net_ipv4_hdr *hdr, uint16_t len)
+{
+	uint32_t sum;
+
+	sum = (uint16_t)~hdr->chksum + (uint16_t)~hdr->len + htons(len);
+	sum = (sum & 0xffff) + (sum >> 16);
+	sum = (sum & 0xffff) + (sum >> 16);
+
+	hdr->chksum = ~sum;
+	hdr->len = htons(len);
+}
+
+static void gro_merge(struct net_pkt *pkt, struct gro_hdrs *h,
+		      struct net_pkt *next, struct gro_hdrs *next_h)
+{
+	size_t hdr_len = gro_hdrs_len(next_h);
+	struct net_buf *buf = next->buffer;
+
+	h->payload_len += next_h->payload_len;
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && h->eth->type == htons(NET_ETH_PTYPE_IP)) {
+		gro_ipv4_set_len(h->ipv4, h->ip_len + h->tcp_len + h->payload_len);
+	} else {
+		h->ipv6->len = htons(h->tcp_len + h->payload_len);
+	}
+
+	/* The latest window and push flag apply */
+	memcpy(h->tcp->wnd, next_h->tcp->wnd, sizeof(h->tcp->wnd));
+	h->tcp->flags |= next_h->tcp->flags & GRO_TCP_PSH;
+
+	net_buf_pull(buf, hdr_len);
+	if (buf->len == 0) {
+		buf = net_buf_frag_del(NULL, buf);
+	}
+
+	next->buffer = NULL;
+	net_pkt_append_buffer(pkt, buf);
+	net_pkt_unref(next);
+}
+
+struct net_pkt *net_tcp_gro(struct k_fifo *fifo, struct net_pkt *pkt)
+{
+	struct net_if *iface = net_pkt_iface(pkt);
+	struct gro_hdrs h, next_h;
+	uint16_t seg_len;
+	int count = 1;
+
+	/* The header of the merged packet is not verified again */
+	if (net_if_l2(iface) != &NET_L2_GET_NAME(ETHERNET) ||
+	    net_if_need_calc_rx_checksum(iface) ||
+	    k_fifo_is_empty(fifo) || !gro_parse(pkt, &h) ||
+	    !gro_is_local(iface, &h)) {
+		return pkt;
+	}
+
+	seg_len = h.payload_len;
+
+	while (count < CONFIG_NET_TCP_GRO_MAX_SEGMENTS) {
+		/* The RX thread is the only consumer of its queue, what is
+		 * peeked here is what is taken next.
+		 */
+		struct net_pkt *next = k_fifo_peek_head(fifo);
+
+		/* A short or pushed segment ends the burst */
+		if (next == NULL || h.payload_len != seg_len * count ||
+		    (h.tcp->flags & GRO_TCP_PSH) ||
+		    net_pkt_iface(next) != iface || !gro_parse(next, &next_h) ||
+		    next_h.payload_len > seg_len ||
+		    h.ip_len + h.tcp_len + h.payload_len + next_h.payload_len > UINT16_MAX ||
+		    sys_get_be32(next_h.tcp->seq) != sys_get_be32(h.tcp->seq) + h.payload_len ||
+		    !gro_same_flow(&h, &next_h)) {
+			break;
+		}
+
+		next = k_fifo_get(fifo, K_NO_WAIT);
+		gro_merge(pkt, &h, next, &next_h);
+		count++;
+	}
+
+	if (count > 1) {
+		NET_DBG("Merged %d segments, %u bytes", count, h.payload_len);
+	}
+
+	return pkt;
+}
@@ -5,6 +5,8 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <zephyr/sys/iterable_sections.h>
+
 #include "tp.h"
 
 #define is(_a, _b) (strcmp((_a), (_b)) == 0)
@@ -58,7 +60,7 @@
 #endif
 
 #define tcp_pkt_ref(_pkt) net_pkt_ref(_pkt)
-#define tcp_pkt_alloc(_conn, _len)					\
+#define tcp_pkt_alloc_timeout(_conn, _len, _timeout)			\
 ({									\
 	struct net_pkt *_pkt;						\
 									\
@@ -68,9 +70,9 @@
 			(_len),						\
 			net_context_get_family((_conn)->context),	\
 			IPPROTO_TCP,					\
-			TCP_PKT_ALLOC_TIMEOUT);				\
+			(_timeout));					\
 	} else {							\
-		_pkt = net_pkt_alloc(TCP_PKT_ALLOC_TIMEOUT);		\
+		_pkt = net_pkt_alloc(_timeout);				\
 	}								\
 									\
 	tp_pkt_alloc(_pkt, tp_basename(__FILE__), __LINE__);		\
@@ -78,6 +80,9 @@
 	_pkt;								\
 })
 
+#define tcp_pkt_alloc(_conn, _len)					\
+	tcp_pkt_alloc_timeout(_conn, _len, TCP_PKT_ALLOC_TIMEOUT)
+
 #define tcp_rx_pkt_alloc(_conn, _len)					\
 ({									\
 	struct net_pkt *_pkt;						\
@@ -146,7 +151,7 @@
 #define conn_send_data_dump(_conn)                                             \
 	({                                                                     \
 		NET_DBG("conn: %p total=%zd, unacked_len=%d, "                 \
-			"send_win=%hu, mss=%hu",                               \
+			"send_win=%u, mss=%hu",                                \
 			(_conn), net_pkt_get_len((_conn)->send_data),          \
 			_conn->unacked_len, _conn->send_win,                   \
 			(uint16_t)conn_mss((_conn)));                          \
@@ -227,30 +232,86 @@ union tcp_endpoint {
 #define NET_TCP_NOP_OPT          1
 #define NET_TCP_MSS_OPT          2
 #define NET_TCP_WINDOW_SCALE_OPT 3
+#define NET_TCP_SACK_PERM_OPT    4
+#define NET_TCP_SACK_OPT         5
 
 /* TCP Option sizes */
 #define NET_TCP_END_SIZE          1
 #define NET_TCP_NOP_SIZE          1
 #define NET_TCP_MSS_SIZE          4
 #define NET_TCP_WINDOW_SCALE_SIZE 3
+#define NET_TCP_SACK_PERM_SIZE    2
+
+/* Largest window scale shift allowed by RFC 7323 */
+#define NET_TCP_MAX_WINDOW_SCALE  14
+
+/* Without the timestamp option, up to 4 SACK blocks fit in the header */
+#define NET_TCP_MAX_SACK_BLOCKS   4
+
+struct tcp_sack_block {
+	uint32_t left;
+	uint32_t right;
+};
 
 struct tcp_options {
 	uint16_t mss;
 	uint16_t window;
+#ifdef CONFIG_NET_TCP_SACK
+	struct tcp_sack_block sack[NET_TCP_MAX_SACK_BLOCKS];
+	uint8_t sack_count;
+#endif
 	bool mss_found : 1;
 	bool wnd_found : 1;
+	bool sack_perm_found : 1;
 };
 
+/* Largest window that can be advertised or used */
+#ifdef CONFIG_NET_TCP_WINDOW_SCALE
+#define TCP_MAX_WIN (UINT16_MAX << NET_TCP_MAX_WINDOW_SCALE)
+#else
+#define TCP_MAX_WIN UINT16_MAX
+#endif
+
+struct tcp;
+
 #ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
 
-struct tcp_collision_avoidance_reno {
-	uint16_t cwnd;
-	uint16_t ssthresh;
-	uint16_t pending_fast_retransmit_bytes;
+/** Congestion control algorithm, selected per connection by name */
+struct tcp_ca_ops {
+	const char *name;
+	/** Reset the algorithm state, optional */
+	void (*init)(struct tcp *conn);
+	/** Return the slow start threshold to use after a loss */
+	uint32_t (*ssthresh)(struct tcp *conn);
+	/** Grow the congestion window once above the slow start threshold */
+	void (*cong_avoid)(struct tcp *conn, uint32_t acked_len);
+};
+
+#define TCP_CA_DEFINE(_id, _name, _init, _ssthresh, _cong_avoid)	\
+	static const STRUCT_SECTION_ITERABLE(tcp_ca_ops, _id) = {	\
+		.name = _name,						\
+		.init = _init,						\
+		.ssthresh = _ssthresh,					\
+		.cong_avoid = _cong_avoid,				\
+	}
+
+struct tcp_congestion_avoidance {
+	const struct tcp_ca_ops *ops;
+	uint32_t cwnd;
+	uint32_t ssthresh;
+	uint32_t pending_fast_retransmit_bytes;
+#ifdef CONFIG_NET_TCP_CONGESTION_CUBIC
+	struct {
+		int64_t epoch_start;
+		uint32_t w_max;
+		uint32_t w_est;
+		uint32_t origin;
+		uint32_t k;
+	} cubic;
+#endif
 };
 #endif
 
-struct tcp;
 typedef void (*net_tcp_closed_cb_t)(struct tcp *conn, void *user_data);
 
 struct tcp { /* TCP connection */
@@ -314,15 +375,25 @@ struct tcp { /* TCP connection */
 	uint32_t keep_cnt;
 	uint32_t keep_cur;
 #endif /* CONFIG_NET_TCP_KEEPALIVE */
-	uint16_t recv_win_max;
-	uint16_t recv_win;
-	uint16_t send_win_max;
-	uint16_t send_win;
+	uint32_t recv_win_max;
+	uint32_t recv_win;
+	uint32_t send_win_max;
+	uint32_t send_win;
+#ifdef CONFIG_NET_TCP_SACK
+	/* Blocks SACKed by the peer above conn->seq, sorted and disjoint */
+	struct tcp_sack_block sacked[NET_TCP_MAX_SACK_BLOCKS];
+	uint32_t sack_recover; /* end of the data sent when the loss was detected */
+	uint8_t sacked_count;
+#endif
+#ifdef CONFIG_NET_TCP_WINDOW_SCALE
+	uint8_t recv_wscale; /* shift applied to the window we advertise */
+	uint8_t send_wscale; /* shift applied to the peer's window */
+#endif
 #ifdef CONFIG_NET_TCP_RANDOMIZED_RTO
 	uint16_t rto;
 #endif
 #ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
-	struct tcp_collision_avoidance_reno ca;
+	struct tcp_congestion_avoidance ca;
 #endif
 	uint8_t send_data_retries;
 #ifdef CONFIG_NET_TCP_FAST_RETRANSMIT
@@ -336,6 +407,10 @@ struct tcp { /* TCP connection */
 	bool keep_alive : 1;
 #endif /* CONFIG_NET_TCP_KEEPALIVE */
 	bool tcp_nodelay : 1;
+#ifdef CONFIG_NET_TCP_SACK
+	bool sack_permitted : 1;
+	bool sack_recovery : 1;
+#endif
 };
 
 #define _flags(_fl, _op, _mask, _cond)					\
@@ -520,6 +520,100 @@ static uint16_t offset_based_swap8(const uint8_t *data)
 	}
 }
 
+#if defined(CONFIG_ARMV7_M_ARMV8_M_MAINLINE)
+/* Sum the words with a chain of add with carry instructions, the carry
+ * out of each addition is added back by the next one.
+ */
+static inline uint32_t chksum_words(const uint32_t *p, size_t words)
+{
+	uint32_t sum = 0U;
+
+	while (words >= 4) {
+		__asm__ ("adds %0, %0, %1\n\t"
+			 "adcs %0, %0, %2\n\t"
+			 "adcs %0, %0, %3\n\t"
+			 "adcs %0, %0, %4\n\t"
+			 "adc %0, %0, #0"
+			 : "+r" (sum)
+			 : "r" (p[0]), "r" (p[1]), "r" (p[2]), "r" (p[3])
+			 : "cc");
+		p += 4;
+		words -= 4;
+	}
+
+	while (words--) {
+		__asm__ ("adds %0, %0, %1\n\t"
+			 "adc %0, %0, #0"
+			 : "+r" (sum)
+			 : "r" (*p++)
+			 : "cc");
+	}
+
+	return sum;
+}
+#elif defined(CONFIG_64BIT)
+/* Sum two words at a time into a 64-bit accumulator, adding the carry
+ * back in.
+ */
+static inline uint32_t chksum_words(const uint32_t *p, size_t words)
+{
+	uint64_t sum = 0U;
+	uint64_t sum_b = 0U;
+
+	while (words >= 4) {
+		uint64_t a = UNALIGNED_GET((const uint64_t *)p);
+		uint64_t b = UNALIGNED_GET((const uint64_t *)(p + 2));
+
+		sum += a;
+		sum += (sum < a);
+		sum_b += b;
+		sum_b += (sum_b < b);
+		p += 4;
+		words -= 4;
+	}
+
+	sum += sum_b;
+	sum += (sum < sum_b);
+
+	while (words--) {
+		sum += *p;
+		sum += (sum < *p);
+		p++;
+	}
+
+	sum = (sum & 0xffffffff) + (sum >> 32);
+	sum = (sum & 0xffffffff) + (sum >> 32);
+
+	return sum;
+}
+#else
+static inline uint32_t chksum_words(const uint32_t *p, size_t words)
+{
+	uint64_t sum = 0U;
+
+	/* Do loop unrolling for the very large data sets */
+	while (words >= 4) {
+		uint64_t sum_a = p[0];
+		uint64_t sum_b = p[1];
+
+		sum_a += p[2];
+		sum_b += p[3];
+		sum += sum_a + sum_b;
+		p += 4;
+		words -= 4;
+	}
+
+	while (words--) {
+		sum += *p++;
+	}
+
+	sum = (sum & 0xffffffff) + (sum >> 32);
+	sum = (sum & 0xffffffff) + (sum >> 32);
+
+	return sum;
+}
+#endif
+
 /* Word based checksum calculation based on:
  * https://blogs.igalia.com/dpino/2018/06/14/fast-checksum-computation/
  * It’s not necessary to add octets as 16-bit words. Due to the associative property of addition,
@@ -530,8 +624,6 @@ static uint16_t offset_based_swap8(const uint8_t *data)
 uint16_t calc_chksum(uint16_t sum_in, const uint8_t *data, size_t len)
 {
 	uint64_t sum;
-	uint32_t *p;
-	size_t i = 0;
 	size_t pending = len;
 	int odd_start = ((uintptr_t)data & 0x01);
 
@@ -555,24 +647,11 @@ uint16_t calc_chksum(uint16_t sum_in, const uint8_t *data, size_t len)
 		sum = sum + *((uint16_t *)data);
 		data += sizeof(uint16_t);
 	}
-	p = (uint32_t *)data;
 
-	/* Do loop unrolling for the very large data sets */
-	while (pending >= sizeof(uint32_t) * 4) {
-		uint64_t sum_a = p[i];
-		uint64_t sum_b = p[i + 1];
-
-		pending -= sizeof(uint32_t) * 4;
-		sum_a += p[i + 2];
-		sum_b += p[i + 3];
-		i += 4;
-		sum += sum_a + sum_b;
-	}
-	while (pending >= sizeof(uint32_t)) {
-		pending -= sizeof(uint32_t);
-		sum = sum + p[i++];
-	}
-	data = (uint8_t *)(p + i);
+	sum += chksum_words((const uint32_t *)data, pending / sizeof(uint32_t));
+	data += ROUND_DOWN(pending, sizeof(uint32_t));
+	pending %= sizeof(uint32_t);
+
 	if (pending >= 2) {
 		pending -= sizeof(uint16_t);
 		sum = sum + *((uint16_t *)data);
@@ -597,6 +676,28 @@ uint16_t calc_chksum(uint16_t sum_in, const uint8_t *data, size_t len)
 	}
 }
 
+/* Copy in blocks small enough to be still in the cache when they are summed,
+ * instead of reading the whole data twice. The block length is even so that
+ * the blocks can be chained.
+ */
+#define CHKSUM_COPY_BLOCK 64
+
+uint16_t calc_chksum_copy(uint16_t sum, uint8_t *dst, const uint8_t *src, size_t len)
+{
+	while (len > 0) {
+		size_t block = MIN(len, CHKSUM_COPY_BLOCK);
+
+		memcpy(dst, src, block);
+		sum = calc_chksum(sum, dst, block);
+
+		dst += block;
+		src += block;
+		len -= block;
+	}
+
+	return sum;
+}
+
 static inline uint16_t pkt_calc_chksum(struct net_pkt *pkt, uint16_t sum)
 {
 	struct net_pkt_cursor *cur = &pkt->cursor;
@@ -113,6 +113,11 @@ static int net_bt_send(struct net_if *iface, struct net_pkt *pkt)
 		return ret;
 	}
 
+	/* Compression only shrinks the head fragment, fill the gap before
+	 * passing the fragments to L2CAP.
+	 */
+	net_pkt_compact(pkt);
+
 	length = net_pkt_get_len(pkt);
 
 	net_capture_pkt(iface, pkt);
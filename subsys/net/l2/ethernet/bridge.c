@@ -12,6 +12,7 @@ LOG_MODULE_REGISTER(net_eth_bridge, CONFIG_NET_ETHERNET_BRIDGE_LOG_LEVEL);
 #include <zephyr/net/net_if.h>
 #include <zephyr/net/ethernet.h>
 #include <zephyr/net/ethernet_bridge.h>
+#include <zephyr/sys/byteorder.h>
 #include <zephyr/sys/iterable_sections.h>
 #include <zephyr/sys/slist.h>
 
@@ -20,6 +21,23 @@ LOG_MODULE_REGISTER(net_eth_bridge, CONFIG_NET_ETHERNET_BRIDGE_LOG_LEVEL);
 extern struct eth_bridge _eth_bridge_list_start[];
 extern struct eth_bridge _eth_bridge_list_end[];
 
+#if defined(CONFIG_NET_ETHERNET_BRIDGE_FDB)
+#define FDB_AGEING_TIME_MS (CONFIG_NET_ETHERNET_BRIDGE_FDB_AGEING_TIME * MSEC_PER_SEC)
+
+static void fdb_init(struct eth_bridge *br)
+{
+	sys_slist_init(&br->fdb_free);
+
+	for (int i = 0; i < ARRAY_SIZE(br->fdb); i++) {
+		sys_slist_init(&br->fdb[i]);
+	}
+
+	for (int i = 0; i < ARRAY_SIZE(br->fdb_entries); i++) {
+		sys_slist_append(&br->fdb_free, &br->fdb_entries[i].node);
+	}
+}
+#endif
+
 static void lock_bridge(struct eth_bridge *br)
 {
 	/* Lazy-evaluate initialization.  The ETH_BRIDGE_INITIALIZER()
@@ -29,11 +47,133 @@ static void lock_bridge(struct eth_bridge *br)
 	 */
 	if (!br->initialized) {
 		k_mutex_init(&br->lock);
+#if defined(CONFIG_NET_ETHERNET_BRIDGE_FDB)
+		fdb_init(br);
+#endif
 		br->initialized = true;
 	}
 	k_mutex_lock(&br->lock, K_FOREVER);
 }
 
+#if defined(CONFIG_NET_ETHERNET_BRIDGE_FDB)
+static sys_slist_t *fdb_bucket(struct eth_bridge *br, const uint8_t *addr)
+{
+	/* The last bytes are the NIC specific part, they vary the most */
+	uint32_t hash = sys_get_be32(&addr[2]);
+
+	hash ^= hash >> 16;
+
+	return &br->fdb[hash % ARRAY_SIZE(br->fdb)];
+}
+
+static bool fdb_entry_expired(struct eth_bridge_fdb_entry *entry, uint32_t now)
+{
+	return (uint32_t)(now - entry->last_seen) >= FDB_AGEING_TIME_MS;
+}
+
+static void fdb_entry_free(struct eth_bridge *br, sys_slist_t *bucket,
+			   struct eth_bridge_fdb_entry *entry)
+{
+	sys_slist_find_and_remove(bucket, &entry->node);
+	sys_slist_prepend(&br->fdb_free, &entry->node);
+}
+
+/* Must be invoked with bridge lock held */
+static struct eth_bridge_fdb_entry *fdb_lookup(struct eth_bridge *br,
+					       const uint8_t *addr,
+					       uint32_t now)
+{
+	sys_slist_t *bucket = fdb_bucket(br, addr);
+	struct eth_bridge_fdb_entry *entry, *next;
+
+	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(bucket, entry, next, node) {
+		if (memcmp(entry->addr, addr, sizeof(entry->addr)) != 0) {
+			continue;
+		}
+
+		if (fdb_entry_expired(entry, now)) {
+			fdb_entry_free(br, bucket, entry);
+			br->stats.aged++;
+			return NULL;
+		}
+
+		return entry;
+	}
+
+	return NULL;
+}
+
+/* Must be invoked with bridge lock held */
+static struct eth_bridge_fdb_entry *fdb_alloc(struct eth_bridge *br,
+					      uint32_t now)
+{
+	struct eth_bridge_fdb_entry *oldest = NULL;
+	sys_snode_t *node;
+
+	node = sys_slist_get(&br->fdb_free);
+	if (node != NULL) {
+		return CONTAINER_OF(node, struct eth_bridge_fdb_entry, node);
+	}
+
+	/* Table is full, reuse the least recently seen address */
+	for (int i = 0; i < ARRAY_SIZE(br->fdb_entries); i++) {
+		struct eth_bridge_fdb_entry *entry = &br->fdb_entries[i];
+
+		if (oldest == NULL ||
+		    (uint32_t)(now - entry->last_seen) >
+		    (uint32_t)(now - oldest->last_seen)) {
+			oldest = entry;
+		}
+	}
+
+	sys_slist_find_and_remove(fdb_bucket(br, oldest->addr), &oldest->node);
+	br->stats.aged++;
+
+	return oldest;
+}
+
+/* Must be invoked with bridge lock held */
+static void fdb_learn(struct eth_bridge *br, struct ethernet_context *ctx,
+		      const uint8_t *addr, uint32_t now)
+{
+	struct eth_bridge_fdb_entry *entry;
+
+	/* Group addresses are never used as a source */
+	if (addr[0] & 0x01) {
+		return;
+	}
+
+	entry = fdb_lookup(br, addr, now);
+	if (entry == NULL) {
+		entry = fdb_alloc(br, now);
+		memcpy(entry->addr, addr, sizeof(entry->addr));
+		sys_slist_prepend(fdb_bucket(br, addr), &entry->node);
+		br->stats.learned++;
+
+		NET_DBG("learned %s on iface %p",
+			net_sprint_ll_addr(addr, sizeof(entry->addr)), ctx->iface);
+	}
+
+	/* Also moves the address if the station moved to another port */
+	entry->port = ctx;
+	entry->last_seen = now;
+}
+
+/* Must be invoked with bridge lock held */
+static void fdb_flush_port(struct eth_bridge *br, struct ethernet_context *ctx)
+{
+	for (int i = 0; i < ARRAY_SIZE(br->fdb); i++) {
+		struct eth_bridge_fdb_entry *entry, *next;
+
+		SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&br->fdb[i], entry, next, node) {
+			if (ctx == NULL || entry->port == ctx) {
+				fdb_entry_free(br, &br->fdb[i], entry);
+			}
+		}
+	}
+}
+#endif /* CONFIG_NET_ETHERNET_BRIDGE_FDB */
+
 void net_eth_bridge_foreach(eth_bridge_cb_t cb, void *user_data)
 {
 	STRUCT_SECTION_FOREACH(eth_bridge, br) {
@@ -116,6 +256,10 @@ int eth_bridge_iface_remove(struct eth_bridge *br, struct net_if *iface)
 	sys_slist_find_and_remove(&br->interfaces, &ctx->bridge.node);
 	ctx->bridge.instance = NULL;
 
+#if defined(CONFIG_NET_ETHERNET_BRIDGE_FDB)
+	fdb_flush_port(br, ctx);
+#endif
+
 	k_mutex_unlock(&br->lock);
 
 	NET_DBG("iface %p removed from bridge %p", iface, br);
@@ -151,6 +295,53 @@ int eth_bridge_listener_remove(struct eth_bridge *br, struct eth_bridge_listener
 	return 0;
 }
 
+void eth_bridge_stats_get(struct eth_bridge *br, struct eth_bridge_stats *stats)
+{
+	lock_bridge(br);
+	*stats = br->stats;
+	k_mutex_unlock(&br->lock);
+}
+
+void eth_bridge_fdb_foreach(struct eth_bridge *br, eth_bridge_fdb_cb_t cb,
+			    void *user_data)
+{
+#if defined(CONFIG_NET_ETHERNET_BRIDGE_FDB)
+	uint32_t now = k_uptime_get_32();
+
+	lock_bridge(br);
+
+	for (int i = 0; i < ARRAY_SIZE(br->fdb); i++) {
+		struct eth_bridge_fdb_entry *entry;
+
+		SYS_SLIST_FOR_EACH_CONTAINER(&br->fdb[i], entry, node) {
+			if (fdb_entry_expired(entry, now)) {
+				continue;
+			}
+
+			cb(br, (const struct net_eth_addr *)entry->addr,
+			   entry->port->iface, now - entry->last_seen, user_data);
+		}
+	}
+
+	k_mutex_unlock(&br->lock);
+#else
+	ARG_UNUSED(br);
+	ARG_UNUSED(cb);
+	ARG_UNUSED(user_data);
+#endif
+}
+
+void eth_bridge_fdb_flush(struct eth_bridge *br)
+{
+#if defined(CONFIG_NET_ETHERNET_BRIDGE_FDB)
+	lock_bridge(br);
+	fdb_flush_port(br, NULL);
+	k_mutex_unlock(&br->lock);
+#else
+	ARG_UNUSED(br);
+#endif
+}
+
 static inline bool is_link_local_addr(struct net_eth_addr *addr)
 {
 	if (addr->addr[0] == 0x01 &&
@@ -165,6 +356,49 @@ static inline bool is_link_local_addr(struct net_eth_addr *addr)
 	return false;
 }
 
+static bool can_xmit(struct ethernet_context *out_ctx)
+{
+	/* Skip it if not allowed to transmit */
+	if (!out_ctx->bridge.allow_tx) {
+		return false;
+	}
+
+	/* Skip it if not up */
+	return net_if_flag_is_set(out_ctx->iface, NET_IF_UP);
+}
+
+static void xmit(struct net_pkt *pkt, struct net_if *orig_iface,
+		 struct ethernet_context *out_ctx)
+{
+	/*
+	 * Use AF_UNSPEC to avoid interference, set the output
+	 * interface and send the packet.
+	 */
+	net_pkt_set_family(pkt, AF_UNSPEC);
+	net_pkt_set_orig_iface(pkt, orig_iface);
+	net_pkt_set_iface(pkt, out_ctx->iface);
+	net_if_queue_tx(out_ctx->iface, pkt);
+}
+
+static void deliver_to_listeners(struct eth_bridge *br, struct net_pkt *pkt)
+{
+	sys_snode_t *node;
+
+	SYS_SLIST_FOR_EACH_NODE(&br->listeners, node) {
+		struct eth_bridge_listener *l;
+		struct net_pkt *out_pkt;
+
+		l = CONTAINER_OF(node, struct eth_bridge_listener, node);
+
+		out_pkt = net_pkt_shallow_clone(pkt, K_NO_WAIT);
+		if (out_pkt == NULL) {
+			continue;
+		}
+
+		k_fifo_put(&l->pkt_queue, out_pkt);
+	}
+}
+
 enum net_verdict net_eth_bridge_input(struct ethernet_context *ctx,
 				      struct net_pkt *pkt)
 {
@@ -173,16 +407,56 @@ enum net_verdict net_eth_bridge_input(struct ethernet_context *ctx,
 
 	NET_DBG("new pkt %p", pkt);
 
+	lock_bridge(br);
+
+	br->stats.rx++;
+
 	/* Drop all link-local packets for now. */
 	if (is_link_local_addr((struct net_eth_addr *)net_pkt_lladdr_dst(pkt))) {
+		br->stats.dropped++;
+		k_mutex_unlock(&br->lock);
 		return NET_DROP;
 	}
 
-	lock_bridge(br);
+#if defined(CONFIG_NET_ETHERNET_BRIDGE_FDB)
+	uint32_t now = k_uptime_get_32();
+	const uint8_t *dst = net_pkt_lladdr_dst(pkt)->addr;
+	struct eth_bridge_fdb_entry *entry;
+
+	fdb_learn(br, ctx, net_pkt_lladdr_src(pkt)->addr, now);
+
+	entry = (dst[0] & 0x01) ? NULL : fdb_lookup(br, dst, now);
+	if (entry != NULL) {
+		deliver_to_listeners(br, pkt);
+
+		if (entry->port == ctx || !can_xmit(entry->port)) {
+			/* The destination is on the segment the frame
+			 * came from, or cannot be reached right now.
+			 */
+			br->stats.filtered++;
+			k_mutex_unlock(&br->lock);
+			net_pkt_unref(pkt);
+			return NET_OK;
+		}
+
+		/* Known unicast destination, hand over the received packet
+		 * itself to the single output interface.
+		 */
+		NET_DBG("forwarding pkt %p on iface %p", pkt, entry->port->iface);
+
+		br->stats.forwarded++;
+		xmit(pkt, net_pkt_iface(pkt), entry->port);
+
+		k_mutex_unlock(&br->lock);
+		return NET_OK;
+	}
+#endif /* CONFIG_NET_ETHERNET_BRIDGE_FDB */
+
+	br->stats.flooded++;
 
 	/*
-	 * Send packet to all registered interfaces for now.
-	 * Eventually we could get smarter with a MAC address cache.
+	 * Send packet to all registered interfaces, the destination is
+	 * unknown or a group address.
 	 */
 	SYS_SLIST_FOR_EACH_NODE(&br->interfaces, node) {
 		struct ethernet_context *out_ctx;
@@ -195,46 +469,22 @@ enum net_verdict net_eth_bridge_input(struct ethernet_context *ctx,
 			continue;
 		}
 
-		/* Skip it if not allowed to transmit */
-		if (!out_ctx->bridge.allow_tx) {
-			continue;
-		}
-
-		/* Skip it if not up */
-		if (!net_if_flag_is_set(out_ctx->iface, NET_IF_UP)) {
+		if (!can_xmit(out_ctx)) {
 			continue;
 		}
 
 		out_pkt = net_pkt_shallow_clone(pkt, K_NO_WAIT);
 		if (out_pkt == NULL) {
+			br->stats.dropped++;
 			continue;
 		}
 
 		NET_DBG("sending pkt %p as %p on iface %p", pkt, out_pkt, out_ctx->iface);
 
-		/*
-		 * Use AF_UNSPEC to avoid interference, set the output
-		 * interface and send the packet.
-		 */
-		net_pkt_set_family(out_pkt, AF_UNSPEC);
-		net_pkt_set_orig_iface(out_pkt, net_pkt_iface(pkt));
-		net_pkt_set_iface(out_pkt, out_ctx->iface);
-		net_if_queue_tx(out_ctx->iface, out_pkt);
+		xmit(out_pkt, net_pkt_iface(pkt), out_ctx);
 	}
 
-	SYS_SLIST_FOR_EACH_NODE(&br->listeners, node) {
-		struct eth_bridge_listener *l;
-		struct net_pkt *out_pkt;
-
-		l = CONTAINER_OF(node, struct eth_bridge_listener, node);
-
-		out_pkt = net_pkt_shallow_clone(pkt, K_NO_WAIT);
-		if (out_pkt == NULL) {
-			continue;
-		}
-
-		k_fifo_put(&l->pkt_queue, out_pkt);
-	}
+	deliver_to_listeners(br, pkt);
 
 	k_mutex_unlock(&br->lock);
 
@@ -201,6 +201,91 @@ static int cmd_bridge_show(const struct shell *sh, size_t argc, char *argv[])
 	return 0;
 }
 
+static struct eth_bridge *get_bridge(const struct shell *sh, char *index_str)
+{
+	struct eth_bridge *br;
+	int br_idx;
+
+	br_idx = get_idx(sh, index_str);
+	if (br_idx < 0) {
+		return NULL;
+	}
+	br = eth_bridge_get_by_index(br_idx);
+	if (br == NULL) {
+		shell_warn(sh, "Bridge %d not found\n", br_idx);
+	}
+	return br;
+}
+
+static int cmd_bridge_stats(const struct shell *sh, size_t argc, char *argv[])
+{
+	struct eth_bridge_stats stats;
+	struct eth_bridge *br;
+
+	br = get_bridge(sh, argv[1]);
+	if (br == NULL) {
+		return -ENOENT;
+	}
+
+	eth_bridge_stats_get(br, &stats);
+
+	shell_fprintf(sh, SHELL_NORMAL, "Received  : %u\n", stats.rx);
+	shell_fprintf(sh, SHELL_NORMAL, "Forwarded : %u\n", stats.forwarded);
+	shell_fprintf(sh, SHELL_NORMAL, "Flooded   : %u\n", stats.flooded);
+	shell_fprintf(sh, SHELL_NORMAL, "Filtered  : %u\n", stats.filtered);
+	shell_fprintf(sh, SHELL_NORMAL, "Dropped   : %u\n", stats.dropped);
+	shell_fprintf(sh, SHELL_NORMAL, "Learned   : %u\n", stats.learned);
+	shell_fprintf(sh, SHELL_NORMAL, "Aged      : %u\n", stats.aged);
+
+	return 0;
+}
+
+#if defined(CONFIG_NET_ETHERNET_BRIDGE_FDB)
+static void fdb_show(struct eth_bridge *br, const struct net_eth_addr *addr,
+		     struct net_if *iface, uint32_t age, void *user_data)
+{
+	const struct shell *sh = user_data;
+	const uint8_t *a = addr->addr;
+
+	shell_fprintf(sh, SHELL_NORMAL,
+		      "%02x:%02x:%02x:%02x:%02x:%02x %-10d%u.%03u\n",
+		      a[0], a[1], a[2], a[3], a[4], a[5],
+		      net_if_get_by_iface(iface), age / MSEC_PER_SEC,
+		      age % MSEC_PER_SEC);
+}
+#endif
+
+static int cmd_bridge_fdb(const struct shell *sh, size_t argc, char *argv[])
+{
+#if defined(CONFIG_NET_ETHERNET_BRIDGE_FDB)
+	struct eth_bridge *br;
+
+	br = get_bridge(sh, argv[1]);
+	if (br == NULL) {
+		return -ENOENT;
+	}
+
+	if (argc == 3) {
+		if (strcmp(argv[2], "flush") != 0) {
+			shell_warn(sh, "Unknown argument %s\n", argv[2]);
+			return -EINVAL;
+		}
+
+		eth_bridge_fdb_flush(br);
+		return 0;
+	}
+
+	shell_fprintf(sh, SHELL_NORMAL, "address           iface     age (s)\n");
+	eth_bridge_fdb_foreach(br, fdb_show, (void *)sh);
+
+	return 0;
+#else
+	shell_warn(sh, "Set %s to enable %s support.\n",
+		   "CONFIG_NET_ETHERNET_BRIDGE_FDB", "forwarding database");
+	return -ENOEXEC;
+#endif
+}
+
 SHELL_STATIC_SUBCMD_SET_CREATE(bridge_commands,
 	SHELL_CMD_ARG(addif, NULL,
 		  "Add a network interface to a bridge.\n"
@@ -218,6 +303,14 @@ SHELL_STATIC_SUBCMD_SET_CREATE(bridge_commands,
 		  "Show bridge information.\n"
 		  "'bridge show [<bridge_index>]'",
 		  cmd_bridge_show, 1, 1),
+	SHELL_CMD_ARG(stats, NULL,
+		  "Show bridge forwarding statistics.\n"
+		  "'bridge stats <bridge_index>'",
+		  cmd_bridge_stats, 2, 0),
+	SHELL_CMD_ARG(fdb, NULL,
+		  "Show or flush the learned addresses of a bridge.\n"
+		  "'bridge fdb <bridge_index> [flush]'",
+		  cmd_bridge_fdb, 2, 1),
 	SHELL_SUBCMD_SET_END
 );
 
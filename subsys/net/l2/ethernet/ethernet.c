@@ -25,6 +25,7 @@ LOG_MODULE_REGISTER(net_ethernet, CONFIG_NET_L2_ETHERNET_LOG_LEVEL);
 #include "arp.h"
 #include "eth_stats.h"
 #include "net_private.h"
+#include "ipv4.h"
 #include "ipv6.h"
 #include "ipv4_autoconf_internal.h"
 #include "bridge.h"
@@ -598,6 +599,145 @@ static void ethernet_remove_l2_header(struct net_pkt *pkt)
 	net_pkt_frag_unref(buf);
 }
 
+#if defined(CONFIG_NET_TCP_TSO)
+/* IPv4 or IPv6 header with its options, and TCP header with its options */
+#define GSO_MAX_HDR_LEN 128
+
+#define GSO_TCP_FIN BIT(0)
+#define GSO_TCP_PSH BIT(3)
+
+static int ethernet_send(struct net_if *iface, struct net_pkt *pkt);
+
+static struct net_pkt *ethernet_gso_segment(struct net_if *iface,
+					    struct net_pkt *pkt,
+					    const uint8_t *hdr, size_t hdr_len,
+					    size_t len)
+{
+	struct net_pkt *seg;
+
+	seg = net_pkt_alloc_with_buffer(iface, hdr_len + len, AF_UNSPEC, 0,
+					NET_BUF_TIMEOUT);
+	if (!seg) {
+		return NULL;
+	}
+
+	net_pkt_set_family(seg, net_pkt_family(pkt));
+	net_pkt_set_context(seg, net_pkt_context(pkt));
+	net_pkt_set_priority(seg, net_pkt_priority(pkt));
+	net_pkt_set_vlan_tag(seg, net_pkt_vlan_tag(pkt));
+	net_pkt_set_ip_hdr_len(seg, net_pkt_ip_hdr_len(pkt));
+
+	/* The link addresses do not point into the packet when sending */
+	memcpy(net_pkt_lladdr_src(seg), net_pkt_lladdr_src(pkt),
+	       sizeof(struct net_linkaddr));
+	memcpy(net_pkt_lladdr_dst(seg), net_pkt_lladdr_dst(pkt),
+	       sizeof(struct net_linkaddr));
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(pkt) == AF_INET) {
+		net_pkt_set_ipv4_opts_len(seg, net_pkt_ipv4_opts_len(pkt));
+	} else if (IS_ENABLED(CONFIG_NET_IPV6) && net_pkt_family(pkt) == AF_INET6) {
+		net_pkt_set_ipv6_ext_len(seg, net_pkt_ipv6_ext_len(pkt));
+		net_pkt_set_ipv6_next_hdr(seg, net_pkt_ipv6_next_hdr(pkt));
+	}
+
+	if (net_pkt_write(seg, hdr, hdr_len) || net_pkt_copy(seg, pkt, len)) {
+		net_pkt_unref(seg);
+		return NULL;
+	}
+
+	net_pkt_cursor_init(seg);
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(seg) == AF_INET) {
+		if (net_ipv4_finalize(seg, IPPROTO_TCP) < 0) {
+			net_pkt_unref(seg);
+			return NULL;
+		}
+	} else if (net_ipv6_finalize(seg, IPPROTO_TCP) < 0) {
+		net_pkt_unref(seg);
+		return NULL;
+	}
+
+	return seg;
+}
+
+/* Split a TCP segmentation offload packet in software, for drivers without
+ * ETHERNET_HW_TSO. The headers are read once and copied in front of each
+ * segment, only the sequence number, the flags, the lengths and the
+ * checksums differ between them.
+ */
+static int ethernet_gso_send(struct net_if *iface, struct net_pkt *pkt)
+{
+	uint8_t hdr[GSO_MAX_HDR_LEN];
+	struct net_tcp_hdr *tcp_hdr;
+	uint16_t mss = net_pkt_tso_mss(pkt);
+	size_t ip_len = net_pkt_ip_hdr_len(pkt) + net_pkt_ip_opts_len(pkt);
+	size_t hdr_len, len, offset;
+	uint32_t seq;
+	uint8_t flags;
+	int sent = 0;
+	int ret;
+
+	if (ip_len + sizeof(struct net_tcp_hdr) > sizeof(hdr)) {
+		return -EMSGSIZE;
+	}
+
+	net_pkt_cursor_init(pkt);
+	net_pkt_set_overwrite(pkt, true);
+
+	if (net_pkt_read(pkt, hdr, ip_len + sizeof(struct net_tcp_hdr))) {
+		return -ENOBUFS;
+	}
+
+	tcp_hdr = (struct net_tcp_hdr *)(hdr + ip_len);
+	hdr_len = ip_len + (tcp_hdr->offset >> 4) * 4U;
+
+	if (hdr_len > sizeof(hdr) || hdr_len < ip_len + sizeof(struct net_tcp_hdr)) {
+		return -EMSGSIZE;
+	}
+
+	if (net_pkt_read(pkt, hdr + ip_len + sizeof(struct net_tcp_hdr),
+			 hdr_len - ip_len - sizeof(struct net_tcp_hdr))) {
+		return -ENOBUFS;
+	}
+
+	len = net_pkt_get_len(pkt) - hdr_len;
+	seq = sys_get_be32(tcp_hdr->seq);
+	flags = tcp_hdr->flags;
+
+	for (offset = 0; offset < len; offset += mss) {
+		size_t seg_len = MIN(mss, len - offset);
+		struct net_pkt *seg;
+
+		sys_put_be32(seq + offset, tcp_hdr->seq);
+
+		/* Only the last segment pushes or closes */
+		if (offset + seg_len < len) {
+			tcp_hdr->flags = flags & ~(GSO_TCP_PSH | GSO_TCP_FIN);
+		} else {
+			tcp_hdr->flags = flags;
+		}
+
+		seg = ethernet_gso_segment(iface, pkt, hdr, hdr_len, seg_len);
+		if (!seg) {
+			NET_DBG("Cannot allocate segment %zu/%zu", offset, len);
+			return -ENOMEM;
+		}
+
+		ret = ethernet_send(iface, seg);
+		if (ret < 0) {
+			net_pkt_unref(seg);
+			return ret;
+		}
+
+		sent += ret;
+	}
+
+	net_pkt_unref(pkt);
+
+	return sent;
+}
+#endif /* CONFIG_NET_TCP_TSO */
+
 static int ethernet_send(struct net_if *iface, struct net_pkt *pkt)
 {
 	const struct ethernet_api *api = net_if_get_device(iface)->api;
@@ -686,6 +826,14 @@ static int ethernet_send(struct net_if *iface, struct net_pkt *pkt)
 		goto error;
 	}
 
+#if defined(CONFIG_NET_TCP_TSO)
+	if (net_pkt_tso_mss(pkt) > 0 &&
+	    (ptype == htons(NET_ETH_PTYPE_IP) || ptype == htons(NET_ETH_PTYPE_IPV6)) &&
+	    !(net_eth_get_hw_capabilities(iface) & ETHERNET_HW_TSO)) {
+		return ethernet_gso_send(iface, pkt);
+	}
+#endif
+
 	/* If the ll dst addr has not been set before, let's assume
 	 * temporarily it's a broadcast one. When filling the header,
 	 * it might detect this should be multicast and act accordingly.
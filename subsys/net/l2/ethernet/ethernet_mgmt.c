@@ -207,6 +207,14 @@ static int ethernet_set_config(uint32_t mgmt_request,
 
 		config.txinjection_mode = params->txinjection_mode;
 		type = ETHERNET_CONFIG_TYPE_TXINJECTION_MODE;
+	} else if (mgmt_request == NET_REQUEST_ETHERNET_SET_RX_COALESCE) {
+		if (!is_hw_caps_supported(dev, ETHERNET_RX_COALESCE)) {
+			return -ENOTSUP;
+		}
+
+		memcpy(&config.rx_coalesce, &params->rx_coalesce,
+		       sizeof(struct ethernet_rx_coalesce));
+		type = ETHERNET_CONFIG_TYPE_RX_COALESCE;
 	} else {
 		return -EINVAL;
 	}
@@ -247,6 +255,9 @@ NET_MGMT_REGISTER_REQUEST_HANDLER(NET_REQUEST_ETHERNET_SET_T1S_PARAM,
 NET_MGMT_REGISTER_REQUEST_HANDLER(NET_REQUEST_ETHERNET_SET_TXINJECTION_MODE,
 				  ethernet_set_config);
 
+NET_MGMT_REGISTER_REQUEST_HANDLER(NET_REQUEST_ETHERNET_SET_RX_COALESCE,
+				  ethernet_set_config);
+
 static int ethernet_get_config(uint32_t mgmt_request,
 			       struct net_if *iface,
 			       void *data, size_t len)
@@ -453,6 +464,20 @@ static int ethernet_get_config(uint32_t mgmt_request,
 		}
 
 		params->txinjection_mode = config.txinjection_mode;
+	} else if (mgmt_request == NET_REQUEST_ETHERNET_GET_RX_COALESCE) {
+		if (!is_hw_caps_supported(dev, ETHERNET_RX_COALESCE)) {
+			return -ENOTSUP;
+		}
+
+		type = ETHERNET_CONFIG_TYPE_RX_COALESCE;
+
+		ret = api->get_config(dev, type, &config);
+		if (ret) {
+			return ret;
+		}
+
+		memcpy(&params->rx_coalesce, &config.rx_coalesce,
+		       sizeof(struct ethernet_rx_coalesce));
 	} else {
 		return -EINVAL;
 	}
@@ -481,6 +506,9 @@ NET_MGMT_REGISTER_REQUEST_HANDLER(NET_REQUEST_ETHERNET_GET_TXTIME_PARAM,
 NET_MGMT_REGISTER_REQUEST_HANDLER(NET_REQUEST_ETHERNET_GET_TXINJECTION_MODE,
 				  ethernet_get_config);
 
+NET_MGMT_REGISTER_REQUEST_HANDLER(NET_REQUEST_ETHERNET_GET_RX_COALESCE,
+				  ethernet_get_config);
+
 void ethernet_mgmt_raise_carrier_on_event(struct net_if *iface)
 {
 	net_mgmt_event_notify(NET_EVENT_ETHERNET_CARRIER_ON, iface);
@@ -547,16 +547,24 @@ static int ieee802154_send(struct net_if *iface, struct net_pkt *pkt)
 		if (requires_fragmentation) {
 			pkt_buf = ieee802154_6lo_fragment(&frag_ctx, frame_buf, true);
 		} else {
-			net_buf_add_mem(frame_buf, pkt_buf->data, pkt_buf->len);
-			pkt_buf = pkt_buf->frags;
+			/* Header compression leaves the packet fragments as they
+			 * are, gather them all in the single frame.
+			 */
+			while (pkt_buf) {
+				net_buf_add_mem(frame_buf, pkt_buf->data, pkt_buf->len);
+				pkt_buf = pkt_buf->frags;
+			}
 		}
 #else
-		if (ll_hdr_len + pkt_buf->len + authtag_len > IEEE802154_MTU) {
-			NET_ERR("Frame too long: %d", pkt_buf->len);
+		if (ll_hdr_len + net_pkt_get_len(pkt) + authtag_len > IEEE802154_MTU) {
+			NET_ERR("Frame too long: %zu", net_pkt_get_len(pkt));
 			return -EINVAL;
 		}
-		net_buf_add_mem(frame_buf, pkt_buf->data, pkt_buf->len);
-		pkt_buf = pkt_buf->frags;
+
+		while (pkt_buf) {
+			net_buf_add_mem(frame_buf, pkt_buf->data, pkt_buf->len);
+			pkt_buf = pkt_buf->frags;
+		}
 #endif /* CONFIG_NET_L2_IEEE802154_FRAGMENT */
 
 		__ASSERT_NO_MSG(authtag_len <= net_buf_tailroom(frame_buf));
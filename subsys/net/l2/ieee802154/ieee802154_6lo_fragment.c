@@ -18,6 +18,7 @@ LOG_MODULE_REGISTER(net_ieee802154_6lo_fragment, CONFIG_NET_L2_IEEE802154_LOG_LE
 #include "net_private.h"
 
 #include <errno.h>
+#include <string.h>
 
 #include <zephyr/net/net_core.h>
 #include <zephyr/net/net_if.h>
@@ -35,17 +36,27 @@ LOG_MODULE_REGISTER(net_ieee802154_6lo_fragment, CONFIG_NET_L2_IEEE802154_LOG_LE
 
 /**
  *  Reassemble cache : Depends on cache size it used for reassemble
- *  IPv6 packets simultaneously.
+ *  IPv6 packets simultaneously. Caches in use are looked up through
+ *  a hash table on datagram size, tag and link layer source address.
  */
 struct frag_cache {
+	sys_snode_t node;	       /* Hash bucket node */
 	struct k_work_delayable timer; /* Reassemble timer */
 	struct net_pkt *pkt;	       /* Reassemble packet */
 	uint16_t size;		       /* Datagram size */
 	uint16_t tag;		       /* Datagram tag */
+	uint16_t received;	       /* Payload received so far */
+	int hdr_diff;		       /* Uncompressed headers size difference */
+	uint8_t src[NET_LINK_ADDR_MAX_LENGTH]; /* Link layer source address */
+	uint8_t src_len;
+	uint8_t bucket;
+	bool first_received;
 	bool used;
 };
 
 static struct frag_cache cache[REASS_CACHE_SIZE];
+static sys_slist_t cache_buckets[REASS_CACHE_SIZE];
+static K_MUTEX_DEFINE(cache_lock);
 
 /**
  *  RFC 4944, section 5.3
@@ -256,25 +267,33 @@ static void update_protocol_header_lengths(struct net_pkt *pkt, uint16_t size)
 	}
 }
 
-static inline void clear_reass_cache(uint16_t size, uint16_t tag)
+static inline uint8_t reass_cache_bucket(uint16_t size, uint16_t tag,
+					 const struct net_linkaddr *src)
 {
-	uint8_t i;
+	uint16_t hash = size ^ tag;
 
-	for (i = 0U; i < REASS_CACHE_SIZE; i++) {
-		if (!(cache[i].size == size && cache[i].tag == tag)) {
-			continue;
-		}
+	if (src->addr != NULL && src->len > 0) {
+		hash ^= src->addr[src->len - 1];
+	}
 
-		if (cache[i].pkt) {
-			net_pkt_unref(cache[i].pkt);
-		}
+	return hash % REASS_CACHE_SIZE;
+}
 
-		cache[i].pkt = NULL;
-		cache[i].size = 0U;
-		cache[i].tag = 0U;
-		cache[i].used = false;
-		k_work_cancel_delayable(&cache[i].timer);
+static inline void clear_reass_cache(struct frag_cache *fcache)
+{
+	if (fcache->pkt) {
+		net_pkt_unref(fcache->pkt);
 	}
+
+	if (fcache->used) {
+		sys_slist_find_and_remove(&cache_buckets[fcache->bucket], &fcache->node);
+	}
+
+	fcache->pkt = NULL;
+	fcache->size = 0U;
+	fcache->tag = 0U;
+	fcache->used = false;
+	k_work_cancel_delayable(&fcache->timer);
 }
 
 /**
@@ -286,14 +305,14 @@ static void reass_timeout(struct k_work *work)
 	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
 	struct frag_cache *fcache = CONTAINER_OF(dwork, struct frag_cache, timer);
 
-	if (fcache->pkt) {
-		net_pkt_unref(fcache->pkt);
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	/* The cache may have been reused while waiting for the lock */
+	if (!k_work_delayable_is_pending(dwork)) {
+		clear_reass_cache(fcache);
 	}
 
-	fcache->pkt = NULL;
-	fcache->size = 0U;
-	fcache->tag = 0U;
-	fcache->used = false;
+	k_mutex_unlock(&cache_lock);
 }
 
 /**
@@ -303,6 +322,7 @@ static void reass_timeout(struct k_work *work)
  */
 static inline struct frag_cache *set_reass_cache(struct net_pkt *pkt, uint16_t size, uint16_t tag)
 {
+	struct net_linkaddr *src = net_pkt_lladdr_src(pkt);
 	int i;
 
 	for (i = 0; i < REASS_CACHE_SIZE; i++) {
@@ -313,8 +333,19 @@ static inline struct frag_cache *set_reass_cache(struct net_pkt *pkt, uint16_t s
 		cache[i].pkt = pkt;
 		cache[i].size = size;
 		cache[i].tag = tag;
+		cache[i].received = 0U;
+		cache[i].first_received = false;
+		cache[i].src_len = 0U;
 		cache[i].used = true;
 
+		if (src->addr != NULL && src->len <= sizeof(cache[i].src)) {
+			memcpy(cache[i].src, src->addr, src->len);
+			cache[i].src_len = src->len;
+		}
+
+		cache[i].bucket = reass_cache_bucket(size, tag, src);
+		sys_slist_append(&cache_buckets[cache[i].bucket], &cache[i].node);
+
 		k_work_init_delayable(&cache[i].timer, reass_timeout);
 		k_work_reschedule(&cache[i].timer, FRAG_REASSEMBLY_TIMEOUT);
 		return &cache[i];
@@ -324,106 +355,90 @@ static inline struct frag_cache *set_reass_cache(struct net_pkt *pkt, uint16_t s
 }
 
 /**
- *  Return cache if it matches with size and tag of stored caches,
+ *  Return cache if it matches with size, tag and source of stored caches,
  *  otherwise return NULL.
  */
-static inline struct frag_cache *get_reass_cache(uint16_t size, uint16_t tag)
+static inline struct frag_cache *get_reass_cache(struct net_pkt *pkt, uint16_t size, uint16_t tag)
 {
-	uint8_t i;
+	struct net_linkaddr *src = net_pkt_lladdr_src(pkt);
+	uint8_t src_len = (src->addr != NULL) ? src->len : 0U;
+	struct frag_cache *fcache;
 
-	for (i = 0U; i < REASS_CACHE_SIZE; i++) {
-		if (cache[i].used) {
-			if (cache[i].size == size && cache[i].tag == tag) {
-				return &cache[i];
-			}
+	SYS_SLIST_FOR_EACH_CONTAINER(&cache_buckets[reass_cache_bucket(size, tag, src)],
+				     fcache, node) {
+		if (fcache->size == size && fcache->tag == tag &&
+		    fcache->src_len == src_len &&
+		    (src_len == 0U || memcmp(fcache->src, src->addr, src_len) == 0)) {
+			return fcache;
 		}
 	}
 
 	return NULL;
 }
 
-static inline void fragment_append(struct net_pkt *pkt, struct net_buf *frag)
+static inline uint16_t fragment_offset(struct net_buf *frag)
 {
 	if (get_datagram_type(frag->data) == NET_6LO_DISPATCH_FRAG1) {
-		/* Always make sure first fragment is inserted first
-		 * This will be useful for fragment_cached_pkt_len()
-		 */
-		frag->frags = pkt->buffer;
-		pkt->buffer = frag;
-	} else {
-		net_pkt_append_buffer(pkt, frag);
+		return 0;
 	}
+
+	return ((uint16_t)frag->data[NET_FRAG_OFFSET_POS] << 3);
 }
 
-static inline size_t fragment_cached_pkt_len(struct net_pkt *pkt)
+/**
+ *  Insert the fragment in the chain of the cached packet, ordered by offset, so
+ *  the first fragment comes first and the chain can be used as it is once all
+ *  fragments are received. Also account for the received payload.
+ */
+static inline void fragment_append(struct frag_cache *fcache, struct net_buf *frag)
 {
-	size_t len = 0U;
-	struct net_buf *frag;
-	int hdr_diff;
+	struct net_pkt *pkt = fcache->pkt;
+	struct net_buf *prev = NULL;
+	struct net_buf *current = pkt->buffer;
+	uint16_t offset = fragment_offset(frag);
+	uint16_t frag_hdr_len = NET_6LO_FRAGN_HDR_LEN;
 	uint8_t *data;
 
-	frag = pkt->buffer;
-	while (frag) {
-		uint16_t frag_hdr_len = NET_6LO_FRAGN_HDR_LEN;
-
-		if (get_datagram_type(frag->data) == NET_6LO_DISPATCH_FRAG1) {
-			frag_hdr_len = NET_6LO_FRAG1_HDR_LEN;
-		}
+	while (current && fragment_offset(current) <= offset) {
+		prev = current;
+		current = current->frags;
+	}
 
-		len += frag->len - frag_hdr_len;
+	frag->frags = current;
 
-		frag = frag->frags;
+	if (prev) {
+		prev->frags = frag;
+	} else {
+		pkt->buffer = frag;
 	}
 
-	/* 6lo assumes that fragment header has been removed,
-	 * and in our side we assume first buffer is always the first fragment.
-	 */
-	data = pkt->buffer->data;
-	pkt->buffer->data += NET_6LO_FRAG1_HDR_LEN;
+	if (get_datagram_type(frag->data) == NET_6LO_DISPATCH_FRAG1) {
+		frag_hdr_len = NET_6LO_FRAG1_HDR_LEN;
 
-	hdr_diff = net_6lo_uncompress_hdr_diff(pkt);
+		/* 6lo assumes that fragment header has been removed */
+		data = frag->data;
+		frag->data += NET_6LO_FRAG1_HDR_LEN;
 
-	pkt->buffer->data = data;
+		fcache->hdr_diff = net_6lo_uncompress_hdr_diff(pkt);
+		fcache->first_received = true;
 
-	if (hdr_diff == INT_MAX) {
-		return 0;
+		frag->data = data;
 	}
 
-	return len + hdr_diff;
+	fcache->received += frag->len - frag_hdr_len;
 }
 
-static inline uint16_t fragment_offset(struct net_buf *frag)
+static inline bool fragment_complete(struct frag_cache *fcache)
 {
-	if (get_datagram_type(frag->data) == NET_6LO_DISPATCH_FRAG1) {
-		return 0;
+	if (!fcache->first_received || fcache->hdr_diff == INT_MAX) {
+		return false;
 	}
 
-	return ((uint16_t)frag->data[NET_FRAG_OFFSET_POS] << 3);
+	return (fcache->received + fcache->hdr_diff) == fcache->size;
 }
 
-static void fragment_move_back(struct net_pkt *pkt, struct net_buf *frag, struct net_buf *stop)
-{
-	struct net_buf *prev, *current;
-
-	prev = NULL;
-	current = pkt->buffer;
-
-	while (current && current != stop) {
-		if (fragment_offset(frag) < fragment_offset(current)) {
-			if (prev) {
-				prev->frags = frag;
-			}
-
-			frag->frags = current;
-			break;
-		}
-
-		prev = current;
-		current = current->frags;
-	}
-}
-
-static inline void fragment_remove_headers(struct net_pkt *pkt)
+/* The fragments are in order, only the fragmentation headers are left to remove */
+static inline void fragment_reconstruct_packet(struct net_pkt *pkt)
 {
 	struct net_buf *frag;
 
@@ -435,36 +450,12 @@ static inline void fragment_remove_headers(struct net_pkt *pkt)
 			frag_hdr_len = NET_6LO_FRAG1_HDR_LEN;
 		}
 
-		memmove(frag->data, frag->data + frag_hdr_len, frag->len - frag_hdr_len);
-		frag->len -= frag_hdr_len;
+		net_buf_pull(frag, frag_hdr_len);
 
 		frag = frag->frags;
 	}
 }
 
-static inline void fragment_reconstruct_packet(struct net_pkt *pkt)
-{
-	struct net_buf *prev, *current, *next;
-
-	prev = NULL;
-	current = pkt->buffer;
-
-	while (current) {
-		next = current->frags;
-
-		if (!prev || (fragment_offset(prev) > fragment_offset(current))) {
-			prev = current;
-		} else {
-			fragment_move_back(pkt, current, prev);
-		}
-
-		current = next;
-	}
-
-	/* Let's remove now useless fragmentation headers */
-	fragment_remove_headers(pkt);
-}
-
 static inline bool fragment_packet_valid(struct net_pkt *pkt)
 {
 	return (get_datagram_type(pkt->buffer->data) == NET_6LO_DISPATCH_FRAG1);
@@ -506,10 +497,13 @@ static inline enum net_verdict fragment_add_to_cache(struct net_pkt *pkt)
 	 */
 	pkt->buffer = NULL;
 
-	fcache = get_reass_cache(size, tag);
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	fcache = get_reass_cache(pkt, size, tag);
 	if (!fcache) {
 		fcache = set_reass_cache(pkt, size, tag);
 		if (!fcache) {
+			k_mutex_unlock(&cache_lock);
 			NET_ERR("Could not get a cache entry");
 			pkt->buffer = frag;
 			return NET_DROP;
@@ -518,9 +512,9 @@ static inline enum net_verdict fragment_add_to_cache(struct net_pkt *pkt)
 		first_frag = true;
 	}
 
-	fragment_append(fcache->pkt, frag);
+	fragment_append(fcache, frag);
 
-	if (fragment_cached_pkt_len(fcache->pkt) == fcache->size) {
+	if (fragment_complete(fcache)) {
 		if (!first_frag) {
 			/* Assign buffer back to input packet. */
 			pkt->buffer = fcache->pkt->buffer;
@@ -532,7 +526,8 @@ static inline enum net_verdict fragment_add_to_cache(struct net_pkt *pkt)
 			fcache->pkt = NULL;
 		}
 
-		clear_reass_cache(size, tag);
+		clear_reass_cache(fcache);
+		k_mutex_unlock(&cache_lock);
 
 		if (!fragment_packet_valid(pkt)) {
 			NET_ERR("Invalid fragmented packet");
@@ -557,6 +552,8 @@ static inline enum net_verdict fragment_add_to_cache(struct net_pkt *pkt)
 		return NET_CONTINUE;
 	}
 
+	k_mutex_unlock(&cache_lock);
+
 	/* Unref Rx part of original packet */
 	if (!first_frag) {
 		net_pkt_unref(pkt);
@@ -512,6 +512,10 @@ void net_capture_pkt(struct net_if *iface, struct net_pkt *pkt)
 		return;
 	}
 
+#if defined(CONFIG_NET_CAPTURE_RING)
+	net_capture_ring_pkt(iface, pkt);
+#endif
+
 	k_mutex_lock(&lock, K_FOREVER);
 
 	SYS_SLIST_FOR_EACH_NODE_SAFE(&net_capture_devlist, sn, sns) {
@@ -0,0 +1,305 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_capture, CONFIG_NET_CAPTURE_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/ring_buffer.h>
+#include <zephyr/net/net_core.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/net/capture.h>
+
+#if defined(CONFIG_NET_CAPTURE_RING_UART)
+#include <zephyr/drivers/uart.h>
+#endif
+
+/* pcapng block types and link types, see draft-ietf-opsawg-pcapng */
+#define PCAPNG_SHB_TYPE 0x0a0d0d0a
+#define PCAPNG_IDB_TYPE 0x00000001
+#define PCAPNG_EPB_TYPE 0x00000006
+#define PCAPNG_BYTE_ORDER_MAGIC 0x1a2b3c4d
+
+#define LINKTYPE_ETHERNET 1
+#define LINKTYPE_RAW 101
+#define LINKTYPE_IEEE802_15_4_NOFCS 230
+
+struct pcapng_shb {
+	uint32_t type;
+	uint32_t len;
+	uint32_t magic;
+	uint16_t major;
+	uint16_t minor;
+	int64_t section_len;
+	uint32_t trailer_len;
+} __packed;
+
+struct pcapng_idb {
+	uint32_t type;
+	uint32_t len;
+	uint16_t link_type;
+	uint16_t reserved;
+	uint32_t snaplen;
+	uint32_t trailer_len;
+} __packed;
+
+/* Followed by the padded packet data and the block length */
+struct pcapng_epb {
+	uint32_t type;
+	uint32_t len;
+	uint32_t iface_id;
+	uint32_t ts_high;
+	uint32_t ts_low;
+	uint32_t cap_len;
+	uint32_t orig_len;
+} __packed;
+
+RING_BUF_DECLARE(capture_ring, CONFIG_NET_CAPTURE_RING_SIZE);
+static K_SEM_DEFINE(capture_ring_sem, 0, 1);
+
+/* Serializes the producers, the consumer does not need to take it */
+static struct k_spinlock capture_ring_lock;
+static struct net_if *capture_ring_iface;
+static uint32_t capture_ring_snaplen;
+static struct net_capture_ring_stats capture_ring_stats;
+
+static uint16_t link_type(struct net_if *iface)
+{
+#if defined(CONFIG_NET_L2_ETHERNET)
+	if (net_if_l2(iface) == &NET_L2_GET_NAME(ETHERNET)) {
+		return LINKTYPE_ETHERNET;
+	}
+#endif
+#if defined(CONFIG_NET_L2_IEEE802154)
+	if (net_if_l2(iface) == &NET_L2_GET_NAME(IEEE802154)) {
+		return LINKTYPE_IEEE802_15_4_NOFCS;
+	}
+#endif
+
+	/* Other technologies pass IP packets to the capture */
+	return LINKTYPE_RAW;
+}
+
+void net_capture_ring_pkt(struct net_if *iface, struct net_pkt *pkt)
+{
+	static const uint8_t padding[sizeof(uint32_t)];
+	struct pcapng_epb epb;
+	k_spinlock_key_t key;
+	struct net_buf *buf;
+	uint32_t block_len;
+	uint32_t cap_len;
+	uint32_t left;
+	uint64_t ts;
+
+	/* Cheap check without the lock for the packets of other interfaces */
+	if (capture_ring_iface != iface) {
+		return;
+	}
+
+	ts = k_ticks_to_us_floor64(k_uptime_ticks());
+
+	key = k_spin_lock(&capture_ring_lock);
+
+	if (capture_ring_iface != iface) {
+		goto out;
+	}
+
+	epb.orig_len = net_pkt_get_len(pkt);
+	cap_len = MIN(epb.orig_len, capture_ring_snaplen);
+	block_len = sizeof(epb) + ROUND_UP(cap_len, sizeof(uint32_t)) +
+		    sizeof(block_len);
+
+	if (ring_buf_space_get(&capture_ring) < block_len) {
+		/* Never wait for the consumer, rather lose the packet */
+		capture_ring_stats.dropped++;
+		goto out;
+	}
+
+	epb.type = PCAPNG_EPB_TYPE;
+	epb.len = block_len;
+	epb.iface_id = 0U;
+	epb.ts_high = (uint32_t)(ts >> 32);
+	epb.ts_low = (uint32_t)ts;
+	epb.cap_len = cap_len;
+
+	ring_buf_put(&capture_ring, (uint8_t *)&epb, sizeof(epb));
+
+	left = cap_len;
+	for (buf = pkt->buffer; buf != NULL && left > 0; buf = buf->frags) {
+		uint32_t len = MIN(left, buf->len);
+
+		ring_buf_put(&capture_ring, buf->data, len);
+		left -= len;
+	}
+
+	ring_buf_put(&capture_ring, padding,
+		     ROUND_UP(cap_len, sizeof(uint32_t)) - cap_len);
+	ring_buf_put(&capture_ring, (uint8_t *)&block_len, sizeof(block_len));
+
+	capture_ring_stats.captured++;
+	capture_ring_stats.bytes += block_len;
+
+	k_spin_unlock(&capture_ring_lock, key);
+
+	k_sem_give(&capture_ring_sem);
+	return;
+
+out:
+	k_spin_unlock(&capture_ring_lock, key);
+}
+
+int net_capture_ring_enable(struct net_if *iface, uint32_t snaplen)
+{
+	struct pcapng_shb shb = {
+		.type = PCAPNG_SHB_TYPE,
+		.len = sizeof(shb),
+		.magic = PCAPNG_BYTE_ORDER_MAGIC,
+		.major = 1U,
+		.minor = 0U,
+		.section_len = -1,
+		.trailer_len = sizeof(shb),
+	};
+	struct pcapng_idb idb = {
+		.type = PCAPNG_IDB_TYPE,
+		.len = sizeof(idb),
+		.trailer_len = sizeof(idb),
+	};
+	k_spinlock_key_t key;
+	int ret = 0;
+
+	if (iface == NULL) {
+		return -EINVAL;
+	}
+
+	if (snaplen == 0U) {
+		snaplen = CONFIG_NET_CAPTURE_RING_SNAPLEN;
+	}
+
+	idb.link_type = link_type(iface);
+	idb.snaplen = snaplen;
+
+	key = k_spin_lock(&capture_ring_lock);
+
+	if (capture_ring_iface != NULL) {
+		ret = -EALREADY;
+		goto out;
+	}
+
+	/* Every enable starts a new section, so the stream stays valid
+	 * pcapng whatever the consumer read before.
+	 */
+	if (ring_buf_space_get(&capture_ring) < sizeof(shb) + sizeof(idb)) {
+		ret = -ENOMEM;
+		goto out;
+	}
+
+	ring_buf_put(&capture_ring, (uint8_t *)&shb, sizeof(shb));
+	ring_buf_put(&capture_ring, (uint8_t *)&idb, sizeof(idb));
+
+	capture_ring_snaplen = snaplen;
+	capture_ring_iface = iface;
+
+out:
+	k_spin_unlock(&capture_ring_lock, key);
+
+	if (ret == 0) {
+		k_sem_give(&capture_ring_sem);
+
+		NET_DBG("Capturing iface %d to ring, snaplen %u",
+			net_if_get_by_iface(iface), snaplen);
+	}
+
+	return ret;
+}
+
+int net_capture_ring_disable(void)
+{
+	k_spinlock_key_t key;
+	int ret = 0;
+
+	key = k_spin_lock(&capture_ring_lock);
+
+	if (capture_ring_iface == NULL) {
+		ret = -EALREADY;
+	}
+
+	capture_ring_iface = NULL;
+
+	k_spin_unlock(&capture_ring_lock, key);
+
+	return ret;
+}
+
+struct net_if *net_capture_ring_iface(void)
+{
+	return capture_ring_iface;
+}
+
+uint32_t net_capture_ring_claim(uint8_t **data, uint32_t size,
+				k_timeout_t timeout)
+{
+	uint32_t len;
+
+	len = ring_buf_get_claim(&capture_ring, data, size);
+	if (len > 0U) {
+		return len;
+	}
+
+	if (k_sem_take(&capture_ring_sem, timeout) < 0) {
+		return 0U;
+	}
+
+	return ring_buf_get_claim(&capture_ring, data, size);
+}
+
+int net_capture_ring_finish(uint32_t size)
+{
+	return ring_buf_get_finish(&capture_ring, size);
+}
+
+void net_capture_ring_stats_get(struct net_capture_ring_stats *stats)
+{
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&capture_ring_lock);
+	*stats = capture_ring_stats;
+	k_spin_unlock(&capture_ring_lock, key);
+}
+
+#if defined(CONFIG_NET_CAPTURE_RING_UART)
+static const struct device *const capture_uart =
+	DEVICE_DT_GET(DT_CHOSEN(zephyr_net_capture_uart));
+
+static void capture_uart_thread(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	if (!device_is_ready(capture_uart)) {
+		NET_ERR("Capture UART %s not ready", capture_uart->name);
+		return;
+	}
+
+	while (true) {
+		uint8_t *data;
+		uint32_t len;
+
+		len = net_capture_ring_claim(&data, UINT32_MAX, K_FOREVER);
+
+		for (uint32_t i = 0; i < len; i++) {
+			uart_poll_out(capture_uart, data[i]);
+		}
+
+		(void)net_capture_ring_finish(len);
+	}
+}
+
+K_THREAD_DEFINE(net_capture_uart, CONFIG_NET_CAPTURE_RING_UART_STACK_SIZE,
+		capture_uart_thread, NULL, NULL, NULL,
+		K_LOWEST_APPLICATION_THREAD_PRIO, 0, 0);
+#endif /* CONFIG_NET_CAPTURE_RING_UART */
@@ -60,6 +60,11 @@ static void reset_internal_request(struct coap_client_internal_request *request)
 	request->offset = 0;
 	request->last_id = 0;
 	reset_block_contexts(request);
+#if defined(CONFIG_COAP_CLIENT_BLOCK2_PREFETCH)
+	for (int i = 0; i < CONFIG_COAP_CLIENT_BLOCK2_WINDOW; i++) {
+		request->prefetch[i].ongoing = false;
+	}
+#endif
 }
 
 static int coap_client_schedule_poll(struct coap_client *client, int sock,
@@ -190,6 +195,18 @@ static int coap_client_init_request(struct coap_client *client,
 		}
 	}
 
+#if defined(CONFIG_COAP_CLIENT_BLOCK2_PREFETCH)
+	/* Ask for the size of the resource, needed to request blocks ahead */
+	if (req->method == COAP_METHOD_GET && internal_req->recv_blk_ctx.current == 0) {
+		ret = coap_append_option_int(&internal_req->request, COAP_OPTION_SIZE2, 0);
+
+		if (ret < 0) {
+			LOG_ERR("Failed to append size2 option");
+			goto out;
+		}
+	}
+#endif
+
 	/* Add extra options if any */
 	for (i = 0; i < req->num_options; i++) {
 		ret = coap_packet_append_option(&internal_req->request, req->options[i].code,
@@ -377,6 +394,204 @@ out:
 	return ret;
 }
 
+#if defined(CONFIG_COAP_CLIENT_BLOCK2_PREFETCH)
+static struct coap_client_block2_request *
+block2_prefetch_find(struct coap_client_internal_request *internal_req, size_t current)
+{
+	for (int i = 0; i < CONFIG_COAP_CLIENT_BLOCK2_WINDOW; i++) {
+		if (internal_req->prefetch[i].ongoing &&
+		    internal_req->prefetch[i].current == current) {
+			return &internal_req->prefetch[i];
+		}
+	}
+
+	return NULL;
+}
+
+/* Send the request for a block ahead. The request is built from the state of the
+ * transfer, with the token, message id and block number of the prefetch slot.
+ * Must be called with the send mutex held.
+ */
+static int block2_prefetch_send(struct coap_client *client,
+				struct coap_client_internal_request *internal_req,
+				struct coap_client_block2_request *blk, bool init_pending)
+{
+	uint8_t token[COAP_TOKEN_MAX_LEN];
+	uint32_t last_id = internal_req->last_id;
+	size_t current = internal_req->recv_blk_ctx.current;
+	int ret;
+
+	memcpy(token, internal_req->request_token, sizeof(token));
+	memcpy(internal_req->request_token, blk->token, sizeof(token));
+	internal_req->last_id = blk->id;
+	internal_req->recv_blk_ctx.current = blk->current;
+
+	ret = coap_client_init_request(client, &internal_req->coap_request, internal_req, true);
+	if (ret < 0) {
+		LOG_ERR("Error creating a CoAP request");
+		goto out;
+	}
+
+	if (init_pending) {
+		struct coap_transmission_parameters params = internal_req->pending.params;
+
+		ret = coap_pending_init(&blk->pending, &internal_req->request, &client->address,
+					&params);
+		if (ret < 0) {
+			LOG_ERR("Error creating pending");
+			goto out;
+		}
+
+		coap_pending_cycle(&blk->pending);
+	}
+
+	ret = send_request(client->fd, internal_req->request.data, internal_req->request.offset,
+			   0, &client->address, client->socklen);
+	if (ret < 0) {
+		LOG_ERR("Error sending a CoAP request");
+	} else {
+		ret = 0;
+	}
+
+out:
+	memcpy(internal_req->request_token, token, sizeof(token));
+	internal_req->last_id = last_id;
+	internal_req->recv_blk_ctx.current = current;
+
+	return ret;
+}
+
+/* Request the blocks following the one the transfer waits for, up to the window size
+ * and the size of the resource. Must be called with the send mutex held.
+ */
+static void block2_prefetch_fill(struct coap_client *client,
+				 struct coap_client_internal_request *internal_req)
+{
+	struct coap_block_context *ctx = &internal_req->recv_blk_ctx;
+	size_t block_size = coap_block_size_to_bytes(ctx->block_size);
+	size_t current = ctx->current;
+
+	if (!internal_req->coap_request.confirmable || ctx->total_size == 0) {
+		return;
+	}
+
+	for (int n = 0; n < CONFIG_COAP_CLIENT_BLOCK2_WINDOW; n++) {
+		struct coap_client_block2_request *blk = NULL;
+
+		current += block_size;
+		if (current >= ctx->total_size) {
+			break;
+		}
+
+		if (block2_prefetch_find(internal_req, current) != NULL) {
+			continue;
+		}
+
+		for (int i = 0; i < CONFIG_COAP_CLIENT_BLOCK2_WINDOW; i++) {
+			if (!internal_req->prefetch[i].ongoing) {
+				blk = &internal_req->prefetch[i];
+				break;
+			}
+		}
+
+		if (blk == NULL) {
+			break;
+		}
+
+		memcpy(blk->token, coap_next_token(), sizeof(blk->token));
+		blk->id = coap_next_id();
+		blk->current = current;
+		blk->answered = false;
+		blk->ongoing = true;
+
+		if (block2_prefetch_send(client, internal_req, blk, true) < 0) {
+			blk->ongoing = false;
+			break;
+		}
+
+		LOG_DBG("Requested block at %zu ahead", current);
+	}
+}
+
+/* Make the prefetch slot of the next block the request the transfer waits for.
+ * Returns 1 if there was one, 0 if the next block must be requested.
+ * Must be called with the send mutex held.
+ */
+static int block2_prefetch_promote(struct coap_client *client,
+				   struct coap_client_internal_request *internal_req)
+{
+	struct coap_client_block2_request *blk;
+	struct coap_transmission_parameters params;
+	int ret;
+
+	blk = block2_prefetch_find(internal_req, internal_req->recv_blk_ctx.current);
+	if (blk == NULL) {
+		return 0;
+	}
+
+	memcpy(internal_req->request_token, blk->token, sizeof(blk->token));
+	internal_req->last_id = blk->id;
+	blk->ongoing = false;
+
+	if (!blk->answered) {
+		internal_req->pending = blk->pending;
+		return 1;
+	}
+
+	/* The response came ahead of the previous block and was dropped, ask again */
+	ret = coap_client_init_request(client, &internal_req->coap_request, internal_req, true);
+	if (ret < 0) {
+		LOG_ERR("Error creating a CoAP request");
+		return ret;
+	}
+
+	params = internal_req->pending.params;
+	ret = coap_pending_init(&internal_req->pending, &internal_req->request, &client->address,
+				&params);
+	if (ret < 0) {
+		LOG_ERR("Error creating pending");
+		return ret;
+	}
+
+	coap_pending_cycle(&internal_req->pending);
+
+	ret = send_request(client->fd, internal_req->request.data, internal_req->request.offset,
+			   0, &client->address, client->socklen);
+	if (ret < 0) {
+		LOG_ERR("Error sending a CoAP request");
+		return ret;
+	}
+
+	return 1;
+}
+
+static void block2_prefetch_resend(struct coap_client *client,
+				   struct coap_client_internal_request *internal_req)
+{
+	if (!internal_req->request_ongoing) {
+		return;
+	}
+
+	for (int i = 0; i < CONFIG_COAP_CLIENT_BLOCK2_WINDOW; i++) {
+		struct coap_client_block2_request *blk = &internal_req->prefetch[i];
+
+		if (!blk->ongoing || blk->pending.timeout == 0 ||
+		    blk->pending.timeout > (k_uptime_get() - blk->pending.t0)) {
+			continue;
+		}
+
+		if (coap_pending_cycle(&blk->pending)) {
+			k_mutex_lock(&client->send_mutex, K_FOREVER);
+			(void)block2_prefetch_send(client, internal_req, blk, false);
+			k_mutex_unlock(&client->send_mutex);
+		} else {
+			/* Give up, the block is requested again once it is the next one */
+			blk->ongoing = false;
+		}
+	}
+}
+#endif /* CONFIG_COAP_CLIENT_BLOCK2_PREFETCH */
+
 static void report_callback_error(struct coap_client_internal_request *internal_req, int error_code)
 {
 	if (internal_req->coap_request.cb) {
@@ -442,6 +657,9 @@ static int coap_client_resend_handler(void)
 			if (timeout_expired(&clients[i]->requests[j])) {
 				ret = resend_request(clients[i], &clients[i]->requests[j]);
 			}
+#if defined(CONFIG_COAP_CLIENT_BLOCK2_PREFETCH)
+			block2_prefetch_resend(clients[i], &clients[i]->requests[j]);
+#endif
 		}
 	}
 
@@ -612,6 +830,73 @@ static bool find_echo_option(const struct coap_packet *response, struct coap_opt
 	return coap_find_options(response, COAP_OPTION_ECHO, option, 1);
 }
 
+#if defined(CONFIG_COAP_CLIENT_BLOCK2_PREFETCH)
+/* Handle a response to a block requested ahead. Returns -ENOENT if the response
+ * does not match any of them.
+ */
+static int block2_prefetch_response(struct coap_client *client,
+				    const struct coap_packet *response)
+{
+	uint8_t response_token[COAP_TOKEN_MAX_LEN];
+	struct coap_client_block2_request *blk = NULL;
+	uint8_t response_tkl;
+	int response_type;
+
+	response_tkl = coap_header_get_token(response, response_token);
+	if (response_tkl != COAP_TOKEN_MAX_LEN) {
+		return -ENOENT;
+	}
+
+	for (int i = 0; i < CONFIG_COAP_CLIENT_MAX_REQUESTS && blk == NULL; i++) {
+		struct coap_client_internal_request *internal_req = &client->requests[i];
+
+		if (!internal_req->request_ongoing) {
+			continue;
+		}
+
+		for (int j = 0; j < CONFIG_COAP_CLIENT_BLOCK2_WINDOW; j++) {
+			if (internal_req->prefetch[j].ongoing &&
+			    memcmp(internal_req->prefetch[j].token, response_token,
+				   response_tkl) == 0) {
+				blk = &internal_req->prefetch[j];
+				break;
+			}
+		}
+	}
+
+	if (blk == NULL) {
+		return -ENOENT;
+	}
+
+	response_type = coap_header_get_type(response);
+
+	if (response_type == COAP_TYPE_RESET) {
+		blk->ongoing = false;
+		return 1;
+	}
+
+	/* Separate response coming */
+	if (response_type == COAP_TYPE_ACK &&
+	    coap_header_get_code(response) == COAP_CODE_EMPTY) {
+		blk->pending.t0 = k_uptime_get();
+		blk->pending.timeout = blk->pending.t0 + COAP_SEPARATE_TIMEOUT;
+		blk->pending.retries = 0;
+		return 1;
+	}
+
+	if (response_type == COAP_TYPE_CON) {
+		(void)send_ack(client, response, COAP_CODE_EMPTY);
+	}
+
+	/* Blocks are delivered in order, this one is requested again when it is next */
+	LOG_DBG("Block at %zu received ahead, dropped", blk->current);
+	coap_pending_clear(&blk->pending);
+	blk->answered = true;
+
+	return 1;
+}
+#endif /* CONFIG_COAP_CLIENT_BLOCK2_PREFETCH */
+
 static int handle_response(struct coap_client *client, const struct coap_packet *response)
 {
 	int ret = 0;
@@ -631,6 +916,16 @@ static int handle_response(struct coap_client *client, const struct coap_packet
 	response_type = coap_header_get_type(response);
 
 	internal_req = get_request_with_token(client, response);
+#if defined(CONFIG_COAP_CLIENT_BLOCK2_PREFETCH)
+	if (internal_req == NULL) {
+		ret = block2_prefetch_response(client, response);
+		if (ret != -ENOENT) {
+			return ret;
+		}
+
+		ret = 0;
+	}
+#endif
 	/* Reset and Ack need to match the message ID with request */
 	if ((response_type == COAP_TYPE_ACK || response_type == COAP_TYPE_RESET) &&
 	     internal_req == NULL)  {
@@ -778,6 +1073,19 @@ static int handle_response(struct coap_client *client, const struct coap_packet
 	/* If this wasn't last block, send the next request */
 	if (blockwise_transfer && !last_block) {
 		k_mutex_lock(&client->send_mutex, K_FOREVER);
+#if defined(CONFIG_COAP_CLIENT_BLOCK2_PREFETCH)
+		if (internal_req->send_blk_ctx.total_size == 0) {
+			ret = block2_prefetch_promote(client, internal_req);
+			if (ret < 0) {
+				k_mutex_unlock(&client->send_mutex);
+				goto fail;
+			} else if (ret > 0) {
+				block2_prefetch_fill(client, internal_req);
+				k_mutex_unlock(&client->send_mutex);
+				return 1;
+			}
+		}
+#endif
 		ret = coap_client_init_request(client, &internal_req->coap_request, internal_req,
 					       false);
 
@@ -800,6 +1108,11 @@ static int handle_response(struct coap_client *client, const struct coap_packet
 		ret = send_request(client->fd, internal_req->request.data,
 				   internal_req->request.offset, 0, &client->address,
 				   client->socklen);
+#if defined(CONFIG_COAP_CLIENT_BLOCK2_PREFETCH)
+		if (ret >= 0 && internal_req->send_blk_ctx.total_size == 0) {
+			block2_prefetch_fill(client, internal_req);
+		}
+#endif
 		k_mutex_unlock(&client->send_mutex);
 
 		if (ret < 0) {
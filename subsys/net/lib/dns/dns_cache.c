@@ -0,0 +1,261 @@
+/** @file
+ * @brief DNS answer cache
+ *
+ * Bounded cache of the results of A and AAAA queries, honouring the TTL of
+ * the answer records.
+ */
+
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_dns_resolve, CONFIG_DNS_RESOLVER_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+#include <string.h>
+#include <strings.h>
+
+#include <zephyr/net/dns_resolve.h>
+#include "dns_internal.h"
+
+#define CACHE_NAME_LEN CONFIG_DNS_RESOLVER_CACHE_MAX_NAME_LEN
+#define CACHE_ADDR_COUNT CONFIG_DNS_RESOLVER_AI_MAX_ENTRIES
+
+struct dns_cache_entry {
+	char name[CACHE_NAME_LEN + 1];
+	struct dns_addrinfo info[CACHE_ADDR_COUNT];
+	/** Uptime in ms when the entry expires, 0 if the entry is free */
+	int64_t expires;
+	/** Uptime in ms of the last lookup, used to find an entry to evict */
+	int64_t last_used;
+	enum dns_query_type type;
+	enum dns_resolve_status status;
+	uint8_t count;
+};
+
+static struct dns_cache_entry dns_cache[CONFIG_DNS_RESOLVER_CACHE_MAX_ENTRIES];
+static struct dns_resolve_cache_stats dns_cache_stats;
+static K_MUTEX_DEFINE(dns_cache_lock);
+
+static bool entry_is_valid(struct dns_cache_entry *entry, int64_t now)
+{
+	if (entry->expires == 0) {
+		return false;
+	}
+
+	if (entry->expires <= now) {
+		entry->expires = 0;
+		return false;
+	}
+
+	return true;
+}
+
+/* Must be invoked with cache lock held */
+static struct dns_cache_entry *entry_find(const char *name,
+					  enum dns_query_type type,
+					  int64_t now)
+{
+	for (int i = 0; i < ARRAY_SIZE(dns_cache); i++) {
+		struct dns_cache_entry *entry = &dns_cache[i];
+
+		if (!entry_is_valid(entry, now) || entry->type != type) {
+			continue;
+		}
+
+		/* Domain names are case insensitive, RFC 4343 */
+		if (strncasecmp(entry->name, name, sizeof(entry->name)) == 0) {
+			return entry;
+		}
+	}
+
+	return NULL;
+}
+
+/* Must be invoked with cache lock held */
+static struct dns_cache_entry *entry_alloc(int64_t now)
+{
+	struct dns_cache_entry *lru = NULL;
+
+	for (int i = 0; i < ARRAY_SIZE(dns_cache); i++) {
+		struct dns_cache_entry *entry = &dns_cache[i];
+
+		if (!entry_is_valid(entry, now)) {
+			return entry;
+		}
+
+		if (lru == NULL || entry->last_used < lru->last_used) {
+			lru = entry;
+		}
+	}
+
+	dns_cache_stats.evictions++;
+
+	return lru;
+}
+
+bool dns_cache_lookup(const char *query, enum dns_query_type type,
+		      dns_resolve_cb_t cb, void *user_data)
+{
+	struct dns_addrinfo info[CACHE_ADDR_COUNT];
+	struct dns_cache_entry *entry;
+	enum dns_resolve_status status;
+	int64_t now = k_uptime_get();
+	int count;
+
+	if (type != DNS_QUERY_TYPE_A && type != DNS_QUERY_TYPE_AAAA) {
+		return false;
+	}
+
+	k_mutex_lock(&dns_cache_lock, K_FOREVER);
+
+	entry = entry_find(query, type, now);
+	if (entry == NULL) {
+		dns_cache_stats.misses++;
+		k_mutex_unlock(&dns_cache_lock);
+		return false;
+	}
+
+	entry->last_used = now;
+	status = entry->status;
+	count = entry->count;
+	memcpy(info, entry->info, count * sizeof(info[0]));
+
+	if (status == DNS_EAI_ALLDONE) {
+		dns_cache_stats.hits++;
+	} else {
+		dns_cache_stats.negative_hits++;
+	}
+
+	k_mutex_unlock(&dns_cache_lock);
+
+	NET_DBG("Cache hit for %s (%d addresses)", query, count);
+
+	/* Call the callback without the lock, it may start a new query */
+	for (int i = 0; i < count; i++) {
+		cb(DNS_EAI_INPROGRESS, &info[i], user_data);
+	}
+
+	cb(status, NULL, user_data);
+
+	return true;
+}
+
+void dns_cache_query_start(struct dns_pending_query *pending_query)
+{
+	pending_query->cache_count = 0U;
+	pending_query->cache_ttl = CONFIG_DNS_RESOLVER_CACHE_MAX_TTL;
+}
+
+void dns_cache_query_add(struct dns_pending_query *pending_query,
+			 const struct dns_addrinfo *info)
+{
+	if (pending_query->cache_count >= CACHE_ADDR_COUNT) {
+		return;
+	}
+
+	pending_query->cache_info[pending_query->cache_count++] = *info;
+}
+
+void dns_cache_query_ttl(struct dns_pending_query *pending_query,
+			 uint32_t ttl)
+{
+	pending_query->cache_ttl = MIN(pending_query->cache_ttl, ttl);
+}
+
+void dns_cache_query_done(struct dns_pending_query *pending_query,
+			  int status)
+{
+	struct dns_cache_entry *entry;
+	int64_t now = k_uptime_get();
+	uint32_t ttl;
+
+	if (pending_query->query == NULL ||
+	    strlen(pending_query->query) > CACHE_NAME_LEN) {
+		return;
+	}
+
+	if (status == DNS_EAI_ALLDONE && pending_query->cache_count > 0) {
+		ttl = pending_query->cache_ttl;
+	} else if (status == DNS_EAI_NODATA) {
+		/* The SOA record is not parsed, so the negative TTL of
+		 * RFC 2308 is replaced by a fixed value.
+		 */
+		ttl = CONFIG_DNS_RESOLVER_CACHE_NEGATIVE_TTL;
+		pending_query->cache_count = 0U;
+	} else {
+		return;
+	}
+
+	if (ttl == 0U) {
+		return;
+	}
+
+	k_mutex_lock(&dns_cache_lock, K_FOREVER);
+
+	entry = entry_find(pending_query->query, pending_query->query_type, now);
+	if (entry == NULL) {
+		entry = entry_alloc(now);
+	}
+
+	strcpy(entry->name, pending_query->query);
+	memcpy(entry->info, pending_query->cache_info,
+	       pending_query->cache_count * sizeof(entry->info[0]));
+	entry->count = pending_query->cache_count;
+	entry->type = pending_query->query_type;
+	entry->status = status;
+	entry->expires = now + (int64_t)ttl * MSEC_PER_SEC;
+	entry->last_used = now;
+
+	k_mutex_unlock(&dns_cache_lock);
+
+	NET_DBG("Cached %s for %u s", pending_query->query, ttl);
+}
+
+void dns_resolve_cache_foreach(dns_resolve_cache_cb_t cb, void *user_data)
+{
+	struct dns_resolve_cache_entry info;
+	int64_t now = k_uptime_get();
+
+	k_mutex_lock(&dns_cache_lock, K_FOREVER);
+
+	for (int i = 0; i < ARRAY_SIZE(dns_cache); i++) {
+		struct dns_cache_entry *entry = &dns_cache[i];
+
+		if (!entry_is_valid(entry, now)) {
+			continue;
+		}
+
+		info.name = entry->name;
+		info.type = entry->type;
+		info.status = entry->status;
+		info.info = entry->info;
+		info.count = entry->count;
+		info.ttl = (uint32_t)((entry->expires - now) / MSEC_PER_SEC);
+
+		cb(&info, user_data);
+	}
+
+	k_mutex_unlock(&dns_cache_lock);
+}
+
+void dns_resolve_cache_flush(void)
+{
+	k_mutex_lock(&dns_cache_lock, K_FOREVER);
+
+	for (int i = 0; i < ARRAY_SIZE(dns_cache); i++) {
+		dns_cache[i].expires = 0;
+	}
+
+	k_mutex_unlock(&dns_cache_lock);
+}
+
+void dns_resolve_cache_stats_get(struct dns_resolve_cache_stats *stats)
+{
+	k_mutex_lock(&dns_cache_lock, K_FOREVER);
+	*stats = dns_cache_stats;
+	k_mutex_unlock(&dns_cache_lock);
+}
@@ -18,3 +18,20 @@ int dns_validate_msg(struct dns_resolve_context *ctx,
 		     struct net_buf *dns_cname,
 		     uint16_t *query_hash);
 #endif
+
+#if defined(CONFIG_DNS_RESOLVER_CACHE)
+/* Answer the query from the cache. Returns true, after calling cb with the
+ * cached result, on a hit.
+ */
+bool dns_cache_lookup(const char *query, enum dns_query_type type,
+		      dns_resolve_cb_t cb, void *user_data);
+
+/* Must be invoked with context lock held */
+void dns_cache_query_start(struct dns_pending_query *pending_query);
+void dns_cache_query_add(struct dns_pending_query *pending_query,
+			 const struct dns_addrinfo *info);
+void dns_cache_query_ttl(struct dns_pending_query *pending_query,
+			 uint32_t ttl);
+void dns_cache_query_done(struct dns_pending_query *pending_query,
+			  int status);
+#endif /* CONFIG_DNS_RESOLVER_CACHE */
@@ -473,6 +473,7 @@ int dns_validate_msg(struct dns_resolve_context *ctx,
 {
 	struct dns_addrinfo info = { 0 };
 	uint32_t ttl; /* RR ttl, so far it is not passed to caller */
+	uint32_t min_ttl = UINT32_MAX;
 	uint8_t *src, *addr;
 	const char *query_name;
 	int address_size;
@@ -556,6 +557,8 @@ int dns_validate_msg(struct dns_resolve_context *ctx,
 			goto quit;
 		}
 
+		min_ttl = MIN(min_ttl, ttl);
+
 		switch (dns_msg->response_type) {
 		case DNS_RESPONSE_IP:
 			if (*query_idx >= 0) {
@@ -633,6 +636,10 @@ query_known:
 			src = dns_msg->msg + dns_msg->response_position;
 			memcpy(addr, src, address_size);
 
+#if defined(CONFIG_DNS_RESOLVER_CACHE)
+			dns_cache_query_add(&ctx->queries[*query_idx], &info);
+#endif
+
 			invoke_query_callback(DNS_EAI_INPROGRESS, &info,
 					      &ctx->queries[*query_idx]);
 			items++;
@@ -673,6 +680,13 @@ query_known:
 		}
 	}
 
+#if defined(CONFIG_DNS_RESOLVER_CACHE)
+	/* Also covers the CNAME records of a previous response, so the
+	 * cached result expires with the shortest lived record of the chain.
+	 */
+	dns_cache_query_ttl(&ctx->queries[*query_idx], min_ttl);
+#endif
+
 	/* No IP addresses were found, so we take the last CNAME to generate
 	 * another query. Number of additional queries is controlled via Kconfig
 	 */
@@ -853,6 +867,10 @@ quit:
 		goto free_buf;
 	}
 
+#if defined(CONFIG_DNS_RESOLVER_CACHE)
+	dns_cache_query_done(&ctx->queries[i], ret);
+#endif
+
 	invoke_query_callback(ret, NULL, &ctx->queries[i]);
 
 	/* Marks the end of the results */
@@ -1184,6 +1202,16 @@ int dns_resolve_name(struct dns_resolve_context *ctx,
 	}
 
 try_resolve:
+#if defined(CONFIG_DNS_RESOLVER_CACHE)
+	if (dns_cache_lookup(query, type, cb, user_data)) {
+		if (dns_id) {
+			*dns_id = 0U;
+		}
+
+		return 0;
+	}
+#endif
+
 	k_mutex_lock(&ctx->lock, K_FOREVER);
 
 	if (ctx->state != DNS_RESOLVE_CONTEXT_ACTIVE) {
@@ -1207,6 +1235,10 @@ try_resolve:
 
 	k_work_init_delayable(&ctx->queries[i].timer, query_timeout);
 
+#if defined(CONFIG_DNS_RESOLVER_CACHE)
+	dns_cache_query_start(&ctx->queries[i]);
+#endif
+
 	dns_data = net_buf_alloc(&dns_msg_pool, ctx->buf_timeout);
 	if (!dns_data) {
 		ret = -ENOMEM;
@@ -1473,6 +1505,11 @@ int dns_resolve_reconfigure(struct dns_resolve_context *ctx,
 		}
 	}
 
+#if defined(CONFIG_DNS_RESOLVER_CACHE)
+	/* Answers of the old servers may not be valid for the new ones */
+	dns_resolve_cache_flush();
+#endif
+
 	err = dns_resolve_init_locked(ctx, servers, servers_sa);
 
 unlock:
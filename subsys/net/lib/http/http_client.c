@@ -344,6 +344,11 @@ static int on_message_complete(struct http_parser *parser)
 
 	req->internal.response.message_complete = 1;
 
+	/* Stop at the end of the response, anything after it belongs to
+	 * the next response of a pipeline.
+	 */
+	http_parser_pause(parser, 1);
+
 	return 0;
 }
 
@@ -413,9 +418,118 @@ static void http_data_final_null_resp(struct http_request *req)
 	}
 }
 
-static int http_wait_data(int sock, struct http_request *req, int32_t timeout)
+static void http_process_data(struct http_request *req, size_t *offset,
+			      size_t received)
 {
-	int total_received = 0;
+	struct http_response *rsp = &req->internal.response;
+	size_t parsed;
+
+	rsp->data_len += received;
+
+	parsed = http_parser_execute(&req->internal.parser,
+				     &req->internal.parser_settings,
+				     rsp->recv_buf + *offset, received);
+
+	if (rsp->message_complete && parsed < received) {
+		size_t extra = received - parsed;
+
+		/* Keep the beginning of the next response out of the data
+		 * given to the callback.
+		 */
+		req->internal.next_data = rsp->recv_buf + *offset + parsed;
+		req->internal.next_len = extra;
+
+		rsp->data_len -= extra;
+		if (rsp->body_frag_start != NULL) {
+			rsp->body_frag_len -= MIN(extra, rsp->body_frag_len);
+		}
+	}
+
+	*offset += received;
+
+	if (*offset >= rsp->recv_buf_len) {
+		*offset = 0;
+	}
+
+	if (rsp->cb) {
+		bool notify = false;
+		enum http_final_call event;
+
+		if (rsp->message_complete) {
+			NET_DBG("Calling callback for %zd len data",
+				rsp->data_len);
+
+			notify = true;
+			event = HTTP_DATA_FINAL;
+		} else if (*offset == 0 || req->stream_response) {
+			NET_DBG("Calling callback for partitioned %zd len data",
+				rsp->data_len);
+
+			notify = true;
+			event = HTTP_DATA_MORE;
+		}
+
+		if (notify) {
+			rsp->cb(rsp, event, req->internal.user_data);
+
+			/* Re-use the result buffer and start to fill it again */
+			rsp->data_len = 0;
+			rsp->body_frag_start = NULL;
+			rsp->body_frag_len = 0;
+
+			if (req->stream_response) {
+				*offset = 0;
+			}
+		}
+	}
+}
+
+/* Process the data received together with the previous response of a
+ * pipeline, before waiting for more.
+ */
+static int http_process_pending(struct http_request *req, size_t *offset,
+				const uint8_t *pending, size_t pending_len)
+{
+	struct http_response *rsp = &req->internal.response;
+	size_t len;
+
+	while (pending_len > 0 && !rsp->message_complete) {
+		len = MIN(pending_len, rsp->recv_buf_len - *offset);
+
+		memmove(rsp->recv_buf + *offset, pending, len);
+		pending += len;
+		pending_len -= len;
+
+		http_process_data(req, offset, len);
+	}
+
+	if (pending_len > 0) {
+		/* More than one response was pending, and the receive buffer
+		 * of this request is smaller than the one the data is in.
+		 * Gather the rest in front of the receive buffer.
+		 */
+		if (req->internal.next_len + pending_len > rsp->recv_buf_len) {
+			return -ENOBUFS;
+		}
+
+		if (req->internal.next_len > 0) {
+			memmove(rsp->recv_buf, req->internal.next_data,
+				req->internal.next_len);
+		}
+
+		memcpy(rsp->recv_buf + req->internal.next_len, pending,
+		       pending_len);
+		req->internal.next_data = rsp->recv_buf;
+		req->internal.next_len += pending_len;
+	}
+
+	return 0;
+}
+
+static int http_wait_data(int sock, struct http_request *req, int32_t timeout,
+			  const uint8_t *pending, size_t pending_len)
+{
+	int total_received = pending_len;
 	size_t offset = 0;
 	int received, ret;
 	struct zsock_pollfd fds[1];
@@ -426,7 +540,12 @@ static int http_wait_data(int sock, struct http_request *req, int32_t timeout)
 	fds[0].fd = sock;
 	fds[0].events = ZSOCK_POLLIN;
 
-	do {
+	ret = http_process_pending(req, &offset, pending, pending_len);
+	if (ret < 0) {
+		return ret;
+	}
+
+	while (!req->internal.response.message_complete) {
 		if (timeout > 0) {
 			remaining_time -= (int32_t)k_uptime_delta(&timestamp);
 			if (remaining_time < 0) {
@@ -457,59 +576,15 @@ static int http_wait_data(int sock, struct http_request *req, int32_t timeout)
 				goto finalize_data;
 			} else if (received < 0) {
 				goto error;
-			} else {
-				req->internal.response.data_len += received;
-
-				(void)http_parser_execute(
-					&req->internal.parser, &req->internal.parser_settings,
-					req->internal.response.recv_buf + offset, received);
 			}
 
 			total_received += received;
-			offset += received;
-
-			if (offset >= req->internal.response.recv_buf_len) {
-				offset = 0;
-			}
-
-			if (req->internal.response.cb) {
-				bool notify = false;
-				enum http_final_call event;
-
-				if (req->internal.response.message_complete) {
-					NET_DBG("Calling callback for %zd len data",
-						req->internal.response.data_len);
-
-					notify = true;
-					event = HTTP_DATA_FINAL;
-				} else if (offset == 0) {
-					NET_DBG("Calling callback for partitioned %zd len data",
-						req->internal.response.data_len);
-
-					notify = true;
-					event = HTTP_DATA_MORE;
-				}
-
-				if (notify) {
-					req->internal.response.cb(&req->internal.response, event,
-								  req->internal.user_data);
 
-					/* Re-use the result buffer and start to fill it again */
-					req->internal.response.data_len = 0;
-					req->internal.response.body_frag_start = NULL;
-					req->internal.response.body_frag_len = 0;
-				}
-			}
-
-			if (req->internal.response.message_complete) {
-				ret = total_received;
-				break;
-			}
+			http_process_data(req, &offset, received);
 		}
+	}
 
-	} while (true);
-
-	return ret;
+	return total_received;
 
 finalize_data:
 	ret = total_received;
@@ -523,22 +598,22 @@ error:
 	return ret;
 }
 
-int http_client_req(int sock, struct http_request *req,
-		    int32_t timeout, void *user_data)
+static bool http_req_is_valid(struct http_request *req)
+{
+	return req != NULL && req->response != NULL &&
+	       req->recv_buf != NULL && req->recv_buf_len > 0;
+}
+
+static int http_send_req(int sock, struct http_request *req, void *user_data)
 {
 	/* Utilize the network usage by sending data in bigger blocks */
 	char send_buf[MAX_SEND_BUF_LEN];
 	const size_t send_buf_max_len = sizeof(send_buf);
 	size_t send_buf_pos = 0;
 	int total_sent = 0;
-	int ret, total_recv, i;
+	int ret, i;
 	const char *method;
 
-	if (sock < 0 || req == NULL || req->response == NULL ||
-	    req->recv_buf == NULL || req->recv_buf_len == 0) {
-		return -EINVAL;
-	}
-
 	memset(&req->internal.response, 0, sizeof(req->internal.response));
 
 	req->internal.response.http_cb = req->http_cb;
@@ -547,6 +622,8 @@ int http_client_req(int sock, struct http_request *req,
 	req->internal.response.recv_buf_len = req->recv_buf_len;
 	req->internal.user_data = user_data;
 	req->internal.sock = sock;
+	req->internal.next_data = NULL;
+	req->internal.next_len = 0;
 
 	method = http_method_str(req->method);
 
@@ -713,8 +790,28 @@ int http_client_req(int sock, struct http_request *req,
 	http_client_init_parser(&req->internal.parser,
 				&req->internal.parser_settings);
 
+	return total_sent;
+
+out:
+	return ret;
+}
+
+int http_client_req(int sock, struct http_request *req,
+		    int32_t timeout, void *user_data)
+{
+	int total_sent, total_recv;
+
+	if (sock < 0 || !http_req_is_valid(req)) {
+		return -EINVAL;
+	}
+
+	total_sent = http_send_req(sock, req, user_data);
+	if (total_sent < 0) {
+		return total_sent;
+	}
+
 	/* Request is sent, now wait data to be received */
-	total_recv = http_wait_data(sock, req, timeout);
+	total_recv = http_wait_data(sock, req, timeout, NULL, 0);
 	if (total_recv < 0) {
 		NET_DBG("Wait data failure (%d)", total_recv);
 	} else {
@@ -722,7 +819,53 @@ int http_client_req(int sock, struct http_request *req,
 	}
 
 	return total_sent;
+}
 
-out:
-	return ret;
+int http_client_req_pipeline(int sock, struct http_request **reqs,
+			     size_t count, int32_t timeout, void *user_data)
+{
+	const uint8_t *pending = NULL;
+	size_t pending_len = 0;
+	int total_sent = 0;
+	int ret;
+	size_t i;
+
+	if (sock < 0 || reqs == NULL || count == 0) {
+		return -EINVAL;
+	}
+
+	for (i = 0; i < count; i++) {
+		if (!http_req_is_valid(reqs[i])) {
+			return -EINVAL;
+		}
+	}
+
+	for (i = 0; i < count; i++) {
+		ret = http_send_req(sock, reqs[i], user_data);
+		if (ret < 0) {
+			return ret;
+		}
+
+		total_sent += ret;
+	}
+
+	for (i = 0; i < count; i++) {
+		ret = http_wait_data(sock, reqs[i], timeout, pending,
+				     pending_len);
+		if (ret < 0 || !reqs[i]->internal.response.message_complete) {
+			NET_DBG("Response %zu of %zu not received (%d)", i + 1,
+				count, ret);
+			break;
+		}
+
+		pending = reqs[i]->internal.next_data;
+		pending_len = reqs[i]->internal.next_len;
+	}
+
+	/* The connection failed, the rest of the responses are lost */
+	for (i++; i < count; i++) {
+		http_data_final_null_resp(reqs[i]);
+	}
+
+	return total_sent;
 }
@@ -0,0 +1,343 @@
+/** @file
+ * @brief HTTP client connection pool
+ *
+ * Keeps the connections of the HTTP client alive between requests.
+ */
+
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_http, CONFIG_NET_HTTP_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+#include <string.h>
+#include <errno.h>
+
+#include <zephyr/net/socket.h>
+#include <zephyr/net/http/client.h>
+
+#include "net_private.h"
+
+#define POOL_HOST_LEN CONFIG_HTTP_CLIENT_POOL_HOST_LEN
+#define POOL_PORT_LEN sizeof("65535")
+#define POOL_IDLE_TIMEOUT_MS (CONFIG_HTTP_CLIENT_POOL_IDLE_TIMEOUT * MSEC_PER_SEC)
+
+struct http_pool_conn {
+	char host[POOL_HOST_LEN + 1];
+	char port[POOL_PORT_LEN];
+	int proto;
+	/** Socket of the connection, -1 if the entry is free */
+	int sock;
+	/** Uptime in ms when the connection was last returned to the pool */
+	int64_t last_used;
+	bool in_use;
+};
+
+static struct http_pool_conn http_pool[CONFIG_HTTP_CLIENT_POOL_SIZE] = {
+	[0 ... (CONFIG_HTTP_CLIENT_POOL_SIZE - 1)] = { .sock = -1 },
+};
+static K_MUTEX_DEFINE(http_pool_lock);
+
+static bool is_tls(int proto)
+{
+	return proto >= IPPROTO_TLS_1_0 && proto <= IPPROTO_TLS_1_2;
+}
+
+static const char *endpoint_port(const struct http_client_endpoint *ep)
+{
+	if (ep->port != NULL) {
+		return ep->port;
+	}
+
+	return is_tls(ep->proto) ? "443" : "80";
+}
+
+/* Must be invoked with pool lock held */
+static void conn_close(struct http_pool_conn *conn)
+{
+	(void)zsock_close(conn->sock);
+	conn->sock = -1;
+	conn->in_use = false;
+}
+
+/* An idle connection must not have anything to read. If it has, the server
+ * closed the connection or sent something unexpected.
+ */
+static bool conn_is_alive(struct http_pool_conn *conn, int64_t now)
+{
+	struct zsock_pollfd fds = {
+		.fd = conn->sock,
+		.events = ZSOCK_POLLIN,
+	};
+
+	if (now - conn->last_used >= POOL_IDLE_TIMEOUT_MS) {
+		return false;
+	}
+
+	return zsock_poll(&fds, 1, 0) == 0;
+}
+
+static bool conn_matches(struct http_pool_conn *conn,
+			 const struct http_client_endpoint *ep)
+{
+	return conn->proto == ep->proto &&
+	       strcmp(conn->port, endpoint_port(ep)) == 0 &&
+	       strcmp(conn->host, ep->host) == 0;
+}
+
+/* Must be invoked with pool lock held */
+static struct http_pool_conn *conn_find(const struct http_client_endpoint *ep,
+					int64_t now)
+{
+	for (int i = 0; i < ARRAY_SIZE(http_pool); i++) {
+		struct http_pool_conn *conn = &http_pool[i];
+
+		if (conn->sock < 0 || conn->in_use) {
+			continue;
+		}
+
+		if (!conn_is_alive(conn, now)) {
+			NET_DBG("Closing idle connection to %s", conn->host);
+			conn_close(conn);
+			continue;
+		}
+
+		if (conn_matches(conn, ep)) {
+			return conn;
+		}
+	}
+
+	return NULL;
+}
+
+/* Must be invoked with pool lock held */
+static struct http_pool_conn *conn_alloc(void)
+{
+	struct http_pool_conn *lru = NULL;
+
+	for (int i = 0; i < ARRAY_SIZE(http_pool); i++) {
+		struct http_pool_conn *conn = &http_pool[i];
+
+		if (conn->sock < 0) {
+			return conn;
+		}
+
+		if (conn->in_use) {
+			continue;
+		}
+
+		if (lru == NULL || conn->last_used < lru->last_used) {
+			lru = conn;
+		}
+	}
+
+	if (lru != NULL) {
+		conn_close(lru);
+	}
+
+	return lru;
+}
+
+static int conn_connect(const struct http_client_endpoint *ep)
+{
+	struct zsock_addrinfo hints = {
+		.ai_socktype = SOCK_STREAM,
+	};
+	struct zsock_addrinfo *res;
+	int sock;
+	int ret;
+
+	ret = zsock_getaddrinfo(ep->host, endpoint_port(ep), &hints, &res);
+	if (ret != 0) {
+		NET_DBG("Cannot resolve %s (%d)", ep->host, ret);
+		return -EHOSTUNREACH;
+	}
+
+	sock = zsock_socket(res->ai_family, res->ai_socktype, ep->proto);
+	if (sock < 0) {
+		ret = -errno;
+		goto out;
+	}
+
+#if defined(CONFIG_NET_SOCKETS_SOCKOPT_TLS)
+	if (is_tls(ep->proto)) {
+		ret = zsock_setsockopt(sock, SOL_TLS, TLS_SEC_TAG_LIST,
+				       ep->sec_tag_list,
+				       ep->sec_tag_count * sizeof(sec_tag_t));
+		if (ret < 0) {
+			ret = -errno;
+			goto fail;
+		}
+
+		ret = zsock_setsockopt(sock, SOL_TLS, TLS_HOSTNAME, ep->host,
+				       strlen(ep->host) + 1);
+		if (ret < 0) {
+			ret = -errno;
+			goto fail;
+		}
+	}
+#endif
+
+	ret = zsock_connect(sock, res->ai_addr, res->ai_addrlen);
+	if (ret < 0) {
+		ret = -errno;
+		goto fail;
+	}
+
+	ret = sock;
+	goto out;
+
+fail:
+	(void)zsock_close(sock);
+out:
+	zsock_freeaddrinfo(res);
+
+	return ret;
+}
+
+int http_client_pool_get(const struct http_client_endpoint *ep)
+{
+	struct http_pool_conn *conn;
+	int64_t now = k_uptime_get();
+	int sock;
+
+	if (ep == NULL || ep->host == NULL) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&http_pool_lock, K_FOREVER);
+
+	conn = conn_find(ep, now);
+	if (conn != NULL) {
+		conn->in_use = true;
+		k_mutex_unlock(&http_pool_lock);
+
+		NET_DBG("Reusing connection to %s", ep->host);
+
+		return conn->sock;
+	}
+
+	k_mutex_unlock(&http_pool_lock);
+
+	/* Connect without the lock, the TLS handshake may take a while */
+	sock = conn_connect(ep);
+	if (sock < 0) {
+		return sock;
+	}
+
+	if (strlen(ep->host) > POOL_HOST_LEN ||
+	    strlen(endpoint_port(ep)) >= POOL_PORT_LEN) {
+		/* Used for this request only, http_client_pool_put() closes
+		 * sockets that are not in the pool.
+		 */
+		return sock;
+	}
+
+	k_mutex_lock(&http_pool_lock, K_FOREVER);
+
+	conn = conn_alloc();
+	if (conn != NULL) {
+		strcpy(conn->host, ep->host);
+		strcpy(conn->port, endpoint_port(ep));
+		conn->proto = ep->proto;
+		conn->sock = sock;
+		conn->in_use = true;
+	}
+
+	k_mutex_unlock(&http_pool_lock);
+
+	return sock;
+}
+
+void http_client_pool_put(int sock, bool reuse)
+{
+	if (sock < 0) {
+		return;
+	}
+
+	k_mutex_lock(&http_pool_lock, K_FOREVER);
+
+	for (int i = 0; i < ARRAY_SIZE(http_pool); i++) {
+		struct http_pool_conn *conn = &http_pool[i];
+
+		if (conn->sock != sock) {
+			continue;
+		}
+
+		if (reuse) {
+			conn->in_use = false;
+			conn->last_used = k_uptime_get();
+		} else {
+			conn_close(conn);
+		}
+
+		k_mutex_unlock(&http_pool_lock);
+		return;
+	}
+
+	k_mutex_unlock(&http_pool_lock);
+
+	/* Not pooled */
+	(void)zsock_close(sock);
+}
+
+static bool response_keeps_alive(struct http_request *req)
+{
+	struct http_response *rsp = &req->internal.response;
+
+	/* Bodies of 5xx responses are not read, and nothing may follow the
+	 * response on an idle connection.
+	 */
+	return rsp->message_complete && rsp->http_status_code < 500 &&
+	       req->internal.next_len == 0 &&
+	       http_should_keep_alive(&req->internal.parser);
+}
+
+int http_client_pool_req(const struct http_client_endpoint *ep,
+			 struct http_request *req, int32_t timeout,
+			 void *user_data)
+{
+	int sock;
+	int ret;
+
+	for (int attempt = 0; attempt < 2; attempt++) {
+		sock = http_client_pool_get(ep);
+		if (sock < 0) {
+			return sock;
+		}
+
+		ret = http_client_req(sock, req, timeout, user_data);
+		if (ret >= 0) {
+			http_client_pool_put(sock, response_keeps_alive(req));
+			return ret;
+		}
+
+		/* Sending failed, most likely the server closed the idle
+		 * connection meanwhile. Nothing was received, so the request
+		 * is sent once more over a new connection.
+		 */
+		NET_DBG("Request failed (%d)", ret);
+		http_client_pool_put(sock, false);
+	}
+
+	return ret;
+}
+
+void http_client_pool_flush(void)
+{
+	k_mutex_lock(&http_pool_lock, K_FOREVER);
+
+	for (int i = 0; i < ARRAY_SIZE(http_pool); i++) {
+		struct http_pool_conn *conn = &http_pool[i];
+
+		if (conn->sock >= 0 && !conn->in_use) {
+			conn_close(conn);
+		}
+	}
+
+	k_mutex_unlock(&http_pool_lock);
+}
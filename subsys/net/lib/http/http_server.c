@@ -0,0 +1,827 @@
+/** @file
+ * @brief HTTP server
+ *
+ * HTTP/1.1 server for the services defined with HTTP_SERVICE_DEFINE().
+ */
+
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_http_server, CONFIG_NET_HTTP_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <string.h>
+#include <errno.h>
+
+#include <zephyr/net/socket.h>
+#include <zephyr/net/socket_service.h>
+#include <zephyr/net/http/parser.h>
+#include <zephyr/net/http/server.h>
+
+#include "net_private.h"
+
+#define MAX_CLIENTS CONFIG_HTTP_SERVER_MAX_CLIENTS
+#define MAX_SERVICES CONFIG_HTTP_SERVER_MAX_SERVICES
+#define MAX_URL_LEN CONFIG_HTTP_SERVER_MAX_URL_LENGTH
+#define IDLE_TIMEOUT K_SECONDS(CONFIG_HTTP_SERVER_IDLE_TIMEOUT)
+#define HEADER_LEN 256
+
+struct http_client_ctx {
+	/** Socket of the connection, -1 if the entry is free */
+	int fd;
+	const struct http_service_desc *service;
+	struct http_parser parser;
+	struct k_work_delayable idle_work;
+	/** Resource of the request being received, NULL if not found */
+	const struct http_resource_detail *resource;
+	/** Status of the error response to send, 0 if there is none */
+	enum http_status error;
+	char url[MAX_URL_LEN + 1];
+	size_t url_len;
+	/** A request is being received */
+	bool in_request;
+	/** The header of the response has been sent */
+	bool responded;
+	/** The response uses chunked transfer encoding... */
+	bool chunked;
+	/** ...and the last chunk has been sent */
+	bool chunked_done;
+	bool keep_alive;
+	/** Close the connection once the current data is processed */
+	bool close;
+	uint8_t buffer[CONFIG_HTTP_SERVER_CLIENT_BUFFER_SIZE];
+};
+
+static struct http_client_ctx clients[MAX_CLIENTS];
+static const struct http_service_desc *listener_services[MAX_SERVICES];
+
+/* Listening sockets first, then one entry per client */
+static struct zsock_pollfd fds[MAX_SERVICES + MAX_CLIENTS];
+
+static struct http_parser_settings parser_settings;
+static K_MUTEX_DEFINE(server_lock);
+static bool server_running;
+
+static K_KERNEL_STACK_DEFINE(http_server_stack, CONFIG_HTTP_SERVER_STACK_SIZE);
+static struct k_work_q http_server_work_q;
+
+static void http_server_handler(struct k_work *work);
+
+NET_SOCKET_SERVICE_ASYNC_DEFINE_STATIC(http_server_svc, &http_server_work_q,
+				       http_server_handler,
+				       MAX_SERVICES + MAX_CLIENTS);
+
+static const char *status_str(enum http_status status)
+{
+	switch (status) {
+	case HTTP_200_OK:
+		return "OK";
+	case HTTP_201_CREATED:
+		return "Created";
+	case HTTP_204_NO_CONTENT:
+		return "No Content";
+	case HTTP_400_BAD_REQUEST:
+		return "Bad Request";
+	case HTTP_403_FORBIDDEN:
+		return "Forbidden";
+	case HTTP_404_NOT_FOUND:
+		return "Not Found";
+	case HTTP_405_METHOD_NOT_ALLOWED:
+		return "Method Not Allowed";
+	case HTTP_413_PAYLOAD_TOO_LARGE:
+		return "Payload Too Large";
+	case HTTP_414_URI_TOO_LONG:
+		return "URI Too Long";
+	case HTTP_500_INTERNAL_SERVER_ERROR:
+		return "Internal Server Error";
+	case HTTP_501_NOT_IMPLEMENTED:
+		return "Not Implemented";
+	case HTTP_503_SERVICE_UNAVAILABLE:
+		return "Service Unavailable";
+	default:
+		/* The reason phrase may be empty, RFC 9112 chapter 4 */
+		return "";
+	}
+}
+
+static void update_service(void)
+{
+	int ret;
+
+	ret = net_socket_service_register(&http_server_svc, fds, ARRAY_SIZE(fds),
+					  NULL);
+	if (ret < 0) {
+		NET_ERR("Cannot register socket service (%d)", ret);
+	}
+}
+
+static int sendmsg_all(int fd, struct iovec *iov, size_t iovcnt)
+{
+	struct msghdr msg = { 0 };
+	ssize_t sent;
+
+	while (iovcnt > 0) {
+		if (iov->iov_len == 0) {
+			iov++;
+			iovcnt--;
+			continue;
+		}
+
+		msg.msg_iov = iov;
+		msg.msg_iovlen = iovcnt;
+
+		sent = zsock_sendmsg(fd, &msg, 0);
+		if (sent < 0) {
+			return -errno;
+		}
+
+		while (sent > 0) {
+			if ((size_t)sent >= iov->iov_len) {
+				sent -= iov->iov_len;
+				iov++;
+				iovcnt--;
+			} else {
+				iov->iov_base = (uint8_t *)iov->iov_base + sent;
+				iov->iov_len -= sent;
+				sent = 0;
+			}
+		}
+	}
+
+	return 0;
+}
+
+/* Send the header of a response, and the body with it if there is one.
+ * A negative content_len means chunked transfer encoding.
+ */
+static int send_header(struct http_client_ctx *client, enum http_status status,
+		       const char *content_type, const char *content_encoding,
+		       ssize_t content_len, const void *body, size_t body_len)
+{
+	char header[HEADER_LEN];
+	struct iovec iov[2];
+	int len;
+
+	len = snprintk(header, sizeof(header), "HTTP/1.1 %d %s\r\n", status,
+		       status_str(status));
+
+	if (content_type != NULL && len < sizeof(header)) {
+		len += snprintk(header + len, sizeof(header) - len,
+				"Content-Type: %s\r\n", content_type);
+	}
+
+	if (content_encoding != NULL && len < sizeof(header)) {
+		len += snprintk(header + len, sizeof(header) - len,
+				"Content-Encoding: %s\r\n", content_encoding);
+	}
+
+	if (len < sizeof(header)) {
+		if (content_len < 0) {
+			len += snprintk(header + len, sizeof(header) - len,
+					"Transfer-Encoding: chunked\r\n");
+		} else if (status != HTTP_204_NO_CONTENT) {
+			len += snprintk(header + len, sizeof(header) - len,
+					"Content-Length: %zd\r\n", content_len);
+		}
+	}
+
+	if (len < sizeof(header)) {
+		len += snprintk(header + len, sizeof(header) - len, "%s\r\n",
+				client->keep_alive ? "" : "Connection: close\r\n");
+	}
+
+	if (len >= sizeof(header)) {
+		NET_ERR("Response header too long");
+		return -ENOMEM;
+	}
+
+	client->responded = true;
+
+	iov[0].iov_base = header;
+	iov[0].iov_len = len;
+	iov[1].iov_base = (void *)body;
+	iov[1].iov_len = client->parser.method == HTTP_HEAD ? 0 : body_len;
+
+	return sendmsg_all(client->fd, iov, ARRAY_SIZE(iov));
+}
+
+static int send_static(struct http_client_ctx *client)
+{
+	const struct http_resource_detail_static *detail =
+		CONTAINER_OF(client->resource,
+			     const struct http_resource_detail_static, common);
+
+	/* The data is sent from where it is stored, without copying it */
+	return send_header(client, HTTP_200_OK, detail->common.content_type,
+			   detail->common.content_encoding,
+			   detail->static_data_len, detail->static_data,
+			   detail->static_data_len);
+}
+
+static int send_dynamic(struct http_client_ctx *client)
+{
+	const struct http_resource_detail_dynamic *detail =
+		CONTAINER_OF(client->resource,
+			     const struct http_resource_detail_dynamic, common);
+	int ret;
+
+	ret = detail->cb(client, HTTP_SERVER_DATA_FINAL, NULL, 0,
+			 detail->user_data);
+	if (ret < 0) {
+		if (!client->responded) {
+			return http_server_send_response(
+				client, HTTP_500_INTERNAL_SERVER_ERROR, NULL,
+				NULL, 0);
+		}
+
+		/* Part of the response is sent already, all that can be done
+		 * is to close the connection.
+		 */
+		return ret;
+	}
+
+	if (client->chunked && !client->chunked_done) {
+		return http_server_send_chunk(client, NULL, 0);
+	}
+
+	if (!client->responded) {
+		return http_server_send_response(client, HTTP_204_NO_CONTENT,
+						 NULL, NULL, 0);
+	}
+
+	return 0;
+}
+
+static struct http_client_ctx *parser_client(struct http_parser *parser)
+{
+	return CONTAINER_OF(parser, struct http_client_ctx, parser);
+}
+
+static int on_message_begin(struct http_parser *parser)
+{
+	struct http_client_ctx *client = parser_client(parser);
+
+	client->resource = NULL;
+	client->error = 0;
+	client->url_len = 0;
+	client->in_request = true;
+	client->responded = false;
+	client->chunked = false;
+	client->chunked_done = false;
+
+	return 0;
+}
+
+static int on_url(struct http_parser *parser, const char *at, size_t length)
+{
+	struct http_client_ctx *client = parser_client(parser);
+
+	if (client->url_len + length > MAX_URL_LEN) {
+		client->error = HTTP_414_URI_TOO_LONG;
+		return 0;
+	}
+
+	memcpy(client->url + client->url_len, at, length);
+	client->url_len += length;
+
+	return 0;
+}
+
+static const struct http_resource_detail *find_resource(
+	const struct http_service_desc *service, const char *url)
+{
+	size_t path_len = strcspn(url, "?#");
+
+	HTTP_SERVICE_FOREACH_RESOURCE(service, res) {
+		if (strlen(res->resource) == path_len &&
+		    strncmp(res->resource, url, path_len) == 0) {
+			return res->detail;
+		}
+	}
+
+	return NULL;
+}
+
+static bool method_allowed(const struct http_resource_detail *detail,
+			   enum http_method method)
+{
+	uint32_t methods = detail->bitmask_of_supported_http_methods;
+
+	/* A static resource can always be served to a HEAD request */
+	if (detail->type == HTTP_RESOURCE_TYPE_STATIC) {
+		methods |= BIT(HTTP_GET) | BIT(HTTP_HEAD);
+		methods &= BIT(HTTP_GET) | BIT(HTTP_HEAD);
+	}
+
+	return method < 32 && (methods & BIT(method)) != 0;
+}
+
+static int on_headers_complete(struct http_parser *parser)
+{
+	struct http_client_ctx *client = parser_client(parser);
+
+	client->url[client->url_len] = '\0';
+	client->keep_alive = http_should_keep_alive(parser);
+
+	if (client->error != 0) {
+		return 0;
+	}
+
+	client->resource = find_resource(client->service, client->url);
+	if (client->resource == NULL) {
+		client->error = HTTP_404_NOT_FOUND;
+	} else if (!method_allowed(client->resource, parser->method)) {
+		client->error = HTTP_405_METHOD_NOT_ALLOWED;
+	}
+
+	NET_DBG("%s %s", http_method_str(parser->method), client->url);
+
+	return 0;
+}
+
+static int on_body(struct http_parser *parser, const char *at, size_t length)
+{
+	struct http_client_ctx *client = parser_client(parser);
+	const struct http_resource_detail_dynamic *detail;
+	int ret;
+
+	if (client->error != 0 ||
+	    client->resource->type != HTTP_RESOURCE_TYPE_DYNAMIC) {
+		/* Nothing to do with the body, it is discarded */
+		return 0;
+	}
+
+	detail = CONTAINER_OF(client->resource,
+			      const struct http_resource_detail_dynamic, common);
+
+	ret = detail->cb(client, HTTP_SERVER_DATA_MORE, (const uint8_t *)at,
+			 length, detail->user_data);
+	if (ret < 0 && !client->responded) {
+		client->error = HTTP_500_INTERNAL_SERVER_ERROR;
+	}
+
+	return 0;
+}
+
+static int on_message_complete(struct http_parser *parser)
+{
+	struct http_client_ctx *client = parser_client(parser);
+	int ret;
+
+	client->in_request = false;
+
+	if (client->error != 0) {
+		ret = client->responded ? -EIO :
+		      http_server_send_response(client, client->error, NULL,
+						NULL, 0);
+	} else if (client->resource->type == HTTP_RESOURCE_TYPE_STATIC) {
+		ret = send_static(client);
+	} else {
+		ret = send_dynamic(client);
+	}
+
+	if (ret < 0 || !client->keep_alive) {
+		client->close = true;
+		http_parser_pause(parser, 1);
+	}
+
+	return 0;
+}
+
+static void client_close(struct http_client_ctx *client)
+{
+	int idx = ARRAY_INDEX(clients, client);
+
+	if (client->in_request && client->resource != NULL &&
+	    client->error == 0 &&
+	    client->resource->type == HTTP_RESOURCE_TYPE_DYNAMIC) {
+		const struct http_resource_detail_dynamic *detail =
+			CONTAINER_OF(client->resource,
+				     const struct http_resource_detail_dynamic,
+				     common);
+
+		(void)detail->cb(client, HTTP_SERVER_DATA_ABORTED, NULL, 0,
+				 detail->user_data);
+	}
+
+	NET_DBG("Closing connection %d", client->fd);
+
+	(void)k_work_cancel_delayable(&client->idle_work);
+
+	fds[MAX_SERVICES + idx].fd = -1;
+	update_service();
+
+	(void)zsock_close(client->fd);
+	client->fd = -1;
+}
+
+static void client_idle_timeout(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct http_client_ctx *client =
+		CONTAINER_OF(dwork, struct http_client_ctx, idle_work);
+
+	k_mutex_lock(&server_lock, K_FOREVER);
+
+	if (client->fd >= 0) {
+		NET_DBG("Connection %d idle", client->fd);
+		client_close(client);
+	}
+
+	k_mutex_unlock(&server_lock);
+}
+
+static void client_accept(int idx)
+{
+	const struct http_service_desc *service = listener_services[idx];
+	struct http_client_ctx *client = NULL;
+	size_t count = 0;
+	int fd;
+
+	fd = zsock_accept(fds[idx].fd, NULL, NULL);
+	if (fd < 0) {
+		NET_DBG("Cannot accept (%d)", -errno);
+		return;
+	}
+
+	for (int i = 0; i < ARRAY_SIZE(clients); i++) {
+		if (clients[i].fd < 0) {
+			if (client == NULL) {
+				client = &clients[i];
+			}
+		} else if (clients[i].service == service) {
+			count++;
+		}
+	}
+
+	if (client == NULL || (service->concurrent > 0 && count >= service->concurrent)) {
+		NET_DBG("Too many clients of %s", service->host);
+		(void)zsock_close(fd);
+		return;
+	}
+
+	client->fd = fd;
+	client->service = service;
+	client->in_request = false;
+	client->close = false;
+	http_parser_init(&client->parser, HTTP_REQUEST);
+
+	k_work_reschedule_for_queue(&http_server_work_q, &client->idle_work,
+				    IDLE_TIMEOUT);
+
+	fds[MAX_SERVICES + ARRAY_INDEX(clients, client)].fd = fd;
+	fds[MAX_SERVICES + ARRAY_INDEX(clients, client)].events = ZSOCK_POLLIN;
+	update_service();
+
+	NET_DBG("New connection %d to %s", fd, service->host);
+}
+
+static void client_recv(struct http_client_ctx *client)
+{
+	size_t offset = 0;
+	size_t parsed;
+	ssize_t len;
+
+	len = zsock_recv(client->fd, client->buffer, sizeof(client->buffer),
+			 ZSOCK_MSG_DONTWAIT);
+	if (len < 0 && errno == EAGAIN) {
+		return;
+	}
+
+	if (len <= 0) {
+		client_close(client);
+		return;
+	}
+
+	k_work_reschedule_for_queue(&http_server_work_q, &client->idle_work,
+				    IDLE_TIMEOUT);
+
+	/* Several pipelined requests may be in the buffer, the parser
+	 * continues with the next one after the response is sent.
+	 */
+	while (offset < len) {
+		parsed = http_parser_execute(&client->parser, &parser_settings,
+					     (const char *)client->buffer + offset,
+					     len - offset);
+		offset += parsed;
+
+		if (client->close) {
+			break;
+		}
+
+		if (HTTP_PARSER_ERRNO(&client->parser) != HPE_OK) {
+			NET_DBG("Invalid request (%s)",
+				http_errno_name(HTTP_PARSER_ERRNO(&client->parser)));
+
+			if (!(client->in_request && client->responded)) {
+				client->keep_alive = false;
+				(void)http_server_send_response(
+					client, HTTP_400_BAD_REQUEST, NULL, NULL, 0);
+			}
+
+			client->close = true;
+			break;
+		}
+	}
+
+	if (client->close) {
+		client_close(client);
+	}
+}
+
+static void http_server_handler(struct k_work *work)
+{
+	struct net_socket_service_event *pev =
+		CONTAINER_OF(work, struct net_socket_service_event, work);
+	int fd = pev->event.fd;
+
+	k_mutex_lock(&server_lock, K_FOREVER);
+
+	if (!server_running) {
+		goto out;
+	}
+
+	for (int i = 0; i < MAX_SERVICES; i++) {
+		if (fds[i].fd == fd) {
+			client_accept(i);
+			goto out;
+		}
+	}
+
+	for (int i = 0; i < ARRAY_SIZE(clients); i++) {
+		if (clients[i].fd != fd) {
+			continue;
+		}
+
+		if (pev->event.revents & (ZSOCK_POLLERR | ZSOCK_POLLNVAL)) {
+			client_close(&clients[i]);
+		} else {
+			client_recv(&clients[i]);
+		}
+
+		break;
+	}
+
+out:
+	k_mutex_unlock(&server_lock);
+}
+
+static int listener_create(const struct http_service_desc *service)
+{
+	struct sockaddr addr = { 0 };
+	socklen_t addrlen;
+	int fd;
+	int ret;
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) &&
+	    zsock_inet_pton(AF_INET, service->host, &net_sin(&addr)->sin_addr) == 1) {
+		addr.sa_family = AF_INET;
+	} else if (IS_ENABLED(CONFIG_NET_IPV6) &&
+		   zsock_inet_pton(AF_INET6, service->host,
+				   &net_sin6(&addr)->sin6_addr) == 1) {
+		addr.sa_family = AF_INET6;
+	} else {
+		/* A host name, listen on the unspecified address */
+		memset(&addr, 0, sizeof(addr));
+		addr.sa_family = IS_ENABLED(CONFIG_NET_IPV6) ? AF_INET6 : AF_INET;
+	}
+
+	if (addr.sa_family == AF_INET6) {
+		net_sin6(&addr)->sin6_port = htons(*service->port);
+		addrlen = sizeof(struct sockaddr_in6);
+	} else {
+		net_sin(&addr)->sin_port = htons(*service->port);
+		addrlen = sizeof(struct sockaddr_in);
+	}
+
+	fd = zsock_socket(addr.sa_family, SOCK_STREAM, IPPROTO_TCP);
+	if (fd < 0) {
+		return -errno;
+	}
+
+	if (addr.sa_family == AF_INET6 &&
+	    IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6)) {
+		int off = 0;
+
+		/* Serve IPv4 clients on the same socket */
+		(void)zsock_setsockopt(fd, IPPROTO_IPV6, IPV6_V6ONLY, &off,
+				       sizeof(off));
+	}
+
+	ret = zsock_bind(fd, &addr, addrlen);
+	if (ret < 0) {
+		ret = -errno;
+		goto fail;
+	}
+
+	ret = zsock_listen(fd, MAX(service->backlog, 1));
+	if (ret < 0) {
+		ret = -errno;
+		goto fail;
+	}
+
+	if (*service->port == 0) {
+		/* Write the ephemeral port back to the service */
+		addrlen = sizeof(addr);
+		if (zsock_getsockname(fd, &addr, &addrlen) == 0) {
+			*service->port = ntohs(addr.sa_family == AF_INET6 ?
+					       net_sin6(&addr)->sin6_port :
+					       net_sin(&addr)->sin_port);
+		}
+	}
+
+	NET_DBG("Listening on %s port %u", service->host, *service->port);
+
+	return fd;
+
+fail:
+	(void)zsock_close(fd);
+
+	return ret;
+}
+
+static void close_all(void)
+{
+	for (int i = 0; i < ARRAY_SIZE(clients); i++) {
+		if (clients[i].fd >= 0) {
+			client_close(&clients[i]);
+		}
+	}
+
+	for (int i = 0; i < MAX_SERVICES; i++) {
+		if (fds[i].fd >= 0) {
+			(void)zsock_close(fds[i].fd);
+			fds[i].fd = -1;
+		}
+
+		listener_services[i] = NULL;
+	}
+}
+
+int http_server_start(void)
+{
+	int count = 0;
+	int ret = 0;
+
+	k_mutex_lock(&server_lock, K_FOREVER);
+
+	if (server_running) {
+		ret = -EALREADY;
+		goto out;
+	}
+
+	HTTP_SERVICE_FOREACH(service) {
+		int fd;
+
+		if (count >= MAX_SERVICES) {
+			NET_ERR("Too many services, see %s",
+				"CONFIG_HTTP_SERVER_MAX_SERVICES");
+			ret = -ENOMEM;
+			break;
+		}
+
+		fd = listener_create(service);
+		if (fd < 0) {
+			NET_ERR("Cannot listen on %s port %u (%d)", service->host,
+				*service->port, fd);
+			ret = fd;
+			break;
+		}
+
+		listener_services[count] = service;
+		fds[count].fd = fd;
+		fds[count].events = ZSOCK_POLLIN;
+		count++;
+	}
+
+	if (ret < 0) {
+		close_all();
+		goto out;
+	}
+
+	server_running = true;
+	update_service();
+
+out:
+	k_mutex_unlock(&server_lock);
+
+	return ret;
+}
+
+int http_server_stop(void)
+{
+	k_mutex_lock(&server_lock, K_FOREVER);
+
+	if (!server_running) {
+		k_mutex_unlock(&server_lock);
+		return -EALREADY;
+	}
+
+	server_running = false;
+	close_all();
+	(void)net_socket_service_unregister(&http_server_svc);
+
+	k_mutex_unlock(&server_lock);
+
+	return 0;
+}
+
+enum http_method http_server_get_method(const struct http_client_ctx *client)
+{
+	return client->parser.method;
+}
+
+const char *http_server_get_url(const struct http_client_ctx *client)
+{
+	return client->url;
+}
+
+int http_server_send_response(struct http_client_ctx *client,
+			      enum http_status status,
+			      const char *content_type, const void *body,
+			      size_t len)
+{
+	if (client->responded) {
+		return -EALREADY;
+	}
+
+	return send_header(client, status, content_type, NULL, len, body, len);
+}
+
+int http_server_send_chunk(struct http_client_ctx *client, const void *data,
+			   size_t len)
+{
+	char size[sizeof("ffffffff\r\n")];
+	struct iovec iov[3];
+	int ret;
+
+	if ((client->responded && !client->chunked) || client->chunked_done) {
+		return -EALREADY;
+	}
+
+	if (!client->responded) {
+		ret = send_header(client, HTTP_200_OK,
+				  client->resource->content_type,
+				  client->resource->content_encoding, -1,
+				  NULL, 0);
+		if (ret < 0) {
+			return ret;
+		}
+
+		client->chunked = true;
+	}
+
+	if (len == 0) {
+		client->chunked_done = true;
+	}
+
+	if (client->parser.method == HTTP_HEAD) {
+		return 0;
+	}
+
+	iov[0].iov_base = size;
+	iov[0].iov_len = snprintk(size, sizeof(size), "%x\r\n", (unsigned int)len);
+	iov[1].iov_base = (void *)data;
+	iov[1].iov_len = len;
+	/* For the last chunk, this ends the empty trailer */
+	iov[2].iov_base = "\r\n";
+	iov[2].iov_len = 2;
+
+	return sendmsg_all(client->fd, iov, ARRAY_SIZE(iov));
+}
+
+static int http_server_init(void)
+{
+	struct k_work_queue_config cfg = {
+		.name = "http_server",
+		.no_yield = false,
+	};
+
+	for (int i = 0; i < ARRAY_SIZE(fds); i++) {
+		fds[i].fd = -1;
+	}
+
+	for (int i = 0; i < ARRAY_SIZE(clients); i++) {
+		clients[i].fd = -1;
+		k_work_init_delayable(&clients[i].idle_work, client_idle_timeout);
+	}
+
+	parser_settings.on_message_begin = on_message_begin;
+	parser_settings.on_url = on_url;
+	parser_settings.on_headers_complete = on_headers_complete;
+	parser_settings.on_body = on_body;
+	parser_settings.on_message_complete = on_message_complete;
+
+	k_work_queue_start(&http_server_work_q, http_server_stack,
+			   K_KERNEL_STACK_SIZEOF(http_server_stack),
+			   CONFIG_HTTP_SERVER_THREAD_PRIO, &cfg);
+
+	return 0;
+}
+
+SYS_INIT(http_server_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
@@ -612,6 +612,11 @@ static int64_t check_notifications(struct lwm2m_ctx *ctx, const int64_t timestam
 			continue;
 		}
 
+#if CONFIG_LWM2M_ENGINE_NOTIFY_COALESCE_WINDOW > 0
+		/* Send the notifications due soon along with this one */
+		engine_observe_coalesce(ctx, timestamp);
+#endif
+
 		rc = generate_notify_message(ctx, obs, NULL);
 		if (rc == -ENOMEM) {
 			/* no memory/messages available, retry later */
@@ -1653,6 +1653,7 @@ static int lwm2m_perform_read_object_instance(struct lwm2m_message *msg,
 {
 	struct lwm2m_engine_res *res = NULL;
 	struct lwm2m_engine_obj_field *obj_field;
+	int first, last;
 	int ret = 0;
 
 	while (obj_inst) {
@@ -1668,12 +1669,17 @@ static int lwm2m_perform_read_object_instance(struct lwm2m_message *msg,
 			return ret;
 		}
 
-		for (int index = 0; index < obj_inst->resource_count; index++) {
-			if (msg->path.level > LWM2M_PATH_LEVEL_OBJECT_INST &&
-			    msg->path.res_id != obj_inst->resources[index].res_id) {
-				continue;
-			}
+		first = 0;
+		last = obj_inst->resource_count;
+
+		/* Look up a single resource instead of walking the instance */
+		if (msg->path.level > LWM2M_PATH_LEVEL_OBJECT_INST) {
+			res = lwm2m_get_engine_obj_inst_res(obj_inst, msg->path.res_id);
+			first = res ? res - obj_inst->resources : 0;
+			last = res ? first + 1 : 0;
+		}
 
+		for (int index = first; index < last; index++) {
 			res = &obj_inst->resources[index];
 			msg->path.res_id = res->res_id;
 			obj_field = lwm2m_get_engine_obj_field(obj_inst->obj, res->res_id);
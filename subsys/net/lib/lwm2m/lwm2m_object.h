@@ -412,6 +412,11 @@ struct lwm2m_engine_obj_inst {
 	/* instance list */
 	sys_snode_t node;
 
+#if defined(CONFIG_LWM2M_ENGINE_OBJ_INST_INDEX)
+	/* instance index bucket */
+	sys_snode_t index_node;
+#endif
+
 	struct lwm2m_engine_obj *obj;
 	struct lwm2m_engine_res *resources;
 
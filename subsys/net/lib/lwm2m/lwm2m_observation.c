@@ -204,8 +204,9 @@ static int engine_observe_get_attributes(const struct lwm2m_obj_path *path,
 	struct lwm2m_engine_obj *obj;
 	struct lwm2m_engine_obj_field *obj_field = NULL;
 	struct lwm2m_engine_obj_inst *obj_inst = NULL;
+	struct lwm2m_engine_res *res;
 	struct lwm2m_engine_res_inst *res_inst = NULL;
-	int ret, i;
+	int ret;
 
 	/* defaults from server object */
 	attrs->pmin = lwm2m_server_get_pmin(srv_obj_inst);
@@ -241,20 +242,15 @@ static int engine_observe_get_attributes(const struct lwm2m_obj_path *path,
 
 	/* check if resource exists */
 	if (path->level >= LWM2M_PATH_LEVEL_RESOURCE) {
-		for (i = 0; i < obj_inst->resource_count; i++) {
-			if (obj_inst->resources[i].res_id == path->res_id) {
-				break;
-			}
-		}
-
-		if (i == obj_inst->resource_count) {
+		res = lwm2m_get_engine_obj_inst_res(obj_inst, path->res_id);
+		if (!res) {
 			LOG_ERR("unable to find res_id: %u/%u/%u", path->obj_id, path->obj_inst_id,
 				path->res_id);
 			return -ENOENT;
 		}
 
 		/* load object field data */
-		obj_field = lwm2m_get_engine_obj_field(obj, obj_inst->resources[i].res_id);
+		obj_field = lwm2m_get_engine_obj_field(obj, res->res_id);
 		if (!obj_field) {
 			LOG_ERR("unable to find obj_field: %u/%u/%u", path->obj_id,
 				path->obj_inst_id, path->res_id);
@@ -266,7 +262,7 @@ static int engine_observe_get_attributes(const struct lwm2m_obj_path *path,
 			return -EPERM;
 		}
 
-		ret = update_attrs(&obj_inst->resources[i], attrs);
+		ret = update_attrs(res, attrs);
 		if (ret < 0) {
 			return ret;
 		}
@@ -1472,6 +1468,36 @@ int64_t engine_observe_shedule_next_event(struct observe_node *obs, uint16_t srv
 	return t_s;
 }
 
+void engine_observe_coalesce(struct lwm2m_ctx *ctx, const int64_t timestamp)
+{
+	struct notification_attrs attrs;
+	struct observe_node *obs;
+	int ret;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&ctx->observer, obs, node) {
+		if (!obs->event_timestamp || obs->event_timestamp <= timestamp ||
+		    obs->event_timestamp >
+			    timestamp + CONFIG_LWM2M_ENGINE_NOTIFY_COALESCE_WINDOW ||
+		    obs->active_notify != NULL) {
+			continue;
+		}
+
+		ret = engine_observe_attribute_list_get(&obs->path_list, &attrs,
+							ctx->srv_obj_inst);
+		if (ret < 0) {
+			continue;
+		}
+
+		if (timestamp - obs->last_timestamp < MSEC_PER_SEC * attrs.pmin) {
+			continue;
+		}
+
+		LOG_DBG("Notification coalesced, %lld ms early",
+			(long long)(obs->event_timestamp - timestamp));
+		obs->event_timestamp = timestamp;
+	}
+}
+
 struct lwm2m_obj_path_list *lwm2m_engine_get_from_list(sys_slist_t *path_list)
 {
 	sys_snode_t *path_node = sys_slist_get(path_list);
@@ -35,6 +35,16 @@ void clear_attrs(void *ref);
 int64_t engine_observe_shedule_next_event(struct observe_node *obs, uint16_t srv_obj_inst,
 					  const int64_t timestamp);
 
+/**
+ * @brief Makes the notifications of @p ctx due within the coalescing window due now.
+ *
+ * Only the observations whose minimum period elapsed at @p timestamp are moved.
+ *
+ * @param[in] ctx LwM2M context of the observations.
+ * @param[in] timestamp Current uptime in ms.
+ */
+void engine_observe_coalesce(struct lwm2m_ctx *ctx, const int64_t timestamp);
+
 void remove_observer_from_list(struct lwm2m_ctx *ctx, sys_snode_t *prev_node,
 			       struct observe_node *obs);
 
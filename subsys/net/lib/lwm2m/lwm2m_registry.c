@@ -88,6 +88,9 @@ static const struct default_obj_version default_obj_versions[] = {
 /* Resources */
 static sys_slist_t engine_obj_list;
 static sys_slist_t engine_obj_inst_list;
+#if defined(CONFIG_LWM2M_ENGINE_OBJ_INST_INDEX)
+static sys_slist_t engine_obj_inst_index[CONFIG_LWM2M_ENGINE_OBJ_INST_INDEX_BUCKETS];
+#endif
 
 /* Resource wrappers */
 sys_slist_t *lwm2m_engine_obj_list(void) { return &engine_obj_list; }
@@ -145,6 +148,12 @@ struct lwm2m_engine_obj_field *lwm2m_get_engine_obj_field(struct lwm2m_engine_ob
 	int i;
 
 	if (obj && obj->fields && obj->field_count > 0) {
+		/* Most objects define their fields in order from resource id 0 */
+		if (res_id >= 0 && res_id < obj->field_count &&
+		    obj->fields[res_id].res_id == res_id) {
+			return &obj->fields[res_id];
+		}
+
 		for (i = 0; i < obj->field_count; i++) {
 			if (obj->fields[i].res_id == res_id) {
 				return &obj->fields[i];
@@ -165,6 +174,15 @@ struct lwm2m_engine_obj *lwm2m_engine_get_obj(const struct lwm2m_obj_path *path)
 }
 /* Engine object instance */
 
+#if defined(CONFIG_LWM2M_ENGINE_OBJ_INST_INDEX)
+static sys_slist_t *obj_inst_index_bucket(int obj_id, int obj_inst_id)
+{
+	uint32_t hash = (uint32_t)obj_id * 7U + (uint32_t)obj_inst_id;
+
+	return &engine_obj_inst_index[hash % ARRAY_SIZE(engine_obj_inst_index)];
+}
+#endif
+
 static void engine_register_obj_inst(struct lwm2m_engine_obj_inst *obj_inst)
 {
 #if defined(CONFIG_LWM2M_ACCESS_CONTROL_ENABLE)
@@ -176,6 +194,10 @@ static void engine_register_obj_inst(struct lwm2m_engine_obj_inst *obj_inst)
 #endif /* CONFIG_LWM2M_RD_CLIENT_SUPPORT_BOOTSTRAP */
 #endif /* CONFIG_LWM2M_ACCESS_CONTROL_ENABLE */
 	sys_slist_append(&engine_obj_inst_list, &obj_inst->node);
+#if defined(CONFIG_LWM2M_ENGINE_OBJ_INST_INDEX)
+	sys_slist_append(obj_inst_index_bucket(obj_inst->obj->obj_id, obj_inst->obj_inst_id),
+			 &obj_inst->index_node);
+#endif
 }
 
 static void engine_unregister_obj_inst(struct lwm2m_engine_obj_inst *obj_inst)
@@ -185,17 +207,55 @@ static void engine_unregister_obj_inst(struct lwm2m_engine_obj_inst *obj_inst)
 #endif
 	engine_remove_observer_by_id(obj_inst->obj->obj_id, obj_inst->obj_inst_id);
 	sys_slist_find_and_remove(&engine_obj_inst_list, &obj_inst->node);
+#if defined(CONFIG_LWM2M_ENGINE_OBJ_INST_INDEX)
+	sys_slist_find_and_remove(obj_inst_index_bucket(obj_inst->obj->obj_id,
+							obj_inst->obj_inst_id),
+				  &obj_inst->index_node);
+#endif
 }
 
 struct lwm2m_engine_obj_inst *get_engine_obj_inst(int obj_id, int obj_inst_id)
 {
 	struct lwm2m_engine_obj_inst *obj_inst;
 
+#if defined(CONFIG_LWM2M_ENGINE_OBJ_INST_INDEX)
+	SYS_SLIST_FOR_EACH_CONTAINER(obj_inst_index_bucket(obj_id, obj_inst_id), obj_inst,
+				     index_node) {
+		if (obj_inst->obj->obj_id == obj_id && obj_inst->obj_inst_id == obj_inst_id) {
+			return obj_inst;
+		}
+	}
+#else
 	SYS_SLIST_FOR_EACH_CONTAINER(&engine_obj_inst_list, obj_inst, node) {
 		if (obj_inst->obj->obj_id == obj_id && obj_inst->obj_inst_id == obj_inst_id) {
 			return obj_inst;
 		}
 	}
+#endif
+
+	return NULL;
+}
+
+struct lwm2m_engine_res *lwm2m_get_engine_obj_inst_res(struct lwm2m_engine_obj_inst *obj_inst,
+						       int res_id)
+{
+	int i;
+
+	if (!obj_inst->resources) {
+		return NULL;
+	}
+
+	/* Resources are usually initialized in the order of the fields */
+	if (res_id >= 0 && res_id < obj_inst->resource_count &&
+	    obj_inst->resources[res_id].res_id == res_id) {
+		return &obj_inst->resources[res_id];
+	}
+
+	for (i = 0; i < obj_inst->resource_count; i++) {
+		if (obj_inst->resources[i].res_id == res_id) {
+			return &obj_inst->resources[i];
+		}
+	}
 
 	return NULL;
 }
@@ -427,13 +487,7 @@ int path_to_objs(const struct lwm2m_obj_path *path, struct lwm2m_engine_obj_inst
 		return -ENOENT;
 	}
 
-	for (i = 0; i < oi->resource_count; i++) {
-		if (oi->resources[i].res_id == path->res_id) {
-			r = &oi->resources[i];
-			break;
-		}
-	}
-
+	r = lwm2m_get_engine_obj_inst_res(oi, path->res_id);
 	if (!r) {
 		if (LWM2M_HAS_PERM(of, BIT(LWM2M_FLAG_OPTIONAL))) {
 			LOG_DBG("resource %d not found", path->res_id);
@@ -444,7 +498,12 @@ int path_to_objs(const struct lwm2m_obj_path *path, struct lwm2m_engine_obj_inst
 		return -ENOENT;
 	}
 
-	for (i = 0; i < r->res_inst_count; i++) {
+	if (path->res_inst_id < r->res_inst_count &&
+	    r->res_instances[path->res_inst_id].res_inst_id == path->res_inst_id) {
+		ri = &r->res_instances[path->res_inst_id];
+	}
+
+	for (i = 0; ri == NULL && i < r->res_inst_count; i++) {
 		if (r->res_instances[i].res_inst_id == path->res_inst_id) {
 			ri = &r->res_instances[i];
 			break;
@@ -25,6 +25,9 @@ static void client_reset(struct mqtt_client *client)
 	client->internal.last_activity = 0U;
 	client->internal.rx_buf_datalen = 0U;
 	client->internal.remaining_payload = 0U;
+#if defined(CONFIG_MQTT_INFLIGHT)
+	client->internal.batch = false;
+#endif
 }
 
 /** @brief Initialize tx buffer. */
@@ -236,6 +239,273 @@ static int verify_tx_state(const struct mqtt_client *client)
 	return 0;
 }
 
+#if defined(CONFIG_MQTT_INFLIGHT)
+static struct mqtt_inflight_msg *inflight_find(struct mqtt_client *client,
+					       uint16_t message_id)
+{
+	for (int i = 0; i < ARRAY_SIZE(client->internal.inflight); i++) {
+		struct mqtt_inflight_msg *msg = &client->internal.inflight[i];
+
+		if (msg->state != MQTT_INFLIGHT_FREE &&
+		    msg->qos > MQTT_QOS_0_AT_MOST_ONCE &&
+		    msg->message_id == message_id) {
+			return msg;
+		}
+	}
+
+	return NULL;
+}
+
+static struct mqtt_inflight_msg *inflight_alloc(struct mqtt_client *client)
+{
+	for (int i = 0; i < ARRAY_SIZE(client->internal.inflight); i++) {
+		struct mqtt_inflight_msg *msg = &client->internal.inflight[i];
+
+		if (msg->state == MQTT_INFLIGHT_FREE) {
+			return msg;
+		}
+	}
+
+	return NULL;
+}
+
+/* Write the unsent messages, or with resend all the messages, in the order
+ * they were published with a single transport send.
+ */
+static int inflight_flush(struct mqtt_client *client, bool resend)
+{
+	struct mqtt_inflight_msg *sent[CONFIG_MQTT_INFLIGHT_WINDOW];
+	struct iovec io_vector[CONFIG_MQTT_INFLIGHT_WINDOW];
+	struct msghdr message;
+	uint32_t last_seq = 0U;
+	size_t count = 0;
+	int err_code;
+
+	while (true) {
+		struct mqtt_inflight_msg *next = NULL;
+
+		for (int i = 0; i < ARRAY_SIZE(client->internal.inflight); i++) {
+			struct mqtt_inflight_msg *msg =
+				&client->internal.inflight[i];
+
+			if (msg->state == MQTT_INFLIGHT_FREE ||
+			    (!resend && msg->state != MQTT_INFLIGHT_UNSENT)) {
+				continue;
+			}
+
+			/* Sequence numbers are compared as a wrapping
+			 * difference, to pick the oldest message not yet
+			 * in the vector.
+			 */
+			if (count > 0 &&
+			    (int32_t)(msg->seq - last_seq) <= 0) {
+				continue;
+			}
+
+			if (next == NULL ||
+			    (int32_t)(msg->seq - next->seq) < 0) {
+				next = msg;
+			}
+		}
+
+		if (next == NULL) {
+			break;
+		}
+
+		if (resend && next->state != MQTT_INFLIGHT_UNSENT &&
+		    (next->buf[next->start] & 0xF0) == MQTT_PKT_TYPE_PUBLISH) {
+			next->buf[next->start] |= MQTT_HEADER_DUP_MASK;
+		}
+
+		io_vector[count].iov_base = &next->buf[next->start];
+		io_vector[count].iov_len = next->len;
+		sent[count] = next;
+		last_seq = next->seq;
+		count++;
+	}
+
+	if (count == 0) {
+		return 0;
+	}
+
+	memset(&message, 0, sizeof(message));
+
+	message.msg_iov = io_vector;
+	message.msg_iovlen = count;
+
+	if (resend) {
+		/* Called from the receive path, which disconnects on error. */
+		err_code = mqtt_transport_write_msg(client, &message);
+		if (err_code < 0) {
+			return err_code;
+		}
+
+		client->internal.last_activity = mqtt_sys_tick_in_ms_get();
+	} else {
+		err_code = client_write_msg(client, &message);
+		if (err_code < 0) {
+			return err_code;
+		}
+	}
+
+	NET_DBG("[CID %p]: %zu in-flight messages written", client, count);
+
+	for (size_t i = 0; i < count; i++) {
+		struct mqtt_inflight_msg *msg = sent[i];
+
+		if (msg->state != MQTT_INFLIGHT_UNSENT) {
+			continue;
+		}
+
+		if (msg->qos == MQTT_QOS_0_AT_MOST_ONCE) {
+			msg->state = MQTT_INFLIGHT_FREE;
+		} else if (msg->qos == MQTT_QOS_1_AT_LEAST_ONCE) {
+			msg->state = MQTT_INFLIGHT_WAIT_PUBACK;
+		} else {
+			msg->state = MQTT_INFLIGHT_WAIT_PUBREC;
+		}
+	}
+
+	return 0;
+}
+
+static bool inflight_fits(const struct mqtt_publish_param *param)
+{
+	size_t len = MQTT_FIXED_HEADER_MAX_SIZE +
+		     GET_UT8STR_BUFFER_SIZE(&param->message.topic.topic) +
+		     param->message.payload.len;
+
+	if (param->message.topic.qos > MQTT_QOS_0_AT_MOST_ONCE) {
+		len += sizeof(uint16_t);
+	}
+
+	return len <= CONFIG_MQTT_INFLIGHT_MSG_SIZE;
+}
+
+static int inflight_publish(struct mqtt_client *client,
+			    const struct mqtt_publish_param *param)
+{
+	struct mqtt_inflight_msg *msg;
+	struct buf_ctx packet;
+	int err_code;
+
+	if (!inflight_fits(param)) {
+		return -EMSGSIZE;
+	}
+
+	if (param->message.topic.qos > MQTT_QOS_0_AT_MOST_ONCE &&
+	    inflight_find(client, param->message_id) != NULL) {
+		return -EEXIST;
+	}
+
+	msg = inflight_alloc(client);
+	if (msg == NULL && client->internal.batch) {
+		/* Write the batch, some of it may be QoS 0 */
+		err_code = inflight_flush(client, false);
+		if (err_code < 0) {
+			return err_code;
+		}
+
+		msg = inflight_alloc(client);
+	}
+
+	if (msg == NULL) {
+		return -EAGAIN;
+	}
+
+	packet.cur = msg->buf;
+	packet.end = msg->buf + sizeof(msg->buf);
+
+	err_code = publish_encode(param, &packet);
+	if (err_code < 0) {
+		return err_code;
+	}
+
+	memcpy(packet.end, param->message.payload.data,
+	       param->message.payload.len);
+
+	msg->start = packet.cur - msg->buf;
+	msg->len = packet.end - packet.cur + param->message.payload.len;
+	msg->message_id = param->message_id;
+	msg->qos = param->message.topic.qos;
+	msg->seq = client->internal.inflight_seq++;
+	msg->state = MQTT_INFLIGHT_UNSENT;
+
+	if (client->internal.batch) {
+		return 0;
+	}
+
+	return inflight_flush(client, false);
+}
+
+void mqtt_inflight_ack(struct mqtt_client *client, uint8_t type,
+		       uint16_t message_id)
+{
+	struct mqtt_inflight_msg *msg;
+	struct mqtt_pubrel_param param = {
+		.message_id = message_id,
+	};
+	struct buf_ctx packet;
+
+	msg = inflight_find(client, message_id);
+	if (msg == NULL) {
+		return;
+	}
+
+	switch (type) {
+	case MQTT_PKT_TYPE_PUBACK:
+		if (msg->state == MQTT_INFLIGHT_WAIT_PUBACK) {
+			msg->state = MQTT_INFLIGHT_FREE;
+		}
+
+		break;
+
+	case MQTT_PKT_TYPE_PUBREC:
+		if (msg->state != MQTT_INFLIGHT_WAIT_PUBREC) {
+			break;
+		}
+
+		/* The application sends the PUBREL, keep a copy of it to
+		 * be sent again on reconnection instead of the message.
+		 */
+		packet.cur = msg->buf;
+		packet.end = msg->buf + sizeof(msg->buf);
+
+		if (publish_release_encode(&param, &packet) == 0) {
+			msg->start = packet.cur - msg->buf;
+			msg->len = packet.end - packet.cur;
+			msg->state = MQTT_INFLIGHT_WAIT_PUBCOMP;
+		}
+
+		break;
+
+	case MQTT_PKT_TYPE_PUBCOMP:
+		if (msg->state == MQTT_INFLIGHT_WAIT_PUBCOMP) {
+			msg->state = MQTT_INFLIGHT_FREE;
+		}
+
+		break;
+
+	default:
+		break;
+	}
+}
+
+int mqtt_inflight_connected(struct mqtt_client *client)
+{
+	if (client->clean_session) {
+		/* The broker discarded the session, the messages are lost */
+		for (int i = 0; i < ARRAY_SIZE(client->internal.inflight); i++) {
+			client->internal.inflight[i].state = MQTT_INFLIGHT_FREE;
+		}
+
+		return 0;
+	}
+
+	return inflight_flush(client, true);
+}
+#endif /* CONFIG_MQTT_INFLIGHT */
+
 int mqtt_publish(struct mqtt_client *client,
 		 const struct mqtt_publish_param *param)
 {
@@ -261,6 +531,22 @@ int mqtt_publish(struct mqtt_client *client,
 		goto error;
 	}
 
+#if defined(CONFIG_MQTT_INFLIGHT)
+	if (param->message.topic.qos > MQTT_QOS_0_AT_MOST_ONCE ||
+	    (client->internal.batch && inflight_fits(param))) {
+		err_code = inflight_publish(client, param);
+		goto error;
+	}
+
+	if (client->internal.batch) {
+		/* Keep the order of the messages */
+		err_code = inflight_flush(client, false);
+		if (err_code < 0) {
+			goto error;
+		}
+	}
+#endif
+
 	err_code = publish_encode(param, &packet);
 	if (err_code < 0) {
 		goto error;
@@ -287,6 +573,55 @@ error:
 	return err_code;
 }
 
+int mqtt_publish_batch_begin(struct mqtt_client *client)
+{
+	int err_code;
+
+	NULL_PARAM_CHECK(client);
+
+	if (!IS_ENABLED(CONFIG_MQTT_INFLIGHT)) {
+		return -ENOTSUP;
+	}
+
+	mqtt_mutex_lock(client);
+
+	err_code = verify_tx_state(client);
+#if defined(CONFIG_MQTT_INFLIGHT)
+	if (err_code == 0) {
+		client->internal.batch = true;
+	}
+#endif
+
+	mqtt_mutex_unlock(client);
+
+	return err_code;
+}
+
+int mqtt_publish_batch_end(struct mqtt_client *client)
+{
+	int err_code;
+
+	NULL_PARAM_CHECK(client);
+
+	if (!IS_ENABLED(CONFIG_MQTT_INFLIGHT)) {
+		return -ENOTSUP;
+	}
+
+	mqtt_mutex_lock(client);
+
+	err_code = verify_tx_state(client);
+#if defined(CONFIG_MQTT_INFLIGHT)
+	if (err_code == 0) {
+		client->internal.batch = false;
+		err_code = inflight_flush(client, false);
+	}
+#endif
+
+	mqtt_mutex_unlock(client);
+
+	return err_code;
+}
+
 int mqtt_publish_qos1_ack(struct mqtt_client *client,
 			  const struct mqtt_puback_param *param)
 {
@@ -69,6 +69,13 @@ extern "C" {
 
 #define MQTT_CONNACK_FLAG_SESSION_PRESENT 0x01
 
+/**@brief States of the in-flight publish messages. */
+#define MQTT_INFLIGHT_FREE         0
+#define MQTT_INFLIGHT_UNSENT       1
+#define MQTT_INFLIGHT_WAIT_PUBACK  2
+#define MQTT_INFLIGHT_WAIT_PUBREC  3
+#define MQTT_INFLIGHT_WAIT_PUBCOMP 4
+
 /**@brief Maximum payload size of MQTT packet. */
 #define MQTT_MAX_PAYLOAD_SIZE 0x0FFFFFFF
 
@@ -162,6 +169,27 @@ void event_notify(struct mqtt_client *client, const struct mqtt_evt *evt);
  */
 int mqtt_handle_rx(struct mqtt_client *client);
 
+#if defined(CONFIG_MQTT_INFLIGHT)
+/**@brief Updates the in-flight window on a publish acknowledgment.
+ *
+ * @param[in] client Identifies the client for which the ack was received.
+ * @param[in] type Packet type of the acknowledgment, PUBACK, PUBREC or
+ *                 PUBCOMP.
+ * @param[in] message_id Message id being acknowledged.
+ */
+void mqtt_inflight_ack(struct mqtt_client *client, uint8_t type,
+		       uint16_t message_id);
+
+/**@brief Sends the in-flight messages again after the connection to the
+ *        broker was accepted, or discards them for a clean session.
+ *
+ * @param[in] client Identifies the client which got connected.
+ *
+ * @return 0 if the procedure is successful, an error code otherwise.
+ */
+int mqtt_inflight_connected(struct mqtt_client *client);
+#endif
+
 /**@brief Constructs/encodes Connect packet.
  *
  * @param[in] client Identifies the client for which the procedure is requested.
@@ -89,6 +89,23 @@ static int cmd_net_capture(const struct shell *sh, size_t argc, char *argv[])
 
 		net_capture_foreach(capture_cb, &user_data);
 	}
+
+#if defined(CONFIG_NET_CAPTURE_RING)
+	struct net_capture_ring_stats stats;
+	struct net_if *ring_iface = net_capture_ring_iface();
+
+	net_capture_ring_stats_get(&stats);
+
+	if (ring_iface != NULL) {
+		PR_INFO("Capture ring enabled for iface %d\n",
+			net_if_get_by_iface(ring_iface));
+	} else {
+		PR_INFO("Capture ring %s\n", "disabled");
+	}
+
+	PR("Captured %u, dropped %u packets, %u bytes\n",
+	   stats.captured, stats.dropped, stats.bytes);
+#endif
 #else
 	ARG_UNUSED(argc);
 	ARG_UNUSED(argv);
@@ -244,6 +261,73 @@ static int cmd_net_capture_disable(const struct shell *sh, size_t argc, char *ar
 	return 0;
 }
 
+static int cmd_net_capture_ring_enable(const struct shell *sh, size_t argc,
+				       char *argv[])
+{
+#if defined(CONFIG_NET_CAPTURE_RING)
+	struct net_if *iface;
+	uint32_t snaplen = 0U;
+	int ret, if_index;
+
+	if_index = atoi(argv[1]);
+	iface = net_if_get_by_index(if_index);
+	if (iface == NULL) {
+		PR_WARNING("No such interface with index %d\n", if_index);
+		return -ENOEXEC;
+	}
+
+	if (argc > 2) {
+		snaplen = atoi(argv[2]);
+	}
+
+	ret = net_capture_ring_enable(iface, snaplen);
+	if (ret < 0) {
+		PR_WARNING("Capture ring %s failed (%d)\n", "enable", ret);
+		return -ENOEXEC;
+	}
+#else
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	PR_INFO("Set %s to enable %s support.\n",
+		"CONFIG_NET_CAPTURE_RING", "capture ring");
+#endif
+
+	return 0;
+}
+
+static int cmd_net_capture_ring_disable(const struct shell *sh, size_t argc,
+					char *argv[])
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+#if defined(CONFIG_NET_CAPTURE_RING)
+	int ret;
+
+	ret = net_capture_ring_disable();
+	if (ret < 0) {
+		PR_WARNING("Capture ring %s failed (%d)\n", "disable", ret);
+		return -ENOEXEC;
+	}
+#else
+	PR_INFO("Set %s to enable %s support.\n",
+		"CONFIG_NET_CAPTURE_RING", "capture ring");
+#endif
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(net_cmd_capture_ring,
+	SHELL_CMD_ARG(enable, NULL, "Capture a network interface into the "
+		      "capture ring.\n"
+		      "'net capture ring enable <interface index> [<snaplen>]'",
+		      cmd_net_capture_ring_enable, 2, 1),
+	SHELL_CMD(disable, NULL, "Stop capturing into the capture ring.",
+		  cmd_net_capture_ring_disable),
+	SHELL_SUBCMD_SET_END
+);
+
 SHELL_STATIC_SUBCMD_SET_CREATE(net_cmd_capture,
 	SHELL_CMD(setup, NULL, "Setup network packet capture.\n"
 		  "'net capture setup <remote-ip-addr> <local-addr> <peer-addr>'\n"
@@ -261,6 +345,9 @@ SHELL_STATIC_SUBCMD_SET_CREATE(net_cmd_capture,
 		  cmd_net_capture_enable),
 	SHELL_CMD(disable, NULL, "Disable network packet capture.",
 		  cmd_net_capture_disable),
+	SHELL_CMD(ring, &net_cmd_capture_ring,
+		  "Capture packets into a local ring buffer in pcapng format.",
+		  NULL),
 	SHELL_SUBCMD_SET_END
 );
 
@@ -152,6 +152,76 @@ static int cmd_net_dns_cancel(const struct shell *sh, size_t argc, char *argv[])
 	return 0;
 }
 
+#if defined(CONFIG_DNS_RESOLVER_CACHE)
+static void dns_cache_cb(const struct dns_resolve_cache_entry *entry,
+			 void *user_data)
+{
+	const struct shell *sh = user_data;
+
+	PR("%s %s ttl %u%s\n", entry->name,
+	   entry->type == DNS_QUERY_TYPE_A ? "A" : "AAAA", entry->ttl,
+	   entry->status == DNS_EAI_ALLDONE ? "" : " (no such name)");
+
+	for (int i = 0; i < entry->count; i++) {
+		const struct dns_addrinfo *info = &entry->info[i];
+
+		if (info->ai_family == AF_INET) {
+			PR("\t%s\n", net_sprint_ipv4_addr(
+				   &net_sin(&info->ai_addr)->sin_addr));
+		} else if (info->ai_family == AF_INET6) {
+			PR("\t%s\n", net_sprint_ipv6_addr(
+				   &net_sin6(&info->ai_addr)->sin6_addr));
+		}
+	}
+}
+#endif
+
+static int cmd_net_dns_cache(const struct shell *sh, size_t argc, char *argv[])
+{
+#if defined(CONFIG_DNS_RESOLVER_CACHE)
+	struct dns_resolve_cache_stats stats;
+	uint32_t lookups;
+#endif
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+#if defined(CONFIG_DNS_RESOLVER_CACHE)
+	PR("DNS cache entries:\n");
+	dns_resolve_cache_foreach(dns_cache_cb, (void *)sh);
+
+	dns_resolve_cache_stats_get(&stats);
+	lookups = stats.hits + stats.negative_hits + stats.misses;
+
+	PR("Hits %u, negative hits %u, misses %u, evictions %u\n",
+	   stats.hits, stats.negative_hits, stats.misses, stats.evictions);
+	PR("Hit rate %u%%\n", lookups ?
+	   (uint32_t)(((uint64_t)stats.hits + stats.negative_hits) * 100U / lookups) : 0U);
+#else
+	PR_INFO("Set %s to enable %s support.\n", "CONFIG_DNS_RESOLVER_CACHE",
+		"DNS answer cache");
+#endif
+
+	return 0;
+}
+
+static int cmd_net_dns_cache_flush(const struct shell *sh, size_t argc,
+				   char *argv[])
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+#if defined(CONFIG_DNS_RESOLVER_CACHE)
+	dns_resolve_cache_flush();
+	PR("DNS cache flushed.\n");
+#else
+	PR_INFO("Set %s to enable %s support.\n", "CONFIG_DNS_RESOLVER_CACHE",
+		"DNS answer cache");
+#endif
+
+	return 0;
+}
+
 static int cmd_net_dns_query(const struct shell *sh, size_t argc, char *argv[])
 {
 
@@ -229,9 +299,18 @@ static int cmd_net_dns(const struct shell *sh, size_t argc, char *argv[])
 	return 0;
 }
 
+SHELL_STATIC_SUBCMD_SET_CREATE(net_cmd_dns_cache,
+	SHELL_CMD(flush, NULL, "Remove all entries from the DNS cache.",
+		  cmd_net_dns_cache_flush),
+	SHELL_SUBCMD_SET_END
+);
+
 SHELL_STATIC_SUBCMD_SET_CREATE(net_cmd_dns,
 	SHELL_CMD(cancel, NULL, "Cancel all pending requests.",
 		  cmd_net_dns_cancel),
+	SHELL_CMD(cache, &net_cmd_dns_cache,
+		  "Show the DNS answer cache and its statistics.",
+		  cmd_net_dns_cache),
 	SHELL_CMD(query, NULL,
 		  "'net dns <hostname> [A or AAAA]' queries IPv4 address "
 		  "(default) or IPv6 address for a host name.",
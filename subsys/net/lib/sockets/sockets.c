@@ -269,6 +269,8 @@ int zsock_close_ctx(struct net_context *ctx)
 		(void)net_context_recv(ctx, NULL, K_NO_WAIT, NULL);
 	}
 
+	zsock_epoll_release(ctx);
+
 	ctx->user_data = INT_TO_POINTER(EINTR);
 	sock_set_error(ctx);
 
@@ -378,6 +380,8 @@ static void zsock_accepted_cb(struct net_context *new_ctx,
 		net_context_ref(new_ctx);
 
 		(void)k_condvar_signal(&parent->cond.recv);
+
+		zsock_epoll_notify(parent);
 	}
 
 }
@@ -432,6 +436,8 @@ unlock:
 	/* Wake reader if it was sleeping */
 	(void)k_condvar_signal(&ctx->cond.recv);
 
+	zsock_epoll_notify(ctx);
+
 	if (ctx->cond.lock) {
 		(void)k_mutex_unlock(ctx->cond.lock);
 	}
@@ -449,6 +455,8 @@ int zsock_shutdown_ctx(struct net_context *ctx, int how)
 		sock_set_eof(ctx);
 
 		zsock_flush_queue(ctx);
+
+		zsock_epoll_notify(ctx);
 	} else if (how == ZSOCK_SHUT_WR || how == ZSOCK_SHUT_RDWR) {
 		SET_ERRNO(-ENOTSUP);
 	} else {
@@ -499,6 +507,7 @@ static void zsock_connected_cb(struct net_context *ctx, int status, void *user_d
 	if (status < 0) {
 		ctx->user_data = INT_TO_POINTER(-status);
 		sock_set_error(ctx);
+		zsock_epoll_notify(ctx);
 	}
 }
 
@@ -951,6 +960,12 @@ static inline ssize_t z_vrfy_zsock_sendmsg(int sock,
 	size_t i;
 	int ret;
 
+	/* The data is copied to kernel memory which is freed on return */
+	if (flags & ZSOCK_MSG_ZEROCOPY) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
 	K_OOPS(k_usermode_from_copy(&msg_copy, (void *)msg, sizeof(msg_copy)));
 
 	msg_copy.msg_name = NULL;
@@ -1031,6 +1046,71 @@ fail:
 #include <syscalls/zsock_sendmsg_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+/* Send or receive one message of a zsock_sendmmsg() or zsock_recvmmsg()
+ * call, and store its length.
+ */
+typedef ssize_t (*mmsg_op_t)(int sock, struct mmsghdr *msg, int flags);
+
+static ssize_t sendmmsg_one(int sock, struct mmsghdr *msg, int flags)
+{
+	ssize_t ret;
+
+	ret = z_impl_zsock_sendmsg(sock, &msg->msg_hdr, flags);
+	if (ret >= 0) {
+		msg->msg_len = ret;
+	}
+
+	return ret;
+}
+
+static int sendmmsg_loop(int sock, struct mmsghdr *msgvec, unsigned int vlen,
+			 int flags, mmsg_op_t send_one)
+{
+	unsigned int i;
+
+	for (i = 0; i < vlen; i++) {
+		if (send_one(sock, &msgvec[i], flags) < 0) {
+			break;
+		}
+	}
+
+	/* An error after the first message is left for the next call */
+	if (i == 0 && vlen > 0) {
+		return -1;
+	}
+
+	return i;
+}
+
+int z_impl_zsock_sendmmsg(int sock, struct mmsghdr *msgvec,
+			  unsigned int vlen, int flags)
+{
+	return sendmmsg_loop(sock, msgvec, vlen, flags, sendmmsg_one);
+}
+
+#ifdef CONFIG_USERSPACE
+static ssize_t sendmmsg_one_user(int sock, struct mmsghdr *msg, int flags)
+{
+	unsigned int len;
+	ssize_t ret;
+
+	ret = z_vrfy_zsock_sendmsg(sock, &msg->msg_hdr, flags);
+	if (ret >= 0) {
+		len = ret;
+		K_OOPS(k_usermode_to_copy(&msg->msg_len, &len, sizeof(len)));
+	}
+
+	return ret;
+}
+
+static inline int z_vrfy_zsock_sendmmsg(int sock, struct mmsghdr *msgvec,
+					unsigned int vlen, int flags)
+{
+	return sendmmsg_loop(sock, msgvec, vlen, flags, sendmmsg_one_user);
+}
+#include <syscalls/zsock_sendmmsg_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
 static int sock_get_pkt_src_addr(struct net_pkt *pkt,
 				 enum net_ip_protocol proto,
 				 struct sockaddr *addr,
@@ -1809,6 +1889,51 @@ ssize_t z_vrfy_zsock_recvfrom(int sock, void *buf, size_t max_len, int flags,
 #include <syscalls/zsock_recvfrom_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+/* Zero-copy send completions are the only errors queued */
+static ssize_t zsock_recv_errqueue(struct net_context *ctx,
+				   struct msghdr *msg)
+{
+	struct sock_extended_err err = { 0 };
+	uint32_t lo, hi;
+	bool copied;
+	int ret;
+
+	if (msg->msg_control == NULL ||
+	    msg->msg_controllen < CMSG_LEN(sizeof(err))) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	ret = net_context_get_zerocopy_done(ctx, &lo, &hi, &copied);
+	if (ret < 0) {
+		errno = ret == -ENOTSUP ? EOPNOTSUPP : -ret;
+		return -1;
+	}
+
+	err.ee_origin = SO_EE_ORIGIN_ZEROCOPY;
+	err.ee_code = copied ? SO_EE_CODE_ZEROCOPY_COPIED : 0;
+	err.ee_info = lo;
+	err.ee_data = hi;
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) &&
+	    net_context_get_family(ctx) == AF_INET) {
+		(void)insert_pktinfo(msg, IPPROTO_IP, IP_RECVERR,
+				     &err, sizeof(err));
+	} else {
+		(void)insert_pktinfo(msg, IPPROTO_IPV6, IPV6_RECVERR,
+				     &err, sizeof(err));
+	}
+
+	msg->msg_controllen = CMSG_LEN(sizeof(err));
+	msg->msg_flags |= ZSOCK_MSG_ERRQUEUE;
+
+	if (msg->msg_name != NULL) {
+		msg->msg_namelen = 0;
+	}
+
+	return 0;
+}
+
 ssize_t zsock_recvmsg_ctx(struct net_context *ctx, struct msghdr *msg,
 			  int flags)
 {
@@ -1820,6 +1945,10 @@ ssize_t zsock_recvmsg_ctx(struct net_context *ctx, struct msghdr *msg,
 		return -1;
 	}
 
+	if (flags & ZSOCK_MSG_ERRQUEUE) {
+		return zsock_recv_errqueue(ctx, msg);
+	}
+
 	if (msg->msg_iov == NULL) {
 		errno = ENOMEM;
 		return -1;
@@ -2024,6 +2153,113 @@ fail:
 #include <syscalls/zsock_recvmsg_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+static ssize_t recvmmsg_one(int sock, struct mmsghdr *msg, int flags)
+{
+	ssize_t ret;
+
+	ret = z_impl_zsock_recvmsg(sock, &msg->msg_hdr, flags);
+	if (ret >= 0) {
+		msg->msg_len = ret;
+	}
+
+	return ret;
+}
+
+static int recvmmsg_loop(int sock, struct mmsghdr *msgvec, unsigned int vlen,
+			 int flags, const struct zsock_timeval *timeout,
+			 mmsg_op_t recv_one)
+{
+	k_timepoint_t end = sys_timepoint_calc(K_FOREVER);
+	unsigned int i;
+
+	if (timeout != NULL) {
+		end = sys_timepoint_calc(
+			K_USEC(timeout->tv_sec * 1000000UL + timeout->tv_usec));
+	}
+
+	for (i = 0; i < vlen; i++) {
+		int msg_flags = flags & ~ZSOCK_MSG_WAITFORONE;
+
+		if (i > 0 && (flags & ZSOCK_MSG_WAITFORONE)) {
+			msg_flags |= ZSOCK_MSG_DONTWAIT;
+		}
+
+		/* The receive timeout of the socket applies per message, so
+		 * the time limit of the call is waited for here.
+		 */
+		if (timeout != NULL && !(msg_flags & ZSOCK_MSG_DONTWAIT)) {
+			struct zsock_pollfd pfd = {
+				.fd = sock,
+				.events = ZSOCK_POLLIN,
+			};
+			int ret;
+
+			ret = zsock_poll_internal(&pfd, 1,
+						  sys_timepoint_timeout(end));
+			if (ret == 0) {
+				errno = EAGAIN;
+			}
+
+			if (ret <= 0) {
+				break;
+			}
+
+			msg_flags |= ZSOCK_MSG_DONTWAIT;
+		}
+
+		if (recv_one(sock, &msgvec[i], msg_flags) < 0) {
+			break;
+		}
+	}
+
+	/* An error after the first message is left for the next call */
+	if (i == 0 && vlen > 0) {
+		return -1;
+	}
+
+	return i;
+}
+
+int z_impl_zsock_recvmmsg(int sock, struct mmsghdr *msgvec,
+			  unsigned int vlen, int flags,
+			  struct zsock_timeval *timeout)
+{
+	return recvmmsg_loop(sock, msgvec, vlen, flags, timeout, recvmmsg_one);
+}
+
+#ifdef CONFIG_USERSPACE
+static ssize_t recvmmsg_one_user(int sock, struct mmsghdr *msg, int flags)
+{
+	unsigned int len;
+	ssize_t ret;
+
+	ret = z_vrfy_zsock_recvmsg(sock, &msg->msg_hdr, flags);
+	if (ret >= 0) {
+		len = ret;
+		K_OOPS(k_usermode_to_copy(&msg->msg_len, &len, sizeof(len)));
+	}
+
+	return ret;
+}
+
+static inline int z_vrfy_zsock_recvmmsg(int sock, struct mmsghdr *msgvec,
+					unsigned int vlen, int flags,
+					struct zsock_timeval *timeout)
+{
+	struct zsock_timeval timeout_copy;
+
+	if (timeout != NULL) {
+		K_OOPS(k_usermode_from_copy(&timeout_copy, timeout,
+					    sizeof(timeout_copy)));
+		timeout = &timeout_copy;
+	}
+
+	return recvmmsg_loop(sock, msgvec, vlen, flags, timeout,
+			     recvmmsg_one_user);
+}
+#include <syscalls/zsock_recvmmsg_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
 /* As this is limited function, we don't follow POSIX signature, with
  * "..." instead of last arg.
  */
@@ -2126,6 +2362,23 @@ static int zsock_poll_prepare_ctx(struct net_context *ctx,
 		(*pev)++;
 	}
 
+#if defined(CONFIG_NET_PKT_TX_ZEROCOPY)
+	/* Zero-copy completions are waited for only when asked, so that
+	 * sockets not using them do not take poll events.
+	 */
+	if (pfd->events & ZSOCK_POLLERR) {
+		if (*pev == pev_end) {
+			return -ENOMEM;
+		}
+
+		(*pev)->obj = &ctx->zerocopy.done;
+		(*pev)->type = K_POLL_TYPE_SEM_AVAILABLE;
+		(*pev)->mode = K_POLL_MODE_NOTIFY_ONLY;
+		(*pev)->state = K_POLL_STATE_NOT_READY;
+		(*pev)++;
+	}
+#endif
+
 	if (pfd->events & ZSOCK_POLLOUT) {
 		if (IS_ENABLED(CONFIG_NET_NATIVE_TCP) &&
 		    net_context_get_type(ctx) == SOCK_STREAM &&
@@ -2172,6 +2425,15 @@ static int zsock_poll_update_ctx(struct net_context *ctx,
 		}
 		(*pev)++;
 	}
+#if defined(CONFIG_NET_PKT_TX_ZEROCOPY)
+	if (pfd->events & ZSOCK_POLLERR) {
+		(*pev)++;
+	}
+
+	if (k_sem_count_get(&ctx->zerocopy.done) > 0) {
+		pfd->revents |= ZSOCK_POLLERR;
+	}
+#endif
 	if (pfd->events & ZSOCK_POLLOUT) {
 		if (IS_ENABLED(CONFIG_NET_NATIVE_TCP) &&
 		    net_context_get_type(ctx) == SOCK_STREAM &&
@@ -2615,6 +2877,20 @@ int zsock_getsockopt_ctx(struct net_context *ctx, int level, int optname,
 			ret = net_tcp_get_option(ctx, TCP_OPT_NODELAY, optval, optlen);
 			return ret;
 
+		case TCP_CONGESTION:
+			if (IS_ENABLED(CONFIG_NET_TCP_CONGESTION_AVOIDANCE)) {
+				ret = net_tcp_get_option(ctx, TCP_OPT_CONGESTION,
+							 optval, optlen);
+				if (ret < 0) {
+					errno = -ret;
+					return -1;
+				}
+
+				return 0;
+			}
+
+			break;
+
 		case TCP_KEEPIDLE:
 			__fallthrough;
 		case TCP_KEEPINTVL:
@@ -3152,6 +3428,20 @@ int zsock_setsockopt_ctx(struct net_context *ctx, int level, int optname,
 						 TCP_OPT_NODELAY, optval, optlen);
 			return ret;
 
+		case TCP_CONGESTION:
+			if (IS_ENABLED(CONFIG_NET_TCP_CONGESTION_AVOIDANCE)) {
+				ret = net_tcp_set_option(ctx, TCP_OPT_CONGESTION,
+							 optval, optlen);
+				if (ret < 0) {
+					errno = -ret;
+					return -1;
+				}
+
+				return 0;
+			}
+
+			break;
+
 		case TCP_KEEPIDLE:
 			__fallthrough;
 		case TCP_KEEPINTVL:
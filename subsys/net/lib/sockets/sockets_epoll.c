@@ -0,0 +1,739 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_sock_epoll, CONFIG_NET_SOCKETS_LOG_LEVEL);
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/internal/syscall_handler.h>
+#include <zephyr/sys/dlist.h>
+#include <zephyr/sys/fdtable.h>
+#include <zephyr/sys/math_extras.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/net/socket_epoll.h>
+#include "sockets_internal.h"
+
+/* Events that are reported even if they were not requested */
+#define EPOLL_ALWAYS (ZSOCK_EPOLLERR | ZSOCK_EPOLLHUP)
+#define EPOLL_FLAGS (ZSOCK_EPOLLET | ZSOCK_EPOLLONESHOT)
+
+/* The first poll entry is used for the epoll instance itself */
+#define EPOLL_POLLED_MAX (CONFIG_NET_SOCKETS_POLL_MAX - 1)
+
+BUILD_ASSERT(CONFIG_NET_SOCKETS_POLL_MAX > 1,
+	     "epoll needs at least two poll() entries");
+
+extern const struct socket_op_vtable sock_fd_op_vtable;
+
+struct epoll_instance;
+
+struct epoll_item {
+	/* All the items of the instance */
+	sys_dnode_t node;
+	/* Native socket items that have pending events */
+	sys_dnode_t ready_node;
+	/* Items that are monitored with poll() */
+	sys_dnode_t poll_node;
+	/* Items of the same native socket */
+	sys_snode_t ctx_node;
+
+	struct epoll_instance *ep;
+	/* NULL if the file descriptor is not a native socket */
+	struct net_context *ctx;
+	int fd;
+	uint32_t events;
+	zsock_epoll_data_t data;
+	/* Cleared when a ZSOCK_EPOLLONESHOT event has been reported */
+	bool armed;
+	bool ready;
+	bool polled;
+};
+
+struct epoll_instance {
+	sys_dlist_t items;
+	sys_dlist_t ready;
+	sys_dlist_t polled;
+	/* Raised while the ready list is not empty */
+	struct k_poll_signal sig;
+	int polled_count;
+	bool in_use;
+};
+
+static struct epoll_instance epoll_instances[CONFIG_NET_SOCKETS_EPOLL_MAX];
+K_MEM_SLAB_DEFINE_STATIC(epoll_item_slab, sizeof(struct epoll_item),
+			 CONFIG_NET_SOCKETS_EPOLL_MAX_ITEMS, 4);
+
+/* Protects all the epoll instances and the socket item lists */
+static struct k_spinlock epoll_lock;
+
+static const struct fd_op_vtable epoll_fd_vtable;
+
+static uint32_t epoll_ctx_events(struct net_context *ctx)
+{
+	bool stream = net_context_get_type(ctx) == SOCK_STREAM;
+	uint32_t events = 0U;
+
+	/* For listening sockets this is the accept queue */
+	if (!k_fifo_is_empty(&ctx->recv_q) || sock_is_eof(ctx)) {
+		events |= ZSOCK_EPOLLIN;
+	}
+
+	if (sock_is_eof(ctx) && stream) {
+		events |= ZSOCK_EPOLLRDHUP;
+	}
+
+	if (!stream) {
+		events |= ZSOCK_EPOLLOUT;
+	}
+
+	if (sock_is_error(ctx)) {
+		events |= ZSOCK_EPOLLERR;
+	}
+
+	return events;
+}
+
+static inline uint32_t epoll_item_mask(struct epoll_item *item)
+{
+	return (item->events & ~EPOLL_FLAGS) | EPOLL_ALWAYS;
+}
+
+static void epoll_ready_update(struct epoll_instance *ep)
+{
+	if (sys_dlist_is_empty(&ep->ready)) {
+		k_poll_signal_reset(&ep->sig);
+	} else {
+		k_poll_signal_raise(&ep->sig, 0);
+	}
+}
+
+static void epoll_item_check(struct epoll_item *item)
+{
+	if (item->polled || !item->armed || item->ready) {
+		return;
+	}
+
+	if ((epoll_ctx_events(item->ctx) & epoll_item_mask(item)) == 0U) {
+		return;
+	}
+
+	item->ready = true;
+	sys_dlist_append(&item->ep->ready, &item->ready_node);
+	k_poll_signal_raise(&item->ep->sig, 0);
+}
+
+static void epoll_item_free(struct epoll_item *item)
+{
+	struct epoll_instance *ep = item->ep;
+
+	sys_dlist_remove(&item->node);
+
+	if (item->ready) {
+		sys_dlist_remove(&item->ready_node);
+		epoll_ready_update(ep);
+	}
+
+	if (item->polled) {
+		sys_dlist_remove(&item->poll_node);
+		ep->polled_count--;
+	}
+
+	if (item->ctx != NULL) {
+		sys_slist_find_and_remove(&item->ctx->epoll_items,
+					  &item->ctx_node);
+	}
+
+	k_mem_slab_free(&epoll_item_slab, (void *)item);
+}
+
+void zsock_epoll_notify(struct net_context *ctx)
+{
+	struct epoll_item *item;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&epoll_lock);
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&ctx->epoll_items, item, ctx_node) {
+		epoll_item_check(item);
+	}
+
+	k_spin_unlock(&epoll_lock, key);
+}
+
+void zsock_epoll_release(struct net_context *ctx)
+{
+	struct epoll_item *item, *next;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&epoll_lock);
+
+	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&ctx->epoll_items, item, next,
+					  ctx_node) {
+		epoll_item_free(item);
+	}
+
+	k_spin_unlock(&epoll_lock, key);
+}
+
+static struct epoll_item *epoll_item_find(struct epoll_instance *ep,
+					  struct net_context *ctx, int fd)
+{
+	struct epoll_item *item;
+
+	/* Native sockets are rarely in more than one instance, and the
+	 * other file descriptors are limited by the poll() array size, so
+	 * neither lookup depends on the number of monitored sockets.
+	 */
+	if (ctx != NULL) {
+		SYS_SLIST_FOR_EACH_CONTAINER(&ctx->epoll_items, item, ctx_node) {
+			if (item->ep == ep) {
+				return item;
+			}
+		}
+
+		return NULL;
+	}
+
+	SYS_DLIST_FOR_EACH_CONTAINER(&ep->polled, item, poll_node) {
+		if (item->ctx == NULL && item->fd == fd) {
+			return item;
+		}
+	}
+
+	return NULL;
+}
+
+static int epoll_item_set(struct epoll_instance *ep, struct epoll_item *item,
+			  const struct zsock_epoll_event *event)
+{
+	/* Output readiness of stream sockets depends on the TCP send
+	 * window, which does not notify sockets, so poll it instead.
+	 */
+	bool polled = item->ctx == NULL ||
+		(net_context_get_type(item->ctx) == SOCK_STREAM &&
+		 (event->events & ZSOCK_EPOLLOUT));
+
+	if (polled && !item->polled) {
+		if (ep->polled_count >= EPOLL_POLLED_MAX) {
+			return -ENOSPC;
+		}
+
+		sys_dlist_append(&ep->polled, &item->poll_node);
+		ep->polled_count++;
+	} else if (!polled && item->polled) {
+		sys_dlist_remove(&item->poll_node);
+		ep->polled_count--;
+	}
+
+	item->polled = polled;
+	item->events = event->events;
+	item->data = event->data;
+	item->armed = true;
+
+	if (item->ready) {
+		item->ready = false;
+		sys_dlist_remove(&item->ready_node);
+		epoll_ready_update(ep);
+	}
+
+	/* Report a socket that is already readable */
+	if (item->ctx != NULL) {
+		epoll_item_check(item);
+	}
+
+	return 0;
+}
+
+static struct epoll_instance *epoll_get(int epfd)
+{
+	return z_get_fd_obj(epfd, &epoll_fd_vtable, EBADF);
+}
+
+int z_impl_zsock_epoll_ctl(int epfd, int op, int fd,
+			   struct zsock_epoll_event *event)
+{
+	const struct fd_op_vtable *vtable;
+	struct net_context *ctx = NULL;
+	struct epoll_instance *ep;
+	struct epoll_item *item;
+	k_spinlock_key_t key;
+	struct k_mutex *lock;
+	void *obj;
+	int ret = 0;
+
+	ep = epoll_get(epfd);
+	if (ep == NULL) {
+		return -1;
+	}
+
+	obj = z_get_fd_obj_and_vtable(fd, &vtable, &lock);
+	if (obj == NULL) {
+		return -1;
+	}
+
+	if (obj == ep) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if (vtable == &sock_fd_op_vtable.fd_vtable) {
+		ctx = obj;
+	}
+
+	if (op != ZSOCK_EPOLL_CTL_DEL && event == NULL) {
+		errno = EFAULT;
+		return -1;
+	}
+
+	key = k_spin_lock(&epoll_lock);
+
+	if (!ep->in_use) {
+		ret = -EBADF;
+		goto out;
+	}
+
+	item = epoll_item_find(ep, ctx, fd);
+
+	switch (op) {
+	case ZSOCK_EPOLL_CTL_ADD:
+		if (item != NULL) {
+			ret = -EEXIST;
+			break;
+		}
+
+		if (k_mem_slab_alloc(&epoll_item_slab, (void **)&item,
+				     K_NO_WAIT) < 0) {
+			ret = -ENOMEM;
+			break;
+		}
+
+		memset(item, 0, sizeof(*item));
+		item->ep = ep;
+		item->ctx = ctx;
+		item->fd = fd;
+
+		ret = epoll_item_set(ep, item, event);
+		if (ret < 0) {
+			k_mem_slab_free(&epoll_item_slab, (void *)item);
+			break;
+		}
+
+		sys_dlist_append(&ep->items, &item->node);
+
+		if (ctx != NULL) {
+			sys_slist_append(&ctx->epoll_items, &item->ctx_node);
+		}
+
+		break;
+
+	case ZSOCK_EPOLL_CTL_MOD:
+		if (item == NULL) {
+			ret = -ENOENT;
+			break;
+		}
+
+		ret = epoll_item_set(ep, item, event);
+		break;
+
+	case ZSOCK_EPOLL_CTL_DEL:
+		if (item == NULL) {
+			ret = -ENOENT;
+			break;
+		}
+
+		epoll_item_free(item);
+		break;
+
+	default:
+		ret = -EINVAL;
+		break;
+	}
+
+out:
+	k_spin_unlock(&epoll_lock, key);
+
+	if (ret < 0) {
+		errno = -ret;
+		return -1;
+	}
+
+	return 0;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_zsock_epoll_ctl(int epfd, int op, int fd,
+					 struct zsock_epoll_event *event)
+{
+	struct zsock_epoll_event event_copy;
+
+	if (event == NULL) {
+		return z_impl_zsock_epoll_ctl(epfd, op, fd, NULL);
+	}
+
+	K_OOPS(k_usermode_from_copy(&event_copy, event, sizeof(event_copy)));
+
+	return z_impl_zsock_epoll_ctl(epfd, op, fd, &event_copy);
+}
+#include <syscalls/zsock_epoll_ctl_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+/* Report the native sockets on the ready list. Level triggered items stay on
+ * the list for as long as they are ready, others are removed once reported.
+ */
+static int epoll_collect(struct epoll_instance *ep,
+			 struct zsock_epoll_event *events, int maxevents)
+{
+	sys_dlist_t keep = SYS_DLIST_STATIC_INIT(&keep);
+	struct epoll_item *item;
+	sys_dnode_t *node;
+	uint32_t revents;
+	int n = 0;
+
+	while (n < maxevents) {
+		node = sys_dlist_get(&ep->ready);
+		if (node == NULL) {
+			break;
+		}
+
+		item = CONTAINER_OF(node, struct epoll_item, ready_node);
+		item->ready = false;
+
+		revents = epoll_ctx_events(item->ctx) & epoll_item_mask(item);
+		if (revents == 0U) {
+			continue;
+		}
+
+		events[n].events = revents;
+		events[n].data = item->data;
+		n++;
+
+		if (item->events & ZSOCK_EPOLLONESHOT) {
+			item->armed = false;
+		} else if (!(item->events & ZSOCK_EPOLLET)) {
+			item->ready = true;
+			sys_dlist_append(&keep, &item->ready_node);
+		}
+	}
+
+	/* Move the reported level triggered items behind the others so that
+	 * a busy socket does not starve the rest when maxevents is small.
+	 */
+	while ((node = sys_dlist_get(&keep)) != NULL) {
+		sys_dlist_append(&ep->ready, node);
+	}
+
+	epoll_ready_update(ep);
+
+	return n;
+}
+
+static int epoll_polled_fill(struct epoll_instance *ep,
+			     struct zsock_pollfd *pfds,
+			     struct epoll_item **items)
+{
+	struct epoll_item *item;
+	int count = 0;
+
+	SYS_DLIST_FOR_EACH_CONTAINER(&ep->polled, item, poll_node) {
+		if (!item->armed) {
+			continue;
+		}
+
+		pfds[count].fd = item->fd;
+		pfds[count].events = item->events & ~EPOLL_FLAGS;
+		pfds[count].revents = 0;
+		items[count] = item;
+		count++;
+	}
+
+	return count;
+}
+
+static bool epoll_item_is_polled(struct epoll_instance *ep,
+				 struct epoll_item *item)
+{
+	struct epoll_item *iter;
+
+	SYS_DLIST_FOR_EACH_CONTAINER(&ep->polled, iter, poll_node) {
+		if (iter == item) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/* Polled file descriptors are level triggered, ZSOCK_EPOLLET is ignored
+ * for them as poll() cannot tell a new event from an old one.
+ */
+static int epoll_polled_report(struct epoll_instance *ep,
+			       struct zsock_pollfd *pfds,
+			       struct epoll_item **items, int count,
+			       struct zsock_epoll_event *events, int maxevents)
+{
+	struct epoll_item *item;
+	int n = 0;
+
+	for (int i = 0; i < count && n < maxevents; i++) {
+		item = items[i];
+
+		if (pfds[i].revents == 0 || !epoll_item_is_polled(ep, item) ||
+		    item->fd != pfds[i].fd || !item->armed) {
+			continue;
+		}
+
+		if (pfds[i].revents & ZSOCK_POLLNVAL) {
+			/* The file descriptor has been closed */
+			epoll_item_free(item);
+			continue;
+		}
+
+		events[n].events = pfds[i].revents & epoll_item_mask(item);
+		events[n].data = item->data;
+		n++;
+
+		if (item->events & ZSOCK_EPOLLONESHOT) {
+			item->armed = false;
+		}
+	}
+
+	return n;
+}
+
+int z_impl_zsock_epoll_wait(int epfd, struct zsock_epoll_event *events,
+			    int maxevents, int timeout)
+{
+	struct zsock_pollfd pfds[1 + EPOLL_POLLED_MAX];
+	struct epoll_item *items[EPOLL_POLLED_MAX];
+	struct epoll_instance *ep;
+	k_spinlock_key_t key;
+	k_timepoint_t end;
+	int count;
+	int ret;
+	int n;
+
+	ep = epoll_get(epfd);
+	if (ep == NULL) {
+		return -1;
+	}
+
+	if (maxevents <= 0) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if (timeout < 0) {
+		end = sys_timepoint_calc(K_FOREVER);
+	} else {
+		end = sys_timepoint_calc(K_MSEC(timeout));
+	}
+
+	pfds[0].fd = epfd;
+	pfds[0].events = ZSOCK_POLLIN;
+
+	while (true) {
+		key = k_spin_lock(&epoll_lock);
+
+		if (!ep->in_use) {
+			k_spin_unlock(&epoll_lock, key);
+			errno = EBADF;
+			return -1;
+		}
+
+		n = epoll_collect(ep, events, maxevents);
+		count = 0;
+
+		if (n < maxevents) {
+			count = epoll_polled_fill(ep, &pfds[1], items);
+		}
+
+		k_spin_unlock(&epoll_lock, key);
+
+		if (count == 0 && n > 0) {
+			return n;
+		}
+
+		pfds[0].revents = 0;
+
+		ret = zsock_poll_internal(pfds, 1 + count,
+					  n > 0 ? K_NO_WAIT : sys_timepoint_timeout(end));
+		if (ret < 0) {
+			return n > 0 ? n : -1;
+		}
+
+		if (count > 0) {
+			key = k_spin_lock(&epoll_lock);
+			n += epoll_polled_report(ep, &pfds[1], items, count,
+						 &events[n], maxevents - n);
+			k_spin_unlock(&epoll_lock, key);
+		}
+
+		if (n > 0 || ret == 0) {
+			return n;
+		}
+	}
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_zsock_epoll_wait(int epfd,
+					  struct zsock_epoll_event *events,
+					  int maxevents, int timeout)
+{
+	size_t size;
+
+	if (maxevents <= 0 ||
+	    size_mul_overflow(maxevents, sizeof(*events), &size)) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	K_OOPS(K_SYSCALL_MEMORY_WRITE(events, size));
+
+	return z_impl_zsock_epoll_wait(epfd, events, maxevents, timeout);
+}
+#include <syscalls/zsock_epoll_wait_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+static int epoll_close_op(void *obj)
+{
+	struct epoll_instance *ep = obj;
+	struct epoll_item *item, *next;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&epoll_lock);
+
+	SYS_DLIST_FOR_EACH_CONTAINER_SAFE(&ep->items, item, next, node) {
+		epoll_item_free(item);
+	}
+
+	ep->in_use = false;
+
+	k_spin_unlock(&epoll_lock, key);
+
+	return 0;
+}
+
+static int epoll_ioctl_op(void *obj, unsigned int request, va_list args)
+{
+	struct epoll_instance *ep = obj;
+	struct zsock_pollfd *pfd;
+	struct k_poll_event **pev;
+	struct k_poll_event *pev_end;
+	k_spinlock_key_t key;
+
+	switch (request) {
+	case ZFD_IOCTL_POLL_PREPARE:
+		pfd = va_arg(args, struct zsock_pollfd *);
+		pev = va_arg(args, struct k_poll_event **);
+		pev_end = va_arg(args, struct k_poll_event *);
+
+		if (!(pfd->events & ZSOCK_POLLIN)) {
+			return 0;
+		}
+
+		if (*pev == pev_end) {
+			return -ENOMEM;
+		}
+
+		(*pev)->obj = &ep->sig;
+		(*pev)->type = K_POLL_TYPE_SIGNAL;
+		(*pev)->mode = K_POLL_MODE_NOTIFY_ONLY;
+		(*pev)->state = K_POLL_STATE_NOT_READY;
+		(*pev)++;
+
+		return 0;
+
+	case ZFD_IOCTL_POLL_UPDATE:
+		pfd = va_arg(args, struct zsock_pollfd *);
+		pev = va_arg(args, struct k_poll_event **);
+
+		if (!(pfd->events & ZSOCK_POLLIN)) {
+			return 0;
+		}
+
+		/* Only native sockets are seen here, events of the polled
+		 * file descriptors are found by zsock_epoll_wait() itself.
+		 */
+		key = k_spin_lock(&epoll_lock);
+
+		if (!sys_dlist_is_empty(&ep->ready)) {
+			pfd->revents |= ZSOCK_POLLIN;
+		}
+
+		k_spin_unlock(&epoll_lock, key);
+
+		(*pev)++;
+
+		return 0;
+
+	default:
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+}
+
+static const struct fd_op_vtable epoll_fd_vtable = {
+	.close = epoll_close_op,
+	.ioctl = epoll_ioctl_op,
+};
+
+int z_impl_zsock_epoll_create1(int flags)
+{
+	struct epoll_instance *ep = NULL;
+	k_spinlock_key_t key;
+	int fd;
+
+	if (flags & ~ZSOCK_EPOLL_CLOEXEC) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	fd = z_reserve_fd();
+	if (fd < 0) {
+		return -1;
+	}
+
+	key = k_spin_lock(&epoll_lock);
+
+	for (int i = 0; i < ARRAY_SIZE(epoll_instances); i++) {
+		if (!epoll_instances[i].in_use) {
+			ep = &epoll_instances[i];
+			break;
+		}
+	}
+
+	if (ep != NULL) {
+		sys_dlist_init(&ep->items);
+		sys_dlist_init(&ep->ready);
+		sys_dlist_init(&ep->polled);
+		k_poll_signal_init(&ep->sig);
+		ep->polled_count = 0;
+		ep->in_use = true;
+	}
+
+	k_spin_unlock(&epoll_lock, key);
+
+	if (ep == NULL) {
+		z_free_fd(fd);
+		errno = ENOMEM;
+		return -1;
+	}
+
+	z_finalize_fd(fd, ep, &epoll_fd_vtable);
+
+	NET_DBG("epoll instance %p, fd %d", ep, fd);
+
+	return fd;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_zsock_epoll_create1(int flags)
+{
+	return z_impl_zsock_epoll_create1(flags);
+}
+#include <syscalls/zsock_epoll_create1_mrsh.c>
+#endif /* CONFIG_USERSPACE */
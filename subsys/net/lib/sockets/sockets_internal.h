@@ -79,6 +79,21 @@ struct socket_op_vtable {
 
 size_t msghdr_non_empty_iov_count(const struct msghdr *msg);
 
+#if defined(CONFIG_NET_SOCKETS_EPOLL)
+void zsock_epoll_notify(struct net_context *ctx);
+void zsock_epoll_release(struct net_context *ctx);
+#else
+static inline void zsock_epoll_notify(struct net_context *ctx)
+{
+	ARG_UNUSED(ctx);
+}
+
+static inline void zsock_epoll_release(struct net_context *ctx)
+{
+	ARG_UNUSED(ctx);
+}
+#endif /* CONFIG_NET_SOCKETS_EPOLL */
+
 #if defined(CONFIG_NET_SOCKETS_OBJ_CORE)
 int sock_obj_core_alloc(int sock, struct net_socket_register *reg,
 			int family, int type, int proto);
@@ -10,6 +10,12 @@ LOG_MODULE_REGISTER(net_sock_svc, CONFIG_NET_SOCKETS_LOG_LEVEL);
 #include <zephyr/kernel.h>
 #include <zephyr/net/socket_service.h>
 #include <zephyr/posix/sys/eventfd.h>
+#if defined(CONFIG_NET_SOCKETS_EPOLL)
+#include <zephyr/net/socket_epoll.h>
+
+/* Max number of events handled per epoll wait */
+#define SERVICE_EPOLL_EVENTS 8
+#endif
 
 static int init_socket_service(void);
 static bool init_done;
@@ -24,6 +30,10 @@ static struct service {
 	/* The +1 is for triggering events from register function */
 	struct zsock_pollfd events[1 + CONFIG_NET_SOCKETS_POLL_MAX];
 	int count;
+#if defined(CONFIG_NET_SOCKETS_EPOLL)
+	/* Used instead of the poll array above */
+	int epfd;
+#endif
 } ctx;
 
 #define get_idx(svc) (*(svc->idx))
@@ -38,7 +48,10 @@ void net_socket_service_foreach(net_socket_service_cb_t cb, void *user_data)
 static void cleanup_svc_events(const struct net_socket_service_desc *svc)
 {
 	for (int i = 0; i < svc->pev_len; i++) {
-		ctx.events[get_idx(svc) + i].fd = -1;
+		if (!IS_ENABLED(CONFIG_NET_SOCKETS_EPOLL)) {
+			ctx.events[get_idx(svc) + i].fd = -1;
+		}
+
 		svc->pev[i].event.fd = -1;
 		svc->pev[i].event.events = 0;
 	}
@@ -77,7 +90,7 @@ int z_impl_net_socket_service_register(const struct net_socket_service_desc *svc
 			svc->pev[i].user_data = user_data;
 		}
 
-		for (i = 0; i < svc->pev_len; i++) {
+		for (i = 0; i < svc->pev_len && !IS_ENABLED(CONFIG_NET_SOCKETS_EPOLL); i++) {
 			ctx.events[get_idx(svc) + i] = svc->pev[i].event;
 		}
 	}
@@ -108,6 +121,24 @@ static struct net_socket_service_desc *find_svc_and_event(
 	return NULL;
 }
 
+#if defined(CONFIG_NET_SOCKETS_EPOLL)
+static void service_epoll_arm(struct net_socket_service_event *pev, int op)
+{
+	struct zsock_epoll_event ev = {
+		.events = pev->event.events | ZSOCK_EPOLLONESHOT,
+		.data.ptr = pev,
+	};
+
+	if (pev->event.fd < 0) {
+		return;
+	}
+
+	if (zsock_epoll_ctl(ctx.epfd, op, pev->event.fd, &ev) < 0) {
+		NET_DBG("Cannot monitor fd %d (%d)", pev->event.fd, -errno);
+	}
+}
+#endif /* CONFIG_NET_SOCKETS_EPOLL */
+
 /* We do not set the user callback to our work struct because we need to
  * hook into the flow and restore the global poll array so that the next poll
  * round will not notice it and call the callback again while we are
@@ -122,12 +153,20 @@ void net_socket_service_callback(struct k_work *work)
 
 	ev.callback(&ev.work);
 
+#if defined(CONFIG_NET_SOCKETS_EPOLL)
+	/* The fd was registered as one shot, so it is not reported again
+	 * until it is re-armed here.
+	 */
+	ARG_UNUSED(svc);
+	service_epoll_arm(pev, ZSOCK_EPOLL_CTL_MOD);
+#else
 	/* Copy back the socket fd to the global array because we marked
 	 * it as -1 when triggering the work.
 	 */
 	for (int i = 0; i < svc->pev_len; i++) {
 		ctx.events[get_idx(svc) + i] = svc->pev[i].event;
 	}
+#endif
 }
 
 static int call_work(struct zsock_pollfd *pev, struct k_work_q *work_q,
@@ -177,6 +216,95 @@ static int trigger_work(struct zsock_pollfd *pev)
 	return call_work(pev, svc->work_q, &event->work);
 }
 
+#if defined(CONFIG_NET_SOCKETS_EPOLL)
+/* Registration changes are rare, so simply start over with a new epoll
+ * instance instead of tracking which fds were replaced.
+ */
+static int service_epoll_rebuild(int evfd)
+{
+	struct zsock_epoll_event ev = {
+		.events = ZSOCK_EPOLLIN,
+		.data.ptr = NULL,
+	};
+
+	if (ctx.epfd >= 0) {
+		(void)zsock_close(ctx.epfd);
+	}
+
+	ctx.epfd = zsock_epoll_create1(0);
+	if (ctx.epfd < 0) {
+		return -errno;
+	}
+
+	if (zsock_epoll_ctl(ctx.epfd, ZSOCK_EPOLL_CTL_ADD, evfd, &ev) < 0) {
+		return -errno;
+	}
+
+	STRUCT_SECTION_FOREACH(net_socket_service_desc, svc) {
+		for (int j = 0; j < svc->pev_len; j++) {
+			svc->pev[j].svc = svc;
+			service_epoll_arm(&svc->pev[j], ZSOCK_EPOLL_CTL_ADD);
+		}
+	}
+
+	return 0;
+}
+
+static int trigger_epoll_work(struct net_socket_service_event *event,
+			      uint32_t revents)
+{
+	struct zsock_pollfd pev = event->event;
+
+	event->event.revents = revents;
+	pev.revents = revents;
+
+	return call_work(&pev, event->svc->work_q, &event->work);
+}
+
+static int socket_service_epoll(int evfd)
+{
+	struct zsock_epoll_event events[SERVICE_EPOLL_EVENTS];
+	eventfd_t value;
+	int ret, i;
+
+	ctx.epfd = -1;
+
+restart:
+	k_mutex_lock(&lock, K_FOREVER);
+	ret = service_epoll_rebuild(evfd);
+	k_mutex_unlock(&lock);
+
+	if (ret < 0) {
+		NET_ERR("epoll setup failed (%d)", ret);
+		return ret;
+	}
+
+	while (true) {
+		ret = zsock_epoll_wait(ctx.epfd, events, ARRAY_SIZE(events), -1);
+		if (ret < 0) {
+			ret = -errno;
+			NET_ERR("epoll_wait failed (%d)", ret);
+			return ret;
+		}
+
+		for (i = 0; i < ret; i++) {
+			if (events[i].data.ptr == NULL) {
+				eventfd_read(evfd, &value);
+				NET_DBG("Received restart event.");
+				goto restart;
+			}
+		}
+
+		for (i = 0; i < ret; i++) {
+			if (trigger_epoll_work(events[i].data.ptr,
+					       events[i].events) < 0) {
+				NET_DBG("Triggering work failed");
+			}
+		}
+	}
+}
+#endif /* CONFIG_NET_SOCKETS_EPOLL */
+
 static void socket_service_thread(void)
 {
 	int ret, i, fd, count = 0;
@@ -194,6 +322,15 @@ static void socket_service_thread(void)
 		count += svc->pev_len;
 	}
 
+#if defined(CONFIG_NET_SOCKETS_EPOLL)
+	if (count > CONFIG_NET_SOCKETS_EPOLL_MAX_ITEMS) {
+		NET_WARN("You have %d services to monitor but "
+			 "%d epoll items configured.",
+			 count, CONFIG_NET_SOCKETS_EPOLL_MAX_ITEMS);
+		NET_WARN("Consider increasing value of %s to %d",
+			 "CONFIG_NET_SOCKETS_EPOLL_MAX_ITEMS", count);
+	}
+#else
 	if ((count + 1) > ARRAY_SIZE(ctx.events)) {
 		NET_WARN("You have %d services to monitor but "
 			 "%zd poll entries configured.",
@@ -201,6 +338,7 @@ static void socket_service_thread(void)
 		NET_WARN("Consider increasing value of %s to %d",
 			 "CONFIG_NET_SOCKETS_POLL_MAX", count + 1);
 	}
+#endif
 
 	NET_DBG("Monitoring %d socket entries", count);
 
@@ -220,6 +358,11 @@ static void socket_service_thread(void)
 	ctx.events[0].fd = fd;
 	ctx.events[0].events = ZSOCK_POLLIN;
 
+#if defined(CONFIG_NET_SOCKETS_EPOLL)
+	(void)socket_service_epoll(fd);
+	goto out;
+#endif
+
 restart:
 	i = 1;
 
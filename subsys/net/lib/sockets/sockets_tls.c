@@ -51,6 +51,9 @@ LOG_MODULE_REGISTER(net_sock_tls, CONFIG_NET_SOCKETS_LOG_LEVEL);
 #include <mbedtls/error.h>
 #include <mbedtls/platform.h>
 #include <mbedtls/ssl_cache.h>
+#if defined(MBEDTLS_SSL_TICKET_C)
+#include <mbedtls/ssl_ticket.h>
+#endif
 #endif /* CONFIG_MBEDTLS */
 
 #include "sockets_internal.h"
@@ -105,6 +108,11 @@ struct tls_session_cache {
 	/** Peer address. */
 	struct sockaddr peer_addr;
 
+	/** Peer hostname, if set on the socket. The session is then bound to
+	 *  the hostname and port rather than to the peer address.
+	 */
+	char *hostname;
+
 	/** Session buffer. */
 	uint8_t *session;
 
@@ -190,6 +198,9 @@ __net_socket struct tls_context {
 		/** Session cache enabled on a socket. */
 		bool cache_enabled;
 
+		/** Session tickets enabled on a socket. */
+		bool tickets_enabled;
+
 		/** Socket TX timeout */
 		k_timeout_t timeout_tx;
 
@@ -219,6 +230,16 @@ __net_socket struct tls_context {
 
 	/** DTLS peer address length. */
 	socklen_t dtls_peer_addrlen;
+
+#if defined(CONFIG_MBEDTLS_SSL_DTLS_CONNECTION_ID)
+	/** Source address of a CID record received from an address other
+	 *  than the peer address, pending authentication by mbedTLS.
+	 */
+	struct sockaddr dtls_pending_addr;
+
+	/** Pending DTLS peer address length, 0 if none. */
+	socklen_t dtls_pending_addrlen;
+#endif /* CONFIG_MBEDTLS_SSL_DTLS_CONNECTION_ID */
 #endif /* CONFIG_NET_SOCKETS_ENABLE_DTLS */
 
 #if defined(CONFIG_MBEDTLS)
@@ -252,6 +273,12 @@ static struct tls_session_cache client_cache[CONFIG_NET_SOCKETS_TLS_MAX_CLIENT_S
 static mbedtls_ssl_cache_context server_cache;
 #endif
 
+#if defined(MBEDTLS_SSL_TICKET_C)
+/* Ticket keys shared by all server sockets, set up on first use. */
+static mbedtls_ssl_ticket_context server_ticket;
+static bool server_ticket_ready;
+#endif
+
 /* A mutex for protecting TLS context allocation. */
 static struct k_mutex context_lock;
 
@@ -266,6 +293,10 @@ static void tls_session_cache_reset(void)
 		if (client_cache[i].session != NULL) {
 			mbedtls_free(client_cache[i].session);
 		}
+
+		if (client_cache[i].hostname != NULL) {
+			mbedtls_free(client_cache[i].hostname);
+		}
 	}
 
 	(void)memset(client_cache, 0, sizeof(client_cache));
@@ -371,6 +402,10 @@ static int tls_init(void)
 	mbedtls_ssl_cache_init(&server_cache);
 #endif
 
+#if defined(MBEDTLS_SSL_TICKET_C)
+	mbedtls_ssl_ticket_init(&server_ticket);
+#endif
+
 	return 0;
 }
 
@@ -564,7 +599,55 @@ static bool peer_addr_cmp(const struct sockaddr *addr,
 	return false;
 }
 
+static bool peer_port_cmp(const struct sockaddr *addr,
+			  const struct sockaddr *peer_addr)
+{
+	if (addr->sa_family != peer_addr->sa_family) {
+		return false;
+	}
+
+	if (IS_ENABLED(CONFIG_NET_IPV6) && peer_addr->sa_family == AF_INET6) {
+		return net_sin6(peer_addr)->sin6_port == net_sin6(addr)->sin6_port;
+	} else if (IS_ENABLED(CONFIG_NET_IPV4) && peer_addr->sa_family == AF_INET) {
+		return net_sin(peer_addr)->sin_port == net_sin(addr)->sin_port;
+	}
+
+	return false;
+}
+
+/* Sessions established with a hostname are looked up by hostname and port,
+ * so that they can be resumed when the name resolves to another address,
+ * like with a load balanced server sharing its ticket keys.
+ */
+static bool tls_session_match(const struct tls_session_cache *entry,
+			      const struct sockaddr *peer_addr,
+			      const char *hostname)
+{
+	if (hostname != NULL) {
+		return entry->hostname != NULL &&
+		       strcmp(entry->hostname, hostname) == 0 &&
+		       peer_port_cmp(&entry->peer_addr, peer_addr);
+	}
+
+	return entry->hostname == NULL &&
+	       peer_addr_cmp(&entry->peer_addr, peer_addr);
+}
+
+static void tls_session_free(struct tls_session_cache *entry)
+{
+	if (entry->session != NULL) {
+		mbedtls_free(entry->session);
+		entry->session = NULL;
+	}
+
+	if (entry->hostname != NULL) {
+		mbedtls_free(entry->hostname);
+		entry->hostname = NULL;
+	}
+}
+
 static int tls_session_save(const struct sockaddr *peer_addr,
+			    const char *hostname,
 			    mbedtls_ssl_session *session)
 {
 	struct tls_session_cache *entry = NULL;
@@ -578,7 +661,8 @@ static int tls_session_save(const struct sockaddr *peer_addr,
 				entry = &client_cache[i];
 			}
 		} else {
-			if (peer_addr_cmp(&client_cache[i].peer_addr, peer_addr)) {
+			if (tls_session_match(&client_cache[i], peer_addr,
+					      hostname)) {
 				/* Reuse old entry for given address. */
 				entry = &client_cache[i];
 				break;
@@ -595,9 +679,16 @@ static int tls_session_save(const struct sockaddr *peer_addr,
 
 	/* Allocate session and save */
 
-	if (entry->session != NULL) {
-		mbedtls_free(entry->session);
-		entry->session = NULL;
+	tls_session_free(entry);
+
+	if (hostname != NULL) {
+		entry->hostname = mbedtls_calloc(1, strlen(hostname) + 1);
+		if (entry->hostname == NULL) {
+			NET_ERR("Failed to allocate session hostname.");
+			return -ENOMEM;
+		}
+
+		strcpy(entry->hostname, hostname);
 	}
 
 	(void)mbedtls_ssl_session_save(session, NULL, 0, &session_len);
@@ -605,6 +696,7 @@ static int tls_session_save(const struct sockaddr *peer_addr,
 	entry->session = mbedtls_calloc(1, session_len);
 	if (entry->session == NULL) {
 		NET_ERR("Failed to allocate session buffer.");
+		tls_session_free(entry);
 		return -ENOMEM;
 	}
 
@@ -612,8 +704,7 @@ static int tls_session_save(const struct sockaddr *peer_addr,
 				       &session_len);
 	if (ret < 0) {
 		NET_ERR("Failed to serialize session, err: -0x%x.", -ret);
-		mbedtls_free(entry->session);
-		entry->session = NULL;
+		tls_session_free(entry);
 		return -ENOMEM;
 	}
 
@@ -625,6 +716,7 @@ static int tls_session_save(const struct sockaddr *peer_addr,
 }
 
 static int tls_session_get(const struct sockaddr *peer_addr,
+			   const char *hostname,
 			   mbedtls_ssl_session *session)
 {
 	struct tls_session_cache *entry = NULL;
@@ -632,7 +724,7 @@ static int tls_session_get(const struct sockaddr *peer_addr,
 
 	for (int i = 0; i < ARRAY_SIZE(client_cache); i++) {
 		if (client_cache[i].session != NULL &&
-		    peer_addr_cmp(&client_cache[i].peer_addr, peer_addr)) {
+		    tls_session_match(&client_cache[i], peer_addr, hostname)) {
 			entry = &client_cache[i];
 			break;
 		}
@@ -646,14 +738,25 @@ static int tls_session_get(const struct sockaddr *peer_addr,
 				       entry->session_len);
 	if (ret < 0) {
 		/* Discard corrupted session data. */
-		mbedtls_free(entry->session);
-		entry->session = NULL;
+		tls_session_free(entry);
 		return -EIO;
 	}
 
 	return 0;
 }
 
+static const char *tls_session_hostname(struct tls_context *context)
+{
+#if defined(MBEDTLS_X509_CRT_PARSE_C)
+	if (context->options.is_hostname_set &&
+	    context->ssl.hostname != NULL && context->ssl.hostname[0] != '\0') {
+		return context->ssl.hostname;
+	}
+#endif
+
+	return NULL;
+}
+
 static void tls_session_store(struct tls_context *context,
 			      const struct sockaddr *addr,
 			      socklen_t addrlen)
@@ -675,7 +778,8 @@ static void tls_session_store(struct tls_context *context,
 		goto exit;
 	}
 
-	ret = tls_session_save(&peer_addr, &session);
+	ret = tls_session_save(&peer_addr, tls_session_hostname(context),
+			       &session);
 	if (ret < 0) {
 		NET_ERR("Failed to save session for %p", context);
 	}
@@ -699,7 +803,8 @@ static void tls_session_restore(struct tls_context *context,
 	memcpy(&peer_addr, addr, addrlen);
 	mbedtls_ssl_session_init(&session);
 
-	ret = tls_session_get(&peer_addr, &session);
+	ret = tls_session_get(&peer_addr, tls_session_hostname(context),
+			      &session);
 	if (ret < 0) {
 		NET_DBG("Session not found for %p", context);
 		goto exit;
@@ -840,6 +945,62 @@ static void dtls_peer_address_get(struct tls_context *context,
 	*addrlen = len;
 }
 
+#if defined(CONFIG_MBEDTLS_SSL_DTLS_CONNECTION_ID)
+/* DTLS 1.2 record header: type, version, epoch and sequence number,
+ * followed by the connection ID and the length.
+ */
+#define DTLS_CID_RECORD_OFFSET 11
+
+static bool dtls_is_cid_record(struct tls_context *context,
+			       const unsigned char *buf, size_t len)
+{
+	size_t cid_len = context->options.dtls_cid.cid_len;
+
+	if (!context->options.dtls_cid.enabled || cid_len == 0 ||
+	    !mbedtls_ssl_is_handshake_over(&context->ssl)) {
+		return false;
+	}
+
+	if (len < DTLS_CID_RECORD_OFFSET + cid_len + 2 ||
+	    buf[0] != MBEDTLS_SSL_MSG_CID) {
+		return false;
+	}
+
+	return memcmp(&buf[DTLS_CID_RECORD_OFFSET],
+		      context->options.dtls_cid.cid, cid_len) == 0;
+}
+
+/* RFC 9146, section 6: the peer address may only be updated once a record
+ * received from the new address was successfully authenticated, so that
+ * forged or replayed datagrams cannot redirect the session.
+ */
+static void dtls_peer_address_update(struct tls_context *context)
+{
+	int err;
+
+	if (context->dtls_pending_addrlen == 0) {
+		return;
+	}
+
+	dtls_peer_address_set(context, &context->dtls_pending_addr,
+			      context->dtls_pending_addrlen);
+
+	if (context->options.role == MBEDTLS_SSL_IS_SERVER) {
+		err = mbedtls_ssl_set_client_transport_id(
+			&context->ssl,
+			(const unsigned char *)&context->dtls_peer_addr,
+			context->dtls_peer_addrlen);
+		if (err < 0) {
+			NET_WARN("Failed to update client transport ID: %d", err);
+		}
+	}
+
+	context->dtls_pending_addrlen = 0;
+
+	NET_DBG("DTLS peer address updated");
+}
+#endif /* CONFIG_MBEDTLS_SSL_DTLS_CONNECTION_ID */
+
 static int dtls_tx(void *ctx, const unsigned char *buf, size_t len)
 {
 	struct tls_context *tls_ctx = ctx;
@@ -877,6 +1038,13 @@ static int dtls_rx(void *ctx, unsigned char *buf, size_t len)
 		return MBEDTLS_ERR_NET_RECV_FAILED;
 	}
 
+#if defined(CONFIG_MBEDTLS_SSL_DTLS_CONNECTION_ID)
+	/* A new datagram, the previous one was either authenticated or
+	 * dropped by mbedTLS.
+	 */
+	tls_ctx->dtls_pending_addrlen = 0;
+#endif
+
 	if (tls_ctx->dtls_peer_addrlen == 0) {
 		/* Only allow to store peer address for DTLS servers. */
 		if (tls_ctx->options.role == MBEDTLS_SSL_IS_SERVER) {
@@ -895,6 +1063,20 @@ static int dtls_rx(void *ctx, unsigned char *buf, size_t len)
 			return MBEDTLS_ERR_SSL_PEER_VERIFY_FAILED;
 		}
 	} else if (!dtls_is_peer_addr_valid(tls_ctx, &addr, addrlen)) {
+#if defined(CONFIG_MBEDTLS_SSL_DTLS_CONNECTION_ID)
+		/* The peer may have moved, e.g. due to NAT rebinding. Records
+		 * carrying our connection ID are passed to mbedTLS, the peer
+		 * address is switched only after they authenticate.
+		 */
+		if (dtls_is_cid_record(tls_ctx, buf, received) &&
+		    addrlen <= sizeof(tls_ctx->dtls_pending_addr)) {
+			memcpy(&tls_ctx->dtls_pending_addr, &addr, addrlen);
+			tls_ctx->dtls_pending_addrlen = addrlen;
+
+			return received;
+		}
+#endif /* CONFIG_MBEDTLS_SSL_DTLS_CONNECTION_ID */
+
 		return MBEDTLS_ERR_SSL_WANT_READ;
 	}
 
@@ -1170,6 +1352,10 @@ static int tls_mbedtls_reset(struct tls_context *context)
 			     sizeof(context->dtls_peer_addr));
 		context->dtls_peer_addrlen = 0;
 	}
+
+#if defined(CONFIG_MBEDTLS_SSL_DTLS_CONNECTION_ID)
+	context->dtls_pending_addrlen = 0;
+#endif
 #endif
 
 	return 0;
@@ -1274,6 +1460,41 @@ static int tls_mbedtls_handshake(struct tls_context *context,
 	return ret;
 }
 
+#if defined(MBEDTLS_SSL_TICKET_C) && defined(MBEDTLS_SSL_SRV_C)
+#if defined(MBEDTLS_GCM_C)
+#define TLS_TICKET_CIPHER MBEDTLS_CIPHER_AES_128_GCM
+#elif defined(MBEDTLS_CCM_C)
+#define TLS_TICKET_CIPHER MBEDTLS_CIPHER_AES_128_CCM
+#else
+#define TLS_TICKET_CIPHER MBEDTLS_CIPHER_CHACHA20_POLY1305
+#endif
+
+static int tls_server_ticket_setup(void)
+{
+	int ret = 0;
+
+	k_mutex_lock(&context_lock, K_FOREVER);
+
+	if (!server_ticket_ready) {
+		ret = mbedtls_ssl_ticket_setup(&server_ticket,
+					       tls_ctr_drbg_random, NULL,
+					       TLS_TICKET_CIPHER,
+					       CONFIG_NET_SOCKETS_TLS_TICKET_LIFETIME);
+		if (ret != 0) {
+			NET_ERR("Failed to set up ticket keys, err: -0x%x.",
+				-ret);
+			ret = -ENOMEM;
+		} else {
+			server_ticket_ready = true;
+		}
+	}
+
+	k_mutex_unlock(&context_lock);
+
+	return ret;
+}
+#endif /* MBEDTLS_SSL_TICKET_C && MBEDTLS_SSL_SRV_C */
+
 static int tls_mbedtls_init(struct tls_context *context, bool is_server)
 {
 	int role, type, ret;
@@ -1409,6 +1630,29 @@ static int tls_mbedtls_init(struct tls_context *context, bool is_server)
 	}
 #endif
 
+#if defined(MBEDTLS_SSL_SESSION_TICKETS) && defined(MBEDTLS_SSL_CLI_C)
+	if (!is_server) {
+		mbedtls_ssl_conf_session_tickets(&context->config,
+			context->options.tickets_enabled ?
+			MBEDTLS_SSL_SESSION_TICKETS_ENABLED :
+			MBEDTLS_SSL_SESSION_TICKETS_DISABLED);
+	}
+#endif
+
+#if defined(MBEDTLS_SSL_TICKET_C) && defined(MBEDTLS_SSL_SRV_C)
+	if (is_server && context->options.tickets_enabled) {
+		ret = tls_server_ticket_setup();
+		if (ret != 0) {
+			return ret;
+		}
+
+		mbedtls_ssl_conf_session_tickets_cb(&context->config,
+						    mbedtls_ssl_ticket_write,
+						    mbedtls_ssl_ticket_parse,
+						    &server_ticket);
+	}
+#endif
+
 	ret = mbedtls_ssl_setup(&context->ssl,
 				&context->config);
 	if (ret != 0) {
@@ -1929,6 +2173,42 @@ static int tls_opt_session_cache_get(struct tls_context *context,
 	return 0;
 }
 
+#if defined(MBEDTLS_SSL_SESSION_TICKETS)
+static int tls_opt_session_tickets_set(struct tls_context *context,
+				       const void *optval, socklen_t optlen)
+{
+	int *val = (int *)optval;
+
+	if (!optval) {
+		return -EINVAL;
+	}
+
+	if (sizeof(int) != optlen) {
+		return -EINVAL;
+	}
+
+	context->options.tickets_enabled = (*val == TLS_SESSION_TICKETS_ENABLED);
+
+	return 0;
+}
+
+static int tls_opt_session_tickets_get(struct tls_context *context,
+				       void *optval, socklen_t *optlen)
+{
+	int tickets_enabled = context->options.tickets_enabled ?
+			      TLS_SESSION_TICKETS_ENABLED :
+			      TLS_SESSION_TICKETS_DISABLED;
+
+	if (*optlen != sizeof(tickets_enabled)) {
+		return -EINVAL;
+	}
+
+	*(int *)optval = tickets_enabled;
+
+	return 0;
+}
+#endif /* MBEDTLS_SSL_SESSION_TICKETS */
+
 static int tls_opt_session_cache_purge_set(struct tls_context *context,
 					   const void *optval, socklen_t optlen)
 {
@@ -2645,6 +2925,10 @@ static ssize_t recvfrom_dtls_common(struct tls_context *ctx, void *buf,
 			}
 		}
 
+#if defined(CONFIG_MBEDTLS_SSL_DTLS_CONNECTION_ID)
+		dtls_peer_address_update(ctx);
+#endif
+
 		if (src_addr && addrlen) {
 			dtls_peer_address_get(ctx, src_addr, addrlen);
 		}
@@ -3394,6 +3678,12 @@ int ztls_getsockopt_ctx(struct tls_context *ctx, int level, int optname,
 		err = tls_opt_session_cache_get(ctx, optval, optlen);
 		break;
 
+#if defined(MBEDTLS_SSL_SESSION_TICKETS)
+	case TLS_SESSION_TICKETS:
+		err = tls_opt_session_tickets_get(ctx, optval, optlen);
+		break;
+#endif
+
 #if defined(CONFIG_NET_SOCKETS_ENABLE_DTLS)
 	case TLS_DTLS_HANDSHAKE_TIMEOUT_MIN:
 		err = tls_opt_dtls_handshake_timeout_get(ctx, optval,
@@ -3516,6 +3806,12 @@ int ztls_setsockopt_ctx(struct tls_context *ctx, int level, int optname,
 		err = tls_opt_session_cache_purge_set(ctx, optval, optlen);
 		break;
 
+#if defined(MBEDTLS_SSL_SESSION_TICKETS)
+	case TLS_SESSION_TICKETS:
+		err = tls_opt_session_tickets_set(ctx, optval, optlen);
+		break;
+#endif
+
 #if defined(CONFIG_NET_SOCKETS_ENABLE_DTLS)
 	case TLS_DTLS_HANDSHAKE_TIMEOUT_MIN:
 		err = tls_opt_dtls_handshake_timeout_set(ctx, optval,
@@ -22,6 +22,7 @@ LOG_MODULE_REGISTER(net_websocket, CONFIG_NET_WEBSOCKET_LOG_LEVEL);
 #include <zephyr/sys/fdtable.h>
 #include <zephyr/net/net_core.h>
 #include <zephyr/net/net_ip.h>
+#include <zephyr/net/buf.h>
 #if defined(CONFIG_POSIX_API)
 #include <zephyr/posix/unistd.h>
 #include <zephyr/posix/sys/socket.h>
@@ -574,6 +575,37 @@ static int sendmsg_all(int sock, const struct msghdr *message, int flags)
 }
 #endif /* !defined(CONFIG_NET_TEST) */
 
+static int websocket_sendmsg(struct websocket_context *ctx,
+			     struct msghdr *msg, int32_t timeout)
+{
+	if (HEXDUMP_SENT_PACKETS) {
+		LOG_HEXDUMP_DBG(msg->msg_iov[0].iov_base,
+				msg->msg_iov[0].iov_len, "Header");
+		for (int i = 1; i < msg->msg_iovlen; i++) {
+			LOG_HEXDUMP_DBG(msg->msg_iov[i].iov_base,
+					msg->msg_iov[i].iov_len, "Payload");
+		}
+	}
+
+#if defined(CONFIG_NET_TEST)
+	uint8_t *header = msg->msg_iov[0].iov_base;
+
+	/* Simulate a case where the payload is split to two. The unit test
+	 * does not set mask bit in this case.
+	 */
+	return verify_sent_and_received_msg(msg, !(header[1] & BIT(7)));
+#else
+	k_timeout_t tout = K_FOREVER;
+
+	if (timeout != SYS_FOREVER_MS) {
+		tout = K_MSEC(timeout);
+	}
+
+	return sendmsg_all(ctx->real_sock, msg,
+			   K_TIMEOUT_EQ(tout, K_NO_WAIT) ? MSG_DONTWAIT : 0);
+#endif /* CONFIG_NET_TEST */
+}
+
 static int websocket_prepare_and_send(struct websocket_context *ctx,
 				      uint8_t *header, size_t header_len,
 				      uint8_t *payload, size_t payload_len,
@@ -592,41 +624,42 @@ static int websocket_prepare_and_send(struct websocket_context *ctx,
 	msg.msg_iov = io_vector;
 	msg.msg_iovlen = ARRAY_SIZE(io_vector);
 
-	if (HEXDUMP_SENT_PACKETS) {
-		LOG_HEXDUMP_DBG(header, header_len, "Header");
-		if ((payload != NULL) && (payload_len > 0)) {
-			LOG_HEXDUMP_DBG(payload, payload_len, "Payload");
-		} else {
-			LOG_DBG("No payload");
-		}
+	if (HEXDUMP_SENT_PACKETS && ((payload == NULL) || (payload_len == 0))) {
+		LOG_DBG("No payload");
 	}
 
-#if defined(CONFIG_NET_TEST)
-	/* Simulate a case where the payload is split to two. The unit test
-	 * does not set mask bit in this case.
+	return websocket_sendmsg(ctx, &msg, timeout);
+}
+
+void websocket_mask_payload(uint8_t *dst, const uint8_t *src, size_t len,
+			    uint32_t masking_value, size_t offset)
+{
+	uint8_t key[2 * sizeof(uint32_t)];
+	uint32_t key_word;
+	size_t i = 0;
+
+	/* The masking key bytes in transmission order, twice so that a word
+	 * of it can be taken starting from any position.
 	 */
-	return verify_sent_and_received_msg(&msg, !(header[1] & BIT(7)));
-#else
-	k_timeout_t tout = K_FOREVER;
+	sys_put_be32(masking_value, &key[0]);
+	sys_put_be32(masking_value, &key[sizeof(uint32_t)]);
+	memcpy(&key_word, &key[offset % sizeof(uint32_t)], sizeof(key_word));
 
-	if (timeout != SYS_FOREVER_MS) {
-		tout = K_MSEC(timeout);
+	for (; i + sizeof(uint32_t) <= len; i += sizeof(uint32_t)) {
+		uint32_t word;
+
+		memcpy(&word, &src[i], sizeof(word));
+		word ^= key_word;
+		memcpy(&dst[i], &word, sizeof(word));
 	}
 
-	return sendmsg_all(ctx->real_sock, &msg,
-			   K_TIMEOUT_EQ(tout, K_NO_WAIT) ? MSG_DONTWAIT : 0);
-#endif /* CONFIG_NET_TEST */
+	for (; i < len; i++) {
+		dst[i] = src[i] ^ key[(offset + i) % sizeof(uint32_t)];
+	}
 }
 
-int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
-		       enum websocket_opcode opcode, bool mask, bool final,
-		       int32_t timeout)
+static int websocket_check_opcode(enum websocket_opcode opcode)
 {
-	struct websocket_context *ctx;
-	uint8_t header[MAX_HEADER_LEN], hdr_len = 2;
-	uint8_t *data_to_send = (uint8_t *)payload;
-	int ret;
-
 	if (opcode != WEBSOCKET_OPCODE_DATA_TEXT &&
 	    opcode != WEBSOCKET_OPCODE_DATA_BINARY &&
 	    opcode != WEBSOCKET_OPCODE_CONTINUE &&
@@ -636,9 +669,17 @@ int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
 		return -EINVAL;
 	}
 
+	return 0;
+}
+
+static struct websocket_context *websocket_get_send_ctx(int ws_sock)
+{
+	struct websocket_context *ctx;
+
 	ctx = z_get_fd_obj(ws_sock, NULL, 0);
 	if (ctx == NULL) {
-		return -EBADF;
+		errno = EBADF;
+		return NULL;
 	}
 
 #if !defined(CONFIG_NET_TEST)
@@ -647,14 +688,23 @@ int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
 	 */
 
 	if (!PART_OF_ARRAY(contexts, ctx)) {
-		return -ENOENT;
+		errno = ENOENT;
+		return NULL;
 	}
 #endif /* !defined(CONFIG_NET_TEST) */
 
-	NET_DBG("[%p] Len %zd %s/%d/%s", ctx, payload_len, opcode2str(opcode),
-		mask, final ? "final" : "more");
+	return ctx;
+}
+
+/* Returns the length of the header */
+static size_t websocket_build_header(struct websocket_context *ctx,
+				     uint8_t *header, uint64_t payload_len,
+				     enum websocket_opcode opcode, bool mask,
+				     bool final)
+{
+	size_t hdr_len = 2;
 
-	memset(header, 0, sizeof(header));
+	memset(header, 0, MAX_HEADER_LEN);
 
 	/* Is this the last packet? */
 	header[0] = final ? BIT(7) : 0;
@@ -687,27 +737,50 @@ int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
 
 	/* Add masking value if needed */
 	if (mask) {
-		int i;
-
 		ctx->masking_value = sys_rand32_get();
 
 		header[hdr_len++] |= ctx->masking_value >> 24;
 		header[hdr_len++] |= ctx->masking_value >> 16;
 		header[hdr_len++] |= ctx->masking_value >> 8;
 		header[hdr_len++] |= ctx->masking_value;
+	}
 
-		if ((payload != NULL) && (payload_len > 0)) {
-			data_to_send = k_malloc(payload_len);
-			if (!data_to_send) {
-				return -ENOMEM;
-			}
+	return hdr_len;
+}
 
-			memcpy(data_to_send, payload, payload_len);
+int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
+		       enum websocket_opcode opcode, bool mask, bool final,
+		       int32_t timeout)
+{
+	struct websocket_context *ctx;
+	uint8_t header[MAX_HEADER_LEN], hdr_len;
+	uint8_t *data_to_send = (uint8_t *)payload;
+	int ret;
 
-			for (i = 0; i < payload_len; i++) {
-				data_to_send[i] ^= ctx->masking_value >> (8 * (3 - i % 4));
-			}
+	if (websocket_check_opcode(opcode) < 0) {
+		return -EINVAL;
+	}
+
+	ctx = websocket_get_send_ctx(ws_sock);
+	if (ctx == NULL) {
+		return -errno;
+	}
+
+	NET_DBG("[%p] Len %zd %s/%d/%s", ctx, payload_len, opcode2str(opcode),
+		mask, final ? "final" : "more");
+
+	hdr_len = websocket_build_header(ctx, header, payload_len, opcode,
+					 mask, final);
+
+	if (mask && (payload != NULL) && (payload_len > 0)) {
+		data_to_send = k_malloc(payload_len);
+		if (!data_to_send) {
+			return -ENOMEM;
 		}
+
+		/* Copy and mask in one pass */
+		websocket_mask_payload(data_to_send, payload, payload_len,
+				       ctx->masking_value, 0);
 	}
 
 	ret = websocket_prepare_and_send(ctx, header, hdr_len,
@@ -730,6 +803,89 @@ quit:
 	return ret - hdr_len;
 }
 
+int websocket_send_msg_buf(int ws_sock, struct net_buf *payload,
+			   enum websocket_opcode opcode, bool mask, bool final,
+			   int32_t timeout)
+{
+	struct websocket_context *ctx;
+	struct iovec io_vector[WEBSOCKET_TX_IOV_MAX];
+	uint8_t header[MAX_HEADER_LEN];
+	struct msghdr msg = { 0 };
+	size_t payload_len, hdr_len, offset = 0;
+	struct net_buf *frag;
+	int sent = 0;
+	int ret;
+
+	if (websocket_check_opcode(opcode) < 0) {
+		return -EINVAL;
+	}
+
+	ctx = websocket_get_send_ctx(ws_sock);
+	if (ctx == NULL) {
+		return -errno;
+	}
+
+	payload_len = payload != NULL ? net_buf_frags_len(payload) : 0;
+
+	NET_DBG("[%p] Len %zd %s/%d/%s", ctx, payload_len, opcode2str(opcode),
+		mask, final ? "final" : "more");
+
+	hdr_len = websocket_build_header(ctx, header, payload_len, opcode,
+					 mask, final);
+
+	io_vector[0].iov_base = header;
+	io_vector[0].iov_len = hdr_len;
+	msg.msg_iov = io_vector;
+	msg.msg_iovlen = 1;
+
+	/* The buffers are sent as they are, the masking is done in place
+	 * while building the vectors, which the stack then copies once.
+	 */
+	for (frag = payload; frag != NULL; frag = frag->frags) {
+		if (frag->len == 0) {
+			continue;
+		}
+
+		if (mask) {
+			websocket_mask_payload(frag->data, frag->data, frag->len,
+					       ctx->masking_value, offset);
+		}
+
+		offset += frag->len;
+
+		io_vector[msg.msg_iovlen].iov_base = frag->data;
+		io_vector[msg.msg_iovlen].iov_len = frag->len;
+		msg.msg_iovlen++;
+
+		if (msg.msg_iovlen < ARRAY_SIZE(io_vector) &&
+		    frag->frags != NULL) {
+			continue;
+		}
+
+		ret = websocket_sendmsg(ctx, &msg, timeout);
+		if (ret < 0) {
+			NET_DBG("Cannot send ws msg (%d)", ret);
+			return ret;
+		}
+
+		sent += ret;
+		msg.msg_iovlen = 0;
+	}
+
+	/* Header only, or the chain ended with empty buffers */
+	if (msg.msg_iovlen > 0) {
+		ret = websocket_sendmsg(ctx, &msg, timeout);
+		if (ret < 0) {
+			NET_DBG("Cannot send ws msg (%d)", ret);
+			return ret;
+		}
+
+		sent += ret;
+	}
+
+	return sent - (int)hdr_len;
+}
+
 static uint32_t websocket_opcode2flag(uint8_t data)
 {
 	switch (data & 0x0f) {
@@ -749,11 +905,91 @@ static uint32_t websocket_opcode2flag(uint8_t data)
 	return 0;
 }
 
-static int websocket_parse(struct websocket_context *ctx, struct websocket_buffer *payload)
+/* Parse one byte of a frame header */
+static int websocket_parse_header(struct websocket_context *ctx, uint8_t data)
 {
 	int len;
+
+	switch (ctx->parser_state) {
+	case WEBSOCKET_PARSER_STATE_OPCODE:
+		ctx->message_type = websocket_opcode2flag(data);
+		if ((data & 0x80) != 0) {
+			ctx->message_type |= WEBSOCKET_FLAG_FINAL;
+		}
+		ctx->parser_state = WEBSOCKET_PARSER_STATE_LENGTH;
+		break;
+	case WEBSOCKET_PARSER_STATE_LENGTH:
+		ctx->masked = (data & 0x80) != 0;
+		len = data & 0x7f;
+		if (len < 126) {
+			ctx->message_len = len;
+			if (ctx->masked) {
+				ctx->masking_value = 0;
+				ctx->parser_remaining = 4;
+				ctx->parser_state = WEBSOCKET_PARSER_STATE_MASK;
+			} else {
+				ctx->parser_remaining = ctx->message_len;
+				ctx->parser_state =
+					(ctx->parser_remaining == 0)
+						? WEBSOCKET_PARSER_STATE_OPCODE
+						: WEBSOCKET_PARSER_STATE_PAYLOAD;
+			}
+		} else {
+			ctx->message_len = 0;
+			ctx->parser_remaining = (len < 127) ? 2 : 8;
+			ctx->parser_state = WEBSOCKET_PARSER_STATE_EXT_LEN;
+		}
+		break;
+	case WEBSOCKET_PARSER_STATE_EXT_LEN:
+		ctx->parser_remaining--;
+		ctx->message_len |= ((uint64_t)data << (ctx->parser_remaining * 8));
+		if (ctx->parser_remaining == 0) {
+			if (ctx->masked) {
+				ctx->masking_value = 0;
+				ctx->parser_remaining = 4;
+				ctx->parser_state = WEBSOCKET_PARSER_STATE_MASK;
+			} else {
+				ctx->parser_remaining = ctx->message_len;
+				ctx->parser_state = WEBSOCKET_PARSER_STATE_PAYLOAD;
+			}
+		}
+		break;
+	case WEBSOCKET_PARSER_STATE_MASK:
+		ctx->parser_remaining--;
+		ctx->masking_value |= (data << (ctx->parser_remaining * 8));
+		if (ctx->parser_remaining == 0) {
+			if (ctx->message_len == 0) {
+				ctx->parser_remaining = 0;
+				ctx->parser_state = WEBSOCKET_PARSER_STATE_OPCODE;
+			} else {
+				ctx->parser_remaining = ctx->message_len;
+				ctx->parser_state = WEBSOCKET_PARSER_STATE_PAYLOAD;
+			}
+		}
+		break;
+	default:
+		return -EFAULT;
+	}
+
+#if (LOG_LEVEL >= LOG_LEVEL_DBG)
+	if ((ctx->parser_state == WEBSOCKET_PARSER_STATE_PAYLOAD) ||
+	    ((ctx->parser_state == WEBSOCKET_PARSER_STATE_OPCODE) &&
+	     (ctx->message_len == 0))) {
+		NET_DBG("[%p] %smasked, mask 0x%08x, type 0x%02x, msg %zd", ctx,
+			ctx->masked ? "" : "un",
+			ctx->masked ? ctx->masking_value : 0, ctx->message_type,
+			(size_t)ctx->message_len);
+	}
+#endif
+
+	return 0;
+}
+
+static int websocket_parse(struct websocket_context *ctx, struct websocket_buffer *payload)
+{
 	uint8_t data;
 	size_t parsed_count = 0;
+	int ret;
 
 	do {
 		if (parsed_count >= ctx->recv_buf.count) {
@@ -762,77 +998,10 @@ static int websocket_parse(struct websocket_context *ctx, struct websocket_buffe
 		if (ctx->parser_state != WEBSOCKET_PARSER_STATE_PAYLOAD) {
 			data = ctx->recv_buf.buf[parsed_count++];
 
-			switch (ctx->parser_state) {
-			case WEBSOCKET_PARSER_STATE_OPCODE:
-				ctx->message_type = websocket_opcode2flag(data);
-				if ((data & 0x80) != 0) {
-					ctx->message_type |= WEBSOCKET_FLAG_FINAL;
-				}
-				ctx->parser_state = WEBSOCKET_PARSER_STATE_LENGTH;
-				break;
-			case WEBSOCKET_PARSER_STATE_LENGTH:
-				ctx->masked = (data & 0x80) != 0;
-				len = data & 0x7f;
-				if (len < 126) {
-					ctx->message_len = len;
-					if (ctx->masked) {
-						ctx->masking_value = 0;
-						ctx->parser_remaining = 4;
-						ctx->parser_state = WEBSOCKET_PARSER_STATE_MASK;
-					} else {
-						ctx->parser_remaining = ctx->message_len;
-						ctx->parser_state =
-							(ctx->parser_remaining == 0)
-								? WEBSOCKET_PARSER_STATE_OPCODE
-								: WEBSOCKET_PARSER_STATE_PAYLOAD;
-					}
-				} else {
-					ctx->message_len = 0;
-					ctx->parser_remaining = (len < 127) ? 2 : 8;
-					ctx->parser_state = WEBSOCKET_PARSER_STATE_EXT_LEN;
-				}
-				break;
-			case WEBSOCKET_PARSER_STATE_EXT_LEN:
-				ctx->parser_remaining--;
-				ctx->message_len |= ((uint64_t)data << (ctx->parser_remaining * 8));
-				if (ctx->parser_remaining == 0) {
-					if (ctx->masked) {
-						ctx->masking_value = 0;
-						ctx->parser_remaining = 4;
-						ctx->parser_state = WEBSOCKET_PARSER_STATE_MASK;
-					} else {
-						ctx->parser_remaining = ctx->message_len;
-						ctx->parser_state = WEBSOCKET_PARSER_STATE_PAYLOAD;
-					}
-				}
-				break;
-			case WEBSOCKET_PARSER_STATE_MASK:
-				ctx->parser_remaining--;
-				ctx->masking_value |= (data << (ctx->parser_remaining * 8));
-				if (ctx->parser_remaining == 0) {
-					if (ctx->message_len == 0) {
-						ctx->parser_remaining = 0;
-						ctx->parser_state = WEBSOCKET_PARSER_STATE_OPCODE;
-					} else {
-						ctx->parser_remaining = ctx->message_len;
-						ctx->parser_state = WEBSOCKET_PARSER_STATE_PAYLOAD;
-					}
-				}
-				break;
-			default:
-				return -EFAULT;
-			}
-
-#if (LOG_LEVEL >= LOG_LEVEL_DBG)
-			if ((ctx->parser_state == WEBSOCKET_PARSER_STATE_PAYLOAD) ||
-			    ((ctx->parser_state == WEBSOCKET_PARSER_STATE_OPCODE) &&
-			     (ctx->message_len == 0))) {
-				NET_DBG("[%p] %smasked, mask 0x%08x, type 0x%02x, msg %zd", ctx,
-					ctx->masked ? "" : "un",
-					ctx->masked ? ctx->masking_value : 0, ctx->message_type,
-					(size_t)ctx->message_len);
+			ret = websocket_parse_header(ctx, data);
+			if (ret < 0) {
+				return ret;
 			}
-#endif
 		} else {
 			size_t remaining_in_recv_buf = ctx->recv_buf.count - parsed_count;
 			size_t payload_in_recv_buf =
@@ -903,6 +1072,58 @@ static int timeout_to_ms(k_timeout_t *timeout)
 
 #endif /* !defined(CONFIG_NET_TEST) */
 
+/* Receive more data at the end of the receive buffer */
+static int websocket_recv_more(struct websocket_context *ctx, void *fd_obj,
+			       k_timepoint_t end)
+{
+	uint8_t *buf = &ctx->recv_buf.buf[ctx->recv_buf.count];
+	size_t len = ctx->recv_buf.size - ctx->recv_buf.count;
+	int ret;
+
+#if defined(CONFIG_NET_TEST)
+	struct test_data *test_data = fd_obj;
+	size_t input_len = MIN(len, test_data->input_len - test_data->input_pos);
+
+	ARG_UNUSED(end);
+
+	if (input_len > 0) {
+		memcpy(buf, &test_data->input_buf[test_data->input_pos], input_len);
+		test_data->input_pos += input_len;
+		ret = input_len;
+	} else {
+		/* emulate timeout */
+		ret = -EAGAIN;
+	}
+#else
+	k_timeout_t tout = sys_timepoint_timeout(end);
+
+	ARG_UNUSED(fd_obj);
+
+	ret = wait_rx(ctx->real_sock, timeout_to_ms(&tout));
+	if (ret == 0) {
+		ret = recv(ctx->real_sock, buf, len, MSG_DONTWAIT);
+		if (ret < 0) {
+			ret = -errno;
+		}
+	}
+#endif /* CONFIG_NET_TEST */
+
+	if (ret < 0) {
+		return ret;
+	}
+
+	if (ret == 0) {
+		/* Socket closed */
+		return -ENOTCONN;
+	}
+
+	ctx->recv_buf.count += ret;
+
+	NET_DBG("[%p] Received %d bytes", ctx, ret);
+
+	return ret;
+}
+
 int websocket_recv_msg(int ws_sock, uint8_t *buf, size_t buf_len,
 		       uint32_t *message_type, uint64_t *remaining, int32_t timeout)
 {
@@ -911,6 +1132,7 @@ int websocket_recv_msg(int ws_sock, uint8_t *buf, size_t buf_len,
 	k_timepoint_t end;
 	k_timeout_t tout = K_FOREVER;
 	struct websocket_buffer payload = {.buf = buf, .size = buf_len, .count = 0};
+	void *fd_obj;
 
 	if (timeout != SYS_FOREVER_MS) {
 		tout = K_MSEC(timeout);
@@ -922,19 +1144,15 @@ int websocket_recv_msg(int ws_sock, uint8_t *buf, size_t buf_len,
 
 	end = sys_timepoint_calc(tout);
 
-#if defined(CONFIG_NET_TEST)
-	struct test_data *test_data = z_get_fd_obj(ws_sock, NULL, 0);
-
-	if (test_data == NULL) {
+	fd_obj = z_get_fd_obj(ws_sock, NULL, 0);
+	if (fd_obj == NULL) {
 		return -EBADF;
 	}
 
-	ctx = test_data->ctx;
+#if defined(CONFIG_NET_TEST)
+	ctx = ((struct test_data *)fd_obj)->ctx;
 #else
-	ctx = z_get_fd_obj(ws_sock, NULL, 0);
-	if (ctx == NULL) {
-		return -EBADF;
-	}
+	ctx = fd_obj;
 
 	if (!PART_OF_ARRAY(contexts, ctx)) {
 		return -ENOENT;
@@ -945,32 +1163,7 @@ int websocket_recv_msg(int ws_sock, uint8_t *buf, size_t buf_len,
 		size_t parsed_count;
 
 		if (ctx->recv_buf.count == 0) {
-#if defined(CONFIG_NET_TEST)
-			size_t input_len = MIN(ctx->recv_buf.size,
-					       test_data->input_len - test_data->input_pos);
-
-			if (input_len > 0) {
-				memcpy(ctx->recv_buf.buf,
-				       &test_data->input_buf[test_data->input_pos], input_len);
-				test_data->input_pos += input_len;
-				ret = input_len;
-			} else {
-				/* emulate timeout */
-				ret = -EAGAIN;
-			}
-#else
-			tout = sys_timepoint_timeout(end);
-
-			ret = wait_rx(ctx->real_sock, timeout_to_ms(&tout));
-			if (ret == 0) {
-				ret = recv(ctx->real_sock, ctx->recv_buf.buf,
-					   ctx->recv_buf.size, MSG_DONTWAIT);
-				if (ret < 0) {
-					ret = -errno;
-				}
-			}
-#endif /* CONFIG_NET_TEST */
-
+			ret = websocket_recv_more(ctx, fd_obj, end);
 			if (ret < 0) {
 				if ((ret == -EAGAIN) && (payload.count > 0)) {
 					/* go to unmasking */
@@ -978,15 +1171,6 @@ int websocket_recv_msg(int ws_sock, uint8_t *buf, size_t buf_len,
 				}
 				return ret;
 			}
-
-			if (ret == 0) {
-				/* Socket closed */
-				return -ENOTCONN;
-			}
-
-			ctx->recv_buf.count = ret;
-
-			NET_DBG("[%p] Received %d bytes", ctx, ret);
 		}
 
 		ret = websocket_parse(ctx, &payload);
@@ -1019,18 +1203,127 @@ int websocket_recv_msg(int ws_sock, uint8_t *buf, size_t buf_len,
 
 	/* Unmask the data */
 	if (ctx->masked) {
-		uint8_t *mask_as_bytes = (uint8_t *)&ctx->masking_value;
 		size_t data_buf_offset = ctx->message_len - ctx->parser_remaining - payload.count;
 
-		for (size_t i = 0; i < payload.count; i++) {
-			size_t m = data_buf_offset % 4;
+		websocket_mask_payload(payload.buf, payload.buf, payload.count,
+				       ctx->masking_value, data_buf_offset);
+	}
+
+	return payload.count;
+}
+
+/* Hand the payload in the receive buffer to the callback, unmasked in place.
+ * Frames are given whole, unless they do not fit into the receive buffer.
+ */
+static int websocket_deliver_frames(struct websocket_context *ctx, int ws_sock,
+				    websocket_frame_cb_t cb, void *user_data)
+{
+	uint8_t *buf = ctx->recv_buf.buf;
+	size_t parsed_count = 0;
+	int delivered = 0;
+	int ret;
+
+	while (parsed_count < ctx->recv_buf.count) {
+		size_t avail, offset;
+
+		if (ctx->parser_state != WEBSOCKET_PARSER_STATE_PAYLOAD) {
+			ret = websocket_parse_header(ctx, buf[parsed_count++]);
+			if (ret < 0) {
+				return ret;
+			}
 
-			payload.buf[i] ^= mask_as_bytes[3 - m];
-			data_buf_offset++;
+			if (ctx->parser_state == WEBSOCKET_PARSER_STATE_OPCODE) {
+				/* Frame without payload */
+				ret = cb(ws_sock, ctx->message_type, NULL, 0, 0,
+					 user_data);
+				if (ret < 0) {
+					return ret;
+				}
+			}
+
+			continue;
+		}
+
+		avail = MIN(ctx->recv_buf.count - parsed_count,
+			    ctx->parser_remaining);
+
+		if (avail < ctx->parser_remaining &&
+		    ctx->parser_remaining <= ctx->recv_buf.size) {
+			/* Wait for the rest of the frame */
+			break;
+		}
+
+		offset = ctx->message_len - ctx->parser_remaining;
+
+		if (ctx->masked) {
+			websocket_mask_payload(&buf[parsed_count], &buf[parsed_count],
+					       avail, ctx->masking_value, offset);
+		}
+
+		ctx->parser_remaining -= avail;
+		if (ctx->parser_remaining == 0) {
+			ctx->parser_state = WEBSOCKET_PARSER_STATE_OPCODE;
+		}
+
+		ret = cb(ws_sock, ctx->message_type, &buf[parsed_count], avail,
+			 ctx->parser_remaining, user_data);
+		if (ret < 0) {
+			return ret;
 		}
+
+		parsed_count += avail;
+		delivered += avail;
 	}
 
-	return payload.count;
+	/* Keep the start of an incomplete frame */
+	ctx->recv_buf.count -= parsed_count;
+	if (ctx->recv_buf.count > 0) {
+		memmove(buf, &buf[parsed_count], ctx->recv_buf.count);
+	}
+
+	return delivered;
+}
+
+int websocket_recv_frames(int ws_sock, websocket_frame_cb_t cb,
+			  void *user_data, int32_t timeout)
+{
+	struct websocket_context *ctx;
+	k_timeout_t tout = K_FOREVER;
+	k_timepoint_t end;
+	void *fd_obj;
+	int ret;
+
+	if (cb == NULL) {
+		return -EINVAL;
+	}
+
+	if (timeout != SYS_FOREVER_MS) {
+		tout = K_MSEC(timeout);
+	}
+
+	end = sys_timepoint_calc(tout);
+
+	fd_obj = z_get_fd_obj(ws_sock, NULL, 0);
+	if (fd_obj == NULL) {
+		return -EBADF;
+	}
+
+#if defined(CONFIG_NET_TEST)
+	ctx = ((struct test_data *)fd_obj)->ctx;
+#else
+	ctx = fd_obj;
+
+	if (!PART_OF_ARRAY(contexts, ctx)) {
+		return -ENOENT;
+	}
+#endif /* CONFIG_NET_TEST */
+
+	ret = websocket_recv_more(ctx, fd_obj, end);
+	if (ret < 0) {
+		return ret;
+	}
+
+	return websocket_deliver_frames(ctx, ws_sock, cb, user_data);
 }
 
 static int websocket_send(struct websocket_context *ctx, const uint8_t *buf,
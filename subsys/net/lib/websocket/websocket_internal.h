@@ -20,6 +20,9 @@
 /* Max Websocket header length */
 #define MAX_HEADER_LEN 14
 
+/* Max number of buffers given to one sendmsg() call */
+#define WEBSOCKET_TX_IOV_MAX 8
+
 /* From RFC 6455 chapter 4.2.2 */
 #define WS_MAGIC "258EAFA5-E914-47DA-95CA-C5AB0DC85B11"
 
@@ -150,6 +153,18 @@ struct test_data {
  */
 int websocket_disconnect(int sock);
 
+/**
+ * @brief Mask or unmask Websocket payload, a word at a time.
+ *
+ * @param dst Destination of the masked data, may be the same as src.
+ * @param src Data to mask.
+ * @param len Length of the data.
+ * @param masking_value Masking key of the frame.
+ * @param offset Offset of the data in the payload of the frame.
+ */
+void websocket_mask_payload(uint8_t *dst, const uint8_t *src, size_t len,
+			    uint32_t masking_value, size_t offset);
+
 /**
  * @typedef websocket_context_cb_t
  * @brief Callback used while iterating over websocket contexts
@@ -206,6 +206,94 @@ uint32_t zperf_packet_duration(uint32_t packet_size, uint32_t rate_in_kbps)
 			  (rate_in_kbps * 1024U));
 }
 
+/* Ask an iPerf 2 server to run a test back to us while receiving ours, the
+ * equivalent of its -d client option.
+ */
+void zperf_fill_dual_hdr(struct zperf_client_hdr_v1 *hdr,
+			 const struct zperf_upload_params *param)
+{
+	hdr->flags = htonl(ZPERF_FLAGS_VERSION1 | ZPERF_FLAGS_RUN_NOW);
+	hdr->num_of_threads = htonl(MAX(param->num_streams, 1));
+	hdr->port = htonl(param->dual_port);
+	hdr->buffer_len = htonl(param->packet_size);
+	hdr->bandwidth = htonl(param->rate_kbps * 1000U);
+	/* A negative amount is a duration in 10 ms units */
+	hdr->num_of_bytes = htonl(-(int32_t)(param->duration_ms / 10U));
+}
+
+void zperf_cpu_stats_get(struct zperf_cpu_stats *stats)
+{
+#if defined(CONFIG_NET_ZPERF_CPU_LOAD)
+	k_thread_runtime_stats_t rt_stats;
+
+	(void)k_thread_runtime_stats_all_get(&rt_stats);
+
+	/* total_cycles is the non-idle part of execution_cycles */
+	stats->busy_cycles = rt_stats.total_cycles;
+	stats->all_cycles = rt_stats.execution_cycles;
+#else
+	stats->busy_cycles = 0U;
+	stats->all_cycles = 0U;
+#endif
+}
+
+uint32_t zperf_cpu_load(const struct zperf_cpu_stats *start,
+			const struct zperf_cpu_stats *end)
+{
+	uint64_t all = end->all_cycles - start->all_cycles;
+
+	if (all == 0U) {
+		return 0U;
+	}
+
+	return (uint32_t)((end->busy_cycles - start->busy_cycles) * 100U / all);
+}
+
+void zperf_report_init(struct zperf_report *report, uint32_t interval_ms,
+		       zperf_callback callback, void *user_data,
+		       int64_t start_time)
+{
+	*report = (struct zperf_report) {
+		.callback = callback,
+		.user_data = user_data,
+		.start_time = start_time,
+	};
+
+	if (callback != NULL && interval_ms != 0U) {
+		report->period = k_ms_to_ticks_ceil64(interval_ms);
+		zperf_cpu_stats_get(&report->cpu);
+	}
+}
+
+void zperf_report_update(struct zperf_report *report, int64_t now,
+			 uint32_t nb_packets, uint32_t nb_errors,
+			 uint32_t packet_size)
+{
+	struct zperf_results results = { 0 };
+	struct zperf_cpu_stats cpu;
+
+	if (report->period == 0 || now - report->start_time < report->period) {
+		return;
+	}
+
+	zperf_cpu_stats_get(&cpu);
+
+	results.nb_packets_sent = nb_packets - report->nb_packets;
+	results.nb_packets_errors = nb_errors - report->nb_errors;
+	results.client_time_in_us =
+		k_ticks_to_us_ceil32(now - report->start_time);
+	results.packet_size = packet_size;
+	results.cpu_load = zperf_cpu_load(&report->cpu, &cpu);
+
+	report->callback(ZPERF_SESSION_PERIODIC_RESULT, &results,
+			 report->user_data);
+
+	report->start_time = now;
+	report->nb_packets = nb_packets;
+	report->nb_errors = nb_errors;
+	report->cpu = cpu;
+}
+
 void zperf_async_work_submit(struct k_work *work)
 {
 	k_work_submit_to_queue(&zperf_work_q, work);
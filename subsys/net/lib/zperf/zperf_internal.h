@@ -38,6 +38,7 @@
 #endif
 
 #define PACKET_SIZE_MAX CONFIG_NET_ZPERF_MAX_PACKET_SIZE
+#define STREAMS_MAX CONFIG_NET_ZPERF_MAX_STREAMS
 
 #define MY_SRC_PORT 50000
 #define DEF_PORT 5001
@@ -53,6 +54,10 @@ struct zperf_udp_datagram {
 
 BUILD_ASSERT(sizeof(struct zperf_udp_datagram) <= PACKET_SIZE_MAX, "Invalid PACKET_SIZE_MAX");
 
+/* Client header flags, as in include/Settings.hpp of iPerf 2 */
+#define ZPERF_FLAGS_VERSION1 0x80000000
+#define ZPERF_FLAGS_RUN_NOW  0x00000001
+
 struct zperf_client_hdr_v1 {
 	int32_t flags;
 	int32_t num_of_threads;
@@ -82,6 +87,24 @@ struct zperf_async_upload_context {
 	void *user_data;
 };
 
+struct zperf_cpu_stats {
+	uint64_t busy_cycles;
+	uint64_t all_cycles;
+};
+
+/* Periodic reports of an upload */
+struct zperf_report {
+	zperf_callback callback;
+	void *user_data;
+	/* Report period in ticks, 0 if disabled */
+	int64_t period;
+	/* State at the start of the current interval */
+	int64_t start_time;
+	uint32_t nb_packets;
+	uint32_t nb_errors;
+	struct zperf_cpu_stats cpu;
+};
+
 static inline uint32_t time_delta(uint32_t ts, uint32_t t)
 {
 	return (t >= ts) ? (t - ts) : (ULONG_MAX - ts + t);
@@ -100,6 +123,20 @@ int zperf_prepare_upload_sock(const struct sockaddr *peer_addr, int tos,
 
 uint32_t zperf_packet_duration(uint32_t packet_size, uint32_t rate_in_kbps);
 
+void zperf_fill_dual_hdr(struct zperf_client_hdr_v1 *hdr,
+			 const struct zperf_upload_params *param);
+
+void zperf_cpu_stats_get(struct zperf_cpu_stats *stats);
+uint32_t zperf_cpu_load(const struct zperf_cpu_stats *start,
+			const struct zperf_cpu_stats *end);
+
+void zperf_report_init(struct zperf_report *report, uint32_t interval_ms,
+		       zperf_callback callback, void *user_data,
+		       int64_t start_time);
+void zperf_report_update(struct zperf_report *report, int64_t now,
+			 uint32_t nb_packets, uint32_t nb_errors,
+			 uint32_t packet_size);
+
 void zperf_async_work_submit(struct k_work *work);
 void zperf_udp_uploader_init(void);
 void zperf_tcp_uploader_init(void);
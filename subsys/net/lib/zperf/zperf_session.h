@@ -49,6 +49,7 @@ struct session {
 	uint32_t last_time;
 	int32_t jitter;
 	int32_t last_transit_time;
+	struct zperf_cpu_stats cpu_start;
 
 	/* Stats packet*/
 	struct zperf_server_hdr stat;
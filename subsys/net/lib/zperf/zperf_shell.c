@@ -334,9 +334,18 @@ static void udp_session_cb(enum zperf_status status,
 		print_number(sh, rate_in_kbps, KBPS, KBPS_UNIT);
 		shell_fprintf(sh, SHELL_NORMAL, "\n");
 
+		if (IS_ENABLED(CONFIG_NET_ZPERF_CPU_LOAD)) {
+			shell_fprintf(sh, SHELL_NORMAL, " CPU load:\t\t%u %%\n",
+				      result->cpu_load);
+		}
+
 		break;
 	}
 
+	case ZPERF_SESSION_PERIODIC_RESULT:
+		/* Only reported by uploads */
+		break;
+
 	case ZPERF_SESSION_ERROR:
 		shell_fprintf(sh, SHELL_ERROR, "UDP session error.\n");
 		break;
@@ -458,6 +467,11 @@ static void shell_udp_upload_print_stats(const struct shell *sh,
 		shell_fprintf(sh, SHELL_NORMAL, "\t(");
 		print_number(sh, client_rate_in_kbps, KBPS, KBPS_UNIT);
 		shell_fprintf(sh, SHELL_NORMAL, ")\n");
+
+		if (IS_ENABLED(CONFIG_NET_ZPERF_CPU_LOAD)) {
+			shell_fprintf(sh, SHELL_NORMAL, "CPU load:\t\t(%u %%)\n",
+				      results->cpu_load);
+		}
 	}
 }
 
@@ -491,7 +505,41 @@ static void shell_tcp_upload_print_stats(const struct shell *sh,
 		shell_fprintf(sh, SHELL_NORMAL, "Rate:\t\t");
 		print_number(sh, client_rate_in_kbps, KBPS, KBPS_UNIT);
 		shell_fprintf(sh, SHELL_NORMAL, "\n");
+
+		if (IS_ENABLED(CONFIG_NET_ZPERF_CPU_LOAD)) {
+			shell_fprintf(sh, SHELL_NORMAL, "CPU load:\t%u %%\n",
+				      results->cpu_load);
+		}
+	}
+}
+
+static void shell_upload_print_periodic(const struct shell *sh,
+					struct zperf_results *results)
+{
+	unsigned int client_rate_in_kbps;
+
+	if (results->client_time_in_us != 0U) {
+		client_rate_in_kbps = (uint32_t)
+			(((uint64_t)results->nb_packets_sent *
+			  (uint64_t)results->packet_size * (uint64_t)8 *
+			  (uint64_t)USEC_PER_SEC) /
+			 ((uint64_t)results->client_time_in_us * 1000U));
+	} else {
+		client_rate_in_kbps = 0U;
 	}
+
+	shell_fprintf(sh, SHELL_NORMAL, "Interval ");
+	print_number(sh, results->client_time_in_us, TIME_US, TIME_US_UNIT);
+	shell_fprintf(sh, SHELL_NORMAL, ":\t%u packets\t",
+		      results->nb_packets_sent);
+	print_number(sh, client_rate_in_kbps, KBPS, KBPS_UNIT);
+
+	if (IS_ENABLED(CONFIG_NET_ZPERF_CPU_LOAD)) {
+		shell_fprintf(sh, SHELL_NORMAL, "\tCPU load %u %%",
+			      results->cpu_load);
+	}
+
+	shell_fprintf(sh, SHELL_NORMAL, "\n");
 }
 
 static void udp_upload_cb(enum zperf_status status,
@@ -504,6 +552,10 @@ static void udp_upload_cb(enum zperf_status status,
 	case ZPERF_SESSION_STARTED:
 		break;
 
+	case ZPERF_SESSION_PERIODIC_RESULT:
+		shell_upload_print_periodic(sh, result);
+		break;
+
 	case ZPERF_SESSION_FINISHED: {
 		shell_udp_upload_print_stats(sh, result);
 		break;
@@ -525,6 +577,10 @@ static void tcp_upload_cb(enum zperf_status status,
 	case ZPERF_SESSION_STARTED:
 		break;
 
+	case ZPERF_SESSION_PERIODIC_RESULT:
+		shell_upload_print_periodic(sh, result);
+		break;
+
 	case ZPERF_SESSION_FINISHED: {
 		shell_tcp_upload_print_stats(sh, result);
 		break;
@@ -587,6 +643,45 @@ static void send_ping(const struct shell *sh,
 	(void)net_icmp_cleanup_ctx(&ctx);
 }
 
+static void tcp_session_cb(enum zperf_status status,
+			   struct zperf_results *result,
+			   void *user_data);
+
+/* The server of a bidirectional test connects back to the download server */
+static int start_dual_server(const struct shell *sh,
+			     const struct zperf_upload_params *param,
+			     bool is_udp)
+{
+	struct zperf_download_params dl_param = {
+		.port = param->dual_port,
+	};
+	int ret = -ENOTSUP;
+
+	if (is_udp && IS_ENABLED(CONFIG_NET_UDP)) {
+		ret = zperf_udp_download(&dl_param, udp_session_cb, (void *)sh);
+	} else if (!is_udp && IS_ENABLED(CONFIG_NET_TCP)) {
+		ret = zperf_tcp_download(&dl_param, tcp_session_cb, (void *)sh);
+	}
+
+	if (ret == -EALREADY) {
+		shell_fprintf(sh, SHELL_NORMAL,
+			      "Using the running %s server for the reverse "
+			      "test, it must listen on port %u\n",
+			      is_udp ? "UDP" : "TCP", param->dual_port);
+		return 0;
+	} else if (ret < 0) {
+		shell_fprintf(sh, SHELL_ERROR,
+			      "Failed to start %s server (%d)\n",
+			      is_udp ? "UDP" : "TCP", ret);
+		return ret;
+	}
+
+	shell_fprintf(sh, SHELL_NORMAL, "%s server started on port %u\n",
+		      is_udp ? "UDP" : "TCP", param->dual_port);
+
+	return 0;
+}
+
 static int execute_upload(const struct shell *sh,
 			  const struct zperf_upload_params *param,
 			  bool is_udp, bool async)
@@ -602,6 +697,19 @@ static int execute_upload(const struct shell *sh,
 		      param->packet_size);
 	shell_fprintf(sh, SHELL_NORMAL, "Rate:\t\t%u kbps\n",
 		      param->rate_kbps);
+
+	if (param->num_streams > 1) {
+		shell_fprintf(sh, SHELL_NORMAL, "Streams:\t%u\n",
+			      param->num_streams);
+	}
+
+	if (param->dual_port != 0U) {
+		ret = start_dual_server(sh, param, is_udp);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
 	shell_fprintf(sh, SHELL_NORMAL, "Starting...\n");
 
 	if (IS_ENABLED(CONFIG_NET_IPV6) && param->peer_addr.sa_family == AF_INET6) {
@@ -754,6 +862,42 @@ static int shell_cmd_upload(const struct shell *sh, size_t argc,
 			opt_cnt += 1;
 			break;
 
+		case 'P': {
+			int num_streams = parse_arg(&i, argc, argv);
+
+			if (num_streams < 1 ||
+			    num_streams > CONFIG_NET_ZPERF_MAX_STREAMS) {
+				shell_fprintf(sh, SHELL_WARNING,
+					      "Parse error: %s\n", argv[i]);
+				return -ENOEXEC;
+			}
+
+			param.num_streams = num_streams;
+			opt_cnt += 2;
+			break;
+		}
+
+		case 'i': {
+			int interval = parse_arg(&i, argc, argv);
+
+			if (interval < 1) {
+				shell_fprintf(sh, SHELL_WARNING,
+					      "Parse error: %s\n", argv[i]);
+				return -ENOEXEC;
+			}
+
+			/* Reports are given by the asynchronous callback */
+			param.report_interval_ms = interval * MSEC_PER_SEC;
+			async = true;
+			opt_cnt += 2;
+			break;
+		}
+
+		case 'd':
+			param.dual_port = DEF_PORT;
+			opt_cnt += 1;
+			break;
+
 		case 'n':
 			if (is_udp) {
 				shell_fprintf(sh, SHELL_WARNING,
@@ -940,6 +1084,42 @@ static int shell_cmd_upload2(const struct shell *sh, size_t argc,
 			opt_cnt += 1;
 			break;
 
+		case 'P': {
+			int num_streams = parse_arg(&i, argc, argv);
+
+			if (num_streams < 1 ||
+			    num_streams > CONFIG_NET_ZPERF_MAX_STREAMS) {
+				shell_fprintf(sh, SHELL_WARNING,
+					      "Parse error: %s\n", argv[i]);
+				return -ENOEXEC;
+			}
+
+			param.num_streams = num_streams;
+			opt_cnt += 2;
+			break;
+		}
+
+		case 'i': {
+			int interval = parse_arg(&i, argc, argv);
+
+			if (interval < 1) {
+				shell_fprintf(sh, SHELL_WARNING,
+					      "Parse error: %s\n", argv[i]);
+				return -ENOEXEC;
+			}
+
+			/* Reports are given by the asynchronous callback */
+			param.report_interval_ms = interval * MSEC_PER_SEC;
+			async = true;
+			opt_cnt += 2;
+			break;
+		}
+
+		case 'd':
+			param.dual_port = DEF_PORT;
+			opt_cnt += 1;
+			break;
+
 		case 'n':
 			if (is_udp) {
 				shell_fprintf(sh, SHELL_WARNING,
@@ -1123,9 +1303,18 @@ static void tcp_session_cb(enum zperf_status status,
 		print_number(sh, rate_in_kbps, KBPS, KBPS_UNIT);
 		shell_fprintf(sh, SHELL_NORMAL, "\n");
 
+		if (IS_ENABLED(CONFIG_NET_ZPERF_CPU_LOAD)) {
+			shell_fprintf(sh, SHELL_NORMAL, " CPU load:\t\t%u %%\n",
+				      result->cpu_load);
+		}
+
 		break;
 	}
 
+	case ZPERF_SESSION_PERIODIC_RESULT:
+		/* Only reported by uploads */
+		break;
+
 	case ZPERF_SESSION_ERROR:
 		shell_fprintf(sh, SHELL_ERROR, "TCP session error.\n");
 		break;
@@ -1242,6 +1431,12 @@ void zperf_shell_init(void)
 	}
 }
 
+#define ZPERF_UPLOAD_OPTIONS_HELP \
+	"-P num: Number of parallel streams\n" \
+	"-i sec: Report results every sec seconds (implies -a)\n" \
+	"-d: Bidirectional test, the server sends back to the download\n" \
+	"    server on port " DEF_PORT_STR ", which is started if needed\n"
+
 SHELL_STATIC_SUBCMD_SET_CREATE(zperf_cmd_tcp_download,
 	SHELL_CMD(stop, NULL, "Stop TCP server\n", cmd_tcp_download_stop),
 	SHELL_SUBCMD_SET_END
@@ -1263,6 +1458,7 @@ SHELL_STATIC_SUBCMD_SET_CREATE(zperf_cmd_tcp,
 #ifdef CONFIG_NET_CONTEXT_PRIORITY
 		  "-p: Specify custom packet priority\n"
 #endif /* CONFIG_NET_CONTEXT_PRIORITY */
+		  ZPERF_UPLOAD_OPTIONS_HELP
 		  "Example: tcp upload 192.0.2.2 1111 1 1K\n"
 		  "Example: tcp upload 2001:db8::2\n",
 		  cmd_tcp_upload),
@@ -1279,9 +1475,10 @@ SHELL_STATIC_SUBCMD_SET_CREATE(zperf_cmd_tcp,
 #ifdef CONFIG_NET_CONTEXT_PRIORITY
 		  "-p: Specify custom packet priority\n"
 #endif /* CONFIG_NET_CONTEXT_PRIORITY */
+		  "-n: Disable Nagle's algorithm\n"
+		  ZPERF_UPLOAD_OPTIONS_HELP
 		  "Example: tcp upload2 v6 1 1K\n"
 		  "Example: tcp upload2 v4\n"
-		  "-n: Disable Nagle's algorithm\n"
 #if defined(CONFIG_NET_IPV6) && defined(MY_IP6ADDR_SET)
 		  "Default IPv6 address is " MY_IP6ADDR
 		  ", destination [" DST_IP6ADDR "]:" DEF_PORT_STR "\n"
@@ -1322,6 +1519,7 @@ SHELL_STATIC_SUBCMD_SET_CREATE(zperf_cmd_udp,
 #ifdef CONFIG_NET_CONTEXT_PRIORITY
 		  "-p: Specify custom packet priority\n"
 #endif /* CONFIG_NET_CONTEXT_PRIORITY */
+		  ZPERF_UPLOAD_OPTIONS_HELP
 		  "Example: udp upload 192.0.2.2 1111 1 1K 1M\n"
 		  "Example: udp upload 2001:db8::2\n",
 		  cmd_udp_upload),
@@ -1339,6 +1537,7 @@ SHELL_STATIC_SUBCMD_SET_CREATE(zperf_cmd_udp,
 #ifdef CONFIG_NET_CONTEXT_PRIORITY
 		  "-p: Specify custom packet priority\n"
 #endif /* CONFIG_NET_CONTEXT_PRIORITY */
+		  ZPERF_UPLOAD_OPTIONS_HELP
 		  "Example: udp upload2 v4 1 1K 1M\n"
 		  "Example: udp upload2 v6\n"
 #if defined(CONFIG_NET_IPV6) && defined(MY_IP6ADDR_SET)
@@ -63,6 +63,7 @@ static void tcp_received(const struct sockaddr *addr, size_t datalen)
 		zperf_reset_session_stats(session);
 		session->start_time = k_uptime_ticks();
 		session->state = STATE_ONGOING;
+		zperf_cpu_stats_get(&session->cpu_start);
 
 		if (tcp_session_cb != NULL) {
 			tcp_session_cb(ZPERF_SESSION_STARTED, NULL,
@@ -76,12 +77,16 @@ static void tcp_received(const struct sockaddr *addr, size_t datalen)
 
 		if (datalen == 0) { /* EOF */
 			struct zperf_results results = { 0 };
+			struct zperf_cpu_stats cpu_end;
 
 			session->state = STATE_COMPLETED;
+			zperf_cpu_stats_get(&cpu_end);
 
 			results.total_len = session->length;
 			results.time_in_us = k_ticks_to_us_ceil32(
 						time - session->start_time);
+			results.cpu_load = zperf_cpu_load(&session->cpu_start,
+							  &cpu_end);
 
 			if (tcp_session_cb != NULL) {
 				tcp_session_cb(ZPERF_SESSION_FINISHED, &results,
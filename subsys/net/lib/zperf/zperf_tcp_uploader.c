@@ -36,15 +36,20 @@ static ssize_t sendall(int sock, const void *buf, size_t len)
 	return 0;
 }
 
-static int tcp_upload(int sock,
-		      unsigned int duration_in_ms,
-		      unsigned int packet_size,
+static int tcp_upload(const int *socks, int num_socks,
+		      const struct zperf_upload_params *param,
+		      zperf_callback callback, void *user_data,
 		      struct zperf_results *results)
 {
-	k_timepoint_t end = sys_timepoint_calc(K_MSEC(duration_in_ms));
+	k_timepoint_t end = sys_timepoint_calc(K_MSEC(param->duration_ms));
+	unsigned int packet_size = param->packet_size;
+	bool send_dual_hdr = param->dual_port != 0U;
 	int64_t start_time, end_time;
 	uint32_t nb_packets = 0U, nb_errors = 0U;
 	uint32_t alloc_errors = 0U;
+	struct zperf_cpu_stats cpu_start, cpu_end;
+	struct zperf_report report;
+	int stream = 0;
 	int ret = 0;
 
 	if (packet_size > PACKET_SIZE_MAX) {
@@ -53,8 +58,16 @@ static int tcp_upload(int sock,
 		packet_size = PACKET_SIZE_MAX;
 	}
 
+	if (send_dual_hdr && packet_size < sizeof(struct zperf_client_hdr_v1)) {
+		/* The whole header must be in the first packet */
+		packet_size = sizeof(struct zperf_client_hdr_v1);
+	}
+
 	/* Start the loop */
 	start_time = k_uptime_ticks();
+	zperf_cpu_stats_get(&cpu_start);
+	zperf_report_init(&report, param->report_interval_ms, callback,
+			  user_data, start_time);
 
 	(void)memset(sample_packet, 'z', sizeof(sample_packet));
 
@@ -64,9 +77,14 @@ static int tcp_upload(int sock,
 	 */
 	(void)memset(sample_packet, 0, sizeof(uint32_t));
 
+	if (send_dual_hdr) {
+		zperf_fill_dual_hdr((struct zperf_client_hdr_v1 *)sample_packet,
+				    param);
+	}
+
 	do {
-		/* Send the packet */
-		ret = sendall(sock, sample_packet, packet_size);
+		/* Send the packet, the streams take turns */
+		ret = sendall(socks[stream], sample_packet, packet_size);
 		if (ret < 0) {
 			if (nb_errors == 0 && ret != -ENOMEM) {
 				NET_ERR("Failed to send the packet (%d)", errno);
@@ -87,8 +105,22 @@ static int tcp_upload(int sock,
 			}
 		} else {
 			nb_packets++;
+
+			if (send_dual_hdr) {
+				/* Only one of the streams asks for the test
+				 * back, with the number of streams to use.
+				 */
+				(void)memset(sample_packet, 0,
+					     sizeof(struct zperf_client_hdr_v1));
+				send_dual_hdr = false;
+			}
 		}
 
+		stream = (stream + 1) % num_socks;
+
+		zperf_report_update(&report, k_uptime_ticks(), nb_packets,
+				    nb_errors, packet_size);
+
 #if defined(CONFIG_ARCH_POSIX)
 		k_busy_wait(100 * USEC_PER_MSEC);
 #else
@@ -98,6 +130,7 @@ static int tcp_upload(int sock,
 	} while (!sys_timepoint_expired(end));
 
 	end_time = k_uptime_ticks();
+	zperf_cpu_stats_get(&cpu_end);
 
 	/* Add result coming from the client */
 	results->nb_packets_sent = nb_packets;
@@ -105,6 +138,7 @@ static int tcp_upload(int sock,
 				k_ticks_to_us_ceil32(end_time - start_time);
 	results->packet_size = packet_size;
 	results->nb_packets_errors = nb_errors;
+	results->cpu_load = zperf_cpu_load(&cpu_start, &cpu_end);
 
 	if (alloc_errors > 0) {
 		NET_WARN("There was %u network buffer allocation "
@@ -122,37 +156,63 @@ static int tcp_upload(int sock,
 	return 0;
 }
 
-int zperf_tcp_upload(const struct zperf_upload_params *param,
-		     struct zperf_results *result)
+static int tcp_upload_run(const struct zperf_upload_params *param,
+			  zperf_callback callback, void *user_data,
+			  struct zperf_results *result)
 {
-	int sock;
-	int ret;
+	int socks[STREAMS_MAX];
+	int num_socks = MAX(param->num_streams, 1);
+	int ret = 0;
+	int i;
 
-	if (param == NULL || result == NULL) {
+	if (num_socks > STREAMS_MAX) {
+		NET_WARN("Too many streams! max: %d", STREAMS_MAX);
 		return -EINVAL;
 	}
 
-	sock = zperf_prepare_upload_sock(&param->peer_addr, param->options.tos,
-					 param->options.priority, IPPROTO_TCP);
-	if (sock < 0) {
-		return sock;
-	}
+	for (i = 0; i < num_socks; i++) {
+		socks[i] = zperf_prepare_upload_sock(&param->peer_addr,
+						     param->options.tos,
+						     param->options.priority,
+						     IPPROTO_TCP);
+		if (socks[i] < 0) {
+			ret = socks[i];
+			break;
+		}
 
-	if (param->options.tcp_nodelay &&
-	    zsock_setsockopt(sock, IPPROTO_TCP, TCP_NODELAY,
-			     &param->options.tcp_nodelay,
-			     sizeof(param->options.tcp_nodelay)) != 0) {
-		NET_WARN("Failed to set IPPROTO_TCP - TCP_NODELAY socket option.");
-		return -EINVAL;
+		if (param->options.tcp_nodelay &&
+		    zsock_setsockopt(socks[i], IPPROTO_TCP, TCP_NODELAY,
+				     &param->options.tcp_nodelay,
+				     sizeof(param->options.tcp_nodelay)) != 0) {
+			NET_WARN("Failed to set IPPROTO_TCP - TCP_NODELAY socket option.");
+			zsock_close(socks[i]);
+			ret = -EINVAL;
+			break;
+		}
 	}
 
-	ret = tcp_upload(sock, param->duration_ms, param->packet_size, result);
+	if (ret == 0) {
+		ret = tcp_upload(socks, num_socks, param, callback, user_data,
+				 result);
+	}
 
-	zsock_close(sock);
+	while (i-- > 0) {
+		zsock_close(socks[i]);
+	}
 
 	return ret;
 }
 
+int zperf_tcp_upload(const struct zperf_upload_params *param,
+		     struct zperf_results *result)
+{
+	if (param == NULL || result == NULL) {
+		return -EINVAL;
+	}
+
+	return tcp_upload_run(param, NULL, NULL, result);
+}
+
 static void tcp_upload_async_work(struct k_work *work)
 {
 	struct zperf_async_upload_context *upload_ctx =
@@ -163,7 +223,8 @@ static void tcp_upload_async_work(struct k_work *work)
 	upload_ctx->callback(ZPERF_SESSION_STARTED, NULL,
 			     upload_ctx->user_data);
 
-	ret = zperf_tcp_upload(&upload_ctx->param, &result);
+	ret = tcp_upload_run(&upload_ctx->param, upload_ctx->callback,
+			     upload_ctx->user_data, &result);
 	if (ret < 0) {
 		upload_ctx->callback(ZPERF_SESSION_ERROR, NULL,
 				     upload_ctx->user_data);
@@ -134,6 +134,7 @@ static void udp_received(int sock, const struct sockaddr *addr, uint8_t *data,
 			zperf_reset_session_stats(session);
 			session->state = STATE_ONGOING;
 			session->start_time = time;
+			zperf_cpu_stats_get(&session->cpu_start);
 
 			/* Start a new session! */
 			if (udp_session_cb != NULL) {
@@ -145,6 +146,7 @@ static void udp_received(int sock, const struct sockaddr *addr, uint8_t *data,
 	case STATE_ONGOING:
 		if (id < 0) { /* Negative id means session end. */
 			struct zperf_results results = { 0 };
+			struct zperf_cpu_stats cpu_end;
 			uint32_t duration;
 
 			duration = k_ticks_to_us_ceil32(time -
@@ -152,6 +154,7 @@ static void udp_received(int sock, const struct sockaddr *addr, uint8_t *data,
 
 			/* Update state machine */
 			session->state = STATE_COMPLETED;
+			zperf_cpu_stats_get(&cpu_end);
 
 			/* Fill statistics */
 			session->stat.flags = 0x80000000;
@@ -178,6 +181,8 @@ static void udp_received(int sock, const struct sockaddr *addr, uint8_t *data,
 			results.time_in_us = duration;
 			results.jitter_in_us = session->jitter;
 			results.packet_size = session->length / session->counter;
+			results.cpu_load = zperf_cpu_load(&session->cpu_start,
+							  &cpu_end);
 
 			if (udp_session_cb != NULL) {
 				udp_session_cb(ZPERF_SESSION_FINISHED, &results,
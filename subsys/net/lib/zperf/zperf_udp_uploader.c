@@ -131,12 +131,32 @@ static inline int zperf_upload_fin(int sock,
 	return 0;
 }
 
-static int udp_upload(int sock, int port,
-		      unsigned int duration_in_ms,
-		      unsigned int packet_size,
-		      unsigned int rate_in_kbps,
+/* Sum up the statistics the server reported for each of the streams */
+static void udp_results_add(struct zperf_results *results,
+			    const struct zperf_results *stream, int num)
+{
+	if (num == 0) {
+		*results = *stream;
+		return;
+	}
+
+	results->nb_packets_rcvd += stream->nb_packets_rcvd;
+	results->nb_packets_lost += stream->nb_packets_lost;
+	results->nb_packets_outorder += stream->nb_packets_outorder;
+	results->total_len += stream->total_len;
+	results->time_in_us = MAX(results->time_in_us, stream->time_in_us);
+	/* Mean jitter of the streams */
+	results->jitter_in_us = (results->jitter_in_us * num +
+				 stream->jitter_in_us) / (num + 1);
+}
+
+static int udp_upload(const int *socks, int num_socks, int port,
+		      const struct zperf_upload_params *param,
+		      zperf_callback callback, void *user_data,
 		      struct zperf_results *results)
 {
+	unsigned int packet_size = param->packet_size;
+	unsigned int rate_in_kbps = param->rate_kbps;
 	uint32_t packet_duration_us = zperf_packet_duration(packet_size, rate_in_kbps);
 	uint32_t packet_duration = k_us_to_ticks_ceil32(packet_duration_us);
 	uint32_t delay = packet_duration;
@@ -144,6 +164,8 @@ static int udp_upload(int sock, int port,
 	int64_t start_time, end_time;
 	int64_t print_time, last_loop_time;
 	uint32_t print_period;
+	struct zperf_cpu_stats cpu_start, cpu_end;
+	struct zperf_report report;
 	int ret;
 
 	if (packet_size > PACKET_SIZE_MAX) {
@@ -156,10 +178,22 @@ static int udp_upload(int sock, int port,
 		packet_size = sizeof(struct zperf_udp_datagram);
 	}
 
+	if (param->dual_port != 0U &&
+	    packet_size < sizeof(struct zperf_udp_datagram) +
+			  sizeof(struct zperf_client_hdr_v1)) {
+		/* The whole header must be in the packets */
+		packet_size = sizeof(struct zperf_udp_datagram) +
+			      sizeof(struct zperf_client_hdr_v1);
+	}
+
 	/* Start the loop */
 	start_time = k_uptime_ticks();
 	last_loop_time = start_time;
-	end_time = start_time + k_ms_to_ticks_ceil64(duration_in_ms);
+	end_time = start_time + k_ms_to_ticks_ceil64(param->duration_ms);
+
+	zperf_cpu_stats_get(&cpu_start);
+	zperf_report_init(&report, param->report_interval_ms, callback,
+			  user_data, start_time);
 
 	/* Print log every seconds */
 	print_period = k_ms_to_ticks_ceil32(MSEC_PER_SEC);
@@ -203,27 +237,40 @@ static int udp_upload(int sock, int port,
 		/* Fill the packet header */
 		datagram = (struct zperf_udp_datagram *)sample_packet;
 
-		datagram->id = htonl(nb_packets);
+		datagram->id = htonl(nb_packets / num_socks);
 		datagram->tv_sec = htonl(secs);
 		datagram->tv_usec = htonl(usecs);
 
 		hdr = (struct zperf_client_hdr_v1 *)(sample_packet +
 						     sizeof(*datagram));
-		hdr->flags = 0;
-		hdr->num_of_threads = htonl(1);
-		hdr->port = htonl(port);
-		hdr->buffer_len = sizeof(sample_packet) -
-			sizeof(*datagram) - sizeof(*hdr);
-		hdr->bandwidth = htonl(rate_in_kbps);
-		hdr->num_of_bytes = htonl(packet_size);
 
-		/* Send the packet */
-		ret = zsock_send(sock, sample_packet, packet_size, 0);
-		if (ret < 0) {
-			NET_ERR("Failed to send the packet (%d)", errno);
-			return -errno;
-		} else {
-			nb_packets++;
+		/* Each of the streams gets one packet per period, so the
+		 * rate applies to each of them.
+		 */
+		for (int i = 0; i < num_socks; i++) {
+			if (i == 0 && param->dual_port != 0U) {
+				/* Only one of the streams asks for the test
+				 * back, with the number of streams to use.
+				 */
+				zperf_fill_dual_hdr(hdr, param);
+			} else {
+				hdr->flags = 0;
+				hdr->num_of_threads = htonl(1);
+				hdr->port = htonl(port);
+				hdr->buffer_len = sizeof(sample_packet) -
+					sizeof(*datagram) - sizeof(*hdr);
+				hdr->bandwidth = htonl(rate_in_kbps);
+				hdr->num_of_bytes = htonl(packet_size);
+			}
+
+			/* Send the packet */
+			ret = zsock_send(socks[i], sample_packet, packet_size, 0);
+			if (ret < 0) {
+				NET_ERR("Failed to send the packet (%d)", errno);
+				return -errno;
+			} else {
+				nb_packets++;
+			}
 		}
 
 		if (IS_ENABLED(CONFIG_NET_ZPERF_LOG_LEVEL_DBG)) {
@@ -235,6 +282,9 @@ static int udp_upload(int sock, int port,
 			}
 		}
 
+		zperf_report_update(&report, loop_time, nb_packets, 0U,
+				    packet_size);
+
 		/* Wait */
 #if defined(CONFIG_ARCH_POSIX)
 		k_busy_wait(USEC_PER_MSEC);
@@ -246,11 +296,18 @@ static int udp_upload(int sock, int port,
 	} while (last_loop_time < end_time);
 
 	end_time = k_uptime_ticks();
+	zperf_cpu_stats_get(&cpu_end);
 
-	ret = zperf_upload_fin(sock, nb_packets, end_time, packet_size,
-			       results);
-	if (ret < 0) {
-		return ret;
+	for (int i = 0; i < num_socks; i++) {
+		struct zperf_results stream_results = { 0 };
+
+		ret = zperf_upload_fin(socks[i], nb_packets / num_socks,
+				       end_time, packet_size, &stream_results);
+		if (ret < 0) {
+			return ret;
+		}
+
+		udp_results_add(results, &stream_results, i);
 	}
 
 	/* Add result coming from the client */
@@ -258,20 +315,20 @@ static int udp_upload(int sock, int port,
 	results->client_time_in_us =
 				k_ticks_to_us_ceil32(end_time - start_time);
 	results->packet_size = packet_size;
+	results->cpu_load = zperf_cpu_load(&cpu_start, &cpu_end);
 
 	return 0;
 }
 
-int zperf_udp_upload(const struct zperf_upload_params *param,
-		     struct zperf_results *result)
+static int udp_upload_run(const struct zperf_upload_params *param,
+			  zperf_callback callback, void *user_data,
+			  struct zperf_results *result)
 {
+	int socks[STREAMS_MAX];
+	int num_socks = MAX(param->num_streams, 1);
 	int port = 0;
-	int sock;
-	int ret;
-
-	if (param == NULL || result == NULL) {
-		return -EINVAL;
-	}
+	int ret = 0;
+	int i;
 
 	if (param->peer_addr.sa_family == AF_INET) {
 		port = ntohs(net_sin(&param->peer_addr)->sin_port);
@@ -283,20 +340,44 @@ int zperf_udp_upload(const struct zperf_upload_params *param,
 		return -EINVAL;
 	}
 
-	sock = zperf_prepare_upload_sock(&param->peer_addr, param->options.tos,
-					 param->options.priority, IPPROTO_UDP);
-	if (sock < 0) {
-		return sock;
+	if (num_socks > STREAMS_MAX) {
+		NET_WARN("Too many streams! max: %d", STREAMS_MAX);
+		return -EINVAL;
+	}
+
+	for (i = 0; i < num_socks; i++) {
+		socks[i] = zperf_prepare_upload_sock(&param->peer_addr,
+						     param->options.tos,
+						     param->options.priority,
+						     IPPROTO_UDP);
+		if (socks[i] < 0) {
+			ret = socks[i];
+			break;
+		}
 	}
 
-	ret = udp_upload(sock, port, param->duration_ms, param->packet_size,
-			 param->rate_kbps, result);
+	if (ret == 0) {
+		ret = udp_upload(socks, num_socks, port, param, callback,
+				 user_data, result);
+	}
 
-	zsock_close(sock);
+	while (i-- > 0) {
+		zsock_close(socks[i]);
+	}
 
 	return ret;
 }
 
+int zperf_udp_upload(const struct zperf_upload_params *param,
+		     struct zperf_results *result)
+{
+	if (param == NULL || result == NULL) {
+		return -EINVAL;
+	}
+
+	return udp_upload_run(param, NULL, NULL, result);
+}
+
 static void udp_upload_async_work(struct k_work *work)
 {
 	struct zperf_async_upload_context *upload_ctx =
@@ -307,7 +388,8 @@ static void udp_upload_async_work(struct k_work *work)
 	upload_ctx->callback(ZPERF_SESSION_STARTED, NULL,
 			     upload_ctx->user_data);
 
-	ret = zperf_udp_upload(&upload_ctx->param, &result);
+	ret = udp_upload_run(&upload_ctx->param, upload_ctx->callback,
+			     upload_ctx->user_data, &result);
 	if (ret < 0) {
 		upload_ctx->callback(ZPERF_SESSION_ERROR, NULL,
 				     upload_ctx->user_data);
@@ -0,0 +1,318 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(npf_bpf, CONFIG_NET_PKT_FILTER_LOG_LEVEL);
+
+#include <errno.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/net/net_pkt_filter.h>
+#include <zephyr/sys/byteorder.h>
+
+#define BPF_CLASS(code) ((code) & 0x07)
+#define BPF_SIZE(code)  ((code) & 0x18)
+#define BPF_MODE(code)  ((code) & 0xe0)
+#define BPF_OP(code)    ((code) & 0xf0)
+#define BPF_SRC(code)   ((code) & 0x08)
+#define BPF_RVAL(code)  ((code) & 0x18)
+#define BPF_MISCOP(code) ((code) & 0xf8)
+
+/* Slow path of packet loads, for data spanning several fragments */
+static bool load_bytes(struct net_buf *buf, uint32_t offset, uint8_t *dst,
+		       size_t len)
+{
+	while (buf != NULL && offset >= buf->len) {
+		offset -= buf->len;
+		buf = buf->frags;
+	}
+
+	while (len > 0) {
+		size_t chunk;
+
+		if (buf == NULL) {
+			return false;
+		}
+
+		chunk = MIN(len, buf->len - offset);
+		memcpy(dst, buf->data + offset, chunk);
+
+		dst += chunk;
+		len -= chunk;
+		offset = 0;
+		buf = buf->frags;
+	}
+
+	return true;
+}
+
+static bool load(struct net_pkt *pkt, uint32_t offset, uint16_t size,
+		 uint32_t *val)
+{
+	struct net_buf *buf = pkt->buffer;
+	uint8_t tmp[sizeof(uint32_t)];
+	const uint8_t *data;
+	size_t len;
+
+	len = size == NPF_BPF_W ? 4 : size == NPF_BPF_H ? 2 : 1;
+
+	if (buf == NULL || offset > UINT32_MAX - len) {
+		return false;
+	}
+
+	if (offset + len <= buf->len) {
+		data = buf->data + offset;
+	} else if (load_bytes(buf, offset, tmp, len)) {
+		data = tmp;
+	} else {
+		return false;
+	}
+
+	if (len == 4) {
+		*val = sys_get_be32(data);
+	} else if (len == 2) {
+		*val = sys_get_be16(data);
+	} else {
+		*val = data[0];
+	}
+
+	return true;
+}
+
+uint32_t npf_bpf_run(const struct npf_bpf_insn *prog, size_t len,
+		     struct net_pkt *pkt)
+{
+	uint32_t mem[NPF_BPF_MEMWORDS] = { 0 };
+	uint32_t a = 0;
+	uint32_t x = 0;
+	uint32_t val;
+	size_t pc;
+
+	for (pc = 0; pc < len; pc++) {
+		const struct npf_bpf_insn *insn = &prog[pc];
+		uint32_t k = insn->k;
+
+		switch (BPF_CLASS(insn->code)) {
+		case NPF_BPF_LD:
+			switch (BPF_MODE(insn->code)) {
+			case NPF_BPF_IMM:
+				a = k;
+				break;
+			case NPF_BPF_ABS:
+				if (!load(pkt, k, BPF_SIZE(insn->code), &a)) {
+					return 0;
+				}
+				break;
+			case NPF_BPF_IND:
+				if (!load(pkt, x + k, BPF_SIZE(insn->code), &a)) {
+					return 0;
+				}
+				break;
+			case NPF_BPF_MEM:
+				if (k >= NPF_BPF_MEMWORDS) {
+					return 0;
+				}
+				a = mem[k];
+				break;
+			case NPF_BPF_LEN:
+				a = net_pkt_get_len(pkt);
+				break;
+			default:
+				return 0;
+			}
+			break;
+
+		case NPF_BPF_LDX:
+			switch (BPF_MODE(insn->code)) {
+			case NPF_BPF_IMM:
+				x = k;
+				break;
+			case NPF_BPF_MEM:
+				if (k >= NPF_BPF_MEMWORDS) {
+					return 0;
+				}
+				x = mem[k];
+				break;
+			case NPF_BPF_LEN:
+				x = net_pkt_get_len(pkt);
+				break;
+			case NPF_BPF_MSH:
+				/* IPv4 header length, 4 * (pkt[k] & 0xf) */
+				if (!load(pkt, k, NPF_BPF_B, &val)) {
+					return 0;
+				}
+				x = (val & 0xf) << 2;
+				break;
+			default:
+				return 0;
+			}
+			break;
+
+		case NPF_BPF_ST:
+		case NPF_BPF_STX:
+			if (k >= NPF_BPF_MEMWORDS) {
+				return 0;
+			}
+			mem[k] = BPF_CLASS(insn->code) == NPF_BPF_ST ? a : x;
+			break;
+
+		case NPF_BPF_ALU:
+			val = BPF_SRC(insn->code) == NPF_BPF_X ? x : k;
+
+			switch (BPF_OP(insn->code)) {
+			case NPF_BPF_ADD:
+				a += val;
+				break;
+			case NPF_BPF_SUB:
+				a -= val;
+				break;
+			case NPF_BPF_MUL:
+				a *= val;
+				break;
+			case NPF_BPF_DIV:
+				if (val == 0) {
+					return 0;
+				}
+				a /= val;
+				break;
+			case NPF_BPF_MOD:
+				if (val == 0) {
+					return 0;
+				}
+				a %= val;
+				break;
+			case NPF_BPF_OR:
+				a |= val;
+				break;
+			case NPF_BPF_AND:
+				a &= val;
+				break;
+			case NPF_BPF_XOR:
+				a ^= val;
+				break;
+			case NPF_BPF_LSH:
+				a = val < 32 ? a << val : 0;
+				break;
+			case NPF_BPF_RSH:
+				a = val < 32 ? a >> val : 0;
+				break;
+			case NPF_BPF_NEG:
+				a = -a;
+				break;
+			default:
+				return 0;
+			}
+			break;
+
+		case NPF_BPF_JMP:
+			val = BPF_SRC(insn->code) == NPF_BPF_X ? x : k;
+
+			switch (BPF_OP(insn->code)) {
+			case NPF_BPF_JA:
+				if (k >= len - pc - 1) {
+					return 0;
+				}
+				pc += k;
+				break;
+			case NPF_BPF_JEQ:
+				pc += (a == val) ? insn->jt : insn->jf;
+				break;
+			case NPF_BPF_JGT:
+				pc += (a > val) ? insn->jt : insn->jf;
+				break;
+			case NPF_BPF_JGE:
+				pc += (a >= val) ? insn->jt : insn->jf;
+				break;
+			case NPF_BPF_JSET:
+				pc += (a & val) ? insn->jt : insn->jf;
+				break;
+			default:
+				return 0;
+			}
+			break;
+
+		case NPF_BPF_RET:
+			return BPF_RVAL(insn->code) == NPF_BPF_A ? a : k;
+
+		case NPF_BPF_MISC:
+			if (BPF_MISCOP(insn->code) == NPF_BPF_TAX) {
+				x = a;
+			} else if (BPF_MISCOP(insn->code) == NPF_BPF_TXA) {
+				a = x;
+			} else {
+				return 0;
+			}
+			break;
+		}
+	}
+
+	/* Fell off the end of an invalid program */
+	return 0;
+}
+
+int npf_bpf_validate(const struct npf_bpf_insn *prog, size_t len)
+{
+	if (len == 0 || len > CONFIG_NET_PKT_FILTER_BPF_MAX_INSNS) {
+		return -EINVAL;
+	}
+
+	for (size_t pc = 0; pc < len; pc++) {
+		const struct npf_bpf_insn *insn = &prog[pc];
+		size_t remaining = len - pc - 1;
+
+		switch (BPF_CLASS(insn->code)) {
+		case NPF_BPF_LD:
+		case NPF_BPF_LDX:
+			if (BPF_MODE(insn->code) == NPF_BPF_MEM &&
+			    insn->k >= NPF_BPF_MEMWORDS) {
+				return -EINVAL;
+			}
+			break;
+
+		case NPF_BPF_ST:
+		case NPF_BPF_STX:
+			if (insn->k >= NPF_BPF_MEMWORDS) {
+				return -EINVAL;
+			}
+			break;
+
+		case NPF_BPF_ALU:
+			if ((BPF_OP(insn->code) == NPF_BPF_DIV ||
+			     BPF_OP(insn->code) == NPF_BPF_MOD) &&
+			    BPF_SRC(insn->code) == NPF_BPF_K && insn->k == 0) {
+				return -EINVAL;
+			}
+			break;
+
+		case NPF_BPF_JMP:
+			/* Only forward jumps, so every program terminates */
+			if (BPF_OP(insn->code) == NPF_BPF_JA) {
+				if (insn->k >= remaining) {
+					return -EINVAL;
+				}
+			} else if (insn->jt >= remaining || insn->jf >= remaining) {
+				return -EINVAL;
+			}
+			break;
+
+		default:
+			break;
+		}
+	}
+
+	if (BPF_CLASS(prog[len - 1].code) != NPF_BPF_RET) {
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+bool npf_bpf_match(struct npf_test *test, struct net_pkt *pkt)
+{
+	struct npf_test_bpf *test_bpf =
+			CONTAINER_OF(test, struct npf_test_bpf, test);
+
+	return npf_bpf_run(test_bpf->prog, test_bpf->len, pkt) != 0;
+}
@@ -5,6 +5,7 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <zephyr/init.h>
 #include <zephyr/pm/device.h>
 #include <zephyr/pm/device_runtime.h>
 #include <zephyr/sys/__assert.h>
@@ -558,3 +559,134 @@ bool pm_device_runtime_is_enabled(const struct device *dev)
 
 	return pm && atomic_test_bit(&pm->flags, PM_DEVICE_FLAG_RUNTIME_ENABLED);
 }
+
+#ifdef CONFIG_PM_DEVICE_RUNTIME_ASYNC
+
+#define ASYNC_THREADS CONFIG_PM_DEVICE_RUNTIME_ASYNC_THREADS
+
+/*
+ * Resumes are spread over several work queues: a resume waiting on a power
+ * domain of a branch of the tree doesn't hold those of the other branches.
+ * Resumes sharing a domain still serialize on its lock.
+ */
+static struct k_work_q get_async_wq[ASYNC_THREADS];
+static K_THREAD_STACK_ARRAY_DEFINE(get_async_stacks, ASYNC_THREADS,
+				   CONFIG_PM_DEVICE_RUNTIME_ASYNC_STACK_SIZE);
+static atomic_t get_async_next;
+
+static void runtime_get_async_work(struct k_work *work)
+{
+	struct pm_device_runtime_async *req =
+		CONTAINER_OF(work, struct pm_device_runtime_async, work);
+
+	req->cb(req->dev, pm_device_runtime_get(req->dev), req->user_data);
+}
+
+int pm_device_runtime_get_async(const struct device *dev,
+				struct pm_device_runtime_async *req,
+				pm_device_runtime_cb_t cb, void *user_data)
+{
+	struct k_work_q *wq;
+	int ret;
+
+	req->dev = dev;
+	req->cb = cb;
+	req->user_data = user_data;
+
+	/* Nothing that would block: resume right away */
+	if (k_is_pre_kernel() || !pm_device_runtime_is_enabled(dev) ||
+	    atomic_test_bit(&dev->pm_base->flags, PM_DEVICE_FLAG_ISR_SAFE)) {
+		cb(dev, pm_device_runtime_get(dev), user_data);
+		return 0;
+	}
+
+	k_work_init(&req->work, runtime_get_async_work);
+
+	wq = &get_async_wq[(size_t)atomic_inc(&get_async_next) % ASYNC_THREADS];
+	ret = k_work_submit_to_queue(wq, &req->work);
+
+	return (ret < 0) ? ret : 0;
+}
+
+struct get_batch_item {
+	struct pm_device_runtime_async req;
+	struct k_sem *done;
+	int ret;
+};
+
+static void get_batch_cb(const struct device *dev, int ret, void *user_data)
+{
+	struct get_batch_item *item = user_data;
+
+	ARG_UNUSED(dev);
+
+	item->ret = ret;
+	k_sem_give(item->done);
+}
+
+int pm_device_runtime_get_batch(const struct device *const *devs, size_t count)
+{
+	struct get_batch_item items[ASYNC_THREADS];
+	struct k_sem done;
+	size_t i, j, n = 0;
+	int ret = 0;
+
+	k_sem_init(&done, 0, ASYNC_THREADS);
+
+	for (i = 0; (i < count) && (ret == 0); i += n) {
+		n = MIN(count - i, ASYNC_THREADS);
+
+		for (j = 0; j < n; j++) {
+			items[j].done = &done;
+			items[j].ret = pm_device_runtime_get_async(devs[i + j], &items[j].req,
+								   get_batch_cb, &items[j]);
+			if (items[j].ret < 0) {
+				k_sem_give(&done);
+			}
+		}
+
+		for (j = 0; j < n; j++) {
+			(void)k_sem_take(&done, K_FOREVER);
+		}
+
+		for (j = 0; j < n; j++) {
+			if (items[j].ret < 0) {
+				ret = items[j].ret;
+			}
+		}
+	}
+
+	if (ret < 0) {
+		/* Release what was obtained, i - n devices then the last batch */
+		i -= n;
+		for (j = 0; j < n; j++) {
+			if (items[j].ret == 0) {
+				(void)pm_device_runtime_put(devs[i + j]);
+			}
+		}
+		for (j = 0; j < i; j++) {
+			(void)pm_device_runtime_put(devs[j]);
+		}
+	}
+
+	return ret;
+}
+
+static int get_async_init(void)
+{
+	const struct k_work_queue_config cfg = {
+		.name = "pm_runtime_async",
+	};
+
+	for (size_t i = 0; i < ASYNC_THREADS; i++) {
+		k_work_queue_start(&get_async_wq[i], get_async_stacks[i],
+				   K_THREAD_STACK_SIZEOF(get_async_stacks[i]),
+				   CONFIG_PM_DEVICE_RUNTIME_ASYNC_PRIORITY, &cfg);
+	}
+
+	return 0;
+}
+
+SYS_INIT(get_async_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+
+#endif /* CONFIG_PM_DEVICE_RUNTIME_ASYNC */
@@ -18,6 +18,7 @@
 #include <zephyr/tracing/tracing.h>
 
 #include "pm_stats.h"
+#include "policy_predict.h"
 
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(pm, CONFIG_PM_LOG_LEVEL);
@@ -231,11 +232,18 @@ bool pm_system_suspend(int32_t ticks)
 	 */
 	k_sched_lock();
 	pm_stats_start();
+#ifdef CONFIG_PM_POLICY_PREDICT
+	const struct pm_state_info entered = z_cpus_pm_state[id];
+	uint32_t idle_start = k_cycle_get_32();
+#endif
 	/* Enter power state */
 	pm_state_notify(true);
 	atomic_set_bit(z_post_ops_required, id);
 	pm_state_set(z_cpus_pm_state[id].state, z_cpus_pm_state[id].substate_id);
 	pm_stats_stop();
+#ifdef CONFIG_PM_POLICY_PREDICT
+	pm_policy_idle_update(id, &entered, k_cycle_get_32() - idle_start);
+#endif
 
 	/* Wake up sequence starts here */
 #if defined(CONFIG_PM_DEVICE) && !defined(CONFIG_PM_DEVICE_RUNTIME_EXCLUSIVE)
@@ -31,6 +31,25 @@ static char names[CONFIG_MP_MAX_NUM_CPUS][PM_STATE_COUNT][PM_STAT_NAME_LEN];
 static uint32_t time_start[CONFIG_MP_MAX_NUM_CPUS];
 static uint32_t time_stop[CONFIG_MP_MAX_NUM_CPUS];
 
+#ifdef CONFIG_PM_POLICY_PREDICT
+STATS_SECT_START(pm_predict_stats)
+STATS_SECT_ENTRY32(idle_count)
+STATS_SECT_ENTRY32(too_deep)
+STATS_SECT_ENTRY32(too_shallow)
+STATS_SECT_END;
+
+STATS_NAME_START(pm_predict_stats)
+STATS_NAME(pm_predict_stats, idle_count)
+STATS_NAME(pm_predict_stats, too_deep)
+STATS_NAME(pm_predict_stats, too_shallow)
+STATS_NAME_END(pm_predict_stats);
+
+static STATS_SECT_DECL(pm_predict_stats) predict_stats[CONFIG_MP_MAX_NUM_CPUS];
+
+#define PM_PREDICT_STAT_NAME_LEN sizeof("pm_cpu_XXX_predict_stats")
+static char predict_names[CONFIG_MP_MAX_NUM_CPUS][PM_PREDICT_STAT_NAME_LEN];
+#endif
+
 static int pm_stats_init(void)
 {
 
@@ -44,6 +63,14 @@ static int pm_stats_init(void)
 				   STATS_NAME_INIT_PARMS(pm_stats));
 			stats_register(names[i][j], &(stats[i][j].s_hdr));
 		}
+
+#ifdef CONFIG_PM_POLICY_PREDICT
+		snprintk(predict_names[i], PM_PREDICT_STAT_NAME_LEN,
+			 "pm_cpu_%03d_predict_stats", i);
+		stats_init(&(predict_stats[i].s_hdr), STATS_SIZE_32, 3U,
+			   STATS_NAME_INIT_PARMS(pm_predict_stats));
+		stats_register(predict_names[i], &(predict_stats[i].s_hdr));
+#endif
 	}
 
 	return 0;
@@ -70,3 +97,16 @@ void pm_stats_update(enum pm_state state)
 	STATS_INCN(stats[cpu][state], state_total_cycles, time_total);
 	STATS_SET(stats[cpu][state], state_last_cycles, time_total);
 }
+
+#ifdef CONFIG_PM_POLICY_PREDICT
+void pm_stats_predict_update(uint8_t cpu, bool too_deep, bool too_shallow)
+{
+	STATS_INC(predict_stats[cpu], idle_count);
+	if (too_deep) {
+		STATS_INC(predict_stats[cpu], too_deep);
+	}
+	if (too_shallow) {
+		STATS_INC(predict_stats[cpu], too_shallow);
+	}
+}
+#endif
@@ -13,9 +13,13 @@
 #include <zephyr/sys/__assert.h>
 #include <zephyr/sys/time_units.h>
 #include <zephyr/sys/atomic.h>
+#include <zephyr/sys/rb.h>
 #include <zephyr/toolchain.h>
 #include <zephyr/pm/device.h>
 
+#include "pm_stats.h"
+#include "policy_predict.h"
+
 #if DT_HAS_COMPAT_STATUS_OKAY(zephyr_power_state)
 
 #define DT_SUB_LOCK_INIT(node_id)				\
@@ -45,14 +49,47 @@ static struct {
 
 #endif
 
-/** Lock to synchronize access to the latency request list. */
+/** Set of latency requests, sorted by value. */
+struct latency_set {
+	/** Tree of requests. */
+	struct rbtree reqs;
+	/** Maximum latency in us */
+	int32_t max_latency_us;
+	/** Maximum latency in cycles */
+	int32_t max_latency_cyc;
+};
+
+static bool latency_req_lessthan(struct rbnode *a, struct rbnode *b)
+{
+	struct pm_policy_latency_request *req_a =
+		CONTAINER_OF(a, struct pm_policy_latency_request, node);
+	struct pm_policy_latency_request *req_b =
+		CONTAINER_OF(b, struct pm_policy_latency_request, node);
+
+	if (req_a->value_us != req_b->value_us) {
+		return req_a->value_us < req_b->value_us;
+	}
+
+	/* Requests of the same value are ordered by address */
+	return (uintptr_t)req_a < (uintptr_t)req_b;
+}
+
+#define LATENCY_SET_INIT(_i, ...) \
+	{ \
+		.reqs = { .lessthan_fn = latency_req_lessthan }, \
+		.max_latency_us = SYS_FOREVER_US, \
+		.max_latency_cyc = -1, \
+	}
+
+/** Lock to synchronize access to the latency requests. */
 static struct k_spinlock latency_lock;
-/** List of maximum latency requests. */
-static sys_slist_t latency_reqs;
-/** Maximum CPU latency in us */
-static int32_t max_latency_us = SYS_FOREVER_US;
-/** Maximum CPU latency in cycles */
-static int32_t max_latency_cyc = -1;
+/** Latency requests for all the CPUs, then for each CPU. */
+static struct latency_set latency_sets[] = {
+	LATENCY_SET_INIT(0),
+#ifdef CONFIG_PM_POLICY_LATENCY_PER_CPU
+	LISTIFY(CONFIG_MP_MAX_NUM_CPUS, LATENCY_SET_INIT, (,)),
+#endif
+};
 /** List of latency change subscribers. */
 static sys_slist_t latency_subs;
 
@@ -63,33 +100,39 @@ static sys_slist_t events_list;
 /** Next event, in absolute cycles (<0: none, [0, UINT32_MAX]: cycles) */
 static int64_t next_event_cyc = -1;
 
-/** @brief Update maximum allowed latency. */
-static void update_max_latency(void)
+/**
+ * @brief Update maximum allowed latency of a set.
+ *
+ * The smallest request is the leftmost node of the tree, so this is in the
+ * order of O(log n) with the number of requests of the set.
+ */
+static void update_max_latency(struct latency_set *set)
 {
 	int32_t new_max_latency_us = SYS_FOREVER_US;
-	struct pm_policy_latency_request *req;
+	struct rbnode *min = rb_get_min(&set->reqs);
 
-	SYS_SLIST_FOR_EACH_CONTAINER(&latency_reqs, req, node) {
-		if ((new_max_latency_us == SYS_FOREVER_US) ||
-		    ((int32_t)req->value_us < new_max_latency_us)) {
-			new_max_latency_us = (int32_t)req->value_us;
-		}
+	if (min != NULL) {
+		new_max_latency_us = (int32_t)CONTAINER_OF(min, struct pm_policy_latency_request,
+							   node)->value_us;
 	}
 
-	if (max_latency_us != new_max_latency_us) {
+	if (set->max_latency_us != new_max_latency_us) {
 		struct pm_policy_latency_subscription *sreq;
 		int32_t new_max_latency_cyc = -1;
 
-		SYS_SLIST_FOR_EACH_CONTAINER(&latency_subs, sreq, node) {
-			sreq->cb(new_max_latency_us);
+		/* Subscribers follow the requests for all the CPUs */
+		if (set == &latency_sets[0]) {
+			SYS_SLIST_FOR_EACH_CONTAINER(&latency_subs, sreq, node) {
+				sreq->cb(new_max_latency_us);
+			}
 		}
 
 		if (new_max_latency_us != SYS_FOREVER_US) {
 			new_max_latency_cyc = (int32_t)k_us_to_cyc_ceil32(new_max_latency_us);
 		}
 
-		max_latency_us = new_max_latency_us;
-		max_latency_cyc = new_max_latency_cyc;
+		set->max_latency_us = new_max_latency_us;
+		set->max_latency_cyc = new_max_latency_cyc;
 	}
 }
 
@@ -130,10 +173,132 @@ static void update_next_event(uint32_t cyc)
 	next_event_cyc = new_next_event_cyc;
 }
 
+#ifdef CONFIG_PM_POLICY_PREDICT
+
+/** Idle durations are recorded up to this value, in us */
+#define IDLE_MAX_US BIT(24)
+
+/** Most recent idle durations of each CPU, in us */
+static struct {
+	uint32_t us[CONFIG_PM_POLICY_PREDICT_HISTORY];
+	uint8_t next;
+	uint8_t count;
+} idle_history[CONFIG_MP_MAX_NUM_CPUS];
+
+void pm_policy_idle_update(uint8_t cpu, const struct pm_state_info *info, uint32_t idle_cyc)
+{
+	uint32_t idle_us = MIN(k_cyc_to_us_floor32(idle_cyc), IDLE_MAX_US);
+
+	idle_history[cpu].us[idle_history[cpu].next] = idle_us;
+	idle_history[cpu].next = (idle_history[cpu].next + 1U) % CONFIG_PM_POLICY_PREDICT_HISTORY;
+	if (idle_history[cpu].count < CONFIG_PM_POLICY_PREDICT_HISTORY) {
+		idle_history[cpu].count++;
+	}
+
+	if (IS_ENABLED(CONFIG_PM_STATS)) {
+		const struct pm_state_info *cpu_states;
+		uint8_t num_cpu_states = pm_state_cpu_get_all(cpu, &cpu_states);
+		uint32_t target_us = info->min_residency_us + info->exit_latency_us;
+		bool too_shallow = false;
+
+		/* a state worth more than the one used fitted in the idle time */
+		for (uint8_t i = 0U; i < num_cpu_states; i++) {
+			uint32_t state_us = cpu_states[i].min_residency_us +
+					    cpu_states[i].exit_latency_us;
+
+			if ((state_us > target_us) && (state_us <= idle_us)) {
+				too_shallow = true;
+				break;
+			}
+		}
+
+		pm_stats_predict_update(cpu, idle_us < target_us, too_shallow);
+	}
+}
+
+/**
+ * @brief Predict the next idle duration of a CPU, in us, -1 if unknown.
+ *
+ * Wake-ups that aren't timer driven (interrupts from peripherals, incoming
+ * packets, ...) tend to repeat at similar intervals. The recent durations are
+ * averaged, dropping the longest ones until their standard deviation gets
+ * below a sixth of the average. No prediction is done if they are too spread
+ * out, or until the history is full.
+ */
+static int32_t predict_idle_us(uint8_t cpu)
+{
+	const uint32_t *hist = idle_history[cpu].us;
+	uint32_t thresh = UINT32_MAX;
+
+	if (idle_history[cpu].count < CONFIG_PM_POLICY_PREDICT_HISTORY) {
+		return -1;
+	}
+
+	for (int pass = 0; pass < 3; pass++) {
+		uint64_t sum = 0U;
+		uint64_t variance = 0U;
+		uint32_t max = 0U;
+		uint32_t n = 0U;
+		int64_t avg, diff;
+
+		for (uint8_t i = 0U; i < CONFIG_PM_POLICY_PREDICT_HISTORY; i++) {
+			if (hist[i] <= thresh) {
+				sum += hist[i];
+				max = MAX(max, hist[i]);
+				n++;
+			}
+		}
+
+		if (n == 0U) {
+			break;
+		}
+
+		avg = (int64_t)(sum / n);
+
+		for (uint8_t i = 0U; i < CONFIG_PM_POLICY_PREDICT_HISTORY; i++) {
+			if (hist[i] <= thresh) {
+				diff = (int64_t)hist[i] - avg;
+				variance += (uint64_t)(diff * diff);
+			}
+		}
+		variance /= n;
+
+		if ((variance * 36U) <= (uint64_t)(avg * avg)) {
+			return (int32_t)avg;
+		}
+
+		thresh = max - 1U;
+	}
+
+	return -1;
+}
+
+#endif /* CONFIG_PM_POLICY_PREDICT */
+
 #ifdef CONFIG_PM_POLICY_DEFAULT
+/** @brief Maximum latency of a CPU in cycles, -1 if none. */
+static int32_t max_latency_cyc_get(uint8_t cpu)
+{
+	int32_t max_latency_cyc = latency_sets[0].max_latency_cyc;
+
+#ifdef CONFIG_PM_POLICY_LATENCY_PER_CPU
+	int32_t cpu_latency_cyc = latency_sets[1 + cpu].max_latency_cyc;
+
+	if ((max_latency_cyc < 0) ||
+	    ((cpu_latency_cyc >= 0) && (cpu_latency_cyc < max_latency_cyc))) {
+		max_latency_cyc = cpu_latency_cyc;
+	}
+#else
+	ARG_UNUSED(cpu);
+#endif
+
+	return max_latency_cyc;
+}
+
 const struct pm_state_info *pm_policy_next_state(uint8_t cpu, int32_t ticks)
 {
 	int64_t cyc = -1;
+	int32_t max_latency_cyc = max_latency_cyc_get(cpu);
 	uint8_t num_cpu_states;
 	const struct pm_state_info *cpu_states;
 
@@ -170,6 +335,19 @@ const struct pm_state_info *pm_policy_next_state(uint8_t cpu, int32_t ticks)
 		}
 	}
 
+#ifdef CONFIG_PM_POLICY_PREDICT
+	/* expect wake-ups the timeouts don't know about */
+	int32_t predicted_us = predict_idle_us(cpu);
+
+	if (predicted_us >= 0) {
+		int64_t predicted_cyc = (int64_t)k_us_to_cyc_ceil64(predicted_us);
+
+		if ((cyc < 0) || (predicted_cyc < cyc)) {
+			cyc = predicted_cyc;
+		}
+	}
+#endif
+
 	for (int16_t i = (int16_t)num_cpu_states - 1; i >= 0; i--) {
 		const struct pm_state_info *state = &cpu_states[i];
 		uint32_t min_residency_cyc, exit_latency_cyc;
@@ -243,36 +421,62 @@ bool pm_policy_state_lock_is_active(enum pm_state state, uint8_t substate_id)
 	return false;
 }
 
-void pm_policy_latency_request_add(struct pm_policy_latency_request *req,
-				   uint32_t value_us)
+static void latency_request_add(struct pm_policy_latency_request *req,
+				uint8_t set_idx, uint32_t value_us)
 {
+	struct latency_set *set = &latency_sets[set_idx];
+
 	req->value_us = value_us;
+	req->set = set_idx;
 
 	k_spinlock_key_t key = k_spin_lock(&latency_lock);
 
-	sys_slist_append(&latency_reqs, &req->node);
-	update_max_latency();
+	rb_insert(&set->reqs, &req->node);
+	update_max_latency(set);
 
 	k_spin_unlock(&latency_lock, key);
 }
 
+void pm_policy_latency_request_add(struct pm_policy_latency_request *req,
+				   uint32_t value_us)
+{
+	latency_request_add(req, 0U, value_us);
+}
+
+#ifdef CONFIG_PM_POLICY_LATENCY_PER_CPU
+void pm_policy_latency_cpu_request_add(struct pm_policy_latency_request *req,
+				       uint8_t cpu, uint32_t value_us)
+{
+	__ASSERT(cpu < CONFIG_MP_MAX_NUM_CPUS, "Invalid CPU %u", cpu);
+
+	latency_request_add(req, 1U + cpu, value_us);
+}
+#endif
+
 void pm_policy_latency_request_update(struct pm_policy_latency_request *req,
 				      uint32_t value_us)
 {
+	struct latency_set *set = &latency_sets[req->set];
 	k_spinlock_key_t key = k_spin_lock(&latency_lock);
 
-	req->value_us = value_us;
-	update_max_latency();
+	/* The value is the sorting key, re-insert the request */
+	if (req->value_us != value_us) {
+		rb_remove(&set->reqs, &req->node);
+		req->value_us = value_us;
+		rb_insert(&set->reqs, &req->node);
+		update_max_latency(set);
+	}
 
 	k_spin_unlock(&latency_lock, key);
 }
 
 void pm_policy_latency_request_remove(struct pm_policy_latency_request *req)
 {
+	struct latency_set *set = &latency_sets[req->set];
 	k_spinlock_key_t key = k_spin_lock(&latency_lock);
 
-	(void)sys_slist_find_and_remove(&latency_reqs, &req->node);
-	update_max_latency();
+	rb_remove(&set->reqs, &req->node);
+	update_max_latency(set);
 
 	k_spin_unlock(&latency_lock, key);
 }
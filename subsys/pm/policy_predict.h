@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_SUBSYS_PM_POLICY_PREDICT_H_
+#define ZEPHYR_SUBSYS_PM_POLICY_PREDICT_H_
+
+#include <stdint.h>
+#include <zephyr/pm/state.h>
+
+#ifdef CONFIG_PM_POLICY_PREDICT
+/**
+ * @brief Record how long a CPU actually stayed in a power state.
+ *
+ * @param cpu CPU index.
+ * @param info Power state the CPU was in.
+ * @param idle_cyc Time spent in the power state, in cycles.
+ */
+void pm_policy_idle_update(uint8_t cpu, const struct pm_state_info *info, uint32_t idle_cyc);
+#else
+static inline void pm_policy_idle_update(uint8_t cpu, const struct pm_state_info *info,
+					 uint32_t idle_cyc) {}
+#endif /* CONFIG_PM_POLICY_PREDICT */
+
+#endif /* ZEPHYR_SUBSYS_PM_POLICY_PREDICT_H_ */
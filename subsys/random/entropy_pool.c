@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <zephyr/drivers/entropy.h>
+#include <zephyr/random/entropy_pool.h>
+
+#define POOL_SIZE CONFIG_ENTROPY_POOL_SIZE
+
+/*
+ * Each CPU takes from its own pool, so that CPUs do not contend for a lock.
+ * Bytes are taken from the top of a pool and cleared, and the refill work
+ * tops the pools up with one read from the entropy device each, outside of
+ * any lock as the read may block.
+ */
+struct entropy_pool {
+	struct k_spinlock lock;
+	uint16_t fill;
+	struct entropy_pool_stats stats;
+	uint8_t buf[POOL_SIZE];
+};
+
+static const struct device *const entropy_dev =
+	DEVICE_DT_GET(DT_CHOSEN(zephyr_entropy));
+
+static struct entropy_pool pools[CONFIG_MP_MAX_NUM_CPUS];
+
+/* Only used by the refill work */
+static uint8_t refill_buf[POOL_SIZE];
+
+static void entropy_pool_refill(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	for (size_t i = 0; i < ARRAY_SIZE(pools); i++) {
+		struct entropy_pool *pool = &pools[i];
+		k_spinlock_key_t key;
+		size_t len;
+
+		key = k_spin_lock(&pool->lock);
+		len = POOL_SIZE - pool->fill;
+		k_spin_unlock(&pool->lock, key);
+
+		if (len == 0) {
+			continue;
+		}
+
+		if (entropy_get_entropy(entropy_dev, refill_buf, len) < 0) {
+			continue;
+		}
+
+		/* The pool can only have emptied further in the meantime */
+		key = k_spin_lock(&pool->lock);
+		memcpy(&pool->buf[pool->fill], refill_buf, len);
+		pool->fill += len;
+		pool->stats.refilled += len;
+		k_spin_unlock(&pool->lock, key);
+
+		memset(refill_buf, 0, len);
+	}
+}
+
+static K_WORK_DEFINE(refill_work, entropy_pool_refill);
+
+int entropy_pool_get(void *dst, size_t len)
+{
+	uint8_t *out = dst;
+	struct entropy_pool *pool;
+	k_spinlock_key_t key;
+	unsigned int irq_key;
+	bool refill;
+	size_t n;
+	int ret;
+
+	/* Stay on this CPU while picking its pool */
+	irq_key = arch_irq_lock();
+	pool = &pools[arch_curr_cpu()->id];
+	key = k_spin_lock(&pool->lock);
+
+	n = MIN(len, pool->fill);
+	pool->fill -= n;
+	memcpy(out, &pool->buf[pool->fill], n);
+	memset(&pool->buf[pool->fill], 0, n);
+
+	if (n < len) {
+		pool->stats.underruns++;
+	}
+
+	refill = pool->fill < POOL_SIZE / 2;
+
+	k_spin_unlock(&pool->lock, key);
+	arch_irq_unlock(irq_key);
+
+	if (refill) {
+		/* Fails harmlessly before the system work queue runs */
+		(void)k_work_submit(&refill_work);
+	}
+
+	if (n == len) {
+		return 0;
+	}
+
+	if (k_is_in_isr()) {
+		ret = entropy_get_entropy_isr(entropy_dev, out + n, len - n, ENTROPY_BUSYWAIT);
+
+		return (ret < 0) ? ret : 0;
+	}
+
+	return entropy_get_entropy(entropy_dev, out + n, len - n);
+}
+
+void entropy_pool_stats_get(struct entropy_pool_stats *stats)
+{
+	memset(stats, 0, sizeof(*stats));
+
+	for (size_t i = 0; i < ARRAY_SIZE(pools); i++) {
+		k_spinlock_key_t key = k_spin_lock(&pools[i].lock);
+
+		stats->underruns += pools[i].stats.underruns;
+		stats->refilled += pools[i].stats.refilled;
+		k_spin_unlock(&pools[i].lock, key);
+	}
+}
+
+static int entropy_pool_init(void)
+{
+	if (!device_is_ready(entropy_dev)) {
+		return -ENODEV;
+	}
+
+	(void)k_work_submit(&refill_work);
+
+	return 0;
+}
+
+SYS_INIT(entropy_pool_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
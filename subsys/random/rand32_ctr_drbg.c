@@ -8,6 +8,7 @@
 #include <zephyr/device.h>
 #include <zephyr/drivers/entropy.h>
 #include <zephyr/kernel.h>
+#include <zephyr/random/entropy_pool.h>
 #include <string.h>
 
 #if defined(CONFIG_MBEDTLS)
@@ -35,13 +36,22 @@ static const unsigned char drbg_seed[] = CONFIG_CS_CTR_DRBG_PERSONALIZATION;
 static bool ctr_initialised;
 static struct k_mutex ctr_lock;
 
+static int ctr_drbg_get_entropy(uint8_t *buf, size_t len)
+{
+	if (IS_ENABLED(CONFIG_ENTROPY_POOL)) {
+		return entropy_pool_get(buf, len);
+	}
+
+	return entropy_get_entropy(entropy_dev, buf, len);
+}
+
 #if defined(CONFIG_MBEDTLS)
 
 static mbedtls_ctr_drbg_context ctr_ctx;
 
 static int ctr_drbg_entropy_func(void *ctx, unsigned char *buf, size_t len)
 {
-	return entropy_get_entropy(entropy_dev, (void *)buf, len);
+	return ctr_drbg_get_entropy(buf, len);
 }
 
 #elif defined(CONFIG_TINYCRYPT)
@@ -81,8 +91,7 @@ static int ctr_drbg_initialize(void)
 
 	uint8_t entropy[TC_AES_KEY_SIZE + TC_AES_BLOCK_SIZE];
 
-	ret = entropy_get_entropy(entropy_dev, (void *)&entropy,
-				  sizeof(entropy));
+	ret = ctr_drbg_get_entropy(entropy, sizeof(entropy));
 	if (ret != 0) {
 		return -EIO;
 	}
@@ -131,8 +140,7 @@ int z_impl_sys_csrand_get(void *dst, uint32_t outlen)
 		ret = 0;
 	} else if (ret == TC_CTR_PRNG_RESEED_REQ) {
 
-		ret = entropy_get_entropy(entropy_dev,
-				    (void *)&entropy, sizeof(entropy));
+		ret = ctr_drbg_get_entropy(entropy, sizeof(entropy));
 		if (ret != 0) {
 			ret = -EIO;
 			goto end;
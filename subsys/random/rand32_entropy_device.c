@@ -7,11 +7,21 @@
 #include <zephyr/sys/atomic.h>
 #include <zephyr/kernel.h>
 #include <zephyr/drivers/entropy.h>
+#include <zephyr/random/entropy_pool.h>
 #include <string.h>
 
 static const struct device *const entropy_dev =
 	DEVICE_DT_GET(DT_CHOSEN(zephyr_entropy));
 
+static inline int get_entropy(uint8_t *dst, size_t len)
+{
+	if (IS_ENABLED(CONFIG_ENTROPY_POOL)) {
+		return entropy_pool_get(dst, len);
+	}
+
+	return entropy_get_entropy(entropy_dev, dst, len);
+}
+
 #if defined(CONFIG_ENTROPY_DEVICE_RANDOM_GENERATOR)
 uint32_t z_impl_sys_rand32_get(void)
 {
@@ -21,8 +31,7 @@ uint32_t z_impl_sys_rand32_get(void)
 	__ASSERT(device_is_ready(entropy_dev), "Entropy device %s not ready",
 		 entropy_dev->name);
 
-	ret = entropy_get_entropy(entropy_dev, (uint8_t *)&random_num,
-				  sizeof(random_num));
+	ret = get_entropy((uint8_t *)&random_num, sizeof(random_num));
 	if (unlikely(ret < 0)) {
 		/* Use system timer in case the entropy device couldn't deliver
 		 * 32-bit of data.  There's not much that can be done in this
@@ -45,7 +54,7 @@ static int rand_get(uint8_t *dst, size_t outlen, bool csrand)
 	__ASSERT(device_is_ready(entropy_dev), "Entropy device %s not ready",
 		 entropy_dev->name);
 
-	ret = entropy_get_entropy(entropy_dev, dst, outlen);
+	ret = get_entropy(dst, outlen);
 
 	if (unlikely(ret < 0)) {
 		/* Don't try to fill the buffer in case of
@@ -135,6 +135,7 @@ static inline void rtio_executor_done(struct rtio_iodev_sqe *iodev_sqe, int resu
 	struct rtio_iodev_sqe *curr = iodev_sqe, *next;
 	void *userdata;
 	uint32_t sqe_flags, cqe_flags;
+	uint32_t cqe_count = 0;
 
 	do {
 		userdata = curr->sqe.userdata;
@@ -151,7 +152,8 @@ static inline void rtio_executor_done(struct rtio_iodev_sqe *iodev_sqe, int resu
 		}
 		if (!is_canceled && FIELD_GET(RTIO_SQE_NO_RESPONSE, sqe_flags) == 0) {
 			/* Request was not canceled, generate a CQE */
-			rtio_cqe_submit(r, result, userdata, cqe_flags);
+			rtio_cqe_queue(r, result, userdata, cqe_flags);
+			cqe_count++;
 		}
 		curr = next;
 		if (!is_ok) {
@@ -160,6 +162,9 @@ static inline void rtio_executor_done(struct rtio_iodev_sqe *iodev_sqe, int resu
 		}
 	} while (sqe_flags & RTIO_SQE_TRANSACTION);
 
+	/* Waiters see the completions of a transaction at once */
+	rtio_cqe_publish(r, cqe_count);
+
 	/* Curr should now be the last sqe in the transaction if that is what completed */
 	if (sqe_flags & RTIO_SQE_CHAINED) {
 		rtio_iodev_submit(curr);
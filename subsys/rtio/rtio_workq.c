@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <zephyr/init.h>
+#include <zephyr/kernel.h>
+#include <zephyr/rtio/rtio.h>
+#include <zephyr/rtio/rtio_workq.h>
+
+/*
+ * Requests are allocated from a slab and queued in a FIFO shared by the
+ * worker threads, both usable from an ISR.  A worker frees the request
+ * before running the handler, the submission holds all it needs.
+ */
+
+struct rtio_workq_req {
+	void *fifo_reserved;
+	struct rtio_iodev_sqe *iodev_sqe;
+	rtio_workq_handler_t handler;
+};
+
+K_MEM_SLAB_DEFINE_STATIC(rtio_workq_slab, sizeof(struct rtio_workq_req),
+			 CONFIG_RTIO_WORKQ_ITEMS, sizeof(void *));
+static K_FIFO_DEFINE(rtio_workq_fifo);
+
+static K_THREAD_STACK_ARRAY_DEFINE(rtio_workq_stacks, CONFIG_RTIO_WORKQ_THREADS,
+				   CONFIG_RTIO_WORKQ_STACK_SIZE);
+static struct k_thread rtio_workq_threads[CONFIG_RTIO_WORKQ_THREADS];
+
+void rtio_workq_submit(struct rtio_iodev_sqe *iodev_sqe, rtio_workq_handler_t handler)
+{
+	struct rtio_workq_req *req;
+
+	if (k_mem_slab_alloc(&rtio_workq_slab, (void **)&req, K_NO_WAIT) != 0) {
+		rtio_iodev_sqe_err(iodev_sqe, -ENOMEM);
+		return;
+	}
+
+	req->iodev_sqe = iodev_sqe;
+	req->handler = handler;
+	k_fifo_put(&rtio_workq_fifo, req);
+}
+
+uint32_t rtio_workq_used_count_get(void)
+{
+	return k_mem_slab_num_used_get(&rtio_workq_slab);
+}
+
+static void rtio_workq_thread(void *p1, void *p2, void *p3)
+{
+	struct rtio_workq_req *req;
+	struct rtio_iodev_sqe *iodev_sqe;
+	rtio_workq_handler_t handler;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		req = k_fifo_get(&rtio_workq_fifo, K_FOREVER);
+		iodev_sqe = req->iodev_sqe;
+		handler = req->handler;
+		k_mem_slab_free(&rtio_workq_slab, req);
+
+		handler(iodev_sqe);
+	}
+}
+
+static int rtio_workq_init(void)
+{
+	for (int i = 0; i < CONFIG_RTIO_WORKQ_THREADS; i++) {
+		k_thread_create(&rtio_workq_threads[i], rtio_workq_stacks[i],
+				K_THREAD_STACK_SIZEOF(rtio_workq_stacks[i]),
+				rtio_workq_thread, NULL, NULL, NULL,
+				CONFIG_RTIO_WORKQ_THREAD_PRIORITY, 0, K_NO_WAIT);
+		k_thread_name_set(&rtio_workq_threads[i], "rtio_workq");
+	}
+
+	return 0;
+}
+
+SYS_INIT(rtio_workq_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
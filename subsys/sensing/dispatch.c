@@ -34,9 +34,161 @@ static void update_client_consume_time(struct sensing_sensor *sensor,
 	conn->next_consume_time += interval;
 }
 
+struct dispatch_buf;
+
+#ifdef CONFIG_SENSING_BATCH
+/*
+ * A buffer of the RTIO memory pool is shared by all the clients of the
+ * sensor it comes from. It returns to the pool once the dispatch and all
+ * the batches holding it are done with it.
+ */
+struct dispatch_buf {
+	uint8_t *data;
+	uint32_t len;
+	uint16_t refs;
+};
+
+struct dispatch_batch {
+	struct sensing_sensor *sensor;
+	struct sensing_connection *conn;
+	uint64_t deadline;
+	uint8_t count;
+	struct dispatch_buf *bufs[CONFIG_SENSING_BATCH_SIZE];
+};
+
+/* Each buffer takes at least one block */
+static struct dispatch_buf dispatch_bufs[CONFIG_SENSING_RTIO_BLOCK_COUNT];
+static struct dispatch_batch dispatch_batches[CONFIG_SENSING_BATCH_CLIENTS];
+
+static struct dispatch_buf *dispatch_buf_get(uint8_t *data, uint32_t len)
+{
+	for (int i = 0; i < ARRAY_SIZE(dispatch_bufs); i++) {
+		if (dispatch_bufs[i].data == NULL) {
+			dispatch_bufs[i].data = data;
+			dispatch_bufs[i].len = len;
+			dispatch_bufs[i].refs = 1;
+			return &dispatch_bufs[i];
+		}
+	}
+
+	return NULL;
+}
+
+static void dispatch_buf_put(struct dispatch_buf *buf)
+{
+	if (--buf->refs == 0) {
+		rtio_release_buffer(&sensing_rtio_ctx, buf->data, buf->len);
+		buf->data = NULL;
+	}
+}
+
+static void dispatch_batch_flush(struct dispatch_batch *batch, bool deliver)
+{
+	struct sensing_connection *conn = batch->conn;
+
+	for (int i = 0; i < batch->count; i++) {
+		if (deliver) {
+			conn->callback_list->on_data_event(conn, batch->bufs[i]->data,
+							   conn->callback_list->context);
+		}
+		dispatch_buf_put(batch->bufs[i]);
+	}
+	batch->count = 0;
+}
+
+static void dispatch_batch_free(struct dispatch_batch *batch, bool deliver)
+{
+	dispatch_batch_flush(batch, deliver);
+	batch->sensor = NULL;
+	batch->conn = NULL;
+}
+
+/* The held data of closed connections is dropped with the next data of their sensor */
+static void dispatch_batch_drop_closed(struct sensing_sensor *sensor)
+{
+	struct sensing_connection *conn;
+
+	for (int i = 0; i < ARRAY_SIZE(dispatch_batches); i++) {
+		struct dispatch_batch *batch = &dispatch_batches[i];
+		bool open = false;
+
+		if (batch->sensor != sensor) {
+			continue;
+		}
+
+		for_each_client_conn(sensor, conn) {
+			if (conn == batch->conn) {
+				open = true;
+				break;
+			}
+		}
+
+		if (!open) {
+			dispatch_batch_free(batch, false);
+		}
+	}
+}
+
+static struct dispatch_batch *dispatch_batch_get(struct sensing_sensor *sensor,
+						 struct sensing_connection *conn, bool create)
+{
+	struct dispatch_batch *free_batch = NULL;
+
+	for (int i = 0; i < ARRAY_SIZE(dispatch_batches); i++) {
+		if (dispatch_batches[i].conn == conn) {
+			return &dispatch_batches[i];
+		}
+		if ((free_batch == NULL) && (dispatch_batches[i].conn == NULL)) {
+			free_batch = &dispatch_batches[i];
+		}
+	}
+
+	if (!create || (free_batch == NULL)) {
+		return NULL;
+	}
+
+	free_batch->sensor = sensor;
+	free_batch->conn = conn;
+
+	return free_batch;
+}
+
+/* Returns whether the data is held for a later delivery */
+static bool dispatch_batch_add(struct sensing_sensor *sensor, struct sensing_connection *conn,
+			       struct dispatch_buf *buf)
+{
+	bool batching = (conn->latency != 0) && (buf != NULL);
+	struct dispatch_batch *batch = dispatch_batch_get(sensor, conn, batching);
+	uint64_t now = get_us();
+
+	if (batch == NULL) {
+		return false;
+	}
+
+	if (!batching) {
+		/* Deliver the data held before this one */
+		dispatch_batch_free(batch, true);
+		return false;
+	}
+
+	if (batch->count == 0) {
+		batch->deadline = now + conn->latency;
+	}
+
+	buf->refs++;
+	batch->bufs[batch->count++] = buf;
+
+	if ((batch->count == ARRAY_SIZE(batch->bufs)) || (now >= batch->deadline)) {
+		dispatch_batch_flush(batch, true);
+	}
+
+	return true;
+}
+#endif /* CONFIG_SENSING_BATCH */
+
 /* send data to clients based on interval and sensitivity */
 static int send_data_to_clients(struct sensing_sensor *sensor,
-				void *data)
+				void *data, struct dispatch_buf *buf)
 {
 	struct sensing_sensor *client;
 	struct sensing_connection *conn;
@@ -46,6 +198,13 @@ static int send_data_to_clients(struct sensing_sensor *sensor,
 		LOG_DBG("sensor:%s send data to client:%p", conn->source->dev->name, conn);
 
 		if (!is_client_request_data(conn)) {
+#ifdef CONFIG_SENSING_BATCH
+			struct dispatch_batch *batch = dispatch_batch_get(sensor, conn, false);
+
+			if (batch != NULL) {
+				dispatch_batch_free(batch, false);
+			}
+#endif
 			continue;
 		}
 
@@ -64,6 +223,11 @@ static int send_data_to_clients(struct sensing_sensor *sensor,
 					conn->source->dev->name);
 			continue;
 		}
+#ifdef CONFIG_SENSING_BATCH
+		if (dispatch_batch_add(sensor, conn, buf)) {
+			continue;
+		}
+#endif
 		conn->callback_list->on_data_event(conn, data,
 				conn->callback_list->context);
 	}
@@ -92,6 +256,7 @@ static void dispatch_task(void *a, void *b, void *c)
 
 	while (true) {
 		struct rtio_cqe cqe;
+		struct dispatch_buf *buf = NULL;
 
 		rc = rtio_cqe_copy_out(&sensing_rtio_ctx, &cqe, 1, K_FOREVER);
 		if (rc < 1) {
@@ -108,14 +273,27 @@ static void dispatch_task(void *a, void *b, void *c)
 			continue;
 		}
 
+#ifdef CONFIG_SENSING_BATCH
+		buf = dispatch_buf_get(data, data_len);
+#endif
+
 		if ((uintptr_t)cqe.userdata >=
 			    (uintptr_t)STRUCT_SECTION_START(sensing_sensor) &&
 		    (uintptr_t)cqe.userdata < (uintptr_t)STRUCT_SECTION_END(sensing_sensor)) {
 			struct sensing_sensor *sensor = cqe.userdata;
 
-			send_data_to_clients(sensor, data);
+#ifdef CONFIG_SENSING_BATCH
+			dispatch_batch_drop_closed(sensor);
+#endif
+			send_data_to_clients(sensor, data, buf);
 		}
 
+#ifdef CONFIG_SENSING_BATCH
+		if (buf != NULL) {
+			dispatch_buf_put(buf);
+			continue;
+		}
+#endif
 		rtio_release_buffer(&sensing_rtio_ctx, data, data_len);
 	}
 }
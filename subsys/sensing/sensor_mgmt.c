@@ -275,6 +275,9 @@ static void init_connection(struct sensing_connection *conn,
 
 	conn->interval = 0;
 	memset(conn->sensitivity, 0x00, sizeof(conn->sensitivity));
+#ifdef CONFIG_SENSING_BATCH
+	conn->latency = 0;
+#endif
 	/* link connection to its reporter's client_list */
 	sys_slist_append(&conn->source->client_list, &conn->snode);
 }
@@ -500,6 +503,28 @@ int get_sensitivity(struct sensing_connection *conn, int8_t index, uint32_t *sen
 	return 0;
 }
 
+#ifdef CONFIG_SENSING_BATCH
+int set_latency(struct sensing_connection *conn, uint64_t latency)
+{
+	__ASSERT(conn && conn->source, "set latency, connection or reporter not be NULL");
+
+	conn->latency = latency;
+
+	LOG_INF("set latency, sensor:%s, conn:%p, latency:%llu(us)",
+		conn->source->dev->name, conn, latency);
+
+	return 0;
+}
+
+int get_latency(struct sensing_connection *conn, uint64_t *latency)
+{
+	__ASSERT(conn, "get latency, connection not be NULL");
+	*latency = conn->latency;
+
+	return 0;
+}
+#endif
+
 int sensing_get_sensors(int *sensor_nums, const struct sensing_sensor_info **info)
 {
 	if (info == NULL) {
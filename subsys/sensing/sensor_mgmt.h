@@ -57,6 +57,10 @@ int set_interval(struct sensing_connection *conn, uint32_t interval);
 int get_interval(struct sensing_connection *con, uint32_t *sensitivity);
 int set_sensitivity(struct sensing_connection *conn, int8_t index, uint32_t interval);
 int get_sensitivity(struct sensing_connection *con, int8_t index, uint32_t *sensitivity);
+#ifdef CONFIG_SENSING_BATCH
+int set_latency(struct sensing_connection *conn, uint64_t latency);
+int get_latency(struct sensing_connection *conn, uint64_t *latency);
+#endif
 
 static inline struct sensing_sensor *get_sensor_by_dev(const struct device *dev)
 {
@@ -46,6 +46,18 @@ struct settings_nvs {
 
 	uint16_t cache_next;
 #endif
+#if CONFIG_SETTINGS_NVS_NAME_INDEX
+	struct {
+		uint16_t name_id;
+		uint16_t name_hash;
+		uint16_t subtree_hash;
+	} index[CONFIG_SETTINGS_NVS_NAME_INDEX_SIZE];
+
+	uint16_t index_count;
+	bool index_full;
+#endif
+	/* the largest name ID in use is stored at the end of a save operation */
+	bool save_batch;
 };
 
 /* register nvs to be a source of settings */
@@ -30,13 +30,17 @@ struct settings_nvs_read_fn_arg {
 
 static int settings_nvs_load(struct settings_store *cs,
 			     const struct settings_load_arg *arg);
+static int settings_nvs_save_start(struct settings_store *cs);
 static int settings_nvs_save(struct settings_store *cs, const char *name,
 			     const char *value, size_t val_len);
+static int settings_nvs_save_end(struct settings_store *cs);
 static void *settings_nvs_storage_get(struct settings_store *cs);
 
 static struct settings_store_itf settings_nvs_itf = {
 	.csi_load = settings_nvs_load,
+	.csi_save_start = settings_nvs_save_start,
 	.csi_save = settings_nvs_save,
+	.csi_save_end = settings_nvs_save_end,
 	.csi_storage_get = settings_nvs_storage_get
 };
 
@@ -118,80 +122,253 @@ static uint16_t settings_nvs_cache_match(struct settings_nvs *cf, const char *na
 }
 #endif /* CONFIG_SETTINGS_NVS_NAME_CACHE */
 
-static int settings_nvs_load(struct settings_store *cs,
-			     const struct settings_load_arg *arg)
+#if CONFIG_SETTINGS_NVS_NAME_INDEX
+/* The index holds the name ID of each stored setting, sorted by name ID, with
+ * the hash of the complete name and the hash of its first component. Settings
+ * of a subtree all have the same first component.
+ */
+static uint16_t settings_nvs_subtree_hash(const char *name)
 {
-	int ret = 0;
-	struct settings_nvs *cf = CONTAINER_OF(cs, struct settings_nvs, cf_store);
-	struct settings_nvs_read_fn_arg read_fn_arg;
-	char name[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN + 1];
-	char buf;
-	ssize_t rc1, rc2;
-	uint16_t name_id = NVS_NAMECNT_ID;
+	return crc16_ccitt(0xffff, name, settings_name_next(name, NULL));
+}
 
-	name_id = cf->last_name_id + 1;
+static size_t settings_nvs_index_pos(struct settings_nvs *cf, uint16_t name_id)
+{
+	size_t lo = 0;
+	size_t hi = cf->index_count;
 
-	while (1) {
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
 
-		name_id--;
-		if (name_id == NVS_NAMECNT_ID) {
-			break;
+		if (cf->index[mid].name_id < name_id) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
 		}
+	}
 
-		/* In the NVS backend, each setting item is stored in two NVS
-		 * entries one for the setting's name and one with the
-		 * setting's value.
-		 */
-		rc1 = nvs_read(&cf->cf_nvs, name_id, &name, sizeof(name));
-		rc2 = nvs_read(&cf->cf_nvs, name_id + NVS_NAME_ID_OFFSET,
-			       &buf, sizeof(buf));
-
-		if ((rc1 <= 0) && (rc2 <= 0)) {
-			/* Settings largest ID in use is invalid due to
-			 * reset, power failure or partition overflow.
-			 * Decrement it and check the next ID in subsequent
-			 * iteration.
+	return lo;
+}
+
+static void settings_nvs_index_add(struct settings_nvs *cf, const char *name,
+				   uint16_t name_id)
+{
+	size_t pos = settings_nvs_index_pos(cf, name_id);
+
+	if ((pos == cf->index_count) || (cf->index[pos].name_id != name_id)) {
+		if (cf->index_count == CONFIG_SETTINGS_NVS_NAME_INDEX_SIZE) {
+			/* Not all settings can be indexed, fall back to the
+			 * walk through all name IDs.
 			 */
-			if (name_id == cf->last_name_id) {
-				cf->last_name_id--;
-				nvs_write(&cf->cf_nvs, NVS_NAMECNT_ID,
-					  &cf->last_name_id, sizeof(uint16_t));
-			}
+			LOG_WRN("NVS name index full");
+			cf->index_full = true;
+			return;
+		}
+
+		memmove(&cf->index[pos + 1], &cf->index[pos],
+			(cf->index_count - pos) * sizeof(cf->index[0]));
+		cf->index_count++;
+	}
+
+	cf->index[pos].name_id = name_id;
+	cf->index[pos].name_hash = crc16_ccitt(0xffff, name, strlen(name));
+	cf->index[pos].subtree_hash = settings_nvs_subtree_hash(name);
+}
+
+static void settings_nvs_index_del(struct settings_nvs *cf, uint16_t name_id)
+{
+	size_t pos = settings_nvs_index_pos(cf, name_id);
 
+	if ((pos == cf->index_count) || (cf->index[pos].name_id != name_id)) {
+		return;
+	}
+
+	cf->index_count--;
+	memmove(&cf->index[pos], &cf->index[pos + 1],
+		(cf->index_count - pos) * sizeof(cf->index[0]));
+}
+
+static uint16_t settings_nvs_index_match(struct settings_nvs *cf, const char *name,
+					 char *rdname, size_t len)
+{
+	uint16_t name_hash = crc16_ccitt(0xffff, name, strlen(name));
+	int rc;
+
+	for (size_t i = 0; i < cf->index_count; i++) {
+		if (cf->index[i].name_hash != name_hash) {
 			continue;
 		}
 
-		if ((rc1 <= 0) || (rc2 <= 0)) {
-			/* Settings item is not stored correctly in the NVS.
-			 * NVS entry for its name or value is either missing
-			 * or deleted. Clean dirty entries to make space for
-			 * future settings item.
-			 */
-			nvs_delete(&cf->cf_nvs, name_id);
-			nvs_delete(&cf->cf_nvs, name_id + NVS_NAME_ID_OFFSET);
+		rc = nvs_read(&cf->cf_nvs, cf->index[i].name_id, rdname, len);
+		if (rc < 0) {
+			continue;
+		}
 
-			if (name_id == cf->last_name_id) {
-				cf->last_name_id--;
-				nvs_write(&cf->cf_nvs, NVS_NAMECNT_ID,
-					  &cf->last_name_id, sizeof(uint16_t));
-			}
+		rdname[rc] = '\0';
+
+		if (strcmp(name, rdname)) {
+			continue;
+		}
+
+		return cf->index[i].name_id;
+	}
+
+	return NVS_NAMECNT_ID;
+}
+
+/* The lowest name ID not in use */
+static uint16_t settings_nvs_index_free_id(struct settings_nvs *cf)
+{
+	size_t i;
+
+	for (i = 0; i < cf->index_count; i++) {
+		if (cf->index[i].name_id != NVS_NAMECNT_ID + 1 + i) {
+			break;
+		}
+	}
+
+	return NVS_NAMECNT_ID + 1 + i;
+}
+
+static void settings_nvs_index_build(struct settings_nvs *cf)
+{
+	char name[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN + 1];
+	ssize_t rc;
+
+	cf->index_count = 0;
+	cf->index_full = false;
 
+	for (uint16_t name_id = NVS_NAMECNT_ID + 1;
+	     name_id <= cf->last_name_id; name_id++) {
+		rc = nvs_read(&cf->cf_nvs, name_id, &name, sizeof(name));
+		if (rc <= 0) {
 			continue;
 		}
 
-		/* Found a name, this might not include a trailing \0 */
-		name[rc1] = '\0';
-		read_fn_arg.fs = &cf->cf_nvs;
-		read_fn_arg.id = name_id + NVS_NAME_ID_OFFSET;
+		name[rc] = '\0';
+		settings_nvs_index_add(cf, name, name_id);
+	}
+}
+#endif /* CONFIG_SETTINGS_NVS_NAME_INDEX */
+
+static void settings_nvs_last_name_id_store(struct settings_nvs *cf)
+{
+	/* During a save operation it is stored once, at its end */
+	if (!cf->save_batch) {
+		nvs_write(&cf->cf_nvs, NVS_NAMECNT_ID, &cf->last_name_id,
+			  sizeof(uint16_t));
+	}
+}
+
+static int settings_nvs_load_one(struct settings_nvs *cf, uint16_t name_id,
+				 const struct settings_load_arg *arg)
+{
+	struct settings_nvs_read_fn_arg read_fn_arg;
+	char name[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN + 1];
+	char buf;
+	ssize_t rc1, rc2;
+
+	/* In the NVS backend, each setting item is stored in two NVS
+	 * entries one for the setting's name and one with the
+	 * setting's value.
+	 */
+	rc1 = nvs_read(&cf->cf_nvs, name_id, &name, sizeof(name));
+	rc2 = nvs_read(&cf->cf_nvs, name_id + NVS_NAME_ID_OFFSET,
+		       &buf, sizeof(buf));
+
+	if ((rc1 <= 0) && (rc2 <= 0)) {
+		/* Settings largest ID in use is invalid due to
+		 * reset, power failure or partition overflow.
+		 * Decrement it and check the next ID in subsequent
+		 * iteration.
+		 */
+		if (name_id == cf->last_name_id) {
+			cf->last_name_id--;
+			settings_nvs_last_name_id_store(cf);
+		}
+
+		return 0;
+	}
+
+	if ((rc1 <= 0) || (rc2 <= 0)) {
+		/* Settings item is not stored correctly in the NVS.
+		 * NVS entry for its name or value is either missing
+		 * or deleted. Clean dirty entries to make space for
+		 * future settings item.
+		 */
+		nvs_delete(&cf->cf_nvs, name_id);
+		nvs_delete(&cf->cf_nvs, name_id + NVS_NAME_ID_OFFSET);
+
+#if CONFIG_SETTINGS_NVS_NAME_INDEX
+		settings_nvs_index_del(cf, name_id);
+#endif
+
+		if (name_id == cf->last_name_id) {
+			cf->last_name_id--;
+			settings_nvs_last_name_id_store(cf);
+		}
+
+		return 0;
+	}
+
+	/* Found a name, this might not include a trailing \0 */
+	name[rc1] = '\0';
+	read_fn_arg.fs = &cf->cf_nvs;
+	read_fn_arg.id = name_id + NVS_NAME_ID_OFFSET;
 
 #if CONFIG_SETTINGS_NVS_NAME_CACHE
-		settings_nvs_cache_add(cf, name, name_id);
+	settings_nvs_cache_add(cf, name, name_id);
+#endif
+
+	return settings_call_set_handler(name, rc2, settings_nvs_read_fn,
+					 &read_fn_arg, (void *)arg);
+}
+
+static int settings_nvs_load(struct settings_store *cs,
+			     const struct settings_load_arg *arg)
+{
+	int ret = 0;
+	struct settings_nvs *cf = CONTAINER_OF(cs, struct settings_nvs, cf_store);
+	uint16_t name_id = NVS_NAMECNT_ID;
+
+#if CONFIG_SETTINGS_NVS_NAME_INDEX
+	if (!cf->index_full) {
+		uint16_t subtree_hash = 0;
+
+		if (arg->subtree) {
+			subtree_hash = settings_nvs_subtree_hash(arg->subtree);
+		}
+
+		/* Only read the settings of the subtree, from the highest
+		 * name ID like the walk. Removing a dirty entry from the
+		 * index only moves the entries already loaded.
+		 */
+		for (size_t i = cf->index_count; i-- > 0;) {
+			if (arg->subtree &&
+			    (cf->index[i].subtree_hash != subtree_hash)) {
+				continue;
+			}
+
+			ret = settings_nvs_load_one(cf, cf->index[i].name_id, arg);
+			if (ret) {
+				break;
+			}
+		}
+
+		return ret;
+	}
 #endif
 
-		ret = settings_call_set_handler(
-			name, rc2,
-			settings_nvs_read_fn, &read_fn_arg,
-			(void *)arg);
+	name_id = cf->last_name_id + 1;
+
+	while (1) {
+
+		name_id--;
+		if (name_id == NVS_NAMECNT_ID) {
+			break;
+		}
+
+		ret = settings_nvs_load_one(cf, name_id, arg);
 		if (ret) {
 			break;
 		}
@@ -199,6 +376,29 @@ static int settings_nvs_load(struct settings_store *cs,
 	return ret;
 }
 
+static int settings_nvs_save_start(struct settings_store *cs)
+{
+	struct settings_nvs *cf = CONTAINER_OF(cs, struct settings_nvs, cf_store);
+
+	cf->save_batch = true;
+
+	return 0;
+}
+
+static int settings_nvs_save_end(struct settings_store *cs)
+{
+	struct settings_nvs *cf = CONTAINER_OF(cs, struct settings_nvs, cf_store);
+	ssize_t rc;
+
+	cf->save_batch = false;
+
+	/* Nothing is written when the largest name ID in use is unchanged */
+	rc = nvs_write(&cf->cf_nvs, NVS_NAMECNT_ID, &cf->last_name_id,
+		       sizeof(uint16_t));
+
+	return (rc < 0) ? rc : 0;
+}
+
 static int settings_nvs_save(struct settings_store *cs, const char *name,
 			     const char *value, size_t val_len)
 {
@@ -227,6 +427,20 @@ static int settings_nvs_save(struct settings_store *cs, const char *name,
 	}
 #endif
 
+#if CONFIG_SETTINGS_NVS_NAME_INDEX
+	if (!cf->index_full) {
+		name_id = settings_nvs_index_match(cf, name, rdname, sizeof(rdname));
+		if (name_id != NVS_NAMECNT_ID) {
+			write_name_id = name_id;
+			write_name = false;
+		} else {
+			write_name_id = settings_nvs_index_free_id(cf);
+			write_name = true;
+		}
+		goto found;
+	}
+#endif
+
 	name_id = cf->last_name_id + 1;
 	write_name_id = cf->last_name_id + 1;
 	write_name = true;
@@ -277,8 +491,16 @@ found:
 			return rc;
 		}
 
+#if CONFIG_SETTINGS_NVS_NAME_INDEX
+		settings_nvs_index_del(cf, name_id);
+#endif
+
 		if (name_id == cf->last_name_id) {
 			cf->last_name_id--;
+			if (cf->save_batch) {
+				return 0;
+			}
+
 			rc = nvs_write(&cf->cf_nvs, NVS_NAMECNT_ID,
 				       &cf->last_name_id, sizeof(uint16_t));
 			if (rc < 0) {
@@ -300,10 +522,12 @@ found:
 	/* update the last_name_id and write to flash if required*/
 	if (write_name_id > cf->last_name_id) {
 		cf->last_name_id = write_name_id;
-		rc = nvs_write(&cf->cf_nvs, NVS_NAMECNT_ID, &cf->last_name_id,
-			       sizeof(uint16_t));
-		if (rc < 0) {
-			return rc;
+		if (!cf->save_batch) {
+			rc = nvs_write(&cf->cf_nvs, NVS_NAMECNT_ID,
+				       &cf->last_name_id, sizeof(uint16_t));
+			if (rc < 0) {
+				return rc;
+			}
 		}
 	}
 
@@ -320,6 +544,10 @@ found:
 		if (rc < 0) {
 			return rc;
 		}
+
+#if CONFIG_SETTINGS_NVS_NAME_INDEX
+		settings_nvs_index_add(cf, name, write_name_id);
+#endif
 	}
 
 #if CONFIG_SETTINGS_NVS_NAME_CACHE
@@ -355,6 +583,10 @@ int settings_nvs_backend_init(struct settings_nvs *cf)
 		cf->last_name_id = last_name_id;
 	}
 
+#if CONFIG_SETTINGS_NVS_NAME_INDEX
+	settings_nvs_index_build(cf);
+#endif
+
 	LOG_DBG("Initialized");
 	return 0;
 }
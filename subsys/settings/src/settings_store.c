@@ -110,6 +110,41 @@ int settings_save_one(const char *name, const void *value, size_t val_len)
 	return rc;
 }
 
+int settings_save_many(const struct settings_save_item *items, size_t count)
+{
+	int rc = 0;
+	int rc2;
+	struct settings_store *cs;
+
+	cs = settings_save_dst;
+	if (!cs) {
+		return -ENOENT;
+	}
+
+	k_mutex_lock(&settings_lock, K_FOREVER);
+
+	if (cs->cs_itf->csi_save_start) {
+		cs->cs_itf->csi_save_start(cs);
+	}
+
+	for (size_t i = 0; (rc == 0) && (i < count); i++) {
+		rc = cs->cs_itf->csi_save(cs, items[i].name,
+					  (char *)items[i].value,
+					  items[i].val_len);
+	}
+
+	if (cs->cs_itf->csi_save_end) {
+		rc2 = cs->cs_itf->csi_save_end(cs);
+		if (!rc) {
+			rc = rc2;
+		}
+	}
+
+	k_mutex_unlock(&settings_lock);
+
+	return rc;
+}
+
 int settings_delete(const char *name)
 {
 	return settings_save_one(name, NULL, 0);
@@ -103,8 +103,20 @@ static int enable_shell_dummy(void)
 	bool log_backend = CONFIG_SHELL_DUMMY_INIT_LOG_LEVEL > 0;
 	uint32_t level = (CONFIG_SHELL_DUMMY_INIT_LOG_LEVEL > LOG_LEVEL_DBG) ?
 		      CONFIG_LOG_MAX_LEVEL : CONFIG_SHELL_DUMMY_INIT_LOG_LEVEL;
+#ifdef CONFIG_SHELL_BACKEND_DUMMY_NON_INTERACTIVE
+	/* Commands are executed remotely, there is no terminal to drive */
+	static const struct shell_backend_config_flags cfg_flags = {
+		.insert_mode = 0,
+		.echo = 0,
+		.obscure = 0,
+		.mode_delete = 1,
+		.use_colors = 0,
+		.use_vt100 = 0,
+	};
+#else
 	static const struct shell_backend_config_flags cfg_flags =
 					SHELL_DEFAULT_BACKEND_CONFIG_FLAGS;
+#endif
 
 	shell_init(&shell_dummy, NULL, cfg_flags, log_backend, level);
 
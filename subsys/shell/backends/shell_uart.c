@@ -28,14 +28,60 @@ NET_BUF_POOL_DEFINE(smp_shell_rx_pool, CONFIG_MCUMGR_TRANSPORT_SHELL_RX_BUF_COUN
 		    SMP_SHELL_RX_BUF_SIZE, 0, NULL);
 #endif /* CONFIG_MCUMGR_TRANSPORT_SHELL */
 
+/*
+ * Send the content of the TX ring buffer, in one transfer per contiguous
+ * area. The output written while a transfer is in progress is sent by the
+ * next one, and the context which sets tx_busy is the ring buffer consumer.
+ */
+static void async_tx_start(struct shell_uart_async *sh_uart)
+{
+	uint8_t *data;
+	uint32_t len;
+	int err;
+
+	while (atomic_cas(&sh_uart->tx_busy, 0, 1)) {
+		len = ring_buf_get_claim(&sh_uart->tx_ringbuf, &data,
+					 sh_uart->tx_ringbuf.size);
+		if (len > 0) {
+			err = uart_tx(sh_uart->common.dev, data, len, SYS_FOREVER_US);
+			if (err == 0) {
+				return;
+			}
+
+			/* Drop the output which cannot be sent */
+			(void)ring_buf_get_finish(&sh_uart->tx_ringbuf, len);
+			atomic_clear(&sh_uart->tx_busy);
+			return;
+		}
+
+		(void)ring_buf_get_finish(&sh_uart->tx_ringbuf, 0);
+		atomic_clear(&sh_uart->tx_busy);
+
+		/* Catch the output written since the ring buffer was found empty */
+		if (ring_buf_is_empty(&sh_uart->tx_ringbuf)) {
+			return;
+		}
+	}
+}
+
 static void async_callback(const struct device *dev, struct uart_event *evt, void *user_data)
 {
 	struct shell_uart_async *sh_uart = (struct shell_uart_async *)user_data;
 
 	switch (evt->type) {
 	case  UART_TX_DONE:
-		k_sem_give(&sh_uart->tx_sem);
+	case  UART_TX_ABORTED:
+	{
+		int err = ring_buf_get_finish(&sh_uart->tx_ringbuf, evt->data.tx.len);
+
+		__ASSERT_NO_MSG(err == 0);
+		ARG_UNUSED(err);
+
+		atomic_clear(&sh_uart->tx_busy);
+		sh_uart->common.handler(SHELL_TRANSPORT_EVT_TX_RDY, sh_uart->common.context);
+		async_tx_start(sh_uart);
 		break;
+	}
 	case  UART_RX_RDY:
 		uart_async_rx_on_rdy(&sh_uart->async_rx, evt->data.rx.buf, evt->data.rx.len);
 		sh_uart->common.handler(SHELL_TRANSPORT_EVT_RX_RDY, sh_uart->common.context);
@@ -243,7 +289,9 @@ static void async_init(struct shell_uart_async *sh_uart)
 		.buf_cnt = CONFIG_SHELL_BACKEND_SERIAL_ASYNC_RX_BUFFER_COUNT,
 	};
 
-	k_sem_init(&sh_uart->tx_sem, 0, 1);
+	ring_buf_init(&sh_uart->tx_ringbuf, CONFIG_SHELL_BACKEND_SERIAL_TX_RING_BUFFER_SIZE,
+		      sh_uart->tx_buf);
+	sh_uart->tx_busy = 0;
 
 	err = uart_async_rx_init(async_rx, &sh_uart->async_rx_config);
 	(void)err;
@@ -386,20 +434,12 @@ static int irq_write(struct shell_uart_int_driven *sh_uart,
 static int async_write(struct shell_uart_async *sh_uart,
 		       const void *data, size_t length, size_t *cnt)
 {
-	int err;
-
-	err = uart_tx(sh_uart->common.dev, data, length, SYS_FOREVER_US);
-	if (err < 0) {
-		*cnt = 0;
-		return err;
-	}
-
-	err = k_sem_take(&sh_uart->tx_sem, K_FOREVER);
-	*cnt = length;
+	/* The shell waits for the TX ready event when nothing fits */
+	*cnt = ring_buf_put(&sh_uart->tx_ringbuf, data, length);
 
-	sh_uart->common.handler(SHELL_TRANSPORT_EVT_TX_RDY, sh_uart->common.context);
+	async_tx_start(sh_uart);
 
-	return err;
+	return 0;
 }
 
 static int write(const struct shell_transport *transport,
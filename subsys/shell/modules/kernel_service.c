@@ -24,6 +24,9 @@
 #if defined(CONFIG_LOG_RUNTIME_FILTERING)
 #include <zephyr/logging/log_ctrl.h>
 #endif
+#if defined(CONFIG_INIT_PROFILING)
+#include <zephyr/debug/init_profile.h>
+#endif
 
 #if defined(CONFIG_THREAD_MAX_NAME_LEN)
 #define THREAD_MAX_NAM_LEN CONFIG_THREAD_MAX_NAME_LEN
@@ -93,6 +96,144 @@ static int cmd_kernel_cycles(const struct shell *sh,
 	return 0;
 }
 
+#if defined(CONFIG_INIT_PROFILING)
+static int cmd_kernel_boot_profile(const struct shell *sh,
+				   size_t argc, char **argv)
+{
+	const struct init_profile_record *record;
+	const struct init_profile_boot *boot = init_profile_boot_get();
+	bool csv = (argc > 1) && (strcmp(argv[1], "csv") == 0);
+	size_t count;
+	size_t dropped;
+
+	if ((argc > 1) && !csv) {
+		shell_help(sh);
+		return SHELL_CMD_HELP_PRINTED;
+	}
+
+	record = init_profile_get(&count, &dropped);
+
+	if (csv) {
+		shell_print(sh, "init_profile,level,prio,name,device,start,end,"
+			    "cycles,result");
+	} else {
+		shell_print(sh, "%-5s %-4s %-10s %-10s %-6s %s",
+			    "level", "prio", "start(us)", "time(us)",
+			    "result", "name");
+	}
+
+	for (size_t i = 0; i < count; i++, record++) {
+		uint32_t cycles = record->end - record->start;
+
+		if (csv) {
+			shell_print(sh, "init_profile,%u,%u,%s,%u,%u,%u,%u,%d",
+				    record->level, record->entry->init_prio,
+				    init_profile_name(record),
+				    (record->entry->dev != NULL) ? 1U : 0U,
+				    record->start, record->end, cycles,
+				    record->result);
+		} else {
+			shell_print(sh, "%-5u %-4u %-10u %-10u %-6d %s",
+				    record->level, record->entry->init_prio,
+				    k_cyc_to_us_floor32(record->start - boot->cstart),
+				    k_cyc_to_us_floor32(cycles), record->result,
+				    init_profile_name(record));
+		}
+	}
+
+	if (csv) {
+		shell_print(sh, "init_profile_boot,cstart,%u,main,%u,dropped,%zu",
+			    boot->cstart, boot->main, dropped);
+	} else {
+		shell_print(sh, "main() called %u us after z_cstart()",
+			    k_cyc_to_us_floor32(boot->main - boot->cstart));
+		if (dropped != 0) {
+			shell_print(sh, "%zu entries not recorded", dropped);
+		}
+	}
+
+	return 0;
+}
+#endif
+
+#if defined(CONFIG_OBJ_CORE_STATS_SPINLOCK) || defined(CONFIG_OBJ_CORE_STATS_MUTEX)
+struct lockstat_ctx {
+	const struct shell *sh;
+	bool reset;
+	bool spinlock;
+};
+
+static int lockstat_print(struct k_obj_core *obj_core, void *data)
+{
+	struct lockstat_ctx *ctx = data;
+	struct k_lock_stats stats;
+	char name[24] = "";
+
+	if (k_obj_core_stats_raw(obj_core, &stats, sizeof(stats)) != 0) {
+		return 0;
+	}
+
+#if defined(CONFIG_OBJ_CORE_STATS_SPINLOCK)
+	if (ctx->spinlock) {
+		snprintk(name, sizeof(name), "spin %s",
+			 CONTAINER_OF(obj_core, struct k_spinlock_obj, obj_core)->name);
+	}
+#endif
+#if defined(CONFIG_OBJ_CORE_STATS_MUTEX)
+	if (!ctx->spinlock) {
+		snprintk(name, sizeof(name), "mutex %p",
+			 CONTAINER_OF(obj_core, struct k_mutex, obj_core));
+	}
+#endif
+
+	shell_print(ctx->sh, "%-24s %-10llu %-10llu %-10llu %-10u %-10u", name,
+		    (unsigned long long)stats.acquired,
+		    (unsigned long long)stats.contended,
+		    (unsigned long long)k_cyc_to_us_floor64(stats.wait_total),
+		    k_cyc_to_us_floor32(stats.wait_max),
+		    k_cyc_to_us_floor32(stats.hold_max));
+
+	if (ctx->reset) {
+		(void)k_obj_core_stats_reset(obj_core);
+	}
+
+	return 0;
+}
+
+static int cmd_kernel_lockstat(const struct shell *sh,
+			       size_t argc, char **argv)
+{
+	struct lockstat_ctx ctx = {
+		.sh = sh,
+		.reset = (argc > 1) && (strcmp(argv[1], "reset") == 0),
+	};
+	struct k_obj_type *type;
+
+	if ((argc > 1) && !ctx.reset) {
+		shell_help(sh);
+		return SHELL_CMD_HELP_PRINTED;
+	}
+
+	shell_print(sh, "%-24s %-10s %-10s %-10s %-10s %-10s", "lock",
+		    "acquired", "contended", "wait(us)", "wmax(us)", "hmax(us)");
+
+	/* The stats functions take the object core lock themselves */
+	type = k_obj_type_find(K_OBJ_TYPE_SPINLOCK_ID);
+	if (type != NULL) {
+		ctx.spinlock = true;
+		k_obj_type_walk_unlocked(type, lockstat_print, &ctx);
+	}
+
+	type = k_obj_type_find(K_OBJ_TYPE_MUTEX_ID);
+	if (type != NULL) {
+		ctx.spinlock = false;
+		k_obj_type_walk_unlocked(type, lockstat_print, &ctx);
+	}
+
+	return 0;
+}
+#endif
+
 #if defined(CONFIG_INIT_STACKS) && defined(CONFIG_THREAD_STACK_INFO) && \
 	defined(CONFIG_THREAD_MONITOR)
 static void shell_tdata_dump(const struct k_thread *cthread, void *user_data)
@@ -158,6 +299,26 @@ static void shell_tdata_dump(const struct k_thread *cthread, void *user_data)
 			    (uint32_t)rt_stats_thread.peak_cycles);
 		shell_print(sh, "\tAverage execution cycles: %u",
 			    (uint32_t)rt_stats_thread.average_cycles);
+#endif
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+		shell_print(sh, "\tPeak latency cycles: %u, preemptions: %u",
+			    rt_stats_thread.latency_max,
+			    rt_stats_thread.preemptions);
+		for (int i = 0; i < CONFIG_SCHED_THREAD_USAGE_LATENCY_BUCKETS; i++) {
+			if (rt_stats_thread.latency_hist[i] == 0U) {
+				continue;
+			}
+
+			if (i == CONFIG_SCHED_THREAD_USAGE_LATENCY_BUCKETS - 1) {
+				shell_print(sh, "\t  latency >= %u cycles: %u",
+					    BIT(CONFIG_SCHED_THREAD_USAGE_LATENCY_SHIFT + i - 1),
+					    rt_stats_thread.latency_hist[i]);
+			} else {
+				shell_print(sh, "\t  latency < %u cycles: %u",
+					    BIT(CONFIG_SCHED_THREAD_USAGE_LATENCY_SHIFT + i),
+					    rt_stats_thread.latency_hist[i]);
+			}
+		}
 #endif
 	} else {
 		shell_print(sh, "\tTotal execution cycles: ? (? %%)");
@@ -389,7 +550,17 @@ SHELL_STATIC_SUBCMD_SET_CREATE(sub_kernel_reboot,
 #endif
 
 SHELL_STATIC_SUBCMD_SET_CREATE(sub_kernel,
+#if defined(CONFIG_INIT_PROFILING)
+	SHELL_CMD_ARG(boot-profile, NULL,
+		      "Run time of each init entry. Use \"csv\" for a "
+		      "machine-readable dump.", cmd_kernel_boot_profile, 1, 1),
+#endif
 	SHELL_CMD(cycles, NULL, "Kernel cycles.", cmd_kernel_cycles),
+#if defined(CONFIG_OBJ_CORE_STATS_SPINLOCK) || defined(CONFIG_OBJ_CORE_STATS_MUTEX)
+	SHELL_CMD_ARG(lockstat, NULL,
+		      "Lock contention statistics. Use \"reset\" to clear "
+		      "them after printing.", cmd_kernel_lockstat, 1, 1),
+#endif
 #if defined(CONFIG_REBOOT)
 	SHELL_CMD(reboot, &sub_kernel_reboot, "Reboot.", NULL),
 #endif
@@ -1221,7 +1221,7 @@ static int instance_init(const struct shell *sh,
 	}
 
 	if (IS_ENABLED(CONFIG_SHELL_STATS)) {
-		sh->stats->log_lost_cnt = 0;
+		z_shell_stats_reset(sh);
 	}
 
 	z_flag_tx_rdy_set(sh, true);
@@ -385,7 +385,15 @@ static int cmd_shell_stats_show(const struct shell *sh, size_t argc,
 	ARG_UNUSED(argc);
 	ARG_UNUSED(argv);
 
+	int64_t elapsed = MAX(k_uptime_get() - sh->stats->reset_time, 1);
+	atomic_val_t tx_bytes = atomic_get(&sh->stats->tx_bytes_cnt);
+
 	shell_print(sh, "Lost logs: %lu", sh->stats->log_lost_cnt);
+	shell_print(sh, "Output: %lu bytes, %lu writes, %lu waits for transport",
+		    tx_bytes, atomic_get(&sh->stats->tx_write_cnt),
+		    atomic_get(&sh->stats->tx_pend_cnt));
+	shell_print(sh, "Average output rate: %u B/s",
+		    (uint32_t)(((uint64_t)tx_bytes * MSEC_PER_SEC) / elapsed));
 
 	return 0;
 }
@@ -396,7 +404,7 @@ static int cmd_shell_stats_reset(const struct shell *sh,
 	ARG_UNUSED(argc);
 	ARG_UNUSED(argv);
 
-	sh->stats->log_lost_cnt = 0;
+	z_shell_stats_reset(sh);
 
 	return 0;
 }
@@ -439,8 +439,17 @@ void z_shell_write(const struct shell *sh, const void *data,
 		__ASSERT_NO_MSG(length >= tmp_cnt);
 		offset += tmp_cnt;
 		length -= tmp_cnt;
+
+		if (IS_ENABLED(CONFIG_SHELL_STATS)) {
+			atomic_add(&sh->stats->tx_bytes_cnt, tmp_cnt);
+			atomic_inc(&sh->stats->tx_write_cnt);
+		}
+
 		if (tmp_cnt == 0 &&
 		    (sh->ctx->state != SHELL_STATE_PANIC_MODE_ACTIVE)) {
+			if (IS_ENABLED(CONFIG_SHELL_STATS)) {
+				atomic_inc(&sh->stats->tx_pend_cnt);
+			}
 			shell_pend_on_txdone(sh);
 		}
 	}
@@ -25,6 +25,15 @@ static inline void z_shell_raw_fprintf(const struct shell_fprintf *const ctx,
 	va_end(args);
 }
 
+static inline void z_shell_stats_reset(const struct shell *sh)
+{
+	sh->stats->log_lost_cnt = 0;
+	sh->stats->tx_bytes_cnt = 0;
+	sh->stats->tx_write_cnt = 0;
+	sh->stats->tx_pend_cnt = 0;
+	sh->stats->reset_time = k_uptime_get();
+}
+
 /* Macro to send VT100 command. */
 #define Z_SHELL_VT100_CMD(_shell_, ...)					\
 	do {								\
@@ -60,26 +60,45 @@ int flash_area_read(const struct flash_area *fa, off_t off, void *dst,
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_FLASH_MAP_READ_CACHE
+	return flash_map_cache_read(fa->fa_dev, fa->fa_off + off, dst, len);
+#else
 	return flash_read(fa->fa_dev, fa->fa_off + off, dst, len);
+#endif
 }
 
 int flash_area_write(const struct flash_area *fa, off_t off, const void *src,
 		     size_t len)
 {
+	int rc;
+
 	if (!is_in_flash_area_bounds(fa, off, len)) {
 		return -EINVAL;
 	}
 
-	return flash_write(fa->fa_dev, fa->fa_off + off, (void *)src, len);
+	rc = flash_write(fa->fa_dev, fa->fa_off + off, (void *)src, len);
+#ifdef CONFIG_FLASH_MAP_READ_CACHE
+	/* The content of a failed write is unknown, drop it */
+	flash_map_cache_update(fa->fa_dev, fa->fa_off + off, (rc == 0) ? src : NULL, len);
+#endif
+
+	return rc;
 }
 
 int flash_area_erase(const struct flash_area *fa, off_t off, size_t len)
 {
+	int rc;
+
 	if (!is_in_flash_area_bounds(fa, off, len)) {
 		return -EINVAL;
 	}
 
-	return flash_erase(fa->fa_dev, fa->fa_off + off, len);
+	rc = flash_erase(fa->fa_dev, fa->fa_off + off, len);
+#ifdef CONFIG_FLASH_MAP_READ_CACHE
+	flash_map_cache_update(fa->fa_dev, fa->fa_off + off, NULL, len);
+#endif
+
+	return rc;
 }
 
 uint32_t flash_area_align(const struct flash_area *fa)
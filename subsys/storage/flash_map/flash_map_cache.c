@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/flash.h>
+#include <zephyr/storage/flash_map.h>
+#include "flash_map_priv.h"
+
+/*
+ * Set associative cache of flash lines, shared by all the flash devices.
+ * A line is picked in its set by the line number, and the least recently
+ * used line of the set is refilled on a miss.  Reads covering a whole line
+ * go straight to the device.
+ */
+
+#define LINE_SIZE CONFIG_FLASH_MAP_READ_CACHE_LINE_SIZE
+#define SETS	  CONFIG_FLASH_MAP_READ_CACHE_SETS
+#define WAYS	  CONFIG_FLASH_MAP_READ_CACHE_WAYS
+
+BUILD_ASSERT((LINE_SIZE & (LINE_SIZE - 1)) == 0, "line size must be a power of two");
+
+struct fmc_line {
+	const struct device *dev;
+	off_t addr;
+	uint32_t used;
+};
+
+static struct fmc_line fmc_lines[SETS][WAYS];
+static uint8_t fmc_data[SETS][WAYS][LINE_SIZE] __aligned(4);
+static struct flash_area_cache_stats fmc_stats;
+static uint32_t fmc_clock;
+static K_MUTEX_DEFINE(fmc_mutex);
+
+static inline size_t fmc_set(off_t addr)
+{
+	return ((size_t)addr / LINE_SIZE) % SETS;
+}
+
+static int fmc_lookup(const struct device *dev, off_t addr)
+{
+	const struct fmc_line *set = fmc_lines[fmc_set(addr)];
+
+	for (int i = 0; i < WAYS; i++) {
+		if ((set[i].dev == dev) && (set[i].addr == addr)) {
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+static int fmc_fill(const struct device *dev, off_t addr)
+{
+	struct fmc_line *set = fmc_lines[fmc_set(addr)];
+	int way = 0;
+
+	for (int i = 1; i < WAYS; i++) {
+		if (set[i].used < set[way].used) {
+			way = i;
+		}
+	}
+
+	set[way].dev = NULL;
+	if (flash_read(dev, addr, fmc_data[fmc_set(addr)][way], LINE_SIZE) != 0) {
+		/* Typically a line running past the end of the device */
+		return -1;
+	}
+	set[way].dev = dev;
+	set[way].addr = addr;
+
+	return way;
+}
+
+int flash_map_cache_read(const struct device *dev, off_t addr, void *dst, size_t len)
+{
+	uint8_t *out = dst;
+	int rc = 0;
+
+	k_mutex_lock(&fmc_mutex, K_FOREVER);
+
+	while ((len > 0) && (rc == 0)) {
+		off_t line = addr & ~(off_t)(LINE_SIZE - 1);
+		size_t pos = addr - line;
+		size_t chunk = MIN(len, LINE_SIZE - pos);
+		int way = fmc_lookup(dev, line);
+
+		if (way >= 0) {
+			fmc_stats.hits++;
+		} else if (chunk == LINE_SIZE) {
+			fmc_stats.bypass++;
+		} else {
+			fmc_stats.misses++;
+			way = fmc_fill(dev, line);
+		}
+
+		if (way >= 0) {
+			fmc_lines[fmc_set(line)][way].used = ++fmc_clock;
+			memcpy(out, &fmc_data[fmc_set(line)][way][pos], chunk);
+		} else {
+			rc = flash_read(dev, addr, out, chunk);
+		}
+
+		addr += chunk;
+		out += chunk;
+		len -= chunk;
+	}
+
+	k_mutex_unlock(&fmc_mutex);
+
+	return rc;
+}
+
+void flash_map_cache_update(const struct device *dev, off_t addr, const void *src, size_t len)
+{
+	const uint8_t *in = src;
+
+	k_mutex_lock(&fmc_mutex, K_FOREVER);
+
+	while (len > 0) {
+		off_t line = addr & ~(off_t)(LINE_SIZE - 1);
+		size_t pos = addr - line;
+		size_t chunk = MIN(len, LINE_SIZE - pos);
+		int way = fmc_lookup(dev, line);
+
+		if (way >= 0) {
+			if (in != NULL) {
+				memcpy(&fmc_data[fmc_set(line)][way][pos], in, chunk);
+			} else {
+				fmc_lines[fmc_set(line)][way].dev = NULL;
+			}
+		}
+
+		addr += chunk;
+		if (in != NULL) {
+			in += chunk;
+		}
+		len -= chunk;
+	}
+
+	k_mutex_unlock(&fmc_mutex);
+}
+
+void flash_area_cache_invalidate(void)
+{
+	k_mutex_lock(&fmc_mutex, K_FOREVER);
+	memset(fmc_lines, 0, sizeof(fmc_lines));
+	k_mutex_unlock(&fmc_mutex);
+}
+
+void flash_area_cache_stats_get(struct flash_area_cache_stats *stats, bool reset)
+{
+	k_mutex_lock(&fmc_mutex, K_FOREVER);
+	*stats = fmc_stats;
+	if (reset) {
+		memset(&fmc_stats, 0, sizeof(fmc_stats));
+	}
+	k_mutex_unlock(&fmc_mutex);
+}
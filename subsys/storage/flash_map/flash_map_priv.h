@@ -36,4 +36,11 @@ static inline bool is_in_flash_area_bounds(const struct flash_area *fa,
 	return (off >= 0) && ((off + len) <= fa->fa_size);
 }
 
+#ifdef CONFIG_FLASH_MAP_READ_CACHE
+int flash_map_cache_read(const struct device *dev, off_t addr, void *dst, size_t len);
+
+/* Copy written data over the cached lines, or drop them when src is NULL */
+void flash_map_cache_update(const struct device *dev, off_t addr, const void *src, size_t len);
+#endif
+
 #endif /* ZEPHYR_SUBSYS_STORAGE_FLASH_MAP_PRIV_H_ */
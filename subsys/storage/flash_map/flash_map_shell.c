@@ -56,8 +56,30 @@ static int cmd_flash_map_list(const struct shell *sh, size_t argc, char **argv)
 	return 0;
 }
 
+#ifdef CONFIG_FLASH_MAP_READ_CACHE
+static int cmd_flash_map_cache(const struct shell *sh, size_t argc, char **argv)
+{
+	struct flash_area_cache_stats stats;
+	bool reset = (argc > 1) && (strcmp(argv[1], "reset") == 0);
+	uint32_t total;
+
+	flash_area_cache_stats_get(&stats, reset);
+	total = stats.hits + stats.misses;
+
+	shell_print(sh, "hits: %u misses: %u bypass: %u hit rate: %u%%",
+		    stats.hits, stats.misses, stats.bypass,
+		    (total > 0) ? (uint32_t)((100ULL * stats.hits) / total) : 0);
+
+	return 0;
+}
+#endif
+
 SHELL_STATIC_SUBCMD_SET_CREATE(sub_flash_map,
 	/* Alphabetically sorted. */
+#ifdef CONFIG_FLASH_MAP_READ_CACHE
+	SHELL_CMD_ARG(cache, NULL, "Show read cache statistics [reset]",
+		      cmd_flash_map_cache, 1, 1),
+#endif
 	SHELL_CMD(list, NULL, "List flash areas", cmd_flash_map_list),
 	SHELL_SUBCMD_SET_END /* Array terminated. */
 );
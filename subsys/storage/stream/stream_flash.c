@@ -104,23 +104,18 @@ int stream_flash_erase_page(struct stream_flash_ctx *ctx, off_t off)
 
 #endif /* CONFIG_STREAM_FLASH_ERASE */
 
-static int flash_sync(struct stream_flash_ctx *ctx)
+static int flash_write_buf(struct stream_flash_ctx *ctx, uint8_t *buf,
+			   size_t buf_bytes, size_t write_addr)
 {
 	int rc = 0;
-	size_t write_addr = ctx->offset + ctx->bytes_written;
 	size_t buf_bytes_aligned;
 	size_t fill_length;
 	uint8_t filler;
 
-
-	if (ctx->buf_bytes == 0) {
-		return 0;
-	}
-
 	if (IS_ENABLED(CONFIG_STREAM_FLASH_ERASE)) {
 
 		rc = stream_flash_erase_page(ctx,
-					     write_addr + ctx->buf_bytes - 1);
+					     write_addr + buf_bytes - 1);
 		if (rc < 0) {
 			LOG_ERR("stream_flash_erase_page err %d offset=0x%08zx",
 				rc, write_addr);
@@ -129,17 +124,17 @@ static int flash_sync(struct stream_flash_ctx *ctx)
 	}
 
 	fill_length = flash_get_write_block_size(ctx->fdev);
-	if (ctx->buf_bytes % fill_length) {
-		fill_length -= ctx->buf_bytes % fill_length;
+	if (buf_bytes % fill_length) {
+		fill_length -= buf_bytes % fill_length;
 		filler = flash_get_parameters(ctx->fdev)->erase_value;
 
-		memset(ctx->buf + ctx->buf_bytes, filler, fill_length);
+		memset(buf + buf_bytes, filler, fill_length);
 	} else {
 		fill_length = 0;
 	}
 
-	buf_bytes_aligned = ctx->buf_bytes + fill_length;
-	rc = flash_write(ctx->fdev, write_addr, ctx->buf, buf_bytes_aligned);
+	buf_bytes_aligned = buf_bytes + fill_length;
+	rc = flash_write(ctx->fdev, write_addr, buf, buf_bytes_aligned);
 
 	if (rc != 0) {
 		LOG_ERR("flash_write error %d offset=0x%08zx", rc,
@@ -151,24 +146,168 @@ static int flash_sync(struct stream_flash_ctx *ctx)
 		/* Invert to ensure that caller is able to discover a faulty
 		 * flash_read() even if no error code is returned.
 		 */
-		for (int i = 0; i < ctx->buf_bytes; i++) {
-			ctx->buf[i] = ~ctx->buf[i];
+		for (int i = 0; i < buf_bytes; i++) {
+			buf[i] = ~buf[i];
 		}
 
-		rc = flash_read(ctx->fdev, write_addr, ctx->buf,
-				ctx->buf_bytes);
+		rc = flash_read(ctx->fdev, write_addr, buf, buf_bytes);
 		if (rc != 0) {
 			LOG_ERR("flash read failed: %d", rc);
 			return rc;
 		}
 
-		rc = ctx->callback(ctx->buf, ctx->buf_bytes, write_addr);
+		rc = ctx->callback(buf, buf_bytes, write_addr);
 		if (rc != 0) {
 			LOG_ERR("callback failed: %d", rc);
 			return rc;
 		}
 	}
 
+	return rc;
+}
+
+#ifdef CONFIG_STREAM_FLASH_BACKGROUND
+
+static K_THREAD_STACK_DEFINE(stream_flash_wq_stack,
+			     CONFIG_STREAM_FLASH_BACKGROUND_STACK_SIZE);
+static struct k_work_q stream_flash_wq;
+
+static void stream_flash_bg_work(struct k_work *work)
+{
+	struct stream_flash_ctx *ctx = CONTAINER_OF(work, struct stream_flash_ctx,
+						    bg_work);
+	size_t write_addr = ctx->offset + ctx->bytes_written;
+	int rc;
+
+	rc = flash_write_buf(ctx, ctx->bg_buf, ctx->bg_bytes, write_addr);
+
+#ifdef CONFIG_STREAM_FLASH_ERASE
+	size_t next_addr = write_addr + ctx->bg_bytes;
+	size_t end_addr = ctx->offset + ctx->available;
+
+	/* Erase the page the next buffer ends in while it is being filled */
+	if ((rc == 0) && (next_addr < end_addr)) {
+		(void)stream_flash_erase_page(ctx,
+					      MIN(next_addr + ctx->buf_len, end_addr) - 1);
+	}
+#endif /* CONFIG_STREAM_FLASH_ERASE */
+
+	ctx->bg_rc = rc;
+	k_sem_give(&ctx->bg_idle);
+}
+
+/* Wait for the background write to complete and account for it. Returns
+ * with bg_idle taken.
+ */
+static int stream_flash_bg_collect(struct stream_flash_ctx *ctx)
+{
+	int rc;
+
+	k_sem_take(&ctx->bg_idle, K_FOREVER);
+
+	rc = ctx->bg_rc;
+	if (rc == 0) {
+		ctx->bytes_written += ctx->bg_bytes;
+	}
+	ctx->bg_bytes = 0U;
+	ctx->bg_rc = 0;
+
+	return rc;
+}
+
+static int stream_flash_bg_wait(struct stream_flash_ctx *ctx)
+{
+	int rc = stream_flash_bg_collect(ctx);
+
+	k_sem_give(&ctx->bg_idle);
+
+	return rc;
+}
+
+static int stream_flash_bg_sync(struct stream_flash_ctx *ctx)
+{
+	uint8_t *buf;
+	int rc;
+
+	rc = stream_flash_bg_collect(ctx);
+	if (rc != 0) {
+		k_sem_give(&ctx->bg_idle);
+		return rc;
+	}
+
+	/* Hand the filled buffer over and continue with the other one */
+	buf = ctx->bg_buf;
+	ctx->bg_buf = ctx->buf;
+	ctx->bg_bytes = ctx->buf_bytes;
+	ctx->buf = buf;
+	ctx->buf_bytes = 0U;
+
+	k_work_submit_to_queue(&stream_flash_wq, &ctx->bg_work);
+
+	return 0;
+}
+
+int stream_flash_background_enable(struct stream_flash_ctx *ctx)
+{
+	size_t half;
+
+	if (!ctx) {
+		return -EFAULT;
+	}
+
+	if (ctx->bg_buf != NULL) {
+		return 0;
+	}
+
+	half = ctx->buf_len / 2;
+	if ((ctx->buf_bytes != 0U) || (half == 0U) ||
+	    (half % flash_get_write_block_size(ctx->fdev)) != 0U) {
+		return -EINVAL;
+	}
+
+	ctx->bg_buf = ctx->buf + half;
+	ctx->buf_len = half;
+
+	return 0;
+}
+
+static int stream_flash_wq_init(void)
+{
+	struct k_work_queue_config cfg = {
+		.name = "stream_flash",
+	};
+
+	k_work_queue_start(&stream_flash_wq, stream_flash_wq_stack,
+			   K_THREAD_STACK_SIZEOF(stream_flash_wq_stack),
+			   CONFIG_STREAM_FLASH_BACKGROUND_THREAD_PRIORITY, &cfg);
+
+	return 0;
+}
+
+SYS_INIT(stream_flash_wq_init, POST_KERNEL, CONFIG_APPLICATION_INIT_PRIORITY);
+
+#endif /* CONFIG_STREAM_FLASH_BACKGROUND */
+
+static int flash_sync(struct stream_flash_ctx *ctx)
+{
+	size_t write_addr = ctx->offset + ctx->bytes_written;
+	int rc;
+
+	if (ctx->buf_bytes == 0) {
+		return 0;
+	}
+
+#ifdef CONFIG_STREAM_FLASH_BACKGROUND
+	if (ctx->bg_buf != NULL) {
+		return stream_flash_bg_sync(ctx);
+	}
+#endif
+
+	rc = flash_write_buf(ctx, ctx->buf, ctx->buf_bytes, write_addr);
+	if (rc != 0) {
+		return rc;
+	}
+
 	ctx->bytes_written += ctx->buf_bytes;
 	ctx->buf_bytes = 0U;
 
@@ -181,12 +320,18 @@ int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *dat
 	int processed = 0;
 	int rc = 0;
 	int buf_empty_bytes;
+	size_t pending;
 
 	if (!ctx) {
 		return -EFAULT;
 	}
 
-	if (ctx->bytes_written + ctx->buf_bytes + len > ctx->available) {
+	pending = ctx->bytes_written + ctx->buf_bytes;
+#ifdef CONFIG_STREAM_FLASH_BACKGROUND
+	pending += ctx->bg_bytes;
+#endif
+
+	if (pending + len > ctx->available) {
 		return -ENOMEM;
 	}
 
@@ -216,6 +361,12 @@ int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *dat
 		rc = flash_sync(ctx);
 	}
 
+#ifdef CONFIG_STREAM_FLASH_BACKGROUND
+	if (flush && (ctx->bg_buf != NULL) && (rc == 0)) {
+		rc = stream_flash_bg_wait(ctx);
+	}
+#endif
+
 	return rc;
 }
 
@@ -300,6 +451,14 @@ int stream_flash_init(struct stream_flash_ctx *ctx, const struct device *fdev,
 	ctx->last_erased_page_start_offset = -1;
 #endif
 
+#ifdef CONFIG_STREAM_FLASH_BACKGROUND
+	ctx->bg_buf = NULL;
+	ctx->bg_bytes = 0U;
+	ctx->bg_rc = 0;
+	k_work_init(&ctx->bg_work, stream_flash_bg_work);
+	k_sem_init(&ctx->bg_idle, 1, 1);
+#endif
+
 	return 0;
 }
 
@@ -7,6 +7,9 @@
 #include <zephyr/kernel.h>
 #include <zephyr/kernel_structs.h>
 #include <kernel_internal.h>
+#include <zephyr/sys/byteorder.h>
+#include <tracing_core.h>
+#include <tracing_buffer.h>
 #include <ctf_top.h>
 
 
@@ -22,13 +25,97 @@ static void _get_thread_name(struct k_thread *thread,
 	}
 }
 
+/* The name is not part of the compact scheduling events */
+static inline void _get_sched_thread_name(struct k_thread *thread,
+					  ctf_bounded_string_t *name)
+{
+	if (!IS_ENABLED(CONFIG_TRACING_CTF_COMPACT)) {
+		_get_thread_name(thread, name);
+	}
+}
+
+#if defined(CONFIG_TRACING_CTF_COMPACT)
+/* Event id of the extended header, which carries the full timestamp */
+#define CTF_COMPACT_EXTENDED 0xFF
+
+/* The timestamps in a stream are deltas to its previous event */
+#ifdef CONFIG_TRACING_BUFFER_PER_CPU
+#define CTF_COMPACT_STREAMS CONFIG_MP_MAX_NUM_CPUS
+#define CTF_COMPACT_STREAM() (arch_curr_cpu()->id)
+#else
+#define CTF_COMPACT_STREAMS 1
+#define CTF_COMPACT_STREAM() 0
+#endif
+
+static uint32_t compact_last_ts[CTF_COMPACT_STREAMS];
+static bool compact_last_valid[CTF_COMPACT_STREAMS];
+
+static inline uint32_t ctf_compact_timestamp(void)
+{
+	uint64_t cyc = IS_ENABLED(CONFIG_TIMER_HAS_64BIT_CYCLE_COUNTER) ?
+		       k_cycle_get_64() : k_cycle_get_32();
+
+	return (uint32_t)k_cyc_to_us_floor64(cyc);
+}
+
+void ctf_top_compact_emit(uint8_t *epacket, uint32_t length)
+{
+	uint8_t id = epacket[CTF_COMPACT_HDR_RESERVE];
+
+	if (!is_tracing_enabled()) {
+		return;
+	}
+
+#ifdef CONFIG_TRACING_ASYNC
+	if (is_tracing_thread()) {
+		return;
+	}
+#endif
+
+	/* The timestamp is taken and the event is put in the same locked
+	 * section, so that timestamps increase within the stream.
+	 */
+	TRACING_LOCK();
+	unsigned int stream = CTF_COMPACT_STREAM();
+	uint32_t ts = ctf_compact_timestamp();
+	uint8_t *hdr;
+
+	if (compact_last_valid[stream] && (ts - compact_last_ts[stream]) <= UINT16_MAX) {
+		/* Event id and the low 16 bits of the timestamp */
+		hdr = &epacket[CTF_COMPACT_HDR_RESERVE - 2];
+		hdr[0] = id;
+		sys_put_le16(ts, &hdr[1]);
+	} else {
+		hdr = &epacket[0];
+		hdr[0] = CTF_COMPACT_EXTENDED;
+		hdr[1] = id;
+		sys_put_le32(ts, &hdr[2]);
+	}
+
+	length -= hdr - epacket;
+
+	if (IS_ENABLED(CONFIG_TRACING_ASYNC) && (tracing_buffer_space_get() < length)) {
+		/* The event gets dropped, the host cannot follow the time
+		 * until the next full timestamp.
+		 */
+		compact_last_valid[stream] = false;
+	} else {
+		compact_last_ts[stream] = ts;
+		compact_last_valid[stream] = true;
+	}
+
+	tracing_format_raw_data(hdr, length);
+	TRACING_UNLOCK();
+}
+#endif /* CONFIG_TRACING_CTF_COMPACT */
+
 void sys_trace_k_thread_switched_out(void)
 {
 	ctf_bounded_string_t name = { "unknown" };
 	struct k_thread *thread;
 
 	thread = k_sched_current_thread_query();
-	_get_thread_name(thread, &name);
+	_get_sched_thread_name(thread, &name);
 
 	ctf_top_thread_switched_out((uint32_t)(uintptr_t)thread, name);
 }
@@ -39,7 +126,7 @@ void sys_trace_k_thread_switched_in(void)
 	ctf_bounded_string_t name = { "unknown" };
 
 	thread = k_sched_current_thread_query();
-	_get_thread_name(thread, &name);
+	_get_sched_thread_name(thread, &name);
 
 	ctf_top_thread_switched_in((uint32_t)(uintptr_t)thread, name);
 }
@@ -48,7 +135,7 @@ void sys_trace_k_thread_priority_set(struct k_thread *thread)
 {
 	ctf_bounded_string_t name = { "unknown" };
 
-	_get_thread_name(thread, &name);
+	_get_sched_thread_name(thread, &name);
 	ctf_top_thread_priority_set((uint32_t)(uintptr_t)thread,
 				    thread->base.prio, name);
 }
@@ -86,7 +173,7 @@ void sys_trace_k_thread_suspend(struct k_thread *thread)
 {
 	ctf_bounded_string_t name = { "unknown" };
 
-	_get_thread_name(thread, &name);
+	_get_sched_thread_name(thread, &name);
 	ctf_top_thread_suspend((uint32_t)(uintptr_t)thread, name);
 }
 
@@ -94,7 +181,7 @@ void sys_trace_k_thread_resume(struct k_thread *thread)
 {
 	ctf_bounded_string_t name = { "unknown" };
 
-	_get_thread_name(thread, &name);
+	_get_sched_thread_name(thread, &name);
 
 	ctf_top_thread_resume((uint32_t)(uintptr_t)thread, name);
 }
@@ -103,7 +190,7 @@ void sys_trace_k_thread_ready(struct k_thread *thread)
 {
 	ctf_bounded_string_t name = { "unknown" };
 
-	_get_thread_name(thread, &name);
+	_get_sched_thread_name(thread, &name);
 
 	ctf_top_thread_ready((uint32_t)(uintptr_t)thread, name);
 }
@@ -117,7 +204,7 @@ void sys_trace_k_thread_pend(struct k_thread *thread)
 {
 	ctf_bounded_string_t name = { "unknown" };
 
-	_get_thread_name(thread, &name);
+	_get_sched_thread_name(thread, &name);
 	ctf_top_thread_pend((uint32_t)(uintptr_t)thread, name);
 }
 
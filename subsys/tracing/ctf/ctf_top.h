@@ -41,7 +41,28 @@
 		tracing_format_raw_data(epacket, sizeof(epacket));              \
 	}
 
-#ifdef CONFIG_TRACING_CTF_TIMESTAMP
+#if defined(CONFIG_TRACING_CTF_COMPACT)
+/* Room for the extended event header in front of the event id */
+#define CTF_COMPACT_HDR_RESERVE 5
+
+/*
+ * Gather fields after the reserved room, then add the compact header and
+ * emit.
+ */
+#define CTF_EVENT(...)                                                          \
+	{                                                                       \
+		uint8_t epacket[CTF_COMPACT_HDR_RESERVE                         \
+				MAP(CTF_INTERNAL_FIELD_SIZE, ##__VA_ARGS__)];    \
+		uint8_t *epacket_cursor = &epacket[CTF_COMPACT_HDR_RESERVE];    \
+										\
+		MAP(CTF_INTERNAL_FIELD_APPEND, ##__VA_ARGS__)                   \
+		ctf_top_compact_emit(epacket, sizeof(epacket));                 \
+	}
+
+/* Scheduling events leave out the thread name to save bandwidth */
+#define CTF_SCHED_EVENT(id, thread_id, name, ...)                              \
+	CTF_EVENT(id, thread_id, ##__VA_ARGS__)
+#elif defined(CONFIG_TRACING_CTF_TIMESTAMP)
 #define CTF_EVENT(...)                                                         \
 	{                                                                      \
 		const uint32_t tstamp = k_cyc_to_ns_floor64(k_cycle_get_32()); \
@@ -55,6 +76,11 @@
 	}
 #endif
 
+#ifndef CTF_SCHED_EVENT
+#define CTF_SCHED_EVENT(id, thread_id, name, ...)                              \
+	CTF_EVENT(id, thread_id, name, ##__VA_ARGS__)
+#endif
+
 /* Anonymous compound literal with 1 member. Legal since C99.
  * This permits us to take the address of literals, like so:
  *  &CTF_LITERAL(int, 1234)
@@ -110,25 +136,36 @@ typedef struct {
 	char buf[CTF_MAX_STRING_LEN];
 } ctf_bounded_string_t;
 
+#if defined(CONFIG_TRACING_CTF_COMPACT)
+/**
+ * @brief Add the compact header to an event and emit it.
+ *
+ * @param epacket Event with CTF_COMPACT_HDR_RESERVE bytes of room before
+ *                the event id.
+ * @param length Length of the event including the room.
+ */
+void ctf_top_compact_emit(uint8_t *epacket, uint32_t length);
+#endif
+
 static inline void ctf_top_thread_switched_out(uint32_t thread_id,
 					       ctf_bounded_string_t name)
 {
-	CTF_EVENT(CTF_LITERAL(uint8_t, CTF_EVENT_THREAD_SWITCHED_OUT),
-		  thread_id, name);
+	CTF_SCHED_EVENT(CTF_LITERAL(uint8_t, CTF_EVENT_THREAD_SWITCHED_OUT),
+			thread_id, name);
 }
 
 static inline void ctf_top_thread_switched_in(uint32_t thread_id,
 					      ctf_bounded_string_t name)
 {
-	CTF_EVENT(CTF_LITERAL(uint8_t, CTF_EVENT_THREAD_SWITCHED_IN), thread_id,
-		  name);
+	CTF_SCHED_EVENT(CTF_LITERAL(uint8_t, CTF_EVENT_THREAD_SWITCHED_IN), thread_id,
+			name);
 }
 
 static inline void ctf_top_thread_priority_set(uint32_t thread_id, int8_t prio,
 					       ctf_bounded_string_t name)
 {
-	CTF_EVENT(CTF_LITERAL(uint8_t, CTF_EVENT_THREAD_PRIORITY_SET),
-		  thread_id, name, prio);
+	CTF_SCHED_EVENT(CTF_LITERAL(uint8_t, CTF_EVENT_THREAD_PRIORITY_SET),
+			thread_id, name, prio);
 }
 
 static inline void ctf_top_thread_create(uint32_t thread_id, int8_t prio,
@@ -148,29 +185,29 @@ static inline void ctf_top_thread_abort(uint32_t thread_id,
 static inline void ctf_top_thread_suspend(uint32_t thread_id,
 					  ctf_bounded_string_t name)
 {
-	CTF_EVENT(CTF_LITERAL(uint8_t, CTF_EVENT_THREAD_SUSPEND), thread_id,
-		  name);
+	CTF_SCHED_EVENT(CTF_LITERAL(uint8_t, CTF_EVENT_THREAD_SUSPEND), thread_id,
+			name);
 }
 
 static inline void ctf_top_thread_resume(uint32_t thread_id,
 					 ctf_bounded_string_t name)
 {
-	CTF_EVENT(CTF_LITERAL(uint8_t, CTF_EVENT_THREAD_RESUME), thread_id,
-		  name);
+	CTF_SCHED_EVENT(CTF_LITERAL(uint8_t, CTF_EVENT_THREAD_RESUME), thread_id,
+			name);
 }
 
 static inline void ctf_top_thread_ready(uint32_t thread_id,
 					ctf_bounded_string_t name)
 {
-	CTF_EVENT(CTF_LITERAL(uint8_t, CTF_EVENT_THREAD_READY), thread_id,
-		  name);
+	CTF_SCHED_EVENT(CTF_LITERAL(uint8_t, CTF_EVENT_THREAD_READY), thread_id,
+			name);
 }
 
 static inline void ctf_top_thread_pend(uint32_t thread_id,
 				       ctf_bounded_string_t name)
 {
-	CTF_EVENT(CTF_LITERAL(uint8_t, CTF_EVENT_THREAD_PENDING), thread_id,
-		  name);
+	CTF_SCHED_EVENT(CTF_LITERAL(uint8_t, CTF_EVENT_THREAD_PENDING), thread_id,
+			name);
 }
 
 static inline void ctf_top_thread_info(uint32_t thread_id,
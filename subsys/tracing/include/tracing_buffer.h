@@ -104,6 +104,16 @@ int tracing_buffer_get_finish(uint32_t size);
  */
 uint32_t tracing_buffer_get(uint8_t *data, uint32_t size);
 
+/**
+ * @brief Get the CPU of the data claimed last from tracing buffer.
+ *
+ * With CONFIG_TRACING_BUFFER_PER_CPU, each CPU has its own buffer and
+ * claiming takes turns between them. Otherwise it is always 0.
+ *
+ * @return CPU whose buffer was claimed from.
+ */
+unsigned int tracing_buffer_get_cpu(void);
+
 /**
  * @brief Get buffer from tracing command buffer.
  *
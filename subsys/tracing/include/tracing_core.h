@@ -14,9 +14,16 @@
 extern "C" {
 #endif
 
+#ifdef CONFIG_TRACING_BUFFER_PER_CPU
+/* Each CPU puts to its own buffer, only local interrupts are locked */
+#define TRACING_LOCK()		{ unsigned int key; key = arch_irq_lock()
+
+#define TRACING_UNLOCK()	{ arch_irq_unlock(key); } }
+#else
 #define TRACING_LOCK()		{ int key; key = irq_lock()
 
 #define TRACING_UNLOCK()	{ irq_unlock(key); } }
+#endif
 
 /**
  * @brief Check tracing enabled or not.
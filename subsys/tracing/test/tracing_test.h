@@ -449,6 +449,9 @@
 #define sys_port_trace_pm_device_runtime_disable_enter(dev)
 #define sys_port_trace_pm_device_runtime_disable_exit(dev, ret)
 
+#define sys_port_trace_sys_init_enter(entry, level)
+#define sys_port_trace_sys_init_exit(entry, level, result)
+
 void sys_trace_idle(void);
 void sys_trace_isr_enter(void);
 void sys_trace_isr_exit(void);
@@ -0,0 +1,358 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Disable syscall tracing for all calls from this compilation unit to avoid
+ * undefined symbols as the macros are not expanded recursively
+ */
+#define DISABLE_SYSCALL_TRACING
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/sys/__assert.h>
+#include <tracing_core.h>
+#include <tracing_buffer.h>
+#include <tracing_backend.h>
+
+#if defined(CONFIG_TRACING_BACKEND_STREAM_UART)
+#include <zephyr/drivers/uart.h>
+#elif defined(CONFIG_TRACING_BACKEND_STREAM_SPI)
+#include <zephyr/drivers/spi.h>
+#include <zephyr/rtio/rtio.h>
+#elif defined(CONFIG_TRACING_BACKEND_STREAM_USB)
+#include <zephyr/usb/usbd.h>
+#include <zephyr/drivers/usb/udc.h>
+#endif
+
+#define STREAM_BUF_SIZE CONFIG_TRACING_BACKEND_STREAM_BUF_SIZE
+
+/*
+ * The tracing data is copied into one of two buffers while the other one
+ * is transferred. A transfer is started as soon as the transport is idle,
+ * either by the tracing thread after copying data, or by the completion of
+ * the previous transfer, so that the link is kept busy without waiting for
+ * a buffer to fill up.
+ */
+struct stream_buf {
+	uint8_t data[STREAM_BUF_SIZE] __aligned(4);
+	size_t len;
+};
+
+static struct stream_buf stream_bufs[2];
+static uint8_t fill_idx;
+static bool tx_busy;
+static bool tx_ready;
+static struct k_spinlock stream_lock;
+static K_SEM_DEFINE(stream_sem, 0, 1);
+
+static int stream_tx(uint8_t *data, size_t len);
+
+/* Start a transfer of the filled buffer if the transport is idle */
+static void stream_kick(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&stream_lock);
+	struct stream_buf *buf = &stream_bufs[fill_idx];
+
+	if (tx_busy || !tx_ready || (buf->len == 0)) {
+		k_spin_unlock(&stream_lock, key);
+		return;
+	}
+
+	tx_busy = true;
+	fill_idx ^= 1;
+	stream_bufs[fill_idx].len = 0;
+
+	k_spin_unlock(&stream_lock, key);
+
+	/* The transport may take its own locks, do not hold stream_lock */
+	if (stream_tx(buf->data, buf->len) != 0) {
+		/* The data of the buffer is dropped */
+		key = k_spin_lock(&stream_lock);
+		tx_busy = false;
+		k_spin_unlock(&stream_lock, key);
+		k_sem_give(&stream_sem);
+	}
+}
+
+/* Completion of a transfer, may be called from an ISR */
+static void stream_tx_done(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&stream_lock);
+
+	tx_busy = false;
+
+	k_spin_unlock(&stream_lock, key);
+	k_sem_give(&stream_sem);
+
+	stream_kick();
+}
+
+static void stream_set_ready(bool ready)
+{
+	k_spinlock_key_t key = k_spin_lock(&stream_lock);
+
+	tx_ready = ready;
+	if (!ready) {
+		/* Pending data is dropped, the transport is gone */
+		tx_busy = false;
+		stream_bufs[0].len = 0;
+		stream_bufs[1].len = 0;
+	}
+
+	k_spin_unlock(&stream_lock, key);
+	k_sem_give(&stream_sem);
+}
+
+#if defined(CONFIG_TRACING_BACKEND_STREAM_UART)
+
+static const struct device *const tracing_uart_dev =
+	DEVICE_DT_GET(DT_CHOSEN(zephyr_tracing_uart));
+
+static void uart_callback(const struct device *dev, struct uart_event *evt,
+			  void *user_data)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(user_data);
+
+	switch (evt->type) {
+	case UART_TX_DONE:
+	case UART_TX_ABORTED:
+		stream_tx_done();
+		break;
+	default:
+		break;
+	}
+}
+
+static int stream_tx(uint8_t *data, size_t len)
+{
+	return uart_tx(tracing_uart_dev, data, len, SYS_FOREVER_US);
+}
+
+static void stream_transport_init(void)
+{
+	int err;
+
+	__ASSERT(device_is_ready(tracing_uart_dev), "uart backend is not ready");
+
+	err = uart_callback_set(tracing_uart_dev, uart_callback, NULL);
+	__ASSERT(err == 0, "uart backend does not support the async API");
+
+	stream_set_ready(err == 0);
+}
+
+#elif defined(CONFIG_TRACING_BACKEND_STREAM_SPI)
+
+#define TRACING_SPI_OP (SPI_OP_MODE_MASTER | SPI_WORD_SET(8) | SPI_TRANSFER_MSB)
+
+SPI_DT_IODEV_DEFINE(tracing_spi_iodev, DT_CHOSEN(zephyr_tracing_spi), TRACING_SPI_OP, 0);
+RTIO_DEFINE(tracing_spi_rtio, 4, 4);
+
+static void spi_callback(struct rtio *r, const struct rtio_sqe *sqe, void *arg0)
+{
+	ARG_UNUSED(r);
+	ARG_UNUSED(sqe);
+	ARG_UNUSED(arg0);
+
+	stream_tx_done();
+}
+
+static int stream_tx(uint8_t *data, size_t len)
+{
+	struct rtio_sqe *wr_sqe = rtio_sqe_acquire(&tracing_spi_rtio);
+	struct rtio_sqe *cb_sqe = rtio_sqe_acquire(&tracing_spi_rtio);
+
+	if ((wr_sqe == NULL) || (cb_sqe == NULL)) {
+		rtio_sqe_drop_all(&tracing_spi_rtio);
+		return -ENOMEM;
+	}
+
+	/* The callback runs when the write is done, failed or not */
+	rtio_sqe_prep_write(wr_sqe, &tracing_spi_iodev, RTIO_PRIO_NORM, data, len, NULL);
+	wr_sqe->flags |= RTIO_SQE_CHAINED | RTIO_SQE_NO_RESPONSE;
+
+	rtio_sqe_prep_callback(cb_sqe, spi_callback, NULL, NULL);
+	cb_sqe->flags |= RTIO_SQE_NO_RESPONSE;
+
+	return rtio_submit(&tracing_spi_rtio, 0);
+}
+
+static void stream_transport_init(void)
+{
+	__ASSERT(spi_is_ready_iodev(&tracing_spi_iodev), "spi backend is not ready");
+
+	stream_set_ready(spi_is_ready_iodev(&tracing_spi_iodev));
+}
+
+#elif defined(CONFIG_TRACING_BACKEND_STREAM_USB)
+
+/* The data of the buffers is the stream buffers */
+NET_BUF_POOL_FIXED_DEFINE(stream_usb_pool, 2, 0, sizeof(struct udc_buf_info), NULL);
+
+struct stream_usb_desc {
+	struct usb_if_descriptor if0;
+	struct usb_ep_descriptor if0_in_ep;
+	struct usb_desc_header nil_desc;
+} __packed;
+
+static struct stream_usb_desc stream_usb_desc = {
+	.if0 = {
+		.bLength = sizeof(struct usb_if_descriptor),
+		.bDescriptorType = USB_DESC_INTERFACE,
+		.bInterfaceNumber = 0,
+		.bAlternateSetting = 0,
+		.bNumEndpoints = 1,
+		.bInterfaceClass = USB_BCC_VENDOR,
+		.bInterfaceSubClass = 0,
+		.bInterfaceProtocol = 0,
+		.iInterface = 0,
+	},
+
+	/* Data Endpoint IN, get wMaxPacketSize from UDC */
+	.if0_in_ep = {
+		.bLength = sizeof(struct usb_ep_descriptor),
+		.bDescriptorType = USB_DESC_ENDPOINT,
+		.bEndpointAddress = 0x81,
+		.bmAttributes = USB_EP_TYPE_BULK,
+		.wMaxPacketSize = 0,
+		.bInterval = 0x00,
+	},
+
+	/* Termination descriptor */
+	.nil_desc = {
+		.bLength = 0,
+		.bDescriptorType = 0,
+	},
+};
+
+static struct usbd_class_node *stream_usb_node;
+
+static int stream_tx(uint8_t *data, size_t len)
+{
+	struct usbd_class_node *c_nd = stream_usb_node;
+	struct udc_buf_info *bi;
+	struct net_buf *buf;
+	int err;
+
+	buf = net_buf_alloc_with_data(&stream_usb_pool, data, len, K_NO_WAIT);
+	if (buf == NULL) {
+		return -ENOMEM;
+	}
+
+	bi = udc_get_buf_info(buf);
+	memset(bi, 0, sizeof(struct udc_buf_info));
+	bi->ep = stream_usb_desc.if0_in_ep.bEndpointAddress;
+
+	err = usbd_ep_enqueue(c_nd, buf);
+	if (err) {
+		net_buf_unref(buf);
+	}
+
+	return err;
+}
+
+static int stream_usb_request(struct usbd_class_node *c_nd, struct net_buf *buf, int err)
+{
+	ARG_UNUSED(c_nd);
+	ARG_UNUSED(err);
+
+	net_buf_unref(buf);
+	stream_tx_done();
+
+	return 0;
+}
+
+static void stream_usb_enable(struct usbd_class_node *c_nd)
+{
+	stream_set_ready(true);
+}
+
+static void stream_usb_disable(struct usbd_class_node *c_nd)
+{
+	stream_set_ready(false);
+}
+
+static int stream_usb_init(struct usbd_class_node *c_nd)
+{
+	stream_usb_node = c_nd;
+
+	return 0;
+}
+
+static struct usbd_class_api stream_usb_api = {
+	.request = stream_usb_request,
+	.enable = stream_usb_enable,
+	.disable = stream_usb_disable,
+	.init = stream_usb_init,
+};
+
+static struct usbd_class_data stream_usb_class = {
+	.desc = (struct usb_desc_header *)&stream_usb_desc,
+	.v_reqs = NULL,
+};
+
+USBD_DEFINE_CLASS(tracing_stream, &stream_usb_api, &stream_usb_class);
+
+static void stream_transport_init(void)
+{
+	/* Ready once the host has configured the device */
+}
+
+#endif
+
+static void tracing_backend_stream_output(
+	const struct tracing_backend *backend,
+	uint8_t *data, uint32_t length)
+{
+	while (length > 0) {
+		k_spinlock_key_t key = k_spin_lock(&stream_lock);
+		struct stream_buf *buf = &stream_bufs[fill_idx];
+		size_t len = MIN(length, STREAM_BUF_SIZE - buf->len);
+
+		if (!tx_ready) {
+			k_spin_unlock(&stream_lock, key);
+			return;
+		}
+
+		if (len == 0) {
+			bool busy = tx_busy;
+
+			/* Both buffers are in use, wait for the transfer */
+			k_sem_reset(&stream_sem);
+			k_spin_unlock(&stream_lock, key);
+
+			if (busy) {
+				k_sem_take(&stream_sem, K_FOREVER);
+			} else {
+				stream_kick();
+			}
+			continue;
+		}
+
+		memcpy(&buf->data[buf->len], data, len);
+		buf->len += len;
+
+		k_spin_unlock(&stream_lock, key);
+		stream_kick();
+
+		data += len;
+		length -= len;
+	}
+}
+
+static void tracing_backend_stream_init(void)
+{
+	stream_transport_init();
+}
+
+const struct tracing_backend_api tracing_backend_stream_api = {
+	.init = tracing_backend_stream_init,
+	.output = tracing_backend_stream_output
+};
+
+TRACING_BACKEND_DEFINE(tracing_backend_stream, tracing_backend_stream_api);
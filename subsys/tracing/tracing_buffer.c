@@ -4,12 +4,61 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/barrier.h>
 #include <zephyr/sys/ring_buffer.h>
+#include <tracing_buffer.h>
 
-static struct ring_buf tracing_ring_buf;
-static uint8_t tracing_buffer[CONFIG_TRACING_BUFFER_SIZE + 1];
+#ifdef CONFIG_TRACING_BUFFER_PER_CPU
+#define TRACING_BUFFERS CONFIG_MP_MAX_NUM_CPUS
+#else
+#define TRACING_BUFFERS 1
+#endif
+
+static struct ring_buf tracing_ring_buf[TRACING_BUFFERS];
+static uint8_t tracing_buffer[TRACING_BUFFERS][CONFIG_TRACING_BUFFER_SIZE + 1];
 static uint8_t tracing_cmd_buffer[CONFIG_TRACING_CMD_BUFFER_SIZE];
 
+#ifdef CONFIG_TRACING_BUFFER_PER_CPU
+/* Buffer of the CPU the tracing thread reads from */
+static unsigned int read_cpu;
+
+/* Each CPU is the only writer of its buffer and the tracing thread the only
+ * reader. Both sides update their own indexes only, so no lock is needed
+ * between them, but the data has to be visible before the indexes.
+ */
+static inline struct ring_buf *put_buf(void)
+{
+	/* Local interrupts are locked, the CPU cannot change */
+	return &tracing_ring_buf[arch_curr_cpu()->id];
+}
+
+static inline struct ring_buf *get_buf(void)
+{
+	return &tracing_ring_buf[read_cpu];
+}
+
+static inline void buf_fence(void)
+{
+	barrier_dmem_fence_full();
+}
+#else
+static inline struct ring_buf *put_buf(void)
+{
+	return &tracing_ring_buf[0];
+}
+
+static inline struct ring_buf *get_buf(void)
+{
+	return &tracing_ring_buf[0];
+}
+
+static inline void buf_fence(void)
+{
+}
+#endif
+
 uint32_t tracing_cmd_buffer_alloc(uint8_t **data)
 {
 	*data = &tracing_cmd_buffer[0];
@@ -19,51 +68,106 @@ uint32_t tracing_cmd_buffer_alloc(uint8_t **data)
 
 uint32_t tracing_buffer_put_claim(uint8_t **data, uint32_t size)
 {
-	return ring_buf_put_claim(&tracing_ring_buf, data, size);
+	return ring_buf_put_claim(put_buf(), data, size);
 }
 
 int tracing_buffer_put_finish(uint32_t size)
 {
-	return ring_buf_put_finish(&tracing_ring_buf, size);
+	buf_fence();
+
+	return ring_buf_put_finish(put_buf(), size);
 }
 
 uint32_t tracing_buffer_put(uint8_t *data, uint32_t size)
 {
-	return ring_buf_put(&tracing_ring_buf, data, size);
+#ifdef CONFIG_TRACING_BUFFER_PER_CPU
+	struct ring_buf *buf = put_buf();
+	uint32_t total_size = 0U;
+	uint32_t partial_size;
+	uint8_t *dst;
+
+	do {
+		partial_size = ring_buf_put_claim(buf, &dst, size - total_size);
+		memcpy(dst, data + total_size, partial_size);
+		total_size += partial_size;
+	} while ((total_size < size) && partial_size);
+
+	buf_fence();
+	(void)ring_buf_put_finish(buf, total_size);
+
+	return total_size;
+#else
+	return ring_buf_put(put_buf(), data, size);
+#endif
 }
 
 uint32_t tracing_buffer_get_claim(uint8_t **data, uint32_t size)
 {
-	return ring_buf_get_claim(&tracing_ring_buf, data, size);
+#ifdef CONFIG_TRACING_BUFFER_PER_CPU
+	/* Take turns between the CPUs */
+	for (unsigned int i = 1; i <= TRACING_BUFFERS; i++) {
+		unsigned int cpu = (read_cpu + i) % TRACING_BUFFERS;
+
+		if (!ring_buf_is_empty(&tracing_ring_buf[cpu])) {
+			read_cpu = cpu;
+			break;
+		}
+	}
+#endif
+	buf_fence();
+
+	return ring_buf_get_claim(get_buf(), data, size);
 }
 
 int tracing_buffer_get_finish(uint32_t size)
 {
-	return ring_buf_get_finish(&tracing_ring_buf, size);
+	buf_fence();
+
+	return ring_buf_get_finish(get_buf(), size);
 }
 
 uint32_t tracing_buffer_get(uint8_t *data, uint32_t size)
 {
-	return ring_buf_get(&tracing_ring_buf, data, size);
+	buf_fence();
+
+	return ring_buf_get(get_buf(), data, size);
+}
+
+unsigned int tracing_buffer_get_cpu(void)
+{
+#ifdef CONFIG_TRACING_BUFFER_PER_CPU
+	return read_cpu;
+#else
+	return 0;
+#endif
 }
 
 void tracing_buffer_init(void)
 {
-	ring_buf_init(&tracing_ring_buf,
-		      sizeof(tracing_buffer), tracing_buffer);
+	for (int i = 0; i < TRACING_BUFFERS; i++) {
+		ring_buf_init(&tracing_ring_buf[i],
+			      sizeof(tracing_buffer[i]), tracing_buffer[i]);
+	}
 }
 
 bool tracing_buffer_is_empty(void)
 {
-	return ring_buf_is_empty(&tracing_ring_buf);
+	for (int i = 0; i < TRACING_BUFFERS; i++) {
+		if (!ring_buf_is_empty(&tracing_ring_buf[i])) {
+			return false;
+		}
+	}
+
+	return true;
 }
 
 uint32_t tracing_buffer_capacity_get(void)
 {
-	return ring_buf_capacity_get(&tracing_ring_buf);
+	/* All the buffers have the same size */
+	return ring_buf_capacity_get(&tracing_ring_buf[0]);
 }
 
 uint32_t tracing_buffer_space_get(void)
 {
-	return ring_buf_space_get(&tracing_ring_buf);
+	return ring_buf_space_get(put_buf());
 }
@@ -14,6 +14,7 @@
 #include <zephyr/kernel.h>
 #include <zephyr/sys/util.h>
 #include <zephyr/sys/atomic.h>
+#include <zephyr/sys/byteorder.h>
 #include <tracing_core.h>
 #include <tracing_buffer.h>
 #include <tracing_backend.h>
@@ -29,6 +30,8 @@
 #define TRACING_BACKEND_NAME "tracing_backend_posix"
 #elif defined CONFIG_TRACING_BACKEND_RAM
 #define TRACING_BACKEND_NAME "tracing_backend_ram"
+#elif defined CONFIG_TRACING_BACKEND_STREAM
+#define TRACING_BACKEND_NAME "tracing_backend_stream"
 #else
 #define TRACING_BACKEND_NAME ""
 #endif
@@ -52,6 +55,21 @@ static K_SEM_DEFINE(tracing_thread_sem, 0, 1);
 static K_THREAD_STACK_DEFINE(tracing_thread_stack,
 			CONFIG_TRACING_THREAD_STACK_SIZE);
 
+#ifdef CONFIG_TRACING_BUFFER_PER_CPU
+/* Each chunk of data is preceded by the CPU it comes from and its length,
+ * so that the host can split the output into one stream per CPU.
+ */
+static void tracing_chunk_header_handle(uint32_t length)
+{
+	uint8_t hdr[3];
+
+	hdr[0] = tracing_buffer_get_cpu();
+	sys_put_le16(length, &hdr[1]);
+
+	tracing_buffer_handle(hdr, sizeof(hdr));
+}
+#endif
+
 static void tracing_thread_func(void *dummy1, void *dummy2, void *dummy3)
 {
 	uint8_t *transferring_buf;
@@ -60,6 +78,9 @@ static void tracing_thread_func(void *dummy1, void *dummy2, void *dummy3)
 	tracing_thread_tid = k_current_get();
 
 	tracing_buffer_max_length = tracing_buffer_capacity_get();
+#ifdef CONFIG_TRACING_BUFFER_PER_CPU
+	tracing_buffer_max_length = MIN(tracing_buffer_max_length, UINT16_MAX);
+#endif
 
 	while (true) {
 		if (tracing_buffer_is_empty()) {
@@ -69,6 +90,9 @@ static void tracing_thread_func(void *dummy1, void *dummy2, void *dummy3)
 				tracing_buffer_get_claim(
 						&transferring_buf,
 						tracing_buffer_max_length);
+#ifdef CONFIG_TRACING_BUFFER_PER_CPU
+			tracing_chunk_header_handle(transferring_length);
+#endif
 			tracing_buffer_handle(transferring_buf,
 					      transferring_length);
 			tracing_buffer_get_finish(transferring_length);
@@ -22,6 +22,9 @@ void __weak sys_trace_thread_priority_set_user(struct k_thread *thread, int prio
 void __weak sys_trace_isr_enter_user(void) {}
 void __weak sys_trace_isr_exit_user(void) {}
 void __weak sys_trace_idle_user(void) {}
+void __weak sys_trace_sys_init_enter_user(const struct init_entry *entry, int level) {}
+void __weak sys_trace_sys_init_exit_user(const struct init_entry *entry, int level,
+					 int result) {}
 
 void sys_trace_thread_create(struct k_thread *thread)
 {
@@ -92,3 +95,13 @@ void sys_trace_idle(void)
 {
 	sys_trace_idle_user();
 }
+
+void sys_trace_sys_init_enter(const struct init_entry *entry, int level)
+{
+	sys_trace_sys_init_enter_user(entry, level);
+}
+
+void sys_trace_sys_init_exit(const struct init_entry *entry, int level, int result)
+{
+	sys_trace_sys_init_exit_user(entry, level, result);
+}
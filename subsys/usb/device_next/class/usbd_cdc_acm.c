@@ -15,15 +15,19 @@
 #include <zephyr/usb/usbd.h>
 #include <zephyr/usb/usb_ch9.h>
 #include <zephyr/usb/class/usb_cdc.h>
+#include <zephyr/usb/class/usbd_cdc_acm.h>
 
 #include <zephyr/drivers/usb/udc.h>
 
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(usbd_cdc_acm, CONFIG_USBD_CDC_ACM_LOG_LEVEL);
 
+static void cdc_acm_buf_destroy(struct net_buf *buf);
+
 NET_BUF_POOL_FIXED_DEFINE(cdc_acm_ep_pool,
-			  DT_NUM_INST_STATUS_OKAY(DT_DRV_COMPAT) * 2,
-			  512, sizeof(struct udc_buf_info), NULL);
+			  DT_NUM_INST_STATUS_OKAY(DT_DRV_COMPAT) * 2 *
+			  CONFIG_USBD_CDC_ACM_BULK_BUFS,
+			  512, sizeof(struct udc_buf_info), cdc_acm_buf_destroy);
 
 #define CDC_ACM_DEFAULT_LINECODING	{sys_cpu_to_le32(115200), 0, 0, 8}
 #define CDC_ACM_DEFAULT_BULK_EP_MPS	0
@@ -34,7 +38,6 @@ NET_BUF_POOL_FIXED_DEFINE(cdc_acm_ep_pool,
 #define CDC_ACM_CLASS_SUSPENDED		1
 #define CDC_ACM_IRQ_RX_ENABLED		2
 #define CDC_ACM_IRQ_TX_ENABLED		3
-#define CDC_ACM_RX_FIFO_BUSY		4
 #define CDC_ACM_LOCK			5
 
 static struct k_work_q cdc_acm_work_q;
@@ -74,6 +77,14 @@ struct cdc_acm_uart_data {
 	struct k_work tx_fifo_work;
 	/* USBD CDC ACM RX fifo work */
 	struct k_work rx_fifo_work;
+	/* Number of bulk OUT transfers queued */
+	atomic_t rx_queued;
+	/* Number of bulk IN transfers queued */
+	atomic_t tx_queued;
+	/* Raw RX callback, bypassing the RX fifo */
+	usbd_cdc_acm_rx_cb_t rx_cb;
+	/* Raw RX callback user data */
+	void *rx_cb_data;
 	atomic_t state;
 	struct k_sem notif_sem;
 };
@@ -118,6 +129,27 @@ static ALWAYS_INLINE int cdc_acm_work_submit(struct k_work *work)
 	return k_work_submit_to_queue(&cdc_acm_work_q, work);
 }
 
+/*
+ * Buffers handed to the application in raw RX mode come back here, which is
+ * the time to queue the next transfers of their instance.
+ */
+static void cdc_acm_buf_destroy(struct net_buf *buf)
+{
+	struct udc_buf_info *bi = udc_get_buf_info(buf);
+	struct usbd_class_node *c_nd = bi->owner;
+
+	net_buf_destroy(buf);
+
+	if (c_nd != NULL) {
+		const struct device *dev = c_nd->data->priv;
+		struct cdc_acm_uart_data *data = dev->data;
+
+		if (data->rx_cb != NULL) {
+			cdc_acm_work_submit(&data->rx_fifo_work);
+		}
+	}
+}
+
 static ALWAYS_INLINE bool check_wq_ctx(const struct device *dev)
 {
 	return k_current_get() == k_work_queue_thread_get(&cdc_acm_work_q);
@@ -170,7 +202,11 @@ static int usbd_cdc_acm_request(struct usbd_class_node *const c_nd,
 		}
 
 		if (bi->ep == cdc_acm_get_bulk_out(c_nd)) {
-			atomic_clear_bit(&data->state, CDC_ACM_RX_FIFO_BUSY);
+			atomic_dec(&data->rx_queued);
+		}
+
+		if (bi->ep == cdc_acm_get_bulk_in(c_nd)) {
+			atomic_dec(&data->tx_queued);
 		}
 
 		goto ep_request_error;
@@ -178,20 +214,35 @@ static int usbd_cdc_acm_request(struct usbd_class_node *const c_nd,
 
 	if (bi->ep == cdc_acm_get_bulk_out(c_nd)) {
 		/* RX transfer completion */
+		usbd_cdc_acm_rx_cb_t rx_cb = data->rx_cb;
 		size_t done;
 
+		atomic_dec(&data->rx_queued);
+
+		if (rx_cb != NULL) {
+			/* The buffer is released by the application */
+			rx_cb(dev, buf, data->rx_cb_data);
+			cdc_acm_work_submit(&data->rx_fifo_work);
+			return 0;
+		}
+
 		LOG_HEXDUMP_INF(buf->data, buf->len, "");
 		done = ring_buf_put(data->rx_fifo.rb, buf->data, buf->len);
 		if (done && data->cb) {
 			cdc_acm_work_submit(&data->irq_cb_work);
 		}
 
-		atomic_clear_bit(&data->state, CDC_ACM_RX_FIFO_BUSY);
 		cdc_acm_work_submit(&data->rx_fifo_work);
 	}
 
 	if (bi->ep == cdc_acm_get_bulk_in(c_nd)) {
 		/* TX transfer completion */
+		atomic_dec(&data->tx_queued);
+
+		if (!ring_buf_is_empty(data->tx_fifo.rb)) {
+			cdc_acm_work_submit(&data->tx_fifo_work);
+		}
+
 		if (data->cb) {
 			cdc_acm_work_submit(&data->irq_cb_work);
 		}
@@ -467,11 +518,21 @@ static void cdc_acm_tx_fifo_handler(struct k_work *work)
 		return;
 	}
 
+	if (atomic_get(&data->tx_queued) >= CONFIG_USBD_CDC_ACM_BULK_BUFS) {
+		/* Resubmitted by the TX transfer completion */
+		LOG_DBG("TX transfers already queued");
+		return;
+	}
+
 	if (atomic_test_and_set_bit(&data->state, CDC_ACM_LOCK)) {
 		cdc_acm_work_submit(&data->tx_fifo_work);
 		return;
 	}
 
+	if (ring_buf_is_empty(data->tx_fifo.rb)) {
+		goto tx_fifo_handler_exit;
+	}
+
 	buf = cdc_acm_buf_alloc(cdc_acm_get_bulk_in(c_nd));
 	if (buf == NULL) {
 		cdc_acm_work_submit(&data->tx_fifo_work);
@@ -481,10 +542,18 @@ static void cdc_acm_tx_fifo_handler(struct k_work *work)
 	len = ring_buf_get(data->tx_fifo.rb, buf->data, buf->size);
 	net_buf_add(buf, len);
 
+	atomic_inc(&data->tx_queued);
 	ret = usbd_ep_enqueue(c_nd, buf);
 	if (ret) {
 		LOG_ERR("Failed to enqueue");
+		atomic_dec(&data->tx_queued);
 		net_buf_unref(buf);
+		goto tx_fifo_handler_exit;
+	}
+
+	/* Keep the next transfer queued while this one is on the bus */
+	if (!ring_buf_is_empty(data->tx_fifo.rb)) {
+		cdc_acm_work_submit(&data->tx_fifo_work);
 	}
 
 tx_fifo_handler_exit:
@@ -504,6 +573,7 @@ static void cdc_acm_rx_fifo_handler(struct k_work *work)
 	struct cdc_acm_uart_data *data;
 	struct usbd_class_node *c_nd;
 	struct net_buf *buf;
+	atomic_val_t queued;
 	uint8_t ep;
 	int ret;
 
@@ -516,13 +586,18 @@ static void cdc_acm_rx_fifo_handler(struct k_work *work)
 		return;
 	}
 
-	if (ring_buf_space_get(data->rx_fifo.rb) < cdc_acm_get_bulk_mps(c_nd)) {
-		LOG_INF("RX buffer to small, throttle");
+	/* The handler only runs in the class work queue, queued is stable */
+	queued = atomic_get(&data->rx_queued);
+	if (queued >= CONFIG_USBD_CDC_ACM_BULK_BUFS) {
+		LOG_DBG("RX transfers already queued");
 		return;
 	}
 
-	if (atomic_test_and_set_bit(&data->state, CDC_ACM_RX_FIFO_BUSY)) {
-		LOG_WRN("RX transfer already in progress");
+	/* Each queued transfer may fill one packet of the RX fifo */
+	if (data->rx_cb == NULL &&
+	    ring_buf_space_get(data->rx_fifo.rb) <
+	    cdc_acm_get_bulk_mps(c_nd) * (queued + 1)) {
+		LOG_INF("RX buffer to small, throttle");
 		return;
 	}
 
@@ -532,10 +607,17 @@ static void cdc_acm_rx_fifo_handler(struct k_work *work)
 		return;
 	}
 
+	atomic_inc(&data->rx_queued);
 	ret = usbd_ep_enqueue(c_nd, buf);
 	if (ret) {
 		LOG_ERR("Failed to enqueue net_buf for 0x%02x", ep);
+		atomic_dec(&data->rx_queued);
 		net_buf_unref(buf);
+		return;
+	}
+
+	if (queued + 1 < CONFIG_USBD_CDC_ACM_BULK_BUFS) {
+		cdc_acm_work_submit(&data->rx_fifo_work);
 	}
 }
 
@@ -570,7 +652,7 @@ static void cdc_acm_irq_rx_enable(const struct device *dev)
 		cdc_acm_work_submit(&data->irq_cb_work);
 	}
 
-	if (!atomic_test_bit(&data->state, CDC_ACM_RX_FIFO_BUSY)) {
+	if (atomic_get(&data->rx_queued) < CONFIG_USBD_CDC_ACM_BULK_BUFS) {
 		LOG_INF("rx_en: trigger rx_fifo_work");
 		cdc_acm_work_submit(&data->rx_fifo_work);
 	}
@@ -931,6 +1013,59 @@ static int cdc_acm_config_get(const struct device *dev,
 }
 #endif /* CONFIG_UART_USE_RUNTIME_CONFIGURE */
 
+struct net_buf *usbd_cdc_acm_buf_alloc(const struct device *dev,
+				       k_timeout_t timeout)
+{
+	struct cdc_acm_uart_data *const data = dev->data;
+	struct udc_buf_info *bi;
+	struct net_buf *buf;
+
+	buf = net_buf_alloc(&cdc_acm_ep_pool, timeout);
+	if (buf == NULL) {
+		return NULL;
+	}
+
+	bi = udc_get_buf_info(buf);
+	memset(bi, 0, sizeof(struct udc_buf_info));
+	bi->ep = cdc_acm_get_bulk_in(data->c_nd);
+
+	return buf;
+}
+
+int usbd_cdc_acm_submit(const struct device *dev, struct net_buf *buf)
+{
+	struct cdc_acm_uart_data *const data = dev->data;
+	int ret;
+
+	if (!atomic_test_bit(&data->state, CDC_ACM_CLASS_ENABLED) ||
+	    atomic_test_bit(&data->state, CDC_ACM_CLASS_SUSPENDED)) {
+		net_buf_unref(buf);
+		return -EACCES;
+	}
+
+	/* Counted with the FIFO transfers, which wait for its completion */
+	atomic_inc(&data->tx_queued);
+	ret = usbd_ep_enqueue(data->c_nd, buf);
+	if (ret) {
+		LOG_ERR("Failed to enqueue raw transfer");
+		atomic_dec(&data->tx_queued);
+		net_buf_unref(buf);
+	}
+
+	return ret;
+}
+
+void usbd_cdc_acm_rx_cb_set(const struct device *dev, usbd_cdc_acm_rx_cb_t cb,
+			    void *user_data)
+{
+	struct cdc_acm_uart_data *const data = dev->data;
+
+	data->rx_cb_data = user_data;
+	data->rx_cb = cb;
+
+	cdc_acm_work_submit(&data->rx_fifo_work);
+}
+
 static int usbd_cdc_acm_init_wq(void)
 {
 	k_work_queue_init(&cdc_acm_work_q);
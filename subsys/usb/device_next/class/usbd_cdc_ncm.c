@@ -0,0 +1,1112 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT zephyr_cdc_ncm_ethernet
+
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/net/ethernet.h>
+#include <zephyr/sys/byteorder.h>
+
+#include <eth.h>
+
+#include <zephyr/usb/usbd.h>
+#include <zephyr/usb/usb_ch9.h>
+#include <zephyr/usb/class/usb_cdc.h>
+#include <zephyr/drivers/usb/udc.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(cdc_ncm, CONFIG_USBD_CDC_NCM_LOG_LEVEL);
+
+#define CDC_NCM_EP_MPS_BULK		0
+#define CDC_NCM_EP_MPS_INT		16
+#define CDC_NCM_EP_INTERVAL_INT		0x0A
+
+/* NCM10.pdf, 3.2.1 and 3.3.1, 16-bit NTB without CRC */
+#define NTH16_SIGNATURE			0x484D434E
+#define NDP16_SIGNATURE			0x304D434E
+#define NTB_FORMAT_16			BIT(0)
+#define NTB_MIN_SIZE			2048
+
+/*
+ * Datagrams start on 4 bytes boundaries. The host puts its Ethernet
+ * headers 2 bytes after them, so that the IP headers are aligned.
+ */
+#define CDC_NCM_DIVISOR			4
+#define CDC_NCM_OUT_REMAINDER		2
+#define CDC_NCM_NDP_ALIGNMENT		4
+
+/* Bound the NDP chain of a received NTB */
+#define CDC_NCM_MAX_NDP			4
+
+enum {
+	CDC_NCM_IFACE_UP,
+	CDC_NCM_CLASS_ENABLED,
+	CDC_NCM_CLASS_SUSPENDED,
+	CDC_NCM_DATA_IFACE_ENABLED,
+};
+
+struct nth16 {
+	uint32_t dwSignature;
+	uint16_t wHeaderLength;
+	uint16_t wSequence;
+	uint16_t wBlockLength;
+	uint16_t wNdpIndex;
+} __packed;
+
+struct ndp16_datagram {
+	uint16_t wDatagramIndex;
+	uint16_t wDatagramLength;
+} __packed;
+
+struct ndp16 {
+	uint32_t dwSignature;
+	uint16_t wLength;
+	uint16_t wNextNdpIndex;
+	struct ndp16_datagram datagram[];
+} __packed;
+
+struct ntb_parameters {
+	uint16_t wLength;
+	uint16_t bmNtbFormatsSupported;
+	uint32_t dwNtbInMaxSize;
+	uint16_t wNdpInDivisor;
+	uint16_t wNdpInPayloadRemainder;
+	uint16_t wNdpInAlignment;
+	uint16_t wReserved;
+	uint32_t dwNtbOutMaxSize;
+	uint16_t wNdpOutDivisor;
+	uint16_t wNdpOutPayloadRemainder;
+	uint16_t wNdpOutAlignment;
+	uint16_t wNtbOutMaxDatagrams;
+} __packed;
+
+struct ntb_input_size {
+	uint32_t dwNtbInMaxSize;
+	uint16_t wNtbInMaxDatagrams;
+	uint16_t wReserved;
+} __packed;
+
+struct cdc_ncm_notification {
+	union {
+		uint8_t bmRequestType;
+		struct usb_req_type_field RequestType;
+	};
+	uint8_t bNotificationType;
+	uint16_t wValue;
+	uint16_t wIndex;
+	uint16_t wLength;
+} __packed;
+
+static void cdc_ncm_frag_destroy(struct net_buf *frag);
+
+/*
+ * Received datagrams are passed to the network stack as fragments pointing
+ * into their NTB, which holds a reference in their user data.
+ */
+NET_BUF_POOL_DEFINE(cdc_ncm_frag_pool,
+		    DT_NUM_INST_STATUS_OKAY(DT_DRV_COMPAT) * CONFIG_USBD_CDC_NCM_RX_FRAGS,
+		    0, sizeof(struct net_buf *), cdc_ncm_frag_destroy);
+
+struct cdc_ncm_eth_data {
+	struct usbd_class_node *c_nd;
+	struct usbd_desc_node *const mac_desc_nd;
+	/* NTBs to the host, one filled while the other is on the bus */
+	struct net_buf_pool *const in_pool;
+	/* NTBs from the host, held until their datagrams are released */
+	struct net_buf_pool *const out_pool;
+
+	struct net_if *iface;
+	uint8_t mac_addr[6];
+
+	struct k_mutex tx_lock;
+	struct net_buf *tx_ntb;
+	struct ndp16_datagram tx_dgram[CONFIG_USBD_CDC_NCM_IN_MAX_DATAGRAMS];
+	uint8_t tx_count;
+	uint8_t tx_max_dgram;
+	uint16_t tx_seq;
+	uint32_t ntb_in_size;
+	struct k_work tx_work;
+	struct k_work out_work;
+
+	struct k_sem sync_sem;
+	struct k_sem notif_sem;
+	atomic_t state;
+};
+
+struct usbd_cdc_ncm_desc {
+	struct usb_association_descriptor iad;
+
+	struct usb_if_descriptor if0;
+	struct cdc_header_descriptor if0_header;
+	struct cdc_union_descriptor if0_union;
+	struct cdc_ecm_descriptor if0_ecm;
+	struct cdc_ncm_descriptor if0_ncm;
+	struct usb_ep_descriptor if0_int_ep;
+
+	struct usb_if_descriptor if1_0;
+
+	struct usb_if_descriptor if1_1;
+	struct usb_ep_descriptor if1_1_in_ep;
+	struct usb_ep_descriptor if1_1_out_ep;
+
+	struct usb_desc_header nil_desc;
+} __packed;
+
+static uint8_t cdc_ncm_get_ctrl_if(struct usbd_class_node *const c_nd)
+{
+	struct usbd_cdc_ncm_desc *desc = c_nd->data->desc;
+
+	return desc->if0.bInterfaceNumber;
+}
+
+static uint8_t cdc_ncm_get_int_in(struct usbd_class_node *const c_nd)
+{
+	struct usbd_cdc_ncm_desc *desc = c_nd->data->desc;
+
+	return desc->if0_int_ep.bEndpointAddress;
+}
+
+static uint8_t cdc_ncm_get_bulk_in(struct usbd_class_node *const c_nd)
+{
+	struct usbd_cdc_ncm_desc *desc = c_nd->data->desc;
+
+	return desc->if1_1_in_ep.bEndpointAddress;
+}
+
+static uint8_t cdc_ncm_get_bulk_out(struct usbd_class_node *const c_nd)
+{
+	struct usbd_cdc_ncm_desc *desc = c_nd->data->desc;
+
+	return desc->if1_1_out_ep.bEndpointAddress;
+}
+
+static struct net_buf *cdc_ncm_buf_alloc(struct net_buf_pool *const pool,
+					 const uint8_t ep)
+{
+	struct net_buf *buf = NULL;
+	struct udc_buf_info *bi;
+
+	buf = net_buf_alloc(pool, K_NO_WAIT);
+	if (!buf) {
+		return NULL;
+	}
+
+	bi = udc_get_buf_info(buf);
+	memset(bi, 0, sizeof(struct udc_buf_info));
+	bi->ep = ep;
+
+	return buf;
+}
+
+static void cdc_ncm_frag_destroy(struct net_buf *frag)
+{
+	struct net_buf *ntb = *(struct net_buf **)net_buf_user_data(frag);
+
+	net_buf_destroy(frag);
+	net_buf_unref(ntb);
+}
+
+/* Last reference to a received NTB, its buffer can take the next one */
+static void cdc_ncm_out_destroy(struct net_buf *buf)
+{
+	struct usbd_class_node *c_nd = udc_get_buf_info(buf)->owner;
+
+	net_buf_destroy(buf);
+
+	if (c_nd != NULL) {
+		const struct device *dev = c_nd->data->priv;
+		struct cdc_ncm_eth_data *data = dev->data;
+
+		k_work_submit(&data->out_work);
+	}
+}
+
+static int cdc_ncm_out_start(struct usbd_class_node *const c_nd)
+{
+	const struct device *dev = c_nd->data->priv;
+	struct cdc_ncm_eth_data *data = dev->data;
+	struct net_buf *buf;
+	uint8_t ep;
+	int ret;
+
+	if (!atomic_test_bit(&data->state, CDC_NCM_CLASS_ENABLED) ||
+	    !atomic_test_bit(&data->state, CDC_NCM_DATA_IFACE_ENABLED)) {
+		return -EACCES;
+	}
+
+	/* Keep every free NTB buffer queued */
+	ep = cdc_ncm_get_bulk_out(c_nd);
+	while ((buf = cdc_ncm_buf_alloc(data->out_pool, ep)) != NULL) {
+		ret = usbd_ep_enqueue(c_nd, buf);
+		if (ret) {
+			LOG_ERR("Failed to enqueue net_buf for 0x%02x", ep);
+			/* Not to be restarted from the destroy callback */
+			udc_get_buf_info(buf)->owner = NULL;
+			net_buf_unref(buf);
+			return ret;
+		}
+	}
+
+	return 0;
+}
+
+static void cdc_ncm_out_work_handler(struct k_work *work)
+{
+	struct cdc_ncm_eth_data *data;
+
+	data = CONTAINER_OF(work, struct cdc_ncm_eth_data, out_work);
+	(void)cdc_ncm_out_start(data->c_nd);
+}
+
+static void cdc_ncm_rx_datagram(struct cdc_ncm_eth_data *const data,
+				struct net_buf *const ntb,
+				const uint16_t index, const uint16_t len)
+{
+	struct net_buf *frag;
+	struct net_pkt *pkt;
+
+	pkt = net_pkt_rx_alloc_on_iface(data->iface, K_NO_WAIT);
+	if (!pkt) {
+		LOG_ERR("No memory for net_pkt");
+		return;
+	}
+
+	frag = net_buf_alloc_with_data(&cdc_ncm_frag_pool, &ntb->data[index],
+				       len, K_NO_WAIT);
+	if (frag != NULL) {
+		*(struct net_buf **)net_buf_user_data(frag) = net_buf_ref(ntb);
+		net_pkt_frag_add(pkt, frag);
+	} else if (net_pkt_alloc_buffer_raw(pkt, len, K_NO_WAIT) ||
+		   net_pkt_write(pkt, &ntb->data[index], len)) {
+		LOG_ERR("Unable to write into pkt");
+		net_pkt_unref(pkt);
+		return;
+	}
+
+	LOG_DBG("Received packet len %u", len);
+	if (net_recv_data(data->iface, pkt) < 0) {
+		LOG_ERR("Packet %p dropped by network stack", pkt);
+		net_pkt_unref(pkt);
+	}
+}
+
+static int cdc_ncm_rx_ntb(struct cdc_ncm_eth_data *const data,
+			  struct net_buf *const ntb)
+{
+	const uint8_t *const nth = ntb->data;
+	uint32_t block_len;
+	uint32_t ndp_idx;
+
+	if (ntb->len < sizeof(struct nth16) ||
+	    sys_get_le32(&nth[offsetof(struct nth16, dwSignature)]) != NTH16_SIGNATURE ||
+	    sys_get_le16(&nth[offsetof(struct nth16, wHeaderLength)]) != sizeof(struct nth16)) {
+		LOG_WRN("Invalid NTH16");
+		return -EINVAL;
+	}
+
+	block_len = sys_get_le16(&nth[offsetof(struct nth16, wBlockLength)]);
+	if (block_len == 0 || block_len > ntb->len) {
+		block_len = ntb->len;
+	}
+
+	ndp_idx = sys_get_le16(&nth[offsetof(struct nth16, wNdpIndex)]);
+	for (int n = 0; ndp_idx != 0 && n < CDC_NCM_MAX_NDP; n++) {
+		const uint8_t *ndp = &nth[ndp_idx];
+		uint32_t ndp_len;
+
+		if (ndp_idx + sizeof(struct ndp16) > block_len ||
+		    sys_get_le32(&ndp[offsetof(struct ndp16, dwSignature)]) != NDP16_SIGNATURE) {
+			LOG_WRN("Invalid NDP16 at %u", ndp_idx);
+			return -EINVAL;
+		}
+
+		ndp_len = sys_get_le16(&ndp[offsetof(struct ndp16, wLength)]);
+		if (ndp_len < sizeof(struct ndp16) + 2 * sizeof(struct ndp16_datagram) ||
+		    ndp_idx + ndp_len > block_len) {
+			LOG_WRN("Invalid NDP16 length %u", ndp_len);
+			return -EINVAL;
+		}
+
+		for (uint32_t i = sizeof(struct ndp16);
+		     i + sizeof(struct ndp16_datagram) <= ndp_len;
+		     i += sizeof(struct ndp16_datagram)) {
+			uint32_t index = sys_get_le16(&ndp[i]);
+			uint32_t len = sys_get_le16(&ndp[i + sizeof(uint16_t)]);
+
+			if (index == 0 || len == 0) {
+				/* End of the datagram table */
+				break;
+			}
+
+			if (index + len > block_len) {
+				LOG_WRN("Datagram %u at %u out of NTB", len, index);
+				break;
+			}
+
+			cdc_ncm_rx_datagram(data, ntb, index, len);
+		}
+
+		ndp_idx = sys_get_le16(&ndp[offsetof(struct ndp16, wNextNdpIndex)]);
+	}
+
+	return 0;
+}
+
+static int cdc_ncm_acl_out_cb(struct usbd_class_node *const c_nd,
+			      struct net_buf *const buf, const int err)
+{
+	const struct device *dev = c_nd->data->priv;
+	struct cdc_ncm_eth_data *data = dev->data;
+
+	if (!err && buf->len != 0) {
+		(void)cdc_ncm_rx_ntb(data, buf);
+	}
+
+	/* Requeued by the destroy callback once the datagrams are released */
+	net_buf_unref(buf);
+
+	return 0;
+}
+
+static size_t cdc_ncm_ndp_size(const uint8_t count)
+{
+	/* Datagram pointers and the null entry ending the table */
+	return sizeof(struct ndp16) + (count + 1) * sizeof(struct ndp16_datagram);
+}
+
+static bool cdc_ncm_tx_fits(struct cdc_ncm_eth_data *const data, const size_t len)
+{
+	size_t end;
+
+	if (data->tx_count >= data->tx_max_dgram) {
+		return false;
+	}
+
+	end = ROUND_UP(data->tx_ntb->len, CDC_NCM_DIVISOR) + len;
+
+	return ROUND_UP(end, CDC_NCM_NDP_ALIGNMENT) +
+	       cdc_ncm_ndp_size(data->tx_count + 1) <= data->ntb_in_size;
+}
+
+/* Send the aggregated NTB, with the lock held and the IN endpoint idle */
+static void cdc_ncm_tx_flush(struct cdc_ncm_eth_data *const data)
+{
+	struct usbd_class_node *c_nd = data->c_nd;
+	struct net_buf *buf = data->tx_ntb;
+	size_t ndp_size = cdc_ncm_ndp_size(data->tx_count);
+	struct nth16 *nth;
+	struct ndp16 *ndp;
+	uint16_t ndp_idx;
+	uint16_t bulk_mps;
+	int ret;
+
+	data->tx_ntb = NULL;
+
+	ndp_idx = ROUND_UP(buf->len, CDC_NCM_NDP_ALIGNMENT);
+	memset(net_buf_add(buf, ndp_idx - buf->len), 0, ndp_idx - buf->len);
+
+	ndp = net_buf_add(buf, ndp_size);
+	ndp->dwSignature = sys_cpu_to_le32(NDP16_SIGNATURE);
+	ndp->wLength = sys_cpu_to_le16(ndp_size);
+	ndp->wNextNdpIndex = 0;
+	memcpy(ndp->datagram, data->tx_dgram,
+	       data->tx_count * sizeof(struct ndp16_datagram));
+	memset(&ndp->datagram[data->tx_count], 0, sizeof(struct ndp16_datagram));
+
+	nth = (struct nth16 *)buf->data;
+	nth->dwSignature = sys_cpu_to_le32(NTH16_SIGNATURE);
+	nth->wHeaderLength = sys_cpu_to_le16(sizeof(struct nth16));
+	nth->wSequence = sys_cpu_to_le16(data->tx_seq++);
+	nth->wBlockLength = sys_cpu_to_le16(buf->len);
+	nth->wNdpIndex = sys_cpu_to_le16(ndp_idx);
+
+	/*
+	 * REVISE: It should be more abstract and
+	 * not pull UDC stuff in the class code.
+	 */
+	if (udc_device_speed(c_nd->data->uds_ctx->dev) == UDC_BUS_SPEED_FS) {
+		bulk_mps = 64;
+	} else {
+		bulk_mps = 512;
+	}
+
+	/* Only an NTB of the maximum size is not ended by a short packet */
+	if (!(buf->len % bulk_mps) && buf->len < data->ntb_in_size) {
+		udc_ep_buf_set_zlp(buf);
+	}
+
+	LOG_DBG("Send NTB of %u datagrams, len %u", data->tx_count, buf->len);
+	ret = usbd_ep_enqueue(c_nd, buf);
+	if (ret) {
+		LOG_ERR("Failed to enqueue NTB");
+		net_buf_unref(buf);
+		k_sem_give(&data->sync_sem);
+	}
+}
+
+static void cdc_ncm_tx_work_handler(struct k_work *work)
+{
+	struct cdc_ncm_eth_data *data;
+
+	data = CONTAINER_OF(work, struct cdc_ncm_eth_data, tx_work);
+
+	k_mutex_lock(&data->tx_lock, K_FOREVER);
+	if (data->tx_ntb != NULL && k_sem_take(&data->sync_sem, K_NO_WAIT) == 0) {
+		cdc_ncm_tx_flush(data);
+	}
+	k_mutex_unlock(&data->tx_lock);
+}
+
+static int usbd_cdc_ncm_request(struct usbd_class_node *const c_nd,
+				struct net_buf *buf, int err)
+{
+	struct usbd_contex *uds_ctx = c_nd->data->uds_ctx;
+	const struct device *dev = c_nd->data->priv;
+	struct cdc_ncm_eth_data *data = dev->data;
+	struct udc_buf_info *bi;
+
+	bi = udc_get_buf_info(buf);
+
+	if (bi->ep == cdc_ncm_get_bulk_out(c_nd)) {
+		return cdc_ncm_acl_out_cb(c_nd, buf, err);
+	}
+
+	if (bi->ep == cdc_ncm_get_bulk_in(c_nd)) {
+		net_buf_unref(buf);
+		k_sem_give(&data->sync_sem);
+		/* Send what has been aggregated meanwhile */
+		k_work_submit(&data->tx_work);
+
+		return 0;
+	}
+
+	if (bi->ep == cdc_ncm_get_int_in(c_nd)) {
+		k_sem_give(&data->notif_sem);
+
+		return 0;
+	}
+
+	return usbd_ep_buf_free(uds_ctx, buf);
+}
+
+static int cdc_ncm_send_notification(const struct device *dev,
+				     const bool connected)
+{
+	struct cdc_ncm_eth_data *data = dev->data;
+	struct usbd_class_node *c_nd = data->c_nd;
+	struct cdc_ncm_notification notification = {
+		.RequestType = {
+			.direction = USB_REQTYPE_DIR_TO_HOST,
+			.type = USB_REQTYPE_TYPE_CLASS,
+			.recipient = USB_REQTYPE_RECIPIENT_INTERFACE,
+		},
+		.bNotificationType = USB_CDC_NETWORK_CONNECTION,
+		.wValue = sys_cpu_to_le16((uint16_t)connected),
+		.wIndex = sys_cpu_to_le16(cdc_ncm_get_ctrl_if(c_nd)),
+		.wLength = 0,
+	};
+	struct net_buf *buf;
+	uint8_t ep;
+	int ret;
+
+	if (!atomic_test_bit(&data->state, CDC_NCM_CLASS_ENABLED)) {
+		LOG_INF("USB configuration is not enabled");
+		return 0;
+	}
+
+	if (atomic_test_bit(&data->state, CDC_NCM_CLASS_SUSPENDED)) {
+		LOG_INF("USB device is suspended (FIXME)");
+		return 0;
+	}
+
+	ep = cdc_ncm_get_int_in(c_nd);
+	buf = usbd_ep_buf_alloc(c_nd, ep, sizeof(struct cdc_ncm_notification));
+	if (buf == NULL) {
+		return -ENOMEM;
+	}
+
+	net_buf_add_mem(buf, &notification, sizeof(struct cdc_ncm_notification));
+	ret = usbd_ep_enqueue(c_nd, buf);
+	if (ret) {
+		LOG_ERR("Failed to enqueue net_buf for 0x%02x", ep);
+		net_buf_unref(buf);
+		return ret;
+	}
+
+	k_sem_take(&data->notif_sem, K_FOREVER);
+	net_buf_unref(buf);
+
+	return 0;
+}
+
+static void cdc_ncm_reset_ntb_params(struct cdc_ncm_eth_data *const data)
+{
+	data->ntb_in_size = CONFIG_USBD_CDC_NCM_NTB_IN_SIZE;
+	data->tx_max_dgram = CONFIG_USBD_CDC_NCM_IN_MAX_DATAGRAMS;
+}
+
+static void usbd_cdc_ncm_update(struct usbd_class_node *const c_nd,
+				const uint8_t iface, const uint8_t alternate)
+{
+	struct usbd_cdc_ncm_desc *desc = c_nd->data->desc;
+	const uint8_t data_iface = desc->if1_1.bInterfaceNumber;
+	const struct device *dev = c_nd->data->priv;
+	struct cdc_ncm_eth_data *data = dev->data;
+
+	LOG_INF("New configuration, interface %u alternate %u",
+		iface, alternate);
+
+	if (data_iface == iface && alternate == 0) {
+		/* NCM10.pdf, 7.2, the NTB parameters are reset */
+		atomic_clear_bit(&data->state, CDC_NCM_DATA_IFACE_ENABLED);
+		cdc_ncm_reset_ntb_params(data);
+		net_if_carrier_off(data->iface);
+	}
+
+	if (data_iface == iface && alternate == 1) {
+		atomic_set_bit(&data->state, CDC_NCM_DATA_IFACE_ENABLED);
+		net_if_carrier_on(data->iface);
+		if (cdc_ncm_out_start(c_nd)) {
+			LOG_ERR("Failed to start OUT transfer");
+		}
+	}
+}
+
+static void usbd_cdc_ncm_enable(struct usbd_class_node *const c_nd)
+{
+	const struct device *dev = c_nd->data->priv;
+	struct cdc_ncm_eth_data *data = dev->data;
+
+	atomic_set_bit(&data->state, CDC_NCM_CLASS_ENABLED);
+	LOG_INF("Configuration enabled");
+}
+
+static void usbd_cdc_ncm_disable(struct usbd_class_node *const c_nd)
+{
+	const struct device *dev = c_nd->data->priv;
+	struct cdc_ncm_eth_data *data = dev->data;
+
+	if (atomic_test_and_clear_bit(&data->state, CDC_NCM_CLASS_ENABLED)) {
+		net_if_carrier_off(data->iface);
+	}
+
+	atomic_clear_bit(&data->state, CDC_NCM_DATA_IFACE_ENABLED);
+	atomic_clear_bit(&data->state, CDC_NCM_CLASS_SUSPENDED);
+	LOG_INF("Configuration disabled");
+}
+
+static void usbd_cdc_ncm_suspended(struct usbd_class_node *const c_nd)
+{
+	const struct device *dev = c_nd->data->priv;
+	struct cdc_ncm_eth_data *data = dev->data;
+
+	atomic_set_bit(&data->state, CDC_NCM_CLASS_SUSPENDED);
+}
+
+static void usbd_cdc_ncm_resumed(struct usbd_class_node *const c_nd)
+{
+	const struct device *dev = c_nd->data->priv;
+	struct cdc_ncm_eth_data *data = dev->data;
+
+	atomic_clear_bit(&data->state, CDC_NCM_CLASS_SUSPENDED);
+}
+
+static int usbd_cdc_ncm_cth(struct usbd_class_node *const c_nd,
+			    const struct usb_setup_packet *const setup,
+			    struct net_buf *const buf)
+{
+	const struct device *dev = c_nd->data->priv;
+	struct cdc_ncm_eth_data *data = dev->data;
+
+	if (buf == NULL) {
+		errno = -ENOMEM;
+		return 0;
+	}
+
+	if (setup->bRequest == GET_NTB_PARAMETERS) {
+		struct ntb_parameters params = {
+			.wLength = sys_cpu_to_le16(sizeof(struct ntb_parameters)),
+			.bmNtbFormatsSupported = sys_cpu_to_le16(NTB_FORMAT_16),
+			.dwNtbInMaxSize = sys_cpu_to_le32(CONFIG_USBD_CDC_NCM_NTB_IN_SIZE),
+			.wNdpInDivisor = sys_cpu_to_le16(CDC_NCM_DIVISOR),
+			.wNdpInPayloadRemainder = 0,
+			.wNdpInAlignment = sys_cpu_to_le16(CDC_NCM_NDP_ALIGNMENT),
+			.dwNtbOutMaxSize = sys_cpu_to_le32(CONFIG_USBD_CDC_NCM_NTB_OUT_SIZE),
+			.wNdpOutDivisor = sys_cpu_to_le16(CDC_NCM_DIVISOR),
+			.wNdpOutPayloadRemainder = sys_cpu_to_le16(CDC_NCM_OUT_REMAINDER),
+			.wNdpOutAlignment = sys_cpu_to_le16(CDC_NCM_NDP_ALIGNMENT),
+			.wNtbOutMaxDatagrams = 0,
+		};
+
+		net_buf_add_mem(buf, &params, MIN(sizeof(params), setup->wLength));
+
+		return 0;
+	}
+
+	if (setup->bRequest == GET_NTB_INPUT_SIZE) {
+		struct ntb_input_size size = {
+			.dwNtbInMaxSize = sys_cpu_to_le32(data->ntb_in_size),
+			.wNtbInMaxDatagrams = sys_cpu_to_le16(data->tx_max_dgram),
+		};
+
+		net_buf_add_mem(buf, &size, MIN(sizeof(size), setup->wLength));
+
+		return 0;
+	}
+
+	if (setup->bRequest == GET_NTB_FORMAT) {
+		/* Only the 16-bit NTB format is supported */
+		net_buf_add_le16(buf, 0);
+
+		return 0;
+	}
+
+	LOG_DBG("bmRequestType 0x%02x bRequest 0x%02x unsupported",
+		setup->bmRequestType, setup->bRequest);
+	errno = -ENOTSUP;
+
+	return 0;
+}
+
+static int usbd_cdc_ncm_ctd(struct usbd_class_node *const c_nd,
+			    const struct usb_setup_packet *const setup,
+			    const struct net_buf *const buf)
+{
+	const struct device *dev = c_nd->data->priv;
+	struct cdc_ncm_eth_data *data = dev->data;
+	uint32_t size;
+	uint16_t max;
+
+	switch (setup->bRequest) {
+	case SET_ETHERNET_PACKET_FILTER:
+		LOG_INF("bRequest 0x%02x (SetPacketFilter) not implemented",
+			setup->bRequest);
+
+		return 0;
+
+	case SET_NTB_INPUT_SIZE:
+		if (setup->wLength != sizeof(uint32_t) &&
+		    setup->wLength != sizeof(struct ntb_input_size)) {
+			break;
+		}
+
+		size = sys_get_le32(buf->data);
+		if (size < NTB_MIN_SIZE || size > CONFIG_USBD_CDC_NCM_NTB_IN_SIZE) {
+			LOG_WRN("Unsupported NTB input size %u", size);
+			break;
+		}
+
+		/* Read once per datagram by the TX path, no lock needed */
+		data->ntb_in_size = size;
+
+		if (setup->wLength == sizeof(struct ntb_input_size)) {
+			max = sys_get_le16(&buf->data[sizeof(uint32_t)]);
+			data->tx_max_dgram = (max == 0) ? CONFIG_USBD_CDC_NCM_IN_MAX_DATAGRAMS :
+					     MIN(max, CONFIG_USBD_CDC_NCM_IN_MAX_DATAGRAMS);
+		}
+
+		return 0;
+
+	case SET_NTB_FORMAT:
+		if (setup->wValue != 0) {
+			break;
+		}
+
+		return 0;
+
+	default:
+		break;
+	}
+
+	LOG_DBG("bmRequestType 0x%02x bRequest 0x%02x unsupported",
+		setup->bmRequestType, setup->bRequest);
+	errno = -ENOTSUP;
+
+	return 0;
+}
+
+static int usbd_cdc_ncm_init(struct usbd_class_node *const c_nd)
+{
+	struct usbd_cdc_ncm_desc *desc = c_nd->data->desc;
+	const uint8_t if_num = desc->if0.bInterfaceNumber;
+	const struct device *dev = c_nd->data->priv;
+	struct cdc_ncm_eth_data *const data = dev->data;
+
+	/* Update relevant b*Interface fields */
+	desc->iad.bFirstInterface = if_num;
+	desc->if0_union.bControlInterface = if_num;
+	desc->if0_union.bSubordinateInterface0 = if_num + 1;
+	LOG_DBG("CDC NCM class initialized");
+
+	if (usbd_add_descriptor(c_nd->data->uds_ctx, data->mac_desc_nd)) {
+		LOG_ERR("Failed to add iMACAddress string descriptor");
+	} else {
+		desc->if0_ecm.iMACAddress = data->mac_desc_nd->idx;
+	}
+
+	return 0;
+}
+
+static void usbd_cdc_ncm_shutdown(struct usbd_class_node *const c_nd)
+{
+	struct usbd_cdc_ncm_desc *desc = c_nd->data->desc;
+	const struct device *dev = c_nd->data->priv;
+	struct cdc_ncm_eth_data *const data = dev->data;
+
+	desc->if0_ecm.iMACAddress = 0;
+	sys_dlist_remove(&data->mac_desc_nd->node);
+}
+
+/*
+ * Frames are sent right away when the IN endpoint is idle, and aggregated in
+ * the next NTB while the previous one is on the bus.
+ */
+static int cdc_ncm_send(const struct device *dev, struct net_pkt *const pkt)
+{
+	struct cdc_ncm_eth_data *const data = dev->data;
+	struct usbd_class_node *c_nd = data->c_nd;
+	size_t len = net_pkt_get_len(pkt);
+	size_t offset;
+	size_t pad;
+	int ret = 0;
+
+	if (len > NET_ETH_MAX_FRAME_SIZE) {
+		LOG_WRN("Trying to send too large packet, drop");
+		return -ENOMEM;
+	}
+
+	if (!atomic_test_bit(&data->state, CDC_NCM_CLASS_ENABLED) ||
+	    !atomic_test_bit(&data->state, CDC_NCM_IFACE_UP)) {
+		LOG_INF("Configuration is not enabled or interface not ready");
+		return -EACCES;
+	}
+
+	k_mutex_lock(&data->tx_lock, K_FOREVER);
+
+	if (data->tx_ntb != NULL && !cdc_ncm_tx_fits(data, len)) {
+		/* Wait for the NTB on the bus to send the full one */
+		k_sem_take(&data->sync_sem, K_FOREVER);
+		cdc_ncm_tx_flush(data);
+	}
+
+	if (data->tx_ntb == NULL) {
+		data->tx_ntb = cdc_ncm_buf_alloc(data->in_pool,
+						 cdc_ncm_get_bulk_in(c_nd));
+		if (data->tx_ntb == NULL) {
+			LOG_ERR("Failed to allocate buffer");
+			ret = -ENOMEM;
+			goto send_exit;
+		}
+
+		memset(net_buf_add(data->tx_ntb, sizeof(struct nth16)), 0,
+		       sizeof(struct nth16));
+		data->tx_count = 0;
+	}
+
+	if (!cdc_ncm_tx_fits(data, len)) {
+		LOG_WRN("Packet does not fit in NTB, drop");
+		ret = -ENOMEM;
+		goto send_exit;
+	}
+
+	offset = ROUND_UP(data->tx_ntb->len, CDC_NCM_DIVISOR);
+	pad = offset - data->tx_ntb->len;
+	if (net_pkt_read(pkt, net_buf_tail(data->tx_ntb) + pad, len)) {
+		LOG_ERR("Failed copy net_pkt");
+		ret = -ENOBUFS;
+		goto send_exit;
+	}
+
+	memset(net_buf_add(data->tx_ntb, pad), 0, pad);
+	net_buf_add(data->tx_ntb, len);
+	data->tx_dgram[data->tx_count].wDatagramIndex = sys_cpu_to_le16(offset);
+	data->tx_dgram[data->tx_count].wDatagramLength = sys_cpu_to_le16(len);
+	data->tx_count++;
+
+	if (k_sem_take(&data->sync_sem, K_NO_WAIT) == 0) {
+		cdc_ncm_tx_flush(data);
+	}
+
+send_exit:
+	k_mutex_unlock(&data->tx_lock);
+
+	return ret;
+}
+
+static int cdc_ncm_set_config(const struct device *dev,
+			      const enum ethernet_config_type type,
+			      const struct ethernet_config *config)
+{
+	struct cdc_ncm_eth_data *data = dev->data;
+
+	if (type == ETHERNET_CONFIG_TYPE_MAC_ADDRESS) {
+		memcpy(data->mac_addr, config->mac_address.addr,
+		       sizeof(data->mac_addr));
+
+		return 0;
+	}
+
+	return -ENOTSUP;
+}
+
+static int cdc_ncm_get_config(const struct device *dev,
+			      enum ethernet_config_type type,
+			      struct ethernet_config *config)
+{
+	return -ENOTSUP;
+}
+
+static enum ethernet_hw_caps cdc_ncm_get_capabilities(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	return ETHERNET_LINK_10BASE_T | ETHERNET_LINK_100BASE_T;
+}
+
+static int cdc_ncm_iface_start(const struct device *dev)
+{
+	struct cdc_ncm_eth_data *data = dev->data;
+	int ret;
+
+	LOG_DBG("Start interface %p", data->iface);
+	ret = cdc_ncm_send_notification(dev, true);
+	if (!ret) {
+		atomic_set_bit(&data->state, CDC_NCM_IFACE_UP);
+	}
+
+	return ret;
+}
+
+static int cdc_ncm_iface_stop(const struct device *dev)
+{
+	struct cdc_ncm_eth_data *data = dev->data;
+	int ret;
+
+	LOG_DBG("Stop interface %p", data->iface);
+	ret = cdc_ncm_send_notification(dev, false);
+	if (!ret) {
+		atomic_clear_bit(&data->state, CDC_NCM_IFACE_UP);
+	}
+
+	return ret;
+}
+
+static void cdc_ncm_iface_init(struct net_if *const iface)
+{
+	const struct device *dev = net_if_get_device(iface);
+	struct cdc_ncm_eth_data *data = dev->data;
+
+	data->iface = iface;
+	ethernet_init(iface);
+	net_if_set_link_addr(iface, data->mac_addr,
+			     sizeof(data->mac_addr),
+			     NET_LINK_ETHERNET);
+
+	net_if_carrier_off(iface);
+
+	LOG_DBG("CDC NCM interface initialized");
+}
+
+static int usbd_cdc_ncm_preinit(const struct device *dev)
+{
+	struct cdc_ncm_eth_data *data = dev->data;
+
+	if (sys_get_le48(data->mac_addr) == sys_cpu_to_le48(0)) {
+		gen_random_mac(data->mac_addr, 0, 0, 0);
+	}
+
+	k_mutex_init(&data->tx_lock);
+	k_work_init(&data->tx_work, cdc_ncm_tx_work_handler);
+	k_work_init(&data->out_work, cdc_ncm_out_work_handler);
+	cdc_ncm_reset_ntb_params(data);
+
+	LOG_DBG("CDC NCM device initialized");
+
+	return 0;
+}
+
+static struct usbd_class_api usbd_cdc_ncm_api = {
+	.request = usbd_cdc_ncm_request,
+	.update = usbd_cdc_ncm_update,
+	.enable = usbd_cdc_ncm_enable,
+	.disable = usbd_cdc_ncm_disable,
+	.suspended = usbd_cdc_ncm_suspended,
+	.resumed = usbd_cdc_ncm_resumed,
+	.control_to_host = usbd_cdc_ncm_cth,
+	.control_to_dev = usbd_cdc_ncm_ctd,
+	.init = usbd_cdc_ncm_init,
+	.shutdown = usbd_cdc_ncm_shutdown,
+};
+
+static const struct ethernet_api cdc_ncm_eth_api = {
+	.iface_api.init = cdc_ncm_iface_init,
+	.get_config = cdc_ncm_get_config,
+	.set_config = cdc_ncm_set_config,
+	.get_capabilities = cdc_ncm_get_capabilities,
+	.send = cdc_ncm_send,
+	.start = cdc_ncm_iface_start,
+	.stop = cdc_ncm_iface_stop,
+};
+
+#define CDC_NCM_DEFINE_DESCRIPTOR(n)						\
+static struct usbd_cdc_ncm_desc cdc_ncm_desc_##n = {				\
+	.iad = {								\
+		.bLength = sizeof(struct usb_association_descriptor),		\
+		.bDescriptorType = USB_DESC_INTERFACE_ASSOC,			\
+		.bFirstInterface = 0,						\
+		.bInterfaceCount = 0x02,					\
+		.bFunctionClass = USB_BCC_CDC_CONTROL,				\
+		.bFunctionSubClass = NCM_SUBCLASS,				\
+		.bFunctionProtocol = 0,						\
+		.iFunction = 0,							\
+	},									\
+										\
+	.if0 = {								\
+		.bLength = sizeof(struct usb_if_descriptor),			\
+		.bDescriptorType = USB_DESC_INTERFACE,				\
+		.bInterfaceNumber = 0,						\
+		.bAlternateSetting = 0,						\
+		.bNumEndpoints = 1,						\
+		.bInterfaceClass = USB_BCC_CDC_CONTROL,				\
+		.bInterfaceSubClass = NCM_SUBCLASS,				\
+		.bInterfaceProtocol = 0,					\
+		.iInterface = 0,						\
+	},									\
+										\
+	.if0_header = {								\
+		.bFunctionLength = sizeof(struct cdc_header_descriptor),	\
+		.bDescriptorType = USB_DESC_CS_INTERFACE,			\
+		.bDescriptorSubtype = HEADER_FUNC_DESC,				\
+		.bcdCDC = sys_cpu_to_le16(USB_SRN_1_1),				\
+	},									\
+										\
+	.if0_union = {								\
+		.bFunctionLength = sizeof(struct cdc_union_descriptor),		\
+		.bDescriptorType = USB_DESC_CS_INTERFACE,			\
+		.bDescriptorSubtype = UNION_FUNC_DESC,				\
+		.bControlInterface = 0,						\
+		.bSubordinateInterface0 = 1,					\
+	},									\
+										\
+	.if0_ecm = {								\
+		.bFunctionLength = sizeof(struct cdc_ecm_descriptor),		\
+		.bDescriptorType = USB_DESC_CS_INTERFACE,			\
+		.bDescriptorSubtype = ETHERNET_FUNC_DESC,			\
+		.iMACAddress = 0,						\
+		.bmEthernetStatistics = sys_cpu_to_le32(0),			\
+		.wMaxSegmentSize = sys_cpu_to_le16(NET_ETH_MAX_FRAME_SIZE),	\
+		.wNumberMCFilters = sys_cpu_to_le16(0),				\
+		.bNumberPowerFilters = 0,					\
+	},									\
+										\
+	.if0_ncm = {								\
+		.bFunctionLength = sizeof(struct cdc_ncm_descriptor),		\
+		.bDescriptorType = USB_DESC_CS_INTERFACE,			\
+		.bDescriptorSubtype = NCM_FUNC_DESC,				\
+		.bcdNcmVersion = sys_cpu_to_le16(0x0100),			\
+		.bmNetworkCapabilities = 0,					\
+	},									\
+										\
+	.if0_int_ep = {								\
+		.bLength = sizeof(struct usb_ep_descriptor),			\
+		.bDescriptorType = USB_DESC_ENDPOINT,				\
+		.bEndpointAddress = 0x81,					\
+		.bmAttributes = USB_EP_TYPE_INTERRUPT,				\
+		.wMaxPacketSize = sys_cpu_to_le16(CDC_NCM_EP_MPS_INT),		\
+		.bInterval = CDC_NCM_EP_INTERVAL_INT,				\
+	},									\
+										\
+	.if1_0 = {								\
+		.bLength = sizeof(struct usb_if_descriptor),			\
+		.bDescriptorType = USB_DESC_INTERFACE,				\
+		.bInterfaceNumber = 1,						\
+		.bAlternateSetting = 0,						\
+		.bNumEndpoints = 0,						\
+		.bInterfaceClass = USB_BCC_CDC_DATA,				\
+		.bInterfaceSubClass = 0,					\
+		.bInterfaceProtocol = NCM_DATA_PROTOCOL,			\
+		.iInterface = 0,						\
+	},									\
+										\
+	.if1_1 = {								\
+		.bLength = sizeof(struct usb_if_descriptor),			\
+		.bDescriptorType = USB_DESC_INTERFACE,				\
+		.bInterfaceNumber = 1,						\
+		.bAlternateSetting = 1,						\
+		.bNumEndpoints = 2,						\
+		.bInterfaceClass = USB_BCC_CDC_DATA,				\
+		.bInterfaceSubClass = 0,					\
+		.bInterfaceProtocol = NCM_DATA_PROTOCOL,			\
+		.iInterface = 0,						\
+	},									\
+										\
+	.if1_1_in_ep = {							\
+		.bLength = sizeof(struct usb_ep_descriptor),			\
+		.bDescriptorType = USB_DESC_ENDPOINT,				\
+		.bEndpointAddress = 0x82,					\
+		.bmAttributes = USB_EP_TYPE_BULK,				\
+		.wMaxPacketSize = sys_cpu_to_le16(CDC_NCM_EP_MPS_BULK),		\
+		.bInterval = 0,							\
+	},									\
+										\
+	.if1_1_out_ep = {							\
+		.bLength = sizeof(struct usb_ep_descriptor),			\
+		.bDescriptorType = USB_DESC_ENDPOINT,				\
+		.bEndpointAddress = 0x01,					\
+		.bmAttributes = USB_EP_TYPE_BULK,				\
+		.wMaxPacketSize = sys_cpu_to_le16(CDC_NCM_EP_MPS_BULK),		\
+		.bInterval = 0,							\
+	},									\
+										\
+	.nil_desc = {								\
+		.bLength = 0,							\
+		.bDescriptorType = 0,						\
+	},									\
+}
+
+#define USBD_CDC_NCM_DT_DEVICE_DEFINE(n)					\
+	CDC_NCM_DEFINE_DESCRIPTOR(n);						\
+	USBD_DESC_STRING_DEFINE(ncm_mac_desc_nd_##n,				\
+				DT_INST_PROP(n, remote_mac_address),		\
+				USBD_DUT_STRING_INTERFACE);			\
+										\
+	NET_BUF_POOL_FIXED_DEFINE(cdc_ncm_in_pool_##n, 2,			\
+				  CONFIG_USBD_CDC_NCM_NTB_IN_SIZE,		\
+				  sizeof(struct udc_buf_info), NULL);		\
+	NET_BUF_POOL_FIXED_DEFINE(cdc_ncm_out_pool_##n,				\
+				  CONFIG_USBD_CDC_NCM_OUT_BUFS,			\
+				  CONFIG_USBD_CDC_NCM_NTB_OUT_SIZE,		\
+				  sizeof(struct udc_buf_info),			\
+				  cdc_ncm_out_destroy);				\
+										\
+	static struct usbd_class_data usbd_cdc_ncm_data_##n;			\
+										\
+	USBD_DEFINE_CLASS(cdc_ncm_##n,						\
+			  &usbd_cdc_ncm_api,					\
+			  &usbd_cdc_ncm_data_##n);				\
+										\
+	static struct cdc_ncm_eth_data eth_data_##n = {				\
+		.c_nd = &cdc_ncm_##n,						\
+		.mac_addr = DT_INST_PROP_OR(n, local_mac_address, {0}),		\
+		.sync_sem = Z_SEM_INITIALIZER(eth_data_##n.sync_sem, 1, 1),	\
+		.notif_sem = Z_SEM_INITIALIZER(eth_data_##n.notif_sem, 0, 1),	\
+		.mac_desc_nd = &ncm_mac_desc_nd_##n,				\
+		.in_pool = &cdc_ncm_in_pool_##n,				\
+		.out_pool = &cdc_ncm_out_pool_##n,				\
+	};									\
+										\
+	static struct usbd_class_data usbd_cdc_ncm_data_##n = {			\
+		.desc = (struct usb_desc_header *)&cdc_ncm_desc_##n,		\
+		.priv = (void *)DEVICE_DT_GET(DT_DRV_INST(n)),			\
+	};									\
+										\
+	ETH_NET_DEVICE_DT_INST_DEFINE(n, usbd_cdc_ncm_preinit, NULL,		\
+		&eth_data_##n, NULL,						\
+		CONFIG_ETH_INIT_PRIORITY,					\
+		&cdc_ncm_eth_api,						\
+		NET_ETH_MTU);
+
+DT_INST_FOREACH_STATUS_OKAY(USBD_CDC_NCM_DT_DEVICE_DEFINE);
@@ -75,6 +75,18 @@ NET_BUF_POOL_FIXED_DEFINE(msc_ep_pool,
 			  MSC_NUM_INSTANCES * 2, MSC_BUF_SIZE,
 			  sizeof(struct udc_buf_info), NULL);
 
+#if defined(CONFIG_USBD_MSC_DOUBLE_BUFFERING)
+/* SCSI buffer sized data transfers, one being filled while the other one
+ * is on the bus. A command only moves data in one direction at a time.
+ */
+#define MSC_DATA_BUFS 2
+
+NET_BUF_POOL_FIXED_DEFINE(msc_data_pool,
+			  MSC_NUM_INSTANCES * MSC_DATA_BUFS,
+			  CONFIG_USBD_MSC_SCSI_BUFFER_SIZE,
+			  sizeof(struct udc_buf_info), NULL);
+#endif
+
 struct msc_event {
 	struct usbd_class_node *node;
 	/* NULL to request Bulk-Only Mass Storage Reset
@@ -128,14 +140,20 @@ struct msc_bot_ctx {
 	uint32_t transferred_data;
 	size_t scsi_offset;
 	size_t scsi_bytes;
+	/* Data transfers queued on Bulk-In */
+	uint8_t in_queued;
+	/* Data transfers queued on Bulk-Out and their total length */
+	uint8_t out_queued;
+	size_t out_bytes;
 };
 
-static struct net_buf *msc_buf_alloc(const uint8_t ep)
+static struct net_buf *msc_pool_buf_alloc(struct net_buf_pool *const pool,
+					  const uint8_t ep)
 {
 	struct net_buf *buf = NULL;
 	struct udc_buf_info *bi;
 
-	buf = net_buf_alloc(&msc_ep_pool, K_NO_WAIT);
+	buf = net_buf_alloc(pool, K_NO_WAIT);
 	if (!buf) {
 		return NULL;
 	}
@@ -147,6 +165,11 @@ static struct net_buf *msc_buf_alloc(const uint8_t ep)
 	return buf;
 }
 
+static struct net_buf *msc_buf_alloc(const uint8_t ep)
+{
+	return msc_pool_buf_alloc(&msc_ep_pool, ep);
+}
+
 static uint8_t msc_get_bulk_in(struct usbd_class_node *const node)
 {
 	struct msc_bot_desc *desc = node->data->desc;
@@ -216,6 +239,10 @@ static void msc_reset_handler(struct usbd_class_node *node)
 		scsi_reset(&ctx->luns[i]);
 	}
 
+	ctx->in_queued = 0;
+	ctx->out_queued = 0;
+	ctx->out_bytes = 0;
+
 	atomic_clear_bit(&ctx->bits, MSC_BULK_IN_WEDGED);
 	atomic_clear_bit(&ctx->bits, MSC_BULK_OUT_WEDGED);
 }
@@ -240,6 +267,140 @@ static bool is_cbw_meaningful(struct msc_bot_ctx *const ctx)
 	return true;
 }
 
+#if defined(CONFIG_USBD_MSC_DOUBLE_BUFFERING)
+static bool msc_is_data_buf(struct net_buf *const buf)
+{
+	return net_buf_pool_get(buf->pool_id) == &msc_data_pool;
+}
+
+/* Read the disk straight into the data transfers, the next chunk being read
+ * while the previous one is sent to the host.
+ */
+static void msc_read_ahead(struct msc_bot_ctx *ctx)
+{
+	struct scsi_ctx *lun = &ctx->luns[ctx->cbw.bCBWLUN];
+	struct net_buf *buf;
+	uint8_t ep;
+	size_t len;
+	int ret;
+
+	ep = msc_get_bulk_in(ctx->class_node);
+	while (ctx->in_queued < MSC_DATA_BUFS) {
+		if (ctx->in_queued > 0 && scsi_cmd_remaining_data_len(lun) == 0) {
+			break;
+		}
+
+		buf = msc_pool_buf_alloc(&msc_data_pool, ep);
+		if (buf == NULL) {
+			break;
+		}
+
+		len = scsi_read_data(lun, buf->data);
+		if (len == 0 && ctx->in_queued > 0) {
+			/* The transfer ends with the queued data */
+			net_buf_unref(buf);
+			break;
+		}
+
+		/* An empty transfer still completes the data stage */
+		net_buf_add(buf, len);
+		ctx->csw.dCSWDataResidue -= len;
+		ret = usbd_ep_enqueue(ctx->class_node, buf);
+		if (ret) {
+			LOG_ERR("Failed to enqueue net_buf for 0x%02x", ep);
+			net_buf_unref(buf);
+			break;
+		}
+
+		ctx->in_queued++;
+		atomic_set_bit(&ctx->bits, MSC_BULK_IN_QUEUED);
+	}
+}
+
+/* Keep the Bulk-Out data transfers queued while the disk is written, without
+ * asking the host for more than the command carries.
+ */
+static void msc_write_ahead(struct msc_bot_ctx *ctx)
+{
+	struct scsi_ctx *lun = &ctx->luns[ctx->cbw.bCBWLUN];
+	size_t remaining = scsi_cmd_remaining_data_len(lun);
+	struct net_buf *buf;
+	size_t left;
+	uint8_t ep;
+	int ret;
+
+	ep = msc_get_bulk_out(ctx->class_node);
+	while (ctx->out_queued < MSC_DATA_BUFS) {
+		left = remaining > ctx->scsi_bytes ? remaining - ctx->scsi_bytes : 0;
+		left = MIN(left, ctx->cbw.dCBWDataTransferLength - ctx->transferred_data);
+		if (left <= ctx->out_bytes) {
+			break;
+		}
+
+		left -= ctx->out_bytes;
+		buf = msc_pool_buf_alloc(&msc_data_pool, ep);
+		if (buf == NULL) {
+			break;
+		}
+
+		if (left < buf->size) {
+			/* The controller receives up to the buffer tailroom */
+			net_buf_reserve(buf, buf->size - left);
+		}
+
+		ret = usbd_ep_enqueue(ctx->class_node, buf);
+		if (ret) {
+			LOG_ERR("Failed to enqueue net_buf for 0x%02x", ep);
+			net_buf_unref(buf);
+			break;
+		}
+
+		ctx->out_queued++;
+		ctx->out_bytes += net_buf_tailroom(buf);
+	}
+}
+
+static void msc_data_buf_done(struct msc_bot_ctx *ctx, struct net_buf *buf)
+{
+	struct udc_buf_info *bi = udc_get_buf_info(buf);
+
+	if (bi->ep == msc_get_bulk_out(ctx->class_node)) {
+		if (ctx->out_queued > 0) {
+			ctx->out_queued--;
+			ctx->out_bytes -= buf->size - net_buf_headroom(buf);
+		}
+	} else if (ctx->in_queued > 0) {
+		ctx->in_queued--;
+	}
+}
+#else
+static bool msc_is_data_buf(struct net_buf *const buf)
+{
+	return false;
+}
+
+static void msc_read_ahead(struct msc_bot_ctx *ctx)
+{
+}
+
+static void msc_write_ahead(struct msc_bot_ctx *ctx)
+{
+}
+
+static void msc_data_buf_done(struct msc_bot_ctx *ctx, struct net_buf *buf)
+{
+}
+#endif
+
+static void msc_queue_write(struct msc_bot_ctx *ctx)
+{
+	if (IS_ENABLED(CONFIG_USBD_MSC_DOUBLE_BUFFERING)) {
+		msc_write_ahead(ctx);
+	} else {
+		msc_queue_bulk_out_ep(ctx->class_node);
+	}
+}
+
 static void msc_process_read(struct msc_bot_ctx *ctx)
 {
 	struct scsi_ctx *lun = &ctx->luns[ctx->cbw.bCBWLUN];
@@ -249,6 +410,12 @@ static void msc_process_read(struct msc_bot_ctx *ctx)
 	size_t len;
 	int ret;
 
+	/* Data not already provided by the command comes from the disk */
+	if (IS_ENABLED(CONFIG_USBD_MSC_DOUBLE_BUFFERING) && ctx->scsi_bytes == 0) {
+		msc_read_ahead(ctx);
+		return;
+	}
+
 	/* Fill SCSI Data IN buffer if there is no data available */
 	if (ctx->scsi_bytes == 0) {
 		ctx->scsi_bytes = scsi_read_data(lun, ctx->scsi_buf);
@@ -438,6 +605,12 @@ static void msc_process_write(struct msc_bot_ctx *ctx,
 			 * progress. We do not intend to process more data so
 			 * stall the Bulk-Out pipe.
 			 */
+			if (ctx->out_queued > 0) {
+				/* Data transfers would swallow the next CBW */
+				usbd_ep_dequeue(ctx->class_node->data->uds_ctx,
+						msc_get_bulk_out(ctx->class_node));
+			}
+
 			msc_stall_bulk_out_ep(ctx->class_node);
 		}
 
@@ -504,7 +677,8 @@ static void msc_handle_bulk_in(struct msc_bot_ctx *ctx,
 		struct scsi_ctx *lun = &ctx->luns[ctx->cbw.bCBWLUN];
 
 		ctx->transferred_data += len;
-		if (ctx->scsi_bytes == 0) {
+		if (ctx->scsi_bytes == 0 && ctx->in_queued == 0 &&
+		    scsi_cmd_remaining_data_len(lun) == 0) {
 			if (ctx->csw.dCSWDataResidue > 0) {
 				/* Case (5) Hi > Di
 				 * While we may have sent short packet, device
@@ -562,6 +736,10 @@ static void usbd_msc_handle_request(struct usbd_class_node *node,
 	struct udc_buf_info *bi;
 
 	bi = udc_get_buf_info(buf);
+	if (msc_is_data_buf(buf)) {
+		msc_data_buf_done(ctx, buf);
+	}
+
 	if (err) {
 		if (err == -ECONNABORTED) {
 			LOG_WRN("request ep 0x%02x, len %u cancelled",
@@ -613,14 +791,22 @@ static void usbd_msc_thread(void *arg1, void *arg2, void *arg3)
 
 		switch (ctx->state) {
 		case MSC_BBB_EXPECT_CBW:
-		case MSC_BBB_PROCESS_WRITE:
 			/* Ensure we can accept next OUT packet */
 			msc_queue_bulk_out_ep(evt.node);
 			break;
+		case MSC_BBB_PROCESS_WRITE:
+			msc_queue_write(ctx);
+			break;
 		default:
 			break;
 		}
 
+		if (ctx->state == MSC_BBB_PROCESS_READ && ctx->in_queued > 0) {
+			/* Read the next chunk while the previous one is sent */
+			msc_read_ahead(ctx);
+			continue;
+		}
+
 		/* Skip (potentially) response generating code if there is
 		 * IN data already available for the host to pick up.
 		 */
@@ -635,7 +821,7 @@ static void usbd_msc_thread(void *arg1, void *arg2, void *arg3)
 		if (ctx->state == MSC_BBB_PROCESS_READ) {
 			msc_process_read(ctx);
 		} else if (ctx->state == MSC_BBB_PROCESS_WRITE) {
-			msc_queue_bulk_out_ep(evt.node);
+			msc_queue_write(ctx);
 		} else if (ctx->state == MSC_BBB_SEND_CSW) {
 			msc_send_csw(ctx);
 		}
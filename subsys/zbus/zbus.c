@@ -8,6 +8,7 @@
 #include <zephyr/sys/iterable_sections.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/sys/printk.h>
+#include <zephyr/sys/barrier.h>
 #include <zephyr/net/buf.h>
 #include <zephyr/zbus/zbus.h>
 LOG_MODULE_REGISTER(zbus, CONFIG_ZBUS_LOG_LEVEL);
@@ -88,7 +89,7 @@ SYS_INIT(_zbus_init, APPLICATION, CONFIG_ZBUS_CHANNELS_SYS_INIT_PRIORITY);
 
 static inline int _zbus_notify_observer(const struct zbus_channel *chan,
 					const struct zbus_observer *obs, k_timepoint_t end_time,
-					struct net_buf *buf)
+					struct net_buf **buf)
 {
 	switch (obs->type) {
 	case ZBUS_OBSERVER_LISTENER_TYPE: {
@@ -100,14 +101,31 @@ static inline int _zbus_notify_observer(const struct zbus_channel *chan,
 	}
 #if defined(CONFIG_ZBUS_MSG_SUBSCRIBER)
 	case ZBUS_OBSERVER_MSG_SUBSCRIBER_TYPE: {
-		struct net_buf *cloned_buf = net_buf_clone(buf, sys_timepoint_timeout(end_time));
+		struct net_buf *obs_buf;
+
+		/* The message is only copied for the first message subscriber, which gets the buffer
+		 * itself. The following ones get clones, sharing its data when the pool allows it.
+		 * The subscribers never modify the buffers.
+		 */
+		if (*buf == NULL) {
+			*buf = _zbus_create_net_buf(&_zbus_msg_subscribers_pool,
+						    zbus_chan_msg_size(chan),
+						    sys_timepoint_timeout(end_time));
+			if (*buf == NULL) {
+				return -ENOMEM;
+			}
 
-		if (cloned_buf == NULL) {
-			return -ENOMEM;
+			net_buf_add_mem(*buf, zbus_chan_msg(chan), zbus_chan_msg_size(chan));
+			obs_buf = net_buf_ref(*buf);
+		} else {
+			obs_buf = net_buf_clone(*buf, sys_timepoint_timeout(end_time));
+			if (obs_buf == NULL) {
+				return -ENOMEM;
+			}
 		}
-		memcpy(net_buf_user_data(cloned_buf), &chan, sizeof(struct zbus_channel *));
+		memcpy(net_buf_user_data(obs_buf), &chan, sizeof(struct zbus_channel *));
 
-		net_buf_put(obs->message_fifo, cloned_buf);
+		net_buf_put(obs->message_fifo, obs_buf);
 
 		break;
 	}
@@ -129,16 +147,6 @@ static inline int _zbus_vded_exec(const struct zbus_channel *chan, k_timepoint_t
 	struct zbus_channel_observation *observation;
 	struct zbus_channel_observation_mask *observation_mask;
 
-#if defined(CONFIG_ZBUS_MSG_SUBSCRIBER)
-	buf = _zbus_create_net_buf(&_zbus_msg_subscribers_pool, zbus_chan_msg_size(chan),
-				   sys_timepoint_timeout(end_time));
-
-	_ZBUS_ASSERT(buf != NULL, "net_buf zbus_msg_subscribers_pool is "
-				  "unavailable or heap is full");
-
-	net_buf_add_mem(buf, zbus_chan_msg(chan), zbus_chan_msg_size(chan));
-#endif /* CONFIG_ZBUS_MSG_SUBSCRIBER */
-
 	LOG_DBG("Notifing %s's observers. Starting VDED:", _ZBUS_CHAN_NAME(chan));
 
 	int __maybe_unused index = 0;
@@ -156,14 +164,14 @@ static inline int _zbus_vded_exec(const struct zbus_channel *chan, k_timepoint_t
 			continue;
 		}
 
-		err = _zbus_notify_observer(chan, obs, end_time, buf);
+		err = _zbus_notify_observer(chan, obs, end_time, &buf);
 
 		if (err) {
 			last_error = err;
 			LOG_ERR("could not deliver notification to observer %s. Error code %d",
 				_ZBUS_OBS_NAME(obs), err);
 			if (err == -ENOMEM) {
-				if (IS_ENABLED(CONFIG_ZBUS_MSG_SUBSCRIBER)) {
+				if (IS_ENABLED(CONFIG_ZBUS_MSG_SUBSCRIBER) && (buf != NULL)) {
 					net_buf_unref(buf);
 				}
 				return err;
@@ -185,7 +193,7 @@ static inline int _zbus_vded_exec(const struct zbus_channel *chan, k_timepoint_t
 			continue;
 		}
 
-		err = _zbus_notify_observer(chan, obs, end_time, buf);
+		err = _zbus_notify_observer(chan, obs, end_time, &buf);
 
 		if (err) {
 			last_error = err;
@@ -193,7 +201,9 @@ static inline int _zbus_vded_exec(const struct zbus_channel *chan, k_timepoint_t
 	}
 #endif /* CONFIG_ZBUS_RUNTIME_OBSERVERS */
 
-	IF_ENABLED(CONFIG_ZBUS_MSG_SUBSCRIBER, (net_buf_unref(buf);))
+	if (IS_ENABLED(CONFIG_ZBUS_MSG_SUBSCRIBER) && (buf != NULL)) {
+		net_buf_unref(buf);
+	}
 
 	return last_error;
 }
@@ -289,6 +299,34 @@ static inline void update_all_channels_hop(const struct zbus_observer *obs)
 
 #endif /* CONFIG_ZBUS_PRIORITY_BOOST */
 
+#if defined(CONFIG_ZBUS_CHANNEL_SEQLOCK)
+
+/* Lock-free read attempts before waiting for the channel */
+#define SEQLOCK_READ_RETRIES 3
+
+/* The sequence is odd while the message is written, with the channel locked */
+static inline void chan_write_begin(const struct zbus_channel *chan)
+{
+	(void)atomic_inc(&chan->data->seq);
+}
+
+static inline void chan_write_end(const struct zbus_channel *chan)
+{
+	(void)atomic_inc(&chan->data->seq);
+}
+
+#else
+
+static inline void chan_write_begin(const struct zbus_channel *chan)
+{
+}
+
+static inline void chan_write_end(const struct zbus_channel *chan)
+{
+}
+
+#endif /* CONFIG_ZBUS_CHANNEL_SEQLOCK */
+
 static inline int chan_lock(const struct zbus_channel *chan, k_timeout_t timeout, int *prio)
 {
 	bool boosting = false;
@@ -367,7 +405,69 @@ int zbus_chan_pub(const struct zbus_channel *chan, const void *msg, k_timeout_t
 		return err;
 	}
 
+	chan_write_begin(chan);
 	memcpy(chan->message, msg, chan->message_size);
+	chan_write_end(chan);
+
+	err = _zbus_vded_exec(chan, end_time);
+
+	chan_unlock(chan, context_priority);
+
+	return err;
+}
+
+int zbus_chan_loan(const struct zbus_channel *chan, void **msg, k_timeout_t timeout)
+{
+	int err;
+
+	_ZBUS_ASSERT(chan != NULL, "chan is required");
+	_ZBUS_ASSERT(msg != NULL, "msg is required");
+
+	if (chan->validator != NULL) {
+		return -ENOTSUP;
+	}
+
+	if (k_is_in_isr()) {
+		timeout = K_NO_WAIT;
+	}
+
+	int context_priority = ZBUS_MIN_THREAD_PRIORITY;
+
+	err = chan_lock(chan, timeout, &context_priority);
+	if (err) {
+		return err;
+	}
+
+#if defined(CONFIG_ZBUS_PRIORITY_BOOST)
+	chan->data->loan_priority = context_priority;
+#endif /* CONFIG_ZBUS_PRIORITY_BOOST */
+
+	chan_write_begin(chan);
+
+	*msg = chan->message;
+
+	return 0;
+}
+
+int zbus_chan_loan_pub(const struct zbus_channel *chan, k_timeout_t timeout)
+{
+	int err;
+
+	_ZBUS_ASSERT(chan != NULL, "chan is required");
+
+	if (k_is_in_isr()) {
+		timeout = K_NO_WAIT;
+	}
+
+	k_timepoint_t end_time = sys_timepoint_calc(timeout);
+
+	int context_priority = ZBUS_MIN_THREAD_PRIORITY;
+
+#if defined(CONFIG_ZBUS_PRIORITY_BOOST)
+	context_priority = chan->data->loan_priority;
+#endif /* CONFIG_ZBUS_PRIORITY_BOOST */
+
+	chan_write_end(chan);
 
 	err = _zbus_vded_exec(chan, end_time);
 
@@ -397,6 +497,35 @@ int zbus_chan_read(const struct zbus_channel *chan, void *msg, k_timeout_t timeo
 	return 0;
 }
 
+#if defined(CONFIG_ZBUS_CHANNEL_SEQLOCK)
+
+int zbus_chan_read_lockfree(const struct zbus_channel *chan, void *msg, k_timeout_t timeout)
+{
+	_ZBUS_ASSERT(chan != NULL, "chan is required");
+	_ZBUS_ASSERT(msg != NULL, "msg is required");
+
+	for (int i = 0; i < SEQLOCK_READ_RETRIES; ++i) {
+		atomic_val_t seq = atomic_get(&chan->data->seq);
+
+		if (seq & 1) {
+			continue;
+		}
+
+		memcpy(msg, chan->message, chan->message_size);
+
+		/* The copy must be complete before checking it was not overlapped by a write */
+		barrier_dmem_fence_full();
+
+		if (atomic_get(&chan->data->seq) == seq) {
+			return 0;
+		}
+	}
+
+	return zbus_chan_read(chan, msg, timeout);
+}
+
+#endif /* CONFIG_ZBUS_CHANNEL_SEQLOCK */
+
 int zbus_chan_notify(const struct zbus_channel *chan, k_timeout_t timeout)
 {
 	int err;
@@ -437,6 +566,9 @@ int zbus_chan_claim(const struct zbus_channel *chan, k_timeout_t timeout)
 		return err;
 	}
 
+	/* The claimer may change the message */
+	chan_write_begin(chan);
+
 	return 0;
 }
 
@@ -444,6 +576,8 @@ int zbus_chan_finish(const struct zbus_channel *chan)
 {
 	_ZBUS_ASSERT(chan != NULL, "chan is required");
 
+	chan_write_end(chan);
+
 	k_sem_give(&chan->data->sem);
 
 	return 0;
@@ -482,13 +616,36 @@ int zbus_sub_wait_msg(const struct zbus_observer *sub, const struct zbus_channel
 
 	*chan = *((struct zbus_channel **)net_buf_user_data(buf));
 
-	memcpy(msg, net_buf_remove_mem(buf, zbus_chan_msg_size(*chan)), zbus_chan_msg_size(*chan));
+	/* The buffer data may be shared with other subscribers */
+	memcpy(msg, buf->data, zbus_chan_msg_size(*chan));
 
 	net_buf_unref(buf);
 
 	return 0;
 }
 
+int zbus_sub_wait_msg_buf(const struct zbus_observer *sub, const struct zbus_channel **chan,
+			  struct net_buf **buf, k_timeout_t timeout)
+{
+	_ZBUS_ASSERT(!k_is_in_isr(), "zbus_sub_wait_msg_buf cannot be used inside ISRs");
+	_ZBUS_ASSERT(sub != NULL, "sub is required");
+	_ZBUS_ASSERT(sub->type == ZBUS_OBSERVER_MSG_SUBSCRIBER_TYPE,
+		     "sub must be a MSG_SUBSCRIBER");
+	_ZBUS_ASSERT(sub->message_fifo != NULL, "sub message_fifo is required");
+	_ZBUS_ASSERT(chan != NULL, "chan is required");
+	_ZBUS_ASSERT(buf != NULL, "buf is required");
+
+	*buf = net_buf_get(sub->message_fifo, timeout);
+
+	if (*buf == NULL) {
+		return -ENOMSG;
+	}
+
+	*chan = *((struct zbus_channel **)net_buf_user_data(*buf));
+
+	return 0;
+}
+
 #endif /* CONFIG_ZBUS_MSG_SUBSCRIBER */
 
 int zbus_obs_set_chan_notification_mask(const struct zbus_observer *obs,
@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/ztest.h>
+
+/* Only function_filtered_in is relocated, by the section filter */
+__noinline void function_filtered_in(void)
+{
+	printk("Address of %s %p\n", __func__, &function_filtered_in);
+}
+
+__noinline void function_filtered_out(void)
+{
+	printk("Address of %s %p\n", __func__, &function_filtered_out);
+}
+
+ZTEST(code_relocation, test_function_filter)
+{
+	extern uintptr_t __sram2_text_reloc_start;
+	extern uintptr_t __sram2_text_reloc_end;
+
+	function_filtered_in();
+	function_filtered_out();
+
+	zassert_between_inclusive((uintptr_t)&function_filtered_in,
+		(uintptr_t)&__sram2_text_reloc_start,
+		(uintptr_t)&__sram2_text_reloc_end,
+		"function_filtered_in not in sram2 region");
+	zassert_false(((uintptr_t)&function_filtered_out >=
+		       (uintptr_t)&__sram2_text_reloc_start) &&
+		      ((uintptr_t)&function_filtered_out <=
+		       (uintptr_t)&__sram2_text_reloc_end),
+		      "function_filtered_out in sram2 region");
+}
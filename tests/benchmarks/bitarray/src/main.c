@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/bitarray.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/timing/timing.h>
+
+#define NUM_BITS 65536
+#define ITERATIONS 64
+
+SYS_BITARRAY_DEFINE_STATIC(ba, NUM_BITS);
+
+/* Fill the array with runs of @a free_len free bits, each followed by
+ * @a used_len allocated bits, and leave @a tail_free bits free at its
+ * end. Allocating more than @a free_len bits then walks the whole array
+ * before finding room at its end.
+ */
+static void fill(size_t free_len, size_t used_len, size_t tail_free)
+{
+	(void)memset(ba.bundles, 0, ba.num_bundles * sizeof(ba.bundles[0]));
+
+	for (size_t bit = free_len; bit < (NUM_BITS - tail_free);
+	     bit += free_len + used_len) {
+		size_t len = MIN(used_len, NUM_BITS - tail_free - bit);
+
+		(void)sys_bitarray_set_region(&ba, len, bit);
+	}
+}
+
+static void run(const char *pattern, size_t num_bits)
+{
+	timing_t start, end;
+	uint64_t ns;
+	size_t offset;
+	int ret = 0;
+
+	start = timing_counter_get();
+	for (int i = 0; i < ITERATIONS; i++) {
+		ret = sys_bitarray_alloc(&ba, num_bits, &offset);
+		if (ret == 0) {
+			(void)sys_bitarray_free(&ba, num_bits, offset);
+		}
+	}
+	end = timing_counter_get();
+
+	ns = timing_cycles_to_ns(timing_cycles_get(&start, &end));
+	printk("alloc %-10s %5zu bits: %8u ns%s\n", pattern, num_bits,
+	       (uint32_t)(ns / ITERATIONS), (ret == 0) ? "" : " (no room)");
+}
+
+int main(void)
+{
+	static const size_t sizes[] = { 1, 8, 33, 256, 1024 };
+
+	timing_init();
+	timing_start();
+
+	/* Empty array, the first bits found free are used */
+	fill(NUM_BITS, 0, 0);
+	for (size_t i = 0; i < ARRAY_SIZE(sizes); i++) {
+		run("empty", sizes[i]);
+	}
+
+	/* Free runs too short for all but the smallest size, with room
+	 * left at the end of the array only
+	 */
+	fill(7, 1, 2048);
+	for (size_t i = 0; i < ARRAY_SIZE(sizes); i++) {
+		run("fragmented", sizes[i]);
+	}
+
+	/* Mostly allocated array, with one free bit out of 32 */
+	fill(1, 31, 2048);
+	for (size_t i = 0; i < ARRAY_SIZE(sizes); i++) {
+		run("sparse", sizes[i]);
+	}
+
+	timing_stop();
+
+	printk("fin\n");
+
+	return 0;
+}
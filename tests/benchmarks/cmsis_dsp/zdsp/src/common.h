@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_BENCHMARK_CMSIS_DSP_ZDSP_COMMON_H_
+#define ZEPHYR_BENCHMARK_CMSIS_DSP_ZDSP_COMMON_H_
+
+#include <zephyr/dsp/dsp.h>
+#include "../../common/benchmark_common.h"
+
+#define PATTERN_LENGTH	(256)
+
+/* The timings do not depend on the data, the patterns are pseudo-random */
+static inline void fill_f32(float32_t *buf, uint32_t len, uint32_t seed)
+{
+	for (uint32_t i = 0; i < len; i++) {
+		seed = seed * 1664525U + 1013904223U;
+		buf[i] = (float32_t)(int32_t)seed / 4294967296.0f;
+	}
+}
+
+static inline void fill_q15(q15_t *buf, uint32_t len, uint32_t seed)
+{
+	for (uint32_t i = 0; i < len; i++) {
+		seed = seed * 1664525U + 1013904223U;
+		/* Keep some headroom for the accumulations */
+		buf[i] = (q15_t)((int32_t)seed >> 18);
+	}
+}
+
+#endif /* ZEPHYR_BENCHMARK_CMSIS_DSP_ZDSP_COMMON_H_ */
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <string.h>
+#include "common.h"
+
+#define NUM_TAPS	(32)
+#define NUM_STAGES	(4)
+
+static float32_t input_f32[PATTERN_LENGTH];
+static float32_t output_f32[PATTERN_LENGTH];
+static float32_t coeffs_f32[NUM_TAPS];
+static float32_t state_f32[NUM_TAPS + PATTERN_LENGTH - 1];
+static q15_t input_q15[PATTERN_LENGTH];
+static q15_t output_q15[PATTERN_LENGTH];
+static q15_t coeffs_q15[NUM_TAPS];
+static q15_t state_q15[NUM_TAPS + PATTERN_LENGTH - 1];
+
+/* A stable low-pass section, {b0, b1, b2, a1, a2} */
+static const float32_t biquad_f32[5] = {
+	0.0675f, 0.1349f, 0.0675f, 1.1430f, -0.4128f,
+};
+
+/* The same section in Q15 with a post shift of 1, {b0, 0, b1, b2, a1, a2} */
+static const q15_t biquad_q15[6] = {
+	1106, 0, 2210, 1106, 18727, -6763,
+};
+
+ZTEST(zdsp_filtering_benchmark, test_benchmark_fir_f32)
+{
+	struct zdsp_fir_instance_f32 inst;
+	uint32_t irq_key, timestamp, timespan;
+
+	fill_f32(coeffs_f32, NUM_TAPS, 1);
+	fill_f32(input_f32, PATTERN_LENGTH, 2);
+	zdsp_fir_init_f32(&inst, NUM_TAPS, coeffs_f32, state_f32, PATTERN_LENGTH);
+
+	benchmark_begin(&irq_key, &timestamp);
+	zdsp_fir_f32(&inst, input_f32, output_f32, PATTERN_LENGTH);
+	timespan = benchmark_end(irq_key, timestamp);
+
+	TC_PRINT(BENCHMARK_TYPE " = %u\n", timespan);
+}
+
+ZTEST(zdsp_filtering_benchmark, test_benchmark_fir_q15)
+{
+	struct zdsp_fir_instance_q15 inst;
+	uint32_t irq_key, timestamp, timespan;
+
+	fill_q15(coeffs_q15, NUM_TAPS, 3);
+	fill_q15(input_q15, PATTERN_LENGTH, 4);
+	zassert_ok(zdsp_fir_init_q15(&inst, NUM_TAPS, coeffs_q15, state_q15, PATTERN_LENGTH));
+
+	benchmark_begin(&irq_key, &timestamp);
+	zdsp_fir_q15(&inst, input_q15, output_q15, PATTERN_LENGTH);
+	timespan = benchmark_end(irq_key, timestamp);
+
+	TC_PRINT(BENCHMARK_TYPE " = %u\n", timespan);
+}
+
+ZTEST(zdsp_filtering_benchmark, test_benchmark_biquad_df1_f32)
+{
+	struct zdsp_biquad_df1_instance_f32 inst;
+	float32_t coeffs[5 * NUM_STAGES];
+	float32_t state[4 * NUM_STAGES];
+	uint32_t irq_key, timestamp, timespan;
+
+	for (int i = 0; i < NUM_STAGES; i++) {
+		memcpy(&coeffs[5 * i], biquad_f32, sizeof(biquad_f32));
+	}
+	fill_f32(input_f32, PATTERN_LENGTH, 5);
+	zdsp_biquad_df1_init_f32(&inst, NUM_STAGES, coeffs, state);
+
+	benchmark_begin(&irq_key, &timestamp);
+	zdsp_biquad_df1_f32(&inst, input_f32, output_f32, PATTERN_LENGTH);
+	timespan = benchmark_end(irq_key, timestamp);
+
+	TC_PRINT(BENCHMARK_TYPE " = %u\n", timespan);
+}
+
+ZTEST(zdsp_filtering_benchmark, test_benchmark_biquad_df1_q15)
+{
+	struct zdsp_biquad_df1_instance_q15 inst;
+	q15_t coeffs[6 * NUM_STAGES];
+	q15_t state[4 * NUM_STAGES];
+	uint32_t irq_key, timestamp, timespan;
+
+	for (int i = 0; i < NUM_STAGES; i++) {
+		memcpy(&coeffs[6 * i], biquad_q15, sizeof(biquad_q15));
+	}
+	fill_q15(input_q15, PATTERN_LENGTH, 6);
+	zdsp_biquad_df1_init_q15(&inst, NUM_STAGES, coeffs, state, 1);
+
+	benchmark_begin(&irq_key, &timestamp);
+	zdsp_biquad_df1_q15(&inst, input_q15, output_q15, PATTERN_LENGTH);
+	timespan = benchmark_end(irq_key, timestamp);
+
+	TC_PRINT(BENCHMARK_TYPE " = %u\n", timespan);
+}
+
+ZTEST(zdsp_filtering_benchmark, test_benchmark_biquad_df2t_f32)
+{
+	struct zdsp_biquad_df2t_instance_f32 inst;
+	float32_t coeffs[5 * NUM_STAGES];
+	float32_t state[2 * NUM_STAGES];
+	uint32_t irq_key, timestamp, timespan;
+
+	for (int i = 0; i < NUM_STAGES; i++) {
+		memcpy(&coeffs[5 * i], biquad_f32, sizeof(biquad_f32));
+	}
+	fill_f32(input_f32, PATTERN_LENGTH, 7);
+	zdsp_biquad_df2t_init_f32(&inst, NUM_STAGES, coeffs, state);
+
+	benchmark_begin(&irq_key, &timestamp);
+	zdsp_biquad_df2t_f32(&inst, input_f32, output_f32, PATTERN_LENGTH);
+	timespan = benchmark_end(irq_key, timestamp);
+
+	TC_PRINT(BENCHMARK_TYPE " = %u\n", timespan);
+}
+
+ZTEST_SUITE(zdsp_filtering_benchmark, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include "common.h"
+
+#define DIM	(16)
+
+static float32_t data_a[DIM * DIM];
+static float32_t data_b[DIM * DIM];
+static float32_t data_dst[DIM * DIM];
+
+static struct zdsp_matrix_f32 mat_a = ZDSP_MATRIX_F32_INIT(DIM, DIM, data_a);
+static struct zdsp_matrix_f32 mat_b = ZDSP_MATRIX_F32_INIT(DIM, DIM, data_b);
+static struct zdsp_matrix_f32 mat_dst = ZDSP_MATRIX_F32_INIT(DIM, DIM, data_dst);
+
+static void matrix_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	fill_f32(data_a, DIM * DIM, 1);
+	fill_f32(data_b, DIM * DIM, 2);
+
+	/* Diagonally dominant, hence not singular */
+	for (int i = 0; i < DIM; i++) {
+		data_a[i * DIM + i] += (float32_t)DIM;
+	}
+}
+
+ZTEST(zdsp_matrix_benchmark, test_benchmark_mat_add_f32)
+{
+	uint32_t irq_key, timestamp, timespan;
+	int ret;
+
+	benchmark_begin(&irq_key, &timestamp);
+	ret = zdsp_mat_add_f32(&mat_a, &mat_b, &mat_dst);
+	timespan = benchmark_end(irq_key, timestamp);
+
+	zassert_ok(ret);
+	TC_PRINT(BENCHMARK_TYPE " = %u\n", timespan);
+}
+
+ZTEST(zdsp_matrix_benchmark, test_benchmark_mat_mult_f32)
+{
+	uint32_t irq_key, timestamp, timespan;
+	int ret;
+
+	benchmark_begin(&irq_key, &timestamp);
+	ret = zdsp_mat_mult_f32(&mat_a, &mat_b, &mat_dst);
+	timespan = benchmark_end(irq_key, timestamp);
+
+	zassert_ok(ret);
+	TC_PRINT(BENCHMARK_TYPE " = %u\n", timespan);
+}
+
+ZTEST(zdsp_matrix_benchmark, test_benchmark_mat_scale_f32)
+{
+	uint32_t irq_key, timestamp, timespan;
+	int ret;
+
+	benchmark_begin(&irq_key, &timestamp);
+	ret = zdsp_mat_scale_f32(&mat_a, 0.5f, &mat_dst);
+	timespan = benchmark_end(irq_key, timestamp);
+
+	zassert_ok(ret);
+	TC_PRINT(BENCHMARK_TYPE " = %u\n", timespan);
+}
+
+ZTEST(zdsp_matrix_benchmark, test_benchmark_mat_trans_f32)
+{
+	uint32_t irq_key, timestamp, timespan;
+	int ret;
+
+	benchmark_begin(&irq_key, &timestamp);
+	ret = zdsp_mat_trans_f32(&mat_a, &mat_dst);
+	timespan = benchmark_end(irq_key, timestamp);
+
+	zassert_ok(ret);
+	TC_PRINT(BENCHMARK_TYPE " = %u\n", timespan);
+}
+
+ZTEST(zdsp_matrix_benchmark, test_benchmark_mat_inverse_f32)
+{
+	uint32_t irq_key, timestamp, timespan;
+	int ret;
+
+	benchmark_begin(&irq_key, &timestamp);
+	ret = zdsp_mat_inverse_f32(&mat_a, &mat_dst);
+	timespan = benchmark_end(irq_key, timestamp);
+
+	zassert_ok(ret);
+	TC_PRINT(BENCHMARK_TYPE " = %u\n", timespan);
+}
+
+ZTEST(zdsp_matrix_benchmark, test_mat_dims_checked)
+{
+	struct zdsp_matrix_f32 row = ZDSP_MATRIX_F32_INIT(1, DIM, data_b);
+
+	zassert_equal(zdsp_mat_add_f32(&mat_a, &row, &mat_dst), -EINVAL);
+	zassert_equal(zdsp_mat_mult_f32(&row, &mat_a, &mat_dst), -EINVAL);
+	zassert_equal(zdsp_mat_inverse_f32(&row, &mat_dst), -EINVAL);
+}
+
+ZTEST_SUITE(zdsp_matrix_benchmark, NULL, NULL, matrix_before, NULL, NULL);
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include "common.h"
+
+static float32_t input_f32[PATTERN_LENGTH];
+static q15_t input_q15[PATTERN_LENGTH];
+
+static void *statistics_setup(void)
+{
+	fill_f32(input_f32, PATTERN_LENGTH, 1);
+	fill_q15(input_q15, PATTERN_LENGTH, 2);
+
+	return NULL;
+}
+
+#define DEFINE_REDUCTION_BENCHMARK(fn, sfx, type)                                                  \
+	ZTEST(zdsp_statistics_benchmark, test_benchmark_##fn##_##sfx)                              \
+	{                                                                                          \
+		uint32_t irq_key, timestamp, timespan;                                             \
+		type result;                                                                       \
+                                                                                                   \
+		benchmark_begin(&irq_key, &timestamp);                                             \
+		zdsp_##fn##_##sfx(input_##sfx, PATTERN_LENGTH, &result);                           \
+		timespan = benchmark_end(irq_key, timestamp);                                      \
+                                                                                                   \
+		TC_PRINT(BENCHMARK_TYPE " = %u\n", timespan);                                      \
+	}
+
+#define DEFINE_SEARCH_BENCHMARK(fn, sfx, type)                                                     \
+	ZTEST(zdsp_statistics_benchmark, test_benchmark_##fn##_##sfx)                              \
+	{                                                                                          \
+		uint32_t irq_key, timestamp, timespan;                                             \
+		type result;                                                                       \
+		uint32_t index;                                                                    \
+                                                                                                   \
+		benchmark_begin(&irq_key, &timestamp);                                             \
+		zdsp_##fn##_##sfx(input_##sfx, PATTERN_LENGTH, &result, &index);                   \
+		timespan = benchmark_end(irq_key, timestamp);                                      \
+                                                                                                   \
+		TC_PRINT(BENCHMARK_TYPE " = %u\n", timespan);                                      \
+	}
+
+DEFINE_REDUCTION_BENCHMARK(mean, f32, float32_t)
+DEFINE_REDUCTION_BENCHMARK(rms, f32, float32_t)
+DEFINE_REDUCTION_BENCHMARK(var, f32, float32_t)
+DEFINE_REDUCTION_BENCHMARK(std, f32, float32_t)
+DEFINE_SEARCH_BENCHMARK(max, f32, float32_t)
+DEFINE_SEARCH_BENCHMARK(min, f32, float32_t)
+
+DEFINE_REDUCTION_BENCHMARK(mean, q15, q15_t)
+DEFINE_REDUCTION_BENCHMARK(rms, q15, q15_t)
+DEFINE_REDUCTION_BENCHMARK(var, q15, q15_t)
+DEFINE_REDUCTION_BENCHMARK(std, q15, q15_t)
+DEFINE_SEARCH_BENCHMARK(max, q15, q15_t)
+DEFINE_SEARCH_BENCHMARK(min, q15, q15_t)
+
+ZTEST_SUITE(zdsp_statistics_benchmark, NULL, statistics_setup, NULL, NULL, NULL);
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include "common.h"
+
+static float32_t input_f32[2 * PATTERN_LENGTH];
+static float32_t output_f32[PATTERN_LENGTH];
+static q15_t input_q15[2 * PATTERN_LENGTH];
+static q15_t output_q15[2 * PATTERN_LENGTH];
+
+ZTEST(zdsp_transform_benchmark, test_benchmark_rfft_f32)
+{
+	struct zdsp_rfft_instance_f32 inst;
+	uint32_t irq_key, timestamp, timespan;
+
+	zassert_ok(zdsp_rfft_init_f32(&inst, PATTERN_LENGTH));
+	fill_f32(input_f32, PATTERN_LENGTH, 1);
+
+	benchmark_begin(&irq_key, &timestamp);
+	zdsp_rfft_f32(&inst, input_f32, output_f32, false);
+	timespan = benchmark_end(irq_key, timestamp);
+
+	TC_PRINT(BENCHMARK_TYPE " = %u\n", timespan);
+}
+
+ZTEST(zdsp_transform_benchmark, test_benchmark_cfft_f32)
+{
+	struct zdsp_cfft_instance_f32 inst;
+	uint32_t irq_key, timestamp, timespan;
+
+	zassert_ok(zdsp_cfft_init_f32(&inst, PATTERN_LENGTH));
+	fill_f32(input_f32, 2 * PATTERN_LENGTH, 2);
+
+	benchmark_begin(&irq_key, &timestamp);
+	zdsp_cfft_f32(&inst, input_f32, false);
+	timespan = benchmark_end(irq_key, timestamp);
+
+	TC_PRINT(BENCHMARK_TYPE " = %u\n", timespan);
+}
+
+ZTEST(zdsp_transform_benchmark, test_benchmark_rfft_q15)
+{
+	struct zdsp_rfft_instance_q15 inst;
+	uint32_t irq_key, timestamp, timespan;
+
+	zassert_ok(zdsp_rfft_init_q15(&inst, PATTERN_LENGTH, false));
+	fill_q15(input_q15, PATTERN_LENGTH, 3);
+
+	benchmark_begin(&irq_key, &timestamp);
+	zdsp_rfft_q15(&inst, input_q15, output_q15);
+	timespan = benchmark_end(irq_key, timestamp);
+
+	TC_PRINT(BENCHMARK_TYPE " = %u\n", timespan);
+}
+
+ZTEST(zdsp_transform_benchmark, test_benchmark_cfft_q15)
+{
+	struct zdsp_cfft_instance_q15 inst;
+	uint32_t irq_key, timestamp, timespan;
+
+	zassert_ok(zdsp_cfft_init_q15(&inst, PATTERN_LENGTH));
+	fill_q15(input_q15, 2 * PATTERN_LENGTH, 4);
+
+	benchmark_begin(&irq_key, &timestamp);
+	zdsp_cfft_q15(&inst, input_q15, false);
+	timespan = benchmark_end(irq_key, timestamp);
+
+	TC_PRINT(BENCHMARK_TYPE " = %u\n", timespan);
+}
+
+ZTEST_SUITE(zdsp_transform_benchmark, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/hash_map.h>
+#include <zephyr/ztest.h>
+
+#define N_ENTRIES 2048
+
+SYS_HASHMAP_SC_DEFINE_STATIC(sc_map);
+SYS_HASHMAP_OA_LP_DEFINE_STATIC(oa_lp_map);
+SYS_HASHMAP_OA_GP_DEFINE_STATIC(oa_gp_map);
+
+/* Spread the keys out, but keep them reproducible */
+static uint64_t key_of(size_t i)
+{
+	return (uint64_t)i * 2654435761ULL;
+}
+
+static uint32_t cycles_per_op(uint32_t start, size_t count)
+{
+	return (k_cycle_get_32() - start) / count;
+}
+
+static void bench_hashmap(const char *name, struct sys_hashmap *map)
+{
+	uint32_t start;
+	uint32_t insert, hit, miss, remove;
+	uint64_t value;
+
+	start = k_cycle_get_32();
+	for (size_t i = 0; i < N_ENTRIES; ++i) {
+		zassert_equal(sys_hashmap_insert(map, key_of(i), i, NULL), 1);
+	}
+	insert = cycles_per_op(start, N_ENTRIES);
+
+	start = k_cycle_get_32();
+	for (size_t i = 0; i < N_ENTRIES; ++i) {
+		zassert_true(sys_hashmap_get(map, key_of(i), &value));
+	}
+	hit = cycles_per_op(start, N_ENTRIES);
+
+	start = k_cycle_get_32();
+	for (size_t i = N_ENTRIES; i < 2 * N_ENTRIES; ++i) {
+		zassert_false(sys_hashmap_get(map, key_of(i), &value));
+	}
+	miss = cycles_per_op(start, N_ENTRIES);
+
+	start = k_cycle_get_32();
+	for (size_t i = 0; i < N_ENTRIES; ++i) {
+		zassert_true(sys_hashmap_remove(map, key_of(i), NULL));
+	}
+	remove = cycles_per_op(start, N_ENTRIES);
+
+	zassert_true(sys_hashmap_is_empty(map));
+
+	TC_PRINT("%-6s cycles/op: insert %u, get hit %u, get miss %u, remove %u\n",
+		 name, insert, hit, miss, remove);
+}
+
+/**
+ * @brief Compare the Hashmap implementations
+ *
+ * @details Inserts, looks up, misses and removes the same keys in each
+ * implementation, and prints the average number of cycles of each
+ * operation.
+ */
+ZTEST(hash_map_perf, test_hash_map_perf)
+{
+	bench_hashmap("sc", &sc_map);
+	bench_hashmap("oa_lp", &oa_lp_map);
+	bench_hashmap("oa_gp", &oa_gp_map);
+}
+
+ZTEST_SUITE(hash_map_perf, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <inttypes.h>
+#include <zephyr/kernel.h>
+#include <zephyr/rtio/rtio.h>
+#include <zephyr/storage/disk_access.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/timing/timing.h>
+
+/* Reads of REQ_SECTORS sectors spread over the disk, first one at a time
+ * with disk_access_read(), then queued over RTIO keeping up to depth
+ * requests in flight.
+ */
+
+#if defined(CONFIG_NVME)
+#define DISK_NAME "nvme0n0"
+#else
+#define DISK_NAME "RAM"
+#endif
+
+#define SECTOR_SIZE 512
+#define REQ_SECTORS 8
+#define REQ_COUNT 1024
+#define MAX_DEPTH 16
+
+/* Two submission queue entries per request */
+RTIO_DEFINE(disk_rtio, 2 * MAX_DEPTH, MAX_DEPTH);
+DISK_ACCESS_IODEV_DEFINE(disk_iodev, DISK_NAME);
+
+static uint8_t bufs[MAX_DEPTH][REQ_SECTORS * SECTOR_SIZE] __aligned(4);
+static uint32_t req_slots;
+
+static uint32_t req_sector(uint32_t i)
+{
+	return ((i * 7919U) % req_slots) * REQ_SECTORS;
+}
+
+static void report(const char *name, int depth, timing_t *start, timing_t *end)
+{
+	uint64_t us = timing_cycles_to_ns(timing_cycles_get(start, end)) / NSEC_PER_USEC;
+
+	printk("%s depth %2d: %u requests in %" PRIu64 " us (%" PRIu64 " IOPS)\n",
+	       name, depth, REQ_COUNT, us,
+	       (us > 0) ? ((uint64_t)REQ_COUNT * USEC_PER_SEC) / us : 0);
+}
+
+static int bench_sync(void)
+{
+	timing_t start, end;
+	int rc;
+
+	start = timing_counter_get();
+	for (uint32_t i = 0; i < REQ_COUNT; i++) {
+		rc = disk_access_read(DISK_NAME, bufs[0], req_sector(i), REQ_SECTORS);
+		if (rc != 0) {
+			return rc;
+		}
+	}
+	end = timing_counter_get();
+
+	report("sync", 1, &start, &end);
+
+	return 0;
+}
+
+static int bench_rtio(int depth)
+{
+	uintptr_t free_slots[MAX_DEPTH];
+	uint32_t submitted = 0;
+	uint32_t completed = 0;
+	int nfree = depth;
+	timing_t start, end;
+	struct rtio_cqe *cqe;
+	int rc = 0;
+
+	for (int i = 0; i < depth; i++) {
+		free_slots[i] = i;
+	}
+
+	start = timing_counter_get();
+	while (completed < REQ_COUNT) {
+		/* Top up the queue, then wait for one completion */
+		while ((submitted < REQ_COUNT) && (nfree > 0)) {
+			uintptr_t slot = free_slots[--nfree];
+
+			if (disk_access_rtio_read(&disk_rtio, &disk_iodev, bufs[slot],
+						  req_sector(submitted), REQ_SECTORS,
+						  (void *)slot) == NULL) {
+				return -ENOMEM;
+			}
+			submitted++;
+		}
+		rtio_submit(&disk_rtio, 0);
+
+		cqe = rtio_cqe_consume_block(&disk_rtio);
+		if (cqe->result < 0) {
+			rc = cqe->result;
+		}
+		free_slots[nfree++] = (uintptr_t)cqe->userdata;
+		rtio_cqe_release(&disk_rtio, cqe);
+		completed++;
+	}
+	end = timing_counter_get();
+
+	if (rc == 0) {
+		report("rtio", depth, &start, &end);
+	}
+
+	return rc;
+}
+
+int main(void)
+{
+	static const int depths[] = {1, 4, MAX_DEPTH};
+	uint32_t sector_count;
+	uint32_t sector_size;
+	int rc;
+
+	rc = disk_access_init(DISK_NAME);
+	if (rc == 0) {
+		rc = disk_access_ioctl(DISK_NAME, DISK_IOCTL_GET_SECTOR_COUNT, &sector_count);
+	}
+	if (rc == 0) {
+		rc = disk_access_ioctl(DISK_NAME, DISK_IOCTL_GET_SECTOR_SIZE, &sector_size);
+	}
+	if ((rc != 0) || (sector_size != SECTOR_SIZE) || (sector_count < REQ_SECTORS)) {
+		printk("disk %s not usable (%d)\n", DISK_NAME, rc);
+		return 0;
+	}
+
+	req_slots = sector_count / REQ_SECTORS;
+
+	timing_init();
+	timing_start();
+
+	rc = bench_sync();
+	for (int i = 0; (rc == 0) && (i < ARRAY_SIZE(depths)); i++) {
+		rc = bench_rtio(depths[i]);
+	}
+
+	timing_stop();
+
+	if (rc != 0) {
+		printk("benchmark failed (%d)\n", rc);
+		return 0;
+	}
+
+	printk("fin\n");
+
+	return 0;
+}
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * This file contains the benchmarking code that measures the average time it
+ * takes to switch between two fibers of the same thread using
+ * k_fiber_yield(), to compare with switching between threads using
+ * k_yield().
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/kernel/fiber.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/timestamp.h>
+
+#include "utils.h"
+#include "timing_sc.h"
+
+#ifdef CONFIG_FIBER
+
+#define FIBER_STACK_SIZE (512 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+static K_KERNEL_STACK_DEFINE(start_fiber_stack, FIBER_STACK_SIZE);
+static K_KERNEL_STACK_DEFINE(alt_fiber_stack, FIBER_STACK_SIZE);
+
+static struct k_fiber start_fiber;
+static struct k_fiber alt_fiber;
+
+K_FIBER_HOST_DEFINE(bench_fiber_host, 1);
+
+static void alt_fiber_entry(void *p1, void *p2, void *p3)
+{
+	uint32_t  num_iterations;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	num_iterations = (uint32_t)(uintptr_t)p1;
+
+	for (uint32_t i = 0; i < num_iterations; i++) {
+
+		/* 3. Obtain the 'finish' timestamp */
+
+		timestamp.sample = timing_timestamp_get();
+
+		/* 4. Switch to <start_fiber>  */
+
+		k_fiber_yield();
+	}
+}
+
+static void start_fiber_entry(void *p1, void *p2, void *p3)
+{
+	uint64_t  sum = 0ull;
+	uint32_t  num_iterations;
+	timing_t  start;
+	timing_t  finish;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	num_iterations = (uint32_t)(uintptr_t)p1;
+
+	for (uint32_t i = 0; i < num_iterations; i++) {
+
+		/* 1. Get 'start' timestamp */
+
+		start = timing_timestamp_get();
+
+		/* 2. Switch to <alt_fiber> */
+
+		k_fiber_yield();
+
+		/* 5. Get the 'finish' timestamp obtained in <alt_fiber> */
+
+		finish = timestamp.sample;
+
+		/* 6. Track the sum of elapsed times */
+
+		sum += timing_cycles_get(&start, &finish);
+	}
+
+	/* Record the number of cycles for use by the main thread */
+
+	timestamp.cycles = sum;
+}
+
+void fiber_switch_yield(uint32_t num_iterations)
+{
+	uint64_t  sum;
+	char summary[120];
+
+	/* Create the two fibers, <start_fiber> runs first */
+
+	k_fiber_create(&bench_fiber_host, &start_fiber, start_fiber_stack,
+		       K_KERNEL_STACK_SIZEOF(start_fiber_stack),
+		       start_fiber_entry, (void *)(uintptr_t)num_iterations,
+		       NULL, NULL);
+
+	k_fiber_create(&bench_fiber_host, &alt_fiber, alt_fiber_stack,
+		       K_KERNEL_STACK_SIZEOF(alt_fiber_stack),
+		       alt_fiber_entry, (void *)(uintptr_t)num_iterations,
+		       NULL, NULL);
+
+	/* Run them until both are done */
+
+	k_fiber_host_run(&bench_fiber_host);
+
+	/* Get the sum total of measured cycles */
+
+	sum = timestamp.cycles;
+
+	sum -= timestamp_overhead_adjustment(0, 0);
+
+	snprintf(summary, sizeof(summary),
+		 "%-40s - Context switch via k_fiber_yield",
+		 "fiber.yield.ctx");
+	PRINT_STATS_AVG(summary, (uint32_t)sum, num_iterations, 0, "");
+}
+
+#endif /* CONFIG_FIBER */
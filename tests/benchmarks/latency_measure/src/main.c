@@ -37,7 +37,9 @@ struct k_thread  alt_thread;
 int error_count; /* track number of errors */
 
 extern void thread_switch_yield(uint32_t num_iterations, bool is_cooperative);
+extern void fiber_switch_yield(uint32_t num_iterations);
 extern void int_to_thread(uint32_t num_iterations);
+extern int multilevel_isr(uint32_t num_iterations);
 extern void sema_test_signal(uint32_t num_iterations, uint32_t options);
 extern void mutex_lock_unlock(uint32_t num_iterations, uint32_t options);
 extern void sema_context_switch(uint32_t num_iterations,
@@ -85,8 +87,18 @@ static void test_thread(void *arg1, void *arg2, void *arg3)
 	/* Cooperative threads context switching */
 	thread_switch_yield(CONFIG_BENCHMARK_NUM_ITERATIONS, true);
 
+#ifdef CONFIG_FIBER
+	/* Fibers context switching, to compare with the above */
+	fiber_switch_yield(CONFIG_BENCHMARK_NUM_ITERATIONS);
+#endif
+
 	int_to_thread(CONFIG_BENCHMARK_NUM_ITERATIONS);
 
+#if defined(CONFIG_MULTI_LEVEL_INTERRUPTS) && defined(CONFIG_DYNAMIC_INTERRUPTS)
+	/* Dispatch of interrupts behind an aggregator */
+	multilevel_isr(CONFIG_BENCHMARK_NUM_ITERATIONS);
+#endif
+
 	/* Thread creation, starting, suspending, resuming and aborting. */
 
 	thread_ops(CONFIG_BENCHMARK_NUM_ITERATIONS, 0, 0);
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ *
+ * @brief Measure the dispatch of a 2nd level interrupt
+ *
+ * An aggregator ISR calls the ISR of its asserted local IRQ from the
+ * _sw_isr_table. This file compares the time from the aggregator ISR to the
+ * local ISR when:
+ *  1. the table index is computed from the IRQ for each interrupt
+ *  2. the entries of the aggregator were looked up beforehand
+ *
+ * The aggregator ISR is run with irq_offload(), and the entry of the last
+ * local IRQ of the first aggregator is temporarily replaced.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/irq.h>
+#include <zephyr/irq_offload.h>
+#include <zephyr/sw_isr_table.h>
+#include "sw_isr_common.h"
+#include "utils.h"
+#include "timing_sc.h"
+
+#define TEST_LOCAL_IRQ (CONFIG_MAX_IRQ_PER_AGGREGATOR - 1)
+#define TEST_IRQ       (irq_to_level_2(TEST_LOCAL_IRQ) | CONFIG_2ND_LVL_INTR_00_OFFSET)
+
+static struct _isr_table_entry *aggregator_table;
+static timing_t aggregator_start;
+
+static void local_isr(const void *arg)
+{
+	ARG_UNUSED(arg);
+
+	timestamp.sample = timing_timestamp_get();
+}
+
+static void lookup_aggregator_isr(const void *arg)
+{
+	struct _isr_table_entry *ite;
+	uint32_t irq = POINTER_TO_UINT(arg);
+
+	aggregator_start = timing_timestamp_get();
+
+	ite = &_sw_isr_table[z_get_sw_isr_table_idx(irq)];
+	ite->isr(ite->arg);
+}
+
+static void direct_aggregator_isr(const void *arg)
+{
+	struct _isr_table_entry *ite;
+	uint32_t local_irq = POINTER_TO_UINT(arg);
+
+	aggregator_start = timing_timestamp_get();
+
+	ite = &aggregator_table[local_irq];
+	ite->isr(ite->arg);
+}
+
+static uint64_t dispatch(uint32_t num_iterations, void (*aggregator_isr)(const void *),
+			 uint32_t irq)
+{
+	uint64_t sum = 0ull;
+	timing_t start;
+	timing_t finish;
+
+	for (uint32_t i = 0; i < num_iterations; i++) {
+		irq_offload(aggregator_isr, UINT_TO_POINTER(irq));
+		start = aggregator_start;
+		finish = timestamp.sample;
+
+		sum += timing_cycles_get(&start, &finish);
+	}
+
+	return sum;
+}
+
+/**
+ * @brief The test main function
+ *
+ * @return 0 on success
+ */
+int multilevel_isr(uint32_t num_iterations)
+{
+	struct _isr_table_entry *ite;
+	struct _isr_table_entry saved;
+	uint64_t sum;
+	char description[120];
+
+	/* What an aggregator driver computes at initialization */
+	aggregator_table = &_sw_isr_table[z_get_sw_isr_table_idx(TEST_IRQ) - TEST_LOCAL_IRQ];
+
+	ite = &_sw_isr_table[z_get_sw_isr_table_idx(TEST_IRQ)];
+	saved = *ite;
+	ite->isr = local_isr;
+	ite->arg = NULL;
+
+	timing_start();
+	TICK_SYNCH();
+
+	sum = dispatch(num_iterations, lookup_aggregator_isr, TEST_IRQ);
+
+	sum -= timestamp_overhead_adjustment(0, 0);
+
+	snprintf(description, sizeof(description),
+		 "%-40s - Dispatch 2nd level ISR, table index lookup",
+		 "isr.dispatch.level2.lookup");
+	PRINT_STATS_AVG(description, (uint32_t)sum, num_iterations, false, "");
+
+	sum = dispatch(num_iterations, direct_aggregator_isr, TEST_LOCAL_IRQ);
+
+	sum -= timestamp_overhead_adjustment(0, 0);
+
+	snprintf(description, sizeof(description),
+		 "%-40s - Dispatch 2nd level ISR, aggregator entries",
+		 "isr.dispatch.level2.direct");
+	PRINT_STATS_AVG(description, (uint32_t)sum, num_iterations, false, "");
+
+	timing_stop();
+
+	*ite = saved;
+
+	return 0;
+}
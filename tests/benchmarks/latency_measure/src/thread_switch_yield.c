@@ -10,21 +10,28 @@
  * This file contains the benchmarking code that measures the average time it
  * takes to perform context switches between threads using k_yield().
  *
- * When user threads are supported, there are four cases to consider. These are
+ * When user threads are supported, there are five cases to consider. These are
  *   1. Kernel thread -> Kernel thread
  *   2. User thread   -> User thread
  *   3. Kernel thread -> User thread
  *   4. User thread   -> Kernel thread
+ *   5. User thread   -> User thread in another memory domain
  */
 
 #include <zephyr/kernel.h>
 #include <zephyr/timing/timing.h>
 #include <stdlib.h>
 #include <zephyr/timestamp.h>
+#include <zephyr/sys/libc-hooks.h>
 
 #include "utils.h"
 #include "timing_sc.h"
 
+#ifdef CONFIG_USERSPACE
+/* Memory domain of <alt_thread> when switching between memory domains */
+static struct k_mem_domain alt_domain;
+#endif
+
 static void alt_thread_entry(void *p1, void *p2, void *p3)
 {
 	uint32_t  num_iterations;
@@ -93,7 +100,7 @@ static void thread_switch_yield_common(const char *description,
 				       uint32_t num_iterations,
 				       uint32_t start_options,
 				       uint32_t alt_options,
-				       int priority)
+				       int priority, bool other_domain)
 {
 	uint64_t  sum;
 	char tag[50];
@@ -119,6 +126,12 @@ static void thread_switch_yield_common(const char *description,
 		k_thread_access_grant(&start_thread, &alt_thread);
 	}
 
+#ifdef CONFIG_USERSPACE
+	if (other_domain) {
+		k_mem_domain_add_thread(&alt_domain, &alt_thread);
+	}
+#endif
+
 	k_thread_start(&start_thread);
 
 	/* Wait until <start_thread> finishes */
@@ -132,11 +145,13 @@ static void thread_switch_yield_common(const char *description,
 	sum -= timestamp_overhead_adjustment(start_options, alt_options);
 
 	snprintf(tag, sizeof(tag),
-		 "%s.%c_to_%c", description,
+		 "%s.%c_to_%c%s", description,
 		 (start_options & K_USER) == K_USER ? 'u' : 'k',
-		 (alt_options & K_USER) == K_USER ? 'u' : 'k');
+		 (alt_options & K_USER) == K_USER ? 'u' : 'k',
+		 other_domain ? ".xdom" : "");
 	snprintf(summary, sizeof(summary),
-		 "%-40s - Context switch via k_yield", tag);
+		 "%-40s - Context switch via k_yield%s", tag,
+		 other_domain ? " across domains" : "");
 
 	PRINT_STATS_AVG(summary, (uint32_t)sum, num_iterations, 0, "");
 }
@@ -146,6 +161,21 @@ void thread_switch_yield(uint32_t num_iterations, bool is_cooperative)
 	int  priority;
 	char description[40];
 
+#ifdef CONFIG_USERSPACE
+	static bool alt_domain_ready;
+	struct k_mem_partition *alt_parts[] = {
+#if Z_LIBC_PARTITION_EXISTS
+		&z_libc_partition,
+#endif
+		&bench_mem_partition,
+	};
+
+	if (!alt_domain_ready) {
+		k_mem_domain_init(&alt_domain, ARRAY_SIZE(alt_parts), alt_parts);
+		alt_domain_ready = true;
+	}
+#endif
+
 	priority = is_cooperative ? K_PRIO_COOP(6)
 				  : k_thread_priority_get(k_current_get()) - 1;
 
@@ -155,19 +185,23 @@ void thread_switch_yield(uint32_t num_iterations, bool is_cooperative)
 
 	/* Kernel -> Kernel */
 	thread_switch_yield_common(description, num_iterations, 0, 0,
-				   priority);
+				   priority, false);
 
 #if CONFIG_USERSPACE
 	/* User   -> User   */
 	thread_switch_yield_common(description, num_iterations, K_USER, K_USER,
-				   priority);
+				   priority, false);
 
 	/* Kernel -> User   */
 	thread_switch_yield_common(description, num_iterations, 0, K_USER,
-				   priority);
+				   priority, false);
 
 	/* User   -> Kernel */
 	thread_switch_yield_common(description, num_iterations, K_USER, 0,
-				   priority);
+				   priority, false);
+
+	/* User   -> User in another memory domain */
+	thread_switch_yield_common(description, num_iterations, K_USER, K_USER,
+				   priority, true);
 #endif
 }
@@ -22,6 +22,7 @@
 
 #ifdef CONFIG_USERSPACE
 #define  BENCH_BMEM  K_APP_BMEM(bench_mem_partition)
+extern struct k_mem_partition bench_mem_partition;
 #else
 #define  BENCH_BMEM
 #endif
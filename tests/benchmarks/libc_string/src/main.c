@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/timing/timing.h>
+
+/* This benchmark measures memcpy(), memmove(), memset() and memcmp() of
+ * the C library, for sizes from 4 bytes to CONFIG_BENCHMARK_MAX_SIZE in
+ * powers of two. Each size is measured with both buffers word aligned,
+ * and with both of them at odd offsets which differ from each other.
+ *
+ * Each measurement repeats the call often enough to process about
+ * BYTES_PER_RUN bytes, and reports the average time per call along with
+ * the throughput.
+ */
+
+#define MIN_SIZE 4
+#define BYTES_PER_RUN (256 * 1024)
+#define MIN_REPEAT 16
+
+/* Offsets into the buffers for the unaligned measurements */
+#define DST_OFFSET 1
+#define SRC_OFFSET 3
+
+enum bench_op {
+	BENCH_MEMCPY,
+	BENCH_MEMMOVE,
+	BENCH_MEMSET,
+	BENCH_MEMCMP,
+};
+
+static const char *const op_names[] = {
+	[BENCH_MEMCPY] = "memcpy",
+	[BENCH_MEMMOVE] = "memmove",
+	[BENCH_MEMSET] = "memset",
+	[BENCH_MEMCMP] = "memcmp",
+};
+
+static uint8_t dst_buf[CONFIG_BENCHMARK_MAX_SIZE + 8] __aligned(8);
+static uint8_t src_buf[CONFIG_BENCHMARK_MAX_SIZE + 8] __aligned(8);
+
+/* Keeps the compiler from dropping memcmp() calls */
+static volatile int sink;
+
+static void run(enum bench_op op, size_t size, bool aligned)
+{
+	uint8_t *dst = dst_buf + (aligned ? 0 : DST_OFFSET);
+	uint8_t *src = src_buf + (aligned ? 0 : SRC_OFFSET);
+	uint32_t repeat = MAX(BYTES_PER_RUN / size, MIN_REPEAT);
+	timing_t start, end;
+	uint64_t cycles, ns;
+
+	/* Equal buffers, so that memcmp() goes through all of them */
+	memset(src, 0x5a, size);
+	memset(dst, 0x5a, size);
+
+	start = timing_counter_get();
+	for (uint32_t i = 0; i < repeat; i++) {
+		switch (op) {
+		case BENCH_MEMCPY:
+			memcpy(dst, src, size);
+			break;
+		case BENCH_MEMMOVE:
+			memmove(dst, src, size);
+			break;
+		case BENCH_MEMSET:
+			memset(dst, (int)i, size);
+			break;
+		case BENCH_MEMCMP:
+			sink = memcmp(dst, src, size);
+			break;
+		}
+	}
+	end = timing_counter_get();
+
+	cycles = timing_cycles_get(&start, &end);
+	ns = timing_cycles_to_ns_avg(cycles, repeat);
+
+	printk("%-8s %-9s %6zu B: %8u ns %6u MB/s\n", op_names[op],
+	       aligned ? "aligned" : "unaligned", size, (uint32_t)ns,
+	       (uint32_t)((ns != 0) ? (size * 1000U) / ns : 0));
+}
+
+int main(void)
+{
+	timing_init();
+	timing_start();
+
+	printk("C library string functions (%s)\n",
+	       IS_ENABLED(CONFIG_MINIMAL_LIBC_OPTIMIZE_STRING_FOR_SIZE) ?
+	       "size optimized" : "speed optimized");
+
+	for (int op = BENCH_MEMCPY; op <= BENCH_MEMCMP; op++) {
+		for (size_t size = MIN_SIZE; size <= CONFIG_BENCHMARK_MAX_SIZE;
+		     size *= 2) {
+			run(op, size, true);
+			run(op, size, false);
+		}
+	}
+
+	timing_stop();
+	printk("fin\n");
+
+	return 0;
+}
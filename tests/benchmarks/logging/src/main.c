@@ -0,0 +1,270 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/logging/log_backend.h>
+#include <zephyr/logging/log_backend_std.h>
+#include <zephyr/logging/log_ctrl.h>
+#include <zephyr/logging/log_output.h>
+
+LOG_MODULE_REGISTER(bench, LOG_LEVEL_INF);
+
+/* The cost of a logging call is measured over BATCHES batches of BATCH
+ * calls.  In deferred mode, the log buffer is drained between the batches
+ * so that no message is dropped.
+ */
+#define BATCH 16
+#define BATCHES 16
+#define CALLS (BATCH * BATCHES)
+
+/* Each throughput step logs at a fixed rate for STEP_MS, starting at
+ * RATE_MIN messages per second and doubling the rate until messages get
+ * dropped.
+ */
+#define STEP_MS 500
+#define RATE_MIN 500
+#define RATE_MAX 256000
+
+#define FORMAT_SPEC(i, _) " %d"
+#define VALUE(i, _) , i
+
+/* Backend which only counts the messages.  It is active in all the
+ * measurements and serves as the null backend.
+ */
+static uint32_t processed;
+
+static void counter_process(const struct log_backend *const backend,
+			    union log_msg_generic *msg)
+{
+	processed++;
+}
+
+static void counter_panic(const struct log_backend *const backend)
+{
+}
+
+static const struct log_backend_api counter_api = {
+	.process = counter_process,
+	.panic = counter_panic,
+};
+
+LOG_BACKEND_DEFINE(bench_null, counter_api, false);
+
+/* Backend which formats the messages into a RAM buffer */
+static uint8_t ram_log[2048];
+static size_t ram_log_pos;
+
+static int ram_out(uint8_t *data, size_t length, void *ctx)
+{
+	size_t len = MIN(length, sizeof(ram_log) - ram_log_pos);
+
+	memcpy(&ram_log[ram_log_pos], data, len);
+	ram_log_pos = (ram_log_pos + len) % sizeof(ram_log);
+
+	return len;
+}
+
+static uint8_t ram_output_buf[128];
+LOG_OUTPUT_DEFINE(ram_output, ram_out, ram_output_buf, sizeof(ram_output_buf));
+
+static void ram_process(const struct log_backend *const backend,
+			union log_msg_generic *msg)
+{
+	log_output_msg_process(&ram_output, &msg->log, log_backend_std_get_flags());
+}
+
+static const struct log_backend_api ram_api = {
+	.process = ram_process,
+	.panic = counter_panic,
+};
+
+LOG_BACKEND_DEFINE(bench_ram, ram_api, false);
+
+static k_tid_t log_tid;
+
+static void find_log_thread(const struct k_thread *thread, void *user_data)
+{
+	const char *name = k_thread_name_get((k_tid_t)thread);
+
+	if ((name != NULL) && (strcmp(name, "logging") == 0)) {
+		log_tid = (k_tid_t)thread;
+	}
+}
+
+static uint64_t log_thread_cycles(void)
+{
+	k_thread_runtime_stats_t stats;
+
+	if ((log_tid == NULL) || (k_thread_runtime_stats_get(log_tid, &stats) != 0)) {
+		return 0;
+	}
+
+	return stats.execution_cycles;
+}
+
+/* Enable the null backend and the given one, disable all the others */
+static void backends_select(const struct log_backend *selected)
+{
+	STRUCT_SECTION_FOREACH(log_backend, backend) {
+		if ((backend == &bench_null) || (backend == selected)) {
+			log_backend_enable(backend, backend->cb->ctx, LOG_LEVEL_INF);
+		} else if (log_backend_is_active(backend)) {
+			log_backend_disable(backend);
+		}
+	}
+}
+
+static void drain(void)
+{
+	while (log_data_pending()) {
+		k_msleep(1);
+	}
+}
+
+static void report(const char *name, uint32_t cycles)
+{
+	printk("%-10s %6u cycles (%6u ns)\n", name, cycles / CALLS,
+	       (uint32_t)(k_cyc_to_ns_floor64(cycles) / CALLS));
+}
+
+#define BENCH_CALL(_name, _log) do {					\
+	uint32_t _cycles = 0;						\
+									\
+	for (int _b = 0; _b < BATCHES; _b++) {				\
+		uint32_t _start = k_cycle_get_32();			\
+									\
+		for (int _i = 0; _i < BATCH; _i++) {			\
+			_log;						\
+		}							\
+		_cycles += k_cycle_get_32() - _start;			\
+		drain();						\
+	}								\
+	report(_name, _cycles);						\
+} while (0)
+
+#define BENCH_ARGS(n)							\
+	BENCH_CALL("args " #n,						\
+		   LOG_INF("test" LISTIFY(n, FORMAT_SPEC, ())		\
+			   LISTIFY(n, VALUE, ())))
+
+static void bench_calls(void)
+{
+	char str[] = "transient string";
+	uint8_t data[64];
+
+	for (size_t i = 0; i < sizeof(data); i++) {
+		data[i] = i;
+	}
+
+	backends_select(NULL);
+
+	BENCH_ARGS(0);
+	BENCH_ARGS(1);
+	BENCH_ARGS(2);
+	BENCH_ARGS(3);
+	BENCH_ARGS(4);
+	BENCH_ARGS(6);
+	BENCH_ARGS(8);
+	BENCH_CALL("str 1", LOG_INF("test %s", str));
+	BENCH_CALL("str 2", LOG_INF("test %s %s", str, str));
+	BENCH_CALL("const str", LOG_INF("test %s", "constant string"));
+	BENCH_CALL("hex 16", LOG_HEXDUMP_INF(data, 16, "test"));
+	BENCH_CALL("hex 64", LOG_HEXDUMP_INF(data, 64, "test"));
+}
+
+/* Log at the given rate for STEP_MS and report how many messages were
+ * dropped and the CPU load of the processing thread.
+ */
+static bool bench_rate(const char *name, uint32_t rate)
+{
+	uint32_t sent = 0;
+	uint64_t busy = log_thread_cycles();
+	uint32_t start = k_cycle_get_32();
+	int64_t begin = k_uptime_get();
+	int64_t now;
+	uint32_t cycles;
+	uint32_t lost;
+
+	processed = 0;
+
+	while ((now = k_uptime_get() - begin) < STEP_MS) {
+		uint32_t due = (uint64_t)rate * (now + 1) / MSEC_PER_SEC;
+
+		while (sent < due) {
+			LOG_INF("rate %u msg %u", rate, sent);
+			sent++;
+		}
+		k_msleep(1);
+	}
+	drain();
+
+	cycles = k_cycle_get_32() - start;
+	busy = log_thread_cycles() - busy;
+	lost = sent - processed;
+
+	printk("%-16s rate %6u msg/s dropped %5u load %3u%%\n", name, rate, lost,
+	       (uint32_t)((busy * 100U) / cycles));
+
+	return lost == 0;
+}
+
+static void bench_backend(const struct log_backend *backend)
+{
+	const char *name = (backend != NULL) ? backend->name : "null";
+	uint32_t sustained = 0;
+
+	backends_select(backend);
+
+	if (IS_ENABLED(CONFIG_LOG_MODE_IMMEDIATE)) {
+		uint32_t start = k_cycle_get_32();
+		uint64_t ns;
+
+		for (int i = 0; i < CALLS; i++) {
+			LOG_INF("rate %u msg %u", 0, i);
+		}
+
+		ns = k_cyc_to_ns_floor64(k_cycle_get_32() - start) / CALLS;
+		printk("%-16s %6u ns per msg (%6u msg/s)\n", name, (uint32_t)ns,
+		       (uint32_t)(NSEC_PER_SEC / MAX(ns, 1)));
+		return;
+	}
+
+	for (uint32_t rate = RATE_MIN; rate <= RATE_MAX; rate *= 2) {
+		if (!bench_rate(name, rate)) {
+			break;
+		}
+		sustained = rate;
+	}
+
+	printk("%-16s sustained %6u msg/s\n", name, sustained);
+}
+
+int main(void)
+{
+	printk("logging mode: %s\n",
+	       IS_ENABLED(CONFIG_LOG_MODE_IMMEDIATE) ? "immediate" : "deferred");
+
+	k_thread_foreach(find_log_thread, NULL);
+
+	bench_calls();
+
+	bench_backend(NULL);
+	bench_backend(&bench_ram);
+
+	STRUCT_SECTION_FOREACH(log_backend, backend) {
+		if ((backend != &bench_null) && (backend != &bench_ram)) {
+			bench_backend(backend);
+		}
+	}
+
+	printk("fin\n");
+
+	return 0;
+}
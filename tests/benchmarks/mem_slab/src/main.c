@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+
+/* Each worker thread repeatedly takes BURST blocks from the shared slab
+ * and frees them again, OPS_PER_THREAD times in total.  With N workers
+ * started at once, one per CPU, the slab lock (or the per-CPU caches)
+ * see N CPUs hammering the same slab.
+ */
+
+#define OPS_PER_THREAD 20000
+#define BURST 4
+#define BLOCK_SIZE 32
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define WORKER_PRIO K_PRIO_COOP(1)
+
+#define MAX_WORKERS CONFIG_MP_MAX_NUM_CPUS
+
+K_MEM_SLAB_DEFINE_STATIC(slab, BLOCK_SIZE, BURST * MAX_WORKERS * 4, 4);
+
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, MAX_WORKERS, STACK_SIZE);
+static struct k_thread threads[MAX_WORKERS];
+
+static K_SEM_DEFINE(start_sem, 0, MAX_WORKERS);
+static K_SEM_DEFINE(done_sem, 0, MAX_WORKERS);
+
+static volatile bool failed;
+
+static void worker(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	void *blocks[BURST];
+
+	k_sem_take(&start_sem, K_FOREVER);
+
+	for (int i = 0; i < OPS_PER_THREAD / BURST; i++) {
+		for (int j = 0; j < BURST; j++) {
+			if (k_mem_slab_alloc(&slab, &blocks[j], K_NO_WAIT) != 0) {
+				failed = true;
+				blocks[j] = NULL;
+			}
+		}
+		for (int j = 0; j < BURST; j++) {
+			if (blocks[j] != NULL) {
+				k_mem_slab_free(&slab, blocks[j]);
+			}
+		}
+	}
+
+	k_sem_give(&done_sem);
+}
+
+static void run(unsigned int nthreads)
+{
+	uint32_t start, cycles;
+	uint64_t ns;
+
+	for (unsigned int i = 0; i < nthreads; i++) {
+		k_thread_create(&threads[i], stacks[i], STACK_SIZE,
+				worker, NULL, NULL, NULL,
+				WORKER_PRIO, 0, K_FOREVER);
+#ifdef CONFIG_SCHED_CPU_MASK
+		(void)k_thread_cpu_pin(&threads[i], i);
+#endif
+		k_thread_start(&threads[i]);
+	}
+
+	/* Let every worker reach the start line */
+	k_msleep(10);
+
+	start = k_cycle_get_32();
+	for (unsigned int i = 0; i < nthreads; i++) {
+		k_sem_give(&start_sem);
+	}
+	for (unsigned int i = 0; i < nthreads; i++) {
+		k_sem_take(&done_sem, K_FOREVER);
+	}
+	cycles = k_cycle_get_32() - start;
+
+	for (unsigned int i = 0; i < nthreads; i++) {
+		k_thread_join(&threads[i], K_FOREVER);
+	}
+
+	ns = k_cyc_to_ns_floor64(cycles);
+	printk("slab cpus %2u ops %7u time %8u us (%5u ns per op)\n",
+	       nthreads, nthreads * OPS_PER_THREAD, (uint32_t)(ns / 1000U),
+	       (uint32_t)(ns / OPS_PER_THREAD));
+}
+
+int main(void)
+{
+	printk("slab backend: %s\n",
+	       IS_ENABLED(CONFIG_MEM_SLAB_CPU_CACHE) ? "per-CPU caches" : "shared list");
+
+	for (unsigned int n = 1; n <= arch_num_cpus(); n++) {
+		run(n);
+	}
+
+	if (failed) {
+		printk("allocation failed\n");
+	}
+	if (k_mem_slab_num_used_get(&slab) != 0U) {
+		printk("blocks leaked: %u\n", k_mem_slab_num_used_get(&slab));
+	}
+
+	printk("fin\n");
+
+	return 0;
+}
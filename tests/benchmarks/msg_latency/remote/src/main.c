@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Echo of the messaging latency benchmark: each message received on the
+ * "bench" endpoint is sent back as is, from the received callback.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+
+#include <zephyr/ipc/ipc_service.h>
+
+static struct ipc_ept ep;
+
+static void ep_recv(const void *data, size_t len, void *priv)
+{
+	int ret;
+
+	ARG_UNUSED(priv);
+
+	/* Only one message is in flight, so that there is room for the echo */
+	ret = ipc_service_send(&ep, data, len);
+	if (ret < 0) {
+		printk("echo failed with ret %d\n", ret);
+	}
+}
+
+static struct ipc_ept_cfg ep_cfg = {
+	.name = "bench",
+	.cb = {
+		.received = ep_recv,
+	},
+};
+
+int main(void)
+{
+	const struct device *ipc0_instance;
+	int ret;
+
+	ipc0_instance = DEVICE_DT_GET(DT_NODELABEL(ipc0));
+
+	ret = ipc_service_open_instance(ipc0_instance);
+	if ((ret < 0) && (ret != -EALREADY)) {
+		printk("ipc_service_open_instance() failure\n");
+		return ret;
+	}
+
+	ret = ipc_service_register_endpoint(ipc0_instance, &ep, &ep_cfg);
+	if (ret < 0) {
+		printk("ipc_service_register_endpoint() failure\n");
+		return ret;
+	}
+
+	return 0;
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_BENCHMARK_MSG_LATENCY_BENCH_H_
+#define ZEPHYR_BENCHMARK_MSG_LATENCY_BENCH_H_
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+
+/* Message sizes, the smallest one holds the timestamp of the streaming */
+#define MSG_SIZES	16, 64, 256
+#define MSG_SIZE_MAX	256
+
+/* Messages which fit in a channel before the producers block */
+#define QUEUE_DEPTH	8
+
+#define NUM_PINGPONG	500
+
+/* Messages of a streaming run, shared by all the producers and consumers */
+#define NUM_STREAM	1024
+
+#define PRODUCERS_MAX	4
+#define CONSUMERS_MAX	2
+
+/**
+ * @brief Messaging primitive under test
+ *
+ * A channel has two directions: the messages of direction 0 are echoed
+ * to direction 1 by the ping-pong workload, and carry the stream.
+ */
+struct bench_channel {
+	const char *name;
+	/** Prepare both directions for messages of @p size bytes */
+	int (*init)(size_t size);
+	/** Send one message on direction @p dir, waiting for room if needed */
+	int (*send)(int dir, const uint8_t *msg, size_t size);
+	/** Receive one message from direction @p dir, waiting for it */
+	int (*recv)(int dir, uint8_t *msg, size_t size);
+	/** Threads which can send on one direction at the same time */
+	uint8_t max_producers;
+	/** Threads which can receive from one direction at the same time */
+	uint8_t max_consumers;
+	/** Direction 0 is echoed to direction 1 by another core */
+	bool remote_echo;
+};
+
+extern const struct bench_channel msgq_channel;
+extern const struct bench_channel pipe_channel;
+extern const struct bench_channel fifo_channel;
+extern const struct bench_channel zbus_channel;
+extern const struct bench_channel mpsc_pbuf_channel;
+extern const struct bench_channel spsc_pbuf_channel;
+extern const struct bench_channel ipc_channel;
+
+#endif /* ZEPHYR_BENCHMARK_MSG_LATENCY_BENCH_H_ */
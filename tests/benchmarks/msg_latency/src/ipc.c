@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ *
+ * @brief IPC service endpoint as a channel
+ *
+ * The messages sent to the endpoint are echoed by the remote core, see
+ * remote/src/main.c. The received callback runs in the context of the
+ * backend, and hands the message over to the bench thread.
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/ipc/ipc_service.h>
+
+#include "bench.h"
+
+#define IPC_NODE DT_NODELABEL(ipc0)
+
+#if DT_NODE_HAS_COMPAT(IPC_NODE, zephyr_ipc_icbmsg)
+#define IPC_NAME "icbmsg"
+#elif DT_NODE_HAS_COMPAT(IPC_NODE, zephyr_ipc_openamp_static_vrings)
+#define IPC_NAME "rpmsg"
+#else
+#define IPC_NAME "icmsg"
+#endif
+
+#define BOUND_TIMEOUT K_SECONDS(5)
+
+static K_SEM_DEFINE(bound_sem, 0, 1);
+static K_SEM_DEFINE(recv_sem, 0, 1);
+static uint8_t recv_buf[MSG_SIZE_MAX];
+static size_t recv_len;
+static struct ipc_ept ep;
+static bool ep_ready;
+
+static void ep_bound(void *priv)
+{
+	ARG_UNUSED(priv);
+
+	k_sem_give(&bound_sem);
+}
+
+static void ep_recv(const void *data, size_t len, void *priv)
+{
+	ARG_UNUSED(priv);
+
+	recv_len = MIN(len, sizeof(recv_buf));
+	memcpy(recv_buf, data, recv_len);
+	k_sem_give(&recv_sem);
+}
+
+static struct ipc_ept_cfg ep_cfg = {
+	.name = "bench",
+	.cb = {
+		.bound = ep_bound,
+		.received = ep_recv,
+	},
+};
+
+static int ipc_init(size_t size)
+{
+	const struct device *instance = DEVICE_DT_GET(IPC_NODE);
+	int ret;
+
+	ARG_UNUSED(size);
+
+	if (ep_ready) {
+		return 0;
+	}
+
+	ret = ipc_service_open_instance(instance);
+	if (ret < 0 && ret != -EALREADY) {
+		return ret;
+	}
+
+	ret = ipc_service_register_endpoint(instance, &ep, &ep_cfg);
+	if (ret < 0) {
+		return ret;
+	}
+
+	if (k_sem_take(&bound_sem, BOUND_TIMEOUT) != 0) {
+		return -ETIMEDOUT;
+	}
+
+	ep_ready = true;
+
+	return 0;
+}
+
+static int ipc_send(int dir, const uint8_t *msg, size_t size)
+{
+	int ret;
+
+	ARG_UNUSED(dir);
+
+	/* No room in the shared memory until the remote core catches up */
+	while ((ret = ipc_service_send(&ep, msg, size)) == -ENOMEM) {
+		k_yield();
+	}
+
+	return ret < 0 ? ret : 0;
+}
+
+static int ipc_recv(int dir, uint8_t *msg, size_t size)
+{
+	ARG_UNUSED(dir);
+
+	(void)k_sem_take(&recv_sem, K_FOREVER);
+
+	if (recv_len != size) {
+		return -EMSGSIZE;
+	}
+
+	memcpy(msg, recv_buf, size);
+
+	return 0;
+}
+
+/* Time stamps of the two cores cannot be compared, so that only the ping-pong is run */
+const struct bench_channel ipc_channel = {
+	.name = IPC_NAME,
+	.init = ipc_init,
+	.send = ipc_send,
+	.recv = ipc_recv,
+	.max_producers = 0,
+	.max_consumers = 0,
+	.remote_echo = true,
+};
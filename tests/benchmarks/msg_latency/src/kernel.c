@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ *
+ * @brief Kernel objects as channels: message queues, pipes and FIFOs
+ */
+
+#include <string.h>
+
+#include <zephyr/kernel.h>
+
+#include "bench.h"
+
+/* Message queues: the messages are copied in and out of the queue buffer */
+
+static char __aligned(4) msgq_buf[2][QUEUE_DEPTH * MSG_SIZE_MAX];
+static struct k_msgq msgq[2];
+
+static int msgq_init(size_t size)
+{
+	for (int dir = 0; dir < 2; dir++) {
+		k_msgq_init(&msgq[dir], msgq_buf[dir], size, QUEUE_DEPTH);
+	}
+
+	return 0;
+}
+
+static int msgq_send(int dir, const uint8_t *msg, size_t size)
+{
+	ARG_UNUSED(size);
+
+	return k_msgq_put(&msgq[dir], msg, K_FOREVER);
+}
+
+static int msgq_recv(int dir, uint8_t *msg, size_t size)
+{
+	ARG_UNUSED(size);
+
+	return k_msgq_get(&msgq[dir], msg, K_FOREVER);
+}
+
+const struct bench_channel msgq_channel = {
+	.name = "msgq",
+	.init = msgq_init,
+	.send = msgq_send,
+	.recv = msgq_recv,
+	.max_producers = PRODUCERS_MAX,
+	.max_consumers = CONSUMERS_MAX,
+};
+
+/*
+ * Pipes: a byte stream, with whole messages transferred. A writer waiting
+ * for room can complete its message after another writer, so that only
+ * one thread uses each end.
+ */
+
+static unsigned char __aligned(4) pipe_buf[2][QUEUE_DEPTH * MSG_SIZE_MAX];
+static struct k_pipe pipe[2];
+
+static int pipe_init(size_t size)
+{
+	for (int dir = 0; dir < 2; dir++) {
+		k_pipe_init(&pipe[dir], pipe_buf[dir], QUEUE_DEPTH * size);
+	}
+
+	return 0;
+}
+
+static int pipe_send(int dir, const uint8_t *msg, size_t size)
+{
+	size_t written;
+
+	return k_pipe_put(&pipe[dir], msg, size, &written, size, K_FOREVER);
+}
+
+static int pipe_recv(int dir, uint8_t *msg, size_t size)
+{
+	size_t read;
+
+	return k_pipe_get(&pipe[dir], msg, size, &read, size, K_FOREVER);
+}
+
+const struct bench_channel pipe_channel = {
+	.name = "pipe",
+	.init = pipe_init,
+	.send = pipe_send,
+	.recv = pipe_recv,
+	.max_producers = 1,
+	.max_consumers = 1,
+};
+
+/*
+ * FIFOs: the items are queued by reference. The messages are copied in
+ * and out of items taken from a FIFO of free ones, as a zero-copy user
+ * would fill and consume them.
+ */
+
+struct fifo_item {
+	void *fifo_reserved;
+	uint8_t data[MSG_SIZE_MAX];
+};
+
+static struct fifo_item fifo_items[2][QUEUE_DEPTH];
+static struct k_fifo fifo[2];
+static struct k_fifo fifo_free[2];
+
+static int fifo_init(size_t size)
+{
+	ARG_UNUSED(size);
+
+	for (int dir = 0; dir < 2; dir++) {
+		k_fifo_init(&fifo[dir]);
+		k_fifo_init(&fifo_free[dir]);
+
+		for (int i = 0; i < QUEUE_DEPTH; i++) {
+			k_fifo_put(&fifo_free[dir], &fifo_items[dir][i]);
+		}
+	}
+
+	return 0;
+}
+
+static int fifo_send(int dir, const uint8_t *msg, size_t size)
+{
+	struct fifo_item *item = k_fifo_get(&fifo_free[dir], K_FOREVER);
+
+	memcpy(item->data, msg, size);
+	k_fifo_put(&fifo[dir], item);
+
+	return 0;
+}
+
+static int fifo_recv(int dir, uint8_t *msg, size_t size)
+{
+	struct fifo_item *item = k_fifo_get(&fifo[dir], K_FOREVER);
+
+	memcpy(msg, item->data, size);
+	k_fifo_put(&fifo_free[dir], item);
+
+	return 0;
+}
+
+const struct bench_channel fifo_channel = {
+	.name = "fifo",
+	.init = fifo_init,
+	.send = fifo_send,
+	.recv = fifo_recv,
+	.max_producers = PRODUCERS_MAX,
+	.max_consumers = CONSUMERS_MAX,
+};
@@ -0,0 +1,302 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ *
+ * @brief Measure the latency and throughput of the messaging primitives
+ *
+ * Two workloads are run for each primitive and message size:
+ *  1. ping-pong: a message is sent and echoed back, one at a time.
+ *     The latency is the round trip time.
+ *  2. streaming: producer threads send timestamped messages as fast as
+ *     the consumer threads receive them. The latency is the time from
+ *     send to reception.
+ *
+ * With SMP, the threads exchanging messages are pinned to different CPUs.
+ * Each run is printed as one CSV record, see report().
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+
+#include "bench.h"
+
+#define STACK_SIZE	(1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define NUM_WORKERS	(PRODUCERS_MAX + CONSUMERS_MAX)
+#define PRIORITY	K_PRIO_PREEMPT(5)
+
+#define PIN_THREADS	(IS_ENABLED(CONFIG_SMP) && IS_ENABLED(CONFIG_SCHED_CPU_MASK))
+
+static const struct bench_channel *const channels[] = {
+	&msgq_channel,
+	&pipe_channel,
+	&fifo_channel,
+#ifdef CONFIG_ZBUS
+	&zbus_channel,
+#endif
+#ifdef CONFIG_MPSC_PBUF
+	&mpsc_pbuf_channel,
+#endif
+#ifdef CONFIG_SPSC_PBUF
+	&spsc_pbuf_channel,
+#endif
+#ifdef CONFIG_IPC_SERVICE
+	&ipc_channel,
+#endif
+};
+
+static const size_t msg_sizes[] = { MSG_SIZES };
+
+static K_THREAD_STACK_DEFINE(bench_stack, STACK_SIZE);
+static struct k_thread bench_thread;
+
+static K_THREAD_STACK_ARRAY_DEFINE(worker_stacks, NUM_WORKERS, STACK_SIZE);
+static struct k_thread workers[NUM_WORKERS];
+
+/* Latencies of the current run, in cycles */
+static uint32_t samples[MAX(NUM_PINGPONG, NUM_STREAM)];
+static atomic_t num_samples;
+
+static int cmp_sample(const void *a, const void *b)
+{
+	uint32_t sa = *(const uint32_t *)a;
+	uint32_t sb = *(const uint32_t *)b;
+
+	return (sa > sb) - (sa < sb);
+}
+
+static uint32_t sample_ns(uint32_t count, uint32_t percent)
+{
+	return (uint32_t)timing_cycles_to_ns(samples[(count - 1) * percent / 100]);
+}
+
+/*
+ * Print the record "MSG_BENCH,<channel>,<workload>,<size>,<producers>,
+ * <consumers>,<p50 ns>,<p90 ns>,<p99 ns>,<max ns>,<messages per second>".
+ */
+static void report(const struct bench_channel *ch, const char *workload, size_t size,
+		   int producers, int consumers, uint64_t elapsed)
+{
+	uint32_t count = (uint32_t)atomic_get(&num_samples);
+	uint64_t elapsed_ns = MAX(timing_cycles_to_ns(elapsed), 1);
+
+	if (count == 0) {
+		printk("%s %s: no sample\n", ch->name, workload);
+		return;
+	}
+
+	qsort(samples, count, sizeof(samples[0]), cmp_sample);
+
+	printk("MSG_BENCH,%s,%s,%zu,%d,%d,%u,%u,%u,%u,%u\n", ch->name, workload, size,
+	       producers, consumers, sample_ns(count, 50), sample_ns(count, 90),
+	       sample_ns(count, 99), sample_ns(count, 100),
+	       (uint32_t)(((uint64_t)count * NSEC_PER_SEC) / elapsed_ns));
+}
+
+static k_tid_t worker_start(int idx, k_thread_entry_t entry, const struct bench_channel *ch,
+			    size_t size, uint32_t count)
+{
+	k_tid_t tid;
+
+	tid = k_thread_create(&workers[idx], worker_stacks[idx], STACK_SIZE, entry,
+			      (void *)ch, (void *)size, UINT_TO_POINTER(count), PRIORITY, 0,
+			      K_FOREVER);
+
+#if PIN_THREADS
+	/* The bench thread runs on CPU 0 */
+	(void)k_thread_cpu_pin(tid, (idx + 1) % arch_num_cpus());
+#endif
+
+	k_thread_start(tid);
+
+	return tid;
+}
+
+static void echo_entry(void *p1, void *p2, void *p3)
+{
+	const struct bench_channel *ch = p1;
+	size_t size = (size_t)p2;
+	uint32_t count = POINTER_TO_UINT(p3);
+	uint8_t msg[MSG_SIZE_MAX];
+
+	for (uint32_t i = 0; i < count; i++) {
+		if (ch->recv(0, msg, size) < 0 || ch->send(1, msg, size) < 0) {
+			printk("%s: echo failed\n", ch->name);
+			return;
+		}
+	}
+}
+
+static void pingpong(const struct bench_channel *ch, size_t size)
+{
+	uint8_t msg[MSG_SIZE_MAX] = { 0 };
+	timing_t start_run;
+	timing_t start;
+	timing_t end;
+
+	atomic_set(&num_samples, 0);
+
+	if (!ch->remote_echo) {
+		worker_start(0, echo_entry, ch, size, NUM_PINGPONG);
+	}
+
+	start_run = timing_counter_get();
+
+	for (uint32_t i = 0; i < NUM_PINGPONG; i++) {
+		start = timing_counter_get();
+		if (ch->send(0, msg, size) < 0 || ch->recv(1, msg, size) < 0) {
+			printk("%s: ping-pong failed\n", ch->name);
+			break;
+		}
+		end = timing_counter_get();
+
+		samples[i] = (uint32_t)timing_cycles_get(&start, &end);
+		atomic_inc(&num_samples);
+	}
+
+	end = timing_counter_get();
+
+	if (!ch->remote_echo) {
+		(void)k_thread_join(&workers[0], K_FOREVER);
+	}
+
+	report(ch, "pingpong", size, 1, 1, timing_cycles_get(&start_run, &end));
+}
+
+static void producer_entry(void *p1, void *p2, void *p3)
+{
+	const struct bench_channel *ch = p1;
+	size_t size = (size_t)p2;
+	uint32_t count = POINTER_TO_UINT(p3);
+	uint8_t msg[MSG_SIZE_MAX] = { 0 };
+	timing_t now;
+
+	for (uint32_t i = 0; i < count; i++) {
+		now = timing_counter_get();
+		memcpy(msg, &now, sizeof(now));
+
+		if (ch->send(0, msg, size) < 0) {
+			printk("%s: send failed\n", ch->name);
+			return;
+		}
+	}
+}
+
+static void consumer_entry(void *p1, void *p2, void *p3)
+{
+	const struct bench_channel *ch = p1;
+	size_t size = (size_t)p2;
+	uint32_t count = POINTER_TO_UINT(p3);
+	uint8_t msg[MSG_SIZE_MAX];
+	timing_t sent;
+	timing_t now;
+
+	for (uint32_t i = 0; i < count; i++) {
+		if (ch->recv(0, msg, size) < 0) {
+			printk("%s: receive failed\n", ch->name);
+			return;
+		}
+
+		now = timing_counter_get();
+		memcpy(&sent, msg, sizeof(sent));
+
+		samples[atomic_inc(&num_samples)] = (uint32_t)timing_cycles_get(&sent, &now);
+	}
+}
+
+/* Each consumer receives its share of the messages, so that none is left waiting */
+static void stream(const struct bench_channel *ch, size_t size, int producers, int consumers)
+{
+	timing_t start;
+	timing_t end;
+	int n = 0;
+
+	atomic_set(&num_samples, 0);
+
+	start = timing_counter_get();
+
+	for (int i = 0; i < consumers; i++) {
+		worker_start(n++, consumer_entry, ch, size, NUM_STREAM / consumers);
+	}
+
+	for (int i = 0; i < producers; i++) {
+		worker_start(n++, producer_entry, ch, size, NUM_STREAM / producers);
+	}
+
+	for (int i = 0; i < n; i++) {
+		(void)k_thread_join(&workers[i], K_FOREVER);
+	}
+
+	end = timing_counter_get();
+
+	report(ch, "stream", size, producers, consumers, timing_cycles_get(&start, &end));
+}
+
+static void bench_channel_run(const struct bench_channel *ch)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(msg_sizes); i++) {
+		size_t size = msg_sizes[i];
+
+		if (ch->init(size) < 0) {
+			printk("%s: cannot use messages of %zu bytes\n", ch->name, size);
+			continue;
+		}
+
+		pingpong(ch, size);
+
+		for (int p = 1; p <= ch->max_producers; p *= 2) {
+			for (int c = 1; c <= ch->max_consumers; c *= 2) {
+				if (ch->init(size) < 0) {
+					break;
+				}
+
+				stream(ch, size, p, c);
+			}
+		}
+	}
+}
+
+static void bench_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	timing_init();
+	timing_start();
+
+	printk("MSG_BENCH,channel,workload,size,producers,consumers,"
+	       "p50_ns,p90_ns,p99_ns,max_ns,msgs_per_s\n");
+
+	for (size_t i = 0; i < ARRAY_SIZE(channels); i++) {
+		bench_channel_run(channels[i]);
+	}
+
+	timing_stop();
+
+	printk("PROJECT EXECUTION SUCCESSFUL\n");
+}
+
+int main(void)
+{
+	k_tid_t tid;
+
+	tid = k_thread_create(&bench_thread, bench_stack, STACK_SIZE, bench_entry, NULL, NULL,
+			      NULL, PRIORITY, 0, K_FOREVER);
+
+#if PIN_THREADS
+	(void)k_thread_cpu_pin(tid, 0);
+#endif
+
+	k_thread_start(tid);
+	(void)k_thread_join(&bench_thread, K_FOREVER);
+
+	return 0;
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ *
+ * @brief MPSC packet buffer as a channel
+ *
+ * The packet buffer does not wake up its reader, so that a semaphore is
+ * given for each committed message. The writers wait for room in
+ * mpsc_pbuf_alloc().
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/mpsc_pbuf.h>
+
+#include "bench.h"
+
+struct mpsc_msg {
+	MPSC_PBUF_HDR;
+	uint32_t wlen: 32 - MPSC_PBUF_HDR_BITS;
+	uint8_t data[];
+};
+
+#define MPSC_MSG_WLEN(size) (1 + DIV_ROUND_UP(size, sizeof(uint32_t)))
+
+static uint32_t mpsc_buf[2][QUEUE_DEPTH * MPSC_MSG_WLEN(MSG_SIZE_MAX)];
+static struct mpsc_pbuf_buffer mpsc[2];
+static struct k_sem mpsc_ready[2];
+
+static uint32_t mpsc_get_wlen(const union mpsc_pbuf_generic *packet)
+{
+	return ((const struct mpsc_msg *)packet)->wlen;
+}
+
+static int mpsc_init(size_t size)
+{
+	for (int dir = 0; dir < 2; dir++) {
+		const struct mpsc_pbuf_buffer_config config = {
+			.buf = mpsc_buf[dir],
+			.size = QUEUE_DEPTH * MPSC_MSG_WLEN(size),
+			.get_wlen = mpsc_get_wlen,
+		};
+
+		mpsc_pbuf_init(&mpsc[dir], &config);
+		k_sem_init(&mpsc_ready[dir], 0, K_SEM_MAX_LIMIT);
+	}
+
+	return 0;
+}
+
+static int mpsc_send(int dir, const uint8_t *msg, size_t size)
+{
+	struct mpsc_msg *packet;
+
+	packet = (struct mpsc_msg *)mpsc_pbuf_alloc(&mpsc[dir], MPSC_MSG_WLEN(size), K_FOREVER);
+	if (packet == NULL) {
+		return -ENOMEM;
+	}
+
+	packet->wlen = MPSC_MSG_WLEN(size);
+	memcpy(packet->data, msg, size);
+
+	mpsc_pbuf_commit(&mpsc[dir], (union mpsc_pbuf_generic *)packet);
+	k_sem_give(&mpsc_ready[dir]);
+
+	return 0;
+}
+
+static int mpsc_recv(int dir, uint8_t *msg, size_t size)
+{
+	const struct mpsc_msg *packet;
+
+	(void)k_sem_take(&mpsc_ready[dir], K_FOREVER);
+
+	packet = (const struct mpsc_msg *)mpsc_pbuf_claim(&mpsc[dir]);
+	if (packet == NULL) {
+		return -EIO;
+	}
+
+	memcpy(msg, packet->data, size);
+	mpsc_pbuf_free(&mpsc[dir], (const union mpsc_pbuf_generic *)packet);
+
+	return 0;
+}
+
+const struct bench_channel mpsc_pbuf_channel = {
+	.name = "mpsc_pbuf",
+	.init = mpsc_init,
+	.send = mpsc_send,
+	.recv = mpsc_recv,
+	.max_producers = PRODUCERS_MAX,
+	.max_consumers = 1,
+};
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ *
+ * @brief SPSC packet buffer as a channel
+ *
+ * The packet buffer wakes up neither its reader nor its writer, so that
+ * a semaphore is given for each written message, and another one each
+ * time the reader frees room.
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/spsc_pbuf.h>
+
+#include "bench.h"
+
+/* Room for the control block and the length field of each message */
+#define SPSC_BUF_LEN(size) \
+	(sizeof(struct spsc_pbuf) + QUEUE_DEPTH * ROUND_UP((size) + sizeof(uint16_t), 4))
+
+static uint32_t spsc_buf[2][DIV_ROUND_UP(SPSC_BUF_LEN(MSG_SIZE_MAX), sizeof(uint32_t))];
+static struct spsc_pbuf *spsc[2];
+static struct k_sem spsc_ready[2];
+static struct k_sem spsc_room[2];
+
+static int spsc_init(size_t size)
+{
+	for (int dir = 0; dir < 2; dir++) {
+		spsc[dir] = spsc_pbuf_init(spsc_buf[dir], SPSC_BUF_LEN(size), 0);
+		if (spsc[dir] == NULL) {
+			return -EINVAL;
+		}
+
+		k_sem_init(&spsc_ready[dir], 0, K_SEM_MAX_LIMIT);
+		k_sem_init(&spsc_room[dir], 0, 1);
+	}
+
+	return 0;
+}
+
+static int spsc_send(int dir, const uint8_t *msg, size_t size)
+{
+	int ret;
+
+	while ((ret = spsc_pbuf_write(spsc[dir], (const char *)msg, size)) == -ENOMEM) {
+		(void)k_sem_take(&spsc_room[dir], K_FOREVER);
+	}
+
+	if (ret < 0) {
+		return ret;
+	}
+
+	k_sem_give(&spsc_ready[dir]);
+
+	return 0;
+}
+
+static int spsc_recv(int dir, uint8_t *msg, size_t size)
+{
+	int ret;
+
+	(void)k_sem_take(&spsc_ready[dir], K_FOREVER);
+
+	ret = spsc_pbuf_read(spsc[dir], (char *)msg, size);
+	if (ret <= 0) {
+		return ret < 0 ? ret : -EIO;
+	}
+
+	k_sem_give(&spsc_room[dir]);
+
+	return 0;
+}
+
+const struct bench_channel spsc_pbuf_channel = {
+	.name = "spsc_pbuf",
+	.init = spsc_init,
+	.send = spsc_send,
+	.recv = spsc_recv,
+	.max_producers = 1,
+	.max_consumers = 1,
+};
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ *
+ * @brief zbus as a channel
+ *
+ * Each direction is a message subscriber, observing one zbus channel per
+ * message size. The published messages are queued to the subscriber, so
+ * that the number of messages in flight is bounded by a semaphore to keep
+ * the subscriber buffers from running out.
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/zbus/zbus.h>
+
+#include "bench.h"
+
+#define ZBUS_MSG_TYPE(size) struct bench_msg_##size { uint8_t data[size]; }
+
+ZBUS_MSG_TYPE(16);
+ZBUS_MSG_TYPE(64);
+ZBUS_MSG_TYPE(256);
+
+ZBUS_MSG_SUBSCRIBER_DEFINE(bench_sub0);
+ZBUS_MSG_SUBSCRIBER_DEFINE(bench_sub1);
+
+#define ZBUS_BENCH_CHAN_DEFINE(dir, size)						\
+	ZBUS_CHAN_DEFINE(bench_chan##dir##_##size, struct bench_msg_##size, NULL, NULL,	\
+			 ZBUS_OBSERVERS(bench_sub##dir), ZBUS_MSG_INIT(0))
+
+ZBUS_BENCH_CHAN_DEFINE(0, 16);
+ZBUS_BENCH_CHAN_DEFINE(0, 64);
+ZBUS_BENCH_CHAN_DEFINE(0, 256);
+ZBUS_BENCH_CHAN_DEFINE(1, 16);
+ZBUS_BENCH_CHAN_DEFINE(1, 64);
+ZBUS_BENCH_CHAN_DEFINE(1, 256);
+
+static const struct zbus_observer *const subs[2] = { &bench_sub0, &bench_sub1 };
+static const struct zbus_channel *chans[2];
+static struct k_sem credits[2];
+
+static int zbus_bench_init(size_t size)
+{
+	switch (size) {
+	case 16:
+		chans[0] = &bench_chan0_16;
+		chans[1] = &bench_chan1_16;
+		break;
+	case 64:
+		chans[0] = &bench_chan0_64;
+		chans[1] = &bench_chan1_64;
+		break;
+	case 256:
+		chans[0] = &bench_chan0_256;
+		chans[1] = &bench_chan1_256;
+		break;
+	default:
+		return -ENOTSUP;
+	}
+
+	for (int dir = 0; dir < 2; dir++) {
+		k_sem_init(&credits[dir], QUEUE_DEPTH, QUEUE_DEPTH);
+	}
+
+	return 0;
+}
+
+static int zbus_bench_send(int dir, const uint8_t *msg, size_t size)
+{
+	int ret;
+
+	ARG_UNUSED(size);
+
+	(void)k_sem_take(&credits[dir], K_FOREVER);
+
+	ret = zbus_chan_pub(chans[dir], msg, K_FOREVER);
+	if (ret < 0) {
+		k_sem_give(&credits[dir]);
+	}
+
+	return ret;
+}
+
+static int zbus_bench_recv(int dir, uint8_t *msg, size_t size)
+{
+	const struct zbus_channel *chan;
+	int ret;
+
+	ARG_UNUSED(size);
+
+	ret = zbus_sub_wait_msg(subs[dir], &chan, msg, K_FOREVER);
+	if (ret == 0) {
+		k_sem_give(&credits[dir]);
+	}
+
+	return ret;
+}
+
+const struct bench_channel zbus_channel = {
+	.name = "zbus",
+	.init = zbus_bench_init,
+	.send = zbus_bench_send,
+	.recv = zbus_bench_recv,
+	.max_producers = PRODUCERS_MAX,
+	.max_consumers = CONSUMERS_MAX,
+};
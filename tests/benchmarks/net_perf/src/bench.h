@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_BENCHMARK_NET_PERF_BENCH_H_
+#define ZEPHYR_BENCHMARK_NET_PERF_BENCH_H_
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/net_core.h>
+#include <zephyr/timing/timing.h>
+
+#define NUM_ITERATIONS	1000
+
+/* Loopback ports of the UDP and TCP measurements */
+#define BENCH_UDP_PORT	4242
+#define BENCH_TCP_PORT	4243
+
+/* First port of the sockets added for the connection lookup measurement */
+#define BENCH_EXTRA_PORT 5000
+
+/**
+ * @brief Report the average cost of an operation
+ *
+ * Prints the record "NET_BENCH,<metric>,<samples>,<cycles>,<ns>" where the
+ * cycles and nanoseconds are per sample.
+ */
+void bench_report(const char *metric, uint32_t samples, uint64_t cycles);
+
+/**
+ * @brief Report an average time known in microseconds only
+ *
+ * The cycles field of the record is left empty.
+ */
+void bench_report_us(const char *metric, uint32_t samples, uint64_t usec);
+
+/* Snapshot of the packet time statistics of the stack */
+struct bench_pkt_stats {
+	uint64_t tx_sum;
+	uint32_t tx_count;
+	uint64_t rx_sum;
+	uint32_t rx_count;
+#if defined(CONFIG_NET_PKT_TXTIME_STATS_DETAIL)
+	uint64_t tx_detail[NET_PKT_DETAIL_STATS_COUNT];
+#endif
+#if defined(CONFIG_NET_PKT_RXTIME_STATS_DETAIL)
+	uint64_t rx_detail[NET_PKT_DETAIL_STATS_COUNT];
+#endif
+};
+
+void bench_pkt_stats_get(struct bench_pkt_stats *stats);
+
+/**
+ * @brief Report the time spent in the stack since a snapshot
+ *
+ * The records are named "<prefix>.tx", "<prefix>.rx" and, with the detail
+ * statistics, "<prefix>.tx.<n>" and "<prefix>.rx.<n>" for the time spent
+ * between the successive checkpoints of the TX and RX paths.
+ */
+void bench_pkt_stats_report(const char *prefix, const struct bench_pkt_stats *start);
+
+void bench_buf(void);
+void bench_chksum(void);
+void bench_udp(void);
+void bench_tcp(void);
+
+#endif /* ZEPHYR_BENCHMARK_NET_PERF_BENCH_H_ */
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Allocation and release of the buffers and packets the stack is made of,
+ * from pools which are not shared with the traffic of the stack.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/buf.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/sys/printk.h>
+
+#include "bench.h"
+
+#define BUF_SIZE 128
+
+NET_BUF_POOL_DEFINE(bench_buf_pool, 4, BUF_SIZE, 0, NULL);
+
+static void bench_net_buf(void)
+{
+	struct net_buf *buf;
+	timing_t start;
+	timing_t end;
+	uint64_t alloc = 0;
+	uint64_t unref = 0;
+
+	for (int i = 0; i < NUM_ITERATIONS; i++) {
+		start = timing_counter_get();
+		buf = net_buf_alloc(&bench_buf_pool, K_NO_WAIT);
+		end = timing_counter_get();
+
+		if (buf == NULL) {
+			printk("Cannot allocate a net_buf\n");
+			return;
+		}
+
+		alloc += timing_cycles_get(&start, &end);
+
+		start = timing_counter_get();
+		net_buf_unref(buf);
+		end = timing_counter_get();
+
+		unref += timing_cycles_get(&start, &end);
+	}
+
+	bench_report("net_buf.alloc", NUM_ITERATIONS, alloc);
+	bench_report("net_buf.unref", NUM_ITERATIONS, unref);
+}
+
+static void bench_net_pkt(size_t size, const char *alloc_metric, const char *unref_metric)
+{
+	struct net_if *iface = net_if_get_default();
+	struct net_pkt *pkt;
+	timing_t start;
+	timing_t end;
+	uint64_t alloc = 0;
+	uint64_t unref = 0;
+
+	for (int i = 0; i < NUM_ITERATIONS; i++) {
+		start = timing_counter_get();
+		pkt = net_pkt_alloc_with_buffer(iface, size, AF_INET, IPPROTO_UDP, K_NO_WAIT);
+		end = timing_counter_get();
+
+		if (pkt == NULL) {
+			printk("Cannot allocate a net_pkt of %zu bytes\n", size);
+			return;
+		}
+
+		alloc += timing_cycles_get(&start, &end);
+
+		start = timing_counter_get();
+		net_pkt_unref(pkt);
+		end = timing_counter_get();
+
+		unref += timing_cycles_get(&start, &end);
+	}
+
+	bench_report(alloc_metric, NUM_ITERATIONS, alloc);
+	bench_report(unref_metric, NUM_ITERATIONS, unref);
+}
+
+void bench_buf(void)
+{
+	bench_net_buf();
+
+	/* One buffer, and one buffer per fragment of the largest payload */
+	bench_net_pkt(64, "net_pkt.alloc.64", "net_pkt.unref.64");
+	bench_net_pkt(1024, "net_pkt.alloc.1024", "net_pkt.unref.1024");
+}
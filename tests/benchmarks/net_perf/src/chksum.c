@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Checksum of UDP over IPv4 packets, computed over the packet buffers as
+ * the stack does for the packets without checksum offloading.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_ip.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/sys/printk.h>
+
+#include "net_private.h"
+#include "ipv4.h"
+#include "bench.h"
+
+static void bench_chksum_size(size_t size, const char *metric)
+{
+	struct net_if *iface = net_if_get_default();
+	struct net_pkt *pkt;
+	timing_t start;
+	timing_t end;
+	uint64_t cycles = 0;
+	volatile uint16_t chksum;
+
+	pkt = net_pkt_alloc_with_buffer(iface, size, AF_INET, IPPROTO_UDP, K_NO_WAIT);
+	if (pkt == NULL) {
+		printk("Cannot allocate a net_pkt of %zu bytes\n", size);
+		return;
+	}
+
+	/* The content does not matter, only the length and layout do */
+	if (net_pkt_memset(pkt, 0xa5, size) < 0) {
+		printk("Cannot fill a net_pkt of %zu bytes\n", size);
+		net_pkt_unref(pkt);
+		return;
+	}
+
+	net_pkt_set_ip_hdr_len(pkt, sizeof(struct net_ipv4_hdr));
+	net_pkt_cursor_init(pkt);
+
+	for (int i = 0; i < NUM_ITERATIONS; i++) {
+		start = timing_counter_get();
+		chksum = net_calc_chksum(pkt, IPPROTO_UDP);
+		end = timing_counter_get();
+
+		cycles += timing_cycles_get(&start, &end);
+	}
+
+	ARG_UNUSED(chksum);
+
+	net_pkt_unref(pkt);
+
+	bench_report(metric, NUM_ITERATIONS, cycles);
+}
+
+void bench_chksum(void)
+{
+	bench_chksum_size(64, "chksum.udp.64");
+	bench_chksum_size(512, "chksum.udp.512");
+	bench_chksum_size(1024, "chksum.udp.1024");
+}
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ *
+ * @brief Measure the cost of the network stack over the loopback interface
+ *
+ * Each measurement is printed as one CSV record, see bench_report(), so that
+ * the results can be collected by the console harness and compared between
+ * runs.
+ */
+
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/net_mgmt.h>
+#include <zephyr/net/net_stats.h>
+#include <zephyr/sys/printk.h>
+
+#include "bench.h"
+
+void bench_report(const char *metric, uint32_t samples, uint64_t cycles)
+{
+	if (samples == 0) {
+		return;
+	}
+
+	printk("NET_BENCH,%s,%u,%u,%u\n", metric, samples, (uint32_t)(cycles / samples),
+	       (uint32_t)timing_cycles_to_ns_avg(cycles, samples));
+}
+
+void bench_report_us(const char *metric, uint32_t samples, uint64_t usec)
+{
+	if (samples == 0) {
+		return;
+	}
+
+	printk("NET_BENCH,%s,%u,,%u\n", metric, samples,
+	       (uint32_t)((usec * NSEC_PER_USEC) / samples));
+}
+
+void bench_pkt_stats_get(struct bench_pkt_stats *stats)
+{
+	static struct net_stats data;
+	int ret;
+
+	ret = net_mgmt(NET_REQUEST_STATS_GET_ALL, NULL, &data, sizeof(data));
+	if (ret < 0) {
+		printk("Cannot get the network statistics (%d)\n", ret);
+		memset(&data, 0, sizeof(data));
+	}
+
+	stats->tx_sum = data.tx_time.sum;
+	stats->tx_count = data.tx_time.count;
+	stats->rx_sum = data.rx_time.sum;
+	stats->rx_count = data.rx_time.count;
+
+#if defined(CONFIG_NET_PKT_TXTIME_STATS_DETAIL)
+	for (int i = 0; i < NET_PKT_DETAIL_STATS_COUNT; i++) {
+		stats->tx_detail[i] = data.tx_time_detail[i].sum;
+	}
+#endif
+#if defined(CONFIG_NET_PKT_RXTIME_STATS_DETAIL)
+	for (int i = 0; i < NET_PKT_DETAIL_STATS_COUNT; i++) {
+		stats->rx_detail[i] = data.rx_time_detail[i].sum;
+	}
+#endif
+}
+
+void bench_pkt_stats_report(const char *prefix, const struct bench_pkt_stats *start)
+{
+	struct bench_pkt_stats end;
+	uint32_t tx_count;
+	uint32_t rx_count;
+	char metric[48];
+
+	bench_pkt_stats_get(&end);
+
+	/* The time statistics are accumulated in microseconds */
+	tx_count = end.tx_count - start->tx_count;
+	rx_count = end.rx_count - start->rx_count;
+
+	snprintk(metric, sizeof(metric), "%s.tx", prefix);
+	bench_report_us(metric, tx_count, end.tx_sum - start->tx_sum);
+	snprintk(metric, sizeof(metric), "%s.rx", prefix);
+	bench_report_us(metric, rx_count, end.rx_sum - start->rx_sum);
+
+#if defined(CONFIG_NET_PKT_TXTIME_STATS_DETAIL)
+	for (int i = 0; i < NET_PKT_DETAIL_STATS_COUNT; i++) {
+		snprintk(metric, sizeof(metric), "%s.tx.%d", prefix, i);
+		bench_report_us(metric, tx_count, end.tx_detail[i] - start->tx_detail[i]);
+	}
+#endif
+#if defined(CONFIG_NET_PKT_RXTIME_STATS_DETAIL)
+	for (int i = 0; i < NET_PKT_DETAIL_STATS_COUNT; i++) {
+		snprintk(metric, sizeof(metric), "%s.rx.%d", prefix, i);
+		bench_report_us(metric, rx_count, end.rx_detail[i] - start->rx_detail[i]);
+	}
+#endif
+}
+
+int main(void)
+{
+	timing_init();
+	timing_start();
+
+	printk("NET_BENCH,metric,samples,cycles,ns\n");
+
+	bench_buf();
+	bench_chksum();
+	bench_udp();
+	bench_tcp();
+
+	timing_stop();
+
+	printk("PROJECT EXECUTION SUCCESSFUL\n");
+
+	return 0;
+}
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * TCP segments sent and received through a connection over the loopback
+ * interface. The acknowledgments are part of the stack statistics.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/sys/printk.h>
+
+#include "bench.h"
+
+static uint8_t tx_data[1024];
+static uint8_t rx_data[1024];
+
+static int tcp_connect(int *client, int *server)
+{
+	struct sockaddr_in addr = {
+		.sin_family = AF_INET,
+		.sin_port = htons(BENCH_TCP_PORT),
+		.sin_addr = INADDR_LOOPBACK_INIT,
+	};
+	int listener;
+	int ret = -1;
+
+	*client = -1;
+	*server = -1;
+
+	listener = zsock_socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	if (listener < 0) {
+		printk("Cannot create a TCP socket (%d)\n", errno);
+		return -1;
+	}
+
+	if (zsock_bind(listener, (struct sockaddr *)&addr, sizeof(addr)) < 0 ||
+	    zsock_listen(listener, 1) < 0) {
+		printk("Cannot listen on TCP port %u (%d)\n", BENCH_TCP_PORT, errno);
+		goto out;
+	}
+
+	*client = zsock_socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	if (*client < 0) {
+		printk("Cannot create a TCP socket (%d)\n", errno);
+		goto out;
+	}
+
+	if (zsock_connect(*client, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+		printk("Cannot connect to TCP port %u (%d)\n", BENCH_TCP_PORT, errno);
+		goto out;
+	}
+
+	*server = zsock_accept(listener, NULL, NULL);
+	if (*server < 0) {
+		printk("Cannot accept the TCP connection (%d)\n", errno);
+		goto out;
+	}
+
+	ret = 0;
+
+out:
+	zsock_close(listener);
+
+	return ret;
+}
+
+static int tcp_recv_all(int sock, size_t size)
+{
+	size_t received = 0;
+	ssize_t ret;
+
+	while (received < size) {
+		ret = zsock_recv(sock, rx_data, size - received, 0);
+		if (ret <= 0) {
+			printk("Cannot receive %zu bytes (%d)\n", size, errno);
+			return -1;
+		}
+
+		received += ret;
+	}
+
+	return 0;
+}
+
+static void bench_tcp_size(int client, int server, size_t size)
+{
+	struct bench_pkt_stats stats;
+	uint64_t send_cycles = 0;
+	uint64_t recv_cycles = 0;
+	timing_t start;
+	timing_t mid;
+	timing_t end;
+	char metric[32];
+	ssize_t ret;
+
+	bench_pkt_stats_get(&stats);
+
+	for (int i = 0; i < NUM_ITERATIONS; i++) {
+		start = timing_counter_get();
+		ret = zsock_send(client, tx_data, size, 0);
+		mid = timing_counter_get();
+		if (ret != (ssize_t)size) {
+			printk("Cannot send %zu bytes (%d)\n", size, errno);
+			return;
+		}
+
+		if (tcp_recv_all(server, size) < 0) {
+			return;
+		}
+		end = timing_counter_get();
+
+		send_cycles += timing_cycles_get(&start, &mid);
+		recv_cycles += timing_cycles_get(&mid, &end);
+	}
+
+	snprintk(metric, sizeof(metric), "tcp.send.%zu", size);
+	bench_report(metric, NUM_ITERATIONS, send_cycles);
+	snprintk(metric, sizeof(metric), "tcp.recv.%zu", size);
+	bench_report(metric, NUM_ITERATIONS, recv_cycles);
+
+	snprintk(metric, sizeof(metric), "tcp.stack.%zu", size);
+	bench_pkt_stats_report(metric, &stats);
+}
+
+void bench_tcp(void)
+{
+	int client;
+	int server;
+
+	for (size_t i = 0; i < sizeof(tx_data); i++) {
+		tx_data[i] = (uint8_t)i;
+	}
+
+	if (tcp_connect(&client, &server) == 0) {
+		bench_tcp_size(client, server, 64);
+		bench_tcp_size(client, server, 1024);
+	}
+
+	if (server >= 0) {
+		zsock_close(server);
+	}
+
+	if (client >= 0) {
+		zsock_close(client);
+	}
+}
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * UDP datagrams sent and received through the sockets over the loopback
+ * interface, the overhead of socket calls which do not move any data, and
+ * the cost of the connection lookup as more UDP sockets are bound.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/sys/printk.h>
+
+#include "bench.h"
+
+#define EXTRA_SOCKETS_MAX 32
+
+static uint8_t tx_data[1024];
+static uint8_t rx_data[1024];
+
+static int extra_sock[EXTRA_SOCKETS_MAX];
+static int num_extra_sock;
+
+static int udp_socket(uint16_t port, bool do_bind)
+{
+	struct sockaddr_in addr = {
+		.sin_family = AF_INET,
+		.sin_port = htons(port),
+		.sin_addr = INADDR_LOOPBACK_INIT,
+	};
+	int sock;
+
+	sock = zsock_socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+	if (sock < 0) {
+		printk("Cannot create a UDP socket (%d)\n", errno);
+		return -1;
+	}
+
+	if (do_bind) {
+		if (zsock_bind(sock, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+			printk("Cannot bind UDP port %u (%d)\n", port, errno);
+			zsock_close(sock);
+			return -1;
+		}
+	} else {
+		if (zsock_connect(sock, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+			printk("Cannot connect to UDP port %u (%d)\n", port, errno);
+			zsock_close(sock);
+			return -1;
+		}
+	}
+
+	return sock;
+}
+
+static int udp_transfer(int tx, int rx, size_t size, uint64_t *send_cycles,
+			uint64_t *recv_cycles)
+{
+	timing_t start;
+	timing_t mid;
+	timing_t end;
+	ssize_t ret;
+
+	start = timing_counter_get();
+	ret = zsock_send(tx, tx_data, size, 0);
+	mid = timing_counter_get();
+	if (ret != (ssize_t)size) {
+		printk("Cannot send %zu bytes (%d)\n", size, errno);
+		return -1;
+	}
+
+	ret = zsock_recv(rx, rx_data, sizeof(rx_data), 0);
+	end = timing_counter_get();
+	if (ret != (ssize_t)size) {
+		printk("Cannot receive %zu bytes (%d)\n", size, errno);
+		return -1;
+	}
+
+	*send_cycles += timing_cycles_get(&start, &mid);
+	*recv_cycles += timing_cycles_get(&mid, &end);
+
+	return 0;
+}
+
+static void bench_udp_size(int tx, int rx, size_t size)
+{
+	struct bench_pkt_stats stats;
+	uint64_t send_cycles = 0;
+	uint64_t recv_cycles = 0;
+	char metric[32];
+
+	bench_pkt_stats_get(&stats);
+
+	for (int i = 0; i < NUM_ITERATIONS; i++) {
+		if (udp_transfer(tx, rx, size, &send_cycles, &recv_cycles) < 0) {
+			return;
+		}
+	}
+
+	snprintk(metric, sizeof(metric), "udp.send.%zu", size);
+	bench_report(metric, NUM_ITERATIONS, send_cycles);
+	snprintk(metric, sizeof(metric), "udp.recv.%zu", size);
+	bench_report(metric, NUM_ITERATIONS, recv_cycles);
+
+	snprintk(metric, sizeof(metric), "udp.stack.%zu", size);
+	bench_pkt_stats_report(metric, &stats);
+}
+
+/* Socket calls which return straight away, as there is nothing to receive */
+static void bench_socket_calls(int rx)
+{
+	struct zsock_pollfd fds = {
+		.fd = rx,
+		.events = ZSOCK_POLLIN,
+	};
+	timing_t start;
+	timing_t end;
+	uint64_t recv_cycles = 0;
+	uint64_t poll_cycles = 0;
+
+	for (int i = 0; i < NUM_ITERATIONS; i++) {
+		start = timing_counter_get();
+		(void)zsock_recv(rx, rx_data, sizeof(rx_data), ZSOCK_MSG_DONTWAIT);
+		end = timing_counter_get();
+
+		recv_cycles += timing_cycles_get(&start, &end);
+
+		start = timing_counter_get();
+		(void)zsock_poll(&fds, 1, 0);
+		end = timing_counter_get();
+
+		poll_cycles += timing_cycles_get(&start, &end);
+	}
+
+	bench_report("socket.recv.empty", NUM_ITERATIONS, recv_cycles);
+	bench_report("socket.poll.empty", NUM_ITERATIONS, poll_cycles);
+}
+
+/*
+ * The receiving socket is bound first, and then searched last by the
+ * connection lookup when the connections are kept in a list.
+ */
+static void bench_conn_lookup(int tx, int rx)
+{
+	static const int counts[] = { 0, 4, 8, 16, EXTRA_SOCKETS_MAX };
+	uint64_t send_cycles;
+	uint64_t recv_cycles;
+	char metric[32];
+
+	for (size_t i = 0; i < ARRAY_SIZE(counts); i++) {
+		while (num_extra_sock < counts[i]) {
+			int sock = udp_socket(BENCH_EXTRA_PORT + num_extra_sock, true);
+
+			if (sock < 0) {
+				return;
+			}
+
+			extra_sock[num_extra_sock++] = sock;
+		}
+
+		send_cycles = 0;
+		recv_cycles = 0;
+
+		for (int j = 0; j < NUM_ITERATIONS; j++) {
+			if (udp_transfer(tx, rx, 64, &send_cycles, &recv_cycles) < 0) {
+				return;
+			}
+		}
+
+		snprintk(metric, sizeof(metric), "udp.conn.%d", counts[i]);
+		bench_report(metric, NUM_ITERATIONS, send_cycles);
+	}
+}
+
+void bench_udp(void)
+{
+	int rx;
+	int tx;
+
+	for (size_t i = 0; i < sizeof(tx_data); i++) {
+		tx_data[i] = (uint8_t)i;
+	}
+
+	rx = udp_socket(BENCH_UDP_PORT, true);
+	tx = udp_socket(BENCH_UDP_PORT, false);
+	if (rx < 0 || tx < 0) {
+		goto out;
+	}
+
+	bench_udp_size(tx, rx, 64);
+	bench_udp_size(tx, rx, 1024);
+	bench_socket_calls(rx);
+	bench_conn_lookup(tx, rx);
+
+out:
+	while (num_extra_sock > 0) {
+		zsock_close(extra_sock[--num_extra_sock]);
+	}
+
+	if (tx >= 0) {
+		zsock_close(tx);
+	}
+
+	if (rx >= 0) {
+		zsock_close(rx);
+	}
+}
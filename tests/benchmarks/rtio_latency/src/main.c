@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <inttypes.h>
+#include <zephyr/kernel.h>
+#include <zephyr/irq_offload.h>
+#include <zephyr/rtio/rtio.h>
+#include <zephyr/rtio/rtio_workq.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/timing/timing.h>
+
+/* Round trips of no-op submissions, completed by the submit function, from
+ * an interrupt or by the RTIO work queue.
+ */
+
+#define ROUND_TRIPS 10000
+
+RTIO_DEFINE(bench_rtio, 1, 1);
+
+static void direct_submit(struct rtio_iodev_sqe *iodev_sqe)
+{
+	rtio_iodev_sqe_ok(iodev_sqe, 0);
+}
+
+static void isr_complete(const void *arg)
+{
+	rtio_iodev_sqe_ok((struct rtio_iodev_sqe *)arg, 0);
+}
+
+static void isr_submit(struct rtio_iodev_sqe *iodev_sqe)
+{
+	irq_offload(isr_complete, iodev_sqe);
+}
+
+static void workq_handler(struct rtio_iodev_sqe *iodev_sqe)
+{
+	rtio_iodev_sqe_ok(iodev_sqe, 0);
+}
+
+static void workq_submit(struct rtio_iodev_sqe *iodev_sqe)
+{
+	rtio_workq_submit(iodev_sqe, workq_handler);
+}
+
+static const struct rtio_iodev_api direct_api = { .submit = direct_submit };
+static const struct rtio_iodev_api isr_api = { .submit = isr_submit };
+static const struct rtio_iodev_api workq_api = { .submit = workq_submit };
+
+RTIO_IODEV_DEFINE(direct_iodev, &direct_api, NULL);
+RTIO_IODEV_DEFINE(isr_iodev, &isr_api, NULL);
+RTIO_IODEV_DEFINE(workq_iodev, &workq_api, NULL);
+
+static int bench(const char *name, struct rtio_iodev *iodev)
+{
+	timing_t start, end;
+	struct rtio_sqe *sqe;
+	struct rtio_cqe *cqe;
+	uint64_t ns;
+	int rc = 0;
+
+	start = timing_counter_get();
+	for (uint32_t i = 0; (i < ROUND_TRIPS) && (rc == 0); i++) {
+		sqe = rtio_sqe_acquire(&bench_rtio);
+		if (sqe == NULL) {
+			return -ENOMEM;
+		}
+		rtio_sqe_prep_nop(sqe, iodev, NULL);
+
+		rc = rtio_submit(&bench_rtio, 1);
+		cqe = rtio_cqe_consume(&bench_rtio);
+		if ((rc == 0) && (cqe != NULL)) {
+			rc = cqe->result;
+		}
+		if (cqe != NULL) {
+			rtio_cqe_release(&bench_rtio, cqe);
+		}
+	}
+	end = timing_counter_get();
+
+	if (rc == 0) {
+		ns = timing_cycles_to_ns(timing_cycles_get(&start, &end));
+		printk("%-6s: %u submissions, %" PRIu64 " ns per round trip\n", name,
+		       ROUND_TRIPS, ns / ROUND_TRIPS);
+	}
+
+	return rc;
+}
+
+int main(void)
+{
+	int rc;
+
+	timing_init();
+	timing_start();
+
+	rc = bench("direct", &direct_iodev);
+	if (rc == 0) {
+		rc = bench("isr", &isr_iodev);
+	}
+	if (rc == 0) {
+		rc = bench("workq", &workq_iodev);
+	}
+
+	timing_stop();
+
+	if (rc != 0) {
+		printk("benchmark failed (%d)\n", rc);
+		return 0;
+	}
+
+	printk("fin\n");
+
+	return 0;
+}
@@ -32,6 +32,15 @@
 #define N_RUNS 1000
 #define N_SETTLE 10
 
+/* On SMP, a second phase measures scheduler throughput with every CPU
+ * busy: SMP_THREADS_PER_CPU threads per CPU pass semaphore tokens
+ * around a ring, one token per CPU, so that all CPUs keep readying,
+ * pending and switching threads concurrently.
+ */
+#define SMP_THREADS_PER_CPU 4
+#define SMP_MAX_THREADS (SMP_THREADS_PER_CPU * CONFIG_MP_MAX_NUM_CPUS)
+#define SMP_PASSES 2000
+
 
 static K_THREAD_STACK_DEFINE(partner_stack, 1024);
 static struct k_thread partner_thread;
@@ -86,6 +95,72 @@ static void partner_fn(void *arg1, void *arg2, void *arg3)
 	}
 }
 
+#ifdef CONFIG_SMP
+static K_THREAD_STACK_ARRAY_DEFINE(ring_stacks, SMP_MAX_THREADS, 1024);
+static struct k_thread ring_threads[SMP_MAX_THREADS];
+static struct k_sem ring_sems[SMP_MAX_THREADS];
+static struct k_sem ring_done;
+static int ring_len;
+
+static void ring_fn(void *arg1, void *arg2, void *arg3)
+{
+	int idx = POINTER_TO_INT(arg1);
+
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+
+	for (int i = 0; i < SMP_PASSES; i++) {
+		k_sem_take(&ring_sems[idx], K_FOREVER);
+		k_sem_give(&ring_sems[(idx + 1) % ring_len]);
+	}
+
+	k_sem_give(&ring_done);
+}
+
+static void smp_bench(int prio)
+{
+	unsigned int num_cpus = arch_num_cpus();
+	int64_t start;
+	int32_t ms;
+
+	ring_len = SMP_THREADS_PER_CPU * num_cpus;
+	k_sem_init(&ring_done, 0, ring_len);
+
+	for (int i = 0; i < ring_len; i++) {
+		k_sem_init(&ring_sems[i], 0, K_SEM_MAX_LIMIT);
+		k_thread_create(&ring_threads[i], ring_stacks[i],
+				K_THREAD_STACK_SIZEOF(ring_stacks[i]),
+				ring_fn, INT_TO_POINTER(i), NULL, NULL,
+				prio, 0, K_FOREVER);
+	}
+
+	start = k_uptime_get();
+
+	for (int i = 0; i < ring_len; i++) {
+		k_thread_start(&ring_threads[i]);
+	}
+
+	/* One token per CPU, spread evenly around the ring */
+	for (int i = 0; i < num_cpus; i++) {
+		k_sem_give(&ring_sems[i * SMP_THREADS_PER_CPU]);
+	}
+
+	for (int i = 0; i < ring_len; i++) {
+		k_sem_take(&ring_done, K_FOREVER);
+	}
+
+	ms = (int32_t)(k_uptime_get() - start);
+
+	for (int i = 0; i < ring_len; i++) {
+		k_thread_join(&ring_threads[i], K_FOREVER);
+	}
+
+	printk("smp cpus %d threads %d passes %d time %d ms (%d ns per pass)\n",
+	       num_cpus, ring_len, ring_len * SMP_PASSES, ms,
+	       (int32_t)(((int64_t)ms * 1000000) / (ring_len * SMP_PASSES)));
+}
+#endif
+
 int main(void)
 {
 	z_waitq_init(&waitq);
@@ -148,6 +223,14 @@ int main(void)
 		       stamps[4] - stamps[3],
 		       whole, avg);
 	}
+
+#ifdef CONFIG_SMP
+	/* Below main's priority, so main sets up the whole ring before
+	 * the first token moves.
+	 */
+	smp_bench(main_prio + 1);
+#endif
+
 	printk("fin\n");
 	return 0;
 }
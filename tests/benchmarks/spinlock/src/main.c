@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/timing/timing.h>
+
+/* This is a contention benchmark of k_spinlock.  One thread is pinned
+ * to each CPU, and every thread loops for RUN_MS milliseconds:
+ *
+ * 1. Take the shared lock, timing how long k_spin_lock() waited.
+ * 2. Hold it for a number of loop iterations.
+ * 3. Release it and spin a little so that the other CPUs get a chance.
+ *
+ * The wait times are collected in power of two histograms of cycles.
+ */
+
+#define RUN_MS 500
+#define OUTSIDE_LOOPS 20
+#define NUM_BUCKETS 32
+#define STACK_SIZE 1024
+
+static const uint32_t hold_loops[] = { 0, 50, 500 };
+
+struct cpu_result {
+	uint32_t acquisitions;
+	uint64_t wait_total;
+	uint64_t wait_max;
+	uint32_t hist[NUM_BUCKETS];
+};
+
+static struct k_spinlock bench_lock;
+static volatile uint32_t shared_counter;
+static atomic_t ready;
+static uint64_t run_cycles;
+static uint32_t cur_hold;
+
+static struct cpu_result results[CONFIG_MP_MAX_NUM_CPUS];
+static struct k_thread threads[CONFIG_MP_MAX_NUM_CPUS];
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, CONFIG_MP_MAX_NUM_CPUS, STACK_SIZE);
+
+static void spin_loops(uint32_t loops)
+{
+	for (volatile uint32_t i = 0; i < loops; i++) {
+	}
+}
+
+static void bench_thread(void *p1, void *p2, void *p3)
+{
+	struct cpu_result *res = p1;
+	unsigned int num_cpus = POINTER_TO_UINT(p2);
+	timing_t start, now, t0, t1;
+	k_spinlock_key_t key;
+
+	ARG_UNUSED(p3);
+
+	/* Start all CPUs at the same time */
+	atomic_inc(&ready);
+	while (atomic_get(&ready) < num_cpus) {
+		arch_spin_relax();
+	}
+
+	start = timing_counter_get();
+	do {
+		uint64_t wait;
+
+		t0 = timing_counter_get();
+		key = k_spin_lock(&bench_lock);
+		t1 = timing_counter_get();
+
+		shared_counter++;
+		spin_loops(cur_hold);
+		k_spin_unlock(&bench_lock, key);
+
+		wait = timing_cycles_get(&t0, &t1);
+		res->acquisitions++;
+		res->wait_total += wait;
+		res->wait_max = MAX(res->wait_max, wait);
+		res->hist[MIN(wait == 0 ? 0 : (64 - __builtin_clzll(wait)),
+			      NUM_BUCKETS - 1)]++;
+
+		spin_loops(OUTSIDE_LOOPS);
+		now = timing_counter_get();
+	} while (timing_cycles_get(&start, &now) < run_cycles);
+}
+
+static void run(uint32_t hold)
+{
+	unsigned int num_cpus = arch_num_cpus();
+	uint32_t hist[NUM_BUCKETS] = { 0 };
+	uint32_t total = 0;
+
+	memset(results, 0, sizeof(results));
+	atomic_set(&ready, 0);
+	shared_counter = 0;
+	cur_hold = hold;
+
+	/* Keep our own CPU's benchmark thread from spinning at the start
+	 * barrier before all the other threads are running.
+	 */
+	k_sched_lock();
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		k_thread_create(&threads[i], stacks[i], STACK_SIZE,
+				bench_thread, &results[i], UINT_TO_POINTER(num_cpus),
+				NULL, K_PRIO_COOP(2), 0, K_FOREVER);
+		k_thread_cpu_pin(&threads[i], i);
+		k_thread_start(&threads[i]);
+	}
+	k_sched_unlock();
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		k_thread_join(&threads[i], K_FOREVER);
+	}
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		struct cpu_result *res = &results[i];
+
+		printk("  cpu %u acquisitions %u wait avg %u ns max %u ns\n", i,
+		       res->acquisitions,
+		       (uint32_t)timing_cycles_to_ns_avg(res->wait_total,
+							 MAX(res->acquisitions, 1)),
+		       (uint32_t)timing_cycles_to_ns(res->wait_max));
+
+		total += res->acquisitions;
+		for (int b = 0; b < NUM_BUCKETS; b++) {
+			hist[b] += res->hist[b];
+		}
+	}
+
+	for (int b = 0; b < NUM_BUCKETS; b++) {
+		if (hist[b] != 0) {
+			printk("  wait < %u ns: %u\n",
+			       (uint32_t)timing_cycles_to_ns(BIT64(b)), hist[b]);
+		}
+	}
+
+	if (shared_counter != total) {
+		printk("  ERROR: counter %u, %u acquisitions\n", shared_counter, total);
+	}
+
+	printk("spinlock cpus %u hold %u acquisitions %u (%s)\n", num_cpus, hold,
+	       total, IS_ENABLED(CONFIG_TICKET_SPINLOCKS) ? "ticket" :
+	       IS_ENABLED(CONFIG_MCS_SPINLOCKS) ? "mcs" : "tas");
+}
+
+int main(void)
+{
+	timing_init();
+	timing_start();
+
+	run_cycles = timing_freq_get() * RUN_MS / MSEC_PER_SEC;
+
+	for (int i = 0; i < ARRAY_SIZE(hold_loops); i++) {
+		run(hold_loops[i]);
+	}
+
+	timing_stop();
+	printk("fin\n");
+	return 0;
+}
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/timing/timing.h>
+#include <timeout_q.h>
+
+/* This is a microbenchmark of the kernel timeout queue.  For each
+ * population size it:
+ *
+ * 1. Arms N timeouts with pseudo-random expiries a few seconds out
+ *    and measures the average z_add_timeout() cost.
+ * 2. Aborts all of them and measures the average z_abort_timeout()
+ *    cost.
+ * 3. Arms N timeouts that all expire on the same tick and measures
+ *    the time from the first to the last callback, which is the
+ *    per-timeout cost of expiring them in sys_clock_announce().
+ */
+
+#define MAX_TIMEOUTS 10000
+
+static const int counts[] = { 10, 100, MAX_TIMEOUTS };
+
+static struct _timeout timeouts[MAX_TIMEOUTS];
+
+static volatile int fired;
+static timing_t first_fired, last_fired;
+
+static uint32_t rand_state = 1;
+
+static uint32_t next_rand(void)
+{
+	/* Deterministic LCG so that every run arms the same pattern */
+	rand_state = rand_state * 1103515245U + 12345U;
+	return rand_state >> 8;
+}
+
+static void dummy_fn(struct _timeout *t)
+{
+	ARG_UNUSED(t);
+}
+
+static void expire_fn(struct _timeout *t)
+{
+	ARG_UNUSED(t);
+
+	last_fired = timing_counter_get();
+	if (fired++ == 0) {
+		first_fired = last_fired;
+	}
+}
+
+static uint32_t per_timeout_ns(timing_t start, timing_t end, int n)
+{
+	return (uint32_t)(timing_cycles_to_ns(timing_cycles_get(&start, &end)) / n);
+}
+
+static void run(int n)
+{
+	k_ticks_t base = k_ms_to_ticks_ceil32(1000);
+	k_ticks_t spread = k_ms_to_ticks_ceil32(4000);
+	uint32_t insert_ns, abort_ns, expire_ns;
+	timing_t start, end;
+	k_ticks_t target;
+
+	rand_state = 1;
+
+	start = timing_counter_get();
+	for (int i = 0; i < n; i++) {
+		z_add_timeout(&timeouts[i], dummy_fn,
+			      K_TICKS(base + next_rand() % spread));
+	}
+	end = timing_counter_get();
+	insert_ns = per_timeout_ns(start, end, n);
+
+	start = timing_counter_get();
+	for (int i = 0; i < n; i++) {
+		z_abort_timeout(&timeouts[i]);
+	}
+	end = timing_counter_get();
+	abort_ns = per_timeout_ns(start, end, n);
+
+	fired = 0;
+	target = sys_clock_tick_get() + k_ms_to_ticks_ceil32(100);
+	for (int i = 0; i < n; i++) {
+		z_add_timeout(&timeouts[i], expire_fn,
+			      K_TIMEOUT_ABS_TICKS(target));
+	}
+
+	while (fired < n) {
+		k_msleep(10);
+	}
+	expire_ns = per_timeout_ns(first_fired, last_fired, n);
+
+	printk("timeouts %5d insert %6u abort %6u expire %6u (ns per timeout)\n",
+	       n, insert_ns, abort_ns, expire_ns);
+}
+
+int main(void)
+{
+	timing_init();
+	timing_start();
+
+	printk("timeout backend: %s\n",
+	       IS_ENABLED(CONFIG_TIMEOUT_WHEEL) ? "timer wheel" : "delta list");
+
+	for (int i = 0; i < ARRAY_SIZE(counts); i++) {
+		run(counts[i]);
+	}
+
+	timing_stop();
+	printk("fin\n");
+
+	return 0;
+}
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/buf.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/zbus/zbus.h>
+
+/* The publisher runs below the message subscriber threads, which release
+ * every message as soon as it is published, so the time reported covers the
+ * publication and the delivery to all the observers.
+ */
+
+#define PUB_COUNT 10000
+#define MSG_SUBS 4
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define SUB_PRIO K_PRIO_PREEMPT(1)
+#define PUB_PRIO K_PRIO_PREEMPT(2)
+
+struct bench_msg {
+	uint8_t data[64];
+};
+
+static atomic_t received;
+
+static void listener_cb(const struct zbus_channel *chan)
+{
+	ARG_UNUSED(chan);
+
+	(void)atomic_inc(&received);
+}
+
+ZBUS_LISTENER_DEFINE(lis0, listener_cb);
+ZBUS_LISTENER_DEFINE(lis1, listener_cb);
+
+ZBUS_MSG_SUBSCRIBER_DEFINE(msub0);
+ZBUS_MSG_SUBSCRIBER_DEFINE(msub1);
+ZBUS_MSG_SUBSCRIBER_DEFINE(msub2);
+ZBUS_MSG_SUBSCRIBER_DEFINE(msub3);
+
+ZBUS_CHAN_DEFINE(lis_chan, struct bench_msg, NULL, NULL, ZBUS_OBSERVERS(lis0, lis1),
+		 ZBUS_MSG_INIT(0));
+
+ZBUS_CHAN_DEFINE(msub_chan, struct bench_msg, NULL, NULL,
+		 ZBUS_OBSERVERS(msub0, msub1, msub2, msub3), ZBUS_MSG_INIT(0));
+
+static void msg_sub_thread(void *p1, void *p2, void *p3)
+{
+	const struct zbus_observer *sub = p1;
+	const struct zbus_channel *chan;
+	struct net_buf *buf;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (zbus_sub_wait_msg_buf(sub, &chan, &buf, K_FOREVER) == 0) {
+		net_buf_unref(buf);
+		(void)atomic_inc(&received);
+	}
+}
+
+K_THREAD_DEFINE(msub0_thread, STACK_SIZE, msg_sub_thread, &msub0, NULL, NULL, SUB_PRIO, 0, 0);
+K_THREAD_DEFINE(msub1_thread, STACK_SIZE, msg_sub_thread, &msub1, NULL, NULL, SUB_PRIO, 0, 0);
+K_THREAD_DEFINE(msub2_thread, STACK_SIZE, msg_sub_thread, &msub2, NULL, NULL, SUB_PRIO, 0, 0);
+K_THREAD_DEFINE(msub3_thread, STACK_SIZE, msg_sub_thread, &msub3, NULL, NULL, SUB_PRIO, 0, 0);
+
+static void run(const char *name, const struct zbus_channel *chan, unsigned int observers)
+{
+	struct bench_msg msg = {0};
+	uint32_t start, cycles;
+	uint64_t ns;
+	int failed = 0;
+
+	atomic_set(&received, 0);
+
+	start = k_cycle_get_32();
+	for (int i = 0; i < PUB_COUNT; i++) {
+		msg.data[0] = (uint8_t)i;
+		if (zbus_chan_pub(chan, &msg, K_FOREVER) != 0) {
+			failed++;
+		}
+	}
+	while (atomic_get(&received) < (atomic_val_t)((PUB_COUNT - failed) * observers)) {
+		k_yield();
+	}
+	cycles = k_cycle_get_32() - start;
+
+	ns = k_cyc_to_ns_floor64(cycles);
+	printk("%-15s pubs %6u time %8u us (%6u ns per pub)\n", name, PUB_COUNT,
+	       (uint32_t)(ns / 1000U), (uint32_t)(ns / PUB_COUNT));
+
+	if (failed != 0) {
+		printk("%s: %d publications failed\n", name, failed);
+	}
+}
+
+int main(void)
+{
+	k_thread_priority_set(k_current_get(), PUB_PRIO);
+
+	printk("msg_subscriber buffers: %s\n",
+	       IS_ENABLED(CONFIG_ZBUS_MSG_SUBSCRIBER_BUF_ALLOC_DYNAMIC) ? "heap" : "static");
+
+	run("listeners", &lis_chan, 2);
+	run("msg_subscribers", &msub_chan, MSG_SUBS);
+
+	printk("fin\n");
+
+	return 0;
+}
@@ -230,6 +230,51 @@ ZTEST(test_gatt, test_gatt_foreach)
 	}
 }
 
+ZTEST(test_gatt, test_gatt_foreach_range)
+{
+	const struct bt_gatt_attr *attr;
+	uint16_t num;
+
+	/* Make sure the services are registered */
+	bt_gatt_service_unregister(&test_svc);
+	bt_gatt_service_unregister(&test1_svc);
+	zassert_false(bt_gatt_service_register(&test_svc),
+		     "Test service registration failed");
+	zassert_false(bt_gatt_service_register(&test1_svc),
+		     "Test service1 registration failed");
+
+	/* Find characteristics within the second service only */
+	num = 0;
+	bt_gatt_foreach_attr_type(test1_attrs[0].handle, 0xffff,
+				  BT_UUID_GATT_CHRC, NULL, 0, count_attr, &num);
+	zassert_equal(num, 1, "Number of attributes don't match");
+
+	/* Find characteristics within the first service only */
+	num = 0;
+	bt_gatt_foreach_attr_type(test_attrs[0].handle,
+				  test_attrs[ARRAY_SIZE(test_attrs) - 1].handle,
+				  BT_UUID_GATT_CHRC, NULL, 0, count_attr, &num);
+	zassert_equal(num, 1, "Number of attributes don't match");
+
+	/* The first match is the one with the lowest handle */
+	attr = NULL;
+	bt_gatt_foreach_attr_type(test_attrs[0].handle, 0xffff,
+				  BT_UUID_GATT_CHRC, NULL, 1, find_attr, &attr);
+	zassert_equal_ptr(attr, &test_attrs[1], "Attribute don't match");
+
+	/* Look up a single handle */
+	attr = NULL;
+	bt_gatt_foreach_attr(test1_attrs[2].handle, test1_attrs[2].handle,
+			     find_attr, &attr);
+	zassert_equal_ptr(attr, &test1_attrs[2], "Attribute don't match");
+
+	/* Nothing past the last handle */
+	num = 0;
+	bt_gatt_foreach_attr(test1_attrs[ARRAY_SIZE(test1_attrs) - 1].handle + 1,
+			     0xffff, count_attr, &num);
+	zassert_equal(num, 0, "Number of attributes don't match");
+}
+
 ZTEST(test_gatt, test_gatt_read)
 {
 	const struct bt_gatt_attr *attr;
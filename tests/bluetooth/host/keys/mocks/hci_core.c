@@ -5,7 +5,11 @@
  */
 
 #include <zephyr/kernel.h>
+#include <zephyr/bluetooth/hci.h>
+#include <host/hci_core.h>
 #include "mocks/hci_core.h"
 
+struct bt_dev bt_dev;
+
 DEFINE_FAKE_VALUE_FUNC(int, bt_unpair, uint8_t, const bt_addr_le_t *);
 DEFINE_FAKE_VOID_FUNC(bt_id_add, struct bt_keys *);
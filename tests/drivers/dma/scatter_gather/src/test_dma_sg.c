@@ -12,6 +12,7 @@
  *   -# Set dma configuration for scatter gather enable
  *   -# Set direction memory-to-memory with two block transfers
  *   -# Start transfer tx -> rx
+ *   -# Repeat with a transfer prepared once and submitted twice
  * - Expected Results
  *   -# Data is transferred correctly from src buffers to dest buffers without
  *      software intervention.
@@ -39,6 +40,7 @@ K_SEM_DEFINE(xfer_sem, 0, 1);
 
 static struct dma_config dma_cfg = {0};
 static struct dma_block_config dma_block_cfgs[XFERS];
+static struct dma_prepared dma_prep;
 
 static void dma_sg_callback(const struct device *dma_dev, void *user_data,
 			    uint32_t channel, int status)
@@ -51,7 +53,21 @@ static void dma_sg_callback(const struct device *dma_dev, void *user_data,
 	}
 }
 
-static int test_sg(void)
+static int test_sg_verify(void)
+{
+	TC_PRINT("Verify RX buffer should contain the full TX buffer string.\n");
+
+	for (int i = 0; i < XFERS; i++) {
+		TC_PRINT("rx_data[%d]\n", i);
+		if (memcmp(tx_data, rx_data[i], XFER_SIZE)) {
+			return TC_FAIL;
+		}
+	}
+
+	return TC_PASS;
+}
+
+static int test_sg(bool prepared)
 {
 	const struct device *dma;
 	static int chan_id;
@@ -122,6 +138,40 @@ static int test_sg(void)
 		}
 	}
 
+	if (prepared) {
+		TC_PRINT("Preparing the scatter-gather transfer on channel %d\n", chan_id);
+
+		if (dma_prepare(dma, chan_id, &dma_cfg, &dma_prep)) {
+			TC_PRINT("ERROR: transfer prepare (%d)\n", chan_id);
+			return TC_FAIL;
+		}
+
+		for (int n = 0; n < 2; n++) {
+			memset(rx_data, 0, sizeof(rx_data));
+
+			TC_PRINT("Submitting the transfer, round %d\n", n);
+
+			if (dma_submit(dma, &dma_prep)) {
+				TC_PRINT("ERROR: transfer submit (%d)\n", chan_id);
+				return TC_FAIL;
+			}
+
+			if (k_sem_take(&xfer_sem, K_MSEC(1000)) != 0) {
+				TC_PRINT("Timed out waiting for xfers\n");
+				return TC_FAIL;
+			}
+
+			if (test_sg_verify() != TC_PASS) {
+				return TC_FAIL;
+			}
+		}
+
+		dma_release_channel(dma, chan_id);
+
+		TC_PRINT("Finished: DMA prepared Scatter-Gather\n");
+		return TC_PASS;
+	}
+
 	TC_PRINT("Configuring the scatter-gather transfer on channel %d\n", chan_id);
 
 	if (dma_config(dma, chan_id, &dma_cfg)) {
@@ -141,15 +191,12 @@ static int test_sg(void)
 		return TC_FAIL;
 	}
 
-	TC_PRINT("Verify RX buffer should contain the full TX buffer string.\n");
-
-	for (int i = 0; i < XFERS; i++) {
-		TC_PRINT("rx_data[%d]\n", i);
-		if (memcmp(tx_data, rx_data[i], XFER_SIZE)) {
-			return TC_FAIL;
-		}
+	if (test_sg_verify() != TC_PASS) {
+		return TC_FAIL;
 	}
 
+	dma_release_channel(dma, chan_id);
+
 	TC_PRINT("Finished: DMA Scatter-Gather\n");
 	return TC_PASS;
 }
@@ -157,5 +204,10 @@ static int test_sg(void)
 /* export test cases */
 ZTEST(dma_m2m_sg, test_dma_m2m_sg)
 {
-	zassert_true((test_sg() == TC_PASS));
+	zassert_true((test_sg(false) == TC_PASS));
+}
+
+ZTEST(dma_m2m_sg, test_dma_m2m_sg_prepared)
+{
+	zassert_true((test_sg(true) == TC_PASS));
 }
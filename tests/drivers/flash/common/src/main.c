@@ -148,4 +148,58 @@ ZTEST(flash_driver, test_read_unaligned_address)
 	}
 }
 
+#ifdef CONFIG_FLASH_RTIO
+RTIO_DEFINE(flash_rtio_ctx, 4, 2);
+FLASH_IODEV_DEFINE(flash_iodev, TEST_AREA_DEVICE);
+
+static int rtio_run(struct rtio_sqe *sqe, void *userdata)
+{
+	struct rtio_cqe *cqe;
+	int rc;
+
+	zassert_not_null(sqe, "request not queued");
+	zassert_ok(rtio_submit(&flash_rtio_ctx, 1));
+
+	cqe = rtio_cqe_consume_block(&flash_rtio_ctx);
+	zassert_equal(cqe->userdata, userdata, "wrong completion");
+	rc = cqe->result;
+	rtio_cqe_release(&flash_rtio_ctx, cqe);
+
+	return rc;
+}
+
+ZTEST(flash_driver, test_rtio)
+{
+	static uint8_t __aligned(4) buf[EXPECTED_SIZE];
+	int rc;
+
+	rc = rtio_run(flash_rtio_erase(&flash_rtio_ctx, &flash_iodev,
+				       page_info.start_offset, page_info.size,
+				       &flash_iodev), &flash_iodev);
+	zassert_equal(rc, 0, "erase failed");
+
+	rc = rtio_run(flash_rtio_read(&flash_rtio_ctx, &flash_iodev,
+				      TEST_AREA_OFFSET, buf, sizeof(buf), buf), buf);
+	zassert_equal(rc, 0, "read failed");
+	for (size_t i = 0; i < sizeof(buf); i++) {
+		zassert_equal(buf[i], erase_value, "not erased at %u", i);
+	}
+
+	rc = rtio_run(flash_rtio_write(&flash_rtio_ctx, &flash_iodev,
+				       TEST_AREA_OFFSET, expected, sizeof(expected),
+				       expected), expected);
+	zassert_equal(rc, 0, "write failed");
+
+	rc = rtio_run(flash_rtio_read(&flash_rtio_ctx, &flash_iodev,
+				      TEST_AREA_OFFSET, buf, sizeof(buf), buf), buf);
+	zassert_equal(rc, 0, "read failed");
+	zassert_mem_equal(buf, expected, sizeof(buf), "wrong data read back");
+
+	rc = rtio_run(flash_rtio_erase(&flash_rtio_ctx, &flash_iodev,
+				       page_info.start_offset + 1, page_info.size,
+				       NULL), NULL);
+	zassert_not_equal(rc, 0, "unaligned erase should fail");
+}
+#endif /* CONFIG_FLASH_RTIO */
+
 ZTEST_SUITE(flash_driver, NULL, flash_driver_setup, NULL, NULL, NULL);
@@ -10,8 +10,11 @@
 #include <zephyr/drivers/gpio/gpio_emul.h>
 #include <zephyr/drivers/sensor.h>
 #include <zephyr/fff.h>
+#include <zephyr/sys/byteorder.h>
 #include <zephyr/ztest.h>
 
+#include "icm42688.h"
+#include "icm42688_decoder.h"
 #include "icm42688_emul.h"
 #include "icm42688_reg.h"
 
@@ -240,3 +243,50 @@ ZTEST_F(icm42688, test_interrupt)
 	/* Verify the handler was called */
 	zassert_equal(test_interrupt_trigger_handler_fake.call_count, 1);
 }
+
+ZTEST_F(icm42688, test_fifo_decode)
+{
+	const int16_t accel[2][3] = {
+		{12345, -12345, -1},
+		{INT16_MAX, -32766, 0},
+	};
+	/* Scale of the 16 bit readings at +/-4g, for a shift of 6 */
+	const int64_t scale = INT64_C(4) * BIT(31 - 6) * 9.80665;
+	uint8_t buf[sizeof(struct icm42688_fifo_data) + 2 * 16] = {0};
+	struct icm42688_fifo_data *edata = (struct icm42688_fifo_data *)buf;
+	struct {
+		struct sensor_three_axis_data data;
+		struct sensor_three_axis_sample_data extra;
+	} out;
+	const struct sensor_decoder_api *decoder;
+	uint32_t fit = 0;
+
+	edata->header.is_fifo = 1;
+	edata->header.accel_fs = ICM42688_ACCEL_FS_4G;
+	edata->header.gyro_fs = ICM42688_GYRO_FS_2000;
+	edata->accel_odr = ICM42688_ACCEL_ODR_1000;
+	edata->gyro_odr = ICM42688_GYRO_ODR_1000;
+	edata->fifo_count = 2 * 16;
+
+	for (int i = 0; i < 2; i++) {
+		uint8_t *pkt = &buf[sizeof(struct icm42688_fifo_data) + i * 16];
+
+		pkt[0] = FIFO_HEADER_ACCEL | FIFO_HEADER_GYRO;
+		for (int axis = 0; axis < 3; axis++) {
+			sys_put_be16(accel[i][axis], &pkt[1 + axis * 2]);
+		}
+	}
+
+	zassert_ok(sensor_get_decoder(fixture->dev, &decoder));
+	zassert_equal(2, decoder->decode(buf, SENSOR_CHAN_ACCEL_XYZ, 0, &fit, 2, &out));
+	zassert_equal(6, out.data.shift);
+
+	for (int i = 0; i < 2; i++) {
+		for (int axis = 0; axis < 3; axis++) {
+			zassert_equal(accel[i][axis] * scale / INT64_C(32768),
+				      out.data.readings[i].values[axis],
+				      "frame %d axis %d", i, axis);
+		}
+	}
+	zassert_equal(0, decoder->decode(buf, SENSOR_CHAN_ACCEL_XYZ, 0, &fit, 2, &out));
+}
@@ -492,6 +492,57 @@ void alloc_and_free_interval(void)
 	}
 }
 
+void alloc_and_free_fragmented(void)
+{
+	int ret;
+	size_t offset;
+
+	uint32_t ba_100_expected[4];
+
+	SYS_BITARRAY_DEFINE(ba_100, 100);
+
+	printk("Testing bit array alloc with fragmented free runs\n");
+
+	/* Free runs of bits 28-47, across two bundles, and of bits 96-99,
+	 * at the end of the last, partial, bundle.
+	 */
+	ba_100.bundles[0] = 0x0FFFFFFF;
+	ba_100.bundles[1] = 0xFFFF0000;
+	ba_100.bundles[2] = 0xFFFFFFFF;
+	ba_100.bundles[3] = 0x00000000;
+
+	ba_100_expected[0] = 0x0FFFFFFF;
+	ba_100_expected[1] = 0xFFFF0000;
+	ba_100_expected[2] = 0xFFFFFFFF;
+	ba_100_expected[3] = 0x00000000;
+
+	ret = sys_bitarray_alloc(&ba_100, 21, &offset);
+	zassert_equal(ret, -ENOSPC, "sys_bitarray_alloc() should fail but not");
+	zassert_true(cmp_u32_arrays(ba_100.bundles, ba_100_expected, ba_100.num_bundles),
+		     "sys_bitarray_alloc() failed bits comparison");
+
+	ret = sys_bitarray_alloc(&ba_100, 20, &offset);
+	ba_100_expected[0] = 0xFFFFFFFF;
+	ba_100_expected[1] = 0xFFFFFFFF;
+	zassert_equal(ret, 0, "sys_bitarray_alloc() failed: %d", ret);
+	zassert_equal(offset, 28, "sys_bitarray_alloc() offset expected %d, got %d", 28, offset);
+	zassert_true(cmp_u32_arrays(ba_100.bundles, ba_100_expected, ba_100.num_bundles),
+		     "sys_bitarray_alloc() failed bits comparison");
+
+	ret = sys_bitarray_alloc(&ba_100, 5, &offset);
+	zassert_equal(ret, -ENOSPC, "sys_bitarray_alloc() should fail but not");
+
+	ret = sys_bitarray_alloc(&ba_100, 4, &offset);
+	ba_100_expected[3] = 0x0000000F;
+	zassert_equal(ret, 0, "sys_bitarray_alloc() failed: %d", ret);
+	zassert_equal(offset, 96, "sys_bitarray_alloc() offset expected %d, got %d", 96, offset);
+	zassert_true(cmp_u32_arrays(ba_100.bundles, ba_100_expected, ba_100.num_bundles),
+		     "sys_bitarray_alloc() failed bits comparison");
+
+	ret = sys_bitarray_alloc(&ba_100, 1, &offset);
+	zassert_equal(ret, -ENOSPC, "sys_bitarray_alloc() should fail but not");
+}
+
 /**
  * @brief Test bitarrays allocation and free
  *
@@ -517,6 +568,8 @@ ZTEST(bitarray, test_bitarray_alloc_free)
 	}
 
 	alloc_and_free_interval();
+
+	alloc_and_free_fragmented();
 }
 
 ZTEST(bitarray, test_bitarray_region_set_clear)
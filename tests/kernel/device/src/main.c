@@ -10,7 +10,11 @@
 #include <zephyr/ztest.h>
 #include <zephyr/sys/printk.h>
 #include <zephyr/linker/sections.h>
+#include <string.h>
 #include "abstract_driver.h"
+#ifdef CONFIG_INIT_PROFILING
+#include <zephyr/debug/init_profile.h>
+#endif
 
 
 #define DUMMY_PORT_1    "dummy"
@@ -111,6 +115,41 @@ ZTEST_USER(device, test_bogus_dynamic_name)
 	zassert_true(mux == NULL);
 }
 
+/**
+ * @brief Test device binding of every static device
+ *
+ * Validates that looking up a copy of the name of each ready device returns
+ * the first ready device with that name.
+ *
+ * @see device_get_binding()
+ */
+ZTEST(device, test_binding_all_devices)
+{
+	const struct device *devs;
+	size_t count = z_device_get_all_static(&devs);
+	char name[Z_DEVICE_MAX_NAME_LEN];
+
+	for (size_t i = 0; i < count; i++) {
+		const struct device *expected = NULL;
+
+		if (devs[i].name[0] == '\0') {
+			continue;
+		}
+
+		for (size_t j = 0; j < count; j++) {
+			if (device_is_ready(&devs[j]) &&
+			    (strcmp(devs[j].name, devs[i].name) == 0)) {
+				expected = &devs[j];
+				break;
+			}
+		}
+
+		snprintk(name, sizeof(name), "%s", devs[i].name);
+		zassert_equal_ptr(device_get_binding(name), expected,
+				  "wrong device for %s", name);
+	}
+}
+
 /**
  * @brief Test device binding for passing null name
  *
@@ -262,6 +301,60 @@ ZTEST(device, test_sys_init_multiple)
 	zassert_equal(sys_init_counter, 4, "");
 }
 
+#ifdef CONFIG_INIT_PROFILING
+static const struct init_profile_record *find_profile_record(const char *name)
+{
+	const struct init_profile_record *record;
+	size_t count;
+
+	record = init_profile_get(&count, NULL);
+	for (size_t i = 0; i < count; i++, record++) {
+		if (strcmp(init_profile_name(record), name) == 0) {
+			return record;
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * @brief Test that init entries are profiled
+ *
+ * @ingroup kernel_device_tests
+ *
+ * @see init_profile_get()
+ */
+ZTEST(device, test_init_profile)
+{
+	const struct init_profile_record *record;
+	const struct init_profile_record *bad;
+
+	record = find_profile_record("init2");
+	zassert_not_null(record, "SYS_INIT entry not recorded");
+	zassert_is_null(record->entry->dev);
+	zassert_equal(record->entry->init_prio, 2);
+	zassert_equal(record->level, 4, "not at APPLICATION level");
+	zassert_equal(record->result, 0);
+
+	record = find_profile_record(BAD_DRIVER);
+	zassert_not_null(record, "device not recorded");
+	zassert_not_null(record->entry->dev);
+	zassert_equal(record->entry->init_prio,
+		      CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+	zassert_equal(record->level, 3, "not at POST_KERNEL level");
+	zassert_equal(record->result, -EINVAL);
+	bad = record;
+
+	/* POST_KERNEL entries run before APPLICATION ones */
+	record = find_profile_record("init2");
+	zassert_true(bad < record);
+
+	zassert_true(init_profile_boot_get()->main != 0U);
+
+	init_profile_dump();
+}
+#endif
+
 /* this is for storing sequence during initialization */
 extern int init_level_sequence[4];
 extern int init_priority_sequence[4];
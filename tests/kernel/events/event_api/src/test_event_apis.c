@@ -431,3 +431,61 @@ ZTEST(events_api, test_event_receive)
 
 	test_wake_multiple_threads();
 }
+
+static K_EVENT_DEFINE(partial_event);
+volatile static uint32_t partial_events[3];
+
+static void entry_partial(void *p1, void *p2, void *p3)
+{
+	uint32_t  events = (uint32_t)(uintptr_t)p1;
+	bool  wait_all = (bool)(uintptr_t)p2;
+	size_t  idx = (size_t)(uintptr_t)p3;
+
+	if (wait_all) {
+		partial_events[idx] = k_event_wait_all(&partial_event, events,
+						       false, LONG_TIMEOUT);
+	} else {
+		partial_events[idx] = k_event_wait(&partial_event, events,
+						   false, LONG_TIMEOUT);
+	}
+}
+
+/**
+ * Test waking threads as the events they wait for are posted one by one.
+ *
+ * Posting some of the events a thread waits for all of must not wake it,
+ * and posting events nobody waits for must not wake anybody.
+ */
+
+ZTEST(events_api, test_event_partial_post)
+{
+	k_event_set(&partial_event, 0);
+
+	(void) k_thread_create(&treceiver, sreceiver, STACK_SIZE,
+			       entry_partial, (void *)0x11, (void *)true,
+			       (void *)0, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	(void) k_thread_create(&textra1, sextra1, STACK_SIZE,
+			       entry_partial, (void *)0x10, (void *)false,
+			       (void *)1, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	(void) k_thread_create(&textra2, sextra2, STACK_SIZE,
+			       entry_partial, (void *)0x300, (void *)false,
+			       (void *)2, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	k_sleep(DELAY);
+
+	k_event_post(&partial_event, 0x1001);
+	k_sleep(DELAY);
+	zassert_equal(partial_events[0], 0, "woken with some of the events");
+	zassert_equal(partial_events[1], 0, "woken by other events");
+	zassert_equal(partial_events[2], 0, "woken by other events");
+
+	k_event_post(&partial_event, 0x10);
+	k_thread_join(&treceiver, LONG_TIMEOUT);
+	k_thread_join(&textra1, LONG_TIMEOUT);
+	zassert_equal(partial_events[0], 0x11);
+	zassert_equal(partial_events[1], 0x10);
+	zassert_equal(partial_events[2], 0, "woken by other events");
+
+	k_event_post(&partial_event, 0x200);
+	k_thread_join(&textra2, LONG_TIMEOUT);
+	zassert_equal(partial_events[2], 0x200);
+}
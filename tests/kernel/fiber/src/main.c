@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/kernel/fiber.h>
+
+#define NUM_FIBERS 3
+#define FIBER_STACK_SIZE (512 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+static K_KERNEL_STACK_ARRAY_DEFINE(fiber_stacks, NUM_FIBERS, FIBER_STACK_SIZE);
+static struct k_fiber fibers[NUM_FIBERS];
+
+K_FIBER_HOST_DEFINE(test_host, NUM_FIBERS);
+
+static K_THREAD_STACK_DEFINE(giver_stack, STACK_SIZE);
+static struct k_thread giver_thread;
+
+static K_SEM_DEFINE(fiber_sem, 0, NUM_FIBERS);
+
+static int order[3 * NUM_FIBERS];
+static int order_len;
+
+static void create_fibers(k_thread_entry_t entry)
+{
+	for (uintptr_t i = 0; i < NUM_FIBERS; i++) {
+		k_fiber_create(&test_host, &fibers[i], fiber_stacks[i],
+			       K_KERNEL_STACK_SIZEOF(fiber_stacks[i]), entry,
+			       (void *)i, NULL, NULL);
+	}
+}
+
+static void yield_entry(void *p1, void *p2, void *p3)
+{
+	int idx = (int)(uintptr_t)p1;
+
+	for (int i = 0; i < 3; i++) {
+		zassert_equal(k_fiber_current_get(), &fibers[idx]);
+		order[order_len++] = idx;
+		k_fiber_yield();
+	}
+}
+
+/**
+ * @brief Test switching between fibers
+ *
+ * Fibers run in turn, in the order they yield, and the host returns once
+ * all of them have returned.
+ */
+ZTEST(fiber, test_fiber_yield)
+{
+	order_len = 0;
+	create_fibers(yield_entry);
+
+	k_fiber_host_run(&test_host);
+
+	zassert_equal(order_len, ARRAY_SIZE(order));
+	for (int i = 0; i < order_len; i++) {
+		zassert_equal(order[i], i % NUM_FIBERS, "fiber %d ran out of order",
+			      order[i]);
+	}
+	zassert_is_null(k_fiber_current_get());
+}
+
+static void sem_entry(void *p1, void *p2, void *p3)
+{
+	int idx = (int)(uintptr_t)p1;
+
+	zassert_equal(k_fiber_sem_take(&fiber_sem, K_NO_WAIT), -EBUSY);
+	zassert_ok(k_fiber_sem_take(&fiber_sem, K_FOREVER));
+	order[order_len++] = idx;
+}
+
+static void giver_entry(void *p1, void *p2, void *p3)
+{
+	for (int i = 0; i < NUM_FIBERS; i++) {
+		k_msleep(10);
+		k_sem_give(&fiber_sem);
+	}
+}
+
+/**
+ * @brief Test fibers waiting for a semaphore
+ *
+ * Fibers waiting for a semaphore given by another thread don't block each
+ * other, and each of them takes it once.
+ */
+ZTEST(fiber, test_fiber_sem_take)
+{
+	order_len = 0;
+	create_fibers(sem_entry);
+
+	k_thread_create(&giver_thread, giver_stack, STACK_SIZE, giver_entry,
+			NULL, NULL, NULL, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+
+	k_fiber_host_run(&test_host);
+
+	zassert_equal(order_len, NUM_FIBERS);
+	zassert_equal(k_sem_count_get(&fiber_sem), 0);
+
+	k_thread_join(&giver_thread, K_FOREVER);
+}
+
+static void timeout_entry(void *p1, void *p2, void *p3)
+{
+	int idx = (int)(uintptr_t)p1;
+
+	if (idx == 0) {
+		/* Sleeping doesn't keep the other fibers from running */
+		k_fiber_sleep(K_MSEC(50));
+		zassert_equal(order_len, NUM_FIBERS - 1);
+	} else {
+		zassert_equal(k_fiber_sem_take(&fiber_sem, K_MSEC(10 * idx)),
+			      -EAGAIN);
+	}
+	order[order_len++] = idx;
+}
+
+/**
+ * @brief Test fibers sleeping and timing out
+ */
+ZTEST(fiber, test_fiber_timeout)
+{
+	int64_t start = k_uptime_get();
+
+	order_len = 0;
+	create_fibers(timeout_entry);
+
+	k_fiber_host_run(&test_host);
+
+	zassert_true(k_uptime_get() - start >= 50, "fiber slept too short");
+	zassert_equal(order_len, NUM_FIBERS);
+	for (int i = 0; i < NUM_FIBERS; i++) {
+		zassert_equal(order[i], (i + 1) % NUM_FIBERS);
+	}
+}
+
+ZTEST_SUITE(fiber, NULL, NULL, NULL, NULL, NULL);
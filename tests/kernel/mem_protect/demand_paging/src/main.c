@@ -113,6 +113,14 @@ static void print_paging_stats(struct k_mem_paging_stats_t *stats, const char *s
 	       stats->eviction.clean);
 	printk("    - Dirty pages evicted: %lu\n",
 	       stats->eviction.dirty);
+
+#if CONFIG_DEMAND_PAGING_READAHEAD > 0
+	printk("* Readahead (%s):\n", scope);
+	printk("    - Page faults reading ahead: %lu\n",
+	       stats->readahead.faults);
+	printk("    - Pages read ahead: %lu\n",
+	       stats->readahead.pages);
+#endif
 }
 
 ZTEST(demand_paging, test_touch_anon_pages)
@@ -196,6 +204,9 @@ static void test_k_mem_page_out(void)
 {
 	unsigned long faults;
 	int key, ret;
+#if CONFIG_DEMAND_PAGING_READAHEAD > 0
+	struct k_mem_paging_stats_t stats;
+#endif
 
 	/* Lock IRQs to prevent other pagefaults from happening while we
 	 * are measuring stuff
@@ -212,9 +223,22 @@ static void test_k_mem_page_out(void)
 	faults = z_num_pagefaults_get() - faults;
 	irq_unlock(key);
 
+#if CONFIG_DEMAND_PAGING_READAHEAD > 0
+	/* The writes are sequential, so after the second page fault the
+	 * following pages are read ahead.
+	 */
+	zassert_true((faults > 0) && (faults < HALF_PAGES),
+		     "unexpected num pagefaults expected < %lu got %d",
+		     HALF_PAGES, faults);
+
+	k_mem_paging_stats_get(&stats);
+	zassert_not_equal(stats.readahead.pages, 0UL,
+			  "no pages read ahead");
+#else
 	zassert_equal(faults, HALF_PAGES,
 		      "unexpected num pagefaults expected %lu got %d",
 		      HALF_PAGES, faults);
+#endif
 
 	ret = k_mem_page_out(arena, arena_size);
 	zassert_equal(ret, -ENOMEM, "k_mem_page_out should have failed");
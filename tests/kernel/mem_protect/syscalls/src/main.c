@@ -10,6 +10,7 @@
 #include <zephyr/linker/linker-defs.h>
 #include "test_syscalls.h"
 #include <mmu.h>
+#include <zephyr/sys/syscall_batch.h>
 
 #define BUF_SIZE	32
 
@@ -446,6 +447,60 @@ ZTEST(syscalls, test_syscall_context)
 	k_thread_user_mode_enter(test_syscall_context_user, NULL, NULL, NULL);
 }
 
+#ifdef CONFIG_USERSPACE_VDSO
+/* Show that the user readable kernel data agrees with the system calls */
+ZTEST_USER(syscalls, test_vdso)
+{
+	int64_t ticks, base;
+	uint32_t cycles;
+
+	ticks = k_vdso_ticks_get();
+	zassert_true(ticks <= k_uptime_ticks(), "tick count ahead of the kernel");
+
+	k_vdso_clock_base_get(&base, &cycles);
+	zassert_true(base >= ticks, "tick count went backwards");
+
+	/* Waking up takes a clock announcement */
+	k_sleep(K_TICKS(2));
+	zassert_true(k_vdso_ticks_get() >= ticks + 2, "tick count not updated");
+
+#ifndef CONFIG_SMP
+	zassert_equal(k_current_get(), k_sched_current_thread_query(),
+		      "wrong current thread");
+#endif
+}
+#endif /* CONFIG_USERSPACE_VDSO */
+
+#ifdef CONFIG_SYSCALL_BATCH
+K_SEM_DEFINE(batch_sem, 0, 10);
+
+/* Run system calls with and without split arguments in one batch */
+ZTEST_USER(syscalls, test_syscall_batch)
+{
+	struct k_syscall_batch_entry entries[] = {
+		K_SYSCALL_BATCH_ENTRY(K_SYSCALL_K_SEM_GIVE, &batch_sem),
+		K_SYSCALL_BATCH_ENTRY(K_SYSCALL_K_SEM_GIVE, &batch_sem),
+		K_SYSCALL_BATCH_ENTRY(K_SYSCALL_K_SEM_COUNT_GET, &batch_sem),
+		{ .id = K_SYSCALL_SYSCALL_ARG64 },
+	};
+	uint64_t arg = 0x5a7b0d2c19e84f36ULL;
+	int ret;
+
+	k_syscall_batch_arg64_set(&entries[3], 0, arg);
+
+	ret = k_syscall_batch(entries, ARRAY_SIZE(entries));
+	zassert_equal(ret, 0, "batch failed: %d", ret);
+	zassert_equal(entries[2].ret, 2, "sem count %lu, expected 2",
+		      (unsigned long)entries[2].ret);
+	zassert_equal((int)entries[3].ret, z_impl_syscall_arg64(arg),
+		      "syscall didn't match impl");
+	zassert_equal(k_sem_count_get(&batch_sem), 2, "sem not given twice");
+
+	ret = k_syscall_batch(entries, CONFIG_SYSCALL_BATCH_MAX_ENTRIES + 1);
+	zassert_equal(ret, -EINVAL, "oversized batch not rejected");
+}
+#endif /* CONFIG_SYSCALL_BATCH */
+
 K_HEAP_DEFINE(test_heap, BUF_SIZE * (4 * MAX_NR_THREADS));
 
 void *syscalls_setup(void)
@@ -453,6 +508,9 @@ void *syscalls_setup(void)
 	sprintf(kernel_string, "this is a kernel string");
 	sprintf(user_string, "this is a user string");
 	k_thread_heap_assign(k_current_get(), &test_heap);
+#ifdef CONFIG_SYSCALL_BATCH
+	k_object_access_grant(&batch_sem, k_current_get());
+#endif
 
 	return NULL;
 }
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "test_msgq.h"
+
+#define BATCH_LEN 8
+
+K_THREAD_STACK_DECLARE(tstack, STACK_SIZE);
+extern struct k_thread tdata;
+extern struct k_msgq msgq;
+static ZTEST_BMEM char __aligned(4) bbuffer[MSG_SIZE * BATCH_LEN];
+static ZTEST_BMEM uint32_t rx[2 * BATCH_LEN];
+static ZTEST_BMEM uint32_t tx[2 * BATCH_LEN];
+static ZTEST_BMEM uint32_t peer_msg;
+
+static void fill_tx(uint32_t base)
+{
+	for (int i = 0; i < ARRAY_SIZE(tx); i++) {
+		tx[i] = base + i;
+	}
+}
+
+static void batch_wrap(struct k_msgq *q)
+{
+	fill_tx(100);
+
+	/* Move the read and write pointers away from the buffer start so
+	 * the next batch has to wrap around.
+	 */
+	zassert_equal(k_msgq_put_many(q, tx, 5), 5);
+	zassert_equal(k_msgq_get_many(q, rx, 3), 3);
+	for (int i = 0; i < 3; i++) {
+		zassert_equal(rx[i], tx[i]);
+	}
+
+	/**TESTPOINT: only as many messages as fit are queued */
+	zassert_equal(k_msgq_put_many(q, &tx[5], 7), 6);
+	zassert_equal(k_msgq_num_used_get(q), BATCH_LEN);
+	zassert_equal(k_msgq_put_many(q, tx, 1), 0);
+
+	/**TESTPOINT: messages come out in order across the wrap */
+	zassert_equal(k_msgq_get_many(q, rx, ARRAY_SIZE(rx)), BATCH_LEN);
+	for (int i = 0; i < BATCH_LEN; i++) {
+		zassert_equal(rx[i], tx[3 + i]);
+	}
+	zassert_equal(k_msgq_get_many(q, rx, 1), 0);
+	zassert_equal(k_msgq_num_used_get(q), 0);
+}
+
+/**
+ * @addtogroup kernel_message_queue_tests
+ * @{
+ */
+
+/**
+ * @brief Test batched put and get across the end of the ring buffer
+ * @see k_msgq_put_many(), k_msgq_get_many()
+ */
+ZTEST(msgq_api, test_msgq_batch_wrap)
+{
+	k_msgq_init(&msgq, bbuffer, MSG_SIZE, BATCH_LEN);
+
+	batch_wrap(&msgq);
+}
+
+#ifdef CONFIG_USERSPACE
+/**
+ * @brief Test batched put and get from a user thread
+ * @see k_msgq_put_many(), k_msgq_get_many()
+ */
+ZTEST_USER(msgq_api, test_msgq_user_batch_wrap)
+{
+	struct k_msgq *q;
+
+	q = k_object_alloc(K_OBJ_MSGQ);
+	zassert_not_null(q, "couldn't alloc message queue");
+	zassert_false(k_msgq_alloc_init(q, MSG_SIZE, BATCH_LEN));
+
+	batch_wrap(q);
+}
+#endif
+
+static void batch_isr(const void *param)
+{
+	struct k_msgq *q = (struct k_msgq *)param;
+
+	zassert_equal(k_msgq_put_many(q, tx, BATCH_LEN), BATCH_LEN);
+}
+
+/**
+ * @brief Test batched put from an ISR
+ * @see k_msgq_put_many(), k_msgq_get_many()
+ */
+ZTEST(msgq_api, test_msgq_batch_isr)
+{
+	k_msgq_init(&msgq, bbuffer, MSG_SIZE, BATCH_LEN);
+	fill_tx(200);
+
+	irq_offload(batch_isr, &msgq);
+
+	zassert_equal(k_msgq_get_many(&msgq, rx, BATCH_LEN), BATCH_LEN);
+	zassert_mem_equal(rx, tx, BATCH_LEN * MSG_SIZE);
+}
+
+static void reader_entry(void *p1, void *p2, void *p3)
+{
+	zassert_equal(k_msgq_get((struct k_msgq *)p1, &peer_msg, K_FOREVER), 0);
+}
+
+static void writer_entry(void *p1, void *p2, void *p3)
+{
+	uint32_t msg = (uint32_t)(uintptr_t)p2;
+
+	zassert_equal(k_msgq_put((struct k_msgq *)p1, &msg, K_FOREVER), 0);
+}
+
+/**
+ * @brief Test that a batched put serves a waiting reader first
+ * @see k_msgq_put_many()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_batch_put_to_reader)
+{
+	k_msgq_init(&msgq, bbuffer, MSG_SIZE, BATCH_LEN);
+	fill_tx(300);
+
+	k_thread_create(&tdata, tstack, STACK_SIZE, reader_entry,
+			&msgq, NULL, NULL, K_PRIO_PREEMPT(0),
+			K_USER | K_INHERIT_PERMS, K_NO_WAIT);
+	k_msleep(TIMEOUT_MS >> 1);
+
+	zassert_equal(k_msgq_put_many(&msgq, tx, 3), 3);
+	k_thread_join(&tdata, K_FOREVER);
+
+	zassert_equal(peer_msg, tx[0]);
+	zassert_equal(k_msgq_num_used_get(&msgq), 2);
+	zassert_equal(k_msgq_get_many(&msgq, rx, 2), 2);
+	zassert_equal(rx[0], tx[1]);
+	zassert_equal(rx[1], tx[2]);
+}
+
+/**
+ * @brief Test that a batched get also takes a waiting writer's message
+ * @see k_msgq_get_many()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_batch_get_from_writer)
+{
+	k_msgq_init(&msgq, bbuffer, MSG_SIZE, BATCH_LEN);
+	fill_tx(400);
+
+	zassert_equal(k_msgq_put_many(&msgq, tx, BATCH_LEN), BATCH_LEN);
+	k_thread_create(&tdata, tstack, STACK_SIZE, writer_entry,
+			&msgq, (void *)(uintptr_t)tx[BATCH_LEN], NULL,
+			K_PRIO_PREEMPT(0), K_USER | K_INHERIT_PERMS, K_NO_WAIT);
+	k_msleep(TIMEOUT_MS >> 1);
+
+	/**TESTPOINT: the writer's message follows the queued ones */
+	zassert_equal(k_msgq_get_many(&msgq, rx, ARRAY_SIZE(rx)), BATCH_LEN + 1);
+	zassert_mem_equal(rx, tx, (BATCH_LEN + 1) * MSG_SIZE);
+	k_thread_join(&tdata, K_FOREVER);
+
+	/**TESTPOINT: a partial get leaves room for a waiting writer */
+	zassert_equal(k_msgq_put_many(&msgq, tx, BATCH_LEN), BATCH_LEN);
+	k_thread_create(&tdata, tstack, STACK_SIZE, writer_entry,
+			&msgq, (void *)(uintptr_t)tx[BATCH_LEN], NULL,
+			K_PRIO_PREEMPT(0), K_USER | K_INHERIT_PERMS, K_NO_WAIT);
+	k_msleep(TIMEOUT_MS >> 1);
+
+	zassert_equal(k_msgq_get_many(&msgq, rx, 2), 2);
+	k_thread_join(&tdata, K_FOREVER);
+	zassert_equal(k_msgq_num_used_get(&msgq), BATCH_LEN - 1);
+	zassert_equal(k_msgq_get_many(&msgq, rx, BATCH_LEN), BATCH_LEN - 1);
+	zassert_mem_equal(rx, &tx[2], (BATCH_LEN - 1) * MSG_SIZE);
+}
+
+/**
+ * @}
+ */
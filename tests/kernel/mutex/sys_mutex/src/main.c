@@ -447,8 +447,10 @@ ZTEST(mutex_complex, test_supervisor_access)
 {
 	int rv;
 
-#ifdef CONFIG_USERSPACE
-	/* coverage for get_k_mutex checks */
+#if defined(CONFIG_USERSPACE) && !defined(CONFIG_SYS_MUTEX_FAST_PATH)
+	/* coverage for get_k_mutex checks, the fast path would
+	 * dereference these pointers before making the syscall
+	 */
 	rv = sys_mutex_lock((struct sys_mutex *)NULL, K_NO_WAIT);
 	zassert_true(rv == -EINVAL, "accepted bad mutex pointer");
 	rv = sys_mutex_lock((struct sys_mutex *)k_current_get(), K_NO_WAIT);
@@ -467,7 +469,7 @@ ZTEST(mutex_complex, test_supervisor_access)
 
 ZTEST_USER_OR_NOT(mutex_complex, test_user_access)
 {
-#ifdef CONFIG_USERSPACE
+#if defined(CONFIG_USERSPACE) && !defined(CONFIG_SYS_MUTEX_FAST_PATH)
 	int rv;
 
 	rv = sys_mutex_lock(&no_access_mutex, K_NO_WAIT);
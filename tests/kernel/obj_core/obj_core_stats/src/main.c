@@ -6,6 +6,7 @@
 
 #include <zephyr/ztest.h>
 #include <zephyr/sys/mem_blocks.h>
+#include <string.h>
 
 SYS_MEM_BLOCKS_DEFINE(mem_block, 32, 4, 16);  /* Four 32 byte blocks */
 
@@ -693,6 +694,125 @@ ZTEST(obj_core_stats_mem_slab, test_obj_core_stats_mem_slab)
 	k_mem_slab_free(&mem_slab, mem2);
 }
 
+/***************** LOCKS ******************/
+
+#ifdef CONFIG_OBJ_CORE_STATS_MUTEX
+K_MUTEX_DEFINE(stats_mutex);
+
+static struct k_thread mutex_thread;
+static K_THREAD_STACK_DEFINE(mutex_thread_stack,
+			     1024 + CONFIG_TEST_EXTRA_STACK_SIZE);
+
+static void mutex_thread_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	k_mutex_lock(&stats_mutex, K_FOREVER);
+	k_mutex_unlock(&stats_mutex);
+}
+
+ZTEST(obj_core_stats_locks, test_obj_core_stats_mutex)
+{
+	struct k_lock_stats stats;
+	int status;
+
+	status = k_obj_core_stats_reset(K_OBJ_CORE(&stats_mutex));
+	zassert_equal(status, 0, "Expected 0, got %d\n", status);
+
+	/* Recursive locking counts once */
+	k_mutex_lock(&stats_mutex, K_FOREVER);
+	k_mutex_lock(&stats_mutex, K_FOREVER);
+	k_mutex_unlock(&stats_mutex);
+	k_mutex_unlock(&stats_mutex);
+
+	status = k_obj_core_stats_raw(K_OBJ_CORE(&stats_mutex), &stats,
+				      sizeof(stats));
+	zassert_equal(status, 0, "Expected 0, got %d\n", status);
+	zassert_equal(stats.acquired, 1);
+	zassert_equal(stats.contended, 0);
+
+	/* A higher priority thread waits for the mutex while we hold it */
+	k_mutex_lock(&stats_mutex, K_FOREVER);
+	k_thread_create(&mutex_thread, mutex_thread_stack,
+			K_THREAD_STACK_SIZEOF(mutex_thread_stack),
+			mutex_thread_entry, NULL, NULL, NULL,
+			k_thread_priority_get(k_current_get()) - 1, 0, K_NO_WAIT);
+	k_msleep(10);
+	k_mutex_unlock(&stats_mutex);
+	k_thread_join(&mutex_thread, K_FOREVER);
+
+	status = k_obj_core_stats_query(K_OBJ_CORE(&stats_mutex), &stats,
+					sizeof(stats));
+	zassert_equal(status, 0, "Expected 0, got %d\n", status);
+	zassert_equal(stats.acquired, 3);
+	zassert_equal(stats.contended, 1);
+	zassert_true(stats.wait_max > 0);
+	zassert_true(stats.wait_total >= stats.wait_max);
+	zassert_true(stats.hold_max > 0);
+
+	status = k_obj_core_stats_reset(K_OBJ_CORE(&stats_mutex));
+	zassert_equal(status, 0, "Expected 0, got %d\n", status);
+	status = k_obj_core_stats_raw(K_OBJ_CORE(&stats_mutex), &stats,
+				      sizeof(stats));
+	zassert_equal(status, 0, "Expected 0, got %d\n", status);
+	zassert_equal(stats.acquired, 0);
+	zassert_equal(stats.contended, 0);
+}
+#endif /* CONFIG_OBJ_CORE_STATS_MUTEX */
+
+#ifdef CONFIG_OBJ_CORE_STATS_SPINLOCK
+static struct k_spinlock stats_lock;
+static struct k_spinlock_obj stats_lock_obj;
+
+static int find_spinlock(struct k_obj_core *obj_core, void *data)
+{
+	struct k_spinlock_obj *obj =
+		CONTAINER_OF(obj_core, struct k_spinlock_obj, obj_core);
+
+	return (strcmp(obj->name, data) == 0) ? 1 : 0;
+}
+
+ZTEST(obj_core_stats_locks, test_obj_core_stats_spinlock)
+{
+	struct k_obj_type *type = k_obj_type_find(K_OBJ_TYPE_SPINLOCK_ID);
+	struct k_lock_stats stats;
+	k_spinlock_key_t key;
+	int status;
+
+	zassert_not_null(type);
+	zassert_equal(k_obj_type_walk_unlocked(type, find_spinlock, "sched"),
+		      1, "Scheduler lock not registered");
+
+	k_spinlock_obj_register(&stats_lock_obj, &stats_lock, "test");
+	zassert_equal(k_obj_type_walk_unlocked(type, find_spinlock, "test"), 1);
+
+	for (int i = 0; i < 3; i++) {
+		key = k_spin_lock(&stats_lock);
+		k_spin_unlock(&stats_lock, key);
+	}
+	zassert_ok(k_spin_trylock(&stats_lock, &key));
+	k_spin_unlock(&stats_lock, key);
+
+	status = k_obj_core_stats_raw(K_OBJ_CORE(&stats_lock_obj), &stats,
+				      sizeof(stats));
+	zassert_equal(status, 0, "Expected 0, got %d\n", status);
+	zassert_equal(stats.acquired, 4);
+	zassert_equal(stats.contended, 0);
+	zassert_equal(stats.wait_total, 0);
+
+	status = k_obj_core_stats_reset(K_OBJ_CORE(&stats_lock_obj));
+	zassert_equal(status, 0, "Expected 0, got %d\n", status);
+	status = k_obj_core_stats_raw(K_OBJ_CORE(&stats_lock_obj), &stats,
+				      sizeof(stats));
+	zassert_equal(status, 0, "Expected 0, got %d\n", status);
+	zassert_equal(stats.acquired, 0);
+
+	k_obj_core_unlink(K_OBJ_CORE(&stats_lock_obj));
+}
+#endif /* CONFIG_OBJ_CORE_STATS_SPINLOCK */
+
 ZTEST_SUITE(obj_core_stats_system, NULL, NULL,
 	    ztest_simple_1cpu_before, ztest_simple_1cpu_after, NULL);
 
@@ -704,3 +824,6 @@ ZTEST_SUITE(obj_core_stats_mem_block, NULL, NULL,
 
 ZTEST_SUITE(obj_core_stats_mem_slab, NULL, NULL,
 	    ztest_simple_1cpu_before, ztest_simple_1cpu_after, NULL);
+
+ZTEST_SUITE(obj_core_stats_locks, NULL, NULL,
+	    ztest_simple_1cpu_before, ztest_simple_1cpu_after, NULL);
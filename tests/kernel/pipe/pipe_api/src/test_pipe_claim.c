@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @brief Tests for in place access to the pipe buffer
+ * @ingroup kernel_pipe_tests
+ * @{
+ */
+
+#include <zephyr/ztest.h>
+
+#define CLAIM_PIPE_LEN 8
+#define CLAIM_STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define CLAIM_TIMEOUT_MS 100
+
+static unsigned char __aligned(4) claim_buf[CLAIM_PIPE_LEN];
+static struct k_pipe claim_pipe;
+static K_THREAD_STACK_DEFINE(claim_stack, CLAIM_STACK_SIZE);
+static struct k_thread claim_thread;
+
+static const unsigned char pattern[] = "0123456789abcdef";
+static unsigned char peer_buf[CLAIM_PIPE_LEN];
+static size_t peer_bytes;
+
+static void claim_before(void)
+{
+	/* Start every test with the indices at the buffer start */
+	k_pipe_init(&claim_pipe, claim_buf, sizeof(claim_buf));
+	memset(peer_buf, 0, sizeof(peer_buf));
+	peer_bytes = 0;
+}
+
+static void produce(const unsigned char *src, size_t len)
+{
+	void *data;
+	size_t size = len;
+
+	zassert_equal(k_pipe_reserve(&claim_pipe, &data, &size), 0);
+	zassert_equal(size, len);
+	memcpy(data, src, len);
+	zassert_equal(k_pipe_commit(&claim_pipe, len), 0);
+}
+
+ZTEST(pipe_api, test_pipe_claim_wrap)
+{
+	unsigned char rx[CLAIM_PIPE_LEN];
+	size_t bytes_read;
+	void *data;
+	size_t size;
+
+	claim_before();
+
+	/* Move the indices to the middle of the buffer */
+	produce(pattern, 5);
+	zassert_ok(k_pipe_get(&claim_pipe, rx, 5, &bytes_read, 5, K_NO_WAIT));
+	zassert_mem_equal(rx, pattern, 5);
+
+	/**TESTPOINT: the free space is only granted up to the buffer end */
+	size = CLAIM_PIPE_LEN;
+	zassert_equal(k_pipe_reserve(&claim_pipe, &data, &size), 0);
+	zassert_equal(size, CLAIM_PIPE_LEN - 5);
+	zassert_equal(k_pipe_reserve(&claim_pipe, &data, &size), -EBUSY);
+	zassert_equal(k_pipe_put(&claim_pipe, (void *)pattern, 1, &bytes_read,
+				 0, K_NO_WAIT), -EBUSY);
+	memcpy(data, pattern, size);
+	zassert_equal(k_pipe_commit(&claim_pipe, size + 1), -EINVAL);
+	zassert_equal(k_pipe_commit(&claim_pipe, size), 0);
+	zassert_equal(k_pipe_commit(&claim_pipe, 0), -EINVAL);
+
+	/* The rest of the free space is at the start of the buffer */
+	produce(&pattern[3], 5);
+	zassert_equal(k_pipe_read_avail(&claim_pipe), CLAIM_PIPE_LEN);
+
+	size = CLAIM_PIPE_LEN;
+	zassert_equal(k_pipe_reserve(&claim_pipe, &data, &size), -EAGAIN);
+
+	/**TESTPOINT: data is read in place in two parts */
+	size = CLAIM_PIPE_LEN;
+	zassert_equal(k_pipe_peek(&claim_pipe, &data, &size), 0);
+	zassert_equal(size, CLAIM_PIPE_LEN - 5);
+	zassert_mem_equal(data, pattern, size);
+	zassert_equal(k_pipe_peek(&claim_pipe, &data, &size), -EBUSY);
+	zassert_equal(k_pipe_get(&claim_pipe, rx, 1, &bytes_read, 0,
+				 K_NO_WAIT), -EBUSY);
+
+	/* Consuming part of the claim leaves the rest in place */
+	zassert_equal(k_pipe_consume(&claim_pipe, 1), 0);
+	size = CLAIM_PIPE_LEN;
+	zassert_equal(k_pipe_peek(&claim_pipe, &data, &size), 0);
+	zassert_equal(size, CLAIM_PIPE_LEN - 6);
+	zassert_mem_equal(data, &pattern[1], size);
+	zassert_equal(k_pipe_consume(&claim_pipe, size), 0);
+
+	size = CLAIM_PIPE_LEN;
+	zassert_equal(k_pipe_peek(&claim_pipe, &data, &size), 0);
+	zassert_equal(size, 5);
+	zassert_mem_equal(data, &pattern[3], size);
+	zassert_equal(k_pipe_consume(&claim_pipe, size + 1), -EINVAL);
+	zassert_equal(k_pipe_consume(&claim_pipe, size), 0);
+
+	size = CLAIM_PIPE_LEN;
+	zassert_equal(k_pipe_peek(&claim_pipe, &data, &size), -EAGAIN);
+	zassert_equal(k_pipe_write_avail(&claim_pipe), CLAIM_PIPE_LEN);
+}
+
+static void reader_entry(void *p1, void *p2, void *p3)
+{
+	zassert_ok(k_pipe_get(&claim_pipe, peer_buf, 4, &peer_bytes, 4,
+			      K_FOREVER));
+}
+
+static void writer_entry(void *p1, void *p2, void *p3)
+{
+	size_t bytes_written;
+
+	zassert_ok(k_pipe_put(&claim_pipe, (void *)&pattern[CLAIM_PIPE_LEN], 4,
+			      &bytes_written, 4, K_FOREVER));
+}
+
+/**
+ * @brief Committed data goes to a thread blocked in k_pipe_get()
+ */
+ZTEST(pipe_api_1cpu, test_pipe_commit_to_reader)
+{
+	claim_before();
+
+	k_thread_create(&claim_thread, claim_stack, CLAIM_STACK_SIZE,
+			reader_entry, NULL, NULL, NULL,
+			K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	k_msleep(CLAIM_TIMEOUT_MS);
+
+	produce(pattern, 6);
+	k_thread_join(&claim_thread, K_FOREVER);
+
+	zassert_equal(peer_bytes, 4);
+	zassert_mem_equal(peer_buf, pattern, 4);
+	zassert_equal(k_pipe_read_avail(&claim_pipe), 2);
+}
+
+/**
+ * @brief Consuming data lets a thread blocked in k_pipe_put() proceed
+ */
+ZTEST(pipe_api_1cpu, test_pipe_consume_from_writer)
+{
+	void *data;
+	size_t size = CLAIM_PIPE_LEN;
+
+	claim_before();
+	produce(pattern, CLAIM_PIPE_LEN);
+
+	k_thread_create(&claim_thread, claim_stack, CLAIM_STACK_SIZE,
+			writer_entry, NULL, NULL, NULL,
+			K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	k_msleep(CLAIM_TIMEOUT_MS);
+
+	zassert_equal(k_pipe_peek(&claim_pipe, &data, &size), 0);
+	zassert_equal(size, CLAIM_PIPE_LEN);
+	zassert_equal(k_pipe_consume(&claim_pipe, 4), 0);
+	k_thread_join(&claim_thread, K_FOREVER);
+
+	/* The writer's data now follows what was left */
+	size = CLAIM_PIPE_LEN;
+	zassert_equal(k_pipe_peek(&claim_pipe, &data, &size), 0);
+	zassert_equal(size, 4);
+	zassert_mem_equal(data, &pattern[4], 4);
+	zassert_equal(k_pipe_consume(&claim_pipe, size), 0);
+
+	size = CLAIM_PIPE_LEN;
+	zassert_equal(k_pipe_peek(&claim_pipe, &data, &size), 0);
+	zassert_equal(size, 4);
+	zassert_mem_equal(data, &pattern[CLAIM_PIPE_LEN], 4);
+	zassert_equal(k_pipe_consume(&claim_pipe, size), 0);
+}
+
+#ifdef CONFIG_POLL
+/**
+ * @brief Committing data signals poll events on the pipe
+ */
+ZTEST(pipe_api, test_pipe_commit_poll)
+{
+	struct k_poll_event event = K_POLL_EVENT_INITIALIZER(
+		K_POLL_TYPE_PIPE_DATA_AVAILABLE, K_POLL_MODE_NOTIFY_ONLY,
+		&claim_pipe);
+
+	claim_before();
+
+	zassert_equal(k_poll(&event, 1, K_NO_WAIT), -EAGAIN);
+	produce(pattern, 2);
+	zassert_ok(k_poll(&event, 1, K_NO_WAIT));
+	zassert_equal(event.state, K_POLL_STATE_PIPE_DATA_AVAILABLE);
+}
+#endif
+
+/**
+ * @}
+ */
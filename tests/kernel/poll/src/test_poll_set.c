@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+
+#ifdef CONFIG_POLL_SET
+
+#define SET_STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define NUM_SEMS 4
+
+static struct k_poll_set set;
+static struct k_sem sems[NUM_SEMS];
+static struct k_poll_signal set_signal;
+static struct k_poll_event events[NUM_SEMS + 1];
+static struct k_thread set_thread;
+static K_THREAD_STACK_DEFINE(set_stack, SET_STACK_SIZE);
+
+static void set_setup(void)
+{
+	k_poll_set_init(&set);
+	k_poll_signal_init(&set_signal);
+
+	for (int i = 0; i < NUM_SEMS; i++) {
+		k_sem_init(&sems[i], 0, 1);
+		k_poll_event_init(&events[i], K_POLL_TYPE_SEM_AVAILABLE,
+				  K_POLL_MODE_NOTIFY_ONLY, &sems[i]);
+		events[i].tag = i;
+		zassert_ok(k_poll_set_add(&set, &events[i]));
+	}
+
+	k_poll_event_init(&events[NUM_SEMS], K_POLL_TYPE_SIGNAL,
+			  K_POLL_MODE_NOTIFY_ONLY, &set_signal);
+	events[NUM_SEMS].tag = NUM_SEMS;
+	zassert_ok(k_poll_set_add(&set, &events[NUM_SEMS]));
+}
+
+static void set_teardown(void)
+{
+	for (int i = 0; i < ARRAY_SIZE(events); i++) {
+		zassert_ok(k_poll_set_remove(&set, &events[i]));
+	}
+}
+
+/**
+ * @brief Test that a poll set reports ready events, level triggered
+ *
+ * @ingroup kernel_poll_tests
+ *
+ * @see k_poll_set_init(), k_poll_set_add(), k_poll_set_wait()
+ */
+ZTEST(poll_api_1cpu, test_poll_set_level)
+{
+	struct k_poll_event *ready[NUM_SEMS + 1];
+
+	set_setup();
+
+	zassert_equal(k_poll_set_wait(&set, ready, ARRAY_SIZE(ready),
+				      K_NO_WAIT), -EAGAIN);
+	zassert_equal(k_poll_set_add(&set, &events[0]), -EALREADY);
+
+	k_sem_give(&sems[2]);
+	zassert_equal(k_poll_set_wait(&set, ready, ARRAY_SIZE(ready),
+				      K_NO_WAIT), 1);
+	zassert_equal_ptr(ready[0], &events[2]);
+	zassert_equal(ready[0]->state, K_POLL_STATE_SEM_AVAILABLE);
+
+	/**TESTPOINT: the event is reported until its condition clears */
+	zassert_equal(k_poll_set_wait(&set, ready, ARRAY_SIZE(ready),
+				      K_NO_WAIT), 1);
+	zassert_equal_ptr(ready[0], &events[2]);
+	zassert_ok(k_sem_take(&sems[2], K_NO_WAIT));
+	zassert_equal(k_poll_set_wait(&set, ready, ARRAY_SIZE(ready),
+				      K_NO_WAIT), -EAGAIN);
+
+	/**TESTPOINT: events that don't fit stay queued */
+	k_sem_give(&sems[1]);
+	k_sem_give(&sems[3]);
+	zassert_ok(k_poll_signal_raise(&set_signal, 0x1234));
+	zassert_equal(k_poll_set_wait(&set, ready, 2, K_NO_WAIT), 2);
+	zassert_equal_ptr(ready[0], &events[1]);
+	zassert_equal_ptr(ready[1], &events[3]);
+	zassert_ok(k_sem_take(&sems[1], K_NO_WAIT));
+	zassert_ok(k_sem_take(&sems[3], K_NO_WAIT));
+
+	zassert_equal(k_poll_set_wait(&set, ready, 2, K_NO_WAIT), 1);
+	zassert_equal_ptr(ready[0], &events[NUM_SEMS]);
+	zassert_equal(ready[0]->state, K_POLL_STATE_SIGNALED);
+	k_poll_signal_reset(&set_signal);
+	zassert_equal(k_poll_set_wait(&set, ready, 2, K_NO_WAIT), -EAGAIN);
+
+	set_teardown();
+	zassert_equal(k_poll_set_remove(&set, &events[0]), -EINVAL);
+}
+
+/**
+ * @brief Test that an event added while ready is reported
+ *
+ * @ingroup kernel_poll_tests
+ *
+ * @see k_poll_set_add(), k_poll_set_remove(), k_poll_set_wait()
+ */
+ZTEST(poll_api_1cpu, test_poll_set_add_ready)
+{
+	struct k_poll_event *ready[1];
+
+	set_setup();
+
+	zassert_ok(k_poll_set_remove(&set, &events[0]));
+	k_sem_give(&sems[0]);
+
+	/* Removed events are not reported */
+	zassert_equal(k_poll_set_wait(&set, ready, 1, K_NO_WAIT), -EAGAIN);
+
+	zassert_ok(k_poll_set_add(&set, &events[0]));
+	zassert_equal(k_poll_set_wait(&set, ready, 1, K_NO_WAIT), 1);
+	zassert_equal_ptr(ready[0], &events[0]);
+
+	/* A reported event can be removed before it is re-armed */
+	zassert_ok(k_poll_set_remove(&set, &events[0]));
+	zassert_equal(k_poll_set_wait(&set, ready, 1, K_NO_WAIT), -EAGAIN);
+	zassert_ok(k_poll_set_add(&set, &events[0]));
+	zassert_ok(k_sem_take(&sems[0], K_NO_WAIT));
+
+	set_teardown();
+}
+
+static void give_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	k_msleep(50);
+	k_sem_give((struct k_sem *)p1);
+}
+
+/**
+ * @brief Test waiting on a poll set for another thread's event
+ *
+ * @ingroup kernel_poll_tests
+ *
+ * @see k_poll_set_wait()
+ */
+ZTEST(poll_api_1cpu, test_poll_set_wait)
+{
+	struct k_poll_event *ready[NUM_SEMS];
+
+	set_setup();
+
+	zassert_equal(k_poll_set_wait(&set, ready, ARRAY_SIZE(ready),
+				      K_MSEC(20)), -EAGAIN);
+
+	k_thread_create(&set_thread, set_stack, SET_STACK_SIZE, give_entry,
+			&sems[NUM_SEMS - 1], NULL, NULL,
+			K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+
+	zassert_equal(k_poll_set_wait(&set, ready, ARRAY_SIZE(ready),
+				      K_FOREVER), 1);
+	zassert_equal(ready[0]->tag, NUM_SEMS - 1);
+	zassert_ok(k_sem_take(&sems[NUM_SEMS - 1], K_NO_WAIT));
+	k_thread_join(&set_thread, K_FOREVER);
+
+	set_teardown();
+}
+
+#endif /* CONFIG_POLL_SET */
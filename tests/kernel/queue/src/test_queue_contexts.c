@@ -553,3 +553,47 @@ ZTEST(queue_api, test_queue_unique_append)
 	ret = k_queue_unique_append(&queue, (void *)&data[1]);
 	zassert_true(ret, "queue unique append failed");
 }
+
+static qdata_t data_o[4];
+
+static void tIsr_entry_append_order(const void *p)
+{
+	struct k_queue *pqueue = (struct k_queue *)p;
+
+	k_queue_append(pqueue, &data_o[1]);
+	k_queue_append(pqueue, &data_o[2]);
+}
+
+/**
+ * @brief Verify the order of items appended from different contexts
+ *
+ * @ingroup kernel_queue_tests
+ *
+ * @details Interleave appends from an ISR and a thread with a prepend
+ * and check that peeking, removing and getting items all see them in
+ * the order they were queued in.
+ *
+ * @see k_queue_append(), k_queue_prepend(), k_queue_remove()
+ */
+ZTEST(queue_api, test_queue_append_order)
+{
+	k_queue_init(&queue);
+
+	k_queue_append(&queue, &data_o[0]);
+	irq_offload(tIsr_entry_append_order, (const void *)&queue);
+
+	zassert_false(k_queue_is_empty(&queue));
+	zassert_equal(k_queue_peek_head(&queue), &data_o[0]);
+	zassert_equal(k_queue_peek_tail(&queue), &data_o[2]);
+
+	k_queue_append(&queue, &data_o[3]);
+	zassert_true(k_queue_remove(&queue, &data_o[1]));
+	k_queue_prepend(&queue, &data_o[1]);
+
+	zassert_equal(k_queue_get(&queue, K_NO_WAIT), &data_o[1]);
+	zassert_equal(k_queue_get(&queue, K_NO_WAIT), &data_o[0]);
+	zassert_equal(k_queue_get(&queue, K_NO_WAIT), &data_o[2]);
+	zassert_equal(k_queue_get(&queue, K_NO_WAIT), &data_o[3]);
+	zassert_is_null(k_queue_get(&queue, K_NO_WAIT));
+	zassert_true(k_queue_is_empty(&queue));
+}
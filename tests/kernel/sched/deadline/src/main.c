@@ -215,4 +215,103 @@ ZTEST(suite_deadline, test_unqueued)
 	}
 }
 
+#ifdef CONFIG_SCHED_DEADLINE_SERVER
+/**
+ * @brief Validate the admission control of budget servers
+ *
+ * @ingroup kernel_sched_tests
+ */
+ZTEST(suite_deadline, test_server_admission)
+{
+	static struct k_sched_server s1, s2;
+
+	zassert_equal(k_sched_server_init(&s1, 0, 1000), -EINVAL);
+	zassert_equal(k_sched_server_init(&s1, 2000, 1000), -EINVAL);
+
+	zassert_ok(k_sched_server_init(&s1, 6000, 10000));
+	zassert_equal(k_sched_server_init(&s2,
+		(CONFIG_SCHED_DEADLINE_SERVER_MAX_UTIL - 59) * 100, 10000), -EBUSY,
+		"reservation above the utilization limit accepted");
+
+	k_thread_create(&worker_threads[0], worker_stacks[0], STACK_SIZE,
+			worker, INT_TO_POINTER(0), NULL, NULL,
+			K_PRIO_COOP(0), 0, K_FOREVER);
+	zassert_equal(k_sched_server_attach(&s1, &worker_threads[0]), -EINVAL,
+		      "cooperative thread attached");
+	k_thread_priority_set(&worker_threads[0],
+			      K_LOWEST_APPLICATION_THREAD_PRIO);
+	zassert_ok(k_sched_server_attach(&s1, &worker_threads[0]));
+	zassert_equal(k_sched_server_attach(&s1, &worker_threads[0]), -EALREADY);
+	zassert_equal(k_sched_server_release(&s1), -EBUSY,
+		      "server released with a thread attached");
+	k_sched_server_detach(&worker_threads[0]);
+	k_thread_abort(&worker_threads[0]);
+
+	zassert_ok(k_sched_server_release(&s1));
+	zassert_ok(k_sched_server_init(&s2,
+		(CONFIG_SCHED_DEADLINE_SERVER_MAX_UTIL - 59) * 100, 10000));
+	zassert_ok(k_sched_server_release(&s2));
+}
+
+static volatile uint32_t spin_count[2];
+
+static void spin_worker(void *p1, void *p2, void *p3)
+{
+	volatile uint32_t *count = p1;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (1) {
+		(*count)++;
+	}
+}
+
+/**
+ * @brief Validate that a budget server isolates CPU hogs
+ *
+ * @details Two threads at the same priority spin forever.  Without
+ * servers the first one would starve the other.  With servers of 20%
+ * and 50% of the CPU, both run, and the second one gets more CPU time.
+ *
+ * @ingroup kernel_sched_tests
+ */
+ZTEST(suite_deadline, test_server_isolation)
+{
+	static struct k_sched_server hog_server, victim_server;
+
+	zassert_ok(k_sched_server_init(&hog_server, 2000, 10000));
+	zassert_ok(k_sched_server_init(&victim_server, 5000, 10000));
+
+	spin_count[0] = 0;
+	spin_count[1] = 0;
+
+	for (int i = 0; i < 2; i++) {
+		k_thread_create(&worker_threads[i], worker_stacks[i], STACK_SIZE,
+				spin_worker, (void *)&spin_count[i], NULL, NULL,
+				K_LOWEST_APPLICATION_THREAD_PRIO, 0, K_FOREVER);
+	}
+
+	zassert_ok(k_sched_server_attach(&hog_server, &worker_threads[0]));
+	zassert_ok(k_sched_server_attach(&victim_server, &worker_threads[1]));
+
+	k_thread_start(&worker_threads[0]);
+	k_thread_start(&worker_threads[1]);
+
+	k_sleep(K_MSEC(500));
+
+	k_thread_abort(&worker_threads[0]);
+	k_thread_abort(&worker_threads[1]);
+
+	zassert_true(spin_count[1] > 0, "hog starved the other thread");
+	zassert_true(spin_count[1] > spin_count[0],
+		     "larger budget got less CPU time (%u vs %u)",
+		     spin_count[1], spin_count[0]);
+
+	/* Aborted threads are detached */
+	zassert_ok(k_sched_server_release(&hog_server));
+	zassert_ok(k_sched_server_release(&victim_server));
+}
+#endif /* CONFIG_SCHED_DEADLINE_SERVER */
+
 ZTEST_SUITE(suite_deadline, NULL, NULL, NULL, NULL, NULL);
@@ -757,6 +757,50 @@ ZTEST(smp, test_smp_ipi)
 }
 #endif
 
+#ifdef CONFIG_ARCH_HAS_DIRECTED_IPIS
+/**
+ * @brief Test directed interprocessor interrupts
+ *
+ * @ingroup kernel_smp_integration_tests
+ *
+ * @details Send a scheduler IPI to each other CPU in turn with
+ * arch_sched_directed_ipi() and check that exactly one IPI handler
+ * ran each time.
+ *
+ * @see arch_sched_directed_ipi()
+ */
+ZTEST(smp, test_smp_directed_ipi)
+{
+	unsigned int num_cpus = arch_num_cpus();
+	unsigned int key;
+	int self;
+
+#ifndef CONFIG_TRACE_SCHED_IPI
+	ztest_test_skip();
+#endif
+
+	for (int i = 0; i < num_cpus; i++) {
+		key = arch_irq_lock();
+		self = _current_cpu->id;
+		arch_irq_unlock(key);
+
+		if (i == self) {
+			continue;
+		}
+
+		sched_ipi_has_called = 0;
+		arch_sched_directed_ipi(BIT(i));
+
+		k_msleep(100);
+
+		/**TESTPOINT: only the targeted CPU took the IPI */
+		zassert_equal(sched_ipi_has_called, 1,
+			      "CPU %d: expected 1 IPI, got %d", i,
+			      sched_ipi_has_called);
+	}
+}
+#endif
+
 void k_sys_fatal_error_handler(unsigned int reason, const z_arch_esf_t *esf)
 {
 	static int trigger;
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/kernel/thread_pool.h>
+
+#define POOL_SIZE 2
+#define STACK_SIZE (512 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+K_THREAD_POOL_DEFINE(test_pool, POOL_SIZE, STACK_SIZE, K_PRIO_PREEMPT(1));
+
+static K_SEM_DEFINE(job_done, 0, POOL_SIZE);
+static K_SEM_DEFINE(job_release, 0, POOL_SIZE);
+
+static k_tid_t job_threads[POOL_SIZE];
+
+static void job(void *p1, void *p2, void *p3)
+{
+	uintptr_t idx = (uintptr_t)p1;
+
+	job_threads[idx] = k_current_get();
+	zassert_equal((uintptr_t)p2, idx + 1);
+	zassert_equal((uintptr_t)p3, idx + 2);
+
+	/* Later jobs must run at the pool priority again */
+	k_thread_priority_set(k_current_get(), K_PRIO_PREEMPT(2));
+
+	k_sem_give(&job_done);
+	(void)k_sem_take(&job_release, K_FOREVER);
+}
+
+static k_tid_t spawn(uintptr_t idx, k_timeout_t timeout)
+{
+	return k_thread_pool_spawn(&test_pool, job, (void *)idx,
+				   (void *)(idx + 1), (void *)(idx + 2),
+				   timeout);
+}
+
+/**
+ * @brief Test running jobs in the threads of a thread pool
+ *
+ * Jobs run in the threads of the pool as long as some are idle, and the
+ * threads are reused once their job is done.
+ */
+ZTEST(thread_pool, test_thread_pool_spawn)
+{
+	k_tid_t tids[POOL_SIZE];
+
+	for (uintptr_t i = 0; i < POOL_SIZE; i++) {
+		tids[i] = spawn(i, K_NO_WAIT);
+		zassert_not_null(tids[i], "no idle thread for job %lu",
+				 (unsigned long)i);
+		zassert_ok(k_sem_take(&job_done, K_FOREVER));
+		zassert_equal(job_threads[i], tids[i], "job ran in another thread");
+	}
+
+	zassert_not_equal(tids[0], tids[1], "jobs share a thread");
+	zassert_is_null(spawn(0, K_NO_WAIT), "job spawned on busy pool");
+
+	/* Finishing a job makes its thread idle again */
+	k_sem_give(&job_release);
+	job_threads[0] = NULL;
+	zassert_not_null(spawn(0, K_MSEC(100)), "thread not reused");
+	zassert_ok(k_sem_take(&job_done, K_FOREVER));
+	zassert_true(job_threads[0] == tids[0] || job_threads[0] == tids[1]);
+	zassert_equal(k_thread_priority_get(job_threads[0]), K_PRIO_PREEMPT(2));
+
+	for (int i = 0; i < POOL_SIZE; i++) {
+		k_sem_give(&job_release);
+	}
+
+	/* All threads idle again, at the pool priority */
+	k_sleep(K_MSEC(10));
+	for (int i = 0; i < POOL_SIZE; i++) {
+		zassert_equal(k_thread_priority_get(tids[i]), K_PRIO_PREEMPT(1));
+	}
+}
+
+static void *thread_pool_setup(void)
+{
+	k_thread_pool_start(&test_pool);
+
+	return NULL;
+}
+
+ZTEST_SUITE(thread_pool, NULL, thread_pool_setup, NULL, NULL, NULL);
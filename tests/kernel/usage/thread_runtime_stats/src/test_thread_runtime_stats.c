@@ -539,5 +539,51 @@ ZTEST(usage_api, test_thread_stats_usage)
 	k_thread_abort(tid);
 }
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+/**
+ * @brief Test the scheduling latency statistics
+ *
+ * The main thread sleeps a few times while a lower priority helper
+ * thread spins.  Every wakeup of the main thread must be counted in its
+ * latency histogram, and each of them preempts the helper thread.
+ */
+ZTEST(usage_api, test_thread_latency_stats)
+{
+	k_thread_runtime_stats_t  stats1;
+	k_thread_runtime_stats_t  stats2;
+	k_thread_runtime_stats_t  helper_stats;
+	uint32_t  wakeups = 0;
+	k_tid_t  tid;
+	int  i;
+
+	tid = k_thread_create(&helper_thread, helper_stack,
+			      K_THREAD_STACK_SIZEOF(helper_stack),
+			      helper1, NULL, NULL, NULL,
+			      K_LOWEST_APPLICATION_THREAD_PRIO, 0, K_NO_WAIT);
+
+	k_thread_runtime_stats_get(k_current_get(), &stats1);
+
+	for (i = 0; i < 5; i++) {
+		k_sleep(K_TICKS(2));
+	}
+
+	k_thread_runtime_stats_get(k_current_get(), &stats2);
+	k_thread_runtime_stats_get(tid, &helper_stats);
+
+	for (i = 0; i < CONFIG_SCHED_THREAD_USAGE_LATENCY_BUCKETS; i++) {
+		zassert_true(stats2.latency_hist[i] >= stats1.latency_hist[i]);
+		wakeups += stats2.latency_hist[i] - stats1.latency_hist[i];
+	}
+
+	zassert_true(wakeups >= 5, "%u wakeups recorded, expected 5", wakeups);
+	zassert_true(stats2.latency_max > 0);
+	zassert_true(helper_stats.preemptions >= 5,
+		     "helper preempted %u times, expected 5",
+		     helper_stats.preemptions);
+
+	k_thread_abort(tid);
+}
+#endif
+
 ZTEST_SUITE(usage_api, NULL, NULL,
 		ztest_simple_1cpu_before, ztest_simple_1cpu_after, NULL);
@@ -0,0 +1,296 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#define NUM_WORKERS 3
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+/* Workers are preemptible and lower priority than the (cooperative) test
+ * thread, so they only run while the test thread sleeps.
+ */
+#define WORKER_PRIORITY K_PRIO_PREEMPT(1)
+#define HELPER_PRIORITY K_PRIO_PREEMPT(0)
+
+#define SETTLE_MS 50
+
+static K_THREAD_STACK_ARRAY_DEFINE(worker_stacks, NUM_WORKERS, STACK_SIZE);
+static struct k_thread worker_threads[NUM_WORKERS - 1];
+static struct k_work_q pool;
+
+static K_THREAD_STACK_DEFINE(helper_stack, STACK_SIZE);
+static struct k_thread helper_thread;
+static bool helper_created;
+
+/* Given by the test to let a blocking handler return. */
+static K_SEM_DEFINE(rel_sem, 0, NUM_WORKERS);
+
+static struct k_work block_work[NUM_WORKERS];
+static struct k_work sleep_work;
+
+/* Must be in coherent memory, so not on the stack. */
+static struct k_work_sync work_sync;
+
+static atomic_t started;
+static atomic_t completed;
+static atomic_t active;
+static atomic_t max_active;
+static atomic_t helper_done;
+
+static void block_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	atomic_inc(&started);
+	k_sem_take(&rel_sem, K_FOREVER);
+	atomic_inc(&completed);
+}
+
+static void sleep_handler(struct k_work *work)
+{
+	atomic_val_t now = atomic_inc(&active) + 1;
+
+	ARG_UNUSED(work);
+
+	if (now > atomic_get(&max_active)) {
+		atomic_set(&max_active, now);
+	}
+
+	atomic_inc(&started);
+	k_msleep(10);
+	atomic_dec(&active);
+	atomic_inc(&completed);
+}
+
+static void reset(void)
+{
+	atomic_clear(&started);
+	atomic_clear(&completed);
+	atomic_clear(&active);
+	atomic_clear(&max_active);
+	atomic_clear(&helper_done);
+	k_sem_reset(&rel_sem);
+
+	for (int i = 0; i < NUM_WORKERS; i++) {
+		k_work_init(&block_work[i], block_handler);
+	}
+	k_work_init(&sleep_work, sleep_handler);
+}
+
+static void *pool_setup(void)
+{
+	struct k_work_queue_config cfg = {
+		.name = "pool",
+		.pin_cpus = IS_ENABLED(CONFIG_SCHED_CPU_MASK),
+	};
+
+	k_work_queue_init(&pool);
+	k_work_queue_pool_start(&pool, worker_threads,
+				(k_thread_stack_t *)worker_stacks, STACK_SIZE,
+				NUM_WORKERS, WORKER_PRIORITY, &cfg);
+
+	return NULL;
+}
+
+static void pool_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	reset();
+}
+
+static void pool_after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	/* Let anything a failed test left blocked finish. */
+	for (int i = 0; i < NUM_WORKERS; i++) {
+		k_sem_give(&rel_sem);
+	}
+	(void)k_work_queue_drain(&pool, false);
+
+	if (helper_created) {
+		k_thread_join(&helper_thread, K_FOREVER);
+		helper_created = false;
+	}
+}
+
+static void run_helper(k_thread_entry_t entry)
+{
+	k_thread_create(&helper_thread, helper_stack,
+			K_THREAD_STACK_SIZEOF(helper_stack),
+			entry, NULL, NULL, NULL,
+			HELPER_PRIORITY, 0, K_NO_WAIT);
+	helper_created = true;
+}
+
+static void flush_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	zassert_true(k_work_flush(&block_work[0], &work_sync));
+	atomic_set(&helper_done, 1);
+}
+
+static void cancel_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	zassert_true(k_work_cancel_sync(&block_work[0], &work_sync));
+	atomic_set(&helper_done, 1);
+}
+
+static void drain_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	zassert_equal(k_work_queue_drain(&pool, false), 1);
+	atomic_set(&helper_done, 1);
+}
+
+/* Block one item in its handler and make sure it is running. */
+static void start_blocked_item(void)
+{
+	zassert_equal(k_work_submit_to_queue(&pool, &block_work[0]), 1);
+	k_msleep(SETTLE_MS);
+	zassert_equal(atomic_get(&started), 1);
+	zassert_equal(k_work_busy_get(&block_work[0]), K_WORK_RUNNING);
+}
+
+ZTEST(work_pool, test_concurrent_items)
+{
+	for (int i = 0; i < NUM_WORKERS; i++) {
+		zassert_equal(k_work_submit_to_queue(&pool, &block_work[i]), 1);
+	}
+
+	/* Every worker picks up one of the blocking items. */
+	k_msleep(SETTLE_MS);
+	zassert_equal(atomic_get(&started), NUM_WORKERS);
+	zassert_equal(atomic_get(&completed), 0);
+
+	for (int i = 0; i < NUM_WORKERS; i++) {
+		k_sem_give(&rel_sem);
+	}
+	k_msleep(SETTLE_MS);
+	zassert_equal(atomic_get(&completed), NUM_WORKERS);
+}
+
+ZTEST(work_pool, test_no_self_concurrency)
+{
+	int rc;
+
+	zassert_equal(k_work_submit_to_queue(&pool, &sleep_work), 1);
+	while (atomic_get(&started) == 0) {
+		k_msleep(1);
+	}
+
+	/* Resubmitting while the handler runs must queue it to run again
+	 * afterwards, not on one of the idle workers.
+	 */
+	rc = k_work_submit_to_queue(&pool, &sleep_work);
+	zassert_equal(rc, 2, "unexpected submission result %d", rc);
+
+	for (int i = 0; i < 10; i++) {
+		(void)k_work_submit_to_queue(&pool, &sleep_work);
+		k_msleep(3);
+	}
+
+	(void)k_work_queue_drain(&pool, false);
+	zassert_true(atomic_get(&completed) >= 2);
+	zassert_equal(atomic_get(&max_active), 1);
+}
+
+ZTEST(work_pool, test_flush_running)
+{
+	start_blocked_item();
+
+	/* The flush must wait for the handler even though other workers
+	 * are idle.
+	 */
+	run_helper(flush_entry);
+	k_msleep(SETTLE_MS);
+	zassert_equal(atomic_get(&helper_done), 0);
+
+	k_sem_give(&rel_sem);
+	k_msleep(SETTLE_MS);
+	zassert_equal(atomic_get(&helper_done), 1);
+	zassert_equal(atomic_get(&completed), 1);
+}
+
+ZTEST(work_pool, test_cancel_sync_running)
+{
+	start_blocked_item();
+
+	run_helper(cancel_entry);
+	k_msleep(SETTLE_MS);
+	zassert_equal(atomic_get(&helper_done), 0);
+	zassert_equal(k_work_busy_get(&block_work[0]),
+		      K_WORK_RUNNING | K_WORK_CANCELING);
+
+	k_sem_give(&rel_sem);
+	k_msleep(SETTLE_MS);
+	zassert_equal(atomic_get(&helper_done), 1);
+	zassert_equal(k_work_busy_get(&block_work[0]), 0);
+}
+
+ZTEST(work_pool, test_drain_waits_for_all_workers)
+{
+	for (int i = 0; i < NUM_WORKERS; i++) {
+		zassert_equal(k_work_submit_to_queue(&pool, &block_work[i]), 1);
+	}
+	k_msleep(SETTLE_MS);
+
+	run_helper(drain_entry);
+
+	/* Draining completes only once the last busy worker is done. */
+	for (int i = 0; i < NUM_WORKERS; i++) {
+		k_msleep(SETTLE_MS);
+		zassert_equal(atomic_get(&helper_done), 0);
+		k_sem_give(&rel_sem);
+	}
+
+	k_msleep(SETTLE_MS);
+	zassert_equal(atomic_get(&helper_done), 1);
+	zassert_equal(atomic_get(&completed), NUM_WORKERS);
+}
+
+ZTEST(work_pool, test_stats)
+{
+#ifdef CONFIG_WORKQUEUE_STATS
+	struct k_work_queue_stats stats;
+
+	k_work_queue_stats_reset(&pool);
+
+	for (int i = 0; i < NUM_WORKERS; i++) {
+		zassert_equal(k_work_submit_to_queue(&pool, &block_work[i]), 1);
+	}
+	k_msleep(SETTLE_MS);
+
+	for (int i = 0; i < NUM_WORKERS; i++) {
+		k_sem_give(&rel_sem);
+	}
+	(void)k_work_queue_drain(&pool, false);
+
+	k_work_queue_stats_get(&pool, &stats);
+	zassert_equal(stats.processed, NUM_WORKERS);
+	zassert_equal(stats.pending, 0);
+	zassert_true(stats.max_pending >= 1);
+	zassert_equal(stats.max_busy, NUM_WORKERS);
+	zassert_true(stats.busy_cycles > 0);
+	zassert_true(stats.total_latency >= stats.max_latency);
+#else
+	ztest_test_skip();
+#endif
+}
+
+ZTEST_SUITE(work_pool, NULL, pool_setup, pool_before, pool_after, NULL);
@@ -7,6 +7,8 @@
 #include <zephyr/ztest.h>
 #include <zephyr/kernel.h>
 #include <zephyr/sys/fdtable.h>
+#include <zephyr/posix/unistd.h>
+#include <zephyr/posix/sys/ioctl.h>
 #include <errno.h>
 
 /* The thread will test that the refcounting of fd object will
@@ -178,4 +180,66 @@ ZTEST(fdtable, test_z_fd_multiple_access)
 	zassert_equal(errno, EBADF, "fd was found");
 }
 
+static K_SEM_DEFINE(ioctl_started, 0, 1);
+static K_SEM_DEFINE(ioctl_done, 0, 1);
+
+static int blocking_ioctl_vmeth(void *obj, unsigned int request, va_list args)
+{
+	k_sem_give(&ioctl_started);
+	k_sem_take(&ioctl_done, K_FOREVER);
+
+	return 42;
+}
+
+static int blocking_close_vmeth(void *obj)
+{
+	return 0;
+}
+
+static const struct fd_op_vtable blocking_vtable = {
+	.ioctl = blocking_ioctl_vmeth,
+	.close = blocking_close_vmeth,
+};
+
+static void ioctl_cb(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	zassert_equal(ioctl(POINTER_TO_INT(p1), 0), 42, "ioctl failed");
+}
+
+ZTEST(fdtable, test_close_during_ioctl)
+{
+	const struct fd_op_vtable *vtable;
+	int fd, fd2;
+
+	fd = z_alloc_fd((void *)&blocking_vtable, &blocking_vtable);
+	zassert_true(fd >= 0, "fd < 0");
+
+	k_thread_create(&fd_thread, fd_thread_stack,
+			K_THREAD_STACK_SIZEOF(fd_thread_stack),
+			ioctl_cb, INT_TO_POINTER(fd), NULL, NULL,
+			CONFIG_ZTEST_THREAD_PRIORITY, 0, K_NO_WAIT);
+
+	zassert_ok(k_sem_take(&ioctl_started, K_SECONDS(1)));
+
+	zassert_ok(close(fd), "close failed");
+
+	/* The entry is still in use by ioctl(), it must not be reused */
+	fd2 = z_reserve_fd();
+	zassert_true(fd2 >= 0, "fd2 < 0");
+	zassert_not_equal(fd2, fd, "entry reused while in use");
+	z_free_fd(fd2);
+
+	k_sem_give(&ioctl_done);
+	k_thread_join(&fd_thread, K_FOREVER);
+
+	/* Now it is free */
+	zassert_is_null(z_get_fd_obj_and_vtable(fd, &vtable, NULL));
+	fd2 = z_reserve_fd();
+	zassert_equal(fd2, fd, "entry not freed");
+	z_free_fd(fd2);
+}
+
 ZTEST_SUITE(fdtable, NULL, NULL, NULL, NULL, NULL);
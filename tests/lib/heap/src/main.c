@@ -50,6 +50,14 @@
 #define SOLO_FREE_HEADER_HEAP_SZ (64)
 #endif
 
+/* The fast bin list heads and their running total add to it as well */
+#ifdef CONFIG_SYS_HEAP_FAST_BINS
+#define SOLO_FREE_HEADER_EXTRA_SZ \
+	ROUND_UP((CONFIG_SYS_HEAP_FAST_BIN_COUNT + 1) * sizeof(uint32_t), 8)
+#else
+#define SOLO_FREE_HEADER_EXTRA_SZ 0
+#endif
+
 #define SCRATCH_SZ (sizeof(heapmem) / 2)
 
 /* The test memory.  Make them pointer arrays for robust alignment
@@ -154,10 +162,25 @@ static void log_result(size_t sz, struct z_heap_stress_result *r)
 	uint32_t succ_pct = ((100ULL * r->successful_allocs + r->total_allocs / 2)
 			  / r->total_allocs);
 
+	uint32_t failed = r->total_allocs - r->successful_allocs;
+	uint32_t ops_per_sec = (uint32_t)(((uint64_t)tot *
+					   sys_clock_hw_cycles_per_sec()) /
+					  MAX(r->op_cycles, 1));
+
 	TC_PRINT("successful allocs: %d/%d (%d%%), frees: %d,"
 		 "  avg usage: %d/%d (%d%%)\n",
 		 r->successful_allocs, r->total_allocs, succ_pct,
 		 r->total_frees, avg, (int) sz, avg_pct);
+
+	if (failed != 0) {
+		uint32_t fail_avg = (uint32_t)((r->accumulated_failed_in_use_bytes +
+						failed / 2) / failed);
+
+		TC_PRINT("avg usage at failed alloc: %d/%d (%d%%)\n",
+			 fail_avg, (int) sz,
+			 (uint32_t)((100ULL * fail_avg + sz / 2) / sz));
+	}
+	TC_PRINT("ops/sec: %u\n", ops_per_sec);
 }
 
 /* Do a heavy test over a small heap, with many iterations that need
@@ -259,7 +282,8 @@ ZTEST(lib_heap, test_solo_free_header)
 
 	TC_PRINT("Testing solo free header in a heap\n");
 
-	sys_heap_init(&heap, heapmem, SOLO_FREE_HEADER_HEAP_SZ);
+	sys_heap_init(&heap, heapmem,
+		      SOLO_FREE_HEADER_HEAP_SZ + SOLO_FREE_HEADER_EXTRA_SZ);
 	if (sizeof(void *) > 4U) {
 		sys_heap_alloc(&heap, 1);
 		zassert_true(sys_heap_validate(&heap), "");
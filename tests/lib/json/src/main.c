@@ -8,6 +8,9 @@
 #include <stdbool.h>
 #include <zephyr/ztest.h>
 #include <zephyr/data/json.h>
+#ifdef CONFIG_NET_BUF
+#include <zephyr/net/buf.h>
+#endif
 
 struct test_nested {
 	int nested_int;
@@ -1209,4 +1212,256 @@ ZTEST(lib_json_test, test_large_descriptor)
 	zassert_true(ret & ((int64_t)1 << 39), "Field int39 not decoded");
 }
 
+#ifdef CONFIG_JSON_STREAM_PARSER
+static char stream_str_buf[512];
+
+/* Feed the parser with chunks of chunk_len bytes */
+static int64_t stream_parse(const char *json, size_t chunk_len,
+			    const struct json_obj_descr *descr, size_t descr_len,
+			    void *val, size_t buf_size)
+{
+	struct json_stream_parser parser;
+	size_t len = strlen(json);
+	int64_t ret = -EAGAIN;
+
+	json_stream_parser_init(&parser, descr, descr_len, val,
+				stream_str_buf, buf_size);
+
+	for (size_t pos = 0; pos < len; pos += chunk_len) {
+		ret = json_stream_parse(&parser, &json[pos], MIN(chunk_len, len - pos));
+		if (ret != -EAGAIN) {
+			break;
+		}
+	}
+
+	return ret;
+}
+
+static void assert_nested_equal(const struct test_nested *a,
+				const struct test_nested *b)
+{
+	zassert_equal(a->nested_int, b->nested_int);
+	zassert_equal(a->nested_bool, b->nested_bool);
+	zassert_true(!strcmp(a->nested_string, b->nested_string));
+}
+
+ZTEST(lib_json_test, test_json_stream_decoding)
+{
+	static const char json[] = "{\"some_string\":\"zephyr 123\\uABCD456\","
+		"\"some_int\":\t42\n,"
+		"\"some_bool\":true    \t  "
+		"\n"
+		"\r   ,"
+		"\"some_nested_struct\":{    "
+		"\"nested_int\":-1234,\n\n"
+		"\"nested_bool\":false,\t"
+		"\"nested_string\":\"this should be escaped: \\t\","
+		"\"extra_nested_array\":[0,-1]},"
+		"\"extra_struct\":{\"nested_bool\":false,\"s\":\"}]\\\"\"},"
+		"\"extra_bool\":true,"
+		"\"some_array\":[11,22, 33,\t45,\n299],"
+		"\"another_b!@l\":true,"
+		"\"if\":false,"
+		"\"another-array\":[2,3,5,7],"
+		"\"4nother_ne$+\":{\"nested_int\":1234,"
+		"\"nested_bool\":true,"
+		"\"nested_string\":\"no escape necessary\"},"
+		"\"nested_obj_array\":["
+		"{\"nested_int\":1,\"nested_bool\":true,\"nested_string\":\"true\"},"
+		"{\"nested_int\":0,\"nested_bool\":false,\"nested_string\":\"false\"}]"
+		"}\n";
+	char encoded[sizeof(json)];
+	struct test_struct expected;
+	struct test_struct ts;
+	int64_t ret;
+
+	memcpy(encoded, json, sizeof(json));
+	ret = json_obj_parse(encoded, sizeof(encoded) - 1, test_descr,
+			     ARRAY_SIZE(test_descr), &expected);
+	zassert_equal(ret, (1 << ARRAY_SIZE(test_descr)) - 1);
+
+	for (size_t chunk_len = 1; chunk_len < sizeof(json); chunk_len++) {
+		memset(&ts, 0, sizeof(ts));
+		ret = stream_parse(json, chunk_len, test_descr,
+				   ARRAY_SIZE(test_descr), &ts,
+				   sizeof(stream_str_buf));
+
+		zassert_equal(ret, (1 << ARRAY_SIZE(test_descr)) - 1,
+			      "Not all fields decoded with %d byte chunks", chunk_len);
+		zassert_true(!strcmp(ts.some_string, expected.some_string));
+		zassert_equal(ts.some_int, expected.some_int);
+		zassert_equal(ts.some_bool, expected.some_bool);
+		assert_nested_equal(&ts.some_nested_struct,
+				    &expected.some_nested_struct);
+		zassert_equal(ts.some_array_len, expected.some_array_len);
+		zassert_true(!memcmp(ts.some_array, expected.some_array,
+				     ts.some_array_len * sizeof(ts.some_array[0])));
+		zassert_equal(ts.another_bxxl, expected.another_bxxl);
+		zassert_equal(ts.if_, expected.if_);
+		zassert_equal(ts.another_array_len, expected.another_array_len);
+		zassert_true(!memcmp(ts.another_array, expected.another_array,
+				     ts.another_array_len * sizeof(ts.another_array[0])));
+		assert_nested_equal(&ts.xnother_nexx, &expected.xnother_nexx);
+		zassert_equal(ts.obj_array_len, expected.obj_array_len);
+		for (size_t i = 0; i < ts.obj_array_len; i++) {
+			assert_nested_equal(&ts.nested_obj_array[i],
+					    &expected.nested_obj_array[i]);
+		}
+	}
+}
+
+ZTEST(lib_json_test, test_json_stream_2dim_obj_arr_decoding)
+{
+	static const char json[] = "{\"objects_array_array\":["
+		"[{\"name\":\"Sim\303\263n Bol\303\255var\",\"height\":168},"
+		 "{\"name\":\"Pel\303\251\",\"height\":173},"
+		 "{\"name\":\"Usain Bolt\",\"height\":195}],"
+		"[{\"name\":\"Muggsy Bogues\",\"height\":160},"
+		 "{\"name\":\"Hakeem Olajuwon\",\"height\":213}],"
+		"[{\"name\":\"Alex Honnold\",\"height\":180},"
+		 "{\"name\":\"Hazel Findlay\",\"height\":157},"
+		 "{\"name\":\"Daila Ojeda\",\"height\":158},"
+		 "{\"name\":\"Albert Einstein\",\"height\":172}]"
+		"]}";
+	static const size_t num_elements[] = { 3, 2, 4 };
+	char encoded[sizeof(json)];
+	struct obj_array_2dim expected;
+	struct obj_array_2dim oaa;
+	int64_t ret;
+
+	memcpy(encoded, json, sizeof(json));
+	ret = json_obj_parse(encoded, sizeof(encoded) - 1, array_2dim_descr,
+			     ARRAY_SIZE(array_2dim_descr), &expected);
+	zassert_equal(ret, 1);
+
+	for (size_t chunk_len = 1; chunk_len < sizeof(json); chunk_len += 7) {
+		ret = stream_parse(json, chunk_len, array_2dim_descr,
+				   ARRAY_SIZE(array_2dim_descr), &oaa,
+				   sizeof(stream_str_buf));
+
+		zassert_equal(ret, 1, "Not decoded with %d byte chunks", chunk_len);
+		zassert_equal(oaa.objects_array_array_len, ARRAY_SIZE(num_elements));
+
+		for (int i = 0; i < ARRAY_SIZE(num_elements); i++) {
+			const struct obj_array *arr = &oaa.objects_array_array[i];
+			const struct obj_array *exp = &expected.objects_array_array[i];
+
+			zassert_equal(arr->num_elements, num_elements[i]);
+			for (int j = 0; j < arr->num_elements; j++) {
+				zassert_true(!strcmp(arr->elements[j].name,
+						     exp->elements[j].name));
+				zassert_equal(arr->elements[j].height,
+					      exp->elements[j].height);
+			}
+		}
+	}
+}
+
+ZTEST(lib_json_test, test_json_stream_errors)
+{
+	struct encoding_test encoded[] = {
+		{ "{\"some_string\":\"\\u@@@@\"}", -EINVAL },
+		{ "{\"some_string\":\"\\X\"}", -EINVAL },
+		{ "{\"some_bool\":truffle }", -EINVAL },
+		{ "{\"some_string\":null }", -EINVAL },
+		{ "{\"some_int\":xxx }", -EINVAL },
+		{ "{\"some_int\":4x2 }", -EINVAL },
+		{ "{\"some_string\",}", -EINVAL },
+		{ "{\"some_string\":false}", -EINVAL },
+		{ "{\"some_array\":[1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17]}", -ENOSPC },
+		{ "[]", -EINVAL },
+		{ "{\"some_string", -EAGAIN },
+		{ "{\"some_int\":42", -EAGAIN },
+		{ "{\"key_not_in_descr\":123456}", 0 },
+		{ "{\"some_int\":1} trailing data is ignored", 1 << 1 },
+	};
+	struct test_struct ts;
+	int64_t ret;
+
+	for (int i = 0; i < ARRAY_SIZE(encoded); i++) {
+		ret = stream_parse(encoded[i].str, 3, test_descr,
+				   ARRAY_SIZE(test_descr), &ts,
+				   sizeof(stream_str_buf));
+		zassert_equal(ret, encoded[i].result,
+			      "Decoding '%s' result %d, expected %d",
+			      encoded[i].str, (int)ret, encoded[i].result);
+	}
+
+	/* Decoded string and its terminating NUL character don't fit in the
+	 * storage, which must also be able to hold the key.
+	 */
+	ret = stream_parse("{\"some_string\":\"0123456789ab\"}", 4, test_descr,
+			   ARRAY_SIZE(test_descr), &ts, 12);
+	zassert_equal(ret, -ENOMEM);
+
+	ret = stream_parse("{\"some_string\":\"0123456789a\"}", 4, test_descr,
+			   ARRAY_SIZE(test_descr), &ts, 12);
+	zassert_equal(ret, 1 << 0);
+	zassert_true(!strcmp(ts.some_string, "0123456789a"));
+}
+#endif /* CONFIG_JSON_STREAM_PARSER */
+
+#ifdef CONFIG_NET_BUF
+NET_BUF_POOL_DEFINE(json_net_buf_pool, 64, 16, 0, NULL);
+
+ZTEST(lib_json_test, test_json_encode_net_buf)
+{
+	struct test_struct ts = {
+		.some_string = "zephyr 123",
+		.some_int = 42,
+		.some_bool = true,
+		.some_nested_struct = {
+			.nested_int = -1234,
+			.nested_bool = false,
+			.nested_string = "this should be escaped: \t"
+		},
+		.some_array = { 1, 4, 8, 16, 32 },
+		.some_array_len = 5,
+		.another_array_len = 0,
+		.xnother_nexx = {
+			.nested_int = 1234,
+			.nested_bool = true,
+			.nested_string = "no escape necessary",
+		},
+		.nested_obj_array = {
+			{1, true, "true"},
+			{0, false, "false"}
+		},
+		.obj_array_len = 2
+	};
+	static char expected[512];
+	static char encoded[512];
+	struct net_buf *buf = NULL;
+	ssize_t len;
+	int ret;
+
+	ret = json_obj_encode_buf(test_descr, ARRAY_SIZE(test_descr), &ts,
+				  expected, sizeof(expected));
+	zassert_equal(ret, 0);
+	len = strlen(expected);
+
+	/* One fragment short of the encoded length */
+	for (int i = 0; i < DIV_ROUND_UP(len, 16) - 1; i++) {
+		buf = net_buf_frag_add(buf, net_buf_alloc(&json_net_buf_pool, K_NO_WAIT));
+	}
+
+	ret = json_obj_encode_net_buf(test_descr, ARRAY_SIZE(test_descr), &ts, buf);
+	zassert_equal(ret, -ENOMEM);
+
+	net_buf_unref(buf);
+	buf = NULL;
+	for (int i = 0; i < DIV_ROUND_UP(len, 16); i++) {
+		buf = net_buf_frag_add(buf, net_buf_alloc(&json_net_buf_pool, K_NO_WAIT));
+	}
+
+	ret = json_obj_encode_net_buf(test_descr, ARRAY_SIZE(test_descr), &ts, buf);
+	zassert_equal(ret, 0);
+	zassert_equal(net_buf_frags_len(buf), len);
+	zassert_equal(net_buf_linearize(encoded, sizeof(encoded), buf, 0, len), len);
+	zassert_mem_equal(encoded, expected, len);
+
+	net_buf_unref(buf);
+}
+#endif /* CONFIG_NET_BUF */
+
 ZTEST_SUITE(lib_json_test, NULL, NULL, NULL, NULL, NULL);
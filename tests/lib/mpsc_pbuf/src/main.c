@@ -925,6 +925,7 @@ ZTEST(log_buffer, test_overwrite_consistency)
 		.flags = MPSC_PBUF_MODE_OVERWRITE
 	};
 
+	current_rd_idx = 0;
 	mpsc_pbuf_init(&buffer, &cfg);
 	int repeat = 50000;
 	int id = 0;
@@ -978,6 +979,175 @@ ZTEST(log_buffer, test_overwrite_consistency)
 	}
 }
 
+void item_claim_batch(bool pow2)
+{
+	const union mpsc_pbuf_generic *items[4];
+	struct mpsc_pbuf_buffer buffer;
+	union test_item test_1word = {.data = {.valid = 1, .len = 1 }};
+	uint32_t rd = 0;
+	uint32_t wr = 0;
+	uint32_t cnt;
+
+	init(&buffer, 8 - !pow2, false);
+
+	for (int i = 0; i < 3 * buffer.size; i++) {
+		/* Put up to 5 packets and read them in batches of up to 4. */
+		for (int j = 0; j <= (i % 6); j++) {
+			test_1word.data.data = wr++;
+			mpsc_pbuf_put_word(&buffer, test_1word.item);
+		}
+
+		while ((cnt = mpsc_pbuf_claim_batch(&buffer, items,
+						    ARRAY_SIZE(items))) > 0) {
+			zassert_true(cnt <= ARRAY_SIZE(items));
+			for (int j = 0; j < cnt; j++) {
+				union test_item *t = (union test_item *)items[j];
+
+				zassert_equal(t->data.data, rd++);
+			}
+			mpsc_pbuf_free_batch(&buffer, items, cnt);
+		}
+
+		zassert_equal(rd, wr);
+		zassert_false(mpsc_pbuf_is_pending(&buffer));
+	}
+
+	zassert_is_null(mpsc_pbuf_claim(&buffer));
+}
+
+ZTEST(log_buffer, test_claim_batch)
+{
+	item_claim_batch(true);
+	item_claim_batch(false);
+}
+
+void overwrite_while_claimed_batch(bool pow2)
+{
+	const union mpsc_pbuf_generic *items[2];
+	struct test_data_var *p;
+	struct mpsc_pbuf_buffer buffer;
+
+	init(&buffer, 32 - !pow2, true);
+
+	uint32_t fill_len = 5;
+	uint32_t len = 6;
+	uint32_t packet_cnt = saturate_buffer_uneven(&buffer, fill_len);
+
+	/* Claim 2 packets. Buffer is now full. Allocation shall skip both
+	 * claimed packets and drop the next one, which together with the
+	 * remaining space at the end of the buffer fits the new packet.
+	 */
+	zassert_equal(mpsc_pbuf_claim_batch(&buffer, items, ARRAY_SIZE(items)), 2);
+	p = (struct test_data_var *)items[0];
+	zassert_equal(p->hdr.len, fill_len);
+	zassert_equal(p->hdr.data, 0);
+	p = (struct test_data_var *)items[1];
+	zassert_equal(p->hdr.data, 1);
+
+	exp_dropped_data[0] = 2;
+	exp_dropped_len[0] = fill_len;
+	exp_drop_cnt = 1;
+	p = (struct test_data_var *)mpsc_pbuf_alloc(&buffer, len, K_NO_WAIT);
+	zassert_true(p);
+	zassert_equal(drop_cnt, exp_drop_cnt);
+	p->hdr.len = len;
+	mpsc_pbuf_commit(&buffer, (union mpsc_pbuf_generic *)p);
+
+	mpsc_pbuf_free_batch(&buffer, items, 2);
+
+	for (int i = 0; i < packet_cnt - drop_cnt - 2; i++) {
+		p = (struct test_data_var *)mpsc_pbuf_claim(&buffer);
+		zassert_true(p);
+		zassert_equal(p->hdr.len, fill_len);
+		zassert_equal(p->hdr.data, i + drop_cnt + 2);
+		mpsc_pbuf_free(&buffer, (union mpsc_pbuf_generic *)p);
+	}
+
+	p = (struct test_data_var *)mpsc_pbuf_claim(&buffer);
+	zassert_true(p);
+	zassert_equal(p->hdr.len, len);
+	mpsc_pbuf_free(&buffer, (union mpsc_pbuf_generic *)p);
+
+	zassert_is_null(mpsc_pbuf_claim(&buffer));
+
+	/* Packet committed afterwards shall be readable. */
+	p = (struct test_data_var *)mpsc_pbuf_alloc(&buffer, fill_len, K_NO_WAIT);
+	zassert_true(p);
+	p->hdr.len = fill_len;
+	mpsc_pbuf_commit(&buffer, (union mpsc_pbuf_generic *)p);
+
+	zassert_equal(mpsc_pbuf_claim_batch(&buffer, items, ARRAY_SIZE(items)), 1);
+	zassert_equal_ptr(items[0], p);
+	mpsc_pbuf_free_batch(&buffer, items, 1);
+}
+
+ZTEST(log_buffer, test_overwrite_while_claimed_batch)
+{
+	overwrite_while_claimed_batch(true);
+	overwrite_while_claimed_batch(false);
+}
+
+ZTEST(log_buffer, test_overwrite_consistency_batch)
+{
+	const union mpsc_pbuf_generic *items[8];
+	struct mpsc_pbuf_buffer buffer;
+	static struct mpsc_pbuf_buffer_config cfg = {
+		.buf = buf32,
+		.size = ARRAY_SIZE(buf32),
+		.notify_drop = consistent_drop,
+		.get_wlen = get_wlen,
+		.flags = MPSC_PBUF_MODE_OVERWRITE
+	};
+
+	current_rd_idx = 0;
+	mpsc_pbuf_init(&buffer, &cfg);
+	int repeat = 50000;
+	int id = 0;
+
+	while (id < repeat) {
+		uint32_t cnt = 0;
+		bool alloc_during_claim = (rand_get(1, 5) <= 2);
+
+		/* Occasionally claim a batch to simulate that processing of
+		 * the batch is interrupted by allocations.
+		 */
+		if (alloc_during_claim) {
+			cnt = mpsc_pbuf_claim_batch(&buffer, items,
+						    rand_get(1, ARRAY_SIZE(items)));
+			for (int i = 0; i < cnt; i++) {
+				validate_packet((struct test_data_var *)items[i]);
+			}
+		}
+
+		uint32_t wr_cnt = rand_get(1, 15);
+
+		for (int i = 0; i < wr_cnt; i++) {
+			uint32_t wlen = rand_get(1, 15);
+			struct test_data_var *tdv;
+
+			tdv = (struct test_data_var *)mpsc_pbuf_alloc(&buffer,
+								      wlen,
+								      K_NO_WAIT);
+			tdv->hdr.len = wlen;
+			tdv->hdr.data = id++;
+			mpsc_pbuf_commit(&buffer, (union mpsc_pbuf_generic *)tdv);
+		}
+
+		/* Put back batch claimed before committing new items. */
+		mpsc_pbuf_free_batch(&buffer, items, cnt);
+
+		uint32_t rd_cnt = rand_get(1, 10);
+
+		for (int i = 0; i < rd_cnt; i++) {
+			cnt = mpsc_pbuf_claim_batch(&buffer, items, ARRAY_SIZE(items));
+			for (int j = 0; j < cnt; j++) {
+				validate_packet((struct test_data_var *)items[j]);
+			}
+			mpsc_pbuf_free_batch(&buffer, items, cnt);
+		}
+	}
+}
+
 K_THREAD_STACK_DEFINE(t1_stack, 1024);
 K_THREAD_STACK_DEFINE(t2_stack, 1024);
 
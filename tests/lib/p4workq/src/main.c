@@ -274,5 +274,44 @@ ZTEST(lib_p4wq_1cpu, test_p4wq_simple)
 	zassert_true(has_run, "high-priority item didn't run");
 }
 
+static struct k_p4wq_work order_items[4];
+static int order[ARRAY_SIZE(order_items)];
+static int num_ordered;
+
+static void order_handler(struct k_p4wq_work *work)
+{
+	order[num_ordered++] = work - order_items;
+}
+
+/* Items submitted while they can't run are run by priority, then by
+ * deadline
+ */
+ZTEST(lib_p4wq_1cpu, test_p4wq_order)
+{
+	static const int prios[] = { 4, 2, 3, 2 };
+	static const int deadlines_us[] = { 100, 1000, 100, 100 };
+	static const int expected[] = { 3, 1, 2, 0 };
+
+	k_thread_priority_set(k_current_get(), 1);
+
+	num_ordered = 0;
+	for (int i = 0; i < ARRAY_SIZE(order_items); i++) {
+		order_items[i] = (struct k_p4wq_work){};
+		order_items[i].priority = prios[i];
+		order_items[i].deadline = k_us_to_cyc_ceil32(deadlines_us[i]);
+		order_items[i].handler = order_handler;
+		k_p4wq_submit(&wq, &order_items[i]);
+	}
+	zassert_equal(num_ordered, 0, "items ran too early");
+
+	k_msleep(10);
+	zassert_equal(num_ordered, ARRAY_SIZE(order_items),
+		      "not all items ran");
+	for (int i = 0; i < ARRAY_SIZE(order_items); i++) {
+		zassert_equal(order[i], expected[i], "item %d ran as %d",
+			      expected[i], i);
+	}
+}
+
 ZTEST_SUITE(lib_p4wq, NULL, NULL, NULL, NULL, NULL);
 ZTEST_SUITE(lib_p4wq_1cpu, NULL, NULL, ztest_simple_1cpu_before, ztest_simple_1cpu_after, NULL);
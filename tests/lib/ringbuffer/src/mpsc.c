@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <zephyr/ztest.h>
+#include <zephyr/ztress.h>
+#include <zephyr/sys/ring_buffer.h>
+#include <string.h>
+
+#define MPSC_PRODUCERS 3
+#define MPSC_RECORD_SIZE 4
+
+RING_BUF_MPSC_DECLARE(mpsc_ringbuf, 32);
+
+static uint16_t mpsc_put_seq[MPSC_PRODUCERS];
+static uint16_t mpsc_get_seq[MPSC_PRODUCERS];
+
+ZTEST(ringbuffer_api, test_ringbuffer_mpsc_claim_vec)
+{
+	struct ring_buf_vec vec[2];
+	uint8_t data[32];
+	uint8_t *ptr;
+	uint32_t len;
+
+	ring_buf_mpsc_init(&mpsc_ringbuf, sizeof(data), data);
+	zassert_equal(ring_buf_mpsc_capacity_get(&mpsc_ringbuf), sizeof(data));
+
+	/* Move the indexes close to the end of the buffer */
+	zassert_equal(ring_buf_mpsc_put(&mpsc_ringbuf, data, 28), 28);
+	zassert_equal(ring_buf_mpsc_get(&mpsc_ringbuf, NULL, 28), 28);
+	zassert_true(ring_buf_mpsc_is_empty(&mpsc_ringbuf));
+
+	/* A contiguous claim stops at the end of the buffer */
+	len = ring_buf_mpsc_put_claim(&mpsc_ringbuf, &ptr, 8);
+	zassert_equal(len, 4);
+	zassert_equal(ptr, &data[28]);
+	zassert_equal(ring_buf_mpsc_put_finish(&mpsc_ringbuf, len), 0);
+
+	/* A vectored claim returns both segments */
+	len = ring_buf_mpsc_put_claim_vec(&mpsc_ringbuf, vec, 40);
+	zassert_equal(len, 28);
+	zassert_equal(vec[0].data, &data[0]);
+	zassert_equal(vec[0].size, 28);
+	zassert_equal(vec[1].size, 0);
+	zassert_equal(ring_buf_mpsc_space_get(&mpsc_ringbuf), 0);
+	zassert_equal(ring_buf_mpsc_put_finish(&mpsc_ringbuf, len), 0);
+
+	len = ring_buf_mpsc_get_claim_vec(&mpsc_ringbuf, vec, 10);
+	zassert_equal(len, 10);
+	zassert_equal(vec[0].data, &data[28]);
+	zassert_equal(vec[0].size, 4);
+	zassert_equal(vec[1].data, &data[0]);
+	zassert_equal(vec[1].size, 6);
+	zassert_equal(ring_buf_mpsc_get_finish(&mpsc_ringbuf, 11), -EINVAL);
+	zassert_equal(ring_buf_mpsc_get_finish(&mpsc_ringbuf, len), 0);
+	zassert_equal(ring_buf_mpsc_size_get(&mpsc_ringbuf), 22);
+}
+
+ZTEST(ringbuffer_api, test_ringbuffer_mpsc_finish_order)
+{
+	uint8_t data[32];
+	uint8_t out[8];
+	uint8_t *first, *second;
+
+	ring_buf_mpsc_init(&mpsc_ringbuf, sizeof(data), data);
+
+	zassert_equal(ring_buf_mpsc_put_finish(&mpsc_ringbuf, 0), -EINVAL,
+		      "Finished without a claim");
+
+	zassert_equal(ring_buf_mpsc_put_claim(&mpsc_ringbuf, &first, 4), 4);
+	zassert_equal(ring_buf_mpsc_put_claim(&mpsc_ringbuf, &second, 4), 4);
+	zassert_equal(second, first + 4);
+	memcpy(first, "abcd", 4);
+	memcpy(second, "efgh", 4);
+
+	/* Nothing is visible until the first claim is finished too */
+	zassert_equal(ring_buf_mpsc_put_finish(&mpsc_ringbuf, 4), 0);
+	zassert_true(ring_buf_mpsc_is_empty(&mpsc_ringbuf));
+	zassert_equal(ring_buf_mpsc_space_get(&mpsc_ringbuf), 24);
+
+	zassert_equal(ring_buf_mpsc_put_finish(&mpsc_ringbuf, 4), 0);
+	zassert_equal(ring_buf_mpsc_size_get(&mpsc_ringbuf), 8);
+
+	zassert_equal(ring_buf_mpsc_get(&mpsc_ringbuf, out, sizeof(out)), 8);
+	zassert_mem_equal(out, "abcdefgh", 8);
+}
+
+static bool mpsc_produce(void *user_data, uint32_t iter_cnt, bool last, int prio)
+{
+	uintptr_t id = (uintptr_t)user_data;
+	uint8_t record[MPSC_RECORD_SIZE];
+	uint32_t len;
+
+	if (iter_cnt == 0) {
+		mpsc_put_seq[id] = 0;
+	}
+
+	record[0] = id;
+	record[1] = mpsc_put_seq[id] & 0xff;
+	record[2] = mpsc_put_seq[id] >> 8;
+	record[3] = ~id;
+
+	/* Records are all the same size so there's no partial one */
+	len = ring_buf_mpsc_put(&mpsc_ringbuf, record, sizeof(record));
+	if (len != 0) {
+		zassert_equal(len, sizeof(record));
+		mpsc_put_seq[id]++;
+	}
+
+	return true;
+}
+
+static bool mpsc_consume(void *user_data, uint32_t iter_cnt, bool last, int prio)
+{
+	uint8_t record[MPSC_RECORD_SIZE];
+	uint16_t seq;
+	uint8_t id;
+
+	if (iter_cnt == 0) {
+		memset(mpsc_get_seq, 0, sizeof(mpsc_get_seq));
+	}
+
+	while (ring_buf_mpsc_size_get(&mpsc_ringbuf) >= sizeof(record)) {
+		zassert_equal(ring_buf_mpsc_get(&mpsc_ringbuf, record, sizeof(record)),
+			      sizeof(record));
+
+		id = record[0];
+		zassert_true(id < MPSC_PRODUCERS, "Unexpected producer %d", id);
+		zassert_equal(record[3], (uint8_t)~id, "Corrupted record");
+
+		/* Each producer's records come in order, none is lost */
+		seq = record[1] | (record[2] << 8);
+		zassert_equal(seq, mpsc_get_seq[id], "Got %u, exp: %u from %u",
+			      seq, mpsc_get_seq[id], id);
+		mpsc_get_seq[id]++;
+	}
+
+	return true;
+}
+
+/* Test is validating multiple producers putting data while preempting
+ * each other, with a single consumer.
+ */
+ZTEST(ringbuffer_api, test_ringbuffer_mpsc_stress)
+{
+	uint8_t data[32];
+	k_timeout_t timeout;
+
+	ring_buf_mpsc_init(&mpsc_ringbuf, sizeof(data), data);
+
+	timeout = (CONFIG_SYS_CLOCK_TICKS_PER_SEC < 10000) ? K_MSEC(1000) : K_MSEC(10000);
+
+	ztress_set_timeout(timeout);
+	ZTRESS_EXECUTE(ZTRESS_TIMER(mpsc_produce, (void *)0, 0, Z_TIMEOUT_TICKS(20)),
+		       ZTRESS_THREAD(mpsc_produce, (void *)1, 0, 0, Z_TIMEOUT_TICKS(20)),
+		       ZTRESS_THREAD(mpsc_produce, (void *)2, 0, 1000, Z_TIMEOUT_TICKS(20)),
+		       ZTRESS_THREAD(mpsc_consume, NULL, 0, 2000, Z_TIMEOUT_TICKS(20)));
+}
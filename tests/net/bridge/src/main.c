@@ -218,9 +218,10 @@ static void test_iface_setup(void)
 }
 
 /*
- * Simulate a packet reception from the outside world
+ * Simulate a packet reception from the outside world, dst overrides the
+ * default destination address when not NULL.
  */
-static void _recv_data(struct net_if *iface)
+static void _recv_data_to(struct net_if *iface, const uint8_t *dst)
 {
 	struct net_pkt *pkt;
 	struct net_eth_hdr eth_hdr;
@@ -252,6 +253,10 @@ static void _recv_data(struct net_if *iface)
 	eth_hdr.src.addr[4] = 0x77;
 	eth_hdr.src.addr[5] = 0x88;
 
+	if (dst != NULL) {
+		memcpy(eth_hdr.dst.addr, dst, sizeof(eth_hdr.dst.addr));
+	}
+
 	eth_hdr.type = htons(NET_ETH_PTYPE_ALL);
 
 	ret = net_pkt_write(pkt, &eth_hdr, sizeof(eth_hdr));
@@ -265,6 +270,11 @@ static void _recv_data(struct net_if *iface)
 	zassert_equal(ret, 0, "");
 }
 
+static void _recv_data(struct net_if *iface)
+{
+	_recv_data_to(iface, NULL);
+}
+
 static void test_recv_before_bridging(void)
 {
 	/* fake some packet reception */
@@ -352,6 +362,73 @@ static void test_recv_with_bridge(void)
 	check_free_packet_count();
 }
 
+#if defined(CONFIG_NET_ETHERNET_BRIDGE_FDB)
+static void count_fdb_entry(struct eth_bridge *br, const struct net_eth_addr *addr,
+			    struct net_if *iface, uint32_t age, void *user_data)
+{
+	int *count = user_data;
+
+	(*count)++;
+}
+
+static void test_recv_with_fdb(void)
+{
+	struct eth_bridge_stats before, after;
+	uint8_t dst[6];
+	int count = 0;
+
+	/* all three source addresses were learned by test_recv_with_bridge() */
+	eth_bridge_fdb_foreach(&test_bridge, count_fdb_entry, &count);
+	zassert_equal(count, 3, "");
+
+	eth_bridge_stats_get(&test_bridge, &before);
+
+	/* send to the station seen behind fake_iface[0] */
+	dst[0] = 0xa2;
+	dst[1] = 0x11;
+	dst[2] = 0x22;
+	dst[3] = net_if_get_by_iface(fake_iface[0]);
+	dst[4] = 0x77;
+	dst[5] = 0x88;
+
+	_recv_data_to(fake_iface[2], dst);
+
+	k_sleep(K_MSEC(100));
+
+	/* only the port of the destination transmitted the packet */
+	zassert_is_null(eth_fake_data[1].sent_pkt, "");
+	zassert_is_null(eth_fake_data[2].sent_pkt, "");
+	zassert_not_null(eth_fake_data[0].sent_pkt, "");
+	zassert_mem_equal(NET_ETH_HDR(eth_fake_data[0].sent_pkt)->dst.addr,
+			  dst, sizeof(dst), "");
+
+	net_pkt_unref(eth_fake_data[0].sent_pkt);
+	eth_fake_data[0].sent_pkt = NULL;
+
+	/* a destination on the incoming port is not forwarded at all */
+	_recv_data_to(fake_iface[0], dst);
+
+	k_sleep(K_MSEC(100));
+
+	zassert_is_null(eth_fake_data[0].sent_pkt, "");
+	zassert_is_null(eth_fake_data[1].sent_pkt, "");
+	zassert_is_null(eth_fake_data[2].sent_pkt, "");
+
+	eth_bridge_stats_get(&test_bridge, &after);
+	zassert_equal(after.rx - before.rx, 2, "");
+	zassert_equal(after.forwarded - before.forwarded, 1, "");
+	zassert_equal(after.filtered - before.filtered, 1, "");
+	zassert_equal(after.flooded, before.flooded, "");
+
+	check_free_packet_count();
+
+	eth_bridge_fdb_flush(&test_bridge);
+	count = 0;
+	eth_bridge_fdb_foreach(&test_bridge, count_fdb_entry, &count);
+	zassert_equal(count, 0, "");
+}
+#endif
+
 static void test_recv_after_bridging(void)
 {
 	int ret;
@@ -374,6 +451,9 @@ ZTEST(net_eth_bridge, test_net_eth_bridge)
 	test_recv_before_bridging();
 	test_setup_bridge();
 	test_recv_with_bridge();
+#if defined(CONFIG_NET_ETHERNET_BRIDGE_FDB)
+	test_recv_with_fdb();
+#endif
 	test_recv_after_bridging();
 }
 
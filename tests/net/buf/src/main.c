@@ -71,6 +71,7 @@ static void var_destroy(struct net_buf *buf);
 NET_BUF_POOL_HEAP_DEFINE(bufs_pool, 10, USER_DATA_HEAP, buf_destroy);
 NET_BUF_POOL_FIXED_DEFINE(fixed_pool, 10, FIXED_BUFFER_SIZE, USER_DATA_FIXED, fixed_destroy);
 NET_BUF_POOL_VAR_DEFINE(var_pool, 10, 1024, USER_DATA_VAR, var_destroy);
+NET_BUF_POOL_FIXED_DEFINE(chain_pool, 8, FIXED_BUFFER_SIZE, USER_DATA_FIXED, NULL);
 
 static void buf_destroy(struct net_buf *buf)
 {
@@ -470,6 +471,85 @@ ZTEST(net_buf_tests, test_net_buf_var_pool)
 	zassert_equal(destroy_called, 3, "Incorrect destroy callback count");
 }
 
+static int chain_len(struct net_buf *buf)
+{
+	int count = 0;
+
+	for (; buf; buf = buf->frags) {
+		zassert_equal(buf->ref, 1, "Invalid fragment ref count");
+		zassert_equal(buf->len, 0, "Invalid fragment length");
+		count++;
+	}
+
+	return count;
+}
+
+ZTEST(net_buf_tests, test_net_buf_alloc_chain)
+{
+	struct net_buf *buf1;
+
+	destroy_called = 0;
+
+	buf1 = net_buf_alloc_chain(&fixed_pool, 2 * FIXED_BUFFER_SIZE + 1,
+				   K_NO_WAIT);
+	zassert_not_null(buf1, "Failed to get buffer chain");
+	zassert_equal(chain_len(buf1), 3, "Invalid number of fragments");
+	zassert_equal(buf1->frags->size, FIXED_BUFFER_SIZE,
+		      "Invalid fragment size");
+
+	net_buf_unref_chain(buf1);
+	zassert_equal(destroy_called, 3, "Incorrect destroy callback count");
+
+	/* Without a maximum allocation size, a single buffer is used */
+	buf1 = net_buf_alloc_chain(&var_pool, 500, K_NO_WAIT);
+	zassert_not_null(buf1, "Failed to get buffer chain");
+	zassert_equal(chain_len(buf1), 1, "Invalid number of fragments");
+	zassert_true(buf1->size >= 500, "Invalid buffer size");
+
+	net_buf_unref_chain(buf1);
+	zassert_equal(destroy_called, 4, "Incorrect destroy callback count");
+}
+
+ZTEST(net_buf_tests, test_net_buf_alloc_chain_exhaust)
+{
+	struct net_buf *buf1, *buf2;
+	int i;
+
+	for (i = 0; i < 3; i++) {
+		buf1 = net_buf_alloc_chain(&chain_pool,
+					   5 * FIXED_BUFFER_SIZE, K_NO_WAIT);
+		zassert_not_null(buf1, "Failed to get buffer chain");
+		zassert_equal(chain_len(buf1), 5, "Invalid number of fragments");
+
+		/* Not enough buffers left, nothing must be kept allocated */
+		buf2 = net_buf_alloc_chain(&chain_pool,
+					   4 * FIXED_BUFFER_SIZE, K_NO_WAIT);
+		zassert_is_null(buf2, "Got chain from exhausted pool");
+
+		buf2 = net_buf_alloc_chain(&chain_pool,
+					   3 * FIXED_BUFFER_SIZE, K_NO_WAIT);
+		zassert_not_null(buf2, "Failed to get remaining buffers");
+		zassert_equal(chain_len(buf2), 3, "Invalid number of fragments");
+
+		/* A chain shared with another owner is released by the last one */
+		net_buf_ref(buf2);
+		net_buf_unref_chain(buf2);
+		zassert_equal(buf2->ref, 1, "Shared chain freed");
+		zassert_equal(chain_len(buf2), 3, "Shared chain modified");
+
+		net_buf_unref_chain(buf1);
+		net_buf_unref_chain(buf2);
+	}
+
+	/* The freed buffers are all usable again */
+	buf1 = net_buf_alloc_chain(&chain_pool, 8 * FIXED_BUFFER_SIZE,
+				   TEST_TIMEOUT);
+	zassert_not_null(buf1, "Failed to get the whole pool");
+	zassert_equal(chain_len(buf1), 8, "Invalid number of fragments");
+
+	net_buf_unref_chain(buf1);
+}
+
 ZTEST(net_buf_tests, test_net_buf_byte_order)
 {
 	struct net_buf *buf;
@@ -465,7 +465,7 @@ static struct net_buf frame_buf = {
 	.__buf = frame_buffer_data,
 };
 
-static bool test_fragment(struct net_fragment_data *data)
+static bool test_fragment_reassembly(struct net_fragment_data *data, bool reverse)
 {
 	struct net_pkt *rxpkt = NULL;
 	struct net_pkt *f_pkt = NULL;
@@ -492,18 +492,28 @@ static bool test_fragment(struct net_fragment_data *data)
 		goto end;
 	}
 
+	f_pkt = net_pkt_alloc(K_FOREVER);
+	if (!f_pkt) {
+		goto end;
+	}
+
 	if (!ieee802154_6lo_requires_fragmentation(pkt, 0, 0)) {
-		f_pkt = pkt;
+		/* Sent in a single frame, like ieee802154_send() does */
+		dfrag = net_pkt_get_frag(f_pkt, net_pkt_get_len(pkt), K_FOREVER);
+		if (!dfrag) {
+			goto end;
+		}
+
+		dfrag->len = net_buf_linearize(dfrag->data, dfrag->size, pkt->buffer, 0,
+					       net_pkt_get_len(pkt));
+		net_pkt_frag_add(f_pkt, dfrag);
+
+		net_pkt_unref(pkt);
 		pkt = NULL;
 
 		goto reassemble;
 	}
 
-	f_pkt = net_pkt_alloc(K_FOREVER);
-	if (!f_pkt) {
-		goto end;
-	}
-
 	ieee802154_6lo_fragment_ctx_init(&ctx, pkt, hdr_diff, data->iphc);
 	frame_buf.len = 0U;
 
@@ -528,6 +538,20 @@ static bool test_fragment(struct net_fragment_data *data)
 	pkt = NULL;
 
 reassemble:
+	if (reverse) {
+		struct net_buf *prev = NULL, *next;
+
+		/* Pass the fragments to reassembly in reverse order */
+		buf = f_pkt->buffer;
+		while (buf) {
+			next = buf->frags;
+			buf->frags = prev;
+			prev = buf;
+			buf = next;
+		}
+
+		f_pkt->buffer = prev;
+	}
 
 #if DEBUG > 0
 	printk("length after compression and fragmentation %zd\n",
@@ -593,6 +617,11 @@ end:
 	return result;
 }
 
+static bool test_fragment(struct net_fragment_data *data)
+{
+	return test_fragment_reassembly(data, false);
+}
+
 ZTEST(ieee802154_6lo_fragment, test_fragment_sam00_dam00)
 {
 	bool ret = test_fragment(&test_data_1);
@@ -656,4 +685,10 @@ ZTEST(ieee802154_6lo_fragment, test_fragment_ipv6_no_fragmentation_after_iphc)
 	zassert_true(ret);
 }
 
+ZTEST(ieee802154_6lo_fragment, test_fragment_out_of_order)
+{
+	zassert_true(test_fragment_reassembly(&test_data_1, true));
+	zassert_true(test_fragment_reassembly(&test_data_8, true));
+}
+
 ZTEST_SUITE(ieee802154_6lo_fragment, NULL, NULL, NULL, NULL, NULL);
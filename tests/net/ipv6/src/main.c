@@ -1682,4 +1682,46 @@ ZTEST(net_ipv6, test_nd_reachability_hint)
 	zassert_equal(net_ipv6_nbr_data(nbr)->state, NET_IPV6_NBR_STATE_REACHABLE);
 }
 
+ZTEST(net_ipv6, test_nbr_lookup_many)
+{
+	struct in6_addr addr[4];
+	struct net_nbr *nbr;
+	int i;
+
+	/* Enough neighbors to share hash buckets */
+	for (i = 0; i < ARRAY_SIZE(addr); i++) {
+		net_ipv6_addr_create(&addr[i], 0x2001, 0x0db8, 0, 0, 0, 0,
+				     0x1000, i + 1);
+
+		nbr = net_ipv6_nbr_add(TEST_NET_IF, &addr[i], NULL, false,
+				       NET_IPV6_NBR_STATE_STALE);
+		zassert_not_null(nbr, "Cannot add neighbor %d", i);
+	}
+
+	for (i = 0; i < ARRAY_SIZE(addr); i++) {
+		nbr = net_ipv6_nbr_lookup(TEST_NET_IF, &addr[i]);
+		zassert_not_null(nbr, "Neighbor %d not found", i);
+		zassert_true(net_ipv6_addr_cmp(&net_ipv6_nbr_data(nbr)->addr,
+					       &addr[i]), "Wrong neighbor %d", i);
+	}
+
+	/* Removing one neighbor keeps the others reachable */
+	zassert_true(net_ipv6_nbr_rm(TEST_NET_IF, &addr[1]), "");
+	zassert_is_null(net_ipv6_nbr_lookup(TEST_NET_IF, &addr[1]), "");
+
+	for (i = 0; i < ARRAY_SIZE(addr); i++) {
+		if (i == 1) {
+			continue;
+		}
+
+		zassert_not_null(net_ipv6_nbr_lookup(TEST_NET_IF, &addr[i]),
+				 "Neighbor %d lost", i);
+		(void)net_ipv6_nbr_rm(TEST_NET_IF, &addr[i]);
+	}
+
+	for (i = 0; i < ARRAY_SIZE(addr); i++) {
+		zassert_is_null(net_ipv6_nbr_lookup(TEST_NET_IF, &addr[i]), "");
+	}
+}
+
 ZTEST_SUITE(net_ipv6, NULL, ipv6_setup, NULL, NULL, ipv6_teardown);
@@ -329,6 +329,113 @@ static ssize_t z_impl_zsock_recvfrom_custom_fake_echo_next_req(int sock, void *b
 	return sizeof(ack_data);
 }
 
+#define BLOCK2_SIZE 64
+#define BLOCK2_SZX 2
+
+struct block2_request {
+	uint16_t id;
+	uint8_t token[COAP_TOKEN_MAX_LEN];
+	int num;
+};
+
+static struct block2_request block2_requests[8];
+static int block2_pending;
+static int block2_max_pending;
+static size_t block2_received;
+static bool block2_done;
+
+static void z_impl_sys_rand_get_custom_fake_counter(void *dst, size_t len)
+{
+	static uint8_t counter;
+
+	for (size_t i = 0; i < len; i++) {
+		((uint8_t *)dst)[i] = ++counter;
+	}
+}
+
+static void z_impl_sys_rand_get_custom_fake_zero(void *dst, size_t len)
+{
+	memset(dst, 0, len);
+}
+
+static ssize_t z_impl_zsock_sendto_custom_fake_block2(int sock, void *buf, size_t len,
+						       int flags, const struct sockaddr *dest_addr,
+						       socklen_t addrlen)
+{
+	struct coap_packet request = {0};
+	struct block2_request *req = &block2_requests[block2_pending];
+	int block2;
+	int ret;
+
+	ret = coap_packet_parse(&request, buf, len, NULL, 0);
+	zassert_equal(ret, 0, "Invalid request sent");
+	zassert_true(block2_pending < ARRAY_SIZE(block2_requests), "Too many requests");
+
+	block2 = coap_get_option_int(&request, COAP_OPTION_BLOCK2);
+
+	req->id = coap_header_get_id(&request);
+	coap_header_get_token(&request, req->token);
+	req->num = block2 < 0 ? 0 : GET_BLOCK_NUM(block2);
+
+	block2_pending++;
+	block2_max_pending = MAX(block2_max_pending, block2_pending);
+	set_socket_events(ZSOCK_POLLIN);
+
+	return len;
+}
+
+static ssize_t z_impl_zsock_recvfrom_custom_fake_block2(int sock, void *buf, size_t max_len,
+							 int flags, struct sockaddr *src_addr,
+							 socklen_t *addrlen)
+{
+	struct block2_request req = block2_requests[0];
+	size_t total = strlen(long_payload);
+	size_t offset = req.num * BLOCK2_SIZE;
+	bool more = offset + BLOCK2_SIZE < total;
+	struct coap_packet response;
+	int ret;
+
+	zassert_true(block2_pending > 0, "No request to answer");
+
+	memmove(&block2_requests[0], &block2_requests[1],
+		(--block2_pending) * sizeof(block2_requests[0]));
+	if (block2_pending == 0) {
+		clear_socket_events();
+	}
+
+	ret = coap_packet_init(&response, buf, max_len, COAP_VERSION_1, COAP_TYPE_ACK,
+			       COAP_TOKEN_MAX_LEN, req.token, COAP_RESPONSE_CODE_CONTENT, req.id);
+	zassert_equal(ret, 0, "Failed to init response");
+
+	ret = coap_append_option_int(&response, COAP_OPTION_BLOCK2,
+				     (req.num << 4) | (more << 3) | BLOCK2_SZX);
+	zassert_equal(ret, 0, "Failed to append block2 option");
+
+	ret = coap_append_option_int(&response, COAP_OPTION_SIZE2, total);
+	zassert_equal(ret, 0, "Failed to append size2 option");
+
+	ret = coap_packet_append_payload_marker(&response);
+	zassert_equal(ret, 0, "Failed to append payload marker");
+
+	ret = coap_packet_append_payload(&response, long_payload + offset,
+					 MIN(BLOCK2_SIZE, total - offset));
+	zassert_equal(ret, 0, "Failed to append payload");
+
+	return response.offset;
+}
+
+static void coap_callback_block2(int16_t code, size_t offset, const uint8_t *payload, size_t len,
+				 bool last_block, void *user_data)
+{
+	last_response_code = code;
+
+	zassert_equal(offset, block2_received, "Block delivered out of order");
+	zassert_mem_equal(payload, long_payload + offset, len, "Invalid block payload");
+
+	block2_received += len;
+	block2_done = last_block;
+}
+
 static void *suite_setup(void)
 {
 	coap_client_init(&client, NULL);
@@ -687,3 +794,45 @@ ZTEST(coap_client, test_unmatching_tokens)
 	k_sleep(K_MSEC(500));
 	zassert_equal(last_response_code, -ETIMEDOUT, "Unexpected response");
 }
+
+ZTEST(coap_client, test_block2_prefetch)
+{
+	int ret = 0;
+	struct sockaddr address = {0};
+	struct coap_client_request client_request = {
+		.method = COAP_METHOD_GET,
+		.confirmable = true,
+		.path = test_path,
+		.fmt = COAP_CONTENT_FORMAT_TEXT_PLAIN,
+		.cb = coap_callback_block2,
+		.payload = NULL,
+		.len = 0
+	};
+
+	z_impl_sys_rand_get_fake.custom_fake = z_impl_sys_rand_get_custom_fake_counter;
+	z_impl_zsock_sendto_fake.custom_fake = z_impl_zsock_sendto_custom_fake_block2;
+	z_impl_zsock_recvfrom_fake.custom_fake = z_impl_zsock_recvfrom_custom_fake_block2;
+	block2_pending = 0;
+	block2_max_pending = 0;
+	block2_received = 0;
+	block2_done = false;
+	clear_socket_events();
+
+	LOG_INF("Send request");
+	ret = coap_client_req(&client, 0, &address, &client_request, NULL);
+	zassert_true(ret >= 0, "Sending request failed, %d", ret);
+
+	k_sleep(K_MSEC(500));
+
+	/* The other tests expect an all zero token */
+	z_impl_sys_rand_get_fake.custom_fake = z_impl_sys_rand_get_custom_fake_zero;
+	(void)coap_next_token();
+
+	zassert_true(block2_done, "Transfer not completed");
+	zassert_equal(block2_received, strlen(long_payload), "Incomplete transfer");
+	zassert_equal(last_response_code, COAP_RESPONSE_CODE_CONTENT, "Unexpected response");
+	zassert_equal(block2_max_pending, 1 + CONFIG_COAP_CLIENT_BLOCK2_WINDOW,
+		      "Blocks not requested ahead");
+	zassert_equal(z_impl_zsock_sendto_fake.call_count,
+		      DIV_ROUND_UP(strlen(long_payload), BLOCK2_SIZE));
+}
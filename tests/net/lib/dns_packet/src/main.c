@@ -1242,6 +1242,100 @@ ZTEST(dns_packet, test_dns_flags_len)
 		      "DNS message length check failed (%d)", ret);
 }
 
+#if defined(CONFIG_DNS_RESOLVER_CACHE)
+static int cache_addr_count;
+static enum dns_resolve_status cache_status;
+
+static void cache_cb(enum dns_resolve_status status,
+		     struct dns_addrinfo *info,
+		     void *user_data)
+{
+	ARG_UNUSED(user_data);
+
+	if (status == DNS_EAI_INPROGRESS) {
+		zassert_equal(info->ai_family, AF_INET, "Invalid family");
+		zassert_mem_equal(&net_sin(&info->ai_addr)->sin_addr,
+				  resp_ipv4_addr, sizeof(resp_ipv4_addr),
+				  "Invalid address");
+		cache_addr_count++;
+	} else {
+		cache_status = status;
+	}
+}
+
+static bool cache_lookup(const char *name)
+{
+	cache_addr_count = 0;
+	cache_status = DNS_EAI_INPROGRESS;
+
+	return dns_cache_lookup(name, DNS_QUERY_TYPE_A, cache_cb, NULL);
+}
+#endif
+
+ZTEST(dns_packet, test_dns_cache)
+{
+#if defined(CONFIG_DNS_RESOLVER_CACHE)
+	struct dns_pending_query query = {
+		.query = DNAME1,
+		.query_type = DNS_QUERY_TYPE_A,
+	};
+	struct dns_resolve_cache_stats stats;
+	struct dns_addrinfo info = { 0 };
+
+	dns_resolve_cache_flush();
+
+	zassert_false(cache_lookup(DNAME1), "Empty cache hit");
+
+	info.ai_family = AF_INET;
+	info.ai_addr.sa_family = AF_INET;
+	info.ai_addrlen = sizeof(struct sockaddr_in);
+	memcpy(&net_sin(&info.ai_addr)->sin_addr, resp_ipv4_addr,
+	       sizeof(resp_ipv4_addr));
+
+	/* The CNAME leading to the address lives shorter than the address */
+	dns_cache_query_start(&query);
+	dns_cache_query_ttl(&query, 1);
+	dns_cache_query_add(&query, &info);
+	dns_cache_query_ttl(&query, 3600);
+	dns_cache_query_done(&query, DNS_EAI_ALLDONE);
+
+	zassert_true(cache_lookup("WWW.ZephyrProject.org"), "Cache miss");
+	zassert_equal(cache_addr_count, 1, "Invalid address count");
+	zassert_equal(cache_status, DNS_EAI_ALLDONE, "Invalid status");
+
+	zassert_false(dns_cache_lookup(DNAME1, DNS_QUERY_TYPE_AAAA, cache_cb,
+				       NULL), "Hit for wrong type");
+
+	k_msleep(1100);
+	zassert_false(cache_lookup(DNAME1), "Expired entry hit");
+
+	/* Negative answer */
+	query.query = DNAME2;
+	dns_cache_query_start(&query);
+	dns_cache_query_done(&query, DNS_EAI_NODATA);
+
+	zassert_true(cache_lookup(DNAME2), "Negative answer not cached");
+	zassert_equal(cache_addr_count, 0, "Invalid address count");
+	zassert_equal(cache_status, DNS_EAI_NODATA, "Invalid status");
+
+	/* Failures are not cached */
+	query.query = ZEPHYR_LOCAL;
+	dns_cache_query_start(&query);
+	dns_cache_query_done(&query, DNS_EAI_FAIL);
+	zassert_false(cache_lookup(ZEPHYR_LOCAL), "Failure cached");
+
+	dns_resolve_cache_stats_get(&stats);
+	zassert_equal(stats.hits, 1, "Invalid hit count");
+	zassert_equal(stats.negative_hits, 1, "Invalid negative hit count");
+	zassert_equal(stats.misses, 4, "Invalid miss count");
+
+	dns_resolve_cache_flush();
+	zassert_false(cache_lookup(DNAME2), "Flushed entry hit");
+#else
+	ztest_test_skip();
+#endif
+}
+
 ZTEST_SUITE(dns_packet, NULL, NULL, NULL, NULL, NULL);
 /* TODO:
  *	1) add malformed DNS data (mostly done)
@@ -126,6 +126,48 @@ ZTEST(lwm2m_registry, test_unknown_res)
 	zassert_equal(ret, 0);
 }
 
+ZTEST(lwm2m_registry, test_obj_inst_lookup)
+{
+	struct lwm2m_engine_obj_inst *obj_inst;
+	struct lwm2m_engine_res *res;
+	int ret;
+
+	for (int i = 0; i < CONFIG_LWM2M_IPSO_TEMP_SENSOR_INSTANCE_COUNT; i++) {
+		ret = lwm2m_create_object_inst(&LWM2M_OBJ(3303, i));
+		zassert_equal(ret, 0);
+	}
+
+	for (int i = 0; i < CONFIG_LWM2M_IPSO_TEMP_SENSOR_INSTANCE_COUNT; i++) {
+		obj_inst = lwm2m_engine_get_obj_inst(&LWM2M_OBJ(3303, i));
+		zassert_not_null(obj_inst);
+		zassert_equal(obj_inst->obj->obj_id, 3303);
+		zassert_equal(obj_inst->obj_inst_id, i);
+
+		res = lwm2m_engine_get_res(&LWM2M_OBJ(3303, i, 5700));
+		zassert_not_null(res);
+		zassert_equal(res->res_id, 5700);
+	}
+
+	ret = lwm2m_delete_object_inst(&LWM2M_OBJ(3303, 1));
+	zassert_equal(ret, 0);
+
+	zassert_is_null(lwm2m_engine_get_obj_inst(&LWM2M_OBJ(3303, 1)));
+	zassert_is_null(lwm2m_engine_get_res(&LWM2M_OBJ(3303, 1, 5700)));
+	zassert_not_null(lwm2m_engine_get_obj_inst(&LWM2M_OBJ(3303, 0)));
+	zassert_not_null(lwm2m_engine_get_obj_inst(&LWM2M_OBJ(3303, 2)));
+
+	for (int i = 0; i < CONFIG_LWM2M_IPSO_TEMP_SENSOR_INSTANCE_COUNT; i++) {
+		if (i == 1) {
+			continue;
+		}
+
+		ret = lwm2m_delete_object_inst(&LWM2M_OBJ(3303, i));
+		zassert_equal(ret, 0);
+	}
+
+	zassert_is_null(lwm2m_engine_get_obj_inst(&LWM2M_OBJ(3303, 0)));
+}
+
 ZTEST(lwm2m_registry, test_get_res_inst)
 {
 	zassert_is_null(lwm2m_engine_get_res_inst(&LWM2M_OBJ(3)));
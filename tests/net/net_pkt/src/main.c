@@ -1151,6 +1151,109 @@ ZTEST(net_pkt_test_suite, test_net_pkt_remove_tail)
 	net_pkt_unref(pkt);
 }
 
+static uint16_t chksum_ref(uint16_t sum, const uint8_t *data, size_t len)
+{
+	uint16_t tmp;
+
+	for (size_t i = 0; i < len; i++) {
+		tmp = (i % 2) ? data[i] : data[i] << 8;
+		sum += tmp;
+		if (sum < tmp) {
+			sum++;
+		}
+	}
+
+	return sum;
+}
+
+ZTEST(net_pkt_test_suite, test_net_pkt_write_chksum)
+{
+	static uint8_t data[CONFIG_NET_BUF_DATA_SIZE * 2 + 3];
+	static uint8_t readback[sizeof(data) + 1];
+	struct net_pkt *pkt;
+	uint16_t sum = 0U;
+	int err;
+
+	for (int i = 0; i < sizeof(data); i++) {
+		data[i] = (uint8_t)(i * 7 + 0xf3);
+	}
+
+	pkt = net_pkt_alloc_with_buffer(NULL, sizeof(data) + 1,
+					AF_UNSPEC, 0, K_NO_WAIT);
+	zassert_true(pkt != NULL, "Pkt not allocated");
+
+	/* Start at an odd offset and span three buffers */
+	net_pkt_cursor_init(pkt);
+	zassert_equal(net_pkt_write_u8(pkt, 0), 0, "Write failed");
+
+	err = net_pkt_write_chksum(pkt, data, sizeof(data), &sum);
+	zassert_equal(err, 0, "Write with checksum failed");
+	zassert_equal(net_pkt_get_len(pkt), sizeof(data) + 1,
+		      "Pkt length is invalid");
+
+	net_pkt_cursor_init(pkt);
+	zassert_equal(net_pkt_read(pkt, readback, sizeof(readback)), 0,
+		      "Read failed");
+	zassert_mem_equal(readback + 1, data, sizeof(data), "Data mismatch");
+
+	zassert_equal(sum, chksum_ref(0U, readback, sizeof(readback)),
+		      "Checksum mismatch");
+
+	net_pkt_unref(pkt);
+}
+
+#if defined(CONFIG_NET_PKT_TX_ZEROCOPY)
+static int ext_released;
+
+static void ext_released_cb(void *user_data)
+{
+	ext_released += POINTER_TO_INT(user_data);
+}
+
+ZTEST(net_pkt_test_suite, test_net_pkt_append_external)
+{
+	static const uint8_t ext_data[] = "caller owned data";
+	static uint8_t readback[sizeof(ext_data) + 4];
+	struct net_pkt *pkt, *clone;
+	int err;
+
+	ext_released = 0;
+
+	pkt = net_pkt_alloc_with_buffer(NULL, 64, AF_UNSPEC, 0, K_NO_WAIT);
+	zassert_true(pkt != NULL, "Pkt not allocated");
+
+	zassert_equal(net_pkt_write_be32(pkt, 0x01020304), 0, "Write failed");
+
+	err = net_pkt_append_external(pkt, ext_data, sizeof(ext_data),
+				      ext_released_cb, INT_TO_POINTER(1),
+				      K_NO_WAIT);
+	zassert_equal(err, 0, "Append failed");
+	zassert_equal(pkt->buffer->frags->data, ext_data,
+		      "Data was copied");
+	zassert_equal(net_pkt_get_len(pkt), sizeof(ext_data) + 4,
+		      "Pkt length is invalid");
+
+	/* Nothing can be written after the caller data */
+	zassert_not_equal(net_pkt_write_u8(pkt, 0), 0, "Write succeeded");
+
+	net_pkt_cursor_init(pkt);
+	zassert_equal(net_pkt_read(pkt, readback, sizeof(readback)), 0,
+		      "Read failed");
+	zassert_mem_equal(readback + 4, ext_data, sizeof(ext_data),
+			  "Data mismatch");
+
+	/* A shallow clone keeps the data referenced */
+	clone = net_pkt_shallow_clone(pkt, K_NO_WAIT);
+	zassert_true(clone != NULL, "Pkt not cloned");
+
+	net_pkt_unref(pkt);
+	zassert_equal(ext_released, 0, "Data released too early");
+
+	net_pkt_unref(clone);
+	zassert_equal(ext_released, 1, "Data not released");
+}
+#endif /* CONFIG_NET_PKT_TX_ZEROCOPY */
+
 ZTEST(net_pkt_test_suite, test_net_pkt_shallow_clone_noleak_buf)
 {
 	const int bufs_to_allocate = 3;
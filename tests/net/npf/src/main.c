@@ -15,6 +15,7 @@ LOG_MODULE_REGISTER(npf_test, NET_LOG_LEVEL);
 #include <string.h>
 #include <errno.h>
 #include <zephyr/sys/printk.h>
+#include <zephyr/sys/byteorder.h>
 
 #include "ipv4.h"
 #include "ipv6.h"
@@ -216,6 +217,78 @@ ZTEST(net_pkt_filter_test_suite, test_npf_example1)
 	zassert_true(npf_remove_recv_rule(&small_ip_pkt), "");
 }
 
+/*
+ * Example 1 with a bytecode condition.
+ */
+
+static const struct npf_bpf_insn small_ip_prog[] = {
+	NPF_BPF_STMT(NPF_BPF_LD | NPF_BPF_H | NPF_BPF_ABS, 12),
+	NPF_BPF_JUMP(NPF_BPF_JMP | NPF_BPF_JEQ | NPF_BPF_K, NET_ETH_PTYPE_IP, 0, 3),
+	NPF_BPF_STMT(NPF_BPF_LD | NPF_BPF_W | NPF_BPF_LEN, 0),
+	NPF_BPF_JUMP(NPF_BPF_JMP | NPF_BPF_JGT | NPF_BPF_K, 200, 1, 0),
+	NPF_BPF_STMT(NPF_BPF_RET | NPF_BPF_K, 1),
+	NPF_BPF_STMT(NPF_BPF_RET | NPF_BPF_K, 0),
+};
+
+static NPF_BPF_MATCH(small_ip_bpf, small_ip_prog);
+static NPF_RULE(small_ip_pkt_bpf, NET_OK, small_ip_bpf);
+
+ZTEST(net_pkt_filter_test_suite, test_npf_bpf_example1)
+{
+	zassert_equal(npf_bpf_validate(small_ip_prog, ARRAY_SIZE(small_ip_prog)), 0, "");
+
+	/* install filter rules */
+	npf_insert_recv_rule(&npf_default_drop);
+	npf_insert_recv_rule(&small_ip_pkt_bpf);
+
+	test_npf_example_common();
+
+	/* remove filter rules */
+	zassert_true(npf_remove_recv_rule(&npf_default_drop), "");
+	zassert_true(npf_remove_recv_rule(&small_ip_pkt_bpf), "");
+}
+
+ZTEST(net_pkt_filter_test_suite, test_npf_bpf_load)
+{
+	const size_t offset = CONFIG_NET_BUF_DATA_SIZE - 2;
+	const struct npf_bpf_insn load_prog[] = {
+		/* Word across the first fragment boundary */
+		NPF_BPF_STMT(NPF_BPF_LD | NPF_BPF_W | NPF_BPF_ABS, offset),
+		NPF_BPF_STMT(NPF_BPF_RET | NPF_BPF_A, 0),
+	};
+	const struct npf_bpf_insn oob_prog[] = {
+		NPF_BPF_STMT(NPF_BPF_LD | NPF_BPF_B | NPF_BPF_ABS, 300),
+		NPF_BPF_STMT(NPF_BPF_RET | NPF_BPF_K, 1),
+	};
+	const struct npf_bpf_insn bad_prog[] = {
+		NPF_BPF_JUMP(NPF_BPF_JMP | NPF_BPF_JEQ | NPF_BPF_K, 0, 1, 0),
+		NPF_BPF_STMT(NPF_BPF_RET | NPF_BPF_K, 1),
+	};
+	const struct npf_bpf_insn div_prog[] = {
+		NPF_BPF_STMT(NPF_BPF_ALU | NPF_BPF_DIV | NPF_BPF_K, 0),
+		NPF_BPF_STMT(NPF_BPF_RET | NPF_BPF_K, 1),
+	};
+	struct net_pkt *pkt;
+	uint32_t expected;
+
+	pkt = build_test_pkt(NET_ETH_PTYPE_IP, 300, NULL);
+
+	expected = sys_get_be32((const uint8_t *)&dummy_data[offset - sizeof(struct net_eth_hdr)]);
+	zassert_equal(npf_bpf_run(load_prog, ARRAY_SIZE(load_prog), pkt), expected, "");
+
+	/* Loads past the end of the packet reject it */
+	zassert_equal(npf_bpf_run(oob_prog, ARRAY_SIZE(oob_prog), pkt), 0, "");
+
+	net_pkt_unref(pkt);
+
+	zassert_equal(npf_bpf_validate(load_prog, ARRAY_SIZE(load_prog)), 0, "");
+	zassert_equal(npf_bpf_validate(bad_prog, ARRAY_SIZE(bad_prog)), -EINVAL,
+		      "jump past the end accepted");
+	zassert_equal(npf_bpf_validate(div_prog, ARRAY_SIZE(div_prog)), -EINVAL,
+		      "division by zero accepted");
+	zassert_equal(npf_bpf_validate(load_prog, 1), -EINVAL, "missing return accepted");
+}
+
 /*
  * Example 2 in NPF_RULE() documentation.
  */
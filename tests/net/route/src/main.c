@@ -544,6 +544,44 @@ static void test_route_preference(void)
 	net_route_del(route_entry);
 }
 
+static void test_route_longest_prefix(void)
+{
+	struct in6_addr inner = generic_addr;
+	struct in6_addr outer = generic_addr;
+	struct net_route_entry *wide, *narrow, *entry;
+
+	inner.s6_addr[15] = 0x42;
+	outer.s6_addr[12] = 0x42;
+
+	wide = net_route_add(my_iface, &generic_addr, 64, &peer_addr,
+			     NET_IPV6_ND_INFINITE_LIFETIME,
+			     NET_ROUTE_PREFERENCE_LOW);
+	zassert_not_null(wide, "Route add failed");
+
+	narrow = net_route_add(my_iface, &generic_addr, 112, &peer_addr_alt,
+			       NET_IPV6_ND_INFINITE_LIFETIME,
+			       NET_ROUTE_PREFERENCE_LOW);
+	zassert_not_null(narrow, "Route add failed");
+
+	entry = net_route_lookup(my_iface, &inner);
+	zassert_equal_ptr(entry, narrow, "Longest prefix not found");
+
+	entry = net_route_lookup(my_iface, &outer);
+	zassert_equal_ptr(entry, wide, "Shorter prefix not found");
+
+	entry = net_route_lookup(my_iface, &ll_addr);
+	zassert_is_null(entry, "Route found for unrelated address");
+
+	zassert_false(net_route_del(narrow), "Route del failed");
+
+	entry = net_route_lookup(my_iface, &inner);
+	zassert_equal_ptr(entry, wide, "Removed route still found");
+
+	zassert_false(net_route_del(wide), "Route del failed");
+
+	entry = net_route_lookup(my_iface, &outer);
+	zassert_is_null(entry, "Removed route still found");
+}
 
 /*test case main entry*/
 ZTEST(route_test_suite, test_route)
@@ -566,6 +604,7 @@ ZTEST(route_test_suite, test_route)
 	test_route_del_many();
 	test_route_lifetime();
 	test_route_preference();
+	test_route_longest_prefix();
 }
 
 ZTEST_SUITE(route_test_suite, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,275 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_test, CONFIG_NET_SOCKETS_LOG_LEVEL);
+
+#include <stdio.h>
+#include <zephyr/ztest_assert.h>
+
+#include <zephyr/net/socket.h>
+#include <zephyr/net/socket_epoll.h>
+#include <zephyr/posix/sys/eventfd.h>
+
+#include "../../socket_helpers.h"
+
+#define BUF_AND_SIZE(buf) buf, sizeof(buf) - 1
+#define STRLEN(buf) (sizeof(buf) - 1)
+
+#define TEST_STR_SMALL "test"
+
+#define MY_IPV6_ADDR "::1"
+
+#define SERVER_PORT 4242
+#define CLIENT_PORT 9898
+
+#define WAIT_MS 100
+
+static int c_sock;
+static int s_sock;
+static int epfd;
+
+static void send_small(void)
+{
+	ssize_t len;
+
+	len = send(c_sock, BUF_AND_SIZE(TEST_STR_SMALL), 0);
+	zassert_equal(len, STRLEN(TEST_STR_SMALL), "invalid send len");
+}
+
+static void recv_small(void)
+{
+	char buf[10];
+	ssize_t len;
+
+	len = recv(s_sock, buf, sizeof(buf), 0);
+	zassert_equal(len, STRLEN(TEST_STR_SMALL), "invalid recv len");
+}
+
+static void add_sock(int sock, uint32_t events)
+{
+	struct epoll_event ev = {
+		.events = events,
+		.data.fd = sock,
+	};
+	int res;
+
+	res = epoll_ctl(epfd, EPOLL_CTL_ADD, sock, &ev);
+	zassert_equal(res, 0, "epoll_ctl failed (%d)", errno);
+}
+
+ZTEST(net_socket_epoll, test_level_triggered)
+{
+	struct epoll_event events[2];
+	int res;
+
+	add_sock(s_sock, EPOLLIN);
+
+	res = epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(res, 0, "unexpected event");
+
+	send_small();
+
+	res = epoll_wait(epfd, events, ARRAY_SIZE(events), WAIT_MS);
+	zassert_equal(res, 1, "no event");
+	zassert_equal(events[0].events, EPOLLIN, "");
+	zassert_equal(events[0].data.fd, s_sock, "");
+
+	/* Still readable, so reported again */
+	res = epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(res, 1, "event not repeated");
+
+	recv_small();
+
+	res = epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(res, 0, "event after data was read");
+
+	res = epoll_ctl(epfd, EPOLL_CTL_ADD, s_sock, &events[0]);
+	zassert_equal(res, -1, "duplicate add");
+	zassert_equal(errno, EEXIST, "");
+
+	res = epoll_ctl(epfd, EPOLL_CTL_DEL, s_sock, NULL);
+	zassert_equal(res, 0, "epoll_ctl failed (%d)", errno);
+
+	res = epoll_ctl(epfd, EPOLL_CTL_DEL, s_sock, NULL);
+	zassert_equal(res, -1, "removed twice");
+	zassert_equal(errno, ENOENT, "");
+}
+
+ZTEST(net_socket_epoll, test_edge_triggered)
+{
+	struct epoll_event events[2];
+	int res;
+
+	add_sock(s_sock, EPOLLIN | EPOLLET);
+
+	send_small();
+
+	res = epoll_wait(epfd, events, ARRAY_SIZE(events), WAIT_MS);
+	zassert_equal(res, 1, "no event");
+	zassert_equal(events[0].events, EPOLLIN, "");
+
+	/* Data is still pending but nothing new arrived */
+	res = epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(res, 0, "event repeated");
+
+	send_small();
+
+	res = epoll_wait(epfd, events, ARRAY_SIZE(events), WAIT_MS);
+	zassert_equal(res, 1, "no event for new data");
+
+	recv_small();
+	recv_small();
+}
+
+ZTEST(net_socket_epoll, test_oneshot)
+{
+	struct epoll_event ev = {
+		.events = EPOLLIN | EPOLLONESHOT,
+		.data.u32 = 42,
+	};
+	struct epoll_event events[2];
+	int res;
+
+	add_sock(s_sock, ev.events);
+
+	send_small();
+
+	res = epoll_wait(epfd, events, ARRAY_SIZE(events), WAIT_MS);
+	zassert_equal(res, 1, "no event");
+
+	res = epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(res, 0, "disabled socket reported");
+
+	/* Re-arming reports data that is already pending */
+	res = epoll_ctl(epfd, EPOLL_CTL_MOD, s_sock, &ev);
+	zassert_equal(res, 0, "epoll_ctl failed (%d)", errno);
+
+	res = epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(res, 1, "no event after re-arm");
+	zassert_equal(events[0].data.u32, 42, "");
+
+	recv_small();
+}
+
+ZTEST(net_socket_epoll, test_output)
+{
+	struct epoll_event events[2];
+	int res;
+
+	add_sock(c_sock, EPOLLOUT);
+
+	res = epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(res, 1, "UDP socket not writable");
+	zassert_equal(events[0].events, EPOLLOUT, "");
+	zassert_equal(events[0].data.fd, c_sock, "");
+}
+
+ZTEST(net_socket_epoll, test_polled_fd)
+{
+	struct epoll_event events[2];
+	eventfd_t value;
+	int efd;
+	int res;
+
+	efd = eventfd(0, 0);
+	zassert_true(efd >= 0, "eventfd failed (%d)", errno);
+
+	add_sock(efd, EPOLLIN);
+	add_sock(s_sock, EPOLLIN);
+
+	res = epoll_wait(epfd, events, ARRAY_SIZE(events), 10);
+	zassert_equal(res, 0, "unexpected event");
+
+	res = eventfd_write(efd, 1);
+	zassert_equal(res, 0, "");
+
+	res = epoll_wait(epfd, events, ARRAY_SIZE(events), WAIT_MS);
+	zassert_equal(res, 1, "no event");
+	zassert_equal(events[0].data.fd, efd, "");
+
+	send_small();
+
+	res = epoll_wait(epfd, events, ARRAY_SIZE(events), WAIT_MS);
+	zassert_equal(res, 2, "both fds should be ready");
+
+	res = eventfd_read(efd, &value);
+	zassert_equal(res, 0, "");
+	recv_small();
+
+	/* Closed file descriptors leave the instance */
+	res = close(efd);
+	zassert_equal(res, 0, "close failed");
+
+	res = epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(res, 0, "unexpected event");
+}
+
+ZTEST(net_socket_epoll, test_poll_epoll_fd)
+{
+	struct pollfd pfd = {
+		.fd = epfd,
+		.events = POLLIN,
+	};
+	int res;
+
+	add_sock(s_sock, EPOLLIN);
+
+	res = poll(&pfd, 1, 0);
+	zassert_equal(res, 0, "epoll fd readable");
+
+	send_small();
+
+	res = poll(&pfd, 1, WAIT_MS);
+	zassert_equal(res, 1, "epoll fd not readable");
+	zassert_equal(pfd.revents, POLLIN, "");
+
+	recv_small();
+}
+
+static void *setup(void)
+{
+	struct sockaddr_in6 c_addr;
+	struct sockaddr_in6 s_addr;
+	int res;
+
+	prepare_sock_udp_v6(MY_IPV6_ADDR, CLIENT_PORT, &c_sock, &c_addr);
+	prepare_sock_udp_v6(MY_IPV6_ADDR, SERVER_PORT, &s_sock, &s_addr);
+
+	res = bind(s_sock, (struct sockaddr *)&s_addr, sizeof(s_addr));
+	zassert_equal(res, 0, "bind failed");
+
+	res = connect(c_sock, (struct sockaddr *)&s_addr, sizeof(s_addr));
+	zassert_equal(res, 0, "connect failed");
+
+	return NULL;
+}
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	epfd = epoll_create1(0);
+	zassert_true(epfd >= 0, "epoll_create1 failed (%d)", errno);
+}
+
+static void after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	/* Also removes the sockets from the instance */
+	(void)close(epfd);
+}
+
+static void teardown(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	(void)close(c_sock);
+	(void)close(s_sock);
+}
+
+ZTEST_SUITE(net_socket_epoll, NULL, setup, before, after, teardown);
@@ -2419,6 +2419,50 @@ ZTEST(net_socket_tcp, test_so_keepalive)
 	test_context_cleanup();
 }
 
+ZTEST(net_socket_tcp, test_tcp_congestion)
+{
+	struct sockaddr_in bind_addr4;
+	char name[16];
+	socklen_t optlen = sizeof(name);
+	int sock, ret;
+
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, ANY_PORT, &sock, &bind_addr4);
+
+	ret = getsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, name, &optlen);
+	zassert_equal(ret, 0, "getsockopt failed (%d)", errno);
+	zassert_equal(strcmp(name, CONFIG_NET_TCP_CONGESTION_DEFAULT), 0,
+		      "getsockopt got invalid value");
+	zassert_equal(optlen, sizeof(CONFIG_NET_TCP_CONGESTION_DEFAULT),
+		      "getsockopt got invalid size");
+
+	ret = setsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, "reno", strlen("reno"));
+	zassert_equal(ret, 0, "setsockopt failed (%d)", errno);
+
+	optlen = sizeof(name);
+	ret = getsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, name, &optlen);
+	zassert_equal(ret, 0, "getsockopt failed (%d)", errno);
+	zassert_equal(strcmp(name, "reno"), 0, "getsockopt got invalid value");
+
+	ret = setsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, "vegas", strlen("vegas"));
+	zassert_equal(ret, -1, "setsockopt should fail");
+	zassert_equal(errno, ENOENT, "setsockopt got invalid errno (%d)", errno);
+
+	if (IS_ENABLED(CONFIG_NET_TCP_CONGESTION_CUBIC)) {
+		ret = setsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, "cubic",
+				 sizeof("cubic"));
+		zassert_equal(ret, 0, "setsockopt failed (%d)", errno);
+
+		optlen = sizeof(name);
+		ret = getsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, name, &optlen);
+		zassert_equal(ret, 0, "getsockopt failed (%d)", errno);
+		zassert_equal(strcmp(name, "cubic"), 0, "getsockopt got invalid value");
+	}
+
+	test_close(sock);
+
+	test_context_cleanup();
+}
+
 ZTEST(net_socket_tcp, test_keepalive_timeout)
 {
 	struct sockaddr_in c_saddr, s_saddr;
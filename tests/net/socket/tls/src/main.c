@@ -1634,6 +1634,79 @@ ZTEST(net_socket_tls, test_poll_dtls_pollerr)
 	k_msleep(10);
 }
 
+ZTEST(net_socket_tls, test_session_tickets)
+{
+#if defined(CONFIG_MBEDTLS_SSL_TICKET_C)
+	int enabled = TLS_SESSION_TICKETS_ENABLED;
+	int cache = TLS_SESSION_CACHE_ENABLED;
+	uint8_t rx_buf[sizeof(TEST_STR_SMALL) - 1];
+	struct sockaddr_in6 c_saddr;
+	struct sockaddr_in6 s_saddr;
+	struct connect_data test_data;
+	struct sockaddr addr;
+	socklen_t addrlen;
+	socklen_t optlen;
+	int optval;
+	int ret;
+
+	prepare_sock_tls_v6(MY_IPV6_ADDR, ANY_PORT, &s_sock, &s_saddr,
+			    IPPROTO_TLS_1_2);
+	test_config_psk(s_sock, -1);
+
+	ret = setsockopt(s_sock, SOL_TLS, TLS_SESSION_TICKETS, &enabled,
+			 sizeof(enabled));
+	zassert_equal(ret, 0, "setsockopt failed (%d)", errno);
+
+	optlen = sizeof(optval);
+	ret = getsockopt(s_sock, SOL_TLS, TLS_SESSION_TICKETS, &optval, &optlen);
+	zassert_equal(ret, 0, "getsockopt failed (%d)", errno);
+	zassert_equal(optval, TLS_SESSION_TICKETS_ENABLED, "Tickets not enabled");
+
+	test_bind(s_sock, (struct sockaddr *)&s_saddr, sizeof(s_saddr));
+	test_listen(s_sock);
+
+	/* The second connection resumes the session of the first one */
+	for (int i = 0; i < 2; i++) {
+		prepare_sock_tls_v6(MY_IPV6_ADDR, ANY_PORT, &c_sock, &c_saddr,
+				    IPPROTO_TLS_1_2);
+		test_config_psk(-1, c_sock);
+
+		ret = setsockopt(c_sock, SOL_TLS, TLS_SESSION_CACHE, &cache,
+				 sizeof(cache));
+		zassert_equal(ret, 0, "setsockopt failed (%d)", errno);
+		ret = setsockopt(c_sock, SOL_TLS, TLS_SESSION_TICKETS, &enabled,
+				 sizeof(enabled));
+		zassert_equal(ret, 0, "setsockopt failed (%d)", errno);
+
+		test_data.sock = c_sock;
+		test_data.addr = (struct sockaddr *)&s_saddr;
+		k_work_init_delayable(&test_data.work, client_connect_work_handler);
+		test_work_reschedule(&test_data.work, K_NO_WAIT);
+
+		addrlen = sizeof(addr);
+		test_accept(s_sock, &new_sock, &addr, &addrlen);
+		test_work_wait(&test_data.work);
+
+		test_send(c_sock, TEST_STR_SMALL, sizeof(TEST_STR_SMALL) - 1, 0);
+		ret = recv(new_sock, rx_buf, sizeof(rx_buf), 0);
+		zassert_equal(ret, sizeof(TEST_STR_SMALL) - 1, "recv() failed");
+		zassert_mem_equal(rx_buf, TEST_STR_SMALL, ret,
+				  "Invalid data received");
+
+		test_close(c_sock);
+		c_sock = -1;
+		test_close(new_sock);
+		new_sock = -1;
+	}
+
+	test_sockets_close();
+
+	k_sleep(TCP_TEARDOWN_TIMEOUT);
+#else
+	ztest_test_skip();
+#endif
+}
+
 static void *tls_tests_setup(void)
 {
 	k_work_queue_init(&tls_test_work_queue);
@@ -2408,6 +2408,188 @@ ZTEST_USER(net_socket_udp, test_35_recvmsg_msg_controllen_update)
 	zassert_equal(rv, 0, "close failed");
 }
 
+static void check_zerocopy_done(int sock, uint32_t lo, uint32_t hi)
+{
+	struct sock_extended_err *err;
+	struct zsock_pollfd pfd = {
+		.fd = sock,
+		.events = ZSOCK_POLLERR,
+	};
+	struct msghdr msg;
+	struct cmsghdr *cmsg;
+	union {
+		struct cmsghdr hdr;
+		unsigned char  buf[CMSG_SPACE(sizeof(struct sock_extended_err))];
+	} cmsgbuf;
+	int rv;
+
+	rv = zsock_poll(&pfd, 1, 1000);
+	zassert_equal(rv, 1, "poll failed (%d)", rv);
+	zassert_true(pfd.revents & ZSOCK_POLLERR, "no completion");
+
+	memset(&msg, 0, sizeof(msg));
+	msg.msg_control = &cmsgbuf.buf;
+	msg.msg_controllen = sizeof(cmsgbuf.buf);
+
+	rv = recvmsg(sock, &msg, MSG_ERRQUEUE);
+	zassert_equal(rv, 0, "recvmsg failed (%d)", errno);
+	zassert_true(msg.msg_flags & MSG_ERRQUEUE, "flag not set");
+
+	cmsg = CMSG_FIRSTHDR(&msg);
+	zassert_not_null(cmsg, "no ancillary data");
+	zassert_equal(cmsg->cmsg_level, IPPROTO_IP, "invalid level");
+	zassert_equal(cmsg->cmsg_type, IP_RECVERR, "invalid type");
+
+	err = (struct sock_extended_err *)CMSG_DATA(cmsg);
+	zassert_equal(err->ee_errno, 0, "invalid errno");
+	zassert_equal(err->ee_origin, SO_EE_ORIGIN_ZEROCOPY, "invalid origin");
+	zassert_equal(err->ee_code, 0, "data was copied");
+	zassert_equal(err->ee_info, lo, "invalid first send");
+	zassert_equal(err->ee_data, hi, "invalid last send");
+
+	/* The completion was consumed */
+	msg.msg_controllen = sizeof(cmsgbuf.buf);
+	rv = recvmsg(sock, &msg, MSG_ERRQUEUE);
+	zassert_equal(rv, -1, "recvmsg succeeded");
+	zassert_equal(errno, EAGAIN, "invalid errno (%d)", errno);
+}
+
+ZTEST(net_socket_udp, test_36_v4_sendmsg_zerocopy)
+{
+	static const char part1[] = "zero";
+	static const char part2[] = "copy";
+	char rx_buf[sizeof(part1) + sizeof(part2)];
+	int rv;
+	int client_sock;
+	int server_sock;
+	struct sockaddr_in client_addr;
+	struct sockaddr_in server_addr;
+	struct msghdr msg;
+	struct iovec io_vector[2];
+
+	if (!IS_ENABLED(CONFIG_NET_PKT_TX_ZEROCOPY)) {
+		ztest_test_skip();
+	}
+
+	prepare_sock_udp_v4(MY_IPV4_ADDR, ANY_PORT, &client_sock, &client_addr);
+	prepare_sock_udp_v4(MY_IPV4_ADDR, SERVER_PORT, &server_sock, &server_addr);
+
+	rv = bind(server_sock,
+		  (struct sockaddr *)&server_addr,
+		  sizeof(server_addr));
+	zassert_equal(rv, 0, "server bind failed");
+
+	io_vector[0].iov_base = (void *)part1;
+	io_vector[0].iov_len = strlen(part1);
+	io_vector[1].iov_base = (void *)part2;
+	io_vector[1].iov_len = strlen(part2);
+
+	memset(&msg, 0, sizeof(msg));
+	msg.msg_iov = io_vector;
+	msg.msg_iovlen = 2;
+	msg.msg_name = &server_addr;
+	msg.msg_namelen = sizeof(server_addr);
+
+	for (uint32_t id = 0; id < 2; id++) {
+		rv = sendmsg(client_sock, &msg, MSG_ZEROCOPY);
+		zassert_equal(rv, strlen(part1) + strlen(part2),
+			      "sendmsg failed (%d)", errno);
+
+		rv = recv(server_sock, rx_buf, sizeof(rx_buf), 0);
+		zassert_equal(rv, strlen(part1) + strlen(part2),
+			      "recv failed (%d)", errno);
+		zassert_mem_equal(rx_buf, "zerocopy", rv, "invalid data");
+
+		check_zerocopy_done(client_sock, id, id);
+	}
+
+	rv = close(client_sock);
+	zassert_equal(rv, 0, "close failed");
+	rv = close(server_sock);
+	zassert_equal(rv, 0, "close failed");
+}
+
+ZTEST(net_socket_udp, test_37_v4_sendmmsg_recvmmsg)
+{
+	static const char * const payloads[] = { "one", "two", "three" };
+	char rx_buf[ARRAY_SIZE(payloads) + 1][16];
+	struct iovec tx_iov[ARRAY_SIZE(payloads)];
+	struct iovec rx_iov[ARRAY_SIZE(rx_buf)];
+	struct mmsghdr tx_msgs[ARRAY_SIZE(payloads)];
+	struct mmsghdr rx_msgs[ARRAY_SIZE(rx_buf)];
+	struct zsock_timeval timeout = {
+		.tv_sec = 0,
+		.tv_usec = 100000,
+	};
+	struct sockaddr_in client_addr;
+	struct sockaddr_in server_addr;
+	int client_sock;
+	int server_sock;
+	int rv;
+
+	prepare_sock_udp_v4(MY_IPV4_ADDR, ANY_PORT, &client_sock, &client_addr);
+	prepare_sock_udp_v4(MY_IPV4_ADDR, SERVER_PORT, &server_sock, &server_addr);
+
+	rv = bind(server_sock,
+		  (struct sockaddr *)&server_addr,
+		  sizeof(server_addr));
+	zassert_equal(rv, 0, "server bind failed");
+
+	memset(tx_msgs, 0, sizeof(tx_msgs));
+	for (int i = 0; i < ARRAY_SIZE(payloads); i++) {
+		tx_iov[i].iov_base = (void *)payloads[i];
+		tx_iov[i].iov_len = strlen(payloads[i]);
+		tx_msgs[i].msg_hdr.msg_iov = &tx_iov[i];
+		tx_msgs[i].msg_hdr.msg_iovlen = 1;
+		tx_msgs[i].msg_hdr.msg_name = &server_addr;
+		tx_msgs[i].msg_hdr.msg_namelen = sizeof(server_addr);
+	}
+
+	memset(rx_msgs, 0, sizeof(rx_msgs));
+	for (int i = 0; i < ARRAY_SIZE(rx_buf); i++) {
+		rx_iov[i].iov_base = rx_buf[i];
+		rx_iov[i].iov_len = sizeof(rx_buf[i]);
+		rx_msgs[i].msg_hdr.msg_iov = &rx_iov[i];
+		rx_msgs[i].msg_hdr.msg_iovlen = 1;
+	}
+
+	rv = sendmmsg(client_sock, tx_msgs, ARRAY_SIZE(tx_msgs), 0);
+	zassert_equal(rv, ARRAY_SIZE(tx_msgs), "sendmmsg failed (%d)", errno);
+
+	/* One more buffer than datagrams, the call returns on timeout */
+	rv = recvmmsg(server_sock, rx_msgs, ARRAY_SIZE(rx_msgs), 0, &timeout);
+	zassert_equal(rv, ARRAY_SIZE(payloads), "recvmmsg failed (%d)", errno);
+
+	for (int i = 0; i < ARRAY_SIZE(payloads); i++) {
+		zassert_equal(tx_msgs[i].msg_len, strlen(payloads[i]),
+			      "invalid sent length");
+		zassert_equal(rx_msgs[i].msg_len, strlen(payloads[i]),
+			      "invalid received length");
+		zassert_mem_equal(rx_buf[i], payloads[i], strlen(payloads[i]),
+				  "invalid data");
+	}
+
+	rv = recvmmsg(server_sock, rx_msgs, ARRAY_SIZE(rx_msgs),
+		      MSG_DONTWAIT, NULL);
+	zassert_equal(rv, -1, "recvmmsg succeeded");
+	zassert_equal(errno, EAGAIN, "invalid errno (%d)", errno);
+
+	/* Only the first datagram is waited for */
+	rv = sendmmsg(client_sock, tx_msgs, 1, 0);
+	zassert_equal(rv, 1, "sendmmsg failed (%d)", errno);
+
+	rv = recvmmsg(server_sock, rx_msgs, ARRAY_SIZE(rx_msgs),
+		      MSG_WAITFORONE, NULL);
+	zassert_equal(rv, 1, "recvmmsg failed (%d)", errno);
+	zassert_mem_equal(rx_buf[0], payloads[0], strlen(payloads[0]),
+			  "invalid data");
+
+	rv = close(client_sock);
+	zassert_equal(rv, 0, "close failed");
+	rv = close(server_sock);
+	zassert_equal(rv, 0, "close failed");
+}
+
 static void after(void *arg)
 {
 	ARG_UNUSED(arg);
@@ -334,9 +334,9 @@ int verify_sent_and_received_msg(struct msghdr *msg, bool split_msg)
 
 	/* Then the first split if it is enabled */
 	if (split_msg) {
-		split_len = msg->msg_iov[1].iov_len / 2;
+		split_len = payload_iov.iov_len / 2;
 
-		ret = test_recv_buf(msg->msg_iov[1].iov_base,
+		ret = test_recv_buf(payload_iov.iov_base,
 				    split_len,
 				    &ctx, &msg_type, &remaining,
 				    recv_buf, sizeof(recv_buf));
@@ -347,9 +347,9 @@ int verify_sent_and_received_msg(struct msghdr *msg, bool split_msg)
 
 	/* Then the data */
 	while (remaining > 0) {
-		ret = test_recv_buf((uint8_t *)msg->msg_iov[1].iov_base +
+		ret = test_recv_buf((uint8_t *)payload_iov.iov_base +
 								total_read,
-				    msg->msg_iov[1].iov_len - total_read,
+				    payload_iov.iov_len - total_read,
 				    &ctx, &msg_type, &remaining,
 				    recv_buf, sizeof(recv_buf));
 		zassert_true(ret > 0, "Cannot read data (%d)", ret);
@@ -480,6 +480,124 @@ ZTEST(net_websocket, test_recv_in_small_buffer)
 			  "Invalid message, should be '%s' was '%s'", frame1_msg, recv_buf);
 }
 
+ZTEST(net_websocket, test_mask_payload)
+{
+	static const uint32_t mask = 0xe17e8eb9;
+	static const uint8_t key[] = { 0xe1, 0x7e, 0x8e, 0xb9 };
+	uint8_t masked[32];
+
+	/* Unaligned source, all the offsets and lengths around a word */
+	for (size_t offset = 0; offset < 8; offset++) {
+		for (size_t len = 0; len < sizeof(masked); len++) {
+			websocket_mask_payload(masked, (const uint8_t *)lorem_ipsum + 1,
+					       len, mask, offset);
+
+			for (size_t i = 0; i < len; i++) {
+				zassert_equal(masked[i], lorem_ipsum[i + 1] ^ key[(offset + i) % 4],
+					      "Invalid mask at %zd, offset %zd, len %zd",
+					      i, offset, len);
+			}
+		}
+	}
+}
+
+NET_BUF_POOL_FIXED_DEFINE(test_buf_pool, 4, 512, 0, NULL);
+
+ZTEST(net_websocket, test_send_buf_and_recv_lorem_ipsum)
+{
+	static struct websocket_context ctx;
+	struct net_buf *payload = NULL;
+	size_t offset = 0;
+	int fd, ret;
+
+	memset(&ctx, 0, sizeof(ctx));
+
+	ctx.recv_buf.buf = temp_recv_buf;
+	ctx.recv_buf.size = sizeof(temp_recv_buf);
+
+	test_msg_len = sizeof(lorem_ipsum) - 1;
+
+	/* Buffers of odd sizes, so that the mask continues across them */
+	while (offset < test_msg_len) {
+		struct net_buf *frag = net_buf_alloc(&test_buf_pool, K_NO_WAIT);
+		size_t len = MIN(test_msg_len - offset, 401);
+
+		zassert_not_null(frag, "Cannot allocate buffer");
+		net_buf_add_mem(frag, lorem_ipsum + offset, len);
+		offset += len;
+
+		if (payload == NULL) {
+			payload = frag;
+		} else {
+			net_buf_frag_add(payload, frag);
+		}
+	}
+
+	fd = test_fd_alloc(&ctx);
+	ret = websocket_send_msg_buf(fd, payload, WEBSOCKET_OPCODE_DATA_TEXT,
+				     true, true, SYS_FOREVER_MS);
+	zassert_equal(ret, test_msg_len,
+		      "Should have sent %zd bytes but sent %d instead",
+		      test_msg_len, ret);
+
+	z_free_fd(fd);
+	net_buf_unref(payload);
+}
+
+static int frames_received;
+
+static int frame_cb(int ws_sock, uint32_t message_type, uint8_t *data,
+		    size_t len, uint64_t remaining, void *user_data)
+{
+	zassert_equal(remaining, 0, "Frame not whole");
+	zassert_equal(message_type & WEBSOCKET_FLAG_TEXT, WEBSOCKET_FLAG_TEXT,
+		      "Msg is not text");
+	zassert_equal(len, sizeof(frame1_msg) - 1, "Invalid frame length %zd", len);
+	zassert_mem_equal(data, frame1_msg, len, "Invalid frame payload");
+
+	frames_received++;
+
+	return 0;
+}
+
+ZTEST(net_websocket, test_recv_frames)
+{
+	static struct test_data test_data;
+	struct websocket_context ctx;
+	int fd, ret;
+
+	memset(&ctx, 0, sizeof(ctx));
+
+	ctx.recv_buf.buf = temp_recv_buf;
+	ctx.recv_buf.size = sizeof(temp_recv_buf);
+
+	memcpy(feed_buf, &frame2, sizeof(frame2));
+
+	test_data.ctx = &ctx;
+	test_data.input_buf = feed_buf;
+	test_data.input_pos = 0;
+	frames_received = 0;
+
+	fd = test_fd_alloc(&test_data);
+
+	/* The first frame and a part of the second one */
+	test_data.input_len = sizeof(frame1) + FRAME1_HDR_SIZE + 3;
+	ret = websocket_recv_frames(fd, frame_cb, NULL, 0);
+	zassert_equal(ret, sizeof(frame1_msg) - 1, "Invalid length %d", ret);
+	zassert_equal(frames_received, 1, "First frame not received");
+
+	/* The second frame is given once it is whole */
+	test_data.input_len = sizeof(frame2);
+	ret = websocket_recv_frames(fd, frame_cb, NULL, 0);
+	zassert_equal(ret, sizeof(frame1_msg) - 1, "Invalid length %d", ret);
+	zassert_equal(frames_received, 2, "Second frame not received");
+
+	ret = websocket_recv_frames(fd, frame_cb, NULL, 0);
+	zassert_equal(ret, -EAGAIN, "Should have timed out (%d)", ret);
+
+	z_free_fd(fd);
+}
+
 static void *setup(void)
 {
 	k_thread_system_pool_assign(k_current_get());
@@ -927,6 +927,14 @@ ZTEST(net_tcp, test_server_with_options_ipv4)
 	 */
 	test_sem_take(K_MSEC(100), __LINE__);
 
+	/* The peer offered a window scale of 7 and SACK in its SYN */
+#if defined(CONFIG_NET_TCP_WINDOW_SCALE)
+	zassert_equal(accepted_ctx->tcp->send_wscale, 7, "Window scale not used");
+#endif
+#if defined(CONFIG_NET_TCP_SACK)
+	zassert_true(accepted_ctx->tcp->sack_permitted, "SACK not permitted");
+#endif
+
 	/* Trigger the peer to send DATA  */
 	k_work_reschedule(&test_server, K_NO_WAIT);
 
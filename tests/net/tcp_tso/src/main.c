@@ -0,0 +1,388 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_test, CONFIG_NET_L2_ETHERNET_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+#include <zephyr/random/random.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/ztest.h>
+
+#include <zephyr/net/ethernet.h>
+#include <zephyr/net/net_ip.h>
+#include <zephyr/net/net_l2.h>
+#include <zephyr/net/net_pkt.h>
+
+#include "ipv4.h"
+#include "net_private.h"
+
+#define TEST_PORT 4242
+#define TEST_SEQ 0xfffffe00
+#define TEST_MSS 500
+#define TEST_LEN (3 * TEST_MSS + 200)
+
+#define TCP_FLAG_PSH BIT(3)
+#define TCP_FLAG_ACK BIT(4)
+
+#define HDRS_LEN (sizeof(struct net_eth_hdr) + NET_IPV4H_LEN + NET_TCPH_LEN)
+
+#define WAIT_TIME K_MSEC(100)
+
+static struct in_addr in4addr_my = { { { 192, 0, 2, 1 } } };
+static struct in_addr in4addr_dst = { { { 192, 0, 2, 2 } } };
+
+static uint8_t test_data[TEST_LEN];
+static uint8_t verify_buf[TEST_LEN];
+
+struct eth_context {
+	struct net_if *iface;
+	uint8_t mac_addr[6];
+	enum ethernet_hw_caps caps;
+};
+
+static struct eth_context eth_context_sw = {
+	.caps = 0,
+};
+
+static struct eth_context eth_context_hw = {
+	.caps = ETHERNET_HW_TSO | ETHERNET_HW_TX_CHKSUM_OFFLOAD |
+		ETHERNET_HW_RX_CHKSUM_OFFLOAD,
+};
+
+/* What the driver saw of each packet */
+struct tx_record {
+	uint32_t seq;
+	uint16_t ip_len;
+	uint16_t tso_mss;
+	uint16_t chksum;
+	uint8_t flags;
+	size_t payload_len;
+	bool payload_ok;
+};
+
+static struct tx_record records[8];
+static int record_count;
+
+static K_SEM_DEFINE(tx_sem, 0, UINT_MAX);
+
+static void eth_iface_init(struct net_if *iface)
+{
+	const struct device *dev = net_if_get_device(iface);
+	struct eth_context *context = dev->data;
+
+	context->iface = iface;
+
+	net_if_set_link_addr(iface, context->mac_addr,
+			     sizeof(context->mac_addr),
+			     NET_LINK_ETHERNET);
+
+	ethernet_init(iface);
+}
+
+static int eth_tx(const struct device *dev, struct net_pkt *pkt)
+{
+	uint8_t hdr[HDRS_LEN];
+	struct net_ipv4_hdr *ip_hdr;
+	struct net_tcp_hdr *tcp_hdr;
+	struct tx_record *rec;
+	size_t offset;
+
+	ARG_UNUSED(dev);
+
+	if (record_count >= ARRAY_SIZE(records)) {
+		return -ENOBUFS;
+	}
+
+	rec = &records[record_count];
+
+	net_pkt_cursor_init(pkt);
+	if (net_pkt_read(pkt, hdr, sizeof(hdr))) {
+		return -EINVAL;
+	}
+
+	ip_hdr = (struct net_ipv4_hdr *)(hdr + sizeof(struct net_eth_hdr));
+	tcp_hdr = (struct net_tcp_hdr *)(hdr + sizeof(struct net_eth_hdr) +
+					 NET_IPV4H_LEN);
+
+	rec->seq = sys_get_be32(tcp_hdr->seq);
+	rec->ip_len = ntohs(ip_hdr->len);
+	rec->tso_mss = net_pkt_tso_mss(pkt);
+	rec->chksum = tcp_hdr->chksum;
+	rec->flags = tcp_hdr->flags;
+	rec->payload_len = net_pkt_get_len(pkt) - sizeof(hdr);
+
+	offset = rec->seq - TEST_SEQ;
+	rec->payload_ok = offset + rec->payload_len <= sizeof(test_data) &&
+			  net_pkt_read(pkt, verify_buf, rec->payload_len) == 0 &&
+			  memcmp(verify_buf, test_data + offset, rec->payload_len) == 0;
+
+	record_count++;
+	k_sem_give(&tx_sem);
+
+	return 0;
+}
+
+static enum ethernet_hw_caps eth_capabilities(const struct device *dev)
+{
+	struct eth_context *context = dev->data;
+
+	return context->caps;
+}
+
+static const struct ethernet_api api_funcs = {
+	.iface_api.init = eth_iface_init,
+
+	.get_capabilities = eth_capabilities,
+	.send = eth_tx,
+};
+
+static int eth_init(const struct device *dev)
+{
+	struct eth_context *context = dev->data;
+
+	/* 00-00-5E-00-53-xx Documentation RFC 7042 */
+	context->mac_addr[0] = 0x00;
+	context->mac_addr[1] = 0x00;
+	context->mac_addr[2] = 0x5E;
+	context->mac_addr[3] = 0x00;
+	context->mac_addr[4] = 0x53;
+	context->mac_addr[5] = sys_rand32_get();
+
+	return 0;
+}
+
+ETH_NET_DEVICE_INIT(eth_tso_sw_test, "eth_tso_sw_test", eth_init, NULL,
+		    &eth_context_sw, NULL, CONFIG_ETH_INIT_PRIORITY,
+		    &api_funcs, NET_ETH_MTU);
+
+ETH_NET_DEVICE_INIT(eth_tso_hw_test, "eth_tso_hw_test", eth_init, NULL,
+		    &eth_context_hw, NULL, CONFIG_ETH_INIT_PRIORITY,
+		    &api_funcs, NET_ETH_MTU);
+
+static void send_tso_pkt(struct net_if *iface)
+{
+	struct net_tcp_hdr hdr = {
+		.src_port = htons(TEST_PORT),
+		.dst_port = htons(TEST_PORT),
+		.offset = (NET_TCPH_LEN / 4) << 4,
+		.flags = TCP_FLAG_PSH | TCP_FLAG_ACK,
+	};
+	struct net_pkt *pkt;
+
+	sys_put_be32(TEST_SEQ, hdr.seq);
+	sys_put_be16(1024, hdr.wnd);
+
+	pkt = net_pkt_alloc_with_buffer(iface, sizeof(hdr) + sizeof(test_data),
+					AF_INET, IPPROTO_TCP, K_SECONDS(1));
+	zassert_not_null(pkt, "Cannot allocate pkt");
+
+	zassert_ok(net_ipv4_create(pkt, &in4addr_my, &in4addr_dst));
+	zassert_ok(net_pkt_write(pkt, &hdr, sizeof(hdr)));
+	zassert_ok(net_pkt_write(pkt, test_data, sizeof(test_data)));
+
+	net_pkt_cursor_init(pkt);
+	zassert_ok(net_ipv4_finalize(pkt, IPPROTO_TCP));
+
+	net_pkt_set_tso_mss(pkt, TEST_MSS);
+
+	zassert_ok(net_send_data(pkt), "Cannot send pkt");
+}
+
+static void wait_records(int count)
+{
+	for (int i = 0; i < count; i++) {
+		zassert_ok(k_sem_take(&tx_sem, WAIT_TIME), "Missing packet %d", i);
+	}
+
+	zassert_equal(k_sem_take(&tx_sem, WAIT_TIME), -EAGAIN, "Too many packets");
+	zassert_equal(record_count, count, "Invalid packet count");
+}
+
+ZTEST(net_tcp_tso, test_tso_software)
+{
+	size_t offset = 0;
+
+	send_tso_pkt(eth_context_sw.iface);
+	wait_records(DIV_ROUND_UP(TEST_LEN, TEST_MSS));
+
+	for (int i = 0; i < record_count; i++) {
+		struct tx_record *rec = &records[i];
+		bool last = i == record_count - 1;
+
+		zassert_equal(rec->tso_mss, 0, "Segment %d not split", i);
+		zassert_equal(rec->seq, (uint32_t)(TEST_SEQ + offset),
+			      "Segment %d invalid seq", i);
+		zassert_equal(rec->payload_len, last ? TEST_LEN % TEST_MSS : TEST_MSS,
+			      "Segment %d invalid length", i);
+		zassert_equal(rec->ip_len, NET_IPV4H_LEN + NET_TCPH_LEN + rec->payload_len,
+			      "Segment %d invalid IP length", i);
+		zassert_equal(rec->flags, last ? (TCP_FLAG_PSH | TCP_FLAG_ACK) : TCP_FLAG_ACK,
+			      "Segment %d invalid flags", i);
+		zassert_not_equal(rec->chksum, 0, "Segment %d checksum not set", i);
+		zassert_true(rec->payload_ok, "Segment %d invalid payload", i);
+
+		offset += rec->payload_len;
+	}
+}
+
+ZTEST(net_tcp_tso, test_tso_hardware)
+{
+	send_tso_pkt(eth_context_hw.iface);
+	wait_records(1);
+
+	zassert_equal(records[0].tso_mss, TEST_MSS, "Segment size not kept");
+	zassert_equal(records[0].seq, TEST_SEQ, "Invalid seq");
+	zassert_equal(records[0].payload_len, TEST_LEN, "Packet was split");
+	zassert_true(records[0].payload_ok, "Invalid payload");
+}
+
+static void *tcp_tso_setup(void)
+{
+	for (int i = 0; i < sizeof(test_data); i++) {
+		test_data[i] = i;
+	}
+
+	zassert_not_null(eth_context_sw.iface, "No software TSO interface");
+	zassert_not_null(eth_context_hw.iface, "No hardware TSO interface");
+
+	zassert_not_null(net_if_ipv4_addr_add(eth_context_hw.iface, &in4addr_my,
+					      NET_ADDR_MANUAL, 0),
+			 "Cannot add IPv4 address");
+
+	net_if_up(eth_context_sw.iface);
+	net_if_up(eth_context_hw.iface);
+
+	return NULL;
+}
+
+static void tcp_tso_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	record_count = 0;
+	k_sem_reset(&tx_sem);
+}
+
+ZTEST_SUITE(net_tcp_tso, NULL, tcp_tso_setup, tcp_tso_before, NULL, NULL);
+
+/* Receive side coalescing, in front of the RX queue of the interface with
+ * hardware checksums.
+ */
+
+static struct k_fifo gro_fifo;
+
+static struct net_pkt *gro_frame(uint32_t seq, size_t len, uint16_t port,
+				 uint8_t flags)
+{
+	struct net_if *iface = eth_context_hw.iface;
+	struct net_eth_hdr eth = {
+		.type = htons(NET_ETH_PTYPE_IP),
+	};
+	struct net_ipv4_hdr ip = {
+		.vhl = 0x45,
+		.len = htons(NET_IPV4H_LEN + NET_TCPH_LEN + len),
+		.ttl = 64,
+		.proto = IPPROTO_TCP,
+	};
+	struct net_tcp_hdr tcp = {
+		.src_port = htons(port),
+		.dst_port = htons(TEST_PORT),
+		.offset = (NET_TCPH_LEN / 4) << 4,
+		.flags = flags,
+	};
+	struct net_pkt *pkt;
+
+	memcpy(eth.dst.addr, eth_context_hw.mac_addr, sizeof(eth.dst.addr));
+	memcpy(ip.src, &in4addr_dst, sizeof(ip.src));
+	memcpy(ip.dst, &in4addr_my, sizeof(ip.dst));
+	sys_put_be16(NET_IPV4_DO_NOT_FRAG_MASK, ip.offset);
+	ip.chksum = htons((uint16_t)~calc_chksum(0, (uint8_t *)&ip, sizeof(ip)));
+	sys_put_be32(seq, tcp.seq);
+	sys_put_be32(1, tcp.ack);
+	sys_put_be16(seq - TEST_SEQ, tcp.wnd);
+
+	pkt = net_pkt_rx_alloc_with_buffer(iface, HDRS_LEN + len, AF_UNSPEC, 0,
+					   K_SECONDS(1));
+	zassert_not_null(pkt, "Cannot allocate pkt");
+
+	zassert_ok(net_pkt_write(pkt, &eth, sizeof(eth)));
+	zassert_ok(net_pkt_write(pkt, &ip, sizeof(ip)));
+	zassert_ok(net_pkt_write(pkt, &tcp, sizeof(tcp)));
+	zassert_ok(net_pkt_write(pkt, test_data + (seq - TEST_SEQ), len));
+
+	return pkt;
+}
+
+ZTEST(net_tcp_gro, test_gro_merge)
+{
+	struct net_ipv4_hdr *ip;
+	struct net_tcp_hdr *tcp;
+	struct net_pkt *pkt;
+	uint8_t hdr[HDRS_LEN];
+
+	pkt = gro_frame(TEST_SEQ, TEST_MSS, TEST_PORT, TCP_FLAG_ACK);
+	k_fifo_put(&gro_fifo, gro_frame(TEST_SEQ + TEST_MSS, TEST_MSS, TEST_PORT,
+					TCP_FLAG_ACK));
+	k_fifo_put(&gro_fifo, gro_frame(TEST_SEQ + 2 * TEST_MSS, 200, TEST_PORT,
+					TCP_FLAG_ACK | TCP_FLAG_PSH));
+	/* Another flow is not merged */
+	k_fifo_put(&gro_fifo, gro_frame(TEST_SEQ + 2 * TEST_MSS + 200, 100,
+					TEST_PORT + 1, TCP_FLAG_ACK));
+
+	pkt = net_tcp_gro(&gro_fifo, pkt);
+	zassert_equal(net_pkt_get_len(pkt), HDRS_LEN + 2 * TEST_MSS + 200,
+		      "Segments not merged");
+
+	net_pkt_cursor_init(pkt);
+	zassert_ok(net_pkt_read(pkt, hdr, sizeof(hdr)));
+	zassert_ok(net_pkt_read(pkt, verify_buf, 2 * TEST_MSS + 200));
+	zassert_mem_equal(verify_buf, test_data, 2 * TEST_MSS + 200, "Invalid payload");
+
+	ip = (struct net_ipv4_hdr *)(hdr + sizeof(struct net_eth_hdr));
+	tcp = (struct net_tcp_hdr *)(hdr + sizeof(struct net_eth_hdr) + NET_IPV4H_LEN);
+
+	zassert_equal(ntohs(ip->len), NET_IPV4H_LEN + NET_TCPH_LEN + 2 * TEST_MSS + 200,
+		      "Invalid IP length");
+	zassert_equal(calc_chksum(0, (uint8_t *)ip, NET_IPV4H_LEN), 0xffff,
+		      "Invalid IP checksum");
+	zassert_equal(sys_get_be32(tcp->seq), TEST_SEQ, "Invalid seq");
+	zassert_equal(tcp->flags, TCP_FLAG_ACK | TCP_FLAG_PSH, "Invalid flags");
+	zassert_equal(sys_get_be16(tcp->wnd), 2 * TEST_MSS, "Window not updated");
+
+	net_pkt_unref(pkt);
+
+	pkt = k_fifo_get(&gro_fifo, K_NO_WAIT);
+	zassert_not_null(pkt, "Other flow merged");
+	net_pkt_unref(pkt);
+	zassert_true(k_fifo_is_empty(&gro_fifo), "Queue not empty");
+}
+
+ZTEST(net_tcp_gro, test_gro_hole)
+{
+	struct net_pkt *pkt, *next;
+
+	pkt = gro_frame(TEST_SEQ, TEST_MSS, TEST_PORT, TCP_FLAG_ACK);
+	next = gro_frame(TEST_SEQ + 2 * TEST_MSS, TEST_MSS, TEST_PORT, TCP_FLAG_ACK);
+	k_fifo_put(&gro_fifo, next);
+
+	zassert_equal_ptr(net_tcp_gro(&gro_fifo, pkt), pkt, "Invalid packet");
+	zassert_equal(net_pkt_get_len(pkt), HDRS_LEN + TEST_MSS,
+		      "Segments with a hole merged");
+	zassert_equal_ptr(k_fifo_get(&gro_fifo, K_NO_WAIT), next, "Next segment taken");
+
+	net_pkt_unref(pkt);
+	net_pkt_unref(next);
+}
+
+static void *tcp_gro_setup(void)
+{
+	k_fifo_init(&gro_fifo);
+
+	return tcp_tso_setup();
+}
+
+ZTEST_SUITE(net_tcp_gro, NULL, tcp_gro_setup, NULL, NULL, NULL);
@@ -923,4 +923,29 @@ ZTEST(test_utils_fn, test_ip_checksum)
 	}
 }
 
+ZTEST(test_utils_fn, test_ip_checksum_copy)
+{
+	static uint8_t copy[CHECKSUM_TEST_LENGTH + 8];
+	uint16_t sum_got;
+	uint16_t sum_exp;
+
+	for (int i = 0; i < CHECKSUM_TEST_LENGTH; i++) {
+		testdata[i] = (uint8_t)(i * 31 + 7);
+	}
+
+	for (int offset = 0; offset < 4; offset++) {
+		for (int length = 1; length <= CHECKSUM_TEST_LENGTH - 8; length += 37) {
+			memset(copy, 0, sizeof(copy));
+
+			sum_exp = calc_chksum_ref(length, testdata + offset, length);
+			sum_got = calc_chksum_copy(length, copy + 3 - offset,
+						   testdata + offset, length);
+
+			zassert_equal(sum_got, sum_exp, "Checksum mismatch while copying\n");
+			zassert_mem_equal(copy + 3 - offset, testdata + offset, length,
+					  "Data mismatch while copying\n");
+		}
+	}
+}
+
 ZTEST_SUITE(test_utils_fn, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/posix/aio.h>
+#include <zephyr/posix/sys/eventfd.h>
+#include <zephyr/posix/unistd.h>
+#include <zephyr/ztest.h>
+
+/* Requests are made on eventfds: writes add their value to the counter,
+ * reads return it and reset it, or block until it's not zero.
+ */
+
+static K_SEM_DEFINE(notify_sem, 0, K_SEM_MAX_LIMIT);
+
+static void notify_fn(union sigval val)
+{
+	zassert_equal(val.sival_ptr, &notify_sem);
+	k_sem_give(&notify_sem);
+}
+
+static void prep(struct aiocb *cb, int fd, eventfd_t *value)
+{
+	*cb = (struct aiocb){
+		.aio_fildes = fd,
+		.aio_buf = value,
+		.aio_nbytes = sizeof(*value),
+		.aio_sigevent.sigev_notify = SIGEV_NONE,
+	};
+}
+
+static void wait_done(struct aiocb *cb)
+{
+	for (int i = 0; (aio_error(cb) == EINPROGRESS) && (i < 1000); i++) {
+		k_msleep(1);
+	}
+
+	zassert_not_equal(aio_error(cb), EINPROGRESS, "request not done");
+}
+
+static int new_eventfd(void)
+{
+	int fd = eventfd(0, 0);
+
+	zassert_true(fd >= 0, "eventfd() failed: %d", errno);
+
+	return fd;
+}
+
+ZTEST(posix_aio, test_aio_write_read)
+{
+	int fd = new_eventfd();
+	eventfd_t wval = 3, rval = 0;
+	struct aiocb wcb, rcb;
+
+	prep(&wcb, fd, &wval);
+	zassert_ok(aio_write(&wcb));
+	wait_done(&wcb);
+	zassert_equal(aio_error(&wcb), 0);
+	zassert_equal(aio_return(&wcb), sizeof(wval));
+
+	prep(&rcb, fd, &rval);
+	zassert_ok(aio_read(&rcb));
+	wait_done(&rcb);
+	zassert_equal(aio_error(&rcb), 0);
+	zassert_equal(aio_return(&rcb), sizeof(rval));
+	zassert_equal(rval, 3);
+
+	zassert_ok(close(fd));
+}
+
+ZTEST(posix_aio, test_aio_suspend)
+{
+	int fd = new_eventfd();
+	struct timespec timeout = { .tv_nsec = 10 * NSEC_PER_MSEC };
+	eventfd_t wval = 5, rval = 0;
+	struct aiocb rcb;
+	const struct aiocb *list[] = { NULL, &rcb };
+
+	/* Blocks until the counter is written to */
+	prep(&rcb, fd, &rval);
+	zassert_ok(aio_read(&rcb));
+
+	zassert_equal(aio_suspend(list, ARRAY_SIZE(list), &timeout), -1);
+	zassert_equal(errno, EAGAIN);
+	zassert_equal(aio_error(&rcb), EINPROGRESS);
+
+	zassert_equal(write(fd, &wval, sizeof(wval)), sizeof(wval));
+
+	zassert_ok(aio_suspend(list, ARRAY_SIZE(list), NULL));
+	zassert_equal(aio_return(&rcb), sizeof(rval));
+	zassert_equal(rval, 5);
+
+	zassert_ok(close(fd));
+}
+
+ZTEST(posix_aio, test_lio_listio)
+{
+	int fd = new_eventfd();
+	eventfd_t wval[] = { 1, 2, 4 };
+	eventfd_t rval = 0;
+	struct aiocb cb[ARRAY_SIZE(wval) + 1];
+	struct aiocb *list[ARRAY_SIZE(cb)];
+	struct sigevent sig = {
+		.sigev_notify = SIGEV_THREAD,
+		.sigev_notify_function = notify_fn,
+		.sigev_value.sival_ptr = &notify_sem,
+	};
+
+	for (int i = 0; i < ARRAY_SIZE(wval); i++) {
+		prep(&cb[i], fd, &wval[i]);
+		cb[i].aio_lio_opcode = LIO_WRITE;
+		list[i] = &cb[i];
+	}
+
+	prep(&cb[ARRAY_SIZE(wval)], fd, &rval);
+	cb[ARRAY_SIZE(wval)].aio_lio_opcode = LIO_NOP;
+	list[ARRAY_SIZE(wval)] = &cb[ARRAY_SIZE(wval)];
+
+	zassert_ok(lio_listio(LIO_WAIT, list, ARRAY_SIZE(list), NULL));
+	for (int i = 0; i < ARRAY_SIZE(wval); i++) {
+		zassert_equal(aio_return(&cb[i]), sizeof(wval[i]));
+	}
+
+	zassert_equal(read(fd, &rval, sizeof(rval)), sizeof(rval));
+	zassert_equal(rval, 7);
+
+	/* Again, notified once all of them are done */
+	k_sem_reset(&notify_sem);
+	zassert_ok(lio_listio(LIO_NOWAIT, list, ARRAY_SIZE(list), &sig));
+	zassert_ok(k_sem_take(&notify_sem, K_SECONDS(1)));
+	for (int i = 0; i < ARRAY_SIZE(wval); i++) {
+		zassert_equal(aio_error(&cb[i]), 0);
+	}
+
+	zassert_equal(read(fd, &rval, sizeof(rval)), sizeof(rval));
+	zassert_equal(rval, 7);
+
+	zassert_ok(close(fd));
+}
+
+ZTEST(posix_aio, test_aio_notify)
+{
+	int fd = new_eventfd();
+	eventfd_t wval = 1;
+	struct aiocb wcb;
+
+	k_sem_reset(&notify_sem);
+
+	prep(&wcb, fd, &wval);
+	wcb.aio_sigevent.sigev_notify = SIGEV_THREAD;
+	wcb.aio_sigevent.sigev_notify_function = notify_fn;
+	wcb.aio_sigevent.sigev_value.sival_ptr = &notify_sem;
+	zassert_ok(aio_write(&wcb));
+
+	zassert_ok(k_sem_take(&notify_sem, K_SECONDS(1)));
+	zassert_equal(aio_return(&wcb), sizeof(wval));
+
+	zassert_ok(close(fd));
+}
+
+ZTEST(posix_aio, test_aio_errors)
+{
+	eventfd_t val = 1;
+	struct aiocb cb;
+	struct aiocb *list[] = { &cb };
+
+	prep(&cb, -1, &val);
+	zassert_ok(aio_write(&cb));
+	wait_done(&cb);
+	zassert_equal(aio_error(&cb), EBADF);
+	zassert_equal(aio_return(&cb), -1);
+
+	prep(&cb, 0, &val);
+	cb.aio_reqprio = 1;
+	zassert_equal(aio_read(&cb), -1);
+	zassert_equal(errno, EINVAL);
+
+	prep(&cb, 0, &val);
+	cb.aio_sigevent.sigev_notify = SIGEV_SIGNAL;
+	zassert_equal(aio_read(&cb), -1);
+	zassert_equal(errno, EINVAL);
+
+	prep(&cb, 0, &val);
+	cb.aio_lio_opcode = LIO_WRITE;
+	zassert_equal(lio_listio(-1, list, 1, NULL), -1);
+	zassert_equal(errno, EINVAL);
+	zassert_equal(lio_listio(LIO_WAIT, list, 0, NULL), -1);
+	zassert_equal(errno, EINVAL);
+}
+
+ZTEST(posix_aio, test_aio_cancel)
+{
+	int fd = new_eventfd();
+	eventfd_t wval = 2, rval = 0;
+	struct aiocb wcb, rcb;
+
+	if (CONFIG_POSIX_AIO_THREADS > 1) {
+		/* The write may start right away */
+		ztest_test_skip();
+	}
+
+	/* The read keeps the only thread busy, the write stays queued */
+	prep(&rcb, fd, &rval);
+	zassert_ok(aio_read(&rcb));
+	k_msleep(10);
+
+	prep(&wcb, fd, &wval);
+	zassert_ok(aio_write(&wcb));
+
+	zassert_equal(aio_cancel(fd, &wcb), AIO_CANCELED);
+	zassert_equal(aio_error(&wcb), ECANCELED);
+	zassert_equal(aio_return(&wcb), -1);
+	zassert_equal(aio_cancel(fd, &wcb), AIO_ALLDONE);
+	zassert_equal(aio_cancel(fd, NULL), AIO_NOTCANCELED);
+
+	zassert_equal(write(fd, &wval, sizeof(wval)), sizeof(wval));
+	wait_done(&rcb);
+	zassert_equal(aio_return(&rcb), sizeof(rval));
+	zassert_equal(rval, 2);
+
+	zassert_ok(close(fd));
+}
+
+ZTEST_SUITE(posix_aio, NULL, NULL, NULL, NULL, NULL);
@@ -276,6 +276,67 @@ ZTEST(mqueue, test_mqueue_notify_errors)
 	zassert_ok(mq_unlink(queue), "Unable to unlink queue");
 }
 
+ZTEST(mqueue, test_mqueue_loan)
+{
+	mqd_t mqd;
+	struct mq_attr attrs = {
+		.mq_msgsize = MESSAGE_SIZE,
+		.mq_maxmsg = MESG_COUNT_PERMQ,
+	};
+	struct mq_attr nonblock = {
+		.mq_flags = O_NONBLOCK,
+	};
+	char *loaned[MESG_COUNT_PERMQ];
+	char *msg, *buf;
+	int32_t mode = 0777;
+	int flags = O_RDWR | O_CREAT;
+
+	mqd = mq_open(queue, flags, mode, &attrs);
+	zassert_not_equal(mqd, (mqd_t)-1, "Unable to open message queue");
+
+	zassert_ok(mq_loan_np(mqd, &buf, NULL), "Unable to loan buffer");
+	strcpy(buf, send_data);
+	zassert_ok(mq_send_loaned_np(mqd, buf, sizeof(send_data), 0),
+		   "Unable to send loaned buffer");
+
+	zassert_equal(mq_timedreceive_loaned_np(mqd, &msg, NULL, NULL), sizeof(send_data));
+	zassert_equal_ptr(msg, buf, "Message was copied");
+	zassert_false(strcmp(msg, send_data), "Error in data reception. exp: %s act: %s",
+		      send_data, msg);
+	zassert_ok(mq_return_np(mqd, msg), "Unable to return buffer");
+
+	/* Regular messages report their actual length */
+	zassert_ok(mq_send(mqd, send_data, 5, 0), "Unable to send message");
+	zassert_equal(mq_timedreceive_loaned_np(mqd, &msg, NULL, NULL), 5);
+	zassert_ok(strncmp(msg, send_data, 5));
+	zassert_ok(mq_return_np(mqd, msg), "Unable to return buffer");
+
+	/* Loaned buffers use up the queue */
+	zassert_ok(mq_setattr(mqd, &nonblock, NULL));
+	for (int i = 0; i < MESG_COUNT_PERMQ; i++) {
+		zassert_ok(mq_loan_np(mqd, &loaned[i], NULL), "Unable to loan buffer");
+	}
+
+	zassert_equal(mq_loan_np(mqd, &buf, NULL), -1);
+	zassert_equal(errno, EAGAIN);
+	zassert_equal(mq_send(mqd, send_data, MESSAGE_SIZE, 0), -1);
+	zassert_equal(errno, EAGAIN);
+	zassert_equal(mq_timedreceive_loaned_np(mqd, &msg, NULL, NULL), -1);
+	zassert_equal(errno, EAGAIN);
+
+	zassert_equal(mq_return_np(mqd, send_data), -1);
+	zassert_equal(errno, EINVAL);
+	zassert_equal(mq_send_loaned_np(mqd, loaned[0], MESSAGE_SIZE + 1, 0), -1);
+	zassert_equal(errno, EMSGSIZE);
+
+	for (int i = 0; i < MESG_COUNT_PERMQ; i++) {
+		zassert_ok(mq_return_np(mqd, loaned[i]), "Unable to return buffer");
+	}
+
+	zassert_ok(mq_close(mqd), "Unable to close message queue descriptor.");
+	zassert_ok(mq_unlink(queue), "Unable to unlink queue");
+}
+
 static void before(void *arg)
 {
 	ARG_UNUSED(arg);
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/debug/profiler.h>
+
+#define SAMPLE_PERIOD_US 2000
+#define BUSY_MS 200
+
+static volatile uint32_t spin;
+
+static void busy_wait_ms(uint32_t ms)
+{
+	int64_t end = k_uptime_get() + ms;
+
+	while (k_uptime_get() < end) {
+		spin++;
+	}
+}
+
+struct dump_result {
+	size_t lines;
+	size_t own;
+	size_t depth;
+};
+
+static void dump_cb(const char *line, void *user_data)
+{
+	struct dump_result *result = user_data;
+	const char *name = k_thread_name_get(k_current_get());
+	size_t len = strlen(line);
+	size_t depth = 0;
+
+	zassert_true(len > 2, "line too short: %s", line);
+	zassert_equal(strcmp(&line[len - 2], " 1"), 0, "no count: %s", line);
+
+	for (const char *c = line; *c != '\0'; c++) {
+		if (*c == ';') {
+			depth++;
+		}
+	}
+
+	if (strncmp(line, name, strlen(name)) == 0) {
+		result->own++;
+		result->depth = MAX(result->depth, depth);
+	}
+
+	result->lines++;
+}
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	profiler_reset();
+}
+
+ZTEST(profiler, test_start_stop)
+{
+	zassert_equal(profiler_start(0), -EINVAL);
+	zassert_equal(profiler_stop(), -EALREADY);
+	zassert_ok(profiler_start(SAMPLE_PERIOD_US));
+	zassert_equal(profiler_start(SAMPLE_PERIOD_US), -EALREADY);
+	zassert_ok(profiler_stop());
+}
+
+ZTEST(profiler, test_samples)
+{
+	struct dump_result result = { 0 };
+	size_t samples;
+	uint32_t dropped;
+
+	zassert_ok(profiler_start(SAMPLE_PERIOD_US));
+	busy_wait_ms(BUSY_MS);
+	zassert_ok(profiler_stop());
+
+	profiler_stats_get(&samples, &dropped);
+	zassert_true(samples > 0, "no samples");
+	zassert_equal(dropped, 0, "%u samples dropped", dropped);
+
+	profiler_dump_folded(dump_cb, &result);
+	zassert_equal(result.lines, samples);
+
+	/* The test thread is busy for the whole sampling time */
+	zassert_true(result.own * 2 > samples, "%zu of %zu samples in the test thread",
+		     result.own, samples);
+
+	if (IS_ENABLED(CONFIG_PROFILER_FRAME_POINTER)) {
+		zassert_true(result.depth > 1, "no callers recorded");
+	} else {
+		zassert_equal(result.depth, 1);
+	}
+
+	/* No samples are taken after stopping */
+	busy_wait_ms(10 * SAMPLE_PERIOD_US / USEC_PER_MSEC);
+	profiler_stats_get(&result.lines, NULL);
+	zassert_equal(result.lines, samples);
+}
+
+ZTEST(profiler, test_dropped)
+{
+	size_t samples;
+	uint32_t dropped;
+
+	zassert_ok(profiler_start(SAMPLE_PERIOD_US));
+	busy_wait_ms((CONFIG_PROFILER_SAMPLES + 10) * SAMPLE_PERIOD_US / USEC_PER_MSEC);
+	zassert_ok(profiler_stop());
+
+	profiler_stats_get(&samples, &dropped);
+	zassert_equal(samples, CONFIG_PROFILER_SAMPLES);
+	zassert_true(dropped > 0, "no samples dropped");
+
+	profiler_reset();
+	profiler_stats_get(&samples, &dropped);
+	zassert_equal(samples, 0);
+	zassert_equal(dropped, 0);
+}
+
+ZTEST_SUITE(profiler, NULL, NULL, before, NULL, NULL);
@@ -9,6 +9,14 @@
 #include <zephyr/storage/flash_map.h>
 #include <zephyr/dfu/flash_img.h>
 
+#ifdef CONFIG_IMG_LZ4
+#include <lz4.h>
+#endif
+
+#ifdef CONFIG_IMG_DECODE
+#include <zephyr/sys/byteorder.h>
+#endif
+
 #define SLOT0_PARTITION		slot0_partition
 #define SLOT1_PARTITION		slot1_partition
 
@@ -165,4 +173,220 @@ ZTEST(img_util, test_check_flash)
 	flash_area_close(ctx.flash_area);
 }
 
+#ifdef CONFIG_IMG_LZ4
+ZTEST(img_util, test_lz4)
+{
+	/* Same image as in test_check_flash */
+	static const uint8_t tst_vec[] = "0123456789abcdef\nfedcba9876543210\n";
+	const uint8_t tst_sha[] = { 0xc6, 0xb6, 0x7c, 0x46, 0xe7, 0x2e, 0x14, 0x17,
+				    0x49, 0xa4, 0xd2, 0xf1, 0x38, 0x58, 0xb2, 0xa7,
+				    0x54, 0xaf, 0x6d, 0x39, 0x50, 0x6b, 0xd5, 0x41,
+				    0x90, 0xf6, 0x18, 0x1a, 0xe0, 0xc2, 0x7f, 0x98 };
+	static struct flash_img_context ctx;
+	struct flash_img_lz4_hdr *hdr;
+	struct flash_img_lz4_hdr peek_hdr;
+	struct flash_img_check fic;
+	uint8_t img[128];
+	uint8_t peek[4];
+	size_t img_len;
+	int len;
+	int ret;
+
+	/* Header, then the image as one LZ4 block */
+	hdr = (struct flash_img_lz4_hdr *)img;
+	hdr->magic = sys_cpu_to_le32(FLASH_IMG_LZ4_MAGIC);
+	hdr->size = sys_cpu_to_le32(sizeof(tst_vec) - 1);
+	memcpy(hdr->sha256, tst_sha, sizeof(tst_sha));
+	len = LZ4_compress_default((const char *)tst_vec,
+				   (char *)&img[sizeof(*hdr) + sizeof(uint32_t)],
+				   sizeof(tst_vec) - 1,
+				   sizeof(img) - sizeof(*hdr) - sizeof(uint32_t));
+	zassert_true(len > 0, "LZ4 compression failed");
+	sys_put_le32(len, &img[sizeof(*hdr)]);
+	img_len = sizeof(*hdr) + sizeof(uint32_t) + len;
+
+	ret = flash_img_lz4_peek(img, img_len, &peek_hdr, peek, sizeof(peek));
+	zassert_equal(ret, sizeof(peek), "LZ4 peek failed");
+	zassert_equal(peek_hdr.size, sizeof(tst_vec) - 1);
+	zassert_mem_equal(peek, tst_vec, sizeof(peek));
+
+	ret = flash_img_init_id(&ctx, SLOT1_PARTITION_ID);
+	zassert_true(ret == 0, "Flash img init");
+	ret = flash_area_erase(ctx.flash_area, 0, ctx.flash_area->fa_size);
+	zassert_true(ret == 0, "Flash erase failure (%d)", ret);
+
+	/* Fed in small pieces, splitting the block headers */
+	for (size_t off = 0; off < img_len; off += 5) {
+		ret = flash_img_lz4_buffered_write(&ctx, &img[off], MIN(5, img_len - off),
+						   (off + 5) >= img_len);
+		zassert_equal(ret, 0, "LZ4 write failed at %u (%d)", off, ret);
+	}
+
+	fic.match = tst_sha;
+	fic.clen = sizeof(tst_vec) - 1;
+	ret = flash_img_check(&ctx, &fic, SLOT1_PARTITION_ID);
+	zassert_equal(ret, 0, "Decompressed image check failed");
+
+	/* A truncated image is rejected */
+	ret = flash_img_init_id(&ctx, SLOT1_PARTITION_ID);
+	zassert_true(ret == 0, "Flash img init");
+	ret = flash_img_lz4_buffered_write(&ctx, img, img_len - 1, true);
+	zassert_equal(ret, -EINVAL, "Truncated image accepted");
+	flash_area_close(ctx.flash_area);
+}
+#endif
+
+#ifdef CONFIG_IMG_DELTA
+#define STORAGE_PARTITION_ID	FIXED_PARTITION_ID(storage_partition)
+
+/* Image of test_check_flash, upper case letters in the source */
+static const uint8_t delta_src[] = "0123456789ABCDEF\nfedcba9876543210\n";
+static const uint8_t delta_vec[] = "0123456789abcdef\nfedcba9876543210\n";
+static const uint8_t delta_sha[] = { 0xc6, 0xb6, 0x7c, 0x46, 0xe7, 0x2e, 0x14, 0x17,
+				     0x49, 0xa4, 0xd2, 0xf1, 0x38, 0x58, 0xb2, 0xa7,
+				     0x54, 0xaf, 0x6d, 0x39, 0x50, 0x6b, 0xd5, 0x41,
+				     0x90, 0xf6, 0x18, 0x1a, 0xe0, 0xc2, 0x7f, 0x98 };
+
+static size_t delta_op_put(uint8_t *buf, uint8_t op, uint32_t len, uint32_t src_off)
+{
+	struct flash_img_delta_op *o = (struct flash_img_delta_op *)buf;
+
+	o->op = op;
+	o->len = sys_cpu_to_le32(len);
+	o->src_off = sys_cpu_to_le32(src_off);
+
+	return sizeof(*o);
+}
+
+/* Builds the delta image, the source is stored in the storage partition */
+static size_t delta_build(uint8_t *img)
+{
+	struct flash_img_delta_hdr *hdr = (struct flash_img_delta_hdr *)img;
+	const struct flash_area *fa;
+	uint8_t src[sizeof(delta_src) + 3] = { 0 };
+	size_t len = sizeof(*hdr);
+	int ret;
+
+	ret = flash_area_open(STORAGE_PARTITION_ID, &fa);
+	zassert_equal(ret, 0, "Flash area open failed");
+	ret = flash_area_erase(fa, 0, fa->fa_size);
+	zassert_equal(ret, 0, "Flash erase failure (%d)", ret);
+	memcpy(src, delta_src, sizeof(delta_src) - 1);
+	ret = flash_area_write(fa, 0, src, ROUND_DOWN(sizeof(src), 4));
+	zassert_equal(ret, 0, "Flash write failure (%d)", ret);
+	flash_area_close(fa);
+
+	memset(hdr, 0, sizeof(*hdr));
+	hdr->magic = sys_cpu_to_le32(FLASH_IMG_DELTA_MAGIC);
+	hdr->src_size = sys_cpu_to_le32(sizeof(delta_src) - 1);
+	hdr->size = sys_cpu_to_le32(sizeof(delta_vec) - 1);
+	memcpy(hdr->sha256, delta_sha, sizeof(delta_sha));
+
+	len += delta_op_put(&img[len], FLASH_IMG_DELTA_COPY, 10, 0);
+	len += delta_op_put(&img[len], FLASH_IMG_DELTA_ADD, 6, 10);
+	memset(&img[len], 'a' - 'A', 6);
+	len += 6;
+	len += delta_op_put(&img[len], FLASH_IMG_DELTA_COPY, 15, 16);
+	len += delta_op_put(&img[len], FLASH_IMG_DELTA_INSERT, 3, 0);
+	memcpy(&img[len], "10\n", 3);
+	len += 3;
+
+	return len;
+}
+
+ZTEST(img_util, test_delta)
+{
+	static struct flash_img_context ctx;
+	struct flash_img_delta_hdr peek_hdr;
+	struct flash_img_check fic;
+	uint8_t img[160];
+	uint8_t peek[4];
+	size_t img_len;
+	int ret;
+
+	img_len = delta_build(img);
+
+	ret = flash_img_delta_peek(img, img_len, STORAGE_PARTITION_ID, &peek_hdr, peek,
+				   sizeof(peek));
+	zassert_equal(ret, 0, "Delta peek failed (%d)", ret);
+	zassert_equal(peek_hdr.size, sizeof(delta_vec) - 1);
+	zassert_mem_equal(peek, delta_vec, sizeof(peek));
+
+	ret = flash_img_init_id(&ctx, SLOT1_PARTITION_ID);
+	zassert_true(ret == 0, "Flash img init");
+	flash_img_delta_source_set(&ctx, STORAGE_PARTITION_ID);
+	ret = flash_area_erase(ctx.flash_area, 0, ctx.flash_area->fa_size);
+	zassert_true(ret == 0, "Flash erase failure (%d)", ret);
+
+	/* Fed in small pieces, splitting the operations */
+	for (size_t off = 0; off < img_len; off += 5) {
+		ret = flash_img_delta_buffered_write(&ctx, &img[off], MIN(5, img_len - off),
+						     (off + 5) >= img_len);
+		zassert_equal(ret, 0, "Delta write failed at %u (%d)", off, ret);
+	}
+
+	fic.match = delta_sha;
+	fic.clen = sizeof(delta_vec) - 1;
+	ret = flash_img_check(&ctx, &fic, SLOT1_PARTITION_ID);
+	zassert_equal(ret, 0, "Delta image check failed");
+
+	/* A truncated image is rejected */
+	ret = flash_img_init_id(&ctx, SLOT1_PARTITION_ID);
+	zassert_true(ret == 0, "Flash img init");
+	flash_img_delta_source_set(&ctx, STORAGE_PARTITION_ID);
+	ret = flash_img_delta_buffered_write(&ctx, img, img_len - 1, true);
+	zassert_equal(ret, -EINVAL, "Truncated image accepted");
+	flash_area_close(ctx.flash_area);
+
+	/* So is a copy going past the end of the source */
+	sys_put_le32(sizeof(delta_src), &img[sizeof(peek_hdr) + offsetof(struct flash_img_delta_op,
+									 len)]);
+	ret = flash_img_init_id(&ctx, SLOT1_PARTITION_ID);
+	zassert_true(ret == 0, "Flash img init");
+	flash_img_delta_source_set(&ctx, STORAGE_PARTITION_ID);
+	ret = flash_img_delta_buffered_write(&ctx, img, img_len, true);
+	zassert_equal(ret, -EINVAL, "Copy out of the source accepted");
+	flash_area_close(ctx.flash_area);
+}
+
+#ifdef CONFIG_IMG_LZ4
+ZTEST(img_util, test_lz4_delta)
+{
+	static struct flash_img_context ctx;
+	struct flash_img_lz4_hdr *hdr;
+	struct flash_img_check fic;
+	uint8_t img[192];
+	size_t delta_len;
+	size_t img_len;
+	int ret;
+
+	/* The delta image stored as one uncompressed block */
+	hdr = (struct flash_img_lz4_hdr *)img;
+	delta_len = delta_build(&img[sizeof(*hdr) + sizeof(uint32_t)]);
+	hdr->magic = sys_cpu_to_le32(FLASH_IMG_LZ4_MAGIC);
+	hdr->size = sys_cpu_to_le32(delta_len);
+	memset(hdr->sha256, 0, sizeof(hdr->sha256));
+	sys_put_le32(delta_len | FLASH_IMG_LZ4_BLOCK_RAW, &img[sizeof(*hdr)]);
+	img_len = sizeof(*hdr) + sizeof(uint32_t) + delta_len;
+
+	ret = flash_img_init_id(&ctx, SLOT1_PARTITION_ID);
+	zassert_true(ret == 0, "Flash img init");
+	flash_img_delta_source_set(&ctx, STORAGE_PARTITION_ID);
+	ret = flash_area_erase(ctx.flash_area, 0, ctx.flash_area->fa_size);
+	zassert_true(ret == 0, "Flash erase failure (%d)", ret);
+
+	for (size_t off = 0; off < img_len; off += 7) {
+		ret = flash_img_lz4_delta_buffered_write(&ctx, &img[off], MIN(7, img_len - off),
+							 (off + 7) >= img_len);
+		zassert_equal(ret, 0, "LZ4 delta write failed at %u (%d)", off, ret);
+	}
+
+	fic.match = delta_sha;
+	fic.clen = sizeof(delta_vec) - 1;
+	ret = flash_img_check(&ctx, &fic, SLOT1_PARTITION_ID);
+	zassert_equal(ret, 0, "Delta image check failed");
+}
+#endif
+#endif
+
 ZTEST_SUITE(img_util, NULL, NULL, NULL, NULL, NULL);
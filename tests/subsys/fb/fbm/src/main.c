@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/device.h>
+#include <zephyr/display/fbm.h>
+#include <zephyr/ztest.h>
+
+#define PANEL_W 32
+#define PANEL_H 16
+#define BPP 2
+#define FB_SIZE (PANEL_W * PANEL_H * BPP)
+#define MAX_WRITES 16
+
+struct fake_write {
+	struct display_fbm_rect rect;
+	const void *buf;
+};
+
+static uint8_t panel[FB_SIZE];
+static struct fake_write writes[MAX_WRITES];
+static int num_writes;
+
+static uint8_t fb0[FB_SIZE];
+static uint8_t fb1[FB_SIZE];
+static uint8_t *const fbs[] = { fb0, fb1 };
+static struct display_fbm fbm;
+
+static int fake_write(const struct device *dev, const uint16_t x,
+		      const uint16_t y,
+		      const struct display_buffer_descriptor *desc,
+		      const void *buf)
+{
+	const uint8_t *src = buf;
+
+	zassert_true(num_writes < MAX_WRITES);
+	writes[num_writes].rect = (struct display_fbm_rect){ x, y, desc->width, desc->height };
+	writes[num_writes].buf = buf;
+	num_writes++;
+
+	for (uint16_t row = 0; row < desc->height; row++) {
+		memcpy(&panel[((y + row) * PANEL_W + x) * BPP], src, desc->width * BPP);
+		src += desc->pitch * BPP;
+	}
+
+	return 0;
+}
+
+static void fake_get_capabilities(const struct device *dev,
+				  struct display_capabilities *caps)
+{
+	memset(caps, 0, sizeof(*caps));
+	caps->x_resolution = PANEL_W;
+	caps->y_resolution = PANEL_H;
+	caps->supported_pixel_formats = PIXEL_FORMAT_RGB_565;
+	caps->current_pixel_format = PIXEL_FORMAT_RGB_565;
+}
+
+static const struct display_driver_api fake_api = {
+	.write = fake_write,
+	.get_capabilities = fake_get_capabilities,
+};
+
+DEVICE_DEFINE(fake_display, "fake_display", NULL, NULL, NULL, NULL,
+	      POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEVICE, &fake_api);
+
+static void draw(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t val)
+{
+	static uint8_t pixels[FB_SIZE];
+	struct display_buffer_descriptor desc = {
+		.width = w,
+		.height = h,
+		.pitch = w,
+		.buf_size = w * h * BPP,
+	};
+
+	memset(pixels, val, desc.buf_size);
+	zassert_ok(display_fbm_write(&fbm, x, y, &desc, pixels));
+}
+
+static void assert_rect(int idx, uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+	const struct display_fbm_rect *r = &writes[idx].rect;
+
+	zassert_true(r->x == x && r->y == y && r->width == w && r->height == h,
+		     "write %d is %ux%u at %u,%u", idx, r->width, r->height, r->x, r->y);
+}
+
+static void init_fbm(uint8_t num_bufs, uint32_t flags)
+{
+	const struct device *dev = DEVICE_GET(fake_display);
+
+	zassert_ok(display_fbm_init(&fbm, dev, fbs, num_bufs, FB_SIZE, flags));
+}
+
+static void flush(void)
+{
+	zassert_ok(display_fbm_flush(&fbm));
+	zassert_ok(display_fbm_sync(&fbm, K_FOREVER));
+}
+
+ZTEST(display_fbm, test_merge_overlapping)
+{
+	init_fbm(1, 0);
+
+	display_fbm_invalidate(&fbm, &(struct display_fbm_rect){ 2, 2, 4, 4 });
+	display_fbm_invalidate(&fbm, &(struct display_fbm_rect){ 5, 5, 4, 4 });
+	flush();
+
+	zassert_equal(num_writes, 1);
+	assert_rect(0, 2, 2, 7, 7);
+}
+
+ZTEST(display_fbm, test_disjoint)
+{
+	init_fbm(1, 0);
+
+	draw(0, 0, 2, 2, 0x11);
+	draw(20, 10, 2, 2, 0x22);
+	flush();
+
+	zassert_equal(num_writes, 2);
+	zassert_mem_equal(panel, fb0, FB_SIZE);
+
+	/* Nothing changed since */
+	flush();
+	zassert_equal(num_writes, 2);
+}
+
+ZTEST(display_fbm, test_widen_and_clip)
+{
+	init_fbm(1, 0);
+
+	display_fbm_invalidate(&fbm, &(struct display_fbm_rect){ 1, 0, 30, 2 });
+	display_fbm_invalidate(&fbm, &(struct display_fbm_rect){ 30, 14, 8, 8 });
+	display_fbm_invalidate(&fbm, &(struct display_fbm_rect){ PANEL_W, 0, 1, 1 });
+	flush();
+
+	zassert_equal(num_writes, 2);
+	assert_rect(0, 0, 0, PANEL_W, 2);
+	assert_rect(1, 30, 14, 2, 2);
+}
+
+ZTEST(display_fbm, test_overflow)
+{
+	init_fbm(1, 0);
+
+	for (int i = 0; i <= CONFIG_DISPLAY_FBM_MAX_RECTS; i++) {
+		draw((i * 3) % PANEL_W, (i * 3) / PANEL_W * 2, 1, 1, i + 1);
+	}
+
+	flush();
+
+	zassert_true(num_writes <= CONFIG_DISPLAY_FBM_MAX_RECTS);
+	zassert_mem_equal(panel, fb0, FB_SIZE);
+}
+
+ZTEST(display_fbm, test_double_buffer)
+{
+	uint8_t *buf;
+
+	init_fbm(2, 0);
+
+	zassert_equal(display_fbm_get_buffer(&fbm), fb0);
+	draw(4, 4, 8, 4, 0x33);
+	flush();
+
+	/* Drawing goes on in the other buffer, holding the flushed frame */
+	buf = display_fbm_get_buffer(&fbm);
+	zassert_equal(buf, fb1);
+	zassert_mem_equal(buf, fb0, FB_SIZE);
+	zassert_equal(writes[0].buf, &fb0[(4 * PANEL_W + 4) * BPP]);
+
+	draw(0, 12, 2, 2, 0x44);
+	flush();
+
+	zassert_equal(num_writes, 2);
+	assert_rect(1, 0, 12, 2, 2);
+	zassert_mem_equal(panel, fb1, FB_SIZE);
+	zassert_mem_equal(fb0, fb1, FB_SIZE);
+}
+
+ZTEST(display_fbm, test_full_frame)
+{
+	init_fbm(2, DISPLAY_FBM_FULL_FRAME);
+
+	draw(1, 1, 2, 2, 0x55);
+	flush();
+
+	zassert_equal(num_writes, 1);
+	assert_rect(0, 0, 0, PANEL_W, PANEL_H);
+	zassert_equal(writes[0].buf, fb0);
+
+	draw(8, 8, 2, 2, 0x66);
+	flush();
+
+	zassert_equal(num_writes, 2);
+	zassert_equal(writes[1].buf, fb1);
+	zassert_mem_equal(panel, fb1, FB_SIZE);
+	zassert_mem_equal(fb0, fb1, FB_SIZE);
+}
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	memset(panel, 0, sizeof(panel));
+	memset(fb0, 0, sizeof(fb0));
+	memset(fb1, 0, sizeof(fb1));
+	memset(writes, 0, sizeof(writes));
+	num_writes = 0;
+}
+
+ZTEST_SUITE(display_fbm, NULL, NULL, before, NULL, NULL);
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "fcb_test.h"
+
+#define TEST_ENTRIES 300
+
+#ifdef CONFIG_FCB_INDEX
+static struct fcb_sector_index test_fcb_index[4];
+#endif
+
+static void check_getnth(struct fcb *fcb, int cnt)
+{
+	struct fcb_entry walk = {0};
+	struct fcb_entry loc;
+	int rc;
+
+	for (int n = 0; n < cnt; n++) {
+		rc = fcb_getnext(fcb, &walk);
+		zassert_true(rc == 0, "fcb_getnext call failure");
+
+		rc = fcb_getnth(fcb, n, &loc);
+		zassert_true(rc == 0, "fcb_getnth call failure");
+		zassert_true(loc.fe_sector == walk.fe_sector &&
+			     loc.fe_elem_off == walk.fe_elem_off &&
+			     loc.fe_data_off == walk.fe_data_off &&
+			     loc.fe_data_len == walk.fe_data_len,
+			     "fcb_getnth: fetched wrong location of entry %d", n);
+	}
+
+	rc = fcb_getnth(fcb, cnt, &loc);
+	zassert_true(rc == -ENOENT, "fcb_getnth: entry past the end found");
+
+	rc = fcb_offset_last_n(fcb, 5, &loc);
+	zassert_true(rc == 0, "fcb_offset_last_n call failure");
+	rc = fcb_getnth(fcb, cnt - 5, &walk);
+	zassert_true(rc == 0, "fcb_getnth call failure");
+	zassert_true(loc.fe_sector == walk.fe_sector &&
+		     loc.fe_elem_off == walk.fe_elem_off,
+		     "fcb_offset_last_n: fetched wrong location");
+}
+
+ZTEST(fcb_test_with_4sectors_set, test_fcb_getnth)
+{
+	struct fcb *fcb;
+	struct fcb_entry loc;
+	uint8_t test_data[128];
+	int rc;
+
+	fcb = &test_fcb;
+
+#ifdef CONFIG_FCB_INDEX
+	fcb->f_index = test_fcb_index;
+	rc = fcb_init(TEST_FCB_FLASH_AREA_ID, fcb);
+	zassert_true(rc == 0, "fcb_init call failure");
+#endif
+
+	rc = fcb_getnth(fcb, 0, &loc);
+	zassert_true(rc == -ENOENT, "fcb_getnth: entry found in empty fcb");
+
+	for (int i = 0; i < TEST_ENTRIES; i++) {
+		uint16_t len = 1 + (i % sizeof(test_data));
+
+		for (int j = 0; j < len; j++) {
+			test_data[j] = fcb_test_append_data(len, j);
+		}
+
+		rc = fcb_append(fcb, len, &loc);
+		zassert_true(rc == 0, "fcb_append call failure");
+
+		rc = flash_area_write(fcb->fap, FCB_ENTRY_FA_DATA_OFF(loc),
+				      test_data, len);
+		zassert_true(rc == 0, "flash_area_write call failure");
+
+		rc = fcb_append_finish(fcb, &loc);
+		zassert_true(rc == 0, "fcb_append_finish call failure");
+	}
+
+	check_getnth(fcb, TEST_ENTRIES);
+
+	/* The same after the rebuild of the index */
+	rc = fcb_init(TEST_FCB_FLASH_AREA_ID, fcb);
+	zassert_true(rc == 0, "fcb_init call failure");
+
+	check_getnth(fcb, TEST_ENTRIES);
+
+#ifdef CONFIG_FCB_INDEX
+	fcb->f_index = NULL;
+#endif
+}
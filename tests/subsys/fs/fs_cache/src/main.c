@@ -0,0 +1,340 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/fs/fs.h>
+#include <zephyr/fs/fs_sys.h>
+#include <zephyr/fs/fs_cache.h>
+
+#define TEST_FS_TYPE	FS_TYPE_EXTERNAL_BASE
+#define TEST_MNTP	"/RAM:"
+#define TEST_FILE	TEST_MNTP "/file"
+
+#define FILE_SIZE	4096
+#define PAGE_SIZE	256
+#define PAGE_COUNT	4
+
+/* A file system holding a single file in RAM, counting the accesses */
+static uint8_t ram_file[FILE_SIZE];
+static size_t ram_len;
+static uint32_t ram_reads;
+static uint32_t ram_writes;
+
+struct ram_handle {
+	size_t pos;
+	bool used;
+};
+
+static struct ram_handle ram_handles[2];
+
+static int ram_open(struct fs_file_t *zfp, const char *file_name, fs_mode_t flags)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(ram_handles); i++) {
+		if (!ram_handles[i].used) {
+			ram_handles[i].used = true;
+			ram_handles[i].pos = 0;
+			zfp->filep = &ram_handles[i];
+			return 0;
+		}
+	}
+
+	return -ENFILE;
+}
+
+static int ram_close(struct fs_file_t *zfp)
+{
+	struct ram_handle *h = zfp->filep;
+
+	h->used = false;
+
+	return 0;
+}
+
+static ssize_t ram_read(struct fs_file_t *zfp, void *ptr, size_t size)
+{
+	struct ram_handle *h = zfp->filep;
+	size_t len = (h->pos < ram_len) ? MIN(size, ram_len - h->pos) : 0;
+
+	memcpy(ptr, &ram_file[h->pos], len);
+	h->pos += len;
+	ram_reads++;
+
+	return len;
+}
+
+static ssize_t ram_write(struct fs_file_t *zfp, const void *ptr, size_t size)
+{
+	struct ram_handle *h = zfp->filep;
+	size_t len = MIN(size, FILE_SIZE - h->pos);
+
+	if (len > 0) {
+		memcpy(&ram_file[h->pos], ptr, len);
+		h->pos += len;
+		ram_len = MAX(ram_len, h->pos);
+	}
+	ram_writes++;
+
+	return len;
+}
+
+static int ram_lseek(struct fs_file_t *zfp, off_t offset, int whence)
+{
+	struct ram_handle *h = zfp->filep;
+	off_t pos;
+
+	switch (whence) {
+	case FS_SEEK_SET:
+		pos = offset;
+		break;
+	case FS_SEEK_CUR:
+		pos = h->pos + offset;
+		break;
+	case FS_SEEK_END:
+		pos = ram_len + offset;
+		break;
+	default:
+		return -EINVAL;
+	}
+
+	if ((pos < 0) || (pos > FILE_SIZE)) {
+		return -EINVAL;
+	}
+
+	h->pos = pos;
+
+	return 0;
+}
+
+static off_t ram_tell(struct fs_file_t *zfp)
+{
+	struct ram_handle *h = zfp->filep;
+
+	return h->pos;
+}
+
+static int ram_truncate(struct fs_file_t *zfp, off_t length)
+{
+	if (length > FILE_SIZE) {
+		return -EINVAL;
+	}
+
+	if (length > ram_len) {
+		memset(&ram_file[ram_len], 0, length - ram_len);
+	}
+	ram_len = length;
+
+	return 0;
+}
+
+static int ram_sync(struct fs_file_t *zfp)
+{
+	return 0;
+}
+
+static int ram_mount(struct fs_mount_t *mountp)
+{
+	return 0;
+}
+
+static int ram_unmount(struct fs_mount_t *mountp)
+{
+	return 0;
+}
+
+static const struct fs_file_system_t ram_fs = {
+	.open = ram_open,
+	.close = ram_close,
+	.read = ram_read,
+	.write = ram_write,
+	.lseek = ram_lseek,
+	.tell = ram_tell,
+	.truncate = ram_truncate,
+	.sync = ram_sync,
+	.mount = ram_mount,
+	.unmount = ram_unmount,
+};
+
+static struct fs_mount_t ram_mnt = {
+	.type = TEST_FS_TYPE,
+	.mnt_point = TEST_MNTP,
+};
+
+FS_CACHE_DEFINE(ram_cache, PAGE_SIZE, PAGE_COUNT);
+
+static void ram_fill(size_t len)
+{
+	for (size_t i = 0; i < len; i++) {
+		ram_file[i] = i;
+	}
+	ram_len = len;
+}
+
+static void open_file(struct fs_file_t *zfp)
+{
+	fs_file_t_init(zfp);
+	zassert_ok(fs_open(zfp, TEST_FILE, FS_O_RDWR | FS_O_CREATE), "open failed");
+}
+
+ZTEST(fs_cache, test_sequential_read)
+{
+	struct fs_cache_stats stats;
+	struct fs_file_t file;
+	uint8_t buf[16];
+
+	ram_fill(FILE_SIZE);
+	open_file(&file);
+
+	for (size_t off = 0; off < FILE_SIZE; off += sizeof(buf)) {
+		zassert_equal(fs_read(&file, buf, sizeof(buf)), sizeof(buf));
+		for (size_t i = 0; i < sizeof(buf); i++) {
+			zassert_equal(buf[i], (uint8_t)(off + i), "wrong data at %u", off + i);
+		}
+	}
+	zassert_equal(fs_read(&file, buf, sizeof(buf)), 0, "read past the end");
+	zassert_ok(fs_close(&file));
+
+	/* One access per page, and one at the end of the file */
+	zassert_true(ram_reads <= (FILE_SIZE / PAGE_SIZE) + 1, "%u reads", ram_reads);
+
+	zassert_ok(fs_cache_stats_get(TEST_MNTP, &stats, false));
+	zassert_true(stats.read_ahead > 0, "no read-ahead");
+	zassert_true(stats.hits > stats.misses, "hits %u misses %u", stats.hits, stats.misses);
+}
+
+ZTEST(fs_cache, test_large_read)
+{
+	static uint8_t buf[4 * PAGE_SIZE];
+	struct fs_cache_stats stats;
+	struct fs_file_t file;
+
+	ram_fill(FILE_SIZE);
+	open_file(&file);
+
+	zassert_equal(fs_read(&file, buf, sizeof(buf)), sizeof(buf));
+	zassert_mem_equal(buf, ram_file, sizeof(buf));
+	zassert_equal(fs_tell(&file), sizeof(buf));
+	zassert_ok(fs_close(&file));
+
+	zassert_equal(ram_reads, 1, "%u reads", ram_reads);
+	zassert_ok(fs_cache_stats_get(TEST_MNTP, &stats, false));
+	zassert_equal(stats.bypass, 1);
+}
+
+ZTEST(fs_cache, test_small_writes)
+{
+	struct fs_file_t file;
+	uint8_t buf[16];
+	size_t len = PAGE_COUNT * PAGE_SIZE;
+
+	open_file(&file);
+
+	for (size_t off = 0; off < len; off += sizeof(buf)) {
+		for (size_t i = 0; i < sizeof(buf); i++) {
+			buf[i] = off + i;
+		}
+		zassert_equal(fs_write(&file, buf, sizeof(buf)), sizeof(buf));
+	}
+
+	if (IS_ENABLED(CONFIG_FILE_SYSTEM_CACHE_WRITE_BACK)) {
+		zassert_equal(ram_writes, 0, "%u writes before sync", ram_writes);
+	}
+
+	zassert_ok(fs_sync(&file));
+	zassert_equal(ram_len, len);
+	for (size_t i = 0; i < len; i++) {
+		zassert_equal(ram_file[i], (uint8_t)i, "wrong data at %u", i);
+	}
+
+	if (IS_ENABLED(CONFIG_FILE_SYSTEM_CACHE_WRITE_BACK)) {
+		/* One access per page */
+		zassert_equal(ram_writes, PAGE_COUNT, "%u writes", ram_writes);
+	} else {
+		zassert_equal(ram_writes, len / sizeof(buf), "%u writes", ram_writes);
+	}
+
+	zassert_ok(fs_close(&file));
+}
+
+ZTEST(fs_cache, test_read_after_write)
+{
+	struct fs_file_t file;
+	uint8_t wbuf[100];
+	uint8_t rbuf[20];
+
+	for (size_t i = 0; i < sizeof(wbuf); i++) {
+		wbuf[i] = 0xff - i;
+	}
+
+	open_file(&file);
+
+	zassert_equal(fs_write(&file, wbuf, sizeof(wbuf)), sizeof(wbuf));
+	zassert_ok(fs_seek(&file, 10, FS_SEEK_SET));
+	zassert_equal(fs_read(&file, rbuf, sizeof(rbuf)), sizeof(rbuf));
+	zassert_mem_equal(rbuf, &wbuf[10], sizeof(rbuf));
+	zassert_equal(fs_tell(&file), 10 + sizeof(rbuf));
+
+	zassert_ok(fs_seek(&file, -(off_t)sizeof(rbuf), FS_SEEK_END));
+	zassert_equal(fs_read(&file, rbuf, sizeof(rbuf)), sizeof(rbuf));
+	zassert_mem_equal(rbuf, &wbuf[sizeof(wbuf) - sizeof(rbuf)], sizeof(rbuf));
+	zassert_equal(fs_read(&file, rbuf, sizeof(rbuf)), 0, "read past the end");
+
+	zassert_ok(fs_truncate(&file, 50));
+	zassert_ok(fs_seek(&file, 40, FS_SEEK_SET));
+	zassert_equal(fs_read(&file, rbuf, sizeof(rbuf)), 10);
+	zassert_mem_equal(rbuf, &wbuf[40], 10);
+
+	zassert_ok(fs_close(&file));
+}
+
+ZTEST(fs_cache, test_two_handles)
+{
+	struct fs_file_t file1;
+	struct fs_file_t file2;
+	char buf[4];
+
+	open_file(&file1);
+	open_file(&file2);
+
+	zassert_equal(fs_write(&file1, "abc", 3), 3);
+	zassert_equal(fs_read(&file2, buf, 3), 3);
+	zassert_mem_equal(buf, "abc", 3);
+
+	zassert_ok(fs_seek(&file2, 0, FS_SEEK_SET));
+	zassert_equal(fs_write(&file2, "xyz", 3), 3);
+	zassert_ok(fs_seek(&file1, 0, FS_SEEK_SET));
+	zassert_equal(fs_read(&file1, buf, 3), 3);
+	zassert_mem_equal(buf, "xyz", 3);
+
+	zassert_ok(fs_close(&file1));
+	zassert_ok(fs_close(&file2));
+	zassert_mem_equal(ram_file, "xyz", 3);
+}
+
+static void *fs_cache_setup(void)
+{
+	zassert_ok(fs_register(TEST_FS_TYPE, &ram_fs));
+	zassert_ok(fs_mount(&ram_mnt));
+	zassert_ok(fs_cache_set(TEST_MNTP, &ram_cache));
+
+	return NULL;
+}
+
+static void fs_cache_before(void *fixture)
+{
+	struct fs_cache_stats stats;
+
+	memset(ram_file, 0, sizeof(ram_file));
+	ram_len = 0;
+	ram_reads = 0;
+	ram_writes = 0;
+
+	zassert_ok(fs_cache_stats_get(TEST_MNTP, &stats, true));
+}
+
+ZTEST_SUITE(fs_cache, NULL, fs_cache_setup, fs_cache_before, NULL, NULL);
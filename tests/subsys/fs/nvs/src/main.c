@@ -933,3 +933,123 @@ ZTEST_F(nvs, test_nvs_cache_hash_quality)
 
 #endif
 }
+
+#ifdef CONFIG_NVS_LOOKUP_INDEX
+static uint32_t lookup_index_addr(struct nvs_fs *fs, uint16_t id)
+{
+	for (size_t i = 0; i < CONFIG_NVS_LOOKUP_CACHE_SIZE; i++) {
+		if (fs->lookup_index_id[i] == id) {
+			return fs->lookup_cache[i];
+		}
+	}
+
+	return NVS_LOOKUP_CACHE_NO_ADDR;
+}
+#endif
+
+/*
+ * Test that the NVS lookup index holds the address of the most recent ATE of
+ * each ID, after writes and after nvs_mount().
+ */
+ZTEST_F(nvs, test_nvs_cache_index)
+{
+#ifdef CONFIG_NVS_LOOKUP_INDEX
+	const uint16_t num_ids = CONFIG_NVS_LOOKUP_CACHE_SIZE / 4;
+	uint32_t ate_addr[CONFIG_NVS_LOOKUP_CACHE_SIZE / 4];
+	int err;
+	uint16_t id;
+	uint16_t data;
+
+	fixture->fs.sector_count = 3;
+	err = nvs_mount(&fixture->fs);
+	zassert_true(err == 0, "nvs_mount call failure: %d", err);
+
+	for (int pass = 0; pass < 2; pass++) {
+		for (id = 0; id < num_ids; id++) {
+			data = id + pass;
+			ate_addr[id] = fixture->fs.ate_wra;
+			err = nvs_write(&fixture->fs, id, &data, sizeof(data));
+			zassert_equal(err, sizeof(data), "nvs_write call failure: %d", err);
+		}
+	}
+
+	for (id = 0; id < num_ids; id++) {
+		zassert_equal(lookup_index_addr(&fixture->fs, id), ate_addr[id],
+			      "invalid index entry after write");
+	}
+	zassert_false(fixture->fs.lookup_index_full, "index full");
+
+	err = nvs_mount(&fixture->fs);
+	zassert_true(err == 0, "nvs_mount call failure: %d", err);
+
+	for (id = 0; id < num_ids; id++) {
+		zassert_equal(lookup_index_addr(&fixture->fs, id), ate_addr[id],
+			      "invalid index entry after restart");
+	}
+	zassert_equal(lookup_index_addr(&fixture->fs, num_ids), NVS_LOOKUP_CACHE_NO_ADDR,
+		      "unexpected index entry");
+#endif
+}
+
+/*
+ * Test that the background gc erases the oldest sector ahead of need and keeps
+ * its data.
+ */
+ZTEST_F(nvs, test_nvs_background_gc)
+{
+#ifdef CONFIG_NVS_BACKGROUND_GC
+	const uint16_t num_ids = 4;
+	const uint16_t once_id = 10;
+	uint8_t close_ate[sizeof(struct nvs_ate)];
+	uint16_t data[4];
+	uint16_t value = 0;
+	uint16_t rd;
+	int err;
+
+	fixture->fs.sector_count = 4;
+	err = nvs_mount(&fixture->fs);
+	zassert_true(err == 0, "nvs_mount call failure: %d", err);
+
+	/* The only entry of once_id stays in sector 0 */
+	err = nvs_write(&fixture->fs, once_id, &value, sizeof(value));
+	zassert_equal(err, sizeof(value), "nvs_write call failure: %d", err);
+
+	while ((fixture->fs.ate_wra >> ADDR_SECT_SHIFT) != 2) {
+		++value;
+		data[value % num_ids] = value;
+		err = nvs_write(&fixture->fs, value % num_ids, &value, sizeof(value));
+		zassert_equal(err, sizeof(value), "nvs_write call failure: %d", err);
+	}
+
+	for (int i = 0; (err = nvs_gc_step(&fixture->fs)) > 0; i++) {
+		zassert_true(i < 1000, "background gc does not complete");
+	}
+	zassert_equal(err, 0, "nvs_gc_step call failure: %d", err);
+
+	/* Sector 0 has been collected, the write sector is unchanged */
+	err = flash_read(fixture->fs.flash_device, fixture->fs.offset +
+			 fixture->fs.sector_size - sizeof(close_ate),
+			 close_ate, sizeof(close_ate));
+	zassert_true(err == 0, "flash_read failed: %d", err);
+	for (size_t i = 0; i < sizeof(close_ate); i++) {
+		zassert_equal(close_ate[i], fixture->fs.flash_parameters->erase_value,
+			      "sector 0 not erased");
+	}
+	zassert_equal(fixture->fs.ate_wra >> ADDR_SECT_SHIFT, 2, "write sector changed");
+
+	for (int pass = 0; pass < 2; pass++) {
+		err = nvs_read(&fixture->fs, once_id, &rd, sizeof(rd));
+		zassert_equal(err, sizeof(rd), "nvs_read call failure: %d", err);
+		zassert_equal(rd, 0, "incorrect data read");
+
+		for (uint16_t id = 0; id < num_ids; id++) {
+			err = nvs_read(&fixture->fs, id, &rd, sizeof(rd));
+			zassert_equal(err, sizeof(rd), "nvs_read call failure: %d", err);
+			zassert_equal(rd, data[id], "incorrect data read");
+		}
+
+		err = nvs_mount(&fixture->fs);
+		zassert_true(err == 0, "nvs_mount call failure: %d", err);
+	}
+#endif
+}
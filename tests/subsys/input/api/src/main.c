@@ -185,6 +185,51 @@ ZTEST(input_api, test_report_apis)
 	zassert_equal(last_event.sync, 1);
 }
 
+#ifdef CONFIG_INPUT_FRAMES
+
+static struct input_frame last_frame;
+static int frame_count;
+
+static void input_cb_frame(const struct input_frame *frame)
+{
+	memcpy(&last_frame, frame, sizeof(last_frame));
+	frame_count++;
+}
+INPUT_FRAME_CALLBACK_DEFINE(&fake_dev, input_cb_frame);
+
+ZTEST(input_api, test_frames)
+{
+	/* complete any frame left by the other tests */
+	input_report_key(&fake_dev, INPUT_KEY_A, 0, true, K_FOREVER);
+	frame_count = 0;
+
+	input_report_abs(&fake_dev, INPUT_ABS_X, 10, false, K_FOREVER);
+	input_report_abs(&fake_dev, INPUT_ABS_Y, 20, false, K_FOREVER);
+	input_report_rel(&fake_dev, INPUT_REL_WHEEL, 1, false, K_FOREVER);
+	input_report_abs(&fake_dev, INPUT_ABS_X, 11, false, K_FOREVER);
+	input_report_rel(&fake_dev, INPUT_REL_WHEEL, 2, false, K_FOREVER);
+	zassert_equal(frame_count, 0);
+
+	input_report_key(&fake_dev, INPUT_BTN_TOUCH, 1, true, K_FOREVER);
+	zassert_equal(frame_count, 1);
+	zassert_equal(last_frame.dev, &fake_dev);
+	zassert_equal(last_frame.num_events, 4);
+	zassert_equal(last_frame.events[0].code, INPUT_ABS_X);
+	zassert_equal(last_frame.events[0].value, 11);
+	zassert_equal(last_frame.events[1].code, INPUT_ABS_Y);
+	zassert_equal(last_frame.events[1].value, 20);
+	zassert_equal(last_frame.events[2].code, INPUT_REL_WHEEL);
+	zassert_equal(last_frame.events[2].value, 3);
+	zassert_equal(last_frame.events[3].code, INPUT_BTN_TOUCH);
+	zassert_equal(last_frame.events[3].sync, 1);
+
+	/* events of other devices are not merged in the frame */
+	input_report_abs(NULL, INPUT_ABS_X, 1, true, K_FOREVER);
+	zassert_equal(frame_count, 1);
+}
+
+#endif /* CONFIG_INPUT_FRAMES */
+
 #endif /* CONFIG_INPUT_MODE_THREAD */
 
 ZTEST_SUITE(input_api, NULL, NULL, NULL, NULL, NULL);
@@ -183,6 +183,55 @@ ZTEST(test_pbuf, test_retcodes)
 	zassert_equal(pbuf_read(&pb2, read_buf, 10), 0);
 }
 
+/* Zero-copy read tests. */
+ZTEST(test_pbuf, test_claim)
+{
+	static const struct pbuf_cfg cfg = PBUF_CFG_INIT(memory_area, MEM_AREA_SZ, 0);
+
+	static struct pbuf pb = {
+		.cfg = &cfg,
+	};
+
+	uint8_t read_buf[MEM_AREA_SZ];
+	uint8_t write_buf[MEM_AREA_SZ];
+	const char *data;
+	uint16_t part;
+	int ret;
+
+	for (size_t i = 0; i < MEM_AREA_SZ; i++) {
+		write_buf[i] = i+1;
+	}
+
+	zassert_equal(pbuf_init(&pb), 0);
+
+	/* Claim from empty buffer. */
+	zassert_equal(pbuf_claim(&pb, &data, &part), 0);
+	zassert_equal(pbuf_free(&pb, MSGA_SZ), -EINVAL);
+
+	zassert_equal(pbuf_write(&pb, write_buf, MSGA_SZ), MSGA_SZ);
+
+	/* The message is read in place and stays until it is freed. */
+	ret = pbuf_claim(&pb, &data, &part);
+	zassert_equal(ret, MSGA_SZ);
+	zassert_equal(part, MSGA_SZ);
+	zassert_mem_equal(data, write_buf, MSGA_SZ);
+	zassert_equal(pbuf_claim(&pb, &data, &part), MSGA_SZ);
+	zassert_equal(pbuf_free(&pb, MSGB_SZ), -EINVAL);
+	zassert_equal(pbuf_free(&pb, MSGA_SZ), 0);
+	zassert_equal(pbuf_claim(&pb, &data, &part), 0);
+
+	/* A message wrapping around is returned in two parts. */
+	zassert_equal(pbuf_write(&pb, write_buf, MPS), MPS);
+	ret = pbuf_claim(&pb, &data, &part);
+	zassert_equal(ret, MPS);
+	zassert_true(part < MPS);
+	memcpy(read_buf, data, part);
+	memcpy(&read_buf[part], cfg.data_loc, MPS - part);
+	zassert_mem_equal(read_buf, write_buf, MPS);
+	zassert_equal(pbuf_free(&pb, MPS), 0);
+	zassert_equal(pbuf_read(&pb, NULL, 0), 0);
+}
+
 #define STRESS_LEN_MOD (44)
 #define STRESS_LEN_MIN (20)
 #define STRESS_LEN_MAX (STRESS_LEN_MIN + STRESS_LEN_MOD)
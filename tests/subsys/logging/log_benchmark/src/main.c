@@ -47,6 +47,9 @@ struct backend_cb {
 static void process(struct log_backend const *const backend,
 		    union log_msg_generic *msg)
 {
+	struct backend_cb *cb = (struct backend_cb *)backend->cb->ctx;
+
+	cb->counter++;
 }
 
 static void panic(struct log_backend const *const backend)
@@ -230,6 +233,43 @@ ZTEST(test_log_benchmark, test_log_message_with_string)
 		cyc / repeat, us / repeat);
 }
 
+/** Test how long it takes to process messages in deferred mode, including
+ * claiming them from the buffer and freeing them. Backend does nothing with
+ * the messages.
+ */
+ZTEST(test_log_benchmark, test_log_message_process_time)
+{
+	uint32_t total_cyc = 0;
+	uint32_t total_msg = 0;
+
+	log_backend_enable(&backend, &backend_ctrl_blk, LOG_LEVEL_DBG);
+
+	for (int i = 0; i < 8; i++) {
+		int _dummy = 0;
+
+		/* Fill the buffer. */
+		TEST_LOG_CAPACITY(2, _dummy, 0);
+		backend_ctrl_blk.counter = 0;
+
+		uint32_t cyc = test_helpers_cycle_get();
+
+		while (log_process()) {
+		}
+
+		total_cyc += test_helpers_cycle_get() - cyc;
+		total_msg += backend_ctrl_blk.counter;
+		zassert_true(backend_ctrl_blk.counter > 0);
+	}
+
+	log_backend_disable(&backend);
+
+	uint32_t total_us = k_cyc_to_us_ceil32(total_cyc);
+
+	PRINT("Average processing a message (batch size %d): %u cycles (%u us)\n",
+		CONFIG_LOG_PROCESS_BATCH_SIZE,
+		total_cyc / total_msg, total_us / total_msg);
+}
+
 /*test case main entry*/
 static void *log_benchmark_setup(void)
 {
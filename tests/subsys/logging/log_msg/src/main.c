@@ -535,6 +535,38 @@ ZTEST(log_msg, test_mode_size_str_with_2strings)
 	get_msg_validate_length(exp_len);
 }
 
+ZTEST(log_msg, test_mode_size_const_str)
+{
+	static const uint8_t domain = 3;
+	static const uint8_t level = 2;
+	const void *source = (const void *)123;
+	uint32_t exp_len;
+	int mode;
+	const char *prefix = "prefix";
+
+	/* Without any string pointer accepted upfront, a const char * is
+	 * only known to be read-only at compile time when configured so.
+	 */
+	Z_LOG_MSG_CREATE3(1, mode, 0, domain, source, level,
+			   NULL, 0, "test %s", prefix);
+	zassert_equal(mode, IS_ENABLED(CONFIG_LOG_MSG_CONST_CHAR_RO) ?
+			    EXP_MODE(ZERO_COPY) : EXP_MODE(FROM_STACK),
+			"Unexpected creation mode");
+
+	/* Calculate expected message length. Message consists of:
+	 * - header
+	 * - package: header + fmt pointer + pointer
+	 *
+	 * Message size is rounded up to the required alignment.
+	 */
+	exp_len = offsetof(struct log_msg, data) +
+			 /* package */sizeof(struct cbprintf_package_hdr_ext) +
+				      sizeof(const char *);
+	exp_len = ROUND_UP(exp_len, Z_LOG_MSG_ALIGNMENT) / sizeof(int);
+
+	get_msg_validate_length(exp_len);
+}
+
 static log_timestamp_t timestamp_get_inc(void)
 {
 	return timestamp++;
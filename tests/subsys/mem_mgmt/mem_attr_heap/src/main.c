@@ -142,4 +142,68 @@ ZTEST(mem_attr_heap, test_mem_attr_heap)
 	zassert_true(((uintptr_t) block % 64 == 0), "");
 }
 
+ZTEST(mem_attr_heap, test_mem_attr_heap_policy)
+{
+	const struct mem_attr_region_t *region;
+	struct sys_memory_stats stats, old_stats;
+	void *blocks[16];
+	void *block;
+	int n = 0;
+	int ret;
+
+	ret = mem_attr_heap_pool_init();
+	zassert_true((ret == 0) || (ret == -EALREADY), "Failed initialization");
+
+	/*
+	 * Fill up the DMA region.
+	 */
+	while ((block = mem_attr_heap_alloc(DT_MEM_SW_ALLOC_DMA, 0x200)) != NULL) {
+		zassert_true(n < ARRAY_SIZE(blocks), "Too many blocks allocated");
+		region = mem_attr_heap_get_region(block);
+		zassert_equal(region->dt_addr, ADDR_MEM_DMA_SW,
+			      "Memory allocated from the wrong region");
+		blocks[n++] = block;
+	}
+
+	/*
+	 * The exact policy is the default one.
+	 */
+	block = mem_attr_heap_policy_alloc(DT_MEM_SW_ALLOC_DMA, MEM_ATTR_HEAP_POLICY_EXACT,
+					   0, 0x200);
+	zassert_is_null(block, "Memory allocated from a full region");
+
+	/*
+	 * It spills over to the cacheable and DMA region.
+	 */
+	block = mem_attr_heap_policy_alloc(DT_MEM_SW_ALLOC_DMA, MEM_ATTR_HEAP_POLICY_SPILL,
+					   0, 0x200);
+	zassert_not_null(block, "Failed to allocate memory");
+	region = mem_attr_heap_get_region(block);
+	zassert_equal(region->dt_addr, ADDR_MEM_CACHE_DMA_SW,
+		      "Memory allocated from the wrong region");
+
+	/*
+	 * But never to a region without the requested attributes.
+	 */
+	zassert_is_null(mem_attr_heap_policy_alloc(DT_MEM_SW_ALLOC_DMA,
+						   MEM_ATTR_HEAP_POLICY_SPILL, 0, 0x1000),
+			"Memory allocated from the wrong region");
+
+	/*
+	 * Check the utilization of the region.
+	 */
+	zassert_ok(mem_attr_heap_region_stats_get(region, &old_stats));
+	mem_attr_heap_free(block);
+	zassert_ok(mem_attr_heap_region_stats_get(region, &stats));
+	zassert_true(stats.allocated_bytes + 0x200 <= old_stats.allocated_bytes,
+		     "Wrong allocated size");
+	zassert_equal(stats.allocated_bytes + stats.free_bytes,
+		      old_stats.allocated_bytes + old_stats.free_bytes,
+		      "Wrong region size");
+
+	while (n > 0) {
+		mem_attr_heap_free(blocks[--n]);
+	}
+}
+
 ZTEST_SUITE(mem_attr_heap, NULL, NULL, NULL, NULL, NULL);
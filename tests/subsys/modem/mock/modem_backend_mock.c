@@ -72,6 +72,20 @@ static int modem_backend_mock_receive(void *data, uint8_t *buf, size_t size)
 	return ring_buf_get(&mock->rx_rb, buf, size);
 }
 
+static int modem_backend_mock_receive_claim(void *data, uint8_t **buf)
+{
+	struct modem_backend_mock *mock = (struct modem_backend_mock *)data;
+
+	return ring_buf_get_claim(&mock->rx_rb, buf, mock->limit);
+}
+
+static int modem_backend_mock_receive_finish(void *data, size_t size)
+{
+	struct modem_backend_mock *mock = (struct modem_backend_mock *)data;
+
+	return ring_buf_get_finish(&mock->rx_rb, size);
+}
+
 static int modem_backend_mock_close(void *data)
 {
 	struct modem_backend_mock *mock = (struct modem_backend_mock *)data;
@@ -85,6 +99,8 @@ struct modem_pipe_api modem_backend_mock_api = {
 	.transmit = modem_backend_mock_transmit,
 	.receive = modem_backend_mock_receive,
 	.close = modem_backend_mock_close,
+	.receive_claim = modem_backend_mock_receive_claim,
+	.receive_finish = modem_backend_mock_receive_finish,
 };
 
 static void modem_backend_mock_receive_ready_handler(struct k_work *item)
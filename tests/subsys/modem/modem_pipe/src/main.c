@@ -397,5 +397,17 @@ ZTEST(modem_pipe, test_attach)
 	test_pipe_attach_receive_not_ready_transmit_idle();
 }
 
+ZTEST(modem_pipe, test_receive_claim_not_supported)
+{
+	uint8_t *buf;
+
+	test_pipe_open();
+	test_reset();
+	zassert_equal(modem_pipe_receive_claim(test_pipe, &buf), -ENOTSUP,
+		      "Claim should not be supported");
+	zassert_equal(modem_pipe_receive_finish(test_pipe, 0), -ENOTSUP,
+		      "Finish should not be supported");
+}
+
 ZTEST_SUITE(modem_pipe, NULL, modem_backend_fake_setup, modem_backend_fake_before,
 	    modem_backend_fake_after, NULL);
@@ -495,6 +495,35 @@ ZTEST(modem_ppp, test_ip_frame_send_large)
 		     "Incorrect data received");
 }
 
+ZTEST(modem_ppp, test_ip_frame_send_large_fcs)
+{
+	const uint8_t header[] = {0xFF, 0x03};
+	struct net_pkt *pkt;
+	size_t size;
+	uint16_t fcs;
+	int ret;
+
+	pkt = net_pkt_alloc_with_buffer(&test_iface, TEST_MODEM_PPP_IP_FRAME_SEND_LARGE_N,
+					AF_UNSPEC, 0, K_NO_WAIT);
+
+	net_pkt_cursor_init(pkt);
+	net_pkt_set_family(pkt, AF_INET);
+	size = test_modem_ppp_fill_net_pkt(pkt, TEST_MODEM_PPP_IP_FRAME_SEND_LARGE_N);
+	zassert_true(size == TEST_MODEM_PPP_IP_FRAME_SEND_LARGE_N, "Failed to fill net pkt");
+	test_net_send(pkt);
+	k_msleep(TEST_MODEM_PPP_IP_FRAME_SEND_LARGE_N * 2);
+
+	ret = modem_backend_mock_get(&mock, buffer, TEST_MODEM_PPP_MOCK_PIPE_RX_BUF_SIZE);
+	zassert_true(buffer[0] == 0x7E, "Missing start of frame");
+	zassert_true(buffer[ret - 1] == 0x7E, "Missing end of frame");
+
+	/* Unwrapped data is followed by the FCS, which must give the good FCS residue */
+	size = test_modem_ppp_unwrap(unwrapped_buffer, buffer, ret);
+	fcs = crc16_ccitt(0xFFFF, header, sizeof(header));
+	fcs = crc16_ccitt(fcs, unwrapped_buffer, size + 2);
+	zassert_true(fcs == 0xF0B8, "Incorrect FCS");
+}
+
 ZTEST(modem_ppp, test_ip_frame_receive_large)
 {
 	struct net_pkt *pkt;
@@ -300,6 +300,63 @@ ZTEST(device_runtime_api, test_pm_device_runtime_auto)
 	zassert_equal(pm_device_runtime_put(dev), 0, "");
 }
 
+#ifdef CONFIG_PM_DEVICE_RUNTIME_ASYNC
+static K_SEM_DEFINE(get_async_sem, 0, 1);
+static const struct device *get_async_dev;
+static int get_async_ret;
+
+static void get_async_cb(const struct device *dev, int ret, void *user_data)
+{
+	ARG_UNUSED(user_data);
+
+	get_async_dev = dev;
+	get_async_ret = ret;
+	k_sem_give(&get_async_sem);
+}
+
+ZTEST(device_runtime_api, test_api_get_async)
+{
+	const struct device *devs[] = {
+		test_dev,
+		DEVICE_DT_GET(DT_NODELABEL(test_dev)),
+	};
+	struct pm_device_runtime_async req;
+	enum pm_device_state state;
+	int ret;
+
+	/* usage: 0, +1, resume: yes */
+	ret = pm_device_runtime_get_async(test_dev, &req, get_async_cb, NULL);
+	zassert_equal(ret, 0);
+
+	ret = k_sem_take(&get_async_sem, K_MSEC(100));
+	zassert_equal(ret, 0);
+	zassert_equal(get_async_dev, test_dev);
+	zassert_equal(get_async_ret, 0);
+
+	(void)pm_device_state_get(test_dev, &state);
+	zassert_equal(state, PM_DEVICE_STATE_ACTIVE);
+
+	/* usage: 1, -1, suspend: yes */
+	ret = pm_device_runtime_put(test_dev);
+	zassert_equal(ret, 0);
+
+	/* resume both devices at once */
+	ret = pm_device_runtime_get_batch(devs, ARRAY_SIZE(devs));
+	zassert_equal(ret, 0);
+
+	(void)pm_device_state_get(test_dev, &state);
+	zassert_equal(state, PM_DEVICE_STATE_ACTIVE);
+
+	for (size_t i = 0; i < ARRAY_SIZE(devs); i++) {
+		ret = pm_device_runtime_put(devs[i]);
+		zassert_equal(ret, 0);
+	}
+
+	(void)pm_device_state_get(test_dev, &state);
+	zassert_equal(state, PM_DEVICE_STATE_SUSPENDED);
+}
+#endif /* CONFIG_PM_DEVICE_RUNTIME_ASYNC */
+
 void *device_runtime_api_setup(void)
 {
 	test_dev = device_get_binding("test_driver");
@@ -595,6 +595,38 @@ ZTEST(rtio_api, test_rtio_transaction)
 	}
 }
 
+/**
+ * @brief Test polling for completions
+ *
+ * Ensures that rtio_cqe_consume_spin() returns the completion of a request
+ * finished from an ISR, and gives up once the queue stays empty.
+ */
+ZTEST(rtio_api, test_rtio_consume_spin)
+{
+	int res;
+	uintptr_t userdata = 0;
+	struct rtio_sqe *sqe;
+	struct rtio_cqe *cqe;
+
+	for (int i = 0; i < TEST_REPEATS; i++) {
+		sqe = rtio_sqe_acquire(&r_simple);
+		zassert_not_null(sqe, "Expected a valid sqe");
+		rtio_sqe_prep_nop(sqe, (struct rtio_iodev *)&iodev_test_simple, &userdata);
+
+		res = rtio_submit(&r_simple, 0);
+		zassert_ok(res, "Should return ok from rtio_execute");
+
+		cqe = rtio_cqe_consume_spin(&r_simple, K_MSEC(500));
+		zassert_not_null(cqe, "Expected a valid cqe");
+		zassert_ok(cqe->result, "Result should be ok");
+		zassert_equal_ptr(cqe->userdata, &userdata, "Expected userdata back");
+		rtio_cqe_release(&r_simple, cqe);
+
+		cqe = rtio_cqe_consume_spin(&r_simple, K_USEC(100));
+		zassert_is_null(cqe, "Expected no cqe");
+	}
+}
+
 #define THROUGHPUT_ITERS 100000
 RTIO_DEFINE(r_throughput, SQE_POOL_SIZE, CQE_POOL_SIZE);
 
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/rtio/rtio.h>
+#include <zephyr/rtio/rtio_workq.h>
+
+#define WORKQ_REQS 6
+
+RTIO_DEFINE(r_workq, WORKQ_REQS, WORKQ_REQS);
+
+static atomic_t workq_running;
+static atomic_t workq_running_max;
+
+/* Blocking implementation, sleeping as a driver waiting for its bus would */
+static void workq_iodev_handler(struct rtio_iodev_sqe *iodev_sqe)
+{
+	atomic_val_t running = atomic_inc(&workq_running) + 1;
+	atomic_val_t max = atomic_get(&workq_running_max);
+
+	while ((running > max) && !atomic_cas(&workq_running_max, max, running)) {
+		max = atomic_get(&workq_running_max);
+	}
+
+	k_msleep(5);
+	atomic_dec(&workq_running);
+
+	rtio_iodev_sqe_ok(iodev_sqe, 0);
+}
+
+static void workq_iodev_submit(struct rtio_iodev_sqe *iodev_sqe)
+{
+	rtio_workq_submit(iodev_sqe, workq_iodev_handler);
+}
+
+static const struct rtio_iodev_api workq_iodev_api = {
+	.submit = workq_iodev_submit,
+};
+
+RTIO_IODEV_DEFINE(workq_iodev, &workq_iodev_api, NULL);
+
+ZTEST(rtio_workq, test_workq)
+{
+	uintptr_t userdata[WORKQ_REQS];
+	uint32_t seen = 0;
+	struct rtio_sqe *sqe;
+	struct rtio_cqe *cqe;
+
+	for (int i = 0; i < WORKQ_REQS; i++) {
+		userdata[i] = i;
+		sqe = rtio_sqe_acquire(&r_workq);
+		zassert_not_null(sqe, "Expected a valid sqe");
+		rtio_sqe_prep_nop(sqe, &workq_iodev, &userdata[i]);
+	}
+
+	/* The submitter does not block on the handlers */
+	zassert_ok(rtio_submit(&r_workq, 0));
+
+	for (int i = 0; i < WORKQ_REQS; i++) {
+		cqe = rtio_cqe_consume_block(&r_workq);
+		zassert_ok(cqe->result, "Result should be ok");
+		seen |= BIT(*(uintptr_t *)cqe->userdata);
+		rtio_cqe_release(&r_workq, cqe);
+	}
+
+	zassert_equal(seen, BIT_MASK(WORKQ_REQS), "Missing completions");
+	zassert_equal(rtio_workq_used_count_get(), 0, "Requests not released");
+	zassert_true(atomic_get(&workq_running_max) <= CONFIG_RTIO_WORKQ_THREADS,
+		     "More handlers than threads running concurrently");
+	zassert_true(atomic_get(&workq_running_max) == MIN(WORKQ_REQS, CONFIG_RTIO_WORKQ_THREADS),
+		     "Handlers not run concurrently");
+}
+
+ZTEST(rtio_workq, test_workq_chain)
+{
+	struct rtio_sqe *sqe;
+	struct rtio_cqe *cqe;
+
+	/* Chained submissions run one after the other */
+	atomic_set(&workq_running_max, 0);
+	for (int i = 0; i < 3; i++) {
+		sqe = rtio_sqe_acquire(&r_workq);
+		zassert_not_null(sqe, "Expected a valid sqe");
+		rtio_sqe_prep_nop(sqe, &workq_iodev, NULL);
+		if (i < 2) {
+			sqe->flags |= RTIO_SQE_CHAINED;
+		}
+	}
+
+	zassert_ok(rtio_submit(&r_workq, 3));
+
+	for (int i = 0; i < 3; i++) {
+		cqe = rtio_cqe_consume(&r_workq);
+		zassert_not_null(cqe, "Expected a valid cqe");
+		zassert_ok(cqe->result, "Result should be ok");
+		rtio_cqe_release(&r_workq, cqe);
+	}
+
+	zassert_equal(atomic_get(&workq_running_max), 1, "Chain not serialized");
+}
+
+ZTEST_SUITE(rtio_workq, NULL, NULL, NULL, NULL, NULL);
@@ -619,3 +619,54 @@ ZTEST(settings_functional, test_direct_loading_filter)
 	}
 	settings_deregister(&filtered_loader_settings);
 }
+
+static unsigned int save_many_loaded;
+static uint8_t save_many_vals[3];
+
+static int save_many_loader(const char *key, size_t len, settings_read_cb read_cb,
+			    void *cb_arg, void *param)
+{
+	uint8_t val;
+	int idx;
+
+	zassert_not_null(key, "Unexpected key");
+	zassert_equal(1, len);
+
+	idx = key[0] - '1';
+	zassert_true((idx >= 0) && (idx < ARRAY_SIZE(save_many_vals)),
+		     "Unexpected key: %s", key);
+
+	zassert_equal(sizeof(val), read_cb(cb_arg, &val, sizeof(val)));
+	save_many_vals[idx] = val;
+	save_many_loaded++;
+
+	return 0;
+}
+
+ZTEST(settings_functional, test_save_many)
+{
+	const uint8_t vals[] = {41, 42, 43, 44};
+	const struct settings_save_item items[] = {
+		{ .name = "many/1", .value = &vals[0], .val_len = 1 },
+		{ .name = "many/2", .value = &vals[1], .val_len = 1 },
+		{ .name = "many/3", .value = &vals[2], .val_len = 1 },
+		{ .name = "other/1", .value = &vals[3], .val_len = 1 },
+		{ .name = "many/2", .value = NULL, .val_len = 0 },
+	};
+	int rc;
+
+	settings_subsys_init();
+
+	rc = settings_save_many(items, ARRAY_SIZE(items));
+	zassert_equal(0, rc, "settings_save_many failed: %d", rc);
+
+	memset(save_many_vals, 0, sizeof(save_many_vals));
+	save_many_loaded = 0;
+	rc = settings_load_subtree_direct("many", save_many_loader, NULL);
+	zassert_equal(0, rc);
+
+	zassert_equal(2, save_many_loaded);
+	zassert_equal(41, save_many_vals[0]);
+	zassert_equal(0, save_many_vals[1]);
+	zassert_equal(43, save_many_vals[2]);
+}
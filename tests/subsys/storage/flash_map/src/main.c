@@ -190,4 +190,54 @@ ZTEST(flash_map, test_flash_area_erased_val)
 	flash_area_close(fa);
 }
 
+#ifdef CONFIG_FLASH_MAP_READ_CACHE
+ZTEST(flash_map, test_flash_area_read_cache)
+{
+	struct flash_area_cache_stats stats;
+	const struct flash_area *fa;
+	uint32_t sec_cnt = 1;
+	struct flash_sector sec;
+	uint8_t wd[16];
+	uint8_t rd[16];
+	uint8_t erased;
+	int rc;
+
+	rc = flash_area_open(SLOT1_PARTITION_ID, &fa);
+	zassert_true(rc == 0, "flash_area_open() fail");
+
+	rc = flash_area_get_sectors(SLOT1_PARTITION_ID, &sec_cnt, &sec);
+	zassert_true(rc == 0 || rc == -ENOMEM, "flash_area_get_sectors() fail");
+	zassert_ok(flash_area_erase(fa, 0, sec.fs_size));
+	erased = flash_area_erased_val(fa);
+
+	flash_area_cache_invalidate();
+	flash_area_cache_stats_get(&stats, true);
+
+	/* The first read loads the line, the second one hits it */
+	zassert_ok(flash_area_read(fa, 0, rd, sizeof(rd)));
+	zassert_ok(flash_area_read(fa, sizeof(rd), rd, sizeof(rd)));
+	for (int i = 0; i < sizeof(rd); i++) {
+		zassert_equal(rd[i], erased, "not erased");
+	}
+	flash_area_cache_stats_get(&stats, true);
+	zassert_equal(stats.misses, 1, "%u misses", stats.misses);
+	zassert_equal(stats.hits, 1, "%u hits", stats.hits);
+
+	/* Writes and erases are seen by the following reads */
+	(void)memset(wd, 0x5a, sizeof(wd));
+	zassert_ok(flash_area_write(fa, 0, wd, sizeof(wd)));
+	zassert_ok(flash_area_read(fa, 0, rd, sizeof(rd)));
+	zassert_mem_equal(rd, wd, sizeof(rd));
+
+	zassert_ok(flash_area_erase(fa, 0, sec.fs_size));
+	zassert_ok(flash_area_read(fa, 0, rd, sizeof(rd)));
+	for (int i = 0; i < sizeof(rd); i++) {
+		zassert_equal(rd[i], erased, "stale data after erase");
+	}
+
+	flash_area_cache_invalidate();
+	flash_area_close(fa);
+}
+#endif
+
 ZTEST_SUITE(flash_map, NULL, NULL, NULL, NULL, NULL);
@@ -643,6 +643,40 @@ ZTEST(lib_stream_flash, test_stream_flash_progress_clear)
 #endif
 }
 
+ZTEST(lib_stream_flash, test_stream_flash_background)
+{
+	int rc;
+	size_t chunk = BUF_LEN / 4;
+	size_t len = (page_size * 2) + chunk;
+
+	Z_TEST_SKIP_IFNDEF(CONFIG_STREAM_FLASH_BACKGROUND);
+
+	init_target();
+
+	rc = stream_flash_buffered_write(&ctx, write_buf, 1, false);
+	zassert_equal(rc, 0, "expected success");
+	rc = stream_flash_background_enable(&ctx);
+	zassert_equal(rc, -EINVAL, "should fail as the buffer is not empty");
+
+	init_target();
+
+	rc = stream_flash_background_enable(&ctx);
+	zassert_equal(rc, 0, "expected success");
+	zassert_equal(ctx.buf_len, BUF_LEN / 2, "buffer should be split");
+
+	for (size_t off = 0; off < len; off += chunk) {
+		rc = stream_flash_buffered_write(&ctx, write_buf, chunk, false);
+		zassert_equal(rc, 0, "expected success");
+	}
+
+	rc = stream_flash_buffered_write(&ctx, write_buf, 0, true);
+	zassert_equal(rc, 0, "expected success");
+	zassert_equal(stream_flash_bytes_written(&ctx), len,
+		      "all bytes should be written after a flush");
+
+	VERIFY_WRITTEN(0, len);
+}
+
 void lib_stream_flash_before(void *data)
 {
 	zassume_true(device_is_ready(fdev), "Device is not ready");
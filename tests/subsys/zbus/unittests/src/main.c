@@ -8,6 +8,7 @@
 #include <zephyr/irq_offload.h>
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
+#include <zephyr/net/buf.h>
 #include <zephyr/zbus/zbus.h>
 #include <zephyr/ztest.h>
 LOG_MODULE_DECLARE(zbus, CONFIG_ZBUS_LOG_LEVEL);
@@ -356,11 +357,14 @@ ZTEST(basic, test_specification_based__zbus_chan)
 
 	zbus_obs_set_enable(&foo_msg_sub, true);
 	zbus_obs_set_enable(&foo2_msg_sub, true);
+	zassert_equal(0, zbus_chan_notify(&msg_sub_no_pool_chan, K_MSEC(200)),
+		      "The pool has 2 slots, one per MSG_SUBSCRIBER is enough.");
 	zassert_equal(-ENOMEM, zbus_chan_notify(&msg_sub_no_pool_chan, K_MSEC(200)),
-		      "It must return an error, the pool only have 2 slots. For publishing to "
-		      "MSG_SUBSCRIBERS it is necessary at least one per each and a spare one.");
+		      "It must return an error, the pool only have 2 slots, both held by the "
+		      "MSG_SUBSCRIBERS of the previous publication.");
 
 	zassert_equal(0, zbus_sub_wait_msg(&foo_msg_sub, &chan, &msg, K_MSEC(500)), NULL);
+	zassert_equal(0, zbus_sub_wait_msg(&foo2_msg_sub, &chan, &msg, K_MSEC(500)), NULL);
 	zbus_obs_set_enable(&foo_msg_sub, false);
 	zbus_obs_set_enable(&foo2_msg_sub, false);
 }
@@ -597,6 +601,61 @@ ZTEST(basic, test_hard_channel)
 	zassert_equal(err, -ENOMSG, "Err must be -ENOMSG, the channel message is invalid");
 }
 
+ZTEST(basic, test_chan_loan)
+{
+	struct version_msg *loaned;
+	struct version_msg current;
+	const struct zbus_channel *chan;
+	struct net_buf *buf;
+
+	zassert_equal(-ENOTSUP, zbus_chan_loan(&hard_chan, (void **)&loaned, K_NO_WAIT),
+		      "Channels with a validator cannot be loaned");
+
+	zassert_equal(0, zbus_chan_add_obs(&version_chan, &foo_msg_sub, K_MSEC(200)), NULL);
+	zbus_obs_set_enable(&foo_msg_sub, true);
+
+	zassert_equal(0, zbus_chan_loan(&version_chan, (void **)&loaned, K_NO_WAIT), NULL);
+	zassert_equal(-EBUSY, zbus_chan_read(&version_chan, &current, K_NO_WAIT),
+		      "The channel must be locked until the loan is published");
+	loaned->build = 2048;
+	zassert_equal(0, zbus_chan_loan_pub(&version_chan, K_NO_WAIT), NULL);
+
+	zassert_equal(0, zbus_chan_read(&version_chan, &current, K_NO_WAIT), NULL);
+	zassert_equal(2048, current.build, "The message must be published in place");
+
+	/* Message subscribers get the published buffer */
+	zassert_equal(0, zbus_sub_wait_msg_buf(&foo_msg_sub, &chan, &buf, K_MSEC(500)), NULL);
+	zassert_equal_ptr(&version_chan, chan, NULL);
+	zassert_equal(sizeof(struct version_msg), buf->len, NULL);
+	zassert_equal(2048, ((struct version_msg *)buf->data)->build, NULL);
+	net_buf_unref(buf);
+
+	zbus_obs_set_enable(&foo_msg_sub, false);
+	zassert_equal(0, zbus_chan_rm_obs(&version_chan, &foo_msg_sub, K_MSEC(200)), NULL);
+
+	current.build = 1023;
+	zassert_equal(0, zbus_chan_pub(&version_chan, &current, K_NO_WAIT), NULL);
+}
+
+ZTEST(basic, test_chan_read_lockfree)
+{
+	Z_TEST_SKIP_IFNDEF(CONFIG_ZBUS_CHANNEL_SEQLOCK);
+
+#if defined(CONFIG_ZBUS_CHANNEL_SEQLOCK)
+	struct version_msg current;
+
+	zassert_equal(0, zbus_chan_read_lockfree(&version_chan, &current, K_NO_WAIT), NULL);
+	zassert_equal(1023, current.build, NULL);
+
+	/* A pending write makes the reader fall back to the channel semaphore */
+	zassert_equal(0, zbus_chan_claim(&version_chan, K_NO_WAIT), NULL);
+	zassert_equal(-EBUSY, zbus_chan_read_lockfree(&version_chan, &current, K_NO_WAIT), NULL);
+	zassert_equal(0, zbus_chan_finish(&version_chan), NULL);
+
+	zassert_equal(0, zbus_chan_read_lockfree(&version_chan, &current, K_NO_WAIT), NULL);
+#endif /* CONFIG_ZBUS_CHANNEL_SEQLOCK */
+}
+
 ZTEST(basic, test_specification_based__zbus_obs_set_enable)
 {
 	bool enable;
@@ -50,6 +50,29 @@ ZTEST(crc, test_crc32_ieee)
 	zassert_equal(crc32_ieee(test3, sizeof(test3)), 0x20089AA4);
 }
 
+ZTEST(crc, test_crc32_long)
+{
+	static uint8_t buf[1000];
+
+	for (size_t i = 0; i < sizeof(buf); i++) {
+		buf[i] = (uint8_t)(i * 7 + 3);
+	}
+
+	/* Long enough for word and block sized steps, in pieces which are
+	 * neither of those sizes nor aligned to them.
+	 */
+	zassert_equal(crc32_ieee(buf, sizeof(buf)), 0x17BC2A46);
+	zassert_equal(crc32_ieee_update(crc32_ieee_update(0, buf, 333),
+					buf + 333, sizeof(buf) - 333),
+		      0x17BC2A46);
+
+	zassert_equal(crc32_c(0, buf + 1, sizeof(buf) - 1, true, true),
+		      0xC8AA8EFB);
+	zassert_equal(crc32_c(crc32_c(0, buf + 1, 500, true, false),
+			      buf + 501, sizeof(buf) - 501, false, true),
+		      0xC8AA8EFB);
+}
+
 ZTEST(crc, test_crc16)
 {
 	uint8_t test[] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
@@ -277,4 +277,154 @@ ZTEST(rbtree_api, test_rb_get_minmax)
 	zassert_true(rb_get_max(&test_rbtree) == &nodes[7], "the tree is invalid");
 }
 
+/**
+ * @brief Test bounded searches.
+ *
+ * @details Insert the even nodes, then look up the nodes around
+ * every node of the array, in the tree or not.
+ *
+ * @ingroup lib_rbtree_tests
+ *
+ * @see rb_find_ge(), rb_find_le()
+ */
+ZTEST(rbtree_api, test_rb_find_ge_le)
+{
+	(void)memset(&test_rbtree, 0, sizeof(test_rbtree));
+	test_rbtree.lessthan_fn = node_lessthan;
+	(void)memset(nodes, 0, sizeof(nodes));
+
+	zassert_is_null(rb_find_ge(&test_rbtree, &nodes[0]));
+	zassert_is_null(rb_find_le(&test_rbtree, &nodes[0]));
+
+	for (int i = 2; i < MAX_NODES - 1; i += 2) {
+		rb_insert(&test_rbtree, &nodes[i]);
+	}
+
+	for (int i = 0; i < MAX_NODES; i++) {
+		int ge = ROUND_UP(MAX(i, 2), 2);
+		int le = ROUND_DOWN(MIN(i, MAX_NODES - 2), 2);
+
+		zassert_equal_ptr(rb_find_ge(&test_rbtree, &nodes[i]),
+				  (ge < MAX_NODES - 1) ? &nodes[ge] : NULL,
+				  "wrong node >= %d", i);
+		zassert_equal_ptr(rb_find_le(&test_rbtree, &nodes[i]),
+				  (le >= 2) ? &nodes[le] : NULL,
+				  "wrong node <= %d", i);
+	}
+}
+
+/* Nodes of an order statistics tree: each one knows the size of its
+ * subtree.
+ */
+struct size_node {
+	struct rbnode node;
+	int size;
+};
+
+static struct size_node size_nodes[MAX_NODES];
+
+static int subtree_size(struct rbnode *n)
+{
+	return (n != NULL) ? CONTAINER_OF(n, struct size_node, node)->size : 0;
+}
+
+static void size_augment(struct rbnode *n, struct rbnode *left,
+			 struct rbnode *right)
+{
+	CONTAINER_OF(n, struct size_node, node)->size =
+		1 + subtree_size(left) + subtree_size(right);
+}
+
+static bool size_lessthan(struct rbnode *a, struct rbnode *b)
+{
+	return a < b;
+}
+
+/* Checks the size of every subtree, returns the size of this one */
+static int check_size(struct rbnode *n)
+{
+	int size;
+
+	if (n == NULL) {
+		return 0;
+	}
+
+	size = 1 + check_size(rb_node_left(n)) + check_size(rb_node_right(n));
+	_CHECK(subtree_size(n) == size);
+
+	return size;
+}
+
+/* Returns the node of the given rank, in O(log2(N)) */
+static struct rbnode *select_rank(struct rbtree *tree, int rank)
+{
+	struct rbnode *n = tree->root;
+
+	while (n != NULL) {
+		int left = subtree_size(rb_node_left(n));
+
+		if (rank == left) {
+			break;
+		} else if (rank < left) {
+			n = rb_node_left(n);
+		} else {
+			rank -= left + 1;
+			n = rb_node_right(n);
+		}
+	}
+
+	return n;
+}
+
+/**
+ * @brief Test an augmented tree.
+ *
+ * @details Randomly insert and remove nodes of an order statistics
+ * tree, checking the size of all subtrees and the rank of all nodes
+ * after each operation.
+ *
+ * @ingroup lib_rbtree_tests
+ *
+ * @see rb_insert(), rb_remove()
+ */
+ZTEST(rbtree_api, test_rbtree_augmented)
+{
+	struct rbtree tree = {
+		.lessthan_fn = size_lessthan,
+		.augment_fn = size_augment,
+	};
+	int count = 0;
+
+	(void)memset(size_nodes, 0, sizeof(size_nodes));
+	(void)memset(node_mask, 0, sizeof(node_mask));
+
+	for (int i = 0; i < 4 * MAX_NODES; i++) {
+		int node = next_rand_mod(MAX_NODES / 4);
+		int rank = 0;
+
+		if (!get_node_mask(node)) {
+			rb_insert(&tree, &size_nodes[node].node);
+			set_node_mask(node, 1);
+			count++;
+		} else {
+			rb_remove(&tree, &size_nodes[node].node);
+			set_node_mask(node, 0);
+			count--;
+		}
+
+		zassert_equal(check_size(tree.root), count);
+
+		for (int j = 0; j < MAX_NODES; j++) {
+			if (get_node_mask(j)) {
+				zassert_equal_ptr(select_rank(&tree, rank),
+						  &size_nodes[j].node,
+						  "wrong node of rank %d", rank);
+				rank++;
+			}
+		}
+
+		zassert_is_null(select_rank(&tree, count));
+	}
+}
+
 ZTEST_SUITE(rbtree_api, NULL, NULL, NULL, NULL, NULL);